@@ -60,5 +60,6 @@
 #define SDRAM_HEAP_SIZE             0x600000
 
 void _LCD_Init(void);
+uint8_t _LCD_SetRefreshMode(gui_refresh_mode_t mode);
 
 #endif /* __LCD_DISCOVERY */
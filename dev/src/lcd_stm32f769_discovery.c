@@ -38,6 +38,9 @@ uint8_t pSyncLeft[]   = {0x02, 0x15};             /* Scan @ 533 */
 static int32_t active_area = INVALID_AREA;
 int8_t pending_buffer = -1;
 
+static volatile uint8_t refresh_idle;       /* Set to 1 to stop refresh after frame without layer change */
+static volatile uint8_t refresh_stopped;    /* Set to 1 when panel shows image from its own frame memory */
+
 gui_layer_t* currentLayer;
 
 #if 0
@@ -390,13 +393,40 @@ void HAL_DSI_EndOfRefreshCallback(DSI_HandleTypeDef *hdsi) {
             __HAL_DSI_WRAPPER_ENABLE(hdsi);
             HAL_DSI_LongWrite(hdsi, 0, DSI_DCS_LONG_PKT_WRITE, 4, OTM8009A_CMD_CASET, pColLeft);
             
-            /* Start new refresh */
-            HAL_DSI_LongWrite(hdsi, 0, DSI_DCS_LONG_PKT_WRITE, 2, OTM8009A_CMD_WRTESCN, pSyncLeft); 
+            if (refresh_idle && i == GUI_LAYERS) {
+                /* Nothing changed, panel keeps image in its frame memory and LTDC stops reading SDRAM */
+                refresh_stopped = 1;
+            } else {
+                /* Start new refresh */
+                HAL_DSI_LongWrite(hdsi, 0, DSI_DCS_LONG_PKT_WRITE, 2, OTM8009A_CMD_WRTESCN, pSyncLeft); 
+            }
         }
     }
     active_area = (active_area == LEFT_AREA) ? RIGHT_AREA : LEFT_AREA; 
 }
 
+/**
+  * @brief  Set refresh mode of display
+  * @note   In idle mode DSI refresh is stopped after current frame and panel refreshes itself from its frame memory
+  * @param  mode: Member of @ref gui_refresh_mode_t enumeration
+  * @retval 1 on success, 0 otherwise
+  */
+uint8_t
+_LCD_SetRefreshMode(gui_refresh_mode_t mode) {
+    if (mode == GUI_REFRESH_MODE_IDLE) {
+        refresh_idle = 1;                       /* Refresh stops in end of refresh callback */
+    } else {
+        HAL_NVIC_DisableIRQ(DSI_IRQn);          /* Do not race with end of refresh callback */
+        refresh_idle = 0;
+        if (refresh_stopped) {                  /* Start refresh again on next tearing effect */
+            refresh_stopped = 0;
+            HAL_DSI_LongWrite(&hdsi, 0, DSI_DCS_LONG_PKT_WRITE, 2, OTM8009A_CMD_WRTESCN, pSyncLeft);
+        }
+        HAL_NVIC_EnableIRQ(DSI_IRQn);
+    }
+    return 1;
+}
+
 /**
   * @brief  DCS or Generic short/long write command
   * @param  NbrParams: Number of parameters. It indicates the write command mode:
@@ -128,6 +128,12 @@ void _LCD_Init(void) {
     HAL_LTDC_ProgramLineEvent(&LTDCHandle, 0);
 }
 
+/* Set refresh mode, pixel clock is halved while idle to reduce SDRAM reads of LTDC */
+uint8_t _LCD_SetRefreshMode(gui_refresh_mode_t mode) {
+    __HAL_RCC_PLLSAI_PLLSAICLKDIVR_CONFIG(mode == GUI_REFRESH_MODE_IDLE ? RCC_PLLSAIDIVR_8 : RCC_PLLSAIDIVR_4);
+    return 1;
+}
+
 /* IRQ callback for line event */
 void HAL_LTDC_LineEvenCallback(LTDC_HandleTypeDef *hltdc) {
     uint8_t i = 0;
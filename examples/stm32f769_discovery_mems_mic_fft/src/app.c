@@ -34,9 +34,6 @@ static void led_init(void);
 #define LED3_PORT           GPIOA
 #define LED3_PIN            GPIO_PIN_12
 
-uint8_t DmaRecHalfBuffCplt;
-uint8_t DmaRecBuffCplt;
-
 typedef struct {
     uint32_t freq_start;                        /*!< Start frequency in units of Hertz */
     uint32_t freq_end;                          /*!< End frequency in units of Hertz */
@@ -81,6 +78,17 @@ freq_bands[] = {
  */
 int32_t     audio_raw_buff[2 * AUDIO_BUFF_SIZE];
 
+/**
+ * Half of raw buffer filled by DMA and ready to be processed, set from DMA interrupts.
+ * DMA fills other half meanwhile, processing must finish before it is complete.
+ */
+int32_t* volatile audio_ready;
+
+/**
+ * Number of filled halves not processed in time
+ */
+volatile uint32_t audio_overrun;
+
 /**
  * FFT size is the same as audio buffer size.
  * We have to process all input elements
@@ -111,6 +119,17 @@ float32_t   audio_buff_fft_out[FFT_SIZE];
  */
 float32_t   audio_buff_fft_out_real[FFT_SIZE / 2];
 
+/**
+ * Magnitude shown at top of graph
+ */
+#define FFT_GRAPH_MAX                           1000.0f
+
+/**
+ * Graph values for next frame, filled while graph draws from its current buffer.
+ * Buffers are swapped after each frame, graph data buffer allocated on create is used as second one
+ */
+int16_t     graph_buff[FFT_SIZE / 2];
+
 /**
  * \brief           Real-FFT instance
  */
@@ -149,10 +168,8 @@ user_thread(void const * arg) {
     gui_handle_p h, h_text;
     gui_graph_data_p d;
     size_t i, j;
-    int32_t* psrc = NULL;
-    uint32_t update = 0;
-    float32_t max_value;
-    uint32_t max_index;
+    int32_t* psrc;
+    int16_t* graph_next = graph_buff;
     
     h = gui_graph_create(GUI_ID_GRAPH_FFT, 10, 10, 780, 400, NULL, gui_graph_callback, 0);
     d = gui_graph_data_create(0, GUI_GRAPH_TYPE_YT, (FFT_SIZE / 2));
@@ -162,7 +179,7 @@ user_thread(void const * arg) {
     gui_graph_setminy(h, 0);
     
     gui_graph_setmaxx(h, (FFT_SIZE / 2) - 1);
-    gui_graph_setmaxy(h, 1000);
+    gui_graph_setmaxy(h, 32767);                /* Magnitude of FFT_GRAPH_MAX in Q15 format */
     gui_graph_zoomreset(h);
     
     gui_graph_data_setcolor(d, GUI_COLOR_BLUE);
@@ -174,6 +191,9 @@ user_thread(void const * arg) {
     
     /* Prepare biquad cascade filter, for DC voltage remove */
     arm_biquad_cascade_df1_init_f32(&iir_filt, 1, iir_filt_coeffs, iir_filt_states);
+    
+    /* Tables for Real-FFT are prepared once */
+    arm_rfft_fast_init_f32(&rfft_f32, FFT_SIZE);
 
     /* Start DFSDM data reception */
     HAL_DFSDM_FilterRegularStart_DMA(&hdfsdm1_filter0, (int32_t *)audio_raw_buff, 2 * AUDIO_BUFF_SIZE);
@@ -185,87 +205,58 @@ user_thread(void const * arg) {
     }
     
     while (1) {
-        /*
-         * If half-transfer complete DMA is ready, 
-         * process first part of buffer
-         */
-        if (DmaRecHalfBuffCplt) {               /* DFSDM half-complete check */
-            DmaRecHalfBuffCplt = 0; 
-            psrc = &audio_raw_buff[0];
-        }
+        /* Take half of buffer completed by DMA */
+        __disable_irq();
+        psrc = audio_ready;
+        audio_ready = NULL;
+        __enable_irq();
         
-        /*
-         * If transfer complete DMA is ready, 
-         * process second part of buffer
-         */
-        if (DmaRecBuffCplt) {                   /* DFSDM transfer-complete check */
-            DmaRecBuffCplt = 0;
-            psrc = &audio_raw_buff[AUDIO_BUFF_SIZE];
-        }
-
-        /* Anything to process? */
         if (psrc != NULL) {                     /* Check if anything to process */
-            /* Do the post processing, shift data down 8-bits */
-            for (i = 0; i < ARR_SIZE(audio_buff_fft_in); i++) {
-                audio_buff_fft_in[i] = (float32_t)(psrc[i] >> 16);
-            }
+            /*
+             * Convert samples to float directly from DMA buffer.
+             * Samples are left aligned in 32-bit words, Q31 conversion keeps them in range [-1, 1).
+             * Processing is linear, scale of 16-bit samples is applied once to magnitudes below
+             */
+            arm_q31_to_float(psrc, audio_buff_fft_in, FFT_SIZE);
             
             /* Process with high-pass filter to remove DC voltage */
             /* Set the same buffer as input and output */
-            arm_biquad_cascade_df1_f32(&iir_filt, audio_buff_fft_in, audio_buff_fft_in, ARR_SIZE(audio_buff_fft_in));
+            arm_biquad_cascade_df1_f32(&iir_filt, audio_buff_fft_in, audio_buff_fft_in, FFT_SIZE);
             
-            /* Check if UART is free to send new data */
-            if (++update) {
-                float32_t scale;
-                update = 0;
-                
-                /* Process with Real-FFT */
-                arm_rfft_fast_init_f32(&rfft_f32, FFT_SIZE);
-                arm_rfft_fast_f32(&rfft_f32, audio_buff_fft_in, audio_buff_fft_out, 0);
-                arm_cmplx_mag_f32(audio_buff_fft_out, audio_buff_fft_out_real, ARR_SIZE(audio_buff_fft_out_real));  /* Calculate absolute value from real-cplx pairs */               
-                
-                /* Normalize FFT result back to normal */
-                for (i = 0; i < ARR_SIZE(audio_buff_fft_out_real); i++) {
-                    audio_buff_fft_out_real[i] /= FFT_SIZE;
+            /* Process with Real-FFT and calculate absolute value from real-cplx pairs */
+            arm_rfft_fast_f32(&rfft_f32, audio_buff_fft_in, audio_buff_fft_out, 0);
+            arm_cmplx_mag_f32(audio_buff_fft_out, audio_buff_fft_out_real, ARR_SIZE(audio_buff_fft_out_real));
+            
+            /* Normalize FFT result back to 16-bit sample units */
+            arm_scale_f32(audio_buff_fft_out_real, 32768.0f / (float32_t)FFT_SIZE, audio_buff_fft_out_real, ARR_SIZE(audio_buff_fft_out_real));
+            
+            /*
+             * Convert magnitudes to graph values in second buffer and hand it to graph.
+             * Graph does not copy values, buffer previously used by graph is filled on next frame
+             */
+            arm_scale_f32(audio_buff_fft_out_real, 1.0f / FFT_GRAPH_MAX, audio_buff_fft_in, ARR_SIZE(audio_buff_fft_out_real));    /* FFT input is free after transform */
+            arm_float_to_q15(audio_buff_fft_in, graph_next, ARR_SIZE(audio_buff_fft_out_real));
+            gui_graph_data_swapbuffer(d, graph_next, ARR_SIZE(audio_buff_fft_out_real), &graph_next);
+            
+            /* Calculate sum values */
+            processed_count++;                  /* Increase processed count used for averaging */
+            processed_count_divider = processed_count > 5 ? 5 : processed_count;
+            for (j = 0; j < ARR_SIZE(freq_bands); j++) {
+                freq_bands[j].sum = 0;
+                for (i = freq_bands[j].freq_start_index; i < freq_bands[j].freq_end_index && i < ARR_SIZE(audio_buff_fft_out_real); i++) {
+                    freq_bands[j].sum += audio_buff_fft_out_real[i];
                 }
                 
-//                /* Calculate max value and scale */
-//                arm_max_f32(audio_buff_fft_out_real, ARR_SIZE(audio_buff_fft_out_real), &max_value, &max_index);
-//                scale = 32767.0f / max_value;
-//                
-//                /* Add data to plot */
-//                for (i = 0; i < ARR_SIZE(audio_buff_fft_out_real); i++) {
-//                    //gui_graph_data_addvalue(d, 0, (int16_t)(audio_buff_fft_out_real[i] * scale));
-//                }
-//                
-//                /* Set maximal graph value */
-//                gui_graph_setmaxy(h, max_value * scale);
-//                gui_graph_zoomreset(h);         /* Reset zoom to default */
-//                gui_widget_invalidate(h);
-                
-                /* Calculate sum values */
-                processed_count++;              /* Increase processed count used for averaging */
-                processed_count_divider = processed_count > 5 ? 5 : processed_count;
-                for (j = 0; j < ARR_SIZE(freq_bands); j++) {
-                    freq_bands[j].sum = 0;
-                    for (i = 0; i < ARR_SIZE(audio_buff_fft_out_real); i++) {
-                        if (i >= freq_bands[j].freq_start_index && i < freq_bands[j].freq_end_index) {
-                            freq_bands[j].sum += audio_buff_fft_out_real[i];
-                        }
-                    }
-                    
-                    /* Calculate new average value */
-                    freq_bands[j].average = (freq_bands[j].average * ((float)(processed_count_divider) - 1.0f) + freq_bands[j].sum * 1.01f) / ((float)processed_count_divider);
-                
-                    /* Decide to turn on/off LED */
-                    if (freq_bands[j].sum > freq_bands[j].average) {
-                        freq_bands[j].gpio->BSRR = freq_bands[j].pin;
-                    } else {
-                        freq_bands[j].gpio->BSRR = freq_bands[j].pin << 16;
-                    }
+                /* Calculate new average value */
+                freq_bands[j].average = (freq_bands[j].average * ((float)(processed_count_divider) - 1.0f) + freq_bands[j].sum * 1.01f) / ((float)processed_count_divider);
+            
+                /* Decide to turn on/off LED */
+                if (freq_bands[j].sum > freq_bands[j].average) {
+                    freq_bands[j].gpio->BSRR = freq_bands[j].pin;
+                } else {
+                    freq_bands[j].gpio->BSRR = freq_bands[j].pin << 16;
                 }
             }
-            psrc = NULL;                        /* Clear pbuf once not used anymore */
         }
         osDelay(1);
     }
@@ -273,12 +264,18 @@ user_thread(void const * arg) {
 
 void
 HAL_DFSDM_FilterRegConvHalfCpltCallback(DFSDM_Filter_HandleTypeDef *hdfsdm_filter) {
-    DmaRecHalfBuffCplt = 1;
+    if (audio_ready != NULL) {
+        audio_overrun++;                        /* Previous half was not processed */
+    }
+    audio_ready = &audio_raw_buff[0];
 }
 
 void
 HAL_DFSDM_FilterRegConvCpltCallback(DFSDM_Filter_HandleTypeDef *hdfsdm_filter) {
-    DmaRecBuffCplt = 1;
+    if (audio_ready != NULL) {
+        audio_overrun++;                        /* Previous half was not processed */
+    }
+    audio_ready = &audio_raw_buff[AUDIO_BUFF_SIZE];
 }
 
 /* DFSDM1 init function */
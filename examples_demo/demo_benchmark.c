@@ -0,0 +1,333 @@
+#include "demo.h"
+#include "gui/gui_mem.h"
+#include "system/gui_sys.h"
+#include "system/gui_ll_ram.h"
+#include <stdio.h>
+
+/*
+ * Headless benchmark suite
+ *
+ * Runs fixed number of frames per scene and prints frame rate, pixel
+ * throughput and memory usage. Link with headless RAM driver (gui_ll_ram.c)
+ * and call \ref demo_benchmark_run instead of starting GUI thread,
+ * as benchmark calls gui_process itself.
+ *
+ * Pixel counters are available when GUI_CFG_USE_LL_STATS is enabled.
+ * Frame rate limiting (GUI_CFG_FRAME_RATE) should be disabled.
+ *
+ * After each scene, frame built from incremental redraws is compared
+ * against forced full redraw of the same scene, any difference is
+ * reported as redraw error.
+ */
+
+#define BENCH_FRAMES                        100
+#define BENCH_SETTLE                        50
+
+/**
+ * \brief           Benchmark scene
+ */
+typedef struct {
+    const char* name;                       /*!< Scene name */
+    void (*setup)(gui_handle_p parent);     /*!< Create widgets on full-screen parent */
+    void (*step)(uint32_t frame);           /*!< Modify scene before each frame */
+} bench_scene_t;
+
+static gui_handle_p bench_h;                /* Main widget of active scene */
+static gui_graph_data_p bench_data;         /* Graph data of graph scene */
+static gui_handle_p bench_leds[48];         /* LEDs of LED scene */
+
+#if GUI_CFG_USE_TOUCH
+
+/**
+ * \brief           Click on absolute screen position
+ */
+static void
+bench_click(gui_dim_t x, gui_dim_t y) {
+    gui_touch_data_t ts = {0};
+
+    ts.count = 1;
+    ts.x[0] = x;
+    ts.y[0] = y;
+    ts.status = GUI_TOUCH_STATE_PRESSED;
+    gui_input_touchadd(&ts);
+    ts.count = 0;
+    ts.status = GUI_TOUCH_STATE_RELEASED;
+    gui_input_touchadd(&ts);
+}
+
+#endif /* GUI_CFG_USE_TOUCH */
+
+/* Full-screen redraw */
+static void
+fullscreen_setup(gui_handle_p parent) {
+    size_t i;
+
+    for (i = 0; i < 12; i++) {
+        gui_handle_p h = gui_button_create(0, 10 + (i % 4) * 195, 10 + (i / 4) * 155, 185, 145, parent, NULL, 0);
+        gui_widget_settext(h, _GT("Benchmark"));
+    }
+    bench_h = parent;
+}
+
+static void
+fullscreen_step(uint32_t frame) {
+    GUI_UNUSED(frame);
+    gui_widget_invalidate(bench_h);
+}
+
+/* Text-heavy listview scroll, listview keeps pointers to item strings */
+static gui_char listview_text[200][4][20];
+
+static void
+listview_setup(gui_handle_p parent) {
+    gui_listview_row_p row;
+    size_t i, c;
+
+    bench_h = gui_listview_create(0, 0, 0, 800, 480, parent, NULL, 0);
+    for (c = 0; c < 4; c++) {
+        gui_listview_addcolumn(bench_h, _GT("Column"), 190);
+    }
+    for (i = 0; i < GUI_COUNT_OF(listview_text); i++) {
+        row = gui_listview_addrow(bench_h);
+        for (c = 0; c < 4; c++) {
+            sprintf((char *)listview_text[i][c], "Row %u, column %u", (unsigned)i, (unsigned)c);
+            gui_listview_setitemstring(bench_h, row, (uint16_t)c, listview_text[i][c]);
+        }
+    }
+}
+
+static void
+listview_step(uint32_t frame) {
+    gui_listview_scroll(bench_h, (frame % 100) < 50 ? 1 : -1);
+}
+
+/* Graph with many points */
+static void
+graph_setup(gui_handle_p parent, size_t points) {
+    gui_graph_data_p data;
+    size_t i;
+
+    bench_h = gui_graph_create(0, 0, 0, 800, 480, parent, NULL, 0);
+    gui_graph_setaxes(bench_h, 0, (float)points, -100, 100);
+    gui_graph_zoomreset(bench_h);
+    data = gui_graph_data_create(0, GUI_GRAPH_TYPE_YT, points);
+    gui_graph_data_setcolor(data, GUI_COLOR_GREEN);
+    for (i = 0; i < points; i++) {
+        gui_graph_data_addvalue(data, 0, (int16_t)((i * 37) % 200) - 100);
+    }
+    gui_graph_attachdata(bench_h, data);
+    bench_data = data;
+}
+
+static void
+graph1k_setup(gui_handle_p parent) {
+    graph_setup(parent, 1000);
+}
+
+static void
+graph10k_setup(gui_handle_p parent) {
+    graph_setup(parent, 10000);
+}
+
+static void
+graph_step(uint32_t frame) {
+    gui_graph_data_addvalue(bench_data, 0, (int16_t)((frame * 37) % 200) - 100);
+}
+
+/* Window with alpha dragged over other widgets */
+static void
+alpha_setup(gui_handle_p parent) {
+    fullscreen_setup(parent);
+    bench_h = gui_window_create(0, 0, 100, 300, 200, parent, NULL, 0);
+    gui_widget_setalpha(bench_h, 0xA0);
+}
+
+static void
+alpha_step(uint32_t frame) {
+    gui_widget_setposition(bench_h, (gui_dim_t)((frame * 5) % 500), 100);
+}
+
+/* Sprite cached LEDs toggled inside transparent container */
+static void
+led_setup(gui_handle_p parent) {
+    size_t i;
+
+    bench_h = gui_container_create(0, 10, 10, 390, 460, parent, NULL, 0);
+    gui_widget_setalpha(bench_h, 0xC0);
+    for (i = 0; i < GUI_COUNT_OF(bench_leds); i++) {
+        bench_leds[i] = gui_led_create(0, 5 + (i % 6) * 62, 5 + (i / 6) * 55, 32, 32, bench_h, NULL, 0);
+        gui_led_settype(bench_leds[i], (i & 1) ? GUI_LED_TYPE_CIRCLE : GUI_LED_TYPE_RECT);
+    }
+}
+
+static void
+led_step(uint32_t frame) {
+    gui_led_toggle(bench_leds[(frame * 7) % GUI_COUNT_OF(bench_leds)]);
+    if ((frame % 10) == 0) {
+        gui_widget_invalidate(bench_h);     /* Region taller than redraw strip or band */
+    }
+}
+
+/* Keyboard popup */
+static void
+keyboard_setup(gui_handle_p parent) {
+    bench_h = gui_edittext_create(0, 10, 10, 300, 40, parent, NULL, 0);
+}
+
+static void
+keyboard_step(uint32_t frame) {
+    if (frame & 1) {
+        gui_keyboard_hide();
+    } else {
+        gui_keyboard_show(bench_h);
+    }
+}
+
+/* Dropdown open and close */
+static void
+dropdown_setup(gui_handle_p parent) {
+    size_t i;
+
+    bench_h = gui_dropdown_create(0, 10, 10, 300, 40, parent, NULL, 0);
+    for (i = 0; i < 20; i++) {
+        gui_dropdown_addstring(bench_h, _GT("Dropdown item"));
+    }
+}
+
+static void
+dropdown_step(uint32_t frame) {
+    GUI_UNUSED(frame);
+#if GUI_CFG_USE_TOUCH
+    bench_click(gui_widget_getabsolutex(bench_h) + 5, gui_widget_getabsolutey(bench_h) + 5);
+#else /* GUI_CFG_USE_TOUCH */
+    gui_widget_invalidate(bench_h);
+#endif /* !GUI_CFG_USE_TOUCH */
+}
+
+static const bench_scene_t
+scenes[] = {
+    { "fullscreen",     fullscreen_setup,   fullscreen_step },
+    { "listview",       listview_setup,     listview_step },
+    { "graph_1k",       graph1k_setup,      graph_step },
+    { "graph_10k",      graph10k_setup,     graph_step },
+    { "alpha_drag",     alpha_setup,        alpha_step },
+    { "keyboard",       keyboard_setup,     keyboard_step },
+    { "dropdown",       dropdown_setup,     dropdown_step },
+    { "led_alpha",      led_setup,          led_step },
+};
+
+/**
+ * \brief           Process GUI until frames drawn with time budget and animations are finished
+ */
+static void
+bench_settle(void) {
+    size_t i;
+
+    for (i = 0; i < BENCH_SETTLE; i++) {
+        gui_process();
+    }
+}
+
+/**
+ * \brief           Get checksum of frame currently shown on virtual display
+ */
+static uint32_t
+bench_framesum(void) {
+    const uint32_t* px = gui_ll_ram_getframebuffer();
+    uint32_t sum = 2166136261UL;
+    size_t i;
+
+    for (i = 0; i < (size_t)gui_lcd_getwidth() * (size_t)gui_lcd_getheight(); i++) {
+        sum = (sum ^ px[i]) * 16777619UL;
+    }
+    return sum;
+}
+
+/**
+ * \brief           Compare incrementally drawn frame with forced full redraw
+ * \param[in]       parent: Full-screen parent of scene
+ * \return          `1` when both frames are equal, `0` otherwise
+ */
+static uint8_t
+bench_check_redraw(gui_handle_p parent) {
+    uint32_t sum;
+
+    bench_settle();
+    sum = bench_framesum();
+    gui_protect(1);
+    gui_widget_invalidate(parent);
+    gui_unprotect(1);
+    bench_settle();
+    return sum == bench_framesum();
+}
+
+/**
+ * \brief           Run single scene and print results
+ */
+static void
+bench_run_scene(const bench_scene_t* scene) {
+    gui_handle_p parent;
+    uint32_t frame, time;
+    uint8_t redraw_ok;
+    size_t allocs;
+    uint64_t pixels = 0;
+#if GUI_CFG_USE_LL_STATS
+    gui_stats_t stats;
+#endif /* GUI_CFG_USE_LL_STATS */
+
+    gui_protect(1);
+    parent = gui_window_create(0, 0, 0, 800, 480, gui_window_getdesktop(), NULL, 0);
+    scene->setup(parent);
+    gui_unprotect(1);
+    gui_process();                          /* Draw initial scene, not measured */
+
+    allocs = gui_mem_getalloccount();
+    time = gui_sys_now();
+    for (frame = 0; frame < BENCH_FRAMES; frame++) {
+        gui_protect(1);
+        scene->step(frame);
+        gui_unprotect(1);
+        gui_process();
+#if GUI_CFG_USE_LL_STATS
+        gui_stats_get(&stats);
+        pixels += (uint64_t)stats.pixels_filled + stats.pixels_copied + stats.pixels_blended;
+#endif /* GUI_CFG_USE_LL_STATS */
+    }
+    time = gui_sys_now() - time;
+    allocs = gui_mem_getalloccount() - allocs;
+    if (time == 0) {
+        time = 1;
+    }
+    redraw_ok = bench_check_redraw(parent);
+
+    printf("%-12s %12u %15u %15u %13u %7s\r\n", scene->name,
+        (unsigned)(BENCH_FRAMES * 1000UL / time),
+        (unsigned)(pixels * 1000UL / time),
+        (unsigned)gui_mem_getminfree(), (unsigned)allocs,
+        redraw_ok ? "ok" : "ERROR");
+
+    gui_protect(1);
+    gui_keyboard_hide();
+    gui_widget_remove(&parent);
+    gui_unprotect(1);
+    gui_process();                          /* Remove widgets */
+}
+
+/**
+ * \brief           Run all benchmark scenes
+ * \note            GUI must be initialized with \ref gui_init before
+ */
+void
+demo_benchmark_run(void) {
+    size_t i;
+
+    gui_protect(1);
+    gui_widget_setfontdefault(&GUI_Font_Arial_Bold_18);
+    gui_keyboard_create();
+    gui_unprotect(1);
+
+    printf("%-12s %12s %15s %15s %13s %7s\r\n", "scene", "frames/s", "pixels/s", "heap minfree", "allocs", "redraw");
+    for (i = 0; i < GUI_COUNT_OF(scenes); i++) {
+        bench_run_scene(&scenes[i]);
+    }
+}
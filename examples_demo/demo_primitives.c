@@ -0,0 +1,316 @@
+#include "demo.h"
+#include "system/gui_sys.h"
+#include <stdio.h>
+
+/*
+ * Drawing primitive micro-benchmark
+ *
+ * Calls each drawing primitive repeatedly for fixed time in draw event of
+ * full-screen widget and prints calls/s, pixels/s and low-level calls per
+ * primitive call for each size and clipping configuration:
+ *
+ *  - inside:  primitive is entirely inside clipping region
+ *  - half:    clipping region covers left half of primitive
+ *  - outside: clipping region does not overlap primitive
+ *
+ * Benchmark does not depend on low-level driver, link it with headless RAM
+ * driver, SDL or DMA2D driver to compare `gui_ll_t` implementations.
+ * Layer pixel format is the one of linked driver, images are drawn from
+ * 16, 24 and 32 bits per pixel sources. Call \ref demo_primitives_run instead
+ * of starting GUI thread, as benchmark calls gui_process itself.
+ *
+ * Pixel and low-level call counters are available when GUI_CFG_USE_LL_STATS
+ * is enabled. Band rendering and GUI_CFG_FRAME_RATE should be disabled.
+ */
+
+#define PRIM_TIME                           50
+#define PRIM_X                              100
+#define PRIM_Y                              100
+#define PRIM_SIZE_MAX                       128
+
+/**
+ * \brief           Drawing primitive
+ */
+typedef struct {
+    const char* name;                       /*!< Primitive name */
+    void (*draw)(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size);    /*!< Draw primitive in `size` square */
+} prim_t;
+
+/**
+ * \brief           Clipping configuration
+ */
+typedef struct {
+    const char* name;                       /*!< Configuration name */
+    void (*clip)(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size);    /*!< Set clipping region for `size` square */
+} prim_clip_t;
+
+static const prim_t* prim_active;           /* Primitive drawn by next draw event, `NULL` for baseline */
+static const prim_clip_t* prim_clip_active; /* Clipping of active primitive */
+static gui_dim_t prim_size;                 /* Size of active primitive */
+static uint32_t prim_calls, prim_time;      /* Result of last draw event */
+
+static uint32_t prim_pixels[PRIM_SIZE_MAX * PRIM_SIZE_MAX];  /* Source pixels of images */
+static gui_image_desc_t prim_image;         /* Image descriptor of active image primitive */
+static const gui_char* prim_text = _GT("The quick brown fox jumps over the lazy dog");
+
+/* Primitives */
+static void
+prim_setpixel(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    GUI_UNUSED(size);
+    gui_draw_setpixel(disp, x, y, GUI_COLOR_RED);
+}
+
+static void
+prim_hline(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_hline(disp, x, y, size, GUI_COLOR_RED);
+}
+
+static void
+prim_vline(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_vline(disp, x, y, size, GUI_COLOR_RED);
+}
+
+static void
+prim_line(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_line(disp, x, y, x + size - 1, y + size / 2, GUI_COLOR_RED);
+}
+
+static void
+prim_line_aa(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_line_aa(disp, x, y, x + size - 1, y + size / 2, GUI_COLOR_RED);
+}
+
+static void
+prim_rectangle(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_rectangle(disp, x, y, size, size, GUI_COLOR_RED);
+}
+
+static void
+prim_filledrectangle(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_filledrectangle(disp, x, y, size, size, GUI_COLOR_RED);
+}
+
+static void
+prim_roundedrectangle(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_roundedrectangle(disp, x, y, size, size, size / 4, GUI_COLOR_RED);
+}
+
+static void
+prim_filledroundedrectangle(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_filledroundedrectangle(disp, x, y, size, size, size / 4, GUI_COLOR_RED);
+}
+
+static void
+prim_circle(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_circle(disp, x + size / 2, y + size / 2, size / 2 - 1, GUI_COLOR_RED);
+}
+
+static void
+prim_filledcircle(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_filledcircle(disp, x + size / 2, y + size / 2, size / 2 - 1, GUI_COLOR_RED);
+}
+
+static void
+prim_circle_aa(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_circle_aa(disp, x + size / 2, y + size / 2, size / 2 - 1, GUI_COLOR_RED);
+}
+
+static void
+prim_triangle(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_triangle(disp, x, y + size - 1, x + size / 2, y, x + size - 1, y + size - 1, GUI_COLOR_RED);
+}
+
+static void
+prim_filledtriangle(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_filledtriangle(disp, x, y + size - 1, x + size / 2, y, x + size - 1, y + size - 1, GUI_COLOR_RED);
+}
+
+static void
+prim_writetext(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    gui_draw_text_t f;
+
+    gui_draw_text_init(&f);
+    f.x = x;
+    f.y = y;
+    f.width = size;
+    f.height = size;
+    f.color1width = size;
+    f.color1 = GUI_COLOR_BLACK;
+    f.flags |= GUI_FLAG_TEXT_MULTILINE;
+    gui_draw_writetext(disp, &GUI_Font_Arial_Bold_18, prim_text, &f);
+}
+
+/**
+ * \brief           Set image descriptor for square of pixels
+ */
+static void
+prim_image_set(gui_dim_t size, uint8_t bpp) {
+    memset(&prim_image, 0x00, sizeof(prim_image));
+    prim_image.x_size = size;
+    prim_image.y_size = size;
+    prim_image.bpp = bpp;
+    prim_image.image = (const uint8_t *)prim_pixels;
+}
+
+static void
+prim_image16(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    prim_image_set(size, 16);
+    gui_draw_image(disp, x, y, &prim_image);
+}
+
+static void
+prim_image24(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    prim_image_set(size, 24);
+    gui_draw_image(disp, x, y, &prim_image);
+}
+
+static void
+prim_image32(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    prim_image_set(size, 32);
+    gui_draw_image(disp, x, y, &prim_image);
+}
+
+static const prim_t
+prims[] = {
+    { "setpixel",               prim_setpixel },
+    { "hline",                  prim_hline },
+    { "vline",                  prim_vline },
+    { "line",                   prim_line },
+    { "line_aa",                prim_line_aa },
+    { "rectangle",              prim_rectangle },
+    { "filledrectangle",        prim_filledrectangle },
+    { "roundedrectangle",       prim_roundedrectangle },
+    { "filledroundedrectangle", prim_filledroundedrectangle },
+    { "circle",                 prim_circle },
+    { "filledcircle",           prim_filledcircle },
+    { "circle_aa",              prim_circle_aa },
+    { "triangle",               prim_triangle },
+    { "filledtriangle",         prim_filledtriangle },
+    { "writetext",              prim_writetext },
+    { "image_16bpp",            prim_image16 },
+    { "image_24bpp",            prim_image24 },
+    { "image_32bpp",            prim_image32 },
+};
+
+/* Clipping configurations, region is intersected with region of draw event */
+static void
+clip_inside(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    GUI_UNUSED(disp);
+    GUI_UNUSED(x);
+    GUI_UNUSED(y);
+    GUI_UNUSED(size);
+}
+
+static void
+clip_half(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    disp->x1 = GUI_MAX(disp->x1, x);
+    disp->y1 = GUI_MAX(disp->y1, y);
+    disp->x2 = GUI_MIN(disp->x2, x + GUI_MAX(size / 2, 1));
+    disp->y2 = GUI_MIN(disp->y2, y + size);
+}
+
+static void
+clip_outside(gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t size) {
+    disp->x1 = GUI_MAX(disp->x1, x + size + 1);
+    disp->y1 = GUI_MAX(disp->y1, y);
+    disp->x2 = GUI_MIN(disp->x2, x + 2 * size + 1);
+    disp->y2 = GUI_MIN(disp->y2, y + size);
+}
+
+static const prim_clip_t
+clips[] = {
+    { "inside",     clip_inside },
+    { "half",       clip_half },
+    { "outside",    clip_outside },
+};
+
+static const gui_dim_t sizes[] = { 8, 32, PRIM_SIZE_MAX };
+
+/**
+ * \brief           Widget callback, active primitive is drawn in draw event
+ */
+static uint8_t
+prim_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result) {
+    if (evt == GUI_EVT_DRAW) {
+        gui_display_t disp = *GUI_EVT_PARAMTYPE_DISP(param);
+        uint32_t start;
+
+        prim_calls = 0;
+        prim_time = 0;
+        if (prim_active == NULL) {
+            return 1;                       /* Baseline frame */
+        }
+        prim_clip_active->clip(&disp, PRIM_X, PRIM_Y, prim_size);
+        start = gui_sys_now();
+        do {
+            prim_active->draw(&disp, PRIM_X, PRIM_Y, prim_size);
+            prim_calls++;
+        } while ((prim_time = gui_sys_now() - start) < PRIM_TIME);
+        return 1;
+    }
+    return gui_widget_processdefaultcallback(h, evt, param, result);
+}
+
+/**
+ * \brief           Draw single frame and get low-level statistics
+ */
+static void
+prim_frame(gui_handle_p h, gui_stats_t* stats) {
+    memset(stats, 0x00, sizeof(*stats));
+    gui_protect(1);
+    gui_widget_invalidate(h);
+    gui_unprotect(1);
+    gui_process();
+    gui_stats_get(stats);
+}
+
+/**
+ * \brief           Run all primitives and print results
+ * \note            GUI must be initialized with \ref gui_init before
+ */
+void
+demo_primitives_run(void) {
+    size_t p, s, c;
+    gui_handle_p h;
+    gui_stats_t base, stats;
+    uint64_t pixels;
+
+    for (p = 0; p < GUI_COUNT_OF(prim_pixels); p++) {
+        prim_pixels[p] = 0xFF000000UL | (uint32_t)(p * 2654435761UL >> 8);
+    }
+    gui_protect(1);
+    h = gui_container_create(0, 0, 0, 800, 480, gui_window_getdesktop(), prim_callback, 0);
+    gui_unprotect(1);
+    gui_process();
+
+    prim_active = NULL;
+    prim_frame(h, &base);                   /* Pixels drawn by widgets without primitive */
+
+    printf("%-24s %6s %8s %12s %15s %10s\r\n", "primitive", "size", "clip", "calls/s", "pixels/s", "ll/call");
+    for (p = 0; p < GUI_COUNT_OF(prims); p++) {
+        for (s = 0; s < GUI_COUNT_OF(sizes); s++) {
+            for (c = 0; c < GUI_COUNT_OF(clips); c++) {
+                prim_active = &prims[p];
+                prim_clip_active = &clips[c];
+                prim_size = sizes[s];
+                prim_frame(h, &stats);
+                if (prim_time == 0) {
+                    prim_time = 1;
+                }
+                pixels = (uint64_t)stats.pixels_filled + stats.pixels_copied + stats.pixels_blended;
+                pixels -= GUI_MIN(pixels, (uint64_t)base.pixels_filled + base.pixels_copied + base.pixels_blended);
+
+                printf("%-24s %6u %8s %12u %15u %10u\r\n", prims[p].name, (unsigned)sizes[s], clips[c].name,
+                    (unsigned)((uint64_t)prim_calls * 1000UL / prim_time),
+                    (unsigned)(pixels * 1000UL / prim_time),
+                    prim_calls ? (unsigned)((stats.calls - GUI_MIN(stats.calls, base.calls)) / prim_calls) : 0U);
+            }
+        }
+    }
+
+    prim_active = NULL;
+    gui_protect(1);
+    gui_widget_remove(&h);
+    gui_unprotect(1);
+    gui_process();
+}
@@ -0,0 +1,265 @@
+#include "demo.h"
+#include "system/gui_sys.h"
+#include <stdio.h>
+
+/*
+ * Headless scaling benchmark
+ *
+ * Sweeps widget count, tree depth, list length and number of distinct
+ * characters in glyph cache and prints CSV with time of create, invalidate,
+ * redraw, touch and remove for each size. Complexity regressions show up
+ * as changed slope of the curves.
+ *
+ * Link with headless RAM driver (gui_ll_ram.c) and call \ref demo_scaling_run
+ * instead of starting GUI thread, as benchmark calls gui_process itself.
+ * Times are in units of GUI_CFG_PROFILER_CYCLES, overwrite it with cycle
+ * or high resolution counter of platform to measure small sizes.
+ * Memory must be large enough for 10k widgets, GUI_CFG_FRAME_RATE should be disabled.
+ * Depth sweep needs GUI_CFG_WIDGET_DEPTH_MAX of at least 35, deeper sizes are skipped.
+ *
+ * Lists are limited to 32767 entries by their 16-bit index.
+ * When memory runs out, sweep continues with widgets or entries created
+ * so far and reports their number as size.
+ */
+
+#define SCALING_REPEAT                      100
+
+/**
+ * \brief           Scaling sweep
+ */
+typedef struct {
+    const char* name;                       /*!< Sweep name */
+    const uint32_t* sizes;                  /*!< Sizes of sweep */
+    size_t sizes_count;                     /*!< Number of sizes */
+    gui_handle_p (*create)(gui_handle_p parent, uint32_t* size);/*!< Create widgets and return widget to touch,
+                                                    size is set to number of widgets or entries actually created */
+    void (*invalidate)(gui_handle_p h, uint32_t size);  /*!< Invalidate widgets of sweep */
+} scaling_sweep_t;
+
+static gui_handle_p scaling_widgets[10000]; /* Widgets of widget count sweep */
+static gui_char scaling_text[1024];         /* Text of glyph cache sweep */
+
+/* Widget count, small buttons in grid of one parent */
+static const uint32_t count_sizes[] = { 10, 100, 1000, 10000 };
+
+static gui_handle_p
+count_create(gui_handle_p parent, uint32_t* size) {
+    uint32_t i;
+
+    for (i = 0; i < *size; i++) {
+        scaling_widgets[i] = gui_button_create(0, (float)((i % 100) * 8), (float)((i / 100) * 4), 8, 4, parent, NULL, 0);
+        if (scaling_widgets[i] == NULL) {
+            break;                          /* Out of memory */
+        }
+    }
+    *size = i;
+    return i > 0 ? scaling_widgets[i - 1] : NULL;
+}
+
+static void
+count_invalidate(gui_handle_p h, uint32_t size) {
+    uint32_t i;
+
+    GUI_UNUSED(h);
+    for (i = 0; i < size; i++) {
+        gui_widget_invalidate(scaling_widgets[i]);
+    }
+}
+
+/* Tree depth, nested containers with button as leaf */
+static const uint32_t depth_sizes[] = { 1, 2, 4, 8, 16, 32 };
+
+static gui_handle_p
+depth_create(gui_handle_p parent, uint32_t* size) {
+    uint32_t i;
+
+    for (i = 0; i < *size && parent != NULL; i++) {
+        parent = gui_container_create(0, 5, 5, (float)(790 - 10 * i), (float)(470 - 10 * i), parent, NULL, 0);
+    }
+    if (parent == NULL) {
+        return NULL;                        /* Nesting limit reached */
+    }
+    return gui_button_create(0, 5, 5, 100, 40, parent, NULL, 0);
+}
+
+static void
+depth_invalidate(gui_handle_p h, uint32_t size) {
+    size_t i;
+
+    GUI_UNUSED(size);
+    for (i = 0; i < SCALING_REPEAT; i++) {
+        gui_widget_invalidate(h);
+    }
+}
+
+/* List length, selection moves to last entry */
+static const uint32_t list_sizes[] = { 10, 100, 1000, 10000, 30000 };
+
+static gui_handle_p
+listbox_create(gui_handle_p parent, uint32_t* size) {
+    gui_handle_p h;
+    uint32_t i;
+
+    h = gui_listbox_create(0, 0, 0, 800, 480, parent, NULL, 0);
+    for (i = 0; h != NULL && i < *size; i++) {
+        if (!gui_listbox_addstring(h, _GT("Listbox item"))) {
+            break;                          /* Out of memory */
+        }
+    }
+    *size = i;
+    return i > 0 ? h : NULL;
+}
+
+static void
+listbox_invalidate(gui_handle_p h, uint32_t size) {
+    gui_listbox_setselection(h, (int16_t)(size - 1));
+}
+
+static gui_handle_p
+listview_create(gui_handle_p parent, uint32_t* size) {
+    gui_listview_row_p row;
+    gui_handle_p h;
+    uint32_t i;
+
+    h = gui_listview_create(0, 0, 0, 800, 480, parent, NULL, 0);
+    if (h == NULL || !gui_listview_addcolumn(h, _GT("Column"), 400)) {
+        *size = 0;
+        return NULL;
+    }
+    for (i = 0; i < *size; i++) {
+        if ((row = gui_listview_addrow(h)) == NULL) {
+            break;                          /* Out of memory */
+        }
+        gui_listview_setitemstring(h, row, 0, _GT("Listview item"));
+    }
+    *size = i;
+    return i > 0 ? h : NULL;
+}
+
+static void
+listview_invalidate(gui_handle_p h, uint32_t size) {
+    gui_listview_setselection(h, (int16_t)(size - 1));
+}
+
+/* Glyph cache, full-screen text with number of distinct characters */
+static const uint32_t glyph_sizes[] = { 10, 25, 50, 95 };
+
+static gui_handle_p
+glyph_create(gui_handle_p parent, uint32_t* size) {
+    gui_handle_p h;
+    size_t i;
+
+    for (i = 0; i < GUI_COUNT_OF(scaling_text) - 1; i++) {
+        scaling_text[i] = (gui_char)(' ' + i % *size);
+    }
+    scaling_text[i] = 0;
+    h = gui_textview_create(0, 0, 0, 800, 480, parent, NULL, 0);
+    gui_widget_settext(h, scaling_text);
+    return h;
+}
+
+static void
+glyph_invalidate(gui_handle_p h, uint32_t size) {
+    GUI_UNUSED(size);
+    gui_widget_invalidate(h);
+}
+
+static const scaling_sweep_t
+sweeps[] = {
+    { "widgets",    count_sizes,    GUI_COUNT_OF(count_sizes),  count_create,       count_invalidate },
+    { "depth",      depth_sizes,    GUI_COUNT_OF(depth_sizes),  depth_create,       depth_invalidate },
+    { "listbox",    list_sizes,     GUI_COUNT_OF(list_sizes),   listbox_create,     listbox_invalidate },
+    { "listview",   list_sizes,     GUI_COUNT_OF(list_sizes),   listview_create,    listview_invalidate },
+    { "glyphs",     glyph_sizes,    GUI_COUNT_OF(glyph_sizes),  glyph_create,       glyph_invalidate },
+};
+
+/**
+ * \brief           Press and release touch on center of widget
+ */
+static void
+scaling_touch(gui_handle_p h) {
+#if GUI_CFG_USE_TOUCH
+    gui_touch_data_t ts = {0};
+
+    ts.count = 1;
+    ts.x[0] = gui_widget_getabsolutex(h) + gui_widget_getwidth(h) / 2;
+    ts.y[0] = gui_widget_getabsolutey(h) + gui_widget_getheight(h) / 2;
+    ts.status = GUI_TOUCH_STATE_PRESSED;
+    gui_input_touchadd(&ts);
+    ts.count = 0;
+    ts.status = GUI_TOUCH_STATE_RELEASED;
+    gui_input_touchadd(&ts);
+#else /* GUI_CFG_USE_TOUCH */
+    GUI_UNUSED(h);
+#endif /* !GUI_CFG_USE_TOUCH */
+}
+
+/**
+ * \brief           Run single size of sweep and print CSV line
+ */
+static void
+scaling_run_size(const scaling_sweep_t* sweep, uint32_t size) {
+    gui_handle_p parent, h;
+    uint32_t t_create, t_invalidate, t_redraw, t_touch, t_remove;
+
+    gui_process();                          /* Start from clean screen */
+    gui_protect(1);
+    t_create = GUI_CFG_PROFILER_CYCLES();
+    parent = gui_container_create(0, 0, 0, 800, 480, gui_window_getdesktop(), NULL, 0);
+    h = sweep->create(parent, &size);       /* Size is lowered when memory runs out */
+    t_create = GUI_CFG_PROFILER_CYCLES() - t_create;
+    if (h == NULL) {                        /* Size is not supported by configuration or memory */
+        gui_widget_remove(&parent);
+        gui_unprotect(1);
+        gui_process();
+        return;
+    }
+    gui_unprotect(1);
+    gui_process();                          /* Draw initial scene, not measured */
+
+    gui_protect(1);
+    t_invalidate = GUI_CFG_PROFILER_CYCLES();
+    sweep->invalidate(h, size);
+    t_invalidate = GUI_CFG_PROFILER_CYCLES() - t_invalidate;
+    gui_unprotect(1);
+
+    t_redraw = GUI_CFG_PROFILER_CYCLES();
+    gui_process();
+    t_redraw = GUI_CFG_PROFILER_CYCLES() - t_redraw;
+
+    scaling_touch(h);
+    t_touch = GUI_CFG_PROFILER_CYCLES();
+    gui_process();
+    t_touch = GUI_CFG_PROFILER_CYCLES() - t_touch;
+
+    gui_protect(1);
+    t_remove = GUI_CFG_PROFILER_CYCLES();
+    gui_widget_remove(&parent);
+    gui_unprotect(1);
+    gui_process();                          /* Widgets are removed on processing */
+    t_remove = GUI_CFG_PROFILER_CYCLES() - t_remove;
+
+    printf("%s,%u,%u,%u,%u,%u,%u\r\n", sweep->name, (unsigned)size,
+        (unsigned)t_create, (unsigned)t_invalidate, (unsigned)t_redraw,
+        (unsigned)t_touch, (unsigned)t_remove);
+}
+
+/**
+ * \brief           Run all scaling sweeps and print results as CSV
+ * \note            GUI must be initialized with \ref gui_init before
+ */
+void
+demo_scaling_run(void) {
+    size_t i, s;
+
+    gui_protect(1);
+    gui_widget_setfontdefault(&GUI_Font_Arial_Bold_18);
+    gui_unprotect(1);
+
+    printf("sweep,size,create,invalidate,redraw,touch,remove\r\n");
+    for (i = 0; i < GUI_COUNT_OF(sweeps); i++) {
+        for (s = 0; s < sweeps[i].sizes_count; s++) {
+            scaling_run_size(&sweeps[i], sweeps[i].sizes[s]);
+        }
+    }
+}
@@ -66,6 +66,9 @@ extern gui_const gui_font_t GUI_Font_Comic_Sans_MS_Regular_22;
 /* Functions for export */
 void    demo_init(void);
 void    demo_create_feature(win_data_t* data, uint8_t protect);
+void    demo_benchmark_run(void);
+void    demo_scaling_run(void);
+void    demo_primitives_run(void);
 
 void    demo_create_feature_window(gui_handle_p parent, uint8_t protect);
 void    demo_create_feature_list_container(gui_handle_p parent, uint8_t protect);
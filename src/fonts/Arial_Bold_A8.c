@@ -0,0 +1,1330 @@
+#include "gui/gui.h"
+
+gui_const uint8_t Font_Arial_Bold_18_A8_Atlas[] = {
+    /* Font_Arial_Bold_18_0021 */
+    0xFF, 0xFF, 0xAA,
+    0xFF, 0xFF, 0xAA,
+    0xFF, 0xFF, 0xAA,
+    0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0x00,
+    0x55, 0xAA, 0xAA,
+    0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xAA,
+    0xFF, 0xFF, 0xAA,
+    0xFF, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_0022 */
+    0x55, 0xFF, 0xAA, 0xAA, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xAA, 0xAA,
+    0x55, 0x55, 0xAA, 0x00, 0x00, 0xFF, 0xAA, 0x00,
+    /* Font_Arial_Bold_18_0023 */
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x55, 0x55, 0xAA, 0x00, 0x55, 0x55, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0024 */
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0025 */
+    0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0x00, 0x55, 0x55, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0x00, 0x55, 0x55, 0xAA, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0x00, 0x55, 0x55, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x00, 0xFF, 0xAA, 0xAA, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xAA, 0x00, 0x55, 0x55, 0xAA, 0x00, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xAA, 0xAA, 0x00, 0x55, 0x55, 0xAA, 0x00, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0xAA, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    /* Font_Arial_Bold_18_0026 */
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0xFF, 0x55, 0xFF, 0xAA, 0xFF, 0x55, 0xAA, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0027 */
+    0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xAA,
+    /* Font_Arial_Bold_18_0028 */
+    0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_0029 */
+    0x55, 0xFF, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xAA, 0xAA, 0x00,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x55, 0x55, 0xAA, 0xAA,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xAA, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0x00, 0x00,
+    /* Font_Arial_Bold_18_002a */
+    0x00, 0x00, 0x00, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0xAA, 0xAA, 0xFF, 0xAA, 0xFF, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xAA, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0x00, 0xAA, 0x55, 0x00, 0xAA, 0x00,
+    /* Font_Arial_Bold_18_002b */
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_002c */
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x55, 0xAA, 0xAA,
+    0x55, 0x00, 0xAA, 0x00,
+    /* Font_Arial_Bold_18_002d */
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_002e */
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_002f */
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x55, 0x55, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x55, 0x55, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0030 */
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0031 */
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xAA,
+    0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_0032 */
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_0033 */
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0x00, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0034 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0035 */
+    0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0036 */
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xFF, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0037 */
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0038 */
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    /* Font_Arial_Bold_18_0039 */
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    /* Font_Arial_Bold_18_003a */
+    0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_003b */
+    0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA,
+    0x00, 0x55, 0xAA,
+    0x55, 0x55, 0x00,
+    0x55, 0x00, 0x00,
+    /* Font_Arial_Bold_18_003c */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA,
+    /* Font_Arial_Bold_18_003d */
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_003e */
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_003f */
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0040 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0x55, 0xFF, 0xAA, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0xAA, 0xAA,
+    0x55, 0x55, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xAA,
+    0xFF, 0xAA, 0xAA, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xAA, 0xAA, 0x00, 0x55, 0x55, 0xAA,
+    0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0x00,
+    0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xAA, 0xAA,
+    0x55, 0xAA, 0xAA, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x55, 0x55, 0xFF, 0x00, 0x00,
+    0x55, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0041 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    /* Font_Arial_Bold_18_0042 */
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    /* Font_Arial_Bold_18_0043 */
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0044 */
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0045 */
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_0046 */
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0047 */
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0048 */
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_0049 */
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_004a */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    /* Font_Arial_Bold_18_004b */
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA,
+    /* Font_Arial_Bold_18_004c */
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    /* Font_Arial_Bold_18_004d */
+    0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x55, 0x55, 0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xAA, 0x55, 0xFF, 0xAA, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xFF, 0x55, 0xFF, 0xAA, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_004e */
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x55, 0xFF, 0xFF, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    /* Font_Arial_Bold_18_004f */
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0050 */
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0051 */
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0x00,
+    /* Font_Arial_Bold_18_0052 */
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    /* Font_Arial_Bold_18_0053 */
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0054 */
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0055 */
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0056 */
+    0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0057 */
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00, 0xFF, 0xFF, 0xAA, 0x55, 0xFF, 0xAA, 0xAA, 0x55, 0x55, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x55, 0x55, 0xFF, 0x00, 0x55, 0x55, 0xFF, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xAA, 0x55, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x55, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0058 */
+    0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    /* Font_Arial_Bold_18_0059 */
+    0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_005a */
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_005b */
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_005c */
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x55, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_005d */
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_005e */
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x55, 0xFF, 0xAA, 0x00,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_005f */
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_0060 */
+    0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x55, 0x55, 0xAA,
+    /* Font_Arial_Bold_18_0061 */
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x55, 0x55, 0xFF, 0x00,
+    0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x55, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_0062 */
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    /* Font_Arial_Bold_18_0063 */
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0x00, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x00, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0064 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_0065 */
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    /* Font_Arial_Bold_18_0066 */
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0067 */
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0068 */
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_0069 */
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_006a */
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    /* Font_Arial_Bold_18_006b */
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xFF, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    /* Font_Arial_Bold_18_006c */
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_006d */
+    0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_006e */
+    0x55, 0x55, 0xFF, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_006f */
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0070 */
+    0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0071 */
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    /* Font_Arial_Bold_18_0072 */
+    0x55, 0xFF, 0xAA, 0xFF, 0x55, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0073 */
+    0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xAA,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xAA, 0x00,
+    /* Font_Arial_Bold_18_0074 */
+    0x00, 0x00, 0x00, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_0075 */
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00,
+    0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x55, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_0076 */
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA, 0xFF, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0077 */
+    0x55, 0x55, 0xFF, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xAA,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0x00, 0x55, 0xFF, 0xFF, 0x55, 0xAA, 0xAA, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    /* Font_Arial_Bold_18_0078 */
+    0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0xFF, 0x55, 0xFF, 0xAA, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00,
+    0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    /* Font_Arial_Bold_18_0079 */
+    0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x55, 0x55, 0xFF, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xAA, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_007a */
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    /* Font_Arial_Bold_18_007b */
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x55, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xAA, 0xAA,
+    /* Font_Arial_Bold_18_007c */
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    0xFF, 0xAA, 0xAA,
+    /* Font_Arial_Bold_18_007d */
+    0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xAA, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0x55, 0x55, 0xFF, 0xAA, 0xAA,
+    0x00, 0x00, 0xFF, 0xFF, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xAA, 0xAA, 0x00, 0x00,
+    0x00, 0x55, 0x55, 0xAA, 0xAA, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00,
+    0xFF, 0xFF, 0xAA, 0xAA, 0x00, 0x00, 0x00,
+    /* Font_Arial_Bold_18_007e */
+    0x55, 0x55, 0xFF, 0xFF, 0x00, 0xAA, 0x00, 0x00, 0x55, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA,
+    0xAA, 0xAA, 0x00, 0x00, 0xFF, 0x55, 0xFF, 0xFF, 0x00, 0xAA,
+};
+
+gui_const gui_font_char_t Arial_Bold_18_A8_CharTable[] = {
+    {   0,    1,  0,    0,    6, &Font_Arial_Bold_18_A8_Atlas[0]},
+    {   3,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[0]},
+    {   8,    5,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[39]},
+    {  11,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[79]},
+    {   9,   16,  0,    0,    0, &Font_Arial_Bold_18_A8_Atlas[222]},
+    {  15,   14,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[366]},
+    {  13,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[576]},
+    {   3,    5,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[745]},
+    {   5,   17,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[760]},
+    {   5,   17,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[845]},
+    {   8,    6,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[930]},
+    {  10,    9,  0,    3,    0, &Font_Arial_Bold_18_A8_Atlas[978]},
+    {   4,    6,  0,   11,    0, &Font_Arial_Bold_18_A8_Atlas[1068]},
+    {   6,    3,  0,    8,    0, &Font_Arial_Bold_18_A8_Atlas[1092]},
+    {   4,    3,  0,   11,    0, &Font_Arial_Bold_18_A8_Atlas[1110]},
+    {   6,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[1122]},
+    {   9,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[1200]},
+    {   6,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[1317]},
+    {   9,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[1395]},
+    {   9,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[1512]},
+    {  11,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[1629]},
+    {  10,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[1772]},
+    {   9,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[1902]},
+    {   9,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[2019]},
+    {   9,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[2136]},
+    {   9,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[2253]},
+    {   3,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[2370]},
+    {   3,   13,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[2400]},
+    {  10,   10,  0,    3,    0, &Font_Arial_Bold_18_A8_Atlas[2439]},
+    {  10,    8,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[2539]},
+    {  10,   10,  0,    3,    0, &Font_Arial_Bold_18_A8_Atlas[2619]},
+    {  10,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[2719]},
+    {  17,   17,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[2849]},
+    {  14,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[3138]},
+    {  12,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[3320]},
+    {  12,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[3476]},
+    {  12,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[3632]},
+    {  11,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[3788]},
+    {  10,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[3931]},
+    {  13,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[4061]},
+    {  12,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[4230]},
+    {   4,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[4386]},
+    {  10,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[4438]},
+    {  13,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[4568]},
+    {  11,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[4737]},
+    {  14,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[4880]},
+    {  12,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[5062]},
+    {  13,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[5218]},
+    {  11,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[5387]},
+    {  14,   14,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[5530]},
+    {  13,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[5726]},
+    {  11,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[5895]},
+    {  12,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[6038]},
+    {  12,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[6194]},
+    {  13,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[6350]},
+    {  18,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[6519]},
+    {  13,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[6753]},
+    {  13,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[6922]},
+    {  12,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[7091]},
+    {   6,   17,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[7247]},
+    {   6,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[7349]},
+    {   6,   17,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[7427]},
+    {   9,    7,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[7529]},
+    {  11,    2,  0,   16,    0, &Font_Arial_Bold_18_A8_Atlas[7592]},
+    {   4,    3,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[7614]},
+    {   9,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[7626]},
+    {  10,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[7716]},
+    {  10,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[7846]},
+    {  10,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[7946]},
+    {   9,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[8076]},
+    {   8,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[8166]},
+    {  10,   14,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[8270]},
+    {  10,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[8410]},
+    {   4,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[8540]},
+    {   6,   17,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[8592]},
+    {  10,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[8694]},
+    {   4,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[8824]},
+    {  15,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[8876]},
+    {  10,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[9026]},
+    {  10,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[9126]},
+    {  10,   14,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[9226]},
+    {  10,   14,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[9366]},
+    {   7,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[9506]},
+    {   9,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[9576]},
+    {   7,   13,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[9666]},
+    {  10,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[9757]},
+    {  11,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[9857]},
+    {  15,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[9967]},
+    {  10,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[10117]},
+    {  11,   14,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[10217]},
+    {   9,   10,  0,    4,    0, &Font_Arial_Bold_18_A8_Atlas[10371]},
+    {   7,   17,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[10461]},
+    {   3,   17,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[10580]},
+    {   7,   17,  0,    1,    0, &Font_Arial_Bold_18_A8_Atlas[10631]},
+    {  10,    4,  0,    5,    0, &Font_Arial_Bold_18_A8_Atlas[10750]},
+    {   0,    1,  0,    0,    6, &Font_Arial_Bold_18_A8_Atlas[10790]},
+};
+
+gui_const gui_font_t GUI_Font_Arial_Bold_18_A8 = {
+    _GT("Arial Bold"),
+    18,
+    0x20,
+    0x7f,
+    GUI_FLAG_FONT_A8,
+    Arial_Bold_18_A8_CharTable
+};
@@ -0,0 +1,647 @@
+#include "gui/gui.h"
+
+gui_const uint8_t Font_Calibri_Bold_8_A8_Atlas[] = {
+    /* Font_Calibri_Bold_8_0020 */
+    0x00, 0x00, 0x00, 0x00,
+    /* Font_Calibri_Bold_8_0021 */
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    /* Font_Calibri_Bold_8_0022 */
+    0xFF, 0x00, 0xFF,
+    0x00, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_0023 */
+    0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0024 */
+    0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00,
+    /* Font_Calibri_Bold_8_0025 */
+    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0026 */
+    0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0027 */
+    0xFF,
+    /* Font_Calibri_Bold_8_0028 */
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0xFF, 0x00,
+    0xFF, 0x00,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    /* Font_Calibri_Bold_8_0029 */
+    0xFF, 0x00,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    /* Font_Calibri_Bold_8_002a */
+    0xFF, 0xFF,
+    0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_002b */
+    0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFF, 0x00, 0x00,
+    /* Font_Calibri_Bold_8_002c */
+    0x00, 0xFF,
+    0xFF, 0x00,
+    /* Font_Calibri_Bold_8_002d */
+    0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_002e */
+    0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_002f */
+    0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00,
+    /* Font_Calibri_Bold_8_0030 */
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0031 */
+    0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0032 */
+    0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0033 */
+    0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0034 */
+    0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0035 */
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0036 */
+    0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0037 */
+    0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00,
+    /* Font_Calibri_Bold_8_0038 */
+    0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0039 */
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_003a */
+    0xFF,
+    0x00,
+    0x00,
+    0xFF,
+    /* Font_Calibri_Bold_8_003b */
+    0x00, 0xFF,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0xFF,
+    0xFF, 0x00,
+    /* Font_Calibri_Bold_8_003c */
+    0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_003d */
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_003e */
+    0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00,
+    /* Font_Calibri_Bold_8_003f */
+    0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0040 */
+    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+    /* Font_Calibri_Bold_8_0041 */
+    0x00, 0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_0042 */
+    0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0043 */
+    0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0044 */
+    0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0045 */
+    0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00,
+    0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0046 */
+    0xFF, 0xFF,
+    0xFF, 0x00,
+    0xFF, 0xFF,
+    0xFF, 0x00,
+    0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0047 */
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0048 */
+    0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0049 */
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    /* Font_Calibri_Bold_8_004a */
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_004b */
+    0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_004c */
+    0xFF, 0x00,
+    0xFF, 0x00,
+    0xFF, 0x00,
+    0xFF, 0x00,
+    0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_004d */
+    0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_004e */
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_004f */
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0050 */
+    0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00,
+    /* Font_Calibri_Bold_8_0051 */
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0052 */
+    0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_0053 */
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0054 */
+    0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0055 */
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0056 */
+    0xFF, 0x00, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00, 0x00,
+    /* Font_Calibri_Bold_8_0057 */
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0058 */
+    0xFF, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_0059 */
+    0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_005a */
+    0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_005b */
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    /* Font_Calibri_Bold_8_005c */
+    0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00,
+    0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF,
+    0x00, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_005d */
+    0xFF, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    /* Font_Calibri_Bold_8_005e */
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_005f */
+    0xFF, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0060 */
+    0xFF,
+    /* Font_Calibri_Bold_8_0061 */
+    0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0062 */
+    0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0063 */
+    0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0064 */
+    0x00, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0065 */
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0066 */
+    0x00, 0xFF,
+    0xFF, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    /* Font_Calibri_Bold_8_0067 */
+    0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0068 */
+    0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_0069 */
+    0xFF, 0xFF,
+    0xFF, 0x00,
+    0xFF, 0x00,
+    0xFF, 0x00,
+    0xFF, 0x00,
+    /* Font_Calibri_Bold_8_006a */
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_006b */
+    0xFF, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_006c */
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    /* Font_Calibri_Bold_8_006d */
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_006e */
+    0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_006f */
+    0x00, 0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0070 */
+    0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0x00,
+    /* Font_Calibri_Bold_8_0071 */
+    0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_0072 */
+    0xFF, 0x00, 0xFF,
+    0xFF, 0xFF, 0x00,
+    0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x00,
+    /* Font_Calibri_Bold_8_0073 */
+    0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0074 */
+    0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0075 */
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_0076 */
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0077 */
+    0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+    0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_0078 */
+    0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0xFF,
+    0xFF, 0x00, 0xFF,
+    /* Font_Calibri_Bold_8_0079 */
+    0xFF, 0x00, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF, 0x00,
+    0x00, 0xFF, 0x00, 0x00,
+    /* Font_Calibri_Bold_8_007a */
+    0xFF, 0xFF, 0xFF,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_007b */
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0xFF, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    0x00, 0xFF,
+    /* Font_Calibri_Bold_8_007c */
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    /* Font_Calibri_Bold_8_007d */
+    0xFF, 0x00, 0x00,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0xFF,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00,
+    0x00, 0xFF, 0x00,
+    /* Font_Calibri_Bold_8_007e */
+    0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0xFF, 0xFF,
+    /* Font_Calibri_Bold_8_007f */
+    0x00, 0x00, 0x00, 0x00,
+};
+
+gui_const gui_font_char_t Calibri_Bold_8_A8_CharTable[] = {
+    {   4,    1,  0,    0,    1, &Font_Calibri_Bold_8_A8_Atlas[0]},
+    {   1,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[4]},
+    {   3,    2,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[9]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[15]},
+    {   4,    7,  0,    0,    1, &Font_Calibri_Bold_8_A8_Atlas[35]},
+    {   6,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[63]},
+    {   5,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[93]},
+    {   1,    1,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[118]},
+    {   2,    7,  0,    0,    1, &Font_Calibri_Bold_8_A8_Atlas[119]},
+    {   2,    7,  0,    0,    1, &Font_Calibri_Bold_8_A8_Atlas[133]},
+    {   2,    2,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[147]},
+    {   4,    2,  0,    3,    1, &Font_Calibri_Bold_8_A8_Atlas[151]},
+    {   2,    2,  0,    5,    1, &Font_Calibri_Bold_8_A8_Atlas[159]},
+    {   2,    1,  0,    3,    1, &Font_Calibri_Bold_8_A8_Atlas[163]},
+    {   2,    1,  0,    5,    1, &Font_Calibri_Bold_8_A8_Atlas[165]},
+    {   3,    7,  0,    0,    1, &Font_Calibri_Bold_8_A8_Atlas[167]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[188]},
+    {   3,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[208]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[223]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[243]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[263]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[283]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[303]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[323]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[343]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[363]},
+    {   1,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[383]},
+    {   2,    5,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[387]},
+    {   4,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[397]},
+    {   4,    2,  0,    3,    1, &Font_Calibri_Bold_8_A8_Atlas[413]},
+    {   4,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[421]},
+    {   3,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[437]},
+    {   7,    6,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[452]},
+    {   5,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[494]},
+    {   3,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[519]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[534]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[554]},
+    {   3,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[574]},
+    {   2,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[589]},
+    {   5,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[599]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[624]},
+    {   1,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[644]},
+    {   2,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[649]},
+    {   3,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[659]},
+    {   2,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[674]},
+    {   5,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[684]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[709]},
+    {   5,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[729]},
+    {   3,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[754]},
+    {   6,    6,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[769]},
+    {   3,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[805]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[820]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[840]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[860]},
+    {   5,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[880]},
+    {   7,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[905]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[940]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[960]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[980]},
+    {   1,    7,  0,    0,    1, &Font_Calibri_Bold_8_A8_Atlas[1000]},
+    {   3,    7,  0,    0,    1, &Font_Calibri_Bold_8_A8_Atlas[1007]},
+    {   2,    7,  0,    0,    1, &Font_Calibri_Bold_8_A8_Atlas[1028]},
+    {   4,    3,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[1042]},
+    {   4,    1,  0,    6,    1, &Font_Calibri_Bold_8_A8_Atlas[1054]},
+    {   1,    1,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[1058]},
+    {   3,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1059]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[1071]},
+    {   3,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1091]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[1103]},
+    {   4,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1123]},
+    {   2,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[1139]},
+    {   4,    5,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1149]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[1169]},
+    {   2,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[1189]},
+    {   2,    6,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[1199]},
+    {   4,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[1211]},
+    {   1,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[1231]},
+    {   6,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1236]},
+    {   4,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1260]},
+    {   4,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1276]},
+    {   4,    5,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1292]},
+    {   4,    5,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1312]},
+    {   3,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1332]},
+    {   3,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1344]},
+    {   3,    5,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[1356]},
+    {   4,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1371]},
+    {   4,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1387]},
+    {   6,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1403]},
+    {   3,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1427]},
+    {   4,    5,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1439]},
+    {   3,    4,  0,    2,    1, &Font_Calibri_Bold_8_A8_Atlas[1459]},
+    {   2,    7,  0,    0,    1, &Font_Calibri_Bold_8_A8_Atlas[1471]},
+    {   1,    7,  0,    0,    1, &Font_Calibri_Bold_8_A8_Atlas[1485]},
+    {   3,    7,  0,    0,    1, &Font_Calibri_Bold_8_A8_Atlas[1492]},
+    {   4,    2,  0,    1,    1, &Font_Calibri_Bold_8_A8_Atlas[1513]},
+    {   4,    1,  0,    0,    1, &Font_Calibri_Bold_8_A8_Atlas[1521]},
+};
+
+gui_const gui_font_t GUI_Font_Calibri_Bold_8_A8 = {
+    _GT("Calibri Bold"),
+    8,
+    0x20,
+    0x7f,
+    GUI_FLAG_FONT_A8,
+    Calibri_Bold_8_A8_CharTable
+};
@@ -34,18 +34,23 @@
 #define GUI_INTERNAL
 #include "gui/gui_private.h"
 #include "gui/gui.h"
+#include "widget/gui_window.h"
 #include "system/gui_sys.h"
 
 /**
  * \brief           GUI global structure
  */
-gui_t GUI;
+GUI_CFG_FAST_DATA gui_t GUI;
+
+#if GUI_CFG_USE_SPLASH || __DOXYGEN__
+static const gui_image_desc_t* splash_image;        /*!< Image drawn in \ref gui_init, kept outside \ref GUI to survive its reset */
+#endif /* GUI_CFG_USE_SPLASH || __DOXYGEN__ */
 
 /**
  * \brief           Clips are required to draw widget
  * \param[in]       h: Widget handle
  */
-static void
+GUI_CFG_FAST_CODE static void
 check_disp_clipping(gui_handle_p h) {
 #if !GUI_CFG_USE_POS_SIZE_CACHE
     gui_dim_t x, y, wi, hi;
@@ -55,6 +60,7 @@ check_disp_clipping(gui_handle_p h) {
     memcpy(&GUI.display_temp, &GUI.display, sizeof(GUI.display_temp));
     
 #if GUI_CFG_USE_POS_SIZE_CACHE
+    guii_widget_updateabs(h);
     if (GUI.display_temp.x1 == GUI_DIM_MAX || GUI.display_temp.x1 < h->abs_visible_x1) {
         GUI.display_temp.x1 = h->abs_visible_x1;
     }
@@ -109,288 +115,1428 @@ check_disp_clipping(gui_handle_p h) {
 #endif /* !GUI_CFG_USE_POS_SIZE_CACHE */
 }
 
+#if !GUI_CFG_USE_POS_SIZE_CACHE || __DOXYGEN__
+
 /**
- * \brief           Redraw all widgets of selected parent
- * \param[in]       parent: Parent widget handle to draw widgets on
- * \param[in]       force_redraw: Set to 1 to force drawing all widgets on linked list
- * \return          Number of widgets redrawn
+ * \brief           Clips are required to draw widget inside already clipped region of its parent
+ *
+ *                  Result is the same as with \ref check_disp_clipping,
+ *                  widgets above direct parent are already part of parent region
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       clip: Clipping region of parent widget
  */
-static uint32_t
-redraw_widgets(gui_handle_p parent, uint8_t force_redraw) {
+GUI_CFG_FAST_CODE static void
+check_disp_clipping_child(gui_handle_p h, const gui_display_t* clip) {
+    gui_dim_t x, y, wi, hi;
+    
+    /* Widget itself */
+    x = gui_widget_getabsolutex(h);
+    y = gui_widget_getabsolutey(h);
+    wi = gui_widget_getwidth(h);
+    hi = gui_widget_getheight(h);
+    GUI.display_temp.x1 = GUI_MAX(clip->x1, x);
+    GUI.display_temp.y1 = GUI_MAX(clip->y1, y);
+    GUI.display_temp.x2 = GUI_MIN(clip->x2, x + wi);
+    GUI.display_temp.y2 = GUI_MIN(clip->y2, y + hi);
+    
+    /* Inner area of direct parent */
+    x = guii_widget_getparentabsolutex(h);
+    y = guii_widget_getparentabsolutey(h);
+    wi = guii_widget_getparentinnerwidth(h);
+    hi = guii_widget_getparentinnerheight(h);
+    GUI.display_temp.x1 = GUI_MAX(GUI.display_temp.x1, x);
+    GUI.display_temp.y1 = GUI_MAX(GUI.display_temp.y1, y);
+    GUI.display_temp.x2 = GUI_MIN(GUI.display_temp.x2, x + wi);
+    GUI.display_temp.y2 = GUI_MIN(GUI.display_temp.y2, y + hi);
+}
+
+#endif /* !GUI_CFG_USE_POS_SIZE_CACHE || __DOXYGEN__ */
+
+/**
+ * \brief           Check if area of parent widget is fully painted by its opaque children
+ *
+ *                  Child covers area when it has \ref GUI_FLAG_WIDGET_OPAQUE flag set (or is itself covered by opaque children),
+ *                  is visible without transparency and its visible part inside parent covers complete area.
+ *
+ * \param[in]       parent: Parent widget handle
+ * \param[in]       area: Area to check for coverage
+ * \return          `1` if area is fully covered, `0` otherwise
+ */
+static uint8_t
+is_covered_by_opaque_children(gui_handle_p parent, const gui_display_t* area) {
     gui_handle_p h;
-    uint32_t cnt = 0;
-    static uint32_t level = 0;
+    gui_dim_t x1, y1, x2, y2, px, py;
 
-    /* Go through all elements of parent */
     GUI_LINKEDLIST_WIDGETSLISTNEXT(parent, h) {
-        if (!guii_widget_isvisible(h)) {            /* Check if visible */
-            guii_widget_clrflag(h, GUI_FLAG_REDRAW);/* Clear flag to be sure */
-            continue;                               /* Ignore hidden elements */
-        }
-        if (guii_widget_isinsideclippingregion(h, 1)) { /* If widget is inside clipping region and not fully covered by any of its siblings */
-            /* Draw main widget if required */
-            if (guii_widget_getflag(h, GUI_FLAG_REDRAW) || force_redraw) {    /* Check if redraw required */
+        if (!guii_widget_isvisible(h) || guii_widget_getflag(h, GUI_FLAG_OVERLAY)
 #if GUI_CFG_USE_ALPHA
-                gui_layer_t* layerPrev = GUI.lcd.drawing_layer; /* Save drawing layer */
-                uint8_t transparent = 0;
+            || guii_widget_hasalpha(h)
 #endif /* GUI_CFG_USE_ALPHA */
-                
-                guii_widget_clrflag(h, GUI_FLAG_REDRAW);    /* Clear flag for drawing on widget */
-                
-                /* Prepare clipping region for this widget drawing */
-                check_disp_clipping(h);             /* Check coordinates for drawings only particular widget */
+        ) {
+            continue;
+        }
 
-#if GUI_CFG_USE_ALPHA
-                /* Check alpha and check if blending function exists to merge layers later together */
-                if (guii_widget_hasalpha(h) /* && GUI.ll.CopyBlend != NULL */) {
-                    gui_dim_t width = GUI.display_temp.x2 - GUI.display_temp.x1;
-                    gui_dim_t height = GUI.display_temp.y2 - GUI.display_temp.y1;
-                    
-                    /* Try to allocate memory for new virtual layer for temporary usage */
-                    GUI.lcd.drawing_layer = GUI_MEMALLOC(sizeof(*GUI.lcd.drawing_layer) + (size_t)width * (size_t)height * (size_t)GUI.lcd.pixel_size);
-                    
-                    if (GUI.lcd.drawing_layer != NULL) {/* Check if allocation was successful */
-                        GUI.lcd.drawing_layer->width = width;
-                        GUI.lcd.drawing_layer->height = height;
-                        GUI.lcd.drawing_layer->x_pos = GUI.display_temp.x1;
-                        GUI.lcd.drawing_layer->y_pos = GUI.display_temp.y1;
-                        GUI.lcd.drawing_layer->start_address = ((uint8_t *)GUI.lcd.drawing_layer) + sizeof(*GUI.lcd.drawing_layer);
-                        transparent = 1;            /* We are going to transparent drawing mode */
-                    } else {
-                        GUI.lcd.drawing_layer = layerPrev;  /* Reset layer back */
-                    }
-                }
-#endif /* GUI_CFG_USE_ALPHA */
-                
-                /* Draw widget itself normally, don't care on layer offset and size */
-                GUI_EVT_PARAMTYPE_DISP(&GUI.evt_param) = &GUI.display_temp;
-                guii_widget_callback(h, GUI_EVT_DRAW, &GUI.evt_param, &GUI.evt_result);
-                
-                /* Check if there are children widgets in this widget */
-                if (guii_widget_haschildren(h)) {   /* Check if widget has children */
-                    /* ...now call function for actual redrawing process */
-                    /* Force children redraw operation, even if no redraw flag set */
-                    level++;
-                    cnt += redraw_widgets(h, 1);    /* Redraw children widgets */
-                    level--;
-                }
-                
-                /* TODO: Copy previous temporary variables instead of calling function again */
-                /* Prepare clipping region for this widget drawing */
-                check_disp_clipping(h);             /* Check coordinates for drawings only particular widget */
-                
-                /* Draw widget itself normally, don't care on layer offset and size */
-                GUI_EVT_PARAMTYPE_DISP(&GUI.evt_param) = &GUI.display_temp;
-                guii_widget_callback(h, GUI_EVT_DRAWAFTER, &GUI.evt_param, &GUI.evt_result);
-                
-#if GUI_CFG_USE_ALPHA
-                /* If transparent mode is used on widget, copy content back */
-                if (transparent) {                  /* If we are in transparent mode */
-                    /* Copy layers with blending */
-                    if (GUI.ll.CopyBlend != NULL) { /* Hardware way */
-                        GUI.ll.CopyBlend(&GUI.lcd, GUI.lcd.drawing_layer,
-                            (void *)(((uint8_t *)layerPrev->start_address) +
-                                GUI.lcd.pixel_size * (layerPrev->width * (GUI.lcd.drawing_layer->y_pos - layerPrev->y_pos) + (GUI.lcd.drawing_layer->x_pos - layerPrev->x_pos))),
-                            (void *)GUI.lcd.drawing_layer->start_address,
-                            gui_widget_getalpha(h), 0xFF,
-                            GUI.lcd.drawing_layer->width, GUI.lcd.drawing_layer->height,
-                            layerPrev->width - GUI.lcd.drawing_layer->width, 0
-                        );
-                    } else {                        /* Software way, ugly and slow way */
-                        gui_dim_t x, y, dxo, dyo;
-                        gui_color_t fg, bg;
-                        uint8_t r, g, b;
-                        float a;
-
-                        /* Get difference in offset */
-                        dxo = GUI.lcd.drawing_layer->x_pos - layerPrev->x_pos;
-                        dyo = GUI.lcd.drawing_layer->y_pos - layerPrev->y_pos;;
-
-                        a = GUI_FLOAT(gui_widget_getalpha(h)) / GUI_FLOAT(0xFF);
-                        for (y = 0; y < GUI.lcd.drawing_layer->height; y++) {
-                            for (x = 0; x < GUI.lcd.drawing_layer->width; x++) {
-                                fg = GUI.ll.GetPixel(&GUI.lcd, GUI.lcd.drawing_layer, x, y);
-                                bg = GUI.ll.GetPixel(&GUI.lcd, layerPrev, dxo + x, dyo + y);
-
-                                r = GUI_U8(((fg >> 16) & 0xFF) * a + (1.0f - a) * ((bg >> 16) & 0xFF));
-                                g = GUI_U8(((fg >> 8) & 0xFF) * a + (1.0f - a) * ((bg >> 8) & 0xFF));
-                                b = GUI_U8(((fg >> 0) & 0xFF) * a + (1.0f - a) * ((bg >> 0) & 0xFF));
-                                
-                                fg = (gui_color_t)(0xFF000000UL | (uint8_t)r << 16 | (uint8_t)g << 8 | (uint8_t)b);
-                                
-                                GUI.ll.SetPixel(&GUI.lcd, layerPrev, dxo + x, dyo + y, fg);
-                            }
-                        }                        
-                    }
-                    
-                    GUI_MEMFREE(GUI.lcd.drawing_layer); /* Free memory for virtual layer */
-                    GUI.lcd.drawing_layer = layerPrev;  /* Reset layer pointer */
-                }
-#endif /* GUI_CFG_USE_ALPHA */
+        /* Get part of child visible inside parent inner area */
+        x1 = gui_widget_getabsolutex(h);
+        y1 = gui_widget_getabsolutey(h);
+        x2 = x1 + gui_widget_getwidth(h);
+        y2 = y1 + gui_widget_getheight(h);
+        px = guii_widget_getparentabsolutex(h);
+        py = guii_widget_getparentabsolutey(h);
+        x1 = GUI_MAX(x1, px);
+        y1 = GUI_MAX(y1, py);
+        x2 = GUI_MIN(x2, px + guii_widget_getparentinnerwidth(h));
+        y2 = GUI_MIN(y2, py + guii_widget_getparentinnerheight(h));
 
-                cnt++;
-            /* Check if any child widget needs drawing */
-            } else if (guii_widget_haschildren(h)) {
-                cnt += redraw_widgets(h, 0);        /* Redraw children widgets */
+        if (x1 <= area->x1 && y1 <= area->y1 && x2 >= area->x2 && y2 >= area->y2) {
+            if (guii_widget_getcoreflag(h, GUI_FLAG_WIDGET_OPAQUE)
+                || (guii_widget_haschildren(h) && is_covered_by_opaque_children(h, area))) {
+                return 1;
             }
         }
     }
-    return cnt;                                     /* Return number of redrawn objects */
+    return 0;
 }
 
-#if GUI_CFG_USE_TOUCH
+#if GUI_CFG_USE_COVERAGE_MASK || __DOXYGEN__
+
+#define COVERAGE_TILE                   ((gui_dim_t)GUI_CFG_COVERAGE_TILE_SIZE)
 
 /**
- * \brief           Set relative coordinate of touch on widget
+ * \brief           Mark tiles of drawing region which are completely covered by opaque children of widget
  *
- *					Relative coordinates are calculated based on widget position on screen
- *					and actual absolute X and Y values from touch event
- * \param[in,out]   ts: Raw touch data with X and Y position
- * \param[in]       h: Widget handle. Set to `NULL` to use default value
+ *                  Only children which are drawn after widget in the same region are used,
+ *                  fills of widget then skip covered tiles. Mask is active only when at least one tile is covered
+ *
+ * \param[in]       parent: Widget to be drawn
+ * \param[in]       clip: Drawing region of widget
  */
 static void
-set_relative_coordinate(guii_touch_data_t* ts, gui_touch_data_t* old, gui_handle_p h) {
-    uint8_t i = 0;
+coverage_build(gui_handle_p parent, const gui_display_t* clip) {
+    guii_coverage_t* cv = &GUI.coverage;
+    gui_handle_p h;
+    gui_dim_t x1, y1, x2, y2, px, py, tx, ty, tx1, ty1, tx2, ty2;
+    size_t words;
 
-    /* Get absolute position */
-    if (h != NULL) {
-        ts->widget_x = gui_widget_getabsolutex(h);
-        ts->widget_y = gui_widget_getabsolutey(h);
-        ts->widget_width = gui_widget_getwidth(h);
-        ts->widget_height = gui_widget_getheight(h);
-    } else {
-        ts->widget_x = 0;
-        ts->widget_y = 0;
-        ts->widget_width = gui_lcd_getwidth();
-        ts->widget_height = gui_lcd_getheight();
+    cv->active = 0;
+    if (clip->x2 <= clip->x1 || clip->y2 <= clip->y1) {
+        return;
     }
-    
-    /* Calculate values */
-    for (i = 0; i < ts->ts.count; i++) {
-        /* Get previous values  */
-        ts->x_old[i] = old->x[i];
-        ts->y_old[i] = old->y[i];
+    cv->x = clip->x1 & ~(COVERAGE_TILE - 1);
+    cv->y = clip->y1 & ~(COVERAGE_TILE - 1);
+    cv->cols = (clip->x2 - cv->x + COVERAGE_TILE - 1) / COVERAGE_TILE;
+    cv->rows = (clip->y2 - cv->y + COVERAGE_TILE - 1) / COVERAGE_TILE;
+    words = ((size_t)cv->cols * (size_t)cv->rows + 31) / 32;
+    if (words > cv->size) {                         /* Grow mask, it is kept for next widgets */
+        uint32_t* tiles = GUI_MEMREALLOC(cv->tiles, words * sizeof(*tiles));
+        if (tiles == NULL) {
+            return;
+        }
+        cv->tiles = tiles;
+        cv->size = words;
+    }
+    memset(cv->tiles, 0x00, words * sizeof(*cv->tiles));
 
-        /* Calculate difference new value versus old */
-        ts->x_diff[i] = ts->ts.x[i] - ts->x_old[i];
-        ts->y_diff[i] = ts->ts.y[i] - ts->y_old[i];
+    GUI_LINKEDLIST_WIDGETSLISTNEXT(parent, h) {
+        if (!guii_widget_getcoreflag(h, GUI_FLAG_WIDGET_OPAQUE)
+            || !guii_widget_isvisible(h) || guii_widget_getflag(h, GUI_FLAG_OVERLAY)
+#if GUI_CFG_USE_ALPHA
+            || guii_widget_hasalpha(h)
+#endif /* GUI_CFG_USE_ALPHA */
+        ) {
+            continue;
+        }
 
-        /* Calculate widget relative coordinate */
-        ts->x_rel[i] = ts->ts.x[i] - ts->widget_x;
-        ts->y_rel[i] = ts->ts.y[i] - ts->widget_y;
+        /* Get part of child visible inside parent inner area and drawing region */
+        x1 = gui_widget_getabsolutex(h);
+        y1 = gui_widget_getabsolutey(h);
+        x2 = x1 + gui_widget_getwidth(h);
+        y2 = y1 + gui_widget_getheight(h);
+        px = guii_widget_getparentabsolutex(h);
+        py = guii_widget_getparentabsolutey(h);
+        x1 = GUI_MAX(GUI_MAX(x1, px), clip->x1);
+        y1 = GUI_MAX(GUI_MAX(y1, py), clip->y1);
+        x2 = GUI_MIN(GUI_MIN(x2, px + guii_widget_getparentinnerwidth(h)), clip->x2);
+        y2 = GUI_MIN(GUI_MIN(y2, py + guii_widget_getparentinnerheight(h)), clip->y2);
+        if (x2 <= x1 || y2 <= y1 || !guii_widget_isinsideclippingregion(h, 1)) {
+            continue;                               /* Child is not drawn in this region */
+        }
+
+        /* Tiles cut by drawing region are covered when child covers their part inside region */
+        tx1 = x1 == clip->x1 ? 0 : (x1 - cv->x + COVERAGE_TILE - 1) / COVERAGE_TILE;
+        ty1 = y1 == clip->y1 ? 0 : (y1 - cv->y + COVERAGE_TILE - 1) / COVERAGE_TILE;
+        tx2 = x2 == clip->x2 ? cv->cols : (x2 - cv->x) / COVERAGE_TILE;
+        ty2 = y2 == clip->y2 ? cv->rows : (y2 - cv->y) / COVERAGE_TILE;
+        for (ty = ty1; ty < ty2; ty++) {
+            for (tx = tx1; tx < tx2; tx++) {
+                size_t bit = (size_t)ty * (size_t)cv->cols + (size_t)tx;
+                cv->tiles[bit >> 5] |= (uint32_t)1 << (bit & 0x1F);
+                cv->active = 1;
+            }
+        }
     }
+}
 
-#if GUI_CFG_TOUCH_MAX_PRESSES > 1
-    if (ts->ts.count == 2) {                        /* 2 points detected */
-        ts->distance_old = ts->distance;            /* Save old distance */
-        gui_math_distancebetweenxy(ts->x_rel[0], ts->y_rel[0], ts->x_rel[1], ts->y_rel[1], &ts->distance);  /* Calculate distance between 2 points */
+#endif /* GUI_CFG_USE_COVERAGE_MASK || __DOXYGEN__ */
+
+#if GUI_CFG_USE_WIDGET_CACHE
+
+/**
+ * \brief           Get cache layer of widget, allocate it if necessary
+ * \param[in]       h: Widget handle
+ * \param[out]      valid: Set to `1` when cached content may be copied to screen or `0` when widget must be rendered to cache first
+ * \return          Cache layer on success, `NULL` if widget must be drawn without cache
+ */
+static gui_layer_t*
+get_widget_cache(gui_handle_p h, uint8_t* valid) {
+    gui_layer_t* cache = h->cache_layer;
+    gui_display_t disp;
+    gui_dim_t x, y, wi, hi;
+    size_t size;
+
+    x = gui_widget_getabsolutex(h);
+    y = gui_widget_getabsolutey(h);
+    wi = gui_widget_getwidth(h);
+    hi = gui_widget_getheight(h);
+
+    /* Get complete visible area of widget on screen */
+    memcpy(&disp, &GUI.display, sizeof(disp));
+    GUI.display.x1 = 0;
+    GUI.display.y1 = 0;
+    GUI.display.x2 = GUI.lcd.width;
+    GUI.display.y2 = GUI.lcd.height;
+    check_disp_clipping(h);
+    memcpy(&GUI.display, &disp, sizeof(GUI.display));
+
+    if (cache != NULL && (cache->width != wi || cache->height != hi)) {
+        guii_widget_freecache(h);                   /* Widget size changed, allocate new layer */
+        cache = NULL;
+    }
+    if (cache == NULL) {
+        if (wi <= 0 || hi <= 0) {
+            return NULL;
+        }
+        size = sizeof(*cache) + (size_t)wi * (size_t)hi * (size_t)GUI.lcd.pixel_size + GUI_LCD_TILES_SIZE(wi, hi);
+        if (GUI.widget_cache_size + size > GUI_CFG_WIDGET_CACHE_SIZE) {
+            return NULL;                            /* Out of cache budget */
+        }
+        cache = GUI_MEMALLOC_CLASS(size, GUI_MEM_CLASS_PIXEL);
+        if (cache == NULL) {
+            return NULL;
+        }
+        cache->width = wi;
+        cache->height = hi;
+        cache->start_address = ((uint8_t *)cache) + sizeof(*cache);
+        cache->pixel_format = GUI.lcd.layers[0].pixel_format;
+        GUI_LCD_TILES_INIT(cache);
+        GUI.widget_cache_size += size;
+        h->cache_layer = cache;
     }
-#endif /* GUI_CFG_TOUCH_MAX_PRESSES > 1 */
+
+    /* Cached content is valid only if widget was not invalidated and it did not move since */
+    *valid = guii_widget_getflag(h, GUI_FLAG_CACHE_VALID) && cache->x_pos == x && cache->y_pos == y
+        && cache->display.x1 == GUI.display_temp.x1 && cache->display.y1 == GUI.display_temp.y1
+        && cache->display.x2 == GUI.display_temp.x2 && cache->display.y2 == GUI.display_temp.y2;
+    cache->x_pos = x;
+    cache->y_pos = y;
+    memcpy(&cache->display, &GUI.display_temp, sizeof(cache->display));
+    return cache;
 }
 
-/*
- * How touch events work
- *
- * When using touch, 3 events are supported on widget:
- *  - TouchStart: Triggered when touch is going from released status to pressed status (touch just pressed)
- *  - TouchMove: Triggered when touch is in pressed status and new pressed event is received (finger is moving on widget pressed on touch panel)
- *  - TouchEnd: Triggered when touch is going from pressed status to released. Finger has been just released from touch panel
- *
- * Besides, with these 3 basic touch events, it is possible to handle 3 more events,
- *         which may not be used just with touch but can also be used with mouse
- *  - Click: Triggered when pressed state is detected and after that released state, still on widget coordinates
- *  - LongClick: Triggered when pressed state is detected for x amount of time (usually 2 seconds)
- *  - DblClick: Triggered when 2 Click events are detected in range of defined time
- *
- * To be able to detect DblClick, 2 Click events must be valid in certain time.
- *
- * Since second events are based on first 3 events for touch, first events must be respected for proper handling second ones.
- *
- * Each widget receives a callback for TouchStart, TouchMove and TouchEnd events.
- * Callback function can return status if event is processed or not. On the returned value 2 things are possible.
- *
- * Consider using button and dropdown. In button, everything what matters is TouchStart and TouchEnd.
- * If TouchMove happens, it is not necessary to handle because only press is needed for detection.
- * In this case, if TouchStart happen and TouchMove too (finger moved inside widget),
- * click event will happen after TouchEnd event, because TouchMove command was ignored and 0 was returned on callback.
+/**
+ * \brief           Copy current clipping region of widget from its cache layer to drawing layer
  *
- * In dropdown mode it is different because TouchMove is required to detect sliding on items.
- * If TouchMove is detected and 1 is returned from callback, Click event won't be called after TouchEnd event,
- * even if release was inside widget. This is not valid Click because TouchMove was required for something.
- * If Click event would be also triggered in this case, after sliding, item value would be automatically selected which is wrong.
- * In this case, Click event is detected only if TouchMove is not detected (TouchStart and after immediatelly TouchEnd).
+ *                  Transparent widget is blended with its alpha instead,
+ *                  changing alpha does not require widget to be rendered again
  *
- * This is all handled by this "thread" function
+ * \param[in]       h: Widget handle
  */
+static void
+copy_widget_cache(gui_handle_p h) {
+    gui_layer_t* cache = h->cache_layer;
+    gui_layer_t* drawing = GUI.lcd.drawing_layer;
+    const gui_display_t* disp = &GUI.display_temp;
+
+    if (disp->x2 <= disp->x1 || disp->y2 <= disp->y1) {
+        return;
+    }
+#if GUI_CFG_USE_ALPHA
+    if (guii_widget_hasalpha(h)) {
+        void* dst, *src;
+
+        dst = (void *)(((uint8_t *)drawing->start_address) + GUI.lcd.pixel_size * ((disp->y1 - drawing->y_pos) * drawing->width + (disp->x1 - drawing->x_pos)));
+        src = (void *)(((uint8_t *)cache->start_address) + GUI.lcd.pixel_size * ((disp->y1 - cache->y_pos) * cache->width + (disp->x1 - cache->x_pos)));
+        GUI_LL(CopyBlend)(&GUI.lcd, drawing, dst, src, gui_widget_getalpha(h), 0xFF,
+            disp->x2 - disp->x1,                    /* Area width */
+            disp->y2 - disp->y1,                    /* Area height */
+            drawing->width - (disp->x2 - disp->x1), /* Offline destination */
+            cache->width - (disp->x2 - disp->x1)    /* Offline source */
+        );
+        return;
+    }
+#endif /* GUI_CFG_USE_ALPHA */
+    guii_lcd_copylayer(drawing, cache, disp->x1, disp->y1, disp->x2, disp->y2);
+}
+
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+
+#if GUI_CFG_USE_DISPLAY_LIST || __DOXYGEN__
 
 /**
- * \brief           Touch event proto thread 
+ * \brief           Draw widget from its display list or record new list during draw callback
  *
- *                  Designed as non-blocking event thread for processing input touch events.
- * \param[in]       ts: Touch information with X and Y positions
- * \param[in]       old: Old touch information
- * \param[in]       v: Is input value valid or is just "check" call
- * \param[out]      result: Result of event, if any
- * \return          PT thread result
+ *                  List is replayed when it was recorded for the same position and visible area of widget.
+ *                  New list is recorded only when complete visible area of widget is redrawn at once
+ *
+ * \param[in]       h: Widget handle
  */
-static
-PT_THREAD(__TouchEvents_Thread(guii_touch_data_t* const ts, gui_touch_data_t* const old, uint8_t v, gui_widget_evt_t* const result)) {
-    static volatile uint32_t time;
-    static uint8_t i = 0;
-    static gui_dim_t x[2], y[2];
+static void
+draw_widget_list(gui_handle_p h) {
+    gui_draw_list_t* list = h->draw_list;
+    const gui_display_t* disp = &GUI.display_temp;
+    uint8_t record;
+    
+    if (list != NULL && list->valid && list->x == h->abs_x && list->y == h->abs_y
+        && list->area_x1 == h->abs_visible_x1 && list->area_y1 == h->abs_visible_y1
+        && list->area_x2 == h->abs_visible_x2 && list->area_y2 == h->abs_visible_y2) {
+        gui_draw_list_replay(disp, list);
+        return;
+    }
+    
+    record = disp->x1 == h->abs_visible_x1 && disp->y1 == h->abs_visible_y1
+        && disp->x2 == h->abs_visible_x2 && disp->y2 == h->abs_visible_y2
+        && (list == NULL || !list->failed);
+    if (record && list == NULL) {
+        list = h->draw_list = GUI_MEMALLOC(sizeof(*list));
+        record = list != NULL;
+    }
+    if (record) {
+        gui_draw_list_start(list);
+    }
+    guii_widget_callback(h, GUI_EVT_DRAW, &GUI.evt_param, &GUI.evt_result);
+    if (record && gui_draw_list_stop(list)) {       /* Save geometry list is valid for */
+        list->x = h->abs_x;
+        list->y = h->abs_y;
+        list->area_x1 = h->abs_visible_x1;
+        list->area_y1 = h->abs_visible_y1;
+        list->area_x2 = h->abs_visible_x2;
+        list->area_y2 = h->abs_visible_y2;
+    }
+}
 
-    *result = (gui_widget_evt_t)0;                  /* Reset widget control variable */          
+#endif /* GUI_CFG_USE_DISPLAY_LIST || __DOXYGEN__ */
 
-    PT_BEGIN(&ts->pt);                              /* Start thread execution */
+#if GUI_CFG_USE_ALPHA || __DOXYGEN__
 
-    memset(x, 0x00, sizeof(x));                     /* Reset X values */
-    memset(y, 0x00, sizeof(y));                     /* Reset Y values */
-    for (i = 0; i < 2;) {                           /* Allow up to 2 touch presses */
+/**
+ * \brief           Get scratch layer for drawing transparent widget
+ *
+ *                  Layer is taken from frame scratch memory when it fits there,
+ *                  otherwise layer of current nesting level is reused and grown when necessary.
+ *                  Content of layer is not cleared.
+ *
+ * \param[in]       width: Layer width
+ * \param[in]       height: Layer height
+ * \return          Layer on success, `NULL` otherwise
+ */
+static gui_layer_t*
+alpha_layer_get(gui_dim_t width, gui_dim_t height) {
+    gui_layer_t* layer;
+    size_t size;
 
-        /* Wait for valid input with pressed state */
-        PT_WAIT_UNTIL(&ts->pt, v && ts->ts.status && !old->status && ts->ts.count == 1);
+    if (width <= 0 || height <= 0) {
+        return NULL;
+    }
+    size = (size_t)width * (size_t)height * (size_t)GUI.lcd.pixel_size;
+#if GUI_CFG_USE_MEM_FRAME
+    if (sizeof(*layer) + size <= gui_mem_frame_getfree()) {    /* Pool is used only for layers larger than free scratch memory */
+        if ((layer = GUI_MEMALLOC_FRAME(sizeof(*layer) + size)) != NULL) {
+            memset(layer, 0x00, sizeof(*layer));    /* Scratch memory is not cleared */
+        }
+    } else
+#endif /* GUI_CFG_USE_MEM_FRAME */
+    if (GUI.alpha_depth < GUI_CFG_ALPHA_SCRATCH_LAYERS) {
+        layer = GUI.alpha_layers[GUI.alpha_depth];
+        if (layer == NULL || GUI.alpha_layers_size[GUI.alpha_depth] < size) {
+            if (layer != NULL) {
+                GUI_MEMFREE(layer);                 /* Old layer is too small */
+            }
+            layer = GUI_MEMALLOC_CLASS(sizeof(*layer) + size, GUI_MEM_CLASS_PIXEL);
+            GUI.alpha_layers[GUI.alpha_depth] = layer;
+            GUI.alpha_layers_size[GUI.alpha_depth] = layer != NULL ? size : 0;
+        }
+    } else {
+        layer = GUI_MEMALLOC_CLASS(sizeof(*layer) + size, GUI_MEM_CLASS_PIXEL); /* Too deep for pool, use temporary layer */
+    }
+    if (layer != NULL) {
+        layer->width = width;
+        layer->height = height;
+        layer->start_address = ((uint8_t *)layer) + sizeof(*layer);
+        GUI.alpha_depth++;
+    }
+    return layer;
+}
 
-        time = ts->ts.time;                         /* Get start time of this touch */
-        x[i] = ts->x_rel[0];                        /* Save X value */
-        y[i] = ts->y_rel[0];                        /* Save Y value */
-        
-        /* Either wait for released status or timeout */
-        do {
-            PT_YIELD(&ts->pt);                      /* Stop thread for now and wait next call */
+/**
+ * \brief           Release scratch layer after transparent widget is blended
+ * \param[in]       layer: Layer returned by \ref alpha_layer_get
+ */
+static void
+alpha_layer_put(gui_layer_t* layer) {
+    GUI.alpha_depth--;
+    if (GUI.alpha_depth >= GUI_CFG_ALPHA_SCRATCH_LAYERS || GUI.alpha_layers[GUI.alpha_depth] != layer) {
+        GUI_MEMFREE_FRAME(layer);                   /* Temporary layer outside of pool */
+    }
+}
 
-            /* Wait for new data */
-            /* Wait touch with released state or timeout */
-            PT_WAIT_UNTIL(&ts->pt, v || (gui_sys_now() - time) > GUI_CFG_LONG_CLICK_TIMEOUT);
+/**
+ * \brief           Blend complete scratch layer to layer below it in software
+ * \param[in]       dst: Layer to blend to
+ * \param[in]       src: Scratch layer with widget content
+ * \param[in]       a: Widget alpha
+ */
+static void
+alpha_layer_blend(gui_layer_t* dst, const gui_layer_t* src, uint8_t a) {
+    gui_dim_t x, y;
+    size_t off = (size_t)(src->y_pos - dst->y_pos) * dst->width + (src->x_pos - dst->x_pos);
 
-            /* We have new touch entry, but we do
-               not yet if it is "pressed" or "released" */
-            if (v) {
-                /*
-                 * If touch is still pressed (touch move) and we have active widget and touch move event was not processed
-                 * then we can use click events also after touch move (for example, button is that widget) where in
-                 * some cases, click event should not be processed after touch move (slider, dropdown, etc)
-                 */
-                if (ts->ts.status && GUI.active_widget != NULL && !guii_widget_getflag(GUI.active_widget, GUI_FLAG_TOUCH_MOVE)) {
-                    time = ts->ts.time;             /* Get start time of this touch */
-                    x[i] = ts->x_rel[0];            /* Update X value */
-                    y[i] = ts->y_rel[0];            /* Update Y value */
-                    continue;                       /* Continue and wait for next (released) event */
-                } else {                            /* Released status received */
-                    break;                          /* Stop execution, continue later */
+    gui_lcd_fence();                                /* Hardware may still draw to layers */
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+    {
+        const gui_layer_access_t* acc;
+        gui_layer_access_t sa;
+        const uint8_t* sp;
+        uint8_t* dp;
+        size_t sps, dps;
+        
+        GUI_UNUSED(off);
+        if ((acc = guii_lcd_getaccess(src, 1)) != NULL) {
+            sa = *acc;                              /* Access is cached for single layer only */
+            acc = guii_lcd_getaccess(dst, 1);
+        }
+        if (acc == NULL) {                          /* Blend with low-level pixel functions */
+            for (y = 0; y < src->height; y++) {
+                for (x = 0; x < src->width; x++) {
+                    gui_dim_t dx = src->x_pos - dst->x_pos + x, dy = src->y_pos - dst->y_pos + y;
+                    
+                    GUI_LL(SetPixel)(&GUI.lcd, dst, dx, dy, 0xFF000000UL | guii_blend_color(GUI_LL(GetPixel)(&GUI.lcd, (gui_layer_t *)src, x, y),
+                        GUI_LL(GetPixel)(&GUI.lcd, dst, dx, dy), a));
                 }
             }
-            else {
-                break;                              /* Stop while loop execution */
+            return;
+        }
+        sps = sa.format == GUI_PIXEL_FORMAT_RGB565 ? 2 : 4;
+        dps = acc->format == GUI_PIXEL_FORMAT_RGB565 ? 2 : 4;
+        for (y = 0; y < src->height; y++) {
+            sp = sa.base + (size_t)y * sa.stride;
+            dp = guii_access_addr(acc, dst, src->x_pos, src->y_pos + y);
+            for (x = 0; x < src->width; x++, sp += sps, dp += dps) {
+                guii_access_setpixel(acc, dp, 0xFF000000UL | guii_blend_color(guii_access_getpixel(&sa, sp), guii_access_getpixel(acc, dp), a));
             }
-        } while (1);
+        }
+    }
+#else /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+    if (src->pixel_format == GUI_PIXEL_FORMAT_RGB565) {
+        const uint16_t* s = src->start_address;
+        uint16_t* d = (uint16_t *)dst->start_address + off;
+        for (y = 0; y < src->height; y++, d += dst->width - src->width) {
+            for (x = 0; x < src->width; x++, s++, d++) {
+                *d = GUI_COLOR_TO_RGB565(guii_blend_color(GUI_COLOR_FROM_RGB565(*s), GUI_COLOR_FROM_RGB565(*d), a));
+            }
+        }
+    } else {
+        const uint32_t* s = src->start_address;
+        uint32_t* d = (uint32_t *)dst->start_address + off;
+        for (y = 0; y < src->height; y++, d += dst->width - src->width) {
+            for (x = 0; x < src->width; x++, s++, d++) {
+                *d = 0xFF000000UL | guii_blend_color(*s, *d, a);
+            }
+        }
+    }
+#endif /* !GUI_CFG_USE_LL_DIRECT_ACCESS */
+}
 
-        /* Check what was the reason for thread to continue */
-        if (v) {                                    /* New touch event occurred */
-            if (!ts->ts.status) {                   /* We received released state */
+#endif /* GUI_CFG_USE_ALPHA || __DOXYGEN__ */
 
-                /* Try to get second click, check difference for double click */
-                /* Difference was too big, reset and act like normal click */
-                if (i && (GUI_ABS(x[0] - x[1]) > 30 || GUI_ABS(y[0] - y[1]) > 30)) {
+#if GUI_CFG_USE_PROFILER || __DOXYGEN__
+
+/**
+ * \brief           Add cycles to profiler entry of widget
+ * \param[in]       entries: Array of entries
+ * \param[in]       len: Number of entries in array
+ * \param[in]       h: Widget handle
+ * \param[in]       by_id: Set to `1` to match entry by widget ID or `0` by widget type
+ * \param[in]       cycles: Number of cycles spent for widget
+ */
+static void
+profiler_add_entry(gui_profiler_entry_t* entries, size_t len, gui_handle_p h, uint8_t by_id, uint32_t cycles) {
+    size_t i;
+    
+    for (i = 0; i < len; i++) {
+        if (entries[i].widget == NULL) {            /* First free entry, entries are added in order */
+            entries[i].widget = h->widget;
+            entries[i].id = h->id;
+            break;
+        } else if (entries[i].widget == h->widget && (!by_id || entries[i].id == h->id)) {
+            break;
+        }
+    }
+    if (i < len) {                                  /* New widgets are not counted when table is full */
+        entries[i].count++;
+        entries[i].cycles += cycles;
+    }
+}
+
+/**
+ * \brief           Count draw callback cycles for widget
+ * \param[in]       h: Widget handle
+ * \param[in]       cycles: Number of cycles spent in draw callback
+ */
+static void
+profiler_add_draw(gui_handle_p h, uint32_t cycles) {
+    GUI.profiler.current.draw_cycles += cycles;
+    GUI.profiler.current.widgets++;
+    profiler_add_entry(GUI.profiler.types, GUI_CFG_PROFILER_TYPES, h, 0, cycles);
+    profiler_add_entry(GUI.profiler.ids, GUI_CFG_PROFILER_IDS, h, 1, cycles);
+}
+
+/**
+ * \brief           Finish frame record, save it to ring buffer and notify user
+ */
+static void
+profiler_end_frame(void) {
+    GUI.profiler.frames[GUI.profiler.frames_count % GUI_CFG_PROFILER_FRAMES] = GUI.profiler.current;
+    GUI.profiler.frames_count++;
+    if (GUI.profiler.fn != NULL) {
+        GUI.profiler.fn(&GUI.profiler.current);
+    }
+    memset(&GUI.profiler.current, 0x00, sizeof(GUI.profiler.current));
+}
+
+#define PROFILER_START(var)         uint32_t var = GUI_CFG_PROFILER_CYCLES()
+#define PROFILER_ELAPSED(var)       (GUI_CFG_PROFILER_CYCLES() - (var))
+#endif /* GUI_CFG_USE_PROFILER || __DOXYGEN__ */
+
+#if GUI_CFG_USE_LATENCY || __DOXYGEN__
+
+/**
+ * \brief           Save latency sample when measured touch reached display
+ */
+static void
+latency_save(void) {
+    gui_latency_t* l = &GUI.latency;
+    uint32_t total;
+
+    if (l->state != GUI_LATENCY_CONFIRMED) {
+        return;
+    }
+    total = l->confirmed - l->received;
+    l->samples[l->stat.count % GUI_CFG_LATENCY_SAMPLES] = total;
+    if (l->stat.count == 0 || total < l->stat.min) {
+        l->stat.min = total;
+    }
+    if (total > l->stat.max) {
+        l->stat.max = total;
+    }
+    l->stat.count++;
+    l->stat.avg += total;
+    l->stat.queue_avg += l->dispatch - l->received;
+    l->stat.process_avg += l->dispatched - l->dispatch;
+    l->stat.render_avg += l->rendered - l->dispatched;
+    l->stat.confirm_avg += l->confirmed - l->rendered;
+    l->state = GUI_LATENCY_IDLE;                    /* Ready for next touch */
+}
+
+#endif /* GUI_CFG_USE_LATENCY || __DOXYGEN__ */
+
+#if GUI_CFG_USE_REDRAW_DEBUG || __DOXYGEN__
+
+/**
+ * \brief           Add widget draw to heatmap
+ * \param[in]       disp: Area drawn by widget
+ */
+static void
+redraw_debug_count(const gui_display_t* disp) {
+    gui_dim_t x, y, x1, y1, x2, y2;
+    uint8_t* p;
+    
+    if (GUI.heatmap == NULL) {
+        return;
+    }
+    x1 = GUI_MAX(disp->x1, 0);
+    y1 = GUI_MAX(disp->y1, 0);
+    x2 = GUI_MIN(disp->x2, GUI.lcd.width);
+    y2 = GUI_MIN(disp->y2, GUI.lcd.height);
+    for (y = y1; y < y2; y++) {
+        p = &GUI.heatmap[(size_t)y * (size_t)GUI.lcd.width + x1];
+        for (x = x1; x < x2; x++, p++) {
+            if (*p < 0xFF) {
+                (*p)++;
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Get heatmap color for number of draws
+ * \note            Each color covers twice as many draws as previous one
+ * \param[in]       cnt: Number of draws of pixel
+ * \return          Overlay color
+ */
+static gui_color_t
+redraw_debug_color(uint8_t cnt) {
+    static const gui_color_t colors[] = {
+        GUI_COLOR_BLUE, GUI_COLOR_CYAN, GUI_COLOR_GREEN, GUI_COLOR_YELLOW, GUI_COLOR_RED
+    };
+    size_t i;
+    
+    for (i = 0; cnt > 1 && i < (GUI_COUNT_OF(colors) - 1); i++) {
+        cnt >>= 1;
+    }
+    return colors[i];
+}
+
+/**
+ * \brief           Draw redraw debug overlay over area drawn in current frame
+ *
+ *                  Heatmap is drawn as checkerboard pattern to keep original content visible
+ *
+ * \param[in]       clip: Area of current dirty region or band
+ * \param[in]       regions: Dirty regions of frame
+ * \param[in]       regions_count: Number of dirty regions
+ */
+static void
+redraw_debug_overlay(const gui_display_t* clip, const gui_display_t* regions, size_t regions_count) {
+    gui_dim_t x, y;
+    size_t i;
+    uint8_t cnt;
+    
+    if (GUI.heatmap != NULL) {
+        for (y = GUI_MAX(clip->y1, 0); y < GUI_MIN(clip->y2, GUI.lcd.height); y++) {
+            for (x = GUI_MAX(clip->x1, 0); x < GUI_MIN(clip->x2, GUI.lcd.width); x++) {
+                if (!((x + y) & 1)) {
+                    continue;
+                }
+                cnt = GUI.heatmap[(size_t)y * (size_t)GUI.lcd.width + x];
+                if (cnt) {
+                    gui_draw_setpixel(clip, x, y, redraw_debug_color(cnt));
+                }
+            }
+        }
+    }
+    if (GUI.redraw_debug & GUI_REDRAW_DEBUG_REGIONS) {
+        for (i = 0; i < regions_count; i++) {
+            gui_draw_rectangle(clip, regions[i].x1, regions[i].y1, regions[i].x2 - regions[i].x1, regions[i].y2 - regions[i].y1, GUI_COLOR_RED);
+        }
+    }
+}
+
+#endif /* GUI_CFG_USE_REDRAW_DEBUG || __DOXYGEN__ */
+
+#if GUI_CFG_USE_WIDGET_ORDER || __DOXYGEN__
+
+/**
+ * \brief           Rebuild flattened draw order of widget tree if tree changed
+ * \note            Called only before drawing or touch processing, array must stay unchanged while it is scanned
+ * \return          `1` when order array is valid, `0` when widget tree linked lists must be used
+ */
+static uint8_t
+widget_order_update(void) {
+    gui_handle_p h;
+    guii_widget_order_t* e;
+    size_t count = 1, p = 0;
+
+    if (GUI.order_valid) {
+        return 1;
+    }
+
+    /* Root entry is first, widgets follow in pre-order */
+    h = gui_linkedlist_widgetgetnext(NULL, NULL);
+    do {
+        if (count >= GUI.order_size) {      /* Grow array */
+            size_t size = GUI.order_size > 0 ? 2 * GUI.order_size : 16;
+
+            if (size > 0x10000UL) {         /* Indexes are limited to 16-bits */
+                size = 0x10000UL;
+            }
+            if (count >= size || (e = GUI_MEMREALLOC(GUI.order, size * sizeof(*GUI.order))) == NULL) {
+                return 0;
+            }
+            GUI.order = e;
+            GUI.order_size = size;
+        }
+        if (count == 1) {
+            memset(&GUI.order[0], 0x00, sizeof(GUI.order[0]));
+            if (h == NULL) {
+                break;
+            }
+        }
+        e = &GUI.order[count];
+        e->h = h;
+        e->size = 0;
+        e->parent = (uint16_t)p;
+        e->depth = GUI.order[p].depth + 1;
+        if (guii_widget_haschildren(h)) {   /* Continue with children */
+            p = count++;
+            h = gui_linkedlist_widgetgetnext(h, NULL);
+            continue;
+        }
+        count++;
+
+        /* Go to next widget, close subtrees of parents without more children */
+        while (gui_linkedlist_widgetgetnext(NULL, h) == NULL && p != 0) {
+            GUI.order[p].size = (uint16_t)(count - p - 1);
+            h = GUI.order[p].h;
+            p = GUI.order[p].parent;
+        }
+        h = gui_linkedlist_widgetgetnext(NULL, h);
+    } while (h != NULL);
+    GUI.order[0].size = (uint16_t)(count - 1);
+    GUI.order_valid = 1;
+    return 1;
+}
+
+#if GUI_CFG_USE_OVERLAY || __DOXYGEN__
+
+/**
+ * \brief           Get draw order index of widget
+ * \note            Order is invalidated if widget is not found, linked lists are used then
+ * \param[in]       h: Widget handle
+ * \return          Draw order index of widget
+ */
+static size_t
+widget_order_index(gui_handle_p h) {
+    size_t i;
+
+    if (widget_order_update()) {
+        for (i = 1; i <= GUI.order[0].size; ++i) {
+            if (GUI.order[i].h == h) {
+                return i;
+            }
+        }
+        GUI.order_valid = 0;
+    }
+    return 0;
+}
+
+#endif /* GUI_CFG_USE_OVERLAY || __DOXYGEN__ */
+
+#endif /* GUI_CFG_USE_WIDGET_ORDER || __DOXYGEN__ */
+
+/**
+ * \brief           Get first child widget of parent in draw order
+ * \param[in]       parent: Parent widget handle or `NULL` for root widgets
+ * \param[in]       pidx: Draw order index of parent
+ * \param[out]      idx: Draw order index of returned widget
+ * \return          Widget handle on success, `NULL` otherwise
+ */
+GUI_CFG_FAST_CODE static gui_handle_p
+widget_getfirst(gui_handle_p parent, size_t pidx, size_t* idx) {
+#if GUI_CFG_USE_WIDGET_ORDER
+    if (GUI.order_valid) {
+        if (GUI.order[pidx].size == 0) {
+            return NULL;
+        }
+        *idx = pidx + 1;
+        return GUI.order[*idx].h;
+    }
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
+    GUI_UNUSED2(pidx, idx);
+    return gui_linkedlist_widgetgetnext(parent, NULL);
+}
+
+/**
+ * \brief           Get next sibling widget in draw order, subtree of current widget is skipped
+ * \param[in]       h: Current widget handle
+ * \param[in]       pidx: Draw order index of parent
+ * \param[in,out]   idx: Draw order index of current widget, set to index of returned widget
+ * \return          Widget handle on success, `NULL` otherwise
+ */
+GUI_CFG_FAST_CODE static gui_handle_p
+widget_getnext(gui_handle_p h, size_t pidx, size_t* idx) {
+#if GUI_CFG_USE_WIDGET_ORDER
+    if (GUI.order_valid) {
+        *idx += GUI.order[*idx].size + 1;
+        if (*idx > pidx + GUI.order[pidx].size) {
+            return NULL;
+        }
+        return GUI.order[*idx].h;
+    }
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
+    GUI_UNUSED2(pidx, idx);
+    return gui_linkedlist_widgetgetnext(NULL, h);
+}
+
+#if GUI_CFG_USE_TOUCH || __DOXYGEN__
+
+#if GUI_CFG_USE_WIDGET_ORDER || __DOXYGEN__
+
+/**
+ * \brief           Find direct child of parent which contains entry in its subtree
+ * \param[in]       pidx: Draw order index of parent
+ * \param[in]       idx: Draw order index of entry inside subtree of parent
+ * \return          Draw order index of child, `0` if entry is parent itself
+ */
+static size_t
+widget_order_child(size_t pidx, size_t idx) {
+    if (idx == pidx) {
+        return 0;
+    }
+    while (GUI.order[idx].parent != pidx) {
+        idx = GUI.order[idx].parent;
+    }
+    return idx;
+}
+
+#endif /* GUI_CFG_USE_WIDGET_ORDER || __DOXYGEN__ */
+
+/**
+ * \brief           Get last child widget of parent in draw order
+ * \param[in]       parent: Parent widget handle or `NULL` for root widgets
+ * \param[in]       pidx: Draw order index of parent
+ * \param[out]      idx: Draw order index of returned widget
+ * \return          Widget handle on success, `NULL` otherwise
+ */
+static gui_handle_p
+widget_getlast(gui_handle_p parent, size_t pidx, size_t* idx) {
+#if GUI_CFG_USE_WIDGET_ORDER
+    if (GUI.order_valid) {
+        *idx = widget_order_child(pidx, pidx + GUI.order[pidx].size);
+        return *idx ? GUI.order[*idx].h : NULL;
+    }
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
+    GUI_UNUSED2(pidx, idx);
+    return gui_linkedlist_widgetgetprev(parent, NULL);
+}
+
+/**
+ * \brief           Get previous sibling widget in draw order
+ * \param[in]       h: Current widget handle
+ * \param[in]       pidx: Draw order index of parent
+ * \param[in,out]   idx: Draw order index of current widget, set to index of returned widget
+ * \return          Widget handle on success, `NULL` otherwise
+ */
+static gui_handle_p
+widget_getprev(gui_handle_p h, size_t pidx, size_t* idx) {
+#if GUI_CFG_USE_WIDGET_ORDER
+    if (GUI.order_valid) {
+        *idx = widget_order_child(pidx, *idx - 1);
+        return *idx ? GUI.order[*idx].h : NULL;
+    }
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
+    GUI_UNUSED2(pidx, idx);
+    return gui_linkedlist_widgetgetprev(NULL, h);
+}
+
+#endif /* GUI_CFG_USE_TOUCH || __DOXYGEN__ */
+
+static uint8_t redraw_clear_flags;                  /*!< Set to `1` when redraw flags may be cleared after drawing (last dirty region), other widgets are cleared after frame */
+static uint8_t redraw_keep_flags;                   /*!< Set to `1` when widgets were invalidated while frame was drawn */
+
+/**
+ * \brief           Drawing state of widget, kept while its children are drawn
+ */
+typedef struct {
+    uint8_t drawing;                        /*!< Set to `1` when widget was drawn and must be finished after children */
+#if GUI_CFG_USE_ALPHA || __DOXYGEN__
+    gui_layer_t* layer_prev;                /*!< Drawing layer before widget */
+    uint8_t transparent;                    /*!< Set to `1` when widget is drawn to scratch layer for blending */
+#endif /* GUI_CFG_USE_ALPHA || __DOXYGEN__ */
+#if GUI_CFG_USE_WIDGET_CACHE || __DOXYGEN__
+    gui_layer_t* cache;                     /*!< Cache layer widget is rendered to */
+    gui_layer_t* cache_prev;                /*!< Drawing layer before cache layer */
+    gui_display_t disp_prev;                /*!< Clipping region before cache rendering */
+#endif /* GUI_CFG_USE_WIDGET_CACHE || __DOXYGEN__ */
+    gui_display_t clip;                     /*!< Clipping region of widget, used again after children are drawn */
+#if GUI_CFG_USE_COVERAGE_MASK || __DOXYGEN__
+    uint8_t children;                       /*!< Set to `1` when children of widget are drawn after it */
+#endif /* GUI_CFG_USE_COVERAGE_MASK || __DOXYGEN__ */
+} redraw_state_t;
+
+/**
+ * \brief           List of sibling widgets being drawn, one per nesting level
+ */
+typedef struct {
+    size_t pidx;                            /*!< Draw order index of parent widget */
+    gui_handle_p h;                         /*!< Current widget on list */
+    size_t idx;                             /*!< Draw order index of current widget */
+    gui_display_t drawn;                    /*!< Bounding box of widgets drawn on list */
+    uint8_t force;                          /*!< Set to `1` to force drawing all widgets on list */
+    uint8_t single;                         /*!< Set to `1` when list consists of current widget only */
+    redraw_state_t st;                      /*!< Drawing state of current widget */
+} redraw_frame_t;
+
+GUI_CFG_FAST_DATA static redraw_frame_t redraw_stack[GUI_CFG_WIDGET_DEPTH_MAX]; /*!< Traversal stack for drawing, not placed on thread stack */
+
+/**
+ * \brief           Set clipping region for widget drawing and save it to drawing state
+ * \param[in]       h: Widget handle
+ * \param[in]       clip: Clipping region of parent widget or `NULL` to calculate region from all parents
+ * \param[out]      st: Drawing state to save region to
+ */
+GUI_CFG_FAST_CODE static void
+redraw_widget_clip(gui_handle_p h, const gui_display_t* clip, redraw_state_t* st) {
+#if GUI_CFG_USE_POS_SIZE_CACHE
+    GUI_UNUSED(clip);
+    check_disp_clipping(h);                         /* Visible area of widget already includes its parents */
+#else /* GUI_CFG_USE_POS_SIZE_CACHE */
+    if (clip != NULL) {
+        check_disp_clipping_child(h, clip);
+    } else {
+        check_disp_clipping(h);
+    }
+#endif /* !GUI_CFG_USE_POS_SIZE_CACHE */
+    memcpy(&st->clip, &GUI.display_temp, sizeof(st->clip));
+}
+
+/**
+ * \brief           Clear redraw flag of all widgets in tree after last dirty region of frame is drawn
+ *
+ *                  Flag is cleared while drawing only in last region, as widget may overlap
+ *                  regions drawn later. Widget inside earlier regions only is not visited there,
+ *                  children of widget served from cache layer are not visited at all
+ * \note            Widgets on overlay planes are skipped, their flags are handled by overlay redraw
+ * \param[in]       parent: Parent widget of subtree, `NULL` for all widgets
+ */
+static void
+redraw_clear_flags_tree(gui_handle_p parent) {
+    gui_handle_p h, c;
+
+    h = gui_linkedlist_widgetgetnext(parent, NULL);
+    while (h != NULL) {
+#if GUI_CFG_USE_OVERLAY
+        if (!guii_widget_getflag(h, GUI_FLAG_OVERLAY))
+#endif /* GUI_CFG_USE_OVERLAY */
+        {
+            guii_widget_clrflag(h, GUI_FLAG_REDRAW);
+            if (guii_widget_haschildren(h) && (c = gui_linkedlist_widgetgetnext(h, NULL)) != NULL) {
+                h = c;                              /* Continue with children */
+                continue;
+            }
+        }
+
+        /* Go to next widget, close subtrees of parents without more children */
+        while (h != parent && gui_linkedlist_widgetgetnext(NULL, h) == NULL) {
+            h = guii_widget_getparent(h);
+        }
+        h = h != parent ? gui_linkedlist_widgetgetnext(NULL, h) : NULL;
+    }
+}
+
+/**
+ * \brief           Start drawing of single widget, children are drawn after
+ * \param[in]       h: Widget handle, visible and inside clipping region
+ * \param[in]       clip: Clipping region of parent widget, saved by its drawing state.
+ *                      Set to `NULL` when parent region is not known
+ * \param[in]       force_redraw: Set to 1 to force drawing widget and all its children
+ * \param[out]      st: Drawing state to pass to \ref redraw_widget_finish
+ * \return          `0` if widget does not need drawing and only its children are checked,
+ *                  `1` if widget and its children were served from cache,
+ *                  `2` if widget was drawn and its children must be drawn too before finish
+ */
+GUI_CFG_FAST_CODE static uint8_t
+redraw_widget_start(gui_handle_p h, const gui_display_t* clip, uint8_t force_redraw, redraw_state_t* st) {
+    st->drawing = 0;
+
+    /* Draw main widget if required */
+    if (!guii_widget_getflag(h, GUI_FLAG_REDRAW) && !force_redraw) {  /* Check if redraw required */
+#if !GUI_CFG_USE_POS_SIZE_CACHE
+        if (guii_widget_haschildren(h)) {
+            redraw_widget_clip(h, clip, st);        /* Children are clipped inside widget region */
+        }
+#endif /* !GUI_CFG_USE_POS_SIZE_CACHE */
+        return 0;
+    }
+#if GUI_CFG_USE_ALPHA
+    st->layer_prev = GUI.lcd.drawing_layer;         /* Save drawing layer */
+    st->transparent = 0;
+#endif /* GUI_CFG_USE_ALPHA */
+#if GUI_CFG_USE_WIDGET_CACHE
+    st->cache = NULL;
+    st->cache_prev = NULL;
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+
+    /* Widget may overlap next dirty regions, keep flag until last one */
+    if (redraw_clear_flags) {
+        guii_widget_clrflag(h, GUI_FLAG_REDRAW);    /* Clear flag for drawing on widget */
+    }
+
+#if GUI_CFG_USE_WIDGET_CACHE
+    /* Serve widget from cache layer or render complete visible area of widget to it first */
+    /* Transparent widget is blended from cache, which needs blending function */
+    if (guii_widget_getflag(h, GUI_FLAG_CACHE) && (!guii_widget_hasalpha(h) || GUI_LL_ISSET(CopyBlend))) {
+        uint8_t cacheValid = 0;
+
+        st->cache = get_widget_cache(h, &cacheValid);
+        if (st->cache != NULL) {
+            if (cacheValid) {
+                if (redraw_clear_flags && guii_widget_haschildren(h)) {
+                    redraw_clear_flags_tree(h);     /* Children are not visited, cache layer holds them */
+                }
+                check_disp_clipping(h);
+                copy_widget_cache(h);
+                return 1;
+            }
+            memcpy(&st->disp_prev, &GUI.display, sizeof(st->disp_prev));
+            memcpy(&GUI.display, &st->cache->display, sizeof(GUI.display));
+            st->cache_prev = GUI.lcd.drawing_layer;
+            GUI.lcd.drawing_layer = st->cache;
+        }
+    }
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+
+    /* Prepare clipping region for this widget drawing, cache layer has its own region */
+#if GUI_CFG_USE_WIDGET_CACHE
+    if (st->cache != NULL) {
+        clip = NULL;
+    }
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+    redraw_widget_clip(h, clip, st);
+
+#if GUI_CFG_USE_ALPHA
+    /* Check alpha and check if blending function exists to merge layers later together */
+    /* Alpha of widget on overlay plane is applied by display controller, cached widget is blended from cache */
+    if (guii_widget_hasalpha(h) && !guii_widget_getflag(h, GUI_FLAG_OVERLAY)
+#if GUI_CFG_USE_WIDGET_CACHE
+        && st->cache == NULL
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+        /* && GUI_LL_ISSET(CopyBlend) */) {
+        gui_layer_t* layerPrev = st->layer_prev;
+        gui_dim_t width = GUI.display_temp.x2 - GUI.display_temp.x1;
+        gui_dim_t height = GUI.display_temp.y2 - GUI.display_temp.y1;
+
+        /* Get scratch layer for temporary usage */
+        GUI.lcd.drawing_layer = alpha_layer_get(width, height);
+
+        if (GUI.lcd.drawing_layer != NULL) {        /* Check if layer is available */
+            GUI.lcd.drawing_layer->x_pos = GUI.display_temp.x1;
+            GUI.lcd.drawing_layer->y_pos = GUI.display_temp.y1;
+            GUI.lcd.drawing_layer->pixel_format = layerPrev->pixel_format;
+
+            /* Start with background, pixels not drawn by widget stay unchanged after blending */
+            GUI_LL(Copy)(&GUI.lcd, GUI.lcd.drawing_layer, GUI.lcd.drawing_layer->start_address,
+                (void *)(((uint8_t *)layerPrev->start_address) +
+                    GUI.lcd.pixel_size * (layerPrev->width * (GUI.display_temp.y1 - layerPrev->y_pos) + (GUI.display_temp.x1 - layerPrev->x_pos))),
+                width, height, 0, layerPrev->width - width);
+            st->transparent = 1;                    /* We are going to transparent drawing mode */
+        } else {
+            GUI.lcd.drawing_layer = layerPrev;      /* Reset layer back */
+        }
+    }
+#endif /* GUI_CFG_USE_ALPHA */
+
+    /* Draw widget itself normally, skip it when opaque children paint complete region anyway */
+    if (!guii_widget_haschildren(h) || !is_covered_by_opaque_children(h, &GUI.display_temp)) {
+#if GUI_CFG_USE_PROFILER
+        PROFILER_START(start);
+#endif /* GUI_CFG_USE_PROFILER */
+        GUI_EVT_PARAMTYPE_DISP(&GUI.evt_param) = &GUI.display_temp;
+#if GUI_CFG_USE_COVERAGE_MASK
+        if (st->children && guii_widget_haschildren(h)) {
+            coverage_build(h, &GUI.display_temp);   /* Skip fills below opaque children */
+        }
+#endif /* GUI_CFG_USE_COVERAGE_MASK */
+#if GUI_CFG_USE_DISPLAY_LIST
+        if (guii_widget_getflag(h, GUI_FLAG_DISPLAY_LIST)) {
+            draw_widget_list(h);                    /* Replay drawing when widget did not change */
+        } else
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+        {
+            guii_widget_callback(h, GUI_EVT_DRAW, &GUI.evt_param, &GUI.evt_result);
+        }
+#if GUI_CFG_USE_COVERAGE_MASK
+        GUI.coverage.active = 0;
+#endif /* GUI_CFG_USE_COVERAGE_MASK */
+#if GUI_CFG_USE_PROFILER
+        profiler_add_draw(h, PROFILER_ELAPSED(start));
+#endif /* GUI_CFG_USE_PROFILER */
+#if GUI_CFG_USE_REDRAW_DEBUG
+        redraw_debug_count(&GUI.display_temp);
+#endif /* GUI_CFG_USE_REDRAW_DEBUG */
+    }
+    st->drawing = 1;
+    return 2;
+}
+
+/**
+ * \brief           Finish drawing of single widget after its children were drawn
+ * \param[in]       h: Widget handle
+ * \param[in]       st: Drawing state set by \ref redraw_widget_start
+ */
+GUI_CFG_FAST_CODE static void
+redraw_widget_finish(gui_handle_p h, redraw_state_t* st) {
+    /* Restore clipping region of widget, children drawing changed it */
+    memcpy(&GUI.display_temp, &st->clip, sizeof(GUI.display_temp));
+
+    /* Draw widget itself normally, don't care on layer offset and size */
+    GUI_EVT_PARAMTYPE_DISP(&GUI.evt_param) = &GUI.display_temp;
+    guii_widget_callback(h, GUI_EVT_DRAWAFTER, &GUI.evt_param, &GUI.evt_result);
+
+#if GUI_CFG_USE_WIDGET_CACHE
+    /* Cache is rendered, copy required part of it to screen */
+    if (st->cache != NULL) {
+        GUI.lcd.drawing_layer = st->cache_prev;
+        memcpy(&GUI.display, &st->disp_prev, sizeof(GUI.display));
+        guii_widget_setflag(h, GUI_FLAG_CACHE_VALID);
+        GUI_LCD_TILES_UPDATE(st->cache);            /* Find solid areas of rendered cache */
+        check_disp_clipping(h);
+        copy_widget_cache(h);
+    }
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+
+#if GUI_CFG_USE_ALPHA
+    /* If transparent mode is used on widget, copy content back */
+    if (st->transparent) {                          /* If we are in transparent mode */
+        gui_layer_t* layerPrev = st->layer_prev;
+
+        /* Copy layers with blending */
+        if (GUI_LL_ISSET(CopyBlend)) {              /* Hardware way */
+            GUI_LL(CopyBlend)(&GUI.lcd, GUI.lcd.drawing_layer,
+                (void *)(((uint8_t *)layerPrev->start_address) +
+                    GUI.lcd.pixel_size * (layerPrev->width * (GUI.lcd.drawing_layer->y_pos - layerPrev->y_pos) + (GUI.lcd.drawing_layer->x_pos - layerPrev->x_pos))),
+                (void *)GUI.lcd.drawing_layer->start_address,
+                gui_widget_getalpha(h), 0xFF,
+                GUI.lcd.drawing_layer->width, GUI.lcd.drawing_layer->height,
+                layerPrev->width - GUI.lcd.drawing_layer->width, 0
+            );
+        } else {                                    /* Software way, row by row on layer memory */
+            alpha_layer_blend(layerPrev, GUI.lcd.drawing_layer, gui_widget_getalpha(h));
+        }
+
+        gui_lcd_fence();                            /* Wait for blending to finish before memory is released */
+        alpha_layer_put(GUI.lcd.drawing_layer);     /* Release scratch layer */
+        GUI.lcd.drawing_layer = layerPrev;          /* Reset layer pointer */
+    }
+#else /* GUI_CFG_USE_ALPHA */
+    GUI_UNUSED(st);
+#endif /* !GUI_CFG_USE_ALPHA */
+}
+
+/**
+ * \brief           Redraw widgets of selected parent or single widget, together with their children
+ *
+ *                  Tree is traversed without recursion, each nesting level uses one entry of \ref redraw_stack
+ *
+ * \param[in]       parent: Parent widget handle to draw widgets on
+ * \param[in]       pidx: Draw order index of parent widget, `0` for root widgets
+ * \param[in]       h: Single widget to draw instead of all children of parent, visible and inside clipping region.
+ *                      Set to `NULL` to draw children of parent
+ * \param[in]       idx: Draw order index of single widget
+ * \param[in]       force_redraw: Set to 1 to force drawing all widgets
+ * \return          Number of widgets redrawn
+ */
+GUI_CFG_FAST_CODE static uint32_t
+redraw_tree(gui_handle_p parent, size_t pidx, gui_handle_p h, size_t idx, uint8_t force_redraw) {
+    redraw_frame_t* f = redraw_stack;
+    uint32_t cnt = 0;
+    uint8_t force, res;
+
+    f->pidx = pidx;
+    f->force = force_redraw;
+    f->single = h != NULL;
+    f->idx = idx;
+    f->h = f->single ? h : widget_getfirst(parent, pidx, &f->idx);
+    f->drawn.x1 = f->drawn.y1 = GUI_DIM_MAX;
+    f->drawn.x2 = f->drawn.y2 = GUI_DIM_MIN;
+    for (;;) {
+        if (f->h == NULL) {                         /* All widgets on list processed */
+            if (f == redraw_stack) {
+                break;
+            }
+            f--;                                    /* Continue with parent widget */
+            if (f->st.drawing) {
+                redraw_widget_finish(f->h, &f->st);
+                cnt++;
+            }
+            f->h = f->single ? NULL : widget_getnext(f->h, f->pidx, &f->idx);
+            continue;
+        }
+        h = f->h;
+        force = f->force;
+        if (!f->single) {
+            if (!guii_widget_isvisible(h)) {        /* Check if visible */
+                guii_widget_clrflag(h, GUI_FLAG_REDRAW);/* Clear flag to be sure */
+                f->h = widget_getnext(h, f->pidx, &f->idx);
+                continue;                           /* Ignore hidden elements */
+            }
+            /* Widget on overlay is drawn to its overlay plane, widget outside clipping region or fully covered by any of its siblings is skipped */
+            if (
+#if GUI_CFG_USE_OVERLAY
+                guii_widget_getflag(h, GUI_FLAG_OVERLAY) ||
+#endif /* GUI_CFG_USE_OVERLAY */
+                !guii_widget_isinsideclippingregion(h, 1)) {
+                f->h = widget_getnext(h, f->pidx, &f->idx);
+                continue;
+            }
+
+            /*
+             * Widget above sibling drawn in this region is drawn too.
+             * Invalidated area of sibling may be merged to bigger region than its overlap check was done for
+             */
+            if (!force) {
+                gui_dim_t x1 = gui_widget_getabsolutex(h), y1 = gui_widget_getabsolutey(h);
+                gui_dim_t x2 = x1 + gui_widget_getwidth(h), y2 = y1 + gui_widget_getheight(h);
+
+                if (GUI_RECT_MATCH(x1, y1, x2, y2, f->drawn.x1, f->drawn.y1, f->drawn.x2, f->drawn.y2)) {
+                    force = 1;
+                }
+                if (force || guii_widget_getflag(h, GUI_FLAG_REDRAW)) {
+                    f->drawn.x1 = GUI_MIN(f->drawn.x1, x1);
+                    f->drawn.y1 = GUI_MIN(f->drawn.y1, y1);
+                    f->drawn.x2 = GUI_MAX(f->drawn.x2, x2);
+                    f->drawn.y2 = GUI_MAX(f->drawn.y2, y2);
+                }
+            }
+        }
+
+#if GUI_CFG_USE_COVERAGE_MASK
+        f->st.children = f < &redraw_stack[GUI_CFG_WIDGET_DEPTH_MAX - 1];
+#endif /* GUI_CFG_USE_COVERAGE_MASK */
+        res = redraw_widget_start(h, f > redraw_stack ? &(f - 1)->st.clip : NULL, force, &f->st);
+        if (res == 1) {                             /* Served from cache together with children */
+            cnt++;
+        } else if (guii_widget_haschildren(h) && f < &redraw_stack[GUI_CFG_WIDGET_DEPTH_MAX - 1]) {
+            /* Children of drawn widget are forced to redraw, even if no redraw flag set */
+            f++;
+            f->pidx = (f - 1)->idx;
+            f->force = res == 2;
+            f->single = 0;
+            f->h = widget_getfirst(h, f->pidx, &f->idx);
+            f->drawn.x1 = f->drawn.y1 = GUI_DIM_MAX;
+            f->drawn.x2 = f->drawn.y2 = GUI_DIM_MIN;
+            continue;
+        } else if (res == 2) {
+            redraw_widget_finish(h, &f->st);
+            cnt++;
+        }
+        f->h = f->single ? NULL : widget_getnext(h, f->pidx, &f->idx);
+    }
+    return cnt;                                     /* Return number of redrawn objects */
+}
+
+/**
+ * \brief           Redraw all widgets of selected parent
+ * \param[in]       parent: Parent widget handle to draw widgets on
+ * \param[in]       pidx: Draw order index of parent widget, `0` for root widgets
+ * \param[in]       force_redraw: Set to 1 to force drawing all widgets on linked list
+ * \return          Number of widgets redrawn
+ */
+static uint32_t
+redraw_widgets(gui_handle_p parent, size_t pidx, uint8_t force_redraw) {
+    return redraw_tree(parent, pidx, NULL, 0, force_redraw);
+}
+
+#if GUI_CFG_USE_TOUCH
+
+#if GUI_CFG_TOUCH_PREDICT || __DOXYGEN__
+
+/**
+ * \brief           Get touch prediction offset
+ * \param[in]       speed: Touch velocity in units of pixels per second
+ * \param[in]       lead: Time to extrapolate in units of milliseconds
+ * \return          Offset in units of pixels
+ */
+static gui_dim_t
+predict_offset(int32_t speed, uint32_t lead) {
+    int32_t off = speed * (int32_t)lead / 1000;
+    
+    if (off > GUI_CFG_TOUCH_PREDICT_MAX) {
+        off = GUI_CFG_TOUCH_PREDICT_MAX;
+    } else if (off < -GUI_CFG_TOUCH_PREDICT_MAX) {
+        off = -GUI_CFG_TOUCH_PREDICT_MAX;
+    }
+    return (gui_dim_t)off;
+}
+
+#endif /* GUI_CFG_TOUCH_PREDICT || __DOXYGEN__ */
+
+/**
+ * \brief           Set relative coordinate of touch on widget
+ *
+ *					Relative coordinates are calculated based on widget position on screen
+ *					and actual absolute X and Y values from touch event
+ * \param[in,out]   ts: Raw touch data with X and Y position
+ * \param[in]       h: Widget handle. Set to `NULL` to use default value
+ */
+static void
+set_relative_coordinate(guii_touch_data_t* ts, gui_touch_data_t* old, gui_handle_p h) {
+    uint8_t i = 0;
+#if GUI_CFG_TOUCH_PREDICT
+    uint32_t lead = GUI_CFG_TOUCH_PREDICT_TIME;
+    
+#if GUI_CFG_USE_LATENCY
+    if (GUI.latency.stat.count > 0) {               /* Use measured touch-to-photon latency */
+        lead = GUI.latency.stat.avg / GUI.latency.stat.count;
+    }
+#endif /* GUI_CFG_USE_LATENCY */
+#endif /* GUI_CFG_TOUCH_PREDICT */
+
+    /* Get absolute position */
+    if (h != NULL) {
+        ts->widget_x = gui_widget_getabsolutex(h);
+        ts->widget_y = gui_widget_getabsolutey(h);
+        ts->widget_width = gui_widget_getwidth(h);
+        ts->widget_height = gui_widget_getheight(h);
+    } else {
+        ts->widget_x = 0;
+        ts->widget_y = 0;
+        ts->widget_width = gui_lcd_getwidth();
+        ts->widget_height = gui_lcd_getheight();
+    }
+    
+    /* Calculate values */
+    for (i = 0; i < ts->ts.count; i++) {
+        /* Get previous values  */
+        ts->x_old[i] = old->x[i];
+        ts->y_old[i] = old->y[i];
+
+        /* Calculate difference new value versus old */
+        ts->x_diff[i] = ts->ts.x[i] - ts->x_old[i];
+        ts->y_diff[i] = ts->ts.y[i] - ts->y_old[i];
+
+        /* Estimate velocity, keep previous value if samples have the same time */
+        if (!old->status) {
+            ts->x_speed[i] = 0;                     /* Touch just pressed, no movement yet */
+            ts->y_speed[i] = 0;
+        } else if (ts->ts.time != old->time) {
+            ts->x_speed[i] = (int32_t)ts->x_diff[i] * 1000 / (int32_t)(ts->ts.time - old->time);
+            ts->y_speed[i] = (int32_t)ts->y_diff[i] * 1000 / (int32_t)(ts->ts.time - old->time);
+        }
+
+        /* Calculate widget relative coordinate */
+        ts->x_rel[i] = ts->ts.x[i] - ts->widget_x;
+        ts->y_rel[i] = ts->ts.y[i] - ts->widget_y;
+
+#if GUI_CFG_TOUCH_PREDICT
+        /* Extrapolate to display time, difference is between predicted positions */
+        if (!old->status || ts->ts.count != old->count) {
+            ts->x_pred_old[i] = 0;
+            ts->y_pred_old[i] = 0;
+            ts->x_pred[i] = 0;
+            ts->y_pred[i] = 0;
+        } else {
+            ts->x_pred[i] = predict_offset(ts->x_speed[i], lead);
+            ts->y_pred[i] = predict_offset(ts->y_speed[i], lead);
+        }
+        ts->x_rel[i] += ts->x_pred[i];
+        ts->y_rel[i] += ts->y_pred[i];
+        ts->x_diff[i] += ts->x_pred[i] - ts->x_pred_old[i];
+        ts->y_diff[i] += ts->y_pred[i] - ts->y_pred_old[i];
+#endif /* GUI_CFG_TOUCH_PREDICT */
+    }
+
+#if GUI_CFG_TOUCH_MAX_PRESSES > 1 && !GUI_CFG_USE_GESTURE
+    if (ts->ts.count == 2) {                        /* 2 points detected */
+        ts->distance_old = ts->distance;            /* Save old distance */
+        gui_math_distancebetweenxy(ts->x_rel[0], ts->y_rel[0], ts->x_rel[1], ts->y_rel[1], &ts->distance);  /* Calculate distance between 2 points */
+    }
+#endif /* GUI_CFG_TOUCH_MAX_PRESSES > 1 && !GUI_CFG_USE_GESTURE */
+}
+
+/*
+ * How touch events work
+ *
+ * When using touch, 3 events are supported on widget:
+ *  - TouchStart: Triggered when touch is going from released status to pressed status (touch just pressed)
+ *  - TouchMove: Triggered when touch is in pressed status and new pressed event is received (finger is moving on widget pressed on touch panel)
+ *  - TouchEnd: Triggered when touch is going from pressed status to released. Finger has been just released from touch panel
+ *
+ * Besides, with these 3 basic touch events, it is possible to handle 3 more events,
+ *         which may not be used just with touch but can also be used with mouse
+ *  - Click: Triggered when pressed state is detected and after that released state, still on widget coordinates
+ *  - LongClick: Triggered when pressed state is detected for x amount of time (usually 2 seconds)
+ *  - DblClick: Triggered when 2 Click events are detected in range of defined time
+ *
+ * To be able to detect DblClick, 2 Click events must be valid in certain time.
+ *
+ * Since second events are based on first 3 events for touch, first events must be respected for proper handling second ones.
+ *
+ * Each widget receives a callback for TouchStart, TouchMove and TouchEnd events.
+ * Callback function can return status if event is processed or not. On the returned value 2 things are possible.
+ *
+ * Consider using button and dropdown. In button, everything what matters is TouchStart and TouchEnd.
+ * If TouchMove happens, it is not necessary to handle because only press is needed for detection.
+ * In this case, if TouchStart happen and TouchMove too (finger moved inside widget),
+ * click event will happen after TouchEnd event, because TouchMove command was ignored and 0 was returned on callback.
+ *
+ * In dropdown mode it is different because TouchMove is required to detect sliding on items.
+ * If TouchMove is detected and 1 is returned from callback, Click event won't be called after TouchEnd event,
+ * even if release was inside widget. This is not valid Click because TouchMove was required for something.
+ * If Click event would be also triggered in this case, after sliding, item value would be automatically selected which is wrong.
+ * In this case, Click event is detected only if TouchMove is not detected (TouchStart and after immediatelly TouchEnd).
+ *
+ * This is all handled by this "thread" function
+ */
+
+/**
+ * \brief           Touch event proto thread 
+ *
+ *                  Designed as non-blocking event thread for processing input touch events.
+ * \param[in]       ts: Touch information with X and Y positions
+ * \param[in]       old: Old touch information
+ * \param[in]       v: Is input value valid or is just "check" call
+ * \param[out]      result: Result of event, if any
+ * \return          PT thread result
+ */
+static
+PT_THREAD(__TouchEvents_Thread(guii_touch_data_t* const ts, gui_touch_data_t* const old, uint8_t v, gui_widget_evt_t* const result)) {
+    static volatile uint32_t time;
+    static uint8_t i = 0;
+    static gui_dim_t x[2], y[2];
+
+    *result = (gui_widget_evt_t)0;                  /* Reset widget control variable */          
+
+    PT_BEGIN(&ts->pt);                              /* Start thread execution */
+
+    memset(x, 0x00, sizeof(x));                     /* Reset X values */
+    memset(y, 0x00, sizeof(y));                     /* Reset Y values */
+    for (i = 0; i < 2;) {                           /* Allow up to 2 touch presses */
+
+        /* Wait for valid input with pressed state */
+        PT_WAIT_UNTIL(&ts->pt, v && ts->ts.status && !old->status && ts->ts.count == 1);
+
+        time = ts->ts.time;                         /* Get start time of this touch */
+        x[i] = ts->x_rel[0];                        /* Save X value */
+        y[i] = ts->y_rel[0];                        /* Save Y value */
+        
+        /* Either wait for released status or timeout */
+        do {
+            PT_YIELD(&ts->pt);                      /* Stop thread for now and wait next call */
+
+            /* Wait for new data */
+            /* Wait touch with released state or timeout */
+            PT_WAIT_UNTIL(&ts->pt, v || (gui_sys_now() - time) > GUI_CFG_LONG_CLICK_TIMEOUT);
+
+            /* We have new touch entry, but we do
+               not yet if it is "pressed" or "released" */
+            if (v) {
+                /*
+                 * If touch is still pressed (touch move) and we have active widget and touch move event was not processed
+                 * then we can use click events also after touch move (for example, button is that widget) where in
+                 * some cases, click event should not be processed after touch move (slider, dropdown, etc)
+                 */
+                if (ts->ts.status && GUI.active_widget != NULL && !guii_widget_getflag(GUI.active_widget, GUI_FLAG_TOUCH_MOVE)) {
+                    time = ts->ts.time;             /* Get start time of this touch */
+                    x[i] = ts->x_rel[0];            /* Update X value */
+                    y[i] = ts->y_rel[0];            /* Update Y value */
+                    continue;                       /* Continue and wait for next (released) event */
+                } else {                            /* Released status received */
+                    break;                          /* Stop execution, continue later */
+                }
+            }
+            else {
+                break;                              /* Stop while loop execution */
+            }
+        } while (1);
+
+        /* Check what was the reason for thread to continue */
+        if (v) {                                    /* New touch event occurred */
+            if (!ts->ts.status) {                   /* We received released state */
+
+                /* Try to get second click, check difference for double click */
+                /* Difference was too big, reset and act like normal click */
+                if (i && (GUI_ABS(x[0] - x[1]) > 30 || GUI_ABS(y[0] - y[1]) > 30)) {
                     i = 0;
                 }
                 set_relative_coordinate(ts, old, GUI.active_widget);
@@ -405,377 +1551,1814 @@ PT_THREAD(__TouchEvents_Thread(guii_touch_data_t* const ts, gui_touch_data_t* co
                 if (!i) {                           /* On first call, this is click event */
                     *result = GUI_EVT_CLICK;        /* Click event occurred */
 
-                    time = ts->ts.time;             /* Save last time */
-                    PT_YIELD(&ts->pt);              /* Stop thread for now and wait next call with new touch event */
+                    time = ts->ts.time;             /* Save last time */
+                    PT_YIELD(&ts->pt);              /* Stop thread for now and wait next call with new touch event */
+
+                    /* Wait for valid input with pressed state */
+                    PT_WAIT_UNTIL(&ts->pt, (v && ts->ts.status) || (gui_sys_now() - time) > 300);
+                    if ((gui_sys_now() - time) > 300) { /* Check timeout for new pressed state */
+                        PT_EXIT(&ts->pt);           /* Exit protothread */
+                    }
+                } else {
+                    *result = GUI_EVT_DBLCLICK;     /* Double click event */
+                    PT_EXIT(&ts->pt);               /* Reset protothread */
+                }
+            }
+        } else {
+            if (!i) {                               /* Timeout occurred with no touch data, long click */
+                *result = GUI_EVT_LONGCLICK;        /* Click event occurred */
+            }
+            PT_EXIT(&ts->pt);                       /* Exit protothread here */
+        }
+        i++;
+    }
+    PT_END(&ts->pt);                                /* Stop thread execution */
+}
+
+/**
+ * \brief           List of sibling widgets checked for touch, one per nesting level
+ */
+typedef struct {
+    size_t pidx;                            /*!< Draw order index of parent widget */
+    gui_handle_p h;                         /*!< Current widget on list */
+    size_t idx;                             /*!< Draw order index of current widget */
+    uint8_t dialog_only;                    /*!< Set to `1` when only dialog based widgets are checked */
+} touch_frame_t;
+
+GUI_CFG_FAST_DATA static touch_frame_t touch_stack[GUI_CFG_WIDGET_DEPTH_MAX]; /*!< Traversal stack for touch, not placed on thread stack */
+
+/**
+ * \brief           Process input touch event
+ *
+ *                  Scan all widgets from top to bottom which will be first on valid
+ *                  position for touch and call callback function to this widget.
+ *                  Tree is traversed without recursion, each nesting level uses one entry of \ref touch_stack
+ * \param[in]       touch: Touch data info
+ * \param[in]       touch_old: Previous touch data
+ * \return          Member of \ref guii_touch_status_t enumeration about success
+ */
+static guii_touch_status_t
+process_touch(guii_touch_data_t* const touch, gui_touch_data_t* const touch_old) {
+    touch_frame_t* f = touch_stack;
+    gui_handle_p h;
+    uint8_t isKeyboard = 0;
+    guii_touch_status_t tStat;
+#if GUI_CFG_USE_WIDGET_GRID
+    uint32_t cell = guii_widget_getgridmask(touch->ts.x[0], touch->ts.y[0], touch->ts.x[0], touch->ts.y[0]);
+#endif /* GUI_CFG_USE_WIDGET_GRID */
+
+    /*
+     * To handle touch events, process widgets in reverse order,
+     * starting from widget on most deep level.
+     *
+     * This is due to the fact that widget with most deep level,
+     * is displayed on top of screen = should be detected first
+     */
+    f->pidx = 0;
+    f->dialog_only = 0;
+    f->h = widget_getlast(NULL, 0, &f->idx);
+    for (;;) {
+        if (f->h == NULL) {                         /* No widget on list detected touch */
+            if (f == touch_stack) {
+                break;
+            }
+            f--;                                    /* Check parent widget itself */
+            h = f->h;
+        } else {
+            h = f->h;
+            if (guii_widget_ishidden(h)) {          /* Ignore hidden widget */
+                f->h = widget_getprev(h, f->pidx, &f->idx);
+                continue;
+            }
+
+            /*
+             * Dialogs are placed as children of main window
+             * If level 1 is current and dialog is detected,
+             * stop processsing other widgets except if widget is inside dialog
+             */
+            if (f == &touch_stack[1]) {             /* On base elements list = children of base window element */
+                if (guii_widget_isdialogbase(h)) {  /* We found dialog element */
+                    f->dialog_only = 1;             /* Check only widgets which are dialog based */
+                }
+            }
+
+            /* When we should only check dialogs and previous element is not dialog anymore */
+            if (f->dialog_only && !guii_widget_isdialogbase(h)) {
+                f->h = NULL;
+                continue;
+            }
+
+#if GUI_CFG_USE_WIDGET_GRID
+            /*
+             * Children are always inside visible area of parent,
+             * skip widget with all its children if it does not cover touched cell
+             */
+            guii_widget_updateabs(h);
+            if (!(h->grid_mask & cell)) {
+                f->h = widget_getprev(h, f->pidx, &f->idx);
+                continue;
+            }
+#endif /* GUI_CFG_USE_WIDGET_GRID */
+
+            /*
+             * Visible area of children is always inside visible area of parent,
+             * skip widget with all its children if touch is outside of it
+             */
+            check_disp_clipping(h);
+            if (touch->ts.x[0] < GUI.display_temp.x1 || touch->ts.x[0] > GUI.display_temp.x2 ||
+                touch->ts.y[0] < GUI.display_temp.y1 || touch->ts.y[0] > GUI.display_temp.y2) {
+                f->h = widget_getprev(h, f->pidx, &f->idx);
+                continue;
+            }
+
+            /* Check for keyboard mode */
+            if (h->id == GUI_ID_KEYBOARD_BASE) {
+                isKeyboard = 1;                     /* Set keyboard mode as 1 */
+            }
+
+            /*
+             * Before we check if touch position matches widget coordinates
+             * we have to check if this widget has any direct children
+             */
+            if (guii_widget_haschildren(h) && f < &touch_stack[GUI_CFG_WIDGET_DEPTH_MAX - 1]) {
+                f++;                                /* Process touch on widget elements first */
+                f->pidx = (f - 1)->idx;
+                f->dialog_only = 0;
+                f->h = widget_getlast(h, f->pidx, &f->idx);
+                continue;
+            }
+        }
+
+        /* Children widgets were not detected, check this widget */
+        tStat = touchCONTINUE;
+        check_disp_clipping(h);                     /* Check display region where widget is placed */
+
+        /* Check if widget is in touch area */
+        if (touch->ts.x[0] >= GUI.display_temp.x1 && touch->ts.x[0] <= GUI.display_temp.x2 && 
+            touch->ts.y[0] >= GUI.display_temp.y1 && touch->ts.y[0] <= GUI.display_temp.y2) {
+            set_relative_coordinate(touch, touch_old, h);
+
+            /* Call touch start callback to see if widget accepts touches */
+            GUI_EVT_PARAMTYPE_TOUCH(&GUI.evt_param) = touch;
+            guii_widget_callback(h, GUI_EVT_TOUCHSTART, &GUI.evt_param, &GUI.evt_result);
+            tStat = GUI_EVT_RESULTTYPE_TOUCH(&GUI.evt_result);
+            if (tStat == touchCONTINUE) {           /* Check result status */
+                tStat = touchHANDLED;               /* If command is processed, touchCONTINUE can't work */
+            }
+
+            /*
+             * Move widget down on parent linked list and do the same with all of its parents,
+             * no matter of touch focus or not
+             */
+            guii_widget_movedowntree(h);
+
+            if (tStat == touchHANDLED) {            /* Touch handled for widget completely */
+                /*
+                 * Set active widget and set flag for it
+                 * Set focus widget and set flag for it but only do this if widget is not related to keyboard
+                 *
+                 * This allows us to click keyboard items but not to lose focus on main widget
+                 */
+                if (!isKeyboard) {
+                    guii_widget_focus_set(h);
+                }
+                guii_widget_active_set(h);
+
+                /*
+                 * Invalidate actual handle object
+                 * Already invalidated in guii_widget_active_set function
+                 */
+                //gui_widget_invalidate(h);   
+            } else {                                /* Touch handled with no focus */
+                /*
+                 * When touch was handled without focus,
+                 * process only clearing currently focused and active widgets and clear them
+                 */
+                if (!isKeyboard) {
+                    guii_widget_focus_clear();
+                }
+                guii_widget_active_clear();
+            }
+        }
+
+        /* Check for keyboard mode */
+        if (gui_widget_getid(h) == GUI_ID_KEYBOARD_BASE) {
+            isKeyboard = 0;                         /* Set keyboard mode as 1 */
+        }
+
+        if (tStat != touchCONTINUE) {               /* Return status if necessary */
+            return tStat;
+        }
+        f->h = widget_getprev(h, f->pidx, &f->idx);
+    }
+    return touchCONTINUE;                           /* Try with another widget */
+}
+
+#define __ProcessAfterTouchEventsThread() do {\
+    if (rresult != 0 && GUI.active_widget != NULL) {/* Valid event occurred, widget may be removed since touch */\
+        uint8_t ret;                                \
+        GUI_EVT_PARAMTYPE_TOUCH(&param) = &GUI.touch;    \
+        ret = guii_widget_callback(GUI.active_widget, rresult, &param, NULL);\
+        if (rresult == GUI_EVT_DBLCLICK && !ret) {   /* If double click was not recorded, proceed with normal click again */\
+            guii_widget_callback(GUI.active_widget, GUI_EVT_CLICK, &param, NULL);/* Check for normal click now */\
+        }\
+    }\
+} while (0)
+
+/**
+ * \brief           Process single touch entry read to current touch data
+ *
+ *                  Consecutive move samples are merged to latest one
+ *                  when \ref GUI_CFG_TOUCH_COMPRESS_MOVE is enabled
+ */
+static void
+process_touch_entry(void) {
+    gui_evt_param_t param = {0};
+    gui_evt_result_t result = {0};
+    gui_widget_evt_t rresult;
+    
+    GUI_TRACE(GUI_TRACE_EVT_TOUCH_START, GUI.touch.ts.status);
+#if GUI_CFG_USE_LATENCY
+    if (GUI.latency.state == GUI_LATENCY_IDLE) {
+        GUI.latency.received = GUI.touch.ts.time;
+        GUI.latency.dispatch = gui_sys_now();
+        GUI.latency.state = GUI_LATENCY_DISPATCH;
+    }
+#endif /* GUI_CFG_USE_LATENCY */
+#if GUI_CFG_TOUCH_COMPRESS_MOVE
+    /* Move samples only, dispatch latest one to widgets */
+    if (GUI.touch.ts.status && GUI.touch_old.status && GUI.touch.ts.count == GUI.touch_old.count) {
+        guii_input_touchcompress(&GUI.touch.ts);
+    }
+#endif /* GUI_CFG_TOUCH_COMPRESS_MOVE */
+    /* Set relative coordinates for new widget directly */
+    if (GUI.active_widget != NULL && GUI.touch.ts.status) {
+        set_relative_coordinate(&GUI.touch, &GUI.touch_old, GUI.active_widget);
+    }
+    
+    /*
+     * Old status: pressed
+     * New status: pressed
+     * Action: Touch move on active element
+     */
+    if (GUI.touch.ts.status && GUI.touch_old.status) {
+        if (GUI.active_widget != NULL) {        /* If active widget exists */
+            if (GUI.touch.ts.count == GUI.touch_old.count) {
+                gui_handle_p aw = GUI.active_widget;/* Temporary set active widget */
+                do {
+                    uint8_t r;
+                    GUI_EVT_PARAMTYPE_TOUCH(&param) = &GUI.touch;
+                    GUI_EVT_RESULTTYPE_TOUCH(&result) = touchCONTINUE;
+                    if (aw != GUI.active_widget) {
+                        r = guii_widget_callback(aw, GUI_EVT_TOUCHSTART, &param, &result);   /* The same amount of touch events currently */
+                        GUI_EVT_RESULTTYPE_TOUCH(&result) = touchCONTINUE;
+                    }
+                    r = guii_widget_callback(aw, GUI_EVT_TOUCHMOVE, &param, &result);   /* The same amount of touch events currently */
+                    if (r) {                    /* Check if touch move processed */
+                        guii_widget_setflag(aw, GUI_FLAG_TOUCH_MOVE);   /* Touch move has been processed */
+                    } else {
+                        guii_widget_clrflag(aw, GUI_FLAG_TOUCH_MOVE);   /* Touch move has not been processed */
+                    }
+                    if (GUI_EVT_RESULTTYPE_TOUCH(&result) != touchCONTINUE) {
+                        break;
+                    }
+                    
+                    /*
+                     * TODO: Handle relative coordinates on new object
+                     *
+                     * If widget does not detect touch start, then forward touch start to parent widget.
+                     * With this approach, you can achieve slider on parent widget
+                     */
+                    aw = guii_widget_getparent(aw);    /* Get parent widget */
+                    if (aw != NULL) {
+                        set_relative_coordinate(&GUI.touch, &GUI.touch_old, aw);
+                    }
+                } while (aw != NULL);
+                
+                /*
+                 * In case touch move widget was detected on another widget,
+                 * set this new widget to active from now on
+                 */
+                if (aw != NULL) {
+                    if (aw != GUI.active_widget) {
+                        guii_widget_active_set(aw);  /* Set new active widget */
+                    }
+                }
+            } else {
+                GUI_EVT_PARAMTYPE_TOUCH(&param) = &GUI.touch;
+                GUI_EVT_RESULTTYPE_TOUCH(&result) = touchCONTINUE;
+                guii_widget_callback(GUI.active_widget, GUI_EVT_TOUCHSTART, &param, &result);    /* New amount of touch elements happened */
+            }
+        }
+    }
+    
+    /*
+     * Old status: released
+     * New status: pressed
+     * Action: Touch down on element, find element
+     */
+    if (GUI.touch.ts.status && !GUI.touch_old.status) {
+#if GUI_CFG_USE_WIDGET_ORDER
+        widget_order_update();
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
+        process_touch(&GUI.touch, &GUI.touch_old);
+        if (GUI.active_widget != GUI.active_widget_prev) {  /* If new active widget is not the same as previous */
+            PT_INIT(&GUI.touch.pt)              /* Reset thread, otherwise process with double click event */
+        }
+    }
+    
+    /* Periodical check for events on active widget */
+    if (GUI.active_widget != NULL) {
+        __TouchEvents_Thread(&GUI.touch, &GUI.touch_old, 1, &rresult);   /* Call thread for touch process */
+        __ProcessAfterTouchEventsThread();      /* Process after event macro */
+    }
+    
+#if GUI_CFG_USE_GESTURE
+    guii_gesture_sample(&GUI.touch.ts);         /* Movement is processed once after all samples */
+#endif /* GUI_CFG_USE_GESTURE */
+
+    /*
+     * Old status: pressed
+     * New status: released
+     * Action: Touch up on active element
+     */
+    if (!GUI.touch.ts.status && GUI.touch_old.status) {
+        if (GUI.active_widget != NULL) {        /* Check if active widget */
+            GUI_EVT_PARAMTYPE_TOUCH(&param) = &GUI.touch;
+            GUI_EVT_RESULTTYPE_TOUCH(&result) = touchCONTINUE;
+            guii_widget_callback(GUI.active_widget, GUI_EVT_TOUCHEND, &param, &result);  /* Process callback function */
+            guii_widget_active_clear();         /* Clear active widget */
+        }
+    }
+    
+    memcpy((void *)&GUI.touch_old, (void *)&GUI.touch.ts, sizeof(GUI.touch_old));   /* Copy current touch to last touch status */
+#if GUI_CFG_TOUCH_PREDICT
+    memcpy(GUI.touch.x_pred_old, GUI.touch.x_pred, sizeof(GUI.touch.x_pred_old));   /* Offsets are delivered to widgets */
+    memcpy(GUI.touch.y_pred_old, GUI.touch.y_pred, sizeof(GUI.touch.y_pred_old));
+#endif /* GUI_CFG_TOUCH_PREDICT */
+    GUI_TRACE(GUI_TRACE_EVT_TOUCH_END, 0);
+#if GUI_CFG_USE_LATENCY
+    if (GUI.latency.state == GUI_LATENCY_INVALIDATED) {
+        GUI.latency.dispatched = gui_sys_now();
+        GUI.latency.state = GUI_LATENCY_WAIT_FRAME;
+    } else if (GUI.latency.state == GUI_LATENCY_DISPATCH) {
+        GUI.latency.state = GUI_LATENCY_IDLE;   /* Nothing to show for this touch */
+    }
+#endif /* GUI_CFG_USE_LATENCY */
+}
+
+/**
+ * \brief           Process touch when no new touch entry is available
+ *
+ *                  Touch event thread is called periodically to handle long presses and timeouts
+ */
+static void
+process_touch_idle(void) {
+    gui_evt_param_t param = {0};
+    gui_widget_evt_t rresult;
+    
+    __TouchEvents_Thread(&GUI.touch, &GUI.touch_old, 0, &rresult);   /* Call thread for touch process periodically, handle long presses or timeouts */
+    __ProcessAfterTouchEventsThread();          /* Process after event macro */
+}
+
+#endif /* GUI_CFG_USE_TOUCH */
 
-                    /* Wait for valid input with pressed state */
-                    PT_WAIT_UNTIL(&ts->pt, (v && ts->ts.status) || (gui_sys_now() - time) > 300);
-                    if ((gui_sys_now() - time) > 300) { /* Check timeout for new pressed state */
-                        PT_EXIT(&ts->pt);           /* Exit protothread */
+#if GUI_CFG_USE_KEYBOARD || __DOXYGEN__
+
+/**
+ * \brief           Process single keyboard entry
+ *
+ *                  Key is sent to focused widget. When not handled, tab key moves focus to next widget.
+ *                  With \ref GUI_CFG_USE_FOCUS_GRAPH, arrow keys move focus to nearest widget in key direction
+ * \param[in]       key: Keyboard entry read from input buffer
+ */
+static void
+process_key_entry(guii_keyboard_data_t* key) {
+    gui_evt_param_t param = {0};
+    gui_evt_result_t result = {0};
+    
+#if GUI_CFG_USE_FOCUS_GRAPH
+    if (GUI.focused_widget != NULL) {               /* Check if any widget is in focus already */
+        GUI_EVT_PARAMTYPE_KEYBOARD(&param) = key;
+        GUI_EVT_RESULTTYPE_KEYBOARD(&result) = keyCONTINUE;
+        guii_widget_callback(GUI.focused_widget, GUI_EVT_KEYPRESS, &param, &result);
+        if (GUI_EVT_RESULTTYPE_KEYBOARD(&result) == keyHANDLED) {
+            return;
+        }
+    }
+    switch (key->kb.keys[0]) {                      /* Move focus with precomputed neighbours */
+        case GUI_KEY_UP:
+            guii_focus_move(GUI_FOCUS_DIR_UP);
+            break;
+        case GUI_KEY_DOWN:
+            guii_focus_move(GUI_FOCUS_DIR_DOWN);
+            break;
+        case GUI_KEY_LEFT:
+            guii_focus_move(GUI_FOCUS_DIR_LEFT);
+            break;
+        case GUI_KEY_RIGHT:
+            guii_focus_move(GUI_FOCUS_DIR_RIGHT);
+            break;
+        case GUI_KEY_TAB:
+            guii_focus_move(GUI_FOCUS_DIR_NEXT);
+            break;
+        default:
+            break;
+    }
+#else /* GUI_CFG_USE_FOCUS_GRAPH */
+    if (GUI.focused_widget != NULL) {               /* Check if any widget is in focus already */
+        GUI_EVT_PARAMTYPE_KEYBOARD(&param) = key;
+        GUI_EVT_RESULTTYPE_KEYBOARD(&result) = keyCONTINUE;
+        guii_widget_callback(GUI.focused_widget, GUI_EVT_KEYPRESS, &param, &result);
+        if (GUI_EVT_RESULTTYPE_KEYBOARD(&result) != keyHANDLED) {
+            if (key->kb.keys[0] == GUI_KEY_TAB) {   /* Tab key pressed, set next widget as focused */
+                gui_handle_p h = gui_linkedlist_widgetgetnext(NULL, GUI.active_widget); /* Get next widget if possible */
+                if (h != NULL && guii_widget_ishidden(h)) {/* Ignore hidden widget */
+                    h = NULL;
+                }
+                if (h == NULL) {                    /* There is no next widget */
+                    for (h = gui_linkedlist_widgetgetnext(guii_widget_getparent(GUI.focused_widget), NULL); 
+                        h != NULL; h = gui_linkedlist_widgetgetnext(NULL, h)) {
+                        if (guii_widget_isvisible(h)) { /* Check if widget is visible */
+                            break;
+                        }
                     }
-                } else {
-                    *result = GUI_EVT_DBLCLICK;     /* Double click event */
-                    PT_EXIT(&ts->pt);               /* Reset protothread */
+                }
+                if (h != NULL) {                    /* We have next widget */
+                    if (!guii_widget_islayoutchild(h)) {
+                        gui_linkedlist_widgetmovetobottom(h);   /* Set widget to the down of list */
+                    }
+                    guii_widget_focus_set(h);       /* Set focus to new widget */
                 }
             }
+        }
+    }
+#endif /* !GUI_CFG_USE_FOCUS_GRAPH */
+}
+#endif /* GUI_CFG_USE_KEYBOARD || __DOXYGEN__ */
+
+#if GUI_CFG_USE_TOUCH || GUI_CFG_USE_KEYBOARD || __DOXYGEN__
+
+/**
+ * \brief           Process touch and keyboard inputs in single pass
+ *
+ *                  Entries of both input buffers are processed in order of their time.
+ *                  When \ref GUI_CFG_INPUT_BUDGET is set, processing stops after budget is used
+ *                  and remaining entries are processed on next call, after frame is redrawn
+ */
+static void
+process_input(void) {
+#if GUI_CFG_USE_TOUCH
+    uint8_t touch_processed = 0;
+#endif /* GUI_CFG_USE_TOUCH */
+#if GUI_CFG_USE_KEYBOARD
+    guii_keyboard_data_t key;
+#endif /* GUI_CFG_USE_KEYBOARD */
+#if GUI_CFG_USE_TOUCH && GUI_CFG_USE_KEYBOARD
+    uint32_t touch_time, key_time;
+    uint8_t touch_avail, key_avail;
+#endif /* GUI_CFG_USE_TOUCH && GUI_CFG_USE_KEYBOARD */
+#if GUI_CFG_INPUT_BUDGET
+    size_t budget = GUI_CFG_INPUT_BUDGET;
+#endif /* GUI_CFG_INPUT_BUDGET */
+    
+    while (1) {
+#if GUI_CFG_INPUT_BUDGET
+        if (budget == 0) {                          /* Leave remaining entries for next frame */
+            break;
+        }
+        --budget;
+#endif /* GUI_CFG_INPUT_BUDGET */
+#if GUI_CFG_USE_TOUCH && GUI_CFG_USE_KEYBOARD
+        touch_avail = guii_input_touchnexttime(&touch_time);
+        key_avail = guii_input_keynexttime(&key_time);
+        if (touch_avail && (!key_avail || (int32_t)(touch_time - key_time) <= 0)) { /* Oldest entry first */
+            guii_input_touchread(&GUI.touch.ts);
+            process_touch_entry();
+            touch_processed = 1;
+        } else if (key_avail) {
+            guii_input_keyread(&key.kb);
+            process_key_entry(&key);
         } else {
-            if (!i) {                               /* Timeout occurred with no touch data, long click */
-                *result = GUI_EVT_LONGCLICK;        /* Click event occurred */
-            }
-            PT_EXIT(&ts->pt);                       /* Exit protothread here */
+            break;
         }
-        i++;
+#elif GUI_CFG_USE_TOUCH
+        if (!guii_input_touchread(&GUI.touch.ts)) {
+            break;
+        }
+        process_touch_entry();
+        touch_processed = 1;
+#else /* GUI_CFG_USE_TOUCH */
+        if (!guii_input_keyread(&key.kb)) {
+            break;
+        }
+        process_key_entry(&key);
+#endif /* !GUI_CFG_USE_TOUCH */
     }
-    PT_END(&ts->pt);                                /* Stop thread execution */
+#if GUI_CFG_USE_TOUCH
+    if (touch_processed) {
+#if GUI_CFG_USE_GESTURE
+        guii_gesture_process();                     /* Recognize gestures from coalesced samples */
+#endif /* GUI_CFG_USE_GESTURE */
+    } else {                                        /* No new touch events, periodically call touch event thread */
+        process_touch_idle();
+    }
+#endif /* GUI_CFG_USE_TOUCH */
 }
 
+#endif /* GUI_CFG_USE_TOUCH || GUI_CFG_USE_KEYBOARD || __DOXYGEN__ */
+
+/* Frame may be drawn in multiple processing passes only on drawing layer which is not on display */
+#define REDRAW_SLICED               (GUI_CFG_REDRAW_BUDGET && !GUI_CFG_USE_BAND_RENDERING && !GUI_CFG_USE_DIRECT_RENDERING)
+
+/* Dirty regions are moved to snapshot when core protection may be released during frame */
+#define REDRAW_SNAPSHOT             ((GUI_CFG_OS && GUI_CFG_REDRAW_YIELD) || REDRAW_SLICED)
+
+#if REDRAW_SNAPSHOT || __DOXYGEN__
+static gui_display_t redraw_regions[GUI_CFG_DISPLAY_REGIONS];   /*!< Snapshot of dirty regions of frame being drawn */
+static gui_display_t redraw_next;                   /*!< Bounding box of regions invalidated while frame is drawn */
+#endif /* REDRAW_SNAPSHOT || __DOXYGEN__ */
+
+#if (GUI_CFG_OS && GUI_CFG_REDRAW_YIELD) || __DOXYGEN__
+
 /**
- * \brief           Process input touch event
- *                  
- *                  Scan all widgets from top to bottom which will be first on valid 
- *                  position for touch and call callback function to this widget
- * \param[in]       touch: Touch data info
- * \param[in]       parent: Parent widget where to check for touch
- * \return          Member of \ref guii_touch_status_t enumeration about success
+ * \brief           Release core protection between dirty regions of frame
+ *
+ *                  Widget handles stay valid as widgets are removed only by GUI thread.
+ *                  Invalidations made meanwhile are collected for next frame and
+ *                  redraw flags are kept till then as they cannot be told apart from flags of current frame
  */
-static guii_touch_status_t
-process_touch(guii_touch_data_t* const touch, gui_touch_data_t* const touch_old, gui_handle_p parent) {
-    gui_handle_p h;
-    static uint8_t deep = 0;
-    static uint8_t isKeyboard = 0;
-    uint8_t dialogOnly = 0;
-    guii_touch_status_t tStat = touchCONTINUE;
+static void
+redraw_yield(void) {
+    memcpy(&GUI.display, &redraw_next, sizeof(GUI.display));/* Clipping of current region is set again after yield */
+    GUI.redrawing = 0;
+    GUI_CORE_UNPROTECT(1);
+    gui_sys_thread_yield();                         /* Let waiting threads take protection */
+    GUI_CORE_PROTECT(1);
+    GUI.redrawing = 1;
+    memcpy(&redraw_next, &GUI.display, sizeof(redraw_next));
+    if (GUI.display_regions_count) {
+        redraw_keep_flags = 1;
+    }
+}
+
+#define REDRAW_YIELD()              redraw_yield()
+#else /* (GUI_CFG_OS && GUI_CFG_REDRAW_YIELD) || __DOXYGEN__ */
+#define REDRAW_YIELD()              do {} while (0)
+#endif /* !((GUI_CFG_OS && GUI_CFG_REDRAW_YIELD) || __DOXYGEN__) */
+
+#if GUI_CFG_USE_BAND_RENDERING || __DOXYGEN__
+
+/**
+ * \brief           Redraw all dirty regions band by band into small layer buffer
+ *
+ *                  Each band is filled with background color first, then all widgets in band
+ *                  are redrawn and band is sent to display using low-level layer
+ */
+static void
+redraw_bands(const gui_display_t* regions, size_t regions_count) {
+    gui_layer_t* band;
+    gui_dim_t x1, y1, x2, y2, y, lines;
+    uint8_t result;
+    size_t i;
     
-    /*
-     * To handle touch events, process widgets in reverse order,
-     * starting from widget on most deep level.
-     *
-     * This is due to the fact that widget with most deep level,
-     * is displayed on top of screen = should be detected first
-     */
-    GUI_LINKEDLIST_WIDGETSLISTPREV(parent, h) {
-        if (guii_widget_ishidden(h)) {             /* Ignore hidden widget */
+    for (i = 0; i < regions_count; i++) {
+        /* Limit region to visible screen */
+        x1 = GUI_MAX(regions[i].x1, 0);
+        y1 = GUI_MAX(regions[i].y1, 0);
+        x2 = GUI_MIN(regions[i].x2, GUI.lcd.width);
+        y2 = GUI_MIN(regions[i].y2, GUI.lcd.height);
+        if (x2 <= x1 || y2 <= y1) {
             continue;
         }
         
-        /*
-         * Dialogs are placed as children of main window
-         * If level 1 is current and dialog is detected,
-         * stop processsing other widgets except if widget is inside dialog
-         */
-        if (deep == 1) {                            /* On base elements list = children of base window element */
-            if (guii_widget_isdialogbase(h)) {      /* We found dialog element */
-                dialogOnly = 1;                     /* Check only widgets which are dialog based */
+        lines = (gui_dim_t)(GUI.band_size / (size_t)(x2 - x1)); /* Number of lines of region width fitting into buffer */
+        for (y = y1; y < y2; y += lines) {
+            if (i > 0 || y > y1) {
+                REDRAW_YIELD();                     /* Band was sent, let other threads access GUI */
+            }
+            
+            /* With 2 band buffers, next band is rendered while previous one is still transferred */
+            band = &GUI.lcd.layers[GUI.band_index];
+            while (band->pending) {                 /* Wait till low-level finished transfer from this buffer */
+#if GUI_CFG_OS
+                gui_sys_thread_yield();
+#endif /* GUI_CFG_OS */
+            }
+            GUI.lcd.drawing_layer = band;
+            GUI.lcd.active_layer = band;
+            band->x_pos = x1;
+            band->y_pos = y;
+            band->width = x2 - x1;
+            band->height = GUI_MIN(lines, y2 - y);
+            
+            GUI.display.x1 = band->x_pos;
+            GUI.display.y1 = band->y_pos;
+            GUI.display.x2 = band->x_pos + band->width;
+            GUI.display.y2 = band->y_pos + band->height;
+            
+            /* Clear flags only on last band of last region */
+            redraw_clear_flags = !redraw_keep_flags && (i == (regions_count - 1)) && (y + lines) >= y2;
+            
+#if GUI_CFG_USE_WIDGET_ORDER
+            widget_order_update();
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
+            if (!is_covered_by_opaque_children(NULL, &GUI.display)) {
+                /* Same background as initial fill of frame buffer layers, desktop usually paints complete band */
+                GUI_LL(Fill)(&GUI.lcd, band, band->start_address, band->width, band->height, 0, GUI_COLOR_LIGHTGRAY);
+            }
+            redraw_widgets(NULL, 0, 1);             /* All widgets must be drawn as band has no previous content */
+#if GUI_CFG_USE_REDRAW_DEBUG
+            redraw_debug_overlay(&GUI.display, regions, regions_count);
+#endif /* GUI_CFG_USE_REDRAW_DEBUG */
+            
+            result = 1;
+            if (GUI.band_count > 1) {
+                band->pending = 1;                  /* Cleared by low-level when transfer is finished */
+                GUI.band_index ^= 1;
             }
+            GUI_LL_CONTROL(GUI_LL_Command_FlushBand, band, &result); /* Send band to display */
         }
-        
-        /* When we should only check dialogs and previous element is not dialog anymore */
-        if (dialogOnly && !guii_widget_isdialogbase(h)) {
-            break;
+    }
+}
+
+#endif /* GUI_CFG_USE_BAND_RENDERING || __DOXYGEN__ */
+
+#if !GUI_CFG_USE_BAND_RENDERING || __DOXYGEN__
+
+/* Layer read by remote stream encoder is not drawn */
+#if GUI_CFG_USE_REMOTE
+#define LAYER_IS_READ(l)            guii_remote_reading(l)
+#else /* GUI_CFG_USE_REMOTE */
+#define LAYER_IS_READ(l)            0
+#endif /* !GUI_CFG_USE_REMOTE */
+
+/**
+ * \brief           Get layer for next frame
+ * \note            With triple buffering, layer with oldest content which is not on display
+ *                  and not waiting for display is used, otherwise layer not used by last frame
+ * \return          Layer to draw on or `NULL` if all layers are in use
+ */
+static gui_layer_t*
+redraw_get_layer(void) {
+#if GUI_CFG_USE_DIRECT_RENDERING
+    return GUI.lcd.active_layer;                    /* Single layer is always used */
+#endif /* GUI_CFG_USE_DIRECT_RENDERING */
+#if GUI_CFG_USE_TRIPLE_BUFFERING
+    gui_layer_t* layer = NULL, *l;
+    size_t i;
+
+    if (GUI.lcd.layer_count >= 3) {
+        for (i = 0; i < GUI.lcd.layer_count; i++) {
+            l = &GUI.lcd.layers[i];
+            if (l != GUI.lcd.active_layer && l != GUI.lcd.display_layer && !l->pending && !LAYER_IS_READ(l)
+                && (layer == NULL || l->frame < layer->frame)) {
+                layer = l;
+            }
         }
-        
-        /* Check for keyboard mode */
-        if (h->id == GUI_ID_KEYBOARD_BASE) {
-            isKeyboard = 1;                         /* Set keyboard mode as 1 */
+        return layer;
+    }
+#endif /* GUI_CFG_USE_TRIPLE_BUFFERING */
+    if (GUI.lcd.flags & GUI_FLAG_LCD_WAIT_LAYER_CONFIRM) {  /* Layer of previous frame is still shown */
+        return NULL;
+    }
+    if (LAYER_IS_READ(GUI.lcd.drawing_layer)) {     /* Older frame is still streamed from layer */
+        return NULL;
+    }
+    return GUI.lcd.drawing_layer;
+}
+
+/**
+ * \brief           Copy region from layer with newest content to drawing layer
+ * \param[in]       drawing: Destination layer
+ * \param[in]       active: Source layer
+ * \param[in]       disp: Region to copy
+ */
+static void
+redraw_copy_region(gui_layer_t* drawing, gui_layer_t* active, const gui_display_t* disp) {
+    if (disp->x1 < GUI.lcd.width && disp->x2 >= 0 && disp->y1 < GUI.lcd.height && disp->y2 >= 0) {
+        GUI_LL(Copy)(&GUI.lcd, drawing, 
+            (void *)(((uint8_t *)drawing->start_address) + GUI.lcd.pixel_size * (disp->y1 * drawing->width + disp->x1)),   /* Destination address */
+            (void *)(((uint8_t *)active->start_address) + GUI.lcd.pixel_size * (disp->y1 * active->width + disp->x1)), /* Source address */
+            disp->x2 - disp->x1,                    /* Area width */
+            disp->y2 - disp->y1,                    /* Area height */
+            drawing->width - (disp->x2 - disp->x1), /* Offline destination */
+            active->width - (disp->x2 - disp->x1)   /* Offline source */
+        );
+    }
+}
+
+/**
+ * \brief           Bring drawing layer up to date with newest frame
+ *
+ *                  Regions drawn in all frames newer than content of drawing layer are copied from active layer.
+ *                  When any of these frames is not available on layers anymore, complete screen is copied
+ *
+ * \param[in]       drawing: Layer to draw next frame on
+ * \param[in]       active: Layer with newest frame
+ */
+static void
+redraw_copy_stale(gui_layer_t* drawing, gui_layer_t* active) {
+    gui_display_t copied[GUI_CFG_DISPLAY_REGIONS];
+    size_t i, k, c, copied_count = 0, frames = 0;
+    const gui_layer_t* l;
+    const gui_display_t* r;
+
+    if (drawing == active) {
+        return;
+    }
+    for (i = 0; i < GUI.lcd.layer_count; i++) {     /* Count newer frames still kept on layers */
+        if (GUI.lcd.layers[i].frame > drawing->frame) {
+            frames++;
         }
-        
-        /*
-         * Before we check if touch position matches widget coordinates
-         * we have to check if this widget has any direct children
-         */
-        if (guii_widget_haschildren(h)) {           /* Check if widget has children */
-            deep++;                                 /* Go deeper in level */
-            tStat = process_touch(touch, touch_old, h); /* Process touch on widget elements first */
-            deep--;                                 /* Go back to normal level */
+    }
+    if (frames != active->frame - drawing->frame) { /* Regions of some frame are lost */
+        gui_display_t all = { 0, 0, GUI.lcd.width, GUI.lcd.height };
+        redraw_copy_region(drawing, active, &all);
+        return;
+    }
+    for (i = 0; i < GUI.lcd.layer_count; i++) {
+        l = &GUI.lcd.layers[i];
+        if (l->frame <= drawing->frame) {
+            continue;
         }
-        
-        /* hildren widgets were not detected */
-        if (tStat == touchCONTINUE) {               /* Do we still have to check this widget? */
-            check_disp_clipping(h);                 /* Check display region where widget is placed */
-        
-            /* Check if widget is in touch area */
-            if (touch->ts.x[0] >= GUI.display_temp.x1 && touch->ts.x[0] <= GUI.display_temp.x2 && 
-                touch->ts.y[0] >= GUI.display_temp.y1 && touch->ts.y[0] <= GUI.display_temp.y2) {
-                set_relative_coordinate(touch, touch_old, h);
-                    
-                /* Call touch start callback to see if widget accepts touches */
-                GUI_EVT_PARAMTYPE_TOUCH(&GUI.evt_param) = touch;
-                guii_widget_callback(h, GUI_EVT_TOUCHSTART, &GUI.evt_param, &GUI.evt_result);
-                tStat = GUI_EVT_RESULTTYPE_TOUCH(&GUI.evt_result);
-                if (tStat == touchCONTINUE) {       /* Check result status */
-                    tStat = touchHANDLED;           /* If command is processed, touchCONTINUE can't work */
+        for (k = 0; k < l->regions_count; k++) {
+            r = &l->regions[k];
+            for (c = 0; c < copied_count; c++) {    /* Skip regions already copied from overlapping frame */
+                if (copied[c].x1 <= r->x1 && copied[c].y1 <= r->y1 && copied[c].x2 >= r->x2 && copied[c].y2 >= r->y2) {
+                    break;
                 }
-                
-                /*
-                 * Move widget down on parent linked list and do the same with all of its parents,
-                 * no matter of touch focus or not
-                 */
-                guii_widget_movedowntree(h);
-                
-                if (tStat == touchHANDLED) {        /* Touch handled for widget completely */
-                    /*
-                     * Set active widget and set flag for it
-                     * Set focus widget and set flag for it but only do this if widget is not related to keyboard
-                     *
-                     * This allows us to click keyboard items but not to lose focus on main widget
-                     */
-                    if (!isKeyboard) {
-                        guii_widget_focus_set(h);
-                    }
-                    guii_widget_active_set(h);
-                    
-                    /*
-                     * Invalidate actual handle object
-                     * Already invalidated in guii_widget_active_set function
-                     */
-                    //gui_widget_invalidate(h);   
-                } else {                            /* Touch handled with no focus */
-                    /*
-                     * When touch was handled without focus,
-                     * process only clearing currently focused and active widgets and clear them
-                     */
-                    if (!isKeyboard) {
-                        guii_widget_focus_clear();
-                    }
-                    guii_widget_active_clear();
+            }
+            if (c == copied_count) {
+                redraw_copy_region(drawing, active, r);
+                if (copied_count < GUI_COUNT_OF(copied)) {
+                    copied[copied_count++] = *r;
+                }
+            }
+        }
+    }
+}
+
+#endif /* !GUI_CFG_USE_BAND_RENDERING || __DOXYGEN__ */
+
+#if GUI_CFG_USE_COPY_MOVE || GUI_CFG_USE_POPUP_RESTORE || __DOXYGEN__
+
+/**
+ * \brief           Expand first region to cover second region too
+ * \param[in,out]   a: Region to expand
+ * \param[in]       b: Region to include
+ */
+static void
+merge_region(gui_display_t* a, const gui_display_t* b) {
+    a->x1 = GUI_MIN(a->x1, b->x1);
+    a->y1 = GUI_MIN(a->y1, b->y1);
+    a->x2 = GUI_MAX(a->x2, b->x2);
+    a->y2 = GUI_MAX(a->y2, b->y2);
+}
+
+/**
+ * \brief           Add area written by copy to regions of layer with newest frame
+ *
+ *                  Copied area is part of frame, next drawing layer must be updated with it too
+ *
+ * \param[in]       r: Copied area
+ */
+static void
+redraw_add_copied(const gui_display_t* r) {
+    gui_layer_t* l = GUI.lcd.active_layer;
+
+    if (l->regions_count < GUI_COUNT_OF(l->regions)) {
+        l->regions[l->regions_count++] = *r;
+    } else {
+        merge_region(&l->regions[l->regions_count - 1], r);
+    }
+    merge_region(&l->display, r);
+}
+
+#endif /* GUI_CFG_USE_COPY_MOVE || GUI_CFG_USE_POPUP_RESTORE || __DOXYGEN__ */
+
+#if GUI_CFG_USE_COPY_MOVE || __DOXYGEN__
+
+/**
+ * \brief           Copy pixels of moved widget from its area on newest frame to its new position
+ *
+ *                  Widget content did not change since newest frame, only background uncovered
+ *                  at old position is redrawn. Dirty regions drawn after copy overwrite it where necessary
+ *
+ * \param[in]       drawing: Layer to draw next frame on
+ * \param[in]       active: Layer with newest frame
+ * \param[out]      dst: Area on drawing layer written by copy
+ * \return          `1` if pixels were copied, `0` otherwise
+ */
+static uint8_t
+redraw_copy_move(gui_layer_t* drawing, gui_layer_t* active, gui_display_t* dst) {
+    const gui_display_t* src = &GUI.move_src;
+    gui_handle_p h = GUI.move_widget;
+
+    GUI.move_widget = NULL;
+    if (h == NULL || drawing == active) {
+        return 0;
+    }
+    dst->x1 = gui_widget_getabsolutex(h);
+    dst->y1 = gui_widget_getabsolutey(h);
+    dst->x2 = dst->x1 + (src->x2 - src->x1);
+    dst->y2 = dst->y1 + (src->y2 - src->y1);
+    if (dst->x1 < 0 || dst->y1 < 0 || dst->x2 > GUI.lcd.width || dst->y2 > GUI.lcd.height) {
+        return 0;                                   /* Widget is redrawn at new position */
+    }
+    GUI_LL(Copy)(&GUI.lcd, drawing,
+        (void *)(((uint8_t *)drawing->start_address) + GUI.lcd.pixel_size * (dst->y1 * drawing->width + dst->x1)),  /* Destination address */
+        (void *)(((uint8_t *)active->start_address) + GUI.lcd.pixel_size * (src->y1 * active->width + src->x1)),    /* Source address */
+        src->x2 - src->x1,                          /* Area width */
+        src->y2 - src->y1,                          /* Area height */
+        drawing->width - (src->x2 - src->x1),       /* Offline destination */
+        active->width - (src->x2 - src->x1)         /* Offline source */
+    );
+    return 1;
+}
+
+/**
+ * \brief           Copy pixels of scrolled area from newest frame shifted by scroll distance
+ *
+ *                  Only part of area uncovered by shift is redrawn, see \ref gui_widget_scrollarea
+ *
+ * \param[in]       drawing: Layer to draw next frame on
+ * \param[in]       active: Layer with newest frame
+ * \param[out]      dst: Area on drawing layer written by copy
+ * \return          `1` if pixels were copied, `0` otherwise
+ */
+static uint8_t
+redraw_copy_scroll(gui_layer_t* drawing, gui_layer_t* active, gui_display_t* dst) {
+    const gui_display_t* a = &GUI.scroll_area;
+    gui_dim_t dy = GUI.scroll_dy;
+
+    if (GUI.scroll_widget == NULL || drawing == active) {
+        GUI.scroll_widget = NULL;
+        return 0;
+    }
+    GUI.scroll_widget = NULL;
+    dst->x1 = a->x1;
+    dst->x2 = a->x2;
+    dst->y1 = dy < 0 ? a->y1 : (a->y1 + dy);
+    dst->y2 = dy < 0 ? (a->y2 + dy) : a->y2;
+    GUI_LL(Copy)(&GUI.lcd, drawing,
+        (void *)(((uint8_t *)drawing->start_address) + GUI.lcd.pixel_size * (dst->y1 * drawing->width + dst->x1)),          /* Destination address */
+        (void *)(((uint8_t *)active->start_address) + GUI.lcd.pixel_size * ((dst->y1 - dy) * active->width + dst->x1)),     /* Source address */
+        dst->x2 - dst->x1,                          /* Area width */
+        dst->y2 - dst->y1,                          /* Area height */
+        drawing->width - (dst->x2 - dst->x1),       /* Offline destination */
+        active->width - (dst->x2 - dst->x1)         /* Offline source */
+    );
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_COPY_MOVE || __DOXYGEN__ */
+
+#if GUI_CFG_USE_POPUP_RESTORE || __DOXYGEN__
+
+/**
+ * \brief           Save pixels below popup before it is drawn for the first time
+ * \param[in]       drawing: Layer to draw next frame on, with newest frame in popup area
+ */
+static void
+redraw_popup_save(gui_layer_t* drawing) {
+    const gui_display_t* a = &GUI.popup_area;
+
+    if (GUI.popup_state != GUI_POPUP_SAVE) {
+        return;
+    }
+    GUI_LL(Copy)(&GUI.lcd, drawing,
+        GUI.popup_buff,                             /* Destination address */
+        (void *)(((uint8_t *)drawing->start_address) + GUI.lcd.pixel_size * (a->y1 * drawing->width + a->x1)),  /* Source address */
+        a->x2 - a->x1,                              /* Area width */
+        a->y2 - a->y1,                              /* Area height */
+        0,                                          /* Offline destination */
+        drawing->width - (a->x2 - a->x1)            /* Offline source */
+    );
+    GUI.popup_state = GUI_POPUP_SAVED;
+}
+
+/**
+ * \brief           Copy saved pixels back to area of closed popup
+ *
+ *                  Pixels are restored once popup is removed or redrawn on its closed position,
+ *                  see \ref gui_widget_popup_close
+ *
+ * \param[in]       drawing: Layer to draw next frame on
+ * \param[out]      dst: Area on drawing layer written by copy
+ * \return          `1` if pixels were copied, `0` otherwise
+ */
+static uint8_t
+redraw_popup_restore(gui_layer_t* drawing, gui_display_t* dst) {
+    if (GUI.popup_state != GUI_POPUP_RESTORE || GUI.popup_widget != NULL) {
+        return 0;
+    }
+    memcpy(dst, &GUI.popup_area, sizeof(*dst));
+    GUI_LL(Copy)(&GUI.lcd, drawing,
+        (void *)(((uint8_t *)drawing->start_address) + GUI.lcd.pixel_size * (dst->y1 * drawing->width + dst->x1)),  /* Destination address */
+        GUI.popup_buff,                             /* Source address */
+        dst->x2 - dst->x1,                          /* Area width */
+        dst->y2 - dst->y1,                          /* Area height */
+        drawing->width - (dst->x2 - dst->x1),       /* Offline destination */
+        0                                           /* Offline source */
+    );
+    GUI_MEMFREE(GUI.popup_buff);
+    GUI.popup_state = GUI_POPUP_IDLE;
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_POPUP_RESTORE || __DOXYGEN__ */
+
+#if GUI_CFG_USE_DIRECT_RENDERING || __DOXYGEN__
+
+/**
+ * \brief           Get next dirty region to draw directly to displayed layer
+ *
+ *                  Regions which scan-out has already passed are safe until next frame reaches them,
+ *                  the one closest to top of screen is drawn first.
+ *                  When no region is safe, function waits for scan-out to pass the nearest one
+ *
+ * \param[in]       regions: List of dirty regions
+ * \param[in]       regions_count: Number of regions
+ * \param[in,out]   done: Set to `1` for each region already drawn
+ * \return          Region to draw
+ */
+static const gui_display_t*
+redraw_direct_next(const gui_display_t* regions, size_t regions_count, uint8_t* done) {
+    gui_dim_t line, wait;
+    size_t i, next;
+
+    for (;;) {
+        next = regions_count;
+        wait = GUI_DIM_MAX;
+        if (!GUI_LL_CONTROL(GUI_LL_Command_GetScanLine, NULL, &line)) {
+            line = GUI_DIM_MAX;                     /* Scan line not known, draw in order */
+        }
+        for (i = 0; i < regions_count; i++) {
+            if (done[i]) {
+                continue;
+            }
+            if (regions[i].y2 <= line) {            /* Scan-out passed region */
+                if (next == regions_count || regions[i].y1 < regions[next].y1) {
+                    next = i;
                 }
+            } else if (regions[i].y2 < wait) {
+                wait = regions[i].y2;
+            }
+        }
+        if (next < regions_count) {
+            done[next] = 1;
+            return &regions[next];
+        }
+        wait = GUI_MIN(wait, GUI.lcd.height);
+        GUI_LL_CONTROL(GUI_LL_Command_WaitScanLine, &wait, NULL); /* Line is polled when wait is not supported */
+    }
+}
+
+#endif /* GUI_CFG_USE_DIRECT_RENDERING || __DOXYGEN__ */
+
+#if GUI_CFG_USE_OVERLAY || __DOXYGEN__
+
+/**
+ * \brief           Render widgets shown on overlay planes and update planes on low-level
+ *
+ *                  Widget is rendered completely to plane buffer only when it or any of its children was invalidated.
+ *                  Plane is set to low-level when its content, position, alpha or visibility changed
+ */
+static void
+redraw_overlays(void) {
+    gui_overlay_plane_t* plane;
+    gui_layer_t* layer, *drawing;
+    gui_display_t disp;
+    gui_overlay_t ov;
+    gui_handle_p h;
+    gui_dim_t x, y, wi, hi;
+    uint8_t visible, alpha, update, clear_flags, result;
+    size_t i;
+
+    for (i = 0; i < GUI_COUNT_OF(GUI.overlays); i++) {
+        plane = &GUI.overlays[i];
+        if ((h = plane->h) == NULL) {
+            continue;
+        }
+        visible = !guii_widget_ishiddentree(h);     /* Widget and all parents must be visible */
+        x = gui_widget_getabsolutex(h);
+        y = gui_widget_getabsolutey(h);
+        wi = gui_widget_getwidth(h);
+        hi = gui_widget_getheight(h);
+        alpha = gui_widget_getalpha(h);
+        update = 0;
+
+        /* Plane content must not change while displayed, disable plane before buffer is released */
+        layer = plane->layer;
+        if (layer != NULL && (layer->width != wi || layer->height != hi)) {
+            if (plane->shown) {
+                ov.num = (uint8_t)i;
+                ov.layer = NULL;
+                ov.alpha = 0;
+                GUI_LL_CONTROL(GUI_LL_Command_SetOverlay, &ov, &result);
+                plane->shown = 0;
             }
+            GUI_MEMFREE(layer);
+            layer = plane->layer = NULL;
         }
-        
-        /* Check for keyboard mode */
-        if (gui_widget_getid(h) == GUI_ID_KEYBOARD_BASE) {
-            isKeyboard = 0;                         /* Set keyboard mode as 1 */
+        if (visible && layer == NULL && wi > 0 && hi > 0) {
+            layer = GUI_MEMALLOC_CLASS(sizeof(*layer) + (size_t)wi * (size_t)hi * (size_t)GUI.lcd.pixel_size, GUI_MEM_CLASS_PIXEL);
+            if (layer != NULL) {
+                memset(layer, 0x00, sizeof(*layer));
+                layer->num = (uint8_t)i;
+                layer->width = wi;
+                layer->height = hi;
+                layer->start_address = ((uint8_t *)layer) + sizeof(*layer);
+                layer->pixel_format = GUI.lcd.layers[0].pixel_format;
+                plane->layer = layer;
+                guii_widget_setflag(h, GUI_FLAG_REDRAW);/* New buffer has no content */
+            }
         }
-        
-        if (tStat != touchCONTINUE) {               /* Return status if necessary */
-            return tStat;
+        visible = visible && layer != NULL;
+
+        /* Render complete widget, part outside screen is left transparent */
+        if (visible && guii_widget_getflag(h, GUI_FLAG_REDRAW)) {
+            layer->x_pos = x;
+            layer->y_pos = y;
+            GUI_LL(Fill)(&GUI.lcd, layer, layer->start_address, wi, hi, 0, GUI_COLOR_TRANS);
+
+            memcpy(&disp, &GUI.display, sizeof(disp));
+            GUI.display.x1 = GUI_MAX(x, 0);
+            GUI.display.y1 = GUI_MAX(y, 0);
+            GUI.display.x2 = GUI_MIN(x + wi, GUI.lcd.width);
+            GUI.display.y2 = GUI_MIN(y + hi, GUI.lcd.height);
+            drawing = GUI.lcd.drawing_layer;
+            GUI.lcd.drawing_layer = layer;
+            clear_flags = redraw_clear_flags;
+            redraw_clear_flags = 1;
+            GUI.redrawing = 1;
+            if (GUI.display.x1 < GUI.display.x2 && GUI.display.y1 < GUI.display.y2) {
+#if GUI_CFG_USE_WIDGET_ORDER
+                redraw_tree(NULL, 0, h, widget_order_index(h), 1);
+#else /* GUI_CFG_USE_WIDGET_ORDER */
+                redraw_tree(NULL, 0, h, 0, 1);
+#endif /* !GUI_CFG_USE_WIDGET_ORDER */
+            }
+            GUI.redrawing = 0;
+            redraw_clear_flags = clear_flags;
+            GUI.lcd.drawing_layer = drawing;
+            memcpy(&GUI.display, &disp, sizeof(GUI.display));
+            guii_widget_clrflag(h, GUI_FLAG_REDRAW);
+            gui_lcd_fence();                        /* Drawing must finish before plane shows buffer */
+            update = 1;
+        }
+
+        /* Set plane to low-level only when anything changed */
+        ov.num = (uint8_t)i;
+        ov.layer = visible ? layer : NULL;
+        ov.alpha = alpha;
+        if (visible && (update || !plane->shown || plane->x != x || plane->y != y || plane->alpha != alpha)) {
+            layer->x_pos = x;
+            layer->y_pos = y;
+            GUI_LL_CONTROL(GUI_LL_Command_SetOverlay, &ov, &result);
+            plane->x = x;
+            plane->y = y;
+            plane->alpha = alpha;
+            plane->shown = 1;
+        } else if (!visible && plane->shown) {
+            GUI_LL_CONTROL(GUI_LL_Command_SetOverlay, &ov, &result);
+            plane->shown = 0;
         }
     }
-    return touchCONTINUE;                           /* Try with another widget */
 }
 
-#define __ProcessAfterTouchEventsThread() do {\
-    if (rresult != 0) {                             /* Valid event occurred */\
-        uint8_t ret;                                \
-        GUI_EVT_PARAMTYPE_TOUCH(&param) = &GUI.touch;    \
-        ret = guii_widget_callback(GUI.active_widget, rresult, &param, NULL);\
-        if (rresult == GUI_EVT_DBLCLICK && !ret) {   /* If double click was not recorded, proceed with normal click again */\
-            guii_widget_callback(GUI.active_widget, GUI_EVT_CLICK, &param, NULL);/* Check for normal click now */\
-        }\
-    }\
-} while (0)
+#endif /* GUI_CFG_USE_OVERLAY || __DOXYGEN__ */
+
+#if GUI_CFG_USE_TRANSITION || __DOXYGEN__
 
 /**
- * \brief           Process touch inputs
- * 
- *                  Reads all input touches written so far to buffer 
- *                  and goes one by one
+ * \brief           Render all visible widgets of screen to offscreen layer
+ *
+ *                  Widgets keep their redraw flags, main layer is drawn as usual after transition
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       layer: Screen sized layer to render to
+ */
+void
+guii_redraw_tolayer(gui_layer_t* layer) {
+    gui_display_t disp;
+    gui_layer_t* drawing;
+    uint8_t clear_flags;
+
+#if GUI_CFG_USE_LAYOUT
+    guii_widget_layoutprocess();                    /* Newly shown screen is arranged first */
+#endif /* GUI_CFG_USE_LAYOUT */
+#if GUI_CFG_USE_WIDGET_ORDER
+    widget_order_update();
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
+
+    memcpy(&disp, &GUI.display, sizeof(disp));
+    GUI.display.x1 = 0;
+    GUI.display.y1 = 0;
+    GUI.display.x2 = GUI.lcd.width;
+    GUI.display.y2 = GUI.lcd.height;
+    drawing = GUI.lcd.drawing_layer;
+    GUI.lcd.drawing_layer = layer;
+    clear_flags = redraw_clear_flags;
+    redraw_clear_flags = 0;
+    GUI.redrawing = 1;
+    redraw_widgets(NULL, 0, 1);
+#if GUI_CFG_USE_LL_GPU
+    {
+        uint8_t result = 0;
+        GUI_LL_CONTROL(GUI_LL_Command_Submit, &GUI.display, &result);
+    }
+#endif /* GUI_CFG_USE_LL_GPU */
+    GUI.redrawing = 0;
+    redraw_clear_flags = clear_flags;
+    GUI.lcd.drawing_layer = drawing;
+    memcpy(&GUI.display, &disp, sizeof(GUI.display));
+    gui_lcd_fence();                                /* Drawing must finish before layer is shown */
+}
+
+/**
+ * \brief           Compose pre-rendered screens of running transition in current clipping region
+ *
+ *                  Each screen layer is copied at its display position, incoming screen is on top
  */
 static void
-gui_process_touch(void) {
-    gui_evt_param_t param = {0};
-    gui_evt_result_t result = {0};
-    gui_widget_evt_t rresult;
-    
-    if (guii_input_touchavailable()) {              /* Check if any touch available */
-        while (guii_input_touchread(&GUI.touch.ts)) {   /* Process all touch events possible */
-            /* Set relative coordinates for new widget directly */
-            if (GUI.active_widget != NULL && GUI.touch.ts.status) {
-                set_relative_coordinate(&GUI.touch, &GUI.touch_old, GUI.active_widget);
-            }
-            
-            /*
-             * Old status: pressed
-             * New status: pressed
-             * Action: Touch move on active element
-             */
-            if (GUI.touch.ts.status && GUI.touch_old.status) {
-                if (GUI.active_widget != NULL) {    /* If active widget exists */
-                    if (GUI.touch.ts.count == GUI.touch_old.count) {
-                        gui_handle_p aw = GUI.active_widget;/* Temporary set active widget */
-                        do {
-                            uint8_t r;
-                            GUI_EVT_PARAMTYPE_TOUCH(&param) = &GUI.touch;
-                            GUI_EVT_RESULTTYPE_TOUCH(&result) = touchCONTINUE;
-                            if (aw != GUI.active_widget) {
-                                r = guii_widget_callback(aw, GUI_EVT_TOUCHSTART, &param, &result);   /* The same amount of touch events currently */
-                                GUI_EVT_RESULTTYPE_TOUCH(&result) = touchCONTINUE;
-                            }
-                            r = guii_widget_callback(aw, GUI_EVT_TOUCHMOVE, &param, &result);   /* The same amount of touch events currently */
-                            if (r) {                /* Check if touch move processed */
-                                guii_widget_setflag(aw, GUI_FLAG_TOUCH_MOVE);   /* Touch move has been processed */
-                            } else {
-                                guii_widget_clrflag(aw, GUI_FLAG_TOUCH_MOVE);   /* Touch move has not been processed */
-                            }
-                            if (GUI_EVT_RESULTTYPE_TOUCH(&result) != touchCONTINUE) {
-                                break;
-                            }
-                            
-                            /*
-                             * TODO: Handle relative coordinates on new object
-                             *
-                             * If widget does not detect touch start, then forward touch start to parent widget.
-                             * With this approach, you can achieve slider on parent widget
-                             */
-                            aw = guii_widget_getparent(aw);    /* Get parent widget */
-                            if (aw != NULL) {
-                                set_relative_coordinate(&GUI.touch, &GUI.touch_old, aw);
-                            }
-                        } while (aw != NULL);
-                        
-                        /*
-                         * In case touch move widget was detected on another widget,
-                         * set this new widget to active from now on
-                         */
-                        if (aw != NULL) {
-                            if (aw != GUI.active_widget) {
-                                guii_widget_active_set(aw);  /* Set new active widget */
-                            }
-                        }
-                    } else {
-                        GUI_EVT_PARAMTYPE_TOUCH(&param) = &GUI.touch;
-                        GUI_EVT_RESULTTYPE_TOUCH(&result) = touchCONTINUE;
-                        guii_widget_callback(GUI.active_widget, GUI_EVT_TOUCHSTART, &param, &result);    /* New amount of touch elements happened */
-                    }
-                }
-            }
-            
-            /*
-             * Old status: released
-             * New status: pressed
-             * Action: Touch down on element, find element
-             */
-            if (GUI.touch.ts.status && !GUI.touch_old.status) {
-                process_touch(&GUI.touch, &GUI.touch_old, NULL);
-                if (GUI.active_widget != GUI.active_widget_prev) {  /* If new active widget is not the same as previous */
-                    PT_INIT(&GUI.touch.pt)          /* Reset thread, otherwise process with double click event */
-                }
-            }
-            
-            /* Periodical check for events on active widget */
-            if (GUI.active_widget != NULL) {
-                __TouchEvents_Thread(&GUI.touch, &GUI.touch_old, 1, &rresult);   /* Call thread for touch process */
-                __ProcessAfterTouchEventsThread();  /* Process after event macro */
-            }
-            
-            /*
-             * Old status: pressed
-             * New status: released
-             * Action: Touch up on active element
-             */
-            if (!GUI.touch.ts.status && GUI.touch_old.status) {
-                if (GUI.active_widget != NULL) {    /* Check if active widget */
-                    GUI_EVT_PARAMTYPE_TOUCH(&param) = &GUI.touch;
-                    GUI_EVT_RESULTTYPE_TOUCH(&result) = touchCONTINUE;
-                    guii_widget_callback(GUI.active_widget, GUI_EVT_TOUCHEND, &param, &result);  /* Process callback function */
-                    guii_widget_active_clear();     /* Clear active widget */
-                }
-            }
-            
-            memcpy((void *)&GUI.touch_old, (void *)&GUI.touch.ts, sizeof(GUI.touch_old));   /* Copy current touch to last touch status */
+redraw_transition(void) {
+    gui_layer_t* drawing = GUI.lcd.drawing_layer, *layer;
+    gui_dim_t x1, y1, x2, y2;
+    size_t i;
+
+    for (i = 0; i < GUI_COUNT_OF(GUI.transition.layers); i++) {
+        layer = GUI.transition.layers[i];
+        x1 = GUI_MAX(GUI.display.x1, layer->x_pos);
+        y1 = GUI_MAX(GUI.display.y1, layer->y_pos);
+        x2 = GUI_MIN(GUI.display.x2, layer->x_pos + layer->width);
+        y2 = GUI_MIN(GUI.display.y2, layer->y_pos + layer->height);
+        if (x1 >= x2 || y1 >= y2) {
+            continue;
         }
-    } else {                                        /* No new touch events, periodically call touch event thread */
-        __TouchEvents_Thread(&GUI.touch, &GUI.touch_old, 0, &rresult);   /* Call thread for touch process periodically, handle long presses or timeouts */
-        __ProcessAfterTouchEventsThread();          /* Process after event macro */
+        GUI_LL(Copy)(&GUI.lcd, drawing,
+            (void *)(((uint8_t *)drawing->start_address) + GUI.lcd.pixel_size * (y1 * drawing->width + x1)),
+            (void *)(((uint8_t *)layer->start_address) + GUI.lcd.pixel_size * ((y1 - layer->y_pos) * layer->width + (x1 - layer->x_pos))),
+            x2 - x1, y2 - y1, drawing->width - (x2 - x1), layer->width - (x2 - x1)
+        );
     }
 }
 
-#endif /* GUI_CFG_USE_TOUCH */
+#endif /* GUI_CFG_USE_TRANSITION || __DOXYGEN__ */
 
-#if GUI_CFG_USE_KEYBOARD || __DOXYGEN__
+/**
+ * \brief           Frame being drawn, kept till all dirty regions are drawn
+ */
+typedef struct {
+    const gui_display_t* regions;           /*!< Dirty regions of frame */
+    size_t regions_count;                   /*!< Number of dirty regions */
+#if !GUI_CFG_USE_BAND_RENDERING || __DOXYGEN__
+    gui_layer_t* active;                    /*!< Layer active when frame was started */
+    gui_layer_t* drawing;                   /*!< Layer frame is drawn on */
+    gui_display_t bounds;                   /*!< Bounding box of all dirty regions */
+#if GUI_CFG_USE_COPY_MOVE || __DOXYGEN__
+    gui_display_t move_dst;                 /*!< Area moved widget was copied to */
+    gui_display_t scroll_dst;               /*!< Area scrolled content was copied to */
+    uint8_t moved;                          /*!< Set to `1` when moved widget was copied */
+    uint8_t scrolled;                       /*!< Set to `1` when scrolled content was copied */
+#endif /* GUI_CFG_USE_COPY_MOVE || __DOXYGEN__ */
+#if GUI_CFG_USE_POPUP_RESTORE || __DOXYGEN__
+    gui_display_t popup_dst;                /*!< Area restored from pixels below closed popup */
+    uint8_t restored;                       /*!< Set to `1` when pixels below popup were restored */
+#endif /* GUI_CFG_USE_POPUP_RESTORE || __DOXYGEN__ */
+#endif /* !GUI_CFG_USE_BAND_RENDERING || __DOXYGEN__ */
+#if GUI_CFG_USE_REFRESH_LIMIT || __DOXYGEN__
+    uint32_t start;                         /*!< Time frame was started */
+#endif /* GUI_CFG_USE_REFRESH_LIMIT || __DOXYGEN__ */
+#if REDRAW_SLICED || __DOXYGEN__
+    size_t index;                           /*!< Index of next region to draw */
+    gui_dim_t y;                            /*!< First line of next strip to draw in region */
+    uint8_t pending;                        /*!< Set to `1` when frame is continued in next processing pass */
+#endif /* REDRAW_SLICED || __DOXYGEN__ */
+} redraw_pass_t;
+
+static redraw_pass_t redraw_pass;                   /*!< Frame being drawn */
 
 /**
- * \brief           Process input keyboard data
- * 
- *                  Check all input keyboard data and process entry by entry to relevant widget
+ * \brief           Start new frame with all dirty regions set for redraw
+ * \return          `1` when frame must be drawn, `0` if nothing is left to draw on main layer
  */
-static void
-process_keyboard(void) {
-    guii_keyboard_data_t key;
-    
-    gui_evt_param_t param = {0};
-    gui_evt_result_t result = {0};
+static uint8_t
+redraw_pass_start(void) {
+#if GUI_CFG_USE_POPUP_RESTORE
+    if (GUI.popup_state == GUI_POPUP_RESTORE && GUI.popup_widget != NULL
+        && !guii_widget_getflag(GUI.popup_widget, GUI_FLAG_REMOVE)) {   /* Removed popup is not drawn anymore */
+        gui_handle_p h = GUI.popup_widget;
+        
+        GUI.popup_widget = NULL;
+        gui_widget_invalidatewithparent(h);         /* Closed popup is drawn over restored pixels */
+    }
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
     
-    while (guii_input_keyread(&key.kb)) {           /* Read all keyboard entires */
-        if (GUI.focused_widget != NULL) {           /* Check if any widget is in focus already */
-            GUI_EVT_PARAMTYPE_KEYBOARD(&param) = &key;
-            GUI_EVT_RESULTTYPE_KEYBOARD(&result) = keyCONTINUE;
-            guii_widget_callback(GUI.focused_widget, GUI_EVT_KEYPRESS, &param, &result);
-            if (GUI_EVT_RESULTTYPE_KEYBOARD(&result) != keyHANDLED) {
-                if (key.kb.keys[0] == GUI_KEY_TAB) {/* Tab key pressed, set next widget as focused */
-                    gui_handle_p h = gui_linkedlist_widgetgetnext(NULL, GUI.active_widget); /* Get next widget if possible */
-                    if (h != NULL && guii_widget_ishidden(h)) {/* Ignore hidden widget */
-                        h = NULL;
-                    }
-                    if (h == NULL) {                /* There is no next widget */
-                        for (h = gui_linkedlist_widgetgetnext(guii_widget_getparent(GUI.focused_widget), NULL); 
-                            h != NULL; h = gui_linkedlist_widgetgetnext(NULL, h)) {
-                            if (guii_widget_isvisible(h)) {    /* Check if widget is visible */
-                                break;
-                            }
-                        }
-                    }
-                    if (h != NULL) {                /* We have next widget */
-                        gui_linkedlist_widgetmovetobottom(h); /* Set widget to the down of list */
-                        guii_widget_focus_set(h);   /* Set focus to new widget */
-                    }
-                }
+    GUI.flags &= ~GUI_FLAG_REDRAW;                  /* Clear redraw flag */
+#if GUI_CFG_USE_OVERLAY
+    redraw_overlays();                              /* Overlay planes do not depend on main layer */
+    if (!GUI.display_regions_count && (GUI.display.x1 >= GUI.display.x2 || GUI.display.y1 >= GUI.display.y2)
+#if GUI_CFG_USE_POPUP_RESTORE
+        && (GUI.popup_state != GUI_POPUP_RESTORE || GUI.popup_widget != NULL)
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+        ) {
+        return 0;                                   /* Only overlays changed, main layer stays as is */
+    }
+#endif /* GUI_CFG_USE_OVERLAY */
+    GUI_TRACE(GUI_TRACE_EVT_FRAME_START, GUI.display_regions_count);
+#if GUI_CFG_USE_LATENCY
+    if (GUI.latency.state == GUI_LATENCY_WAIT_FRAME) {
+        GUI.latency.state = GUI_LATENCY_RENDER;     /* Touch result is drawn in this frame */
+    }
+#endif /* GUI_CFG_USE_LATENCY */
+#if GUI_CFG_FRAME_RATE
+    GUI.frame_time = gui_sys_now();                 /* Pace next frame from now if layer confirmation is not used */
+#endif /* GUI_CFG_FRAME_RATE */
+#if GUI_CFG_USE_REFRESH_LIMIT
+    redraw_pass.start = gui_sys_now();
+#endif /* GUI_CFG_USE_REFRESH_LIMIT */
+
+    /* Widgets set for redraw without clipping region use bounding box only */
+    if (!GUI.display_regions_count) {
+        GUI.display_regions[0] = GUI.display;
+        GUI.display_regions_count = 1;
+    }
+    redraw_pass.regions = GUI.display_regions;
+    redraw_pass.regions_count = GUI.display_regions_count;
+#if !GUI_CFG_USE_BAND_RENDERING
+    memcpy(&redraw_pass.bounds, &GUI.display, sizeof(redraw_pass.bounds));  /* Save bounding box of all regions */
+#endif /* !GUI_CFG_USE_BAND_RENDERING */
+    redraw_keep_flags = 0;
+#if REDRAW_SNAPSHOT
+    /* Take dirty set to snapshot, invalidations done while protection is released belong to next frame */
+    memcpy(redraw_regions, GUI.display_regions, sizeof(redraw_regions[0]) * redraw_pass.regions_count);
+    redraw_pass.regions = redraw_regions;
+    GUI.display_regions_count = 0;
+    redraw_next.x1 = GUI_DIM_MAX;
+    redraw_next.y1 = GUI_DIM_MAX;
+    redraw_next.x2 = GUI_DIM_MIN;
+    redraw_next.y2 = GUI_DIM_MIN;
+#endif /* REDRAW_SNAPSHOT */
+#if REDRAW_SLICED
+    redraw_pass.index = 0;
+    redraw_pass.y = redraw_pass.regions[0].y1;
+#endif /* REDRAW_SLICED */
+
+#if !GUI_CFG_USE_BAND_RENDERING
+    /* Copy from currently active layer to drawing layer only changes since its content */
+    redraw_pass.active = GUI.lcd.active_layer;
+    redraw_pass.drawing = redraw_get_layer();
+    GUI.lcd.drawing_layer = redraw_pass.drawing;
+    redraw_copy_stale(redraw_pass.drawing, redraw_pass.active);
+#if GUI_CFG_USE_POPUP_RESTORE
+    redraw_pass.restored = redraw_popup_restore(redraw_pass.drawing, &redraw_pass.popup_dst);   /* Scrolled and moved pixels are newer */
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+#if GUI_CFG_USE_COPY_MOVE
+    redraw_pass.scrolled = redraw_copy_scroll(redraw_pass.drawing, redraw_pass.active, &redraw_pass.scroll_dst);
+    redraw_pass.moved = redraw_copy_move(redraw_pass.drawing, redraw_pass.active, &redraw_pass.move_dst);   /* Moved widget is above scrolled area when they overlap */
+#endif /* GUI_CFG_USE_COPY_MOVE */
+#if GUI_CFG_USE_POPUP_RESTORE
+    redraw_popup_save(redraw_pass.drawing);         /* Drawing layer holds newest frame until widgets are drawn */
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+#endif /* !GUI_CFG_USE_BAND_RENDERING */
+    return 1;
+}
+
+#if !GUI_CFG_USE_BAND_RENDERING || __DOXYGEN__
+
+/**
+ * \brief           Redraw all widgets inside current clipping region on drawing layer
+ */
+static void
+redraw_region(void) {
+#if GUI_CFG_USE_TRANSITION
+    if (GUI.transition.layers[0] != NULL && !GUI.transition.planes) {
+        redraw_transition();                        /* Widgets are drawn again when transition ends */
+    } else
+#endif /* GUI_CFG_USE_TRANSITION */
+    {
+#if GUI_CFG_USE_WIDGET_ORDER
+        widget_order_update();
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
+        redraw_widgets(NULL, 0, 0);
+    }
+#if GUI_CFG_USE_REDRAW_DEBUG
+    redraw_debug_overlay(&GUI.display, redraw_pass.regions, redraw_pass.regions_count);
+#endif /* GUI_CFG_USE_REDRAW_DEBUG */
+#if GUI_CFG_USE_LL_GPU
+    {
+        uint8_t result = 0;
+        GUI_LL_CONTROL(GUI_LL_Command_Submit, &GUI.display, &result);   /* Start commands recorded for region */
+    }
+#endif /* GUI_CFG_USE_LL_GPU */
+}
+
+/**
+ * \brief           Redraw all widgets on drawing layer, once per dirty region
+ *
+ *                  With \ref GUI_CFG_REDRAW_BUDGET, regions are drawn in strips
+ *                  until budget of processing pass is used
+ * \return          `1` when all regions were drawn, `0` when frame continues in next pass
+ */
+static uint8_t
+redraw_pass_draw(void) {
+#if REDRAW_SLICED
+    const gui_display_t* r;
+    uint32_t time = gui_sys_now();
+    uint8_t first = 1;
+
+    while (redraw_pass.index < redraw_pass.regions_count) {
+        if (!first) {
+            if ((gui_sys_now() - time) >= GUI_CFG_REDRAW_BUDGET) {
+                return 0;                           /* Budget used, let input and timers run first */
             }
+            REDRAW_YIELD();                         /* Let other threads access GUI between strips */
+        }
+        first = 0;
+        
+        /* Draw next strip of region */
+        r = &redraw_pass.regions[redraw_pass.index];
+        memcpy(&GUI.display, r, sizeof(GUI.display));
+        GUI.display.y1 = redraw_pass.y;
+        GUI.display.y2 = GUI_MIN(r->y2, redraw_pass.y + GUI_CFG_REDRAW_BUDGET_LINES);
+        redraw_pass.y = GUI.display.y2;
+        if (redraw_pass.y >= r->y2 && ++redraw_pass.index < redraw_pass.regions_count) {
+            redraw_pass.y = redraw_pass.regions[redraw_pass.index].y1;
+        }
+        redraw_clear_flags = !redraw_keep_flags && redraw_pass.index == redraw_pass.regions_count;
+        redraw_region();
+    }
+#else /* REDRAW_SLICED */
+#if GUI_CFG_USE_DIRECT_RENDERING
+    uint8_t done[GUI_CFG_DISPLAY_REGIONS] = {0};
+#endif /* GUI_CFG_USE_DIRECT_RENDERING */
+    size_t i;
+
+    for (i = 0; i < redraw_pass.regions_count; i++) {
+        if (i > 0) {
+            REDRAW_YIELD();                         /* Let other threads access GUI between regions */
         }
+#if GUI_CFG_USE_DIRECT_RENDERING
+        memcpy(&GUI.display, redraw_direct_next(redraw_pass.regions, redraw_pass.regions_count, done), sizeof(GUI.display));
+#else /* GUI_CFG_USE_DIRECT_RENDERING */
+        memcpy(&GUI.display, &redraw_pass.regions[i], sizeof(GUI.display));
+#endif /* !GUI_CFG_USE_DIRECT_RENDERING */
+        redraw_clear_flags = !redraw_keep_flags && i == (redraw_pass.regions_count - 1);
+        redraw_region();
     }
+#endif /* !REDRAW_SLICED */
+    return 1;
 }
-#endif /* GUI_CFG_USE_KEYBOARD || __DOXYGEN__ */
 
 /**
- * \brief           Process redraw of all widgets
+ * \brief           Give completely drawn layer to display
  */
 static void
-process_redraw(void) {
-    gui_layer_t* active = GUI.lcd.active_layer;
-    gui_layer_t* drawing = GUI.lcd.drawing_layer;
+redraw_pass_finish(void) {
+    gui_layer_t* drawing = redraw_pass.drawing;
+#if !GUI_CFG_USE_DIRECT_RENDERING
     uint8_t result = 1;
-    gui_display_t* dispA = &active->display;
-    
-    if ((GUI.lcd.flags & GUI_FLAG_LCD_WAIT_LAYER_CONFIRM) || !(GUI.flags & GUI_FLAG_REDRAW)) {  /* Check if anything to draw first */
-        return;
-    }
-    
-    GUI.flags &= ~GUI_FLAG_REDRAW;                  /* Clear redraw flag */
+#endif /* !GUI_CFG_USE_DIRECT_RENDERING */
 
-    /* Copy from currently active layer to drawing layer only changes on layer */
-    if (dispA->x1 < GUI.lcd.width && dispA->x2 >= 0 && dispA->y1 < GUI.lcd.height && dispA->y2 >= 0) {
-        GUI.ll.Copy(&GUI.lcd, drawing, 
-            (void *)(((uint8_t *)drawing->start_address) + GUI.lcd.pixel_size * (dispA->y1 * drawing->width + dispA->x1)),   /* Destination address */
-            (void *)(((uint8_t *)active->start_address) + GUI.lcd.pixel_size * (dispA->y1 * active->width + dispA->x1)), /* Source address */
-            dispA->x2 - dispA->x1,                  /* Area width */
-            dispA->y2 - dispA->y1,                  /* Area height */
-            drawing->width - (dispA->x2 - dispA->x1),   /* Offline destination */
-            active->width - (dispA->x2 - dispA->x1) /* Offline source */
-        );
-    }
-    
-    redraw_widgets(NULL, 0);                        /* Redraw all widgets now on drawing layer */
+    drawing->frame = ++GUI.frame_num;               /* Save age of layer content */
+#if !GUI_CFG_USE_DIRECT_RENDERING
     drawing->pending = 1;                           /* Set drawing layer as pending */
-
-    /* Draw clipping area rectangle on screen for debug */
-    //gui_draw_rectangle(&GUI.display, GUI.display.x1, GUI.display.y1, GUI.display.x2, GUI.display.y2, GUI_COLOR_RED);
     
     /* Notify low-level about layer change */
     GUI.lcd.flags |= GUI_FLAG_LCD_WAIT_LAYER_CONFIRM;
-    gui_ll_control(&GUI.lcd, GUI_LL_Command_SetActiveLayer, &drawing, &result); /* Set new active layer to low-level driver */
+    GUI_TRACE(GUI_TRACE_EVT_LAYER_SWAP, drawing - GUI.lcd.layers);
+    GUI_LL_CONTROL(GUI_LL_Command_SetActiveLayer, &drawing, &result); /* Set new active layer to low-level driver */
     
     /* Swap active and drawing layers */
     /* New drawings won't be affected until confirmation from low-level is not received */
     GUI.lcd.active_layer = drawing;
-    GUI.lcd.drawing_layer = active;
+    GUI.lcd.drawing_layer = redraw_pass.active;
+#endif /* !GUI_CFG_USE_DIRECT_RENDERING */
     
-    memcpy(&GUI.lcd.active_layer->display, &GUI.display, sizeof(GUI.display));  /* Copy clipping data to region */
+    /* Copy clipping data to region */
+    memcpy(&GUI.lcd.active_layer->display, &redraw_pass.bounds, sizeof(redraw_pass.bounds));
+    memcpy(GUI.lcd.active_layer->regions, redraw_pass.regions, sizeof(redraw_pass.regions[0]) * redraw_pass.regions_count);
+    GUI.lcd.active_layer->regions_count = redraw_pass.regions_count;
+#if GUI_CFG_USE_COPY_MOVE
+    if (redraw_pass.scrolled) {
+        redraw_add_copied(&redraw_pass.scroll_dst);
+    }
+    if (redraw_pass.moved) {
+        redraw_add_copied(&redraw_pass.move_dst);
+    }
+#endif /* GUI_CFG_USE_COPY_MOVE */
+#if GUI_CFG_USE_POPUP_RESTORE
+    if (redraw_pass.restored) {
+        redraw_add_copied(&redraw_pass.popup_dst);
+    }
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+#if GUI_CFG_USE_REMOTE
+    guii_remote_frame(GUI.lcd.active_layer);        /* Stream changed areas of finished frame */
+#endif /* GUI_CFG_USE_REMOTE */
+}
+
+#endif /* !GUI_CFG_USE_BAND_RENDERING || __DOXYGEN__ */
+
+#if REDRAW_SLICED || __DOXYGEN__
+
+/**
+ * \brief           Stop drawing of frame till next processing pass
+ *
+ *                  Regions invalidated in the meantime are collected for next frame,
+ *                  drawing layer keeps content drawn so far and is not given to display
+ */
+static void
+redraw_pass_suspend(void) {
+    memcpy(&GUI.display, &redraw_next, sizeof(GUI.display));
+    redraw_pass.pending = 1;
+}
+
+/**
+ * \brief           Continue drawing of frame started by previous processing pass
+ */
+static void
+redraw_pass_resume(void) {
+    memcpy(&redraw_next, &GUI.display, sizeof(redraw_next));
+    if (GUI.display_regions_count) {                /* Widgets invalidated between passes are drawn again in next frame */
+        redraw_keep_flags = 1;
+    }
+    GUI.lcd.drawing_layer = redraw_pass.drawing;
+    redraw_pass.pending = 0;
+}
+
+#endif /* REDRAW_SLICED || __DOXYGEN__ */
+
+/**
+ * \brief           Check if redraw is pending and get time until it may start
+ * \param[out]      delay: Pointer to output variable to save number of milliseconds
+ *                      until redraw may start, according to frame rate and coalescing window
+ * \return          `1` if redraw is pending and not blocked by layer confirmation, `0` otherwise
+ */
+static uint8_t
+get_redraw_delay(uint32_t* delay) {
+#if GUI_CFG_FRAME_RATE || GUI_CFG_REDRAW_COALESCE_TIME
+    uint32_t time, diff;
+#endif /* GUI_CFG_FRAME_RATE || GUI_CFG_REDRAW_COALESCE_TIME */
+
+#if REDRAW_SLICED
+    if (redraw_pass.pending) {                      /* Started frame is continued immediately */
+        *delay = 0;
+        return 1;
+    }
+#endif /* REDRAW_SLICED */
+#if GUI_CFG_USE_SPLASH
+    if (GUI.splash_hold) {                          /* Splash image stays on display until widgets are ready */
+        return 0;
+    }
+#endif /* GUI_CFG_USE_SPLASH */
+    if (!(GUI.flags & GUI_FLAG_REDRAW)) {           /* Check if anything to draw first */
+        return 0;
+    }
+#if GUI_CFG_USE_BAND_RENDERING
+    if (GUI.lcd.flags & GUI_FLAG_LCD_WAIT_LAYER_CONFIRM) {
+        return 0;
+    }
+#else /* GUI_CFG_USE_BAND_RENDERING */
+    if (redraw_get_layer() == NULL) {               /* No layer to draw on yet */
+        return 0;
+    }
+#endif /* !GUI_CFG_USE_BAND_RENDERING */
+    *delay = 0;
+#if GUI_CFG_FRAME_RATE || GUI_CFG_REDRAW_COALESCE_TIME
+    time = gui_sys_now();
+#endif /* GUI_CFG_FRAME_RATE || GUI_CFG_REDRAW_COALESCE_TIME */
+#if GUI_CFG_FRAME_RATE
+    diff = time - GUI.frame_time;
+    if (diff < (1000 / GUI_CFG_FRAME_RATE)) {      /* Frame period did not elapse yet */
+        *delay = (1000 / GUI_CFG_FRAME_RATE) - diff;
+    }
+#endif /* GUI_CFG_FRAME_RATE */
+#if GUI_CFG_REDRAW_COALESCE_TIME
+    diff = time - GUI.redraw_request_time;
+    if (diff < GUI_CFG_REDRAW_COALESCE_TIME && (GUI_CFG_REDRAW_COALESCE_TIME - diff) > *delay) {
+        *delay = GUI_CFG_REDRAW_COALESCE_TIME - diff;   /* Wait for more invalidations */
+    }
+#endif /* GUI_CFG_REDRAW_COALESCE_TIME */
+    return 1;
+}
+
+/**
+ * \brief           Process redraw of all widgets
+ */
+static void
+process_redraw(void) {
+    uint32_t delay;
+#if GUI_CFG_USE_PROFILER
+    uint32_t start = GUI_CFG_PROFILER_CYCLES();
+#endif /* GUI_CFG_USE_PROFILER */
+    
+#if GUI_CFG_USE_REFRESH_LIMIT
+    if (!(GUI.flags & GUI_FLAG_REDRAW)) {
+        GUI.redraw_overload = 0;                    /* Nothing left to draw, deferred widgets may be drawn again */
+    }
+#endif /* GUI_CFG_USE_REFRESH_LIMIT */
+    if (!get_redraw_delay(&delay) || delay) {       /* Check if anything to draw and if frame may start */
+        return;
+    }
+#if REDRAW_SLICED
+    if (redraw_pass.pending) {
+        redraw_pass_resume();                       /* Frame was started by previous pass */
+    } else if (!redraw_pass_start()) {
+        return;
+    }
+#else /* REDRAW_SLICED */
+    if (!redraw_pass_start()) {
+        return;
+    }
+#endif /* !REDRAW_SLICED */
+
+    GUI.redrawing = 1;
+#if GUI_CFG_USE_BAND_RENDERING
+    redraw_bands(redraw_pass.regions, redraw_pass.regions_count);   /* Redraw regions band by band */
+#else /* GUI_CFG_USE_BAND_RENDERING */
+    if (!redraw_pass_draw()) {
+#if REDRAW_SLICED
+        GUI.redrawing = 0;
+        redraw_pass_suspend();
+#if GUI_CFG_USE_PROFILER
+        GUI.profiler.current.redraw_cycles += GUI_CFG_PROFILER_CYCLES() - start;
+#endif /* GUI_CFG_USE_PROFILER */
+#endif /* REDRAW_SLICED */
+        return;
+    }
+    redraw_pass_finish();
+#endif /* !GUI_CFG_USE_BAND_RENDERING */
+    if (!redraw_keep_flags && redraw_pass.regions_count > 1) {
+        redraw_clear_flags_tree(NULL);              /* Widgets outside of last region were skipped by it */
+    }
+    GUI.redrawing = 0;
+#if GUI_CFG_USE_REFRESH_LIMIT
+    /* Lower priority widgets are deferred while frames, including passes of sliced frame, take too long */
+    GUI.redraw_overload = (gui_sys_now() - redraw_pass.start) > GUI_CFG_REFRESH_FRAME_BUDGET;
+#endif /* GUI_CFG_USE_REFRESH_LIMIT */
     
+#if REDRAW_SNAPSHOT
+    /* Keep regions invalidated during frame for next drawing process */
+    memcpy(&GUI.display, &redraw_next, sizeof(GUI.display));
+#else /* REDRAW_SNAPSHOT */
     /* Invalid clipping region(s) for next drawing process */
+    GUI.display_regions_count = 0;
     GUI.display.x1 = GUI_DIM_MAX;
     GUI.display.y1 = GUI_DIM_MAX;
     GUI.display.x2 = GUI_DIM_MIN;
     GUI.display.y2 = GUI_DIM_MIN;
+#endif /* !REDRAW_SNAPSHOT */
+    GUI_TRACE(GUI_TRACE_EVT_FRAME_END, 0);
+#if GUI_CFG_USE_LATENCY
+    if (GUI.latency.state == GUI_LATENCY_RENDER) {
+        GUI.latency.rendered = gui_sys_now();
+        GUI.latency.confirmed = GUI.latency.rendered;
+        GUI.latency.state = GUI_LATENCY_CONFIRMED;
+        if (GUI.lcd.flags & GUI_FLAG_LCD_WAIT_LAYER_CONFIRM) {
+            GUI.latency.state = GUI_LATENCY_CONFIRM;
+        }
+        latency_save();                             /* Save sample if layer is already on display */
+    }
+#endif /* GUI_CFG_USE_LATENCY */
+#if GUI_CFG_USE_PROFILER
+    GUI.profiler.current.redraw_cycles += GUI_CFG_PROFILER_CYCLES() - start;
+    profiler_end_frame();
+#endif /* GUI_CFG_USE_PROFILER */
+#if GUI_CFG_USE_LL_STATS
+    guii_lcd_stats_endframe();
+#endif /* GUI_CFG_USE_LL_STATS */
+#if GUI_CFG_USE_CACHE_MANAGER
+    guii_cache_frame();                             /* Update cache budgets periodically */
+#endif /* GUI_CFG_USE_CACHE_MANAGER */
+#if GUI_CFG_USE_MEM_FRAME
+    gui_mem_frame_reset();                          /* Scratch buffers are not used after redraw */
+#endif /* GUI_CFG_USE_MEM_FRAME */
+}
+
+#if GUI_CFG_DISPLAY_COUNT > 1 || __DOXYGEN__
+
+/* Members of GUI structure before OS structure belong to display, members from OS structure on are shared */
+#if GUI_CFG_OS
+#define DISPLAY_STATE_SIZE          offsetof(gui_t, OS)
+#else /* GUI_CFG_OS */
+#define DISPLAY_STATE_SIZE          offsetof(gui_t, evt_cb)
+#endif /* !GUI_CFG_OS */
+
+/* Font cache, widget pools and translations are shared between displays */
+#define DISPLAY_SHARE(ctx, m)       memcpy(&GUI.m, &(ctx)->m, sizeof(GUI.m))
+
+/* Display is added when its state is in GUI structure or saved */
+#define DISPLAY_EXISTS(num)         ((num) == display_current || display_ctx[(num)] != NULL)
+
+static gui_t* display_ctx[GUI_CFG_DISPLAY_COUNT];   /*!< Saved state of displays, `NULL` for current display and displays not added */
+static uint8_t display_current;                     /*!< Display with its state in \ref GUI structure */
+static uint8_t display_selected;                    /*!< Display used by application calls */
+static volatile uint8_t display_confirm_layer[GUI_CFG_DISPLAY_COUNT];  /*!< Layer last confirmed by driver of display */
+static volatile uint8_t display_confirm_seq[GUI_CFG_DISPLAY_COUNT];    /*!< Number of confirmations, written by driver only */
+static uint8_t display_confirm_seen[GUI_CFG_DISPLAY_COUNT];            /*!< Number of confirmations already applied to display */
+
+/**
+ * \brief           Make display current by exchanging its saved state with \ref GUI structure
+ *
+ *                  State size is multiple of pointer size as next member of structure is pointer aligned
+ * \param[in]       num: Display number, must be added
+ */
+static void
+display_switch(uint8_t num) {
+    gui_t* ctx = display_ctx[num];
+    size_t* a = (size_t *)&GUI, * b;
+    size_t i, tmp;
+    
+    if (num == display_current || ctx == NULL) {
+        return;
+    }
+    b = (size_t *)ctx;
+    for (i = 0; i < DISPLAY_STATE_SIZE / sizeof(size_t); i++) {
+        tmp = a[i];
+        a[i] = b[i];
+        b[i] = tmp;
+    }
+    DISPLAY_SHARE(ctx, root_fonts);                 /* Shared members were exchanged too, take latest values back */
+    DISPLAY_SHARE(ctx, font_cache);
+    DISPLAY_SHARE(ctx, font_cache_count);
+    DISPLAY_SHARE(ctx, font_cache_size);
+#if GUI_CFG_USE_WIDGET_POOL
+    DISPLAY_SHARE(ctx, widget_pools);
+#endif /* GUI_CFG_USE_WIDGET_POOL */
+#if GUI_CFG_USE_TRANSLATE
+    DISPLAY_SHARE(ctx, translate);
+#endif /* GUI_CFG_USE_TRANSLATE */
+    display_ctx[display_current] = ctx;             /* Structure now holds state of previous display */
+    display_ctx[num] = NULL;
+    display_current = num;
+}
+
+/**
+ * \brief           Apply layer confirmation received from driver of current display
+ */
+static void
+display_applyconfirm(void) {
+    uint8_t seq = display_confirm_seq[display_current];
+    
+    if (seq != display_confirm_seen[display_current]) {
+        display_confirm_seen[display_current] = seq;
+        gui_lcd_confirmactivelayer(display_confirm_layer[display_current]);
+    }
+}
+
+#endif /* GUI_CFG_DISPLAY_COUNT > 1 || __DOXYGEN__ */
+
+#if GUI_CFG_USE_IDLE_REFRESH || __DOXYGEN__
+
+/**
+ * \brief           Set refresh mode of current display
+ * \param[in]       mode: Member of \ref gui_refresh_mode_t enumeration
+ */
+static void
+refresh_setmode(gui_refresh_mode_t mode) {
+    uint8_t result = 1;
+    
+    if (GUI.refresh_mode != (uint8_t)mode) {
+        GUI.refresh_mode = (uint8_t)mode;           /* Mode is kept when driver does not process it, not to send it again */
+        GUI_LL_CONTROL(GUI_LL_Command_SetRefreshMode, &mode, &result);
+    }
+}
+
+/**
+ * \brief           Detect activity of current display and set its refresh mode
+ *
+ *                  Display is active while input entries wait, touch is pressed, redraw is pending
+ *                  or layer change is not confirmed yet. Normal mode is set before entries are processed and frame is drawn
+ *
+ * \param[in]       input: Set to `1` when touch and keyboard inputs are processed on display
+ */
+static void
+refresh_process(uint8_t input) {
+    uint8_t active;
+    
+    active = (GUI.flags & GUI_FLAG_REDRAW) || (GUI.lcd.flags & GUI_FLAG_LCD_WAIT_LAYER_CONFIRM);
+#if GUI_CFG_USE_TOUCH || GUI_CFG_USE_KEYBOARD
+    if (input && guii_input_available()) {
+        active = 1;
+    }
+#endif /* GUI_CFG_USE_TOUCH || GUI_CFG_USE_KEYBOARD */
+#if GUI_CFG_USE_TOUCH
+    if (input && GUI.touch_old.status) {
+        active = 1;
+    }
+#endif /* GUI_CFG_USE_TOUCH */
+    GUI_UNUSED(input);
+    if (active) {
+        GUI.refresh_time = gui_sys_now();
+        refresh_setmode(GUI_REFRESH_MODE_NORMAL);
+    } else if ((gui_sys_now() - GUI.refresh_time) >= GUI_CFG_IDLE_REFRESH_TIMEOUT) {
+        refresh_setmode(GUI_REFRESH_MODE_IDLE);
+    }
+}
+
+#endif /* GUI_CFG_USE_IDLE_REFRESH || __DOXYGEN__ */
+
+#if GUI_CFG_OS || __DOXYGEN__
+
+/**
+ * \brief           Get time till next work of current display
+ * \param[in,out]   has_timeout: Set to `1` when timeout is set
+ * \param[in,out]   timeout: Timeout in units of milliseconds, decreased only
+ */
+static void
+process_gettimeout(uint8_t* has_timeout, uint32_t* timeout) {
+    uint32_t t;
+    
+    if (guii_timer_getnexttimeout(&t) && (!*has_timeout || t < *timeout)) {
+        *has_timeout = 1;
+        *timeout = t;
+    }
+#if GUI_CFG_USE_TOUCH
+    if (GUI.touch_old.status && (!*has_timeout || *timeout > 20)) {
+        *has_timeout = 1;                           /* Poll while pressed to detect long click */
+        *timeout = 20;
+    }
+#endif /* GUI_CFG_USE_TOUCH */
+    if (get_redraw_delay(&t) && (!*has_timeout || t < *timeout)) {
+        *has_timeout = 1;                           /* Redraw is pending, wait only till it may start */
+        *timeout = t;
+    }
+#if GUI_CFG_USE_WIDGET_BUILDER && GUI_CFG_WIDGET_PREBUILD
+    if (GUI.build_list != NULL) {                   /* Builders left for idle passes, do not block */
+        *has_timeout = 1;
+        *timeout = 0;
+    }
+#endif /* GUI_CFG_USE_WIDGET_BUILDER && GUI_CFG_WIDGET_PREBUILD */
+#if GUI_CFG_USE_IDLE_REFRESH
+    if (GUI.refresh_mode == GUI_REFRESH_MODE_NORMAL) {  /* Wake up to set idle refresh mode */
+        t = gui_sys_now() - GUI.refresh_time;
+        t = t < GUI_CFG_IDLE_REFRESH_TIMEOUT ? GUI_CFG_IDLE_REFRESH_TIMEOUT - t : 0;
+        if (!*has_timeout || t < *timeout) {
+            *has_timeout = 1;
+            *timeout = t;
+        }
+    }
+#endif /* GUI_CFG_USE_IDLE_REFRESH */
+}
+
+#endif /* GUI_CFG_OS || __DOXYGEN__ */
+
+/**
+ * \brief           Process timers, input and redraw of current display
+ * \param[in]       input: Set to `1` to process touch and keyboard inputs on display
+ */
+static void
+process_display(uint8_t input) {
+#if GUI_CFG_USE_LATENCY
+    latency_save();                                 /* Layer could be confirmed while thread was waiting */
+#endif /* GUI_CFG_USE_LATENCY */
+#if GUI_CFG_USE_PROFILER
+    {
+        PROFILER_START(start);
+        guii_timer_process();                       /* Process all timers */
+        GUI.profiler.current.timer_cycles += PROFILER_ELAPSED(start);
+    }
+#else /* GUI_CFG_USE_PROFILER */
+    guii_timer_process();                           /* Process all timers */
+#endif /* !GUI_CFG_USE_PROFILER */
+    guii_widget_executeremove();                    /* Delete widgets */
+#if GUI_CFG_USE_LAYOUT
+    guii_widget_layoutprocess();                    /* Arrange children of changed layouts */
+#endif /* GUI_CFG_USE_LAYOUT */
+#if GUI_CFG_USE_IDLE_REFRESH
+    refresh_process(input);                         /* Restore normal refresh before input response is drawn */
+#endif /* GUI_CFG_USE_IDLE_REFRESH */
+#if GUI_CFG_USE_TOUCH || GUI_CFG_USE_KEYBOARD
+    if (input) {
+#if GUI_CFG_USE_PROFILER
+        {
+            PROFILER_START(start);
+            process_input();                        /* Process touch and keyboard inputs */
+            GUI.profiler.current.touch_cycles += PROFILER_ELAPSED(start);
+        }
+#else /* GUI_CFG_USE_PROFILER */
+        process_input();                            /* Process touch and keyboard inputs */
+#endif /* !GUI_CFG_USE_PROFILER */
+    }
+#else /* GUI_CFG_USE_TOUCH || GUI_CFG_USE_KEYBOARD */
+    GUI_UNUSED(input);
+#endif /* !(GUI_CFG_USE_TOUCH || GUI_CFG_USE_KEYBOARD) */
+    process_redraw();                               /* Redraw widgets */
+#if GUI_CFG_USE_REMOTE
+    guii_remote_process();                          /* Send areas left while encoder was busy */
+#endif /* GUI_CFG_USE_REMOTE */
+#if GUI_CFG_USE_MEM_MOVABLE
+    if (!(GUI.flags & GUI_FLAG_REDRAW)) {           /* Nothing left to draw, use idle time to compact heap */
+        gui_mem_compact(GUI_CFG_MEM_COMPACT_BYTES);
+    }
+#endif /* GUI_CFG_USE_MEM_MOVABLE */
+#if GUI_CFG_USE_WIDGET_BUILDER && GUI_CFG_WIDGET_PREBUILD
+    if (!(GUI.flags & GUI_FLAG_REDRAW)) {           /* Nothing left to draw, build hidden containers before they are shown */
+        guii_widget_prebuild();
+    }
+#endif /* GUI_CFG_USE_WIDGET_BUILDER && GUI_CFG_WIDGET_PREBUILD */
 }
 
 /**
@@ -803,33 +3386,65 @@ gui_thread(void * const argument) {
 #endif /* GUI_CFG_OS || __DOXYGEN__ */
 
 /**
- * \brief           Initializes GUI stack.
- *                    In addition, it prepares memory for work with widgets on later usage and
- *                    calls low-layer functions to initialize LCD or custom driver for LCD
+ * \brief           Initialize low-level driver and layers of current display
  * \return          Member of \ref guir_t enumeration
  */
-guir_t
-gui_init(void) {
+static guir_t
+lcd_init(void) {
     uint8_t result;
-
-    memset((void *)&GUI, 0x00, sizeof(GUI));        /* Reset GUI structure */
-    
-    gui_seteventcallback(NULL);                     /* Set event callback */
-    
-#if GUI_CFG_OS
-    /* Init system */
-    gui_sys_init();                                 /* Init low-level system */
-    gui_sys_mbox_create(&GUI.OS.mbox, 32);          /* Message box for 10 elements */
-#endif /* GUI_CFG_OS */
     
     /* Call LCD low-level function */
     result = 1;
-    gui_ll_control(&GUI.lcd, GUI_LL_Command_Init, &GUI.ll, &result);/* Call low-level initialization */
-    GUI.ll.Init(&GUI.lcd);                          /* Call user LCD driver function */
+    GUI_LL_CONTROL(GUI_LL_Command_Init, &GUI.ll, &result); /* Call low-level initialization */
+    GUI_LL(Init)(&GUI.lcd);                         /* Call user LCD driver function */
+#if GUI_CFG_USE_LCD_ROTATION
+    if (!guii_lcd_rotation_init()) {                /* Map drawing calls to physical orientation */
+        return guiERROR;
+    }
+#endif /* GUI_CFG_USE_LCD_ROTATION */
+#if GUI_CFG_USE_LL_STATS
+    guii_lcd_stats_init();                          /* Count pixels of all low-level drawing calls */
+#endif /* GUI_CFG_USE_LL_STATS */
     
     /* Check situation with layers */
     if (GUI.lcd.layer_count >= 1) {
         size_t i;
+        
+        /* Drivers not aware of pixel format only set pixel size */
+        for (i = 0; i < GUI.lcd.layer_count; i++) {
+            if (GUI.lcd.pixel_size == 2 && GUI.lcd.layers[i].pixel_format == GUI_PIXEL_FORMAT_ARGB8888) {
+                GUI.lcd.layers[i].pixel_format = GUI_PIXEL_FORMAT_RGB565;
+            }
+        }
+#if GUI_CFG_USE_BAND_RENDERING
+        /* Single small layer is used for all bands */
+        if (!GUI.lcd.layers[0].width) {
+            GUI.lcd.layers[0].width = GUI.lcd.width;
+        }
+        GUI.band_size = (size_t)GUI.lcd.layers[0].width * (size_t)GUI.lcd.layers[0].height;
+        GUI.band_count = 1;
+        if (GUI.lcd.layer_count > 1 && GUI.lcd.layers[1].start_address != NULL) {  /* Second buffer for pipelined transfer */
+            if (!GUI.lcd.layers[1].width) {
+                GUI.lcd.layers[1].width = GUI.lcd.width;
+            }
+            GUI.band_size = GUI_MIN(GUI.band_size, (size_t)GUI.lcd.layers[1].width * (size_t)GUI.lcd.layers[1].height);
+            GUI.band_count = 2;
+        }
+        if (GUI.band_size < (size_t)GUI.lcd.width) {/* At least one line must fit into buffer */
+            return guiERROR;
+        }
+        GUI.lcd.active_layer = &GUI.lcd.layers[0];
+        GUI.lcd.drawing_layer = &GUI.lcd.layers[0];
+        
+        /* Draw entire screen on first redraw */
+        GUI.display_regions[0].x1 = 0;
+        GUI.display_regions[0].y1 = 0;
+        GUI.display_regions[0].x2 = GUI.lcd.width;
+        GUI.display_regions[0].y2 = GUI.lcd.height;
+        GUI.display_regions_count = 1;
+        GUI.display = GUI.display_regions[0];
+        GUI.flags |= GUI_FLAG_REDRAW;
+#else /* GUI_CFG_USE_BAND_RENDERING */
         /* Set default values for all layers */
         /* User layers use full screen */
         for (i = 0; i < GUI.lcd.layer_count; i++) {
@@ -840,17 +3455,74 @@ gui_init(void) {
         }
         GUI.lcd.active_layer = &GUI.lcd.layers[0];
         GUI.lcd.drawing_layer = &GUI.lcd.layers[0];
-        GUI.ll.Fill(&GUI.lcd, GUI.lcd.drawing_layer, (void *)GUI.lcd.drawing_layer->start_address, GUI.lcd.width, GUI.lcd.height, 0, GUI_COLOR_LIGHTGRAY);
+        GUI_LL(Fill)(&GUI.lcd, GUI.lcd.drawing_layer, (void *)GUI.lcd.drawing_layer->start_address, GUI.lcd.width, GUI.lcd.height, 0, GUI_COLOR_LIGHTGRAY);
+#if !GUI_CFG_USE_DIRECT_RENDERING
         if (GUI.lcd.layer_count > 1) {
             GUI.lcd.drawing_layer = &GUI.lcd.layers[1];
         }
+#endif /* !GUI_CFG_USE_DIRECT_RENDERING */
+#if GUI_CFG_USE_TRIPLE_BUFFERING
+        GUI.lcd.display_layer = &GUI.lcd.layers[0];
+#endif /* GUI_CFG_USE_TRIPLE_BUFFERING */
+#endif /* !GUI_CFG_USE_BAND_RENDERING */
     } else {
         return guiERROR;
     }
+    return guiOK;
+}
+
+/**
+ * \brief           Initializes GUI stack.
+ *                    In addition, it prepares memory for work with widgets on later usage and
+ *                    calls low-layer functions to initialize LCD or custom driver for LCD
+ * \return          Member of \ref guir_t enumeration
+ */
+guir_t
+gui_init(void) {
+    memset((void *)&GUI, 0x00, sizeof(GUI));        /* Reset GUI structure */
+    
+    gui_seteventcallback(NULL);                     /* Set event callback */
+    
+#if GUI_CFG_OS
+    /* Init system */
+    gui_sys_init();                                 /* Init low-level system */
+#if !GUI_SYS_USE_NOTIFY
+    gui_sys_mbox_create(&GUI.OS.mbox, 32);          /* Message box for wakeup messages */
+#endif /* !GUI_SYS_USE_NOTIFY */
+#endif /* GUI_CFG_OS */
+    
+#if GUI_CFG_DISPLAY_COUNT > 1
+    GUI.ll_control = gui_ll_control;                /* First display uses default driver */
+    memset(display_ctx, 0x00, sizeof(display_ctx));
+    display_current = 0;
+    display_selected = 0;
+#endif /* GUI_CFG_DISPLAY_COUNT > 1 */
+    if (lcd_init() != guiOK) {
+        return guiERROR;
+    }
+#if GUI_CFG_USE_SPLASH && !GUI_CFG_USE_BAND_RENDERING
+    if (splash_image != NULL) {                     /* Show splash on displayed layer, first frame is drawn to other layer */
+        gui_layer_t* layer = GUI.lcd.drawing_layer;
+        gui_display_t disp = { 0, 0, 0, 0 };
+
+        disp.x2 = GUI.lcd.width;
+        disp.y2 = GUI.lcd.height;
+        GUI.lcd.drawing_layer = &GUI.lcd.layers[0];
+        gui_draw_image(&disp, (GUI.lcd.width - splash_image->x_size) / 2, (GUI.lcd.height - splash_image->y_size) / 2, splash_image);
+        GUI.lcd.drawing_layer = layer;
+    }
+#endif /* GUI_CFG_USE_SPLASH && !GUI_CFG_USE_BAND_RENDERING */
+    
+#if GUI_CFG_USE_SPLASH
+    GUI.splash_hold = splash_image != NULL;         /* Hold redraw until application ends splash */
+#endif /* GUI_CFG_USE_SPLASH */
     
     guii_input_init();                              /* Init input devices */
     GUI.initialized = 1;                            /* GUI is initialized */
     guii_widget_init();                             /* Init widgets */
+#if GUI_CFG_USE_DEFER
+    guii_defer_init();                              /* Init deferred work queue and its worker */
+#endif /* GUI_CFG_USE_DEFER */
     
 #if GUI_CFG_OS
     /* Create graphical thread */
@@ -876,27 +3548,110 @@ gui_init(void) {
 int32_t
 gui_process(void) {
 #if GUI_CFG_OS
+#if GUI_SYS_USE_NOTIFY
+    uint32_t reasons;
+#else /* GUI_SYS_USE_NOTIFY */
     gui_mbox_msg_t* msg;
-    uint32_t time;
-    uint32_t tmr_cnt = guii_timer_getactivecount(); /* Get number of active timers in system */
+#endif /* !GUI_SYS_USE_NOTIFY */
+    uint32_t timeout, time;
+    uint8_t has_timeout;
+#endif /* GUI_CFG_OS */
+#if GUI_CFG_DISPLAY_COUNT > 1
+    uint8_t i;
+#endif /* GUI_CFG_DISPLAY_COUNT > 1 */
+#if GUI_CFG_OS
     
-    time = gui_sys_mbox_get(&GUI.OS.mbox, (void **)&msg, tmr_cnt ? 1 : 20); /* Get value from message queue */
+    /*
+     * Block on message queue until next timer deadline.
+     * Without active timers and pending redraw, wait for new message forever.
+     */
+    GUI_CORE_PROTECT(1);
+    has_timeout = 0;
+    timeout = 0;
+#if GUI_CFG_DISPLAY_COUNT > 1
+    for (i = 0; i < GUI_CFG_DISPLAY_COUNT; i++) {
+        if (DISPLAY_EXISTS(i)) {                    /* Thread wakes up for earliest work of all displays */
+            display_switch(i);
+            display_applyconfirm();
+            process_gettimeout(&has_timeout, &timeout);
+        }
+    }
+    display_switch(display_selected);
+#else /* GUI_CFG_DISPLAY_COUNT > 1 */
+    process_gettimeout(&has_timeout, &timeout);
+#endif /* !GUI_CFG_DISPLAY_COUNT > 1 */
+#if GUI_CFG_INPUT_BUDGET
+    if (guii_input_available()) {                   /* Entries left by input budget, do not block */
+        has_timeout = 1;
+        timeout = 0;
+    }
+#endif /* GUI_CFG_INPUT_BUDGET */
+    GUI.OS.processing = 0;                          /* Events from now on must wakeup thread */
+#if GUI_CFG_USE_DEFER
+    if (guii_defer_pending()) {                     /* Work posted after last processing, do not block */
+        has_timeout = 1;
+        timeout = 0;
+    }
+#endif /* GUI_CFG_USE_DEFER */
+    GUI_CORE_UNPROTECT(1);
     
-    GUI_UNUSED(time);
+    time = gui_sys_now();
+#if GUI_SYS_USE_NOTIFY
+    if (!has_timeout) {
+        gui_sys_notify_wait(&reasons, 0);           /* Wait for new notification */
+    } else if (timeout) {
+        gui_sys_notify_wait(&reasons, timeout);   /* Wait for notification or first timer expiry */
+    } else {
+        gui_sys_notify_getnow(&reasons);            /* Timer already expired, do not block */
+    }
+    GUI_UNUSED(reasons);                            /* Thread checks all sources after wakeup */
+#else /* GUI_SYS_USE_NOTIFY */
+    if (!has_timeout) {
+        gui_sys_mbox_get(&GUI.OS.mbox, (void **)&msg, 0);   /* Wait for new message */
+    } else if (timeout) {
+        gui_sys_mbox_get(&GUI.OS.mbox, (void **)&msg, timeout); /* Wait for message or first timer expiry */
+    } else {
+        gui_sys_mbox_getnow(&GUI.OS.mbox, (void **)&msg);   /* Timer already expired, do not block */
+    }
     GUI_UNUSED(msg);
+#endif /* !GUI_SYS_USE_NOTIFY */
+    time = gui_sys_now() - time;
+
 #endif /* GUI_CFG_OS */
    
     GUI_CORE_PROTECT(1);
-    guii_timer_process();                           /* Process all timers */
-    guii_widget_executeremove();                    /* Delete widgets */
-#if GUI_CFG_USE_TOUCH
-    gui_process_touch();                            /* Process touch inputs */
-#endif /* GUI_CFG_USE_TOUCH */
-#if GUI_CFG_USE_KEYBOARD
-    process_keyboard();                             /* Process keyboard inputs */
-#endif /* GUI_CFG_USE_KEYBOARD */
-    process_redraw();                               /* Redraw widgets */
+#if GUI_CFG_OS
+    GUI.OS.processing = 1;
+    GUI.OS.idle_stat.wakeups++;
+    GUI_TRACE(GUI_TRACE_EVT_MBOX_WAKEUP, time);
+    GUI.OS.idle_stat.idle_time += time;
+    time = gui_sys_now();
+#endif /* GUI_CFG_OS */
+#if GUI_CFG_USE_WIDGET_CMD_QUEUE
+#if GUI_CFG_DISPLAY_COUNT > 1
+    display_switch(0);                              /* Commands are queued for widgets of first display */
+#endif /* GUI_CFG_DISPLAY_COUNT > 1 */
+    guii_widget_executecommands();                  /* Apply widget updates posted from other threads */
+#endif /* GUI_CFG_USE_WIDGET_CMD_QUEUE */
+#if GUI_CFG_DISPLAY_COUNT > 1
+    for (i = 0; i < GUI_CFG_DISPLAY_COUNT; i++) {
+        if (DISPLAY_EXISTS(i)) {                    /* Displays are processed one after another */
+            display_switch(i);
+            display_applyconfirm();
+            process_display(i == 0);
+        }
+    }
+    display_switch(display_selected);               /* Application calls continue on selected display */
+#else /* GUI_CFG_DISPLAY_COUNT > 1 */
+    process_display(1);
+#endif /* !GUI_CFG_DISPLAY_COUNT > 1 */
+#if GUI_CFG_OS
+    GUI.OS.idle_stat.busy_time += gui_sys_now() - time;
+#endif /* GUI_CFG_OS */
     GUI_CORE_UNPROTECT(1);
+#if GUI_CFG_USE_DEFER
+    guii_defer_process();                           /* Process deferred work without core protection */
+#endif /* GUI_CFG_USE_DEFER */
     
     return 0;                                       /* Return number of elements updated on GUI */
 }
@@ -916,6 +3671,397 @@ gui_seteventcallback(gui_eventcallback_t cb) {
     return 1;
 }
 
+/**
+ * \brief           Set callback called by GUI thread after each drawn frame
+ * \note            Callback is called with GUI core protected, it may be used to export profiler data
+ * \param[in]       fn: Callback function. Set to `NULL` to disable it
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_profiler_setcallback(gui_profiler_fn fn) {
+#if GUI_CFG_USE_PROFILER
+    GUI_CORE_PROTECT(1);
+    GUI.profiler.fn = fn;
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+#else /* GUI_CFG_USE_PROFILER */
+    GUI_UNUSED(fn);
+    return 0;
+#endif /* !GUI_CFG_USE_PROFILER */
+}
+
+/**
+ * \brief           Get records of recent frames
+ * \param[out]      frames: Array to save records to, from oldest to newest
+ * \param[in]       len: Number of entries in array
+ * \return          Number of records saved to array
+ */
+size_t
+gui_profiler_getframes(gui_profiler_frame_t* frames, size_t len) {
+    size_t cnt = 0;
+#if GUI_CFG_USE_PROFILER
+    size_t i, first;
+    
+    GUI_ASSERTPARAMS(frames != NULL);
+    GUI_CORE_PROTECT(1);
+    cnt = GUI_MIN(GUI.profiler.frames_count, GUI_CFG_PROFILER_FRAMES);
+    cnt = GUI_MIN(cnt, len);
+    first = GUI.profiler.frames_count - cnt;
+    for (i = 0; i < cnt; i++) {
+        frames[i] = GUI.profiler.frames[(first + i) % GUI_CFG_PROFILER_FRAMES];
+    }
+    GUI_CORE_UNPROTECT(1);
+#else /* GUI_CFG_USE_PROFILER */
+    GUI_UNUSED(frames);
+    GUI_UNUSED(len);
+#endif /* !GUI_CFG_USE_PROFILER */
+    return cnt;
+}
+
+/**
+ * \brief           Get draw cost of widgets since last reset
+ * \param[out]      entries: Array to save entries to
+ * \param[in]       len: Number of entries in array
+ * \param[in]       by_id: Set to `1` to get entries per widget ID or `0` per widget type
+ * \return          Number of entries saved to array
+ */
+size_t
+gui_profiler_getwidgets(gui_profiler_entry_t* entries, size_t len, uint8_t by_id) {
+    size_t cnt = 0;
+#if GUI_CFG_USE_PROFILER
+    const gui_profiler_entry_t* src;
+    size_t max;
+    
+    GUI_ASSERTPARAMS(entries != NULL);
+    GUI_CORE_PROTECT(1);
+    src = by_id ? GUI.profiler.ids : GUI.profiler.types;
+    max = by_id ? GUI_CFG_PROFILER_IDS : GUI_CFG_PROFILER_TYPES;
+    for (; cnt < len && cnt < max && src[cnt].widget != NULL; cnt++) {
+        entries[cnt] = src[cnt];
+    }
+    GUI_CORE_UNPROTECT(1);
+#else /* GUI_CFG_USE_PROFILER */
+    GUI_UNUSED(entries);
+    GUI_UNUSED(len);
+    GUI_UNUSED(by_id);
+#endif /* !GUI_CFG_USE_PROFILER */
+    return cnt;
+}
+
+/**
+ * \brief           Clear all profiler frames and widget entries
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_profiler_reset(void) {
+#if GUI_CFG_USE_PROFILER
+    gui_profiler_fn fn;
+    
+    GUI_CORE_PROTECT(1);
+    fn = GUI.profiler.fn;
+    memset(&GUI.profiler, 0x00, sizeof(GUI.profiler));
+    GUI.profiler.fn = fn;
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+#else /* GUI_CFG_USE_PROFILER */
+    return 0;
+#endif /* !GUI_CFG_USE_PROFILER */
+}
+
+/**
+ * \brief           Get touch-to-photon latency statistics
+ * \param[out]      stat: Pointer to structure to fill
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_latency_get(gui_latency_stat_t* stat) {
+#if GUI_CFG_USE_LATENCY
+    size_t i, k, n, below, need;
+
+    GUI_ASSERTPARAMS(stat != NULL);
+    GUI_CORE_PROTECT(1);
+    *stat = GUI.latency.stat;
+    if (stat->count > 0) {
+        stat->avg /= stat->count;
+        stat->queue_avg /= stat->count;
+        stat->process_avg /= stat->count;
+        stat->render_avg /= stat->count;
+        stat->confirm_avg /= stat->count;
+
+        /* Smallest recent sample with at least 99% of samples not above it */
+        n = GUI_MIN(stat->count, GUI_CFG_LATENCY_SAMPLES);
+        need = (n * 99 + 99) / 100;
+        stat->p99 = stat->max;
+        for (i = 0; i < n; i++) {
+            for (below = 0, k = 0; k < n; k++) {
+                if (GUI.latency.samples[k] <= GUI.latency.samples[i]) {
+                    below++;
+                }
+            }
+            if (below >= need && GUI.latency.samples[i] < stat->p99) {
+                stat->p99 = GUI.latency.samples[i];
+            }
+        }
+    }
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+#else /* GUI_CFG_USE_LATENCY */
+    GUI_UNUSED(stat);
+    return 0;
+#endif /* !GUI_CFG_USE_LATENCY */
+}
+
+/**
+ * \brief           Clear touch-to-photon latency statistics
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_latency_reset(void) {
+#if GUI_CFG_USE_LATENCY
+    GUI_CORE_PROTECT(1);
+    memset(&GUI.latency, 0x00, sizeof(GUI.latency));
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+#else /* GUI_CFG_USE_LATENCY */
+    return 0;
+#endif /* !GUI_CFG_USE_LATENCY */
+}
+
+/**
+ * \brief           Set redraw debug overlay modes
+ * \note            Heatmap buffer of `1` byte per pixel is allocated when \ref GUI_REDRAW_DEBUG_HEATMAP is enabled
+ *                  and released when disabled. Counts are kept when only regions mode is changed
+ * \param[in]       mode: Modes to enable, bitwise OR of \ref GUI_REDRAW_DEBUG values. Set to `0` to disable overlay
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_redrawdebug_setmode(uint8_t mode) {
+#if GUI_CFG_USE_REDRAW_DEBUG
+    gui_handle_p h;
+    uint8_t ret = 1;
+    
+    GUI_CORE_PROTECT(1);
+    if ((mode & GUI_REDRAW_DEBUG_HEATMAP) && GUI.heatmap == NULL) {
+#if GUI_CFG_USE_MEM_ARENA
+        gui_mem_arena_t* arena = gui_mem_arena_setactive(NULL);/* Heatmap outlives screen arenas */
+        GUI.heatmap = GUI_MEMALLOC((size_t)GUI.lcd.width * (size_t)GUI.lcd.height);
+        gui_mem_arena_setactive(arena);
+#else /* GUI_CFG_USE_MEM_ARENA */
+        GUI.heatmap = GUI_MEMALLOC((size_t)GUI.lcd.width * (size_t)GUI.lcd.height);
+#endif /* !GUI_CFG_USE_MEM_ARENA */
+        if (GUI.heatmap == NULL) {
+            mode &= ~GUI_REDRAW_DEBUG_HEATMAP;
+            ret = 0;
+        }
+    } else if (!(mode & GUI_REDRAW_DEBUG_HEATMAP) && GUI.heatmap != NULL) {
+        GUI_MEMFREE(GUI.heatmap);
+    }
+    GUI.redraw_debug = mode;
+    if ((h = (gui_handle_p)gui_linkedlist_getnext_gen(&GUI.root, NULL)) != NULL) {
+        gui_widget_invalidate(h);                   /* Redraw desktop to show or remove overlay on entire screen */
+    }
+    GUI_CORE_UNPROTECT(1);
+    return ret;
+#else /* GUI_CFG_USE_REDRAW_DEBUG */
+    GUI_UNUSED(mode);
+    return 0;
+#endif /* !GUI_CFG_USE_REDRAW_DEBUG */
+}
+
+/**
+ * \brief           Get heatmap of widget draws
+ * \note            Buffer has `1` byte per pixel, row after row of LCD width.
+ *                  Values are number of widget draws of each pixel since last reset, saturated at `255`
+ * \return          Pointer to heatmap buffer or `NULL` when heatmap is not enabled
+ */
+const uint8_t*
+gui_redrawdebug_getheatmap(void) {
+#if GUI_CFG_USE_REDRAW_DEBUG
+    return GUI.heatmap;
+#else /* GUI_CFG_USE_REDRAW_DEBUG */
+    return NULL;
+#endif /* !GUI_CFG_USE_REDRAW_DEBUG */
+}
+
+/**
+ * \brief           Clear heatmap counts
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_redrawdebug_reset(void) {
+#if GUI_CFG_USE_REDRAW_DEBUG
+    GUI_CORE_PROTECT(1);
+    if (GUI.heatmap != NULL) {
+        memset(GUI.heatmap, 0x00, (size_t)GUI.lcd.width * (size_t)GUI.lcd.height);
+    }
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+#else /* GUI_CFG_USE_REDRAW_DEBUG */
+    return 0;
+#endif /* !GUI_CFG_USE_REDRAW_DEBUG */
+}
+
+/**
+ * \brief           Set image shown on display during boot
+ * \note            Function must be called before \ref gui_init.
+ *                  Image is drawn centered on display immediately after low-level initialization
+ *                  and stays there until \ref gui_splash_end is called, while widgets are created
+ * \param[in]       img: Image descriptor, must stay valid until \ref gui_init returns.
+ *                      Memory mapped image is copied directly from flash, image with `read` function is decoded
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_splash_set(const gui_image_desc_t* img) {
+#if GUI_CFG_USE_SPLASH
+    if (GUI.initialized) {                          /* Too late, first screen is already shown */
+        return 0;
+    }
+    splash_image = img;
+    return 1;
+#else /* GUI_CFG_USE_SPLASH */
+    GUI_UNUSED(img);
+    return 0;
+#endif /* !GUI_CFG_USE_SPLASH */
+}
+
+/**
+ * \brief           Release redraw held by splash image
+ * \note            Call it when first screen is created.
+ *                  Complete frame is then drawn to drawing layer and replaces splash image on display at once
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_splash_end(void) {
+#if GUI_CFG_USE_SPLASH
+    GUI_CORE_PROTECT(1);
+    GUI.splash_hold = 0;
+    splash_image = NULL;
+#if GUI_CFG_OS
+    if (GUI.flags & GUI_FLAG_REDRAW) {
+        guii_wakeup(GUI_SYS_WAKEUP_INVALIDATE);     /* Wakeup GUI thread to draw first frame */
+    }
+#endif /* GUI_CFG_OS */
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+#else /* GUI_CFG_USE_SPLASH */
+    return 0;
+#endif /* !GUI_CFG_USE_SPLASH */
+}
+
+/**
+ * \brief           Add display driven by same GUI instance
+ *
+ *                  Display gets its own layers, widget tree, timers and redraw state with desktop window created.
+ *                  Font cache, widget pools and translations are shared with other displays
+ * \note            Display `0` is initialized in \ref gui_init with default low-level driver.
+ *                  Touch, keyboard and widget commands from other threads are processed on display `0` only
+ * \param[in]       num: Display number, from `1` to \ref GUI_CFG_DISPLAY_COUNT - `1`
+ * \param[in]       ctrl: Low-level control function of display, same prototype as \ref gui_ll_control
+ * \return          `1` on success, `0` otherwise
+ * \sa              gui_display_select
+ */
+uint8_t
+gui_display_add(uint8_t num, gui_ll_control_fn ctrl) {
+#if GUI_CFG_DISPLAY_COUNT > 1
+    gui_t* ctx;
+    uint8_t prev, ret = 0;
+    
+    GUI_ASSERTPARAMS(num > 0 && num < GUI_CFG_DISPLAY_COUNT && ctrl != NULL);
+    GUI_CORE_PROTECT(1);
+    if (!DISPLAY_EXISTS(num) && (ctx = GUI_MEMALLOC(sizeof(*ctx))) != NULL) {
+        prev = display_current;
+        display_ctx[num] = ctx;                     /* Empty state, shared members are taken from current display */
+        display_switch(num);
+        GUI.ll_control = ctrl;
+        if (lcd_init() == guiOK) {
+            gui_window_createdesktop(GUI_ID_WINDOW_BASE, NULL);
+            ret = 1;
+        }
+        display_switch(prev);
+        if (!ret) {
+            GUI_MEMFREE(display_ctx[num]);          /* State of display is saved there again */
+        }
+    }
+#if GUI_CFG_OS
+    if (ret) {
+        guii_wakeup(GUI_SYS_WAKEUP_INVALIDATE);     /* Wakeup GUI thread to draw new display */
+    }
+#endif /* GUI_CFG_OS */
+    GUI_CORE_UNPROTECT(1);
+    return ret;
+#else /* GUI_CFG_DISPLAY_COUNT > 1 */
+    GUI_UNUSED2(num, ctrl);
+    return 0;
+#endif /* !GUI_CFG_DISPLAY_COUNT > 1 */
+}
+
+/**
+ * \brief           Select display used by all following application calls
+ *
+ *                  Widgets, timers and layers of selected display are created and modified.
+ *                  Widget handle must only be used while its display is selected
+ * \param[in]       num: Display number, added with \ref gui_display_add or `0`
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_display_select(uint8_t num) {
+#if GUI_CFG_DISPLAY_COUNT > 1
+    uint8_t ret = 0;
+    
+    GUI_ASSERTPARAMS(num < GUI_CFG_DISPLAY_COUNT);
+    GUI_CORE_PROTECT(1);
+    if (DISPLAY_EXISTS(num)) {
+        display_selected = num;
+        display_switch(num);
+        ret = 1;
+    }
+    GUI_CORE_UNPROTECT(1);
+    return ret;
+#else /* GUI_CFG_DISPLAY_COUNT > 1 */
+    return num == 0;
+#endif /* !GUI_CFG_DISPLAY_COUNT > 1 */
+}
+
+/**
+ * \brief           Get display used by application calls
+ * \return          Selected display number
+ */
+uint8_t
+gui_display_getselected(void) {
+#if GUI_CFG_DISPLAY_COUNT > 1
+    return display_selected;
+#else /* GUI_CFG_DISPLAY_COUNT > 1 */
+    return 0;
+#endif /* !GUI_CFG_DISPLAY_COUNT > 1 */
+}
+
+/**
+ * \brief           Confirm layer is shown on display
+ *
+ *                  Confirmation is applied to display by GUI thread before next processing.
+ *                  Drivers of all displays must confirm layers this way when \ref GUI_CFG_DISPLAY_COUNT is greater than `1`,
+ *                  as \ref gui_lcd_confirmactivelayer changes display with its state currently loaded
+ * \note            With more displays, function may be called from interrupt
+ * \param[in]       num: Display number
+ * \param[in]       layer_num: Number of layer now shown on display
+ */
+void
+gui_display_confirmactivelayer(uint8_t num, uint8_t layer_num) {
+#if GUI_CFG_DISPLAY_COUNT > 1
+    if (num < GUI_CFG_DISPLAY_COUNT) {
+        display_confirm_layer[num] = layer_num;     /* Layer is written before sequence is changed */
+        display_confirm_seq[num]++;
+#if GUI_CFG_OS
+        guii_wakeup_isr(GUI_SYS_WAKEUP_LAYER);
+#endif /* GUI_CFG_OS */
+    }
+#else /* GUI_CFG_DISPLAY_COUNT > 1 */
+    if (num == 0) {
+        gui_lcd_confirmactivelayer(layer_num);
+    }
+#endif /* !GUI_CFG_DISPLAY_COUNT > 1 */
+}
+
 #if GUI_CFG_OS || __DOXYGEN__
 
 /**
@@ -940,7 +4086,7 @@ uint8_t
 gui_unprotect(const uint8_t unprotect) {
     if (unprotect) {
         GUI_CORE_UNPROTECT(1);
-        gui_sys_mbox_putnow(&GUI.OS.mbox, 0x00);    /* Wakeup processing thread */
+        guii_wakeup(GUI_SYS_WAKEUP_WIDGET);         /* Wakeup processing thread */
     }
     return 1;
 }
@@ -966,4 +4112,29 @@ gui_delay(const uint32_t ms) {
     return 0;
 }
 
+/**
+ * \brief           Get GUI thread idle statistics
+ *
+ *                  When there are no active timers, no input and no pending redraw,
+ *                  GUI thread sleeps until new event. Use statistics to verify
+ *                  thread does not wake up when there is nothing to process
+ *
+ * \note            Available only when \ref GUI_CFG_OS is enabled
+ * \param[out]      stat: Pointer to output structure to fill statistics to
+ * \param[in]       reset: Set to `1` to reset statistics after read
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_getidlestats(gui_idle_stat_t* stat, uint8_t reset) {
+    GUI_ASSERTPARAMS(stat != NULL);
+    
+    GUI_CORE_PROTECT(1);
+    *stat = GUI.OS.idle_stat;
+    if (reset) {
+        memset(&GUI.OS.idle_stat, 0x00, sizeof(GUI.OS.idle_stat));
+    }
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+}
+
 #endif /* GUI_CFG_OS || __DOXYGEN__ */
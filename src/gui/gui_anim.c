@@ -0,0 +1,644 @@
+/**    
+ * \file            gui_anim.c
+ * \brief           Widget property animation engine
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_anim.h"
+#include "widget/gui_widget.h"
+#include "widget/gui_window.h"
+
+#if GUI_CFG_USE_ANIM || __DOXYGEN__
+
+#define ANIM_ONE                    ((int32_t)1024) /* Progress of finished animation */
+
+static uint8_t anim_processing;                     /* Set to `1` while animations are applied from timer */
+
+/**
+ * \brief           Get eased progress
+ * \param[in]       ease: Easing function
+ * \param[in]       p: Linear progress between `0` and \ref ANIM_ONE
+ * \return          Eased progress between `0` and \ref ANIM_ONE
+ */
+static int32_t
+anim_progress(gui_anim_ease_t ease, int32_t p) {
+    int32_t q = ANIM_ONE - p;
+    
+    switch (ease) {
+        case GUI_ANIM_EASE_IN_QUAD:
+            return (p * p) >> 10;
+        case GUI_ANIM_EASE_OUT_QUAD:
+            return ANIM_ONE - ((q * q) >> 10);
+        case GUI_ANIM_EASE_IN_OUT_QUAD:
+            return p < (ANIM_ONE / 2) ? ((2 * p * p) >> 10) : (ANIM_ONE - ((2 * q * q) >> 10));
+        case GUI_ANIM_EASE_IN_CUBIC:
+            return (p * p * p) >> 20;
+        case GUI_ANIM_EASE_OUT_CUBIC:
+            return ANIM_ONE - ((q * q * q) >> 20);
+        case GUI_ANIM_EASE_IN_OUT_CUBIC:
+            return p < (ANIM_ONE / 2) ? ((4 * p * p * p) >> 20) : (ANIM_ONE - ((4 * q * q * q) >> 20));
+        default:
+            return p;
+    }
+}
+
+/**
+ * \brief           Apply new value to animated property
+ * \param[in]       a: Animation
+ * \param[in]       value: New property value
+ */
+static void
+anim_apply(gui_anim_t* a, int32_t value) {
+    if (a->h == NULL || a->value == value) {        /* Removed animation or nothing to change */
+        return;
+    }
+    a->value = value;
+    switch ((gui_anim_prop_t)a->prop) {
+        case GUI_ANIM_PROP_X:
+            gui_widget_setxposition(a->h, (gui_dim_t)value);
+            break;
+        case GUI_ANIM_PROP_Y:
+            gui_widget_setyposition(a->h, (gui_dim_t)value);
+            break;
+        case GUI_ANIM_PROP_WIDTH:
+            gui_widget_setwidth(a->h, (gui_dim_t)value);
+            break;
+        case GUI_ANIM_PROP_HEIGHT:
+            gui_widget_setheight(a->h, (gui_dim_t)value);
+            break;
+        case GUI_ANIM_PROP_ALPHA:
+            gui_widget_setalpha(a->h, (uint8_t)(value < 0 ? 0 : (value > 0xFF ? 0xFF : value)));
+            break;
+        case GUI_ANIM_PROP_XSCROLL:
+            gui_widget_setscrollx(a->h, (gui_dim_t)value);
+            break;
+        case GUI_ANIM_PROP_YSCROLL:
+            gui_widget_setscrolly(a->h, (gui_dim_t)value);
+            break;
+        case GUI_ANIM_PROP_VALUE:
+            a->fn(a->h, value);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * \brief           Find running animation of widget property
+ * \param[in]       h: Widget handle
+ * \param[in]       prop: Animated property
+ * \return          Animation on success, `NULL` otherwise
+ */
+static gui_anim_t *
+anim_find(gui_handle_p h, gui_anim_prop_t prop) {
+    gui_anim_t* a;
+    
+    for (a = GUI.anims; a != NULL; a = a->next) {
+        if (a->h == h && a->prop == (uint8_t)prop) {
+            break;
+        }
+    }
+    return a;
+}
+
+/**
+ * \brief           Remove animation from list or mark it for removal when animations are being applied
+ * \param[in]       a: Animation to remove
+ */
+static void
+anim_free(gui_anim_t* a) {
+    gui_anim_t** p;
+    
+    if (anim_processing) {
+        a->h = NULL;                                /* Timer callback removes it after current pass */
+        return;
+    }
+    for (p = &GUI.anims; *p != NULL; p = &(*p)->next) {
+        if (*p == a) {
+            *p = a->next;
+            GUI_MEMFREE(a);
+            break;
+        }
+    }
+}
+
+/**
+ * \brief           Animation frame timer callback
+ *
+ *                  All animations are applied in single invalidation batch.
+ *                  When previous frame was not drawn yet, intermediate values are not applied
+ *                  as they would never be shown, only finished animations are completed.
+ * \param[in]       t: Timer handle
+ */
+static void
+anim_timer_callback(gui_timer_t* t) {
+    gui_anim_t** p;
+    gui_anim_t* a;
+    uint32_t time, elapsed;
+    uint8_t skip;
+    
+    skip = (GUI.flags & GUI_FLAG_REDRAW) == GUI_FLAG_REDRAW;    /* Rendering is behind animation */
+    time = gui_sys_now();
+    
+    anim_processing = 1;
+    gui_widget_invalidate_begin();
+    for (a = GUI.anims; a != NULL; a = a->next) {
+        elapsed = time - a->start;
+        if (elapsed >= a->duration) {
+            anim_apply(a, a->to);                   /* Finish animation */
+            a->h = NULL;
+        } else if (!skip) {
+            anim_apply(a, gui_anim_ease((gui_anim_ease_t)a->ease, a->from, a->to, elapsed, a->duration));
+        }
+    }
+    gui_widget_invalidate_end();
+    anim_processing = 0;
+    
+    for (p = &GUI.anims; *p != NULL;) {             /* Remove finished animations */
+        a = *p;
+        if (a->h == NULL) {
+            *p = a->next;
+            GUI_MEMFREE(a);
+        } else {
+            p = &a->next;
+        }
+    }
+    if (GUI.anims == NULL) {
+        guii_timer_stop(t);                         /* Nothing to animate, timer may sleep */
+    }
+}
+
+/**
+ * \brief           Start property animation
+ * \param[in]       h: Widget handle
+ * \param[in]       prop: Animated property
+ * \param[in]       fn: Setter for \ref GUI_ANIM_PROP_VALUE property
+ * \param[in]       from: Start value
+ * \param[in]       to: End value
+ * \param[in]       duration: Duration in units of milliseconds
+ * \param[in]       ease: Easing function
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+anim_start(gui_handle_p h, gui_anim_prop_t prop, gui_widget_cmd_int_fn fn, int32_t from, int32_t to, uint32_t duration, gui_anim_ease_t ease) {
+    gui_anim_t* a;
+    
+    if (GUI.anim_timer == NULL) {
+        GUI.anim_timer = guii_timer_create(GUI_CFG_ANIM_PERIOD, anim_timer_callback, NULL);
+        if (GUI.anim_timer == NULL) {
+            return 0;
+        }
+    }
+    
+    a = anim_find(h, prop);                         /* Running animation of property is retargeted */
+    if (a == NULL) {
+        a = GUI_MEMALLOC_CLASS(sizeof(*a), GUI_MEM_CLASS_FAST);
+        if (a == NULL) {
+            return 0;
+        }
+        if (GUI.anims == NULL) {
+            guii_timer_startperiodic(GUI.anim_timer);   /* First animation starts frame timer */
+        }
+        a->next = GUI.anims;
+        GUI.anims = a;
+        a->h = h;
+        a->prop = (uint8_t)prop;
+        a->value = ~from;                           /* Force first value to be applied */
+    }
+    a->fn = fn;
+    a->from = from;
+    a->to = to;
+    a->start = gui_sys_now();
+    a->duration = duration;
+    a->ease = (uint8_t)ease;
+    anim_apply(a, from);
+    return 1;
+}
+
+/**
+ * \brief           Start animation of widget property
+ *
+ *                  Property is set to `from` value immediately and reaches `to` value after `duration`.
+ *                  If property is already animated, running animation is replaced.
+ *
+ * \note            Position and size animations set values in units of pixels
+ * \param[in]       h: Widget handle
+ * \param[in]       prop: Animated property, \ref GUI_ANIM_PROP_VALUE is started with \ref gui_anim_startvalue
+ * \param[in]       from: Start value
+ * \param[in]       to: End value
+ * \param[in]       duration: Duration in units of milliseconds
+ * \param[in]       ease: Easing function
+ * \return          `1` on success, `0` otherwise
+ * \sa              gui_anim_stop
+ */
+uint8_t
+gui_anim_start(gui_handle_p h, gui_anim_prop_t prop, int32_t from, int32_t to, uint32_t duration, gui_anim_ease_t ease) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h) && prop < GUI_ANIM_PROP_VALUE);
+    return anim_start(h, prop, NULL, from, to, duration, ease);
+}
+
+/**
+ * \brief           Start animation of widget value
+ *
+ *                  Value is applied on each frame with setter function, such as \ref gui_progbar_setvalue.
+ *                  Widget may have only one value animation at a time.
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       fn: Value setter function
+ * \param[in]       from: Start value
+ * \param[in]       to: End value
+ * \param[in]       duration: Duration in units of milliseconds
+ * \param[in]       ease: Easing function
+ * \return          `1` on success, `0` otherwise
+ * \sa              gui_anim_stop
+ */
+uint8_t
+gui_anim_startvalue(gui_handle_p h, gui_widget_cmd_int_fn fn, int32_t from, int32_t to, uint32_t duration, gui_anim_ease_t ease) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h) && fn != NULL);
+    return anim_start(h, GUI_ANIM_PROP_VALUE, fn, from, to, duration, ease);
+}
+
+/**
+ * \brief           Stop animation of widget property
+ * \param[in]       h: Widget handle
+ * \param[in]       prop: Animated property
+ * \param[in]       finish: Set to `1` to set property to end value or `0` to keep current value
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_anim_stop(gui_handle_p h, gui_anim_prop_t prop, uint8_t finish) {
+    gui_anim_t* a;
+    
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));
+    
+    a = anim_find(h, prop);
+    if (a == NULL) {
+        return 0;
+    }
+    if (finish) {
+        anim_apply(a, a->to);
+    }
+    anim_free(a);
+    return 1;
+}
+
+/**
+ * \brief           Check if widget property is animated
+ * \param[in]       h: Widget handle
+ * \param[in]       prop: Animated property
+ * \return          `1` if animation is running, `0` otherwise
+ */
+uint8_t
+gui_anim_isrunning(gui_handle_p h, gui_anim_prop_t prop) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));
+    return anim_find(h, prop) != NULL;
+}
+
+/**
+ * \brief           Get eased value between two values
+ * \param[in]       ease: Easing function
+ * \param[in]       from: Start value
+ * \param[in]       to: End value
+ * \param[in]       elapsed: Time elapsed since start
+ * \param[in]       duration: Total duration, in the same units as `elapsed`
+ * \return          Value at `elapsed` time
+ */
+int32_t
+gui_anim_ease(gui_anim_ease_t ease, int32_t from, int32_t to, uint32_t elapsed, uint32_t duration) {
+    int32_t p;
+    
+    if (elapsed >= duration) {
+        return to;
+    }
+    p = (int32_t)(((uint64_t)elapsed * ANIM_ONE) / duration);
+    return from + (int32_t)((((int64_t)to - from) * anim_progress(ease, p)) / ANIM_ONE);
+}
+
+/**
+ * \brief           Remove all animations of widget
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       h: Widget handle
+ */
+void
+guii_anim_remove(gui_handle_p h) {
+    gui_anim_t* a, *next;
+    
+    for (a = GUI.anims; a != NULL; a = next) {
+        next = a->next;
+        if (a->h == h) {
+            anim_free(a);
+        }
+    }
+}
+
+#if GUI_CFG_USE_TRANSITION || __DOXYGEN__
+
+/**
+ * \brief           Check if transition moves screens vertically
+ * \param[in]       type: Transition type
+ * \return          `1` for vertical movement, `0` for horizontal
+ */
+#define TRANSITION_VERTICAL(type)   (((type) & 0x02) != 0)
+
+/**
+ * \brief           Check if transition moves screens to left or up, to negative coordinates
+ * \param[in]       type: Transition type
+ * \return          `1` for movement to negative coordinates, `0` otherwise
+ */
+#define TRANSITION_NEGATIVE(type)   (((type) & 0x01) == 0)
+
+/**
+ * \brief           Check if outgoing screen moves together with incoming one
+ * \param[in]       type: Transition type
+ * \return          `1` for push transition, `0` for slide transition
+ */
+#define TRANSITION_PUSH(type)       ((type) >= GUI_TRANSITION_PUSH_LEFT)
+
+/**
+ * \brief           Get distance incoming screen moves during transition
+ * \return          Screen width or height in units of pixels
+ */
+static gui_dim_t
+transition_distance(void) {
+    return TRANSITION_VERTICAL(GUI.transition.type) ? GUI.lcd.height : GUI.lcd.width;
+}
+
+/**
+ * \brief           Set display position of both screen layers according to current offset
+ */
+static void
+transition_setpos(void) {
+    gui_transition_state_t* t = &GUI.transition;
+    gui_dim_t pos[2];
+    size_t i;
+
+    pos[0] = TRANSITION_PUSH(t->type) ? t->offset : 0;  /* Outgoing screen moves only when pushed out */
+    pos[1] = t->offset - transition_distance();     /* Incoming screen enters from opposite edge */
+    for (i = 0; i < GUI_COUNT_OF(t->layers); i++) {
+        if (TRANSITION_NEGATIVE(t->type)) {
+            pos[i] = -pos[i];
+        }
+        t->layers[i]->x_pos = TRANSITION_VERTICAL(t->type) ? 0 : pos[i];
+        t->layers[i]->y_pos = TRANSITION_VERTICAL(t->type) ? pos[i] : 0;
+    }
+}
+
+#if GUI_CFG_USE_OVERLAY || __DOXYGEN__
+
+/**
+ * \brief           Show both screen layers on overlay planes at their current position
+ * \param[in]       show: Set to `1` to show layers or `0` to disable planes
+ */
+static void
+transition_setplanes(uint8_t show) {
+    gui_transition_state_t* t = &GUI.transition;
+    gui_overlay_t ov;
+    uint8_t result;
+    size_t i;
+
+    for (i = 0; i < GUI_COUNT_OF(t->layers); i++) {
+        ov.num = t->plane[i];
+        ov.layer = show ? t->layers[i] : NULL;
+        ov.alpha = 0xFF;
+        GUI_LL_CONTROL(GUI_LL_Command_SetOverlay, &ov, &result);
+        GUI.overlays[t->plane[i]].shown = show;
+    }
+}
+
+/**
+ * \brief           Reserve `2` free overlay planes for screen layers
+ *
+ *                  Layer of incoming screen gets plane with higher number
+ *
+ * \return          `1` on success, `0` when planes are not available
+ */
+static uint8_t
+transition_getplanes(void) {
+    gui_transition_state_t* t = &GUI.transition;
+    gui_overlay_t ov;
+    uint8_t result = 1;
+    size_t i, cnt = 0;
+
+    for (i = 0; i < GUI_COUNT_OF(GUI.overlays) && cnt < GUI_COUNT_OF(t->plane); i++) {
+        if (GUI.overlays[i].h == NULL && GUI.overlays[i].layer == NULL) {
+            t->plane[cnt++] = (uint8_t)i;
+        }
+    }
+    if (cnt < GUI_COUNT_OF(t->plane)) {
+        return 0;
+    }
+    ov.num = t->plane[0];
+    ov.layer = NULL;
+    ov.alpha = 0;
+    if (!GUI_LL_CONTROL(GUI_LL_Command_SetOverlay, &ov, &result) || result) {
+        return 0;                                   /* Low-level does not support overlays */
+    }
+    for (i = 0; i < GUI_COUNT_OF(t->plane); i++) {
+        GUI.overlays[t->plane[i]].layer = t->layers[i]; /* Plane is not free for widgets anymore */
+    }
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_OVERLAY || __DOXYGEN__ */
+
+/**
+ * \brief           Redraw complete screen on main layer
+ */
+static void
+transition_invalidate(void) {
+    gui_handle_p h;
+
+    if ((h = gui_window_getdesktop()) != NULL) {
+        gui_widget_invalidate(h);
+    }
+}
+
+/**
+ * \brief           Stop transition and release screen layers
+ *
+ *                  Main layer shows incoming screen drawn by widgets again
+ */
+static void
+transition_end(void) {
+    gui_transition_state_t* t = &GUI.transition;
+    size_t i;
+
+    guii_timer_stop(t->timer);
+#if GUI_CFG_USE_OVERLAY
+    if (t->planes) {
+        transition_setplanes(0);
+        for (i = 0; i < GUI_COUNT_OF(t->plane); i++) {
+            GUI.overlays[t->plane[i]].layer = NULL;
+        }
+    }
+#endif /* GUI_CFG_USE_OVERLAY */
+    gui_lcd_fence();                                /* Low-level may still read from layers */
+    for (i = 0; i < GUI_COUNT_OF(t->layers); i++) {
+        GUI_MEMFREE(t->layers[i]);
+    }
+    if (!t->planes) {
+        transition_invalidate();                    /* Main layer was not drawn by widgets during transition */
+    }
+    t->planes = 0;
+}
+
+/**
+ * \brief           Transition frame timer callback
+ *
+ *                  Transition on overlay planes ends only after main layer with incoming screen
+ *                  was given to display, otherwise old content would be visible for one frame
+ * \param[in]       timer: Timer handle
+ */
+static void
+transition_timer_callback(gui_timer_t* timer) {
+    gui_transition_state_t* t = &GUI.transition;
+    gui_dim_t offset;
+    uint32_t elapsed;
+
+    GUI_UNUSED(timer);
+    elapsed = gui_sys_now() - t->start;
+    offset = (gui_dim_t)gui_anim_ease((gui_anim_ease_t)t->ease, 0, transition_distance(), elapsed, t->duration);
+    if (offset != t->offset) {
+        t->offset = offset;
+        transition_setpos();
+#if GUI_CFG_USE_OVERLAY
+        if (t->planes) {
+            transition_setplanes(1);                /* Only plane positions change */
+        } else
+#endif /* GUI_CFG_USE_OVERLAY */
+        {
+            transition_invalidate();                /* Layers are copied to main layer */
+        }
+    }
+    if (elapsed >= t->duration && (!t->planes
+        || !((GUI.flags & GUI_FLAG_REDRAW) || (GUI.lcd.flags & GUI_FLAG_LCD_WAIT_LAYER_CONFIRM)))) {
+        transition_end();
+    }
+}
+
+/**
+ * \brief           Change screen with slide or push transition
+ *
+ *                  Both screens are rendered once to screen sized buffers, transition then only
+ *                  moves buffers each frame, either with overlay planes or with single copy of each buffer.
+ *                  Outgoing screen is hidden and incoming screen is shown immediately,
+ *                  widgets drawn during transition are shown when it ends.
+ *
+ * \note            Screens are expected to cover complete display, outgoing screen is visible
+ *                  and incoming screen is hidden before call
+ * \note            Running transition is finished before new one starts
+ * \param[in]       from: Outgoing screen, visible before call
+ * \param[in]       to: Incoming screen, shown with transition
+ * \param[in]       type: Transition type
+ * \param[in]       duration: Duration in units of milliseconds
+ * \param[in]       ease: Easing function
+ * \return          `1` on success, `0` when screens were switched without transition because of low memory
+ * \sa              gui_anim_istransition
+ */
+uint8_t
+gui_anim_transition(gui_handle_p from, gui_handle_p to, gui_transition_t type, uint32_t duration, gui_anim_ease_t ease) {
+    gui_transition_state_t* t = &GUI.transition;
+    gui_layer_t* layer;
+    size_t i;
+    uint8_t ret = 0;
+
+    GUI_ASSERTPARAMS(guii_widget_iswidget(from) && guii_widget_iswidget(to) && from != to
+        && type <= GUI_TRANSITION_PUSH_DOWN);
+    GUI_CORE_PROTECT(1);
+    if (t->layers[0] != NULL) {
+        transition_end();                           /* Previous transition is completed immediately */
+    }
+    if (t->timer == NULL) {
+        t->timer = guii_timer_create(GUI_CFG_ANIM_PERIOD, transition_timer_callback, NULL);
+    }
+
+    /* Allocate layer for each screen, none is used if any allocation fails */
+    for (i = 0; t->timer != NULL && i < GUI_COUNT_OF(t->layers); i++) {
+        layer = GUI_MEMALLOC_CLASS(sizeof(*layer) + (size_t)GUI.lcd.width * (size_t)GUI.lcd.height * (size_t)GUI.lcd.pixel_size, GUI_MEM_CLASS_PIXEL);
+        if (layer == NULL) {
+            break;
+        }
+        layer->num = (uint8_t)i;
+        layer->width = GUI.lcd.width;
+        layer->height = GUI.lcd.height;
+        layer->start_address = ((uint8_t *)layer) + sizeof(*layer);
+        layer->pixel_format = GUI.lcd.layers[0].pixel_format;
+        t->layers[i] = layer;
+    }
+
+    if (i == GUI_COUNT_OF(t->layers)) {
+        guii_redraw_tolayer(t->layers[0]);          /* Outgoing screen as currently shown */
+        gui_widget_hide(from);
+        gui_widget_show(to);
+        guii_redraw_tolayer(t->layers[1]);
+
+        t->start = gui_sys_now();
+        t->duration = duration;
+        t->offset = 0;
+        t->type = (uint8_t)type;
+        t->ease = (uint8_t)ease;
+        transition_setpos();
+#if GUI_CFG_USE_OVERLAY
+        t->planes = transition_getplanes();
+        if (t->planes) {
+            transition_setplanes(1);                /* Main layer is drawn with incoming screen below planes */
+        } else
+#endif /* GUI_CFG_USE_OVERLAY */
+        {
+            transition_invalidate();
+        }
+        guii_timer_startperiodic(t->timer);
+        ret = 1;
+    } else {
+        while (i > 0) {
+            --i;
+            GUI_MEMFREE(t->layers[i]);
+        }
+        gui_widget_hide(from);                      /* Switch screens without transition */
+        gui_widget_show(to);
+    }
+    GUI_CORE_UNPROTECT(1);
+    return ret;
+}
+
+/**
+ * \brief           Check if screen transition is running
+ * \return          `1` if transition is running, `0` otherwise
+ */
+uint8_t
+gui_anim_istransition(void) {
+    return GUI.transition.layers[0] != NULL;
+}
+
+#endif /* GUI_CFG_USE_TRANSITION || __DOXYGEN__ */
+
+#endif /* GUI_CFG_USE_ANIM || __DOXYGEN__ */
@@ -174,6 +174,125 @@ gui_buffer_read(gui_buff_t* buff, void* data, uint32_t count) {
     return (i + count);                         /* Return number of elements stored in memory */
 }
 
+/**
+ * \brief  Gets pointer to first element to read, without copying it
+ * \note   Use \ref gui_buffer_getlinearblockreadlength to get number of readable elements at address
+ *         and \ref gui_buffer_skip to remove them after they were processed
+ * \param  buff: Pointer to \ref gui_buff_t structure
+ * \return Pointer to first element to read or `NULL` if buffer is empty
+ */
+void*
+gui_buffer_getlinearblockreadaddress(gui_buff_t* buff) {
+    if (buff == NULL || !gui_buffer_getfull(buff)) {    /* Check buffer structure */
+        return NULL;
+    }
+    return &buff->buff[buff->out < buff->size ? buff->out : 0];
+}
+
+/**
+ * \brief  Gets number of elements readable at once from \ref gui_buffer_getlinearblockreadaddress
+ * \note   When data wrap around end of buffer, only elements till end of buffer are counted
+ * \param  buff: Pointer to \ref gui_buff_t structure
+ * \return Number of elements in linear block
+ */
+uint32_t
+gui_buffer_getlinearblockreadlength(gui_buff_t* buff) {
+    uint32_t in, out;
+    
+    if (buff == NULL) {                         /* Check buffer structure */
+        return 0;
+    }
+    in = buff->in;                              /* Save values */
+    out = buff->out < buff->size ? buff->out : 0;
+    if (in >= out) {                            /* Data are not wrapped */
+        return in - out;
+    }
+    return buff->size - out;                    /* Read till end of memory first */
+}
+
+/**
+ * \brief  Removes elements from buffer without copying them
+ * \param  buff: Pointer to \ref gui_buff_t structure
+ * \param  count: Number of elements to remove
+ * \return Number of elements removed from buffer
+ */
+uint32_t
+gui_buffer_skip(gui_buff_t* buff, uint32_t count) {
+    uint32_t full;
+    
+    if (buff == NULL || count == 0) {           /* Check buffer structure */
+        return 0;
+    }
+    full = gui_buffer_getfull(buff);
+    if (count > full) {                         /* Cannot skip more than available */
+        count = full;
+    }
+    buff->out = (buff->out + count) % buff->size;   /* Elements are released to writer */
+    return count;
+}
+
+/**
+ * \brief  Gets pointer to free memory to write elements to, without copying from other memory
+ * \note   Use \ref gui_buffer_getlinearblockwritelength to get number of elements writable at address
+ *         and \ref gui_buffer_advance to publish them after they were written
+ * \param  buff: Pointer to \ref gui_buff_t structure
+ * \return Pointer to free memory or `NULL` if buffer is full
+ */
+void*
+gui_buffer_getlinearblockwriteaddress(gui_buff_t* buff) {
+    if (buff == NULL || !gui_buffer_getfree(buff)) {    /* Check buffer structure */
+        return NULL;
+    }
+    return &buff->buff[buff->in < buff->size ? buff->in : 0];
+}
+
+/**
+ * \brief  Gets number of elements writable at once to \ref gui_buffer_getlinearblockwriteaddress
+ * \note   When free memory wraps around end of buffer, only elements till end of buffer are counted
+ * \param  buff: Pointer to \ref gui_buff_t structure
+ * \return Number of elements in linear block
+ */
+uint32_t
+gui_buffer_getlinearblockwritelength(gui_buff_t* buff) {
+    uint32_t in, out, len;
+    
+    if (buff == NULL) {                         /* Check buffer structure */
+        return 0;
+    }
+    in = buff->in < buff->size ? buff->in : 0;  /* Save values */
+    out = buff->out;
+    if (out > in) {                             /* Free memory is between pointers */
+        len = out - in - 1;
+    } else {                                    /* Free memory till end of buffer */
+        len = buff->size - in;
+        if (out == 0) {                         /* One element is always free to distinguish full from empty */
+            len--;
+        }
+    }
+    return len;
+}
+
+/**
+ * \brief  Publishes elements written to memory returned by \ref gui_buffer_getlinearblockwriteaddress
+ * \param  buff: Pointer to \ref gui_buff_t structure
+ * \param  count: Number of written elements
+ * \return Number of elements added to buffer
+ */
+uint32_t
+gui_buffer_advance(gui_buff_t* buff, uint32_t count) {
+    uint32_t free;
+    
+    if (buff == NULL || count == 0) {           /* Check buffer structure */
+        return 0;
+    }
+    free = gui_buffer_getfree(buff);
+    if (count > free) {                         /* Cannot write more than free */
+        count = free;
+    }
+    buff->in = (buff->in + count) % buff->size; /* Elements are available to reader */
+    return count;
+}
+
 /**
  * \brief  Gets number of free elements in buffer 
  * \param  buff: Pointer to \ref gui_buff_t structure
@@ -0,0 +1,297 @@
+/**    
+ * \file            gui_cache.c
+ * \brief           Adaptive cache budgets
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_cache.h"
+
+#if GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__
+
+/* Configured size of each cache, `0` when cache is disabled or not limited */
+#define CACHE_FONT_SIZE             ((size_t)GUI_CFG_FONT_CACHE_SIZE)
+#if GUI_CFG_USE_IMAGE_CACHE
+#define CACHE_IMAGE_SIZE            ((size_t)GUI_CFG_IMAGE_CACHE_SIZE)
+#else /* GUI_CFG_USE_IMAGE_CACHE */
+#define CACHE_IMAGE_SIZE            ((size_t)0)
+#endif /* !GUI_CFG_USE_IMAGE_CACHE */
+#if GUI_CFG_USE_SPRITE_CACHE
+#define CACHE_SPRITE_SIZE           ((size_t)GUI_CFG_SPRITE_CACHE_SIZE)
+#else /* GUI_CFG_USE_SPRITE_CACHE */
+#define CACHE_SPRITE_SIZE           ((size_t)0)
+#endif /* !GUI_CFG_USE_SPRITE_CACHE */
+#if GUI_CFG_USE_LCD_ROTATION
+#define CACHE_ROTATION_SIZE         ((size_t)GUI_CFG_LCD_ROTATION_CACHE_SIZE)
+#else /* GUI_CFG_USE_LCD_ROTATION */
+#define CACHE_ROTATION_SIZE         ((size_t)0)
+#endif /* !GUI_CFG_USE_LCD_ROTATION */
+
+#define CACHE_SUM                   (CACHE_FONT_SIZE + CACHE_IMAGE_SIZE + CACHE_SPRITE_SIZE + CACHE_ROTATION_SIZE)
+
+/* Common budget of all caches */
+#if GUI_CFG_CACHE_BUDGET
+#define CACHE_TOTAL                 ((size_t)GUI_CFG_CACHE_BUDGET)
+#else /* GUI_CFG_CACHE_BUDGET */
+#define CACHE_TOTAL                 CACHE_SUM
+#endif /* !GUI_CFG_CACHE_BUDGET */
+
+/* Initial budget of cache, configured size scaled to common budget */
+#define CACHE_SHARE(size)           (CACHE_SUM ? (size_t)((uint64_t)(size) * CACHE_TOTAL / CACHE_SUM) : 0)
+
+/* Minimal budget of cache, quarter of its configured size */
+#define CACHE_FLOOR(size)           ((size) >> 2)
+
+/**
+ * \brief           State of single cache
+ */
+typedef struct {
+    size_t budget;                                  /*!< Current budget in units of bytes */
+    uint32_t hits;                                  /*!< Aged number of lookups found in cache */
+    uint32_t misses;                                /*!< Aged number of lookups not found in cache */
+    uint32_t reclaimed;                             /*!< Number of entries released on failed allocation */
+} cache_state_t;
+
+static const size_t cache_size[GUI_CACHE_END] = {
+    [GUI_CACHE_FONT] = CACHE_FONT_SIZE,
+    [GUI_CACHE_IMAGE] = CACHE_IMAGE_SIZE,
+    [GUI_CACHE_SPRITE] = CACHE_SPRITE_SIZE,
+    [GUI_CACHE_ROTATION] = CACHE_ROTATION_SIZE,
+};
+
+/* Caches are shared by all displays, same as character cache */
+static cache_state_t caches[GUI_CACHE_END] = {
+    [GUI_CACHE_FONT] = {.budget = CACHE_SHARE(CACHE_FONT_SIZE)},
+    [GUI_CACHE_IMAGE] = {.budget = CACHE_SHARE(CACHE_IMAGE_SIZE)},
+    [GUI_CACHE_SPRITE] = {.budget = CACHE_SHARE(CACHE_SPRITE_SIZE)},
+    [GUI_CACHE_ROTATION] = {.budget = CACHE_SHARE(CACHE_ROTATION_SIZE)},
+};
+static uint32_t cache_frames;                       /* Number of frames since last budget update */
+
+/**
+ * \brief           Get number of bytes used by cache entries
+ * \param[in]       cache: Cache, member of \ref gui_cache_t
+ * \return          Number of used bytes
+ */
+static size_t
+cache_used(gui_cache_t cache) {
+    switch (cache) {
+        case GUI_CACHE_FONT: return GUI.font_cache_size;
+#if GUI_CFG_USE_IMAGE_CACHE
+        case GUI_CACHE_IMAGE: return GUI.image_cache_size;
+#endif /* GUI_CFG_USE_IMAGE_CACHE */
+#if GUI_CFG_USE_SPRITE_CACHE
+        case GUI_CACHE_SPRITE: return GUI.sprite_cache_size;
+#endif /* GUI_CFG_USE_SPRITE_CACHE */
+#if GUI_CFG_USE_LCD_ROTATION
+        case GUI_CACHE_ROTATION: return GUI.rot_cache_size;
+#endif /* GUI_CFG_USE_LCD_ROTATION */
+        default: return 0;
+    }
+}
+
+/**
+ * \brief           Release least recently used entry of cache, except most recently used one
+ * \param[in]       cache: Cache, member of \ref gui_cache_t
+ * \return          `1` if entry was released, `0` otherwise
+ */
+static uint8_t
+cache_release(gui_cache_t cache) {
+    switch (cache) {
+        case GUI_CACHE_FONT: return guii_text_cachereclaim();
+#if GUI_CFG_USE_IMAGE_CACHE
+        case GUI_CACHE_IMAGE: return guii_draw_image_cachereclaim();
+#endif /* GUI_CFG_USE_IMAGE_CACHE */
+#if GUI_CFG_USE_SPRITE_CACHE
+        case GUI_CACHE_SPRITE: return guii_draw_sprite_cachereclaim();
+#endif /* GUI_CFG_USE_SPRITE_CACHE */
+#if GUI_CFG_USE_LCD_ROTATION
+        case GUI_CACHE_ROTATION: return guii_lcd_rotation_cachereclaim();
+#endif /* GUI_CFG_USE_LCD_ROTATION */
+        default: return 0;
+    }
+}
+
+/**
+ * \brief           Split common budget between caches
+ *
+ *                  Cache which is not full releases half of its unused budget, down to its floor.
+ *                  Remaining bytes are shared by full caches with misses, by their number of accesses.
+ *                  Nothing changes when no cache needs more memory
+ */
+static void
+cache_rebalance(void) {
+    size_t target[GUI_CACHE_END], spare = CACHE_TOTAL, used;
+    uint32_t weight = 0;
+    uint8_t full[GUI_CACHE_END];
+    uint8_t i;
+    
+    for (i = 0; i < GUI_CACHE_END; i++) {
+        full[i] = 0;
+        target[i] = 0;
+        if (!cache_size[i]) {
+            continue;
+        }
+        used = cache_used((gui_cache_t)i);
+        if (caches[i].misses && used + (caches[i].budget >> 3) >= caches[i].budget) {
+            full[i] = 1;                            /* Cache evicts entries it still misses */
+            target[i] = CACHE_FLOOR(cache_size[i]);
+            weight += caches[i].hits + caches[i].misses;
+        } else {
+            target[i] = used < caches[i].budget ? used + (caches[i].budget - used) / 2 : caches[i].budget;
+            target[i] = GUI_MAX(target[i], CACHE_FLOOR(cache_size[i]));
+        }
+        spare -= GUI_MIN(spare, target[i]);
+    }
+    if (!weight) {
+        return;
+    }
+    for (i = 0; i < GUI_CACHE_END; i++) {
+        if (full[i]) {
+            target[i] += (size_t)((uint64_t)spare * (caches[i].hits + caches[i].misses) / weight);
+        }
+        caches[i].budget = target[i];
+        while (cache_used((gui_cache_t)i) > caches[i].budget && cache_release((gui_cache_t)i)) {}
+    }
+}
+
+/**
+ * \brief           Count cache lookup
+ * \note            This function is private and may be called only when GUI is protected
+ * \param[in]       cache: Cache, member of \ref gui_cache_t
+ * \param[in]       hit: Set to `1` when entry was found or `0` otherwise
+ */
+void
+guii_cache_count(gui_cache_t cache, uint8_t hit) {
+    if (hit) {
+        caches[cache].hits++;
+    } else {
+        caches[cache].misses++;
+    }
+}
+
+/**
+ * \brief           Get current budget of cache
+ * \note            This function is private and may be called only when GUI is protected
+ * \param[in]       cache: Cache, member of \ref gui_cache_t
+ * \return          Maximal number of bytes cache entries may use
+ */
+size_t
+guii_cache_getbudget(gui_cache_t cache) {
+    return caches[cache].budget;
+}
+
+/**
+ * \brief           Update budgets of caches every \ref GUI_CFG_CACHE_REBALANCE_PERIOD frames
+ * \note            This function is private and may be called only when GUI is protected,
+ *                  after frame is drawn and no cache entry is in use
+ */
+void
+guii_cache_frame(void) {
+    uint8_t i;
+    
+    if (++cache_frames < GUI_CFG_CACHE_REBALANCE_PERIOD) {
+        return;
+    }
+    cache_frames = 0;
+    cache_rebalance();
+    for (i = 0; i < GUI_CACHE_END; i++) {           /* Halve counters, recent accesses have more weight */
+        caches[i].hits >>= 1;
+        caches[i].misses >>= 1;
+    }
+}
+
+/**
+ * \brief           Release cache entries after heap allocation failed
+ *
+ *                  Entries are released one by one from cache with least hits per byte,
+ *                  so allocation may be tried again after each call
+ *
+ * \note            This function is private and may be called only when GUI is protected
+ * \param[in]       size: Number of bytes of failed allocation
+ * \return          `1` if any entry was released, `0` when no entry may be released
+ */
+uint8_t
+guii_cache_reclaim(size_t size) {
+    size_t freed = 0, used, best_used = 0, before;
+    uint8_t i, best, skip = 0;
+    
+    while (freed < size) {
+        best = GUI_CACHE_END;
+        for (i = 0; i < GUI_CACHE_END; i++) {
+            if ((skip & (1 << i)) || !(used = cache_used((gui_cache_t)i))) {
+                continue;
+            }
+            /* Lower hits per byte first, larger cache first on equal density */
+            if (best == GUI_CACHE_END
+                || (uint64_t)(caches[i].hits + 1) * best_used < (uint64_t)(caches[best].hits + 1) * used) {
+                best = i;
+                best_used = used;
+            }
+        }
+        if (best == GUI_CACHE_END) {
+            break;
+        }
+        before = cache_used((gui_cache_t)best);
+        if (!cache_release((gui_cache_t)best)) {
+            skip |= 1 << best;                      /* Only entry in use is left */
+            continue;
+        }
+        freed += before - cache_used((gui_cache_t)best);
+        caches[best].reclaimed++;
+    }
+    return freed > 0;
+}
+
+/**
+ * \brief           Get usage statistics of cache
+ *
+ *                  Sizes of image, sprite and rotation caches are reported for currently selected display
+ *
+ * \param[in]       cache: Cache, member of \ref gui_cache_t
+ * \param[out]      stat: Output statistics
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_cache_getstat(gui_cache_t cache, gui_cache_stat_t* stat) {
+    GUI_ASSERTPARAMS(cache < GUI_CACHE_END && stat != NULL);
+    
+    GUI_CORE_PROTECT(1);
+    stat->used = cache_used(cache);
+    stat->budget = cache_size[cache] ? caches[cache].budget : 0;
+    stat->hits = caches[cache].hits;
+    stat->misses = caches[cache].misses;
+    stat->reclaimed = caches[cache].reclaimed;
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__ */
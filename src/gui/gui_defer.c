@@ -0,0 +1,193 @@
+/**    
+ * \file            gui_defer.c
+ * \brief           Deferred work queue
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_defer.h"
+
+#if GUI_CFG_USE_DEFER || __DOXYGEN__
+
+/* Work is processed by separate worker thread */
+#define DEFER_WORKER                (GUI_CFG_OS && GUI_CFG_DEFER_THREAD)
+
+/**
+ * \brief           Single deferred work entry
+ */
+typedef struct {
+    gui_defer_fn fn;                                /*!< Function to call */
+    void* arg;                                      /*!< Custom argument */
+} defer_item_t;
+
+static defer_item_t defer_queue[GUI_CFG_DEFER_QUEUE_SIZE];
+static size_t defer_in;                             /* Number of entries written */
+static size_t defer_out;                            /* Number of entries read */
+
+#if GUI_CFG_OS
+static gui_sys_mutex_t defer_mutex;                 /* Queue protection, separate from core protection held during redraw */
+#define DEFER_LOCK()                gui_sys_mutex_lock(&defer_mutex)
+#define DEFER_UNLOCK()              gui_sys_mutex_unlock(&defer_mutex)
+#else /* GUI_CFG_OS */
+#define DEFER_LOCK()
+#define DEFER_UNLOCK()
+#endif /* !GUI_CFG_OS */
+
+#if DEFER_WORKER
+static gui_sys_mbox_t defer_mbox;                   /* Wakeup of worker thread */
+static gui_sys_thread_t defer_thread_id;            /* Worker thread */
+#endif /* DEFER_WORKER */
+
+/**
+ * \brief           Process entries which were in queue when function was called
+ *
+ *                  Entries added by processed work are left for next call,
+ *                  so work posting itself again does not block caller
+ */
+static void
+defer_run(void) {
+    defer_item_t item;
+    size_t cnt;
+    
+    DEFER_LOCK();
+    cnt = defer_in - defer_out;
+    DEFER_UNLOCK();
+    for (; cnt > 0; cnt--) {
+        DEFER_LOCK();
+        item = defer_queue[defer_out % GUI_CFG_DEFER_QUEUE_SIZE];
+        defer_out++;
+        DEFER_UNLOCK();
+        item.fn(item.arg);                          /* Call work without any protection */
+    }
+}
+
+#if DEFER_WORKER
+/**
+ * \brief           Worker thread for deferred work
+ * \param[in]       argument: Unused
+ */
+static void
+defer_thread(void * const argument) {
+    void* msg;
+    
+    GUI_UNUSED(argument);
+    while (1) {
+        gui_sys_mbox_get(&defer_mbox, &msg, 0);     /* Wait for new work */
+        defer_run();
+    }
+}
+#endif /* DEFER_WORKER */
+
+/**
+ * \brief           Add work to be processed outside core protection
+ * \note            Function may be called from any thread, also from timer and widget callbacks
+ * \param[in]       fn: Function to call
+ * \param[in]       arg: Custom argument passed to function
+ * \return          `1` on success, `0` if queue is full
+ */
+uint8_t
+gui_defer(gui_defer_fn fn, void* arg) {
+    uint8_t ret = 0;
+    
+    GUI_ASSERTPARAMS(fn != NULL);
+    DEFER_LOCK();
+    if (defer_in - defer_out < GUI_CFG_DEFER_QUEUE_SIZE) {
+        defer_queue[defer_in % GUI_CFG_DEFER_QUEUE_SIZE].fn = fn;
+        defer_queue[defer_in % GUI_CFG_DEFER_QUEUE_SIZE].arg = arg;
+        defer_in++;
+        ret = 1;
+    }
+    DEFER_UNLOCK();
+    
+    if (ret) {
+#if DEFER_WORKER
+        gui_sys_mbox_putnow(&defer_mbox, NULL);     /* Wakeup worker, message may already be pending */
+#elif GUI_CFG_OS
+        if (!GUI.OS.processing) {
+            guii_wakeup(GUI_SYS_WAKEUP_WIDGET);     /* Wakeup GUI thread to process work */
+        }
+#endif /* GUI_CFG_OS */
+    }
+    return ret;
+}
+
+/**
+ * \brief           Init deferred work queue and start worker thread
+ * \note            This function is private and may be called only from \ref gui_init
+ */
+void
+guii_defer_init(void) {
+    defer_in = 0;
+    defer_out = 0;
+#if GUI_CFG_OS
+    if (!gui_sys_mutex_isvalid(&defer_mutex)) {
+        gui_sys_mutex_create(&defer_mutex);
+    }
+#endif /* GUI_CFG_OS */
+#if DEFER_WORKER
+    if (!gui_sys_mbox_isvalid(&defer_mbox)) {
+        gui_sys_mbox_create(&defer_mbox, 1);
+        gui_sys_thread_create(&defer_thread_id, "gui_defer", defer_thread, NULL, GUI_CFG_DEFER_THREAD_SS, GUI_CFG_DEFER_THREAD_PRIO);
+    }
+#endif /* DEFER_WORKER */
+}
+
+/**
+ * \brief           Process deferred work on GUI thread
+ * \note            This function is private and must be called without core protection.
+ *                  It does nothing when worker thread is used
+ */
+void
+guii_defer_process(void) {
+#if !DEFER_WORKER
+    defer_run();
+#endif /* !DEFER_WORKER */
+}
+
+/**
+ * \brief           Check if deferred work waits for GUI thread
+ * \return          `1` if GUI thread must not block, `0` otherwise
+ */
+uint8_t
+guii_defer_pending(void) {
+#if DEFER_WORKER
+    return 0;
+#else /* DEFER_WORKER */
+    uint8_t ret;
+    
+    DEFER_LOCK();
+    ret = defer_in != defer_out;
+    DEFER_UNLOCK();
+    return ret;
+#endif /* !DEFER_WORKER */
+}
+
+#endif /* GUI_CFG_USE_DEFER || __DOXYGEN__ */
@@ -75,6 +75,173 @@ typedef struct {
 
 static gui_stringrectvars_t var;
 
+#if GUI_CFG_USE_DISPLAY_LIST || __DOXYGEN__
+
+/**
+ * \brief           Type of command recorded to display list
+ */
+typedef enum {
+    DRAW_LIST_FILLSCREEN = 0x00,                    /*!< \ref gui_draw_fillscreen */
+    DRAW_LIST_SETPIXEL,                             /*!< \ref gui_draw_setpixel */
+    DRAW_LIST_VLINE,                                /*!< \ref gui_draw_vline */
+    DRAW_LIST_HLINE,                                /*!< \ref gui_draw_hline */
+    DRAW_LIST_LINE,                                 /*!< \ref gui_draw_line */
+    DRAW_LIST_RECTANGLE,                            /*!< \ref gui_draw_rectangle */
+    DRAW_LIST_FILLEDRECTANGLE,                      /*!< \ref gui_draw_filledrectangle */
+    DRAW_LIST_RECTANGLE3D,                          /*!< \ref gui_draw_rectangle3d */
+    DRAW_LIST_ROUNDEDRECTANGLE,                     /*!< \ref gui_draw_roundedrectangle */
+    DRAW_LIST_FILLEDROUNDEDRECTANGLE,               /*!< \ref gui_draw_filledroundedrectangle */
+    DRAW_LIST_CIRCLE,                               /*!< \ref gui_draw_circle */
+    DRAW_LIST_FILLEDCIRCLE,                         /*!< \ref gui_draw_filledcircle */
+    DRAW_LIST_TRIANGLE,                             /*!< \ref gui_draw_triangle */
+    DRAW_LIST_FILLEDTRIANGLE,                       /*!< \ref gui_draw_filledtriangle */
+    DRAW_LIST_CIRCLECORNER,                         /*!< \ref gui_draw_circlecorner */
+    DRAW_LIST_FILLEDCIRCLECORNER,                   /*!< \ref gui_draw_filledcirclecorner */
+    DRAW_LIST_LINE_AA,                              /*!< \ref gui_draw_line_aa */
+    DRAW_LIST_CIRCLE_AA,                            /*!< \ref gui_draw_circle_aa */
+    DRAW_LIST_CIRCLECORNER_AA,                      /*!< \ref gui_draw_circlecorner_aa */
+    DRAW_LIST_IMAGE,                                /*!< \ref gui_draw_image */
+    DRAW_LIST_POLY,                                 /*!< \ref gui_draw_poly, points are payload */
+    DRAW_LIST_ICON,                                 /*!< \ref gui_draw_icon */
+    DRAW_LIST_TEXT,                                 /*!< \ref gui_draw_writetext, drawing structure and string are payload */
+    DRAW_LIST_SCROLLBAR,                            /*!< \ref gui_draw_scrollbar, scroll bar structure is payload */
+    DRAW_LIST_GRADIENT,                             /*!< \ref gui_draw_gradientroundedrectangle, gradient structure is payload */
+    DRAW_LIST_NINEPATCH,                            /*!< \ref gui_draw_ninepatch */
+    DRAW_LIST_IMAGE_TRANSFORM,                      /*!< \ref gui_draw_image_transform, transform structure is payload */
+} draw_list_type_t;
+
+/**
+ * \brief           Single command of display list, followed by `len` bytes of payload
+ */
+typedef struct {
+    uint8_t type;                                   /*!< Command type, member of \ref draw_list_type_t */
+    uint8_t arg;                                    /*!< Circle corners or 3D state */
+    uint16_t len;                                   /*!< Number of payload bytes following command */
+    gui_display_t disp;                             /*!< Clipping region used when command was recorded */
+    gui_dim_t v[6];                                 /*!< Coordinates and sizes */
+    gui_color_t color;                              /*!< Drawing color */
+    const void* ptr;                                /*!< Font, image or icon */
+} draw_list_cmd_t;
+
+/**
+ * \brief           Round payload length up, so that each command in list starts aligned
+ */
+#define DRAW_LIST_ALIGN(x)              (((x) + sizeof(void *) - 1) & ~(sizeof(void *) - 1))
+
+static gui_draw_list_t* draw_list_rec;              /*!< Display list being recorded or `NULL` */
+
+/**
+ * \brief           Add command to display list being recorded
+ * \param[in]       disp: Clipping region of drawing call
+ * \param[in,out]   cmd: Command to add, its length and clipping region are set by function
+ * \param[in]       data: Payload to copy after command or `NULL` to only reserve memory for it
+ * \param[in]       len: Number of payload bytes
+ * \return          Pointer to payload memory on success, `NULL` when list is full
+ */
+static uint8_t*
+draw_list_add(const gui_display_t* disp, draw_list_cmd_t* cmd, const void* data, size_t len) {
+    gui_draw_list_t* list = draw_list_rec;
+    size_t need = list->len + sizeof(*cmd) + DRAW_LIST_ALIGN(len);
+    uint8_t* p;
+    
+    
+    if (list->failed) {
+        return NULL;
+    }
+    if (DRAW_LIST_ALIGN(len) > 0xFFFF || need > GUI_CFG_DISPLAY_LIST_SIZE) {
+        list->failed = 1;                           /* Drawing is too complex for list */
+        return NULL;
+    }
+    if (need > list->size) {                        /* Grow list memory */
+        size_t size = list->size ? 2 * list->size : 0x80;
+        
+        while (size < need) {
+            size *= 2;
+        }
+        if (size > GUI_CFG_DISPLAY_LIST_SIZE) {
+            size = GUI_CFG_DISPLAY_LIST_SIZE;
+        }
+        p = GUI_MEMREALLOC(list->data, size);
+        if (p == NULL) {
+            list->failed = 1;
+            return NULL;
+        }
+        list->data = p;
+        list->size = size;
+    }
+    
+    cmd->len = (uint16_t)DRAW_LIST_ALIGN(len);
+    memcpy(&cmd->disp, disp, sizeof(cmd->disp));
+    p = list->data + list->len;
+    memcpy(p, cmd, sizeof(*cmd));
+    if (data != NULL) {
+        memcpy(p + sizeof(*cmd), data, len);
+    }
+    list->len = need;
+    return p + sizeof(*cmd);
+}
+
+/**
+ * \brief           Record drawing call to display list and draw it
+ *
+ *                  Only top level call is recorded, list is disabled
+ *                  while `call` runs so nested drawing functions draw normally
+ *
+ * \hideinitializer
+ */
+#define DRAW_LIST_RECORD(type, arg, v0, v1, v2, v3, v4, v5, color, ptr, data, len, call)  do {    \
+    if (draw_list_rec != NULL) {                                                \
+        gui_draw_list_t* const rec = draw_list_rec;                             \
+        draw_list_cmd_t cmd = {(uint8_t)(type), (uint8_t)(arg), 0, {0, 0, 0, 0},  \
+            {(gui_dim_t)(v0), (gui_dim_t)(v1), (gui_dim_t)(v2), (gui_dim_t)(v3), (gui_dim_t)(v4), (gui_dim_t)(v5)},    \
+            (color), (ptr)};                                                    \
+        draw_list_add(disp, &cmd, (data), (len));                               \
+        draw_list_rec = NULL;                                                   \
+        call;                                                                   \
+        draw_list_rec = rec;                                                    \
+        return;                                                                 \
+    }                                                                           \
+} while (0)
+
+#else /* GUI_CFG_USE_DISPLAY_LIST */
+#define DRAW_LIST_RECORD(type, arg, v0, v1, v2, v3, v4, v5, color, ptr, data, len, call)
+#endif /* !GUI_CFG_USE_DISPLAY_LIST */
+
+#if GUI_CFG_USE_LL_DIRECT_ACCESS || __DOXYGEN__
+
+/**
+ * \brief           Get direct access to drawing layer for software row loops
+ * \param[in]       sync: Set to `1` to wait for pending hardware operations, `0` to use low-level functions instead
+ * \return          Layer access or `NULL` to draw pixels with low-level functions
+ */
+static const gui_layer_access_t *
+draw_access(uint8_t sync) {
+#if GUI_CFG_USE_DISPLAY_LIST
+    if (draw_list_rec != NULL) {
+        return NULL;                                /* Drawing is recorded with pixel functions */
+    }
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+    return guii_lcd_getaccess(GUI.lcd.drawing_layer, sync);
+}
+
+/**
+ * \brief           Blend color to pixel in directly accessed drawing layer
+ * \param[in]       acc: Access to drawing layer
+ * \param[in]       p: Pixel address
+ * \param[in]       color: Foreground color
+ * \param[in]       a: Foreground weight, `0xFF` for solid color
+ */
+static inline void
+draw_access_blend(const gui_layer_access_t* acc, uint8_t* p, gui_color_t color, uint8_t a) {
+    if (a == 0xFF) {
+        guii_access_setpixel(acc, p, color);
+    } else if (a) {
+        guii_access_setpixel(acc, p, guii_blend_color(color, guii_access_getpixel(acc, p), a));
+    }
+}
+
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS || __DOXYGEN__ */
+
 /* Get string rectangle width and height */
 #define RECT_CONTINUE(incCnt)     if (1) {          \
     if (incCnt) var.cnt++;                          \
@@ -149,6 +316,76 @@ process_string_rectangle_before_return(gui_stringrectvars_t* var, gui_stringrect
     }
 }
 
+#if GUI_CFG_USE_COVERAGE_MASK || __DOXYGEN__
+
+#define COVERAGE_TILE                   ((gui_dim_t)GUI_CFG_COVERAGE_TILE_SIZE)
+
+/**
+ * \brief           Fill already clipped rectangle except tiles covered by opaque children of drawn widget
+ *
+ *                  Consecutive tile rows without covered tile are filled as one rectangle
+ *
+ * \param[in]       x: Absolute X position of rectangle
+ * \param[in]       y: Absolute Y position of rectangle
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       color: Fill color
+ */
+GUI_CFG_FAST_CODE static void
+fill_uncovered(gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color) {
+    const guii_coverage_t* cv = &GUI.coverage;
+    gui_layer_t* layer = GUI.lcd.drawing_layer;
+    gui_dim_t tx, ty, tx1, ty1, tx2, ty2, band, ys, ye, xs, xe;
+    size_t row;
+    uint8_t covered;
+
+    tx1 = (x - cv->x) / COVERAGE_TILE;
+    ty1 = (y - cv->y) / COVERAGE_TILE;
+    tx2 = (x + width - 1 - cv->x) / COVERAGE_TILE;
+    ty2 = (y + height - 1 - cv->y) / COVERAGE_TILE;
+    if (x < cv->x || y < cv->y || tx2 >= cv->cols || ty2 >= cv->rows) {
+        GUI_LL(FillRect)(&GUI.lcd, layer, x - layer->x_pos, y - layer->y_pos, width, height, color);
+        return;                                     /* Rectangle is not inside mask, fill it normally */
+    }
+
+    band = y;                                       /* Start of rows not filled yet */
+    for (ty = ty1; ty <= ty2; ty++) {
+        ys = GUI_MAX(y, cv->y + ty * COVERAGE_TILE);
+        ye = GUI_MIN(y + height, cv->y + (ty + 1) * COVERAGE_TILE);
+        row = (size_t)ty * (size_t)cv->cols;
+
+        covered = 0;
+        for (tx = tx1; tx <= tx2 && !covered; tx++) {
+            covered = !!(cv->tiles[(row + tx) >> 5] & ((uint32_t)1 << ((row + tx) & 0x1F)));
+        }
+        if (!covered) {
+            continue;                               /* Row is merged with next rows */
+        }
+        if (band < ys) {                            /* Fill rows above without any covered tile */
+            GUI_LL(FillRect)(&GUI.lcd, layer, x - layer->x_pos, band - layer->y_pos, width, ys - band, color);
+        }
+        band = ye;
+
+        /* Fill runs of uncovered tiles in this row */
+        for (tx = tx1; tx <= tx2; tx++) {
+            if (cv->tiles[(row + tx) >> 5] & ((uint32_t)1 << ((row + tx) & 0x1F))) {
+                continue;
+            }
+            xs = GUI_MAX(x, cv->x + tx * COVERAGE_TILE);
+            while (tx < tx2 && !(cv->tiles[(row + tx + 1) >> 5] & ((uint32_t)1 << ((row + tx + 1) & 0x1F)))) {
+                tx++;
+            }
+            xe = GUI_MIN(x + width, cv->x + (tx + 1) * COVERAGE_TILE);
+            GUI_LL(FillRect)(&GUI.lcd, layer, xs - layer->x_pos, ys - layer->y_pos, xe - xs, ye - ys, color);
+        }
+    }
+    if (band < y + height) {
+        GUI_LL(FillRect)(&GUI.lcd, layer, x - layer->x_pos, band - layer->y_pos, width, y + height - band, color);
+    }
+}
+
+#endif /* GUI_CFG_USE_COVERAGE_MASK || __DOXYGEN__ */
+
 /**
  * \brief           Get a line of text for given rectangle
  * \param[in]       rect: Rectangle parameters
@@ -220,6 +457,7 @@ string_rectangle(gui_stringrect_t* rect, gui_string_t* str, uint8_t onlyToNextLi
                 } else {                            /* Try to get character size */
                     /* Try to fit character in current line */
                     gui_text_getcharsize(rect->Font, var.ch, &w, &h);   /* Get character dimensions */
+                    w += gui_text_getkerning(rect->Font, var.lastCh, var.ch);   /* Adjust for previous character */
                     if ((var.cW + w) < rect->StringDraw->width) {   /* Do we have enough memory available */
                         var.cW += w;                /* Increase total line width */
                         if (CH_WS == var.ch) {      /* Check if character is white space */
@@ -269,6 +507,8 @@ string_rectangle(gui_stringrect_t* rect, gui_string_t* str, uint8_t onlyToNextLi
         var.cW = 0;
         while (gui_string_getch(&var.s, &var.ch, &i)) { /* Get next character from string */
             gui_text_getcharsize(rect->Font, var.ch, &w, &h);   /* Get character width and height */
+            w += gui_text_getkerning(rect->Font, var.lastCh, var.ch);   /* Adjust for previous character */
+            var.lastCh = var.ch;
             if (!(rect->StringDraw->flags & GUI_FLAG_TEXT_RIGHTALIGN) && (var.cW + w) > rect->StringDraw->width) {  /* Check if end now */
                 break;
             }
@@ -287,12 +527,16 @@ string_rectangle(gui_stringrect_t* rect, gui_string_t* str, uint8_t onlyToNextLi
 
 /* Draw character to screen */
 /* X and Y coordinates are TOP LEFT coordinates for character */
-static void
+GUI_CFG_FAST_CODE static void
 draw_char(const gui_display_t* disp, const gui_font_t* font, const gui_draw_text_t* draw, gui_dim_t x, gui_dim_t y, const gui_font_char_t* c) {
-    uint8_t i, b, k, columns;
+    uint8_t i, b, k, columns, flags;
+    const uint8_t* data;
     gui_dim_t x1;
-    
-    while (!GUI.ll.IsReady(&GUI.lcd));              /* Wait till ready */
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+    const gui_layer_access_t* acc;
+    gui_dim_t xs = 0, xe = 0;                       /* Used only when memory access is available */
+    size_t ps = 0;
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
     
     y += c->y_pos;                                  /* Set Y position */
     
@@ -302,22 +546,30 @@ draw_char(const gui_display_t* disp, const gui_font_t* font, const gui_draw_text
     )) {
         return;
     }
+    GUI_LCD_STATS_GLYPH();
     
-    if (GUI.ll.CopyChar != NULL) {                  /* If copying character function exists in low-level part */
-        gui_font_charentry_t* entry = NULL;
+    if (GUI_LL_ISSET(CopyChar)) {                   /* If copying character function exists in low-level part */
+        const uint8_t* ptr = NULL;
         
-        entry = gui_text_getcharentry(font, c);     /* Get char entry from font and character for fast alpha drawing operations */
-        if (entry == NULL) {
-            entry = gui_text_createcharentry(font, c);  /* Create new entry */
+        if ((font->flags & (GUI_FLAG_FONT_A8 | GUI_FLAG_FONT_RLE)) == GUI_FLAG_FONT_A8 && font->read == NULL) {   /* Character data are already in A8 format */
+            ptr = c->data;                          /* Use data directly from font */
+        } else {
+            gui_font_charentry_t* entry = NULL;
+            
+            entry = gui_text_getcharentry(font, c); /* Get char entry from font and character for fast alpha drawing operations */
+            if (entry == NULL) {
+                entry = gui_text_createcharentry(font, c);  /* Create new entry */
+            }
+            if (entry != NULL) {
+                ptr = (const uint8_t *)entry + GUI_MEM_ALIGN(sizeof(*entry));   /* Go to start of data array */
+            }
         }
-        if (entry != NULL) {                        /* We have valid data */
+        if (ptr != NULL) {                          /* We have valid data */
             gui_dim_t width, height, offlineSrc, offlineDst, tmpx;
             uint8_t* dst = 0;
-            uint8_t* ptr = (uint8_t *)entry;        /* Get pointer */
             
             tmpx = x;                               /* Start X */
             
-            ptr += sizeof(*entry);                  /* Go to start of data array */
             dst = (uint8_t *)(((uint8_t *)GUI.lcd.drawing_layer->start_address) + ((y - GUI.lcd.drawing_layer->y_pos) * GUI.lcd.drawing_layer->width + (x - GUI.lcd.drawing_layer->x_pos)) * GUI.lcd.pixel_size);
             
             width = c->x_size;                      /* Get X size */
@@ -349,17 +601,17 @@ draw_char(const gui_display_t* disp, const gui_font_t* font, const gui_draw_text
                 gui_dim_t firstWidth = (draw->x + draw->color1width) - tmpx;
                 
                 /* First part draw */
-                GUI.ll.CopyChar(&GUI.lcd, GUI.lcd.drawing_layer, dst, ptr, 
+                GUI_LL(CopyChar)(&GUI.lcd, GUI.lcd.drawing_layer, dst, ptr, 
                     firstWidth, height,
                     offlineDst + width - firstWidth, offlineSrc + width - firstWidth, draw->color1);
                 
                 /* Second part draw */
-                GUI.ll.CopyChar(&GUI.lcd, GUI.lcd.drawing_layer, dst + firstWidth * GUI.lcd.pixel_size, ptr + firstWidth, 
+                GUI_LL(CopyChar)(&GUI.lcd, GUI.lcd.drawing_layer, dst + firstWidth * GUI.lcd.pixel_size, ptr + firstWidth, 
                     width - firstWidth, height,
                     offlineDst + firstWidth, offlineSrc + firstWidth, draw->color2);
             } else {
                 /* Draw entire character with single color */
-                GUI.ll.CopyChar(&GUI.lcd, GUI.lcd.drawing_layer, dst, ptr, 
+                GUI_LL(CopyChar)(&GUI.lcd, GUI.lcd.drawing_layer, dst, ptr, 
                     width, height,
                     offlineDst, offlineSrc, (draw->x + draw->color1width) > x ? draw->color1 : draw->color2);
             }
@@ -367,18 +619,152 @@ draw_char(const gui_display_t* disp, const gui_font_t* font, const gui_draw_text
         }
     }
     
-    if (font->flags & GUI_FLAG_FONT_AA) {           /* Font has anti alliasing enabled */
+    data = c->data;
+    flags = font->flags;
+    if (font->read != NULL || (font->flags & GUI_FLAG_FONT_RLE)) {  /* Data are on external storage or compressed, use A8 copy from cache */
+        gui_font_charentry_t* entry;
+        
+        entry = gui_text_getcharentry(font, c);
+        if (entry == NULL) {
+            entry = gui_text_createcharentry(font, c);
+        }
+        if (entry == NULL) {
+            return;
+        }
+        data = (const uint8_t *)entry + GUI_MEM_ALIGN(sizeof(*entry));
+        flags = GUI_FLAG_FONT_A8;
+    }
+    
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+    acc = (flags & (GUI_FLAG_FONT_A8 | GUI_FLAG_FONT_A4 | GUI_FLAG_FONT_AA)) ? draw_access(1) : NULL;
+    if (acc != NULL) {
+        xs = GUI_MAX(x, disp->x1);                  /* Visible part of each character row */
+        xe = GUI_MIN(x + c->x_size, disp->x2);
+        ps = acc->format == GUI_PIXEL_FORMAT_RGB565 ? 2 : 4;
+    }
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+    if (flags & GUI_FLAG_FONT_A8) {                 /* Font has 8-bit alpha data */
+        gui_color_t color, baseColor;
+        gui_dim_t yi;
+        uint8_t a;
+        
+        for (yi = 0; yi < c->y_size; yi++, y++) {
+            if (y < disp->y1 || y > disp->y2 || y >= (draw->y + draw->height)) {    /* Do not draw when we are outside clipping are */
+                continue;
+            }
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+            if (acc != NULL) {                      /* Blend row directly in memory */
+                uint8_t* p;
+                
+                if (y >= disp->y2) {
+                    continue;
+                }
+                p = guii_access_addr(acc, GUI.lcd.drawing_layer, xs, y);
+                for (x1 = xs - x; x1 < xe - x; x1++, p += ps) {
+                    draw_access_blend(acc, p, (x + x1) < (draw->x + draw->color1width) ? draw->color1 : draw->color2,
+                        data[(size_t)yi * c->x_size + x1]);
+                }
+                continue;
+            }
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+            for (x1 = 0; x1 < c->x_size; x1++) {
+                if ((x + x1) < disp->x1 || (x + x1) > disp->x2) {
+                    continue;
+                }
+                a = data[(size_t)yi * c->x_size + x1];   /* Get alpha for pixel */
+                if (!a) {
+                    continue;
+                }
+                baseColor = (x + x1) < (draw->x + draw->color1width) ? draw->color1 : draw->color2;
+                if (a == 0xFF) {                    /* Draw solid color */
+                    gui_draw_setpixel(disp, x + x1, y, baseColor);
+                } else {                            /* Blend with current color */
+                    color = gui_draw_getpixel(disp, x + x1, y);
+                    gui_draw_setpixel(disp, x + x1, y, guii_blend_color(baseColor, color, a));
+                }
+            }
+        }
+    } else if (flags & GUI_FLAG_FONT_A4) {          /* Font has 4-bit alpha data */
+        gui_color_t color, baseColor;
+        gui_dim_t yi;
+        uint8_t a;
+        
+        columns = (c->x_size + 1) >> 1;             /* Calculate number of bytes used for single character line */
+        for (yi = 0; yi < c->y_size; yi++, y++) {
+            if (y < disp->y1 || y > disp->y2 || y >= (draw->y + draw->height)) {    /* Do not draw when we are outside clipping are */
+                continue;
+            }
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+            if (acc != NULL) {                      /* Blend row directly in memory */
+                uint8_t* p;
+                
+                if (y >= disp->y2) {
+                    continue;
+                }
+                p = guii_access_addr(acc, GUI.lcd.drawing_layer, xs, y);
+                for (x1 = xs - x; x1 < xe - x; x1++, p += ps) {
+                    b = data[(size_t)yi * columns + (x1 >> 1)];
+                    draw_access_blend(acc, p, (x + x1) < (draw->x + draw->color1width) ? draw->color1 : draw->color2,
+                        (uint8_t)(((x1 & 0x01) ? (b & 0x0F) : (b >> 4)) * 0x11));
+                }
+                continue;
+            }
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+            for (x1 = 0; x1 < c->x_size; x1++) {
+                if ((x + x1) < disp->x1 || (x + x1) > disp->x2) {
+                    continue;
+                }
+                b = data[(size_t)yi * columns + (x1 >> 1)];
+                a = (uint8_t)(((x1 & 0x01) ? (b & 0x0F) : (b >> 4)) * 0x11);  /* Scale 4-bit alpha to 8-bit */
+                if (!a) {
+                    continue;
+                }
+                baseColor = (x + x1) < (draw->x + draw->color1width) ? draw->color1 : draw->color2;
+                if (a == 0xFF) {                    /* Draw solid color */
+                    gui_draw_setpixel(disp, x + x1, y, baseColor);
+                } else {                            /* Blend with current color */
+                    color = gui_draw_getpixel(disp, x + x1, y);
+                    gui_draw_setpixel(disp, x + x1, y, guii_blend_color(baseColor, color, a));
+                }
+            }
+        }
+    } else if (flags & GUI_FLAG_FONT_AA) {          /* Font has anti alliasing enabled */
         gui_color_t color;                          /* Temporary color for AA */
-        uint8_t tmp, r1, g1, b1;
+        uint8_t tmp;
         
         columns = c->x_size / 4;                    /* Calculate number of bytes used for single character line */
         if (c->x_size % 4) {                        /* If only 1 column used */
             columns++;
         }
         
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+        if (acc != NULL) {                          /* Blend rows directly in memory */
+            gui_dim_t yi;
+            uint8_t* p;
+            
+            for (yi = 0; yi < c->y_size; yi++, y++) {
+                if (y < disp->y1 || y >= disp->y2 || y >= (draw->y + draw->height)) {
+                    continue;
+                }
+                p = guii_access_addr(acc, GUI.lcd.drawing_layer, xs, y);
+                for (x1 = xs - x; x1 < xe - x; x1++, p += ps) {
+                    tmp = (data[(size_t)yi * columns + (x1 >> 2)] >> (6 - 2 * (x1 & 0x03))) & 0x03;
+                    if (!tmp) {
+                        continue;
+                    }
+                    color = (x + x1) < (draw->x + draw->color1width) ? draw->color1 : draw->color2;
+                    if (tmp != 0x03) {              /* 2-bit value is scaled to weight of current color */
+                        color = guii_blend_color(guii_access_getpixel(acc, p), color, GUI_U8(tmp * 0x55));
+                    }
+                    guii_access_setpixel(acc, p, color);
+                }
+            }
+            return;
+        }
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
         for (i = 0; i < columns * c->y_size; i++) { /* Go through all data bytes */
             if (y >= disp->y1 && y <= disp->y2 && y < (draw->y + draw->height)) {   /* Do not draw when we are outside clipping are */            
-                b = c->data[i];                     /* Get character byte */
+                b = data[i];                        /* Get character byte */
                 for (k = 0; k < 4; k++) {           /* Scan each bit in byte */
                     gui_color_t baseColor;
                     x1 = x + (i % columns) * 4 + k; /* Get new X value for pixel draw */
@@ -394,16 +780,10 @@ draw_char(const gui_display_t* disp, const gui_font_t* font, const gui_draw_text
                     if (tmp == 0x03) {              /* Draw solid color if both bits are enabled */
                         gui_draw_setpixel(disp, x1, y, baseColor);
                     } else if (tmp) {               /* Calculate new color */
-                        float t = (float)tmp / 3.0f;
                         color = gui_draw_getpixel(disp, x1, y); /* Read current color */
                         
-                        /* Calculate new values for pixel */
-                        r1 = GUI_U8((float)t * (float)((color >> 16) & 0xFF) + (float)(1.0f - (float)t) * (float)((baseColor >> 16) & 0xFF));
-                        g1 = GUI_U8((float)t * (float)((color >>  8) & 0xFF) + (float)(1.0f - (float)t) * (float)((baseColor >>  8) & 0xFF));
-                        b1 = GUI_U8((float)t * (float)((color >>  0) & 0xFF) + (float)(1.0f - (float)t) * (float)((baseColor >>  0) & 0xFF));
-                        
-                        /* Draw actual pixel to screen */
-                        gui_draw_setpixel(disp, x1, y, (color & 0xFF000000UL) | r1 << 16 | g1 << 8 | b1);
+                        /* Draw blended pixel to screen, 2-bit value is scaled to 8-bit weight */
+                        gui_draw_setpixel(disp, x1, y, guii_blend_color(color, baseColor, GUI_U8(tmp * 0x55)));
                     }
                 }
             }
@@ -418,7 +798,7 @@ draw_char(const gui_display_t* disp, const gui_font_t* font, const gui_draw_text
         }
         for (i = 0; i < columns * c->y_size; i++) { /* Go through all data bytes */
             if (y >= disp->y1 && y <= disp->y2 && y < (draw->y + draw->height)) {   /* Do not draw when we are outside clipping are */
-                b = c->data[i];                     /* Get character byte */
+                b = data[i];                        /* Get character byte */
                 for (k = 0; k < 8; k++) {           /* Scan each bit in byte */
                     if (b & (1 << (7 - k))) {       /* If bit is set, draw pixel */
                         x1 = x + (i % columns) * 8 + k; /* Get new X value for pixel draw */
@@ -445,7 +825,7 @@ static const gui_char *
 string_get_pointer_for_width(const gui_font_t* font, gui_string_t* str, gui_draw_text_t* draw) {
     gui_dim_t tot = 0, w, h;
     uint8_t i;
-    uint32_t ch;
+    uint32_t ch, next = 0;
     const gui_char* tmp = str->str;                 /* Set start of string */
     
     gui_string_gotoend(str);                        /* Go to the end of string */
@@ -455,6 +835,8 @@ string_get_pointer_for_width(const gui_font_t* font, gui_string_t* str, gui_draw
             break;
         }
         gui_text_getcharsize(font, ch, &w, &h);
+        w += gui_text_getkerning(font, ch, next);   /* Adjust for next character */
+        next = ch;
         if ((tot + w) < draw->width) {
             tot += w;
         } else {
@@ -465,8 +847,34 @@ string_get_pointer_for_width(const gui_font_t* font, gui_string_t* str, gui_draw
     return str->str + i + 1;
 }
 
+#if GUI_CFG_USE_LL_GPU
+
+/**
+ * \brief           Get clipping region in drawing layer coordinates for vector GPU functions
+ * \param[in]       disp: Clipping region in screen coordinates
+ * \param[out]      clip: Clipping region relative to drawing layer
+ * \return          `1` when shape may be drawn by GPU, `0` otherwise
+ */
+static uint8_t
+gpu_clip(const gui_display_t* disp, gui_display_t* clip) {
+    const gui_layer_t* layer = GUI.lcd.drawing_layer;
+    
+#if GUI_CFG_USE_COVERAGE_MASK
+    if (GUI.coverage.active) {
+        return 0;                                   /* Covered tiles are skipped by software only */
+    }
+#endif /* GUI_CFG_USE_COVERAGE_MASK */
+    clip->x1 = GUI_MAX(disp->x1, layer->x_pos) - layer->x_pos;
+    clip->y1 = GUI_MAX(disp->y1, layer->y_pos) - layer->y_pos;
+    clip->x2 = GUI_MIN(disp->x2, layer->x_pos + layer->width) - layer->x_pos;
+    clip->y2 = GUI_MIN(disp->y2, layer->y_pos + layer->height) - layer->y_pos;
+    return clip->x1 < clip->x2 && clip->y1 < clip->y2;
+}
+
+#endif /* GUI_CFG_USE_LL_GPU */
+
 /* Fill screen with color on specific coordinates */
-static void
+GUI_CFG_FAST_CODE static void
 gui_draw_fill(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color) {
     if (                                            /* Check if redraw is inside area */
         !GUI_RECT_MATCH(x, y, x + width, y + height,
@@ -496,7 +904,13 @@ gui_draw_fill(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t wid
         height = disp->y2 - y;
     }
     if (width > 0 && height > 0) {
-        GUI.ll.FillRect(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos, width, height, color);
+#if GUI_CFG_USE_COVERAGE_MASK
+        if (GUI.coverage.active) {
+            fill_uncovered(x, y, width, height, color);
+            return;
+        }
+#endif /* GUI_CFG_USE_COVERAGE_MASK */
+        GUI_LL(FillRect)(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos, width, height, color);
     }
 }
 
@@ -516,7 +930,9 @@ gui_draw_text_init(gui_draw_text_t* f) {
  */
 void
 gui_draw_fillscreen(const gui_display_t* disp, gui_color_t color) {
-    GUI.ll.Fill(&GUI.lcd, GUI.lcd.drawing_layer, 0, GUI.lcd.drawing_layer->width, GUI.lcd.drawing_layer->height, 0, color);
+    DRAW_LIST_RECORD(DRAW_LIST_FILLSCREEN, 0, 0, 0, 0, 0, 0, 0, color, NULL, NULL, 0, gui_draw_fillscreen(disp, color));
+    
+    GUI_LL(Fill)(&GUI.lcd, GUI.lcd.drawing_layer, 0, GUI.lcd.drawing_layer->width, GUI.lcd.drawing_layer->height, 0, color);
 }
 
 /**
@@ -529,10 +945,22 @@ gui_draw_fillscreen(const gui_display_t* disp, gui_color_t color) {
  */
 void
 gui_draw_setpixel(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_color_t color) {
+    DRAW_LIST_RECORD(DRAW_LIST_SETPIXEL, 0, x, y, 0, 0, 0, 0, color, NULL, NULL, 0, gui_draw_setpixel(disp, x, y, color));
+    
     if (y < disp->y1 || y >= disp->y2 || x < disp->x1 || x >= disp->x2) {
         return;
     }
-    GUI.ll.SetPixel(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos, color);
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+    {
+        const gui_layer_access_t* acc = guii_lcd_getaccess(GUI.lcd.drawing_layer, 0);
+        
+        if (acc != NULL) {                          /* Single pixel is written directly when no fence is needed */
+            guii_access_setpixel(acc, guii_access_addr(acc, GUI.lcd.drawing_layer, x, y), color);
+            return;
+        }
+    }
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+    GUI_LL(SetPixel)(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos, color);
 }
 
 /**
@@ -545,7 +973,21 @@ gui_draw_setpixel(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_color
  */
 gui_color_t
 gui_draw_getpixel(const gui_display_t* disp, gui_dim_t x, gui_dim_t y) {
-    return GUI.ll.GetPixel(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos);
+#if GUI_CFG_USE_DISPLAY_LIST
+    if (draw_list_rec != NULL) {
+        draw_list_rec->failed = 1;                  /* Drawing depends on content below, it cannot be replayed */
+    }
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+    {
+        const gui_layer_access_t* acc = guii_lcd_getaccess(GUI.lcd.drawing_layer, 0);
+        
+        if (acc != NULL) {
+            return guii_access_getpixel(acc, guii_access_addr(acc, GUI.lcd.drawing_layer, x, y));
+        }
+    }
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+    return GUI_LL(GetPixel)(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos);
 }
 
 /**
@@ -557,8 +999,10 @@ gui_draw_getpixel(const gui_display_t* disp, gui_dim_t x, gui_dim_t y) {
  * \param[in]       color: Color used for drawing operation 
  * \sa              gui_draw_hline, gui_draw_line
  */
-void
+GUI_CFG_FAST_CODE void
 gui_draw_vline(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    DRAW_LIST_RECORD(DRAW_LIST_VLINE, 0, x, y, length, 0, 0, 0, color, NULL, NULL, 0, gui_draw_vline(disp, x, y, length, color));
+    
     if (x >= disp->x2 || x < disp->x1 || y > disp->y2 || (y + length) < disp->y1) {
         return;
     }
@@ -569,7 +1013,7 @@ gui_draw_vline(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t le
     if ((y + length) > disp->y2) {
         length = disp->y2 - y;
     }
-    GUI.ll.DrawVLine(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos, length, color);
+    GUI_LL(DrawVLine)(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos, length, color);
 }
 
 /**
@@ -581,8 +1025,10 @@ gui_draw_vline(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t le
  * \param[in]       color: Color used for drawing operation
  * \sa              gui_draw_vline, gui_draw_line
  */
-void
+GUI_CFG_FAST_CODE void
 gui_draw_hline(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    DRAW_LIST_RECORD(DRAW_LIST_HLINE, 0, x, y, length, 0, 0, 0, color, NULL, NULL, 0, gui_draw_hline(disp, x, y, length, color));
+    
     if (y >= disp->y2 || y < disp->y1 || x > disp->x2 || (x + length) < disp->x1) {
         return;
     }
@@ -593,584 +1039,3665 @@ gui_draw_hline(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t le
     if ((x + length) > disp->x2) {
         length = disp->x2 - x;
     }
-    GUI.ll.DrawHLine(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos, length, color);
+    GUI_LL(DrawHLine)(&GUI.lcd, GUI.lcd.drawing_layer, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos, length, color);
 }
 
-/******************************************************************************/
-/******************************************************************************/
-/***                          Functions for primitives                       **/
-/******************************************************************************/
-/******************************************************************************/
+#if GUI_CFG_USE_GRADIENT || __DOXYGEN__
+
+#define GRADIENT_CHUNK                  32          /*!< Number of pixels computed at once when ramp is not available */
 
 /**
- * \brief           Draw line from point 1 to point 2
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x1: Line start X position
- * \param[in]       y1: Line start Y position
- * \param[in]       x2: Line end X position
- * \param[in]       y2: Line end Y position
- * \param[in]       color: Color used for drawing operation
- * \sa              gui_draw_vline, gui_draw_hline
+ * \brief           Gradient filled shape being drawn
  */
-void
-gui_draw_line(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_color_t color) {
-    gui_dim_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
-    yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
-    curpixel = 0;
-    
-    /* Check if coordinates are inside drawing region */
-//    if (                                            /* Check if redraw is inside area */
-//        !GUI_RECT_MATCH(  x1, y1, x2, y2,
-//                            disp->x1, disp->y1, disp->x2, disp->y2)) {
-//        return;
-//    }
+typedef struct {
+    const gui_gradient_t* grad;                     /*!< Gradient colors and direction */
+    gui_dim_t x;                                    /*!< Left position of gradient box on screen */
+    gui_dim_t y;                                    /*!< Top position of gradient box on screen */
+    gui_dim_t width;                                /*!< Gradient box width */
+    gui_dim_t height;                               /*!< Gradient box height */
+    gui_dim_t length;                               /*!< Number of colors between start and stop color */
+    const uint8_t* ramp;                            /*!< Colors in layer pixel format, `NULL` when computed for each pixel */
+} gui_gradient_ctx_t;
 
-	deltax = GUI_ABS(x2 - x1);
-	deltay = GUI_ABS(y2 - y1);
-    
-    if (deltax == 0) {                              /* Straight vertical line */
-        gui_draw_vline(disp, x1, GUI_MIN(y1, y2), deltay, color);
-        return;
-    }
-    if (deltay == 0) {                              /* Straight horizontal line */
-        gui_draw_hline(disp, GUI_MIN(x1, x2), y1, deltax, color);
-        return;
-    }
+#if GUI_CFG_GRADIENT_CACHE_COUNT || __DOXYGEN__
 
-    x = x1;
-    y = y1;
+/**
+ * \brief           Cached gradient color ramp
+ */
+typedef struct {
+    gui_color_t start;                              /*!< Start color */
+    gui_color_t stop;                               /*!< Stop color */
+    gui_dim_t length;                               /*!< Number of colors */
+    uint8_t pixel_format;                           /*!< Layer pixel format of colors */
+    uint32_t used;                                  /*!< Stamp of last use, least recently used ramp is replaced */
+    uint8_t* ramp;                                  /*!< Colors, `NULL` when entry is free */
+} gui_gradient_ramp_t;
 
-    if (x2 >= x1) {
-        xinc1 = 1;
-        xinc2 = 1;
-    } else {
-        xinc1 = -1;
-        xinc2 = -1;
-    }
+static gui_gradient_ramp_t gradient_ramps[GUI_CFG_GRADIENT_CACHE_COUNT];
+static uint32_t gradient_stamp;
 
-    if (y2 >= y1) {
-        yinc1 = 1;
-        yinc2 = 1;
-    } else {
-        yinc1 = -1;
-        yinc2 = -1;
-    }
+#endif /* GUI_CFG_GRADIENT_CACHE_COUNT || __DOXYGEN__ */
 
-    if (deltax >= deltay) {
-        xinc1 = 0;
-        yinc2 = 0;
-        den = deltax;
-        num = deltax / 2;
-        numadd = deltay;
-        numpixels = deltax;
-    } else {
-        xinc2 = 0;
-        yinc1 = 0;
-        den = deltay;
-        num = deltay / 2;
-        numadd = deltax;
-        numpixels = deltay;
-    }
+/**
+ * \brief           Scratch buffer for pixels computed without ramp
+ */
+static struct {
+    uint8_t pending;                                /*!< Set to `1` when low-level may still read buffer */
+    uint32_t buf[GRADIENT_CHUNK];                   /*!< Pixels in layer pixel format */
+} gradient_scratch;
 
-    for (curpixel = 0; curpixel <= numpixels; curpixel++) {
-        gui_draw_setpixel(disp, x, y, color);
-        num += numadd;
-        if (num >= den) {
-            num -= den;
-            x += xinc1;
-            y += yinc1;
-        }
-        x += xinc2;
-        y += yinc2;
-    }
+/**
+ * \brief           Get gradient color at specific position
+ * \param[in]       grad: Gradient colors
+ * \param[in]       i: Position between `0` and `n - 1`
+ * \param[in]       n: Number of positions
+ * \return          Opaque color
+ */
+static gui_color_t
+gradient_color(const gui_gradient_t* grad, gui_dim_t i, gui_dim_t n) {
+    uint8_t a = n > 1 ? GUI_U8((uint32_t)i * 0xFF / (uint32_t)(n - 1)) : 0;
+    return 0xFF000000UL | guii_blend_color(grad->stop, grad->start, a);
 }
 
 /**
- * \brief           Draw rectangle extended function
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       rect: Rectangle data
+ * \brief           Write color in pixel format of drawing layer
+ * \param[out]      dst: Pixel array
+ * \param[in]       i: Pixel index
+ * \param[in]       color: Color to write
  */
-void
-gui_draw_rectangle_ex(const gui_display_t* disp, gui_draw_rect_ex_t* rect) {
-
+static void
+gradient_setpixel(void* dst, size_t i, gui_color_t color) {
+    if (GUI.lcd.drawing_layer->pixel_format == GUI_PIXEL_FORMAT_RGB565) {
+        ((uint16_t *)dst)[i] = GUI_COLOR_TO_RGB565(color);
+    } else {
+        ((uint32_t *)dst)[i] = color;
+    }
 }
 
 /**
- * \brief           Draw rectangle
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x: Top left X position
- * \param[in]       y: Top left Y position
- * \param[in]       width: Rectangle width
- * \param[in]       height: Rectangle height
- * \param[in]       color: Color used for drawing operation
- * \sa              gui_draw_filledrectangle, gui_draw_roundedrectangle, gui_draw_filledroundedrectangle
+ * \brief           Get color ramp of gradient in pixel format of drawing layer
+ *
+ *                  Ramp is kept in cache and reused by later draws with the same colors and length
+ *
+ * \param[in]       grad: Gradient colors
+ * \param[in]       length: Number of colors
+ * \return          Pointer to ramp on success, `NULL` when it cannot be allocated
  */
-void
-gui_draw_rectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color) {
-    if (width == 0 || height == 0) {
-        return;
-    }
-    gui_draw_hline(disp, x,             y,              width,  color);
-    gui_draw_vline(disp, x,             y,              height, color);
+static const uint8_t *
+gradient_getramp(const gui_gradient_t* grad, gui_dim_t length) {
+#if GUI_CFG_GRADIENT_CACHE_COUNT
+    gui_gradient_ramp_t* e = NULL;
+    uint8_t fmt = (uint8_t)GUI.lcd.drawing_layer->pixel_format;
+    size_t i;
     
-    gui_draw_hline(disp, x,             y + height - 1, width,  color);
-    gui_draw_vline(disp, x + width - 1, y,              height, color);
-}
-
-/**
- * \brief           Draw filled rectangle
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x: Top left X position
- * \param[in]       y: Top left Y position
- * \param[in]       width: Rectangle width
- * \param[in]       height: Rectangle height
- * \param[in]       color: Color used for drawing operation
- * \sa              gui_draw_rectangle, gui_draw_roundedrectangle, gui_draw_filledroundedrectangle
- */
-void
-gui_draw_filledrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color) {
-    gui_draw_fill(disp, x, y, width, height, color);
+    for (i = 0; i < GUI_COUNT_OF(gradient_ramps); i++) {
+        gui_gradient_ramp_t* r = &gradient_ramps[i];
+        if (r->ramp != NULL && r->start == grad->start && r->stop == grad->stop
+            && r->length == length && r->pixel_format == fmt) {
+            r->used = ++gradient_stamp;
+            return r->ramp;
+        }
+        if (e == NULL || (e->ramp != NULL && (r->ramp == NULL || r->used < e->used))) {
+            e = r;                                  /* Free or least recently used entry */
+        }
+    }
+    if (e->ramp != NULL) {
+        gui_lcd_fence();                            /* Hardware may still copy from ramp */
+        GUI_MEMFREE(e->ramp);
+    }
+    e->ramp = GUI_MEMALLOC_CLASS((size_t)length * GUI.lcd.pixel_size, GUI_MEM_CLASS_PIXEL);
+    if (e->ramp == NULL) {
+        return NULL;
+    }
+    for (i = 0; i < (size_t)length; i++) {
+        gradient_setpixel(e->ramp, i, gradient_color(grad, (gui_dim_t)i, length));
+    }
+    e->start = grad->start;
+    e->stop = grad->stop;
+    e->length = length;
+    e->pixel_format = fmt;
+    e->used = ++gradient_stamp;
+    return e->ramp;
+#else /* GUI_CFG_GRADIENT_CACHE_COUNT */
+    GUI_UNUSED2(grad, length);
+    return NULL;
+#endif /* !GUI_CFG_GRADIENT_CACHE_COUNT */
 }
 
 /**
- * \brief           Draw rectangle with 3D view
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x: Top left X position
- * \param[in]       y: Top left Y position
- * \param[in]       width: Rectangle width
- * \param[in]       height: Rectangle height
- * \param[in]       state: 3D state. This parameter can be a value of \ref gui_draw_3d_state_t enumeration
+ * \brief           Prepare gradient for drawing to box
+ * \param[out]      g: Gradient drawing context
+ * \param[in]       grad: Gradient colors and direction
+ * \param[in]       x: Box left position on screen
+ * \param[in]       y: Box top position on screen
+ * \param[in]       width: Box width
+ * \param[in]       height: Box height
  */
-void
-gui_draw_rectangle3d(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_draw_3d_state_t state) {
-    gui_color_t c1, c2, c3;
+static void
+gradient_begin(gui_gradient_ctx_t* g, const gui_gradient_t* grad, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height) {
+    uint32_t d;
     
-    c1 = GUI_COLOR_BLACK;
-    if (state == GUI_DRAW_3D_State_Raised) {
-        c2 = 0xFFAAAAAA;
-        c3 = 0xFF555555;
+    g->grad = grad;
+    g->x = x;
+    g->y = y;
+    g->width = width;
+    g->height = height;
+    g->ramp = NULL;
+    if (grad->type == GUI_GRADIENT_VERTICAL) {
+        g->length = height;                         /* Single color per row needs no ramp */
+    } else if (grad->type == GUI_GRADIENT_RADIAL) {
+        gui_math_isqrt((uint32_t)width * width + (uint32_t)height * height, &d);
+        g->length = (gui_dim_t)(d / 2 + 1);         /* Distance from center to corners */
+        g->ramp = gradient_getramp(grad, g->length);
     } else {
-        c2 = 0xFF555555;
-        c3 = 0xFFAAAAAA;
+        g->length = width;
+        g->ramp = gradient_getramp(grad, g->length);
     }
-    
-    gui_draw_rectangle(disp, x, y, width, height, c1);
-    
-    gui_draw_hline(disp, x + 1, y + 1, width - 2, c2);
-    gui_draw_vline(disp, x + 1, y + 1, height - 3, c2);
-    
-    gui_draw_hline(disp, x + 1, y + height - 2, width - 2, c3);
-    gui_draw_vline(disp, x + width - 2, y + 2, height - 4, c3);
 }
 
 /**
- * \brief           Draw rectangle with rounded corners
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x: Top left X position
- * \param[in]       y: Top left Y position
- * \param[in]       width: Rectangle width
- * \param[in]       height: Rectangle height
- * \param[in]       r: Corner radius, max value can be r = MIN(width, height) / 2
- * \param[in]       color: Color used for drawing operation
- * \sa              gui_draw_rectangle, gui_draw_filledrectangle, gui_draw_filledroundedrectangle
+ * \brief           Draw single row of gradient
+ * \param[in]       g: Gradient drawing context
+ * \param[in]       x: Span start X position on screen, already clipped
+ * \param[in]       y: Span Y position on screen, already clipped
+ * \param[in]       length: Span length
  */
-void
-gui_draw_roundedrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t r, gui_color_t color) {
-    if (r >= (height / 2)) {
-        r = height / 2 - 1;
+GUI_CFG_FAST_CODE static void
+gradient_span(const gui_gradient_ctx_t* g, gui_dim_t x, gui_dim_t y, gui_dim_t length) {
+    gui_layer_t* layer = GUI.lcd.drawing_layer;
+    uint8_t* dst = ((uint8_t *)layer->start_address) + GUI.lcd.pixel_size * ((size_t)(y - layer->y_pos) * layer->width + (x - layer->x_pos));
+    int32_t dx, dy = 2 * (y - g->y) + 1 - g->height;  /* Distance from center in units of half pixel */
+    uint32_t d2, s = 0;
+    gui_dim_t i, n;
+    
+    if (g->grad->type == GUI_GRADIENT_VERTICAL) {
+        GUI_LL(DrawHLine)(&GUI.lcd, layer, x - layer->x_pos, y - layer->y_pos, length, gradient_color(g->grad, y - g->y, g->length));
+        return;
     }
-    if (r >= (width / 2)) {
-        r = width / 2 - 1;
+    if (g->grad->type == GUI_GRADIENT_HORIZONTAL && g->ramp != NULL) {
+        GUI_LL(Copy)(&GUI.lcd, layer, dst, g->ramp + (size_t)(x - g->x) * GUI.lcd.pixel_size, length, 1, 0, 0);
+        return;
     }
-    if (r) {
-        gui_draw_hline(disp, x + r,         y,              width - 2 * r,  color);
-        gui_draw_vline(disp, x + width - 1, y + r,          height - 2 * r, color);
-        gui_draw_hline(disp, x + r,         y + height - 1, width - 2 * r,  color);
-        gui_draw_vline(disp, x,             y + r,          height - 2 * r, color);
-        
-        gui_draw_circlecorner(disp, x + r,             y + r,              r, GUI_DRAW_CIRCLE_TL, color);
-        gui_draw_circlecorner(disp, x + width - r - 1, y + r,              r, GUI_DRAW_CIRCLE_TR, color);
-        gui_draw_circlecorner(disp, x + r,             y + height - r - 1, r, GUI_DRAW_CIRCLE_BL, color);
-        gui_draw_circlecorner(disp, x + width - r - 1, y + height - r - 1, r, GUI_DRAW_CIRCLE_BR, color);
-    } else {
-        gui_draw_rectangle(disp, x, y, width, height, color);
+    
+    /* Compute pixels to scratch buffer in chunks */
+    if (g->grad->type == GUI_GRADIENT_RADIAL) {
+        dx = 2 * (x - g->x) + 1 - g->width;
+        gui_math_isqrt((uint32_t)(dx * dx + dy * dy), &s);
+    }
+    for (; length > 0; length -= n, x += n, dst += (size_t)n * GUI.lcd.pixel_size) {
+        n = GUI_MIN(length, GRADIENT_CHUNK);
+        if (gradient_scratch.pending) {
+            gui_lcd_fence();
+            gradient_scratch.pending = 0;
+        }
+        for (i = 0; i < n; i++) {
+            gui_dim_t pos = x + i - g->x;
+            if (g->grad->type == GUI_GRADIENT_RADIAL) {
+                dx = 2 * pos + 1 - g->width;
+                d2 = (uint32_t)(dx * dx + dy * dy);
+                while (s * s > d2) {                /* Distance changes slowly between neighbours */
+                    s--;
+                }
+                while ((s + 1) * (s + 1) <= d2) {
+                    s++;
+                }
+                pos = (gui_dim_t)(s / 2);
+            }
+            if (g->ramp != NULL) {
+                memcpy(((uint8_t *)gradient_scratch.buf) + (size_t)i * GUI.lcd.pixel_size, g->ramp + (size_t)pos * GUI.lcd.pixel_size, GUI.lcd.pixel_size);
+            } else {
+                gradient_setpixel(gradient_scratch.buf, (size_t)i, gradient_color(g->grad, pos, g->length));
+            }
+        }
+        GUI_LL(Copy)(&GUI.lcd, layer, dst, gradient_scratch.buf, n, 1, 0, 0);
+        gradient_scratch.pending = 1;               /* Hardware may read buffer in background */
     }
 }
 
 /**
- * \brief           Draw filled rectangle with rounded corners
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \brief           Draw gradient to clipped rectangle
+ * \param[in]       disp: Clipping region
+ * \param[in]       g: Gradient drawing context
  * \param[in]       x: Top left X position
  * \param[in]       y: Top left Y position
  * \param[in]       width: Rectangle width
  * \param[in]       height: Rectangle height
- * \param[in]       r: Corner radius, max value can be r = MIN(width, height) / 2
- * \param[in]       color: Color used for drawing operation
- * \sa              gui_draw_rectangle, gui_draw_filledrectangle, gui_draw_roundedrectangle
  */
-void
-gui_draw_filledroundedrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t r, gui_color_t color) {
-    if (r >= (height / 2)) {
-        r = height / 2 - 1;
-    }
-    if (r >= (width / 2)) {
-        r = width / 2 - 1;
-    }
-    if (r) {
-        if ((gui_dim_t)(width - 2 * r) > 0) {
-            gui_draw_filledrectangle(disp, x + r,         y,     width - 2 * r, height,         color);
-        }
-        if ((gui_dim_t)(height - 2 * r) > 0) {
-            gui_draw_filledrectangle(disp, x,             y + r, r,             height - 2 * r, color);
-            gui_draw_filledrectangle(disp, x + width - r, y + r, r,             height - 2 * r, color);
-        }
-        
-        gui_draw_filledcirclecorner(disp, x + r,             y + r,              r, GUI_DRAW_CIRCLE_TL, color);
-        gui_draw_filledcirclecorner(disp, x + width - r - 1, y + r,              r, GUI_DRAW_CIRCLE_TR, color);
-        gui_draw_filledcirclecorner(disp, x + r,             y + height - r - 1, r, GUI_DRAW_CIRCLE_BL, color);
-        gui_draw_filledcirclecorner(disp, x + width - r - 1, y + height - r - 1, r, GUI_DRAW_CIRCLE_BR, color);
-    } else {
-        gui_draw_filledrectangle(disp, x, y, width, height, color);
+static void
+gradient_fill(const gui_display_t* disp, const gui_gradient_ctx_t* g, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height) {
+    gui_dim_t x2 = GUI_MIN(x + width, disp->x2), y2 = GUI_MIN(y + height, disp->y2);
+    
+    x = GUI_MAX(x, disp->x1);
+    for (y = GUI_MAX(y, disp->y1); x < x2 && y < y2; y++) {
+        gradient_span(g, x, y, x2 - x);
     }
 }
 
+#endif /* GUI_CFG_USE_GRADIENT || __DOXYGEN__ */
+
 /**
- * \brief           Draw circle
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x: X position of circle center
- * \param[in]       y: X position of circle center
- * \param[in]       r: Circle radius
- * \param[in]       color: Color used for drawing operation 
- * \sa              gui_draw_filledcircle, gui_draw_circlecorner, gui_draw_filledcirclecorner
+ * \brief           Batch of clipped horizontal spans for filled shape drawing
  */
-void
-gui_draw_circle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t r, gui_color_t color) {
-    gui_draw_circlecorner(disp, x, y, r, GUI_DRAW_CIRCLE_TL, color);
-    gui_draw_circlecorner(disp, x - 1, y, r, GUI_DRAW_CIRCLE_TR, color);
-    gui_draw_circlecorner(disp, x, y - 1, r, GUI_DRAW_CIRCLE_BL, color);
-    gui_draw_circlecorner(disp, x - 1, y - 1, r, GUI_DRAW_CIRCLE_BR, color);
-}
+typedef struct {
+    const gui_display_t* disp;                      /*!< Clipping region */
+    gui_color_t color;                              /*!< Fill color for all spans */
+#if GUI_CFG_USE_GRADIENT || __DOXYGEN__
+    const gui_gradient_ctx_t* grad;                 /*!< Gradient drawn directly instead of buffered spans, `NULL` for plain color */
+#endif /* GUI_CFG_USE_GRADIENT || __DOXYGEN__ */
+    size_t count;                                   /*!< Number of spans in buffer */
+    gui_span_t spans[GUI_CFG_DRAW_SPAN_COUNT];      /*!< Spans waiting to be sent to low-level */
+} gui_span_batch_t;
 
 /**
- * \brief           Draw filled circle
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x: X position of circle center
- * \param[in]       y: X position of circle center
- * \param[in]       r: Circle radius
- * \param[in]       color: Color used for drawing operation 
- * \sa              gui_draw_circle, gui_draw_circlecorner, gui_draw_filledcirclecorner
+ * \brief           Send all buffered spans to low-level layer
+ * \param[in,out]   b: Span batch
  */
-void
-gui_draw_filledcircle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t r, gui_color_t color) {
-    gui_draw_filledcirclecorner(disp, x, y, r, GUI_DRAW_CIRCLE_TL, color);
-    gui_draw_filledcirclecorner(disp, x, y, r, GUI_DRAW_CIRCLE_TR, color);
-    gui_draw_filledcirclecorner(disp, x, y - 1, r, GUI_DRAW_CIRCLE_BL, color);
-    gui_draw_filledcirclecorner(disp, x, y - 1, r, GUI_DRAW_CIRCLE_BR, color);
+GUI_CFG_FAST_CODE static void
+span_flush(gui_span_batch_t* b) {
+    if (!b->count) {
+        return;
+    }
+    if (GUI_LL_ISSET(FillSpans)) {                  /* Low-level executes whole list at once */
+        GUI_LL(FillSpans)(&GUI.lcd, GUI.lcd.drawing_layer, b->spans, b->count, b->color);
+    } else {
+        size_t i;
+        for (i = 0; i < b->count; i++) {
+            GUI_LL(DrawHLine)(&GUI.lcd, GUI.lcd.drawing_layer, b->spans[i].x, b->spans[i].y, b->spans[i].length, b->color);
+        }
+    }
+    b->count = 0;
 }
 
 /**
- * \brief           Draw triangle
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x1: Triangle point 1 X position
- * \param[in]       y1: Triangle point 1 Y position
- * \param[in]       x2: Triangle point 2 X position
- * \param[in]       y2: Triangle point 2 Y position
- * \param[in]       x3: Triangle point 3 X position
- * \param[in]       y3: Triangle point 3 Y position
- * \param[in]       color: Color used for drawing operation 
- * \sa              gui_draw_filledtriangle
+ * \brief           Initialize span batch for new shape
+ * \param[out]      b: Span batch
+ * \param[in]       disp: Clipping region
+ * \param[in]       color: Fill color
  */
-void
-gui_draw_triangle(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1,  gui_dim_t x2, gui_dim_t y2, gui_dim_t x3, gui_dim_t y3, gui_color_t color) {
-    gui_draw_line(disp, x1, y1, x2, y2, color);
-    gui_draw_line(disp, x1, y1, x3, y3, color);
-    gui_draw_line(disp, x2, y2, x3, y3, color);
+static void
+span_begin(gui_span_batch_t* b, const gui_display_t* disp, gui_color_t color) {
+    b->disp = disp;
+    b->color = color;
+#if GUI_CFG_USE_GRADIENT
+    b->grad = NULL;
+#endif /* GUI_CFG_USE_GRADIENT */
+    b->count = 0;
 }
 
 /**
- * \brief           Draw filled triangle
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x1: Triangle point 1 X position
- * \param[in]       y1: Triangle point 1 Y position
- * \param[in]       x2: Triangle point 2 X position
- * \param[in]       y2: Triangle point 2 Y position
- * \param[in]       x3: Triangle point 3 X position
- * \param[in]       y3: Triangle point 3 Y position
- * \param[in]       color: Color used for drawing operation 
- * \sa              gui_draw_triangle
+ * \brief           Clip horizontal span and add it to batch
+ * \param[in,out]   b: Span batch
+ * \param[in]       x: Span start X position on screen
+ * \param[in]       y: Span Y position on screen
+ * \param[in]       length: Span length
  */
-void
-gui_draw_filledtriangle(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_dim_t x3, gui_dim_t y3, gui_color_t color) {
-    gui_dim_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
-    yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
-    curpixel = 0;
-
-    deltax = GUI_ABS(x2 - x1);
-    deltay = GUI_ABS(y2 - y1);
-    x = x1;
-    y = y1;
-
-    if (x2 >= x1) {
-        xinc1 = 1;
-        xinc2 = 1;
-    } else {
-        xinc1 = -1;
-        xinc2 = -1;
+GUI_CFG_FAST_CODE static void
+span_add(gui_span_batch_t* b, gui_dim_t x, gui_dim_t y, gui_dim_t length) {
+    gui_span_t* span;
+    
+    if (y < b->disp->y1 || y >= b->disp->y2) {
+        return;
     }
-
-    if (y2 >= y1) {
-        yinc1 = 1;
-        yinc2 = 1;
-    } else {
-        yinc1 = -1;
-        yinc2 = -1;
+    if (x < b->disp->x1) {
+        length -= b->disp->x1 - x;
+        x = b->disp->x1;
     }
-
-    if (deltax >= deltay){
-        xinc1 = 0;
-        yinc2 = 0;
-        den = deltax;
-        num = deltax / 2;
-        numadd = deltay;
-        numpixels = deltax;
-    } else {
-        xinc2 = 0;
-        yinc1 = 0;
-        den = deltay;
-        num = deltay / 2;
-        numadd = deltax;
-        numpixels = deltay;
+    if ((x + length) > b->disp->x2) {
+        length = b->disp->x2 - x;
     }
+    if (length <= 0) {
+        return;
+    }
+#if GUI_CFG_USE_GRADIENT
+    if (b->grad != NULL) {
+        gradient_span(b->grad, x, y, length);
+        return;
+    }
+#endif /* GUI_CFG_USE_GRADIENT */
+    if (b->count == GUI_COUNT_OF(b->spans)) {
+        span_flush(b);
+    }
+    span = &b->spans[b->count++];
+    span->x = x - GUI.lcd.drawing_layer->x_pos;
+    span->y = y - GUI.lcd.drawing_layer->y_pos;
+    span->length = length;
+}
 
-    for (curpixel = 0; curpixel <= numpixels; curpixel++) {
-        gui_draw_line(disp, x, y, x3, y3, color);
-
-        num += numadd;
-        if (num >= den) {
-            num -= den;
-            x += xinc1;
-            y += yinc1;
-        }
-        x += xinc2;
-        y += yinc2;
+/**
+ * \brief           Add span for single row of circle arc pair
+ *
+ *                  Span covers `[xl - dx, xr + dx)` when both corners are selected,
+ *                  otherwise only selected side is added. Span always covers `[xl, xm)`.
+ *
+ * \param[in,out]   b: Span batch
+ * \param[in]       xl: Origin X of left corner
+ * \param[in]       xr: Origin X of right corner
+ * \param[in]       xm: End X of middle part between corners, set to `xl` when there is none
+ * \param[in]       y: Row Y position
+ * \param[in]       dx: Arc half width on this row
+ * \param[in]       left: Set to `1` when left corner is selected
+ * \param[in]       right: Set to `1` when right corner is selected
+ */
+static void
+span_arc_row(gui_span_batch_t* b, gui_dim_t xl, gui_dim_t xr, gui_dim_t xm, gui_dim_t y, gui_dim_t dx, uint8_t left, uint8_t right) {
+    gui_dim_t s = left ? xl - dx : xl;
+    gui_dim_t e = right ? xr + dx : xr;
+    if (e < xm) {
+        e = xm;
+    }
+    if (e > s) {
+        span_add(b, s, y, e - s);
     }
 }
 
 /**
- * \brief           Draw circle corner, selected with parameter
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x0: X position of corner origin
- * \param[in]       y0: Y position of corner origin
- * \param[in]       r: Circle radius
- * \param[in]       c: List of corners to draw. Use BITWISE OR with these values to specify corner:
- *                     - \ref GUI_DRAW_CIRCLE_TL
- *                     - \ref GUI_DRAW_CIRCLE_TR
- *                     - \ref GUI_DRAW_CIRCLE_BL
- *                     - \ref GUI_DRAW_CIRCLE_BR
- * \param[in]       color: Color used for drawing operation 
- * \sa              gui_draw_circle, gui_draw_filledcircle, gui_draw_filledcirclecorner
+ * \brief           Rasterize filled circle arcs to span batch
+ *
+ *                  Each row is emitted once, left and right arcs on the same row are merged
+ *
+ * \param[in,out]   b: Span batch
+ * \param[in]       xl: Origin X of left corners
+ * \param[in]       xr: Origin X of right corners
+ * \param[in]       xm: End X of middle part between corners, set to `xl` when there is none
+ * \param[in]       yt: Origin Y of top corners
+ * \param[in]       yb: Origin Y of bottom corners
+ * \param[in]       r: Arc radius
+ * \param[in]       c: List of corners to draw, \ref GUI_DRAW_CIRCLE_TL, \ref GUI_DRAW_CIRCLE_TR, \ref GUI_DRAW_CIRCLE_BL, \ref GUI_DRAW_CIRCLE_BR
  */
-void
-gui_draw_circlecorner(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, uint8_t c, gui_color_t color) {
+static void
+span_arcs(gui_span_batch_t* b, gui_dim_t xl, gui_dim_t xr, gui_dim_t xm, gui_dim_t yt, gui_dim_t yb, gui_dim_t r, uint8_t c) {
     gui_dim_t f = 1 - r;
     gui_dim_t ddF_x = 1;
     gui_dim_t ddF_y = -2 * r;
     gui_dim_t x = 0;
     gui_dim_t y = r;
-    
-    if (!GUI_RECT_MATCH(
-        x0 - r, y0 - r, x0 + r, y0 + r,
+    uint8_t tl = !!(c & GUI_DRAW_CIRCLE_TL), tr = !!(c & GUI_DRAW_CIRCLE_TR);
+    uint8_t bl = !!(c & GUI_DRAW_CIRCLE_BL), br = !!(c & GUI_DRAW_CIRCLE_BR);
+
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        /* Rows close to origin change on every step */
+        span_arc_row(b, xl, xr, xm, yt - x, y, tl, tr);
+        span_arc_row(b, xl, xr, xm, yb + x, y, bl, br);
+
+        /* Rows far from origin only when they are final, before y changes */
+        if (f >= 0 || x >= y) {
+            span_arc_row(b, xl, xr, xm, yt - y, x, tl, tr);
+            span_arc_row(b, xl, xr, xm, yb + y, x, bl, br);
+        }
+    }
+}
+
+/**
+ * \brief           Coverage tile for anti-aliased primitives
+ */
+typedef struct {
+    gui_dim_t x;                                    /*!< Tile left position on screen */
+    gui_dim_t y;                                    /*!< Tile top position on screen */
+    gui_dim_t width;                                /*!< Tile width */
+    gui_dim_t height;                               /*!< Tile height */
+    uint8_t used;                                   /*!< Set to `1` when at least one pixel has coverage */
+    uint8_t pending;                                /*!< Set to `1` when low-level may still read buffer */
+    uint8_t buf[GUI_CFG_DRAW_AA_BUFFER_SIZE];       /*!< `A8` coverage values, `width * height` entries */
+} gui_aa_tile_t;
+
+static gui_aa_tile_t aa_tile;
+
+/**
+ * \brief           Start new coverage tile
+ * \param[in]       disp: Clipping region
+ * \param[in]       x: Tile left position
+ * \param[in]       y: Tile top position
+ * \param[in]       width: Tile width, `width * height` must not exceed \ref GUI_CFG_DRAW_AA_BUFFER_SIZE
+ * \param[in]       height: Tile height
+ * \return          `1` when tile is visible and has to be rasterized, `0` otherwise
+ */
+static uint8_t
+aa_tile_begin(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height) {
+    gui_aa_tile_t* t = &aa_tile;
+    
+    if (width <= 0 || height <= 0 || !GUI_RECT_MATCH(
+        disp->x1, disp->y1, disp->x2, disp->y2,
+        x, y, x + width, y + height
+    )) {
+        return 0;
+    }
+    if (t->pending) {                               /* Previous tile may still be processed by hardware */
+        gui_lcd_fence();
+        t->pending = 0;
+    }
+    t->x = x;
+    t->y = y;
+    t->width = width;
+    t->height = height;
+    t->used = 0;
+    memset(t->buf, 0x00, (size_t)width * (size_t)height);
+    return 1;
+}
+
+/**
+ * \brief           Set coverage for pixel in tile, keep higher value when already set
+ * \param[in]       x: Pixel X position on screen
+ * \param[in]       y: Pixel Y position on screen
+ * \param[in]       a: Coverage value, `0` to `255`
+ */
+GUI_CFG_FAST_CODE static void
+aa_tile_plot(gui_dim_t x, gui_dim_t y, uint8_t a) {
+    gui_aa_tile_t* t = &aa_tile;
+    uint8_t* p;
+    
+    if (!a || x < t->x || y < t->y || x >= (t->x + t->width) || y >= (t->y + t->height)) {
+        return;
+    }
+    p = &t->buf[(size_t)(y - t->y) * t->width + (x - t->x)];
+    if (*p < a) {
+        *p = a;
+    }
+    t->used = 1;
+}
+
+/**
+ * \brief           Blend `A8` coverage values to drawing layer
+ * \param[in]       disp: Clipping region
+ * \param[in]       x: Left position of first value on screen
+ * \param[in]       y: Top position of first value on screen
+ * \param[in]       w: Number of values in each row
+ * \param[in]       h: Number of rows
+ * \param[in]       src: Coverage values
+ * \param[in]       color: Color to blend
+ * \return          `1` when low-level may still read `src` in background, `0` otherwise
+ */
+static uint8_t
+draw_a8(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t w, gui_dim_t h, const uint8_t* src, gui_color_t color) {
+    gui_dim_t stride = w;
+    
+    if (x < disp->x1) {
+        src += disp->x1 - x;
+        w -= disp->x1 - x;
+        x = disp->x1;
+    }
+    if (y < disp->y1) {
+        src += (size_t)(disp->y1 - y) * stride;
+        h -= disp->y1 - y;
+        y = disp->y1;
+    }
+    if ((x + w) > disp->x2) {
+        w = disp->x2 - x;
+    }
+    if ((y + h) > disp->y2) {
+        h = disp->y2 - y;
+    }
+    if (w <= 0 || h <= 0) {
+        return 0;
+    }
+    
+    if (GUI_LL_ISSET(CopyChar)) {                   /* Blend all values with single call */
+        uint8_t* dst = (uint8_t *)GUI.lcd.drawing_layer->start_address + 
+            ((size_t)(y - GUI.lcd.drawing_layer->y_pos) * GUI.lcd.drawing_layer->width + (x - GUI.lcd.drawing_layer->x_pos)) * GUI.lcd.pixel_size;
+        GUI_LL(CopyChar)(&GUI.lcd, GUI.lcd.drawing_layer, dst, src, w, h, GUI.lcd.drawing_layer->width - w, stride - w, color);
+        return 1;
+    } else {
+        gui_dim_t xi, yi;
+        gui_color_t c;
+        uint8_t a;
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+        const gui_layer_access_t* acc = draw_access(1);
+        
+        if (acc != NULL) {                          /* Blend rows directly in memory */
+            size_t ps = acc->format == GUI_PIXEL_FORMAT_RGB565 ? 2 : 4;
+            uint8_t* p;
+            
+            for (yi = 0; yi < h; yi++) {
+                p = guii_access_addr(acc, GUI.lcd.drawing_layer, x, y + yi);
+                for (xi = 0; xi < w; xi++, p += ps) {
+                    draw_access_blend(acc, p, color, src[(size_t)yi * stride + xi]);
+                }
+            }
+            return 0;
+        }
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+        
+        for (yi = 0; yi < h; yi++) {
+            for (xi = 0; xi < w; xi++) {
+                a = src[(size_t)yi * stride + xi];
+                if (a == 0xFF) {
+                    gui_draw_setpixel(disp, x + xi, y + yi, color);
+                } else if (a) {
+                    c = gui_draw_getpixel(disp, x + xi, y + yi);
+                    gui_draw_setpixel(disp, x + xi, y + yi, guii_blend_color(color, c, a));
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief           Blend coverage tile to drawing layer
+ * \param[in]       disp: Clipping region
+ * \param[in]       color: Color of primitive
+ */
+GUI_CFG_FAST_CODE static void
+aa_tile_flush(const gui_display_t* disp, gui_color_t color) {
+    gui_aa_tile_t* t = &aa_tile;
+    
+    if (!t->used) {
+        return;
+    }
+    if (draw_a8(disp, t->x, t->y, t->width, t->height, t->buf, color)) {
+        t->pending = 1;
+    }
+}
+
+/******************************************************************************/
+/******************************************************************************/
+/***                          Functions for primitives                       **/
+/******************************************************************************/
+/******************************************************************************/
+
+/**
+ * \brief           Draw line from point 1 to point 2
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x1: Line start X position
+ * \param[in]       y1: Line start Y position
+ * \param[in]       x2: Line end X position
+ * \param[in]       y2: Line end Y position
+ * \param[in]       color: Color used for drawing operation
+ * \sa              gui_draw_vline, gui_draw_hline
+ */
+void
+gui_draw_line(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_color_t color) {
+    gui_dim_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0, 
+    yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0, 
+    curpixel = 0;
+    
+    DRAW_LIST_RECORD(DRAW_LIST_LINE, 0, x1, y1, x2, y2, 0, 0, color, NULL, NULL, 0, gui_draw_line(disp, x1, y1, x2, y2, color));
+    
+    /* Check if coordinates are inside drawing region */
+//    if (                                            /* Check if redraw is inside area */
+//        !GUI_RECT_MATCH(  x1, y1, x2, y2,
+//                            disp->x1, disp->y1, disp->x2, disp->y2)) {
+//        return;
+//    }
+
+	deltax = GUI_ABS(x2 - x1);
+	deltay = GUI_ABS(y2 - y1);
+    
+    if (deltax == 0) {                              /* Straight vertical line */
+        gui_draw_vline(disp, x1, GUI_MIN(y1, y2), deltay, color);
+        return;
+    }
+    if (deltay == 0) {                              /* Straight horizontal line */
+        gui_draw_hline(disp, GUI_MIN(x1, x2), y1, deltax, color);
+        return;
+    }
+
+    x = x1;
+    y = y1;
+
+    if (x2 >= x1) {
+        xinc1 = 1;
+        xinc2 = 1;
+    } else {
+        xinc1 = -1;
+        xinc2 = -1;
+    }
+
+    if (y2 >= y1) {
+        yinc1 = 1;
+        yinc2 = 1;
+    } else {
+        yinc1 = -1;
+        yinc2 = -1;
+    }
+
+    if (deltax >= deltay) {
+        xinc1 = 0;
+        yinc2 = 0;
+        den = deltax;
+        num = deltax / 2;
+        numadd = deltay;
+        numpixels = deltax;
+    } else {
+        xinc2 = 0;
+        yinc1 = 0;
+        den = deltay;
+        num = deltay / 2;
+        numadd = deltax;
+        numpixels = deltay;
+    }
+
+    for (curpixel = 0; curpixel <= numpixels; curpixel++) {
+        gui_draw_setpixel(disp, x, y, color);
+        num += numadd;
+        if (num >= den) {
+            num -= den;
+            x += xinc1;
+            y += yinc1;
+        }
+        x += xinc2;
+        y += yinc2;
+    }
+}
+
+/**
+ * \brief           Draw rectangle extended function
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       rect: Rectangle data
+ */
+void
+gui_draw_rectangle_ex(const gui_display_t* disp, gui_draw_rect_ex_t* rect) {
+
+}
+
+/**
+ * \brief           Draw rectangle
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       color: Color used for drawing operation
+ * \sa              gui_draw_filledrectangle, gui_draw_roundedrectangle, gui_draw_filledroundedrectangle
+ */
+void
+gui_draw_rectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color) {
+    DRAW_LIST_RECORD(DRAW_LIST_RECTANGLE, 0, x, y, width, height, 0, 0, color, NULL, NULL, 0, gui_draw_rectangle(disp, x, y, width, height, color));
+    
+    if (width == 0 || height == 0) {
+        return;
+    }
+    gui_draw_hline(disp, x,             y,              width,  color);
+    gui_draw_vline(disp, x,             y,              height, color);
+    
+    gui_draw_hline(disp, x,             y + height - 1, width,  color);
+    gui_draw_vline(disp, x + width - 1, y,              height, color);
+}
+
+/**
+ * \brief           Draw filled rectangle
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       color: Color used for drawing operation
+ * \sa              gui_draw_rectangle, gui_draw_roundedrectangle, gui_draw_filledroundedrectangle
+ */
+void
+gui_draw_filledrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color) {
+    DRAW_LIST_RECORD(DRAW_LIST_FILLEDRECTANGLE, 0, x, y, width, height, 0, 0, color, NULL, NULL, 0, gui_draw_filledrectangle(disp, x, y, width, height, color));
+    
+    gui_draw_fill(disp, x, y, width, height, color);
+}
+
+/**
+ * \brief           Draw rectangle with 3D view
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       state: 3D state. This parameter can be a value of \ref gui_draw_3d_state_t enumeration
+ */
+void
+gui_draw_rectangle3d(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_draw_3d_state_t state) {
+    gui_color_t c1, c2, c3;
+    
+    DRAW_LIST_RECORD(DRAW_LIST_RECTANGLE3D, state, x, y, width, height, 0, 0, 0, NULL, NULL, 0, gui_draw_rectangle3d(disp, x, y, width, height, state));
+    
+    c1 = GUI_COLOR_BLACK;
+    if (state == GUI_DRAW_3D_State_Raised) {
+        c2 = 0xFFAAAAAA;
+        c3 = 0xFF555555;
+    } else {
+        c2 = 0xFF555555;
+        c3 = 0xFFAAAAAA;
+    }
+    
+    gui_draw_rectangle(disp, x, y, width, height, c1);
+    
+    gui_draw_hline(disp, x + 1, y + 1, width - 2, c2);
+    gui_draw_vline(disp, x + 1, y + 1, height - 3, c2);
+    
+    gui_draw_hline(disp, x + 1, y + height - 2, width - 2, c3);
+    gui_draw_vline(disp, x + width - 2, y + 2, height - 4, c3);
+}
+
+/**
+ * \brief           Draw rectangle with rounded corners
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       r: Corner radius, max value can be r = MIN(width, height) / 2
+ * \param[in]       color: Color used for drawing operation
+ * \sa              gui_draw_rectangle, gui_draw_filledrectangle, gui_draw_filledroundedrectangle
+ */
+void
+gui_draw_roundedrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t r, gui_color_t color) {
+    DRAW_LIST_RECORD(DRAW_LIST_ROUNDEDRECTANGLE, 0, x, y, width, height, r, 0, color, NULL, NULL, 0, gui_draw_roundedrectangle(disp, x, y, width, height, r, color));
+    
+    if (r >= (height / 2)) {
+        r = height / 2 - 1;
+    }
+    if (r >= (width / 2)) {
+        r = width / 2 - 1;
+    }
+    if (r) {
+        gui_draw_hline(disp, x + r,         y,              width - 2 * r,  color);
+        gui_draw_vline(disp, x + width - 1, y + r,          height - 2 * r, color);
+        gui_draw_hline(disp, x + r,         y + height - 1, width - 2 * r,  color);
+        gui_draw_vline(disp, x,             y + r,          height - 2 * r, color);
+        
+        gui_draw_circlecorner(disp, x + r,             y + r,              r, GUI_DRAW_CIRCLE_TL, color);
+        gui_draw_circlecorner(disp, x + width - r - 1, y + r,              r, GUI_DRAW_CIRCLE_TR, color);
+        gui_draw_circlecorner(disp, x + r,             y + height - r - 1, r, GUI_DRAW_CIRCLE_BL, color);
+        gui_draw_circlecorner(disp, x + width - r - 1, y + height - r - 1, r, GUI_DRAW_CIRCLE_BR, color);
+    } else {
+        gui_draw_rectangle(disp, x, y, width, height, color);
+    }
+}
+
+/**
+ * \brief           Draw filled rectangle with rounded corners
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       r: Corner radius, max value can be r = MIN(width, height) / 2
+ * \param[in]       color: Color used for drawing operation
+ * \sa              gui_draw_rectangle, gui_draw_filledrectangle, gui_draw_roundedrectangle
+ */
+void
+gui_draw_filledroundedrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t r, gui_color_t color) {
+    DRAW_LIST_RECORD(DRAW_LIST_FILLEDROUNDEDRECTANGLE, 0, x, y, width, height, r, 0, color, NULL, NULL, 0, gui_draw_filledroundedrectangle(disp, x, y, width, height, r, color));
+    
+    if (r >= (height / 2)) {
+        r = height / 2 - 1;
+    }
+    if (r >= (width / 2)) {
+        r = width / 2 - 1;
+    }
+    if (r > 0) {
+        gui_span_batch_t b;
+#if GUI_CFG_USE_LL_GPU
+        gui_display_t clip;
+#endif /* GUI_CFG_USE_LL_GPU */
+        
+        if (!GUI_RECT_MATCH(
+            disp->x1, disp->y1, disp->x2, disp->y2,
+            x, y, x + width, y + height
+        )) {
+            return;
+        }
+#if GUI_CFG_USE_LL_GPU
+        if (GUI_LL_ISSET(FillRoundRect) && gpu_clip(disp, &clip)
+            && GUI_LL(FillRoundRect)(&GUI.lcd, GUI.lcd.drawing_layer, &clip, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos, width, height, r, color)) {
+            return;
+        }
+#endif /* GUI_CFG_USE_LL_GPU */
+        
+        /* Middle part with full width */
+        gui_draw_filledrectangle(disp, x, y + r, width, height - 2 * r, color);
+        
+        /* Top and bottom rows, corners are merged with middle part of each row */
+        span_begin(&b, disp, color);
+        span_arcs(&b, x + r, x + width - r - 1, x + width - r, y + r, y + height - r - 1, r, GUI_DRAW_CIRCLE_TL | GUI_DRAW_CIRCLE_TR | GUI_DRAW_CIRCLE_BL | GUI_DRAW_CIRCLE_BR);
+        span_flush(&b);
+    } else {
+        gui_draw_filledrectangle(disp, x, y, width, height, color);
+    }
+}
+
+#if GUI_CFG_USE_GRADIENT || __DOXYGEN__
+
+/**
+ * \brief           Draw rectangle filled with gradient
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       grad: Gradient colors and direction. Colors are drawn opaque
+ * \sa              gui_draw_gradientroundedrectangle, gui_draw_filledrectangle
+ */
+void
+gui_draw_gradientrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const gui_gradient_t* grad) {
+    gui_draw_gradientroundedrectangle(disp, x, y, width, height, 0, grad);
+}
+
+/**
+ * \brief           Draw rectangle with rounded corners filled with gradient
+ *
+ *                  Gradient spans complete rectangle, corners are cut from it
+ *
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       r: Corner radius, max value can be r = MIN(width, height) / 2
+ * \param[in]       grad: Gradient colors and direction. Colors are drawn opaque
+ * \sa              gui_draw_gradientrectangle, gui_draw_filledroundedrectangle
+ */
+void
+gui_draw_gradientroundedrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t r, const gui_gradient_t* grad) {
+    gui_gradient_ctx_t g;
+#if GUI_CFG_USE_LL_GPU
+    gui_display_t clip;
+#endif /* GUI_CFG_USE_LL_GPU */
+    
+    DRAW_LIST_RECORD(DRAW_LIST_GRADIENT, 0, x, y, width, height, r, 0, 0, NULL, grad, sizeof(*grad), gui_draw_gradientroundedrectangle(disp, x, y, width, height, r, grad));
+    
+    if (width <= 0 || height <= 0 || !GUI_RECT_MATCH(
+        disp->x1, disp->y1, disp->x2, disp->y2,
+        x, y, x + width, y + height
+    )) {
+        return;
+    }
+    if (r >= (height / 2)) {
+        r = height / 2 - 1;
+    }
+    if (r >= (width / 2)) {
+        r = width / 2 - 1;
+    }
+#if GUI_CFG_USE_LL_GPU
+    if (GUI_LL_ISSET(FillGradient) && gpu_clip(disp, &clip)
+        && GUI_LL(FillGradient)(&GUI.lcd, GUI.lcd.drawing_layer, &clip, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos, width, height, GUI_MAX(r, 0), grad)) {
+        return;
+    }
+#endif /* GUI_CFG_USE_LL_GPU */
+    
+    gradient_begin(&g, grad, x, y, width, height);
+    if (r > 0) {
+        gui_span_batch_t b;
+        
+        /* Middle part with full width */
+        gradient_fill(disp, &g, x, y + r, width, height - 2 * r);
+        
+        /* Top and bottom rows with corners */
+        span_begin(&b, disp, 0);
+        b.grad = &g;
+        span_arcs(&b, x + r, x + width - r - 1, x + width - r, y + r, y + height - r - 1, r, GUI_DRAW_CIRCLE_TL | GUI_DRAW_CIRCLE_TR | GUI_DRAW_CIRCLE_BL | GUI_DRAW_CIRCLE_BR);
+    } else {
+        gradient_fill(disp, &g, x, y, width, height);
+    }
+}
+
+#endif /* GUI_CFG_USE_GRADIENT || __DOXYGEN__ */
+
+/**
+ * \brief           Draw circle
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: X position of circle center
+ * \param[in]       y: X position of circle center
+ * \param[in]       r: Circle radius
+ * \param[in]       color: Color used for drawing operation 
+ * \sa              gui_draw_filledcircle, gui_draw_circlecorner, gui_draw_filledcirclecorner
+ */
+void
+gui_draw_circle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t r, gui_color_t color) {
+    DRAW_LIST_RECORD(DRAW_LIST_CIRCLE, 0, x, y, r, 0, 0, 0, color, NULL, NULL, 0, gui_draw_circle(disp, x, y, r, color));
+    
+    gui_draw_circlecorner(disp, x, y, r, GUI_DRAW_CIRCLE_TL, color);
+    gui_draw_circlecorner(disp, x - 1, y, r, GUI_DRAW_CIRCLE_TR, color);
+    gui_draw_circlecorner(disp, x, y - 1, r, GUI_DRAW_CIRCLE_BL, color);
+    gui_draw_circlecorner(disp, x - 1, y - 1, r, GUI_DRAW_CIRCLE_BR, color);
+}
+
+/**
+ * \brief           Draw filled circle
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: X position of circle center
+ * \param[in]       y: X position of circle center
+ * \param[in]       r: Circle radius
+ * \param[in]       color: Color used for drawing operation 
+ * \sa              gui_draw_circle, gui_draw_circlecorner, gui_draw_filledcirclecorner
+ */
+void
+gui_draw_filledcircle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t r, gui_color_t color) {
+    gui_span_batch_t b;
+    
+    DRAW_LIST_RECORD(DRAW_LIST_FILLEDCIRCLE, 0, x, y, r, 0, 0, 0, color, NULL, NULL, 0, gui_draw_filledcircle(disp, x, y, r, color));
+    
+    if (!GUI_RECT_MATCH(
+        disp->x1, disp->y1, disp->x2, disp->y2,
+        x - r, y - r, x + r, y + r
+    )) {
+        return;
+    }
+    span_begin(&b, disp, color);
+    span_arcs(&b, x, x, x, y, y - 1, r, GUI_DRAW_CIRCLE_TL | GUI_DRAW_CIRCLE_TR | GUI_DRAW_CIRCLE_BL | GUI_DRAW_CIRCLE_BR);
+    span_flush(&b);
+}
+
+/**
+ * \brief           Draw triangle
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x1: Triangle point 1 X position
+ * \param[in]       y1: Triangle point 1 Y position
+ * \param[in]       x2: Triangle point 2 X position
+ * \param[in]       y2: Triangle point 2 Y position
+ * \param[in]       x3: Triangle point 3 X position
+ * \param[in]       y3: Triangle point 3 Y position
+ * \param[in]       color: Color used for drawing operation 
+ * \sa              gui_draw_filledtriangle
+ */
+void
+gui_draw_triangle(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1,  gui_dim_t x2, gui_dim_t y2, gui_dim_t x3, gui_dim_t y3, gui_color_t color) {
+    DRAW_LIST_RECORD(DRAW_LIST_TRIANGLE, 0, x1, y1, x2, y2, x3, y3, color, NULL, NULL, 0, gui_draw_triangle(disp, x1, y1, x2, y2, x3, y3, color));
+    
+    gui_draw_line(disp, x1, y1, x2, y2, color);
+    gui_draw_line(disp, x1, y1, x3, y3, color);
+    gui_draw_line(disp, x2, y2, x3, y3, color);
+}
+
+/**
+ * \brief           Draw filled triangle
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x1: Triangle point 1 X position
+ * \param[in]       y1: Triangle point 1 Y position
+ * \param[in]       x2: Triangle point 2 X position
+ * \param[in]       y2: Triangle point 2 Y position
+ * \param[in]       x3: Triangle point 3 X position
+ * \param[in]       y3: Triangle point 3 Y position
+ * \param[in]       color: Color used for drawing operation 
+ * \sa              gui_draw_triangle
+ */
+void
+gui_draw_filledtriangle(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_dim_t x3, gui_dim_t y3, gui_color_t color) {
+    gui_span_batch_t b;
+    gui_dim_t t, y, xa, xb;
+    int32_t dy13, dy12, dy23;
+    
+    DRAW_LIST_RECORD(DRAW_LIST_FILLEDTRIANGLE, 0, x1, y1, x2, y2, x3, y3, color, NULL, NULL, 0, gui_draw_filledtriangle(disp, x1, y1, x2, y2, x3, y3, color));
+    
+    /* Sort points by Y coordinate, y1 <= y2 <= y3 */
+    if (y1 > y2) {
+        t = x1; x1 = x2; x2 = t;
+        t = y1; y1 = y2; y2 = t;
+    }
+    if (y2 > y3) {
+        t = x2; x2 = x3; x3 = t;
+        t = y2; y2 = y3; y3 = t;
+    }
+    if (y1 > y2) {
+        t = x1; x1 = x2; x2 = t;
+        t = y1; y1 = y2; y2 = t;
+    }
+    
+    /* Clip whole shape at once */
+    if (!GUI_RECT_MATCH(
+        disp->x1, disp->y1, disp->x2, disp->y2,
+        GUI_MIN(x1, GUI_MIN(x2, x3)), y1, GUI_MAX(x1, GUI_MAX(x2, x3)) + 1, y3 + 1
+    )) {
+        return;
+    }
+    
+    span_begin(&b, disp, color);
+    dy13 = y3 - y1;
+    dy12 = y2 - y1;
+    dy23 = y3 - y2;
+    for (y = GUI_MAX(y1, disp->y1); y <= y3 && y < disp->y2; y++) {
+        /* Long edge from point 1 to point 3 */
+        xa = dy13 ? (gui_dim_t)(x1 + ((int32_t)(x3 - x1) * (y - y1)) / dy13) : GUI_MIN(x1, GUI_MIN(x2, x3));
+        
+        /* Short edges, from point 1 to 2 and from point 2 to 3 */
+        if (y < y2) {
+            xb = (gui_dim_t)(x1 + ((int32_t)(x2 - x1) * (y - y1)) / dy12);
+        } else if (dy23) {
+            xb = (gui_dim_t)(x2 + ((int32_t)(x3 - x2) * (y - y2)) / dy23);
+        } else {
+            xb = dy13 ? x2 : GUI_MAX(x2, GUI_MAX(x1, x3));
+        }
+        if (xa > xb) {
+            t = xa; xa = xb; xb = t;
+        }
+        span_add(&b, xa, y, xb - xa + 1);           /* Edges are inclusive */
+    }
+    span_flush(&b);
+}
+
+/**
+ * \brief           Draw circle corner, selected with parameter
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x0: X position of corner origin
+ * \param[in]       y0: Y position of corner origin
+ * \param[in]       r: Circle radius
+ * \param[in]       c: List of corners to draw. Use BITWISE OR with these values to specify corner:
+ *                     - \ref GUI_DRAW_CIRCLE_TL
+ *                     - \ref GUI_DRAW_CIRCLE_TR
+ *                     - \ref GUI_DRAW_CIRCLE_BL
+ *                     - \ref GUI_DRAW_CIRCLE_BR
+ * \param[in]       color: Color used for drawing operation 
+ * \sa              gui_draw_circle, gui_draw_filledcircle, gui_draw_filledcirclecorner
+ */
+void
+gui_draw_circlecorner(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, uint8_t c, gui_color_t color) {
+    gui_dim_t f = 1 - r;
+    gui_dim_t ddF_x = 1;
+    gui_dim_t ddF_y = -2 * r;
+    gui_dim_t x = 0;
+    gui_dim_t y = r;
+    
+    DRAW_LIST_RECORD(DRAW_LIST_CIRCLECORNER, c, x0, y0, r, 0, 0, 0, color, NULL, NULL, 0, gui_draw_circlecorner(disp, x0, y0, r, c, color));
+    
+    if (!GUI_RECT_MATCH(
+        x0 - r, y0 - r, x0 + r, y0 + r,
         disp->x1, disp->y1, disp->x2, disp->y2
     )) {
         return;
     }
 
-    while (x < y) {
-        if (f >= 0) {
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        if (c & GUI_DRAW_CIRCLE_TL) {               /* Top left corner */
+            gui_draw_setpixel(disp, x0 - y, y0 - x, color);
+            gui_draw_setpixel(disp, x0 - x, y0 - y, color);
+        }
+
+        if (c & GUI_DRAW_CIRCLE_TR) {               /* Top right corner */
+            gui_draw_setpixel(disp, x0 + x, y0 - y, color);
+            gui_draw_setpixel(disp, x0 + y, y0 - x, color);
+        }
+
+        if (c & GUI_DRAW_CIRCLE_BR) {               /* Bottom right corner */
+            gui_draw_setpixel(disp, x0 + x, y0 + y, color);
+            gui_draw_setpixel(disp, x0 + y, y0 + x, color);
+        }
+
+        if (c & GUI_DRAW_CIRCLE_BL) {               /* Bottom left corner */
+            gui_draw_setpixel(disp, x0 - x, y0 + y, color);
+            gui_draw_setpixel(disp, x0 - y, y0 + x, color);
+        }
+    }
+}
+
+/**
+ * \brief           Draw anti-aliased line from point 1 to point 2
+ *
+ *                  Coverage is calculated in fixed point and blended in tiles
+ *                  with low-level `CopyChar` function, when available
+ *
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x1: Line start X position
+ * \param[in]       y1: Line start Y position
+ * \param[in]       x2: Line end X position
+ * \param[in]       y2: Line end Y position
+ * \param[in]       color: Color used for drawing operation
+ * \sa              gui_draw_line
+ */
+void
+gui_draw_line_aa(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_color_t color) {
+    gui_dim_t a1, b1, a2, b2, a, lo, hi, i, n;
+    int32_t slope, bs, be, b;
+    uint8_t steep, f;
+#if GUI_CFG_USE_LL_GPU
+    gui_display_t clip;
+#endif /* GUI_CFG_USE_LL_GPU */
+    
+    DRAW_LIST_RECORD(DRAW_LIST_LINE_AA, 0, x1, y1, x2, y2, 0, 0, color, NULL, NULL, 0, gui_draw_line_aa(disp, x1, y1, x2, y2, color));
+    
+    if (!GUI_RECT_MATCH(
+        disp->x1, disp->y1, disp->x2, disp->y2,
+        GUI_MIN(x1, x2), GUI_MIN(y1, y2), GUI_MAX(x1, x2) + 1, GUI_MAX(y1, y2) + 1
+    )) {
+        return;
+    }
+#if GUI_CFG_USE_LL_GPU
+    if (GUI_LL_ISSET(DrawLineAA) && gpu_clip(disp, &clip)
+        && GUI_LL(DrawLineAA)(&GUI.lcd, GUI.lcd.drawing_layer, &clip,
+            x1 - GUI.lcd.drawing_layer->x_pos, y1 - GUI.lcd.drawing_layer->y_pos,
+            x2 - GUI.lcd.drawing_layer->x_pos, y2 - GUI.lcd.drawing_layer->y_pos, color)) {
+        return;
+    }
+#endif /* GUI_CFG_USE_LL_GPU */
+    
+    /* Walk along major axis "a", minor axis "b" is in 16.16 fixed point */
+    steep = GUI_ABS(y2 - y1) > GUI_ABS(x2 - x1);
+    if (steep) {
+        a1 = y1; b1 = x1; a2 = y2; b2 = x2;
+    } else {
+        a1 = x1; b1 = y1; a2 = x2; b2 = y2;
+    }
+    if (a1 > a2) {
+        gui_dim_t t;
+        t = a1; a1 = a2; a2 = t;
+        t = b1; b1 = b2; b2 = t;
+    }
+    slope = a2 > a1 ? ((int32_t)(b2 - b1) * 65536) / (a2 - a1) : 0;
+    
+    for (a = a1; a <= a2; a += n) {
+        /* Number of steps which fit to coverage tile */
+        n = GUI_MIN(a2 - a + 1, GUI_CFG_DRAW_AA_BUFFER_SIZE / 3);
+        while (n > 1 && (size_t)n * (size_t)(((GUI_ABS(slope) * (n - 1)) >> 16) + 3) > GUI_CFG_DRAW_AA_BUFFER_SIZE) {
+            n /= 2;
+        }
+        
+        bs = (int32_t)b1 * 65536 + slope * (a - a1);
+        be = bs + slope * (n - 1);
+        lo = (gui_dim_t)(GUI_MIN(bs, be) >> 16);
+        hi = (gui_dim_t)(GUI_MAX(bs, be) >> 16) + 1;
+        if (!(steep ? aa_tile_begin(disp, lo, a, hi - lo + 1, n) : aa_tile_begin(disp, a, lo, n, hi - lo + 1))) {
+            continue;
+        }
+        for (i = 0, b = bs; i < n; i++, b += slope) {
+            f = GUI_U8((b >> 8) & 0xFF);            /* Fractional part is coverage of second pixel */
+            if (steep) {
+                aa_tile_plot((gui_dim_t)(b >> 16), a + i, 0xFF - f);
+                aa_tile_plot((gui_dim_t)(b >> 16) + 1, a + i, f);
+            } else {
+                aa_tile_plot(a + i, (gui_dim_t)(b >> 16), 0xFF - f);
+                aa_tile_plot(a + i, (gui_dim_t)(b >> 16) + 1, f);
+            }
+        }
+        aa_tile_flush(disp, color);
+    }
+}
+
+/**
+ * \brief           Draw anti-aliased circle
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x0: X position of circle center
+ * \param[in]       y0: Y position of circle center
+ * \param[in]       r: Circle radius
+ * \param[in]       color: Color used for drawing operation
+ * \sa              gui_draw_circle, gui_draw_circlecorner_aa
+ */
+void
+gui_draw_circle_aa(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, gui_color_t color) {
+    DRAW_LIST_RECORD(DRAW_LIST_CIRCLE_AA, 0, x0, y0, r, 0, 0, 0, color, NULL, NULL, 0, gui_draw_circle_aa(disp, x0, y0, r, color));
+    
+    gui_draw_circlecorner_aa(disp, x0, y0, r, GUI_DRAW_CIRCLE_TL | GUI_DRAW_CIRCLE_TR | GUI_DRAW_CIRCLE_BL | GUI_DRAW_CIRCLE_BR, color);
+}
+
+/**
+ * \brief           Draw anti-aliased circle arc, selected by corners
+ *
+ *                  Coverage of each pixel is based on its distance from circle edge,
+ *                  approximated in fixed point without square root per pixel
+ *
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x0: X position of corner origin
+ * \param[in]       y0: Y position of corner origin
+ * \param[in]       r: Circle radius
+ * \param[in]       c: List of corners to draw. Use BITWISE OR with these values to specify corner:
+ *                     - \ref GUI_DRAW_CIRCLE_TL
+ *                     - \ref GUI_DRAW_CIRCLE_TR
+ *                     - \ref GUI_DRAW_CIRCLE_BL
+ *                     - \ref GUI_DRAW_CIRCLE_BR
+ * \param[in]       color: Color used for drawing operation
+ * \sa              gui_draw_circlecorner, gui_draw_circle_aa
+ */
+void
+gui_draw_circlecorner_aa(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, uint8_t c, gui_color_t color) {
+    gui_dim_t bx1, by1, bx2, by2, tx, ty, tw, th, y, dx, dy, from, to;
+    int32_t rr, inner, outer, e;
+    uint32_t v, recip;
+    uint64_t inv;
+    uint8_t left, right;
+    
+    DRAW_LIST_RECORD(DRAW_LIST_CIRCLECORNER_AA, c, x0, y0, r, 0, 0, 0, color, NULL, NULL, 0, gui_draw_circlecorner_aa(disp, x0, y0, r, c, color));
+    
+    if (r <= 0 || !c) {
+        return;
+    }
+    
+    /* Bounding box of selected corners, including 1 pixel of edge smoothing */
+    bx1 = (c & (GUI_DRAW_CIRCLE_TL | GUI_DRAW_CIRCLE_BL)) ? x0 - r - 1 : x0;
+    bx2 = (c & (GUI_DRAW_CIRCLE_TR | GUI_DRAW_CIRCLE_BR)) ? x0 + r + 2 : x0 + 1;
+    by1 = (c & (GUI_DRAW_CIRCLE_TL | GUI_DRAW_CIRCLE_TR)) ? y0 - r - 1 : y0;
+    by2 = (c & (GUI_DRAW_CIRCLE_BL | GUI_DRAW_CIRCLE_BR)) ? y0 + r + 2 : y0 + 1;
+    if (!GUI_RECT_MATCH(
+        disp->x1, disp->y1, disp->x2, disp->y2,
+        bx1, by1, bx2, by2
+    )) {
+        return;
+    }
+    
+    tw = GUI_MIN(bx2 - bx1, GUI_CFG_DRAW_AA_BUFFER_SIZE);
+    th = GUI_MAX(1, GUI_CFG_DRAW_AA_BUFFER_SIZE / tw);
+    rr = (int32_t)r * r;
+    inv = gui_math_irecip((uint32_t)r, &recip) ? recip : ((uint64_t)1 << 32);  /* Division by radius for each pixel is multiplication */
+    for (ty = by1; ty < by2; ty += th) {
+        for (tx = bx1; tx < bx2; tx += tw) {
+            if (!aa_tile_begin(disp, tx, ty, GUI_MIN(tw, bx2 - tx), GUI_MIN(th, by2 - ty))) {
+                continue;
+            }
+            for (y = ty; y < (ty + th) && y < by2; y++) {
+                dy = y - y0;
+                left = (dy <= 0 && (c & GUI_DRAW_CIRCLE_TL)) || (dy >= 0 && (c & GUI_DRAW_CIRCLE_BL));
+                right = (dy <= 0 && (c & GUI_DRAW_CIRCLE_TR)) || (dy >= 0 && (c & GUI_DRAW_CIRCLE_BR));
+                
+                /* Range of horizontal distances with coverage on this row */
+                outer = (int32_t)(r + 1) * (r + 1) - (int32_t)dy * dy;
+                if (outer < 0) {
+                    continue;
+                }
+                inner = (int32_t)(r - 1) * (r - 1) - (int32_t)dy * dy;
+                gui_math_isqrt((uint32_t)GUI_MAX(inner, 0), &v);
+                from = (gui_dim_t)v;
+                gui_math_isqrt((uint32_t)outer, &v);
+                to = (gui_dim_t)v;
+                
+                for (dx = from; dx <= to; dx++) {
+                    /* Distance to edge in 1/256 pixel, |d - r| ~= |dx^2 + dy^2 - r^2| / 2r */
+                    e = ((int32_t)dx * dx + (int32_t)dy * dy - rr) * 128;
+                    e = 0xFF - (int32_t)(((uint64_t)GUI_ABS(e) * inv) >> 32);
+                    if (e <= 0) {
+                        continue;
+                    }
+                    if (right) {
+                        aa_tile_plot(x0 + dx, y, GUI_U8(e));
+                    }
+                    if (left) {
+                        aa_tile_plot(x0 - dx, y, GUI_U8(e));
+                    }
+                }
+            }
+            aa_tile_flush(disp, color);
+        }
+    }
+}
+
+/**
+ * \brief           Draw filled circle corner, selected with parameter
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x0: X position of corner origin
+ * \param[in]       y0: Y position of corner origin
+ * \param[in]       r: Circle radius
+ * \param[in]       c: List of corners to draw. Use BITWISE OR with these values to specify corner:
+ *                     - \ref GUI_DRAW_CIRCLE_TL
+ *                     - \ref GUI_DRAW_CIRCLE_TR
+ *                     - \ref GUI_DRAW_CIRCLE_BL
+ *                     - \ref GUI_DRAW_CIRCLE_BR
+ * \param[in]       color: Color used for drawing operation 
+ * \sa              gui_draw_circle, gui_draw_filledcircle, gui_draw_circlecorner
+ */
+void
+gui_draw_filledcirclecorner(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, uint8_t c, gui_color_t color) {
+    gui_span_batch_t b;
+    
+    DRAW_LIST_RECORD(DRAW_LIST_FILLEDCIRCLECORNER, c, x0, y0, r, 0, 0, 0, color, NULL, NULL, 0, gui_draw_filledcirclecorner(disp, x0, y0, r, c, color));
+    
+    if (!GUI_RECT_MATCH(
+        disp->x1, disp->y1, disp->x2, disp->y2,
+        x0 - r, y0 - r, x0 + r, y0 + r
+    )) {
+        return;
+    }
+    span_begin(&b, disp, color);
+    span_arcs(&b, x0, x0, x0, y0, y0, r, c);
+    span_flush(&b);
+}
+
+#if GUI_CFG_USE_IMAGE_COMPRESSION || __DOXYGEN__
+
+/**
+ * \brief           Scratch buffer for decoded image data
+ */
+static struct {
+    uint8_t pending;                                /*!< Set to `1` when low-level may still read buffer */
+    uint8_t buf[GUI_CFG_DRAW_IMAGE_BUFFER_SIZE];    /*!< Decoded pixels and palette indices */
+} img_scratch;
+
+/**
+ * \brief           Send decoded rows from scratch buffer to low-level
+ * \param[in]       img: Image descriptor
+ * \param[in]       x: Absolute X position of first pixel
+ * \param[in]       y: Absolute Y position of first row
+ * \param[in]       src: First decoded pixel
+ * \param[in]       width: Number of pixels in each row
+ * \param[in]       height: Number of rows
+ * \param[in]       offline_src: Number of pixels between end of one and start of next row in source
+ */
+GUI_CFG_FAST_CODE static void
+image_blit(const gui_image_desc_t* img, gui_dim_t x, gui_dim_t y, const uint8_t* src, gui_dim_t width, gui_dim_t height, gui_dim_t offline_src) {
+    gui_layer_t* layer = GUI.lcd.drawing_layer;
+    uint8_t* dst;
+    
+    dst = ((uint8_t *)layer->start_address) + GUI.lcd.pixel_size * ((y - layer->y_pos) * layer->width + (x - layer->x_pos));
+    if (img->bpp == 32) {
+        if (GUI_LL_ISSET(DrawImage32)) {
+            GUI_LL(DrawImage32)(&GUI.lcd, layer, img, dst, src, width, height, layer->width - width, offline_src);
+        }
+    } else if (img->bpp == 24) {
+        if (GUI_LL_ISSET(DrawImage24)) {
+            GUI_LL(DrawImage24)(&GUI.lcd, layer, img, dst, src, width, height, layer->width - width, offline_src);
+        }
+    } else if (img->bpp == 16) {
+        if (GUI_LL_ISSET(DrawImage16)) {
+            GUI_LL(DrawImage16)(&GUI.lcd, layer, img, dst, src, width, height, layer->width - width, offline_src);
+        }
+    }
+    img_scratch.pending = 1;                        /* Hardware may read buffer in background */
+}
+
+/**
+ * \brief           Wait for low-level to release scratch buffer before it is overwritten
+ */
+static void
+image_scratch_acquire(void) {
+    if (img_scratch.pending) {
+        gui_lcd_fence();
+        img_scratch.pending = 0;
+    }
+}
+
+/**
+ * \brief           Decode one row of \ref GUI_IMAGE_COMPRESSION_RLE image
+ * \param[in]       src: Start of encoded row
+ * \param[out]      dst: Output buffer for `x_size` pixels
+ * \param[in]       x_size: Number of pixels in row
+ * \param[in]       bytes: Number of bytes per pixel
+ * \return          Start of next encoded row
+ */
+GUI_CFG_FAST_CODE static const uint8_t*
+image_rle_row(const uint8_t* src, uint8_t* dst, gui_dim_t x_size, uint8_t bytes) {
+    size_t left = (size_t)x_size, n, i;
+    uint8_t c;
+    
+    while (left) {
+        c = *src++;
+        n = (size_t)(c & 0x7F) + 1;
+        if (n > left) {                             /* Invalid stream, never write outside of row */
+            n = left;
+        }
+        if (c & 0x80) {                             /* Repeated pixel */
+            for (i = 0; i < n; i++, dst += bytes) {
+                memcpy(dst, src, bytes);
+            }
+            src += bytes;
+        } else {                                    /* Raw pixels */
+            memcpy(dst, src, n * bytes);
+            src += n * bytes;
+            dst += n * bytes;
+        }
+        left -= n;
+    }
+    return src;
+}
+
+/**
+ * \brief           Decompress `LZ4` block
+ * \param[in]       src: Compressed block
+ * \param[in]       src_len: Length of compressed block in units of bytes
+ * \param[out]      dst: Output buffer
+ * \param[in]       dst_len: Size of output buffer in units of bytes
+ * \return          Number of decompressed bytes, `0` on invalid block
+ */
+static size_t
+image_lz4_decode(const uint8_t* src, size_t src_len, uint8_t* dst, size_t dst_len) {
+    const uint8_t* s = src, *s_end = src + src_len;
+    uint8_t* d = dst, *d_end = dst + dst_len;
+    const uint8_t* m;
+    size_t len, off;
+    uint8_t token, b;
+    
+    while (s < s_end) {
+        token = *s++;
+        
+        /* Copy literals */
+        len = token >> 4;
+        if (len == 15) {
+            do {
+                if (s >= s_end) {
+                    return 0;
+                }
+                b = *s++;
+                len += b;
+            } while (b == 0xFF);
+        }
+        if (len > (size_t)(s_end - s) || len > (size_t)(d_end - d)) {
+            return 0;
+        }
+        memcpy(d, s, len);
+        s += len;
+        d += len;
+        if (s >= s_end) {                           /* Last sequence has literals only */
+            break;
+        }
+        
+        /* Copy match */
+        if (s_end - s < 2) {
+            return 0;
+        }
+        off = (size_t)s[0] | ((size_t)s[1] << 8);
+        s += 2;
+        if (off == 0 || off > (size_t)(d - dst)) {
+            return 0;
+        }
+        len = token & 0x0F;
+        if (len == 15) {
+            do {
+                if (s >= s_end) {
+                    return 0;
+                }
+                b = *s++;
+                len += b;
+            } while (b == 0xFF);
+        }
+        len += 4;
+        if (len > (size_t)(d_end - d)) {
+            return 0;
+        }
+        for (m = d - off; len > 0; len--) {         /* Byte copy, match may overlap output */
+            *d++ = *m++;
+        }
+    }
+    return (size_t)(d - dst);
+}
+
+/**
+ * \brief           Draw visible part of indexed image
+ *
+ *                  Low-level color lookup table is used when available,
+ *                  otherwise indices are expanded to pixels in scratch buffer.
+ *
+ * \param[in]       img: Image descriptor with \ref GUI_IMAGE_COMPRESSION_L8 or \ref GUI_IMAGE_COMPRESSION_L4 data
+ * \param[in]       x: Top left X position of image
+ * \param[in]       y: Top left Y position of image
+ * \param[in]       x1: First visible X position
+ * \param[in]       y1: First visible Y position
+ * \param[in]       x2: Last visible X position + 1
+ * \param[in]       y2: Last visible Y position + 1
+ */
+static void
+image_draw_indexed(const gui_image_desc_t* img, gui_dim_t x, gui_dim_t y, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2) {
+    uint8_t bytes = img->bpp >> 3, l4 = img->compression == GUI_IMAGE_COMPRESSION_L4, idx;
+    size_t stride = l4 ? ((size_t)img->x_size + 1) / 2 : (size_t)img->x_size;  /* Bytes in each source row */
+    gui_dim_t width = x2 - x1, rows, cnt, r, k, i;
+    const uint8_t* row;
+    uint8_t* dst;
+    
+    if (img->palette == NULL) {
+        return;
+    }
+    
+    /* Let hardware expand indices, L4 source must start at byte boundary */
+    if (GUI_LL_ISSET(DrawImageL) && (!l4 || !((x1 - x) & 0x01))) {
+        gui_layer_t* layer = GUI.lcd.drawing_layer;
+        
+        row = img->image + (size_t)(y1 - y) * stride + (size_t)(l4 ? (x1 - x) / 2 : (x1 - x));
+        dst = ((uint8_t *)layer->start_address) + GUI.lcd.pixel_size * ((y1 - layer->y_pos) * layer->width + (x1 - layer->x_pos));
+        if (GUI_LL(DrawImageL)(&GUI.lcd, layer, img, dst, row, width, y2 - y1, layer->width - width,
+            (gui_dim_t)(l4 ? 2 * stride : stride) - width)) {
+            return;
+        }
+    }
+    
+    rows = (gui_dim_t)(sizeof(img_scratch.buf) / ((size_t)width * bytes));
+    if (!rows) {
+        return;
+    }
+    for (r = y1; r < y2; r += cnt) {
+        cnt = GUI_MIN(rows, y2 - r);
+        image_scratch_acquire();
+        dst = img_scratch.buf;
+        for (k = 0; k < cnt; k++) {
+            row = img->image + (size_t)(r - y + k) * stride;
+            for (i = x1 - x; i < x2 - x; i++, dst += bytes) {
+                idx = l4 ? (uint8_t)((row[i >> 1] >> ((i & 0x01) ? 0 : 4)) & 0x0F) : row[i];
+                memcpy(dst, &img->palette[(size_t)idx * bytes], bytes);
+            }
+        }
+        image_blit(img, x1, r, img_scratch.buf, width, cnt, 0);
+    }
+}
+
+/**
+ * \brief           Draw compressed image
+ *
+ *                  Only tiles and rows which intersect clipping region are decoded.
+ *
+ * \param[in]       disp: Clipping region
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       img: Image descriptor
+ */
+static void
+image_draw_compressed(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_desc_t* img) {
+    uint8_t bytes = img->bpp >> 3;
+    gui_dim_t x1, x2, y1, y2, width, tile_h, t, ty, r, r1, r2, cnt, rows;
+    const uint8_t* src;
+    uint8_t* dst;
+    size_t idx_size, i;
+    
+    x1 = GUI_MAX(x, disp->x1);
+    x2 = GUI_MIN(x + img->x_size, disp->x2);
+    y1 = GUI_MAX(y, disp->y1);
+    y2 = GUI_MIN(y + img->y_size, disp->y2);
+    width = x2 - x1;
+    if (width <= 0 || y2 <= y1 || !bytes) {
+        return;
+    }
+    if (img->compression == GUI_IMAGE_COMPRESSION_L8 || img->compression == GUI_IMAGE_COMPRESSION_L4) {
+        image_draw_indexed(img, x, y, x1, y1, x2, y2);
+        return;
+    }
+    if (img->tiles != NULL && img->tile_height > 0) {
+        tile_h = img->tile_height;
+    } else if (img->compression == GUI_IMAGE_COMPRESSION_RLE) {
+        tile_h = img->y_size;                       /* Single tile, decoded sequentially */
+    } else {
+        return;                                     /* LZ4 tiles need offsets table for block lengths */
+    }
+    
+    for (t = (y1 - y) / tile_h; y + t * tile_h < y2; t++) {
+        ty = y + t * tile_h;                        /* Absolute position of first tile row */
+        src = img->image + (img->tiles != NULL ? img->tiles[t] : 0);
+        r1 = GUI_MAX(ty, y1) - ty;                  /* First visible row in tile */
+        r2 = GUI_MIN(GUI_MIN(ty + tile_h, y + img->y_size), y2) - ty;   /* Last visible row in tile + 1 */
+        cnt = 0;
+        
+        if (img->compression == GUI_IMAGE_COMPRESSION_RLE) {
+            /* Decode complete rows, blit only visible part of them */
+            rows = (gui_dim_t)(sizeof(img_scratch.buf) / ((size_t)img->x_size * bytes));
+            if (!rows) {
+                return;
+            }
+            for (r = 0; r < r2; r++) {
+                if (!cnt) {
+                    image_scratch_acquire();
+                }
+                src = image_rle_row(src, &img_scratch.buf[(size_t)cnt * img->x_size * bytes], img->x_size, bytes);
+                if (r < r1) {                       /* Row above clipping region, overwrite it */
+                    continue;
+                }
+                if (++cnt == rows || r == r2 - 1) {
+                    image_blit(img, x1, ty + r - cnt + 1, &img_scratch.buf[(size_t)(x1 - x) * bytes], width, cnt, img->x_size - width);
+                    cnt = 0;
+                }
+            }
+        } else if (img->compression == GUI_IMAGE_COMPRESSION_LZ4_PALETTE) {
+            /* Indices of complete tile first, followed by visible pixels */
+            idx_size = (size_t)img->x_size * (size_t)tile_h;
+            if (img->palette == NULL || idx_size >= sizeof(img_scratch.buf)) {
+                return;
+            }
+            rows = (gui_dim_t)((sizeof(img_scratch.buf) - idx_size) / ((size_t)width * bytes));
+            if (!rows) {
+                return;
+            }
+            image_scratch_acquire();
+            if (!image_lz4_decode(src, (size_t)(img->tiles[t + 1] - img->tiles[t]), img_scratch.buf, idx_size)) {
+                return;
+            }
+            for (r = r1; r < r2; r++) {
+                if (!cnt) {
+                    image_scratch_acquire();
+                }
+                src = &img_scratch.buf[(size_t)r * img->x_size + (x1 - x)];
+                dst = &img_scratch.buf[idx_size + (size_t)cnt * width * bytes];
+                for (i = 0; i < (size_t)width; i++, dst += bytes) {
+                    memcpy(dst, &img->palette[(size_t)src[i] * bytes], bytes);
+                }
+                if (++cnt == rows || r == r2 - 1) {
+                    image_blit(img, x1, ty + r - cnt + 1, &img_scratch.buf[idx_size], width, cnt, 0);
+                    cnt = 0;
+                }
+            }
+        } else {
+            return;
+        }
+    }
+}
+
+#endif /* GUI_CFG_USE_IMAGE_COMPRESSION || __DOXYGEN__ */
+
+#if GUI_CFG_USE_IMAGE_CACHE || __DOXYGEN__
+
+/**
+ * \brief           Free memory of entry which is not in cache
+ * \param[in]       entry: Entry to free
+ */
+static void
+image_cache_free(gui_image_cacheentry_t* entry) {
+#if GUI_CFG_USE_CACHE_RETAIN
+    if (guii_retain_free(entry)) {                  /* Entry in retained region is not part of heap */
+        return;
+    }
+#endif /* GUI_CFG_USE_CACHE_RETAIN */
+    GUI_MEMFREE(entry);
+}
+
+/**
+ * \brief           Remove image from cache and free its memory
+ * \param[in]       entry: Entry to remove
+ */
+static void
+image_cache_remove(gui_image_cacheentry_t* entry) {
+    gui_linkedlist_remove_gen(&GUI.root_images, (gui_linkedlist_t *)entry);
+    GUI.image_cache_size -= entry->memsize;
+    gui_lcd_fence();                                /* Image may still be used by queued low-level operation */
+    image_cache_free(entry);
+}
+
+/**
+ * \brief           Remove least recently used image from cache
+ * \return          `1` if entry was removed, `0` if cache is empty
+ */
+static uint8_t
+image_cache_removelru(void) {
+    gui_image_cacheentry_t* entry;
+    
+    entry = (gui_image_cacheentry_t *)gui_linkedlist_getnext_gen(&GUI.root_images, NULL);
+    if (entry != NULL) {
+        image_cache_remove(entry);
+        return 1;
+    }
+    return 0;
+}
+
+#if GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__
+
+/**
+ * \brief           Remove least recently used image when heap allocation failed
+ * \note            This function is private and may be called only when GUI is protected
+ * \return          `1` if entry was removed, `0` if only most recently used entry is left, it may be in use
+ */
+uint8_t
+guii_draw_image_cachereclaim(void) {
+    if (GUI.root_images.first == GUI.root_images.last) {
+        return 0;
+    }
+    return image_cache_removelru();
+}
+
+#endif /* GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__ */
+
+#if GUI_CFG_USE_IMAGE_COMPRESSION || __DOXYGEN__
+
+/**
+ * \brief           Decode complete compressed image to raw pixels
+ * \param[in]       img: Image descriptor
+ * \param[in]       data: Compressed image data
+ * \param[out]      out: Output buffer for `x_size * y_size` pixels
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+image_decode(const gui_image_desc_t* img, const uint8_t* data, uint8_t* out) {
+    uint8_t bytes = img->bpp >> 3;
+    size_t row = (size_t)img->x_size * bytes, idx_size, n, i;
+    gui_dim_t r, tile_h;
+    uint8_t* idx;
+    
+    if (img->compression == GUI_IMAGE_COMPRESSION_RLE) {
+        for (r = 0; r < img->y_size; r++) {         /* Tiles follow each other, decode rows sequentially */
+            data = image_rle_row(data, &out[(size_t)r * row], img->x_size, bytes);
+        }
+        return 1;
+    } else if (img->compression == GUI_IMAGE_COMPRESSION_LZ4_PALETTE) {
+        if (img->tiles == NULL || img->palette == NULL || img->tile_height <= 0) {
+            return 0;
+        }
+        tile_h = img->tile_height;
+        idx_size = (size_t)img->x_size * (size_t)tile_h;
+        while ((idx = GUI_MEMALLOC_FRAME(idx_size)) == NULL && image_cache_removelru()) {}
+        if (idx == NULL) {
+            return 0;
+        }
+        for (r = 0; r < img->y_size; r += tile_h) {
+            if (img->tiles[r / tile_h + 1] > img->size) {
+                break;                              /* Tile outside of read data */
+            }
+            n = image_lz4_decode(&data[img->tiles[r / tile_h]], (size_t)(img->tiles[r / tile_h + 1] - img->tiles[r / tile_h]), idx, idx_size);
+            if (!n) {
+                break;
+            }
+            for (i = 0; i < n; i++, out += bytes) { /* Expand indices to pixels */
+                memcpy(out, &img->palette[(size_t)idx[i] * bytes], bytes);
+            }
+        }
+        GUI_MEMFREE_FRAME(idx);
+        return r >= img->y_size;
+    } else if (img->compression == GUI_IMAGE_COMPRESSION_JPEG) {
+        return GUI_LL_ISSET(DecodeImage) && GUI_LL(DecodeImage)(&GUI.lcd, img, data, out);
+    } else if (img->compression == GUI_IMAGE_COMPRESSION_L8 || img->compression == GUI_IMAGE_COMPRESSION_L4) {
+        uint8_t l4 = img->compression == GUI_IMAGE_COMPRESSION_L4, c;
+        size_t stride = l4 ? ((size_t)img->x_size + 1) / 2 : (size_t)img->x_size;
+        gui_dim_t k;
+        
+        if (img->palette == NULL || img->size < stride * (size_t)img->y_size) {
+            return 0;
+        }
+        for (r = 0; r < img->y_size; r++, data += stride) {
+            for (k = 0; k < img->x_size; k++, out += bytes) {
+                c = l4 ? (uint8_t)((data[k >> 1] >> ((k & 0x01) ? 0 : 4)) & 0x0F) : data[k];
+                memcpy(out, &img->palette[(size_t)c * bytes], bytes);
+            }
+        }
+        return 1;
+    }
+    return 0;
+}
+
+#endif /* GUI_CFG_USE_IMAGE_COMPRESSION || __DOXYGEN__ */
+
+/**
+ * \brief           Set descriptor of decoded image from its source descriptor
+ * \param[in]       entry: Cache entry with source set, data follow aligned entry structure
+ */
+static void
+image_cache_setdesc(gui_image_cacheentry_t* entry) {
+    const gui_image_desc_t* img = entry->src;
+    gui_dim_t stride = img->x_size;
+    
+    if (img->compression == GUI_IMAGE_COMPRESSION_NONE && img->stride) {
+        stride = img->stride;                       /* Raw rows are read with padding and drawn in place */
+    }
+    memset(&entry->desc, 0x00, sizeof(entry->desc));
+    entry->desc.x_size = img->x_size;
+    entry->desc.y_size = img->y_size;
+    entry->desc.bpp = img->bpp;
+    entry->desc.image = ((uint8_t *)entry) + GUI_MEM_ALIGN(sizeof(*entry));
+    entry->desc.size = (size_t)stride * (size_t)img->y_size * (img->bpp >> 3);
+    entry->desc.flags = img->flags | GUI_FLAG_IMAGE_VOLATILE;   /* Entry memory is reused for other images */
+    entry->desc.stride = stride;
+}
+
+/**
+ * \brief           Get decoded raw image from cache, read and decode it when not cached yet
+ * \param[in]       img: Image descriptor with `read` function or \ref GUI_IMAGE_COMPRESSION_JPEG data
+ * \return          Descriptor of raw image in cache memory on success, `NULL` otherwise
+ */
+static const gui_image_desc_t*
+image_cache_get(const gui_image_desc_t* img) {
+    gui_image_cacheentry_t* entry;
+    uint8_t bytes = img->bpp >> 3, ok = 0;
+    size_t raw_size, memsize;
+    gui_dim_t stride = img->x_size;
+    uint8_t* ptr;
+    
+    /* Find entry and mark it as most recently used */
+    for (entry = (gui_image_cacheentry_t *)gui_linkedlist_getnext_gen(&GUI.root_images, NULL); entry != NULL;
+        entry = (gui_image_cacheentry_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)entry)) {
+        if (entry->src == img) {
+            if (GUI.root_images.last != (gui_linkedlist_t *)entry) {
+                gui_linkedlist_remove_gen(&GUI.root_images, (gui_linkedlist_t *)entry);
+                gui_linkedlist_add_gen(&GUI.root_images, (gui_linkedlist_t *)entry);
+            }
+            GUI_CACHE_HIT(GUI_CACHE_IMAGE);
+            return &entry->desc;
+        }
+    }
+    GUI_CACHE_MISS(GUI_CACHE_IMAGE);
+    
+    if (img->compression == GUI_IMAGE_COMPRESSION_NONE && img->stride) {
+        stride = img->stride;                       /* Raw rows are read with padding and drawn in place */
+    }
+    raw_size = (size_t)stride * (size_t)img->y_size * bytes;
+    memsize = GUI_MEM_ALIGN(sizeof(*entry)) + GUI_MEM_ALIGN(raw_size);
+    if (!raw_size || memsize > GUI_CFG_IMAGE_CACHE_SIZE) {
+        return NULL;
+    }
+    
+    /* Make space in cache by removing least recently used images */
+    while ((GUI.image_cache_size + memsize) > GUI_CACHE_BUDGET(GUI_CACHE_IMAGE, GUI_CFG_IMAGE_CACHE_SIZE) && image_cache_removelru()) {}
+#if GUI_CFG_USE_CACHE_RETAIN
+    entry = guii_retain_alloc(GUI_RETAIN_IMAGE, memsize);   /* Use region kept over reset first */
+#else /* GUI_CFG_USE_CACHE_RETAIN */
+    entry = NULL;
+#endif /* !GUI_CFG_USE_CACHE_RETAIN */
+    while (entry == NULL && (entry = GUI_MEMALLOC_CLASS(memsize, GUI_MEM_CLASS_PIXEL)) == NULL && image_cache_removelru()) {}
+    if (entry == NULL) {
+        return NULL;
+    }
+    ptr = ((uint8_t *)entry) + GUI_MEM_ALIGN(sizeof(*entry));
+    
+    /* Read and decode image, only once */
+    if (img->compression == GUI_IMAGE_COMPRESSION_NONE) {
+        ok = img->read(img, 0, ptr, raw_size);
+#if GUI_CFG_USE_IMAGE_COMPRESSION
+    } else if (img->read == NULL) {                 /* Memory mapped data are decoded in place */
+        ok = image_decode(img, img->image, ptr);
+    } else if (img->size) {
+        uint8_t* data;
+        
+        while ((data = GUI_MEMALLOC_FRAME(img->size)) == NULL && image_cache_removelru()) {}
+        if (data != NULL) {
+            ok = img->read(img, 0, data, img->size) && image_decode(img, data, ptr);
+            GUI_MEMFREE_FRAME(data);
+        }
+#endif /* GUI_CFG_USE_IMAGE_COMPRESSION */
+    }
+    if (!ok) {
+        image_cache_free(entry);
+        return NULL;
+    }
+    
+    entry->src = img;
+    entry->memsize = memsize;
+    image_cache_setdesc(entry);
+    gui_linkedlist_add_gen(&GUI.root_images, (gui_linkedlist_t *)entry);   /* Add entry as most recently used */
+    GUI.image_cache_size += memsize;
+#if GUI_CFG_USE_CACHE_RETAIN
+    guii_retain_commit(entry);                      /* Keep decoded image over reset */
+#endif /* GUI_CFG_USE_CACHE_RETAIN */
+    return &entry->desc;
+}
+
+#if GUI_CFG_USE_CACHE_RETAIN || __DOXYGEN__
+
+/**
+ * \brief           Add decoded image from retained region to cache
+ * \note            This function is private and may be called only when GUI is protected
+ * \param[in]       entry: Entry with valid source descriptor and data
+ * \return          `1` if entry was added, `0` when it does not fit to cache
+ */
+uint8_t
+guii_draw_image_cacheadopt(gui_image_cacheentry_t* entry) {
+    gui_image_cacheentry_t* e;
+    
+    if ((GUI.image_cache_size + entry->memsize) > GUI_CACHE_BUDGET(GUI_CACHE_IMAGE, GUI_CFG_IMAGE_CACHE_SIZE)) {
+        return 0;
+    }
+    for (e = (gui_image_cacheentry_t *)gui_linkedlist_getnext_gen(&GUI.root_images, NULL); e != NULL;
+        e = (gui_image_cacheentry_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)e)) {
+        if (e->src == entry->src) {
+            return 0;
+        }
+    }
+    image_cache_setdesc(entry);                     /* Descriptor is built again from source */
+    if (GUI_MEM_ALIGN(sizeof(*entry)) + GUI_MEM_ALIGN(entry->desc.size) != entry->memsize) {
+        return 0;
+    }
+    gui_linkedlist_add_gen(&GUI.root_images, (gui_linkedlist_t *)entry);
+    GUI.image_cache_size += entry->memsize;
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_CACHE_RETAIN || __DOXYGEN__ */
+
+#endif /* GUI_CFG_USE_IMAGE_CACHE || __DOXYGEN__ */
+
+/**
+ * \brief           Draw image to display of any depth and size
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       img: Pointer to \ref gui_image_desc_t structure with image description 
+ */
+void
+gui_draw_image(gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_desc_t* img) {
+    uint8_t bytes = img->bpp >> 3;                  /* Get number of bytes per pixel on image */
+    
+    gui_layer_t* layer;
+    const uint8_t* src;
+    const uint8_t* dst;
+    gui_dim_t width, height, stride;
+    gui_dim_t offlineSrc, offlineDst;
+    
+    DRAW_LIST_RECORD(DRAW_LIST_IMAGE, 0, x, y, 0, 0, 0, 0, 0, img, NULL, 0, gui_draw_image(disp, x, y, img));
+    
+    if (!img || !GUI_RECT_MATCH(
+        disp->x1, disp->y1, disp->x2, disp->y2,
+        x, y, x + img->x_size, y + img->y_size
+    )) {
+        return;
+    }
+    if (img->read != NULL || img->compression == GUI_IMAGE_COMPRESSION_JPEG) {   /* Image is not memory mapped or must be decoded as whole */
+#if GUI_CFG_USE_IMAGE_CACHE
+        img = image_cache_get(img);                 /* Use decoded copy from cache */
+        if (img == NULL) {
+            return;
+        }
+        bytes = img->bpp >> 3;
+#else /* GUI_CFG_USE_IMAGE_CACHE */
+        return;
+#endif /* !GUI_CFG_USE_IMAGE_CACHE */
+    }
+    if (img->compression != GUI_IMAGE_COMPRESSION_NONE) {
+#if GUI_CFG_USE_IMAGE_COMPRESSION
+        image_draw_compressed(disp, x, y, img);
+#endif /* GUI_CFG_USE_IMAGE_COMPRESSION */
+        return;
+    }
+    
+    layer = GUI.lcd.drawing_layer;                  /* Set layer pointer */
+    
+    stride = img->stride ? img->stride : img->x_size;   /* Get source row length */
+    width = img->x_size;                            /* Set default width */
+    height = img->y_size;                           /* Set default height */
+    
+    src = (uint8_t *)(img->image);                  /* Set source address */
+    dst = (uint8_t *)(((uint8_t *)layer->start_address) + GUI.lcd.pixel_size * ((y - layer->y_pos) * layer->width + (x - layer->x_pos)));
+    
+    //TODO: Check proper coordinates for memory!
+    if (y < disp->y1) {
+        src += (disp->y1 - y) * stride * bytes;     /* Set offset for number of image lines */
+        dst += (disp->y1 - y) * layer->width * GUI.lcd.pixel_size;  /* Set offset for number of layer lines */
+        height -= disp->y1 - y;                     /* Decrease effective height */
+    }
+    if ((y + img->y_size) > disp->y2) {
+        height -= y + img->y_size - disp->y2;       /* Decrease effective height */
+    }
+    if (x < disp->x1) {                             /* Set offset start address if required */
+        src += (disp->x1 - x) * bytes;              /* Set offset of start address in X direction */
+        dst += (disp->x1 - x) * GUI.lcd.pixel_size; /* Set offset of start address in X direction */
+        width -= disp->x1 - x;                      /* Decrease effective width */
+    }
+    if ((x + img->x_size) > disp->x2) {
+        width -= x + img->x_size - disp->x2;        /* Decrease effective width */
+    }
+    
+    offlineSrc = stride - width;                    /* Set offline source */
+    offlineDst = layer->width - width;              /* Set offline destination */
+    
+    /*******************/
+    /*    Draw image   */
+    /*******************/
+    if (bytes == 4) {                               /* Draw 32BPP image */
+        if (GUI_LL_ISSET(DrawImage32)) {            /* Draw image 32BPP if possible */
+            GUI_LL(DrawImage32)(&GUI.lcd, GUI.lcd.drawing_layer, img, (uint8_t *)dst, (const uint8_t *)src, width, height, offlineDst, offlineSrc);
+        }
+    } else if (bytes == 3) {                        /* Draw 24BPP image */
+        if (GUI_LL_ISSET(DrawImage24)) {            /* Draw image 24BPP if possible */
+            GUI_LL(DrawImage24)(&GUI.lcd, GUI.lcd.drawing_layer, img, (uint8_t *)dst, (const uint8_t *)src, width, height, offlineDst, offlineSrc);
+        }
+    } else if (bytes == 2) {                        /* Draw 16BPP image */
+        if (GUI_LL_ISSET(DrawImage16)) {            /* Draw image 16BPP if possible */
+            GUI_LL(DrawImage16)(&GUI.lcd, GUI.lcd.drawing_layer, img, (uint8_t *)dst, (const uint8_t *)src, width, height, offlineDst, offlineSrc);
+        }
+    }
+}
+
+/**
+ * \brief           Remove decoded image from image cache
+ *
+ *                  Must be called when image data on external storage change
+ *                  or before descriptor with `read` function is released.
+ *                  With \ref GUI_CFG_USE_LCD_ROTATION, pre-rotated copy of memory mapped image is removed too.
+ *
+ * \param[in]       img: Image descriptor to remove. Set to `NULL` to remove all images
+ * \return          `1` if at least one image was removed, `0` otherwise
+ */
+uint8_t
+gui_draw_image_cacheremove(const gui_image_desc_t* img) {
+    uint8_t ret = 0;
+#if GUI_CFG_USE_IMAGE_CACHE
+    gui_image_cacheentry_t* entry, *next;
+    
+    GUI_CORE_PROTECT(1);
+    for (entry = (gui_image_cacheentry_t *)gui_linkedlist_getnext_gen(&GUI.root_images, NULL); entry != NULL; entry = next) {
+        next = (gui_image_cacheentry_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)entry);
+        if (img == NULL || entry->src == img) {
+            image_cache_remove(entry);
+            ret = 1;
+        }
+    }
+    GUI_CORE_UNPROTECT(1);
+#else /* GUI_CFG_USE_IMAGE_CACHE */
+    GUI_UNUSED(img);
+#endif /* !GUI_CFG_USE_IMAGE_CACHE */
+#if GUI_CFG_USE_LCD_ROTATION
+    GUI_CORE_PROTECT(1);
+    ret = guii_lcd_rotation_cacheremove(img) || ret;
+    GUI_CORE_UNPROTECT(1);
+#endif /* GUI_CFG_USE_LCD_ROTATION */
+    return ret;
+}
+
+#if GUI_CFG_USE_SPRITE_CACHE || __DOXYGEN__
+
+/**
+ * \brief           Pre-rendered sprite in sprite cache, followed by key and pixels
+ */
+typedef struct {
+    gui_linkedlist_t list;                          /*!< Linked list entry, must be first on the list */
+    gui_image_desc_t img;                           /*!< `32BPP` image with rendered pixels */
+    size_t key_len;                                 /*!< Number of key bytes following entry */
+    size_t memsize;                                 /*!< Number of bytes allocated for entry */
+} gui_sprite_cacheentry_t;
+
+/**
+ * \brief           Remove least recently used sprite from cache
+ * \return          `1` if entry was removed, `0` if cache is empty
+ */
+static uint8_t
+sprite_cache_removelru(void) {
+    gui_sprite_cacheentry_t* entry;
+    
+    entry = (gui_sprite_cacheentry_t *)gui_linkedlist_getnext_gen(&GUI.root_sprites, NULL);
+    if (entry != NULL) {
+        gui_linkedlist_remove_gen(&GUI.root_sprites, (gui_linkedlist_t *)entry);
+        GUI.sprite_cache_size -= entry->memsize;
+        gui_lcd_fence();                            /* Sprite may still be used by queued low-level operation */
+        GUI_MEMFREE(entry);
+        return 1;
+    }
+    return 0;
+}
+
+#if GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__
+
+/**
+ * \brief           Remove least recently used sprite when heap allocation failed
+ * \note            This function is private and may be called only when GUI is protected
+ * \return          `1` if entry was removed, `0` if only most recently used entry is left, it may be in use
+ */
+uint8_t
+guii_draw_sprite_cachereclaim(void) {
+    if (GUI.root_sprites.first == GUI.root_sprites.last) {
+        return 0;
+    }
+    return sprite_cache_removelru();
+}
+
+#endif /* GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__ */
+
+/**
+ * \brief           Find sprite in cache and mark it as most recently used
+ * \param[in]       key: Sprite key
+ * \param[in]       key_len: Key length in units of bytes
+ * \param[in]       width: Sprite width
+ * \param[in]       height: Sprite height
+ * \return          Sprite entry on success, `NULL` if not in cache
+ */
+static gui_sprite_cacheentry_t *
+sprite_cache_find(const void* key, size_t key_len, gui_dim_t width, gui_dim_t height) {
+    gui_sprite_cacheentry_t* entry;
+    
+    for (entry = (gui_sprite_cacheentry_t *)gui_linkedlist_getnext_gen(&GUI.root_sprites, NULL); entry != NULL;
+        entry = (gui_sprite_cacheentry_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)entry)) {
+        if (entry->img.x_size == width && entry->img.y_size == height && entry->key_len == key_len
+            && !memcmp(entry + 1, key, key_len)) {
+            if (GUI.root_sprites.last != (gui_linkedlist_t *)entry) {
+                gui_linkedlist_remove_gen(&GUI.root_sprites, (gui_linkedlist_t *)entry);
+                gui_linkedlist_add_gen(&GUI.root_sprites, (gui_linkedlist_t *)entry);
+            }
+            GUI_CACHE_HIT(GUI_CACHE_SPRITE);
+            return entry;
+        }
+    }
+    GUI_CACHE_MISS(GUI_CACHE_SPRITE);
+    return NULL;
+}
+
+/**
+ * \brief           Allocate new sprite in cache, least recently used sprites are removed to make space
+ * \param[in]       key: Sprite key
+ * \param[in]       key_len: Key length in units of bytes
+ * \param[in]       width: Sprite width
+ * \param[in]       height: Sprite height
+ * \param[in]       bpp: Bits per pixel of sprite image
+ * \return          Sprite entry with uninitialized pixels on success, `NULL` otherwise
+ */
+static gui_sprite_cacheentry_t *
+sprite_cache_add(const void* key, size_t key_len, gui_dim_t width, gui_dim_t height, uint8_t bpp) {
+    gui_sprite_cacheentry_t* entry;
+    size_t hdr = GUI_MEM_ALIGN(sizeof(*entry) + key_len);
+    size_t size = (size_t)width * (size_t)height * (bpp >> 3);
+    
+    if (hdr + size > GUI_CFG_SPRITE_CACHE_SIZE) {
+        return NULL;
+    }
+    while ((GUI.sprite_cache_size + hdr + size) > GUI_CACHE_BUDGET(GUI_CACHE_SPRITE, GUI_CFG_SPRITE_CACHE_SIZE) && sprite_cache_removelru()) {}
+    while ((entry = GUI_MEMALLOC_CLASS(hdr + size, GUI_MEM_CLASS_PIXEL)) == NULL && sprite_cache_removelru()) {}
+    if (entry == NULL) {
+        return NULL;
+    }
+    memcpy(entry + 1, key, key_len);
+    entry->key_len = key_len;
+    entry->memsize = hdr + size;
+    entry->img.x_size = width;
+    entry->img.y_size = height;
+    entry->img.bpp = bpp;
+    entry->img.image = ((uint8_t *)entry) + hdr;
+    entry->img.size = size;
+    gui_linkedlist_add_gen(&GUI.root_sprites, (gui_linkedlist_t *)entry);   /* Add entry as most recently used */
+    GUI.sprite_cache_size += entry->memsize;
+    return entry;
+}
+
+/**
+ * \brief           Render sprite to its pixel memory
+ *
+ *                  Drawing layer is temporarily replaced with `ARGB8888` layer over sprite area,
+ *                  untouched pixels stay transparent. Pixels are then converted to `32BPP` image format.
+ *
+ * \param[in,out]   entry: Sprite entry with allocated pixels
+ * \param[in]       x: Absolute X position of sprite used while rendering
+ * \param[in]       y: Absolute Y position of sprite used while rendering
+ * \param[in]       key: Key passed to render function
+ * \param[in]       render: Function drawing sprite content
+ */
+static void
+sprite_render(gui_sprite_cacheentry_t* entry, gui_dim_t x, gui_dim_t y, const void* key, gui_draw_sprite_fn render) {
+    gui_layer_t layer, *drawing = GUI.lcd.drawing_layer;
+    uint8_t pixel_size = GUI.lcd.pixel_size, opaque = 1;
+    uint8_t* px = (uint8_t *)entry->img.image;
+    gui_display_t disp;
+    uint32_t c;
+    size_t i;
+#if GUI_CFG_USE_COVERAGE_MASK
+    uint8_t coverage = GUI.coverage.active;
+    
+    GUI.coverage.active = 0;                        /* Sprite misses content of children */
+#endif /* GUI_CFG_USE_COVERAGE_MASK */
+    
+    memset(&layer, 0x00, sizeof(layer));
+    layer.start_address = px;
+    layer.width = entry->img.x_size;
+    layer.height = entry->img.y_size;
+    layer.x_pos = x;
+    layer.y_pos = y;
+    layer.pixel_format = GUI_PIXEL_FORMAT_ARGB8888;
+    disp.x1 = x;
+    disp.y1 = y;
+    disp.x2 = x + layer.width;
+    disp.y2 = y + layer.height;
+    
+    GUI.lcd.drawing_layer = &layer;
+    GUI.lcd.pixel_size = 4;
+    render(&disp, x, y, key);
+    GUI.lcd.drawing_layer = drawing;
+    GUI.lcd.pixel_size = pixel_size;
+#if GUI_CFG_USE_COVERAGE_MASK
+    GUI.coverage.active = coverage;
+#endif /* GUI_CFG_USE_COVERAGE_MASK */
+    gui_lcd_fence();                                /* Pixels are read by CPU */
+    
+    /* Convert to R, G, B and inverted alpha bytes */
+    for (i = 0; i < (size_t)layer.width * (size_t)layer.height; i++, px += 4) {
+        memcpy(&c, px, sizeof(c));
+        px[0] = GUI_U8(c >> 16);
+        px[1] = GUI_U8(c >> 8);
+        px[2] = GUI_U8(c);
+        px[3] = GUI_U8(0xFF - (c >> 24));
+        opaque = opaque && px[3] == 0x00;
+    }
+    entry->img.flags = GUI_FLAG_IMAGE_VOLATILE | (opaque ? GUI_FLAG_IMAGE_OPAQUE : 0);
+}
+
+#endif /* GUI_CFG_USE_SPRITE_CACHE || __DOXYGEN__ */
+
+/**
+ * \brief           Draw small widget part from shared sprite cache
+ *
+ *                  Sprite is rendered once per unique key with `render` function
+ *                  and later drawn with single image blit. Key must describe
+ *                  everything which affects sprite look, such as widget type, colors and state,
+ *                  and must not contain uninitialized padding bytes. Pixels not drawn by `render`
+ *                  stay transparent, only non anti-aliased primitives must be used.
+ *
+ *                  When \ref GUI_CFG_USE_SPRITE_CACHE is disabled or sprite does not fit to cache,
+ *                  `render` draws directly to screen.
+ *
+ * \param[in]       disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Sprite width
+ * \param[in]       height: Sprite height
+ * \param[in]       key: Sprite key, passed also to `render` function
+ * \param[in]       key_len: Key length in units of bytes
+ * \param[in]       render: Function to draw sprite content at given position
+ */
+void
+guii_draw_sprite(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const void* key, size_t key_len, gui_draw_sprite_fn render) {
+#if GUI_CFG_USE_SPRITE_CACHE
+    gui_sprite_cacheentry_t* entry;
+    
+    if (width <= 0 || height <= 0 || !GUI_RECT_MATCH(
+        disp->x1, disp->y1, disp->x2, disp->y2,
+        x, y, x + width, y + height
+    )) {
+        return;
+    }
+#if GUI_CFG_USE_DISPLAY_LIST
+    if (draw_list_rec != NULL) {                    /* Record primitives to display list */
+        render(disp, x, y, key);
+        return;
+    }
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+    
+    if ((entry = sprite_cache_find(key, key_len, width, height)) == NULL) {
+        if ((entry = sprite_cache_add(key, key_len, width, height, 32)) == NULL) {
+            render(disp, x, y, key);                /* Does not fit to cache */
+            return;
+        }
+        sprite_render(entry, x, y, key, render);
+    }
+    gui_draw_image((gui_display_t *)disp, x, y, &entry->img);
+#else /* GUI_CFG_USE_SPRITE_CACHE */
+    GUI_UNUSED3(width, height, key_len);
+    render(disp, x, y, key);
+#endif /* !GUI_CFG_USE_SPRITE_CACHE */
+}
+
+#if GUI_CFG_USE_NINEPATCH || __DOXYGEN__
+
+/**
+ * \brief           Get run of destination pixels mapped to consecutive source pixels in one direction
+ * \param[in]       d: Destination offset from start of nine-patch
+ * \param[in]       size: Destination size
+ * \param[in]       src: Source image size
+ * \param[in]       lo: Size of left or top border
+ * \param[in]       hi: Size of right or bottom border
+ * \param[in]       tile: Set to `1` to repeat middle part instead of stretching it
+ * \param[out]      s: Source offset of first pixel in run
+ * \return          Number of pixels in run
+ */
+static gui_dim_t
+ninepatch_run(gui_dim_t d, gui_dim_t size, gui_dim_t src, gui_dim_t lo, gui_dim_t hi, uint8_t tile, gui_dim_t* s) {
+    int32_t mid_src = src - lo - hi, mid_dst, o, n;
+    
+    if (size < lo + hi) {                           /* Borders share available size when they do not fit */
+        lo = (gui_dim_t)(((int32_t)size * lo) / (lo + hi));
+        hi = size - lo;
+    }
+    if (d < lo) {                                   /* Left or top border */
+        *s = d;
+        return lo - d;
+    }
+    if (d >= size - hi) {                           /* Right or bottom border */
+        *s = src - (size - d);
+        return size - d;
+    }
+    mid_dst = size - lo - hi;
+    o = d - lo;
+    if (tile) {
+        *s = lo + (gui_dim_t)(o % mid_src);
+        n = mid_src - o % mid_src;
+    } else {                                        /* Sample at pixel centers, join pixels which map 1:1 */
+        *s = lo + (gui_dim_t)(((2 * o + 1) * mid_src) / (2 * mid_dst));
+        for (n = 1; o + n < mid_dst && lo + (gui_dim_t)(((2 * (o + n) + 1) * mid_src) / (2 * mid_dst)) == *s + n; n++) {}
+    }
+    return (gui_dim_t)GUI_MIN(n, mid_dst - o);
+}
+
+/**
+ * \brief           Draw rectangular part of image
+ * \param[in]       disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       img: Image descriptor
+ * \param[in]       sx: Left column of part in image
+ * \param[in]       sy: Top row of part in image
+ * \param[in]       x: Destination X position
+ * \param[in]       y: Destination Y position
+ * \param[in]       width: Part width
+ * \param[in]       height: Part height
+ */
+static void
+ninepatch_blit(const gui_display_t* disp, const gui_image_desc_t* img, gui_dim_t sx, gui_dim_t sy, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height) {
+    gui_display_t clip;
+    
+    clip.x1 = GUI_MAX(disp->x1, x);
+    clip.y1 = GUI_MAX(disp->y1, y);
+    clip.x2 = GUI_MIN(disp->x2, x + width);
+    clip.y2 = GUI_MIN(disp->y2, y + height);
+    if (clip.x1 < clip.x2 && clip.y1 < clip.y2) {
+        gui_draw_image(&clip, x - sx, y - sy, img);
+    }
+}
+
+#if GUI_CFG_USE_SPRITE_CACHE || __DOXYGEN__
+
+/**
+ * \brief           Get source image rows with middle columns stretched or tiled to drawing width
+ * \param[in]       np: Nine-patch descriptor
+ * \param[in]       width: Drawing width
+ * \return          Image of `width` columns and source rows on success, `NULL` otherwise
+ */
+static const gui_image_desc_t *
+ninepatch_getstrip(const gui_ninepatch_t* np, gui_dim_t width) {
+    const gui_image_desc_t* src = np->img;
+    gui_sprite_cacheentry_t* entry;
+    gui_dim_t dx, sx, n, row, stride;
+    size_t bytes = src->bpp >> 3;
+    uint8_t* out;
+    
+    if ((entry = sprite_cache_find(&np, sizeof(np), width, src->y_size)) != NULL) {
+        return &entry->img;
+    }
+    if (src->read != NULL || src->compression != GUI_IMAGE_COMPRESSION_NONE) {
+#if GUI_CFG_USE_IMAGE_CACHE
+        src = image_cache_get(src);                 /* Source pixels must be accessible */
+        if (src == NULL) {
+            return NULL;
+        }
+#else /* GUI_CFG_USE_IMAGE_CACHE */
+        return NULL;
+#endif /* !GUI_CFG_USE_IMAGE_CACHE */
+    }
+    if ((entry = sprite_cache_add(&np, sizeof(np), width, src->y_size, src->bpp)) == NULL) {
+        return NULL;
+    }
+    
+    /* Copy each run of columns for all rows */
+    out = (uint8_t *)entry->img.image;
+    stride = src->stride ? src->stride : src->x_size;
+    for (dx = 0; dx < width; dx += n) {
+        n = ninepatch_run(dx, width, src->x_size, np->left, np->right, GUI_U8(np->flags & GUI_FLAG_NINEPATCH_TILE_X), &sx);
+        for (row = 0; row < src->y_size; row++) {
+            memcpy(&out[((size_t)row * width + dx) * bytes], &src->image[((size_t)row * stride + sx) * bytes], n * bytes);
+        }
+    }
+    entry->img.flags = src->flags | GUI_FLAG_IMAGE_VOLATILE;
+    return &entry->img;
+}
+
+#endif /* GUI_CFG_USE_SPRITE_CACHE || __DOXYGEN__ */
+
+/**
+ * \brief           Draw nine-patch image scaled to rectangle
+ *
+ *                  Each row band of nine-patch is drawn with image blits only,
+ *                  which are accelerated by low-level driver when available.
+ *                  With \ref GUI_CFG_USE_SPRITE_CACHE enabled, source rows with stretched middle columns
+ *                  are cached per drawn width and each row band is single blit.
+ *                  Otherwise every run of columns is drawn separately.
+ *
+ * \note            Nine-patch descriptor and its image must not change while in use,
+ *                  cached rows are identified by descriptor address
+ * \param[in]       disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Drawing width
+ * \param[in]       height: Drawing height
+ * \param[in]       np: Nine-patch descriptor
+ */
+void
+gui_draw_ninepatch(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const gui_ninepatch_t* np) {
+    const gui_image_desc_t* img, *strip = NULL;
+    gui_dim_t dx, dy, sx, sy, n, m;
+    
+    DRAW_LIST_RECORD(DRAW_LIST_NINEPATCH, 0, x, y, width, height, 0, 0, 0, np, NULL, 0, gui_draw_ninepatch(disp, x, y, width, height, np));
+    
+    if (np == NULL || (img = np->img) == NULL || width <= 0 || height <= 0
+        || np->left < 0 || np->right < 0 || np->top < 0 || np->bottom < 0
+        || np->left + np->right >= img->x_size || np->top + np->bottom >= img->y_size
+        || !GUI_RECT_MATCH(
+            disp->x1, disp->y1, disp->x2, disp->y2,
+            x, y, x + width, y + height
+        )) {
+        return;
+    }
+#if GUI_CFG_USE_SPRITE_CACHE
+    strip = ninepatch_getstrip(np, width);
+#endif /* GUI_CFG_USE_SPRITE_CACHE */
+    
+    for (dy = 0; dy < height && y + dy < disp->y2; dy += n) {
+        n = ninepatch_run(dy, height, img->y_size, np->top, np->bottom, GUI_U8(np->flags & GUI_FLAG_NINEPATCH_TILE_Y), &sy);
+        if (y + dy + n <= disp->y1) {               /* Band is above clipping region */
+            continue;
+        }
+        if (strip != NULL) {
+            ninepatch_blit(disp, strip, 0, sy, x, y + dy, width, n);
+        } else {
+            for (dx = 0; dx < width && x + dx < disp->x2; dx += m) {
+                m = ninepatch_run(dx, width, img->x_size, np->left, np->right, GUI_U8(np->flags & GUI_FLAG_NINEPATCH_TILE_X), &sx);
+                if (x + dx + m > disp->x1) {
+                    ninepatch_blit(disp, img, sx, sy, x + dx, y + dy, m, n);
+                }
+            }
+        }
+    }
+}
+
+#endif /* GUI_CFG_USE_NINEPATCH || __DOXYGEN__ */
+
+#if GUI_CFG_USE_IMAGE_TRANSFORM || __DOXYGEN__
+
+/**
+ * \brief           Transformed image drawing context
+ *
+ *                  Destination pixel center `(x, y)` relative to drawing position maps
+ *                  to source position `u = u0 + m[0] * x + m[1] * y` and `v = v0 + m[2] * x + m[3] * y`,
+ *                  all values are in `16.16` fixed point format
+ */
+typedef struct {
+    const gui_image_desc_t* img;                    /*!< Raw source image */
+    size_t stride;                                  /*!< Distance between source rows in units of bytes */
+    int32_t m[4];                                   /*!< Inverse transformation matrix */
+    int64_t u0;                                     /*!< Source X position of destination pixel `(0, 0)` */
+    int64_t v0;                                     /*!< Source Y position of destination pixel `(0, 0)` */
+    int64_t umax;                                   /*!< Source positions must be lower than this value */
+    int64_t vmax;                                   /*!< Source positions must be lower than this value */
+    ptrdiff_t step;                                 /*!< Source byte step per destination pixel when mapping is exactly `1:1`, `0` otherwise */
+    uint8_t bilinear;                               /*!< Set to `1` when bilinear filter is used */
+    uint8_t flags;                                  /*!< Image flags of rendered rows */
+} gui_transform_ctx_t;
+
+/**
+ * \brief           Divide and round result towards negative infinity
+ * \param[in]       a: Dividend
+ * \param[in]       b: Divisor, must be positive
+ * \return          Rounded quotient
+ */
+static int64_t
+transform_floordiv(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    
+    if ((a % b) != 0 && a < 0) {
+        q--;
+    }
+    return q;
+}
+
+/**
+ * \brief           Limit destination range to pixels with source position inside image
+ *
+ *                  Range of `x` is limited so that `0 <= c0 + d * x < max`
+ *
+ * \param[in]       c0: Source position at `x = 0`
+ * \param[in]       d: Source position step per destination pixel
+ * \param[in]       max: End of valid source positions
+ * \param[in,out]   lo: First pixel of range
+ * \param[in,out]   hi: End of range
+ */
+static void
+transform_range(int64_t c0, int32_t d, int64_t max, gui_dim_t* lo, gui_dim_t* hi) {
+    int64_t l, h;
+    
+    if (d == 0) {
+        if (c0 < 0 || c0 >= max) {
+            *hi = *lo;
+        }
+        return;
+    }
+    if (d > 0) {
+        l = -transform_floordiv(c0, d);
+        h = transform_floordiv(max - 1 - c0, d) + 1;
+    } else {
+        l = transform_floordiv(c0 - max, -(int64_t)d) + 1;
+        h = transform_floordiv(c0, -(int64_t)d) + 1;
+    }
+    if (l > *lo) {
+        *lo = (gui_dim_t)GUI_MIN(l, *hi);
+    }
+    if (h < *hi) {
+        *hi = (gui_dim_t)GUI_MAX(h, *lo);
+    }
+}
+
+/**
+ * \brief           Read source pixel
+ * \param[in]       t: Transformation context
+ * \param[in]       p: Pointer to pixel in source image
+ * \return          Pixel with red in lowest byte, followed by green, blue and opacity
+ */
+static uint32_t
+transform_fetch(const gui_transform_ctx_t* t, const uint8_t* p) {
+    uint16_t c;
+    
+    if (t->img->bpp == 32) {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)(0xFF - p[3]) << 24);
+    } else if (t->img->bpp == 24) {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | 0xFF000000UL;
+    }
+    memcpy(&c, p, sizeof(c));
+    return GUI_COLOR_FROM_RGB565((uint32_t)c);      /* Red is in low bits of 16BPP image */
+}
+
+/**
+ * \brief           Read source pixel for bilinear filter, pixels outside image are transparent
+ * \param[in]       t: Transformation context
+ * \param[in]       x: Source X position, may be outside image by `1` pixel
+ * \param[in]       y: Source Y position, may be outside image by `1` pixel
+ * \return          Pixel with red in lowest byte, followed by green, blue and opacity
+ */
+GUI_CFG_FAST_CODE static uint32_t
+transform_texel(const gui_transform_ctx_t* t, int32_t x, int32_t y) {
+    uint8_t inside = 1;
+    uint32_t c;
+    
+    if (x < 0 || x >= t->img->x_size) {
+        x = x < 0 ? 0 : t->img->x_size - 1;
+        inside = 0;
+    }
+    if (y < 0 || y >= t->img->y_size) {
+        y = y < 0 ? 0 : t->img->y_size - 1;
+        inside = 0;
+    }
+    c = transform_fetch(t, &t->img->image[(size_t)y * t->stride + (size_t)x * (t->img->bpp >> 3)]);
+    if (!inside) {                                  /* Keep color of edge and remove its opacity */
+        c = (t->img->flags & GUI_FLAG_IMAGE_PREMULTIPLIED) ? 0 : (c & 0x00FFFFFFUL);
+    }
+    return c;
+}
+
+/**
+ * \brief           Interpolate all `4` channels of `2` pixels
+ * \param[in]       a: First pixel
+ * \param[in]       b: Second pixel
+ * \param[in]       w: Weight of second pixel between `0` and `255`
+ * \return          Interpolated pixel
+ */
+static uint32_t
+transform_lerp(uint32_t a, uint32_t b, uint32_t w) {
+    uint32_t rb = ((a & 0x00FF00FFUL) * (256 - w) + (b & 0x00FF00FFUL) * w) >> 8;
+    uint32_t ag = ((a >> 8) & 0x00FF00FFUL) * (256 - w) + ((b >> 8) & 0x00FF00FFUL) * w;
+    
+    return (rb & 0x00FF00FFUL) | (ag & 0xFF00FF00UL);
+}
+
+/**
+ * \brief           Render one destination row of transformed image
+ * \param[in]       t: Transformation context
+ * \param[in]       y: Row relative to drawing position
+ * \param[in]       x1: First column to render relative to drawing position
+ * \param[in]       x2: End column to render relative to drawing position
+ * \param[out]      lo: First rendered column
+ * \param[out]      hi: End of rendered columns
+ * \param[out]      out: `32BPP` pixels of row, first pixel is for column `x1`
+ * \return          `1` if at least one pixel was rendered, `0` otherwise
+ */
+GUI_CFG_FAST_CODE static uint8_t
+transform_row(const gui_transform_ctx_t* t, gui_dim_t y, gui_dim_t x1, gui_dim_t x2, gui_dim_t* lo, gui_dim_t* hi, uint8_t* out) {
+    int64_t u = t->u0 + (int64_t)t->m[1] * y, v = t->v0 + (int64_t)t->m[3] * y;
+    const uint8_t* p;
+    uint8_t bytes = t->img->bpp >> 3;
+    int32_t qu, qv;
+    uint32_t c;
+    gui_dim_t l = x1, h = x2, i;
+    
+    /* Clip row to pixels inside source image, with exactly the same math as below */
+    transform_range(u, t->m[0], t->umax, &l, &h);
+    transform_range(v, t->m[2], t->vmax, &l, &h);
+    if (l >= h) {
+        return 0;
+    }
+    qu = (int32_t)(u + (int64_t)t->m[0] * l);
+    qv = (int32_t)(v + (int64_t)t->m[2] * l);
+    out += (size_t)(l - x1) * 4;
+    
+    if (t->bilinear) {                              /* Position of right neighbour and its weight */
+        for (i = l; i < h; i++, out += 4, qu += t->m[0], qv += t->m[2]) {
+            int32_t sx = qu >> 16, sy = qv >> 16;
+            uint32_t fx = (qu >> 8) & 0xFF, fy = (qv >> 8) & 0xFF;
+            
+            c = transform_lerp(
+                transform_lerp(transform_texel(t, sx - 1, sy - 1), transform_texel(t, sx, sy - 1), fx),
+                transform_lerp(transform_texel(t, sx - 1, sy), transform_texel(t, sx, sy), fx), fy
+            );
+            out[0] = GUI_U8(c);
+            out[1] = GUI_U8(c >> 8);
+            out[2] = GUI_U8(c >> 16);
+            out[3] = GUI_U8(0xFF - (c >> 24));
+        }
+    } else {
+        p = &t->img->image[(size_t)(qv >> 16) * t->stride + (size_t)(qu >> 16) * bytes];
+        for (i = l; i < h; i++, out += 4) {
+            if (t->step) {                          /* Rotation by multiple of 90 degrees */
+                c = transform_fetch(t, p);
+                p += t->step;
+            } else {
+                c = transform_fetch(t, &t->img->image[(size_t)(qv >> 16) * t->stride + (size_t)(qu >> 16) * bytes]);
+                qu += t->m[0];
+                qv += t->m[2];
+            }
+            out[0] = GUI_U8(c);
+            out[1] = GUI_U8(c >> 8);
+            out[2] = GUI_U8(c >> 16);
+            out[3] = GUI_U8(0xFF - (c >> 24));
+        }
+    }
+    *lo = l;
+    *hi = h;
+    return 1;
+}
+
+/**
+ * \brief           Prepare transformation context and bounding box of transformed image
+ * \param[out]      t: Transformation context
+ * \param[in]       img: Source image
+ * \param[in]       tr: Transformation
+ * \param[out]      box: Bounding box relative to drawing position, as left, top, right and bottom
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+transform_init(gui_transform_ctx_t* t, const gui_image_desc_t* img, const gui_image_transform_t* tr, gui_dim_t* box) {
+    int32_t s, c, fa, fb, fc, fd;
+    int64_t px, py, min_x = INT64_MAX, min_y = INT64_MAX, max_x = INT64_MIN, max_y = INT64_MIN;
+    uint8_t i;
+    
+    if (img->read != NULL || img->compression != GUI_IMAGE_COMPRESSION_NONE) {
+#if GUI_CFG_USE_IMAGE_CACHE
+        img = image_cache_get(img);                 /* Source pixels must be accessible */
+        if (img == NULL) {
+            return 0;
+        }
+#else /* GUI_CFG_USE_IMAGE_CACHE */
+        return 0;
+#endif /* !GUI_CFG_USE_IMAGE_CACHE */
+    }
+    if ((img->bpp != 16 && img->bpp != 24 && img->bpp != 32)
+        || img->x_size <= 0 || img->y_size <= 0 || img->x_size >= 0x4000 || img->y_size >= 0x4000) {
+        return 0;
+    }
+    
+    memset(t, 0x00, sizeof(*t));
+    t->img = img;
+    t->stride = (size_t)(img->stride ? img->stride : img->x_size) * (img->bpp >> 3);
+    t->bilinear = GUI_U8(tr->flags & GUI_FLAG_TRANSFORM_BILINEAR);
+    gui_math_isincos(tr->angle, &s, &c);
+    
+    /* Inverse of rotation after scale */
+    t->m[0] = (c * 256) / tr->scale_x;
+    t->m[1] = (s * 256) / tr->scale_x;
+    t->m[2] = (-s * 256) / tr->scale_y;
+    t->m[3] = (c * 256) / tr->scale_y;
+    t->u0 = ((int64_t)tr->pivot_x << 16) + (t->m[0] + t->m[1]) / 2; /* Sample at pixel centers */
+    t->v0 = ((int64_t)tr->pivot_y << 16) + (t->m[2] + t->m[3]) / 2;
+    t->umax = (int64_t)img->x_size << 16;
+    t->vmax = (int64_t)img->y_size << 16;
+    if (t->bilinear) {                              /* Neighbours outside image by 1 pixel contribute to edges */
+        t->u0 += 0x8000;
+        t->v0 += 0x8000;
+        t->umax += 0x10000;
+        t->vmax += 0x10000;
+        t->flags = img->flags & GUI_FLAG_IMAGE_PREMULTIPLIED;
+    } else {
+        if (img->bpp < 32 || (img->flags & GUI_FLAG_IMAGE_OPAQUE)) {
+            t->flags = GUI_FLAG_IMAGE_OPAQUE;
+        } else {
+            t->flags = img->flags & GUI_FLAG_IMAGE_PREMULTIPLIED;
+        }
+        if (!(t->m[0] & 0xFFFF) && !(t->m[2] & 0xFFFF) && !(t->m[1] & 0xFFFF) && !(t->m[3] & 0xFFFF)) {
+            t->step = (ptrdiff_t)(t->m[0] / 0x10000) * (img->bpp >> 3) + (ptrdiff_t)(t->m[2] / 0x10000) * (ptrdiff_t)t->stride;
+        }
+    }
+    
+    /* Forward transformation of image corners gives bounding box */
+    fa = (int32_t)(((int64_t)c * tr->scale_x) >> 8);
+    fb = (int32_t)((-(int64_t)s * tr->scale_y) >> 8);
+    fc = (int32_t)(((int64_t)s * tr->scale_x) >> 8);
+    fd = (int32_t)(((int64_t)c * tr->scale_y) >> 8);
+    for (i = 0; i < 4; i++) {
+        int64_t cx = (i & 0x01) ? img->x_size - tr->pivot_x : -tr->pivot_x;
+        int64_t cy = (i & 0x02) ? img->y_size - tr->pivot_y : -tr->pivot_y;
+        
+        px = fa * cx + fb * cy;
+        py = fc * cx + fd * cy;
+        min_x = GUI_MIN(min_x, px);
+        max_x = GUI_MAX(max_x, px);
+        min_y = GUI_MIN(min_y, py);
+        max_y = GUI_MAX(max_y, py);
+    }
+    box[0] = (gui_dim_t)GUI_MAX(transform_floordiv(min_x, 0x10000) - 1, -0x3FFF);
+    box[1] = (gui_dim_t)GUI_MAX(transform_floordiv(min_y, 0x10000) - 1, -0x3FFF);
+    box[2] = (gui_dim_t)GUI_MIN(transform_floordiv(max_x, 0x10000) + 2, 0x3FFF);
+    box[3] = (gui_dim_t)GUI_MIN(transform_floordiv(max_y, 0x10000) + 2, 0x3FFF);
+    return box[0] < box[2] && box[1] < box[3];
+}
+
+/**
+ * \brief           Draw image scaled and rotated around pivot point
+ *
+ *                  Each destination row is limited to pixels inside source image and clipping region,
+ *                  only those pixels are sampled in fixed point and blended with image blit.
+ *                  Images which are only moved are drawn by \ref gui_draw_image directly.
+ *                  Rotations by multiple of `90` degrees without scaling copy source pixels without sampling.
+ *
+ *                  With \ref GUI_FLAG_TRANSFORM_CACHE flag and \ref GUI_CFG_USE_SPRITE_CACHE enabled,
+ *                  whole transformed image is kept in sprite cache and later draws are single image blit.
+ *                  Cached images are identified by image descriptor address and transformation.
+ *
+ * \note            Images not memory mapped or compressed are transformed from image cache only
+ * \param[in]       disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: X position of image pivot point
+ * \param[in]       y: Y position of image pivot point
+ * \param[in]       img: Pointer to \ref gui_image_desc_t structure with image description
+ * \param[in]       tr: Scale and rotation to apply
+ */
+void
+gui_draw_image_transform(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_desc_t* img, const gui_image_transform_t* tr) {
+    gui_transform_ctx_t t;
+    gui_image_desc_t row;
+    gui_dim_t box[4], x1, y1, x2, y2, lo, hi, width, rows, ry, i;
+    uint8_t* buff;
+#if GUI_CFG_USE_LL_GPU
+    gui_display_t clip;
+#endif /* GUI_CFG_USE_LL_GPU */
+    
+    DRAW_LIST_RECORD(DRAW_LIST_IMAGE_TRANSFORM, 0, x, y, 0, 0, 0, 0, 0, img, tr, sizeof(*tr), gui_draw_image_transform(disp, x, y, img, tr));
+    
+    if (img == NULL || tr == NULL || !tr->scale_x || !tr->scale_y) {
+        return;
+    }
+    if (!(tr->angle % 3600) && tr->scale_x == 256 && tr->scale_y == 256) {
+        gui_draw_image((gui_display_t *)disp, x - tr->pivot_x, y - tr->pivot_y, img);   /* Only moved */
+        return;
+    }
+    if (!transform_init(&t, img, tr, box) || !GUI_RECT_MATCH(
+        disp->x1, disp->y1, disp->x2, disp->y2,
+        x + box[0], y + box[1], x + box[2], y + box[3]
+    )) {
+        return;
+    }
+#if GUI_CFG_USE_LL_GPU
+    if (GUI_LL_ISSET(BlitTransform) && gpu_clip(disp, &clip)) {
+        clip.x1 = GUI_MAX(clip.x1, x + box[0] - GUI.lcd.drawing_layer->x_pos);  /* Limit to transformed image */
+        clip.y1 = GUI_MAX(clip.y1, y + box[1] - GUI.lcd.drawing_layer->y_pos);
+        clip.x2 = GUI_MIN(clip.x2, x + box[2] - GUI.lcd.drawing_layer->x_pos);
+        clip.y2 = GUI_MIN(clip.y2, y + box[3] - GUI.lcd.drawing_layer->y_pos);
+        if (clip.x1 >= clip.x2 || clip.y1 >= clip.y2
+            || GUI_LL(BlitTransform)(&GUI.lcd, GUI.lcd.drawing_layer, &clip, img, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos, tr)) {
+            return;
+        }
+    }
+#endif /* GUI_CFG_USE_LL_GPU */
+    
+#if GUI_CFG_USE_SPRITE_CACHE
+    if (tr->flags & GUI_FLAG_TRANSFORM_CACHE) {
+        gui_sprite_cacheentry_t* entry;
+        size_t n;
+        struct {
+            const gui_image_desc_t* img;
+            gui_image_transform_t tr;
+        } key;
+        
+        memset(&key, 0x00, sizeof(key));            /* Key must not contain uninitialized padding */
+        key.img = img;
+        key.tr.angle = tr->angle;
+        key.tr.scale_x = tr->scale_x;
+        key.tr.scale_y = tr->scale_y;
+        key.tr.pivot_x = tr->pivot_x;
+        key.tr.pivot_y = tr->pivot_y;
+        key.tr.flags = tr->flags;
+        width = box[2] - box[0];
+        rows = box[3] - box[1];
+        if ((entry = sprite_cache_find(&key, sizeof(key), width, rows)) == NULL
+            && (entry = sprite_cache_add(&key, sizeof(key), width, rows, 32)) != NULL) {
+            buff = (uint8_t *)entry->img.image;
+            for (n = 3; n < entry->img.size; n += 4) {
+                buff[n] = 0xFF;                     /* Fully transparent */
+            }
+            for (ry = 0; ry < rows; ry++) {
+                transform_row(&t, box[1] + ry, box[0], box[2], &lo, &hi, &buff[(size_t)ry * width * 4]);
+            }
+            entry->img.flags = (t.flags & GUI_FLAG_IMAGE_PREMULTIPLIED) | GUI_FLAG_IMAGE_VOLATILE;
+        }
+        if (entry != NULL) {
+            gui_draw_image((gui_display_t *)disp, x + box[0], y + box[1], &entry->img);
+            return;
+        }
+    }
+#endif /* GUI_CFG_USE_SPRITE_CACHE */
+    
+    /* Render only visible part, in bands of rows */
+    x1 = GUI_MAX(box[0], disp->x1 - x);
+    y1 = GUI_MAX(box[1], disp->y1 - y);
+    x2 = GUI_MIN(box[2], disp->x2 - x);
+    y2 = GUI_MIN(box[3], disp->y2 - y);
+    width = x2 - x1;
+    rows = (gui_dim_t)GUI_MIN(y2 - y1, GUI_MAX(1, GUI_CFG_IMAGE_TRANSFORM_BUFFER_SIZE / ((size_t)width * 4)));
+    if ((buff = GUI_MEMALLOC_FRAME((size_t)width * rows * 4)) == NULL) {
+        rows = 1;
+        if ((buff = GUI_MEMALLOC_FRAME((size_t)width * 4)) == NULL) {
+            return;
+        }
+    }
+    memset(&row, 0x00, sizeof(row));
+    row.y_size = 1;
+    row.bpp = 32;
+    row.flags = t.flags | GUI_FLAG_IMAGE_VOLATILE;
+    for (ry = y1; ry < y2; ry++) {
+        i = (ry - y1) % rows;
+        if (!i && ry != y1) {
+            gui_lcd_fence();                        /* Band buffer is still read by previous blits */
+        }
+        if (transform_row(&t, ry, x1, x2, &lo, &hi, &buff[(size_t)i * width * 4])) {
+            row.x_size = hi - lo;
+            row.image = &buff[((size_t)i * width + (lo - x1)) * 4];
+            row.size = (size_t)row.x_size * 4;
+            gui_draw_image((gui_display_t *)disp, x + lo, y + ry, &row);
+        }
+    }
+    gui_lcd_fence();
+    GUI_MEMFREE_FRAME(buff);
+}
+
+#endif /* GUI_CFG_USE_IMAGE_TRANSFORM || __DOXYGEN__ */
+
+/**
+ * \brief           Draw polygon lines
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       points: Pointer to array of \ref gui_draw_poly_t points to draw lines between
+ * \param[in]       len: Number of points in array. There must be at least 2 points
+ * \param[in]       color: Color to use for drawing 
+ */
+void
+gui_draw_poly(const gui_display_t* disp, const gui_draw_poly_t* points, size_t len, gui_color_t color) {
+    gui_dim_t x = 0, y = 0;
+
+    DRAW_LIST_RECORD(DRAW_LIST_POLY, 0, len, 0, 0, 0, 0, 0, color, NULL, points, len * sizeof(*points), gui_draw_poly(disp, points, len, color));
+    
+    if (len < 2) {
+        return;
+    }
+
+    gui_draw_line(disp, points->x, points->y, (points + len - 1)->x, (points + len - 1)->y, color);
 
-        if (c & GUI_DRAW_CIRCLE_TL) {               /* Top left corner */
-            gui_draw_setpixel(disp, x0 - y, y0 - x, color);
-            gui_draw_setpixel(disp, x0 - x, y0 - y, color);
-        }
+    while (--len) {
+        x = points->x;
+        y = points->y;
+        points++;
+        gui_draw_line(disp, x, y, points->x, points->y, color);
+    }
+}
 
-        if (c & GUI_DRAW_CIRCLE_TR) {               /* Top right corner */
-            gui_draw_setpixel(disp, x0 + x, y0 - y, color);
-            gui_draw_setpixel(disp, x0 + y, y0 - x, color);
+#if GUI_CFG_USE_VECTOR_ICON || __DOXYGEN__
+
+/**
+ * \brief           Edge of flattened icon path in units of pixels
+ */
+typedef struct {
+    float x0;                                       /*!< Start X position */
+    float y0;                                       /*!< Start Y position */
+    float x1;                                       /*!< End X position */
+    float y1;                                       /*!< End Y position */
+} gui_icon_edge_t;
+
+/**
+ * \brief           Add edge to list, horizontal edges do not contribute to coverage and are skipped
+ * \param[out]      edges: Array of edges, set to `NULL` to only count edges
+ * \param[in,out]   cnt: Number of edges in array
+ * \param[in]       x0: Start X position
+ * \param[in]       y0: Start Y position
+ * \param[in]       x1: End X position
+ * \param[in]       y1: End Y position
+ */
+static void
+icon_edge_add(gui_icon_edge_t* edges, size_t* cnt, float x0, float y0, float x1, float y1) {
+    if (y0 == y1) {
+        return;
+    }
+    if (edges != NULL) {
+        edges[*cnt].x0 = x0;
+        edges[*cnt].y0 = y0;
+        edges[*cnt].x1 = x1;
+        edges[*cnt].y1 = y1;
+    }
+    (*cnt)++;
+}
+
+/**
+ * \brief           Scale icon path to pixels and flatten curves to edges
+ * \param[in]       icon: Vector icon
+ * \param[in]       sx: Horizontal scale from design grid to pixels
+ * \param[in]       sy: Vertical scale from design grid to pixels
+ * \param[out]      edges: Array of edges, set to `NULL` to only count edges
+ * \return          Number of edges
+ */
+static size_t
+icon_flatten(const gui_icon_t* icon, float sx, float sy, gui_icon_edge_t* edges) {
+    const uint8_t* p = icon->path;
+    float px[4], py[4], x = 0, y = 0, mx = 0, my = 0, t, u, nx, ny, len;
+    uint8_t cmd, n, k, segs;
+    size_t cnt = 0;
+    
+    for (;;) {
+        cmd = *p++;
+        if (cmd == GUI_ICON_CMD_MOVE || cmd == GUI_ICON_CMD_END || cmd > GUI_ICON_CMD_CUBIC) {
+            icon_edge_add(edges, &cnt, x, y, mx, my);   /* Close previous contour */
+            if (cmd != GUI_ICON_CMD_MOVE) {
+                break;                              /* End of path */
+            }
+            x = mx = p[0] * sx;
+            y = my = p[1] * sy;
+            p += 2;
+            continue;
+        }
+        
+        n = cmd - GUI_ICON_CMD_LINE + 1;            /* Number of points of command */
+        px[0] = x;
+        py[0] = y;
+        len = 0;
+        for (k = 1; k <= n; k++, p += 2) {
+            px[k] = p[0] * sx;
+            py[k] = p[1] * sy;
+            len += GUI_ABS(px[k] - px[k - 1]) + GUI_ABS(py[k] - py[k - 1]);
         }
+        
+        /* Curves are split to segments of about 3 pixels */
+        segs = n == 1 ? 1 : (uint8_t)GUI_MIN(len / 3.0f + 2.0f, 24.0f);
+        for (k = 1; k <= segs; k++) {
+            t = (float)k / (float)segs;
+            u = 1.0f - t;
+            if (n == 1) {
+                nx = px[1];
+                ny = py[1];
+            } else if (n == 2) {
+                nx = u * u * px[0] + 2.0f * u * t * px[1] + t * t * px[2];
+                ny = u * u * py[0] + 2.0f * u * t * py[1] + t * t * py[2];
+            } else {
+                nx = u * u * u * px[0] + 3.0f * u * u * t * px[1] + 3.0f * u * t * t * px[2] + t * t * t * px[3];
+                ny = u * u * u * py[0] + 3.0f * u * u * t * py[1] + 3.0f * u * t * t * py[2] + t * t * t * py[3];
+            }
+            icon_edge_add(edges, &cnt, x, y, nx, ny);
+            x = nx;
+            y = ny;
+        }
+    }
+    return cnt;
+}
 
-        if (c & GUI_DRAW_CIRCLE_BR) {               /* Bottom right corner */
-            gui_draw_setpixel(disp, x0 + x, y0 + y, color);
-            gui_draw_setpixel(disp, x0 + y, y0 + x, color);
+/**
+ * \brief           Accumulate signed area of edge part inside single row
+ *
+ *                  Prefix sum of accumulated values over row is coverage of each pixel.
+ *
+ * \param[in,out]   acc: Accumulation buffer of `width + 2` entries
+ * \param[in]       width: Row width in units of pixels
+ * \param[in]       e: Edge to accumulate
+ * \param[in]       row: Row index
+ */
+GUI_CFG_FAST_CODE static void
+icon_edge_row(float* acc, gui_dim_t width, const gui_icon_edge_t* e, gui_dim_t row) {
+    float x0, y0, x1, y1, dir, ya, yb, xa, xb, lo, hi, d, s, a0, a1, a2, am, f0, f1;
+    gui_dim_t i0, i1, i;
+    
+    if (e->y0 < e->y1) {
+        dir = 1.0f;
+        x0 = e->x0;
+        y0 = e->y0;
+        x1 = e->x1;
+        y1 = e->y1;
+    } else {
+        dir = -1.0f;                                /* Edge going up, swap points */
+        x0 = e->x1;
+        y0 = e->y1;
+        x1 = e->x0;
+        y1 = e->y0;
+    }
+    ya = GUI_MAX(y0, (float)row);
+    yb = GUI_MIN(y1, (float)(row + 1));
+    if (ya >= yb) {
+        return;                                     /* Edge does not cross row */
+    }
+    xa = x0 + (ya - y0) * (x1 - x0) / (y1 - y0);
+    xb = x0 + (yb - y0) * (x1 - x0) / (y1 - y0);
+    xa = GUI_MIN(GUI_MAX(xa, 0.0f), (float)width);
+    xb = GUI_MIN(GUI_MAX(xb, 0.0f), (float)width);
+    d = (yb - ya) * dir;
+    lo = GUI_MIN(xa, xb);
+    hi = GUI_MAX(xa, xb);
+    i0 = (gui_dim_t)lo;                             /* Floor, positions are not negative */
+    i1 = (gui_dim_t)hi;
+    if ((float)i1 < hi) {                           /* Ceil */
+        i1++;
+    }
+    
+    if (i1 <= i0 + 1) {                             /* Edge part is inside single column */
+        am = 0.5f * (xa + xb) - (float)i0;
+        acc[i0] += d - d * am;
+        acc[i0 + 1] += d * am;
+    } else {
+        s = 1.0f / (hi - lo);
+        f0 = lo - (float)i0;
+        f1 = hi - (float)i1 + 1.0f;
+        a0 = 0.5f * s * (1.0f - f0) * (1.0f - f0);
+        am = 0.5f * s * f1 * f1;
+        acc[i0] += d * a0;
+        if (i1 == i0 + 2) {
+            acc[i0 + 1] += d * (1.0f - a0 - am);
+        } else {
+            a1 = s * (1.5f - f0);
+            acc[i0 + 1] += d * (a1 - a0);
+            for (i = i0 + 2; i < i1 - 1; i++) {
+                acc[i] += d * s;
+            }
+            a2 = a1 + (float)(i1 - i0 - 3) * s;
+            acc[i1 - 1] += d * (1.0f - a2 - am);
         }
+        acc[i1] += d * am;
+    }
+}
 
-        if (c & GUI_DRAW_CIRCLE_BL) {               /* Bottom left corner */
-            gui_draw_setpixel(disp, x0 - x, y0 + y, color);
-            gui_draw_setpixel(disp, x0 - y, y0 + x, color);
+/**
+ * \brief           Rasterize vector icon to `A8` coverage values
+ * \param[in]       icon: Vector icon
+ * \param[in]       width: Output width in units of pixels
+ * \param[in]       height: Output height in units of pixels
+ * \param[out]      out: Output buffer of `width * height` values
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+guii_draw_icon_rasterize(const gui_icon_t* icon, gui_dim_t width, gui_dim_t height, uint8_t* out) {
+    gui_icon_edge_t* edges;
+    float sx, sy, sum, * acc;
+    size_t cnt, i;
+    gui_dim_t x, y;
+    
+    if (icon->path == NULL || !icon->width || !icon->height) {
+        return 0;
+    }
+    sx = (float)width / (float)icon->width;
+    sy = (float)height / (float)icon->height;
+    
+    /* Count edges first to allocate exact memory for them and single row accumulator */
+    cnt = icon_flatten(icon, sx, sy, NULL);
+    edges = GUI_MEMALLOC_FRAME(cnt * sizeof(*edges) + ((size_t)width + 2) * sizeof(*acc));
+    if (edges == NULL) {
+        return 0;
+    }
+    acc = (float *)&edges[cnt];
+    icon_flatten(icon, sx, sy, edges);
+    
+    for (y = 0; y < height; y++, out += width) {
+        memset(acc, 0x00, ((size_t)width + 2) * sizeof(*acc));
+        for (i = 0; i < cnt; i++) {
+            icon_edge_row(acc, width, &edges[i], y);
+        }
+        for (sum = 0, x = 0; x < width; x++) {
+            sum += acc[x];
+            out[x] = GUI_ABS(sum) >= 1.0f ? 0xFF : GUI_U8(GUI_ABS(sum) * 255.0f + 0.5f);
         }
     }
+    GUI_MEMFREE_FRAME(edges);
+    return 1;
 }
 
 /**
- * \brief           Draw filled circle corner, selected with parameter
+ * \brief           Get width of icon drawn at specific height
+ * \param[in]       icon: Vector icon
+ * \param[in]       height: Icon height in units of pixels
+ * \return          Icon width in units of pixels, proportional to design grid
+ */
+gui_dim_t
+gui_draw_icon_getwidth(const gui_icon_t* icon, gui_dim_t height) {
+    if (icon == NULL || !icon->height) {
+        return 0;
+    }
+    return (gui_dim_t)(((int32_t)height * icon->width + (icon->height >> 1)) / icon->height);
+}
+
+/**
+ * \brief           Draw vector icon with anti-aliasing
+ *
+ *                  Icon is rasterized once per size and kept in character cache,
+ *                  repeated draws at the same size only blend cached coverage.
+ *
  * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x0: X position of corner origin
- * \param[in]       y0: Y position of corner origin
- * \param[in]       r: Circle radius
- * \param[in]       c: List of corners to draw. Use BITWISE OR with these values to specify corner:
- *                     - \ref GUI_DRAW_CIRCLE_TL
- *                     - \ref GUI_DRAW_CIRCLE_TR
- *                     - \ref GUI_DRAW_CIRCLE_BL
- *                     - \ref GUI_DRAW_CIRCLE_BR
- * \param[in]       color: Color used for drawing operation 
- * \sa              gui_draw_circle, gui_draw_filledcircle, gui_draw_circlecorner
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       height: Icon height in units of pixels, width is calculated with \ref gui_draw_icon_getwidth
+ * \param[in]       icon: Vector icon to draw
+ * \param[in]       color: Icon color
  */
 void
-gui_draw_filledcirclecorner(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, uint8_t c, gui_color_t color) {
-    gui_dim_t f = 1 - r;
-    gui_dim_t ddF_x = 1;
-    gui_dim_t ddF_y = -2 * r;
-    gui_dim_t x = 0;
-    gui_dim_t y = r;
+gui_draw_icon(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t height, const gui_icon_t* icon, gui_color_t color) {
+    gui_font_charentry_t* entry;
+    gui_dim_t width;
+#if GUI_CFG_USE_LL_GPU
+    gui_display_t clip;
+#endif /* GUI_CFG_USE_LL_GPU */
     
-    if (!GUI_RECT_MATCH(
+    DRAW_LIST_RECORD(DRAW_LIST_ICON, 0, x, y, height, 0, 0, 0, color, icon, NULL, 0, gui_draw_icon(disp, x, y, height, icon, color));
+    
+    width = gui_draw_icon_getwidth(icon, height);
+    if (width <= 0 || height <= 0 || !GUI_RECT_MATCH(
         disp->x1, disp->y1, disp->x2, disp->y2,
-        x0 - r, y0 - r, x0 + r, y0 + r
+        x, y, x + width, y + height
     )) {
         return;
     }
+#if GUI_CFG_USE_LL_GPU
+    if (GUI_LL_ISSET(FillPath) && gpu_clip(disp, &clip)
+        && GUI_LL(FillPath)(&GUI.lcd, GUI.lcd.drawing_layer, &clip, icon, x - GUI.lcd.drawing_layer->x_pos, y - GUI.lcd.drawing_layer->y_pos, width, height, color)) {
+        return;                                     /* Path is filled directly, without coverage in cache */
+    }
+#endif /* GUI_CFG_USE_LL_GPU */
+    entry = gui_text_geticonentry(icon, width, height);
+    if (entry != NULL) {
+        draw_a8(disp, x, y, width, height, (const uint8_t *)entry + GUI_MEM_ALIGN(sizeof(*entry)), color);
+    }
+}
 
-    while (x < y) {
-        if (f >= 0) {
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
+#endif /* GUI_CFG_USE_VECTOR_ICON || __DOXYGEN__ */
+
+#if GUI_CFG_USE_TEXT_LCD || __DOXYGEN__
+
+/**
+ * \brief           Blend LCD subpixel coverage values to drawing layer
+ * \param[in]       disp: Clipping region
+ * \param[in]       x: Left position of first pixel on screen
+ * \param[in]       y: Top position of first pixel on screen
+ * \param[in]       w: Number of pixels in each row
+ * \param[in]       h: Number of rows
+ * \param[in]       src: Coverage values, `3` values per pixel from left to right subpixel
+ * \param[in]       color: Color to blend
+ */
+static void
+draw_lcd(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t w, gui_dim_t h, const uint8_t* src, gui_color_t color) {
+    gui_dim_t xi, yi;
+    gui_color_t c;
+    const uint8_t* p;
+    uint8_t r, g, b;
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+    const gui_layer_access_t* acc = draw_access(1);
+    uint8_t* d = NULL;
+    size_t ps = 0;
+    
+    if (acc != NULL) {
+        ps = acc->format == GUI_PIXEL_FORMAT_RGB565 ? 2 : 4;
+    }
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+    
+    for (yi = GUI_MAX(y, disp->y1); yi < GUI_MIN(y + h, disp->y2); yi++) {
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+        if (acc != NULL) {                          /* Pixels of row are accessed directly in memory */
+            d = guii_access_addr(acc, GUI.lcd.drawing_layer, GUI_MAX(x, disp->x1), yi);
+        }
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+        for (xi = GUI_MAX(x, disp->x1); xi < GUI_MIN(x + w, disp->x2); xi++) {
+            p = &src[3 * ((size_t)(yi - y) * w + (xi - x))];
+#if GUI_CFG_USE_TEXT_LCD == 2
+            r = p[2], g = p[1], b = p[0];           /* BGR subpixel order */
+#else /* GUI_CFG_USE_TEXT_LCD == 2 */
+            r = p[0], g = p[1], b = p[2];           /* RGB subpixel order */
+#endif /* GUI_CFG_USE_TEXT_LCD != 2 */
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+            if (d != NULL) {
+                if ((r & g & b) == 0xFF) {
+                    guii_access_setpixel(acc, d, color);
+                } else if (r | g | b) {
+                    c = guii_access_getpixel(acc, d);
+                    guii_access_setpixel(acc, d, (c & 0xFF000000UL)
+                        | (gui_color_t)guii_blend_u8((color >> 16) & 0xFF, (c >> 16) & 0xFF, r) << 16
+                        | (gui_color_t)guii_blend_u8((color >>  8) & 0xFF, (c >>  8) & 0xFF, g) << 8
+                        | (gui_color_t)guii_blend_u8((color >>  0) & 0xFF, (c >>  0) & 0xFF, b));
+                }
+                d += ps;
+                continue;
+            }
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+            if ((r & g & b) == 0xFF) {
+                gui_draw_setpixel(disp, xi, yi, color);
+            } else if (r | g | b) {
+                c = gui_draw_getpixel(disp, xi, yi);
+                gui_draw_setpixel(disp, xi, yi, (c & 0xFF000000UL)
+                    | (gui_color_t)guii_blend_u8((color >> 16) & 0xFF, (c >> 16) & 0xFF, r) << 16
+                    | (gui_color_t)guii_blend_u8((color >>  8) & 0xFF, (c >>  8) & 0xFF, g) << 8
+                    | (gui_color_t)guii_blend_u8((color >>  0) & 0xFF, (c >>  0) & 0xFF, b));
+            }
         }
+    }
+}
+
+#endif /* GUI_CFG_USE_TEXT_LCD || __DOXYGEN__ */
+
+/**
+ * \brief           Get screen position and subpixel variant of character
+ * \param[in]       font: Font used for character
+ * \param[in]       x: X position of line start
+ * \param[in]       pen: Position of character from line start in units of `1/64` pixel
+ * \param[out]      variant: Subpixel variant of character for \ref gui_text_getcharvariant
+ * \return          X position of character
+ */
+static gui_dim_t
+text_pen_position(const gui_font_t* font, gui_dim_t x, int32_t pen, uint8_t* variant) {
+    int32_t frac = pen & 0x3F, p;
+    
+    x += (gui_dim_t)((pen - frac) / 64);
+    p = (frac * GUI_CFG_TEXT_SUBPIXEL_POSITIONS + 32) >> 6; /* Round to nearest subpixel position */
+    if (p >= GUI_CFG_TEXT_SUBPIXEL_POSITIONS) {
+        p = 0;
         x++;
-        ddF_x += 2;
-        f += ddF_x;
+    }
+    *variant = (uint8_t)p;
+#if GUI_CFG_USE_TEXT_LCD
+    if (font->flags & GUI_FLAG_FONT_LCD) {
+        *variant |= GUI_TEXT_VARIANT_LCD;
+    }
+#else /* GUI_CFG_USE_TEXT_LCD */
+    GUI_UNUSED(font);
+#endif /* !GUI_CFG_USE_TEXT_LCD */
+    return x;
+}
 
-        if (c & GUI_DRAW_CIRCLE_TL) {               /* Top left */            
-            gui_draw_hline(disp, x0 - x, y0 - y, x, color);
-            gui_draw_hline(disp, x0 - y, y0 - x, y, color);
+/**
+ * \brief           Draw character at subpixel position
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       font: Font used for drawing
+ * \param[in]       draw: Text drawing parameters
+ * \param[in]       x: X position of character
+ * \param[in]       y: Top Y position of line
+ * \param[in]       c: Character info handle
+ * \param[in]       variant: Subpixel variant from \ref text_pen_position
+ */
+GUI_CFG_FAST_CODE static void
+draw_char_variant(const gui_display_t* disp, const gui_font_t* font, const gui_draw_text_t* draw, gui_dim_t x, gui_dim_t y, const gui_font_char_t* c, uint8_t variant) {
+    gui_font_charentry_t* entry;
+    gui_display_t d;
+    const uint8_t* src;
+    gui_dim_t w, split;
+    uint8_t i;
+    
+    if (!variant || (entry = gui_text_getcharvariant(font, c, variant)) == NULL) {
+        draw_char(disp, font, draw, x, y, c);       /* Draw on whole pixel */
+        return;
+    }
+    src = (const uint8_t *)entry + GUI_MEM_ALIGN(sizeof(*entry));
+    w = c->x_size + 1;
+    if (variant & GUI_TEXT_VARIANT_LCD) {           /* LCD variant starts one pixel on the left */
+        w = c->x_size + 2;
+        x--;
+    }
+    y += c->y_pos;
+    if (!GUI_RECT_MATCH(disp->x1, disp->y1, disp->x2, disp->y2, x, y, x + w, y + c->y_size)) {
+        return;
+    }
+    GUI_LCD_STATS_GLYPH();
+    
+    split = draw->x + draw->color1width;            /* Position where color 2 starts */
+    for (i = 0; i < 2; i++) {                       /* Draw part with each color */
+        memcpy(&d, disp, sizeof(d));
+        if (i == 0) {
+            d.x2 = GUI_MIN(d.x2, split);
+        } else {
+            d.x1 = GUI_MAX(d.x1, split);
+        }
+        if (d.x1 >= d.x2) {
+            continue;
         }
-        if (c & GUI_DRAW_CIRCLE_TR) {               /* Top right */
-            gui_draw_hline(disp, x0, y0 - y, x, color);
-            gui_draw_hline(disp, x0, y0 - x, y, color);
+#if GUI_CFG_USE_TEXT_LCD
+        if (variant & GUI_TEXT_VARIANT_LCD) {
+            draw_lcd(&d, x, y, w, c->y_size, src, i ? draw->color2 : draw->color1);
+            continue;
+        }
+#endif /* GUI_CFG_USE_TEXT_LCD */
+        draw_a8(&d, x, y, w, c->y_size, src, i ? draw->color2 : draw->color1);
+    }
+}
+
+#if GUI_CFG_DRAW_TEXT_RUN_SIZE || __DOXYGEN__
+
+/**
+ * \brief           `A8` coverage buffer of glyphs in single text line
+ */
+typedef struct {
+    gui_dim_t x1;                                   /*!< Absolute left position of run */
+    gui_dim_t x2;                                   /*!< Absolute right position of run, not included */
+    gui_dim_t y1;                                   /*!< Absolute top position of run */
+    gui_dim_t height;                               /*!< Run height */
+    gui_dim_t stride;                               /*!< Buffer row length in units of bytes */
+    uint8_t used;                                   /*!< Set to `1` when run has at least one glyph */
+    uint8_t pending;                                /*!< Set to `1` when low-level may still read buffer */
+    uint8_t buf[GUI_CFG_DRAW_TEXT_RUN_SIZE];        /*!< Coverage values, `stride * height` entries */
+} gui_text_run_t;
+
+static gui_text_run_t text_runs[2];                 /* Next run is composed while low-level may still blend previous one */
+static uint8_t text_run_num;                        /* Index of run buffer used for next run */
+
+/**
+ * \brief           Get `A8` data of glyph
+ * \param[in]       font: Font used for character
+ * \param[in]       c: Character info handle
+ * \return          Pointer to `x_size * y_size` coverage values, `NULL` if not available
+ */
+GUI_CFG_FAST_CODE static const uint8_t*
+text_run_glyph(const gui_font_t* font, const gui_font_char_t* c) {
+    gui_font_charentry_t* entry;
+    
+    if ((font->flags & (GUI_FLAG_FONT_A8 | GUI_FLAG_FONT_RLE)) == GUI_FLAG_FONT_A8 && font->read == NULL) {   /* Character data are already in A8 format */
+        return c->data;
+    }
+    entry = gui_text_getcharentry(font, c);
+    if (entry == NULL) {
+        entry = gui_text_createcharentry(font, c);
+    }
+    return entry != NULL ? (const uint8_t *)entry + GUI_MEM_ALIGN(sizeof(*entry)) : NULL;
+}
+
+/**
+ * \brief           Blend composed run to drawing layer and switch to other run buffer
+ * \param[in]       draw: Text drawing parameters with colors
+ */
+GUI_CFG_FAST_CODE static void
+text_run_flush(const gui_draw_text_t* draw) {
+    gui_text_run_t* r = &text_runs[text_run_num];
+    gui_layer_t* layer = GUI.lcd.drawing_layer;
+    gui_dim_t w, w1, split;
+    uint8_t* dst;
+    
+    if (!r->used) {
+        return;
+    }
+    r->used = 0;
+    w = r->x2 - r->x1;
+    split = draw->x + draw->color1width;            /* Position where color 2 starts */
+    dst = (uint8_t *)layer->start_address + ((r->y1 - layer->y_pos) * layer->width + (r->x1 - layer->x_pos)) * GUI.lcd.pixel_size;
+    
+    if (split > r->x1 && split < r->x2) {           /* Run is drawn with 2 colors */
+        w1 = split - r->x1;
+        GUI_LL(CopyChar)(&GUI.lcd, layer, dst, r->buf, w1, r->height,
+            layer->width - w1, r->stride - w1, draw->color1);
+        GUI_LL(CopyChar)(&GUI.lcd, layer, dst + w1 * GUI.lcd.pixel_size, r->buf + w1, w - w1, r->height,
+            layer->width - (w - w1), r->stride - (w - w1), draw->color2);
+    } else {
+        GUI_LL(CopyChar)(&GUI.lcd, layer, dst, r->buf, w, r->height,
+            layer->width - w, r->stride - w, split > r->x1 ? draw->color1 : draw->color2);
+    }
+    r->pending = 1;
+    text_run_num ^= 1;
+}
+
+/**
+ * \brief           Draw single line of text with composed glyph runs
+ *
+ *                  Visible glyphs are copied to `A8` buffer first,
+ *                  which is then blended with one `CopyChar` call per color.
+ *
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       font: Font to use for drawing
+ * \param[in]       draw: Text drawing parameters
+ * \param[in,out]   str: String at line start, set to start of next line on return
+ * \param[in]       cnt: Number of characters to read
+ * \param[in]       read_draw: Number of characters to draw
+ * \param[in]       x: Line left X position
+ * \param[in]       y: Line top Y position
+ */
+static void
+text_run_line(const gui_display_t* disp, const gui_font_t* font, const gui_draw_text_t* draw, gui_string_t* str,
+                size_t cnt, size_t read_draw, gui_dim_t x, gui_dim_t y) {
+    gui_text_run_t* r = &text_runs[text_run_num];
+    const gui_font_char_t* c;
+    gui_font_charentry_t* entry;
+    const uint8_t* ptr;
+    gui_dim_t h = 0, y1, y2, gx, gw, gx1, gx2, row, stride;
+    gui_string_t tmp;
+    size_t n, d, k;
+    uint32_t ch, prev = 0, chars[16];
+    int32_t pen = 0;
+    uint8_t i, variant;
+    
+    /* Get height covered by glyphs in line */
+    memcpy(&tmp, str, sizeof(tmp));
+    for (n = cnt, d = read_draw; n-- && d && gui_string_getch(&tmp, &ch, &i); d--) {
+        if ((c = gui_text_getchardesc(font, get_char_from_value(ch))) != NULL && (c->y_pos + c->y_size) > h) {
+            h = c->y_pos + c->y_size;
         }
-        if (c & GUI_DRAW_CIRCLE_BL) {               /* Bottom left */
-            gui_draw_hline(disp, x0 - y, y0 + x, y, color);
-            gui_draw_hline(disp, x0 - x, y0 + y, x, color);
+    }
+    y1 = GUI_MAX(y, disp->y1);
+    y2 = GUI_MIN(y + h, disp->y2);
+    stride = y2 > y1 ? (gui_dim_t)(sizeof(r->buf) / (size_t)(y2 - y1)) : 0;
+    
+    while (cnt > 0 && (n = gui_string_getchars(str, chars, GUI_MIN(cnt, GUI_COUNT_OF(chars)))) > 0) {
+        cnt -= n;
+        for (k = 0; k < n; k++) {                   /* Process decoded block */
+            ch = chars[k];
+            if (read_draw == 0) {                   /* Anything to draw? */
+                continue;
+            }
+            read_draw--;                            /* Decrease number of drawn elements */
+            if ((x + pen / 64) > disp->x2 || (c = gui_text_getchardesc(font, (ch = get_char_from_value(ch)))) == NULL) {
+                continue;
+            }
+            pen += (int32_t)gui_text_getkerning(font, prev, ch) * 64;  /* Adjust for previous character */
+            prev = ch;
+            gx = text_pen_position(font, x, pen, &variant);
+            gw = c->x_size + (variant ? 1 : 0);     /* Shifted glyph has one more column */
+            
+            gx1 = GUI_MAX(gx, disp->x1);            /* Visible part of glyph */
+            gx2 = GUI_MIN(gx + gw, disp->x2);
+            if (gx1 < gx2 && y1 < y2) {
+                ptr = NULL;
+                if (!variant) {
+                    ptr = text_run_glyph(font, c);
+                } else if ((entry = gui_text_getcharvariant(font, c, variant)) != NULL) {
+                    ptr = (const uint8_t *)entry + GUI_MEM_ALIGN(sizeof(*entry));
+                }
+                if (ptr == NULL || (gx2 - gx1) > stride) {
+                    draw_char_variant(disp, font, draw, gx, y, c, variant); /* Glyph cannot be composed */
+                } else {
+                    GUI_LCD_STATS_GLYPH();
+                    if (r->used && (gx2 - r->x1) > stride) {/* Glyph does not fit to current run */
+                        text_run_flush(draw);
+                        r = &text_runs[text_run_num];
+                    }
+                    if (!r->used) {                 /* Start new run */
+                        if (r->pending) {           /* Run before previous one may still be processed by hardware */
+                            gui_lcd_fence();
+                            text_runs[0].pending = text_runs[1].pending = 0;    /* Both runs are finished after fence */
+                        }
+                        r->x1 = r->x2 = gx1;
+                        r->y1 = y1;
+                        r->height = y2 - y1;
+                        r->stride = stride;
+                        r->used = 1;
+                    }
+                    if (gx2 > r->x2) {              /* Clear new columns of run */
+                        for (row = 0; row < r->height; row++) {
+                            memset(&r->buf[(size_t)row * stride + (r->x2 - r->x1)], 0x00, (size_t)(gx2 - r->x2));
+                        }
+                        r->x2 = gx2;
+                    }
+                    for (row = GUI_MAX(y + c->y_pos, y1); row < GUI_MIN(y + c->y_pos + c->y_size, y2); row++) {
+                        memcpy(&r->buf[(size_t)(row - y1) * stride + (gx1 - r->x1)],
+                            &ptr[(size_t)(row - y - c->y_pos) * gw + (gx1 - gx)], (size_t)(gx2 - gx1));
+                    }
+                }
+            }
+            pen += gui_text_getcharadvance64(font, c);  /* Increase X position */
         }
-        if (c & GUI_DRAW_CIRCLE_BR) {               /* Bottom right */
-            gui_draw_hline(disp, x0, y0 + x, y, color);
-            gui_draw_hline(disp, x0, y0 + y, x, color);
+    }
+    text_run_flush(draw);
+}
+
+#endif /* GUI_CFG_DRAW_TEXT_RUN_SIZE || __DOXYGEN__ */
+
+/**
+ * \brief           Get Y position of first text line
+ * \param[in]       draw: Text drawing parameters
+ * \param[in]       height: Total text height
+ * \param[in]       is_edit_mode: Set to `1` when text is in edit mode
+ * \return          Y position of first line
+ */
+static gui_dim_t
+text_get_y(const gui_draw_text_t* draw, gui_dim_t height, uint8_t is_edit_mode) {
+    gui_dim_t y = draw->y;                          /* Get start Y position */
+    
+    if ((draw->align & GUI_VALIGN_MASK) == GUI_VALIGN_CENTER) { /* Check for vertical align center */
+        y += (draw->height - height) / 2;           /* Align center of drawing area */
+    } else if ((draw->align & GUI_VALIGN_MASK) == GUI_VALIGN_BOTTOM) {  /* Check for vertical align bottom */
+        y += draw->height - height;                 /* Align bottom of drawing area */
+    }
+    
+    if (y < draw->y) {
+        y = draw->y;
+    }
+    y -= draw->scrolly;                             /* Go scroll top */
+    
+    /* Check Y start value in case of edit mode = allow always on bottom */
+    if ((draw->flags & GUI_FLAG_TEXT_MULTILINE) && is_edit_mode) {  /* In multi-line and edit mode */
+        if (height > draw->height) {                /* If text is greater than visible area in edit mode, set it to bottom align */
+            y = draw->y + draw->height - height;
         }
     }
+    return y;
+}
+
+/**
+ * \brief           Get X position of text line
+ * \param[in]       draw: Text drawing parameters
+ * \param[in]       width: Line width
+ * \return          X position of line start
+ */
+static gui_dim_t
+text_get_x(const gui_draw_text_t* draw, gui_dim_t width) {
+    gui_dim_t x = draw->x;
+    
+    if ((draw->align & GUI_HALIGN_MASK) == GUI_HALIGN_CENTER) { /* Check for horizontal align center */
+        x += (draw->width - width) / 2;             /* Align center of drawing area */
+    } else if ((draw->align & GUI_HALIGN_MASK) == GUI_HALIGN_RIGHT) {   /* Check for horizontal align right */
+        x += draw->width - width;                   /* Align right of drawing area */
+    }
+    return x;
 }
 
 /**
- * \brief           Draw image to display of any depth and size
+ * \brief           Save cursor position at the end of text line in edit mode
+ * \param[in,out]   draw: Text drawing parameters
+ * \param[in]       width: Line width
+ * \param[in]       y: Line top Y position
+ */
+static void
+text_set_cursor(gui_draw_text_t* draw, gui_dim_t width, gui_dim_t y) {
+    draw->cursorx = text_get_x(draw, width) + width;
+    draw->cursory = y;
+}
+
+/**
+ * \brief           Draw single line of text
  * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       x: Top left X position
- * \param[in]       y: Top left Y position
- * \param[in]       img: Pointer to \ref gui_image_desc_t structure with image description 
+ * \param[in]       font: Font to use for drawing
+ * \param[in]       draw: Text drawing parameters
+ * \param[in,out]   str: String at line start, set to start of next line on return
+ * \param[in]       cnt: Number of characters to read
+ * \param[in]       read_draw: Number of characters to draw
+ * \param[in]       width: Line width
+ * \param[in]       y: Line top Y position
  */
-void
-gui_draw_image(gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_desc_t* img) {
-    uint8_t bytes = img->bpp >> 3;                  /* Get number of bytes per pixel on image */
-    
-    gui_layer_t* layer;
-    const uint8_t* src;
-    const uint8_t* dst;
-    gui_dim_t width, height;
-    gui_dim_t offlineSrc, offlineDst;
+static void
+text_draw_line(const gui_display_t* disp, const gui_font_t* font, const gui_draw_text_t* draw, gui_string_t* str,
+                size_t cnt, size_t read_draw, gui_dim_t width, gui_dim_t y) {
+    const gui_font_char_t* c;
+    gui_dim_t x, gx;
+    uint32_t ch, prev = 0;
+    int32_t pen = 0;
+    uint8_t i, variant;
     
-    if (!img || !GUI_RECT_MATCH(
-        disp->x1, disp->y1, disp->x2, disp->y2,
-        x, y, x + img->x_size, y + img->y_size
-    )) {
+    x = text_get_x(draw, width);
+#if GUI_CFG_DRAW_TEXT_RUN_SIZE
+    if (GUI_LL_ISSET(CopyChar) && !(GUI_CFG_USE_TEXT_LCD && (font->flags & GUI_FLAG_FONT_LCD))) {   /* Compose glyphs and blend them together */
+        text_run_line(disp, font, draw, str, cnt, read_draw, x, y);
         return;
     }
-    
-    layer = GUI.lcd.drawing_layer;                  /* Set layer pointer */
-    
-    width = img->x_size;                            /* Set default width */
-    height = img->y_size;                           /* Set default height */
-    
-    src = (uint8_t *)(img->image);                  /* Set source address */
-    dst = (uint8_t *)(((uint8_t *)layer->start_address) + GUI.lcd.pixel_size * ((y - layer->y_pos) * layer->width + (x - layer->x_pos)));
-    
-    //TODO: Check proper coordinates for memory!
-    if (y < disp->y1) {
-        src += (disp->y1 - y) * img->x_size * bytes;/* Set offset for number of image lines */
-        dst += (disp->y1 - y) * GUI.lcd.width * GUI.lcd.pixel_size;  /* Set offset for number of LCD lines */
-        height -= disp->y1 - y;                     /* Decrease effective height */
-    }
-    if ((y + img->y_size) > disp->y2) {
-        height -= y + img->y_size - disp->y2;       /* Decrease effective height */
-    }
-    if (x < disp->x1) {                             /* Set offset start address if required */
-        src += (disp->x1 - x) * bytes;              /* Set offset of start address in X direction */
-        dst += (disp->x1 - x) * GUI.lcd.pixel_size; /* Set offset of start address in X direction */
-        width -= disp->x1 - x;                      /* Decrease effective width */
-    }
-    if ((x + img->x_size) > disp->x2) {
-        width -= x + img->x_size - disp->x2;        /* Decrease effective width */
-    }
-    
-    offlineSrc = img->x_size - width;               /* Set offline source */
-    offlineDst = layer->width - width;              /* Set offline destination */
-    
-    /*******************/
-    /*    Draw image   */
-    /*******************/
-    if (bytes == 4) {                               /* Draw 32BPP image */
-        if (GUI.ll.DrawImage32 != NULL) {           /* Draw image 32BPP if possible */
-            GUI.ll.DrawImage32(&GUI.lcd, GUI.lcd.drawing_layer, img, (uint8_t *)dst, (const uint8_t *)src, width, height, offlineDst, offlineSrc);
+#endif /* GUI_CFG_DRAW_TEXT_RUN_SIZE */
+    while (cnt-- && gui_string_getch(str, &ch, &i)) {   /* Read character by character */
+        if (read_draw == 0) {                       /* Anything to draw? */
+            continue;
         }
-    } else if (bytes == 3) {                        /* Draw 24BPP image */
-        if (GUI.ll.DrawImage24 != NULL) {           /* Draw image 24BPP if possible */
-            GUI.ll.DrawImage24(&GUI.lcd, GUI.lcd.drawing_layer, img, (uint8_t *)dst, (const uint8_t *)src, width, height, offlineDst, offlineSrc);
+        read_draw--;                                /* Decrease number of drawn elements */
+        
+        if ((x + pen / 64) > disp->x2) {            /* Check if X over line */
+            continue;
         }
-    } else if (bytes == 2) {                        /* Draw 16BPP image */
-        if (GUI.ll.DrawImage16 != NULL) {           /* Draw image 16BPP if possible */
-            GUI.ll.DrawImage16(&GUI.lcd, GUI.lcd.drawing_layer, img, (uint8_t *)dst, (const uint8_t *)src, width, height, offlineDst, offlineSrc);
+        
+        ch = get_char_from_value(ch);               /* Get char from char value */
+        if ((c = gui_text_getchardesc(font, ch)) == 0) {/* Get character pointer */
+            continue;                               /* Character is not known */
         }
+        pen += (int32_t)gui_text_getkerning(font, prev, ch) * 64;  /* Adjust for previous character */
+        prev = ch;
+        gx = text_pen_position(font, x, pen, &variant);/* Variant is known only after position is calculated */
+        draw_char_variant(disp, font, draw, gx, y, c, variant); /* Draw actual char */
+        
+        pen += gui_text_getcharadvance64(font, c);  /* Increase X position */
     }
 }
 
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__
+
 /**
- * \brief           Draw polygon lines
- * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
- * \param[in]       points: Pointer to array of \ref gui_draw_poly_t points to draw lines between
- * \param[in]       len: Number of points in array. There must be at least 2 points
- * \param[in]       color: Color to use for drawing 
+ * \brief           Calculate layout of string and save it to cache
+ *
+ *                  When layout is partially valid, only lines from first changed one are calculated.
+ *
+ * \param[in,out]   layout: Layout cache
+ * \param[in]       font: Font to use for drawing
+ * \param[in]       str: String to draw
+ * \param[in]       draw: Text drawing parameters
+ * \return          `1` on success, `0` otherwise
  */
-void
-gui_draw_poly(const gui_display_t* disp, const gui_draw_poly_t* points, size_t len, gui_color_t color) {
-    gui_dim_t x = 0, y = 0;
-
-    if (len < 2) {
-        return;
+static uint8_t
+text_layout_build(gui_text_layout_t* layout, const gui_font_t* font, const gui_char* str, gui_draw_text_t* draw) {
+    gui_stringrect_t rect = {0};
+    gui_text_layout_line_t* line;
+    gui_string_t currStr;
+    const gui_char* start = str;
+    gui_dim_t x = draw->x;
+    size_t cnt;
+    uint32_t ch;
+    uint8_t i;
+    
+    rect.Font = font;
+    rect.StringDraw = draw;
+    rect.IsEditMode = (draw->flags & GUI_FLAG_TEXT_EDITMODE) == GUI_FLAG_TEXT_EDITMODE;
+    
+    layout->valid = 0;
+    if (layout->partial && layout->font == font && layout->str == str && layout->width == draw->width
+        && layout->lineheight == draw->lineheight && layout->flags == draw->flags) {
+        /* Lines before change are kept, total height is only needed for alignment */
+        layout->height = -1;                        /* Height is not known */
+        if ((draw->align & GUI_VALIGN_MASK) != GUI_VALIGN_TOP || rect.IsEditMode) {
+            gui_string_prepare(&currStr, str);
+            string_rectangle(&rect, &currStr, 0);
+            layout->height = rect.height;
+        }
+        gui_string_prepare(&currStr, str + layout->resume);
+    } else {
+        layout->count = 0;
+        gui_string_prepare(&currStr, str);
+        string_rectangle(&rect, &currStr, 0);       /* Get total text size */
+        layout->x_offset = 0;
+        if (rect.width > draw->width && (draw->flags & GUI_FLAG_TEXT_RIGHTALIGN)) {
+            gui_string_prepare(&currStr, str);
+            start = string_get_pointer_for_width(font, &currStr, draw);
+            layout->x_offset = draw->x - x;         /* Save alignment offset and restore input */
+            draw->x = x;
+        }
+        layout->start = (size_t)(start - str);
+        layout->height = rect.height;
+        gui_string_prepare(&currStr, start);
     }
-
-    gui_draw_line(disp, points->x, points->y, (points + len - 1)->x, (points + len - 1)->y, color);
-
-    while (--len) {
-        x = points->x;
-        y = points->y;
-        points++;
-        gui_draw_line(disp, x, y, points->x, points->y, color);
+    layout->partial = 0;
+    
+    /* Save all lines */
+    while ((cnt = string_rectangle(&rect, &currStr, 1)) > 0) {
+        if (layout->count == layout->size) {        /* Grow lines array */
+            size_t size = layout->size ? 2 * layout->size : 4;
+            line = GUI_MEMREALLOC(layout->lines, size * sizeof(*line));
+            if (line == NULL) {
+                layout->count = 0;
+                return 0;
+            }
+            layout->lines = line;
+            layout->size = size;
+        }
+        line = &layout->lines[layout->count++];
+        line->offset = (size_t)(currStr.str - start);
+        line->read_total = cnt;
+        line->read_draw = rect.ReadDraw;
+        line->width = rect.width;
+        while (cnt-- && gui_string_getch(&currStr, &ch, &i)) {} /* Skip line characters */
+        if (!(draw->flags & GUI_FLAG_TEXT_MULTILINE)) {
+            break;
+        }
     }
+    
+    layout->font = font;
+    layout->str = str;
+    layout->width = draw->width;
+    layout->lineheight = draw->lineheight;
+    layout->flags = draw->flags;
+    layout->valid = 1;
+    return 1;
 }
 
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__ */
+
 /**
  * \brief           Write text to screen
  * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
@@ -1180,18 +4707,69 @@ gui_draw_poly(const gui_display_t* disp, const gui_draw_poly_t* points, size_t l
  */
 void
 gui_draw_writetext(const gui_display_t* disp, const gui_font_t* font, const gui_char* str, gui_draw_text_t* draw) {
-    gui_dim_t x, y;
-    uint32_t ch;
-    uint8_t i;
+    gui_dim_t y;
     size_t cnt;
-    const gui_font_char_t* c;
     gui_stringrect_t rect = {0};                    /* Get string object */
     gui_string_t currStr;
     
+#if GUI_CFG_USE_DISPLAY_LIST
+    if (draw_list_rec != NULL) {                    /* Save drawing structure, original string pointer and string copy */
+        gui_draw_list_t* const rec = draw_list_rec;
+        draw_list_cmd_t cmd = {DRAW_LIST_TEXT, 0, 0, {0, 0, 0, 0}, {0, 0, 0, 0, 0, 0}, 0, font};
+        size_t len = strlen((const char *)str) + 1;
+        uint8_t* const d = draw_list_add(disp, &cmd, NULL, sizeof(*draw) + sizeof(str) + len);
+        
+        if (d != NULL) {
+            memcpy(d, draw, sizeof(*draw));
+            memcpy(d + sizeof(*draw), &str, sizeof(str));
+            memcpy(d + sizeof(*draw) + sizeof(str), str, len);
+        }
+        draw_list_rec = NULL;
+        gui_draw_writetext(disp, font, str, draw);
+        draw_list_rec = rec;
+        return;
+    }
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+    
     if (!draw->lineheight) {                        /* When line height is not set */
         draw->lineheight = font->size;              /* Set font size */
     }
     
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE
+    if (draw->layout != NULL) {
+        gui_text_layout_t* l = draw->layout;
+        
+        if ((l->valid && l->font == font && l->str == str && l->width == draw->width
+                && l->lineheight == draw->lineheight && l->flags == draw->flags
+                && (l->height >= 0 || ((draw->align & GUI_VALIGN_MASK) == GUI_VALIGN_TOP && !(draw->flags & GUI_FLAG_TEXT_EDITMODE))))
+            || text_layout_build(l, font, str, draw)) {
+            draw->x += l->x_offset;
+            str += l->start;
+            y = text_get_y(draw, l->height, (draw->flags & GUI_FLAG_TEXT_EDITMODE) == GUI_FLAG_TEXT_EDITMODE);
+            if (draw->flags & GUI_FLAG_TEXT_EDITMODE) { /* Cursor is after last line, even when not visible */
+                if (l->count) {
+                    text_set_cursor(draw, l->lines[l->count - 1].width, y + (gui_dim_t)(l->count - 1) * draw->lineheight);
+                } else {
+                    text_set_cursor(draw, 0, text_get_y(draw, draw->lineheight, 1));
+                }
+            }
+            cnt = 0;
+            if (draw->lineheight > 0 && (y + GUI_MAX(draw->lineheight, font->size)) <= disp->y1) {
+                cnt = (size_t)((disp->y1 - y - GUI_MAX(draw->lineheight, font->size)) / draw->lineheight) + 1;  /* Jump to first visible line */
+                y += (gui_dim_t)cnt * draw->lineheight;
+            }
+            for (; cnt < l->count && y <= disp->y2; cnt++, y += draw->lineheight) {
+                if ((y + GUI_MAX(draw->lineheight, font->size)) <= disp->y1) {
+                    continue;                       /* Line is above visible area */
+                }
+                gui_string_prepare(&currStr, str + l->lines[cnt].offset);
+                text_draw_line(disp, font, draw, &currStr, l->lines[cnt].read_total, l->lines[cnt].read_draw, l->lines[cnt].width, y);
+            }
+            return;
+        }
+    }
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE */
+    
     rect.Font = font;                               /* Save font structure */
     rect.StringDraw = draw;                         /* Set drawing pointer */
     rect.IsEditMode = (draw->flags & GUI_FLAG_TEXT_EDITMODE) == GUI_FLAG_TEXT_EDITMODE; /* Check if in edit mode */
@@ -1207,60 +4785,105 @@ gui_draw_writetext(const gui_display_t* disp, const gui_font_t* font, const gui_
         }
     }
     
-    x = draw->x;                                    /* Get start X position */
-    y = draw->y;                                    /* Get start Y position */
-    
-    if ((draw->align & GUI_VALIGN_MASK) == GUI_VALIGN_CENTER) { /* Check for vertical align center */
-        y += (draw->height - rect.height) / 2;      /* Align center of drawing area */
-    } else if ((draw->align & GUI_VALIGN_MASK) == GUI_VALIGN_BOTTOM) {  /* Check for vertical align bottom */
-        y += draw->height - rect.height;            /* Align bottom of drawing area */
-    }
-    
-    if (y < draw->y) {
-        y = draw->y;
-    }
-    y -= draw->scrolly;                             /* Go scroll top */
-    
-    /* Check Y start value in case of edit mode = allow always on bottom */
-    if ((draw->flags & GUI_FLAG_TEXT_MULTILINE) && rect.IsEditMode) {   /* In multi-line and edit mode */
-        if (rect.height > draw->height) {           /* If text is greater than visible area in edit mode, set it to bottom align */
-            y = draw->y + draw->height - rect.height;
-        }
+    y = text_get_y(draw, rect.height, rect.IsEditMode); /* Get start Y position */
+    if (rect.IsEditMode) {                          /* Cursor of empty text */
+        text_set_cursor(draw, 0, rect.height ? y : text_get_y(draw, draw->lineheight, 1));
     }
     
     gui_string_prepare(&currStr, str);              /* Prepare string again */
     while ((cnt = string_rectangle(&rect, &currStr, 1)) > 0) {
-        x = draw->x;                                       
-        if ((draw->align & GUI_HALIGN_MASK) == GUI_HALIGN_CENTER) { /* Check for horizontal align center */
-            x += (draw->width - rect.width) / 2;    /* Align center of drawing area */
-        } else if ((draw->align & GUI_HALIGN_MASK) == GUI_HALIGN_RIGHT) {   /* Check for horizontal align right */
-            x += draw->width - rect.width;          /* Align right of drawing area */
-        }
-        while (cnt-- && gui_string_getch(&currStr, &ch, &i)) {  /* Read character by character */
-            if (rect.ReadDraw == 0) {               /* Anything to draw? */
-                continue;
-            }
-            rect.ReadDraw--;                        /* Decrease number of drawn elements */
-            
-            if (x > disp->x2) {                     /* Check if X over line */
-                continue;
-            }
-            
-            ch = get_char_from_value(ch);           /* Get char from char value */
-            if ((c = gui_text_getchardesc(font, ch)) == 0) {/* Get character pointer */
-                continue;                           /* Character is not known */
-            }
-            draw_char(disp, font, draw, x, y, c);   /* Draw actual char */
-            
-            x += c->x_size + c->x_margin;           /* Increase X position */
+        if (y <= disp->y2) {
+            text_draw_line(disp, font, draw, &currStr, cnt, rect.ReadDraw, rect.width, y);
+        } else {                                    /* Only measure lines below visible area for cursor */
+            uint32_t ch;
+            uint8_t i;
+            while (cnt-- && gui_string_getch(&currStr, &ch, &i)) {}
+        }
+        if (rect.IsEditMode) {
+            text_set_cursor(draw, rect.width, y);
         }
         y += draw->lineheight;                      /* Go to next line */
-        if (!(draw->flags & GUI_FLAG_TEXT_MULTILINE) || y > disp->y2) { /* Not multiline or over visible Y area */
+        if (!(draw->flags & GUI_FLAG_TEXT_MULTILINE) || (y > disp->y2 && !rect.IsEditMode)) {  /* Not multiline or over visible Y area */
             break;
         }
     }
 }
 
+/**
+ * \brief           Mark cached text layout invalid
+ *
+ *                  Must be called when content of string changes without changing its pointer.
+ *                  Layout is calculated again on next draw, memory for lines is reused.
+ *
+ * \param[in,out]   layout: Layout cache
+ * \sa              gui_draw_text_layout_free
+ */
+void
+gui_draw_text_layout_invalidate(gui_text_layout_t* layout) {
+    layout->valid = 0;
+    layout->partial = 0;
+}
+
+/**
+ * \brief           Mark cached text layout invalid from specific position in string
+ *
+ *                  Used when text is appended or edited at position, string pointer must stay the same.
+ *                  Multi-line layout keeps lines before the line with changed character,
+ *                  line before it is calculated again as word from changed line may wrap back to it.
+ *
+ * \param[in,out]   layout: Layout cache
+ * \param[in]       offset: Offset of first changed byte in string
+ * \sa              gui_draw_text_layout_invalidate
+ */
+void
+gui_draw_text_layout_invalidatefrom(gui_text_layout_t* layout, size_t offset) {
+    size_t lo, hi, mid;
+    
+    if ((!layout->valid && !layout->partial) || !(layout->flags & GUI_FLAG_TEXT_MULTILINE) || layout->start || layout->x_offset || !layout->count) {
+        gui_draw_text_layout_invalidate(layout);
+        return;
+    }
+    if (layout->partial && offset >= layout->resume) {  /* Lines from this position are not valid already */
+        return;
+    }
+    
+    /* Find last line starting before changed position */
+    for (lo = 0, hi = layout->count; hi - lo > 1; ) {
+        mid = (lo + hi) >> 1;
+        if (layout->lines[mid].offset <= offset) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo) {                                       /* Previous line may change too */
+        lo--;
+    }
+    if (!lo) {                                      /* Complete layout changes */
+        gui_draw_text_layout_invalidate(layout);
+        return;
+    }
+    layout->resume = layout->lines[lo].offset;
+    layout->count = lo;
+    layout->valid = 0;
+    layout->partial = 1;
+}
+
+/**
+ * \brief           Release memory of cached text layout
+ * \param[in,out]   layout: Layout cache
+ * \sa              gui_draw_text_layout_invalidate
+ */
+void
+gui_draw_text_layout_free(gui_text_layout_t* layout) {
+    if (layout->lines != NULL) {
+        GUI_MEMFREE(layout->lines);
+    }
+    layout->size = 0;
+    layout->count = 0;
+    layout->valid = 0;
+}
+
 /**
  * \brief           Initializes \ref gui_draw_sb_t structure for drawing operations
  * \param[in]       sb: Pointer to \ref gui_draw_sb_t to initialize to default values 
@@ -1279,6 +4902,8 @@ void
 gui_draw_scrollbar(const gui_display_t* disp, gui_draw_sb_t* sb) {
     gui_dim_t btnW, btnH, midheight, rectheight, midOffset = 0;
 
+    DRAW_LIST_RECORD(DRAW_LIST_SCROLLBAR, 0, 0, 0, 0, 0, 0, 0, 0, NULL, sb, sizeof(*sb), gui_draw_scrollbar(disp, sb));
+    
     btnW = sb->width;
     btnH = (sb->width << 1) / 3;
     
@@ -1306,3 +4931,217 @@ gui_draw_scrollbar(const gui_display_t* disp, gui_draw_sb_t* sb) {
     }
     gui_draw_rectangle3d(disp, sb->x, sb->y + btnH + midOffset, sb->width, rectheight, GUI_DRAW_3D_State_Raised); 
 }
+
+#if GUI_CFG_USE_DISPLAY_LIST || __DOXYGEN__
+
+/**
+ * \brief           Start recording of drawing calls to display list
+ *
+ *                  Previous content of list is discarded, its memory is reused
+ *
+ * \param[in,out]   list: Display list to record to
+ * \sa              gui_draw_list_stop
+ */
+void
+gui_draw_list_start(gui_draw_list_t* list) {
+    list->len = 0;
+    list->valid = 0;
+    list->failed = 0;
+    draw_list_rec = list;
+}
+
+/**
+ * \brief           Stop recording of drawing calls
+ * \param[in,out]   list: Display list being recorded
+ * \return          `1` when complete drawing was recorded, `0` otherwise
+ * \sa              gui_draw_list_start
+ */
+uint8_t
+gui_draw_list_stop(gui_draw_list_t* list) {
+    draw_list_rec = NULL;
+    list->valid = !list->failed;
+    return list->valid;
+}
+
+/**
+ * \brief           Mark display list being recorded as failed
+ *
+ *                  Used by widgets which write pixels with low-level functions directly,
+ *                  such drawing is not recorded and widget must be drawn with its callback again
+ */
+void
+guii_draw_list_cancel(void) {
+    if (draw_list_rec != NULL) {
+        draw_list_rec->failed = 1;
+    }
+}
+
+/**
+ * \brief           Draw all commands of display list again
+ *
+ *                  Each command is clipped to both, region used when it was recorded and `disp`
+ *
+ * \param[in]       disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       list: Recorded display list
+ */
+void
+gui_draw_list_replay(const gui_display_t* disp, const gui_draw_list_t* list) {
+    const uint8_t* p, *end;
+    const uint8_t* data;
+    draw_list_cmd_t c;
+    gui_display_t d;
+    
+    for (p = list->data, end = list->data + list->len; p < end; p += sizeof(c) + c.len) {
+        memcpy(&c, p, sizeof(c));
+        data = p + sizeof(c);                       /* Payload is aligned, see \ref DRAW_LIST_ALIGN */
+        
+        d.x1 = GUI_MAX(c.disp.x1, disp->x1);
+        d.y1 = GUI_MAX(c.disp.y1, disp->y1);
+        d.x2 = GUI_MIN(c.disp.x2, disp->x2);
+        d.y2 = GUI_MIN(c.disp.y2, disp->y2);
+        if (d.x1 >= d.x2 || d.y1 >= d.y2) {         /* Command is not inside redrawn region */
+            continue;
+        }
+        
+        switch (c.type) {
+            case DRAW_LIST_FILLSCREEN:
+                gui_draw_fillscreen(&d, c.color);
+                break;
+            case DRAW_LIST_SETPIXEL:
+                gui_draw_setpixel(&d, c.v[0], c.v[1], c.color);
+                break;
+            case DRAW_LIST_VLINE:
+                gui_draw_vline(&d, c.v[0], c.v[1], c.v[2], c.color);
+                break;
+            case DRAW_LIST_HLINE:
+                gui_draw_hline(&d, c.v[0], c.v[1], c.v[2], c.color);
+                break;
+            case DRAW_LIST_LINE:
+                gui_draw_line(&d, c.v[0], c.v[1], c.v[2], c.v[3], c.color);
+                break;
+            case DRAW_LIST_RECTANGLE:
+                gui_draw_rectangle(&d, c.v[0], c.v[1], c.v[2], c.v[3], c.color);
+                break;
+            case DRAW_LIST_FILLEDRECTANGLE:
+                gui_draw_filledrectangle(&d, c.v[0], c.v[1], c.v[2], c.v[3], c.color);
+                break;
+            case DRAW_LIST_RECTANGLE3D:
+                gui_draw_rectangle3d(&d, c.v[0], c.v[1], c.v[2], c.v[3], (gui_draw_3d_state_t)c.arg);
+                break;
+            case DRAW_LIST_ROUNDEDRECTANGLE:
+                gui_draw_roundedrectangle(&d, c.v[0], c.v[1], c.v[2], c.v[3], c.v[4], c.color);
+                break;
+            case DRAW_LIST_FILLEDROUNDEDRECTANGLE:
+                gui_draw_filledroundedrectangle(&d, c.v[0], c.v[1], c.v[2], c.v[3], c.v[4], c.color);
+                break;
+            case DRAW_LIST_CIRCLE:
+                gui_draw_circle(&d, c.v[0], c.v[1], c.v[2], c.color);
+                break;
+            case DRAW_LIST_FILLEDCIRCLE:
+                gui_draw_filledcircle(&d, c.v[0], c.v[1], c.v[2], c.color);
+                break;
+            case DRAW_LIST_TRIANGLE:
+                gui_draw_triangle(&d, c.v[0], c.v[1], c.v[2], c.v[3], c.v[4], c.v[5], c.color);
+                break;
+            case DRAW_LIST_FILLEDTRIANGLE:
+                gui_draw_filledtriangle(&d, c.v[0], c.v[1], c.v[2], c.v[3], c.v[4], c.v[5], c.color);
+                break;
+            case DRAW_LIST_CIRCLECORNER:
+                gui_draw_circlecorner(&d, c.v[0], c.v[1], c.v[2], c.arg, c.color);
+                break;
+            case DRAW_LIST_FILLEDCIRCLECORNER:
+                gui_draw_filledcirclecorner(&d, c.v[0], c.v[1], c.v[2], c.arg, c.color);
+                break;
+            case DRAW_LIST_LINE_AA:
+                gui_draw_line_aa(&d, c.v[0], c.v[1], c.v[2], c.v[3], c.color);
+                break;
+            case DRAW_LIST_CIRCLE_AA:
+                gui_draw_circle_aa(&d, c.v[0], c.v[1], c.v[2], c.color);
+                break;
+            case DRAW_LIST_CIRCLECORNER_AA:
+                gui_draw_circlecorner_aa(&d, c.v[0], c.v[1], c.v[2], c.arg, c.color);
+                break;
+            case DRAW_LIST_IMAGE:
+                gui_draw_image(&d, c.v[0], c.v[1], (const gui_image_desc_t *)c.ptr);
+                break;
+            case DRAW_LIST_POLY:
+                gui_draw_poly(&d, (const gui_draw_poly_t *)data, (size_t)c.v[0], c.color);
+                break;
+#if GUI_CFG_USE_VECTOR_ICON
+            case DRAW_LIST_ICON:
+                gui_draw_icon(&d, c.v[0], c.v[1], c.v[2], (const gui_icon_t *)c.ptr, c.color);
+                break;
+#endif /* GUI_CFG_USE_VECTOR_ICON */
+            case DRAW_LIST_TEXT: {
+                gui_draw_text_t draw;
+                const gui_char* str;
+                const gui_char* copy = data + sizeof(draw) + sizeof(str);
+                
+                memcpy(&draw, data, sizeof(draw));
+                memcpy(&str, data + sizeof(draw), sizeof(str));
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE
+                /* Layout built for original string is valid for its copy too */
+                if (draw.layout != NULL && draw.layout->str == str) {
+                    draw.layout->str = copy;
+                    gui_draw_writetext(&d, (const gui_font_t *)c.ptr, copy, &draw);
+                    if (draw.layout->str == copy) {
+                        draw.layout->str = str;
+                    }
+                    break;
+                }
+                draw.layout = NULL;
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE */
+                gui_draw_writetext(&d, (const gui_font_t *)c.ptr, copy, &draw);
+                break;
+            }
+            case DRAW_LIST_SCROLLBAR: {
+                gui_draw_sb_t sb;
+                
+                memcpy(&sb, data, sizeof(sb));
+                gui_draw_scrollbar(&d, &sb);
+                break;
+            }
+#if GUI_CFG_USE_GRADIENT
+            case DRAW_LIST_GRADIENT: {
+                gui_gradient_t grad;
+                
+                memcpy(&grad, data, sizeof(grad));
+                gui_draw_gradientroundedrectangle(&d, c.v[0], c.v[1], c.v[2], c.v[3], c.v[4], &grad);
+                break;
+            }
+#endif /* GUI_CFG_USE_GRADIENT */
+#if GUI_CFG_USE_NINEPATCH
+            case DRAW_LIST_NINEPATCH:
+                gui_draw_ninepatch(&d, c.v[0], c.v[1], c.v[2], c.v[3], (const gui_ninepatch_t *)c.ptr);
+                break;
+#endif /* GUI_CFG_USE_NINEPATCH */
+#if GUI_CFG_USE_IMAGE_TRANSFORM
+            case DRAW_LIST_IMAGE_TRANSFORM: {
+                gui_image_transform_t tr;
+                
+                memcpy(&tr, data, sizeof(tr));
+                gui_draw_image_transform(&d, c.v[0], c.v[1], (const gui_image_desc_t *)c.ptr, &tr);
+                break;
+            }
+#endif /* GUI_CFG_USE_IMAGE_TRANSFORM */
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * \brief           Release memory of display list
+ * \param[in,out]   list: Display list
+ */
+void
+gui_draw_list_free(gui_draw_list_t* list) {
+    if (list->data != NULL) {
+        GUI_MEMFREE(list->data);
+    }
+    list->data = NULL;
+    list->len = list->size = 0;
+    list->valid = 0;
+}
+
+#endif /* GUI_CFG_USE_DISPLAY_LIST || __DOXYGEN__ */
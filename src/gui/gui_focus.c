@@ -0,0 +1,295 @@
+/**    
+ * \file            gui_focus.c
+ * \brief           Focus graph for navigation keys
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_focus.h"
+#include "widget/gui_widget.h"
+
+#if (GUI_CFG_USE_KEYBOARD && GUI_CFG_USE_FOCUS_GRAPH) || __DOXYGEN__
+
+#define FOCUS_NONE                  0xFFFF  /* Index of node when there is no neighbour */
+
+#define G                           (&GUI.focus_graph)
+
+/**
+ * \brief           Check if widget can receive focus with navigation keys
+ * \param[in]       h: Widget handle
+ * \return          `1` if focusable, `0` otherwise
+ */
+static uint8_t
+is_focusable(gui_handle_p h) {
+    return !guii_widget_ishiddentree(h) && !guii_widget_getflag(h, GUI_FLAG_DISABLED);
+}
+
+/**
+ * \brief           Add focusable widgets of tree to graph nodes
+ * \param[in]       parent: Parent widget or `NULL` for all widgets
+ * \param[in]       store: Set to `1` to store widgets to nodes, `0` to only count them
+ * \return          Number of focusable widgets in tree
+ */
+static size_t
+collect_nodes(gui_handle_p parent, uint8_t store) {
+    gui_handle_p h;
+    guii_focus_node_t* n;
+    size_t cnt = 0;
+    
+    GUI_LINKEDLIST_WIDGETSLISTNEXT(parent, h) {
+        if (!is_focusable(h)) {                     /* Ignore hidden and disabled subtrees */
+            continue;
+        }
+        if (guii_widget_allowchildren(h)) {         /* Only leaf widgets receive focus */
+            cnt += collect_nodes(h, store);
+        } else if (G->count + (store ? 0 : cnt) < FOCUS_NONE) {
+            if (store) {
+                n = &G->nodes[G->count++];
+                n->h = h;
+                n->x = gui_widget_getabsolutex(h);
+                n->y = gui_widget_getabsolutey(h);
+                n->width = gui_widget_getwidth(h);
+                n->height = gui_widget_getheight(h);
+            }
+            cnt++;
+        }
+    }
+    return cnt;
+}
+
+/**
+ * \brief           Find nearest node in direction from rectangle
+ *
+ *                  Node center must be outside rectangle in requested direction.
+ *                  Distance perpendicular to direction counts twice,
+ *                  widgets in line with rectangle are preferred over diagonal ones
+ *
+ * \param[in]       x: Rectangle absolute `X` position
+ * \param[in]       y: Rectangle absolute `Y` position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       dir: Direction, one of arrow directions
+ * \param[in]       skip: Index of node to ignore
+ * \return          Index of nearest node or `FOCUS_NONE`
+ */
+static uint16_t
+find_nearest(gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_focus_dir_t dir, size_t skip) {
+    guii_focus_node_t* n;
+    int32_t cx, cy, ncx, ncy, primary, cost, best_cost = 0;
+    uint16_t best = FOCUS_NONE;
+    size_t i;
+    
+    cx = (int32_t)x + width / 2;
+    cy = (int32_t)y + height / 2;
+    for (i = 0; i < G->count; i++) {
+        if (i == skip) {
+            continue;
+        }
+        n = &G->nodes[i];
+        ncx = (int32_t)n->x + n->width / 2;
+        ncy = (int32_t)n->y + n->height / 2;
+        switch (dir) {
+            case GUI_FOCUS_DIR_UP:
+                if (ncy > y) { continue; }
+                primary = cy - ncy;
+                cost = primary + 2 * GUI_ABS(ncx - cx);
+                break;
+            case GUI_FOCUS_DIR_DOWN:
+                if (ncy < y + height) { continue; }
+                primary = ncy - cy;
+                cost = primary + 2 * GUI_ABS(ncx - cx);
+                break;
+            case GUI_FOCUS_DIR_LEFT:
+                if (ncx > x) { continue; }
+                primary = cx - ncx;
+                cost = primary + 2 * GUI_ABS(ncy - cy);
+                break;
+            case GUI_FOCUS_DIR_RIGHT:
+                if (ncx < x + width) { continue; }
+                primary = ncx - cx;
+                cost = primary + 2 * GUI_ABS(ncy - cy);
+                break;
+            default:
+                return FOCUS_NONE;
+        }
+        if (best == FOCUS_NONE || cost < best_cost) {
+            best = (uint16_t)i;
+            best_cost = cost;
+        }
+    }
+    return best;
+}
+
+/**
+ * \brief           Build focus graph for widgets of dialog base or all widgets
+ * \param[in]       root: Dialog base widget or `NULL` for all widgets
+ */
+static void
+focus_build(gui_handle_p root) {
+    guii_focus_node_t tmp, *n;
+    size_t cnt, i, k;
+    uint8_t d;
+    
+    G->dirty = 0;
+    G->root = root;
+    G->count = 0;
+    G->current = 0;
+    
+    cnt = collect_nodes(root, 0);                   /* Count widgets first */
+    if (cnt > G->size) {                            /* Nodes array is too small */
+        GUI_MEMFREE(G->nodes);
+        G->nodes = GUI_MEMALLOC(sizeof(*G->nodes) * cnt);
+        G->size = G->nodes != NULL ? cnt : 0;
+        if (G->nodes == NULL) {
+            return;
+        }
+    }
+    if (cnt == 0) {
+        return;
+    }
+    collect_nodes(root, 1);                         /* Store widgets and their positions */
+    
+    /* Sort nodes in reading order, top to bottom and left to right */
+    for (i = 1; i < G->count; i++) {
+        tmp = G->nodes[i];
+        for (k = i; k > 0 && (G->nodes[k - 1].y > tmp.y
+                || (G->nodes[k - 1].y == tmp.y && G->nodes[k - 1].x > tmp.x)); k--) {
+            G->nodes[k] = G->nodes[k - 1];
+        }
+        G->nodes[k] = tmp;
+    }
+    
+    /* Calculate neighbours in all arrow directions */
+    for (i = 0; i < G->count; i++) {
+        n = &G->nodes[i];
+        for (d = 0; d < GUI_COUNT_OF(n->nb); d++) {
+            n->nb[d] = find_nearest(n->x, n->y, n->width, n->height, (gui_focus_dir_t)d, i);
+        }
+    }
+}
+
+/**
+ * \brief           Move focus to neighbour of focused widget
+ * \param[in]       dir: Direction to move focus
+ * \param[in]       rebuild: Set to `1` to allow rebuild of graph when target widget is not focusable anymore
+ * \return          `1` if focus moved, `0` otherwise
+ */
+static uint8_t
+focus_move(gui_focus_dir_t dir, uint8_t rebuild) {
+    gui_handle_p h, root = NULL;
+    size_t cur;
+    uint16_t target;
+    
+    for (h = GUI.focused_widget; h != NULL; h = guii_widget_getparent(h)) {
+        if (guii_widget_isdialogbase(h)) {          /* Dialog base limits navigation to its widgets */
+            root = h;
+            break;
+        }
+    }
+    if (G->dirty || G->root != root) {
+        focus_build(root);
+        rebuild = 0;
+    }
+    if (G->count == 0) {
+        return 0;
+    }
+    
+    /* Find node of focused widget, focus may be changed by touch */
+    cur = G->current;
+    if (cur >= G->count || G->nodes[cur].h != GUI.focused_widget) {
+        for (cur = 0; cur < G->count && G->nodes[cur].h != GUI.focused_widget; cur++) {}
+    }
+    
+    if (dir == GUI_FOCUS_DIR_NEXT || dir == GUI_FOCUS_DIR_PREV) {
+        if (cur == G->count) {                      /* Start at first or last widget */
+            target = dir == GUI_FOCUS_DIR_NEXT ? 0 : (uint16_t)(G->count - 1);
+        } else {
+            target = (uint16_t)(dir == GUI_FOCUS_DIR_NEXT ? (cur + 1) % G->count : (cur + G->count - 1) % G->count);
+        }
+    } else if (cur < G->count) {
+        target = G->nodes[cur].nb[dir];             /* Precomputed neighbour */
+    } else if (GUI.focused_widget != NULL) {        /* Focused widget is not in graph, search from its position */
+        h = GUI.focused_widget;
+        target = find_nearest(gui_widget_getabsolutex(h), gui_widget_getabsolutey(h),
+            gui_widget_getwidth(h), gui_widget_getheight(h), dir, G->count);
+    } else {
+        target = 0;
+    }
+    if (target == FOCUS_NONE) {
+        return 0;
+    }
+    
+    h = G->nodes[target].h;
+    if (!is_focusable(h)) {                         /* Widget state changed without graph update */
+        if (!rebuild) {
+            return 0;
+        }
+        G->dirty = 1;
+        return focus_move(dir, 0);
+    }
+    guii_widget_focus_set(h);
+    G->current = target;
+    return 1;
+}
+
+/**
+ * \brief           Move focus to neighbour of focused widget
+ * \note            Graph is built again first, when widget tree has changed since last call
+ * \param[in]       dir: Direction to move focus
+ * \return          `1` if focus moved, `0` otherwise
+ */
+uint8_t
+guii_focus_move(gui_focus_dir_t dir) {
+    return focus_move(dir, 1);
+}
+
+/**
+ * \brief           Move focus to neighbour of focused widget
+ *
+ *                  Use with rotary encoder or hardware keys, not sent to GUI as keyboard input.
+ *                  When no widget is focused, first widget in reading order gets focus.
+ *
+ * \param[in]       dir: Direction to move focus, member of \ref gui_focus_dir_t
+ * \return          `1` if focus moved, `0` otherwise
+ */
+uint8_t
+gui_focus_move(gui_focus_dir_t dir) {
+    uint8_t ret;
+    
+    GUI_ASSERTPARAMS(dir <= GUI_FOCUS_DIR_PREV);
+    
+    GUI_CORE_PROTECT(1);
+    ret = guii_focus_move(dir);
+    GUI_CORE_UNPROTECT(1);
+    return ret;
+}
+
+#endif /* (GUI_CFG_USE_KEYBOARD && GUI_CFG_USE_FOCUS_GRAPH) || __DOXYGEN__ */
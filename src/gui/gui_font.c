@@ -0,0 +1,355 @@
+/**	
+ * \file            gui_font.c
+ * \brief           Font file loader
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_font.h"
+
+#if GUI_CFG_USE_FONT_FILE || __DOXYGEN__
+
+#define FONT_HDR_SIZE               16      /* Size of file header in units of bytes */
+#define FONT_RANGE_SIZE             8       /* Size of single range record */
+#define FONT_CHAR_SIZE              12      /* Size of single character record */
+#define FONT_KERN_SIZE              6       /* Size of single kerning record */
+#define FONT_CHUNK_RECORDS          16      /* Number of records read at a time */
+
+/**
+ * \brief           Font file source while parsing
+ */
+typedef struct {
+    const gui_font_t* font;                 /*!< Font with read function or `NULL` for memory data */
+    const uint8_t* mem;                     /*!< Memory with font file when `font` is `NULL` */
+    size_t len;                             /*!< Length of memory data */
+} font_src_t;
+
+/**
+ * \brief           Read part of font file
+ * \param[in]       src: Font file source
+ * \param[in]       offset: Offset in file in units of bytes
+ * \param[out]      data: Output buffer
+ * \param[in]       len: Number of bytes to read
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+font_src_read(const font_src_t* src, size_t offset, void* data, size_t len) {
+    if (src->font != NULL) {
+        return src->font->read(src->font, offset, data, len);
+    }
+    if (offset > src->len || len > src->len - offset) {
+        return 0;
+    }
+    memcpy(data, &src->mem[offset], len);
+    return 1;
+}
+
+/**
+ * \brief           Get little endian 16-bit value
+ * \param[in]       d: Pointer to data
+ * \return          Value
+ */
+static uint16_t
+font_u16(const uint8_t* d) {
+    return (uint16_t)(d[0] | ((uint16_t)d[1] << 8));
+}
+
+/**
+ * \brief           Get little endian 32-bit value
+ * \param[in]       d: Pointer to data
+ * \return          Value
+ */
+static uint32_t
+font_u32(const uint8_t* d) {
+    return (uint32_t)d[0] | ((uint32_t)d[1] << 8) | ((uint32_t)d[2] << 16) | ((uint32_t)d[3] << 24);
+}
+
+/**
+ * \brief           Parse font file and build font tables in RAM
+ *
+ *                  Single memory block is allocated for character, range, kerning and both advance tables.
+ *                  Character `data` members are set to file offsets of glyph data.
+ *
+ * \param[out]      font: Font to fill
+ * \param[in]       src: Font file source
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+font_parse(gui_font_t* font, const font_src_t* src) {
+    uint8_t buff[FONT_CHUNK_RECORDS * FONT_CHAR_SIZE];
+    gui_font_char_t* chars;
+    gui_font_range_t* ranges;
+    gui_font_kern_t* kerning;
+    uint8_t* advance;
+    uint16_t* advance64;
+    uint32_t char_count, i, j, n;
+    uint16_t range_count, kerning_count;
+    size_t offset, memsize, off_ranges, off_kerning, off_advance64, off_advance;
+    uint8_t has_advance = 0, has_advance64 = 0;
+    
+    if (!font_src_read(src, 0, buff, FONT_HDR_SIZE) || memcmp(buff, "EGF1", 4)) {
+        return 0;
+    }
+    range_count = font_u16(&buff[6]);
+    kerning_count = font_u16(&buff[8]);
+    char_count = font_u32(&buff[12]);
+    if (!range_count || !char_count || char_count > 0xFFFF) {
+        return 0;
+    }
+    font->size = buff[4];
+    font->flags = buff[5];
+    
+    /* Calculate memory for all tables */
+    off_ranges = GUI_MEM_ALIGN(char_count * sizeof(*chars));
+    off_kerning = off_ranges + GUI_MEM_ALIGN(range_count * sizeof(*ranges));
+    off_advance64 = off_kerning + GUI_MEM_ALIGN(kerning_count * sizeof(*kerning));
+    off_advance = off_advance64 + GUI_MEM_ALIGN(char_count * sizeof(*advance64));
+    memsize = off_advance + char_count;
+    if ((chars = GUI_MEMALLOC(memsize)) == NULL) {
+        return 0;
+    }
+    ranges = (gui_font_range_t *)((uint8_t *)chars + off_ranges);
+    kerning = (gui_font_kern_t *)((uint8_t *)chars + off_kerning);
+    advance64 = (uint16_t *)((uint8_t *)chars + off_advance64);
+    advance = (uint8_t *)chars + off_advance;
+    
+    /* Read ranges */
+    offset = FONT_HDR_SIZE;
+    for (i = 0; i < range_count; i += n) {
+        n = GUI_MIN(range_count - i, sizeof(buff) / FONT_RANGE_SIZE);
+        if (!font_src_read(src, offset, buff, n * FONT_RANGE_SIZE)) {
+            goto fail;
+        }
+        for (j = 0; j < n; j++) {
+            ranges[i + j].start = font_u32(&buff[j * FONT_RANGE_SIZE]);
+            ranges[i + j].count = font_u16(&buff[j * FONT_RANGE_SIZE + 4]);
+            ranges[i + j].index = font_u16(&buff[j * FONT_RANGE_SIZE + 6]);
+            if ((uint32_t)ranges[i + j].index + ranges[i + j].count > char_count) {
+                goto fail;
+            }
+        }
+        offset += n * FONT_RANGE_SIZE;
+    }
+    
+    /* Read characters */
+    for (i = 0; i < char_count; i += n) {
+        n = GUI_MIN(char_count - i, FONT_CHUNK_RECORDS);
+        if (!font_src_read(src, offset, buff, n * FONT_CHAR_SIZE)) {
+            goto fail;
+        }
+        for (j = 0; j < n; j++) {
+            const uint8_t* d = &buff[j * FONT_CHAR_SIZE];
+            
+            chars[i + j].x_size = d[0];
+            chars[i + j].y_size = d[1];
+            chars[i + j].x_pos = d[2];
+            chars[i + j].y_pos = d[3];
+            chars[i + j].x_margin = d[4];
+            chars[i + j].data = (const uint8_t *)(uintptr_t)font_u32(&d[8]);
+            advance[i + j] = d[5];
+            advance64[i + j] = font_u16(&d[6]);
+            if (d[5]) {
+                has_advance = 1;
+            }
+            if (advance64[i + j]) {
+                has_advance64 = 1;
+            }
+        }
+        offset += n * FONT_CHAR_SIZE;
+    }
+    
+    /* Read kerning pairs */
+    for (i = 0; i < kerning_count; i += n) {
+        n = GUI_MIN(kerning_count - i, sizeof(buff) / FONT_KERN_SIZE);
+        if (!font_src_read(src, offset, buff, n * FONT_KERN_SIZE)) {
+            goto fail;
+        }
+        for (j = 0; j < n; j++) {
+            kerning[i + j].left = font_u16(&buff[j * FONT_KERN_SIZE]);
+            kerning[i + j].right = font_u16(&buff[j * FONT_KERN_SIZE + 2]);
+            kerning[i + j].value = (int8_t)buff[j * FONT_KERN_SIZE + 4];
+        }
+        offset += n * FONT_KERN_SIZE;
+    }
+    
+    font->data = chars;
+    font->ranges = ranges;
+    font->range_count = range_count;
+    font->kerning = kerning_count ? kerning : NULL;
+    font->kerning_count = kerning_count;
+    font->advance = has_advance ? advance : NULL;
+    font->advance64 = has_advance64 ? advance64 : NULL;
+    return 1;
+fail:
+    GUI_MEMFREE(chars);
+    return 0;
+}
+
+/**
+ * \brief           Load font from memory mapped font file
+ *
+ *                  Font tables are built in RAM, while character data are used directly from file memory.
+ *                  Memory must stay valid until font is closed with \ref gui_font_close.
+ *
+ * \param[out]      font: Font structure to fill. Structure must stay valid while font is used
+ * \param[in]       data: Font file memory
+ * \param[in]       len: Length of font file in units of bytes
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_font_load(gui_font_t* font, const void* data, size_t len) {
+    font_src_t src = {0};
+    gui_font_char_t* chars;
+    uint32_t i, count = 0;
+    uint8_t ret;
+    
+    GUI_ASSERTPARAMS(font != NULL && data != NULL);
+    memset(font, 0x00, sizeof(*font));
+    src.mem = data;
+    src.len = len;
+    
+    GUI_CORE_PROTECT(1);
+    ret = font_parse(font, &src);
+    if (ret) {
+        chars = (gui_font_char_t *)font->data;
+        for (i = 0; i < font->range_count; i++) {   /* Get number of characters */
+            count = GUI_MAX(count, (uint32_t)font->ranges[i].index + font->ranges[i].count);
+        }
+        for (i = 0; i < count; i++) {               /* Convert offsets to pointers */
+            size_t offset = (size_t)chars[i].data;
+            uint8_t valid;
+            
+            /* Length header of compressed data must be inside data before it is read */
+            valid = offset <= len && (!(font->flags & GUI_FLAG_FONT_RLE) || len - offset >= 2);
+            chars[i].data = (const uint8_t *)data + offset;
+            if (!valid || gui_text_getchardatasize(font, &chars[i]) > len - offset) {
+                GUI_MEMFREE(chars);
+                memset(font, 0x00, sizeof(*font));
+                ret = 0;
+                break;
+            }
+        }
+    }
+    GUI_CORE_UNPROTECT(1);
+    return ret;
+}
+
+/**
+ * \brief           Open font file on external storage with paged character access
+ *
+ *                  Only font tables are read to RAM. Character data are read with `read` function
+ *                  and converted to character cache when character is drawn for the first time.
+ *
+ * \note            Character cache must be enabled, see \ref GUI_CFG_FONT_CACHE_SIZE
+ * \param[out]      font: Font structure to fill. Structure must stay valid while font is used
+ * \param[in]       read: Function to read font file data
+ * \param[in]       arg: User argument for read function, available as `font->arg`
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_font_open(gui_font_t* font, uint8_t (*read)(const gui_font_t* font, size_t offset, void* data, size_t len), void* arg) {
+    font_src_t src = {0};
+    uint8_t ret;
+    
+    GUI_ASSERTPARAMS(font != NULL && read != NULL);
+    memset(font, 0x00, sizeof(*font));
+    font->read = read;
+    font->arg = arg;
+    src.font = font;
+    
+    GUI_CORE_PROTECT(1);
+    ret = font_parse(font, &src);
+    if (!ret) {
+        memset(font, 0x00, sizeof(*font));
+    }
+    GUI_CORE_UNPROTECT(1);
+    return ret;
+}
+
+/**
+ * \brief           Close font opened with \ref gui_font_load or \ref gui_font_open
+ *
+ *                  Cached characters of font are removed and font tables are released.
+ *
+ * \note            Font must not be used by any widget anymore
+ * \param[in]       font: Font to close
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_font_close(gui_font_t* font) {
+    void* mem;
+    
+    GUI_ASSERTPARAMS(font != NULL && font->data != NULL);
+    
+    GUI_CORE_PROTECT(1);
+    gui_text_cacheremove(font);                     /* Cache entries point to font */
+    mem = (void *)font->data;                       /* All tables are in single block */
+    GUI_MEMFREE(mem);
+    memset(font, 0x00, sizeof(*font));
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+}
+
+/**
+ * \brief           Read characters of string to character cache before they are drawn
+ *
+ *                  Useful for fonts opened with \ref gui_font_open, to read glyphs
+ *                  of next screen from slow storage before drawing starts.
+ *
+ * \param[in]       font: Font to use
+ * \param[in]       str: String with characters to prefetch
+ * \return          Number of characters available in cache
+ */
+size_t
+gui_font_prefetch(const gui_font_t* font, const gui_char* str) {
+    const gui_font_char_t* c;
+    gui_string_t s;
+    uint32_t ch;
+    uint8_t l;
+    size_t cnt = 0;
+    
+    GUI_ASSERTPARAMS(font != NULL && str != NULL);
+    
+    GUI_CORE_PROTECT(1);
+    gui_string_prepare(&s, str);
+    while (gui_string_getch(&s, &ch, &l)) {
+        if ((c = gui_text_getchardesc(font, ch)) == NULL || !c->x_size || !c->y_size) {
+            continue;
+        }
+        if (gui_text_getcharentry(font, c) != NULL || gui_text_createcharentry(font, c) != NULL) {
+            cnt++;
+        }
+    }
+    GUI_CORE_UNPROTECT(1);
+    return cnt;
+}
+
+#endif /* GUI_CFG_USE_FONT_FILE || __DOXYGEN__ */
@@ -0,0 +1,282 @@
+/**    
+ * \file            gui_gesture.c
+ * \brief           Touch gesture recognizer
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_gesture.h"
+#include "widget/gui_widget.h"
+
+#if (GUI_CFG_USE_TOUCH && GUI_CFG_USE_GESTURE) || __DOXYGEN__
+
+#define GESTURE_REST_TIME           100     /* Time after last touch movement when release is not fling */
+
+#define G                           (&GUI.gesture)
+
+/**
+ * \brief           Send gesture to widget and its parents until handled
+ * \param[in]       g: Gesture data with type and values set, position is absolute
+ */
+static void
+gesture_send(gui_gesture_t* g) {
+    gui_evt_param_t param = {0};
+    gui_handle_p h;
+    gui_dim_t x = g->x, y = g->y;
+    
+    GUI_EVT_PARAMTYPE_GESTURE(&param) = g;
+    for (h = G->h; h != NULL; h = guii_widget_getparent(h)) {
+        g->x = x - gui_widget_getabsolutex(h);      /* Position relative to widget */
+        g->y = y - gui_widget_getabsolutey(h);
+        if (guii_widget_callback(h, GUI_EVT_GESTURE, &param, NULL)) {
+            break;
+        }
+    }
+    g->x = x;                                       /* Restore absolute position for next gesture */
+    g->y = y;
+}
+
+/**
+ * \brief           Get distance between first `2` touches with integer math
+ * \param[in]       ts: Touch sample
+ * \return          Distance in units of pixels
+ */
+static uint32_t
+gesture_distance(const gui_touch_data_t* ts) {
+    int32_t dx = (int32_t)ts->x[1] - ts->x[0], dy = (int32_t)ts->y[1] - ts->y[0];
+    uint32_t d;
+    
+    gui_math_isqrt((uint32_t)(dx * dx + dy * dy), &d);
+    return d;
+}
+
+/**
+ * \brief           Get angle of line between first `2` touches
+ * \param[in]       ts: Touch sample
+ * \return          Angle in units of `0.1` degree
+ */
+static int16_t
+gesture_angle(const gui_touch_data_t* ts) {
+    int16_t a;
+    
+    gui_math_iatan2((int32_t)ts->y[1] - ts->y[0], (int32_t)ts->x[1] - ts->x[0], &a);
+    return a;
+}
+
+/**
+ * \brief           Process movement of all samples received since previous call
+ */
+static void
+gesture_frame(void) {
+    gui_gesture_t g = {0};
+    int32_t dx, dy, dt;
+    
+    G->pending = 0;
+    if (G->h == NULL) {
+        G->prev = G->last;
+        return;
+    }
+    
+    /* Velocity of single touch, averaged with previous estimate */
+    dt = (int32_t)(G->last.time - G->prev.time);
+    dx = (int32_t)G->last.x[0] - G->prev.x[0];
+    dy = (int32_t)G->last.y[0] - G->prev.y[0];
+    if (G->last.count == 1 && dt > 0 && (dx || dy)) {
+        G->speed_x = (G->speed_x + dx * 1000 / dt) / 2;
+        G->speed_y = (G->speed_y + dy * 1000 / dt) / 2;
+        G->move_time = G->last.time;
+    }
+    
+#if GUI_CFG_TOUCH_MAX_PRESSES > 1
+    /* Scale and rotation of 2 touches */
+    if (G->last.count == 2) {
+        uint32_t dist = gesture_distance(&G->last);
+        int16_t angle = gesture_angle(&G->last), da;
+        
+        g.x = (G->last.x[0] + G->last.x[1]) / 2;
+        g.y = (G->last.y[0] + G->last.y[1]) / 2;
+        g.dx = g.x - (G->start.x[0] + G->start.x[1]) / 2;
+        g.dy = g.y - (G->start.y[0] + G->start.y[1]) / 2;
+        if (G->distance > 0 && dist != G->distance) {
+            g.type = GUI_GESTURE_PINCH;
+            g.scale = (int32_t)((dist << 8) / G->distance);
+            gesture_send(&g);
+        }
+        da = angle - G->angle;
+        if (da > 1800) {                            /* Shortest rotation */
+            da -= 3600;
+        } else if (da < -1800) {
+            da += 3600;
+        }
+        if (da != 0) {
+            g.type = GUI_GESTURE_ROTATE;
+            g.scale = 256;
+            g.angle = da;
+            gesture_send(&g);
+        }
+        G->distance = dist;
+        G->angle = angle;
+    }
+#endif /* GUI_CFG_TOUCH_MAX_PRESSES > 1 */
+    G->prev = G->last;
+}
+
+/**
+ * \brief           Finish gesture on touch release
+ * \param[in]       time: Release time
+ */
+static void
+gesture_end(uint32_t time) {
+    gui_gesture_t g = {0};
+    int32_t ax, ay;
+    
+    if (G->h == NULL || G->start.count != 1 || G->last.count != 1) {
+        return;                                     /* Swipe and fling only for single touch */
+    }
+    g.x = G->last.x[0];
+    g.y = G->last.y[0];
+    g.dx = G->last.x[0] - G->start.x[0];
+    g.dy = G->last.y[0] - G->start.y[0];
+    g.scale = 256;
+    ax = GUI_ABS(g.dx);
+    ay = GUI_ABS(g.dy);
+    if (ax > 2 * ay) {                              /* Dominant direction */
+        g.dir = g.dx < 0 ? GUI_GESTURE_DIR_LEFT : GUI_GESTURE_DIR_RIGHT;
+    } else if (ay > 2 * ax) {
+        g.dir = g.dy < 0 ? GUI_GESTURE_DIR_UP : GUI_GESTURE_DIR_DOWN;
+    }
+    if ((time - G->move_time) > GESTURE_REST_TIME) {
+        G->speed_x = 0;                             /* Touch was resting before release */
+        G->speed_y = 0;
+    }
+    g.speed_x = G->speed_x;
+    g.speed_y = G->speed_y;
+    
+    if (g.dir != GUI_GESTURE_DIR_NONE && GUI_MAX(ax, ay) >= GUI_CFG_GESTURE_SWIPE_MIN
+        && (G->last.time - G->start.time) <= GUI_CFG_GESTURE_SWIPE_TIME) {
+        g.type = GUI_GESTURE_SWIPE;
+        gesture_send(&g);
+    }
+    if (GUI_ABS(g.speed_x) >= GUI_CFG_GESTURE_FLING_SPEED || GUI_ABS(g.speed_y) >= GUI_CFG_GESTURE_FLING_SPEED) {
+        g.type = GUI_GESTURE_FLING;
+        gesture_send(&g);
+    }
+}
+
+/**
+ * \brief           Store new touch sample
+ *
+ *                  Movement samples are only stored and processed later with \ref guii_gesture_process,
+ *                  press, release and change of number of touches are processed immediately
+ *
+ * \note            Must be called after touch sample was dispatched to widgets and active widget is known
+ * \param[in]       ts: Touch sample
+ */
+void
+guii_gesture_sample(const gui_touch_data_t* const ts) {
+    if (ts->status && G->pressed && ts->count == G->last.count) {
+        G->last = *ts;                              /* Coalesce movement */
+        G->pending = 1;
+        return;
+    }
+    if (G->pending) {
+        gesture_frame();                            /* Process remaining movement first */
+    }
+    if (!ts->status) {                              /* Touch released */
+        if (G->pressed) {
+            gesture_end(ts->time);
+        }
+        G->pressed = 0;
+        G->h = NULL;
+        return;
+    }
+    if (!G->pressed) {                              /* New touch */
+        G->h = GUI.active_widget;
+        G->speed_x = 0;
+        G->speed_y = 0;
+    }
+    G->start = *ts;                                 /* Number of touches changed, restart gesture */
+    G->prev = *ts;
+    G->last = *ts;
+    G->move_time = ts->time;
+    G->pressed = 1;
+#if GUI_CFG_TOUCH_MAX_PRESSES > 1
+    if (ts->count == 2) {
+        G->distance = gesture_distance(ts);
+        G->angle = gesture_angle(ts);
+    }
+#endif /* GUI_CFG_TOUCH_MAX_PRESSES > 1 */
+}
+
+/**
+ * \brief           Process touch movement received since previous call
+ * \note            Called once per \ref gui_process call after all touch samples are read
+ */
+void
+guii_gesture_process(void) {
+    if (G->pending) {
+        gesture_frame();
+    }
+}
+
+/**
+ * \brief           Get touch velocity of current or just released single touch
+ * \param[out]      speed_x: Pointer to output `X` velocity in units of pixels per second
+ * \param[out]      speed_y: Pointer to output `Y` velocity in units of pixels per second
+ * \return          `1` if velocity is available, `0` otherwise
+ */
+uint8_t
+guii_gesture_getspeed(int32_t* const speed_x, int32_t* const speed_y) {
+    if (G->last.count != 1) {
+        return 0;
+    }
+    *speed_x = G->speed_x;
+    *speed_y = G->speed_y;
+    return 1;
+}
+
+/**
+ * \brief           Stop sending gestures to widget which is being removed
+ * \param[in]       h: Widget handle
+ */
+void
+guii_gesture_remove(gui_handle_p h) {
+    gui_handle_p p;
+    
+    for (p = G->h; p != NULL; p = guii_widget_getparent(p)) {
+        if (p == h) {                               /* Widget or one of its parents is removed */
+            G->h = NULL;
+            break;
+        }
+    }
+}
+
+#endif /* (GUI_CFG_USE_TOUCH && GUI_CFG_USE_GESTURE) || __DOXYGEN__ */
@@ -36,36 +36,349 @@
 #include "gui/gui_input.h"
 #include "system/gui_sys.h"
 
+/**
+ * \brief           Lock-free single-producer single-consumer ring buffer
+ *
+ *                  Indices are free-running and only producer writes `in` and only consumer writes `out`,
+ *                  thus buffer may be written from interrupt context while GUI thread reads it
+ */
+typedef struct {
+    uint8_t* data;                          /*!< Pointer to entries memory */
+    size_t entry_size;                      /*!< Size of single entry in units of bytes */
+    size_t mask;                            /*!< Number of entries minus `1`, number of entries must be power of `2` */
+    volatile size_t in;                     /*!< Number of entries written, modified by producer only */
+    volatile size_t out;                    /*!< Number of entries read, modified by consumer only */
+} gui_input_ring_t;
+
 /* Define buffers */
 #if GUI_CFG_USE_TOUCH
-static gui_buff_t buff_ts;
-static uint8_t buff_ts_data[sizeof(gui_touch_data_t) * GUI_CFG_TOUCH_BUFFER_SIZE + 1];
+static gui_input_ring_t buff_ts;
+static gui_touch_data_t buff_ts_data[GUI_CFG_TOUCH_BUFFER_SIZE];
 #endif /* GUI_CFG_USE_TOUCH */
 
 #if GUI_CFG_USE_KEYBOARD
-static gui_buff_t buff_kb;
-static uint8_t buff_kb_data[sizeof(gui_keyboard_data_t) * GUI_CFG_KEYBOARD_BUFFER_SIZE *  + 1];
+static gui_input_ring_t buff_kb;
+static gui_keyboard_data_t buff_kb_data[GUI_CFG_KEYBOARD_BUFFER_SIZE];
 #endif /* GUI_CFG_USE_KEYBOARD */
 
+#if GUI_CFG_USE_INPUT_RECORD
+/**
+ * \brief           Input recorder and replayer
+ */
+typedef struct {
+    gui_input_record_t* rec;                /*!< Records memory, `NULL` when not recording */
+    size_t rec_size;                        /*!< Number of records memory can hold */
+    size_t rec_count;                       /*!< Number of records written */
+    uint32_t rec_start;                     /*!< Time when recording started */
+    const gui_input_record_t* play;         /*!< Records to replay, `NULL` when not replaying */
+    size_t play_count;                      /*!< Number of records to replay */
+    size_t play_pos;                        /*!< Index of next record to replay */
+    uint32_t play_start;                    /*!< Time when replay started */
+    gui_input_replay_fn play_fn;            /*!< Replay function for marks */
+    void* play_arg;                         /*!< Custom argument of replay function */
+} gui_input_record_ctx_t;
+
+static gui_input_record_ctx_t record;
+#endif /* GUI_CFG_USE_INPUT_RECORD */
+
+/**
+ * \brief           Initialize ring buffer
+ * \param[in]       r: Ring buffer handle
+ * \param[in]       data: Pointer to memory for entries
+ * \param[in]       entry_size: Size of single entry in units of bytes
+ * \param[in]       count: Number of entries, must be power of `2`
+ */
+static void
+ring_init(gui_input_ring_t* r, void* data, size_t entry_size, size_t count) {
+    r->data = data;
+    r->entry_size = entry_size;
+    r->mask = count - 1;
+    r->in = 0;
+    r->out = 0;
+}
+
+/**
+ * \brief           Write entry to ring buffer. Must be called by producer only
+ * \param[in]       r: Ring buffer handle
+ * \param[in]       d: Pointer to entry to write
+ * \param[out]      was_empty: Set to `1` if buffer was empty before write, thus consumer must be notified
+ * \return          `1` on success, `0` if buffer is full
+ */
+static uint8_t
+ring_write(gui_input_ring_t* r, const void* d, uint8_t* was_empty) {
+    size_t in = r->in, out = r->out;
+
+    if (in - out > r->mask) {                       /* Check if buffer is full */
+        *was_empty = 0;
+        return 0;
+    }
+    memcpy(&r->data[(in & r->mask) * r->entry_size], d, r->entry_size);
+    GUI_CFG_MEMORY_BARRIER();                       /* Entry must be stored before it is published */
+    r->in = in + 1;
+    *was_empty = in == out;
+    return 1;
+}
+
+#if GUI_CFG_USE_TOUCH
+
+/**
+ * \brief           Get free entry to write in place. Must be called by producer only
+ * \param[in]       r: Ring buffer handle
+ * \return          Pointer to entry memory or `NULL` if buffer is full
+ */
+static void*
+ring_getwrite(gui_input_ring_t* r) {
+    size_t in = r->in;
+
+    if (in - r->out > r->mask) {                    /* Check if buffer is full */
+        return NULL;
+    }
+    return &r->data[(in & r->mask) * r->entry_size];
+}
+
+/**
+ * \brief           Publish entry written to memory from \ref ring_getwrite. Must be called by producer only
+ * \param[in]       r: Ring buffer handle
+ * \return          `1` if buffer was empty before write, thus consumer must be notified
+ */
+static uint8_t
+ring_commit(gui_input_ring_t* r) {
+    size_t in = r->in;
+
+    GUI_CFG_MEMORY_BARRIER();                       /* Entry must be stored before it is published */
+    r->in = in + 1;
+    return in == r->out;
+}
+
+#endif /* GUI_CFG_USE_TOUCH */
+
+/**
+ * \brief           Read entry from ring buffer. Must be called by consumer only
+ * \param[in]       r: Ring buffer handle
+ * \param[out]      d: Pointer to memory to save entry to
+ * \return          `1` on success, `0` if buffer is empty
+ */
+static uint8_t
+ring_read(gui_input_ring_t* r, void* d) {
+    size_t out = r->out;
+
+    if (r->in == out) {                             /* Check if buffer is empty */
+        return 0;
+    }
+    GUI_CFG_MEMORY_BARRIER();                       /* Read entry only after it was published */
+    memcpy(d, &r->data[(out & r->mask) * r->entry_size], r->entry_size);
+    GUI_CFG_MEMORY_BARRIER();                       /* Entry must be read before slot is released to producer */
+    r->out = out + 1;
+    return 1;
+}
+
+/**
+ * \brief           Get time of oldest entry in ring buffer. Must be called by consumer only
+ * \param[in]       r: Ring buffer handle
+ * \param[in]       offset: Offset of `uint32_t` time field in entry structure
+ * \param[out]      time: Pointer to output time
+ * \return          `1` if entry exists, `0` if buffer is empty
+ */
+static uint8_t
+ring_peektime(gui_input_ring_t* r, size_t offset, uint32_t* time) {
+    size_t out = r->out;
+
+    if (r->in == out) {                             /* Check if buffer is empty */
+        return 0;
+    }
+    GUI_CFG_MEMORY_BARRIER();                       /* Read entry only after it was published */
+    memcpy(time, &r->data[(out & r->mask) * r->entry_size + offset], sizeof(*time));
+    return 1;
+}
+
+#if GUI_CFG_USE_TOUCH
+
+/**
+ * \brief           Get oldest entry from ring buffer without removing or copying it. Must be called by consumer only
+ * \param[in]       r: Ring buffer handle
+ * \return          Pointer to entry in buffer memory, valid until entry is read, or `NULL` if buffer is empty
+ */
+static const void*
+ring_peek(gui_input_ring_t* r) {
+    size_t out = r->out;
+
+    if (r->in == out) {                             /* Check if buffer is empty */
+        return NULL;
+    }
+    GUI_CFG_MEMORY_BARRIER();                       /* Read entry only after it was published */
+    return &r->data[(out & r->mask) * r->entry_size];
+}
+
+#endif /* GUI_CFG_USE_TOUCH */
+
+#if GUI_CFG_USE_INPUT_RECORD
+
+/**
+ * \brief           Add entry to recording
+ * \note            Function is called by GUI thread with core protection
+ * \param[in]       type: Record type of \ref gui_input_record_type_t
+ * \param[in]       time: Time of entry
+ * \param[in]       data: Pointer to entry data
+ * \param[in]       size: Size of entry data in units of bytes
+ */
+static void
+record_add(uint8_t type, uint32_t time, const void* data, size_t size) {
+    gui_input_record_t* r;
+    
+    if (record.rec == NULL || record.rec_count >= record.rec_size) {
+        return;
+    }
+    r = &record.rec[record.rec_count++];
+    r->time = time - record.rec_start;
+    r->type = type;
+    memcpy(&r->data, data, size);
+}
+
+#endif /* GUI_CFG_USE_INPUT_RECORD */
+
+/**
+ * \brief           Notify GUI thread about new input entry
+ * \param[in]       was_empty: Set to `1` if input buffer was empty before new entry
+ * \param[in]       isr: Set to `1` when called from interrupt context
+ */
+static void
+notify_input(uint8_t was_empty, uint8_t isr) {
+#if GUI_CFG_OS
+    /* GUI thread reads all entries after wakeup, notify it only on first entry */
+    if (was_empty) {
+        if (isr) {
+            guii_wakeup_isr(GUI_SYS_WAKEUP_INPUT);
+        } else {
+            guii_wakeup(GUI_SYS_WAKEUP_INPUT);
+        }
+    }
+#else /* GUI_CFG_OS */
+    GUI_UNUSED(was_empty);
+    GUI_UNUSED(isr);
+#endif /* !GUI_CFG_OS */
+}
+
 #if GUI_CFG_USE_TOUCH || __DOXYGEN__
 
+/**
+ * \brief           Add new touch entry and notify GUI thread
+ * \param[in]       ts: Pointer to touch data
+ * \param[in]       isr: Set to `1` when called from interrupt context
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+touch_add(gui_touch_data_t* const ts, uint8_t isr) {
+    uint8_t ret, was_empty;
+    
+    ts->time = gui_sys_now();                       /* Set event time */
+    ret = ring_write(&buff_ts, ts, &was_empty);     /* Write data to buffer */
+    GUI_TRACE(GUI_TRACE_EVT_TOUCH_RECEIVED, ts->count);
+    notify_input(was_empty, isr);                   /* Notify stack about new touch added */
+    return ret;
+}
+
 /**
  * \brief           Add new touch data to internal buffer for further processing
+ * \note            Function may be called from single producer thread.
+ *                  Use \ref gui_input_touchadd_isr when touch is read in interrupt
  * \param[in]       ts: Pointer to \ref gui_touch_data_t touch data with valid input
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
 gui_input_touchadd(gui_touch_data_t* const ts) {
-    uint8_t ret;
     GUI_ASSERTPARAMS(ts);
+    return touch_add(ts, 0);
+}
+
+/**
+ * \brief           Add new touch data to internal buffer from interrupt context
+ * \note            Buffer is lock-free for single producer, do not mix calls from interrupt and thread
+ * \param[in]       ts: Pointer to \ref gui_touch_data_t touch data with valid input
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_input_touchadd_isr(gui_touch_data_t* const ts) {
+    GUI_ASSERTPARAMS(ts);
+    return touch_add(ts, 1);
+}
+
+/**
+ * \brief           Get memory of next touch entry to fill it in place
+ *
+ *                  Touch driver may write entry directly to buffer, for example by DMA,
+ *                  and then publish it with \ref gui_input_touchcommit or \ref gui_input_touchcommit_isr.
+ *                  Entry is not added to buffer until it is committed
+ *
+ * \note            Function may be called from single producer only, the same as \ref gui_input_touchadd
+ * \return          Pointer to entry memory or `NULL` if buffer is full
+ */
+gui_touch_data_t*
+gui_input_touchgetentry(void) {
+    return ring_getwrite(&buff_ts);
+}
+
+/**
+ * \brief           Add touch entry filled in memory from \ref gui_input_touchgetentry and notify GUI thread
+ * \param[in]       isr: Set to `1` when called from interrupt context
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+touch_commit(uint8_t isr) {
+    gui_touch_data_t* ts = ring_getwrite(&buff_ts);
     
+    if (ts == NULL) {
+        return 0;
+    }
     ts->time = gui_sys_now();                       /* Set event time */
-    ret = gui_buffer_write(&buff_ts, ts, sizeof(*ts)) ? 1 : 0;  /* Write data to buffer */
-    
-#if GUI_CFG_OS
-    gui_sys_mbox_putnow(&GUI.OS.mbox, NULL);        /* Notify stack about new key added */
-#endif /* GUI_CFG_OS */
-    return ret;
+    GUI_TRACE(GUI_TRACE_EVT_TOUCH_RECEIVED, ts->count);
+    notify_input(ring_commit(&buff_ts), isr);       /* Notify stack about new touch added */
+    return 1;
+}
+
+/**
+ * \brief           Add touch entry filled in memory returned by \ref gui_input_touchgetentry
+ * \note            Function may be called from single producer thread
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_input_touchcommit(void) {
+    return touch_commit(0);
+}
+
+/**
+ * \brief           Add touch entry filled in memory returned by \ref gui_input_touchgetentry from interrupt context
+ * \note            Buffer is lock-free for single producer, do not mix calls from interrupt and thread
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_input_touchcommit_isr(void) {
+    return touch_commit(1);
+}
+
+/**
+ * \brief           Read touch entry from buffer and map its positions to logical screen
+ * \param[out]      ts: Pointer to \ref gui_touch_data_t structure to save touch into to
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+touch_read(gui_touch_data_t* const ts) {
+    if (!ring_read(&buff_ts, ts)) {
+        return 0;
+    }
+#if GUI_CFG_USE_INPUT_RECORD
+    record_add(GUI_INPUT_RECORD_TOUCH, ts->time, ts, sizeof(*ts));  /* Record entry as received from driver */
+#endif /* GUI_CFG_USE_INPUT_RECORD */
+#if GUI_CFG_USE_LCD_ROTATION
+    {
+        size_t i;
+        
+        /* Touch panel is mounted on physical display */
+        for (i = 0; i < GUI_CFG_TOUCH_MAX_PRESSES; i++) {
+            guii_lcd_rotation_point(&ts->x[i], &ts->y[i]);
+        }
+    }
+#endif /* GUI_CFG_USE_LCD_ROTATION */
+    return 1;
 }
 
 /**
@@ -75,11 +388,28 @@ gui_input_touchadd(gui_touch_data_t* const ts) {
  */
 uint8_t
 guii_input_touchread(gui_touch_data_t* const ts) {
-    if (gui_buffer_getfull(&buff_ts) >= sizeof(*ts)) {
-        gui_buffer_read(&buff_ts, ts, sizeof(*ts)); /* Read data from buffer */
-        return 1;
+    return touch_read(ts);                          /* Read data from buffer */
+}
+
+/**
+ * \brief           Read latest touch entry of consecutive move samples
+ *
+ *                  Pressed samples with the same number of touches as `ts` are removed from buffer
+ *                  and only the latest one is saved to `ts`. Press and release transitions are kept in buffer.
+ *
+ * \param[in,out]   ts: Current pressed touch entry, updated with latest compatible entry
+ * \return          Number of entries merged into `ts`
+ */
+size_t
+guii_input_touchcompress(gui_touch_data_t* const ts) {
+    const gui_touch_data_t* next;
+    size_t cnt = 0;
+
+    while ((next = ring_peek(&buff_ts)) != NULL && next->status && next->count == ts->count) {
+        touch_read(ts);                             /* Replace with newer sample */
+        cnt++;
     }
-    return 0;
+    return cnt;
 }
 
 /**
@@ -88,29 +418,62 @@ guii_input_touchread(gui_touch_data_t* const ts) {
  */
 uint8_t
 guii_input_touchavailable(void) {
-    return gui_buffer_getfull(&buff_ts) > 0;       /* Check if any available touch */
+    return buff_ts.in != buff_ts.out;               /* Check if any available touch */
+}
+
+/**
+ * \brief           Get time of oldest touch entry in buffer
+ * \param[out]      time: Pointer to output time
+ * \return          `1` if entry is available, `0` otherwise
+ */
+uint8_t
+guii_input_touchnexttime(uint32_t* const time) {
+    return ring_peektime(&buff_ts, offsetof(gui_touch_data_t, time), time);
 }
 
 #endif /* GUI_CFG_USE_TOUCH || __DOXYGEN__ */
 
 #if GUI_CFG_USE_KEYBOARD || __DOXYGEN__
 
+/**
+ * \brief           Add new key entry and notify GUI thread
+ * \param[in]       kb: Pointer to key data
+ * \param[in]       isr: Set to `1` when called from interrupt context
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+key_add(gui_keyboard_data_t* const kb, uint8_t isr) {
+    uint8_t ret, was_empty;
+    
+    kb->time = gui_sys_now();                       /* Set event time */
+    ret = ring_write(&buff_kb, kb, &was_empty);     /* Write data to buffer */
+    notify_input(was_empty, isr);                   /* Notify stack about new key added */
+    return ret;
+}
+
 /**
  * \brief           Add new key data to internal buffer for further processing
+ * \note            Function may be called from single producer thread.
+ *                  Use \ref gui_input_keyadd_isr when key is read in interrupt
  * \param[in]       kb: Pointer to \ref gui_keyboard_data_t key data
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
 gui_input_keyadd(gui_keyboard_data_t* const kb) {
-    uint8_t ret;
     GUI_ASSERTPARAMS(kb);
-    kb->time = gui_sys_now();                       /* Set event time */
-    ret = gui_buffer_write(&buff_kb, kb, sizeof(*kb)) ? 1 : 0; /* Write data to buffer */
-    
-#if GUI_CFG_OS
-    gui_sys_mbox_putnow(&GUI.OS.mbox, NULL);        /* Notify stack about new key added */
-#endif /* GUI_CFG_OS */
-    return ret;
+    return key_add(kb, 0);
+}
+
+/**
+ * \brief           Add new key data to internal buffer from interrupt context
+ * \note            Buffer is lock-free for single producer, do not mix calls from interrupt and thread
+ * \param[in]       kb: Pointer to \ref gui_keyboard_data_t key data
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_input_keyadd_isr(gui_keyboard_data_t* const kb) {
+    GUI_ASSERTPARAMS(kb);
+    return key_add(kb, 1);
 }
 
 /**
@@ -120,13 +483,186 @@ gui_input_keyadd(gui_keyboard_data_t* const kb) {
  */
 uint8_t
 guii_input_keyread(gui_keyboard_data_t* const kb) {
-    if (gui_buffer_getfull(&buff_kb) >= sizeof(*kb)) {
-        gui_buffer_read(&buff_kb, kb, sizeof(*kb)); /* Read data from buffer */
+    if (!ring_read(&buff_kb, kb)) {                 /* Read data from buffer */
+        return 0;
+    }
+#if GUI_CFG_USE_INPUT_RECORD
+    record_add(GUI_INPUT_RECORD_KEY, kb->time, kb, sizeof(*kb));
+#endif /* GUI_CFG_USE_INPUT_RECORD */
+    return 1;
+}
+
+/**
+ * \brief           Get time of oldest keyboard entry in buffer
+ * \param[out]      time: Pointer to output time
+ * \return          `1` if entry is available, `0` otherwise
+ */
+uint8_t
+guii_input_keynexttime(uint32_t* const time) {
+    return ring_peektime(&buff_kb, offsetof(gui_keyboard_data_t, time), time);
+}
+#endif /* GUI_CFG_USE_KEYBOARD || __DOXYGEN__ */
+
+/**
+ * \brief           Checks if any touch or keyboard entry is waiting to be processed
+ * \return          `1` if entry is available, `0` otherwise
+ */
+uint8_t
+guii_input_available(void) {
+#if GUI_CFG_USE_TOUCH
+    if (buff_ts.in != buff_ts.out) {
         return 1;
     }
+#endif /* GUI_CFG_USE_TOUCH */
+#if GUI_CFG_USE_KEYBOARD
+    if (buff_kb.in != buff_kb.out) {
+        return 1;
+    }
+#endif /* GUI_CFG_USE_KEYBOARD */
     return 0;
 }
-#endif /* GUI_CFG_USE_KEYBOARD || __DOXYGEN__ */
+
+#if GUI_CFG_USE_INPUT_RECORD || __DOXYGEN__
+
+/**
+ * \brief           Start recording of input entries
+ *
+ *                  Each touch and keyboard entry read by GUI is saved to memory with its time
+ *                  relative to start of recording. Entries are saved as received from driver,
+ *                  thus replay goes through the same processing. Records over memory size are dropped
+ * \param[in]       rec: Memory for records
+ * \param[in]       size: Number of records memory can hold
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_input_record_start(gui_input_record_t* rec, size_t size) {
+    GUI_ASSERTPARAMS(rec != NULL && size > 0);
+    
+    GUI_CORE_PROTECT(1);
+    record.rec = rec;
+    record.rec_size = size;
+    record.rec_count = 0;
+    record.rec_start = gui_sys_now();
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+}
+
+/**
+ * \brief           Stop recording of input entries
+ * \return          Number of records saved to memory
+ */
+size_t
+gui_input_record_stop(void) {
+    size_t cnt;
+    
+    GUI_CORE_PROTECT(1);
+    cnt = record.rec_count;
+    record.rec = NULL;
+    GUI_CORE_UNPROTECT(1);
+    return cnt;
+}
+
+/**
+ * \brief           Add application mark to recording
+ *
+ *                  Application marks its own widget updates, such as value set from sensor data,
+ *                  and applies them again in replay function of \ref gui_input_replay_start
+ * \param[in]       mark: Custom mark value
+ * \return          `1` on success, `0` if not recording or memory is full
+ */
+uint8_t
+gui_input_record_mark(uint32_t mark) {
+    uint8_t ret;
+    
+    GUI_CORE_PROTECT(1);
+    ret = record.rec != NULL && record.rec_count < record.rec_size;
+    record_add(GUI_INPUT_RECORD_MARK, gui_sys_now(), &mark, sizeof(mark));
+    GUI_CORE_UNPROTECT(1);
+    return ret;
+}
+
+/**
+ * \brief           Start replay of recorded input entries
+ *
+ *                  Records are replayed with \ref gui_input_replay_process at their time relative
+ *                  to start of replay. With virtual clock returned by \ref gui_sys_now,
+ *                  each replay with the same steps of clock processes the same entries in the same frames
+ * \note            Records memory must stay valid until replay is finished
+ * \param[in]       rec: Records saved with \ref gui_input_record_start
+ * \param[in]       count: Number of records
+ * \param[in]       fn: Replay function for marks, may be `NULL`
+ * \param[in]       arg: Custom argument passed to replay function
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_input_replay_start(const gui_input_record_t* rec, size_t count, gui_input_replay_fn fn, void* arg) {
+    GUI_ASSERTPARAMS(rec != NULL || !count);
+    
+    record.play = rec;
+    record.play_count = count;
+    record.play_pos = 0;
+    record.play_fn = fn;
+    record.play_arg = arg;
+    record.play_start = gui_sys_now();
+    return 1;
+}
+
+/**
+ * \brief           Replay all records with time up to current time
+ *
+ *                  Touch and keyboard records are added to input buffers and replay function is called
+ *                  for marks. Entries which do not fit to full input buffer are added on next call
+ * \note            Function must be called from the same thread as \ref gui_process,
+ *                  before it and in place of input drivers, which must not add entries during replay
+ * \return          `1` while records are left, `0` when replay is finished
+ */
+uint8_t
+gui_input_replay_process(void) {
+    const gui_input_record_t* r;
+    uint32_t elapsed = gui_sys_now() - record.play_start;
+#if GUI_CFG_USE_TOUCH
+    gui_touch_data_t ts;
+#endif /* GUI_CFG_USE_TOUCH */
+#if GUI_CFG_USE_KEYBOARD
+    gui_keyboard_data_t kb;
+#endif /* GUI_CFG_USE_KEYBOARD */
+    uint8_t ok;
+    
+    for (; record.play_pos < record.play_count; record.play_pos++) {
+        r = &record.play[record.play_pos];
+        if (r->time > elapsed) {
+            break;
+        }
+        ok = 1;
+        switch (r->type) {
+#if GUI_CFG_USE_TOUCH
+            case GUI_INPUT_RECORD_TOUCH:
+                ts = r->data.ts;
+                ok = gui_input_touchadd(&ts);
+                break;
+#endif /* GUI_CFG_USE_TOUCH */
+#if GUI_CFG_USE_KEYBOARD
+            case GUI_INPUT_RECORD_KEY:
+                kb = r->data.kb;
+                ok = gui_input_keyadd(&kb);
+                break;
+#endif /* GUI_CFG_USE_KEYBOARD */
+            case GUI_INPUT_RECORD_MARK:
+                if (record.play_fn != NULL) {
+                    record.play_fn(r->data.mark, record.play_arg);
+                }
+                break;
+            default:
+                break;
+        }
+        if (!ok) {
+            break;                                  /* Buffer is full, retry on next call */
+        }
+    }
+    return record.play_pos < record.play_count;
+}
+
+#endif /* GUI_CFG_USE_INPUT_RECORD || __DOXYGEN__ */
 
 /**
  * \brief           Initialize input manager for GUI
@@ -134,9 +670,9 @@ guii_input_keyread(gui_keyboard_data_t* const kb) {
 void
 guii_input_init(void) {
 #if GUI_CFG_USE_TOUCH
-    gui_buffer_init(&buff_ts, sizeof(buff_ts_data), buff_ts_data);
+    ring_init(&buff_ts, buff_ts_data, sizeof(buff_ts_data[0]), GUI_CFG_TOUCH_BUFFER_SIZE);
 #endif /* GUI_CFG_USE_TOUCH */
 #if GUI_CFG_USE_KEYBOARD
-    gui_buffer_init(&buff_kb, sizeof(buff_kb_data), buff_kb_data);
+    ring_init(&buff_kb, buff_kb_data, sizeof(buff_kb_data[0]), GUI_CFG_KEYBOARD_BUFFER_SIZE);
 #endif /* GUI_CFG_USE_KEYBOARD */
 }
@@ -0,0 +1,147 @@
+/**	
+ * \file            gui_intern.c
+ * \brief           Reference counted string intern table
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_intern.h"
+
+#if GUI_CFG_USE_STRING_INTERN || __DOXYGEN__
+
+/**
+ * \brief           Interned string entry, followed by `NULL` terminated text
+ */
+typedef struct intern_entry {
+    struct intern_entry* next;                      /*!< Next entry in the same bucket */
+    uint32_t hash;                                  /*!< Hash of string content */
+    size_t refs;                                    /*!< Number of references to entry */
+} intern_entry_t;
+
+#define INTERN_HDR_SIZE             GUI_MEM_ALIGN(sizeof(intern_entry_t))
+#define INTERN_TEXT(e)              ((gui_char *)((uint8_t *)(e) + INTERN_HDR_SIZE))
+#define INTERN_ENTRY(t)             ((intern_entry_t *)((uint8_t *)(t) - INTERN_HDR_SIZE))
+
+static intern_entry_t* intern_buckets[GUI_CFG_STRING_INTERN_BUCKETS];
+static size_t intern_count;
+
+/**
+ * \brief           Calculate hash of string content
+ * \param[in]       str: String to hash
+ * \param[out]      len: Length of string in units of bytes, without `NULL` termination
+ * \return          FNV-1a hash value
+ */
+static uint32_t
+intern_hash(const gui_char* str, size_t* len) {
+    const gui_char* s = str;
+    uint32_t h = 2166136261UL;
+    
+    for (; *s; s++) {
+        h = (h ^ (uint8_t)*s) * 16777619UL;
+    }
+    *len = s - str;
+    return h;
+}
+
+/**
+ * \brief           Get shared copy of string and add reference to it
+ *
+ *                  Identical strings return the same pointer, text is copied only on first use.
+ *                  Each call must be paired with \ref gui_intern_release call
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       text: Text to intern
+ * \return          Shared copy of text on success, `NULL` otherwise
+ */
+const gui_char*
+gui_intern_get(const gui_char* text) {
+    intern_entry_t* e;
+    uint32_t hash;
+    size_t len;
+    
+    if (text == NULL) {
+        return NULL;
+    }
+    hash = intern_hash(text, &len);
+    for (e = intern_buckets[hash % GUI_CFG_STRING_INTERN_BUCKETS]; e != NULL; e = e->next) {
+        if (e->hash == hash && (INTERN_TEXT(e) == text || !gui_string_compare(INTERN_TEXT(e), text))) {
+            e->refs++;
+            return INTERN_TEXT(e);
+        }
+    }
+    if ((e = GUI_MEMALLOC(INTERN_HDR_SIZE + sizeof(*text) * (len + 1))) == NULL) {
+        return NULL;
+    }
+    memcpy(INTERN_TEXT(e), text, sizeof(*text) * (len + 1));
+    e->hash = hash;
+    e->refs = 1;
+    e->next = intern_buckets[hash % GUI_CFG_STRING_INTERN_BUCKETS];
+    intern_buckets[hash % GUI_CFG_STRING_INTERN_BUCKETS] = e;
+    intern_count++;
+    return INTERN_TEXT(e);
+}
+
+/**
+ * \brief           Remove reference from shared string, string is deleted with last reference
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       text: Text returned by \ref gui_intern_get or `NULL`
+ */
+void
+gui_intern_release(const gui_char* text) {
+    intern_entry_t **e, *entry;
+    
+    if (text == NULL) {
+        return;
+    }
+    entry = INTERN_ENTRY(text);
+    for (e = &intern_buckets[entry->hash % GUI_CFG_STRING_INTERN_BUCKETS]; *e != NULL; e = &(*e)->next) {
+        if (*e == entry) {
+            if (!--entry->refs) {
+                *e = entry->next;
+                intern_count--;
+                GUI_MEMFREE(entry);
+            }
+            return;
+        }
+    }
+}
+
+/**
+ * \brief           Get number of different strings in intern table
+ * \note            This function is private and may be called only when OS protection is active
+ * \return          Number of strings
+ */
+size_t
+gui_intern_getcount(void) {
+    return intern_count;
+}
+
+#endif /* GUI_CFG_USE_STRING_INTERN || __DOXYGEN__ */
@@ -37,6 +37,9 @@
 #include "widget/gui_container.h"
 #include "widget/gui_button.h"
 
+/* Keyboard is built from container and button widgets */
+#if (GUI_CFG_WIDGET_BUTTON && GUI_CFG_WIDGET_CONTAINER) || __DOXYGEN__
+
 #if !__DOXYGEN__
 
 typedef struct {
@@ -70,6 +73,9 @@ typedef struct {
     
     uint8_t action;                                 /*!< Kbd show/hide action */
     uint8_t action_value;                           /*!< Action custom value */
+#if GUI_CFG_KEYBOARD_SINGLE_WIDGET
+    const key_btn_t* key_pressed;                   /*!< Key currently pressed on layout */
+#endif /* GUI_CFG_KEYBOARD_SINGLE_WIDGET */
 } key_info_t;
 
 #define SPECIAL_123                     ((uint32_t)0x01)
@@ -305,6 +311,337 @@ keyboard = {
 
 #endif /* !__DOXYGEN__ */
 
+/**
+ * \brief           Get text to display on key
+ * \param[in]       kbtn: Key descriptor
+ * \param[out]      str: Output string of at least `10` characters
+ */
+static void
+key_get_text(const key_btn_t* kbtn, gui_char* str) {
+    switch (kbtn->s) {                              /* Check if there is specal key */
+        case SPECIAL_123: 
+            strcpy((char *)str, (const char *)_GT("123"));
+            break;
+        case SPECIAL_ABC: 
+            strcpy((char *)str, (const char *)_GT("abc"));
+            break;
+        case SPECIAL_CALC:
+            strcpy((char *)str, (const char *)_GT("#+="));
+            break;
+        case SPECIAL_BACKSPACE: 
+            strcpy((char *)str, (const char *)_GT("Back"));
+            break;
+        case SPECIAL_ENTER: 
+            strcpy((char *)str, (const char *)_GT("Ent"));
+            break;
+        case SPECIAL_SHIFT: 
+            strcpy((char *)str, (const char *)_GT("Shift"));
+            break;
+        case SPECIAL_HIDE: 
+            strcpy((char *)str, (const char *)_GT("Hide"));
+            break;
+        default:
+            if (keyboard.is_shift && kbtn->cs) {    /* Character when shift is ON */
+                gui_string_unicode_encode(kbtn->cs, str);   /* Encode character to unicode */
+            } else {                                /* Character when shift is OFF */
+                gui_string_unicode_encode(kbtn->c, str);    /* Encode character to unicode */
+            }
+            break;
+    }
+}
+
+/**
+ * \brief           Process click on key
+ * \param[in]       kbtn: Key descriptor
+ */
+static void
+key_process_click(const key_btn_t* kbtn) {
+    gui_handle_p tmp1, tmp2, tmp3;
+    uint32_t ch = 0;
+    /* gui_keyboard_data_t kbd = {0}; */
+    
+    if (kbtn->s) {                                  /* Has button special function? */
+        switch (kbtn->s) {                          /* Check special function */
+            case SPECIAL_123:
+            case SPECIAL_ABC: 
+            case SPECIAL_CALC: {                    /* Special functions 123 or ABC */
+                tmp1 = gui_widget_getbyid(GUI_ID_KEYBOARD_LAYOUT_123);
+                tmp2 = gui_widget_getbyid(GUI_ID_KEYBOARD_LAYOUT_ABC);
+                tmp3 = gui_widget_getbyid(GUI_ID_KEYBOARD_LAYOUT_CALC);
+                
+                if (kbtn->s == SPECIAL_ABC) {
+                    gui_widget_hide(tmp1);
+                    gui_widget_show(tmp2);
+                    gui_widget_hide(tmp3);
+                } else if (kbtn->s == SPECIAL_123) {
+                    gui_widget_show(tmp1);
+                    gui_widget_hide(tmp2);
+                    gui_widget_hide(tmp3);
+                } else if (kbtn->s == SPECIAL_CALC) {
+                    gui_widget_hide(tmp1);
+                    gui_widget_hide(tmp2);
+                    gui_widget_show(tmp3);
+                }
+                SHIFT_DISABLE();
+                break;
+            }
+            case SPECIAL_SHIFT: {
+                SHIFT_TOGGLE();
+                break;
+            }
+            case SPECIAL_BACKSPACE: {
+                ch = GUI_KEY_BACKSPACE;
+                break;
+            }
+            case SPECIAL_HIDE: {
+                gui_keyboard_hide();
+                break;
+            }
+        }
+    }
+                                            
+    /* Check if we have to add key to input buffer */
+    if (ch || !kbtn->s) {                           /* If character from special is set or normal key pressed */
+        if (!ch) {                                  /* Only if char not yet set */
+            if (keyboard.is_shift && kbtn->cs) {    /* If shift mode enabled and character has shift mode character */
+                ch = kbtn->cs;                      /* Use shift mode character */
+            } else {
+                ch = kbtn->c;                       /* Use normal character */
+            }
+        }
+        
+        /* Clear shift mode if necessary */
+        if (keyboard.is_shift != SHIFT_UPPERCASE) { /* When not in uppercase shift mode */
+            SHIFT_DISABLE();                        /* Clear shift mode */
+        }
+        
+        /************************************/
+        /* Send character to focused widget */
+        /************************************/
+        if (keyboard.target != NULL) {
+            gui_evt_param_t param;
+            gui_evt_result_t result;
+            guii_keyboard_data_t key;
+
+            gui_string_unicode_encode(ch, key.kb.keys);/* Decode key */
+            GUI_EVT_PARAMTYPE_KEYBOARD(&param) = &key;
+            GUI_EVT_RESULTTYPE_KEYBOARD(&result) = keyCONTINUE;
+            guii_widget_callback(keyboard.target, GUI_EVT_KEYPRESS, &param, &result);
+
+            key.kb.keys[0] = 0;                     /* Set key to 0 */
+            GUI_EVT_PARAMTYPE_KEYBOARD(&param) = &key;
+            GUI_EVT_RESULTTYPE_KEYBOARD(&result) = keyCONTINUE;
+            guii_widget_callback(keyboard.target, GUI_EVT_KEYPRESS, &param, &result);
+        }
+        //kbd.keys[0] = 0;                            /* Set key to 0 */
+        //gui_input_keyadd(&kbd);                     /* Add end key */
+    }
+}
+
+/**
+ * \brief           Process double click on key
+ * \param[in]       kbtn: Key descriptor
+ * \return          `1` if double click was processed, `0` otherwise
+ */
+static uint8_t
+key_process_dblclick(const key_btn_t* kbtn) {
+    switch (kbtn->s) {
+        case SPECIAL_SHIFT: {
+            SHIFT_ENABLE(SHIFT_UPPERCASE);          /* Enable shift upper case mode */
+            return 1;
+        }
+    }
+    return 0;
+}
+
+#if GUI_CFG_KEYBOARD_SINGLE_WIDGET
+
+/**
+ * \brief           Get key rectangle relative to layout widget
+ * \param[in]       h: Layout widget handle
+ * \param[in]       kbtn: Key descriptor, must be part of layout of widget
+ * \param[out]      x: Output `X` position of key
+ * \param[out]      y: Output `Y` position of key
+ * \param[out]      w: Output key width
+ * \param[out]      hh: Output key height
+ * \return          `1` on success, `0` if key is not part of layout
+ */
+static uint8_t
+key_get_rect(gui_handle_p h, const key_btn_t* kbtn, gui_dim_t* x, gui_dim_t* y, gui_dim_t* w, gui_dim_t* hh) {
+    const key_layout_t* layout = gui_widget_getuserdata(h);
+    gui_dim_t width, height;
+    size_t k;
+    
+    width = gui_widget_getwidth(h);
+    height = gui_widget_getheight(h);
+    for (k = 0; k < layout->rows_count; k++) {
+        const key_row_t* row = &layout->rows[k];
+        if (kbtn >= row->btns && kbtn < &row->btns[row->btns_count]) {
+            /* Use the same geometry as percent values of button widgets */
+            *x = GUI_DIM(width * kbtn->x / 100.0f);
+            *y = GUI_DIM(height * GUI_DIM(1 + (100.0f / layout->rows_count) * k) / 100.0f);
+            *w = GUI_DIM(width * kbtn->w / 100.0f);
+            *hh = GUI_DIM(height * 23.0f / 100.0f);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief           Invalidate only area of single key
+ * \param[in]       h: Layout widget handle
+ * \param[in]       kbtn: Key descriptor or `NULL`
+ */
+static void
+key_invalidate(gui_handle_p h, const key_btn_t* kbtn) {
+    gui_dim_t x, y, w, hh;
+    
+    if (kbtn != NULL && key_get_rect(h, kbtn, &x, &y, &w, &hh)) {
+        gui_widget_invalidatearea(h, x, y, w, hh);
+    }
+}
+
+#if GUI_CFG_USE_TOUCH
+
+/**
+ * \brief           Get key on specific position
+ * \param[in]       h: Layout widget handle
+ * \param[in]       x: `X` position relative to widget
+ * \param[in]       y: `Y` position relative to widget
+ * \return          Key descriptor on success, `NULL` otherwise
+ */
+static const key_btn_t *
+key_get_bypos(gui_handle_p h, gui_dim_t x, gui_dim_t y) {
+    const key_layout_t* layout = gui_widget_getuserdata(h);
+    gui_dim_t kx, ky, kw, kh;
+    size_t k, z;
+    
+    for (k = 0; k < layout->rows_count; k++) {
+        for (z = 0; z < layout->rows[k].btns_count; z++) {
+            const key_btn_t* kbtn = &layout->rows[k].btns[z];
+            key_get_rect(h, kbtn, &kx, &ky, &kw, &kh);
+            if (x >= kx && x < (kx + kw) && y >= ky && y < (ky + kh)) {
+                return kbtn;
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Set pressed key and redraw only keys with changed state
+ * \param[in]       h: Layout widget handle
+ * \param[in]       kbtn: New pressed key or `NULL`
+ */
+static void
+key_set_pressed(gui_handle_p h, const key_btn_t* kbtn) {
+    if (keyboard.key_pressed != kbtn) {
+        key_invalidate(h, keyboard.key_pressed);
+        key_invalidate(h, kbtn);
+        keyboard.key_pressed = kbtn;
+    }
+}
+
+#endif /* GUI_CFG_USE_TOUCH */
+
+/**
+ * \brief           Callback for keyboard layout drawn as single widget
+ *
+ *                  Keys are drawn from constant keymap table, only keys in clipping region are drawn
+ */
+static uint8_t
+keyboard_layout_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result) {
+    switch (evt) {
+        case GUI_EVT_DRAW: {
+            gui_display_t* disp = GUI_EVT_PARAMTYPE_DISP(param);
+            const key_layout_t* layout = gui_widget_getuserdata(h);
+            const gui_font_t* font = keyboard.font != NULL ? keyboard.font : keyboard.default_font;
+            gui_dim_t x, y, kx, ky, kw, kh;
+            gui_color_t c1, c2;
+            gui_char str[10];
+            size_t k, z;
+            
+            gui_widget_processdefaultcallback(h, evt, param, result);  /* Draw layout background */
+            
+            x = gui_widget_getabsolutex(h);
+            y = gui_widget_getabsolutey(h);
+            for (k = 0; k < layout->rows_count; k++) {
+                for (z = 0; z < layout->rows[k].btns_count; z++) {
+                    const key_btn_t* kbtn = &layout->rows[k].btns[z];
+                    key_get_rect(h, kbtn, &kx, &ky, &kw, &kh);
+                    kx += x;
+                    ky += y;
+                    if (kx > disp->x2 || (kx + kw) < disp->x1 || ky > disp->y2 || (ky + kh) < disp->y1) {
+                        continue;                   /* Skip keys outside clipping region */
+                    }
+                    
+                    /* Use the same colors as non-3D button widget */
+                    if (keyboard.key_pressed == kbtn) {
+                        c1 = GUI_COLOR_BLACK;
+                        c2 = GUI_COLOR_GRAY;
+                    } else {
+                        c1 = GUI_COLOR_GRAY;
+                        c2 = GUI_COLOR_BLACK;
+                    }
+                    gui_draw_filledrectangle(disp, kx, ky, kw, kh, c1);
+                    gui_draw_rectangle(disp, kx, ky, kw, kh, c2);
+                    
+                    if (font != NULL) {
+                        gui_draw_text_t f;
+                        
+                        str[0] = 0;
+                        key_get_text(kbtn, str);
+                        gui_draw_text_init(&f);
+                        f.x = kx + 1;
+                        f.y = ky + 1;
+                        f.width = kw - 2;
+                        f.height = kh - 2;
+                        f.align = GUI_HALIGN_CENTER | GUI_VALIGN_CENTER;
+                        f.color1width = f.width;
+                        f.color1 = c2;
+                        gui_draw_writetext(disp, font, str, &f);
+                    }
+                }
+            }
+            return 1;
+        }
+#if GUI_CFG_USE_TOUCH
+        case GUI_EVT_TOUCHSTART:
+        case GUI_EVT_TOUCHMOVE: {
+            guii_touch_data_t* ts = GUI_EVT_PARAMTYPE_TOUCH(param);
+            key_set_pressed(h, key_get_bypos(h, ts->x_rel[0], ts->y_rel[0]));
+            GUI_EVT_RESULTTYPE_TOUCH(result) = touchHANDLED;
+            return 1;
+        }
+        case GUI_EVT_TOUCHEND: {
+            key_set_pressed(h, NULL);
+            return 1;
+        }
+        case GUI_EVT_CLICK: {
+            guii_touch_data_t* ts = GUI_EVT_PARAMTYPE_TOUCH(param);
+            const key_btn_t* kbtn = key_get_bypos(h, ts->x_rel[0], ts->y_rel[0]);
+            
+            if (kbtn != NULL) {
+                key_process_click(kbtn);
+            }
+            return 1;
+        }
+        case GUI_EVT_DBLCLICK: {
+            guii_touch_data_t* ts = GUI_EVT_PARAMTYPE_TOUCH(param);
+            const key_btn_t* kbtn = key_get_bypos(h, ts->x_rel[0], ts->y_rel[0]);
+            
+            return kbtn != NULL && key_process_dblclick(kbtn);
+        }
+#endif /* GUI_CFG_USE_TOUCH */
+        default:                                    /* Handle default option */
+            GUI_UNUSED3(h, param, result);          /* Unused elements to prevent compiler warnings */
+            return gui_widget_processdefaultcallback(h, evt, param, result);/* Process default callback */
+    }
+}
+
+#else /* GUI_CFG_KEYBOARD_SINGLE_WIDGET */
+
 /**
  * \brief           Keyboard button callback function
  */
@@ -313,40 +650,8 @@ keyboard_btn_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
     switch (evt) {
         case GUI_EVT_DRAW: {                        /* Draw button */
             gui_char str[10] = {0};
-            const key_btn_t* kbtn;
-            
-            kbtn = (const key_btn_t *)gui_widget_getuserdata(h);/* Get user data */
             
-            switch (kbtn->s) {                      /* Check if there is specal key */
-                case SPECIAL_123: 
-                    strcpy((char *)str, (const char *)_GT("123"));
-                    break;
-                case SPECIAL_ABC: 
-                    strcpy((char *)str, (const char *)_GT("abc"));
-                    break;
-                case SPECIAL_CALC:
-                    strcpy((char *)str, (const char *)_GT("#+="));
-                    break;
-                case SPECIAL_BACKSPACE: 
-                    strcpy((char *)str, (const char *)_GT("Back"));
-                    break;
-                case SPECIAL_ENTER: 
-                    strcpy((char *)str, (const char *)_GT("Ent"));
-                    break;
-                case SPECIAL_SHIFT: 
-                    strcpy((char *)str, (const char *)_GT("Shift"));
-                    break;
-                case SPECIAL_HIDE: 
-                    strcpy((char *)str, (const char *)_GT("Hide"));
-                    break;
-                default:
-                    if (keyboard.is_shift && kbtn->cs) {    /* Character when shift is ON */
-                        gui_string_unicode_encode(kbtn->cs, str);   /* Encode character to unicode */
-                    } else {                        /* Character when shift is OFF */
-                        gui_string_unicode_encode(kbtn->c, str);    /* Encode character to unicode */
-                    }
-                    break;
-            }
+            key_get_text((const key_btn_t *)gui_widget_getuserdata(h), str);
                                                 
             if (keyboard.font != NULL) {            /* Check if widget font is set */
                 gui_widget_setfont(h, keyboard.font);   /* Set drawing font */
@@ -359,101 +664,11 @@ keyboard_btn_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
             return 1;
         }
         case GUI_EVT_CLICK: {                        /* Handle pressed button */
-            gui_handle_p tmp1, tmp2, tmp3;
-            const key_btn_t* kbtn;
-            uint32_t ch = 0;
-            /* gui_keyboard_data_t kbd = {0}; */
-            
-            kbtn = gui_widget_getuserdata(h);       /* Get data from widget */
-            if (kbtn->s) {                          /* Has button special function? */
-                switch (kbtn->s) {                  /* Check special function */
-                    case SPECIAL_123:
-                    case SPECIAL_ABC: 
-                    case SPECIAL_CALC: {            /* Special functions 123 or ABC */
-                        tmp1 = gui_widget_getbyid(GUI_ID_KEYBOARD_LAYOUT_123);
-                        tmp2 = gui_widget_getbyid(GUI_ID_KEYBOARD_LAYOUT_ABC);
-                        tmp3 = gui_widget_getbyid(GUI_ID_KEYBOARD_LAYOUT_CALC);
-                        
-                        if (kbtn->s == SPECIAL_ABC) {
-                            gui_widget_hide(tmp1);
-                            gui_widget_show(tmp2);
-                            gui_widget_hide(tmp3);
-                        } else if (kbtn->s == SPECIAL_123) {
-                            gui_widget_show(tmp1);
-                            gui_widget_hide(tmp2);
-                            gui_widget_hide(tmp3);
-                        } else if (kbtn->s == SPECIAL_CALC) {
-                            gui_widget_hide(tmp1);
-                            gui_widget_hide(tmp2);
-                            gui_widget_show(tmp3);
-                        }
-                        SHIFT_DISABLE();
-                        break;
-                    }
-                    case SPECIAL_SHIFT: {
-                        SHIFT_TOGGLE();
-                        break;
-                    }
-                    case SPECIAL_BACKSPACE: {
-                        ch = GUI_KEY_BACKSPACE;
-                        break;
-                    }
-                    case SPECIAL_HIDE: {
-                        gui_keyboard_hide();
-                        break;
-                    }
-                }
-            }
-                                                    
-            /* Check if we have to add key to input buffer */
-            if (ch || !kbtn->s) {                   /* If character from special is set or normal key pressed */
-                if (!ch) {                          /* Only if char not yet set */
-                    if (keyboard.is_shift && kbtn->cs) {/* If shift mode enabled and character has shift mode character */
-                        ch = kbtn->cs;              /* Use shift mode character */
-                    } else {
-                        ch = kbtn->c;               /* Use normal character */
-                    }
-                }
-                
-                /* Clear shift mode if necessary */
-                if (keyboard.is_shift != SHIFT_UPPERCASE) {   /* When not in uppercase shift mode */
-                    SHIFT_DISABLE();                /* Clear shift mode */
-                }
-                
-                /************************************/
-                /* Send character to focused widget */
-                /************************************/
-                if (keyboard.target != NULL) {
-                    gui_evt_param_t param;
-                    gui_evt_result_t result;
-                    guii_keyboard_data_t key;
-
-                    gui_string_unicode_encode(ch, key.kb.keys);/* Decode key */
-                    GUI_EVT_PARAMTYPE_KEYBOARD(&param) = &key;
-                    GUI_EVT_RESULTTYPE_KEYBOARD(&result) = keyCONTINUE;
-                    guii_widget_callback(keyboard.target, GUI_EVT_KEYPRESS, &param, &result);
-
-                    key.kb.keys[0] = 0;             /* Set key to 0 */
-                    GUI_EVT_PARAMTYPE_KEYBOARD(&param) = &key;
-                    GUI_EVT_RESULTTYPE_KEYBOARD(&result) = keyCONTINUE;
-                    guii_widget_callback(keyboard.target, GUI_EVT_KEYPRESS, &param, &result);
-                }
-                //kbd.keys[0] = 0;                    /* Set key to 0 */
-                //gui_input_keyadd(&kbd);             /* Add end key */
-            }
+            key_process_click(gui_widget_getuserdata(h));
             return 1;
         }
         case GUI_EVT_DBLCLICK: {
-            const key_btn_t* kbtn;
-            
-            kbtn = gui_widget_getuserdata(h);
-            switch (kbtn->s) {
-                case SPECIAL_SHIFT: {
-                    SHIFT_ENABLE(SHIFT_UPPERCASE);  /* Enable shift upper case mode */
-                    return 1;
-                }
-            }
-            return 0;
+            return key_process_dblclick(gui_widget_getuserdata(h));
         }
         default:
             GUI_UNUSED3(h, param, result);          /* Unused elements to prevent compiler warnings */
@@ -474,6 +689,8 @@ keyboard_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const p
     }
 }
 
+#endif /* !GUI_CFG_KEYBOARD_SINGLE_WIDGET */
+
 /* Callback function for base element of keyboard */
 static uint8_t
 keyboard_base_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result) {
@@ -482,11 +699,15 @@ keyboard_base_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* co
             return 1;
         }
         case GUI_EVT_INIT: {                         /* When base element is initialized */
-            gui_handle_p handle, handleLayout;
-            size_t i, k, z;
+            gui_handle_p handleLayout;
+            size_t i;
             const key_layout_t* layout;
+#if !GUI_CFG_KEYBOARD_SINGLE_WIDGET
+            gui_handle_p handle;
+            size_t k, z;
             const key_row_t* row;
             const key_btn_t* btn;
+#endif /* !GUI_CFG_KEYBOARD_SINGLE_WIDGET */
             
             /***************************/
             /*   Configure keyboard    */
@@ -509,7 +730,11 @@ keyboard_base_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* co
                 /***************************/
                 /* Create keyboard layout  */
                 /***************************/
+#if GUI_CFG_KEYBOARD_SINGLE_WIDGET
+                handleLayout = gui_container_create(layout->id, 0, 0, 100, 100, h, keyboard_layout_callback, GUI_FLAG_WIDGET_CREATE_IGNORE_INVALIDATE);
+#else /* GUI_CFG_KEYBOARD_SINGLE_WIDGET */
                 handleLayout = gui_container_create(layout->id, 0, 0, 100, 100, h, keyboard_callback, GUI_FLAG_WIDGET_CREATE_IGNORE_INVALIDATE);
+#endif /* !GUI_CFG_KEYBOARD_SINGLE_WIDGET */
                 gui_widget_setsizepercent(handleLayout, 100, 50);
                 gui_widget_setpositionpercent(handleLayout, 0, 50);
                 gui_widget_setuserdata(handleLayout, (void *)layout);
@@ -520,6 +745,7 @@ keyboard_base_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* co
                 }
                 gui_widget_setignoreinvalidate(handleLayout, 0, 1);
                 
+#if !GUI_CFG_KEYBOARD_SINGLE_WIDGET
                 /***************************/
                 /* Draw buttons on layout  */
                 /***************************/
@@ -537,6 +763,7 @@ keyboard_base_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* co
                         gui_widget_setignoreinvalidate(handle, 0, 1);
                     }
                 }
+#endif /* !GUI_CFG_KEYBOARD_SINGLE_WIDGET */
             }
             return 1;
         }
@@ -599,3 +826,5 @@ gui_keyboard_show(gui_handle_p h) {
 
     return ret;
 }
+
+#endif /* (GUI_CFG_WIDGET_BUTTON && GUI_CFG_WIDGET_CONTAINER) || __DOXYGEN__ */
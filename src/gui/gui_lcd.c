@@ -34,6 +34,7 @@
 #define GUI_INTERNAL
 #include "gui/gui_private.h"
 #include "gui/gui_lcd.h"
+#include "system/gui_sys.h"
 
 /**
  * \brief           Get LCD width in units of pixels
@@ -61,9 +62,1291 @@ void
 gui_lcd_confirmactivelayer(uint8_t layer_num) {
     if ((GUI.lcd.flags & GUI_FLAG_LCD_WAIT_LAYER_CONFIRM)) {/* If we have anything pending */
         GUI.lcd.layers[layer_num].pending = 0;
+#if GUI_CFG_USE_TRIPLE_BUFFERING
+        {
+            size_t i;
+            uint8_t pending = 0;
+
+            /* Layers requested before confirmed one will not be shown anymore */
+            for (i = 0; i < GUI.lcd.layer_count; i++) {
+                if (GUI.lcd.layers[i].pending) {
+                    if (GUI.lcd.layers[i].frame < GUI.lcd.layers[layer_num].frame) {
+                        GUI.lcd.layers[i].pending = 0;
+                    } else {
+                        pending = 1;
+                    }
+                }
+            }
+            GUI.lcd.display_layer = &GUI.lcd.layers[layer_num];
+            if (!pending) {
+                GUI.lcd.flags &= ~GUI_FLAG_LCD_WAIT_LAYER_CONFIRM;  /* Clear flag when nothing waits for display */
+            }
+        }
+#else /* GUI_CFG_USE_TRIPLE_BUFFERING */
         GUI.lcd.flags &= ~GUI_FLAG_LCD_WAIT_LAYER_CONFIRM;  /* Clear flag */
+#endif /* !GUI_CFG_USE_TRIPLE_BUFFERING */
+        GUI_TRACE(GUI_TRACE_EVT_LAYER_CONFIRM, layer_num);
+#if GUI_CFG_USE_LATENCY
+        if (GUI.latency.state == GUI_LATENCY_CONFIRM) {
+            GUI.latency.confirmed = gui_sys_now();
+            GUI.latency.state = GUI_LATENCY_CONFIRMED;  /* Sample is saved by GUI thread */
+        }
+#endif /* GUI_CFG_USE_LATENCY */
+#if GUI_CFG_FRAME_RATE
+        GUI.frame_time = gui_sys_now();             /* Next frame is paced from this confirmation */
+#endif /* GUI_CFG_FRAME_RATE */
 #if GUI_CFG_OS
-        gui_sys_mbox_putnow(&GUI.OS.mbox, 0x00);
+        guii_wakeup(GUI_SYS_WAKEUP_LAYER);
 #endif /* GUI_CFG_OS */
     }
 }
+
+/**
+ * \brief           Wait for low-level layer to finish all pending drawing operations
+ *
+ *                  Low-level drivers may queue drawing operations and execute them asynchronously.
+ *                  Function must be called before memory used as source or destination
+ *                  of queued operation is accessed by CPU or released.
+ */
+void
+gui_lcd_fence(void) {
+    if (GUI_LL_ISSET(IsReady)) {
+#if GUI_CFG_USE_LL_STATS
+        uint32_t start = GUI_CFG_PROFILER_CYCLES();
+        while (!GUI_LL(IsReady)(&GUI.lcd));         /* Wait till ready */
+        GUI.stats.wait_cycles += GUI_CFG_PROFILER_CYCLES() - start;
+#else /* GUI_CFG_USE_LL_STATS */
+        while (!GUI_LL(IsReady)(&GUI.lcd));         /* Wait till ready */
+#endif /* !GUI_CFG_USE_LL_STATS */
+    }
+}
+
+#if GUI_CFG_USE_LL_DIRECT_ACCESS || __DOXYGEN__
+
+/**
+ * \brief           Get direct CPU access to layer memory
+ *
+ *                  Access is queried with \ref GUI_LL_Command_GetLayerAccess and cached for last layer.
+ *
+ * \param[in]       layer: Layer to access
+ * \param[in]       sync: Set to `1` to wait for pending hardware operations when access requires fence,
+ *                      `0` to use low-level functions instead
+ * \return          Layer access or `NULL` when layer must be drawn with low-level functions
+ */
+const gui_layer_access_t *
+guii_lcd_getaccess(const gui_layer_t* layer, uint8_t sync) {
+    gui_layer_access_t* acc = &GUI.access;
+    
+    if (layer != GUI.access_layer || layer->start_address != GUI.access_address || layer->width != GUI.access_width) {
+        uint8_t display = layer >= GUI.lcd.layers && layer < &GUI.lcd.layers[GUI.lcd.layer_count];
+        
+        acc->base = (uint8_t *)layer->start_address;
+        acc->format = layer->pixel_format;
+        acc->stride = (size_t)layer->width * (acc->format == GUI_PIXEL_FORMAT_RGB565 ? 2 : 4);
+        acc->fence = GUI_LL_ISSET(IsReady);
+        if (!GUI_LL_CONTROL(GUI_LL_Command_GetLayerAccess, (void *)layer, acc) && display) {
+            acc->base = NULL;                       /* Display memory may be owned by display controller */
+        }
+#if GUI_CFG_USE_LCD_ROTATION
+        if (display && GUI.lcd.orientation != GUI_LCD_ORIENTATION_0) {
+            acc->base = NULL;                       /* Rows of logical layer are not rows in memory */
+        }
+#endif /* GUI_CFG_USE_LCD_ROTATION */
+        if (acc->format != GUI_PIXEL_FORMAT_ARGB8888 && acc->format != GUI_PIXEL_FORMAT_RGB565) {
+            acc->base = NULL;
+        }
+        GUI.access_layer = layer;
+        GUI.access_address = layer->start_address;
+        GUI.access_width = layer->width;
+    }
+    if (acc->base == NULL || (acc->fence && !sync)) {
+        return NULL;
+    }
+    if (acc->fence) {
+        gui_lcd_fence();                            /* Queued operations may still draw to memory */
+    }
+    return acc;
+}
+
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS || __DOXYGEN__ */
+
+#if GUI_CFG_USE_LAYER_COMPRESSION || __DOXYGEN__
+
+/**
+ * \brief           Tile size of compressed layer
+ */
+#define TILE_SIZE                   ((gui_dim_t)GUI_CFG_LAYER_COMPRESSION_TILE_SIZE)
+
+/**
+ * \brief           Get number of tiles to cover length
+ */
+#define TILE_COUNT(len)             (((size_t)(len) + (size_t)TILE_SIZE - 1) / (size_t)TILE_SIZE)
+
+/**
+ * \brief           Map of solid tiles of retained layer, placed after layer pixels
+ */
+typedef struct gui_layer_tiles {
+    size_t cols;                                    /*!< Number of tiles in each row */
+    size_t rows;                                    /*!< Number of tile rows */
+    uint8_t valid;                                  /*!< Set to `1` when map matches layer content and has solid tiles */
+    gui_color_t* color;                             /*!< Color of each tile, valid for solid tiles only */
+    uint8_t* solid;                                 /*!< Set to `1` for each tile with single color */
+} gui_layer_tiles_t;
+
+/**
+ * \brief           Get number of bytes needed after pixels of retained layer for its tile map
+ * \param[in]       width: Layer width
+ * \param[in]       height: Layer height
+ * \return          Number of bytes including alignment of pixels
+ */
+size_t
+guii_lcd_tiles_size(gui_dim_t width, gui_dim_t height) {
+    size_t pixels = (size_t)width * (size_t)height * (size_t)GUI.lcd.pixel_size;
+    size_t count = TILE_COUNT(width) * TILE_COUNT(height);
+    
+    return GUI_MEM_ALIGN(pixels) - pixels + GUI_MEM_ALIGN(sizeof(gui_layer_tiles_t)) + count * (sizeof(gui_color_t) + 1);
+}
+
+/**
+ * \brief           Set up tile map of retained layer after its pixels
+ * \note            Memory must be allocated with \ref guii_lcd_tiles_size bytes after pixels
+ * \param[in]       layer: Layer with `width`, `height` and `start_address` set
+ */
+void
+guii_lcd_tiles_init(gui_layer_t* layer) {
+    gui_layer_tiles_t* t;
+    size_t pixels = (size_t)layer->width * (size_t)layer->height * (size_t)GUI.lcd.pixel_size;
+    
+    t = (gui_layer_tiles_t *)((uint8_t *)layer->start_address + GUI_MEM_ALIGN(pixels));
+    t->cols = TILE_COUNT(layer->width);
+    t->rows = TILE_COUNT(layer->height);
+    t->valid = 0;
+    t->color = (gui_color_t *)((uint8_t *)t + GUI_MEM_ALIGN(sizeof(*t)));
+    t->solid = (uint8_t *)&t->color[t->cols * t->rows];
+    layer->tiles = t;
+}
+
+/**
+ * \brief           Check if tile of layer has single color
+ * \param[in]       layer: Layer to check
+ * \param[in]       x: Tile X position relative to layer
+ * \param[in]       y: Tile Y position relative to layer
+ * \param[in]       w: Tile width
+ * \param[in]       h: Tile height
+ * \param[out]      color: Color of tile in `ARGB8888` format
+ * \return          `1` if all pixels have the same value, `0` otherwise
+ */
+static uint8_t
+tile_issolid(const gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t w, gui_dim_t h, gui_color_t* color) {
+    gui_dim_t i, j;
+    
+    if (layer->pixel_format == GUI_PIXEL_FORMAT_RGB565) {
+        const uint16_t* p = (const uint16_t *)layer->start_address + (size_t)y * layer->width + x;
+        uint16_t c = *p;
+        
+        for (j = 0; j < h; j++, p += layer->width) {
+            for (i = 0; i < w; i++) {
+                if (p[i] != c) {
+                    return 0;
+                }
+            }
+        }
+        *color = GUI_COLOR_FROM_RGB565(c);
+    } else {
+        const uint32_t* p = (const uint32_t *)layer->start_address + (size_t)y * layer->width + x;
+        uint32_t c = *p;
+        
+        for (j = 0; j < h; j++, p += layer->width) {
+            for (i = 0; i < w; i++) {
+                if (p[i] != c) {
+                    return 0;
+                }
+            }
+        }
+        *color = c;
+    }
+    return 1;
+}
+
+/**
+ * \brief           Build tile map of retained layer after it was rendered
+ *
+ *                  Layer is read once, later copies fill solid tiles without reading layer memory
+ *
+ * \param[in]       layer: Rendered layer
+ */
+void
+guii_lcd_tiles_update(gui_layer_t* layer) {
+    gui_layer_tiles_t* t = layer->tiles;
+    size_t tx, ty, idx, solid = 0;
+    gui_dim_t x, y;
+    
+    if (t == NULL) {
+        return;
+    }
+    gui_lcd_fence();                                /* Rendering may still be in progress */
+    for (ty = 0, idx = 0; ty < t->rows; ty++) {
+        y = (gui_dim_t)ty * TILE_SIZE;
+        for (tx = 0; tx < t->cols; tx++, idx++) {
+            x = (gui_dim_t)tx * TILE_SIZE;
+            t->solid[idx] = tile_issolid(layer, x, y, GUI_MIN(TILE_SIZE, layer->width - x), GUI_MIN(TILE_SIZE, layer->height - y), &t->color[idx]);
+            solid += t->solid[idx];
+        }
+    }
+    t->valid = solid > 0;                           /* Without solid tiles layer is copied at once */
+}
+
+#endif /* GUI_CFG_USE_LAYER_COMPRESSION || __DOXYGEN__ */
+
+/**
+ * \brief           Copy area of retained layer to drawing layer
+ *
+ *                  With \ref GUI_CFG_USE_LAYER_COMPRESSION, solid tiles of layer are filled with their color
+ *                  and remaining tiles are copied, runs of neighbouring tiles in row are merged
+ *
+ * \param[in]       drawing: Layer to copy to
+ * \param[in]       layer: Retained layer with pixels at its `x_pos` and `y_pos` screen position
+ * \param[in]       x1: Left absolute position of area
+ * \param[in]       y1: Top absolute position of area
+ * \param[in]       x2: Right absolute position of area, not included
+ * \param[in]       y2: Bottom absolute position of area, not included
+ */
+void
+guii_lcd_copylayer(gui_layer_t* drawing, const gui_layer_t* layer, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2) {
+    size_t ps = (size_t)GUI.lcd.pixel_size;
+#if GUI_CFG_USE_LAYER_COMPRESSION
+    const gui_layer_tiles_t* t = layer->tiles;
+#endif /* GUI_CFG_USE_LAYER_COMPRESSION */
+    
+    if (x2 <= x1 || y2 <= y1) {
+        return;
+    }
+#if GUI_CFG_USE_LAYER_COMPRESSION
+    if (t != NULL && t->valid) {
+        size_t tx, ty, idx;
+        gui_dim_t x, y, ye, xe;
+        uint8_t solid;
+        gui_color_t color;
+        
+        for (y = y1; y < y2; y = ye) {
+            ty = (size_t)((y - layer->y_pos) / TILE_SIZE);
+            ye = GUI_MIN(y2, layer->y_pos + (gui_dim_t)(ty + 1) * TILE_SIZE);
+            for (x = x1; x < x2; x = xe) {
+                tx = (size_t)((x - layer->x_pos) / TILE_SIZE);
+                idx = ty * t->cols + tx;
+                solid = t->solid[idx];
+                color = t->color[idx];
+                
+                /* Merge following tiles of the same kind */
+                do {
+                    tx++;
+                    idx++;
+                    xe = GUI_MIN(x2, layer->x_pos + (gui_dim_t)tx * TILE_SIZE);
+                } while (xe < x2 && t->solid[idx] == solid && (!solid || t->color[idx] == color));
+                
+                if (solid) {
+                    GUI_LL(Fill)(&GUI.lcd, drawing,
+                        (void *)((uint8_t *)drawing->start_address + ps * ((size_t)(y - drawing->y_pos) * drawing->width + (x - drawing->x_pos))),
+                        xe - x, ye - y, drawing->width - (xe - x), color);
+                } else {
+                    GUI_LL(Copy)(&GUI.lcd, drawing,
+                        (void *)((uint8_t *)drawing->start_address + ps * ((size_t)(y - drawing->y_pos) * drawing->width + (x - drawing->x_pos))),
+                        (const void *)((const uint8_t *)layer->start_address + ps * ((size_t)(y - layer->y_pos) * layer->width + (x - layer->x_pos))),
+                        xe - x, ye - y, drawing->width - (xe - x), layer->width - (xe - x));
+                }
+            }
+        }
+        return;
+    }
+#endif /* GUI_CFG_USE_LAYER_COMPRESSION */
+    GUI_LL(Copy)(&GUI.lcd, drawing,
+        (void *)((uint8_t *)drawing->start_address + ps * ((size_t)(y1 - drawing->y_pos) * drawing->width + (x1 - drawing->x_pos))),
+        (const void *)((const uint8_t *)layer->start_address + ps * ((size_t)(y1 - layer->y_pos) * layer->width + (x1 - layer->x_pos))),
+        x2 - x1,                                    /* Area width */
+        y2 - y1,                                    /* Area height */
+        drawing->width - (x2 - x1),                 /* Offline destination */
+        layer->width - (x2 - x1)                    /* Offline source */
+    );
+}
+
+#if GUI_CFG_USE_LL_STATS || __DOXYGEN__
+
+#define STATS_ADD(field, cnt)       do { GUI.stats.calls++; GUI.stats.field += (uint32_t)(cnt); } while (0)
+
+static void
+stats_setpixel(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_color_t color) {
+    STATS_ADD(pixels_filled, 1);
+    GUI.ll_drv.SetPixel(lcd, layer, x, y, color);
+}
+
+static void
+stats_fill(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLine, gui_color_t color) {
+    STATS_ADD(pixels_filled, xSize * ySize);
+    GUI.ll_drv.Fill(lcd, layer, dst, xSize, ySize, offLine, color);
+}
+
+static void
+stats_copy(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    STATS_ADD(pixels_copied, xSize * ySize);
+    GUI.ll_drv.Copy(lcd, layer, dst, src, xSize, ySize, offLineDst, offLineSrc);
+}
+
+static void
+stats_copyblend(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, uint8_t param1, uint8_t param2, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    STATS_ADD(pixels_blended, xSize * ySize);
+    GUI.ll_drv.CopyBlend(lcd, layer, dst, src, param1, param2, xSize, ySize, offLineDst, offLineSrc);
+}
+
+static void
+stats_drawhline(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    STATS_ADD(pixels_filled, length);
+    GUI.ll_drv.DrawHLine(lcd, layer, x, y, length, color);
+}
+
+static void
+stats_drawvline(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    STATS_ADD(pixels_filled, length);
+    GUI.ll_drv.DrawVLine(lcd, layer, x, y, length, color);
+}
+
+static void
+stats_fillrect(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color) {
+    STATS_ADD(pixels_filled, width * height);
+    GUI.ll_drv.FillRect(lcd, layer, x, y, width, height, color);
+}
+
+static void
+stats_drawimage16(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    STATS_ADD(pixels_copied, xSize * ySize);
+    GUI.ll_drv.DrawImage16(lcd, layer, img, dst, src, xSize, ySize, offLineDst, offLineSrc);
+}
+
+static void
+stats_drawimage24(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    STATS_ADD(pixels_copied, xSize * ySize);
+    GUI.ll_drv.DrawImage24(lcd, layer, img, dst, src, xSize, ySize, offLineDst, offLineSrc);
+}
+
+static void
+stats_drawimage32(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    STATS_ADD(pixels_blended, xSize * ySize);
+    GUI.ll_drv.DrawImage32(lcd, layer, img, dst, src, xSize, ySize, offLineDst, offLineSrc);
+}
+
+static uint8_t
+stats_drawimagel(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    if (!GUI.ll_drv.DrawImageL(lcd, layer, img, dst, src, xSize, ySize, offLineDst, offLineSrc)) {
+        return 0;                                   /* Counted by software expansion */
+    }
+    STATS_ADD(pixels_copied, xSize * ySize);
+    return 1;
+}
+
+static void
+stats_copychar(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc, gui_color_t color) {
+    STATS_ADD(pixels_blended, xSize * ySize);
+    GUI.ll_drv.CopyChar(lcd, layer, dst, src, xSize, ySize, offLineDst, offLineSrc, color);
+}
+
+static void
+stats_fillspans(gui_lcd_t* lcd, gui_layer_t* layer, const gui_span_t* spans, size_t count, gui_color_t color) {
+    size_t i;
+    
+    GUI.stats.calls++;
+    for (i = 0; i < count; i++) {
+        GUI.stats.pixels_filled += (uint32_t)spans[i].length;
+    }
+    GUI.ll_drv.FillSpans(lcd, layer, spans, count, color);
+}
+
+#if GUI_CFG_USE_LL_GPU
+
+/* Count pixels of shape bounding box inside clipping region as filled */
+static void
+stats_gpu(const gui_display_t* clip, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height) {
+    gui_dim_t w = GUI_MIN(x + width, clip->x2) - GUI_MAX(x, clip->x1);
+    gui_dim_t h = GUI_MIN(y + height, clip->y2) - GUI_MAX(y, clip->y1);
+    
+    GUI.stats.calls++;
+    if (w > 0 && h > 0) {
+        GUI.stats.pixels_filled += (uint32_t)w * (uint32_t)h;
+    }
+}
+
+static uint8_t
+stats_fillroundrect(gui_lcd_t* lcd, gui_layer_t* layer, const gui_display_t* clip, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t r, gui_color_t color) {
+    if (!GUI.ll_drv.FillRoundRect(lcd, layer, clip, x, y, width, height, r, color)) {
+        return 0;                                   /* Software drawing is counted by other wrappers */
+    }
+    stats_gpu(clip, x, y, width, height);
+    return 1;
+}
+
+static uint8_t
+stats_fillgradient(gui_lcd_t* lcd, gui_layer_t* layer, const gui_display_t* clip, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t r, const gui_gradient_t* grad) {
+    if (!GUI.ll_drv.FillGradient(lcd, layer, clip, x, y, width, height, r, grad)) {
+        return 0;
+    }
+    stats_gpu(clip, x, y, width, height);
+    return 1;
+}
+
+static uint8_t
+stats_fillpath(gui_lcd_t* lcd, gui_layer_t* layer, const gui_display_t* clip, const gui_icon_t* icon, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color) {
+    if (!GUI.ll_drv.FillPath(lcd, layer, clip, icon, x, y, width, height, color)) {
+        return 0;
+    }
+    stats_gpu(clip, x, y, width, height);
+    return 1;
+}
+
+static uint8_t
+stats_drawlineaa(gui_lcd_t* lcd, gui_layer_t* layer, const gui_display_t* clip, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_color_t color) {
+    if (!GUI.ll_drv.DrawLineAA(lcd, layer, clip, x1, y1, x2, y2, color)) {
+        return 0;
+    }
+    GUI.stats.calls++;
+    GUI.stats.pixels_blended += (uint32_t)(GUI_MAX(GUI_ABS(x2 - x1), GUI_ABS(y2 - y1)) + 1) * 2;
+    return 1;
+}
+
+static uint8_t
+stats_blittransform(gui_lcd_t* lcd, gui_layer_t* layer, const gui_display_t* clip, const gui_image_desc_t* img, gui_dim_t x, gui_dim_t y, const gui_image_transform_t* tr) {
+    if (!GUI.ll_drv.BlitTransform(lcd, layer, clip, img, x, y, tr)) {
+        return 0;
+    }
+    GUI.stats.calls++;
+    GUI.stats.pixels_blended += (uint32_t)(clip->x2 - clip->x1) * (uint32_t)(clip->y2 - clip->y1);
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_LL_GPU */
+
+/**
+ * \brief           Replace low-level drawing functions with counting wrappers
+ * \note            Functions not implemented by driver stay `NULL` so that software fallbacks are used
+ */
+void
+guii_lcd_stats_init(void) {
+    GUI.ll_drv = GUI.ll;                            /* Save driver functions */
+    if (GUI.ll.SetPixel != NULL)    { GUI.ll.SetPixel = stats_setpixel; }
+    if (GUI.ll.Fill != NULL)        { GUI.ll.Fill = stats_fill; }
+    if (GUI.ll.Copy != NULL)        { GUI.ll.Copy = stats_copy; }
+    if (GUI.ll.CopyBlend != NULL)   { GUI.ll.CopyBlend = stats_copyblend; }
+    if (GUI.ll.DrawHLine != NULL)   { GUI.ll.DrawHLine = stats_drawhline; }
+    if (GUI.ll.DrawVLine != NULL)   { GUI.ll.DrawVLine = stats_drawvline; }
+    if (GUI.ll.FillRect != NULL)    { GUI.ll.FillRect = stats_fillrect; }
+    if (GUI.ll.DrawImage16 != NULL) { GUI.ll.DrawImage16 = stats_drawimage16; }
+    if (GUI.ll.DrawImage24 != NULL) { GUI.ll.DrawImage24 = stats_drawimage24; }
+    if (GUI.ll.DrawImage32 != NULL) { GUI.ll.DrawImage32 = stats_drawimage32; }
+    if (GUI.ll.DrawImageL != NULL)  { GUI.ll.DrawImageL = stats_drawimagel; }
+    if (GUI.ll.CopyChar != NULL)    { GUI.ll.CopyChar = stats_copychar; }
+    if (GUI.ll.FillSpans != NULL)   { GUI.ll.FillSpans = stats_fillspans; }
+#if GUI_CFG_USE_LL_GPU
+    if (GUI.ll.FillRoundRect != NULL)   { GUI.ll.FillRoundRect = stats_fillroundrect; }
+    if (GUI.ll.FillGradient != NULL)    { GUI.ll.FillGradient = stats_fillgradient; }
+    if (GUI.ll.FillPath != NULL)        { GUI.ll.FillPath = stats_fillpath; }
+    if (GUI.ll.DrawLineAA != NULL)      { GUI.ll.DrawLineAA = stats_drawlineaa; }
+    if (GUI.ll.BlitTransform != NULL)   { GUI.ll.BlitTransform = stats_blittransform; }
+#endif /* GUI_CFG_USE_LL_GPU */
+}
+
+/**
+ * \brief           Save statistics of finished frame and start counting for next one
+ */
+void
+guii_lcd_stats_endframe(void) {
+    GUI.stats_frame = GUI.stats;
+    if (GUI.stats_frame.calls) {
+        GUI.stats_frame.pixels_per_call = (GUI.stats_frame.pixels_filled + GUI.stats_frame.pixels_copied + GUI.stats_frame.pixels_blended) / GUI.stats_frame.calls;
+    }
+    memset(&GUI.stats, 0x00, sizeof(GUI.stats));
+}
+
+#endif /* GUI_CFG_USE_LL_STATS || __DOXYGEN__ */
+
+#if GUI_CFG_USE_LCD_ROTATION || __DOXYGEN__
+
+/**
+ * \brief           Pre-rotated raw image in rotation cache, followed by pixels in physical orientation
+ */
+typedef struct {
+    gui_linkedlist_t list;                          /*!< Linked list entry, must be first on the list */
+    const gui_image_desc_t* img;                    /*!< Source image descriptor */
+    const uint8_t* image;                           /*!< Source pixels address at time of rotation */
+    gui_dim_t width;                                /*!< Rotated image width, distance between rows in units of pixels */
+    gui_dim_t height;                               /*!< Rotated image height */
+    size_t memsize;                                 /*!< Number of bytes allocated for entry */
+} rot_image_t;
+
+/**
+ * \brief           Low-level function called with rotated source pixels
+ */
+typedef enum {
+    ROT_FN_COPY = 0x00,                             /*!< `Copy` function */
+    ROT_FN_COPYBLEND,                               /*!< `CopyBlend` function */
+    ROT_FN_IMAGE16,                                 /*!< `DrawImage16` function */
+    ROT_FN_IMAGE24,                                 /*!< `DrawImage24` function */
+    ROT_FN_IMAGE32,                                 /*!< `DrawImage32` function */
+    ROT_FN_CHAR                                     /*!< `CopyChar` function */
+} rot_fn_type_t;
+
+/**
+ * \brief           Low-level function and its parameters which do not depend on rectangle
+ */
+typedef struct {
+    rot_fn_type_t type;                             /*!< Function to call */
+    const gui_image_desc_t* img;                    /*!< Image descriptor for image functions */
+    uint8_t param1;                                 /*!< First alpha parameter of `CopyBlend` */
+    uint8_t param2;                                 /*!< Second alpha parameter of `CopyBlend` */
+    gui_color_t color;                              /*!< Color of `CopyChar` */
+} rot_fn_t;
+
+/**
+ * \brief           Map rectangle to rotated area
+ * \param[in]       o: Orientation, member of \ref gui_lcd_orientation_t
+ * \param[in,out]   x: Rectangle X position
+ * \param[in,out]   y: Rectangle Y position
+ * \param[in,out]   w: Rectangle width
+ * \param[in,out]   h: Rectangle height
+ * \param[in]       width: Width of rotated area
+ * \param[in]       height: Height of rotated area
+ */
+static void
+rot_rect(uint8_t o, gui_dim_t* x, gui_dim_t* y, gui_dim_t* w, gui_dim_t* h, gui_dim_t width, gui_dim_t height) {
+    gui_dim_t t;
+    
+    switch (o) {
+        case GUI_LCD_ORIENTATION_90:
+            t = *x;
+            *x = width - *y - *h;
+            *y = t;
+            break;
+        case GUI_LCD_ORIENTATION_180:
+            *x = width - *x - *w;
+            *y = height - *y - *h;
+            return;
+        case GUI_LCD_ORIENTATION_270:
+            t = *y;
+            *y = height - *x - *w;
+            *x = t;
+            break;
+        default:
+            return;
+    }
+    t = *w;                                         /* Swap size for quarter turns */
+    *w = *h;
+    *h = t;
+}
+
+/**
+ * \brief           Copy block of pixels and rotate it
+ *
+ *                  Destination is written row by row, source is read with constant step along each row
+ *
+ * \param[in]       o: Orientation, member of \ref gui_lcd_orientation_t
+ * \param[out]      dst: Destination of top-left rotated pixel
+ * \param[in]       dst_stride: Distance between destination rows in units of pixels
+ * \param[in]       src: Source of top-left pixel
+ * \param[in]       src_stride: Distance between source rows in units of pixels
+ * \param[in]       w: Source block width
+ * \param[in]       h: Source block height
+ * \param[in]       ps: Number of bytes per pixel
+ */
+static void
+rot_block(uint8_t o, uint8_t* dst, size_t dst_stride, const uint8_t* src, size_t src_stride, gui_dim_t w, gui_dim_t h, size_t ps) {
+    const uint8_t* s;
+    uint8_t* d;
+    ptrdiff_t step;
+    gui_dim_t r, c, pw, ph;
+    
+    src_stride *= ps;
+    dst_stride *= ps;
+    pw = (o & 0x01) ? h : w;
+    ph = (o & 0x01) ? w : h;
+    switch (o) {
+        case GUI_LCD_ORIENTATION_90:  step = -(ptrdiff_t)src_stride; break;
+        case GUI_LCD_ORIENTATION_180: step = -(ptrdiff_t)ps; break;
+        case GUI_LCD_ORIENTATION_270: step = (ptrdiff_t)src_stride; break;
+        default:                      step = (ptrdiff_t)ps; break;
+    }
+    
+#define ROT_ROW(n)      for (c = 0, d = dst; c < pw; c++, d += (n), s += step) { memcpy(d, s, (n)); }
+    for (r = 0; r < ph; r++, dst += dst_stride) {
+        switch (o) {                                /* Source of first pixel in destination row */
+            case GUI_LCD_ORIENTATION_90:  s = src + (size_t)(h - 1) * src_stride + (size_t)r * ps; break;
+            case GUI_LCD_ORIENTATION_180: s = src + (size_t)(h - 1 - r) * src_stride + (size_t)(w - 1) * ps; break;
+            case GUI_LCD_ORIENTATION_270: s = src + (size_t)(w - 1 - r) * ps; break;
+            default:                      s = src + (size_t)r * src_stride; break;
+        }
+        switch (ps) {                               /* Constant size lets compiler use single load and store */
+            case 1:  ROT_ROW(1); break;
+            case 2:  ROT_ROW(2); break;
+            case 3:  ROT_ROW(3); break;
+            default: ROT_ROW(4); break;
+        }
+    }
+#undef ROT_ROW
+}
+
+/**
+ * \brief           Check if layer is display layer with rotated memory
+ * \param[in]       layer: Layer to check
+ * \return          `1` if layer is display layer, `0` otherwise
+ */
+static uint8_t
+rot_isdisplay(const gui_layer_t* layer) {
+    return layer >= GUI.lcd.layers && layer < &GUI.lcd.layers[GUI.lcd.layer_count];
+}
+
+/**
+ * \brief           Find display layer with address in its memory
+ * \param[in]       ptr: Address of pixel
+ * \param[out]      x: Logical X position of pixel
+ * \param[out]      y: Logical Y position of pixel
+ * \return          Display layer on success, `NULL` when address is not in display memory
+ */
+static gui_layer_t *
+rot_find(const void* ptr, gui_dim_t* x, gui_dim_t* y) {
+    const uint8_t* start;
+    size_t i, off;
+    
+    for (i = 0; i < GUI.lcd.layer_count; i++) {
+        gui_layer_t* layer = &GUI.lcd.layers[i];
+        
+        start = layer->start_address;
+        if (start == NULL || (const uint8_t *)ptr < start) {
+            continue;
+        }
+        off = (size_t)((const uint8_t *)ptr - start) / GUI.lcd.pixel_size;
+        if (off < (size_t)layer->width * (size_t)layer->height) {
+            *x = (gui_dim_t)(off % (size_t)layer->width);
+            *y = (gui_dim_t)(off / (size_t)layer->width);
+            return layer;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Get physical layer passed to driver for display layer
+ * \param[in]       layer: Logical display layer
+ * \return          Physical layer with the same memory
+ */
+static gui_layer_t *
+rot_phys(const gui_layer_t* layer) {
+    gui_layer_t* p = &GUI.rot_layers[layer - GUI.lcd.layers];
+    
+    p->num = layer->num;
+    p->start_address = layer->start_address;
+    p->pixel_format = layer->pixel_format;
+    return p;
+}
+
+/**
+ * \brief           Get address of pixel in physical layer
+ * \param[in]       p: Physical layer
+ * \param[in]       x: Physical X position
+ * \param[in]       y: Physical Y position
+ * \return          Pixel address
+ */
+static uint8_t *
+rot_addr(const gui_layer_t* p, gui_dim_t x, gui_dim_t y) {
+    return (uint8_t *)p->start_address + GUI.lcd.pixel_size * ((size_t)y * p->width + x);
+}
+
+/**
+ * \brief           Wait for driver to finish reading scratch buffer
+ */
+static void
+rot_waitbuff(void) {
+    if (GUI.rot_pending) {
+        gui_lcd_fence();
+        GUI.rot_pending = 0;
+    }
+}
+
+/**
+ * \brief           Fill rectangle of display layer
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Logical display layer
+ * \param[in]       x: Logical X position
+ * \param[in]       y: Logical Y position
+ * \param[in]       w: Rectangle width
+ * \param[in]       h: Rectangle height
+ * \param[in]       color: Fill color
+ */
+static void
+rot_fill(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t w, gui_dim_t h, gui_color_t color) {
+    gui_layer_t* p = rot_phys(layer);
+    gui_dim_t i, j;
+    
+    rot_rect(GUI.lcd.orientation, &x, &y, &w, &h, GUI.rot_width, GUI.rot_height);
+    if (GUI.ll_rot.FillRect != NULL) {
+        GUI.ll_rot.FillRect(lcd, p, x, y, w, h, color);
+    } else if (GUI.ll_rot.Fill != NULL) {
+        GUI.ll_rot.Fill(lcd, p, rot_addr(p, x, y), w, h, p->width - w, color);
+    } else {
+        for (j = 0; j < h; j++) {
+            for (i = 0; i < w; i++) {
+                GUI.ll_rot.SetPixel(lcd, p, x + i, y + j, color);
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Call driver function with physical rectangle
+ * \param[in]       lcd: LCD handle
+ * \param[in]       p: Physical layer
+ * \param[in]       fn: Function to call
+ * \param[in]       dst: Physical destination address
+ * \param[in]       src: Source address, pixels in physical orientation
+ * \param[in]       w: Physical rectangle width
+ * \param[in]       h: Physical rectangle height
+ * \param[in]       offline_src: Number of pixels between end of one and start of next row in source
+ */
+static void
+rot_call(gui_lcd_t* lcd, gui_layer_t* p, const rot_fn_t* fn, void* dst, const void* src, gui_dim_t w, gui_dim_t h, gui_dim_t offline_src) {
+    gui_dim_t offline_dst = p->width - w;
+    
+    switch (fn->type) {
+        case ROT_FN_COPY:
+            GUI.ll_rot.Copy(lcd, p, dst, src, w, h, offline_dst, offline_src);
+            break;
+        case ROT_FN_COPYBLEND:
+            GUI.ll_rot.CopyBlend(lcd, p, dst, src, fn->param1, fn->param2, w, h, offline_dst, offline_src);
+            break;
+        case ROT_FN_IMAGE16:
+            GUI.ll_rot.DrawImage16(lcd, p, fn->img, dst, src, w, h, offline_dst, offline_src);
+            break;
+        case ROT_FN_IMAGE24:
+            GUI.ll_rot.DrawImage24(lcd, p, fn->img, dst, src, w, h, offline_dst, offline_src);
+            break;
+        case ROT_FN_IMAGE32:
+            GUI.ll_rot.DrawImage32(lcd, p, fn->img, dst, src, w, h, offline_dst, offline_src);
+            break;
+        case ROT_FN_CHAR:
+            GUI.ll_rot.CopyChar(lcd, p, dst, src, w, h, offline_dst, offline_src, fn->color);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * \brief           Draw source pixels to display layer
+ *
+ *                  Source is split to blocks of \ref GUI_CFG_LCD_ROTATION_BUFFER_SIZE bytes,
+ *                  each block is rotated to scratch buffer and drawn with single driver call
+ *
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Logical display layer
+ * \param[in]       fn: Function to call
+ * \param[in]       x: Logical X position of destination
+ * \param[in]       y: Logical Y position of destination
+ * \param[in]       src: Source of top-left pixel
+ * \param[in]       ps: Number of bytes per source pixel
+ * \param[in]       stride: Distance between source rows in units of pixels
+ * \param[in]       w: Rectangle width
+ * \param[in]       h: Rectangle height
+ */
+static void
+rot_blit(gui_lcd_t* lcd, gui_layer_t* layer, const rot_fn_t* fn, gui_dim_t x, gui_dim_t y,
+            const uint8_t* src, size_t ps, gui_dim_t stride, gui_dim_t w, gui_dim_t h) {
+    gui_layer_t* p = rot_phys(layer);
+    uint8_t o = GUI.lcd.orientation;
+    size_t max = GUI_CFG_LCD_ROTATION_BUFFER_SIZE / ps;
+    gui_dim_t i, j, bw, bh, cw, ch, px, py, pw, ph;
+    
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+    
+    /* Physical rows of block must fit to buffer, they are source columns on quarter turns */
+    if (o & 0x01) {
+        ch = (gui_dim_t)GUI_MIN((size_t)h, max);
+        cw = (gui_dim_t)GUI_MIN((size_t)w, max / ch);
+    } else {
+        cw = (gui_dim_t)GUI_MIN((size_t)w, max);
+        ch = (gui_dim_t)GUI_MIN((size_t)h, max / cw);
+    }
+    for (j = 0; j < h; j += ch) {
+        bh = GUI_MIN(ch, h - j);
+        for (i = 0; i < w; i += cw) {
+            bw = GUI_MIN(cw, w - i);
+            rot_waitbuff();                         /* Buffer may be read by previous block */
+            rot_block(o, GUI.rot_buff, (o & 0x01) ? bh : bw, src + ((size_t)j * stride + i) * ps, stride, bw, bh, ps);
+            px = x + i;
+            py = y + j;
+            pw = bw;
+            ph = bh;
+            rot_rect(o, &px, &py, &pw, &ph, GUI.rot_width, GUI.rot_height);
+            rot_call(lcd, p, fn, rot_addr(p, px, py), GUI.rot_buff, pw, ph, 0);
+            GUI.rot_pending = 1;
+        }
+    }
+}
+
+/**
+ * \brief           Remove least recently used pre-rotated image
+ * \return          `1` if image was removed, `0` if cache is empty
+ */
+static uint8_t
+rot_image_removelru(void) {
+    rot_image_t* entry;
+    
+    entry = (rot_image_t *)gui_linkedlist_getnext_gen(&GUI.root_rot_images, NULL);
+    if (entry != NULL) {
+        gui_linkedlist_remove_gen(&GUI.root_rot_images, (gui_linkedlist_t *)entry);
+        GUI.rot_cache_size -= entry->memsize;
+        gui_lcd_fence();                            /* Pixels may still be used by queued low-level operation */
+        GUI_MEMFREE(entry);
+        return 1;
+    }
+    return 0;
+}
+
+#if GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__
+
+/**
+ * \brief           Remove least recently used pre-rotated image when heap allocation failed
+ * \note            This function is private and may be called only when GUI is protected
+ * \return          `1` if image was removed, `0` if only most recently used image is left, it may be in use
+ */
+uint8_t
+guii_lcd_rotation_cachereclaim(void) {
+    if (GUI.root_rot_images.first == GUI.root_rot_images.last) {
+        return 0;
+    }
+    return rot_image_removelru();
+}
+
+#endif /* GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__ */
+
+/**
+ * \brief           Get pre-rotated copy of raw image, image is rotated on first use
+ * \param[in]       img: Image descriptor passed to low-level function
+ * \param[in]       src: Source address passed to low-level function
+ * \param[in]       ps: Number of bytes per pixel
+ * \param[out]      sx: X position of source address in image
+ * \param[out]      sy: Y position of source address in image
+ * \return          Pre-rotated image or `NULL` when image cannot be kept in cache
+ */
+static rot_image_t *
+rot_image_get(const gui_image_desc_t* img, const uint8_t* src, size_t ps, gui_dim_t* sx, gui_dim_t* sy) {
+    rot_image_t* entry;
+    size_t off, hdr = GUI_MEM_ALIGN(sizeof(*entry)), size;
+    gui_dim_t stride;
+    
+    if (img == NULL || img->image == NULL || img->read != NULL || img->compression != GUI_IMAGE_COMPRESSION_NONE
+        || (img->flags & GUI_FLAG_IMAGE_VOLATILE) || (size_t)(img->bpp >> 3) != ps || src < img->image) {
+        return NULL;                                /* Decoded or internal buffers are not memory mapped image */
+    }
+    stride = img->stride ? img->stride : img->x_size;
+    off = (size_t)(src - img->image);
+    if (off % ps || (off /= ps) >= (size_t)stride * img->y_size || (gui_dim_t)(off % stride) >= img->x_size) {
+        return NULL;
+    }
+    *sx = (gui_dim_t)(off % stride);
+    *sy = (gui_dim_t)(off / stride);
+    
+    for (entry = (rot_image_t *)gui_linkedlist_getnext_gen(&GUI.root_rot_images, NULL); entry != NULL;
+        entry = (rot_image_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)entry)) {
+        if (entry->img == img && entry->image == img->image) {
+            if (GUI.root_rot_images.last != (gui_linkedlist_t *)entry) {
+                gui_linkedlist_remove_gen(&GUI.root_rot_images, (gui_linkedlist_t *)entry);
+                gui_linkedlist_add_gen(&GUI.root_rot_images, (gui_linkedlist_t *)entry);
+            }
+            GUI_CACHE_HIT(GUI_CACHE_ROTATION);
+            return entry;
+        }
+    }
+    GUI_CACHE_MISS(GUI_CACHE_ROTATION);
+    
+    size = (size_t)img->x_size * (size_t)img->y_size * ps;
+    if (hdr + size > GUI_CFG_LCD_ROTATION_CACHE_SIZE) {
+        return NULL;
+    }
+    while ((GUI.rot_cache_size + hdr + size) > GUI_CACHE_BUDGET(GUI_CACHE_ROTATION, GUI_CFG_LCD_ROTATION_CACHE_SIZE) && rot_image_removelru()) {}
+    while ((entry = GUI_MEMALLOC_CLASS(hdr + size, GUI_MEM_CLASS_PIXEL)) == NULL && rot_image_removelru()) {}
+    if (entry == NULL) {
+        return NULL;
+    }
+    entry->img = img;
+    entry->image = img->image;
+    entry->width = (GUI.lcd.orientation & 0x01) ? img->y_size : img->x_size;
+    entry->height = (GUI.lcd.orientation & 0x01) ? img->x_size : img->y_size;
+    entry->memsize = hdr + size;
+    rot_block(GUI.lcd.orientation, ((uint8_t *)entry) + hdr, (size_t)entry->width, img->image, (size_t)stride, img->x_size, img->y_size, ps);
+    gui_linkedlist_add_gen(&GUI.root_rot_images, (gui_linkedlist_t *)entry);   /* Add entry as most recently used */
+    GUI.rot_cache_size += entry->memsize;
+    return entry;
+}
+
+/**
+ * \brief           Draw image to display layer
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Logical display layer
+ * \param[in]       fn: Image function to call
+ * \param[in]       x: Logical X position of destination
+ * \param[in]       y: Logical Y position of destination
+ * \param[in]       src: Source of top-left pixel
+ * \param[in]       ps: Number of bytes per source pixel
+ * \param[in]       w: Rectangle width
+ * \param[in]       h: Rectangle height
+ * \param[in]       offline_src: Number of pixels between end of one and start of next row in source
+ */
+static void
+rot_image(gui_lcd_t* lcd, gui_layer_t* layer, const rot_fn_t* fn, gui_dim_t x, gui_dim_t y,
+            const void* src, size_t ps, gui_dim_t w, gui_dim_t h, gui_dim_t offline_src) {
+    rot_image_t* entry;
+    gui_dim_t sx, sy, sw = w, sh = h;
+    
+    if (w > 0 && h > 0 && (entry = rot_image_get(fn->img, src, ps, &sx, &sy)) != NULL) {
+        gui_layer_t* p = rot_phys(layer);
+        
+        rot_rect(GUI.lcd.orientation, &sx, &sy, &sw, &sh, entry->width, entry->height);
+        rot_rect(GUI.lcd.orientation, &x, &y, &w, &h, GUI.rot_width, GUI.rot_height);
+        rot_call(lcd, p, fn, rot_addr(p, x, y),
+            ((const uint8_t *)entry) + GUI_MEM_ALIGN(sizeof(*entry)) + ((size_t)sy * entry->width + sx) * ps,
+            w, h, entry->width - w);
+        return;
+    }
+    rot_blit(lcd, layer, fn, x, y, src, ps, w + offline_src, w, h);
+}
+
+static void
+rot_setpixel(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_color_t color) {
+    gui_dim_t w = 1, h = 1;
+    
+    if (rot_isdisplay(layer)) {
+        rot_rect(GUI.lcd.orientation, &x, &y, &w, &h, GUI.rot_width, GUI.rot_height);
+        layer = rot_phys(layer);
+    }
+    GUI.ll_rot.SetPixel(lcd, layer, x, y, color);
+}
+
+static gui_color_t
+rot_getpixel(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y) {
+    gui_dim_t w = 1, h = 1;
+    
+    if (rot_isdisplay(layer)) {
+        rot_rect(GUI.lcd.orientation, &x, &y, &w, &h, GUI.rot_width, GUI.rot_height);
+        layer = rot_phys(layer);
+    }
+    return GUI.ll_rot.GetPixel(lcd, layer, x, y);
+}
+
+static void
+rot_fillll(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLine, gui_color_t color) {
+    gui_layer_t* d;
+    gui_dim_t x, y;
+    
+    if (xSize > 0 && (d = rot_find(dst, &x, &y)) != NULL) {
+        rot_fill(lcd, d, x, y, xSize, ySize, color);
+        return;
+    }
+    GUI.ll_rot.Fill(lcd, layer, dst, xSize, ySize, offLine, color);
+}
+
+static void
+rot_copy(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    gui_layer_t *d, *s;
+    gui_dim_t dx, dy, sx, sy, w = xSize, h = ySize;
+    rot_fn_t fn;
+    
+    if (xSize <= 0 || ySize <= 0) {
+        return;
+    }
+    d = rot_find(dst, &dx, &dy);
+    s = rot_find(src, &sx, &sy);
+    if (d != NULL && s != NULL) {                   /* Rectangle between display layers, both are rotated the same way */
+        rot_rect(GUI.lcd.orientation, &dx, &dy, &w, &h, GUI.rot_width, GUI.rot_height);
+        rot_rect(GUI.lcd.orientation, &sx, &sy, &xSize, &ySize, GUI.rot_width, GUI.rot_height);
+        GUI.ll_rot.Copy(lcd, rot_phys(d), rot_addr(rot_phys(d), dx, dy), rot_addr(rot_phys(s), sx, sy),
+            w, h, GUI.rot_width - w, GUI.rot_width - w);
+    } else if (d != NULL) {
+        memset(&fn, 0x00, sizeof(fn));
+        fn.type = ROT_FN_COPY;
+        rot_blit(lcd, d, &fn, dx, dy, src, GUI.lcd.pixel_size, xSize + offLineSrc, xSize, ySize);
+    } else if (s != NULL) {                         /* Read display to memory buffer, rotate back with processor */
+        rot_rect(GUI.lcd.orientation, &sx, &sy, &w, &h, GUI.rot_width, GUI.rot_height);
+        gui_lcd_fence();                            /* Display may still be drawn by hardware */
+        rot_block((4 - GUI.lcd.orientation) & 0x03, dst, (size_t)(xSize + offLineDst), rot_addr(rot_phys(s), sx, sy),
+            (size_t)GUI.rot_width, w, h, GUI.lcd.pixel_size);
+    } else {
+        GUI.ll_rot.Copy(lcd, layer, dst, src, xSize, ySize, offLineDst, offLineSrc);
+    }
+}
+
+static void
+rot_copyblend(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, uint8_t param1, uint8_t param2, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    gui_layer_t* d;
+    gui_dim_t x, y, i, j;
+    rot_fn_t fn;
+    
+    d = rot_find(dst, &x, &y);
+    if (GUI.ll_rot.CopyBlend != NULL) {
+        if (d == NULL) {
+            GUI.ll_rot.CopyBlend(lcd, layer, dst, src, param1, param2, xSize, ySize, offLineDst, offLineSrc);
+        } else {
+            memset(&fn, 0x00, sizeof(fn));
+            fn.type = ROT_FN_COPYBLEND;
+            fn.param1 = param1;
+            fn.param2 = param2;
+            rot_blit(lcd, d, &fn, x, y, src, GUI.lcd.pixel_size, xSize + offLineSrc, xSize, ySize);
+        }
+    } else {                                        /* Driver without blending, display memory must not be written directly */
+        const uint8_t* s = src;
+        uint8_t* m = dst;
+        gui_color_t c;
+        
+        GUI_UNUSED(param2);
+        gui_lcd_fence();
+        for (j = 0; j < ySize; j++, s += (size_t)offLineSrc * GUI.lcd.pixel_size, m += (size_t)offLineDst * GUI.lcd.pixel_size) {
+            for (i = 0; i < xSize; i++, s += GUI.lcd.pixel_size, m += GUI.lcd.pixel_size) {
+                c = GUI.lcd.pixel_size == 2 ? GUI_COLOR_FROM_RGB565(*(const uint16_t *)s) : *(const uint32_t *)s;
+                if (d != NULL) {
+                    rot_setpixel(lcd, d, x + i, y + j, 0xFF000000UL | guii_blend_color(c, rot_getpixel(lcd, d, x + i, y + j), param1));
+                } else if (GUI.lcd.pixel_size == 2) {
+                    *(uint16_t *)m = GUI_COLOR_TO_RGB565(guii_blend_color(c, GUI_COLOR_FROM_RGB565(*(uint16_t *)m), param1));
+                } else {
+                    *(uint32_t *)m = 0xFF000000UL | guii_blend_color(c, *(uint32_t *)m, param1);
+                }
+            }
+        }
+    }
+}
+
+static void
+rot_drawhline(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    if (rot_isdisplay(layer)) {
+        rot_fill(lcd, layer, x, y, length, 1, color);
+        return;
+    }
+    GUI.ll_rot.DrawHLine(lcd, layer, x, y, length, color);
+}
+
+static void
+rot_drawvline(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    if (rot_isdisplay(layer)) {
+        rot_fill(lcd, layer, x, y, 1, length, color);
+        return;
+    }
+    GUI.ll_rot.DrawVLine(lcd, layer, x, y, length, color);
+}
+
+static void
+rot_fillrect(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color) {
+    if (rot_isdisplay(layer)) {
+        rot_fill(lcd, layer, x, y, width, height, color);
+        return;
+    }
+    GUI.ll_rot.FillRect(lcd, layer, x, y, width, height, color);
+}
+
+static void
+rot_drawimage16(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    gui_layer_t* d;
+    gui_dim_t x, y;
+    rot_fn_t fn;
+    
+    if ((d = rot_find(dst, &x, &y)) != NULL) {
+        memset(&fn, 0x00, sizeof(fn));
+        fn.type = ROT_FN_IMAGE16;
+        fn.img = img;
+        rot_image(lcd, d, &fn, x, y, src, 2, xSize, ySize, offLineSrc);
+        return;
+    }
+    GUI.ll_rot.DrawImage16(lcd, layer, img, dst, src, xSize, ySize, offLineDst, offLineSrc);
+}
+
+static void
+rot_drawimage24(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    gui_layer_t* d;
+    gui_dim_t x, y;
+    rot_fn_t fn;
+    
+    if ((d = rot_find(dst, &x, &y)) != NULL) {
+        memset(&fn, 0x00, sizeof(fn));
+        fn.type = ROT_FN_IMAGE24;
+        fn.img = img;
+        rot_image(lcd, d, &fn, x, y, src, 3, xSize, ySize, offLineSrc);
+        return;
+    }
+    GUI.ll_rot.DrawImage24(lcd, layer, img, dst, src, xSize, ySize, offLineDst, offLineSrc);
+}
+
+static void
+rot_drawimage32(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    gui_layer_t* d;
+    gui_dim_t x, y;
+    rot_fn_t fn;
+    
+    if ((d = rot_find(dst, &x, &y)) != NULL) {
+        memset(&fn, 0x00, sizeof(fn));
+        fn.type = ROT_FN_IMAGE32;
+        fn.img = img;
+        rot_image(lcd, d, &fn, x, y, src, 4, xSize, ySize, offLineSrc);
+        return;
+    }
+    GUI.ll_rot.DrawImage32(lcd, layer, img, dst, src, xSize, ySize, offLineDst, offLineSrc);
+}
+
+static uint8_t
+rot_drawimagel(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    gui_dim_t x, y;
+    
+    if (rot_find(dst, &x, &y) != NULL) {
+        return 0;                                   /* Indices are expanded by software and drawn rotated */
+    }
+    return GUI.ll_rot.DrawImageL(lcd, layer, img, dst, src, xSize, ySize, offLineDst, offLineSrc);
+}
+
+static void
+rot_copychar(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc, gui_color_t color) {
+    gui_layer_t* d;
+    gui_dim_t x, y;
+    rot_fn_t fn;
+    
+    if ((d = rot_find(dst, &x, &y)) != NULL) {
+        memset(&fn, 0x00, sizeof(fn));
+        fn.type = ROT_FN_CHAR;
+        fn.color = color;
+        rot_blit(lcd, d, &fn, x, y, src, 1, xSize + offLineSrc, xSize, ySize);
+        return;
+    }
+    GUI.ll_rot.CopyChar(lcd, layer, dst, src, xSize, ySize, offLineDst, offLineSrc, color);
+}
+
+static void
+rot_fillspans(gui_lcd_t* lcd, gui_layer_t* layer, const gui_span_t* spans, size_t count, gui_color_t color) {
+    size_t i;
+    
+    if (rot_isdisplay(layer)) {
+        for (i = 0; i < count; i++) {
+            rot_fill(lcd, layer, spans[i].x, spans[i].y, spans[i].length, 1, color);
+        }
+        return;
+    }
+    GUI.ll_rot.FillSpans(lcd, layer, spans, count, color);
+}
+
+/**
+ * \brief           Set logical screen size and replace low-level drawing functions with rotating wrappers
+ *
+ *                  Display layers are passed to driver as layers of physical size,
+ *                  virtual layers and memory buffers are not rotated.
+ *
+ * \note            Functions not implemented by driver stay `NULL` so that software fallbacks are used,
+ *                  except `CopyBlend` which must not be emulated by writing to display memory directly
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+guii_lcd_rotation_init(void) {
+    size_t i;
+    
+    if (GUI.lcd.orientation == GUI_LCD_ORIENTATION_0) {
+        return 1;                                   /* Physical display is used as it is */
+    }
+    GUI.rot_width = GUI.lcd.width;
+    GUI.rot_height = GUI.lcd.height;
+    if (GUI.lcd.orientation & 0x01) {               /* Logical screen is transposed */
+        GUI.lcd.width = GUI.rot_height;
+        GUI.lcd.height = GUI.rot_width;
+    }
+    GUI.rot_layers = GUI_MEMALLOC(sizeof(*GUI.rot_layers) * GUI.lcd.layer_count);
+    GUI.rot_buff = GUI_MEMALLOC_CLASS(GUI_CFG_LCD_ROTATION_BUFFER_SIZE, GUI_MEM_CLASS_PIXEL);
+    if (GUI.rot_layers == NULL || GUI.rot_buff == NULL) {
+        GUI_MEMFREE(GUI.rot_layers);
+        GUI_MEMFREE(GUI.rot_buff);
+        return 0;
+    }
+    for (i = 0; i < GUI.lcd.layer_count; i++) {
+        GUI.rot_layers[i].width = GUI.rot_width;
+        GUI.rot_layers[i].height = GUI.rot_height;
+    }
+    
+    GUI.ll_rot = GUI.ll;                            /* Save driver functions */
+    GUI.ll.SetPixel = rot_setpixel;
+    if (GUI.ll.GetPixel != NULL)    { GUI.ll.GetPixel = rot_getpixel; }
+    if (GUI.ll.Fill != NULL)        { GUI.ll.Fill = rot_fillll; }
+    if (GUI.ll.Copy != NULL)        { GUI.ll.Copy = rot_copy; }
+    if (GUI.ll.GetPixel != NULL || GUI.ll.CopyBlend != NULL) { GUI.ll.CopyBlend = rot_copyblend; }
+    if (GUI.ll.DrawHLine != NULL)   { GUI.ll.DrawHLine = rot_drawhline; }
+    if (GUI.ll.DrawVLine != NULL)   { GUI.ll.DrawVLine = rot_drawvline; }
+    if (GUI.ll.FillRect != NULL)    { GUI.ll.FillRect = rot_fillrect; }
+    if (GUI.ll.DrawImage16 != NULL) { GUI.ll.DrawImage16 = rot_drawimage16; }
+    if (GUI.ll.DrawImage24 != NULL) { GUI.ll.DrawImage24 = rot_drawimage24; }
+    if (GUI.ll.DrawImage32 != NULL) { GUI.ll.DrawImage32 = rot_drawimage32; }
+    if (GUI.ll.DrawImageL != NULL)  { GUI.ll.DrawImageL = rot_drawimagel; }
+    if (GUI.ll.CopyChar != NULL)    { GUI.ll.CopyChar = rot_copychar; }
+    if (GUI.ll.FillSpans != NULL)   { GUI.ll.FillSpans = rot_fillspans; }
+#if GUI_CFG_USE_LL_GPU
+    /* Shapes are drawn by software to rotating wrappers */
+    GUI.ll.FillRoundRect = NULL;
+    GUI.ll.FillGradient = NULL;
+    GUI.ll.FillPath = NULL;
+    GUI.ll.DrawLineAA = NULL;
+    GUI.ll.BlitTransform = NULL;
+#endif /* GUI_CFG_USE_LL_GPU */
+    return 1;
+}
+
+/**
+ * \brief           Map touch position on physical display to logical screen
+ * \param[in,out]   x: X position
+ * \param[in,out]   y: Y position
+ */
+void
+guii_lcd_rotation_point(gui_dim_t* x, gui_dim_t* y) {
+    gui_dim_t w = 1, h = 1;
+    
+    rot_rect((4 - GUI.lcd.orientation) & 0x03, x, y, &w, &h, GUI.lcd.width, GUI.lcd.height);
+}
+
+/**
+ * \brief           Remove pre-rotated copies of image
+ * \param[in]       img: Source image descriptor, set to `NULL` to remove all images
+ * \return          `1` if at least one image was removed, `0` otherwise
+ */
+uint8_t
+guii_lcd_rotation_cacheremove(const gui_image_desc_t* img) {
+    rot_image_t* entry, *next;
+    uint8_t ret = 0;
+    
+    for (entry = (rot_image_t *)gui_linkedlist_getnext_gen(&GUI.root_rot_images, NULL); entry != NULL; entry = next) {
+        next = (rot_image_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)entry);
+        if (img == NULL || entry->img == img) {
+            gui_linkedlist_remove_gen(&GUI.root_rot_images, (gui_linkedlist_t *)entry);
+            GUI.rot_cache_size -= entry->memsize;
+            gui_lcd_fence();                        /* Pixels may still be used by queued low-level operation */
+            GUI_MEMFREE(entry);
+            ret = 1;
+        }
+    }
+    return ret;
+}
+
+#endif /* GUI_CFG_USE_LCD_ROTATION || __DOXYGEN__ */
+
+/**
+ * \brief           Get low-level drawing statistics of last drawn frame
+ * \note            Available only when \ref GUI_CFG_USE_LL_STATS is enabled
+ * \param[out]      stats: Pointer to output structure
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_stats_get(gui_stats_t* stats) {
+#if GUI_CFG_USE_LL_STATS
+    GUI_ASSERTPARAMS(stats != NULL);
+    GUI_CORE_PROTECT(1);
+    *stats = GUI.stats_frame;
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+#else /* GUI_CFG_USE_LL_STATS */
+    GUI_UNUSED(stats);
+    return 0;
+#endif /* !GUI_CFG_USE_LL_STATS */
+}
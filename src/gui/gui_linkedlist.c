@@ -89,6 +89,92 @@ gui_linkedlist_add_gen(gui_linkedlistroot_t* const root, gui_linkedlist_t* const
     root->last = element;                       /* Add new element as last */
 }
     
+/**
+ * \brief           Insert element to doubly linked list before another element
+ * \note            Element added to linkedlist must have \ref gui_linkedlist_t as top structure
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       root: Pointer to \ref gui_linkedlistroot_t structure as base element
+ * \param[in]       before: Element already on list to insert new element before. Set to `NULL` to add element to the end
+ * \param[in]       element: Pointer to \ref gui_linkedlist_t element to insert
+ * \sa              gui_linkedlist_add_gen
+ */
+void
+gui_linkedlist_insertbefore_gen(gui_linkedlistroot_t* const root, gui_linkedlist_t* const before, gui_linkedlist_t* const element) {
+    if (before == NULL) {
+        gui_linkedlist_add_gen(root, element);
+        return;
+    }
+    element->next = before;
+    element->prev = before->prev;
+    if (before->prev != NULL) {
+        ((gui_linkedlist_t *)before->prev)->next = element;
+    } else {
+        root->first = element;
+    }
+    before->prev = element;
+}
+
+/**
+ * \brief           Sort elements of doubly linked list
+ *
+ *                  Elements are relinked with stable merge sort, no memory is allocated
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       root: Pointer to \ref gui_linkedlistroot_t structure as base element
+ * \param[in]       cmp: Compare function, returns negative, zero or positive value
+ *                      when first element is before, equal to or after second element
+ * \param[in]       arg: Custom argument passed to compare function
+ */
+void
+gui_linkedlist_sort_gen(gui_linkedlistroot_t* const root, int (*cmp)(const void* e1, const void* e2, void* arg), void* arg) {
+    gui_linkedlist_t *list = root->first, *p, *q, *e, *tail = NULL;
+    size_t insize, nmerges, psize, qsize;
+    
+    if (list == NULL) {
+        return;
+    }
+    for (insize = 1;; insize <<= 1) {               /* Merge sorted runs of doubled size in each pass */
+        p = list;
+        list = NULL;
+        tail = NULL;
+        nmerges = 0;
+        while (p != NULL) {
+            nmerges++;
+            q = p;
+            for (psize = 0; psize < insize && q != NULL; psize++) {
+                q = q->next;
+            }
+            qsize = insize;
+            while (psize > 0 || (qsize > 0 && q != NULL)) {
+                if (psize > 0 && (qsize == 0 || q == NULL || cmp(p, q, arg) <= 0)) {
+                    e = p;                          /* Take from first run on equal elements to keep order */
+                    p = p->next;
+                    psize--;
+                } else {
+                    e = q;
+                    q = q->next;
+                    qsize--;
+                }
+                if (tail != NULL) {
+                    tail->next = e;
+                } else {
+                    list = e;
+                }
+                e->prev = tail;
+                tail = e;
+            }
+            p = q;
+        }
+        tail->next = NULL;
+        if (nmerges <= 1) {
+            break;
+        }
+    }
+    root->first = list;
+    root->last = tail;
+}
+
 /**
  * \brief           Remove element from doubly linked list
  * \note            This function is private and may be called only when OS protection is active
@@ -455,13 +541,15 @@ gui_linkedlist_multi_find_remove(gui_linkedlistroot_t* const root, void* const e
  */
 void
 gui_linkedlist_widgetadd(gui_handle_p parent, gui_handle_p h) {    
+#if GUI_CFG_USE_WIDGET_ORDER
+    GUI.order_valid = 0;                        /* Draw order must be rebuilt */
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
     if (parent != NULL) {
         gui_linkedlist_add_gen(&parent->root_list, GUI_VP(h));
     } else {
         gui_linkedlist_add_gen(&GUI.root, GUI_VP(h));
     }
-    gui_linkedlist_widgetmovetotop(h);              /* Reset by moving to top */
-    gui_linkedlist_widgetmovetobottom(h);           /* Reset by moving to bottom with reorder */
+    gui_linkedlist_widgetmovetobottom(h);           /* Put after all widgets with the same or lower order */
 }
 
 /**
@@ -472,6 +560,9 @@ gui_linkedlist_widgetadd(gui_handle_p parent, gui_handle_p h) {
  */
 void
 gui_linkedlist_widgetremove(gui_handle_p h) {    
+#if GUI_CFG_USE_WIDGET_ORDER
+    GUI.order_valid = 0;                        /* Draw order must be rebuilt */
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
     if (guii_widget_hasparent(h)) {
         gui_linkedlist_remove_gen(&(guii_widget_getparent(h)->root_list), GUI_VP(h));
     } else {
@@ -488,6 +579,9 @@ gui_linkedlist_widgetremove(gui_handle_p h) {
  */
 uint8_t
 gui_linkedlist_widgetmoveup(gui_handle_p h) {
+#if GUI_CFG_USE_WIDGET_ORDER
+    GUI.order_valid = 0;                        /* Draw order must be rebuilt */
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
     if (guii_widget_hasparent(h)) {
         return gui_linkedlist_moveup_gen(&(guii_widget_getparent(h)->root_list), GUI_VP(h));
     }
@@ -503,6 +597,9 @@ gui_linkedlist_widgetmoveup(gui_handle_p h) {
  */
 uint8_t
 gui_linkedlist_widgetmovedown(gui_handle_p h) {
+#if GUI_CFG_USE_WIDGET_ORDER
+    GUI.order_valid = 0;                        /* Draw order must be rebuilt */
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
     if (guii_widget_hasparent(h)) {
         return gui_linkedlist_movedown_gen(&(guii_widget_getparent(h)->root_list), GUI_VP(h));
     }
@@ -579,106 +676,132 @@ gui_linkedlist_widgetgetprev(gui_handle_p parent, gui_handle_p h) {
  * 1. Normal widgets, with automatic or fixed z-index
  * 2. Widgets with children support
  * 3. Widgets as dialog base elements
+ *
+ * List is always kept sorted by this order and z-index inside first 2 groups,
+ * therefore target position of moved widget can be found by scanning
+ * only from the end of list it is moved to and widget is moved with single unlink and insert
  */
 
+/**
+ * \brief           Get linked list root of widget
+ * \param[in]       h: Widget handle
+ * \return          Pointer to linked list root where widget is placed
+ */
+static gui_linkedlistroot_t *
+widget_root(gui_handle_p h) {
+    if (guii_widget_hasparent(h)) {
+        return &(guii_widget_getparent(h)->root_list);
+    }
+    return &GUI.root;
+}
+
+/**
+ * \brief           Compare widgets by linked list order
+ * \param[in]       a: First widget handle
+ * \param[in]       b: Second widget handle
+ * \return          Negative value when `a` goes before `b`, positive when after, `0` when order is the same
+ */
+static int32_t
+widget_order_cmp(gui_handle_p a, gui_handle_p b) {
+    int32_t ga, gb;
+    
+    ga = guii_widget_isdialogbase(a) ? 2 : (guii_widget_allowchildren(a) ? 1 : 0);
+    gb = guii_widget_isdialogbase(b) ? 2 : (guii_widget_allowchildren(b) ? 1 : 0);
+    if (ga != gb) {
+        return ga - gb;
+    }
+    if (ga == 2) {                                  /* Z-index does not apply to dialog base elements */
+        return 0;
+    }
+    return a->zindex < b->zindex ? -1 : (a->zindex > b->zindex ? 1 : 0);
+}
+
+/**
+ * \brief           Move widget to new position in list of parent widget
+ * \param[in]       root: Linked list root of widget
+ * \param[in]       h: Widget handle to move
+ * \param[in]       prev: Widget to put `h` after or `NULL` to put it as first element
+ * \return          `1` if position changed, `0` otherwise
+ */
+static uint8_t
+widget_splice(gui_linkedlistroot_t* const root, gui_handle_p h, gui_handle_p prev) {
+    gui_linkedlist_t* el = GUI_VP(h);
+    gui_linkedlist_t* p = GUI_VP(prev);
+    
+    if (el->prev == p) {                            /* Already at required position */
+        return 0;
+    }
+#if GUI_CFG_USE_WIDGET_ORDER
+    GUI.order_valid = 0;                        /* Draw order must be rebuilt */
+#endif /* GUI_CFG_USE_WIDGET_ORDER */
+    gui_linkedlist_remove_gen(root, el);
+    el->prev = p;
+    el->next = p != NULL ? p->next : root->first;
+    if (el->next != NULL) {
+        ((gui_linkedlist_t *)el->next)->prev = el;
+    } else {
+        root->last = el;
+    }
+    if (p != NULL) {
+        p->next = el;
+    } else {
+        root->first = el;
+    }
+    return 1;
+}
+
 /**
  * \brief           Move widget to bottom in linked list of parent widget
+ * \note            Widget is put after all widgets with the same or lower order
  * \note            This function is private and may be called only when OS protection is active
  * \param[in]       h: Widget to move to bottom
- * \return          Number of moves on linked list, `0` if move not available
+ * \return          `1` if widget position changed, `0` if move not available
  * \sa              gui_linkedlist_widgetmovetotop
  */
 uint8_t
 gui_linkedlist_widgetmovetobottom(gui_handle_p h) {
-    uint32_t cnt = 0;
+    gui_linkedlistroot_t* root;
+    gui_handle_p prev;
+    
     if (h->list.next == NULL) {
         return 0;
     }
-    while (h->list.next != NULL) {                  /* While device has next element */
-        if (guii_widget_isdialogbase(h)) {          /* Widget is dialog base element */
-            if (!gui_linkedlist_widgetmovedown(h)) {/* Move down */
-                break;
-            }
-            cnt++;
-        } else if (guii_widget_allowchildren(h)) { /* Widget supports children widgets, go to the end of the list if necessary */
-            if (!guii_widget_isdialogbase(h->list.next)) { /* Go down till dialog base is reached */
-                if (h->zindex >= __GH(h->list.next)->zindex) {  /* Check if z-index allows move */
-                    if (!gui_linkedlist_widgetmovedown(h)) {/* Move down */
-                        break;
-                    }
-                    cnt++;
-                } else {
-                    break;
-                }
-            } else {
-                break;
-            }
-        } else {                                    /* Our widget does not allow sub widgets */
-            if (!guii_widget_allowchildren(h->list.next)) {  /* Allow moving down only if next widget does not allow sub widgets */
-                if (h->zindex >= __GH(h->list.next)->zindex) {  /* Check if z-index allows move */
-                    if (!gui_linkedlist_widgetmovedown(h)) {/* Move down */
-                        break;
-                    }
-                    cnt++;
-                } else {
-                    break;
-                }
-            } else {
-                break;
-            }
-        }
+    root = widget_root(h);
+    
+    /* Scan from the end for last widget which goes before or together with current */
+    for (prev = root->last; prev != NULL && prev != h && widget_order_cmp(prev, h) > 0;
+        prev = prev->list.prev) {}
+    if (prev == h) {                                /* Nothing with lower order after widget */
+        return 0;
     }
-    return cnt;
+    return widget_splice(root, h, prev);
 }
 
 /**
  * \brief           Move widget to top in linked list of parent widget
+ * \note            Widget is put before all widgets with the same or higher order
  * \note            This function is private and may be called only when OS protection is active
  * \param[in]       h: Widget to move to top
- * \return          Number of moves on linked list, `0` if move not available
+ * \return          `1` if widget position changed, `0` if move not available
  * \sa              gui_linkedlist_widgetmovetobottom
  */
 uint8_t
 gui_linkedlist_widgetmovetotop(gui_handle_p h) {
-    uint32_t cnt = 0;
+    gui_linkedlistroot_t* root;
+    gui_handle_p next;
+    
     if (h->list.prev == NULL) {
         return 0;
     }
-    while (h->list.prev != NULL) {                  /* While device has previous element */
-        if (guii_widget_isdialogbase(h)) {          /* Widget is dialog base element */
-            if (guii_widget_isdialogbase(h->list.prev)) {   /* If previous widget is dialog base too */
-                if (!gui_linkedlist_widgetmoveup(h)) {  /* Move up widget */
-                    break;
-                }
-                cnt++;
-            } else {
-                break;                              /* Stop execution */
-            }
-        } else if (guii_widget_allowchildren(h)) {  /* If moving widget allows children elements */
-            if (guii_widget_allowchildren(h->list.prev)) {  /* If previous widget allows children too */
-                if (h->zindex <= __GH(h->list.prev)->zindex) {  /* Check if z-index allows move */
-                    if (!gui_linkedlist_widgetmoveup(h)) {  /* Move up */
-                        break;
-                    }
-                    cnt++;
-                } else {
-                    break;
-                }
-            } else {
-                break;                              /* Stop execution */
-            }
-        } else {                                    /* Normal widget */
-            if (h->zindex <= __GH(h->list.prev)->zindex) {  /* Check if z-index allows move */
-                if (!gui_linkedlist_widgetmoveup(h)) {  /* Move up */
-                    break;
-                }
-                cnt++;
-            } else {
-                break;
-            }
-        }
+    root = widget_root(h);
+    
+    /* Scan from the beginning for first widget which goes after or together with current */
+    for (next = root->first; next != NULL && next != h && widget_order_cmp(next, h) < 0;
+        next = next->list.next) {}
+    if (next == h || next == NULL) {                /* Nothing with higher order before widget */
+        return 0;
     }
-    return cnt;
+    return widget_splice(root, h, next->list.prev);
 }
 
 /**
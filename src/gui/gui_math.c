@@ -34,6 +34,37 @@
 #define GUI_INTERNAL
 #include "gui/gui_math.h"
 
+/**
+ * \brief           Sine of each degree from `0` to `90` degrees in units of `1/32768`
+ */
+static const uint16_t sin_table[91] = {
+        0,   572,  1144,  1715,  2286,  2856,  3425,  3993,  4560,  5126,
+     5690,  6252,  6813,  7371,  7927,  8481,  9032,  9580, 10126, 10668,
+    11207, 11743, 12275, 12803, 13328, 13848, 14365, 14876, 15384, 15886,
+    16384, 16877, 17364, 17847, 18324, 18795, 19261, 19720, 20174, 20622,
+    21063, 21498, 21926, 22348, 22763, 23170, 23571, 23965, 24351, 24730,
+    25102, 25466, 25822, 26170, 26510, 26842, 27166, 27482, 27789, 28088,
+    28378, 28660, 28932, 29197, 29452, 29698, 29935, 30163, 30382, 30592,
+    30792, 30983, 31164, 31336, 31499, 31651, 31795, 31928, 32052, 32166,
+    32270, 32365, 32449, 32524, 32588, 32643, 32688, 32723, 32748, 32763,
+    32768,
+};
+
+/**
+ * \brief           Get sine of angle inside first quadrant from table
+ * \param[in]       a: Angle between `0` and `900` in units of `0.1` degree
+ * \return          Sine in units of `1/32768`, between `0` and `32768`
+ */
+static int32_t
+sin_quadrant(int32_t a) {
+    int32_t i = a / 10, f = a % 10;
+    
+    if (f == 0) {
+        return sin_table[i];
+    }
+    return sin_table[i] + (((int32_t)sin_table[i + 1] - sin_table[i]) * f + 5) / 10;    /* Interpolate between degrees */
+}
+
 /**
  * \brief           Calculate square of input value
  *
@@ -119,3 +150,190 @@ gui_math_centerofxy(float x1, float y1, float x2, float y2, float* const resultx
     
     return 1;
 }
+
+/**
+ * \brief           Calculate integer square root of a number
+ *
+ *                  \f$\ y=\lfloor\sqrt{x}\rfloor\f$
+ *
+ * \param[in]       x: Number to calculate square root for
+ * \param[out]      result: Pointer to variable to store result to
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_math_isqrt(uint32_t x, uint32_t* const result) {
+    uint32_t res = 0, bit = (uint32_t)1 << 30;
+    
+    while (bit > x) {                               /* Find highest power of 4 not greater than number */
+        bit >>= 2;
+    }
+    while (bit) {                                   /* Calculate result bit by bit */
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    *result = res;
+    return 1;
+}
+
+/**
+ * \brief           Calculate angle of vector with integer math
+ *
+ *                  Arc tangent is approximated with \f$\ \frac{\pi}{4}r+0.273r(1-r)\f$ per octant,
+ *                  maximal error is below `0.3` degree
+ *
+ * \param[in]       y: Y component of vector
+ * \param[in]       x: X component of vector
+ * \param[out]      result: Pointer to variable to store angle to, between `0` and `3599` in units of `0.1` degree
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_math_iatan2(int32_t y, int32_t x, int16_t* const result) {
+    int32_t ax = x > 0 ? x : -x, ay = y > 0 ? y : -y, r, a;
+    
+    if (ax == 0 && ay == 0) {
+        *result = 0;
+        return 1;
+    }
+    r = ax >= ay ? (ay << 12) / ax : (ax << 12) / ay;   /* Ratio in range 0..1 in units of 1/4096 */
+    a = (r * 450 + (((r * (4096 - r)) >> 12) * 156) + 2048) >> 12;  /* Angle in first octant */
+    if (ay > ax) {
+        a = 900 - a;                                /* Second octant */
+    }
+    if (x < 0) {
+        a = 1800 - a;                               /* Second quadrant */
+    }
+    if (y < 0) {
+        a = 3600 - a;                               /* Third and fourth quadrant */
+    }
+    *result = (int16_t)(a % 3600);
+    return 1;
+}
+
+/**
+ * \brief           Calculate sine and cosine of angle with integer math
+ *
+ *                  Sine of angle inside quadrant is calculated with Taylor series up to \f$\ x^9\f$,
+ *                  maximal error is below \f$\ 10^{-5}\f$. Results for multiples of `90` degrees are exact.
+ *
+ * \param[in]       angle: Angle in units of `0.1` degree
+ * \param[out]      result_sin: Pointer to variable to store sine to, in units of `1/65536`
+ * \param[out]      result_cos: Pointer to variable to store cosine to, in units of `1/65536`
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_math_isincos(int16_t angle, int32_t* const result_sin, int32_t* const result_cos) {
+    int32_t a = angle % 3600, r, s, c, t = 0;
+    int64_t x, x2, p;
+    
+    if (a < 0) {
+        a += 3600;
+    }
+    r = a % 900;                                    /* Angle inside quadrant */
+    s = 0;
+    c = 65536;
+    if (r) {
+        /* Sine of r and of 90 - r, in units of 1/2^24 radians */
+        for (t = 0; t < 2; t++) {
+            x = ((int64_t)(t ? 900 - r : r) * 52707179 + 900) / 1800;    /* 52707179 = pi * 2^24 */
+            x2 = (x * x) >> 24;
+            p = 16777216 - x2 / 72;                 /* 1 - x^2/(8*9) */
+            p = 16777216 - ((x2 * p) >> 24) / 42;   /* 1 - x^2/(6*7) * (..) */
+            p = 16777216 - ((x2 * p) >> 24) / 20;   /* 1 - x^2/(4*5) * (..) */
+            p = 16777216 - ((x2 * p) >> 24) / 6;    /* 1 - x^2/(2*3) * (..) */
+            p = (((x * p) >> 24) + 128) >> 8;       /* Result in units of 1/65536 */
+            if (t) {
+                c = (int32_t)p;
+            } else {
+                s = (int32_t)p;
+            }
+        }
+    }
+    
+    /* Rotate result to quadrant */
+    switch (a / 900) {
+        case 1: t = s; s = c; c = -t; break;
+        case 2: s = -s; c = -c; break;
+        case 3: t = s; s = -c; c = t; break;
+        default: break;
+    }
+    *result_sin = s;
+    *result_cos = c;
+    return 1;
+}
+
+/**
+ * \brief           Calculate sine and cosine of angle from look-up table
+ *
+ *                  Values of each degree are taken from table and interpolated for tenths of degree,
+ *                  maximal error is `2` units. Function does not use multiplications wider than `32-bit`
+ *                  and is intended for per-frame geometry on targets without FPU, such as scale ticks and needles.
+ *
+ * \note            Use \ref gui_math_isincos when results for multiples of `90` degrees must be exact,
+ *                  value `1` is returned as `32767`
+ * \param[in]       angle: Angle in units of `0.1` degree
+ * \param[out]      result_sin: Pointer to variable to store sine to, in units of `1/32768`
+ * \param[out]      result_cos: Pointer to variable to store cosine to, in units of `1/32768`
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_math_isincos_q15(int16_t angle, int16_t* const result_sin, int16_t* const result_cos) {
+    int32_t a = angle % 3600, r, s, c, t;
+    
+    if (a < 0) {
+        a += 3600;
+    }
+    r = a % 900;                                    /* Angle inside quadrant */
+    s = GUI_MIN(sin_quadrant(r), 0x7FFF);
+    c = GUI_MIN(sin_quadrant(900 - r), 0x7FFF);
+    
+    /* Rotate result to quadrant */
+    switch (a / 900) {
+        case 1: t = s; s = c; c = -t; break;
+        case 2: s = -s; c = -c; break;
+        case 3: t = s; s = -c; c = t; break;
+        default: break;
+    }
+    *result_sin = (int16_t)s;
+    *result_cos = (int16_t)c;
+    return 1;
+}
+
+/**
+ * \brief           Calculate reciprocal value with integer math
+ *
+ *                  \f$\ y=\frac{2^{32}}{x}\f$
+ *
+ *                  Value is calculated with Newton-Raphson iterations, without division instruction.
+ *                  Multiply dividend with result and shift right by `32` bits to divide by `x` in a loop,
+ *                  result is not smaller than exact quotient and is less than `1` above it
+ *
+ * \param[in]       x: Divisor, must be greater than `1`
+ * \param[out]      result: Pointer to variable to store reciprocal to
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_math_irecip(uint32_t x, uint32_t* const result) {
+    uint32_t m, y, e;
+    uint8_t n = 0, i;
+    
+    if (x < 2) {                                    /* Result does not fit 32-bit number */
+        return 0;
+    }
+    for (m = x; !(m & 0x80000000UL); m <<= 1) {     /* Normalize divisor to range 0.5..1 */
+        n++;
+    }
+    
+    /* Initial estimation 48/17 - 32/17 * d and 3 iterations of y = y * (2 - d * y), in units of 1/2^30 */
+    y = 3031741620UL - (uint32_t)(((uint64_t)2021161080UL * m) >> 32);
+    for (i = 0; i < 3; i++) {
+        e = 0x80000000UL - (uint32_t)(((uint64_t)m * y) >> 32);
+        y = (uint32_t)(((uint64_t)y * e) >> 30);
+    }
+    *result = (y >> (30 - n)) + 1;                  /* Round up to never be below exact value */
+    return 1;
+}
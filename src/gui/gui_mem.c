@@ -49,13 +49,445 @@ typedef struct MemBlock {
 
 #define MEMBLOCK_METASIZE           MEM_ALIGN(sizeof(MemBlock_t))
 
-static MemBlock_t StartBlock;
-static MemBlock_t* EndBlock = 0;
 static size_t MemAvailableBytes = 0;
 static size_t MemMinAvailableBytes = 0;
+static size_t MemTotalSize = 0;                     /* Size of memory in units of bytes */
+static size_t MemAllocCount = 0;                    /* Number of successful allocations */
+
+/**
+ * \brief           Maximal number of regions walked by \ref gui_mem_walk
+ */
+#define MEM_REGIONS_MAX             8
+
+static mem_region_t MemRegions[MEM_REGIONS_MAX];    /* Block area of each assigned region, without end marker */
+static size_t MemRegionsCount = 0;
+
+static uint8_t MemRegionsClasses = 0;               /* Set to `1` when any region has allocation classes */
+
+#define MEM_REGIONS_ALL             (~(uint32_t)0)  /* Mask of all regions */
+
+/* Save block area of region for heap walk and allocation classes */
+static void
+mem_addregion(void* first, size_t size, uint8_t classes) {
+    if (MemRegionsCount < MEM_REGIONS_MAX) {
+        MemRegions[MemRegionsCount].start_address = first;
+        MemRegions[MemRegionsCount].size = size;
+        MemRegions[MemRegionsCount].classes = classes;
+        MemRegionsCount++;
+        if (classes) {
+            MemRegionsClasses = 1;
+        }
+    }
+}
+
+/* Check if block is inside one of regions selected by mask */
+static uint8_t
+mem_inregions(const void* block, uint32_t mask) {
+    size_t i;
+    
+    if (mask == MEM_REGIONS_ALL) {
+        return 1;
+    }
+    for (i = 0; i < MemRegionsCount; i++) {
+        if ((mask & ((uint32_t)1 << i)) && (const uint8_t *)block >= (const uint8_t *)MemRegions[i].start_address
+            && (const uint8_t *)block < (const uint8_t *)MemRegions[i].start_address + MemRegions[i].size) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+#if GUI_CFG_MEM_TLSF || __DOXYGEN__
+
+/*
+ * Two-level segregated fit allocator
+ *
+ * Free blocks are kept in lists, first level is selected by power of 2 of block size,
+ * second level splits each power of 2 range to TLSF_SL_COUNT linear ranges.
+ * Bitmaps of non-empty lists allow finding suitable block in constant time.
+ */
+#define TLSF_SL_LOG                 4
+#define TLSF_SL_COUNT               (1 << TLSF_SL_LOG)
+#define TLSF_ALIGN                  (MEM_ALIGN_NUM > sizeof(void *) ? MEM_ALIGN_NUM : sizeof(void *))
+#define TLSF_ALIGN_SIZE(x)          (((x) + (TLSF_ALIGN - 1)) & ~(TLSF_ALIGN - 1))
+#define TLSF_ALIGN_LOG              (TLSF_ALIGN == 16 ? 4 : (TLSF_ALIGN == 8 ? 3 : 2))
+#define TLSF_FL_SHIFT               (TLSF_SL_LOG + TLSF_ALIGN_LOG)
+#define TLSF_SMALL_SIZE             ((size_t)1 << TLSF_FL_SHIFT)
+#define TLSF_FL_COUNT               (32 - TLSF_FL_SHIFT + 1)
+
+#define TLSF_FLAG_FREE              ((size_t)0x01)  /*!< Block is free */
+#define TLSF_FLAG_PREV_FREE         ((size_t)0x02)  /*!< Previous physical block is free */
+#define TLSF_FLAGS                  (TLSF_FLAG_FREE | TLSF_FLAG_PREV_FREE)
+
+/**
+ * \brief           Block header
+ * 
+ *                  Only `prev_phys` and `size` fields are used when block is allocated,
+ *                  free list pointers overlap with user memory
+ */
+typedef struct tlsf_block {
+    struct tlsf_block* prev_phys;                   /*!< Previous physical block, valid only when previous block is free */
+    size_t size;                                    /*!< Size of user memory of block with flags in lower bits */
+    struct tlsf_block* next_free;                   /*!< Next free block in same list */
+    struct tlsf_block* prev_free;                   /*!< Previous free block in same list */
+} tlsf_block_t;
+
+#define TLSF_HDR_SIZE               TLSF_ALIGN_SIZE(offsetof(tlsf_block_t, next_free))
+#define TLSF_MIN_SIZE               TLSF_ALIGN_SIZE(sizeof(tlsf_block_t) - offsetof(tlsf_block_t, next_free))
+#define tlsf_size(b)                ((b)->size & ~TLSF_FLAGS)
+#define tlsf_isfree(b)              ((b)->size & TLSF_FLAG_FREE)
+#define tlsf_isprevfree(b)          ((b)->size & TLSF_FLAG_PREV_FREE)
+#define tlsf_toptr(b)               ((void *)((uint8_t *)(b) + TLSF_HDR_SIZE))
+#define tlsf_fromptr(p)             ((tlsf_block_t *)((uint8_t *)(p) - TLSF_HDR_SIZE))
+#define tlsf_next(b)                ((tlsf_block_t *)((uint8_t *)(b) + TLSF_HDR_SIZE + tlsf_size(b)))
+
+static uint32_t tlsf_fl_bitmap;
+static uint32_t tlsf_sl_bitmap[TLSF_FL_COUNT];
+static tlsf_block_t* tlsf_lists[TLSF_FL_COUNT][TLSF_SL_COUNT];
+static uint8_t tlsf_initialized;
+
+/* Get index of highest set bit */
+static int
+tlsf_fls(uint32_t x) {
+#if defined(__GNUC__)
+    return x ? 31 - __builtin_clz(x) : -1;
+#else /* defined(__GNUC__) */
+    int bit = -1;
+    while (x) {
+        x >>= 1;
+        bit++;
+    }
+    return bit;
+#endif /* !defined(__GNUC__) */
+}
+
+/* Get index of lowest set bit */
+static int
+tlsf_ffs(uint32_t x) {
+    return tlsf_fls(x & (~x + 1));
+}
+
+/* Get list indexes for block of specific size */
+static void
+tlsf_mapping(size_t size, int* fl, int* sl) {
+    if (size < TLSF_SMALL_SIZE) {
+        *fl = 0;
+        *sl = (int)(size / (TLSF_SMALL_SIZE / TLSF_SL_COUNT));
+    } else {
+        int f = tlsf_fls((uint32_t)size);
+        *sl = (int)((size >> (f - TLSF_SL_LOG)) ^ TLSF_SL_COUNT);
+        *fl = f - TLSF_FL_SHIFT + 1;
+    }
+}
+
+/* Insert free block to list */
+static void
+tlsf_insert(tlsf_block_t* b) {
+    int fl, sl;
+    
+    tlsf_mapping(tlsf_size(b), &fl, &sl);
+    b->prev_free = NULL;
+    b->next_free = tlsf_lists[fl][sl];
+    if (b->next_free != NULL) {
+        b->next_free->prev_free = b;
+    }
+    tlsf_lists[fl][sl] = b;
+    tlsf_fl_bitmap |= (uint32_t)1 << fl;
+    tlsf_sl_bitmap[fl] |= (uint32_t)1 << sl;
+}
+
+/* Remove free block from list */
+static void
+tlsf_remove(tlsf_block_t* b) {
+    int fl, sl;
+    
+    tlsf_mapping(tlsf_size(b), &fl, &sl);
+    if (b->next_free != NULL) {
+        b->next_free->prev_free = b->prev_free;
+    }
+    if (b->prev_free != NULL) {
+        b->prev_free->next_free = b->next_free;
+    } else {
+        tlsf_lists[fl][sl] = b->next_free;
+        if (tlsf_lists[fl][sl] == NULL) {           /* List is now empty */
+            tlsf_sl_bitmap[fl] &= ~((uint32_t)1 << sl);
+            if (!tlsf_sl_bitmap[fl]) {
+                tlsf_fl_bitmap &= ~((uint32_t)1 << fl);
+            }
+        }
+    }
+}
+
+/* Mark block as free, merge it with free neighbours and put it to lists */
+static void
+tlsf_release(tlsf_block_t* b) {
+    tlsf_block_t* next;
+    
+    b->size |= TLSF_FLAG_FREE;
+    if (tlsf_isprevfree(b)) {                       /* Merge with previous block */
+        tlsf_block_t* prev = b->prev_phys;
+        tlsf_remove(prev);
+        prev->size += TLSF_HDR_SIZE + tlsf_size(b);
+        b = prev;
+    }
+    next = tlsf_next(b);
+    if (tlsf_isfree(next)) {                        /* Merge with next block */
+        tlsf_remove(next);
+        b->size += TLSF_HDR_SIZE + tlsf_size(next);
+        next = tlsf_next(b);
+    }
+    next->prev_phys = b;
+    next->size |= TLSF_FLAG_PREV_FREE;
+    tlsf_insert(b);
+}
+
+uint8_t
+mem_assignmem(const mem_region_t* regions, size_t len) {
+    uint8_t* addr;
+    size_t size, i;
+    tlsf_block_t *b, *end;
+    
+    if (tlsf_initialized) {                         /* Regions already defined */
+        return 0;
+    }
+    
+    /* Check if region address are linear and rising */
+    addr = (uint8_t *)0;
+    for (i = 0; i < len; i++) {
+        if (addr >= (uint8_t *)regions[i].start_address) {
+            return 0;
+        }
+        addr = (uint8_t *)regions[i].start_address;
+    }
+    
+    for (; len--; regions++) {
+        /* Align start address and size */
+        addr = (uint8_t *)regions->start_address;
+        size = regions->size;
+        if ((size_t)addr & (TLSF_ALIGN - 1)) {
+            i = TLSF_ALIGN - ((size_t)addr & (TLSF_ALIGN - 1));
+            if (size <= i) {
+                continue;
+            }
+            addr += i;
+            size -= i;
+        }
+        size &= ~(TLSF_ALIGN - 1);
+        if (size < (2 * TLSF_HDR_SIZE + TLSF_MIN_SIZE)) {   /* Region too small */
+            continue;
+        }
+        
+        /* Create one free block and sentinel block at the end of region */
+        b = (tlsf_block_t *)addr;
+        b->prev_phys = NULL;
+        b->size = size - 2 * TLSF_HDR_SIZE;         /* Previous block does not exist, treat as allocated */
+        end = tlsf_next(b);
+        end->prev_phys = b;
+        end->size = 0;                              /* Sentinel is allocated block with no memory */
+        
+        b->size |= TLSF_FLAG_FREE;
+        end->size |= TLSF_FLAG_PREV_FREE;
+        tlsf_insert(b);
+        mem_addregion(b, (uint8_t *)end - (uint8_t *)b, regions->classes);
+        
+        MemAvailableBytes += tlsf_size(b) + TLSF_HDR_SIZE;
+        MemTotalSize += tlsf_size(b) + TLSF_HDR_SIZE;
+        tlsf_initialized = 1;
+    }
+    MemMinAvailableBytes = MemAvailableBytes;
+    
+    return tlsf_initialized;
+}
+
+/* Find free block from lists starting at fl and sl, inside regions selected by mask */
+static tlsf_block_t*
+tlsf_find(int fl, int sl, uint32_t mask) {
+    tlsf_block_t* b;
+    uint32_t map;
+    
+    map = tlsf_sl_bitmap[fl] & (~(uint32_t)0 << sl);
+    while (1) {
+        for (; map; map &= map - 1) {               /* Check all non-empty lists of first level */
+            for (b = tlsf_lists[fl][tlsf_ffs(map)]; b != NULL; b = b->next_free) {
+                if (mem_inregions(b, mask)) {
+                    return b;
+                }
+            }
+        }
+        map = fl + 1 < TLSF_FL_COUNT ? tlsf_fl_bitmap & (~(uint32_t)0 << (fl + 1)) : 0;
+        if (!map) {
+            return NULL;                            /* No block big enough */
+        }
+        fl = tlsf_ffs(map);
+        map = tlsf_sl_bitmap[fl];
+    }
+}
+
+static void*
+mem_alloc_in(size_t size, uint32_t mask) {
+    tlsf_block_t *b, *rem, *next;
+    int fl, sl;
+    
+    if (!tlsf_initialized || !size || size > ((size_t)1 << 30)) {
+        return NULL;
+    }
+    size = TLSF_ALIGN_SIZE(size);
+    if (size < TLSF_MIN_SIZE) {
+        size = TLSF_MIN_SIZE;
+    }
+    
+    /* Round size up to next list range, any block in found list is then big enough */
+    if (size >= TLSF_SMALL_SIZE) {
+        size_t round = ((size_t)1 << (tlsf_fls((uint32_t)size) - TLSF_SL_LOG)) - 1;
+        tlsf_mapping(size + round, &fl, &sl);
+    } else {
+        tlsf_mapping(size, &fl, &sl);
+    }
+    if (fl >= TLSF_FL_COUNT) {
+        return NULL;
+    }
+    
+    /* Find non-empty list with blocks of at least required size */
+    if ((b = tlsf_find(fl, sl, mask)) == NULL) {
+        return NULL;
+    }
+    tlsf_remove(b);
+    
+    /* Split block if remaining part is big enough for new block */
+    if (tlsf_size(b) >= size + TLSF_HDR_SIZE + TLSF_MIN_SIZE) {
+        rem = (tlsf_block_t *)((uint8_t *)tlsf_toptr(b) + size);
+        rem->size = (tlsf_size(b) - size - TLSF_HDR_SIZE) | TLSF_FLAG_FREE;
+        rem->prev_phys = b;
+        b->size = size | (b->size & TLSF_FLAGS);
+        next = tlsf_next(rem);
+        next->prev_phys = rem;
+        tlsf_insert(rem);
+    } else {
+        next = tlsf_next(b);
+        next->size &= ~TLSF_FLAG_PREV_FREE;         /* Previous block is now used */
+    }
+    b->size &= ~TLSF_FLAG_FREE;                     /* Block is now allocated */
+    
+    MemAvailableBytes -= tlsf_size(b) + TLSF_HDR_SIZE;
+    if (MemAvailableBytes < MemMinAvailableBytes) {
+        MemMinAvailableBytes = MemAvailableBytes;
+    }
+    return tlsf_toptr(b);
+}
+
+static void
+mem_free(void* ptr) {
+    tlsf_block_t* b;
+    
+    if (ptr == NULL) {
+        return;
+    }
+    b = tlsf_fromptr(ptr);
+    if (!tlsf_isfree(b)) {                          /* Protect against double free */
+        MemAvailableBytes += tlsf_size(b) + TLSF_HDR_SIZE;
+        tlsf_release(b);
+    }
+}
+
+/* Split end of block to new free block when it is big enough */
+static void
+tlsf_trim(tlsf_block_t* b, size_t size) {
+    tlsf_block_t* rem;
+    
+    if (tlsf_size(b) >= size + TLSF_HDR_SIZE + TLSF_MIN_SIZE) {
+        rem = (tlsf_block_t *)((uint8_t *)tlsf_toptr(b) + size);
+        rem->size = tlsf_size(b) - size - TLSF_HDR_SIZE;    /* Block before is allocated */
+        rem->prev_phys = b;
+        b->size = size | (b->size & TLSF_FLAGS);
+        tlsf_release(rem);                          /* Merge with free block after */
+    }
+}
+
+/* Resize allocated block without moving it, using free block after it when growing */
+static uint8_t
+mem_resize(void* ptr, size_t size) {
+    tlsf_block_t *b, *next;
+    size_t old;
+    
+    if (!size || size > ((size_t)1 << 30)) {
+        return 0;
+    }
+    size = TLSF_ALIGN_SIZE(size);
+    if (size < TLSF_MIN_SIZE) {
+        size = TLSF_MIN_SIZE;
+    }
+    b = tlsf_fromptr(ptr);
+    old = tlsf_size(b);
+    if (size > old) {                               /* Grow to next physical block */
+        next = tlsf_next(b);
+        if (!tlsf_isfree(next) || (old + TLSF_HDR_SIZE + tlsf_size(next)) < size) {
+            return 0;
+        }
+        tlsf_remove(next);
+        b->size += TLSF_HDR_SIZE + tlsf_size(next);
+        tlsf_next(b)->size &= ~TLSF_FLAG_PREV_FREE; /* Block after merged one is now after used block */
+    }
+    tlsf_trim(b, size);                             /* Return unused end back to free lists */
+    
+    MemAvailableBytes = MemAvailableBytes + old - tlsf_size(b);
+    if (MemAvailableBytes < MemMinAvailableBytes) {
+        MemMinAvailableBytes = MemAvailableBytes;
+    }
+    return 1;
+}
+
+/* Get size of user memory from input pointer */
+static size_t
+mem_getusersize(void* ptr) {
+    if (ptr == NULL) {
+        return 0;
+    }
+    return tlsf_size(tlsf_fromptr(ptr));
+}
+
+/* Get block information and next physical block */
+static void*
+mem_walknext(void* block, void** ptr, size_t* size, uint8_t* used) {
+    tlsf_block_t* b = block;
+    
+    *ptr = tlsf_toptr(b);
+    *size = tlsf_size(b);
+    *used = !tlsf_isfree(b);
+    return tlsf_next(b);
+}
+
+#if GUI_CFG_USE_MEM_MOVABLE || __DOXYGEN__
+
+/* Move allocated block to start of free block before it, free block moves after it */
+static void*
+mem_slide(void* block) {
+    tlsf_block_t *b = block, *prev, *rem;
+    size_t size, prev_size;
+    
+    if (!tlsf_isprevfree(b)) {
+        return NULL;
+    }
+    prev = b->prev_phys;
+    size = tlsf_size(b);
+    prev_size = tlsf_size(prev);
+    tlsf_remove(prev);
+    memmove(tlsf_toptr(prev), tlsf_toptr(b), size); /* Header of current block may be overwritten */
+    prev->size = size;                              /* Block before free block is always allocated */
+    rem = tlsf_next(prev);
+    rem->prev_phys = prev;
+    rem->size = prev_size;
+    tlsf_release(rem);                              /* Merge with free block after */
+    return prev;
+}
+
+#endif /* GUI_CFG_USE_MEM_MOVABLE || __DOXYGEN__ */
+
+#else /* GUI_CFG_MEM_TLSF || __DOXYGEN__ */
+
+static MemBlock_t StartBlock;
+static MemBlock_t* EndBlock = 0;
 static size_t MemAllocBit = 0;
 
-static size_t MemTotalSize = 0;                     /* Size of memory in units of bytes */
 /* Insert block to list of free blocks */
 static void
 mem_insertfreeblock(MemBlock_t* newBlock) {
@@ -186,6 +618,8 @@ mem_assignmem(const mem_region_t* regions, size_t len) {
         
         /* Set number of free bytes available to allocate in region */
         MemAvailableBytes += FirstBlock->Size;
+        MemTotalSize += FirstBlock->Size;
+        mem_addregion(FirstBlock, FirstBlock->Size, regions->classes);
         
         regions++;                                  /* Go to next region */
     }
@@ -201,7 +635,7 @@ mem_assignmem(const mem_region_t* regions, size_t len) {
 }
 
 static void*
-mem_alloc(size_t size) {
+mem_alloc_in(size_t size, uint32_t mask) {
     MemBlock_t *Prev, *Curr, *Next;
     void* retval = 0;
 
@@ -226,7 +660,7 @@ mem_alloc(size_t size) {
      */
     Prev = &StartBlock;                             /* Set first first block as previous */
     Curr = Prev->NextFreeBlock;                     /* Set next block as current */
-    while ((Curr->Size < size) && (Curr->NextFreeBlock)) {
+    while ((Curr->Size < size || !mem_inregions(Curr, mask)) && (Curr->NextFreeBlock)) {
         Prev = Curr;
         Curr = Curr->NextFreeBlock;
     }
@@ -258,10 +692,10 @@ mem_alloc(size_t size) {
              */
             mem_insertfreeblock(Next);              /* Insert free memory block to list of free memory blocks (linked list chain) */
         }
+        MemAvailableBytes -= Curr->Size;            /* Decrease available memory, block may be bigger than required */
         Curr->Size |= MemAllocBit;                  /* Set allocated bit = memory is allocated */
         Curr->NextFreeBlock = 0;                    /* Clear next free block pointer as there is no one */
 
-        MemAvailableBytes -= size;                  /* Decrease available memory */
         if (MemAvailableBytes < MemMinAvailableBytes) { /* Check if current available memory is less than ever before */
             MemMinAvailableBytes = MemAvailableBytes;   /* Update minimal available memory */
         }
@@ -297,6 +731,43 @@ mem_free(void* ptr) {
     }
 }
 
+/* Resize allocated block without moving it, using free block after it when growing */
+static uint8_t
+mem_resize(void* ptr, size_t size) {
+    MemBlock_t *block, *prev, *next;
+    size_t old;
+    
+    if (!size || size >= MemAllocBit) {
+        return 0;
+    }
+    size = MEM_ALIGN(size) + MEMBLOCK_METASIZE;
+    block = (MemBlock_t *)(((uint8_t *)ptr) - MEMBLOCK_METASIZE);
+    old = block->Size & ~MemAllocBit;
+    if (size > old) {                               /* Grow to next physical block */
+        next = (MemBlock_t *)((uint8_t *)block + old);
+        for (prev = &StartBlock; prev->NextFreeBlock != NULL && prev->NextFreeBlock < next; prev = prev->NextFreeBlock);
+        if (prev->NextFreeBlock != next || next == EndBlock || (old + next->Size) < size) {
+            return 0;                               /* Next block is used or too small */
+        }
+        prev->NextFreeBlock = next->NextFreeBlock;  /* Remove it from free chain */
+        old += next->Size;
+        MemAvailableBytes -= next->Size;
+    }
+    if ((old - size) > (2 * MEMBLOCK_METASIZE)) {   /* Return unused end back to free chain */
+        next = (MemBlock_t *)((uint8_t *)block + size);
+        next->Size = old - size;
+        MemAvailableBytes += next->Size;
+        mem_insertfreeblock(next);
+        old = size;
+    }
+    block->Size = old | MemAllocBit;
+    
+    if (MemAvailableBytes < MemMinAvailableBytes) {
+        MemMinAvailableBytes = MemAvailableBytes;
+    }
+    return 1;
+}
+
 /* Get size of user memory from input pointer */
 static size_t
 mem_getusersize(void* ptr) {
@@ -312,13 +783,96 @@ mem_getusersize(void* ptr) {
     return 0;
 }
 
+/* Get block information and next physical block */
+static void*
+mem_walknext(void* block, void** ptr, size_t* size, uint8_t* used) {
+    MemBlock_t* b = block;
+    
+    *ptr = (uint8_t *)b + MEMBLOCK_METASIZE;
+    *size = (b->Size & ~MemAllocBit) - MEMBLOCK_METASIZE;
+    *used = (b->Size & MemAllocBit) ? 1 : 0;
+    return (uint8_t *)b + (b->Size & ~MemAllocBit);
+}
+
+#if GUI_CFG_USE_MEM_MOVABLE
+
+/* Move allocated block to start of free block before it, free block moves after it */
+static void*
+mem_slide(void* block) {
+    MemBlock_t *b = block, *prev, *ptr, *rem;
+    size_t size, prev_size;
+    
+    /* Find free block before and its previous entry in free chain */
+    for (prev = NULL, ptr = &StartBlock; ptr->NextFreeBlock != NULL && ptr->NextFreeBlock < b; prev = ptr, ptr = ptr->NextFreeBlock);
+    if (prev == NULL || (uint8_t *)ptr + ptr->Size != (uint8_t *)b) {
+        return NULL;
+    }
+    size = b->Size & ~MemAllocBit;
+    prev_size = ptr->Size;
+    prev->NextFreeBlock = ptr->NextFreeBlock;       /* Remove it from free chain */
+    memmove((uint8_t *)ptr + MEMBLOCK_METASIZE, (uint8_t *)b + MEMBLOCK_METASIZE, size - MEMBLOCK_METASIZE);
+    ptr->Size = size | MemAllocBit;
+    ptr->NextFreeBlock = 0;
+    rem = (MemBlock_t *)((uint8_t *)ptr + size);
+    rem->Size = prev_size;
+    mem_insertfreeblock(rem);                       /* Merge with free block after */
+    return ptr;
+}
+
+#endif /* GUI_CFG_USE_MEM_MOVABLE */
+
+#endif /* !(GUI_CFG_MEM_TLSF || __DOXYGEN__) */
+
+/* Get mask of regions for allocation class, pass `0` = preferred, `1` = general purpose, `2` = any usable */
+static uint32_t
+mem_classregions(uint8_t cls, uint8_t pass) {
+    uint32_t mask = 0;
+    uint8_t c, use;
+    size_t i;
+    
+    for (i = 0; i < MemRegionsCount; i++) {
+        c = MemRegions[i].classes;
+        if (pass == 0) {
+            use = cls ? (c & cls) == cls : !c;
+        } else if (pass == 1) {
+            use = !c;
+        } else {
+            use = !(cls & GUI_MEM_CLASS_DMA) || !c || (c & GUI_MEM_CLASS_DMA);
+        }
+        if (use) {
+            mask |= (uint32_t)1 << i;
+        }
+    }
+    return mask;
+}
+
+/* Allocate memory in region suitable for allocation class */
+static void*
+mem_alloc(size_t size, uint8_t cls) {
+    void* ptr = NULL;
+    uint32_t mask, tried = 0;
+    uint8_t pass;
+    
+    if (!MemRegionsClasses) {                       /* All regions are the same */
+        return mem_alloc_in(size, MEM_REGIONS_ALL);
+    }
+    for (pass = 0; ptr == NULL && pass < 3; pass++) {
+        mask = mem_classregions(cls, pass) & ~tried;    /* Skip regions checked in previous pass */
+        if (mask) {
+            ptr = mem_alloc_in(size, mask);
+            tried |= mask;
+        }
+    }
+    return ptr;
+}
+
 /* Allocate memory and set it to 0 */
 static void*
-mem_calloc(size_t num, size_t size) {
+mem_calloc(size_t num, size_t size, uint8_t cls) {
     void* ptr;
     size_t tot_len = num * size;
     
-    if ((ptr = mem_alloc(tot_len)) != NULL) {       /* Try to allocate memory */
+    if ((ptr = mem_alloc(tot_len, cls)) != NULL) {  /* Try to allocate memory */
         memset(ptr, 0x00, tot_len);                 /* Reset entire memory */
     }
     return ptr;
@@ -331,11 +885,23 @@ mem_realloc(void* ptr, size_t size) {
     size_t oldSize;
     
     if (!ptr) {                                     /* If pointer is not valid */
-        return mem_alloc(size);                     /* Only allocate memory */
+        return mem_alloc(size, GUI_MEM_CLASS_ANY);  /* Only allocate memory */
     }
     
+    if (mem_resize(ptr, size)) {                    /* Shrink or grow to free neighbour in place */
+        return ptr;
+    }
     oldSize = mem_getusersize(ptr);                 /* Get size of old pointer */
-    newPtr = mem_alloc(size);                       /* Try to allocate new memory block */
+    newPtr = NULL;
+    if (MemRegionsClasses) {                        /* Keep memory in the same region if possible */
+        size_t i;
+        
+        for (i = 0; i < MemRegionsCount && !mem_inregions(ptr, (uint32_t)1 << i); i++) {}
+        newPtr = mem_alloc_in(size, (uint32_t)1 << i);
+    }
+    if (newPtr == NULL) {
+        newPtr = mem_alloc(size, GUI_MEM_CLASS_ANY);/* Try to allocate new memory block */
+    }
     if (newPtr != NULL) {                           /* Check success */
         memcpy(newPtr, ptr, size > oldSize ? oldSize : size);   /* Copy old data to new array */
         mem_free(ptr);                              /* Free old pointer */
@@ -359,6 +925,217 @@ mem_getminfree(void) {
     return MemMinAvailableBytes;                    /* Return minimal bytes ever available */
 }
 
+#if GUI_CFG_USE_MEM_ARENA || __DOXYGEN__
+
+/**
+ * \brief           Memory arena structure, followed by arena memory
+ */
+struct gui_mem_arena {
+    struct gui_mem_arena* next;                     /*!< Next created arena */
+    uint8_t* mem;                                   /*!< Start of arena memory */
+    size_t size;                                    /*!< Size of arena memory in units of bytes */
+    size_t used;                                    /*!< Number of used bytes */
+};
+
+#define ARENA_HDR_SIZE              MEM_ALIGN(sizeof(size_t))
+
+static gui_mem_arena_t* arena_list;                 /* List of all created arenas */
+static gui_mem_arena_t* arena_active;               /* Arena used for new allocations */
+
+/**
+ * \brief           Allocate memory from active arena
+ * \param[in]       size: Number of bytes to allocate
+ * \return          Allocated memory on success, `NULL` when there is no active arena or it is full
+ */
+static void*
+arena_alloc(size_t size) {
+    gui_mem_arena_t* a = arena_active;
+    size_t need = ARENA_HDR_SIZE + MEM_ALIGN(size);
+    uint8_t* ptr;
+    
+    if (a == NULL || (a->size - a->used) < need) {
+        return NULL;
+    }
+    ptr = a->mem + a->used;
+    *(size_t *)ptr = size;                          /* Save size for reallocation */
+    a->used += need;
+    return ptr + ARENA_HDR_SIZE;                    /* Arena memory is cleared at create and never reused */
+}
+
+/**
+ * \brief           Find arena memory belongs to
+ * \param[in]       ptr: Memory pointer
+ * \return          Arena on success, `NULL` when memory was allocated from heap
+ */
+static gui_mem_arena_t*
+arena_find(const void* ptr) {
+    gui_mem_arena_t* a;
+    
+    for (a = arena_list; a != NULL; a = a->next) {
+        if ((const uint8_t *)ptr >= a->mem && (const uint8_t *)ptr < (a->mem + a->size)) {
+            return a;
+        }
+    }
+    return NULL;
+}
+
+#endif /* GUI_CFG_USE_MEM_ARENA || __DOXYGEN__ */
+
+#if (GUI_CFG_USE_MEM && GUI_CFG_MEM_TRACE) || __DOXYGEN__
+
+/*
+ * Each heap block starts with pointer to its tag,
+ * user memory follows aligned header
+ */
+#define TRACE_HDR_SIZE              MEM_ALIGN(sizeof(const char *))
+#define TRACE_SIZE(size)            ((size) + TRACE_HDR_SIZE)
+#define TRACE_RAW(ptr)              ((ptr) != NULL ? (void *)((uint8_t *)(ptr) - TRACE_HDR_SIZE) : NULL)
+
+/**
+ * \brief           Save tag to header of raw heap block
+ * \param[in]       raw: Raw block returned by allocator
+ * \param[in]       tag: Tag of allocation site
+ * \return          User memory after header or `NULL` if raw block is not valid
+ */
+static void*
+trace_settag(void* raw, const char* tag) {
+    if (raw == NULL) {
+        return NULL;
+    }
+    *(const char **)raw = tag;
+    return (uint8_t *)raw + TRACE_HDR_SIZE;
+}
+
+#endif /* (GUI_CFG_USE_MEM && GUI_CFG_MEM_TRACE) || __DOXYGEN__ */
+
+#if GUI_CFG_MEM_TRACE
+static const char* MemTag;                          /* Tag overriding allocation site */
+#endif /* GUI_CFG_MEM_TRACE */
+#if GUI_CFG_USE_MEM_MOVABLE
+static uint8_t MemCompactPending = 0;               /* Set to `1` when heap block was freed or moved since last compaction */
+#endif /* GUI_CFG_USE_MEM_MOVABLE */
+static size_t MemFailCount = 0;                     /* Number of failed allocations */
+static size_t MemFailSize = 0;                      /* Size of last failed allocation */
+static const char* MemFailTag;                      /* Tag of last failed allocation */
+
+/* Count allocation result, tag is already resolved */
+static void
+mem_count(const void* ptr, size_t size, const char* tag) {
+    if (ptr != NULL) {
+        MemAllocCount++;
+    } else if (size > 0) {
+        MemFailCount++;
+        MemFailSize = size;
+        MemFailTag = tag;
+    }
+}
+
+/* Get effective tag of allocation, scope tag overrides allocation site */
+static const char*
+mem_gettag(const char* tag) {
+#if GUI_CFG_MEM_TRACE
+    return MemTag != NULL ? MemTag : tag;
+#else /* GUI_CFG_MEM_TRACE */
+    GUI_UNUSED(tag);
+    return NULL;
+#endif /* !GUI_CFG_MEM_TRACE */
+}
+
+/* Allocate memory from heap, without counting result */
+static void*
+heap_tryalloc(size_t size, uint8_t clear, uint8_t cls, const char* tag) {
+#if GUI_CFG_USE_MEM && GUI_CFG_MEM_TRACE
+    return trace_settag(clear ? mem_calloc(1, TRACE_SIZE(size), cls) : mem_alloc(TRACE_SIZE(size), cls), tag);
+#elif GUI_CFG_USE_MEM
+    GUI_UNUSED(tag);
+    return clear ? mem_calloc(1, size, cls) : mem_alloc(size, cls);
+#else
+    GUI_UNUSED(cls);
+    GUI_UNUSED(tag);
+    return clear ? calloc(1, size) : malloc(size);
+#endif
+}
+
+/* Reallocate heap memory, without counting result */
+static void*
+heap_tryrealloc(void* ptr, size_t size, const char* tag) {
+#if GUI_CFG_USE_MEM && GUI_CFG_MEM_TRACE
+    return trace_settag(mem_realloc(TRACE_RAW(ptr), TRACE_SIZE(size)), tag);
+#elif GUI_CFG_USE_MEM
+    GUI_UNUSED(tag);
+    return mem_realloc(ptr, size);
+#else
+    GUI_UNUSED(tag);
+    return realloc(ptr, size);
+#endif
+}
+
+/* Allocate memory from heap */
+static void*
+heap_alloc(size_t size, uint8_t clear, uint8_t cls, const char* tag) {
+    void* ptr;
+
+#if GUI_CFG_USE_CACHE_MANAGER
+    while ((ptr = heap_tryalloc(size, clear, cls, tag)) == NULL && guii_cache_reclaim(size)) {} /* Release cache entries before allocation fails */
+#else /* GUI_CFG_USE_CACHE_MANAGER */
+    ptr = heap_tryalloc(size, clear, cls, tag);
+#endif /* !GUI_CFG_USE_CACHE_MANAGER */
+    mem_count(ptr, size, tag);
+    return ptr;
+}
+
+/* Reallocate heap memory */
+static void*
+heap_realloc(void* ptr, size_t size, const char* tag) {
+    void* new_ptr;
+
+#if GUI_CFG_USE_MEM && GUI_CFG_MEM_TRACE
+    if (ptr == NULL) {
+        return heap_alloc(size, 0, GUI_MEM_CLASS_ANY, tag);
+    }
+#endif /* GUI_CFG_USE_MEM && GUI_CFG_MEM_TRACE */
+#if GUI_CFG_USE_CACHE_MANAGER
+    while ((new_ptr = heap_tryrealloc(ptr, size, tag)) == NULL && size > 0 && guii_cache_reclaim(size)) {}
+#else /* GUI_CFG_USE_CACHE_MANAGER */
+    new_ptr = heap_tryrealloc(ptr, size, tag);
+#endif /* !GUI_CFG_USE_CACHE_MANAGER */
+    ptr = new_ptr;
+#if GUI_CFG_USE_MEM_MOVABLE
+    MemCompactPending = 1;
+#endif /* GUI_CFG_USE_MEM_MOVABLE */
+    mem_count(ptr, size, tag);
+    return ptr;
+}
+
+/* Free heap memory */
+static void
+heap_free(void* ptr) {
+#if GUI_CFG_USE_MEM && GUI_CFG_MEM_TRACE
+    mem_free(TRACE_RAW(ptr));
+#elif GUI_CFG_USE_MEM
+    mem_free(ptr);
+#else
+    free(ptr);
+#endif
+#if GUI_CFG_USE_MEM_MOVABLE
+    MemCompactPending = 1;
+#endif /* GUI_CFG_USE_MEM_MOVABLE */
+}
+
+/* Allocate memory from active arena or heap */
+static void*
+alloc_tagged(size_t size, uint8_t clear, uint8_t cls, const char* tag) {
+#if GUI_CFG_USE_MEM_ARENA
+    void* ptr;
+
+    if (!(cls & GUI_MEM_CLASS_DMA) && (ptr = arena_alloc(size)) != NULL) {  /* Try with active arena first, memory is already cleared */
+        MemAllocCount++;
+        return ptr;
+    }
+#endif /* GUI_CFG_USE_MEM_ARENA */
+    return heap_alloc(size, clear, cls, mem_gettag(tag));
+}
+
 /**
  * \brief           Allocate memory of specific size
  * \note            This function is private and may be called only when OS protection is active
@@ -367,32 +1144,50 @@ mem_getminfree(void) {
  */
 void*
 gui_mem_alloc(uint32_t size) {
-    void* ptr;
-
-#if GUI_CFG_USE_MEM
-    ptr = mem_alloc(size);                          /* Allocate memory and return pointer */
-#else /* GUI_CFG_USE_MEM */
-    ptr = malloc(size);
-#endif /* !GUI_CFG_USE_MEM */
-
-    return ptr;
+    return alloc_tagged(size, 0, GUI_MEM_CLASS_ANY, NULL);
 }
 
 /**
  * \brief           Allocate memory of specific size
- * \note            After new memory is allocated, content of old one is copied to new memory
+ * \note            Block is shrunk in place or grown to free block after it when possible,
+ *                  otherwise new memory is allocated and content of old one is copied to new memory
  * \param[in]       ptr: Pointer to current allocated memory to resize, returned using \ref gui_mem_alloc, \ref gui_mem_calloc or \ref gui_mem_realloc functions
  * \param[in]       size: Number of bytes to allocate on new memory
  * \return          Allocated memory on success, `NULL` otherwise
  */
 void*
 gui_mem_realloc(void* ptr, size_t size) {
-#if GUI_CFG_USE_MEM
-    ptr = mem_realloc(ptr, size);                   /* Reallocate and return pointer */
-#else /* GUI_CFG_USE_MEM */
-    ptr = realloc(ptr, size);
-#endif /* GUI_CFG_USE_MEM */
-    return ptr;
+    return gui_mem_realloc_tag(ptr, size, NULL);
+}
+
+/**
+ * \brief           Reallocate memory and tag it with allocation site
+ * \note            Tag is saved only when \ref GUI_CFG_MEM_TRACE is enabled
+ * \param[in]       ptr: Pointer to current allocated memory to resize
+ * \param[in]       size: Number of bytes to allocate on new memory
+ * \param[in]       tag: Constant string describing allocation site, reported by \ref gui_mem_walk
+ * \return          Allocated memory on success, `NULL` otherwise
+ */
+void*
+gui_mem_realloc_tag(void* ptr, size_t size, const char* tag) {
+#if GUI_CFG_USE_MEM_ARENA
+    if (ptr == NULL) {
+        return alloc_tagged(size, 0, GUI_MEM_CLASS_ANY, tag);
+    }
+    if (arena_find(ptr) != NULL) {                  /* Arena memory cannot grow, copy it to new block */
+        size_t old = *(size_t *)((uint8_t *)ptr - ARENA_HDR_SIZE);
+        void* new_ptr;
+        
+        if (size <= old) {
+            return ptr;
+        }
+        if ((new_ptr = alloc_tagged(size, 0, GUI_MEM_CLASS_ANY, tag)) != NULL) {
+            memcpy(new_ptr, ptr, old);
+        }
+        return new_ptr;
+    }
+#endif /* GUI_CFG_USE_MEM_ARENA */
+    return heap_realloc(ptr, size, mem_gettag(tag));
 }
 
 /**
@@ -403,14 +1198,61 @@ gui_mem_realloc(void* ptr, size_t size) {
  */
 void*
 gui_mem_calloc(size_t num, size_t size) {
-    void* ptr;
+    return alloc_tagged(num * size, 1, GUI_MEM_CLASS_ANY, NULL);
+}
 
-#if GUI_CFG_USE_MEM
-    ptr = mem_calloc(num, size);                    /* Allocate memory and clear it to 0. Then return pointer */
-#else /* GUI_CFG_USE_MEM */
-    ptr = calloc(num, size);
-#endif /* !GUI_CFG_USE_MEM */
-    return ptr;
+/**
+ * \brief           Allocate memory, set it to zero and tag it with allocation site
+ * \note            Tag is saved only when \ref GUI_CFG_MEM_TRACE is enabled
+ * \param[in]       num: Number of elements to allocate
+ * \param[in]       size: Size of each element
+ * \param[in]       tag: Constant string describing allocation site, reported by \ref gui_mem_walk
+ * \return          Allocated memory on success, `NULL` otherwise
+ */
+void*
+gui_mem_calloc_tag(size_t num, size_t size, const char* tag) {
+    return alloc_tagged(num * size, 1, GUI_MEM_CLASS_ANY, tag);
+}
+
+/**
+ * \brief           Allocate memory of allocation class and set it to zero
+ *
+ *                  Memory is allocated in regions with matching classes, see \ref gui_mem_region_t.
+ *                  When they are full, other regions are used, except for \ref GUI_MEM_CLASS_DMA allocations,
+ *                  which are placed only to DMA or general purpose regions
+ *
+ * \param[in]       num: Number of elements to allocate
+ * \param[in]       size: Size of each element
+ * \param[in]       cls: Allocation class, see \ref GUI_MEM_CLASS
+ * \param[in]       tag: Constant string describing allocation site or `NULL`
+ * \return          Allocated memory on success, `NULL` otherwise
+ */
+void*
+gui_mem_calloc_class(size_t num, size_t size, uint8_t cls, const char* tag) {
+    return alloc_tagged(num * size, 1, cls, tag);
+}
+
+/**
+ * \brief           Set tag for all next allocations
+ * 
+ *                  Scope tag overrides allocation site passed by \ref GUI_MEMALLOC,
+ *                  until previous tag is restored
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       tag: Constant string to use as tag or `NULL` to use allocation sites
+ * \return          Previous scope tag, always `NULL` when \ref GUI_CFG_MEM_TRACE is disabled
+ */
+const char*
+gui_mem_settag(const char* tag) {
+#if GUI_CFG_MEM_TRACE
+    const char* prev = MemTag;
+
+    MemTag = tag;
+    return prev;
+#else /* GUI_CFG_MEM_TRACE */
+    GUI_UNUSED(tag);
+    return NULL;
+#endif /* !GUI_CFG_MEM_TRACE */
 }
 
 /**
@@ -419,11 +1261,12 @@ gui_mem_calloc(size_t num, size_t size) {
  */
 void
 gui_mem_free(void* ptr) {
-#if GUI_CFG_USE_MEM
-    mem_free(ptr);                                  /* Free already allocated memory */
-#else /* GUI_CFG_USE_MEM */
-    free(ptr);
-#endif /* !GUI_CFG_USE_MEM */
+#if GUI_CFG_USE_MEM_ARENA
+    if (ptr != NULL && arena_find(ptr) != NULL) {   /* Arena memory is released with arena */
+        return;
+    }
+#endif /* GUI_CFG_USE_MEM_ARENA */
+    heap_free(ptr);
 }
 
 /**
@@ -456,9 +1299,101 @@ gui_mem_getminfree(void) {
     return mem_getminfree();                        /* Get minimal number of bytes ever available for allocation */
 }
 
+/**
+ * \brief           Get number of successful allocations since start
+ * \note            Reallocations are counted as new allocations
+ * \return          Number of allocations
+ */
+size_t
+gui_mem_getalloccount(void) {
+    return MemAllocCount;
+}
+
+/**
+ * \brief           Walk all heap blocks in physical order
+ * \note            This function is private and may be called only when OS protection is active
+ * \note            Memory from arenas is reported as single used heap block
+ * \param[in]       fn: Callback function called for each block. Set to `NULL` to only count blocks
+ * \param[in]       arg: Custom user argument passed to callback
+ * \return          Number of walked blocks
+ */
+size_t
+gui_mem_walk(gui_mem_walk_fn fn, void* arg) {
+    size_t i, size, cnt = 0;
+    uint8_t* b, *end;
+    uint8_t used;
+    void* ptr;
+    const char* tag;
+
+    for (i = 0; i < MemRegionsCount; i++) {
+        b = MemRegions[i].start_address;
+        end = b + MemRegions[i].size;
+        while (b < end) {
+            b = mem_walknext(b, &ptr, &size, &used);
+            tag = NULL;
+#if GUI_CFG_MEM_TRACE
+            if (used && size >= TRACE_HDR_SIZE) {
+                tag = *(const char **)ptr;
+                ptr = (uint8_t *)ptr + TRACE_HDR_SIZE;
+                size -= TRACE_HDR_SIZE;
+            }
+#endif /* GUI_CFG_MEM_TRACE */
+            if (fn != NULL) {
+                fn(ptr, size, used, tag, arg);
+            }
+            cnt++;
+        }
+    }
+    return cnt;
+}
+
+/* Walk callback to collect statistics */
+static void
+mem_stat_fn(void* ptr, size_t size, uint8_t used, const char* tag, void* arg) {
+    gui_mem_stat_t* stat = arg;
+
+    GUI_UNUSED2(ptr, tag);
+    if (used) {
+        stat->used_blocks++;
+        stat->used_bytes += size;
+    } else {
+        stat->free_blocks++;
+        stat->free_bytes += size;
+        if (size > stat->largest_free) {
+            stat->largest_free = size;
+        }
+    }
+}
+
+/**
+ * \brief           Get heap usage and fragmentation statistics
+ * \note            This function is private and may be called only when OS protection is active
+ * \note            Function walks entire heap, do not call it on every frame
+ * \param[out]      stat: Pointer to structure to fill
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_mem_getstats(gui_mem_stat_t* stat) {
+    if (stat == NULL) {
+        return 0;
+    }
+    memset(stat, 0x00, sizeof(*stat));
+    gui_mem_walk(mem_stat_fn, stat);
+    if (stat->free_bytes > 0) {
+        stat->fragmentation = (uint8_t)(100 - (uint32_t)((uint64_t)stat->largest_free * 100 / stat->free_bytes));
+    }
+    stat->alloc_count = MemAllocCount;
+    stat->fail_count = MemFailCount;
+    stat->fail_size = MemFailSize;
+    stat->fail_tag = MemFailTag;
+    return 1;
+}
+
 /**
  * \brief           Assign memory region(s) for allocation functions
- * \note            You can allocate multiple regions by assigning start address and region size in units of bytes
+ * \note            You can allocate multiple regions by assigning start address and region size in units of bytes.
+ *                  Classes of region select allocations placed to it first, such as \ref GUI_MEM_CLASS_FAST
+ *                  for tightly coupled memory and \ref GUI_MEM_CLASS_PIXEL for external memory
  * \param[in]       regions: Pointer to list of regions to use for allocations
  * \param[in]       len: Number of regions to use
  * \return          `1` on success, `0` otherwise
@@ -471,3 +1406,337 @@ gui_mem_assignmemory(const gui_mem_region_t* regions, size_t len) {
 
     return ret;                                     
 }
+
+#if GUI_CFG_USE_MEM_ARENA || __DOXYGEN__
+
+/**
+ * \brief           Create new memory arena
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       size: Arena size in units of bytes
+ * \return          Arena handle on success, `NULL` otherwise
+ */
+gui_mem_arena_t*
+gui_mem_arena_create(size_t size) {
+    gui_mem_arena_t* a, *prev;
+    
+    prev = gui_mem_arena_setactive(NULL);           /* Arena itself is always allocated from heap */
+    a = gui_mem_calloc(1, MEM_ALIGN(sizeof(*a)) + size);
+    gui_mem_arena_setactive(prev);
+    if (a != NULL) {
+        a->mem = (uint8_t *)a + MEM_ALIGN(sizeof(*a));
+        a->size = size;
+        a->next = arena_list;
+        arena_list = a;
+    }
+    return a;
+}
+
+/**
+ * \brief           Get number of arena bytes used by single allocation
+ * \param[in]       size: Number of bytes to allocate
+ * \return          Number of bytes taken from arena, used to calculate arena size
+ */
+size_t
+gui_mem_arena_blocksize(size_t size) {
+    return ARENA_HDR_SIZE + MEM_ALIGN(size);
+}
+
+/**
+ * \brief           Set arena used for next allocations
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       arena: Arena to use. Set to `NULL` to allocate from heap
+ * \return          Previously active arena
+ */
+gui_mem_arena_t*
+gui_mem_arena_setactive(gui_mem_arena_t* arena) {
+    gui_mem_arena_t* prev = arena_active;
+    
+    arena_active = arena;
+    return prev;
+}
+
+/**
+ * \brief           Release arena and all memory allocated from it
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       arena: Arena to delete
+ */
+void
+gui_mem_arena_delete(gui_mem_arena_t* arena) {
+    gui_mem_arena_t** a;
+    
+    for (a = &arena_list; *a != NULL; a = &(*a)->next) {
+        if (*a == arena) {
+            *a = arena->next;                       /* Remove from list first, memory is not arena memory anymore */
+            break;
+        }
+    }
+    if (arena_active == arena) {
+        arena_active = NULL;
+    }
+    heap_free(arena);
+}
+
+#endif /* GUI_CFG_USE_MEM_ARENA || __DOXYGEN__ */
+
+#if GUI_CFG_USE_MEM_FRAME || __DOXYGEN__
+
+#define FRAME_HDR_SIZE              MEM_ALIGN(sizeof(size_t))
+
+static uint8_t* FrameMem;                           /* Frame scratch memory, allocated from heap on first use */
+static size_t FrameUsed;                            /* Number of used bytes from start of scratch memory */
+static size_t FrameTop;                             /* Most bytes used during current frame */
+static size_t FrameLast;                            /* Most bytes used during last finished frame */
+static size_t FramePeak;                            /* Most bytes used during any frame */
+static size_t FrameFallback;                        /* Number of buffers allocated from heap instead */
+
+/**
+ * \brief           Allocate temporary buffer from frame scratch memory
+ *
+ *                  Buffer must be released with \ref gui_mem_frame_free before end of current redraw.
+ *                  Space is reused when buffers are released in reverse order of allocation,
+ *                  other released space is reused after \ref gui_mem_frame_reset
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \note            Memory is not cleared. Buffer is allocated from heap when scratch memory is full
+ * \param[in]       size: Number of bytes to allocate
+ * \param[in]       tag: Constant string describing allocation site or `NULL`, used for heap allocation
+ * \return          Allocated memory on success, `NULL` otherwise
+ */
+void*
+gui_mem_frame_alloc(size_t size, const char* tag) {
+    size_t need = FRAME_HDR_SIZE + MEM_ALIGN(size);
+    uint8_t* ptr;
+    
+    if (FrameMem == NULL) {                         /* Scratch memory may be placed to DMA accessible region only */
+        FrameMem = heap_alloc(GUI_CFG_MEM_FRAME_SIZE, 0, GUI_MEM_CLASS_PIXEL, "frame");
+    }
+    if (FrameMem == NULL || (GUI_CFG_MEM_FRAME_SIZE - FrameUsed) < need) {
+        FrameFallback++;
+        return heap_alloc(size, 0, GUI_MEM_CLASS_PIXEL, mem_gettag(tag));
+    }
+    ptr = FrameMem + FrameUsed;
+    *(size_t *)ptr = need;                          /* Save size to release last buffer */
+    FrameUsed += need;
+    if (FrameUsed > FrameTop) {
+        FrameTop = FrameUsed;
+    }
+    MemAllocCount++;
+    return ptr + FRAME_HDR_SIZE;
+}
+
+/**
+ * \brief           Free buffer allocated with \ref gui_mem_frame_alloc
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       ptr: Buffer to free or `NULL`
+ */
+void
+gui_mem_frame_free(void* ptr) {
+    uint8_t* hdr;
+    
+    if (ptr == NULL) {
+        return;
+    }
+    if (FrameMem == NULL || (uint8_t *)ptr < FrameMem || (uint8_t *)ptr >= (FrameMem + GUI_CFG_MEM_FRAME_SIZE)) {
+        gui_mem_free(ptr);                          /* Buffer did not fit to scratch memory */
+        return;
+    }
+    hdr = (uint8_t *)ptr - FRAME_HDR_SIZE;
+    if (hdr + *(size_t *)hdr == FrameMem + FrameUsed) {
+        FrameUsed = (size_t)(hdr - FrameMem);       /* Last buffer, its space is used again */
+    }
+}
+
+/**
+ * \brief           Get maximal size of next frame scratch allocation
+ * \note            This function is private and may be called only when OS protection is active
+ * \return          Number of bytes \ref gui_mem_frame_alloc serves from scratch memory
+ */
+size_t
+gui_mem_frame_getfree(void) {
+    size_t avail = GUI_CFG_MEM_FRAME_SIZE - FrameUsed;
+    
+    return avail > FRAME_HDR_SIZE ? ((avail - FRAME_HDR_SIZE) & ~MEM_ALIGN_BITS) : 0;
+}
+
+/**
+ * \brief           Release all frame scratch memory and save usage of finished frame
+ * \note            This function is private and may be called only when OS protection is active,
+ *                  at the end of redraw when no scratch buffer is in use
+ */
+void
+gui_mem_frame_reset(void) {
+    FrameLast = FrameTop;
+    if (FrameTop > FramePeak) {
+        FramePeak = FrameTop;
+    }
+    FrameUsed = 0;
+    FrameTop = 0;
+}
+
+/**
+ * \brief           Get frame scratch memory statistics
+ * \param[out]      stat: Output statistics
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_mem_frame_getstats(gui_mem_frame_stat_t* stat) {
+    if (stat == NULL) {
+        return 0;
+    }
+    stat->size = FrameMem != NULL ? GUI_CFG_MEM_FRAME_SIZE : 0;
+    stat->used = FrameUsed;
+    stat->last = FrameLast;
+    stat->peak = GUI_MAX(FramePeak, FrameTop);
+    stat->fallback_count = FrameFallback;
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_MEM_FRAME || __DOXYGEN__ */
+
+#if GUI_CFG_USE_MEM_MOVABLE || __DOXYGEN__
+
+/*
+ * Each movable block starts with pointer to its entry in handle table,
+ * user memory follows aligned header. Entry points to user memory and is updated when block moves.
+ */
+#define MOVABLE_HDR_SIZE            MEM_ALIGN(sizeof(void **))
+#define MOVABLE_RAW(h)              ((void *)((uint8_t *)*(h) - MOVABLE_HDR_SIZE))
+#if GUI_CFG_USE_MEM && GUI_CFG_MEM_TRACE
+#define MOVABLE_OFFSET              TRACE_HDR_SIZE  /* Offset of movable header in heap block */
+#else /* GUI_CFG_USE_MEM && GUI_CFG_MEM_TRACE */
+#define MOVABLE_OFFSET              0
+#endif /* !(GUI_CFG_USE_MEM && GUI_CFG_MEM_TRACE) */
+
+static void* MemHandles[GUI_CFG_MEM_MOVABLE_HANDLES];   /* Handle table, `NULL` entries are not used */
+
+/**
+ * \brief           Get handle table entry of heap block
+ * \param[in]       ptr: Memory of heap block as returned by allocator
+ * \param[in]       size: Size of heap block memory
+ * \return          Handle of movable block, `NULL` when block is not movable
+ */
+static gui_mem_handle_t
+movable_gethandle(void* ptr, size_t size) {
+    void** h;
+    
+    if (size < MOVABLE_OFFSET + MOVABLE_HDR_SIZE) {
+        return NULL;
+    }
+    ptr = (uint8_t *)ptr + MOVABLE_OFFSET;
+    h = *(void ***)ptr;
+    if (h >= MemHandles && h < &MemHandles[GUI_CFG_MEM_MOVABLE_HANDLES]
+        && *h == (uint8_t *)ptr + MOVABLE_HDR_SIZE) {   /* Entry must point back to this block */
+        return h;
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Allocate movable memory and set it to zero
+ *
+ *                  Movable memory is accessed through handle, current memory address is `*handle`.
+ *                  Address may change at every \ref gui_mem_compact call,
+ *                  do not save it across calls which may compact heap, such as \ref gui_process
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \note            Movable memory is never allocated from memory arena
+ * \param[in]       size: Number of bytes to allocate
+ * \return          Handle on success, `NULL` otherwise
+ */
+gui_mem_handle_t
+gui_mem_movable_alloc(size_t size) {
+    void* raw;
+    size_t i;
+    
+    for (i = 0; i < GUI_CFG_MEM_MOVABLE_HANDLES && MemHandles[i] != NULL; i++) {}
+    if (i == GUI_CFG_MEM_MOVABLE_HANDLES) {         /* Handle table is full */
+        return NULL;
+    }
+    if ((raw = heap_alloc(MOVABLE_HDR_SIZE + size, 1, GUI_MEM_CLASS_ANY, mem_gettag(NULL))) == NULL) {
+        return NULL;
+    }
+    *(void ***)raw = &MemHandles[i];
+    MemHandles[i] = (uint8_t *)raw + MOVABLE_HDR_SIZE;
+    return &MemHandles[i];
+}
+
+/**
+ * \brief           Resize movable memory, handle stays the same
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       h: Handle returned by \ref gui_mem_movable_alloc
+ * \param[in]       size: Number of bytes to allocate on new memory
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_mem_movable_realloc(gui_mem_handle_t h, size_t size) {
+    void* raw;
+    
+    if (h == NULL || *h == NULL) {
+        return 0;
+    }
+    if ((raw = heap_realloc(MOVABLE_RAW(h), MOVABLE_HDR_SIZE + size, mem_gettag(NULL))) == NULL) {
+        return 0;                                   /* Old memory is still valid */
+    }
+    *h = (uint8_t *)raw + MOVABLE_HDR_SIZE;
+    return 1;
+}
+
+/**
+ * \brief           Free movable memory and its handle
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       h: Handle returned by \ref gui_mem_movable_alloc or `NULL`
+ */
+void
+gui_mem_movable_free(gui_mem_handle_t h) {
+    if (h != NULL && *h != NULL) {
+        heap_free(MOVABLE_RAW(h));
+        *h = NULL;                                  /* Handle may be reused */
+    }
+}
+
+/**
+ * \brief           Move movable blocks down to free blocks before them to merge free memory
+ *
+ *                  Heap is walked in physical order. Each movable block after free block
+ *                  is copied to start of free block, which then merges with free memory after it.
+ *                  Walk is skipped when no block was freed since previous complete walk.
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       max: Maximal number of bytes to copy, used to limit time spent in single call
+ * \return          Number of copied bytes
+ */
+size_t
+gui_mem_compact(size_t max) {
+    size_t i, size, moved = 0;
+    uint8_t *b, *next, *end;
+    uint8_t used, prev_free;
+    gui_mem_handle_t h;
+    void* ptr;
+    
+    if (!MemCompactPending) {
+        return 0;
+    }
+    for (i = 0; i < MemRegionsCount && moved < max; i++) {
+        b = MemRegions[i].start_address;
+        end = b + MemRegions[i].size;
+        prev_free = 0;
+        while (b < end && moved < max) {
+            next = mem_walknext(b, &ptr, &size, &used);
+            if (used && prev_free && (h = movable_gethandle(ptr, size)) != NULL
+                && (b = mem_slide(b)) != NULL) {
+                next = mem_walknext(b, &ptr, &size, &used); /* Free memory is now after block */
+                *h = (uint8_t *)ptr + MOVABLE_OFFSET + MOVABLE_HDR_SIZE;
+                moved += size;
+            } else {
+                prev_free = !used;
+            }
+            b = next;
+        }
+    }
+    if (moved < max) {                              /* Complete heap was walked */
+        MemCompactPending = 0;
+    }
+    return moved;
+}
+
+#endif /* GUI_CFG_USE_MEM_MOVABLE || __DOXYGEN__ */
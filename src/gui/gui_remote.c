@@ -0,0 +1,645 @@
+/**    
+ * \file            gui_remote.c
+ * \brief           Remote display stream
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_remote.h"
+#include "gui/gui_defer.h"
+#include "gui/gui_input.h"
+
+#if GUI_CFG_USE_REMOTE || __DOXYGEN__
+
+#define REMOTE_RUN_MAX              128             /* Maximal number of pixels in single run */
+#define REMOTE_CHUNK_HDR            5               /* Size of chunk header, sync bytes, flags and length */
+#define REMOTE_RX_TOUCH_SIZE        6               /* Size of touch packet from viewer */
+
+/**
+ * \brief           Remote stream state
+ */
+typedef struct {
+    gui_remote_write_fn fn;                         /*!< Transport function, `NULL` when stream is stopped */
+    void* arg;                                      /*!< Custom argument of transport function */
+    gui_display_t rects[GUI_CFG_REMOTE_RECTS];      /*!< Rectangles waiting for encoder */
+    size_t rects_count;                             /*!< Number of waiting rectangles */
+    uint8_t full;                                   /*!< Set to `1` when entire screen is sent with next batch */
+    gui_remote_write_fn capture_fn;                 /*!< Transport function of pending capture, `NULL` when none */
+    void* capture_arg;                              /*!< Custom argument of capture transport function */
+    uint8_t capture_flags;                          /*!< Flags of pending capture, \ref GUI_REMOTE_CAPTURE_RAW */
+    gui_layer_t snap;                               /*!< Snapshot buffer, `start_address` is `NULL` when not used */
+    size_t snap_size;                               /*!< Size of snapshot buffer in units of bytes */
+    
+    /* Batch, owned by encoder while it is busy */
+    volatile uint8_t busy;                          /*!< Set to `1` while encoder reads batch layer */
+    volatile uint8_t failed;                        /*!< Set to `1` by encoder when transport failed */
+    gui_remote_write_fn job_fn;                     /*!< Transport function of batch */
+    void* job_arg;                                  /*!< Custom argument of transport function of batch */
+    gui_display_t job[GUI_CFG_REMOTE_RECTS];        /*!< Rectangles of batch */
+    size_t job_count;                               /*!< Number of rectangles of batch */
+    gui_layer_t* job_layer;                         /*!< Layer pixels are read from */
+    uint8_t job_direct;                             /*!< Set to `1` to read layer memory directly */
+    uint8_t job_capture;                            /*!< Set to `1` when batch is capture */
+    uint8_t job_raw;                                /*!< Set to `1` to send pixels without encoding */
+    uint32_t job_frame;                             /*!< Frame number of layer */
+    gui_dim_t job_width;                            /*!< Screen width */
+    gui_dim_t job_height;                           /*!< Screen height */
+    uint8_t ok;                                     /*!< Set to `0` when transport failed during batch */
+    uint16_t lit[REMOTE_RUN_MAX];                   /*!< Pixels of literal run being collected */
+    size_t lit_count;                               /*!< Number of pixels in literal run */
+    uint8_t buff[GUI_CFG_REMOTE_BUFF_SIZE];         /*!< Chunk header and encoded stream not written yet */
+    size_t buff_len;                                /*!< Number of bytes in stream buffer, including chunk header */
+    uint8_t chunk_flags;                            /*!< Flags of next chunk, \ref GUI_REMOTE_CHUNK_FIRST */
+    uint8_t chunk_seq;                              /*!< Sequence number of next chunk */
+    
+    /* Packet from viewer */
+    uint8_t rx[REMOTE_RX_TOUCH_SIZE];               /*!< Bytes of packet received so far */
+    size_t rx_len;                                  /*!< Number of received bytes */
+} remote_t;
+
+static remote_t remote;
+
+/**
+ * \brief           Write buffered stream to transport as single chunk
+ * \param[in]       last: Set to `1` for last chunk of batch
+ */
+static void
+remote_flush(uint8_t last) {
+    size_t len = remote.buff_len - REMOTE_CHUNK_HDR;
+    
+    if (remote.ok) {
+        remote.buff[0] = GUI_REMOTE_SYNC_0;
+        remote.buff[1] = GUI_REMOTE_SYNC_1;
+        remote.buff[2] = remote.chunk_flags | (last ? GUI_REMOTE_CHUNK_LAST : 0) | (remote.chunk_seq & GUI_REMOTE_CHUNK_SEQ);
+        remote.buff[3] = (uint8_t)len;
+        remote.buff[4] = (uint8_t)(len >> 8);
+        remote.ok = remote.job_fn(remote.buff, remote.buff_len, remote.job_arg);
+        remote.chunk_seq++;                         /* Viewer detects lost chunk by sequence */
+    }
+    remote.chunk_flags = 0;
+    remote.buff_len = REMOTE_CHUNK_HDR;
+}
+
+/**
+ * \brief           Add bytes to stream buffer
+ * \param[in]       data: Bytes to add
+ * \param[in]       len: Number of bytes
+ */
+static void
+remote_put(const uint8_t* data, size_t len) {
+    size_t n;
+    
+    while (len > 0 && remote.ok) {
+        n = GUI_MIN(len, sizeof(remote.buff) - remote.buff_len);
+        memcpy(&remote.buff[remote.buff_len], data, n);
+        remote.buff_len += n;
+        data += n;
+        len -= n;
+        if (remote.buff_len == sizeof(remote.buff)) {
+            remote_flush(0);
+        }
+    }
+}
+
+/**
+ * \brief           Add `16-bit` value to stream buffer
+ * \param[in]       val: Value to add
+ */
+static void
+remote_put16(uint16_t val) {
+    uint8_t b[2];
+    
+    b[0] = (uint8_t)val;
+    b[1] = (uint8_t)(val >> 8);
+    remote_put(b, sizeof(b));
+}
+
+/**
+ * \brief           Add collected literal run to stream
+ */
+static void
+remote_put_literal(void) {
+    uint8_t c;
+    size_t i;
+    
+    if (remote.lit_count > 0) {
+        c = (uint8_t)(remote.lit_count - 1);
+        remote_put(&c, 1);
+        for (i = 0; i < remote.lit_count; i++) {
+            remote_put16(remote.lit[i]);
+        }
+        remote.lit_count = 0;
+    }
+}
+
+/**
+ * \brief           Add run of equal pixels to stream
+ *
+ *                  Single pixels are collected to literal run instead
+ * \param[in]       px: Pixel value
+ * \param[in]       count: Number of pixels, up to \ref REMOTE_RUN_MAX
+ */
+static void
+remote_put_run(uint16_t px, size_t count) {
+    uint8_t c;
+    
+    if (count == 1) {
+        remote.lit[remote.lit_count++] = px;
+        if (remote.lit_count == REMOTE_RUN_MAX) {
+            remote_put_literal();
+        }
+    } else if (count > 1) {
+        remote_put_literal();
+        c = (uint8_t)(0x80 | (count - 1));
+        remote_put(&c, 1);
+        remote_put16(px);
+    }
+}
+
+/**
+ * \brief           Read pixel of batch layer as `RGB565`
+ * \param[in]       x: X position on screen
+ * \param[in]       y: Y position on screen
+ * \return          Pixel value
+ */
+static uint16_t
+remote_getpixel(gui_dim_t x, gui_dim_t y) {
+    gui_layer_t* l = remote.job_layer;
+    size_t off;
+    
+    if (remote.job_direct) {
+        off = (size_t)y * (size_t)l->width + (size_t)x;
+        if (l->pixel_format == GUI_PIXEL_FORMAT_RGB565) {
+            return ((const uint16_t *)l->start_address)[off];
+        }
+        return GUI_COLOR_TO_RGB565(((const uint32_t *)l->start_address)[off]);
+    }
+    return GUI_COLOR_TO_RGB565(GUI_LL(GetPixel)(&GUI.lcd, l, x, y));
+}
+
+/**
+ * \brief           Encode pixels of rectangle to stream
+ * \param[in]       r: Rectangle on screen
+ */
+static void
+remote_put_rect(const gui_display_t* r) {
+    uint8_t c = GUI_REMOTE_PKT_RECT;
+    uint16_t px, run_px = 0;
+    size_t run = 0;
+    gui_dim_t x, y;
+    
+    remote_put(&c, 1);
+    remote_put16((uint16_t)r->x1);
+    remote_put16((uint16_t)r->y1);
+    remote_put16((uint16_t)(r->x2 - r->x1));
+    remote_put16((uint16_t)(r->y2 - r->y1));
+    for (y = r->y1; y < r->y2 && remote.ok; y++) {
+        for (x = r->x1; x < r->x2; x++) {           /* Runs continue over rows of rectangle */
+            px = remote_getpixel(x, y);
+            if (run > 0 && px == run_px && run < REMOTE_RUN_MAX) {
+                run++;
+                continue;
+            }
+            remote_put_run(run_px, run);
+            run_px = px;
+            run = 1;
+        }
+    }
+    remote_put_run(run_px, run);
+    remote_put_literal();
+}
+
+/**
+ * \brief           Put pixels of rectangle to stream without encoding
+ * \param[in]       r: Rectangle on screen
+ */
+static void
+remote_put_rawrect(const gui_display_t* r) {
+    uint8_t c = GUI_REMOTE_PKT_RECT_RAW;
+    gui_dim_t x, y;
+    
+    remote_put(&c, 1);
+    remote_put16((uint16_t)r->x1);
+    remote_put16((uint16_t)r->y1);
+    remote_put16((uint16_t)(r->x2 - r->x1));
+    remote_put16((uint16_t)(r->y2 - r->y1));
+    for (y = r->y1; y < r->y2 && remote.ok; y++) {
+        for (x = r->x1; x < r->x2; x++) {
+            remote_put16(remote_getpixel(x, y));
+        }
+    }
+}
+
+/**
+ * \brief           Encode batch and write it to transport
+ * \note            Deferred work, called without core protection
+ * \param[in]       arg: Unused
+ */
+static void
+remote_encode(void* arg) {
+    uint8_t hdr[9];
+    size_t i;
+    
+    GUI_UNUSED(arg);
+    remote.ok = 1;
+    remote.buff_len = REMOTE_CHUNK_HDR;
+    remote.chunk_flags = GUI_REMOTE_CHUNK_FIRST;
+    remote.lit_count = 0;
+    hdr[0] = GUI_REMOTE_PKT_FRAME;
+    hdr[1] = (uint8_t)remote.job_width;
+    hdr[2] = (uint8_t)(remote.job_width >> 8);
+    hdr[3] = (uint8_t)remote.job_height;
+    hdr[4] = (uint8_t)(remote.job_height >> 8);
+    hdr[5] = (uint8_t)remote.job_frame;
+    hdr[6] = (uint8_t)(remote.job_frame >> 8);
+    hdr[7] = (uint8_t)(remote.job_frame >> 16);
+    hdr[8] = (uint8_t)(remote.job_frame >> 24);
+    remote_put(hdr, sizeof(hdr));
+    for (i = 0; i < remote.job_count && remote.ok; i++) {
+        if (remote.job_raw) {
+            remote_put_rawrect(&remote.job[i]);
+        } else {
+            remote_put_rect(&remote.job[i]);
+        }
+    }
+    hdr[0] = GUI_REMOTE_PKT_END;
+    remote_put(hdr, 1);
+    remote_flush(1);
+    
+    if (remote.job_capture) {
+        remote.job_fn(NULL, 0, remote.job_arg);     /* Tell capture is finished */
+    } else if (!remote.ok) {
+        remote.failed = 1;                          /* Viewer lost part of stream, send entire screen next time */
+    }
+    remote.busy = 0;                                /* Layer may be drawn again */
+#if GUI_CFG_OS
+    guii_wakeup(GUI_SYS_WAKEUP_WIDGET);             /* Wakeup GUI thread to draw held frame or send next batch */
+#endif /* GUI_CFG_OS */
+}
+
+/**
+ * \brief           Add rectangle to list waiting for encoder
+ * \param[in]       rect: Rectangle on screen
+ */
+static void
+remote_addrect(const gui_display_t* rect) {
+    gui_display_t r;
+    gui_display_t* e;
+    uint32_t grow, best_grow = 0;
+    size_t i, best = 0;
+    
+    r.x1 = GUI_MAX(rect->x1, 0);
+    r.y1 = GUI_MAX(rect->y1, 0);
+    r.x2 = GUI_MIN(rect->x2, GUI.lcd.width);
+    r.y2 = GUI_MIN(rect->y2, GUI.lcd.height);
+    if (r.x1 >= r.x2 || r.y1 >= r.y2 || remote.full) {
+        return;
+    }
+    for (i = 0; i < remote.rects_count; i++) {
+        e = &remote.rects[i];
+        if (GUI_RECT_MATCH(e->x1, e->y1, e->x2, e->y2, r.x1, r.y1, r.x2, r.y2)) {
+            break;                                  /* Touching rectangles are merged */
+        }
+    }
+    if (i == remote.rects_count) {
+        if (remote.rects_count < GUI_CFG_REMOTE_RECTS) {
+            remote.rects[remote.rects_count++] = r;
+            return;
+        }
+        for (i = 0; i < remote.rects_count; i++) {  /* List is full, merge with rectangle growing least */
+            e = &remote.rects[i];
+            grow = (uint32_t)(GUI_MAX(e->x2, r.x2) - GUI_MIN(e->x1, r.x1)) * (uint32_t)(GUI_MAX(e->y2, r.y2) - GUI_MIN(e->y1, r.y1))
+                    - (uint32_t)(e->x2 - e->x1) * (uint32_t)(e->y2 - e->y1);
+            if (i == 0 || grow < best_grow) {
+                best_grow = grow;
+                best = i;
+            }
+        }
+        i = best;
+    }
+    e = &remote.rects[i];
+    e->x1 = GUI_MIN(e->x1, r.x1);
+    e->y1 = GUI_MIN(e->y1, r.y1);
+    e->x2 = GUI_MAX(e->x2, r.x2);
+    e->y2 = GUI_MAX(e->y2, r.y2);
+}
+
+/**
+ * \brief           Set layer pixels of batch are read from
+ *
+ *                  When snapshot buffer is set, rectangles of batch are copied to it with low-level `Copy`
+ *                  and layer may be drawn again before batch is encoded
+ * \param[in]       layer: Layer with newest finished frame
+ */
+static void
+remote_setlayer(gui_layer_t* layer) {
+    size_t i, ps = layer->pixel_format == GUI_PIXEL_FORMAT_RGB565 ? 2 : 4;
+    const gui_display_t* r;
+    
+    remote.job_layer = layer;
+    remote.job_direct = layer->start_address != NULL;
+#if GUI_CFG_USE_LCD_ROTATION
+    if (GUI.lcd.orientation) {
+        remote.job_direct = 0;                      /* Layer memory is in physical orientation */
+    }
+#endif /* GUI_CFG_USE_LCD_ROTATION */
+    if (!remote.job_direct || remote.snap.start_address == NULL || !GUI_LL_ISSET(Copy)
+        || remote.snap_size < ps * (size_t)GUI.lcd.width * (size_t)GUI.lcd.height) {
+        return;
+    }
+    remote.snap.pixel_format = layer->pixel_format;
+    remote.snap.width = GUI.lcd.width;
+    remote.snap.height = GUI.lcd.height;
+    for (i = 0; i < remote.job_count; i++) {
+        r = &remote.job[i];
+        GUI_LL(Copy)(&GUI.lcd, &remote.snap,
+            (uint8_t *)remote.snap.start_address + ps * ((size_t)r->y1 * (size_t)remote.snap.width + (size_t)r->x1),
+            (const uint8_t *)layer->start_address + ps * ((size_t)r->y1 * (size_t)layer->width + (size_t)r->x1),
+            r->x2 - r->x1, r->y2 - r->y1, remote.snap.width - (r->x2 - r->x1), layer->width - (r->x2 - r->x1));
+    }
+    gui_lcd_fence();                                /* Copy may be done by hardware */
+    remote.job_layer = &remote.snap;
+}
+
+/**
+ * \brief           Post pending capture or waiting rectangles to encoder when it is idle
+ *
+ *                  Pixels are read from newest finished frame, as frames are drawn to other layers
+ * \note            Function must be called with core protection
+ */
+static void
+remote_post(void) {
+    gui_layer_t* layer = GUI.lcd.active_layer;
+    
+    if (remote.busy || layer == NULL) {
+        return;
+    }
+    if (remote.capture_fn != NULL) {                /* Capture goes before stream, its rectangles are kept */
+        remote.job[0].x1 = 0;
+        remote.job[0].y1 = 0;
+        remote.job[0].x2 = GUI.lcd.width;
+        remote.job[0].y2 = GUI.lcd.height;
+        remote.job_count = 1;
+        remote.job_fn = remote.capture_fn;
+        remote.job_arg = remote.capture_arg;
+        remote.job_capture = 1;
+        remote.job_raw = (remote.capture_flags & GUI_REMOTE_CAPTURE_RAW) ? 1 : 0;
+    } else {
+        if (remote.fn == NULL) {
+            return;
+        }
+        if (remote.failed) {
+            remote.failed = 0;
+            remote.full = 1;
+        }
+        if (remote.full) {
+            remote.rects[0].x1 = 0;
+            remote.rects[0].y1 = 0;
+            remote.rects[0].x2 = GUI.lcd.width;
+            remote.rects[0].y2 = GUI.lcd.height;
+            remote.rects_count = 1;
+        } else if (!remote.rects_count) {
+            return;
+        }
+        memcpy(remote.job, remote.rects, sizeof(remote.rects[0]) * remote.rects_count);
+        remote.job_count = remote.rects_count;
+        remote.job_fn = remote.fn;
+        remote.job_arg = remote.arg;
+        remote.job_capture = 0;
+        remote.job_raw = 0;
+    }
+    remote.job_frame = layer->frame;
+    remote.job_width = GUI.lcd.width;
+    remote.job_height = GUI.lcd.height;
+    remote_setlayer(layer);
+    
+    remote.busy = 1;
+    if (gui_defer(remote_encode, NULL)) {
+        if (remote.job_capture) {
+            remote.capture_fn = NULL;
+        } else {
+            remote.rects_count = 0;
+            remote.full = 0;
+        }
+    } else {
+        remote.busy = 0;                            /* Queue is full, try again on next processing */
+    }
+}
+
+/**
+ * \brief           Start remote stream
+ *
+ *                  Entire screen is sent first, then dirty rectangles of each finished frame
+ * \note            Transport function is called by deferred work without core protection,
+ *                  it may block until data are written
+ * \param[in]       fn: Transport function
+ * \param[in]       arg: Custom argument passed to transport function
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_remote_start(gui_remote_write_fn fn, void* arg) {
+    GUI_ASSERTPARAMS(fn != NULL);
+    
+    GUI_CORE_PROTECT(1);
+    remote.fn = fn;
+    remote.arg = arg;
+    remote.rects_count = 0;
+    remote.full = 1;
+    remote_post();
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+}
+
+/**
+ * \brief           Stop remote stream
+ * \note            Batch being encoded is still written to transport function
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_remote_stop(void) {
+    GUI_CORE_PROTECT(1);
+    remote.fn = NULL;
+    remote.rects_count = 0;
+    remote.full = 0;
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+}
+
+/**
+ * \brief           Send entire screen with next batch
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_remote_refresh(void) {
+    GUI_CORE_PROTECT(1);
+    remote.full = 1;
+    remote_post();
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+}
+
+/**
+ * \brief           Capture entire screen
+ *
+ *                  Newest finished frame is encoded by deferred work and written to transport function
+ *                  as single batch of remote stream, core protection is not held while it is written.
+ *                  When batch is written, transport function is called once more with `NULL` data and `0` length
+ * \note            Without snapshot buffer, see \ref gui_remote_setsnapshot,
+ *                  next frame to be drawn on captured layer waits until capture is encoded
+ * \param[in]       fn: Transport function of capture
+ * \param[in]       arg: Custom argument passed to transport function
+ * \param[in]       flags: Capture flags, \ref GUI_REMOTE_CAPTURE_RAW, or `0` for run-length encoded pixels
+ * \return          `1` on success, `0` if other capture is pending
+ */
+uint8_t
+gui_remote_capture(gui_remote_write_fn fn, void* arg, uint8_t flags) {
+    uint8_t ret = 0;
+    
+    GUI_ASSERTPARAMS(fn != NULL);
+    
+    GUI_CORE_PROTECT(1);
+    if (remote.capture_fn == NULL && !(remote.busy && remote.job_capture)) {
+        remote.capture_fn = fn;
+        remote.capture_arg = arg;
+        remote.capture_flags = flags;
+        remote_post();
+        ret = 1;
+    }
+    GUI_CORE_UNPROTECT(1);
+    return ret;
+}
+
+/**
+ * \brief           Set buffer for snapshot of encoded rectangles
+ *
+ *                  Rectangles of each batch are copied from layer to buffer with low-level `Copy` right after frame.
+ *                  Encoder then reads buffer and layers are never held for it
+ * \param[in]       mem: Buffer for entire screen in pixel format of layers, `NULL` to read layers directly
+ * \param[in]       size: Size of buffer in units of bytes
+ * \return          `1` on success, `0` if buffer is too small or encoder is busy
+ */
+uint8_t
+gui_remote_setsnapshot(void* mem, size_t size) {
+    uint8_t ret = 0;
+    
+    GUI_CORE_PROTECT(1);
+    if (!remote.busy && (mem == NULL || size >= (size_t)GUI.lcd.pixel_size * (size_t)GUI.lcd.width * (size_t)GUI.lcd.height)) {
+        remote.snap.start_address = mem;
+        remote.snap_size = mem != NULL ? size : 0;
+        ret = 1;
+    }
+    GUI_CORE_UNPROTECT(1);
+    return ret;
+}
+
+/**
+ * \brief           Process packets received from viewer
+ *
+ *                  Touch is added to input buffer with \ref gui_input_touchadd.
+ *                  Packets may be split over multiple calls
+ * \note            Function may be called from single thread only
+ * \param[in]       data: Received bytes
+ * \param[in]       len: Number of received bytes
+ * \return          `1` on success, `0` if touch could not be added
+ */
+uint8_t
+gui_remote_receive(const void* data, size_t len) {
+    const uint8_t* d = data;
+    uint8_t ret = 1;
+    
+    GUI_ASSERTPARAMS(data != NULL || !len);
+    for (; len > 0; len--, d++) {
+        if (!remote.rx_len) {
+            if (*d == GUI_REMOTE_PKT_TOUCH) {
+                remote.rx[remote.rx_len++] = *d;
+            } else if (*d == GUI_REMOTE_PKT_REFRESH) {
+                gui_remote_refresh();
+            }                                       /* Unknown bytes are skipped */
+            continue;
+        }
+        remote.rx[remote.rx_len++] = *d;
+        if (remote.rx_len == REMOTE_RX_TOUCH_SIZE) {
+#if GUI_CFG_USE_TOUCH
+            gui_touch_data_t ts;
+            
+            memset(&ts, 0x00, sizeof(ts));
+            ts.status = remote.rx[1] ? GUI_TOUCH_STATE_PRESSED : GUI_TOUCH_STATE_RELEASED;
+            ts.count = remote.rx[1] ? 1 : 0;
+            ts.x[0] = (gui_dim_t)(remote.rx[2] | (remote.rx[3] << 8));
+            ts.y[0] = (gui_dim_t)(remote.rx[4] | (remote.rx[5] << 8));
+            if (!gui_input_touchadd(&ts)) {
+                ret = 0;
+            }
+#endif /* GUI_CFG_USE_TOUCH */
+            remote.rx_len = 0;
+        }
+    }
+    return ret;
+}
+
+/**
+ * \brief           Add dirty rectangles of finished frame to stream
+ * \note            This function is private and must be called with core protection after layer swap
+ * \param[in]       layer: Layer with finished frame
+ */
+void
+guii_remote_frame(gui_layer_t* layer) {
+    size_t i;
+    
+    if (remote.fn == NULL) {
+        return;
+    }
+    for (i = 0; i < layer->regions_count; i++) {
+        remote_addrect(&layer->regions[i]);
+    }
+    remote_post();
+}
+
+/**
+ * \brief           Post rectangles left while encoder was busy
+ * \note            This function is private and must be called with core protection
+ */
+void
+guii_remote_process(void) {
+    remote_post();
+}
+
+/**
+ * \brief           Check if encoder reads layer
+ * \param[in]       layer: Layer to check
+ * \return          `1` when layer must not be drawn, `0` otherwise
+ */
+uint8_t
+guii_remote_reading(const gui_layer_t* layer) {
+    return remote.busy && remote.job_layer == layer;
+}
+
+#endif /* GUI_CFG_USE_REMOTE || __DOXYGEN__ */
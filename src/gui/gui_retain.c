@@ -0,0 +1,343 @@
+/**    
+ * \file            gui_retain.c
+ * \brief           Character and image cache in retained memory
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_retain.h"
+
+#if GUI_CFG_USE_CACHE_RETAIN || __DOXYGEN__
+
+#define RETAIN_MAGIC                0x4E544552UL    /* Region header marker, "RETN" */
+#define RETAIN_VERSION              1               /* Version of region format */
+#define RETAIN_DEAD                 ((uint32_t)0x80)/* Record type flag, entry was removed from cache */
+
+/* Number of bytes reserved for record header before entry */
+#define RETAIN_RECORD_SIZE          GUI_MEM_ALIGN(sizeof(retain_record_t))
+
+/* Layout of cache entries, region from build with different layout is not used */
+#define RETAIN_LAYOUT               ((uint32_t)sizeof(gui_font_charentry_t) | ((uint32_t)sizeof(gui_image_cacheentry_t) << 12) | ((uint32_t)GUI_CFG_MEM_ALIGNMENT << 24))
+
+/**
+ * \brief           Header at the beginning of retained region
+ */
+typedef struct {
+    uint32_t magic;                                 /*!< Region marker, set to \ref RETAIN_MAGIC */
+    uint32_t version;                               /*!< Region format version */
+    uint32_t layout;                                /*!< Layout of cache entries */
+    uint32_t id;                                    /*!< Application identity */
+    size_t base;                                    /*!< Address of region when it was formatted */
+    size_t size;                                    /*!< Number of bytes available for records */
+    size_t used;                                    /*!< Number of bytes used by committed records */
+    uint32_t check;                                 /*!< Checksum of fields above */
+} retain_header_t;
+
+/**
+ * \brief           Header of each entry in region
+ */
+typedef struct {
+    uint32_t type;                                  /*!< Entry type, `GUI_RETAIN_*` value with optional \ref RETAIN_DEAD flag */
+    size_t size;                                    /*!< Number of bytes used by record, including this header */
+    uint32_t ident;                                 /*!< Identity hash of font character or image descriptor */
+    uint32_t check;                                 /*!< Checksum of entry key and data */
+} retain_record_t;
+
+static retain_header_t* retain;                     /* Region header, `NULL` when region is not assigned */
+static uint8_t* retain_data;                        /* Start of records, right after header */
+static retain_record_t* retain_pending;             /* Record allocated but not committed yet */
+static size_t retain_live;                          /* Number of committed records used by caches */
+
+/**
+ * \brief           Update FNV-1a hash with block of memory
+ * \param[in]       h: Hash value to update
+ * \param[in]       data: Data to process
+ * \param[in]       len: Number of bytes
+ * \return          Updated hash value
+ */
+static uint32_t
+retain_hash(uint32_t h, const void* data, size_t len) {
+    const uint8_t* d = data;
+    
+    for (; len >= 4; len -= 4, d += 4) {            /* Process words, data are aligned */
+        h = (h ^ *(const uint32_t *)d) * 16777619UL;
+    }
+    for (; len > 0; len--, d++) {
+        h = (h ^ *d) * 16777619UL;
+    }
+    return h;
+}
+
+/**
+ * \brief           Update header checksum after change
+ */
+static void
+retain_header_update(void) {
+    retain->check = retain_hash(2166136261UL, retain, offsetof(retain_header_t, check));
+}
+
+/**
+ * \brief           Get checksum of entry key and data
+ * \note            Entry pointers are covered without reading memory they point to
+ * \param[in]       rec: Record to calculate checksum for
+ * \return          Checksum value
+ */
+static uint32_t
+retain_check(const retain_record_t* rec) {
+    const uint8_t* entry = (const uint8_t *)rec + RETAIN_RECORD_SIZE;
+    size_t key[3], memsize, hdr;
+    uint32_t h;
+    
+    if ((rec->type & ~RETAIN_DEAD) == GUI_RETAIN_CHAR) {
+        const gui_font_charentry_t* e = (const void *)entry;
+        key[0] = (size_t)e->font;
+        key[1] = (size_t)e->ch;
+        memsize = e->memsize;
+        hdr = GUI_MEM_ALIGN(sizeof(*e));
+    } else {
+        const gui_image_cacheentry_t* e = (const void *)entry;
+        key[0] = (size_t)e->src;
+        key[1] = 0;
+        memsize = e->memsize;
+        hdr = GUI_MEM_ALIGN(sizeof(*e));
+    }
+    key[2] = memsize;
+    h = retain_hash(2166136261UL, key, sizeof(key));
+    if (memsize < hdr || memsize > rec->size - RETAIN_RECORD_SIZE) {
+        return ~h;                                  /* Invalid size, data are not read */
+    }
+    return retain_hash(h, entry + hdr, memsize - hdr);
+}
+
+/**
+ * \brief           Get identity hash of font character or image entry was created from
+ * \note            Descriptors are read, function may only be called for entry with valid checksum
+ * \param[in]       rec: Record to calculate identity for
+ * \return          Identity hash
+ */
+static uint32_t
+retain_ident(const retain_record_t* rec) {
+    const uint8_t* entry = (const uint8_t *)rec + RETAIN_RECORD_SIZE;
+    size_t key[8];
+    
+    memset(key, 0x00, sizeof(key));
+    if ((rec->type & ~RETAIN_DEAD) == GUI_RETAIN_CHAR) {
+        const gui_font_charentry_t* e = (const void *)entry;
+        key[0] = (size_t)e->font->flags;
+        key[1] = (size_t)e->font->size;
+        key[2] = (size_t)e->font->read;
+        key[3] = (size_t)e->ch->x_size;
+        key[4] = (size_t)e->ch->y_size;
+        key[5] = (size_t)e->ch->data;
+    } else {
+        const gui_image_desc_t* img = ((const gui_image_cacheentry_t *)(const void *)entry)->src;
+        key[0] = ((size_t)img->x_size << 16) | (size_t)img->y_size;
+        key[1] = ((size_t)img->bpp << 16) | ((size_t)img->compression << 8) | img->flags;
+        key[2] = (size_t)img->image;
+        key[3] = (size_t)img->read;
+        key[4] = img->size;
+        key[5] = (size_t)img->stride;
+        key[6] = (size_t)img->palette;
+        key[7] = (size_t)img->tiles;
+    }
+    return retain_hash(2166136261UL, key, sizeof(key));
+}
+
+/**
+ * \brief           Adopt valid records of region to caches
+ * \return          Number of adopted entries
+ */
+static size_t
+retain_adopt(void) {
+    retain_record_t* rec;
+    size_t off, cnt = 0;
+    uint8_t ok;
+    
+    for (off = 0; off < retain->used; off += rec->size) {
+        rec = (retain_record_t *)(retain_data + off);
+        if (rec->size < RETAIN_RECORD_SIZE || GUI_MEM_ALIGN(rec->size) != rec->size || rec->size > retain->used - off) {
+            break;                                  /* Broken chain, following records cannot be found */
+        }
+        if (rec->type & RETAIN_DEAD) {
+            continue;
+        }
+        ok = 0;
+        if ((rec->type == GUI_RETAIN_CHAR || rec->type == GUI_RETAIN_IMAGE)
+            && rec->check == retain_check(rec) && rec->ident == retain_ident(rec)) {
+            if (rec->type == GUI_RETAIN_CHAR) {
+                ok = guii_text_cacheadopt((gui_font_charentry_t *)((uint8_t *)rec + RETAIN_RECORD_SIZE));
+#if GUI_CFG_USE_IMAGE_CACHE
+            } else {
+                ok = guii_draw_image_cacheadopt((gui_image_cacheentry_t *)((uint8_t *)rec + RETAIN_RECORD_SIZE));
+#endif /* GUI_CFG_USE_IMAGE_CACHE */
+            }
+        }
+        if (ok) {
+            cnt++;
+        } else {
+            rec->type |= RETAIN_DEAD;               /* Entry does not belong to this application anymore */
+        }
+    }
+    retain->used = off;                             /* Records after broken one are ignored */
+    retain_live = cnt;
+    if (!retain_live) {
+        retain->used = 0;                           /* Nothing to keep, start over */
+    }
+    retain_header_update();
+    return cnt;
+}
+
+/**
+ * \brief           Assign retained memory region for character and image cache
+ *
+ *                  When region holds valid content of previous run with the same identity,
+ *                  its entries are adopted to caches. Otherwise region is formatted.
+ *
+ * \note            Function must be called after \ref gui_init, before anything is drawn.
+ *                  Region must be at the same address after reset
+ * \param[in]       mem: Region start address. Memory must keep its content over reset
+ * \param[in]       size: Region size in units of bytes
+ * \param[in]       id: Application identity, such as firmware build checksum.
+ *                      Entries point to fonts and images of application, region of other build must never be adopted
+ * \return          Number of adopted entries
+ */
+size_t
+gui_retain_setregion(void* mem, size_t size, uint32_t id) {
+    size_t cnt = 0, pad;
+    
+    GUI_ASSERTPARAMS(mem != NULL);
+    pad = GUI_MEM_ALIGN((size_t)mem) - (size_t)mem;
+    GUI_ASSERTPARAMS(size > pad + GUI_MEM_ALIGN(sizeof(retain_header_t)) + RETAIN_RECORD_SIZE);
+    
+    GUI_CORE_PROTECT(1);
+    retain = (retain_header_t *)((uint8_t *)mem + pad);
+    retain_data = (uint8_t *)retain + GUI_MEM_ALIGN(sizeof(retain_header_t));
+    retain_pending = NULL;
+    size = (size - pad - GUI_MEM_ALIGN(sizeof(retain_header_t))) & ~(size_t)(GUI_CFG_MEM_ALIGNMENT - 1);
+    if (retain->magic == RETAIN_MAGIC && retain->version == RETAIN_VERSION && retain->layout == RETAIN_LAYOUT
+        && retain->id == id && retain->base == (size_t)retain && retain->size == size && retain->used <= size
+        && retain->check == retain_hash(2166136261UL, retain, offsetof(retain_header_t, check))) {
+        cnt = retain_adopt();
+    } else {
+        retain->magic = RETAIN_MAGIC;               /* Format region */
+        retain->version = RETAIN_VERSION;
+        retain->layout = RETAIN_LAYOUT;
+        retain->id = id;
+        retain->base = (size_t)retain;
+        retain->size = size;
+        retain->used = 0;
+        retain_live = 0;
+        retain_header_update();
+    }
+    GUI_CORE_UNPROTECT(1);
+    return cnt;
+}
+
+/**
+ * \brief           Allocate cache entry in retained region
+ * \note            This function is private and may be called only when GUI is protected.
+ *                  Entry is not kept over reset until \ref guii_retain_commit is called
+ * \param[in]       type: Entry type, `GUI_RETAIN_*` value
+ * \param[in]       memsize: Number of bytes for entry including data
+ * \return          Zeroed entry memory on success, `NULL` when region is not assigned or full
+ */
+void*
+guii_retain_alloc(uint8_t type, size_t memsize) {
+    retain_record_t* rec;
+    size_t need;
+    
+    if (retain == NULL || retain_pending != NULL) {
+        return NULL;
+    }
+    need = RETAIN_RECORD_SIZE + GUI_MEM_ALIGN(memsize);
+    if (need > retain->size - retain->used) {
+        return NULL;
+    }
+    rec = (retain_record_t *)(retain_data + retain->used);
+    memset(rec, 0x00, need);
+    rec->type = type;
+    rec->size = need;
+    retain_pending = rec;
+    return (uint8_t *)rec + RETAIN_RECORD_SIZE;
+}
+
+/**
+ * \brief           Keep filled entry over reset
+ * \note            This function is private and may be called only when GUI is protected.
+ *                  Entry allocated from heap is ignored
+ * \param[in]       entry: Entry allocated with \ref guii_retain_alloc, added to cache
+ */
+void
+guii_retain_commit(void* entry) {
+    retain_record_t* rec;
+    
+    if (retain_pending == NULL || entry != (uint8_t *)retain_pending + RETAIN_RECORD_SIZE) {
+        return;
+    }
+    rec = retain_pending;
+    rec->check = retain_check(rec);
+    rec->ident = retain_ident(rec);
+    retain->used += rec->size;                      /* Record is complete, make it visible after reset */
+    retain_pending = NULL;
+    retain_live++;
+    retain_header_update();
+}
+
+/**
+ * \brief           Release cache entry if it is placed in retained region
+ * \note            This function is private and may be called only when GUI is protected
+ * \param[in]       entry: Cache entry to release
+ * \return          `1` if entry is in region and must not be freed to heap, `0` otherwise
+ */
+uint8_t
+guii_retain_free(void* entry) {
+    retain_record_t* rec;
+    
+    if (retain == NULL || (uint8_t *)entry < retain_data || (uint8_t *)entry >= retain_data + retain->size) {
+        return 0;
+    }
+    rec = (retain_record_t *)((uint8_t *)entry - RETAIN_RECORD_SIZE);
+    if (rec == retain_pending) {                    /* Not committed, space is reused by next allocation */
+        retain_pending = NULL;
+        return 1;
+    }
+    if (!(rec->type & RETAIN_DEAD)) {
+        rec->type |= RETAIN_DEAD;
+        retain_live--;
+    }
+    if (!retain_live && retain_pending == NULL) {
+        retain->used = 0;                           /* All entries removed, reuse complete region */
+    }
+    retain_header_update();
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_CACHE_RETAIN || __DOXYGEN__ */
@@ -234,6 +234,14 @@ gui_string_getch(gui_string_t* const s, uint32_t* const out, uint8_t* const len)
     if (s == NULL || s->str == NULL || !*s->str) {  /* End of string check */
         return 0;
     }
+    if (!s->s.r && *s->str < 0x80) {        /* ASCII character, skip decoder */
+        *out = s->s.res = *s->str++;
+        s->s.t = 1;
+        if (len) {
+            *len = 1;
+        }
+        return 1;
+    }
     
     while (*s->str) {                       /* Check all characters */
         r = gui_string_unicode_decode(&s->s, *s->str++);    /* Try to decode string */
@@ -259,6 +267,53 @@ gui_string_getch(gui_string_t* const s, uint32_t* const out, uint8_t* const len)
 #endif /* GUI_CFG_USE_UNICODE */  
 }
 
+/**
+ * \brief           Get multiple decoded characters from source string
+ *
+ *                  Runs of ASCII characters are detected `4` bytes at a time, other characters
+ *                  are decoded with \ref gui_string_getch.
+ *
+ * \param[in,out]   s: Pointer to \ref gui_string_t structure with input string
+ * \param[out]      out: Output array for decoded characters
+ * \param[in]       count: Maximal number of characters to decode
+ * \return          Number of decoded characters, `0` at the end of string
+ */
+size_t
+gui_string_getchars(gui_string_t* const s, uint32_t* const out, size_t count) {
+    size_t n = 0;
+    
+    if (s == NULL || s->str == NULL) {
+        return 0;
+    }
+#if GUI_CFG_USE_UNICODE
+    while (n < count) {
+        if (!s->s.r && (count - n) >= 4 && !((size_t)s->str & 0x03)) {
+            uint32_t w;
+            
+            memcpy(&w, s->str, sizeof(w));  /* Aligned word never crosses end of memory region */
+            if (!((w | ((w - 0x01010101UL) & ~w)) & 0x80808080UL)) {   /* No byte with top bit set or zero */
+                out[n++] = s->str[0];
+                out[n++] = s->str[1];
+                out[n++] = s->str[2];
+                out[n++] = s->s.res = s->str[3];
+                s->str += 4;
+                s->s.t = 1;
+                continue;
+            }
+        }
+        if (!gui_string_getch(s, &out[n], NULL)) {
+            break;
+        }
+        n++;
+    }
+#else /* GUI_CFG_USE_UNICODE */
+    while (n < count && *s->str) {
+        out[n++] = *s->str++;
+    }
+#endif /* !GUI_CFG_USE_UNICODE */
+    return n;
+}
+
 /**
  * \brief           Get character by character from end of string up
  * \note            Functionality is the same as \ref gui_string_getch except order is swapped
@@ -338,6 +393,75 @@ gui_string_gotoend(gui_string_t* const str) {
     return 1;
 }
 
+/**
+ * \brief           Format integer or fixed-point number to string without `sprintf`
+ *
+ *                  Only integer arithmetic is used, number `-1234` with `2` decimals is formatted as `-12.34`
+ *
+ * \param[out]      dst: Output string
+ * \param[in]       len: Size of output memory in units of \ref gui_char, including string termination
+ * \param[in]       value: Value to format
+ * \param[in]       fmt: Number format. Set to `NULL` to format plain integer
+ * \return          Length of output string, `0` if output memory is too small
+ */
+size_t
+gui_string_fromnumber(gui_char* const dst, size_t len, int32_t value, const gui_string_numberformat_t* const fmt) {
+    gui_char tmp[16];
+    uint32_t u;
+    size_t n = 0, pad, total, k = 0, slen;
+    uint8_t decimals = 0, width = 0, flags = 0, sign = 0;
+    
+    if (dst == NULL || !len) {
+        return 0;
+    }
+    if (fmt != NULL) {
+        decimals = GUI_MIN(fmt->decimals, 9);
+        width = fmt->width;
+        flags = fmt->flags;
+    }
+    u = value < 0 ? (0U - (uint32_t)value) : (uint32_t)value;
+    do {                                            /* Write digits in reverse order */
+        tmp[n++] = (gui_char)('0' + (u % 10));
+        u /= 10;
+        if (n == decimals) {
+            tmp[n++] = '.';                         /* Decimal point after fractional digits */
+        }
+    } while (u > 0 || n <= (size_t)decimals + (decimals ? 1 : 0));   /* At least one integer digit */
+    if (value < 0) {
+        sign = '-';
+    } else if (flags & GUI_STRING_NUMBER_PLUS) {
+        sign = '+';
+    }
+    
+    total = n + (sign ? 1 : 0);
+    pad = width > total ? (width - total) : 0;
+    slen = fmt != NULL && fmt->suffix != NULL ? gui_string_lengthtotal(fmt->suffix) : 0;
+    if ((total + pad + slen) >= len) {              /* Check memory for string and termination */
+        dst[0] = 0;
+        return 0;
+    }
+    if (!(flags & GUI_STRING_NUMBER_ZEROPAD)) {     /* Spaces are before sign */
+        for (; pad > 0; pad--) {
+            dst[k++] = ' ';
+        }
+    }
+    if (sign) {
+        dst[k++] = sign;
+    }
+    for (; pad > 0; pad--) {                        /* Zeros are after sign */
+        dst[k++] = '0';
+    }
+    while (n > 0) {
+        dst[k++] = tmp[--n];
+    }
+    if (slen) {
+        memcpy(&dst[k], fmt->suffix, slen * sizeof(*dst));
+        k += slen;
+    }
+    dst[k] = 0;
+    return k;
+}
+
 /**
  * \brief           Check if character is printable
  * \param[in]       ch: First memory address
@@ -39,15 +39,280 @@
 #define CH_WS                       GUI_KEY_WS
 #define get_char_from_value(ch)     (uint32_t)((CH_CR == (ch) || CH_LF == (ch)) ? CH_WS : (ch))
 
+#define FONT_CACHE_MASK             ((size_t)(GUI_CFG_FONT_CACHE_HASH_SIZE - 1))
+#define FONT_CACHE_MAX_COUNT        ((size_t)(GUI_CFG_FONT_CACHE_HASH_SIZE - (GUI_CFG_FONT_CACHE_HASH_SIZE >> 2)))
+
+#if (GUI_CFG_FONT_CACHE_HASH_SIZE & (GUI_CFG_FONT_CACHE_HASH_SIZE - 1)) || GUI_CFG_FONT_CACHE_HASH_SIZE < 4
+#error "GUI_CFG_FONT_CACHE_HASH_SIZE must be power of 2 and at least 4"
+#endif
+
+#if GUI_CFG_TEXT_SUBPIXEL_POSITIONS < 1 || GUI_CFG_TEXT_SUBPIXEL_POSITIONS > 16
+#error "GUI_CFG_TEXT_SUBPIXEL_POSITIONS must be between 1 and 16"
+#endif
+
+/**
+ * \brief           Get hash table start slot for font and character pair
+ * \param[in]       font: Font used for character, or vector icon
+ * \param[in]       c: Character info handle, or icon height
+ * \return          Slot index in hash table
+ */
+GUI_CFG_FAST_CODE static size_t
+font_cache_hash(const void* font, const void* c) {
+    uint32_t h;
+    
+    h = (uint32_t)((size_t)font >> 2) * 31U ^ (uint32_t)((size_t)c >> 2);
+    h *= 0x9E3779B1UL;                              /* Spread bits using golden ratio multiplier */
+    return (size_t)(h >> 16) & FONT_CACHE_MASK;
+}
+
+/**
+ * \brief           Get hash table start slot for existing entry
+ * \param[in]       entry: Cached entry
+ * \return          Slot index in hash table
+ */
+static size_t
+font_cache_entryhash(const gui_font_charentry_t* entry) {
+#if GUI_CFG_USE_VECTOR_ICON
+    if (entry->icon != NULL) {
+        return font_cache_hash(entry->icon, (const void *)((size_t)entry->height << 2));
+    }
+#endif /* GUI_CFG_USE_VECTOR_ICON */
+    return font_cache_hash(entry->font, (const void *)((size_t)entry->ch ^ ((size_t)entry->variant << 2)));
+}
+
+/**
+ * \brief           Free memory of entry which is not in cache
+ * \param[in]       entry: Entry to free
+ */
+static void
+font_cache_free(gui_font_charentry_t* entry) {
+#if GUI_CFG_USE_CACHE_RETAIN
+    if (guii_retain_free(entry)) {                  /* Entry in retained region is not part of heap */
+        return;
+    }
+#endif /* GUI_CFG_USE_CACHE_RETAIN */
+    GUI_MEMFREE(entry);
+}
+
+/**
+ * \brief           Remove entry from hash table and free its memory
+ * \note            Linear probing requires entries after removed slot to be moved back
+ * \param[in]       entry: Entry to remove
+ */
+static void
+font_cache_remove(gui_font_charentry_t* entry) {
+    size_t i, j, k;
+    
+    /* Find slot of entry */
+    for (i = font_cache_entryhash(entry); GUI.font_cache[i] != entry; i = (i + 1) & FONT_CACHE_MASK) {
+        if (GUI.font_cache[i] == NULL) {            /* Entry is not in table, should not happen */
+            break;
+        }
+    }
+    if (GUI.font_cache[i] == entry) {
+        GUI.font_cache[i] = NULL;
+        
+        /* Move back entries which would not be found anymore */
+        for (j = (i + 1) & FONT_CACHE_MASK; GUI.font_cache[j] != NULL; j = (j + 1) & FONT_CACHE_MASK) {
+            k = font_cache_entryhash(GUI.font_cache[j]);
+            if ((j > i && (k <= i || k > j)) || (j < i && (k <= i && k > j))) {
+                GUI.font_cache[i] = GUI.font_cache[j];
+                GUI.font_cache[j] = NULL;
+                i = j;
+            }
+        }
+    }
+    
+    gui_linkedlist_remove_gen(&GUI.root_fonts, (gui_linkedlist_t *)entry);
+    GUI.font_cache_count--;
+    GUI.font_cache_size -= entry->memsize;
+    gui_lcd_fence();                                /* Character may still be used by queued low-level operation */
+    font_cache_free(entry);
+}
+
+/**
+ * \brief           Remove least recently used entry from cache
+ * \return          `1` if entry was removed, `0` if cache is empty
+ */
+static uint8_t
+font_cache_removelru(void) {
+    gui_font_charentry_t* entry;
+    
+    entry = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(&GUI.root_fonts, NULL);
+    if (entry != NULL) {
+        font_cache_remove(entry);
+        return 1;
+    }
+    return 0;
+}
+
+#if GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__
+
+/**
+ * \brief           Remove least recently used character when heap allocation failed
+ * \note            This function is private and may be called only when GUI is protected
+ * \return          `1` if entry was removed, `0` if only most recently used entry is left, it may be in use
+ */
+uint8_t
+guii_text_cachereclaim(void) {
+    if (GUI.root_fonts.first == GUI.root_fonts.last) {
+        return 0;
+    }
+    return font_cache_removelru();
+}
+
+#endif /* GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__ */
+
+/**
+ * \brief           Allocate memory for new entry, release least recently used entries when cache is full
+ * \param[in]       memsize: Number of bytes for entry including data
+ * \param[in]       retain: Set to `1` to place entry in retained region when available
+ * \return          Entry memory on success, `NULL` otherwise
+ */
+static gui_font_charentry_t*
+font_cache_alloc(size_t memsize, uint8_t retain) {
+    gui_font_charentry_t* entry;
+    
+    /* Make space in cache by removing least recently used entries */
+    while (GUI.font_cache_count >= FONT_CACHE_MAX_COUNT
+#if GUI_CFG_FONT_CACHE_SIZE
+        || (GUI.font_cache_size + memsize) > GUI_CACHE_BUDGET(GUI_CACHE_FONT, GUI_CFG_FONT_CACHE_SIZE)
+#endif /* GUI_CFG_FONT_CACHE_SIZE */
+    ) {
+        if (!font_cache_removelru()) {
+            break;
+        }
+    }
+    
+    /* Allocate memory for entry, release other entries if there is not enough memory */
+    entry = NULL;
+#if GUI_CFG_USE_CACHE_RETAIN
+    if (retain) {
+        entry = guii_retain_alloc(GUI_RETAIN_CHAR, memsize);    /* Use region kept over reset first */
+    }
+#else /* GUI_CFG_USE_CACHE_RETAIN */
+    GUI_UNUSED(retain);
+#endif /* !GUI_CFG_USE_CACHE_RETAIN */
+    while (entry == NULL && (entry = GUI_MEMALLOC_CLASS(memsize, GUI_MEM_CLASS_PIXEL)) == NULL && font_cache_removelru()) {}
+    if (entry != NULL) {
+        entry->memsize = memsize;
+        entry->variant = 0;
+#if GUI_CFG_USE_VECTOR_ICON
+        entry->icon = NULL;
+#endif /* GUI_CFG_USE_VECTOR_ICON */
+    }
+    return entry;
+}
+
+/**
+ * \brief           Add filled entry to cache as most recently used
+ * \param[in]       entry: Entry allocated with \ref font_cache_alloc
+ */
+static void
+font_cache_add(gui_font_charentry_t* entry) {
+    size_t i;
+    
+    gui_linkedlist_add_gen(&GUI.root_fonts, (gui_linkedlist_t *)entry);  /* Add entry to linked list as most recently used */
+    
+    /* Add entry to hash table */
+    for (i = font_cache_entryhash(entry); GUI.font_cache[i] != NULL; i = (i + 1) & FONT_CACHE_MASK) {}
+    GUI.font_cache[i] = entry;
+    GUI.font_cache_count++;
+    GUI.font_cache_size += entry->memsize;
+}
+
+/**
+ * \brief           Decode run-length compressed character data to 8-bit alpha
+ *
+ *                  Runs continue over line ends, pixels not covered by data are cleared.
+ *
+ * \param[in]       font: Font with \ref GUI_FLAG_FONT_RLE flag
+ * \param[in]       data: Compressed data after 2-bytes length header
+ * \param[in]       len: Number of compressed bytes
+ * \param[out]      out: Output buffer
+ * \param[in]       count: Number of pixels to decode
+ */
+static void
+font_rle_decode(const gui_font_t* font, const uint8_t* data, size_t len, uint8_t* out, size_t count) {
+    const uint8_t* end = data + len;
+    size_t run, k;
+    uint8_t b, bpp, scale;
+
+    if (font->flags & GUI_FLAG_FONT_A8) {           /* Get bits per pixel of literal values */
+        bpp = 8;
+        scale = 0x01;
+    } else if (font->flags & GUI_FLAG_FONT_A4) {
+        bpp = 4;
+        scale = 0x11;
+    } else if (font->flags & GUI_FLAG_FONT_AA) {
+        bpp = 2;
+        scale = 0x55;
+    } else {
+        bpp = 1;
+        scale = 0xFF;
+    }
+    while (data < end && count) {
+        b = *data++;
+        if (!(b & 0x80)) {                          /* Run of transparent or solid pixels */
+            run = GUI_MIN((size_t)(b & 0x3F) + 1, count);
+            memset(out, (b & 0x40) ? 0xFF : 0x00, run);
+        } else {                                    /* Literal pixels packed in font format, first in top bits */
+            run = GUI_MIN((size_t)(b & 0x7F) + 1, count);
+            run = GUI_MIN(run, (size_t)(end - data) * (8 / bpp));
+            for (k = 0; k < run; k++) {
+                b = (uint8_t)(data[(k * bpp) >> 3] << ((k * bpp) & 0x07));
+                out[k] = (uint8_t)((b >> (8 - bpp)) * scale);
+            }
+            data += (run * bpp + 7) >> 3;
+        }
+        out += run;
+        count -= run;
+    }
+    memset(out, 0x00, count);                       /* Clear pixels of truncated data */
+}
+
+/**
+ * \brief           Find character in sorted ranges of sparse font
+ * \param[in]       font: Font with ranges table
+ * \param[in]       ch: Unicode decoded character
+ * \return          Char info on success, `NULL` otherwise
+ */
+GUI_CFG_FAST_CODE static const gui_font_char_t *
+font_range_find(const gui_font_t* font, uint32_t ch) {
+    const gui_font_range_t* r;
+    size_t lo = 0, hi = font->range_count, mid;
+    
+    while (lo < hi) {
+        mid = (lo + hi) >> 1;
+        r = &font->ranges[mid];
+        if (ch < r->start) {
+            hi = mid;
+        } else if (ch >= r->start + r->count) {
+            lo = mid + 1;
+        } else {
+            return &font->data[r->index + (ch - r->start)];
+        }
+    }
+    return NULL;
+}
+
 /**
  * \brief           Get character descriptor from specific character and font
  * \param[in]       font: Font to use for drawing
  * \param[in]       ch: Unicode decoded character
  * \return          Char info of specific font and character code
  */
-const gui_font_char_t *
+GUI_CFG_FAST_CODE const gui_font_char_t *
 gui_text_getchardesc(const gui_font_t* font, uint32_t ch) {
+    const gui_font_char_t* c;
+    
     ch = get_char_from_value(ch);
+    if (font->ranges != NULL) {                     /* Sparse font, search ranges */
+        if ((c = font_range_find(font, ch)) == NULL) {
+            c = font_range_find(font, '?');         /* Try with question mark */
+        }
+        return c;
+    }
     /* Try to get character from font */
     if (ch >= font->startchar && ch <= font->endchar) {
         return &font->data[(ch)-font->startchar];
@@ -72,7 +337,7 @@ gui_text_getcharsize(const gui_font_t* font, uint32_t ch, gui_dim_t* width, gui_
     
     c = gui_text_getchardesc(font, ch);
     if (c != NULL) {
-        *width = c->x_size + c->x_margin;
+        *width = gui_text_getcharadvance(font, c);
         *height = c->y_size;
     } else {
         *width = 0;
@@ -80,23 +345,149 @@ gui_text_getcharsize(const gui_font_t* font, uint32_t ch, gui_dim_t* width, gui_
     }
 }
 
+/**
+ * \brief           Get horizontal advance of character
+ * \param[in]       font: Font used for character
+ * \param[in]       c: Character info handle from \ref gui_text_getchardesc
+ * \return          Distance to start of next character in units of pixels
+ */
+gui_dim_t
+gui_text_getcharadvance(const gui_font_t* font, const gui_font_char_t* c) {
+    if (font->advance != NULL) {
+        return font->advance[c - font->data];
+    }
+    if (font->advance64 != NULL) {
+        return (gui_dim_t)((font->advance64[c - font->data] + 32) >> 6);
+    }
+    return c->x_size + c->x_margin;
+}
+
+/**
+ * \brief           Get horizontal advance of character with fractional part
+ * \param[in]       font: Font used for character
+ * \param[in]       c: Character info handle from \ref gui_text_getchardesc
+ * \return          Distance to start of next character in units of `1/64` pixel
+ */
+int32_t
+gui_text_getcharadvance64(const gui_font_t* font, const gui_font_char_t* c) {
+    if (font->advance64 != NULL) {
+        return font->advance64[c - font->data];
+    }
+    return (int32_t)gui_text_getcharadvance(font, c) * 64;
+}
+
+/**
+ * \brief           Get kerning adjustment between two adjacent characters
+ * \note            Kerning table is searched with binary search
+ * \param[in]       font: Font used for characters
+ * \param[in]       left: Unicode decoded left character
+ * \param[in]       right: Unicode decoded right character
+ * \return          Advance adjustment in units of pixels, `0` if pair is not in table
+ */
+gui_dim_t
+gui_text_getkerning(const gui_font_t* font, uint32_t left, uint32_t right) {
+    const gui_font_kern_t* k;
+    size_t lo = 0, hi = font->kerning_count, mid;
+    uint32_t key, val;
+    
+    key = (left << 16) | (right & 0xFFFF);
+    while (lo < hi) {
+        mid = (lo + hi) >> 1;
+        k = &font->kerning[mid];
+        val = ((uint32_t)k->left << 16) | k->right;
+        if (val == key) {
+            return k->value;
+        } else if (val < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief           Get width of each string prefix in single line
+ *
+ *                  Entry `widths[k]` is set to width of first `k` characters, including kerning.
+ *                  Array can be used with \ref gui_text_getcharsforwidth to find truncation
+ *                  or cursor position without measuring string again.
+ *
+ * \param[in]       font: Font used for string
+ * \param[in]       str: String to measure
+ * \param[out]      widths: Output array with at least `count + 1` entries
+ * \param[in]       count: Maximal number of characters to measure
+ * \return          Number of measured characters
+ */
+size_t
+gui_text_getprefixwidths(const gui_font_t* font, const gui_char* str, gui_dim_t* widths, size_t count) {
+    const gui_font_char_t* c;
+    gui_string_t s;
+    uint32_t ch, prev = 0, chars[16];
+    size_t n = 0, k, cnt;
+    
+    widths[0] = 0;
+    gui_string_prepare(&s, str);
+    while (n < count && (cnt = gui_string_getchars(&s, chars, GUI_MIN(count - n, GUI_COUNT_OF(chars)))) > 0) {
+        for (k = 0; k < cnt; k++) {                 /* Process decoded block */
+            ch = get_char_from_value(chars[k]);
+            widths[n + 1] = widths[n];
+            if ((c = gui_text_getchardesc(font, ch)) != NULL) {
+                widths[n + 1] += gui_text_getkerning(font, prev, ch) + gui_text_getcharadvance(font, c);
+            }
+            prev = ch;
+            n++;
+        }
+    }
+    return n;
+}
+
+/**
+ * \brief           Get number of characters which fit to width
+ * \param[in]       widths: Prefix widths from \ref gui_text_getprefixwidths
+ * \param[in]       count: Number of measured characters
+ * \param[in]       width: Available width in units of pixels
+ * \return          Maximal `k` where `widths[k] <= width`
+ */
+size_t
+gui_text_getcharsforwidth(const gui_dim_t* widths, size_t count, gui_dim_t width) {
+    size_t lo = 0, hi = count, mid;
+    
+    while (lo < hi) {
+        mid = (lo + hi + 1) >> 1;
+        if (widths[mid] <= width) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return lo;
+}
+
 /**
  * \brief           Get character entry generated in memory for fast drawing
  * \param[in]       font: Font used for character
  * \param[in]       c: Character info handle
  * \return          Character entry on success, `NULL` otherwise
  */
-gui_font_charentry_t *
+GUI_CFG_FAST_CODE gui_font_charentry_t *
 gui_text_getcharentry(const gui_font_t* font, const gui_font_char_t* c) {
     gui_font_charentry_t* entry;
+    size_t i;
 
-    /* Process all characters on linked list */
-    for (entry = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(&GUI.root_fonts, NULL); entry != NULL;
-        entry = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)entry)) {
-        if (entry->font == font && entry->ch == c) {
+    /* Find entry in hash table */
+    for (i = font_cache_hash(font, c); (entry = GUI.font_cache[i]) != NULL; i = (i + 1) & FONT_CACHE_MASK) {
+        if (entry->font == font && entry->ch == c && !entry->variant) {
+            /* Mark entry as most recently used */
+            if (GUI.root_fonts.last != (gui_linkedlist_t *)entry) {
+                gui_linkedlist_remove_gen(&GUI.root_fonts, (gui_linkedlist_t *)entry);
+                gui_linkedlist_add_gen(&GUI.root_fonts, (gui_linkedlist_t *)entry);
+            }
+            GUI_CACHE_HIT(GUI_CACHE_FONT);
             return entry;
         }
     }
+    GUI_CACHE_MISS(GUI_CACHE_FONT);
     return 0;
 }
 
@@ -109,15 +500,32 @@ gui_text_getcharentry(const gui_font_t* font, const gui_font_char_t* c) {
 gui_font_charentry_t *
 gui_text_createcharentry(const gui_font_t* font, const gui_font_char_t* c) {
     gui_font_charentry_t* entry = NULL;
-    size_t columns, memDataSize, memsize;
+    size_t i, columns, memDataSize, memsize;
+    const uint8_t* data = c->data;
+    uint8_t* raw = NULL;
 
     /* Calculate memory size for data */
     memsize = GUI_MEM_ALIGN(sizeof(*entry));
     memDataSize = (size_t)c->x_size * (size_t)c->y_size;
     memsize += GUI_MEM_ALIGN(memDataSize);          /* Align memory before increase */
-    entry = GUI_MEMALLOC(memsize);                  /* Allocate memory for entry */
+    
+    entry = font_cache_alloc(memsize, font->read == NULL);  /* Opened fonts are not at the same address after reset */
+    if (entry != NULL && font->read != NULL) {      /* Read stored character data from external storage */
+        size_t raw_size = gui_text_getchardatasize(font, c);
+        
+        while ((raw = GUI_MEMALLOC_FRAME(raw_size)) == NULL && font_cache_removelru()) {}
+        if (raw == NULL || raw_size < ((font->flags & GUI_FLAG_FONT_RLE) ? 2 : 0)
+            || !font->read(font, (size_t)c->data, raw, raw_size)) {
+            if (raw != NULL) {
+                GUI_MEMFREE_FRAME(raw);
+            }
+            font_cache_free(entry);
+            return NULL;
+        }
+        data = raw;
+    }
     if (entry != NULL) {                            /* Allocation was successful */
-        uint16_t i, x;
+        uint16_t x;
         uint8_t b, k, t;
         uint8_t* ptr = (uint8_t *)entry;            /* Go to memory size */
 
@@ -126,14 +534,27 @@ gui_text_createcharentry(const gui_font_t* font, const gui_font_char_t* c) {
         entry->ch = c;                              /* Set pointer to character */
         entry->font = font;                         /* Set pointer to font structure */
 
-        if (font->flags & GUI_FLAG_FONT_AA) {       /* Anti-alliased font */
+        if (font->flags & GUI_FLAG_FONT_RLE) {      /* Run-length compressed data, length header first */
+            font_rle_decode(font, data + 2, (size_t)data[0] | ((size_t)data[1] << 8), ptr, memDataSize);
+        } else if (font->flags & GUI_FLAG_FONT_A8) {/* Data are already in A8 format */
+            memcpy(ptr, data, memDataSize);
+        } else if (font->flags & GUI_FLAG_FONT_A4) {/* 4-bit alpha, scale each nibble to 8-bit */
+            columns = (c->x_size + 1) >> 1;         /* Calculate number of bytes used for single character line */
+            for (i = 0; i < c->y_size * columns; i++) {
+                b = data[i];
+                *ptr++ = (uint8_t)((b >> 4) * 0x11);
+                if ((i % columns) != (columns - 1) || !(c->x_size & 0x01)) {
+                    *ptr++ = (uint8_t)((b & 0x0F) * 0x11);
+                }
+            }
+        } else if (font->flags & GUI_FLAG_FONT_AA) {/* Anti-alliased font */
             columns = c->x_size >> 2;               /* Calculate number of bytes used for single character line */
             if (c->x_size % 4) {                    /* If only 1 column used */
                 columns++;
             }
             x = 0;
             for (i = 0; i < c->y_size * columns; i++) { /* Inspect all vertical lines */
-                b = c->data[i];                     /* Get byte of data */
+                b = data[i];                        /* Get byte of data */
                 for (k = 0; k < 4; k++) {           /* Scan each bit in byte */
                     t = (b >> (6 - 2 * k)) & 0x03;  /* Get temporary bits on bottom */
                     switch (t) {
@@ -164,7 +585,7 @@ gui_text_createcharentry(const gui_font_t* font, const gui_font_char_t* c) {
             }
             x = 0;
             for (i = 0; i < c->y_size * columns; i++) { /* Inspect all vertical lines */
-                b = c->data[i];                     /* Get byte of data */
+                b = data[i];                        /* Get byte of data */
                 for (k = 0; k < 8; k++) {           /* Scan each bit in byte */
                     if ((b >> (7 - k)) & 0x01) {
                         *ptr++ = 0xFF;
@@ -179,7 +600,294 @@ gui_text_createcharentry(const gui_font_t* font, const gui_font_char_t* c) {
                 }
             }
         }
-        gui_linkedlist_add_gen(&GUI.root_fonts, (gui_linkedlist_t *)entry);  /* Add entry to linked list */
+        font_cache_add(entry);
+#if GUI_CFG_USE_CACHE_RETAIN
+        guii_retain_commit(entry);                  /* Keep unpacked character over reset */
+#endif /* GUI_CFG_USE_CACHE_RETAIN */
+    }
+    if (raw != NULL) {
+        GUI_MEMFREE_FRAME(raw);
     }
     return entry;
 }
+
+/**
+ * \brief           Get number of bytes of stored character data in font format
+ *
+ *                  For \ref GUI_FLAG_FONT_RLE fonts length header is read from character data
+ *
+ * \param[in]       font: Font for character
+ * \param[in]       c: Character descriptor
+ * \return          Number of data bytes, `0` if length header cannot be read
+ */
+size_t
+gui_text_getchardatasize(const gui_font_t* font, const gui_font_char_t* c) {
+    size_t columns;
+    
+    if (font->flags & GUI_FLAG_FONT_RLE) {          /* Length of compressed data is stored before data */
+        uint8_t hdr[2];
+        
+        if (font->read != NULL) {
+            if (!font->read(font, (size_t)c->data, hdr, sizeof(hdr))) {
+                return 0;
+            }
+        } else {
+            memcpy(hdr, c->data, sizeof(hdr));
+        }
+        return 2 + ((size_t)hdr[0] | ((size_t)hdr[1] << 8));
+    } else if (font->flags & GUI_FLAG_FONT_A8) {
+        columns = c->x_size;
+    } else if (font->flags & GUI_FLAG_FONT_A4) {
+        columns = ((size_t)c->x_size + 1) >> 1;
+    } else if (font->flags & GUI_FLAG_FONT_AA) {
+        columns = ((size_t)c->x_size + 3) >> 2;
+    } else {
+        columns = ((size_t)c->x_size + 7) >> 3;
+    }
+    return columns * c->y_size;
+}
+
+/**
+ * \brief           Remove cached characters of font
+ *
+ *                  Must be called before font structure or its character table is released.
+ *
+ * \param[in]       font: Font to remove characters for. Set to `NULL` to remove all characters
+ * \return          `1` if at least one character was removed, `0` otherwise
+ */
+uint8_t
+gui_text_cacheremove(const gui_font_t* font) {
+    gui_font_charentry_t* entry, *next;
+    uint8_t ret = 0;
+    
+    for (entry = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(&GUI.root_fonts, NULL); entry != NULL; entry = next) {
+        next = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)entry);
+        if (entry->font != NULL && (font == NULL || entry->font == font)) {
+            font_cache_remove(entry);
+            ret = 1;
+        }
+    }
+    return ret;
+}
+
+#if GUI_CFG_USE_CACHE_RETAIN || __DOXYGEN__
+
+/**
+ * \brief           Add character entry from retained region to cache
+ * \note            This function is private and may be called only when GUI is protected
+ * \param[in]       entry: Entry with valid font, character and data
+ * \return          `1` if entry was added, `0` when cache is full
+ */
+uint8_t
+guii_text_cacheadopt(gui_font_charentry_t* entry) {
+    if (GUI.font_cache_count >= FONT_CACHE_MAX_COUNT
+#if GUI_CFG_FONT_CACHE_SIZE
+        || (GUI.font_cache_size + entry->memsize) > GUI_CACHE_BUDGET(GUI_CACHE_FONT, GUI_CFG_FONT_CACHE_SIZE)
+#endif /* GUI_CFG_FONT_CACHE_SIZE */
+        || gui_text_getcharentry(entry->font, entry->ch) != NULL) {
+        return 0;
+    }
+    entry->variant = 0;
+#if GUI_CFG_USE_VECTOR_ICON
+    entry->icon = NULL;
+#endif /* GUI_CFG_USE_VECTOR_ICON */
+    font_cache_add(entry);
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_CACHE_RETAIN || __DOXYGEN__ */
+
+/**
+ * \brief           Fill coverage of character shifted right by fraction of pixel
+ * \param[in]       c: Character descriptor
+ * \param[in]       src: `A8` coverage of character, `x_size * y_size` entries
+ * \param[in]       shift: Shift in units of `1/256` pixel
+ * \param[out]      out: Output coverage, `(x_size + 1) * y_size` entries
+ */
+static void
+font_variant_shift(const gui_font_char_t* c, const uint8_t* src, uint32_t shift, uint8_t* out) {
+    uint32_t prev, a;
+    gui_dim_t x, y;
+    
+    for (y = 0; y < c->y_size; y++) {
+        prev = 0;
+        for (x = 0; x <= c->x_size; x++) {
+            a = x < c->x_size ? *src++ : 0;
+            *out++ = (uint8_t)((a * (256 - shift) + prev * shift) >> 8);
+            prev = a;
+        }
+    }
+}
+
+#if GUI_CFG_USE_TEXT_LCD || __DOXYGEN__
+
+/**
+ * \brief           Fill LCD subpixel coverage of character
+ *
+ *                  Coverage is box sampled for each third of pixel and filtered
+ *                  with 5-tap filter to reduce color fringes.
+ *
+ * \param[in]       c: Character descriptor
+ * \param[in]       src: `A8` coverage of character, `x_size * y_size` entries
+ * \param[in]       shift: Shift in units of `1/256` pixel
+ * \param[out]      out: Output coverage, `3 * (x_size + 2) * y_size` entries for left, middle and right subpixel.
+ *                      First output pixel is one pixel left of character position
+ */
+static void
+font_variant_lcd(const gui_font_char_t* c, const uint8_t* src, uint32_t shift, uint8_t* out) {
+    static const uint8_t filter[] = {0x08, 0x4D, 0x56, 0x4D, 0x08};
+    uint8_t sub[3 * (255 + 2) + 4];
+    int32_t s0, i0, rem, part;
+    uint32_t v, a0, a1;
+    gui_dim_t x, y, k, t, n;
+    
+    n = 3 * (c->x_size + 2);
+    for (y = 0; y < c->y_size; y++, src += c->x_size) {
+        /* Sample each third of pixel, positions in units of 1/768 pixel */
+        for (k = 0; k < n; k++) {
+            s0 = k * 256 - 768 - (int32_t)shift * 3 + 2 * 768;  /* Keep value positive */
+            i0 = s0 / 768 - 2;
+            rem = s0 % 768;
+            a0 = (i0 >= 0 && i0 < c->x_size) ? src[i0] : 0;
+            if (rem + 256 <= 768) {
+                sub[k + 2] = (uint8_t)a0;
+            } else {
+                part = 768 - rem;
+                a1 = (i0 + 1 >= 0 && i0 + 1 < c->x_size) ? src[i0 + 1] : 0;
+                sub[k + 2] = (uint8_t)((a0 * part + a1 * (256 - part)) >> 8);
+            }
+        }
+        sub[0] = sub[1] = sub[n + 2] = sub[n + 3] = 0;
+        
+        /* Filter subpixels */
+        for (x = 0; x < n; x++) {
+            for (v = 0, t = 0; t < 5; t++) {
+                v += (uint32_t)filter[t] * sub[x + t];
+            }
+            *out++ = GUI_U8(GUI_MIN(v >> 8, 0xFF));
+        }
+    }
+}
+
+#endif /* GUI_CFG_USE_TEXT_LCD || __DOXYGEN__ */
+
+/**
+ * \brief           Get entry with subpixel variant of character, create it when not cached yet
+ *
+ *                  Variant with horizontal subpixel shift has `x_size + 1` coverage values per line.
+ *                  LCD variant has `3 * (x_size + 2)` coverage values per line,
+ *                  where first pixel is one pixel left of character position.
+ *
+ * \param[in]       font: Font for character
+ * \param[in]       c: Character descriptor
+ * \param[in]       variant: Subpixel position between `0` and \ref GUI_CFG_TEXT_SUBPIXEL_POSITIONS - 1,
+ *                      with \ref GUI_TEXT_VARIANT_LCD bit for LCD coverage. Must not be `0`
+ * \return          Character entry on success, `NULL` otherwise
+ */
+gui_font_charentry_t *
+gui_text_getcharvariant(const gui_font_t* font, const gui_font_char_t* c, uint8_t variant) {
+    gui_font_charentry_t* entry, *base;
+    const uint8_t* src;
+    size_t i, memDataSize;
+    uint32_t shift;
+    
+    /* Find entry in hash table */
+    for (i = font_cache_hash(font, (const void *)((size_t)c ^ ((size_t)variant << 2))); (entry = GUI.font_cache[i]) != NULL; i = (i + 1) & FONT_CACHE_MASK) {
+        if (entry->font == font && entry->ch == c && entry->variant == variant) {
+            if (GUI.root_fonts.last != (gui_linkedlist_t *)entry) {
+                gui_linkedlist_remove_gen(&GUI.root_fonts, (gui_linkedlist_t *)entry);
+                gui_linkedlist_add_gen(&GUI.root_fonts, (gui_linkedlist_t *)entry);
+            }
+            return entry;
+        }
+    }
+    
+#if GUI_CFG_USE_TEXT_LCD
+    if (variant & GUI_TEXT_VARIANT_LCD) {
+        memDataSize = 3 * ((size_t)c->x_size + 2) * (size_t)c->y_size;
+    } else
+#endif /* GUI_CFG_USE_TEXT_LCD */
+    {
+        memDataSize = ((size_t)c->x_size + 1) * (size_t)c->y_size;
+    }
+    
+    /* Allocate first, entry is not in cache yet and cannot be removed by base character */
+    entry = font_cache_alloc(GUI_MEM_ALIGN(sizeof(*entry)) + GUI_MEM_ALIGN(memDataSize), 0);
+    if (entry == NULL) {
+        return NULL;
+    }
+    if ((font->flags & (GUI_FLAG_FONT_A8 | GUI_FLAG_FONT_RLE)) == GUI_FLAG_FONT_A8 && font->read == NULL) {
+        src = c->data;
+    } else {
+        if ((base = gui_text_getcharentry(font, c)) == NULL) {
+            base = gui_text_createcharentry(font, c);
+        }
+        if (base == NULL) {
+            GUI_MEMFREE(entry);
+            return NULL;
+        }
+        src = (const uint8_t *)base + GUI_MEM_ALIGN(sizeof(*base));
+    }
+    entry->font = font;
+    entry->ch = c;
+    entry->variant = variant;
+    
+    shift = ((uint32_t)(variant & ~GUI_TEXT_VARIANT_LCD) << 8) / GUI_CFG_TEXT_SUBPIXEL_POSITIONS;
+#if GUI_CFG_USE_TEXT_LCD
+    if (variant & GUI_TEXT_VARIANT_LCD) {
+        font_variant_lcd(c, src, shift, (uint8_t *)entry + GUI_MEM_ALIGN(sizeof(*entry)));
+    } else
+#endif /* GUI_CFG_USE_TEXT_LCD */
+    {
+        font_variant_shift(c, src, shift, (uint8_t *)entry + GUI_MEM_ALIGN(sizeof(*entry)));
+    }
+    font_cache_add(entry);
+    return entry;
+}
+
+#if GUI_CFG_USE_VECTOR_ICON || __DOXYGEN__
+
+/**
+ * \brief           Get entry with icon rasterized to `A8` at specific size, rasterize it when not cached yet
+ * \param[in]       icon: Vector icon
+ * \param[in]       width: Width of rasterized icon in units of pixels
+ * \param[in]       height: Height of rasterized icon in units of pixels
+ * \return          Entry with `width * height` coverage values after aligned structure on success, `NULL` otherwise
+ */
+gui_font_charentry_t *
+gui_text_geticonentry(const gui_icon_t* icon, gui_dim_t width, gui_dim_t height) {
+    gui_font_charentry_t* entry;
+    size_t i;
+    
+    if (width <= 0 || height <= 0) {
+        return NULL;
+    }
+    
+    /* Find entry in hash table */
+    for (i = font_cache_hash(icon, (const void *)((size_t)height << 2)); (entry = GUI.font_cache[i]) != NULL; i = (i + 1) & FONT_CACHE_MASK) {
+        if (entry->icon == icon && entry->height == height && entry->width == width) {
+            if (GUI.root_fonts.last != (gui_linkedlist_t *)entry) {
+                gui_linkedlist_remove_gen(&GUI.root_fonts, (gui_linkedlist_t *)entry);
+                gui_linkedlist_add_gen(&GUI.root_fonts, (gui_linkedlist_t *)entry);
+            }
+            return entry;
+        }
+    }
+    
+    entry = font_cache_alloc(GUI_MEM_ALIGN(sizeof(*entry)) + GUI_MEM_ALIGN((size_t)width * (size_t)height), 0);
+    if (entry != NULL) {
+        entry->ch = NULL;
+        entry->font = NULL;
+        if (!guii_draw_icon_rasterize(icon, width, height, (uint8_t *)entry + GUI_MEM_ALIGN(sizeof(*entry)))) {
+            GUI_MEMFREE(entry);
+            return NULL;
+        }
+        entry->icon = icon;
+        entry->width = width;
+        entry->height = height;
+        font_cache_add(entry);
+    }
+    return entry;
+}
+
+#endif /* GUI_CFG_USE_VECTOR_ICON || __DOXYGEN__ */
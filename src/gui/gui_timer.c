@@ -36,11 +36,113 @@
 #include "gui/gui_timer.h"
 #include "system/gui_sys.h"
 
-#define GUI_FLAG_TIMER_ACTIVE           ((uint16_t)(1 << 0UL))  /*!< Timer is active */
+#define GUI_FLAG_TIMER_ACTIVE           ((uint16_t)(1 << 0UL))  /*!< Timer is active and is on list of active timers */
 #define GUI_FLAG_TIMER_PERIODIC         ((uint16_t)(1 << 1UL))  /*!< Timer will start from beginning after reach end */ 
-#define GUI_FLAG_TIMER_CALL             ((uint16_t)(1 << 2UL))  /*!< Call callback function on timer */
 
 #define guii_timer_isperiodic(t)        ((t)->flags & GUI_FLAG_TIMER_PERIODIC)
+#define guii_timer_isactive(t)          ((t)->flags & GUI_FLAG_TIMER_ACTIVE)
+
+/**
+ * \brief           Check if time `a` is before time `b`, with overflow protection
+ * \hideinitializer
+ */
+#define guii_timer_isbefore(a, b)       ((int32_t)((uint32_t)(a) - (uint32_t)(b)) < 0)
+
+/**
+ * \brief           Insert timer to list of active timers, ordered by expiry time
+ *
+ *                  List is scanned from the end as newly started timer
+ *                  usually expires after already running timers
+ * \param[in]       t: Timer to insert
+ */
+static void
+timer_insert(gui_timer_t* const t) {
+    gui_timer_t* prev;
+    
+    for (prev = (gui_timer_t *)GUI.timers.list.last; prev != NULL; prev = (gui_timer_t *)prev->list.prev) {
+        if (!guii_timer_isbefore(t->expire, prev->expire)) {
+            break;
+        }
+    }
+    
+    t->list.prev = prev;
+    if (prev != NULL) {                             /* Insert after previous timer */
+        t->list.next = prev->list.next;
+        prev->list.next = t;
+    } else {                                        /* Insert as first timer */
+        t->list.next = GUI.timers.list.first;
+        GUI.timers.list.first = t;
+    }
+    if (t->list.next != NULL) {
+        ((gui_timer_t *)t->list.next)->list.prev = t;
+    } else {
+        GUI.timers.list.last = t;
+    }
+    t->flags |= GUI_FLAG_TIMER_ACTIVE;
+}
+
+/**
+ * \brief           Remove timer from list of active timers, if it is there
+ * \param[in]       t: Timer to remove
+ */
+static void
+timer_unlink(gui_timer_t* const t) {
+    if (guii_timer_isactive(t)) {
+        gui_linkedlist_remove_gen(&GUI.timers.list, (gui_linkedlist_t *)t);
+        t->flags &= ~GUI_FLAG_TIMER_ACTIVE;
+    }
+}
+
+/**
+ * \brief           Wakeup GUI thread as next deadline may change
+ */
+static void
+timer_wakeup(void) {
+#if GUI_CFG_OS
+    if (!GUI.OS.processing) {
+        guii_wakeup(GUI_SYS_WAKEUP_TIMER);
+    }
+#endif /* GUI_CFG_OS */
+}
+
+/**
+ * \brief           Schedule timer to expire one period from now
+ * \param[in]       t: Timer to schedule
+ */
+static void
+timer_schedule(gui_timer_t* const t) {
+    timer_unlink(t);
+    t->expire = gui_sys_now() + t->period;          /* Set new expiry time */
+    timer_insert(t);
+    timer_wakeup();
+}
+
+/**
+ * \brief           Get time when expired timers must be processed at latest
+ *
+ *                  It is the earliest expiry time plus slack of all active timers.
+ *                  List is ordered by expiry time, scan stops at first timer
+ *                  which expires after already found deadline
+ *
+ * \param[out]      deadline: Pointer to output variable to save absolute deadline time to
+ * \return          `1` if at least one timer is active, `0` otherwise
+ */
+static uint8_t
+timer_deadline(uint32_t* deadline) {
+    gui_timer_t* t = GUI.timers.list.first;
+    
+    if (t == NULL) {
+        return 0;
+    }
+    *deadline = t->expire + t->slack;
+    for (t = (gui_timer_t *)t->list.next; t != NULL && guii_timer_isbefore(t->expire, *deadline);
+        t = (gui_timer_t *)t->list.next) {
+        if (guii_timer_isbefore(t->expire + t->slack, *deadline)) {
+            *deadline = t->expire + t->slack;
+        }
+    }
+    return 1;
+}
 
 /**
  * \brief           Create new software timer
@@ -54,21 +156,15 @@ gui_timer_t *
 guii_timer_create(uint16_t period, void (*callback)(gui_timer_t *), void* const params) {
     gui_timer_t* ptr;
     
-    ptr = GUI_MEMALLOC(sizeof(*ptr));               /* Allocate memory for timer */
+    ptr = GUI_MEMALLOC_CLASS(sizeof(*ptr), GUI_MEM_CLASS_FAST);               /* Allocate memory for timer */
     if (ptr != NULL) {
         memset(ptr, 0x00, sizeof(*ptr));            /* Reset memory */
         
         ptr->period = period;                       /* Set period value */
-        ptr->counter = period;                      /* Set current counter value */
+        ptr->slack = (uint16_t)((uint32_t)period * GUI_CFG_TIMER_SLACK / 100);  /* Default slack */
         ptr->callback = callback;                   /* Set callback */
         ptr->params = params;                       /* Timer custom parameters */
-        ptr->flags = 0;                             /* Timer flags management */
-        
-        gui_linkedlist_add_gen(&GUI.timers.list, (gui_linkedlist_t *)ptr);  /* Add timer to linked list */
-
-#if GUI_CFG_OS
-        gui_sys_mbox_putnow(&GUI.OS.mbox, NULL);    /* Add new message to queue */
-#endif /* GUI_CFG_OS */
+        ptr->flags = 0;                             /* Timer flags management, timer is not on active list until started */
     }
     return ptr;
 }
@@ -83,7 +179,7 @@ guii_timer_create(uint16_t period, void (*callback)(gui_timer_t *), void* const
 uint8_t
 guii_timer_remove(gui_timer_t** const t) {  
     GUI_ASSERTPARAMS(t != NULL && *t != NULL);  
-    gui_linkedlist_remove_gen(&GUI.timers.list, (gui_linkedlist_t *)(*t));  /* Remove timer from linked list */
+    timer_unlink(*t);                               /* Remove timer from list of active timers */
     GUI_MEMFREE(*t);                                /* Free memory for timer */
     *t = NULL;                                      /* Clear pointer */
     
@@ -99,13 +195,8 @@ guii_timer_remove(gui_timer_t** const t) {
 uint8_t
 guii_timer_start(gui_timer_t* const t) {
     GUI_ASSERTPARAMS(t);
-    t->counter = t->period;                         /* Reset counter to top value */
     t->flags &= ~GUI_FLAG_TIMER_PERIODIC;           /* Clear periodic flag */
-    t->flags |= GUI_FLAG_TIMER_ACTIVE;              /* Set active flag */
-
-#if GUI_CFG_OS
-    gui_sys_mbox_putnow(&GUI.OS.mbox, NULL);        /* Add new message to queue */
-#endif /* GUI_CFG_OS */
+    timer_schedule(t);                              /* Start timer from beginning */
     
     return 1;
 }
@@ -119,8 +210,8 @@ guii_timer_start(gui_timer_t* const t) {
 uint8_t
 guii_timer_startperiodic(gui_timer_t* const t) {
     GUI_ASSERTPARAMS(t);
-    t->counter = t->period;                         /* Reset counter to top value */
-    t->flags |= GUI_FLAG_TIMER_ACTIVE | GUI_FLAG_TIMER_PERIODIC;    /* Set active flag */
+    t->flags |= GUI_FLAG_TIMER_PERIODIC;            /* Set periodic flag */
+    timer_schedule(t);                              /* Start timer from beginning */
     
     return 1;
 }
@@ -134,8 +225,7 @@ guii_timer_startperiodic(gui_timer_t* const t) {
 uint8_t
 guii_timer_stop(gui_timer_t* const t) {
     GUI_ASSERTPARAMS(t);
-    t->counter = t->period;                         /* Reset counter to top value */
-    t->flags &= ~GUI_FLAG_TIMER_ACTIVE;             /* Clear active flag */
+    timer_unlink(t);                                /* Remove from active list */
     
     return 1;
 }
@@ -149,7 +239,27 @@ guii_timer_stop(gui_timer_t* const t) {
 uint8_t
 guii_timer_reset(gui_timer_t* const t) {
     GUI_ASSERTPARAMS(t);
-    t->counter = t->period;                         /* Clear and reset timer */
+    if (guii_timer_isactive(t)) {
+        timer_schedule(t);                          /* Restart period of running timer */
+    }
+    
+    return 1;
+}
+
+/**
+ * \brief           Set maximal time timer may be late to expire together with other timers
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       t: Pointer to \ref gui_timer_t structure
+ * \param[in]       slack: Slack in units of milliseconds. Set to `0` to expire timer exactly on time
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+guii_timer_setslack(gui_timer_t* const t, uint16_t slack) {
+    GUI_ASSERTPARAMS(t);
+    t->slack = slack;
+    if (guii_timer_isactive(t)) {
+        timer_wakeup();
+    }
     
     return 1;
 }
@@ -157,48 +267,44 @@ guii_timer_reset(gui_timer_t* const t) {
 /**
  * \brief           Internal processing called by GUI library
  * \note            This function is private and may be called only when OS protection is active
- * \note            Processes all timers in loop and calls callback function if needed 
+ * \note            Processes only expired timers from the beginning of active list
+ *                  and calls callback function for each of them.
+ *                  Nothing is processed until slack of at least one expired timer elapses,
+ *                  then all expired timers are processed together
  */
 void
 guii_timer_process(void) {
     gui_timer_t* t;
-    volatile uint32_t time = gui_sys_now();         /* Get current time */
-    volatile uint32_t lastTime = GUI.timers.time;
-    uint32_t diff = time - lastTime;                /* Get difference in time */
+    uint32_t time = gui_sys_now();                  /* Get current time */
+    uint32_t deadline;
     
-    if (diff == 0) {                                /* No difference in time */
-        return;
+    if (!timer_deadline(&deadline) || guii_timer_isbefore(time, deadline)) {
+        return;                                     /* Wait for more timers to expire */
     }
     
-    /* Process all software timers */
-    for (t = (gui_timer_t *)GUI.timers.list.first; t != NULL;
-        t = (gui_timer_t *)t->list.next) {
-        if (t->flags & GUI_FLAG_TIMER_CALL) {       /* Counter is set to 0, process callback */
-            t->flags &= ~GUI_FLAG_TIMER_CALL;       /* Clear timer flag */
-            if (!guii_timer_isperiodic(t)) {        /* If timer is not periodic */
-                guii_timer_stop(t);                 /* Stop timer */
-            }
-            if (t->callback != NULL) {              /* Process callback */
-                t->callback(t);                     /* Call user function */
+    /*
+     * List is ordered by expiry time, stop on first timer
+     * which did not yet expire.
+     *
+     * First timer is read again after each callback
+     * as callback may start, stop or remove any timer
+     */
+    while ((t = (gui_timer_t *)GUI.timers.list.first) != NULL
+        && !guii_timer_isbefore(time, t->expire)) {
+        timer_unlink(t);
+        if (guii_timer_isperiodic(t)) {             /* Schedule next period */
+            t->expire += t->period;
+            if (!guii_timer_isbefore(time, t->expire)) {    /* Too late, start from now */
+                t->expire = time + (t->period ? t->period : 1);
             }
+            timer_insert(t);
         }
-        
-        if (!(t->flags & GUI_FLAG_TIMER_ACTIVE)) {  /* Timer is not active */
-            continue;
-        }
-        if (t->counter >= diff) {                   /* Decrease counter value by zero */
-            t->counter -= diff;                     /* Try to decrease to 0 */
-            if (!t->counter) {
-                t->counter = t->period;             /* Set new period value */
-                t->flags |= GUI_FLAG_TIMER_CALL;    /* Set flag for timer callback next time */
-            }
-        } else {                                    /* Overflow mode */
-            t->counter = 0;                         /* Set new counter value */
-            t->flags |= GUI_FLAG_TIMER_CALL;        /* Set callback flag in next check */
+        if (t->callback != NULL) {                  /* Process callback */
+            GUI_TRACE(GUI_TRACE_EVT_TIMER_START, t->period);
+            t->callback(t);                         /* Call user function */
+            GUI_TRACE(GUI_TRACE_EVT_TIMER_END, 0);
         }
     }
-    
-    GUI.timers.time = time;                         /* Reset time */
 }
 
 /**
@@ -211,9 +317,26 @@ guii_timer_getactivecount(void) {
     gui_timer_t* t;
     for (t = (gui_timer_t *)gui_linkedlist_getnext_gen(&GUI.timers.list, NULL); t != NULL;
         t = (gui_timer_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)t)) {
-        if ((t->flags & GUI_FLAG_TIMER_ACTIVE)) {
-            cnt++;
-        }
+        cnt++;
     }
     return cnt;
 }
+
+/**
+ * \brief           Get time until expired timers must be processed
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[out]      timeout: Pointer to output variable to save number of milliseconds until next expiry.
+ *                      Value is set to `0` if timer already expired
+ * \return          `1` if at least one timer is active, `0` otherwise
+ */
+uint8_t
+guii_timer_getnexttimeout(uint32_t* timeout) {
+    uint32_t time, deadline;
+    
+    if (!timer_deadline(&deadline)) {
+        return 0;
+    }
+    time = gui_sys_now();
+    *timeout = guii_timer_isbefore(time, deadline) ? (deadline - time) : 0;
+    return 1;
+}
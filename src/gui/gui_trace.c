@@ -0,0 +1,255 @@
+/**    
+ * \file            gui_trace.c
+ * \brief           Event trace recorder
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_trace.h"
+
+#if GUI_CFG_USE_TRACE || __DOXYGEN__
+
+#define TRACE_MASK                  ((uint32_t)(GUI_CFG_TRACE_SIZE - 1))
+
+#if defined(__GNUC__)
+#define TRACE_RESERVE()             __sync_fetch_and_add(&trace_in, 1)
+#else /* defined(__GNUC__) */
+#define TRACE_RESERVE()             trace_in++      /* Without atomic increment only single producer is allowed */
+#endif /* !defined(__GNUC__) */
+
+static gui_trace_evt_t trace_buff[GUI_CFG_TRACE_SIZE];
+static volatile uint32_t trace_in;                  /* Number of reserved entries */
+static uint32_t trace_out;                          /* Number of read entries */
+static uint32_t trace_dropped;                      /* Number of overwritten or incomplete entries */
+
+/**
+ * \brief           Export format of built-in events
+ */
+static const struct {
+    const char* name;                               /*!< Event name */
+    char phase;                                     /*!< Chrome trace phase, `B` begin, `E` end, `i` instant */
+    uint8_t tid;                                    /*!< Thread ID in export, touch input and display run in own context */
+} trace_events[] = {
+    [GUI_TRACE_EVT_FRAME_START] =   { "frame",          'B', 1 },
+    [GUI_TRACE_EVT_FRAME_END] =     { "frame",          'E', 1 },
+    [GUI_TRACE_EVT_MBOX_WAKEUP] =   { "wakeup",         'i', 1 },
+    [GUI_TRACE_EVT_TOUCH_RECEIVED] ={ "touch_received", 'i', 2 },
+    [GUI_TRACE_EVT_TOUCH_START] =   { "touch",          'B', 1 },
+    [GUI_TRACE_EVT_TOUCH_END] =     { "touch",          'E', 1 },
+    [GUI_TRACE_EVT_TIMER_START] =   { "timer",          'B', 1 },
+    [GUI_TRACE_EVT_TIMER_END] =     { "timer",          'E', 1 },
+    [GUI_TRACE_EVT_LAYER_SWAP] =    { "layer_swap",     'i', 1 },
+    [GUI_TRACE_EVT_LAYER_CONFIRM] = { "layer_confirm",  'i', 3 },
+};
+
+/**
+ * \brief           Write unsigned number as decimal string
+ * \param[out]      str: Output string with at least `21` bytes
+ * \param[in]       val: Value to write
+ * \return          Number of written characters
+ */
+static size_t
+trace_utoa(char* str, uint64_t val) {
+    char tmp[20];
+    size_t len = 0, i;
+
+    do {
+        tmp[len++] = (char)('0' + (val % 10));
+        val /= 10;
+    } while (val > 0);
+    for (i = 0; i < len; i++) {
+        str[i] = tmp[len - i - 1];
+    }
+    str[len] = '\0';
+    return len;
+}
+
+/**
+ * \brief           Append string to output buffer
+ * \return          New length of buffer
+ */
+static size_t
+trace_append(char* buff, size_t len, const char* str) {
+    while (*str) {
+        buff[len++] = *str++;
+    }
+    return len;
+}
+
+#endif /* GUI_CFG_USE_TRACE || __DOXYGEN__ */
+
+/**
+ * \brief           Record trace event
+ * \note            Function is lock-free and may be called from any thread or interrupt
+ * \param[in]       id: Event ID, \ref gui_trace_evt_id_t or custom ID starting at \ref GUI_TRACE_EVT_USER
+ * \param[in]       arg: Event argument
+ */
+void
+gui_trace_record(uint8_t id, uint32_t arg) {
+#if GUI_CFG_USE_TRACE
+    gui_trace_evt_t* e;
+    uint32_t idx;
+
+    idx = TRACE_RESERVE();                          /* Reserve entry */
+    e = &trace_buff[idx & TRACE_MASK];
+    e->seq = 0;                                     /* Entry is incomplete until sequence is set */
+    e->time = GUI_CFG_TRACE_TIMESTAMP();
+    e->arg = arg;
+    e->id = id;
+    GUI_CFG_MEMORY_BARRIER();                       /* Publish entry only after it is written */
+    e->seq = idx + 1;
+    GUI_CFG_TRACE_HOOK(id, arg);
+#else /* GUI_CFG_USE_TRACE */
+    GUI_UNUSED2(id, arg);
+#endif /* !GUI_CFG_USE_TRACE */
+}
+
+/**
+ * \brief           Read recorded events, from oldest to newest
+ * \note            Function must be called by single consumer only.
+ *                  Events overwritten before they were read are counted with \ref gui_trace_getdropped
+ * \param[out]      evts: Array to save events to
+ * \param[in]       len: Number of entries in array
+ * \return          Number of events saved to array
+ */
+size_t
+gui_trace_read(gui_trace_evt_t* evts, size_t len) {
+    size_t cnt = 0;
+#if GUI_CFG_USE_TRACE
+    uint32_t in = trace_in, out = trace_out;
+    gui_trace_evt_t* e;
+
+    GUI_ASSERTPARAMS(evts != NULL);
+    if ((in - out) > GUI_CFG_TRACE_SIZE) {          /* Oldest entries were already overwritten */
+        trace_dropped += (in - out) - GUI_CFG_TRACE_SIZE;
+        out = in - GUI_CFG_TRACE_SIZE;
+    }
+    for (; out != in && cnt < len; out++) {
+        e = &trace_buff[out & TRACE_MASK];
+        GUI_CFG_MEMORY_BARRIER();
+        evts[cnt] = *e;
+        GUI_CFG_MEMORY_BARRIER();
+        if (evts[cnt].seq == out + 1 && e->seq == out + 1) {    /* Entry was complete and not overwritten while copying */
+            cnt++;
+        } else {
+            trace_dropped++;
+        }
+    }
+    trace_out = out;
+#else /* GUI_CFG_USE_TRACE */
+    GUI_UNUSED2(evts, len);
+#endif /* !GUI_CFG_USE_TRACE */
+    return cnt;
+}
+
+/**
+ * \brief           Read all recorded events and write them in Chrome trace JSON format
+ *
+ *                  Output can be opened with Perfetto UI or `chrome://tracing`.
+ *                  On Win32 simulator, `fn` may simply write data to file.
+ *
+ * \note            Function must be called by single consumer only, exported events are removed from buffer
+ * \param[in]       fn: Output function
+ * \param[in]       arg: Custom argument passed to output function
+ * \return          Number of exported events
+ */
+size_t
+gui_trace_export_json(gui_trace_write_fn fn, void* arg) {
+    size_t cnt = 0;
+#if GUI_CFG_USE_TRACE
+    gui_trace_evt_t evts[16];
+    char buff[160];
+    size_t i, n, len;
+
+    GUI_ASSERTPARAMS(fn != NULL);
+    fn("{\"traceEvents\":[\n", 17, arg);
+    while ((n = gui_trace_read(evts, GUI_COUNT_OF(evts))) > 0) {
+        for (i = 0; i < n; i++) {
+            const gui_trace_evt_t* e = &evts[i];
+            uint8_t builtin = e->id < GUI_COUNT_OF(trace_events);
+            char ph[2] = { builtin ? trace_events[e->id].phase : 'i', '\0' };
+
+            len = trace_append(buff, 0, cnt ? ",\n{\"name\":\"" : "{\"name\":\"");
+            len = trace_append(buff, len, gui_trace_getname(e->id));
+            len = trace_append(buff, len, "\",\"ph\":\"");
+            len = trace_append(buff, len, ph);
+            if (ph[0] == 'i') {
+                len = trace_append(buff, len, "\",\"s\":\"t");
+            }
+            len = trace_append(buff, len, "\",\"pid\":1,\"tid\":");
+            len += trace_utoa(&buff[len], builtin ? trace_events[e->id].tid : 1);
+            len = trace_append(buff, len, ",\"ts\":");
+            len += trace_utoa(&buff[len], GUI_CFG_TRACE_TO_US(e->time));
+            len = trace_append(buff, len, ",\"args\":{\"id\":");
+            len += trace_utoa(&buff[len], e->id);
+            len = trace_append(buff, len, ",\"arg\":");
+            len += trace_utoa(&buff[len], e->arg);
+            len = trace_append(buff, len, "}}");
+            fn(buff, len, arg);
+            cnt++;
+        }
+    }
+    fn("\n]}\n", 4, arg);
+#else /* GUI_CFG_USE_TRACE */
+    GUI_UNUSED2(fn, arg);
+#endif /* !GUI_CFG_USE_TRACE */
+    return cnt;
+}
+
+/**
+ * \brief           Get name of trace event
+ * \param[in]       id: Event ID
+ * \return          Event name, `user` for custom events
+ */
+const char*
+gui_trace_getname(uint8_t id) {
+#if GUI_CFG_USE_TRACE
+    if (id < GUI_COUNT_OF(trace_events)) {
+        return trace_events[id].name;
+    }
+#else /* GUI_CFG_USE_TRACE */
+    GUI_UNUSED(id);
+#endif /* !GUI_CFG_USE_TRACE */
+    return "user";
+}
+
+/**
+ * \brief           Get number of events lost because buffer was full when reading
+ * \return          Number of dropped events
+ */
+uint32_t
+gui_trace_getdropped(void) {
+#if GUI_CFG_USE_TRACE
+    return trace_dropped;
+#else /* GUI_CFG_USE_TRACE */
+    return 0;
+#endif /* !GUI_CFG_USE_TRACE */
+}
@@ -37,6 +37,49 @@
 
 #if GUI_CFG_USE_TRANSLATE || __DOXYGEN__
 
+/**
+ * \brief           Calculate hash of string content
+ * \param[in]       str: String to hash
+ * \return          FNV-1a hash value
+ */
+static uint32_t
+translate_hash(const gui_char* str) {
+    uint32_t h = 2166136261UL;
+    
+    for (; *str; str++) {
+        h = (h ^ (uint8_t)*str) * 16777619UL;
+    }
+    return h;
+}
+
+/**
+ * \brief           Build hash table of source language entries
+ * \note            When memory is not available, entries are searched linearly
+ */
+static void
+translate_buildhash(void) {
+    const gui_translate_language_t* lang = GUI.translate.source;
+    size_t size, i, j;
+    
+    if (GUI.translate.hash != NULL) {
+        GUI_MEMFREE(GUI.translate.hash);
+    }
+    GUI.translate.hash_mask = 0;
+    if (lang == NULL || !lang->count || lang->count >= 0xFFFF) {
+        return;
+    }
+    for (size = 4; size < 2 * lang->count; size <<= 1) {}   /* Keep table at most half full */
+    GUI.translate.hash = GUI_MEMALLOC(size * sizeof(*GUI.translate.hash));
+    if (GUI.translate.hash == NULL) {
+        return;
+    }
+    GUI.translate.hash_mask = size - 1;
+    for (i = 0; i < lang->count; i++) {
+        for (j = translate_hash(lang->entries[i]) & GUI.translate.hash_mask; GUI.translate.hash[j]; j = (j + 1) & GUI.translate.hash_mask) {}
+        GUI.translate.hash[j] = (uint16_t)(i + 1);
+    }
+}
+
 /**
  * \brief           Get translated entry from input string
  * \param[in]       src: String to translate
@@ -44,13 +87,28 @@
  */
 const gui_char*
 gui_translate_get(const gui_char* const src) {
-    size_t i;
+    const gui_char* s;
+    size_t i, j;
     
     /* Try to find source string in translate table */
     if (GUI.translate.source == NULL || GUI.translate.active == NULL) { /* Check if languages set correctly */
         return src;                                 /* Just return original string */
     }
     
+    if (GUI.translate.hash != NULL) {               /* Find entry in hash table */
+        for (j = translate_hash(src) & GUI.translate.hash_mask; GUI.translate.hash[j]; j = (j + 1) & GUI.translate.hash_mask) {
+            i = GUI.translate.hash[j] - 1;
+            s = GUI.translate.source->entries[i];
+            if (s == src || gui_string_compare(src, s) == 0) {
+                if (i < GUI.translate.active->count) {  /* Check if in valid range */
+                    return GUI.translate.active->entries[i];    /* Return translated string */
+                }
+                break;
+            }
+        }
+        return src;
+    }
+    
     /* Scan all entries and return appropriate string */
     for (i = 0; i < GUI.translate.source->count; i++) {
         if (gui_string_compare(src, GUI.translate.source->entries[i]) == 0) {
@@ -71,19 +129,27 @@ gui_translate_get(const gui_char* const src) {
  */
 uint8_t
 gui_translate_setactivelanguage(const gui_translate_language_t* const lang) {
+    GUI_CORE_PROTECT(1);
     GUI.translate.active = lang;                    /* Set currently active language */
+    GUI.translate.version++;                        /* Memoized translations are not valid anymore */
+    GUI_CORE_UNPROTECT(1);
     return 1;
 }
 
 /**
  * \brief           Set source language for translated entries
- * \note            These entries are compared with input string to get index for translated value
+ * \note            These entries are compared with input string to get index for translated value.
+ *                  Entries are hashed once here, entries must not change while language is set
  * \param[in]       lang: Language with translation entries
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
 gui_translate_setsourcelanguage(const gui_translate_language_t* const lang) {
+    GUI_CORE_PROTECT(1);
     GUI.translate.source = lang;                    /* Set source language */
+    translate_buildhash();                          /* Prepare fast lookup */
+    GUI.translate.version++;                        /* Memoized translations are not valid anymore */
+    GUI_CORE_UNPROTECT(1);
     return 1;
 }
 
@@ -61,7 +61,17 @@ extern "C" {
 #include "gui/gui_timer.h"
 #include "gui/gui_math.h"
 #include "gui/gui_mem.h"
+#include "gui/gui_trace.h"
+#include "gui/gui_anim.h"
+#include "gui/gui_defer.h"
+#include "gui/gui_retain.h"
+#include "gui/gui_cache.h"
+#include "gui/gui_remote.h"
+#include "gui/gui_gesture.h"
+#include "gui/gui_focus.h"
 #include "gui/gui_translate.h"
+#include "gui/gui_intern.h"
+#include "gui/gui_font.h"
 
 /* GUI Low-Level drivers */
 #include "system/gui_ll.h"
@@ -96,13 +106,69 @@ extern "C" {
  * \note            This function must take care of reseting memory to zero
  * \hideinitializer
  */
+#if GUI_CFG_MEM_TRACE || __DOXYGEN__
+#define GUI_MEMALLOC(size)         gui_mem_calloc_tag(1, size, GUI_MEM_SITE)
+#else /* GUI_CFG_MEM_TRACE || __DOXYGEN__ */
 #define GUI_MEMALLOC(size)         gui_mem_calloc(1, size)
+#endif /* !(GUI_CFG_MEM_TRACE || __DOXYGEN__) */
+
+/**
+ * \brief           Allocate memory of allocation class placed to suitable memory region
+ * \note            This function must take care of reseting memory to zero
+ * \param[in]       size: Number of bytes to allocate
+ * \param[in]       cls: Allocation class, see \ref GUI_MEM_CLASS
+ * \hideinitializer
+ */
+#if GUI_CFG_MEM_TRACE || __DOXYGEN__
+#define GUI_MEMALLOC_CLASS(size, cls)   gui_mem_calloc_class(1, size, cls, GUI_MEM_SITE)
+#else /* GUI_CFG_MEM_TRACE || __DOXYGEN__ */
+#define GUI_MEMALLOC_CLASS(size, cls)   gui_mem_calloc_class(1, size, cls, NULL)
+#endif /* !(GUI_CFG_MEM_TRACE || __DOXYGEN__) */
 
 /**
  * \brief           Reallocate memory with specific size in bytes
  * \hideinitializer
  */
+#if GUI_CFG_MEM_TRACE || __DOXYGEN__
+#define GUI_MEMREALLOC(ptr, size)  gui_mem_realloc_tag(ptr, size, GUI_MEM_SITE)
+#else /* GUI_CFG_MEM_TRACE || __DOXYGEN__ */
 #define GUI_MEMREALLOC(ptr, size)  gui_mem_realloc(ptr, size)
+#endif /* !(GUI_CFG_MEM_TRACE || __DOXYGEN__) */
+
+/**
+ * \brief           Allocate temporary pixel buffer released in the same frame
+ * \note            Memory is not cleared when \ref GUI_CFG_USE_MEM_FRAME is enabled
+ * \param[in]       size: Number of bytes to allocate
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_MEM_FRAME && GUI_CFG_MEM_TRACE
+#define GUI_MEMALLOC_FRAME(size)   gui_mem_frame_alloc(size, GUI_MEM_SITE)
+#elif GUI_CFG_USE_MEM_FRAME || __DOXYGEN__
+#define GUI_MEMALLOC_FRAME(size)   gui_mem_frame_alloc(size, NULL)
+#else /* GUI_CFG_USE_MEM_FRAME || __DOXYGEN__ */
+#define GUI_MEMALLOC_FRAME(size)   GUI_MEMALLOC_CLASS(size, GUI_MEM_CLASS_PIXEL)
+#endif /* !(GUI_CFG_USE_MEM_FRAME || __DOXYGEN__) */
+
+/**
+ * \brief           Free memory allocated with \ref GUI_MEMALLOC_FRAME, heap memory is freed too
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_MEM_FRAME || __DOXYGEN__
+#define GUI_MEMFREE_FRAME(p)   do {                 \
+    gui_mem_frame_free(p);                          \
+    (p) = NULL;                                     \
+} while (0)
+#else /* GUI_CFG_USE_MEM_FRAME || __DOXYGEN__ */
+#define GUI_MEMFREE_FRAME(p)        GUI_MEMFREE(p)
+#endif /* !(GUI_CFG_USE_MEM_FRAME || __DOXYGEN__) */
+
+/**
+ * \brief           Allocation site tag in `file:line` format
+ * \hideinitializer
+ */
+#define GUI_MEM_SITE               __FILE__ ":" GUI_STRINGIFY(__LINE__)
+#define GUI_STRINGIFY(x)           GUI_STRINGIFY_(x)
+#define GUI_STRINGIFY_(x)          #x
 
 /**
  * \brief           Free memory from specific address previously allocated with \ref GUI_MEMALLOC or \ref GUI_MEMREALLOC
@@ -194,10 +260,30 @@ guir_t      gui_init(void);
 int32_t     gui_process(void);
 uint8_t     gui_seteventcallback(gui_eventcallback_t cb);
 
+uint8_t     gui_profiler_setcallback(gui_profiler_fn fn);
+size_t      gui_profiler_getframes(gui_profiler_frame_t* frames, size_t len);
+size_t      gui_profiler_getwidgets(gui_profiler_entry_t* entries, size_t len, uint8_t by_id);
+uint8_t     gui_profiler_reset(void);
+
+uint8_t     gui_latency_get(gui_latency_stat_t* stat);
+uint8_t     gui_latency_reset(void);
+
+uint8_t     gui_redrawdebug_setmode(uint8_t mode);
+const uint8_t*  gui_redrawdebug_getheatmap(void);
+uint8_t     gui_redrawdebug_reset(void);
+
+uint8_t     gui_splash_set(const gui_image_desc_t* img);
+uint8_t     gui_splash_end(void);
+uint8_t     gui_display_add(uint8_t num, gui_ll_control_fn ctrl);
+uint8_t     gui_display_select(uint8_t num);
+uint8_t     gui_display_getselected(void);
+void        gui_display_confirmactivelayer(uint8_t num, uint8_t layer_num);
+
 #if GUI_CFG_OS || __DOXYGEN__
 uint8_t     gui_protect(const uint8_t protect);
 uint8_t     gui_unprotect(const uint8_t unprotect);
 uint8_t     gui_delay(const uint32_t ms);
+uint8_t     gui_getidlestats(gui_idle_stat_t* stat, uint8_t reset);
 #else /* GUI_CFG_OS || __DOXYGEN__ */
 /* Empty macros */
 #define     gui_protect(protect)
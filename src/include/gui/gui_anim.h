@@ -0,0 +1,79 @@
+/**	
+ * \file            gui_anim.h
+ * \brief           Widget property animation engine
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_ANIM_H
+#define GUI_HDR_ANIM_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_utils.h"
+
+/**
+ * \ingroup         GUI_UTILS
+ * \defgroup        GUI_ANIM Animation engine
+ * \brief           Tweens of widget properties driven from single frame timer
+ *
+ *                  All running animations are updated from one timer with \ref GUI_CFG_ANIM_PERIOD period
+ *                  and their invalidations are processed in single batch.
+ *                  Values are calculated from time elapsed since animation start,
+ *                  so when rendering falls behind, intermediate frames are skipped and animation keeps its duration.
+ * \{
+ */
+
+uint8_t     gui_anim_start(gui_handle_p h, gui_anim_prop_t prop, int32_t from, int32_t to, uint32_t duration, gui_anim_ease_t ease);
+uint8_t     gui_anim_startvalue(gui_handle_p h, gui_widget_cmd_int_fn fn, int32_t from, int32_t to, uint32_t duration, gui_anim_ease_t ease);
+uint8_t     gui_anim_stop(gui_handle_p h, gui_anim_prop_t prop, uint8_t finish);
+uint8_t     gui_anim_isrunning(gui_handle_p h, gui_anim_prop_t prop);
+int32_t     gui_anim_ease(gui_anim_ease_t ease, int32_t from, int32_t to, uint32_t elapsed, uint32_t duration);
+
+void        guii_anim_remove(gui_handle_p h);
+
+#if GUI_CFG_USE_TRANSITION || __DOXYGEN__
+uint8_t     gui_anim_transition(gui_handle_p from, gui_handle_p to, gui_transition_t type, uint32_t duration, gui_anim_ease_t ease);
+uint8_t     gui_anim_istransition(void);
+void        guii_redraw_tolayer(gui_layer_t* layer);
+#endif /* GUI_CFG_USE_TRANSITION || __DOXYGEN__ */
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_ANIM_H */
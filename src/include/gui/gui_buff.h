@@ -74,6 +74,13 @@ uint32_t gui_buffer_getfree(gui_buff_t* buff);
 uint32_t gui_buffer_getfull(gui_buff_t* buff);
 void gui_buffer_reset(gui_buff_t* buff);
 
+void* gui_buffer_getlinearblockreadaddress(gui_buff_t* buff);
+uint32_t gui_buffer_getlinearblockreadlength(gui_buff_t* buff);
+uint32_t gui_buffer_skip(gui_buff_t* buff, uint32_t count);
+void* gui_buffer_getlinearblockwriteaddress(gui_buff_t* buff);
+uint32_t gui_buffer_getlinearblockwritelength(gui_buff_t* buff);
+uint32_t gui_buffer_advance(gui_buff_t* buff, uint32_t count);
+
 /**
  * \}
  */
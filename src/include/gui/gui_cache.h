@@ -0,0 +1,127 @@
+/**	
+ * \file            gui_cache.h
+ * \brief           Adaptive cache budgets
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_CACHE_H
+#define GUI_HDR_CACHE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_utils.h"
+
+/**
+ * \ingroup         GUI_UTILS
+ * \defgroup        GUI_CACHE Cache manager
+ * \brief           Adaptive budgets of character, image, sprite and rotation caches
+ *
+ *                  Every \ref GUI_CFG_CACHE_REBALANCE_PERIOD redrawn frames, common budget of \ref GUI_CFG_CACHE_BUDGET bytes
+ *                  is split again. Caches which do not use their budget keep only used bytes,
+ *                  full caches share remaining bytes by number of accesses since last update.
+ *                  Counters are halved after each update, so old usage loses its weight.
+ *
+ *                  When heap allocation fails, single entry is released from cache with least hits per byte
+ *                  until enough bytes are released or allocation succeeds.
+ *                  Most recently used entry of each cache is never released this way, it may be in use by drawing operation
+ * \{
+ */
+
+/**
+ * \brief           List of managed caches
+ */
+typedef enum {
+    GUI_CACHE_FONT = 0x00,                          /*!< Unpacked characters */
+    GUI_CACHE_IMAGE,                                /*!< Decoded images, see \ref GUI_CFG_USE_IMAGE_CACHE */
+    GUI_CACHE_SPRITE,                               /*!< Pre-rendered sprites, see \ref GUI_CFG_USE_SPRITE_CACHE */
+    GUI_CACHE_ROTATION,                             /*!< Pre-rotated images, see \ref GUI_CFG_USE_LCD_ROTATION */
+    GUI_CACHE_END,                                  /*!< Number of caches, not a valid cache */
+} gui_cache_t;
+
+/**
+ * \brief           Usage statistics of single cache
+ */
+typedef struct {
+    size_t used;                                    /*!< Number of bytes used by entries */
+    size_t budget;                                  /*!< Current budget in units of bytes, `0` when cache is not limited */
+    uint32_t hits;                                  /*!< Aged number of lookups found in cache */
+    uint32_t misses;                                /*!< Aged number of lookups not found in cache */
+    uint32_t reclaimed;                             /*!< Number of entries released because heap allocation failed */
+} gui_cache_stat_t;
+
+#if GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__
+
+/**
+ * \brief           Count lookup found in cache
+ * \param[in]       c: Cache, member of \ref gui_cache_t
+ */
+#define GUI_CACHE_HIT(c)            guii_cache_count((c), 1)
+
+/**
+ * \brief           Count lookup not found in cache
+ * \param[in]       c: Cache, member of \ref gui_cache_t
+ */
+#define GUI_CACHE_MISS(c)           guii_cache_count((c), 0)
+
+/**
+ * \brief           Get current budget of cache
+ * \param[in]       c: Cache, member of \ref gui_cache_t
+ * \param[in]       size: Configured size of cache, used when manager is disabled
+ */
+#define GUI_CACHE_BUDGET(c, size)   guii_cache_getbudget(c)
+
+uint8_t     gui_cache_getstat(gui_cache_t cache, gui_cache_stat_t* stat);
+
+void        guii_cache_count(gui_cache_t cache, uint8_t hit);
+size_t      guii_cache_getbudget(gui_cache_t cache);
+void        guii_cache_frame(void);
+uint8_t     guii_cache_reclaim(size_t size);
+
+#else /* GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__ */
+
+#define GUI_CACHE_HIT(c)            ((void)0)
+#define GUI_CACHE_MISS(c)           ((void)0)
+#define GUI_CACHE_BUDGET(c, size)   (size)
+
+#endif /* !(GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__) */
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_CACHE_H */
@@ -72,9 +72,14 @@
 
 /**
  * \brief           Maximal number of touch entries in buffer
+ * \note            Value must be power of `2`
  */
 #ifndef GUI_CFG_TOUCH_BUFFER_SIZE
-#define GUI_CFG_TOUCH_BUFFER_SIZE               10
+#define GUI_CFG_TOUCH_BUFFER_SIZE               16
+#endif
+
+#if GUI_CFG_TOUCH_BUFFER_SIZE & (GUI_CFG_TOUCH_BUFFER_SIZE - 1)
+#error "GUI_CFG_TOUCH_BUFFER_SIZE must be power of 2"
 #endif
 
 /**
@@ -86,13 +91,336 @@
 #define GUI_CFG_TOUCH_MAX_PRESSES               2
 #endif
 
+/**
+ * \brief           Enables `1` or disables `0` compression of touch move samples
+ *
+ *                  When enabled, consecutive pressed samples with the same number of touches
+ *                  are merged into the latest one before \ref GUI_EVT_TOUCHMOVE is dispatched to widgets.
+ *                  Press and release transitions are always processed
+ */
+#ifndef GUI_CFG_TOUCH_COMPRESS_MOVE
+#define GUI_CFG_TOUCH_COMPRESS_MOVE             1
+#endif
+
+/**
+ * \brief           Maximal number of input entries processed in single \ref gui_process call
+ *
+ *                  Touch and keyboard entries are processed together in order of their time.
+ *                  When budget is used, remaining entries stay in input buffers and are processed
+ *                  after frame is redrawn, thus flood of key repeat or encoder events cannot delay rendering.
+ *                  Merged touch move samples count as single entry.
+ *
+ *                  Set to `0` to process all available entries on each call
+ */
+#ifndef GUI_CFG_INPUT_BUDGET
+#define GUI_CFG_INPUT_BUDGET                    0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` touch position prediction
+ *
+ *                  When enabled, position passed to widgets with \ref GUI_EVT_TOUCHMOVE event
+ *                  is extrapolated with touch velocity to expected time when frame with result is displayed.
+ *                  Expected time is average touch-to-photon latency when \ref GUI_CFG_USE_LATENCY is enabled
+ *                  and at least one touch was measured, \ref GUI_CFG_TOUCH_PREDICT_TIME otherwise.
+ *
+ *                  Relative positions and differences are predicted, absolute touch position stays as received
+ */
+#ifndef GUI_CFG_TOUCH_PREDICT
+#define GUI_CFG_TOUCH_PREDICT                   0
+#endif
+
+/**
+ * \brief           Expected time between touch sample and display of frame in units of milliseconds
+ *
+ *                  Used for touch prediction when latency is not measured
+ * \sa              GUI_CFG_TOUCH_PREDICT
+ */
+#ifndef GUI_CFG_TOUCH_PREDICT_TIME
+#if GUI_CFG_FRAME_RATE
+#define GUI_CFG_TOUCH_PREDICT_TIME              (2000 / GUI_CFG_FRAME_RATE)
+#else
+#define GUI_CFG_TOUCH_PREDICT_TIME              30
+#endif
+#endif
+
+/**
+ * \brief           Maximal touch prediction distance in units of pixels
+ *
+ *                  Limits overshoot when touch stops or changes direction
+ * \sa              GUI_CFG_TOUCH_PREDICT
+ */
+#ifndef GUI_CFG_TOUCH_PREDICT_MAX
+#define GUI_CFG_TOUCH_PREDICT_MAX               24
+#endif
+
 /**
  * \brief           Maximal number of keyboard entries in buffer
+ * \note            Value must be power of `2`
  */
 #ifndef GUI_CFG_KEYBOARD_BUFFER_SIZE
-#define GUI_CFG_KEYBOARD_BUFFER_SIZE            10
+#define GUI_CFG_KEYBOARD_BUFFER_SIZE            16
 #endif 
 
+#if GUI_CFG_KEYBOARD_BUFFER_SIZE & (GUI_CFG_KEYBOARD_BUFFER_SIZE - 1)
+#error "GUI_CFG_KEYBOARD_BUFFER_SIZE must be power of 2"
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) input recording and replay
+ *
+ *                  Touch and keyboard entries read by GUI are recorded with time relative to start of recording,
+ *                  together with application marks for its own widget updates, see \ref gui_input_record_start.
+ *                  Recording is replayed with \ref gui_input_replay_start against time of \ref gui_sys_now,
+ *                  thus run on headless display with virtual clock is repeated exactly for performance regression runs.
+ *                  Frame times of replayed runs are compared with profiler, see \ref GUI_CFG_USE_PROFILER
+ */
+#ifndef GUI_CFG_USE_INPUT_RECORD
+#define GUI_CFG_USE_INPUT_RECORD                0
+#endif
+
+/**
+ * \brief           Memory barrier used by lock-free input buffers
+ *
+ *                  Barrier makes sure input entry is completely written before it is
+ *                  published to GUI thread when entries are added from interrupt context.
+ *
+ * \note            Overwrite it with platform specific instruction, such as `__DMB()` on Cortex-M
+ */
+#ifndef GUI_CFG_MEMORY_BARRIER
+#if defined(__GNUC__)
+#define GUI_CFG_MEMORY_BARRIER()                __sync_synchronize()
+#else
+#define GUI_CFG_MEMORY_BARRIER()                do {} while (0)
+#endif
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) command queue for widget updates from other threads
+ *
+ *                  Commands are added without core protection to lock-free queue
+ *                  and applied by GUI thread on next \ref gui_process call.
+ *                  Consecutive commands with the same widget and setter function are merged
+ *
+ * \sa              gui_widget_post_int, gui_widget_post_text
+ */
+#ifndef GUI_CFG_USE_WIDGET_CMD_QUEUE
+#define GUI_CFG_USE_WIDGET_CMD_QUEUE            0
+#endif
+
+/**
+ * \brief           Maximal number of pending widget commands
+ * \note            Value must be power of `2`
+ */
+#ifndef GUI_CFG_WIDGET_CMD_QUEUE_SIZE
+#define GUI_CFG_WIDGET_CMD_QUEUE_SIZE           32
+#endif
+
+#if GUI_CFG_WIDGET_CMD_QUEUE_SIZE & (GUI_CFG_WIDGET_CMD_QUEUE_SIZE - 1)
+#error "GUI_CFG_WIDGET_CMD_QUEUE_SIZE must be power of 2"
+#endif
+
+/**
+ * \brief           Atomic compare and swap on `size_t` variable used by widget command queue
+ *
+ *                  Macro must set `*ptr` to `desired` only if it is equal to `expected`
+ *                  and return nonzero value when value was written
+ *
+ * \note            Overwrite it with platform specific implementation, such as `LDREX/STREX` loop on Cortex-M
+ */
+#ifndef GUI_CFG_ATOMIC_CAS
+#if defined(__GNUC__)
+#define GUI_CFG_ATOMIC_CAS(ptr, expected, desired)  __sync_bool_compare_and_swap((ptr), (expected), (desired))
+#elif GUI_CFG_USE_WIDGET_CMD_QUEUE
+#error "GUI_CFG_ATOMIC_CAS must be defined for widget command queue"
+#endif
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) deferred work queue
+ *
+ *                  Timer and widget callbacks may offload slow work, which does not draw,
+ *                  to bounded queue processed outside core protection. Results are applied
+ *                  back to widgets with command queue, see \ref GUI_CFG_USE_WIDGET_CMD_QUEUE
+ *
+ * \sa              gui_defer
+ */
+#ifndef GUI_CFG_USE_DEFER
+#define GUI_CFG_USE_DEFER                       0
+#endif
+
+/**
+ * \brief           Maximal number of pending deferred work entries
+ */
+#ifndef GUI_CFG_DEFER_QUEUE_SIZE
+#define GUI_CFG_DEFER_QUEUE_SIZE                16
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) separate worker thread for deferred work
+ *
+ *                  When disabled or when \ref GUI_CFG_OS is disabled, deferred work is processed
+ *                  by GUI thread at the end of \ref gui_process, after core protection is released
+ */
+#ifndef GUI_CFG_DEFER_THREAD
+#define GUI_CFG_DEFER_THREAD                    1
+#endif
+
+/**
+ * \brief           Stack size of deferred work thread
+ */
+#ifndef GUI_CFG_DEFER_THREAD_SS
+#define GUI_CFG_DEFER_THREAD_SS                 GUI_SYS_THREAD_SS
+#endif
+
+/**
+ * \brief           Priority of deferred work thread
+ * \note            Use priority lower than GUI thread so work does not delay frames
+ */
+#ifndef GUI_CFG_DEFER_THREAD_PRIO
+#define GUI_CFG_DEFER_THREAD_PRIO               GUI_SYS_THREAD_PRIO
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) button widget
+ *
+ *                  Source file of disabled widget is compiled empty, together with its callback.
+ *                  Window widget is used by core and is always enabled
+ */
+#ifndef GUI_CFG_WIDGET_BUTTON
+#define GUI_CFG_WIDGET_BUTTON                   1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) checkbox widget
+ */
+#ifndef GUI_CFG_WIDGET_CHECKBOX
+#define GUI_CFG_WIDGET_CHECKBOX                 1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) container widget
+ */
+#ifndef GUI_CFG_WIDGET_CONTAINER
+#define GUI_CFG_WIDGET_CONTAINER                1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) debug box widget
+ */
+#ifndef GUI_CFG_WIDGET_DEBUGBOX
+#define GUI_CFG_WIDGET_DEBUGBOX                 1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) dialog widget
+ */
+#ifndef GUI_CFG_WIDGET_DIALOG
+#define GUI_CFG_WIDGET_DIALOG                   1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) dropdown widget
+ */
+#ifndef GUI_CFG_WIDGET_DROPDOWN
+#define GUI_CFG_WIDGET_DROPDOWN                 1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) edit text widget
+ */
+#ifndef GUI_CFG_WIDGET_EDITTEXT
+#define GUI_CFG_WIDGET_EDITTEXT                 1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) gauge widget
+ */
+#ifndef GUI_CFG_WIDGET_GAUGE
+#define GUI_CFG_WIDGET_GAUGE                    1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) graph widget
+ */
+#ifndef GUI_CFG_WIDGET_GRAPH
+#define GUI_CFG_WIDGET_GRAPH                    1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) image widget
+ */
+#ifndef GUI_CFG_WIDGET_IMAGE
+#define GUI_CFG_WIDGET_IMAGE                    1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) LED widget
+ */
+#ifndef GUI_CFG_WIDGET_LED
+#define GUI_CFG_WIDGET_LED                      1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) list container widget
+ */
+#ifndef GUI_CFG_WIDGET_LIST_CONTAINER
+#define GUI_CFG_WIDGET_LIST_CONTAINER           1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) list box widget
+ */
+#ifndef GUI_CFG_WIDGET_LISTBOX
+#define GUI_CFG_WIDGET_LISTBOX                  1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) list view widget
+ */
+#ifndef GUI_CFG_WIDGET_LISTVIEW
+#define GUI_CFG_WIDGET_LISTVIEW                 1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) progress bar widget
+ */
+#ifndef GUI_CFG_WIDGET_PROGBAR
+#define GUI_CFG_WIDGET_PROGBAR                  1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) radio box widget
+ */
+#ifndef GUI_CFG_WIDGET_RADIO
+#define GUI_CFG_WIDGET_RADIO                    1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) slider widget
+ */
+#ifndef GUI_CFG_WIDGET_SLIDER
+#define GUI_CFG_WIDGET_SLIDER                   1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) text view widget
+ */
+#ifndef GUI_CFG_WIDGET_TEXTVIEW
+#define GUI_CFG_WIDGET_TEXTVIEW                 1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) waterfall widget
+ */
+#ifndef GUI_CFG_WIDGET_WATERFALL
+#define GUI_CFG_WIDGET_WATERFALL                1
+#endif
+
+#if GUI_CFG_USE_KEYBOARD && (!GUI_CFG_WIDGET_BUTTON || !GUI_CFG_WIDGET_CONTAINER)
+#error "GUI_CFG_USE_KEYBOARD requires GUI_CFG_WIDGET_BUTTON and GUI_CFG_WIDGET_CONTAINER for virtual keyboard"
+#endif
+
 /**
  * \brief           Enables (1) or disables (0) automatic invalidation of graph widgets
  *                    when graph dataset changes
@@ -104,6 +432,29 @@
 #define GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE   1
 #endif
 
+/**
+ * \brief           Maximal number of characters of number shown by text view widget
+ *
+ *                  When non-zero, text view can show integer or fixed-point value, see \ref gui_textview_setnumber.
+ *                  Number is formatted to memory inside widget and only changed characters are redrawn.
+ *                  Set to `0` to disable the feature
+ */
+#ifndef GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN
+#define GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN      0
+#endif
+
+/**
+ * \brief           Size of text memory inside widget handle in units of bytes
+ *
+ *                  Text memory requested by \ref gui_widget_alloctextmemory, which fits to handle,
+ *                  is used without separate heap allocation. Set to `0` to always allocate text memory from heap
+ *
+ * \note            Every widget handle grows for this size, use multiple of \ref GUI_CFG_MEM_ALIGNMENT
+ */
+#ifndef GUI_CFG_WIDGET_TEXT_INLINE_SIZE
+#define GUI_CFG_WIDGET_TEXT_INLINE_SIZE         0
+#endif
+
 /**
  * \brief           Enables (1) or disables (0) widget mode inside parent only
  *                  
@@ -126,6 +477,38 @@
 #define GUI_CFG_USE_TRANSLATE                   1
 #endif
 
+/**
+ * \brief           Enables (1) or disables (0) string intern table for list widget texts
+ *
+ *                  When enabled, texts of listbox, dropdown and listview items are copied
+ *                  to reference counted table, where identical strings share one copy.
+ *                  Text passed to widget may be changed or released after function returns.
+ *
+ * \sa              gui_intern_get
+ */
+#ifndef GUI_CFG_USE_STRING_INTERN
+#define GUI_CFG_USE_STRING_INTERN               0
+#endif
+
+/**
+ * \brief           Number of hash buckets in string intern table
+ *
+ * \note            Used only when \ref GUI_CFG_USE_STRING_INTERN is enabled
+ */
+#ifndef GUI_CFG_STRING_INTERN_BUCKETS
+#define GUI_CFG_STRING_INTERN_BUCKETS           32
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) shared item models for list widgets
+ *
+ *                  Listbox, dropdown and listview can be attached to one \ref GUI_LISTMODEL object,
+ *                  items are stored once and only affected visible rows of each widget are redrawn on change.
+ */
+#ifndef GUI_CFG_USE_LISTMODEL
+#define GUI_CFG_USE_LISTMODEL                   0
+#endif
+
 /**
  * \brief           Enables (1) or disables (0) library custom allocation algorithm.
  *      
@@ -149,79 +532,1657 @@
 #endif
 
 /**
- * \brief           Enables (1) or disables (0) alpha option for widgets
+ * \brief           Placement attribute for hot code, such as rasterizers and redraw traversal
  *
- *                  When enabled, widgets can overlay each other and bottom widget can be visible below top one
+ *                  Functions executed for every pixel, glyph or widget of each frame are marked with this macro,
+ *                  so they can be linked to tightly coupled instruction memory (ITCM) instead of flash,
+ *                  giving frame times independent of instruction cache misses.
+ *                  Leave empty to keep default placement.
+ *
+ *                  Example for `GCC` with section copied from flash to ITCM by startup code
+ * \code{c}
+//gui_config.h
+#define GUI_CFG_FAST_CODE       __attribute__((section(".itcm_text")))
+
+//Linker script, output section in ITCM with load address in flash
+.itcm_text : {
+    . = ALIGN(4);
+    _sitcm = .;
+    *(.itcm_text .itcm_text*)
+    . = ALIGN(4);
+    _eitcm = .;
+} >ITCMRAM AT> FLASH
+_siitcm = LOADADDR(.itcm_text);
+
+//Startup code, before main
+memcpy(&_sitcm, &_siitcm, (size_t)(&_eitcm - &_sitcm));
+\endcode
+ *
+ *                  Example for `ARM Compiler` scatter file, section is copied by library startup code
+ * \code{c}
+LR_IROM1 0x08000000 {
+    ...
+    RW_ITCM 0x00000000 0x00010000 {
+        *(.itcm_text)
+    }
+}
+\endcode
+ *
+ * \note            On Cortex-M7, ITCM at address `0x00000000` is out of branch range from flash,
+ *                  `GCC` linker adds veneers automatically, other toolchains may require long calls
+ * \sa              GUI_CFG_FAST_DATA
  */
-#ifndef GUI_CFG_USE_ALPHA
-#define GUI_CFG_USE_ALPHA                      0
+#ifndef GUI_CFG_FAST_CODE
+#define GUI_CFG_FAST_CODE
 #endif
 
 /**
- * \brief           Enables (1) or disables (0) widgets' position and size cache
- *
- *                  All position/size values are relative to parent which means
- *                  that when drawing is in process, first step is to calculate
- *                  absolute coordinates on screen. This may take time as
- *                  there might be many parent widgets in tree and in case of many
- *                  widgets on same level, we can enter into huge loop calculations.
+ * \brief           Placement attribute for hot data, such as \ref GUI state and redraw traversal stacks
  *
- *                  To prevent calculation each time and to save time,
- *                  cache is introduced. In this case, every widget change in position/size values
- *                  will immediately calculate absolute values and save into additional information fields.
+ *                  Global \ref GUI structure holds widget tree roots, dirty regions, timers
+ *                  and glyph index of character cache, which are accessed on each frame.
+ *                  Marked variables can be linked to tightly coupled data memory (DTCM).
+ *                  Leave empty to keep default placement.
  *
- * \note            When modifying widget position/size, all children widgets must be modified too
- *                  as absolute position/size may change on them aswell
+ *                  Marked variables are not initialized, section must be cleared by startup code
+ * \code{c}
+//gui_config.h
+#define GUI_CFG_FAST_DATA       __attribute__((section(".dtcm_bss")))
+
+//Linker script, zero initialized output section in DTCM
+.dtcm_bss (NOLOAD) : {
+    . = ALIGN(4);
+    _sdtcm_bss = .;
+    *(.dtcm_bss .dtcm_bss*)
+    . = ALIGN(4);
+    _edtcm_bss = .;
+} >DTCMRAM
+
+//Startup code, before main
+memset(&_sdtcm_bss, 0x00, (size_t)(&_edtcm_bss - &_sdtcm_bss));
+\endcode
  *
- * \note            Enabling this feature significantly reduces calculation time,
- *                  but requires more memory for `4` dimension values (usually `8` bytes) per widget
+ * \note            Widget handles and timers are allocated on heap, assign DTCM region
+ *                  with \ref GUI_MEM_CLASS_FAST class to \ref gui_mem_assignmemory to place them in DTCM too
+ * \sa              GUI_CFG_FAST_CODE
  */
-#ifndef GUI_CFG_USE_POS_SIZE_CACHE
-#define GUI_CFG_USE_POS_SIZE_CACHE              0
+#ifndef GUI_CFG_FAST_DATA
+#define GUI_CFG_FAST_DATA
 #endif
 
 /**
- * \brief           Enables `1` or disables `0` widget invalidate ignore after create event
+ * \brief           Enables (1) or disables (0) two-level segregated fit (TLSF) allocator
+ *                  for library custom allocation algorithm
  *
- *                  When every widget is created, minimum position and size must be set thus,
- *                  some invalidation must apply. To make algorithm effective for drawing,
- *                  invalidation may take some time when applying different settings.
+ *                  When enabled, allocation and free operations are done in constant time
+ *                  and fragmentation is bounded. When disabled, first-fit allocator is used.
  *
- *                  By setting this value to `1`, widget will not be invalidated after creation
- *                  and every attempt to invalidate will have no effect.
+ * \note            Used only when \ref GUI_CFG_USE_MEM is enabled
+ */
+#ifndef GUI_CFG_MEM_TLSF
+#define GUI_CFG_MEM_TLSF                        0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) allocation tags for heap tracing
  *
- *                  Disable invalidate ignore for a widget after it is created,
- *                  by calling \ref gui_widget_setignoreinvalidate
+ *                  Each heap block stores pointer to tag string, file and line of allocation
+ *                  or widget name during widget creation. Tags are reported by \ref gui_mem_walk.
  *
- *                  When feature is applied, user must do the following
- * \code{c}
-gui_handle_p h;
-
-//Create widget with flag to prevent invalidation
-h = gui_somewidget_create(....);
-
-//If any of these functions try to invalidate widget, 
-//it will have no effect thus code might work faster
-gui_somewidget_setparam1(h, ...);
-gui_somewidget_setparam2(h, ...);
-gui_somewidget_setparam3(h, ...);
-
-//Disable ignore invalidate and force invalidation
-gui_widget_setignoreinvalidate(h, 0, 1, 0);
-\endcode
+ * \note            Every allocation uses additional aligned pointer size of heap
  */
-#ifndef GUI_CFG_WIDGET_CREATE_IGNORE_INVALIDATE
-#define GUI_CFG_WIDGET_CREATE_IGNORE_INVALIDATE 0
+#ifndef GUI_CFG_MEM_TRACE
+#define GUI_CFG_MEM_TRACE                       0
 #endif
 
 /**
- * \brief           Long click timeout in units of milliseconds
+ * \brief           Enables (1) or disables (0) memory arenas for building screens
  *
- *                  Value indicates number of milliseconds of pressed state before
- *                  long click event is detected
+ *                  While arena is active, allocations are served from single contiguous block
+ *                  and free operations on arena memory are ignored.
+ *                  Arena is released at once when widget it is attached to is removed.
+ *
+ * \sa              gui_widget_arena_begin, gui_widget_arena_end
  */
-#ifndef GUI_CFG_LONG_CLICK_TIMEOUT
-#define GUI_CFG_LONG_CLICK_TIMEOUT              1500
+#ifndef GUI_CFG_USE_MEM_ARENA
+#define GUI_CFG_USE_MEM_ARENA                   0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) movable memory blocks for heap compaction
+ *
+ *                  Movable blocks are accessed through handle table and may be moved
+ *                  to merge free memory while GUI is idle. Debugbox lines are allocated as movable blocks.
+ *
+ * \sa              gui_mem_movable_alloc, gui_mem_compact
+ */
+#ifndef GUI_CFG_USE_MEM_MOVABLE
+#define GUI_CFG_USE_MEM_MOVABLE                 0
+#endif
+
+/**
+ * \brief           Number of entries in handle table of movable blocks
+ *
+ * \note            Used only when \ref GUI_CFG_USE_MEM_MOVABLE is enabled
+ */
+#ifndef GUI_CFG_MEM_MOVABLE_HANDLES
+#define GUI_CFG_MEM_MOVABLE_HANDLES             64
+#endif
+
+/**
+ * \brief           Maximal number of bytes moved by heap compaction in single idle \ref gui_process call
+ *
+ * \note            Used only when \ref GUI_CFG_USE_MEM_MOVABLE is enabled
+ */
+#ifndef GUI_CFG_MEM_COMPACT_BYTES
+#define GUI_CFG_MEM_COMPACT_BYTES               1024
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) frame scratch memory for temporary buffers
+ *
+ *                  Scratch layers of transparent widgets, image decode buffers, transform bands
+ *                  and other buffers released during drawing are taken from single block with bump allocation.
+ *                  Memory is not cleared, block is reset at the end of each redraw.
+ *                  Buffers which do not fit to block are allocated from heap.
+ *
+ * \sa              GUI_CFG_MEM_FRAME_SIZE, gui_mem_frame_getstats
+ */
+#ifndef GUI_CFG_USE_MEM_FRAME
+#define GUI_CFG_USE_MEM_FRAME                   0
+#endif
+
+/**
+ * \brief           Number of bytes of frame scratch memory, allocated from heap on first use
+ *
+ * \note            Used only when \ref GUI_CFG_USE_MEM_FRAME is enabled
+ */
+#ifndef GUI_CFG_MEM_FRAME_SIZE
+#define GUI_CFG_MEM_FRAME_SIZE                  0x10000
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) object pools for widget allocations
+ *
+ *                  When enabled, widget handles are allocated from fixed-block pools,
+ *                  one pool per widget type. Pool memory is allocated on first widget create
+ *                  of specific type and widgets created after pool is full use heap memory.
+ *
+ * \note            Number of widgets per pool is set by `pool_count` field
+ *                    of \ref gui_widget_t structure or \ref GUI_CFG_WIDGET_POOL_COUNT if field is `0`
+ */
+/**
+ * \brief           Enables (1) or disables (0) hash table for fast widget lookup by ID
+ *
+ *                  Table is allocated on heap and grows with number of widgets.
+ *                  When multiple widgets share the same ID or memory is not available,
+ *                  lookup falls back to search on widget tree
+ */
+#ifndef GUI_CFG_USE_WIDGET_ID_HASH
+#define GUI_CFG_USE_WIDGET_ID_HASH              1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) flattened draw order of widget tree
+ *
+ *                  Widget tree is kept as pre-order array on heap, rebuilt before next redraw
+ *                  or touch processing only when widgets were added, removed or reordered.
+ *                  Drawing and touch detection scan array instead of following linked lists
+ *                  and skip complete subtree with single index jump.
+ *                  When memory is not available, widget tree linked lists are used
+ */
+#ifndef GUI_CFG_USE_WIDGET_ORDER
+#define GUI_CFG_USE_WIDGET_ORDER                0
+#endif
+
+/**
+ * \brief           Maximal nesting level of widgets, `1` for widgets without parent
+ *
+ *                  Widget tree is drawn and searched for touch without recursion,
+ *                  using traversal stacks of this depth outside of GUI thread stack.
+ *                  Widget which would be nested deeper is not created
+ */
+#ifndef GUI_CFG_WIDGET_DEPTH_MAX
+#define GUI_CFG_WIDGET_DEPTH_MAX                10
+#endif
+
+#ifndef GUI_CFG_USE_WIDGET_POOL
+#define GUI_CFG_USE_WIDGET_POOL                 0
+#endif
+
+/**
+ * \brief           Maximal number of different widget types with own object pool
+ *
+ * \note            Used only when \ref GUI_CFG_USE_WIDGET_POOL is enabled
+ */
+#ifndef GUI_CFG_WIDGET_POOL_TYPES
+#define GUI_CFG_WIDGET_POOL_TYPES               8
+#endif
+
+/**
+ * \brief           Default number of widgets in single object pool
+ *
+ * \note            Used only when \ref GUI_CFG_USE_WIDGET_POOL is enabled
+ */
+#ifndef GUI_CFG_WIDGET_POOL_COUNT
+#define GUI_CFG_WIDGET_POOL_COUNT               4
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) alpha option for widgets
+ *
+ *                  When enabled, widgets can overlay each other and bottom widget can be visible below top one
+ */
+#ifndef GUI_CFG_USE_ALPHA
+#define GUI_CFG_USE_ALPHA                      0
+#endif
+
+/**
+ * \brief           Number of reusable scratch layers for drawing transparent widgets
+ *
+ *                  Each nesting level of transparent widgets uses one scratch layer.
+ *                  Layer memory is kept between frames and only reallocated when bigger widget is drawn.
+ *                  Deeper nesting levels allocate and free temporary layer on each draw.
+ *
+ * \note            Used only when \ref GUI_CFG_USE_ALPHA is enabled
+ */
+#ifndef GUI_CFG_ALPHA_SCRATCH_LAYERS
+#define GUI_CFG_ALPHA_SCRATCH_LAYERS            2
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) widgets' position and size cache
+ *
+ *                  All position/size values are relative to parent which means
+ *                  that when drawing is in process, first step is to calculate
+ *                  absolute coordinates on screen. This may take time as
+ *                  there might be many parent widgets in tree and in case of many
+ *                  widgets on same level, we can enter into huge loop calculations.
+ *
+ *                  To prevent calculation each time and to save time,
+ *                  cache is introduced. In this case, every widget change in position/size values
+ *                  marks cached values invalid. They are recalculated on first read,
+ *                  from already valid values of parent widget.
+ *
+ * \note            When widget values are recalculated, direct children widgets are marked invalid,
+ *                  thus change propagates to subtree only when values are used
+ *
+ * \note            Enabling this feature significantly reduces calculation time,
+ *                  but requires more memory for `8` dimension values (usually `16` bytes) per widget
+ */
+#ifndef GUI_CFG_USE_POS_SIZE_CACHE
+#define GUI_CFG_USE_POS_SIZE_CACHE              1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) fixed-point storage of widget position and size
+ *
+ *                  When enabled, position and size are stored as signed `Q24.8` integers
+ *                  instead of `float` and all pixel and percent calculations use integer math.
+ *                  Values passed to API functions are converted once when set.
+ *
+ * \note            Use it on cores without FPU where each `float` operation is a library call.
+ *                  Percent values must stay below `256%` to prevent overflow
+ */
+#ifndef GUI_CFG_USE_FIXED_POINT
+#define GUI_CFG_USE_FIXED_POINT                 0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) compact widget handle for memory constrained devices
+ *
+ *                  When enabled, position and size are stored as signed `16-bit` integers in `Q12.4` format
+ *                  and software timer, scroll and dynamic text state are moved to side structure,
+ *                  allocated only for widgets which use them.
+ *
+ * \note            Position and size must stay in range of `-2047` to `2047` pixels
+ *                  and percent values below `128%`, values out of range are saturated by setter functions
+ */
+#ifndef GUI_CFG_USE_COMPACT_HANDLE
+#define GUI_CFG_USE_COMPACT_HANDLE              0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) uniform grid index of widget visible areas
+ *
+ *                  Screen is split to \ref GUI_CFG_WIDGET_GRID_COLS x \ref GUI_CFG_WIDGET_GRID_ROWS cells
+ *                  and each widget keeps bit mask of cells its visible area covers.
+ *                  Mask is updated together with cached absolute position and size.
+ *
+ *                  Touch lookup skips widgets and whole subtrees not covering touched cell
+ *                  and sibling cover check skips widgets which can not cover checked widget,
+ *                  without calculating their rectangles.
+ *
+ * \note            \ref GUI_CFG_USE_POS_SIZE_CACHE must be enabled
+ */
+#ifndef GUI_CFG_USE_WIDGET_GRID
+#define GUI_CFG_USE_WIDGET_GRID                 0
+#endif
+
+/**
+ * \brief           Number of grid columns for widget grid index
+ * \note            `GUI_CFG_WIDGET_GRID_COLS * GUI_CFG_WIDGET_GRID_ROWS` must not be greater than `32`
+ */
+#ifndef GUI_CFG_WIDGET_GRID_COLS
+#define GUI_CFG_WIDGET_GRID_COLS                8
+#endif
+
+/**
+ * \brief           Number of grid rows for widget grid index
+ * \note            `GUI_CFG_WIDGET_GRID_COLS * GUI_CFG_WIDGET_GRID_ROWS` must not be greater than `32`
+ */
+#ifndef GUI_CFG_WIDGET_GRID_ROWS
+#define GUI_CFG_WIDGET_GRID_ROWS                4
+#endif
+
+#if GUI_CFG_USE_WIDGET_GRID && !GUI_CFG_USE_POS_SIZE_CACHE
+#error "GUI_CFG_USE_WIDGET_GRID requires GUI_CFG_USE_POS_SIZE_CACHE"
+#endif
+
+#if GUI_CFG_WIDGET_GRID_COLS * GUI_CFG_WIDGET_GRID_ROWS > 32
+#error "GUI_CFG_WIDGET_GRID_COLS * GUI_CFG_WIDGET_GRID_ROWS must not be greater than 32"
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` retained widget cache layers
+ *
+ *                  When enabled, widgets set with \ref gui_widget_setcache are rendered
+ *                  together with their children once to offscreen layer and later redraws
+ *                  only copy the layer to screen until widget or any of its children is invalidated.
+ *
+ * \note            Cache is intended for widgets which paint their complete area
+ */
+#ifndef GUI_CFG_USE_WIDGET_CACHE
+#define GUI_CFG_USE_WIDGET_CACHE                0
+#endif
+
+/**
+ * \brief           Maximal number of bytes all widget cache layers may use together
+ *
+ *                  Widget is drawn normally when its cache does not fit into remaining budget
+ */
+#ifndef GUI_CFG_WIDGET_CACHE_SIZE
+#define GUI_CFG_WIDGET_CACHE_SIZE               0x8000
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` per-widget display lists
+ *
+ *                  When enabled, drawing calls of widgets set with \ref gui_widget_setdisplaylist
+ *                  are recorded once and replayed on later redraws caused only by overlapping widgets,
+ *                  widget draw callback is called again after widget itself is invalidated.
+ *
+ * \note            \ref GUI_CFG_USE_POS_SIZE_CACHE must be enabled
+ */
+#ifndef GUI_CFG_USE_DISPLAY_LIST
+#define GUI_CFG_USE_DISPLAY_LIST                0
+#endif
+
+/**
+ * \brief           Maximal number of bytes of single widget display list
+ *
+ *                  Widget is drawn with its callback when its drawing does not fit into list
+ */
+#ifndef GUI_CFG_DISPLAY_LIST_SIZE
+#define GUI_CFG_DISPLAY_LIST_SIZE               0x400
+#endif
+
+#if GUI_CFG_USE_DISPLAY_LIST && !GUI_CFG_USE_POS_SIZE_CACHE
+#error "GUI_CFG_USE_DISPLAY_LIST requires GUI_CFG_USE_POS_SIZE_CACHE"
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` coverage mask for widget fills
+ *
+ *                  Before widget is drawn, tiles completely covered by its opaque children
+ *                  are marked in coarse bitmap. Filled areas of widget skip covered tiles,
+ *                  as children overwrite them anyway, which reduces overdraw of backgrounds.
+ */
+#ifndef GUI_CFG_USE_COVERAGE_MASK
+#define GUI_CFG_USE_COVERAGE_MASK               0
+#endif
+
+/**
+ * \brief           Coverage mask tile width and height in units of pixels
+ * \note            Value must be power of 2
+ */
+#ifndef GUI_CFG_COVERAGE_TILE_SIZE
+#define GUI_CFG_COVERAGE_TILE_SIZE              8
+#endif
+
+#if (GUI_CFG_COVERAGE_TILE_SIZE & (GUI_CFG_COVERAGE_TILE_SIZE - 1)) != 0
+#error "GUI_CFG_COVERAGE_TILE_SIZE must be power of 2"
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` hardware overlay planes for widgets
+ *
+ *                  Widget set with \ref gui_widget_setoverlay is rendered with its children
+ *                  to own buffer, shown on display controller plane above main layer.
+ *                  Moving it, changing its alpha or hiding it only reprograms the plane,
+ *                  widgets below are not redrawn.
+ *
+ * \note            Low-level driver must support \ref GUI_LL_Command_SetOverlay
+ */
+#ifndef GUI_CFG_USE_OVERLAY
+#define GUI_CFG_USE_OVERLAY                     0
+#endif
+
+/**
+ * \brief           Maximal number of overlay planes used at the same time
+ *
+ *                  Low-level driver may support less planes, widget is then drawn normally
+ */
+#ifndef GUI_CFG_OVERLAY_COUNT
+#define GUI_CFG_OVERLAY_COUNT                   1
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` widget invalidate ignore after create event
+ *
+ *                  When every widget is created, minimum position and size must be set thus,
+ *                  some invalidation must apply. To make algorithm effective for drawing,
+ *                  invalidation may take some time when applying different settings.
+ *
+ *                  By setting this value to `1`, widget will not be invalidated after creation
+ *                  and every attempt to invalidate will have no effect.
+ *
+ *                  Disable invalidate ignore for a widget after it is created,
+ *                  by calling \ref gui_widget_setignoreinvalidate
+ *
+ *                  When feature is applied, user must do the following
+ * \code{c}
+gui_handle_p h;
+
+//Create widget with flag to prevent invalidation
+h = gui_somewidget_create(....);
+
+//If any of these functions try to invalidate widget, 
+//it will have no effect thus code might work faster
+gui_somewidget_setparam1(h, ...);
+gui_somewidget_setparam2(h, ...);
+gui_somewidget_setparam3(h, ...);
+
+//Disable ignore invalidate and force invalidation
+gui_widget_setignoreinvalidate(h, 0, 1, 0);
+\endcode
+ */
+#ifndef GUI_CFG_WIDGET_CREATE_IGNORE_INVALIDATE
+#define GUI_CFG_WIDGET_CREATE_IGNORE_INVALIDATE 0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` deferred construction of container children
+ *
+ *                  Builder set with \ref gui_widget_setbuilder to hidden container
+ *                  creates its children on first \ref gui_widget_show call,
+ *                  so hidden tabs and screens do not use time and memory at startup
+ */
+#ifndef GUI_CFG_USE_WIDGET_BUILDER
+#define GUI_CFG_USE_WIDGET_BUILDER              0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` running builders of hidden containers in idle time
+ *
+ *                  When nothing is left to draw, one waiting builder is run per processing pass,
+ *                  in order of registration, so containers are ready before they are shown
+ *
+ * \note            Used only when \ref GUI_CFG_USE_WIDGET_BUILDER is enabled
+ */
+#ifndef GUI_CFG_WIDGET_PREBUILD
+#define GUI_CFG_WIDGET_PREBUILD                 0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` creating widgets as copies of prototype widget
+ *
+ *                  \ref gui_widget_clone copies prototype widget and its children
+ *                  without running widget initialization. With \ref GUI_CFG_USE_MEM_ARENA enabled,
+ *                  memory of complete copy is allocated as single block
+ */
+#ifndef GUI_CFG_USE_WIDGET_CLONE
+#define GUI_CFG_USE_WIDGET_CLONE                0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` splash image shown while widgets are created
+ *
+ *                  Image set with \ref gui_splash_set is drawn to display in \ref gui_init,
+ *                  immediately after low-level initialization. Redraw is held until \ref gui_splash_end
+ *                  is called, then first complete frame replaces splash image
+ *
+ * \note            Splash image is not drawn when \ref GUI_CFG_USE_BAND_RENDERING is enabled,
+ *                  only redraw is held until \ref gui_splash_end call
+ */
+#ifndef GUI_CFG_USE_SPLASH
+#define GUI_CFG_USE_SPLASH                      0
+#endif
+
+/**
+ * \brief           Long click timeout in units of milliseconds
+ *
+ *                  Value indicates number of milliseconds of pressed state before
+ *                  long click event is detected
+ */
+#ifndef GUI_CFG_LONG_CLICK_TIMEOUT
+#define GUI_CFG_LONG_CLICK_TIMEOUT              1500
+#endif
+
+/**
+ * \brief           Maximal number of independent dirty rectangles tracked between 2 redraw operations
+ *
+ *                  Each invalidated widget region is added to the list and merged with existing
+ *                  rectangle only when merge does not add much area to redraw.
+ *                  Redraw and layer copy operations are then executed once per rectangle.
+ *
+ * \note            When list is full, new region is merged with rectangle which grows the least.
+ *                  Set to `1` to use single bounding box for all invalidated widgets
+ */
+#ifndef GUI_CFG_DISPLAY_REGIONS
+#define GUI_CFG_DISPLAY_REGIONS                 8
+#endif
+
+/**
+ * \brief           Number of slots in hash table for fast lookup of cached character entries
+ *
+ *                  Cache may hold up to `75%` of slots at a time before least recently used entries are removed
+ *
+ * \note            Value must be power of `2`
+ */
+#ifndef GUI_CFG_FONT_CACHE_HASH_SIZE
+#define GUI_CFG_FONT_CACHE_HASH_SIZE            256
+#endif
+
+/**
+ * \brief           Maximal number of bytes used by cached character entries
+ *
+ *                  Characters are cached when low-level layer supports `CopyChar` function.
+ *                  When limit is reached, least recently used characters are removed from memory.
+ *
+ * \note            Set to `0` to disable memory limit
+ */
+#ifndef GUI_CFG_FONT_CACHE_SIZE
+#define GUI_CFG_FONT_CACHE_SIZE                 0x8000
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) cached layout of widget texts
+ *
+ *                  Line breaks and line widths of widget text are calculated once
+ *                  and reused on next redraws until text, font or widget width change.
+ *
+ * \note            Each widget with text allocates memory for line entries.
+ *                  When application modifies its own text memory directly, it must call \ref gui_widget_settext afterwards
+ */
+#ifndef GUI_CFG_USE_TEXT_LAYOUT_CACHE
+#define GUI_CFG_USE_TEXT_LAYOUT_CACHE           0
+#endif
+
+/**
+ * \brief           Number of horizontal spans buffered by filled shape rasterizer
+ *
+ *                  Filled circles, rounded rectangles and triangles are clipped once
+ *                  and converted to list of horizontal spans. List is sent to
+ *                  low-level `FillSpans` function when buffer is full or shape is finished.
+ *
+ * \note            Buffer is allocated on stack, each span uses `3 * sizeof(gui_dim_t)` bytes
+ */
+#ifndef GUI_CFG_DRAW_SPAN_COUNT
+#define GUI_CFG_DRAW_SPAN_COUNT                 32
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) gradient filled rectangles
+ *
+ *                  Horizontal and radial gradients are drawn from precomputed ramp of colors
+ *                  in layer pixel format, vertical gradients with single fill per row.
+ *
+ * \sa              gui_draw_gradientrectangle, gui_draw_gradientroundedrectangle, GUI_CFG_GRADIENT_CACHE_COUNT
+ */
+#ifndef GUI_CFG_USE_GRADIENT
+#define GUI_CFG_USE_GRADIENT                    0
+#endif
+
+/**
+ * \brief           Number of gradient color ramps kept in memory between frames
+ *
+ *                  Ramp is allocated for each combination of colors and length
+ *                  and replaced when least recently used. Set to `0` to compute
+ *                  colors on every draw without allocating memory.
+ *
+ * \note            Used only when \ref GUI_CFG_USE_GRADIENT is enabled
+ */
+#ifndef GUI_CFG_GRADIENT_CACHE_COUNT
+#define GUI_CFG_GRADIENT_CACHE_COUNT            4
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) vector icons
+ *
+ *                  Icons are stored as compact paths and rasterized with anti-aliasing
+ *                  once per drawn size to character cache, see \ref gui_draw_icon.
+ *
+ * \sa              gui_icon_t
+ */
+#ifndef GUI_CFG_USE_VECTOR_ICON
+#define GUI_CFG_USE_VECTOR_ICON                 0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) font file loader
+ *
+ *                  Fonts can be loaded at runtime from memory mapped file
+ *                  or opened on external storage, where character data are read
+ *                  to character cache on first use, see \ref gui_font_open.
+ */
+#ifndef GUI_CFG_USE_FONT_FILE
+#define GUI_CFG_USE_FONT_FILE                   0
+#endif
+
+/**
+ * \brief           Number of horizontal subpixel positions of characters
+ *
+ *                  Used with fonts with fractional advances in `advance64` table.
+ *                  Each used position of character is kept as separate variant in character cache.
+ *                  Set to `1` to place characters on whole pixels only, maximal value is `16`
+ */
+#ifndef GUI_CFG_TEXT_SUBPIXEL_POSITIONS
+#define GUI_CFG_TEXT_SUBPIXEL_POSITIONS         4
+#endif
+
+/**
+ * \brief           Enables LCD subpixel rendering for fonts with \ref GUI_FLAG_FONT_LCD flag
+ *
+ *                  Each color channel of pixel gets its own coverage, filtered to reduce color fringes.
+ *                  Characters are drawn by software with per-channel blending.
+ *
+ *                  Set to `0` to disable, `1` for panels with `RGB` subpixel order or `2` for `BGR` order
+ */
+#ifndef GUI_CFG_USE_TEXT_LCD
+#define GUI_CFG_USE_TEXT_LCD                    0
+#endif
+
+/**
+ * \brief           Size of coverage buffer in units of bytes for anti-aliased primitives
+ *
+ *                  Anti-aliased lines and circles are rasterized to `A8` coverage tiles
+ *                  of up to this size, which are blended to layer with single `CopyChar` call each.
+ *                  Bigger buffer means less low-level calls per primitive.
+ *
+ * \note            Buffer is allocated statically
+ */
+#ifndef GUI_CFG_DRAW_AA_BUFFER_SIZE
+#define GUI_CFG_DRAW_AA_BUFFER_SIZE             1024
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) support for compressed images
+ *
+ * \sa              gui_image_compression_t
+ */
+#ifndef GUI_CFG_USE_IMAGE_COMPRESSION
+#define GUI_CFG_USE_IMAGE_COMPRESSION           0
+#endif
+
+/**
+ * \brief           Size of scratch buffer in units of bytes for decoding compressed images
+ *
+ *                  Only rows which intersect clipping region are decoded and sent to low-level
+ *                  with single `DrawImage` call per filled buffer.
+ *                  Buffer must hold at least one image row of decoded pixels.
+ *                  For \ref GUI_IMAGE_COMPRESSION_LZ4_PALETTE it must also hold indices of complete tile.
+ *
+ * \note            Buffer is allocated statically, used only when \ref GUI_CFG_USE_IMAGE_COMPRESSION is enabled
+ */
+#ifndef GUI_CFG_DRAW_IMAGE_BUFFER_SIZE
+#define GUI_CFG_DRAW_IMAGE_BUFFER_SIZE          2048
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) cache of decoded images with `read` function
+ *
+ *                  Images stored on external storage are read and decoded on first draw.
+ *                  Later draws copy decoded pixels from cache memory.
+ *                  \ref GUI_IMAGE_COMPRESSION_JPEG images are always decoded to cache.
+ *
+ * \sa              GUI_CFG_IMAGE_CACHE_SIZE
+ */
+#ifndef GUI_CFG_USE_IMAGE_CACHE
+#define GUI_CFG_USE_IMAGE_CACHE                 0
+#endif
+
+/**
+ * \brief           Maximal number of bytes used by decoded images in cache
+ *
+ *                  When limit is reached, least recently used images are removed from memory.
+ *                  Images larger than limit are not drawn.
+ *
+ * \note            Used only when \ref GUI_CFG_USE_IMAGE_CACHE is enabled
+ */
+#ifndef GUI_CFG_IMAGE_CACHE_SIZE
+#define GUI_CFG_IMAGE_CACHE_SIZE                0x40000
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) character and image cache in retained memory
+ *
+ *                  Memory region kept over warm reset, such as external SDRAM, is assigned with \ref gui_retain_setregion.
+ *                  Unpacked characters and decoded images are placed to region first, with identity of their font or image.
+ *                  After reset, valid entries are adopted to caches instead of being unpacked or decoded again.
+ *
+ * \note            Region must not be initialized by startup code
+ */
+#ifndef GUI_CFG_USE_CACHE_RETAIN
+#define GUI_CFG_USE_CACHE_RETAIN                0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) shared cache of pre-rendered widget sprites
+ *
+ *                  Small stateful widgets, such as checkbox, radio and LED, render their shape
+ *                  once per combination of size, colors and state. Every later draw
+ *                  of any widget with the same look is single image blit.
+ *
+ * \sa              GUI_CFG_SPRITE_CACHE_SIZE, guii_draw_sprite
+ */
+#ifndef GUI_CFG_USE_SPRITE_CACHE
+#define GUI_CFG_USE_SPRITE_CACHE                0
+#endif
+
+/**
+ * \brief           Maximal number of bytes used by pre-rendered sprites
+ *
+ *                  Each sprite uses `4` bytes per pixel. When limit is reached,
+ *                  least recently used sprites are removed from memory.
+ *
+ * \note            Used only when \ref GUI_CFG_USE_SPRITE_CACHE is enabled
+ */
+#ifndef GUI_CFG_SPRITE_CACHE_SIZE
+#define GUI_CFG_SPRITE_CACHE_SIZE               0x4000
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) adaptive budgets of character, image, sprite and rotation caches
+ *
+ *                  Hits and misses of each cache are counted. Periodically, caches which are full and miss
+ *                  get larger part of common budget, caches which do not use their budget release it.
+ *                  When heap allocation fails, entries of caches with least hits per byte are released
+ *                  before allocation is reported as failed.
+ *
+ * \sa              GUI_CFG_CACHE_BUDGET, GUI_CFG_CACHE_REBALANCE_PERIOD, gui_cache_getstat
+ */
+#ifndef GUI_CFG_USE_CACHE_MANAGER
+#define GUI_CFG_USE_CACHE_MANAGER               0
+#endif
+
+/**
+ * \brief           Number of bytes shared by all managed caches
+ *
+ *                  Set to `0` to use sum of configured sizes of enabled caches.
+ *                  Each cache keeps at least quarter of its configured size.
+ *
+ * \note            Used only when \ref GUI_CFG_USE_CACHE_MANAGER is enabled
+ */
+#ifndef GUI_CFG_CACHE_BUDGET
+#define GUI_CFG_CACHE_BUDGET                    0
+#endif
+
+/**
+ * \brief           Number of redrawn frames between cache budget updates
+ *
+ * \note            Used only when \ref GUI_CFG_USE_CACHE_MANAGER is enabled
+ */
+#ifndef GUI_CFG_CACHE_REBALANCE_PERIOD
+#define GUI_CFG_CACHE_REBALANCE_PERIOD          32
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) nine-patch images for skinned widget backgrounds
+ *
+ *                  With \ref GUI_CFG_USE_SPRITE_CACHE enabled, source rows with stretched
+ *                  middle columns are kept in sprite cache per drawn width
+ *                  and each nine-patch row band is drawn with single image blit.
+ *
+ * \sa              gui_draw_ninepatch
+ */
+#ifndef GUI_CFG_USE_NINEPATCH
+#define GUI_CFG_USE_NINEPATCH                   0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) scaled and rotated image drawing
+ *
+ * \sa              GUI_CFG_IMAGE_TRANSFORM_BUFFER_SIZE, gui_draw_image_transform
+ */
+#ifndef GUI_CFG_USE_IMAGE_TRANSFORM
+#define GUI_CFG_USE_IMAGE_TRANSFORM             0
+#endif
+
+/**
+ * \brief           Maximal number of bytes for transformed image rows, allocated while drawing
+ *
+ *                  Rows are rendered to `32BPP` buffer, each row is then drawn with image blit.
+ *                  Larger buffers let low-level driver draw previous rows while next rows are rendered.
+ *
+ * \note            Used only when \ref GUI_CFG_USE_IMAGE_TRANSFORM is enabled
+ */
+#ifndef GUI_CFG_IMAGE_TRANSFORM_BUFFER_SIZE
+#define GUI_CFG_IMAGE_TRANSFORM_BUFFER_SIZE     0x1000
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) pre-rendered window wallpaper
+ *
+ *                  Background color and wallpaper image of window, see \ref gui_window_setwallpaper,
+ *                  are rendered once to buffer of window size.
+ *                  Every redraw of window background is then single `Copy` from buffer instead of fill and image draw.
+ *
+ * \note            When buffer cannot be allocated, background is drawn directly
+ */
+#ifndef GUI_CFG_USE_WALLPAPER_CACHE
+#define GUI_CFG_USE_WALLPAPER_CACHE             1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) pre-rendered dial of gauge widget
+ *
+ *                  Background, face, scale and labels of gauge are rendered once to buffer of widget size.
+ *                  Redraw after value change copies dial only around old and new needle position
+ *                  and draws needle over it.
+ *
+ * \note            When buffer cannot be allocated, dial is drawn directly
+ */
+#ifndef GUI_CFG_USE_GAUGE_CACHE
+#define GUI_CFG_USE_GAUGE_CACHE                 1
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) lossless tile compression of retained layers
+ *
+ *                  Widget cache layers, window wallpaper and gauge dial buffers are split to tiles
+ *                  of \ref GUI_CFG_LAYER_COMPRESSION_TILE_SIZE pixels after they are rendered.
+ *                  Tiles of single color are marked in tile map and copy of layer to screen
+ *                  fills them with low-level `Fill` function instead of reading layer memory,
+ *                  neighbouring tiles are merged to single operation.
+ *                  Mostly flat colored areas are then copied with fraction of memory reads
+ *
+ * \note            Transparent widgets are still blended from complete cache layer
+ */
+#ifndef GUI_CFG_USE_LAYER_COMPRESSION
+#define GUI_CFG_USE_LAYER_COMPRESSION           0
+#endif
+
+/**
+ * \brief           Width and height of tile of compressed layer in units of pixels
+ *
+ *                  Smaller tiles find more solid areas, but increase tile map size
+ *                  and number of low-level operations for each copy
+ */
+#ifndef GUI_CFG_LAYER_COMPRESSION_TILE_SIZE
+#define GUI_CFG_LAYER_COMPRESSION_TILE_SIZE     16
+#endif
+
+/**
+ * \brief           Size of buffer in units of bytes for composing glyphs of text line
+ *
+ *                  When low-level layer supports `CopyChar` function, visible glyphs of each text line
+ *                  are copied to `A8` buffer and blended with single `CopyChar` call instead of one call per glyph.
+ *                  Lines which do not fit to buffer are split to multiple runs.
+ *
+ * \note            Two buffers of this size are allocated statically, next run is composed
+ *                  while low-level may still blend previous one. Set to `0` to draw each glyph separately
+ */
+#ifndef GUI_CFG_DRAW_TEXT_RUN_SIZE
+#define GUI_CFG_DRAW_TEXT_RUN_SIZE              2048
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) SIMD instructions in software low-level kernels
+ *
+ *                  When enabled and compiler targets `SSE2`, fill, blend and
+ *                  character copy kernels of \ref GUI_LL_SW process `4` pixels at a time.
+ *                  Portable kernels use word-wide stores and blend `2` channels per multiplication.
+ */
+#ifndef GUI_CFG_LL_SW_USE_SIMD
+#define GUI_CFG_LL_SW_USE_SIMD                  1
+#endif
+
+/**
+ * \brief           Maximal number of redraw operations per second
+ *
+ *                  New frame is not started earlier than `1000 / GUI_CFG_FRAME_RATE` milliseconds
+ *                  after previous layer change was confirmed by \ref gui_lcd_confirmactivelayer
+ *                  or previous redraw started, when layer confirmation is not used.
+ *                  Invalidations received meanwhile are batched to single redraw.
+ *
+ * \note            Set to `0` to redraw as fast as possible
+ */
+#ifndef GUI_CFG_FRAME_RATE
+#define GUI_CFG_FRAME_RATE                      0
+#endif
+
+/**
+ * \brief           Redraw coalescing window in units of milliseconds
+ *
+ *                  Redraw is postponed for up to this time after first invalidation
+ *                  so that burst of invalidations (such as adding many values to graph)
+ *                  is drawn in single frame. It adds bounded latency to screen update.
+ *
+ * \note            Set to `0` to disable coalescing window
+ */
+#ifndef GUI_CFG_REDRAW_COALESCE_TIME
+#define GUI_CFG_REDRAW_COALESCE_TIME            0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) frame and widget draw cost profiler
+ *
+ *                  Cycles are counted for timers, touch processing, redraw and
+ *                  draw callbacks of each widget type and widget ID
+ *
+ * \sa              gui_profiler_getframes, gui_profiler_getwidgets
+ */
+#ifndef GUI_CFG_USE_PROFILER
+#define GUI_CFG_USE_PROFILER                    0
+#endif
+
+/**
+ * \brief           Get current value of free running cycle counter for profiler
+ *
+ * \note            Default implementation uses system time in units of milliseconds.
+ *                  Overwrite it with platform counter, such as `DWT->CYCCNT` on Cortex-M
+ *                  or `QueryPerformanceCounter` on Win32
+ */
+#ifndef GUI_CFG_PROFILER_CYCLES
+#define GUI_CFG_PROFILER_CYCLES()               gui_sys_now()
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) event trace recorder
+ *
+ *                  Frame start and end, thread wakeups, touch input and processing,
+ *                  timer callbacks and layer swaps are recorded with timestamp to ring buffer
+ *
+ * \sa              gui_trace_read, gui_trace_export_json, GUI_CFG_TRACE_HOOK
+ */
+#ifndef GUI_CFG_USE_TRACE
+#define GUI_CFG_USE_TRACE                       0
+#endif
+
+/**
+ * \brief           Number of events in trace ring buffer
+ * \note            Value must be power of `2`
+ */
+#ifndef GUI_CFG_TRACE_SIZE
+#define GUI_CFG_TRACE_SIZE                      256
+#endif
+
+/**
+ * \brief           Get timestamp for trace events
+ *
+ *                  Same counter as profiler is used by default
+ */
+#ifndef GUI_CFG_TRACE_TIMESTAMP
+#define GUI_CFG_TRACE_TIMESTAMP()               GUI_CFG_PROFILER_CYCLES()
+#endif
+
+/**
+ * \brief           Convert trace timestamp to microseconds for JSON export
+ * \note            Default conversion expects timestamp in units of milliseconds
+ */
+#ifndef GUI_CFG_TRACE_TO_US
+#define GUI_CFG_TRACE_TO_US(time)               ((uint64_t)(time) * 1000)
+#endif
+
+/**
+ * \brief           Hook called for every recorded trace event
+ *
+ *                  Use it to forward events to target tracing tool.
+ *                  With SEGGER SystemView, register module with event names from \ref gui_trace_getname
+ *                  and define hook as `SEGGER_SYSVIEW_RecordU32(module.EventOffset + (id), (arg))`
+ *
+ * \note            Hook may be called from interrupt context when touch is added with \ref gui_input_touchadd_isr
+ */
+#ifndef GUI_CFG_TRACE_HOOK
+#define GUI_CFG_TRACE_HOOK(id, arg)             do {} while (0)
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) pixel throughput counters of low-level drawing functions
+ *
+ *                  Low-level functions are called through counting wrappers
+ *                  and statistics of last frame are available with \ref gui_stats_get
+ */
+#ifndef GUI_CFG_USE_LL_STATS
+#define GUI_CFG_USE_LL_STATS                    0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) low-level functions bound at compile time
+ *
+ *                  Core calls low-level functions defined by \ref GUI_CFG_LL_STATIC_HEADER directly
+ *                  instead of through pointers of \ref gui_ll_t structure.
+ *                  Checks for optional functions are then resolved by compiler
+ *                  and driver functions defined `static inline` in header may be inlined to drawing routines
+ */
+#ifndef GUI_CFG_LL_STATIC
+#define GUI_CFG_LL_STATIC                       0
+#endif
+
+/**
+ * \brief           Header with low-level functions bound at compile time, used when \ref GUI_CFG_LL_STATIC is enabled
+ *
+ *                  For every bound member of \ref gui_ll_t, header defines `GUI_LL_STATIC_Name` to driver function,
+ *                  or to `GUI_LL_STATIC_NONE(Name)` when driver does not support it.
+ *                  Members not defined by header are still called through \ref gui_ll_t structure
+ *
+ * \sa              gui_ll_sw_static.h
+ */
+#ifndef GUI_CFG_LL_STATIC_HEADER
+#define GUI_CFG_LL_STATIC_HEADER                "system/gui_ll_sw_static.h"
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) extended low-level functions of vector GPUs
+ *
+ *                  Adds members to \ref gui_ll_t for anti-aliased rounded rectangles, gradients,
+ *                  vector icon paths, anti-aliased lines and scaled and rotated image blits.
+ *                  Core draw functions forward to them when set and fall back to software when
+ *                  member is `NULL` or returns `0`. After each dirty region is drawn,
+ *                  \ref GUI_LL_Command_Submit is sent to let driver submit recorded commands at once
+ *
+ * \sa              gui_ll_vglite.c
+ */
+#ifndef GUI_CFG_USE_LL_GPU
+#define GUI_CFG_USE_LL_GPU                      0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) direct CPU access to layer memory in software drawing paths
+ *
+ *                  Pixels of anti-aliased characters, alpha coverage blends, single pixels and
+ *                  software blend of transparent widgets are read and written in row loops directly in memory
+ *                  instead of with `SetPixel` and `GetPixel` functions for each pixel.
+ *                  Access to layer is queried once with \ref GUI_LL_Command_GetLayerAccess.
+ *                  Layers of rotated display and layers not addressable by CPU are drawn with low-level functions
+ *
+ * \note            When access requires fence, core waits for pending hardware operations before each row loop
+ *                  and single pixels are still drawn with low-level functions
+ */
+#ifndef GUI_CFG_USE_LL_DIRECT_ACCESS
+#define GUI_CFG_USE_LL_DIRECT_ACCESS            0
+#endif
+
+#if GUI_CFG_LL_STATIC && GUI_CFG_USE_LL_STATS
+#error "GUI_CFG_LL_STATIC cannot be used with GUI_CFG_USE_LL_STATS"
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) display orientation handled by core
+ *
+ *                  Low-level driver sets physical size of LCD and `orientation` member of \ref gui_lcd_t in `Init` function.
+ *                  Widgets are laid out on logical screen and each low-level drawing call
+ *                  is mapped once to rotated rectangle of physical layer memory.
+ *                  Fills stay single rectangle operations, source pixels are rotated to strips of
+ *                  \ref GUI_CFG_LCD_ROTATION_BUFFER_SIZE bytes before they are passed to driver
+ *                  and raw memory mapped images are kept pre-rotated in cache of \ref GUI_CFG_LCD_ROTATION_CACHE_SIZE bytes
+ *
+ * \sa              gui_lcd_orientation_t
+ */
+#ifndef GUI_CFG_USE_LCD_ROTATION
+#define GUI_CFG_USE_LCD_ROTATION                0
+#endif
+
+/**
+ * \brief           Maximal number of bytes for rotated source pixels, allocated while drawing
+ *
+ * \note            Used only when \ref GUI_CFG_USE_LCD_ROTATION is enabled
+ */
+#ifndef GUI_CFG_LCD_ROTATION_BUFFER_SIZE
+#define GUI_CFG_LCD_ROTATION_BUFFER_SIZE        0x1000
+#endif
+
+/**
+ * \brief           Maximal number of bytes used by pre-rotated images
+ *
+ *                  Images are rotated once on first draw and kept in cache until least recently used image is removed.
+ *                  Images with \ref GUI_FLAG_IMAGE_VOLATILE flag are never kept.
+ *                  Set to `0` to rotate image pixels on each draw
+ *
+ * \note            Used only when \ref GUI_CFG_USE_LCD_ROTATION is enabled
+ */
+#ifndef GUI_CFG_LCD_ROTATION_CACHE_SIZE
+#define GUI_CFG_LCD_ROTATION_CACHE_SIZE         0x10000
+#endif
+
+#if GUI_CFG_USE_LCD_ROTATION && GUI_CFG_LL_STATIC
+#error "GUI_CFG_USE_LCD_ROTATION cannot be used with GUI_CFG_LL_STATIC"
+#endif
+#if GUI_CFG_USE_LCD_ROTATION && (GUI_CFG_USE_BAND_RENDERING || GUI_CFG_USE_OVERLAY)
+#error "GUI_CFG_USE_LCD_ROTATION cannot be used with GUI_CFG_USE_BAND_RENDERING or GUI_CFG_USE_OVERLAY"
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) redraw debug overlay
+ *
+ *                  Dirty regions of each frame may be outlined on screen and
+ *                  number of widget draws per pixel may be accumulated to heatmap
+ *                  buffer of `1` byte per pixel, allocated when enabled with \ref gui_redrawdebug_setmode
+ */
+#ifndef GUI_CFG_USE_REDRAW_DEBUG
+#define GUI_CFG_USE_REDRAW_DEBUG                0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) touch-to-photon latency measurement
+ *
+ *                  Touch entry which invalidates any widget is followed until
+ *                  frame with its result is confirmed by low-level layer.
+ *                  Only single touch is measured at a time, touches received meanwhile are ignored
+ *
+ * \sa              gui_latency_get, gui_latency_reset
+ */
+#ifndef GUI_CFG_USE_LATENCY
+#define GUI_CFG_USE_LATENCY                     0
+#endif
+
+/**
+ * \brief           Number of recent latency samples used for percentile calculation
+ */
+#ifndef GUI_CFG_LATENCY_SAMPLES
+#define GUI_CFG_LATENCY_SAMPLES                 128
+#endif
+
+/**
+ * \brief           Number of recent frames kept by profiler
+ */
+#ifndef GUI_CFG_PROFILER_FRAMES
+#define GUI_CFG_PROFILER_FRAMES                 16
+#endif
+
+/**
+ * \brief           Maximal number of widget types counted by profiler
+ */
+#ifndef GUI_CFG_PROFILER_TYPES
+#define GUI_CFG_PROFILER_TYPES                  16
+#endif
+
+/**
+ * \brief           Maximal number of widget IDs counted by profiler
+ */
+#ifndef GUI_CFG_PROFILER_IDS
+#define GUI_CFG_PROFILER_IDS                    32
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) releasing core protection during redraw
+ *
+ *                  Dirty regions are moved to frame snapshot when redraw starts.
+ *                  Between dirty regions (or bands) core protection is released
+ *                  so that API calls from other threads do not wait for complete frame.
+ *                  Widgets invalidated meanwhile are drawn in next frame
+ *
+ * \note            Used only when \ref GUI_CFG_OS is enabled
+ */
+#ifndef GUI_CFG_REDRAW_YIELD
+#define GUI_CFG_REDRAW_YIELD                    0
+#endif
+
+/**
+ * \brief           Time budget for drawing in single processing pass in units of milliseconds
+ *
+ *                  When frame takes longer, its drawing is stopped and continued by next \ref gui_process call,
+ *                  so that timers and input are processed in between. Frame is drawn on drawing layer
+ *                  and given to display only when all dirty regions are drawn.
+ *                  Set to `0` to draw every frame in single pass
+ *
+ * \note            Used only with double or triple buffering,
+ *                  not with \ref GUI_CFG_USE_BAND_RENDERING or \ref GUI_CFG_USE_DIRECT_RENDERING
+ */
+#ifndef GUI_CFG_REDRAW_BUDGET
+#define GUI_CFG_REDRAW_BUDGET                   0
+#endif
+
+/**
+ * \brief           Height of strip in units of lines, dirty regions are split to when drawn with budget
+ *
+ *                  Budget is checked after each strip, so large region does not block input for complete frame
+ *
+ * \note            Used only when \ref GUI_CFG_REDRAW_BUDGET is enabled
+ */
+#ifndef GUI_CFG_REDRAW_BUDGET_LINES
+#define GUI_CFG_REDRAW_BUDGET_LINES             32
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` per-widget refresh rate limit and redraw priorities
+ *
+ *                  Widget set with \ref gui_widget_setrefreshrate is redrawn at most once per its period,
+ *                  invalidations in between are merged to single redraw at the end of period.
+ *                  While frames take longer than \ref GUI_CFG_REFRESH_FRAME_BUDGET, widgets with lower priority
+ *                  set with \ref gui_widget_setpriority are redrawn less often to keep input response
+ */
+#ifndef GUI_CFG_USE_REFRESH_LIMIT
+#define GUI_CFG_USE_REFRESH_LIMIT               0
+#endif
+
+/**
+ * \brief           Maximal time of drawing single frame in units of milliseconds before lower priority widgets are deferred
+ *
+ * \note            Used only when \ref GUI_CFG_USE_REFRESH_LIMIT is enabled
+ */
+#ifndef GUI_CFG_REFRESH_FRAME_BUDGET
+#define GUI_CFG_REFRESH_FRAME_BUDGET            20
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` idle refresh mode of display
+ *
+ *                  When nothing is redrawn, touch is not pressed and no input is received for \ref GUI_CFG_IDLE_REFRESH_TIMEOUT milliseconds,
+ *                  \ref GUI_LL_Command_SetRefreshMode command sets \ref GUI_REFRESH_MODE_IDLE mode,
+ *                  so driver can lower refresh rate and release memory bandwidth used by scan-out.
+ *                  Normal mode is set again on input or invalidation, before frame is drawn
+ */
+#ifndef GUI_CFG_USE_IDLE_REFRESH
+#define GUI_CFG_USE_IDLE_REFRESH                0
+#endif
+
+/**
+ * \brief           Time in units of milliseconds without redraw and input before display is set to idle refresh mode
+ *
+ * \note            Used only when \ref GUI_CFG_USE_IDLE_REFRESH is enabled
+ */
+#ifndef GUI_CFG_IDLE_REFRESH_TIMEOUT
+#define GUI_CFG_IDLE_REFRESH_TIMEOUT            2000
+#endif
+
+/**
+ * \brief           Number of displays driven by single GUI instance
+ *
+ *                  Each display has its own low-level driver, layers, dirty regions, timers, image caches and widget tree with desktop window.
+ *                  Character cache, widget pools, translations and heap are shared.
+ *                  Display is added with \ref gui_display_add and widget API calls use display set with \ref gui_display_select.
+ *                  Frame rate, coalescing and waiting for layer confirmation are handled per display,
+ *                  so display waiting for its driver does not block redraw of others.
+ *                  Displays are still drawn one after another by GUI thread
+ *
+ * \note            Touch and keyboard inputs and widget commands from other threads are processed for display `0`.
+ *                  Drivers confirm layers with \ref gui_display_confirmactivelayer
+ */
+#ifndef GUI_CFG_DISPLAY_COUNT
+#define GUI_CFG_DISPLAY_COUNT                   1
+#endif
+
+#if GUI_CFG_DISPLAY_COUNT > 1 && GUI_CFG_LL_STATIC
+#error "GUI_CFG_LL_STATIC cannot be used with more than one display"
+#endif
+#if GUI_CFG_DISPLAY_COUNT > 1 && (GUI_CFG_REDRAW_BUDGET || GUI_CFG_REDRAW_YIELD)
+#error "GUI_CFG_REDRAW_BUDGET and GUI_CFG_REDRAW_YIELD cannot be used with more than one display"
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` kinetic scrolling of list widgets
+ *
+ *                  When enabled, list widgets continue to scroll after touch is released
+ *                  with velocity of last touch movement and decelerate on each frame.
+ */
+#ifndef GUI_CFG_USE_KINETIC_SCROLL
+#define GUI_CFG_USE_KINETIC_SCROLL              1
+#endif
+
+/**
+ * \brief           Kinetic scroll animation period in units of milliseconds
+ */
+#ifndef GUI_CFG_KINETIC_PERIOD
+#if GUI_CFG_FRAME_RATE
+#define GUI_CFG_KINETIC_PERIOD                  (1000 / GUI_CFG_FRAME_RATE)
+#else
+#define GUI_CFG_KINETIC_PERIOD                  20
+#endif
+#endif
+
+/**
+ * \brief           Period of reading stream attached to debugbox in units of milliseconds
+ *
+ *                  Data written to stream by other threads are read and split to lines
+ *                  at most once per period, see \ref gui_debugbox_setstream
+ */
+#ifndef GUI_CFG_DEBUGBOX_STREAM_PERIOD
+#if GUI_CFG_FRAME_RATE
+#define GUI_CFG_DEBUGBOX_STREAM_PERIOD          (1000 / GUI_CFG_FRAME_RATE)
+#else
+#define GUI_CFG_DEBUGBOX_STREAM_PERIOD          20
+#endif
+#endif
+
+/**
+ * \brief           Edittext cursor blink period in units of milliseconds
+ *
+ *                  Cursor is shown after the end of text when widget is in focus.
+ *                  Each blink only invalidates cursor rectangle, not complete widget.
+ *                  Set to `0` to disable cursor
+ */
+#ifndef GUI_CFG_EDITTEXT_CURSOR_PERIOD
+#define GUI_CFG_EDITTEXT_CURSOR_PERIOD          500
+#endif
+
+/**
+ * \brief           Edittext cursor width in units of pixels
+ */
+#ifndef GUI_CFG_EDITTEXT_CURSOR_WIDTH
+#define GUI_CFG_EDITTEXT_CURSOR_WIDTH           2
+#endif
+
+/**
+ * \brief           Kinetic scroll velocity decrease on each animation period in units of `1/256`
+ */
+#ifndef GUI_CFG_KINETIC_DECAY
+#define GUI_CFG_KINETIC_DECAY                   20
+#endif
+
+/**
+ * \brief           Minimal kinetic scroll velocity in units of pixels per second
+ *
+ *                  Scroll is not started or is stopped when velocity is lower than this value
+ */
+#ifndef GUI_CFG_KINETIC_MIN_SPEED
+#define GUI_CFG_KINETIC_MIN_SPEED               100
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` touch gesture recognizer
+ *
+ *                  Swipe, fling, pinch and rotate gestures are sent to widget with \ref GUI_EVT_GESTURE event.
+ *                  Touch samples received during single \ref gui_process call are coalesced
+ *                  and gestures are calculated once per process call with integer math only.
+ *
+ *                  Kinetic scroll of list widgets uses velocity calculated by gesture recognizer.
+ *
+ * \note            When enabled, `distance` and `distance_old` fields of touch data are not calculated.
+ *                  Use \ref GUI_GESTURE_PINCH gesture instead
+ */
+#ifndef GUI_CFG_USE_GESTURE
+#define GUI_CFG_USE_GESTURE                     0
+#endif
+
+/**
+ * \brief           Minimal swipe gesture displacement in units of pixels
+ */
+#ifndef GUI_CFG_GESTURE_SWIPE_MIN
+#define GUI_CFG_GESTURE_SWIPE_MIN               40
+#endif
+
+/**
+ * \brief           Maximal swipe gesture duration from touch press to release in units of milliseconds
+ */
+#ifndef GUI_CFG_GESTURE_SWIPE_TIME
+#define GUI_CFG_GESTURE_SWIPE_TIME              400
+#endif
+
+/**
+ * \brief           Minimal touch velocity on release for fling gesture in units of pixels per second
+ */
+#ifndef GUI_CFG_GESTURE_FLING_SPEED
+#define GUI_CFG_GESTURE_FLING_SPEED             500
+#endif
+
+/**
+ * \brief           Default slack of software timers in units of percent of timer period
+ *
+ *                  Timer may expire up to slack later than its period, so that timers
+ *                  expiring close together are processed in single pass and produce single redraw.
+ *                  Periodic timers keep their phase, delay does not accumulate.
+ *                  Set to `0` to process each timer exactly on its expiry
+ *
+ * \sa              guii_timer_setslack
+ */
+#ifndef GUI_CFG_TIMER_SLACK
+#define GUI_CFG_TIMER_SLACK                     10
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` animation engine for widget properties
+ *
+ *                  Position, size, alpha, scroll and value animations of all widgets
+ *                  are driven from single timer and applied in single invalidation batch per frame.
+ *
+ * \sa              gui_anim_start, gui_anim_startvalue
+ */
+#ifndef GUI_CFG_USE_ANIM
+#define GUI_CFG_USE_ANIM                        1
+#endif
+
+/**
+ * \brief           Animation engine frame period in units of milliseconds
+ */
+#ifndef GUI_CFG_ANIM_PERIOD
+#if GUI_CFG_FRAME_RATE
+#define GUI_CFG_ANIM_PERIOD                     (1000 / GUI_CFG_FRAME_RATE)
+#else
+#define GUI_CFG_ANIM_PERIOD                     16
+#endif
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` screen transitions
+ *
+ *                  Outgoing and incoming screens are rendered once to screen sized buffers,
+ *                  each frame of slide or push transition only composes them at new offset.
+ *                  When low-level supports \ref GUI_LL_Command_SetOverlay and `2` planes are free,
+ *                  buffers are shown on planes and only plane positions are changed.
+ *                  Otherwise buffers are copied to drawing layer, once per frame.
+ *
+ * \note            Requires \ref GUI_CFG_USE_ANIM and memory for `2` screen sized buffers
+ * \sa              gui_anim_transition
+ */
+#ifndef GUI_CFG_USE_TRANSITION
+#define GUI_CFG_USE_TRANSITION                  0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) band rendering mode for systems without full frame buffer
+ *
+ *                  Low-level driver provides single layer with memory for only few lines of screen.
+ *                  It must set `width` and `height` of layer to size of available buffer in units of pixels.
+ *                  Dirty regions are split to bands which fit into buffer, each band is redrawn
+ *                  and sent to display with \ref GUI_LL_Command_FlushBand command.
+ *
+ *                  When driver provides second layer with band memory, bands are drawn to both buffers
+ *                  in turns so that transfer of previous band (DMA or second core) overlaps drawing of next one.
+ *
+ * \note            In this mode all widgets inside band are redrawn as there is no frame buffer to copy content from
+ */
+#ifndef GUI_CFG_USE_BAND_RENDERING
+#define GUI_CFG_USE_BAND_RENDERING              0
+#endif
+
+#if GUI_CFG_USE_TRANSITION && (!GUI_CFG_USE_ANIM || GUI_CFG_USE_BAND_RENDERING)
+#error "GUI_CFG_USE_TRANSITION requires GUI_CFG_USE_ANIM and cannot be used with GUI_CFG_USE_BAND_RENDERING"
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) triple buffering
+ *
+ *                  When low-level driver provides at least `3` full screen layers,
+ *                  next frame is drawn to free layer while swap to previous frame still waits for confirmation.
+ *                  Layer with oldest content is used and only regions changed in frames drawn since are copied to it.
+ *
+ *                  When layer is requested before previous request was confirmed,
+ *                  driver may show only latest one and confirm it, older pending layers are released on confirmation.
+ *
+ * \note            With less than `3` layers double buffering is used
+ */
+#ifndef GUI_CFG_USE_TRIPLE_BUFFERING
+#define GUI_CFG_USE_TRIPLE_BUFFERING            0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) direct rendering to single frame buffer
+ *
+ *                  Widgets are drawn directly to layer which is scanned out to display,
+ *                  there is no second frame buffer and no copy between layers.
+ *
+ *                  To avoid tearing, dirty regions are drawn only after display scan-out has passed them.
+ *                  Driver reports current line with \ref GUI_LL_Command_GetScanLine
+ *                  and may block until line with \ref GUI_LL_Command_WaitScanLine, for example on line interrupt.
+ *                  When driver supports neither command, regions are drawn immediately
+ *
+ * \note            Not used together with \ref GUI_CFG_USE_BAND_RENDERING or \ref GUI_CFG_USE_TRIPLE_BUFFERING
+ */
+#ifndef GUI_CFG_USE_DIRECT_RENDERING
+#define GUI_CFG_USE_DIRECT_RENDERING            0
+#endif
+
+#if GUI_CFG_USE_DIRECT_RENDERING && (GUI_CFG_USE_BAND_RENDERING || GUI_CFG_USE_TRIPLE_BUFFERING)
+#error "GUI_CFG_USE_DIRECT_RENDERING cannot be used with band rendering or triple buffering"
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) copy of moved widget pixels instead of redraw
+ *
+ *                  When opaque widget with unchanged content is moved with position functions,
+ *                  its pixels are copied from previous frame to new position with `Copy` low-level function.
+ *                  Only background uncovered at old position is redrawn.
+ *
+ *                  Widget must be fully visible at both positions and not overlapped by any widget above it,
+ *                  otherwise it is redrawn as usual.
+ *
+ * \note            Requires at least `2` layers, not used with \ref GUI_CFG_USE_BAND_RENDERING or \ref GUI_CFG_USE_DIRECT_RENDERING
+ */
+#ifndef GUI_CFG_USE_COPY_MOVE
+#if GUI_CFG_USE_BAND_RENDERING || GUI_CFG_USE_DIRECT_RENDERING
+#define GUI_CFG_USE_COPY_MOVE                   0
+#else
+#define GUI_CFG_USE_COPY_MOVE                   1
+#endif
+#endif
+
+#if GUI_CFG_USE_COPY_MOVE && (GUI_CFG_USE_BAND_RENDERING || GUI_CFG_USE_DIRECT_RENDERING)
+#error "GUI_CFG_USE_COPY_MOVE cannot be used with band rendering or direct rendering"
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) saving of pixels below popup widgets
+ *
+ *                  When dropdown opens or dialog is created, pixels of newest frame below it
+ *                  are saved to memory on first frame it is drawn.
+ *                  When popup closes, saved pixels are copied back with single `Copy` low-level call
+ *                  and widgets below popup are not redrawn.
+ *
+ *                  Saved pixels are dropped and area is redrawn as usual
+ *                  when any widget below popup is invalidated while popup is opened.
+ *
+ * \note            Memory for all pixels of popup area is allocated while popup is opened.
+ *                  Popups shown on overlay plane with \ref GUI_CFG_USE_OVERLAY do not need it.
+ *                  Not used with \ref GUI_CFG_USE_BAND_RENDERING or \ref GUI_CFG_USE_DIRECT_RENDERING
+ */
+#ifndef GUI_CFG_USE_POPUP_RESTORE
+#define GUI_CFG_USE_POPUP_RESTORE               0
+#endif
+
+#if GUI_CFG_USE_POPUP_RESTORE && (GUI_CFG_USE_BAND_RENDERING || GUI_CFG_USE_DIRECT_RENDERING)
+#error "GUI_CFG_USE_POPUP_RESTORE cannot be used with band rendering or direct rendering"
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) remote display stream
+ *
+ *                  Dirty rectangles of each finished frame are encoded to `RGB565` with run-length encoding
+ *                  and written to transport callback set with \ref gui_remote_start.
+ *                  Encoder is deferred work, see \ref GUI_CFG_USE_DEFER, and reads newest frame
+ *                  on its layer without core protection. Only next frame to be drawn on that layer waits for it.
+ *                  Touch input of viewer is passed back with \ref gui_remote_receive.
+ *                  Screenshot of entire screen is taken with \ref gui_remote_capture
+ *
+ * \note            Rectangles of frames finished while encoder is busy are merged and sent with next batch.
+ *                  With snapshot buffer set by \ref gui_remote_setsnapshot, layers are not held by encoder
+ */
+#ifndef GUI_CFG_USE_REMOTE
+#define GUI_CFG_USE_REMOTE                      0
+#endif
+
+#if GUI_CFG_USE_REMOTE && !GUI_CFG_USE_DEFER
+#error "GUI_CFG_USE_REMOTE requires GUI_CFG_USE_DEFER"
+#endif
+#if GUI_CFG_USE_REMOTE && (GUI_CFG_USE_BAND_RENDERING || GUI_CFG_USE_DIRECT_RENDERING || GUI_CFG_DISPLAY_COUNT > 1)
+#error "GUI_CFG_USE_REMOTE cannot be used with band rendering, direct rendering or more than one display"
+#endif
+
+/**
+ * \brief           Maximal number of rectangles waiting for remote encoder
+ *
+ *                  When list is full, new rectangle is merged with one growing least
+ */
+#ifndef GUI_CFG_REMOTE_RECTS
+#define GUI_CFG_REMOTE_RECTS                    8
+#endif
+
+/**
+ * \brief           Size of remote stream buffer in units of bytes
+ *
+ *                  Encoded stream is written to transport callback in chunks of this size
+ */
+#ifndef GUI_CFG_REMOTE_BUFF_SIZE
+#define GUI_CFG_REMOTE_BUFF_SIZE                512
+#endif
+
+#if GUI_CFG_USE_REMOTE && GUI_CFG_REMOTE_BUFF_SIZE < 16
+#error "GUI_CFG_REMOTE_BUFF_SIZE must be at least 16"
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) drawing of each virtual keyboard layout as single widget
+ *
+ *                  When enabled, keys are drawn directly from constant keymap table
+ *                  instead of creating button widget for each key.
+ *                  Press and release of key redraws only rectangle of that key.
+ */
+#ifndef GUI_CFG_KEYBOARD_SINGLE_WIDGET
+#define GUI_CFG_KEYBOARD_SINGLE_WIDGET          0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) precomputed focus graph for navigation with keys and rotary encoder
+ *
+ *                  Up, down, left and right neighbours of all visible and enabled widgets are calculated
+ *                  once after widget tree or layout changes, on first navigation key.
+ *                  Arrow and TAB keys, not handled by focused widget, then move focus without widget tree scan.
+ *
+ * \note            Requires \ref GUI_CFG_USE_KEYBOARD to be enabled
+ * \sa              gui_focus_move
+ */
+#ifndef GUI_CFG_USE_FOCUS_GRAPH
+#define GUI_CFG_USE_FOCUS_GRAPH                 0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) automatic layout of children widgets
+ *
+ *                  Widget with children support can arrange its children in row, column or grid
+ *                  with \ref gui_widget_setlayout function instead of using positions set by user.
+ *
+ *                  Children positions are calculated in single measure and arrange pass
+ *                  and result is cached in widget. Only widgets marked with changed layout
+ *                  (child added, removed, resized, shown or hidden or size of widget changed)
+ *                  are arranged again on next \ref gui_process call.
+ */
+#ifndef GUI_CFG_USE_LAYOUT
+#define GUI_CFG_USE_LAYOUT                      0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) per event dispatch table of widget types
+ *
+ *                  Widget type may set table of handlers, indexed by event type.
+ *                  Events without handler in table are not delivered to widget callback at all,
+ *                  which removes function call and `switch` statement for frequent events
+ *                  (touch move, draw after) on widgets not handling them.
+ *
+ *                  Widgets without table receive all events on widget callback function
+ */
+#ifndef GUI_CFG_USE_WIDGET_EVT_TABLE
+#define GUI_CFG_USE_WIDGET_EVT_TABLE            0
 #endif
 
 #ifndef GUI_CFG_SYS_PORT
@@ -0,0 +1,75 @@
+/**	
+ * \file            gui_defer.h
+ * \brief           Deferred work queue
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_DEFER_H
+#define GUI_HDR_DEFER_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_utils.h"
+
+/**
+ * \ingroup         GUI_UTILS
+ * \defgroup        GUI_DEFER Deferred work
+ * \brief           Bounded queue of work processed outside core protection
+ *
+ *                  Timer and widget callbacks run with core protection on GUI thread,
+ *                  slow work called from them delays the frame. Such work, which does not draw,
+ *                  is posted with \ref gui_defer and processed by worker thread
+ *                  when \ref GUI_CFG_OS and \ref GUI_CFG_DEFER_THREAD are enabled,
+ *                  or by GUI thread at the end of \ref gui_process after core protection is released.
+ *
+ *                  Deferred function must not access widgets directly.
+ *                  Results are applied back with \ref gui_widget_post_int or \ref gui_widget_post_text
+ * \{
+ */
+
+uint8_t     gui_defer(gui_defer_fn fn, void* arg);
+
+void        guii_defer_init(void);
+void        guii_defer_process(void);
+uint8_t     guii_defer_pending(void);
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_DEFER_H */
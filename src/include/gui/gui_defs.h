@@ -83,6 +83,16 @@ extern "C" {
 #define GUI_FLAG_IGNORE_INVALIDATE          ((uint32_t)0x00004000)  /*!< Indicates widget invalidation is ignored completely when invalidating it directly */
 #define GUI_FLAG_FIRST_INVALIDATE           ((uint32_t)0x00008000)  /*!< Indicates widget is invalidated for "first" time, thus ignore check if parent is hidden or not */
 #define GUI_FLAG_TOUCH_MOVE                 ((uint32_t)0x00010000)  /*!< Indicates widget callback has processed touch move event. This parameter works in conjunction with \ref GUI_FLAG_ACTIVE flag */
+#define GUI_FLAG_ABS_DIRTY                  ((uint32_t)0x00020000)  /*!< Indicates cached absolute position and size values must be recalculated before use */
+#define GUI_FLAG_INVALIDATE_BATCH           ((uint32_t)0x00200000)  /*!< Indicates widget was invalidated during invalidation batch */
+#define GUI_FLAG_INVALIDATE_BATCH_CLIP      ((uint32_t)0x00400000)  /*!< Indicates widget invalidated during batch should expand clipping region */
+#define GUI_FLAG_CACHE                      ((uint32_t)0x01000000)  /*!< Indicates widget is drawn through offscreen cache layer */
+#define GUI_FLAG_CACHE_VALID                ((uint32_t)0x02000000)  /*!< Indicates content of widget cache layer is up to date */
+#define GUI_FLAG_OVERLAY                    ((uint32_t)0x04000000)  /*!< Indicates widget is shown on hardware overlay plane */
+#define GUI_FLAG_CONST_COLORS               ((uint32_t)0x08000000)  /*!< Indicates `colors` points to constant user list which must not be modified or freed */
+#define GUI_FLAG_LAYOUT_DIRTY               ((uint32_t)0x10000000)  /*!< Indicates children widgets must be arranged again according to widget layout */
+#define GUI_FLAG_HIDDEN_TREE                ((uint32_t)0x20000000)  /*!< Indicates widget itself or any of its parents is not visible. Maintained on show, hide and alpha change */
+#define GUI_FLAG_DISPLAY_LIST               ((uint32_t)0x40000000)  /*!< Indicates widget is drawn from recorded display list when its content did not change */
 
 /**
  * \}
@@ -98,6 +108,7 @@ extern "C" {
 #define GUI_FLAG_WIDGET_ALLOW_CHILDREN      ((uint32_t)0x00040000)  /*!< Widget allows children widgets */
 #define GUI_FLAG_WIDGET_DIALOG_BASE         ((uint32_t)0x00080000)  /*!< Widget is dialog base. When it is active, no other widget around dialog can be pressed */
 #define GUI_FLAG_WIDGET_INVALIDATE_PARENT   ((uint32_t)0x00100000)  /*!< Anytime widget is invalidated, parent should be invalidated too */
+#define GUI_FLAG_WIDGET_OPAQUE              ((uint32_t)0x00800000)  /*!< Widget paints every pixel of its area on draw. Parent drawing is skipped when fully covered by such children */
 
 /**
  * \}
@@ -122,6 +133,20 @@ extern "C" {
 #define GUI_VALIGN_CENTER               (0x01 << 2) /*!< Vertical align is center */
 #define GUI_VALIGN_BOTTOM               (0x02 << 2) /*!< Vertical align is bottom */         
 
+/**
+ * \}
+ */
+
+/**
+ * \anchor          GUI_REDRAW_DEBUG
+ * \name            Redraw debug modes
+ * \brief           Overlays drawn over dirty regions, see \ref gui_redrawdebug_setmode
+ * \{
+ */
+
+#define GUI_REDRAW_DEBUG_REGIONS        0x01/*!< Outline dirty regions of each frame */
+#define GUI_REDRAW_DEBUG_HEATMAP        0x02/*!< Count widget draws per pixel and show counts as color */
+
 /**
  * \}
  */
@@ -203,13 +228,23 @@ typedef struct gui_linkedlistroot {
  * \brief           Core timer structure for GUI timers
  */
 typedef struct gui_timer_core {
-    uint32_t time;                          /*!< Last processed time */
-    gui_linkedlistroot_t list;              /*!< Root linked list object */
+    gui_linkedlistroot_t list;              /*!< Root linked list of active timers, ordered by expiry time */
 } gui_timer_core_t;
 
+/**
+ * \brief           GUI thread idle statistics
+ * \note            Available only when \ref GUI_CFG_OS is enabled
+ */
+typedef struct {
+    uint32_t wakeups;                       /*!< Number of times GUI thread woke up */
+    uint32_t idle_time;                     /*!< Time in units of milliseconds GUI thread was waiting for events */
+    uint32_t busy_time;                     /*!< Time in units of milliseconds GUI thread was processing */
+} gui_idle_stat_t;
+
 typedef uint32_t    gui_id_t;               /*!< GUI object ID */
 typedef uint32_t    gui_color_t;            /*!< Color definition */
 typedef int16_t     gui_dim_t;              /*!< GUI dimensions in units of pixels */
+typedef volatile uint32_t gui_seqlock_t;    /*!< Sequence counter of value read by other threads without core protection */
 typedef uint8_t     gui_char;               /*!< GUI char data type for all string operations */
 #define _GT(x)      (gui_char *)(x)         /*!< Macro to force strings to right format for processing */
 #define gui_const   const                   /*!< Macro for constant keyword */
@@ -251,6 +286,45 @@ typedef uint8_t     gui_char;               /*!< GUI char data type for all stri
 #define GUI_FLOAT(x)                        ((float)(x))        /*!< Result casted to `float` */
 #define GUI_DIM(x)                          ((gui_dim_t)(x))    /*!< Result casted to `gui_dim_t` */
 
+/**
+ * \}
+ */
+
+/**
+ * \defgroup        GUI_COORD Widget coordinates
+ * \brief           Storage type and conversions for widget position and size
+ *
+ *                  With \ref GUI_CFG_USE_COMPACT_HANDLE enabled, values are limited to \ref GUI_COORD_LIMIT
+ *                  and larger values are saturated instead of wrapped around
+ * \{
+ */
+
+#if GUI_CFG_USE_COMPACT_HANDLE
+typedef int16_t gui_coord_t;                /*!< Widget position or size in `Q12.4` format */
+
+#define GUI_COORD_SHIFT                     4   /*!< Number of fractional bits */
+#define GUI_COORD_LIMIT                     2047.9f /*!< Largest absolute value stored without overflow, in units of pixels/percent */
+#define GUI_COORD_CLAMP(x)                  ((float)(x) > GUI_COORD_LIMIT ? GUI_COORD_LIMIT : ((float)(x) < -GUI_COORD_LIMIT ? -GUI_COORD_LIMIT : (float)(x)))   /*!< Limit value to coordinate range */
+#define GUI_COORD(x)                        ((gui_coord_t)(GUI_COORD_CLAMP(x) * (float)(1 << GUI_COORD_SHIFT) + ((x) < 0 ? -0.5f : 0.5f)))  /*!< Convert value to coordinate, saturated to coordinate range */
+#define GUI_COORD_FLOAT(x)                  ((float)(x) / (float)(1 << GUI_COORD_SHIFT))    /*!< Convert coordinate to `float` */
+#define GUI_COORD_PIXELS(x)                 GUI_DIM(((int32_t)(x) + (1 << (GUI_COORD_SHIFT - 1))) >> GUI_COORD_SHIFT)   /*!< Round coordinate to pixels */
+#define GUI_COORD_PERCENT(x, p)             GUI_DIM(((int32_t)(x) * (int32_t)(p) + (50 << GUI_COORD_SHIFT)) / (100 << GUI_COORD_SHIFT))    /*!< Pixels for percent coordinate of `p` pixels */
+#elif GUI_CFG_USE_FIXED_POINT || __DOXYGEN__
+typedef int32_t gui_coord_t;                /*!< Widget position or size in `Q24.8` format */
+
+#define GUI_COORD_SHIFT                     8   /*!< Number of fractional bits */
+#define GUI_COORD(x)                        ((gui_coord_t)((float)(x) * (float)(1 << GUI_COORD_SHIFT) + ((x) < 0 ? -0.5f : 0.5f)))  /*!< Convert value to coordinate */
+#define GUI_COORD_FLOAT(x)                  ((float)(x) / (float)(1 << GUI_COORD_SHIFT))    /*!< Convert coordinate to `float` */
+#define GUI_COORD_PIXELS(x)                 GUI_DIM(((x) + (1 << (GUI_COORD_SHIFT - 1))) >> GUI_COORD_SHIFT)  /*!< Round coordinate to pixels */
+#define GUI_COORD_PERCENT(x, p)             GUI_DIM(((x) * (int32_t)(p) + (50 << GUI_COORD_SHIFT)) / (100 << GUI_COORD_SHIFT))  /*!< Pixels for percent coordinate of `p` pixels */
+#else
+typedef float gui_coord_t;
+#define GUI_COORD(x)                        GUI_FLOAT(x)
+#define GUI_COORD_FLOAT(x)                  (x)
+#define GUI_COORD_PIXELS(x)                 GUI_DIM(x)
+#define GUI_COORD_PERCENT(x, p)             GUI_DIM((float)(x) * (float)(p) / 100.0f + 0.5f)
+#endif /* !(GUI_CFG_USE_COMPACT_HANDLE || GUI_CFG_USE_FIXED_POINT || __DOXYGEN__) */
+
 /**
  * \}
  */
@@ -270,12 +344,22 @@ typedef struct gui_handle* gui_handle_p;
  */
 typedef void (*gui_eventcallback_t)(void);
 
+/**
+ * \brief           Direction of color change of gradient
+ */
+typedef enum {
+    GUI_GRADIENT_HORIZONTAL = 0x00,         /*!< Color changes from left to right edge, each row is copied from color ramp */
+    GUI_GRADIENT_VERTICAL,                  /*!< Color changes from top to bottom edge, each row is filled with single color */
+    GUI_GRADIENT_RADIAL,                    /*!< Color changes from center to corners */
+} gui_gradient_type_t;
+
 /**
  * \brief           Color gradient definition
  */
 typedef struct {
     gui_color_t start;                      /*!< Gradient start color */
     gui_color_t stop;                       /*!< Gradient end color */
+    uint8_t type;                           /*!< Gradient direction, member of \ref gui_gradient_type_t */
 } gui_gradient_t;
 
 /**
@@ -318,6 +402,14 @@ typedef struct {
     gui_dim_t y_rel[GUI_CFG_TOUCH_MAX_PRESSES]; /*!< Relative `Y` position to current widget */
     gui_dim_t x_diff[GUI_CFG_TOUCH_MAX_PRESSES];/*!< `X` difference between old and new touch position */
     gui_dim_t y_diff[GUI_CFG_TOUCH_MAX_PRESSES];/*!< `Y` difference between old and new touch position */
+    int32_t x_speed[GUI_CFG_TOUCH_MAX_PRESSES]; /*!< `X` velocity estimate between old and new touch position in units of pixels per second */
+    int32_t y_speed[GUI_CFG_TOUCH_MAX_PRESSES]; /*!< `Y` velocity estimate between old and new touch position in units of pixels per second */
+#if GUI_CFG_TOUCH_PREDICT || __DOXYGEN__
+    gui_dim_t x_pred[GUI_CFG_TOUCH_MAX_PRESSES];    /*!< `X` prediction offset included in relative position and difference */
+    gui_dim_t y_pred[GUI_CFG_TOUCH_MAX_PRESSES];    /*!< `Y` prediction offset included in relative position and difference */
+    gui_dim_t x_pred_old[GUI_CFG_TOUCH_MAX_PRESSES];/*!< `X` prediction offset of previous sample */
+    gui_dim_t y_pred_old[GUI_CFG_TOUCH_MAX_PRESSES];/*!< `Y` prediction offset of previous sample */
+#endif /* GUI_CFG_TOUCH_PREDICT || __DOXYGEN__ */
 
     gui_dim_t widget_x;                     /*!< Widget absolute `X` position */
     gui_dim_t widget_y;                     /*!< Widget absolute `Y` position */
@@ -330,6 +422,64 @@ typedef struct {
     struct pt pt;                           /*!< Protothread structure */
 } guii_touch_data_t;
 
+/**
+ * \ingroup         GUI_GESTURE
+ * \brief           List of touch gestures
+ */
+typedef enum {
+    GUI_GESTURE_SWIPE = 0x00,               /*!< Fast single touch movement in one direction, reported on release */
+    GUI_GESTURE_FLING,                      /*!< Single touch released while moving, reported on release */
+    GUI_GESTURE_PINCH,                      /*!< Distance between `2` touches changed, reported at most once per process call */
+    GUI_GESTURE_ROTATE,                     /*!< Angle between `2` touches changed, reported at most once per process call */
+} gui_gesture_type_t;
+
+/**
+ * \ingroup         GUI_GESTURE
+ * \brief           Direction of swipe and fling gestures
+ */
+typedef enum {
+    GUI_GESTURE_DIR_NONE = 0x00,            /*!< Movement is not dominant in any direction */
+    GUI_GESTURE_DIR_LEFT,                   /*!< Movement to the left */
+    GUI_GESTURE_DIR_RIGHT,                  /*!< Movement to the right */
+    GUI_GESTURE_DIR_UP,                     /*!< Movement up */
+    GUI_GESTURE_DIR_DOWN,                   /*!< Movement down */
+} gui_gesture_dir_t;
+
+/**
+ * \ingroup         GUI_GESTURE
+ * \brief           Gesture data passed to widget with \ref GUI_EVT_GESTURE event
+ */
+typedef struct {
+    gui_gesture_type_t type;                /*!< Gesture type */
+    gui_gesture_dir_t dir;                  /*!< Direction of swipe and fling gestures */
+    gui_dim_t x;                            /*!< `X` position relative to widget. Center of touches for pinch and rotate, last position otherwise */
+    gui_dim_t y;                            /*!< `Y` position relative to widget. Center of touches for pinch and rotate, last position otherwise */
+    gui_dim_t dx;                           /*!< `X` displacement from gesture start in units of pixels */
+    gui_dim_t dy;                           /*!< `Y` displacement from gesture start in units of pixels */
+    int32_t speed_x;                        /*!< `X` velocity on release in units of pixels per second */
+    int32_t speed_y;                        /*!< `Y` velocity on release in units of pixels per second */
+    int32_t scale;                          /*!< Pinch scale change since previous report in units of `1/256`. Value `256` means no change */
+    int16_t angle;                          /*!< Rotation since previous report in units of `0.1` degree. Positive value is clockwise rotation */
+} gui_gesture_t;
+
+/**
+ * \ingroup         GUI_GESTURE
+ * \brief           Internal gesture recognizer state
+ */
+typedef struct {
+    gui_handle_p h;                         /*!< Widget receiving gestures, widget active at touch press */
+    gui_touch_data_t start;                 /*!< Sample at gesture start */
+    gui_touch_data_t prev;                  /*!< Sample processed on previous process call */
+    gui_touch_data_t last;                  /*!< Latest pressed sample */
+    uint32_t move_time;                     /*!< Time of last touch movement */
+    int32_t speed_x;                        /*!< `X` velocity estimate in units of pixels per second */
+    int32_t speed_y;                        /*!< `Y` velocity estimate in units of pixels per second */
+    uint32_t distance;                      /*!< Distance between `2` touches on previous process call */
+    int16_t angle;                          /*!< Angle between `2` touches on previous process call in units of `0.1` degree */
+    uint8_t pressed;                        /*!< Set to `1` when touch is pressed */
+    uint8_t pending;                        /*!< Set to `1` when new samples are waiting to be processed */
+} guii_gesture_t;
+
 /**
  * \brief           Single key data structure
  */
@@ -359,6 +509,45 @@ typedef enum {
     keyCONTINUE                             /*!< Key has not been handled and further checking can be done */
 } guii_keyboard_status_t;
 
+/**
+ * \ingroup         GUI_FOCUS
+ * \brief           Focus movement directions
+ */
+typedef enum {
+    GUI_FOCUS_DIR_UP = 0x00,                /*!< Nearest widget above focused widget */
+    GUI_FOCUS_DIR_DOWN,                     /*!< Nearest widget below focused widget */
+    GUI_FOCUS_DIR_LEFT,                     /*!< Nearest widget left to focused widget */
+    GUI_FOCUS_DIR_RIGHT,                    /*!< Nearest widget right to focused widget */
+    GUI_FOCUS_DIR_NEXT,                     /*!< Next widget in reading order, wraps to first widget */
+    GUI_FOCUS_DIR_PREV,                     /*!< Previous widget in reading order, wraps to last widget */
+} gui_focus_dir_t;
+
+/**
+ * \ingroup         GUI_FOCUS
+ * \brief           Single widget in focus graph
+ */
+typedef struct {
+    gui_handle_p h;                         /*!< Focusable widget */
+    gui_dim_t x;                            /*!< Widget absolute `X` position when graph was built */
+    gui_dim_t y;                            /*!< Widget absolute `Y` position when graph was built */
+    gui_dim_t width;                        /*!< Widget width when graph was built */
+    gui_dim_t height;                       /*!< Widget height when graph was built */
+    uint16_t nb[4];                         /*!< Indexes of up, down, left and right neighbours, `0xFFFF` when there is none */
+} guii_focus_node_t;
+
+/**
+ * \ingroup         GUI_FOCUS
+ * \brief           Focus graph, nodes are sorted in reading order
+ */
+typedef struct {
+    guii_focus_node_t* nodes;               /*!< Array of graph nodes */
+    size_t count;                           /*!< Number of valid nodes */
+    size_t size;                            /*!< Number of allocated nodes */
+    size_t current;                         /*!< Index of node of focused widget, valid when its handle matches */
+    gui_handle_p root;                      /*!< Dialog base widget graph was built for, `NULL` for all widgets */
+    uint8_t dirty;                          /*!< Set to `1` when widget tree changed and graph must be built again */
+} guii_focus_graph_t;
+
 /**
  * \brief           GUI clipping management
  */
@@ -369,21 +558,100 @@ typedef struct {
     gui_dim_t y2;                           /*!< Clipping area end Y */
 } gui_display_t;
 
+/**
+ * \brief           Horizontal span of pixels for filled shape drawing
+ */
+typedef struct {
+    gui_dim_t x;                            /*!< Span start X position, relative to layer */
+    gui_dim_t y;                            /*!< Span Y position, relative to layer */
+    gui_dim_t length;                       /*!< Span length in units of pixels */
+} gui_span_t;
+
+/**
+ * \brief           Native pixel format of layer memory
+ */
+typedef enum {
+    GUI_PIXEL_FORMAT_ARGB8888 = 0x00,       /*!< `32-bit` pixels, same as \ref gui_color_t */
+    GUI_PIXEL_FORMAT_RGB565,                /*!< `16-bit` pixels with `5` bits for red and blue and `6` bits for green */
+} gui_pixel_format_t;
+
+/**
+ * \brief           Convert `ARGB8888` color to `RGB565` pixel
+ * \hideinitializer
+ */
+#define GUI_COLOR_TO_RGB565(c)              ((uint16_t)((((c) >> 8) & 0xF800) | (((c) >> 5) & 0x07E0) | (((c) >> 3) & 0x001F)))
+
+/**
+ * \brief           Convert `RGB565` pixel to opaque `ARGB8888` color, low bits are replicated from high bits
+ * \hideinitializer
+ */
+#define GUI_COLOR_FROM_RGB565(p)            ((gui_color_t)(0xFF000000UL                                 \
+                                                | ((((p) >> 8) & 0xF8) | (((p) >> 13) & 0x07)) << 16    \
+                                                | ((((p) >> 3) & 0xFC) | (((p) >>  9) & 0x03)) << 8     \
+                                                | ((((p) << 3) & 0xF8) | (((p) >>  2) & 0x07))))
+
 /**
  * \brief           LCD layer structure
  */
 typedef struct {
     uint8_t num;                            /*!< Layer number */
     void* start_address;                    /*!< Start address in memory if it exists */
+    gui_pixel_format_t pixel_format;        /*!< Native format of pixels in layer memory. When left at default and LCD `pixel_size` is `2`, it is set to \ref GUI_PIXEL_FORMAT_RGB565 on init */
     volatile uint8_t pending;               /*!< Layer pending for redrawing operation */
     gui_display_t display;                  /*!< Display setup for clipping regions for main layers (no virtual) */
+    gui_display_t regions[GUI_CFG_DISPLAY_REGIONS]; /*!< List of dirty regions drawn on layer in last redraw (no virtual) */
+    size_t regions_count;                   /*!< Number of valid entries in regions array */
+    uint32_t frame;                         /*!< Number of frame last drawn on layer, content age (no virtual) */
     
     gui_dim_t width;                        /*!< Layer width, used for virtual layers mainly */
     gui_dim_t height;                       /*!< Layer height, used for virtual layers mainly */
     gui_dim_t x_pos;                        /*!< Absolute X position on screen, used for virtual layers */
     gui_dim_t y_pos;                        /*!< Absolute Y position on screen, used for virtual layers */
+#if GUI_CFG_USE_LAYER_COMPRESSION || __DOXYGEN__
+    struct gui_layer_tiles* tiles;          /*!< Map of solid tiles of retained layer, `NULL` for other layers */
+#endif /* GUI_CFG_USE_LAYER_COMPRESSION || __DOXYGEN__ */
 } gui_layer_t;
 
+/**
+ * \brief           Hardware overlay plane setup, parameter of \ref GUI_LL_Command_SetOverlay
+ */
+typedef struct {
+    uint8_t num;                            /*!< Plane number, `0` is first plane above main layer */
+    gui_layer_t* layer;                     /*!< Layer shown on plane with screen position in `x_pos` and `y_pos`. Set to `NULL` to disable plane */
+    uint8_t alpha;                          /*!< Constant plane alpha */
+} gui_overlay_t;
+
+/**
+ * \brief           Refresh mode of display, parameter of \ref GUI_LL_Command_SetRefreshMode
+ * \sa              GUI_CFG_USE_IDLE_REFRESH
+ */
+typedef enum {
+    GUI_REFRESH_MODE_NORMAL = 0x00,         /*!< Normal refresh rate, new frames must be shown without delay */
+    GUI_REFRESH_MODE_IDLE,                  /*!< Display content does not change, refresh rate and pixel clock may be lowered or panel may refresh itself */
+} gui_refresh_mode_t;
+
+/**
+ * \brief           Direct CPU access to layer memory, result of \ref GUI_LL_Command_GetLayerAccess
+ * \sa              GUI_CFG_USE_LL_DIRECT_ACCESS
+ */
+typedef struct {
+    uint8_t* base;                          /*!< Address of top-left pixel of layer. Set to `NULL` when memory is not addressable by CPU */
+    size_t stride;                          /*!< Distance between start of consecutive rows in units of bytes */
+    gui_pixel_format_t format;              /*!< Format of pixels in memory */
+    uint8_t fence;                          /*!< Set to `1` when hardware may access memory asynchronously and \ref gui_lcd_fence must be called before CPU access */
+} gui_layer_access_t;
+
+/**
+ * \brief           Orientation of logical screen on physical display, clockwise
+ * \sa              GUI_CFG_USE_LCD_ROTATION
+ */
+typedef enum {
+    GUI_LCD_ORIENTATION_0 = 0x00,           /*!< Logical screen matches physical display */
+    GUI_LCD_ORIENTATION_90,                 /*!< Logical screen is rotated for `90` degrees, top row of screen is right column of display */
+    GUI_LCD_ORIENTATION_180,                /*!< Logical screen is rotated for `180` degrees */
+    GUI_LCD_ORIENTATION_270                 /*!< Logical screen is rotated for `270` degrees, top row of screen is left column of display */
+} gui_lcd_orientation_t;
+
 /**
  * \brief           GUI LCD structure
  */
@@ -395,20 +663,150 @@ typedef struct {
     gui_layer_t* drawing_layer;             /*!< Currently active drawing layer */
     size_t layer_count;                     /*!< Number of layers used for LCD and drawings */
     gui_layer_t* layers;                    /*!< Pointer to layers */
+#if GUI_CFG_USE_TRIPLE_BUFFERING || __DOXYGEN__
+    gui_layer_t* display_layer;             /*!< Layer last confirmed by low-level, currently scanned out */
+#endif /* GUI_CFG_USE_TRIPLE_BUFFERING || __DOXYGEN__ */
     uint32_t flags;                         /*!< List of flags */
+#if GUI_CFG_USE_LCD_ROTATION || __DOXYGEN__
+    uint8_t orientation;                    /*!< Member of \ref gui_lcd_orientation_t, set by driver with physical size. Size is changed to logical screen on init */
+#endif /* GUI_CFG_USE_LCD_ROTATION || __DOXYGEN__ */
 } gui_lcd_t;
 
+/**
+ * \ingroup         GUI_IMAGE
+ * \brief           Image data compression
+ *
+ *                  Compressed images are decoded to scratch buffer of \ref GUI_CFG_DRAW_IMAGE_BUFFER_SIZE bytes
+ *                  and drawn with the same low-level functions as raw images.
+ */
+typedef enum {
+    GUI_IMAGE_COMPRESSION_NONE = 0x00,      /*!< Raw pixels, `y_size` rows of `stride` entries of `bpp` bits */
+    /**
+     * \brief       Run-length encoded pixels, each row encoded separately
+     *
+     *              Each packet starts with control byte `c`. When bit `7` is set,
+     *              single pixel follows which is repeated `(c & 0x7F) + 1` times,
+     *              otherwise `c + 1` raw pixels follow. Packets never span rows.
+     */
+    GUI_IMAGE_COMPRESSION_RLE,
+    /**
+     * \brief       8-bit palette indices, compressed as `LZ4` block per tile
+     *
+     *              Each tile of `tile_height` rows is independent `LZ4` block (no frame header)
+     *              which decodes to `x_size * tile_height` indices to `palette` array.
+     *              `tiles` table is required and must have one entry more than number of tiles.
+     */
+    GUI_IMAGE_COMPRESSION_LZ4_PALETTE,
+    /**
+     * \brief       Raw 8-bit indices to `palette` array, one byte per pixel
+     *
+     *              Drawn with low-level `DrawImageL` function and color lookup table when available,
+     *              otherwise indices are expanded to pixels in scratch buffer.
+     */
+    GUI_IMAGE_COMPRESSION_L8,
+    /**
+     * \brief       Raw 4-bit indices to `palette` array, two pixels per byte with first pixel in high nibble
+     *
+     *              Each row starts at byte boundary and takes `(x_size + 1) / 2` bytes.
+     */
+    GUI_IMAGE_COMPRESSION_L4,
+    /**
+     * \brief       Baseline `JPEG` file of `size` bytes
+     *
+     *              Image is decoded once with low-level `DecodeImage` function to image cache,
+     *              memory mapped or with `read` function. Requires \ref GUI_CFG_USE_IMAGE_CACHE.
+     */
+    GUI_IMAGE_COMPRESSION_JPEG,
+} gui_image_compression_t;
+
 /**
  * \ingroup         GUI_IMAGE
  * \brief           Image descriptor structure
  */
-typedef struct {
+typedef struct gui_image_desc {
     gui_dim_t x_size;                       /*!< Image X size */
     gui_dim_t y_size;                       /*!< Image Y size */
-    uint8_t bpp;                            /*!< Bits per pixel */
-    const uint8_t* image;                   /*!< Pointer to image byte array */
+    uint8_t bpp;                            /*!< Bits per pixel of decoded image */
+    const uint8_t* image;                   /*!< Pointer to image byte array, or user value for `read` function */
+    uint8_t compression;                    /*!< Image data compression, member of \ref gui_image_compression_t */
+    const uint8_t* palette;                 /*!< Palette entries of `bpp` bits each, used with \ref GUI_IMAGE_COMPRESSION_LZ4_PALETTE, \ref GUI_IMAGE_COMPRESSION_L8 and \ref GUI_IMAGE_COMPRESSION_L4 */
+    uint16_t palette_size;                  /*!< Number of entries in `palette`, set to `0` when all entries addressable by index exist */
+    gui_dim_t tile_height;                  /*!< Number of rows in each compressed tile */
+    const uint32_t* tiles;                  /*!< Offsets of tiles in `image` array, or `NULL` when `image` is single tile */
+    
+    /**
+     * \brief       Read image data from external storage, such as SPI flash or file system
+     *
+     *              When set, image data are not memory mapped. They are read and decoded once
+     *              to image cache on first draw, see \ref GUI_CFG_USE_IMAGE_CACHE.
+     *
+     * \param[in]   img: Image descriptor
+     * \param[in]   offset: Offset in image data in units of bytes
+     * \param[out]  data: Output buffer
+     * \param[in]   len: Number of bytes to read
+     * \return      `1` on success, `0` otherwise
+     */
+    uint8_t (*read)(const struct gui_image_desc* img, size_t offset, void* data, size_t len);
+    size_t size;                            /*!< Size of stored image data in units of bytes, required for compressed images with `read` function */
+    uint8_t flags;                          /*!< Pixel data properties, list of `GUI_FLAG_IMAGE_*` flags */
+    gui_dim_t stride;                       /*!< Distance between starts of consecutive rows of raw memory mapped image in units of pixels, set to `0` when rows are packed (`x_size`) */
 } gui_image_desc_t;
 
+#define GUI_FLAG_IMAGE_OPAQUE           ((uint8_t)0x01) /*!< All pixels of `32BPP` image are fully opaque, image is copied without blending */
+#define GUI_FLAG_IMAGE_PREMULTIPLIED    ((uint8_t)0x02) /*!< Color components of `32BPP` image are premultiplied with alpha */
+#define GUI_FLAG_IMAGE_VOLATILE         ((uint8_t)0x04) /*!< Pixels of image may change between draws, image is not kept in caches of derived pixels */
+
+/**
+ * \ingroup         GUI_IMAGE
+ * \brief           Nine-patch image, scaled to any size with unscaled corners
+ *
+ *                  Source image is split to 3 columns and 3 rows by border sizes.
+ *                  Corners are drawn as they are, edges are stretched or tiled
+ *                  in one direction and center part in both directions.
+ *                  Borders must leave at least one middle column and row in source image.
+ */
+typedef struct {
+    const gui_image_desc_t* img;            /*!< Source image */
+    gui_dim_t left;                         /*!< Width of left border in source image */
+    gui_dim_t top;                          /*!< Height of top border in source image */
+    gui_dim_t right;                        /*!< Width of right border in source image */
+    gui_dim_t bottom;                       /*!< Height of bottom border in source image */
+    uint8_t flags;                          /*!< List of `GUI_FLAG_NINEPATCH_*` flags */
+} gui_ninepatch_t;
+
+#define GUI_FLAG_NINEPATCH_TILE_X       ((uint8_t)0x01) /*!< Middle columns are repeated instead of stretched */
+#define GUI_FLAG_NINEPATCH_TILE_Y       ((uint8_t)0x02) /*!< Middle rows are repeated instead of stretched */
+
+/**
+ * \ingroup         GUI_IMAGE
+ * \brief           Scale and rotation of image drawn with \ref gui_draw_image_transform
+ *
+ *                  Image is scaled first and then rotated around pivot point,
+ *                  which is placed at drawing position.
+ */
+typedef struct {
+    int16_t angle;                          /*!< Clockwise rotation in units of `0.1` degree */
+    uint16_t scale_x;                       /*!< Horizontal scale in units of `1/256`, `256` keeps original width */
+    uint16_t scale_y;                       /*!< Vertical scale in units of `1/256`, `256` keeps original height */
+    gui_dim_t pivot_x;                      /*!< X position of pivot point in image */
+    gui_dim_t pivot_y;                      /*!< Y position of pivot point in image */
+    uint8_t flags;                          /*!< List of `GUI_FLAG_TRANSFORM_*` flags */
+} gui_image_transform_t;
+
+#define GUI_FLAG_TRANSFORM_BILINEAR     ((uint8_t)0x01) /*!< Use bilinear filter instead of nearest pixel, edges are anti-aliased */
+#define GUI_FLAG_TRANSFORM_CACHE        ((uint8_t)0x02) /*!< Keep transformed image in sprite cache, used with \ref GUI_CFG_USE_SPRITE_CACHE */
+
+/**
+ * \ingroup         GUI_IMAGE
+ * \brief           Decoded image in image cache
+ */
+typedef struct {
+    gui_linkedlist_t list;                  /*!< Linked list entry, must be first on the list */
+    const gui_image_desc_t* src;            /*!< Source image descriptor */
+    gui_image_desc_t desc;                  /*!< Descriptor of decoded raw image in cache memory */
+    size_t memsize;                         /*!< Number of bytes allocated for entry */
+} gui_image_cacheentry_t;
+
 /**
  * \brief           Low-level LCD command enumeration
  */
@@ -428,8 +826,104 @@ typedef enum {
      * \param[out]  *result: Pointer to `uint8_t` variable to save result: 0 = OK otherwise ERROR
      */
     GUI_LL_Command_SetActiveLayer,          /*!< Set new layer as active layer */
+    
+    /**
+     * \brief       Send finished band to display, used when \ref GUI_CFG_USE_BAND_RENDERING is enabled
+     *
+     *              Band position on display is set by `x_pos` and `y_pos` and its size by `width` and `height` fields of layer.
+     *              With single band layer, band memory is reused for next band after command returns.
+     *
+     *              When driver provides second band layer, `pending` field of band is set to `1`
+     *              before command and next band is drawn to other layer meanwhile.
+     *              Driver may return immediately and must clear `pending` field when transfer is finished
+     *
+     * \param[in]   *param: Pointer to \ref gui_layer_t structure with band data
+     * \param[out]  *result: Pointer to `uint8_t` variable to save result: 0 = OK otherwise ERROR
+     */
+    GUI_LL_Command_FlushBand,               /*!< Flush band buffer to display */
+    
+    /**
+     * \brief       Get line currently scanned out to display, used when \ref GUI_CFG_USE_DIRECT_RENDERING is enabled
+     *
+     * \param[in]   *param: Not used
+     * \param[out]  *result: Pointer to \ref gui_dim_t variable to save line to.
+     *                  Set to `-1` during blanking before first line and to LCD height or more during blanking after last line
+     */
+    GUI_LL_Command_GetScanLine,             /*!< Get current scan-out line */
+    
+    /**
+     * \brief       Wait until scan-out reaches line or blanking after last line, used when \ref GUI_CFG_USE_DIRECT_RENDERING is enabled
+     *
+     *              Driver may block on display line interrupt. When command is not processed,
+     *              line is polled with \ref GUI_LL_Command_GetScanLine
+     *
+     * \param[in]   *param: Pointer to \ref gui_dim_t variable with line to wait for
+     * \param[out]  *result: Not used
+     */
+    GUI_LL_Command_WaitScanLine,            /*!< Wait for scan-out line */
+    
+    /**
+     * \brief       Set up hardware overlay plane, used when \ref GUI_CFG_USE_OVERLAY is enabled
+     *
+     *              Plane shows layer memory at layer `x_pos` and `y_pos` screen position,
+     *              blended over main layer with pixel alpha multiplied by plane alpha.
+     *              Position may be partially outside screen, driver must clip plane window.
+     *              Command is sent with `NULL` layer when widget is promoted to check if plane exists.
+     *
+     * \param[in]   *param: Pointer to \ref gui_overlay_t structure with plane setup
+     * \param[out]  *result: Pointer to `uint8_t` variable to save result, set to `0` on success
+     */
+    GUI_LL_Command_SetOverlay,              /*!< Set up hardware overlay plane */
+    
+    /**
+     * \brief       Submit drawing commands recorded for dirty region, used when \ref GUI_CFG_USE_LL_GPU is enabled
+     *
+     *              Sent after all widgets inside dirty region are drawn to drawing layer.
+     *              Driver which records drawing operations to command list may start execution
+     *              of complete list and return immediately, `IsReady` function must report
+     *              when execution is finished
+     *
+     * \param[in]   *param: Pointer to \ref gui_display_t structure with drawn region in screen coordinates
+     * \param[out]  *result: Not used
+     */
+    GUI_LL_Command_Submit,                  /*!< Submit recorded drawing commands */
+    
+    /**
+     * \brief       Set refresh mode of display, used when \ref GUI_CFG_USE_IDLE_REFRESH is enabled
+     *
+     *              \ref GUI_REFRESH_MODE_IDLE is set when nothing was redrawn and no input was received for
+     *              \ref GUI_CFG_IDLE_REFRESH_TIMEOUT milliseconds. Driver may lower refresh rate or pixel clock
+     *              of display controller, or stop sending frames to panel with own frame memory, such as `MIPI-DSI` panel in command mode.
+     *              \ref GUI_REFRESH_MODE_NORMAL is set on new input or invalidation, before next frame is drawn.
+     *              Driver must restore normal scan-out before command returns or before next layer change is confirmed
+     *
+     * \param[in]   *param: Pointer to \ref gui_refresh_mode_t variable with new mode
+     * \param[out]  *result: Pointer to `uint8_t` variable to save result, set to `0` on success
+     */
+    GUI_LL_Command_SetRefreshMode,          /*!< Set display refresh mode */
+    
+    /**
+     * \brief       Get direct CPU access to layer memory, used when \ref GUI_CFG_USE_LL_DIRECT_ACCESS is enabled
+     *
+     *              Result is preset by core with `start_address` of layer, stride of layer `width`
+     *              and `pixel_format` of layer, with `fence` set to `1` when driver has `IsReady` function.
+     *              Driver sets `base` to `NULL` when layer memory is not addressable by CPU,
+     *              such as memory of external display controller, and may clear `fence`
+     *              when drawing operations on layer are always synchronous.
+     *              When command is not processed, only layers allocated by core are accessed directly
+     *
+     *              Command is sent once for each new layer memory, result is cached by core
+     *
+     * \param[in]   *param: Pointer to \ref gui_layer_t structure of layer
+     * \param[out]  *result: Pointer to \ref gui_layer_access_t structure to modify
+     */
+    GUI_LL_Command_GetLayerAccess,          /*!< Get direct access to layer memory */
 } GUI_LL_Command_t;
 
+#if GUI_CFG_USE_LL_GPU
+struct gui_icon;                            /* Vector icon is defined with fonts */
+#endif /* GUI_CFG_USE_LL_GPU */
+
 /**
  * \brief           GUI Low-Level structure for drawing operations
  */
@@ -439,7 +933,7 @@ typedef struct gui_ll_t {
     void            (*SetPixel)     (gui_lcd_t *, gui_layer_t *, gui_dim_t, gui_dim_t, gui_color_t);                    /*!< Pointer to LCD set pixel function */
     gui_color_t     (*GetPixel)     (gui_lcd_t *, gui_layer_t *, gui_dim_t, gui_dim_t);                                 /*!< Pointer to read pixel from LCD */
     void            (*Fill)         (gui_lcd_t *, gui_layer_t *, void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_color_t); /*!< Pointer to LCD fill screen or rectangle function */
-    void            (*Copy)         (gui_lcd_t *, gui_layer_t *, void *, const void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to LCD copy data from source to destination */
+    void            (*Copy)         (gui_lcd_t *, gui_layer_t *, void *, const void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to LCD copy data from source to destination. Destination may overlap source on the left within the same lines */
     void            (*CopyBlend)    (gui_lcd_t *, gui_layer_t *, void *, const void *, uint8_t, uint8_t, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function to copy layers together (blending) with support to set overall layer transparency */
     void            (*DrawHLine)    (gui_lcd_t *, gui_layer_t *, gui_dim_t, gui_dim_t, gui_dim_t, gui_color_t);         /*!< Pointer to horizontal line drawing. Set to 0 if you do not have optimized version */
     void            (*DrawVLine)    (gui_lcd_t *, gui_layer_t *, gui_dim_t, gui_dim_t, gui_dim_t, gui_color_t);         /*!< Pointer to vertical line drawing. Set to 0 if you do not have optimized version */
@@ -447,9 +941,34 @@ typedef struct gui_ll_t {
     void            (*DrawImage16)  (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, void *, const void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function for drawing 16BPP (RGB565) images */
     void            (*DrawImage24)  (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, void *, const void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function for drawing 24BPP (RGB888) images */
     void            (*DrawImage32)  (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, void *, const void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function for drawing 32BPP (ARGB8888) images */
+    uint8_t         (*DrawImageL)   (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, void *, const void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function for drawing indexed L8/L4 images with `palette` as color lookup table. Returns `0` when format is not supported to use software expansion */
+    uint8_t         (*DecodeImage)  (gui_lcd_t *, const gui_image_desc_t *, const void *, void *);                  /*!< Pointer to function decoding image data of formats not handled by core, such as `JPEG`, to `x_size * y_size` pixels of `bpp` bits. Returns `1` on success */
     void            (*CopyChar)     (gui_lcd_t *, gui_layer_t *, void *, const void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t, gui_color_t);                /*!< Pointer to copy char function with alpha only as source */
+    void            (*FillSpans)    (gui_lcd_t *, gui_layer_t *, const gui_span_t *, size_t, gui_color_t);              /*!< Pointer to function filling list of clipped horizontal spans with single color. Set to 0 to use `DrawHLine` for each span */
+#if GUI_CFG_USE_LL_GPU || __DOXYGEN__
+    /*
+     * Vector GPU functions, all positions are relative to layer and shape must be clipped to `clip` region.
+     * Function returns `0` when it cannot draw shape with given parameters to use software drawing
+     */
+    uint8_t         (*FillRoundRect)(gui_lcd_t *, gui_layer_t *, const gui_display_t *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t, gui_color_t);   /*!< Pointer to function filling anti-aliased rectangle with corner radius */
+    uint8_t         (*FillGradient) (gui_lcd_t *, gui_layer_t *, const gui_display_t *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t, const gui_gradient_t *);  /*!< Pointer to function filling rectangle with corner radius, `0` for none, with gradient */
+    uint8_t         (*FillPath)     (gui_lcd_t *, gui_layer_t *, const gui_display_t *, const struct gui_icon *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t, gui_color_t);    /*!< Pointer to function filling anti-aliased vector icon path scaled to rectangle */
+    uint8_t         (*DrawLineAA)   (gui_lcd_t *, gui_layer_t *, const gui_display_t *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t, gui_color_t);   /*!< Pointer to function drawing anti-aliased line of `1` pixel width between points */
+    uint8_t         (*BlitTransform)(gui_lcd_t *, gui_layer_t *, const gui_display_t *, const gui_image_desc_t *, gui_dim_t, gui_dim_t, const gui_image_transform_t *); /*!< Pointer to function blending scaled and rotated image with pivot point at position */
+#endif /* GUI_CFG_USE_LL_GPU || __DOXYGEN__ */
 } gui_ll_t;
 
+/**
+ * \brief           Low-level control function of display driver, same as \ref gui_ll_control
+ * \param[in]       lcd: LCD structure of display
+ * \param[in]       cmd: Member of \ref GUI_LL_Command_t enumeration
+ * \param[in]       param: Command parameter
+ * \param[out]      result: Command result
+ * \return          `1` if command was processed, `0` otherwise
+ * \sa              gui_display_add
+ */
+typedef uint8_t (*gui_ll_control_fn)(gui_lcd_t* lcd, GUI_LL_Command_t cmd, void* param, void* result);
+
 /**
  * \defgroup        GUI_FONT Fonts
  * \brief           Font description structures and flags
@@ -469,22 +988,145 @@ typedef struct {
 } gui_font_char_t;
 
 /**
- * \brief           FONT structure for writing usage
+ * \brief           Range of consecutive characters in sparse font
  */
 typedef struct {
+    uint32_t start;                         /*!< First character code in range */
+    uint16_t count;                         /*!< Number of characters in range */
+    uint16_t index;                         /*!< Index of first range character in font `data` array */
+} gui_font_range_t;
+
+/**
+ * \brief           Kerning pair, applied between two adjacent characters
+ */
+typedef struct {
+    uint16_t left;                          /*!< Left character code */
+    uint16_t right;                         /*!< Right character code */
+    int8_t value;                           /*!< Advance adjustment in units of pixels */
+} gui_font_kern_t;
+
+/**
+ * \brief           FONT structure for writing usage
+ */
+typedef struct gui_font {
     const gui_char* name;                   /*!< Pointer to font name */
     uint8_t size;                           /*!< Font size in units of pixels */
     uint16_t startchar;                     /*!< Start character number in list */
     uint16_t endchar;                       /*!< End character number in list */
     uint8_t flags;                          /*!< List of flags for font */
     const gui_font_char_t* data;            /*!< Pointer to first character */
+    const uint8_t* advance;                 /*!< Optional advance width of each character, `x_size + x_margin` is used when `NULL` */
+    const gui_font_kern_t* kerning;         /*!< Optional kerning pairs, sorted by `left` and then by `right` character */
+    uint16_t kerning_count;                 /*!< Number of entries in kerning table */
+    const gui_font_range_t* ranges;         /*!< Optional sorted character ranges, `startchar` and `endchar` are ignored when set */
+    uint16_t range_count;                   /*!< Number of entries in ranges table */
+    
+    /**
+     * \brief       Read character data from external storage, such as file system
+     *
+     *              When set, `data` member of each character holds offset of its data instead of pointer.
+     *              Data are read and converted to `A8` character cache on first draw, see \ref gui_font_open.
+     *
+     * \param[in]   font: Font to read data from
+     * \param[in]   offset: Offset in font data in units of bytes
+     * \param[out]  data: Output buffer
+     * \param[in]   len: Number of bytes to read
+     * \return      `1` on success, `0` otherwise
+     */
+    uint8_t (*read)(const struct gui_font* font, size_t offset, void* data, size_t len);
+    void* arg;                              /*!< User argument for `read` function, such as file handle */
+    const uint16_t* advance64;              /*!< Optional advance of each character in units of `1/64` pixel, enables subpixel positioning */
 } gui_font_t;
 
 #define GUI_FLAG_FONT_AA                ((uint8_t)0x01) /*!< Indicates anti-alliasing on font */
+#define GUI_FLAG_FONT_A8                ((uint8_t)0x10) /*!< Character data is stored as 8-bit alpha (1 byte per pixel) and used directly without RAM cache */
+#define GUI_FLAG_FONT_A4                ((uint8_t)0x20) /*!< Character data is stored as 4-bit alpha (2 pixels per byte, first in high nibble, rows start at byte boundary) */
+#define GUI_FLAG_FONT_LCD               ((uint8_t)0x40) /*!< Draw characters with LCD subpixel coverage, requires \ref GUI_CFG_USE_TEXT_LCD */
+#define GUI_FLAG_FONT_RLE               ((uint8_t)0x80) /*!< Character data is run-length compressed and decoded to `A8` cache on first draw.
+                                                            Data start with 2-bytes little-endian length of compressed data, runs continue over line ends.
+                                                            Code byte `00nnnnnn` is run of `n + 1` transparent pixels, `01nnnnnn` run of `n + 1` solid pixels
+                                                            and `1nnnnnnn` is followed by `n + 1` literal pixels packed in font format (`A8`, `A4`, `AA` or `1-bit`) */
 #define GUI_FLAG_TEXT_RIGHTALIGN        ((uint8_t)0x02) /*!< Indicates right align text if string length is too wide for rectangle */
 #define GUI_FLAG_TEXT_MULTILINE         ((uint8_t)0x04) /*!< Indicates multi line support on widget */
 #define GUI_FLAG_TEXT_EDITMODE          ((uint8_t)0x08) /*!< Edit mode is enabled on text */
 
+/**
+ * \brief           Vector icon path commands
+ *
+ *                  Each command byte is followed by its points, every point as `x` and `y` byte on icon design grid.
+ *                  Contours are filled with non-zero rule, holes must use opposite direction than outline.
+ */
+typedef enum {
+    GUI_ICON_CMD_END = 0x00,                /*!< End of path */
+    GUI_ICON_CMD_MOVE,                      /*!< Start new contour at point, previous contour is closed. `1` point */
+    GUI_ICON_CMD_LINE,                      /*!< Line to point. `1` point */
+    GUI_ICON_CMD_QUAD,                      /*!< Quadratic curve with control point to end point. `2` points */
+    GUI_ICON_CMD_CUBIC,                     /*!< Cubic curve with `2` control points to end point. `3` points */
+} gui_icon_cmd_t;
+
+/**
+ * \brief           Vector icon, rasterized on demand at requested size to character cache
+ */
+typedef struct gui_icon {
+    uint8_t width;                          /*!< Width of design grid */
+    uint8_t height;                         /*!< Height of design grid, icon is scaled to requested height */
+    const uint8_t* path;                    /*!< Path commands, see \ref gui_icon_cmd_t */
+} gui_icon_t;
+
+/**
+ * \brief           Single line of cached text layout
+ */
+typedef struct {
+    size_t offset;                          /*!< Offset of first line character from layout start in units of bytes */
+    size_t read_total;                      /*!< Number of characters to read in line */
+    size_t read_draw;                       /*!< Number of characters to draw in line */
+    gui_dim_t width;                        /*!< Line width in units of pixels */
+} gui_text_layout_line_t;
+
+/**
+ * \brief           Cached layout of string, reused while string, font and drawing rectangle do not change
+ * \sa              gui_draw_text_layout_invalidate
+ */
+typedef struct {
+    const gui_font_t* font;                 /*!< Font used for layout */
+    const gui_char* str;                    /*!< String used for layout */
+    gui_dim_t width;                        /*!< Width of drawing rectangle */
+    gui_dim_t lineheight;                   /*!< Line height */
+    uint8_t flags;                          /*!< Text flags used for layout */
+    uint8_t valid;                          /*!< Set to `1` when layout matches string */
+    uint8_t partial;                        /*!< Set to `1` when first `count` lines are still valid and rest of string starts at `resume` */
+    size_t resume;                          /*!< Offset of first not calculated line, used when `partial` is set */
+    
+    size_t start;                           /*!< Offset of first drawn character in string, used with right align */
+    gui_dim_t x_offset;                     /*!< X offset of right aligned text which is wider than rectangle */
+    gui_dim_t height;                       /*!< Total text height, `-1` when not calculated for top aligned text */
+    size_t count;                           /*!< Number of lines */
+    size_t size;                            /*!< Number of allocated line entries */
+    gui_text_layout_line_t* lines;          /*!< Array of lines */
+} gui_text_layout_t;
+
+/**
+ * \brief           Display list with drawing commands recorded during widget draw
+ *
+ *                  List is replayed instead of calling widget draw callback
+ *                  while widget content, position and visible area do not change
+ *
+ * \sa              gui_widget_setdisplaylist
+ */
+typedef struct {
+    gui_dim_t x;                            /*!< Absolute X position of widget when list was recorded */
+    gui_dim_t y;                            /*!< Absolute Y position of widget when list was recorded */
+    gui_dim_t area_x1;                      /*!< Visible left X position of widget when list was recorded */
+    gui_dim_t area_y1;                      /*!< Visible top Y position of widget when list was recorded */
+    gui_dim_t area_x2;                      /*!< Visible right X position of widget when list was recorded */
+    gui_dim_t area_y2;                      /*!< Visible bottom Y position of widget when list was recorded */
+    uint8_t valid;                          /*!< Set to `1` when list holds complete widget drawing */
+    uint8_t failed;                         /*!< Set to `1` when drawing could not be recorded, cleared on widget invalidation */
+    size_t len;                             /*!< Number of used bytes in `data` */
+    size_t size;                            /*!< Number of allocated bytes in `data` */
+    uint8_t* data;                          /*!< Recorded commands with their payload */
+} gui_draw_list_t;
+
 #if defined(GUI_INTERNAL) || __DOXYGEN__
 /**
  * \brief           Char temporary entry stored in RAM for faster copy with blending operations
@@ -493,6 +1135,13 @@ typedef struct {
     gui_linkedlist_t list;                  /*!< Linked list entry. Must always be first on the list */
     const gui_font_char_t* ch;              /*!< Character value */
     const gui_font_t* font;                 /*!< Pointer to font structure */
+#if GUI_CFG_USE_VECTOR_ICON || __DOXYGEN__
+    const gui_icon_t* icon;                 /*!< Rasterized vector icon, `NULL` for font characters */
+    gui_dim_t width;                        /*!< Width of rasterized icon in units of pixels */
+    gui_dim_t height;                       /*!< Height of rasterized icon in units of pixels */
+#endif /* GUI_CFG_USE_VECTOR_ICON || __DOXYGEN__ */
+    uint8_t variant;                        /*!< Subpixel variant of character, `0` for plain `A8` copy, see \ref gui_text_getcharvariant */
+    size_t memsize;                         /*!< Number of bytes allocated for entry, including data */
 } gui_font_charentry_t;
 #endif /* defined(GUI_INTERNAL) || __DOXYGEN__ */
 
@@ -770,7 +1419,8 @@ typedef struct {
 typedef struct gui_timer {
     gui_linkedlist_t list;                  /*!< Linked list entry, must be first on the list */
     uint16_t period;                        /*!< Timer period value */
-    uint16_t counter;                       /*!< Timer current counter */
+    uint16_t slack;                         /*!< Time in units of milliseconds timer may be late to expire together with other timers */
+    uint32_t expire;                        /*!< Absolute time in units of milliseconds when timer expires */
     uint8_t flags;                          /*!< Timer flags */
     void* params;                           /*!< Custom parameters passed to callback function */
     void (*callback)(struct gui_timer *);   /*!< Timer callback function */
@@ -816,7 +1466,7 @@ typedef enum {
      * \brief       Set user parameter for widget
      *
      * \param[in]   param: Pointer to \ref gui_evt_param_t structure with custom user parameter for widget
-     * \param[out]  result: None
+     * \param[out]  result: Pointer to `uint8_t` variable, preset to `1`. Set to `0` when value did not change to skip invalidation
      */
     GUI_EVT_SETPARAM = 0x03,
     
@@ -1042,13 +1692,80 @@ typedef enum {
      * \param[out]  result: None
      */
     GUI_EVT_ONDISMISS,
+
+    /**
+     * \brief       Touch gesture recognized on widget or one of its children
+     *
+     *              Event is forwarded to parent widgets until handled
+     *
+     * \param[in]   param: Pointer to \ref gui_gesture_t structure with gesture data
+     * \param[out]  result: None
+     * \return      `1` if gesture handled, `0` to forward it to parent widget
+     * \sa          GUI_CFG_USE_GESTURE
+     */
+    GUI_EVT_GESTURE,
+
+    /**
+     * \brief       Widget has been created as copy of prototype widget with \ref gui_widget_clone
+     *
+     * \note        All values are copied from prototype and widget is not on screen yet.
+     *              Values which belong to single widget, such as timers or custom user data, can be set again here
+     *
+     * \param[in]   param: Prototype widget handle
+     * \param[out]  result: Pointer to `uint8_t` variable, preset to `1`. Set to `0` when widget cannot be copied
+     * \sa          GUI_CFG_USE_WIDGET_CLONE
+     */
+    GUI_EVT_CLONE,
+#if defined(GUI_INTERNAL) || __DOXYGEN__
+    
+    /**
+     * \brief       Save widget specific values to screen snapshot
+     *
+     * \note        This field is only visible inside GUI library and can't be used in custom widget callback
+     *
+     * \param[in]   param: Pointer to \ref gui_widget_param structure with memory to save values to in `data` field
+     *                  and number of available bytes in `type` field. When `data` is `NULL`, only size is returned
+     * \param[out]  result: Pointer to `uint8_t` variable to save number of bytes of widget values to
+     * \sa          gui_widget_snapshot_save
+     */
+    GUI_EVT_SAVESTATE,
+    
+    /**
+     * \brief       Restore widget specific values from screen snapshot
+     *
+     * \note        This field is only visible inside GUI library and can't be used in custom widget callback
+     *
+     * \param[in]   param: Pointer to \ref gui_widget_param structure with saved values in `data` field
+     *                  and number of bytes in `type` field
+     * \param[out]  result: Pointer to `uint8_t` variable to save restore status to
+     * \sa          gui_widget_snapshot_restore
+     */
+    GUI_EVT_RESTORESTATE,
+
+    /**
+     * \brief       Number of events, used as size of widget event table
+     *
+     * \note        This field is only visible inside GUI library and can't be used in custom widget callback
+     *
+     * \sa          GUI_CFG_USE_WIDGET_EVT_TABLE
+     */
+    GUI_EVT_COUNT,
+#endif /* defined(GUI_INTERNAL) || __DOXYGEN__ */
 } gui_widget_evt_t;
 
 /**
- * \brief           Style information
+ * \brief           Style information, shared by many widgets
+ *
+ *                  Widgets only keep pointer to style, which may be placed to read-only memory.
+ *                  Colors are read from style on each draw, font and padding are applied
+ *                  with \ref gui_widget_setstyle and \ref gui_widget_updatestyle
+ * \sa              gui_widget_setstyle
  */
 typedef struct {
-    void* arg;
+    const gui_color_t* colors;              /*!< List of colors, indexed as widget color list. Set to `NULL` to use widget default colors */
+    uint8_t color_count;                    /*!< Number of entries in `colors` list */
+    gui_const gui_font_t* font;             /*!< Font used for widget drawings. Set to `NULL` to keep widget font */
+    uint32_t padding;                       /*!< Padding, each byte of one side, MSB = top padding, LSB = left padding. Set to `0` to keep widget padding */
 } gui_style_t;
 
 /**
@@ -1076,6 +1793,7 @@ typedef struct {
         guii_keyboard_data_t* kd;           /*!< Pointer to input keyboard data */
         gui_widget_param* wp;               /*!< Widget parameter */
         gui_handle_p h;                     /*!< Widget handle */
+        const gui_gesture_t* gesture;       /*!< Pointer to gesture data */
     } u;                                    /*!< Union of possible parameters */
 } gui_evt_param_t;
 
@@ -1110,6 +1828,7 @@ typedef uint8_t (*gui_widget_evt_fn) (gui_handle_p h, gui_widget_evt_t evt, gui_
 #define GUI_EVT_PARAMTYPE_I16(x)                (x)->u.i16
 #define GUI_EVT_PARAMTYPE_HANDLE(x)             (x)->u.h
 #define GUI_EVT_PARAMTYPE_INT(x)                (x)->u.i
+#define GUI_EVT_PARAMTYPE_GESTURE(x)            (x)->u.gesture
 
 #define GUI_EVT_RESULTTYPE_TOUCH(x)             (x)->u.ts
 #define GUI_EVT_RESULTTYPE_KEYBOARD(x)          (x)->u.ks
@@ -1125,10 +1844,157 @@ typedef struct {
     gui_widget_evt_fn callback;         /*!< Pointer to control function, returns 1 if command handled or 0 if not */
     const gui_color_t* colors;              /*!< Pointer to list of colors as default values for widget */
     uint8_t color_count;                    /*!< Number of colors used in widget */
+    uint16_t pool_count;                    /*!< Number of widgets in object pool when \ref GUI_CFG_USE_WIDGET_POOL is enabled. Set to `0` to use \ref GUI_CFG_WIDGET_POOL_COUNT */
+#if GUI_CFG_USE_WIDGET_EVT_TABLE || __DOXYGEN__
+    const gui_widget_evt_fn* evt_table;     /*!< Optional table of event handlers with `GUI_EVT_COUNT` entries, indexed by event type.
+                                                    Event with `NULL` entry is not handled by widget. Set to `NULL` to pass all events to `callback` */
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE || __DOXYGEN__ */
 } gui_widget_t;
 
+/**
+ * \brief           Widget object pool statistics
+ */
+typedef struct {
+    const gui_widget_t* widget;             /*!< Widget type of pool */
+    size_t count;                           /*!< Number of widgets in pool */
+    size_t used;                            /*!< Number of widgets currently allocated from pool */
+    size_t max_used;                        /*!< Maximal number of widgets allocated from pool at the same time */
+    size_t overflow;                        /*!< Number of allocations done from heap because pool was full */
+} gui_widget_pool_stat_t;
+
+/**
+ * \brief           Low-level drawing statistics of single frame
+ * \sa              gui_stats_get
+ */
+typedef struct {
+    uint32_t calls;                         /*!< Number of low-level drawing calls */
+    uint32_t pixels_filled;                 /*!< Number of pixels filled with single color */
+    uint32_t pixels_copied;                 /*!< Number of pixels copied, including images */
+    uint32_t pixels_blended;                /*!< Number of pixels blended, including characters */
+    uint32_t glyphs;                        /*!< Number of drawn characters */
+    uint32_t pixels_per_call;               /*!< Average number of pixels per low-level call */
+    uint32_t wait_cycles;                   /*!< Time waiting for low-level to become ready, in units of \ref GUI_CFG_PROFILER_CYCLES */
+} gui_stats_t;
+
+/**
+ * \brief           Profiler draw cost entry for widget type or widget ID
+ * \sa              gui_profiler_getwidgets
+ */
+typedef struct {
+    const gui_widget_t* widget;             /*!< Widget type */
+    gui_id_t id;                            /*!< Widget ID, used only for entries by ID */
+    uint32_t count;                         /*!< Number of draw calls */
+    uint32_t cycles;                        /*!< Cycles spent in draw callbacks */
+} gui_profiler_entry_t;
+
+/**
+ * \brief           Profiler record of single frame
+ *
+ *                  Timers and touch cycles include all processing since previous frame
+ * \sa              gui_profiler_getframes
+ */
+typedef struct {
+    uint32_t timer_cycles;                  /*!< Cycles spent in software timers */
+    uint32_t touch_cycles;                  /*!< Cycles spent in touch and keyboard input processing */
+    uint32_t redraw_cycles;                 /*!< Cycles spent for complete redraw */
+    uint32_t draw_cycles;                   /*!< Cycles spent in widget draw callbacks only */
+    uint32_t widgets;                       /*!< Number of widget draw calls */
+} gui_profiler_frame_t;
+
+/**
+ * \brief           Profiler callback, called by GUI thread after each frame
+ * \param[in]       frame: Record of finished frame
+ */
+typedef void (*gui_profiler_fn)(const gui_profiler_frame_t* frame);
+
+/**
+ * \brief           Touch-to-photon latency statistics in units of milliseconds
+ *
+ *                  Stage averages add up to average total latency
+ * \sa              gui_latency_get
+ */
+typedef struct {
+    uint32_t count;                         /*!< Number of measured touches since reset */
+    uint32_t min;                           /*!< Minimal total latency */
+    uint32_t avg;                           /*!< Average total latency */
+    uint32_t max;                           /*!< Maximal total latency */
+    uint32_t p99;                           /*!< 99th percentile of total latency of recent \ref GUI_CFG_LATENCY_SAMPLES touches */
+    uint32_t queue_avg;                     /*!< Average time touch waited in input buffer */
+    uint32_t process_avg;                   /*!< Average time of touch dispatch to widgets */
+    uint32_t render_avg;                    /*!< Average time from dispatch to end of redraw, including wait for frame start */
+    uint32_t confirm_avg;                   /*!< Average time waiting for layer confirmation from low-level */
+} gui_latency_stat_t;
+
+/**
+ * \brief           Layout mode of children widgets
+ * \sa              gui_widget_setlayout
+ */
+typedef enum {
+    GUI_LAYOUT_NONE = 0x00,                 /*!< Children widgets use positions set by user */
+    GUI_LAYOUT_ROW,                         /*!< Children widgets are placed next to each other from left to right */
+    GUI_LAYOUT_COLUMN,                      /*!< Children widgets are placed below each other from top to bottom */
+    GUI_LAYOUT_GRID,                        /*!< Children widgets are placed to equal width cells of grid, row by row */
+} gui_layout_mode_t;
+
+/**
+ * \brief           Redraw priority class of widget
+ * \sa              gui_widget_setpriority
+ */
+typedef enum {
+    GUI_WIDGET_PRIO_INTERACTIVE = 0x00,     /*!< Widget is redrawn as soon as possible, default for all widgets */
+    GUI_WIDGET_PRIO_LIVE,                   /*!< Widget showing live data, redrawn at most once per refresh window while frames are over budget */
+    GUI_WIDGET_PRIO_BACKGROUND,             /*!< Widget redraw is postponed while redraw is over budget */
+} gui_widget_prio_t;
+
+/**
+ * \brief           Builder function creating children widgets of container when they are first needed
+ * \param[in]       h: Container widget to create children for
+ * \sa              gui_widget_setbuilder
+ */
+typedef void (*gui_widget_build_fn)(gui_handle_p h);
+
 #if defined(GUI_INTERNAL) || __DOXYGEN__
 
+/**
+ * \brief           Layout parameters and cached result of last arrange pass
+ */
+typedef struct {
+    uint8_t mode;                           /*!< Layout mode, member of \ref gui_layout_mode_t enumeration */
+    uint8_t columns;                        /*!< Number of columns in \ref GUI_LAYOUT_GRID mode */
+    gui_dim_t gap;                          /*!< Space between children widgets in units of pixels */
+    gui_dim_t content_width;                /*!< Width of arranged children, used as scroll limit */
+    gui_dim_t content_height;               /*!< Height of arranged children, used as scroll limit */
+} gui_layout_t;
+
+/**
+ * \brief           Optional widget data, not used by most widgets
+ * \note            With \ref GUI_CFG_USE_COMPACT_HANDLE enabled, structure is allocated on first use
+ */
+typedef struct {
+    gui_color_t* colors;                    /*!< Pointer to allocated color memory when custom colors are used */
+    const gui_style_t* style;               /*!< Shared style of widget or `NULL` if not used */
+    gui_timer_t* timer;                     /*!< Software timer pointer */
+    size_t textmemsize;                     /*!< Number of bytes for text when dynamically allocated */
+    size_t textcursor;                      /*!< Text cursor position */
+    
+    /* Scroll feature, available only for widgets with children support */
+    gui_dim_t x_scroll;                     /*!< Scroll of widgets in horizontal direction in units of pixels */
+    gui_dim_t y_scroll;                     /*!< Scroll of widgets in vertical direction in units of pixels */
+#if GUI_CFG_USE_LAYOUT || __DOXYGEN__
+    gui_layout_t layout;                    /*!< Layout of children widgets */
+#endif /* GUI_CFG_USE_LAYOUT || __DOXYGEN__ */
+#if GUI_CFG_USE_REFRESH_LIMIT || __DOXYGEN__
+    gui_timer_t* refresh_timer;             /*!< Timer ending refresh window of widget */
+    uint16_t refresh_period;                /*!< Minimal time between redraws in units of milliseconds or `0` if not limited */
+    uint8_t refresh_prio;                   /*!< Redraw priority, member of \ref gui_widget_prio_t enumeration */
+    uint8_t refresh_flags;                  /*!< Refresh window state flags */
+#endif /* GUI_CFG_USE_REFRESH_LIMIT || __DOXYGEN__ */
+#if GUI_CFG_USE_WIDGET_BUILDER || __DOXYGEN__
+    gui_widget_build_fn build;              /*!< Builder creating children on first show or `NULL` when widget is built */
+    gui_handle_p build_next;                /*!< Next widget waiting for its builder */
+#endif /* GUI_CFG_USE_WIDGET_BUILDER || __DOXYGEN__ */
+} gui_handle_ext_t;
+
 /**
  * \brief           Common GUI values for widgets
  */
@@ -1141,11 +2007,12 @@ typedef struct gui_handle {
     const gui_widget_t* widget;             /*!< Widget parameters with callback functions */
     gui_widget_evt_fn callback;             /*!< Callback function prototype */
     struct gui_handle* parent;              /*!< Pointer to parent widget */
+    struct gui_handle* remove_next;         /*!< Next widget waiting for removal */
 
-    float x;                                /*!< Object X position relative to parent window in units of pixel/percent */
-    float y;                                /*!< Object Y position relative to parent window in units of pixel/percent */
-    float width;                            /*!< Object width in units of pixel/percent */
-    float height;                           /*!< Object height in units of pixel/percent */
+    gui_coord_t x;                          /*!< Object X position relative to parent window in units of pixel/percent */
+    gui_coord_t y;                          /*!< Object Y position relative to parent window in units of pixel/percent */
+    gui_coord_t width;                      /*!< Object width in units of pixel/percent */
+    gui_coord_t height;                     /*!< Object height in units of pixel/percent */
 
 #if GUI_CFG_USE_POS_SIZE_CACHE || __DOXYGEN__
     /* Absolute values for position and size, changed each time position/size is modified */
@@ -1159,6 +2026,9 @@ typedef struct gui_handle {
     gui_dim_t abs_visible_y1;               /*!< Absolute visible top Y positon on screen for widget */
     gui_dim_t abs_visible_x2;               /*!< Absolute visible right X position on screen for widget */
     gui_dim_t abs_visible_y2;               /*!< Absolute visible bottom Y positon on screen for widget */
+#if GUI_CFG_USE_WIDGET_GRID || __DOXYGEN__
+    uint32_t grid_mask;                     /*!< Mask of screen grid cells covered by visible area of widget */
+#endif /* GUI_CFG_USE_WIDGET_GRID || __DOXYGEN__ */
 #endif /* GUI_CFG_USE_POS_SIZE_CACHE */
 
     uint32_t padding;                       /*!< 4-bytes long padding, each byte of one side, MSB = top padding, LSB = left padding.
@@ -1171,14 +2041,30 @@ typedef struct gui_handle {
     uint32_t flags;                         /*!< All possible flags for specific widget */
     gui_const gui_font_t* font;             /*!< Font used for widget drawings */
     gui_char* text;                         /*!< Pointer to widget text if exists */
-    size_t textmemsize;                     /*!< Number of bytes for text when dynamically allocated */
-    size_t textcursor;                      /*!< Text cursor position */
-    gui_timer_t* timer;                     /*!< Software timer pointer */
-    gui_color_t* colors;                    /*!< Pointer to allocated color memory when custom colors are used */
-    
-    /* Scroll feature, available only for widgets with children support */
-    gui_dim_t x_scroll;                     /*!< Scroll of widgets in horizontal direction in units of pixels */
-    gui_dim_t y_scroll;                     /*!< Scroll of widgets in vertical direction in units of pixels */
+#if GUI_CFG_WIDGET_TEXT_INLINE_SIZE || __DOXYGEN__
+    gui_char text_inline[GUI_CFG_WIDGET_TEXT_INLINE_SIZE];  /*!< Text memory used instead of heap for short dynamic texts */
+#endif /* GUI_CFG_WIDGET_TEXT_INLINE_SIZE || __DOXYGEN__ */
+#if GUI_CFG_USE_TRANSLATE || __DOXYGEN__
+    const gui_char* text_translated;        /*!< Memoized translation of `text` */
+    uint32_t text_translate_version;        /*!< Language version of memoized translation */
+#endif /* GUI_CFG_USE_TRANSLATE || __DOXYGEN__ */
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__
+    gui_text_layout_t text_layout;          /*!< Cached layout of widget text */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__ */
+#if GUI_CFG_USE_COMPACT_HANDLE
+    gui_handle_ext_t* ext;                  /*!< Optional widget data, allocated on first use */
+#else /* GUI_CFG_USE_COMPACT_HANDLE */
+    gui_handle_ext_t ext;                   /*!< Optional widget data */
+#endif /* !GUI_CFG_USE_COMPACT_HANDLE */
+#if GUI_CFG_USE_WIDGET_CACHE || __DOXYGEN__
+    gui_layer_t* cache_layer;               /*!< Offscreen layer with rendered widget and its children */
+#endif /* GUI_CFG_USE_WIDGET_CACHE || __DOXYGEN__ */
+#if GUI_CFG_USE_DISPLAY_LIST || __DOXYGEN__
+    gui_draw_list_t* draw_list;             /*!< Recorded drawing commands of widget, see \ref gui_widget_setdisplaylist */
+#endif /* GUI_CFG_USE_DISPLAY_LIST || __DOXYGEN__ */
+#if GUI_CFG_USE_MEM_ARENA || __DOXYGEN__
+    struct gui_mem_arena* arena;            /*!< Memory arena released together with widget */
+#endif /* GUI_CFG_USE_MEM_ARENA || __DOXYGEN__ */
     
     void* arg;                              /*!< Pointer to optional user data */
 } gui_handle;
@@ -1189,6 +2075,56 @@ typedef struct gui_handle {
  */
 typedef gui_handle_p (*gui_widget_createfunc_fn)(gui_id_t, float, float, float, float, gui_handle_p, gui_widget_evt_fn, uint16_t);
 
+/**
+ * \brief           Constant widget description, entry of screen table
+ *
+ *                  Table of descriptions may be placed to read-only memory
+ *                  and instantiated with \ref gui_widget_createscreen
+ * \sa              gui_widget_createscreen
+ */
+typedef struct {
+    gui_widget_createfunc_fn create;        /*!< Widget create function, such as \ref gui_button_create */
+    gui_id_t id;                            /*!< Widget ID */
+    float x;                                /*!< Widget `X` position relative to parent widget */
+    float y;                                /*!< Widget `Y` position relative to parent widget */
+    float width;                            /*!< Widget width */
+    float height;                           /*!< Widget height */
+    int16_t parent;                         /*!< Index of parent entry in table. Set to `-1` to use parent passed to create function */
+    uint16_t flags;                         /*!< Flags for create procedure, see \ref GUI_WIDGET_CREATE_FLAGS */
+    gui_widget_evt_fn evt_fn;               /*!< Widget callback function. Set to `NULL` to use default widget specific callback */
+    const gui_char* text;                   /*!< Widget text or source text for translation. Set to `NULL` to keep default */
+    gui_const gui_font_t* font;             /*!< Widget font. Set to `NULL` to use default font */
+    const gui_color_t* colors;              /*!< Complete list of widget colors used without copy. Set to `NULL` to use widget default colors */
+    uint32_t padding;                       /*!< Padding, each byte of one side, MSB = top padding, LSB = left padding. Set to `0` to keep default */
+    const gui_style_t* style;               /*!< Shared style applied before other entry values. Set to `NULL` if not used */
+} gui_widget_desc_t;
+
+/**
+ * \brief           Saved state of screen created from description table
+ *
+ *                  State of widgets is serialized to compact memory buffer,
+ *                  so screen widgets can be removed and created again later with the same values
+ * \sa              gui_widget_snapshot_save, gui_widget_snapshot_restore, gui_widget_snapshot_free
+ */
+typedef struct {
+    uint8_t* data;                          /*!< Serialized state of all widgets of screen */
+    size_t len;                             /*!< Number of bytes in `data` buffer */
+    size_t count;                           /*!< Number of widgets in snapshot */
+    gui_layer_t* frame;                     /*!< Rendered content of first widget, taken from its cache layer. `NULL` if not kept */
+} gui_snapshot_t;
+
+/**
+ * \brief           Widget setter with integer value, applied from command queue
+ * \sa              gui_widget_post_int
+ */
+typedef uint8_t (*gui_widget_cmd_int_fn)(gui_handle_p h, int32_t value);
+
+/**
+ * \brief           Widget setter with text value, applied from command queue
+ * \sa              gui_widget_post_text
+ */
+typedef uint8_t (*gui_widget_cmd_text_fn)(gui_handle_p h, const gui_char* text);
+
 /**
  * \}
  */
@@ -1210,8 +2146,125 @@ typedef struct {
 typedef struct gui_translate {
     const gui_translate_language_t* source; /*!< Pointer to source language table */
     const gui_translate_language_t* active; /*!< Pointer to current language table */
+    uint16_t* hash;                         /*!< Hash table of source entries, each slot holds `index + 1` or `0` when empty */
+    size_t hash_mask;                       /*!< Number of hash table slots minus `1` */
+    uint32_t version;                       /*!< Incremented on each language change, used to invalidate memoized translations */
 } gui_translate_t;
 
+/**
+ * \ingroup         GUI_ANIM
+ * \brief           List of widget properties animated by animation engine
+ */
+typedef enum {
+    GUI_ANIM_PROP_X = 0x00,                 /*!< `X` position relative to parent in units of pixels */
+    GUI_ANIM_PROP_Y,                        /*!< `Y` position relative to parent in units of pixels */
+    GUI_ANIM_PROP_WIDTH,                    /*!< Width in units of pixels */
+    GUI_ANIM_PROP_HEIGHT,                   /*!< Height in units of pixels */
+    GUI_ANIM_PROP_ALPHA,                    /*!< Widget transparency, between `0x00` and `0xFF` */
+    GUI_ANIM_PROP_XSCROLL,                  /*!< Horizontal scroll of widget with children support */
+    GUI_ANIM_PROP_YSCROLL,                  /*!< Vertical scroll of widget with children support */
+    GUI_ANIM_PROP_VALUE,                    /*!< Widget value, applied with setter function, see \ref gui_anim_startvalue */
+} gui_anim_prop_t;
+
+/**
+ * \ingroup         GUI_ANIM
+ * \brief           List of easing functions
+ */
+typedef enum {
+    GUI_ANIM_EASE_LINEAR = 0x00,            /*!< Constant speed */
+    GUI_ANIM_EASE_IN_QUAD,                  /*!< Quadratic acceleration from zero speed */
+    GUI_ANIM_EASE_OUT_QUAD,                 /*!< Quadratic deceleration to zero speed */
+    GUI_ANIM_EASE_IN_OUT_QUAD,              /*!< Quadratic acceleration until halfway, then deceleration */
+    GUI_ANIM_EASE_IN_CUBIC,                 /*!< Cubic acceleration from zero speed */
+    GUI_ANIM_EASE_OUT_CUBIC,                /*!< Cubic deceleration to zero speed */
+    GUI_ANIM_EASE_IN_OUT_CUBIC,             /*!< Cubic acceleration until halfway, then deceleration */
+} gui_anim_ease_t;
+
+/**
+ * \ingroup         GUI_ANIM
+ * \brief           List of screen transitions
+ *
+ *                  Direction is direction of movement, incoming screen enters from opposite edge
+ */
+typedef enum {
+    GUI_TRANSITION_SLIDE_LEFT = 0x00,       /*!< Incoming screen slides to the left over outgoing screen */
+    GUI_TRANSITION_SLIDE_RIGHT,             /*!< Incoming screen slides to the right over outgoing screen */
+    GUI_TRANSITION_SLIDE_UP,                /*!< Incoming screen slides up over outgoing screen */
+    GUI_TRANSITION_SLIDE_DOWN,              /*!< Incoming screen slides down over outgoing screen */
+    GUI_TRANSITION_PUSH_LEFT,               /*!< Incoming screen pushes outgoing screen to the left */
+    GUI_TRANSITION_PUSH_RIGHT,              /*!< Incoming screen pushes outgoing screen to the right */
+    GUI_TRANSITION_PUSH_UP,                 /*!< Incoming screen pushes outgoing screen up */
+    GUI_TRANSITION_PUSH_DOWN,               /*!< Incoming screen pushes outgoing screen down */
+} gui_transition_t;
+
+/**
+ * \ingroup         GUI_ANIM
+ * \brief           Single running property animation
+ */
+typedef struct gui_anim {
+    struct gui_anim* next;                  /*!< Next animation in list of running animations */
+    gui_handle_p h;                         /*!< Animated widget */
+    gui_widget_cmd_int_fn fn;               /*!< Setter for \ref GUI_ANIM_PROP_VALUE property */
+    int32_t from;                           /*!< Start value */
+    int32_t to;                             /*!< End value */
+    int32_t value;                          /*!< Last applied value */
+    uint32_t start;                         /*!< Start time in units of milliseconds */
+    uint32_t duration;                      /*!< Duration in units of milliseconds */
+    uint8_t prop;                           /*!< Animated property of \ref gui_anim_prop_t type */
+    uint8_t ease;                           /*!< Easing function of \ref gui_anim_ease_t type */
+} gui_anim_t;
+
+/**
+ * \ingroup         GUI_DEFER
+ * \brief           Deferred work function, called outside core protection
+ * \param[in]       arg: Custom argument passed to \ref gui_defer
+ */
+typedef void (*gui_defer_fn)(void* arg);
+
+/**
+ * \ingroup         GUI_REMOTE
+ * \brief           Remote stream transport function, called outside core protection
+ * \param[in]       data: Encoded stream data
+ * \param[in]       len: Number of bytes to write
+ * \param[in]       arg: Custom argument passed to \ref gui_remote_start
+ * \return          `1` when all bytes were written, `0` otherwise
+ */
+typedef uint8_t (*gui_remote_write_fn)(const void* data, size_t len, void* arg);
+
+/**
+ * \ingroup         GUI_INPUT
+ * \brief           Type of input record
+ */
+typedef enum {
+    GUI_INPUT_RECORD_TOUCH = 0x00,          /*!< Touch entry */
+    GUI_INPUT_RECORD_KEY,                   /*!< Keyboard entry */
+    GUI_INPUT_RECORD_MARK                   /*!< Application mark, see \ref gui_input_record_mark */
+} gui_input_record_type_t;
+
+/**
+ * \ingroup         GUI_INPUT
+ * \brief           Single input record
+ */
+typedef struct {
+    uint32_t time;                          /*!< Time relative to start of recording in units of milliseconds */
+    uint8_t type;                           /*!< Record type of \ref gui_input_record_type_t */
+    union {
+        gui_touch_data_t ts;                /*!< Touch entry for \ref GUI_INPUT_RECORD_TOUCH type */
+        gui_keyboard_data_t kb;             /*!< Keyboard entry for \ref GUI_INPUT_RECORD_KEY type */
+        uint32_t mark;                      /*!< Mark value for \ref GUI_INPUT_RECORD_MARK type */
+    } data;                                 /*!< Record data */
+} gui_input_record_t;
+
+/**
+ * \ingroup         GUI_INPUT
+ * \brief           Replay function for application marks
+ *
+ *                  Application applies the same widget update as when mark was recorded
+ * \param[in]       mark: Mark value passed to \ref gui_input_record_mark
+ * \param[in]       arg: Custom argument passed to \ref gui_input_replay_start
+ */
+typedef void (*gui_input_replay_fn)(uint32_t mark, void* arg);
+
 /**
  * \}
  */
@@ -155,6 +155,9 @@ typedef struct {
     gui_color_t color1;                     /*!< Color 1 */
     gui_color_t color2;                     /*!< Color 2 */
     uint32_t scrolly;                       /*!< Scroll in vertical direction */
+    gui_text_layout_t* layout;              /*!< Optional layout cache, used when \ref GUI_CFG_USE_TEXT_LAYOUT_CACHE is enabled */
+    gui_dim_t cursorx;                      /*!< Output: X position after last character, set when \ref GUI_FLAG_TEXT_EDITMODE is used */
+    gui_dim_t cursory;                      /*!< Output: Top Y position of last line, set when \ref GUI_FLAG_TEXT_EDITMODE is used */
 } gui_draw_text_t;
 
 #define GUI_FLAG_DRAW_GRAD_VER              0x01
@@ -215,6 +218,16 @@ typedef struct {
     gui_dim_t y;                           /*!< Poly point Y location */
 } gui_draw_poly_t;
 
+/**
+ * \brief           Function to draw content of sprite
+ * \param[in]       disp: Clipping region of sprite
+ * \param[in]       x: Top left X position of sprite
+ * \param[in]       y: Top left Y position of sprite
+ * \param[in]       key: Sprite key, describing its look
+ * \sa              guii_draw_sprite
+ */
+typedef void (*gui_draw_sprite_fn)(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, const void* key);
+
 void        gui_draw_text_init(gui_draw_text_t* f);
 void        gui_draw_fillscreen(const gui_display_t* disp, gui_color_t color);
 void        gui_draw_setpixel(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_color_t color);
@@ -227,18 +240,57 @@ void        gui_draw_rectangle_ex(const gui_display_t* disp, gui_draw_rect_ex_t*
 void        gui_draw_filledrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color);
 void        gui_draw_roundedrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t r, gui_color_t color);
 void        gui_draw_filledroundedrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t r, gui_color_t color);
+#if GUI_CFG_USE_GRADIENT || __DOXYGEN__
+void        gui_draw_gradientrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const gui_gradient_t* grad);
+void        gui_draw_gradientroundedrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t r, const gui_gradient_t* grad);
+#endif /* GUI_CFG_USE_GRADIENT || __DOXYGEN__ */
 void        gui_draw_circle(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, gui_color_t color);
 void        gui_draw_filledcircle(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, gui_color_t color);
 void        gui_draw_circlecorner(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, uint8_t c, gui_color_t color);
 void        gui_draw_filledcirclecorner(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, uint8_t c, uint32_t color);
+void        gui_draw_line_aa(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_color_t color);
+void        gui_draw_circle_aa(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, gui_color_t color);
+void        gui_draw_circlecorner_aa(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y0, gui_dim_t r, uint8_t c, gui_color_t color);
 void        gui_draw_triangle(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1,  gui_dim_t x2, gui_dim_t y2, gui_dim_t x3, gui_dim_t y3, gui_color_t color);
 void        gui_draw_filledtriangle(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_dim_t x3, gui_dim_t y3, gui_color_t color);
 void        gui_draw_image(gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_desc_t* img);
+uint8_t     gui_draw_image_cacheremove(const gui_image_desc_t* img);
+#if (GUI_CFG_USE_IMAGE_CACHE && GUI_CFG_USE_CACHE_RETAIN) || __DOXYGEN__
+uint8_t     guii_draw_image_cacheadopt(gui_image_cacheentry_t* entry);
+#endif /* (GUI_CFG_USE_IMAGE_CACHE && GUI_CFG_USE_CACHE_RETAIN) || __DOXYGEN__ */
+#if (GUI_CFG_USE_IMAGE_CACHE && GUI_CFG_USE_CACHE_MANAGER) || __DOXYGEN__
+uint8_t     guii_draw_image_cachereclaim(void);
+#endif /* (GUI_CFG_USE_IMAGE_CACHE && GUI_CFG_USE_CACHE_MANAGER) || __DOXYGEN__ */
+#if (GUI_CFG_USE_SPRITE_CACHE && GUI_CFG_USE_CACHE_MANAGER) || __DOXYGEN__
+uint8_t     guii_draw_sprite_cachereclaim(void);
+#endif /* (GUI_CFG_USE_SPRITE_CACHE && GUI_CFG_USE_CACHE_MANAGER) || __DOXYGEN__ */
+#if GUI_CFG_USE_NINEPATCH || __DOXYGEN__
+void        gui_draw_ninepatch(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const gui_ninepatch_t* np);
+#endif /* GUI_CFG_USE_NINEPATCH || __DOXYGEN__ */
+#if GUI_CFG_USE_IMAGE_TRANSFORM || __DOXYGEN__
+void        gui_draw_image_transform(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_desc_t* img, const gui_image_transform_t* tr);
+#endif /* GUI_CFG_USE_IMAGE_TRANSFORM || __DOXYGEN__ */
+void        guii_draw_sprite(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const void* key, size_t key_len, gui_draw_sprite_fn render);
+#if GUI_CFG_USE_VECTOR_ICON || __DOXYGEN__
+void        gui_draw_icon(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t height, const gui_icon_t* icon, gui_color_t color);
+gui_dim_t   gui_draw_icon_getwidth(const gui_icon_t* icon, gui_dim_t height);
+uint8_t     guii_draw_icon_rasterize(const gui_icon_t* icon, gui_dim_t width, gui_dim_t height, uint8_t* out);
+#endif /* GUI_CFG_USE_VECTOR_ICON || __DOXYGEN__ */
 void        gui_draw_writetext(const gui_display_t* disp, const gui_font_t* font, const gui_char* str, gui_draw_text_t* draw);
+void        gui_draw_text_layout_invalidate(gui_text_layout_t* layout);
+void        gui_draw_text_layout_invalidatefrom(gui_text_layout_t* layout, size_t offset);
+void        gui_draw_text_layout_free(gui_text_layout_t* layout);
 void        gui_draw_rectangle3d(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_draw_3d_state_t state);
 void        gui_draw_poly(const gui_display_t* disp, const gui_draw_poly_t* points, size_t len, gui_color_t color);
 void        gui_draw_scrollbar_init(gui_draw_sb_t* sb);
 void        gui_draw_scrollbar(const gui_display_t* disp, gui_draw_sb_t* sb);
+#if GUI_CFG_USE_DISPLAY_LIST || __DOXYGEN__
+void        gui_draw_list_start(gui_draw_list_t* list);
+uint8_t     gui_draw_list_stop(gui_draw_list_t* list);
+void        gui_draw_list_replay(const gui_display_t* disp, const gui_draw_list_t* list);
+void        gui_draw_list_free(gui_draw_list_t* list);
+void        guii_draw_list_cancel(void);
+#endif /* GUI_CFG_USE_DISPLAY_LIST || __DOXYGEN__ */
 
 /**
  * \}
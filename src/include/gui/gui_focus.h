@@ -0,0 +1,81 @@
+/**	
+ * \file            gui_focus.h
+ * \brief           Focus graph for navigation keys
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_FOCUS_H
+#define GUI_HDR_FOCUS_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_utils.h"
+
+/**
+ * \ingroup         GUI_UTILS
+ * \defgroup        GUI_FOCUS Focus graph
+ * \brief           Focus navigation with arrow keys and rotary encoder
+ *
+ *                  Neighbours of all focusable widgets in direction of each arrow key
+ *                  are calculated once after widget tree or layout changes.
+ *                  Each navigation key then moves focus with single lookup, without widget tree scan.
+ *
+ *                  Rotary encoder drivers can move focus with \ref GUI_FOCUS_DIR_NEXT
+ *                  and \ref GUI_FOCUS_DIR_PREV directions on each detent.
+ * \{
+ */
+
+uint8_t     gui_focus_move(gui_focus_dir_t dir);
+uint8_t     guii_focus_move(gui_focus_dir_t dir);
+
+/**
+ * \brief           Mark focus graph to be built again on next navigation
+ * \note            Called on every widget tree, visibility or position change
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_KEYBOARD && GUI_CFG_USE_FOCUS_GRAPH
+#define guii_focus_invalidate()         (GUI.focus_graph.dirty = 1)
+#else
+#define guii_focus_invalidate()
+#endif /* GUI_CFG_USE_KEYBOARD && GUI_CFG_USE_FOCUS_GRAPH */
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_FOCUS_H */
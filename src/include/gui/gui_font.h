@@ -0,0 +1,73 @@
+/**	
+ * \file            gui_font.h
+ * \brief           Font file loader
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_FONT_H
+#define GUI_HDR_FONT_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_utils.h"
+
+/**
+ * \ingroup         GUI_UTILS
+ * \defgroup        GUI_FONT Font file loader
+ * \brief           Load fonts from file system or memory at runtime
+ *
+ * Font file is little endian and starts with 16-byte header:
+ * `"EGF1"` magic, `u8` size, `u8` flags, `u16` range count, `u16` kerning count, `u16` reserved, `u32` character count.
+ *
+ * Header is followed by range records (`u32` start, `u16` count, `u16` index),
+ * character records (`u8` x size, y size, x pos, y pos, x margin, advance, `u16` advance in `1/64` pixel, `u32` data offset),
+ * kerning records (`u16` left, `u16` right, `i8` value, `u8` reserved) and character data.
+ *
+ * \{
+ */
+
+uint8_t     gui_font_load(gui_font_t* font, const void* data, size_t len);
+uint8_t     gui_font_open(gui_font_t* font, uint8_t (*read)(const gui_font_t* font, size_t offset, void* data, size_t len), void* arg);
+uint8_t     gui_font_close(gui_font_t* font);
+size_t      gui_font_prefetch(const gui_font_t* font, const gui_char* str);
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_FONT_H */
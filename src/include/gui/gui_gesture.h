@@ -0,0 +1,70 @@
+/**	
+ * \file            gui_gesture.h
+ * \brief           Touch gesture recognizer
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_GESTURE_H
+#define GUI_HDR_GESTURE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_utils.h"
+
+/**
+ * \ingroup         GUI_UTILS
+ * \defgroup        GUI_GESTURE Gesture recognizer
+ * \brief           Swipe, fling, pinch and rotate gestures from touch input
+ *
+ *                  Touch samples are only stored when received. Movement of all samples received
+ *                  during single \ref gui_process call is processed once, with integer math only,
+ *                  and each recognized gesture is sent to widget with \ref GUI_EVT_GESTURE event.
+ *                  Swipe and fling are reported on touch release, pinch and rotate at most once per process call.
+ * \{
+ */
+
+void        guii_gesture_sample(const gui_touch_data_t* const ts);
+void        guii_gesture_process(void);
+uint8_t     guii_gesture_getspeed(int32_t* const speed_x, int32_t* const speed_y);
+void        guii_gesture_remove(gui_handle_p h);
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_GESTURE_H */
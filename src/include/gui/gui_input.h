@@ -47,13 +47,27 @@ extern "C" {
 #include "gui/gui.h"
     
 uint8_t gui_input_touchadd(gui_touch_data_t* const ts);
+uint8_t gui_input_touchadd_isr(gui_touch_data_t* const ts);
+gui_touch_data_t* gui_input_touchgetentry(void);
+uint8_t gui_input_touchcommit(void);
+uint8_t gui_input_touchcommit_isr(void);
 uint8_t gui_input_keyadd(gui_keyboard_data_t* const kb);
+uint8_t gui_input_keyadd_isr(gui_keyboard_data_t* const kb);
+uint8_t gui_input_record_start(gui_input_record_t* rec, size_t size);
+size_t gui_input_record_stop(void);
+uint8_t gui_input_record_mark(uint32_t mark);
+uint8_t gui_input_replay_start(const gui_input_record_t* rec, size_t count, gui_input_replay_fn fn, void* arg);
+uint8_t gui_input_replay_process(void);
 
 #if !__DOXYGEN__ && defined(GUI_INTERNAL)
 void guii_input_init(void);
 uint8_t guii_input_touchavailable(void);
 uint8_t guii_input_touchread(gui_touch_data_t* const ts);
+size_t guii_input_touchcompress(gui_touch_data_t* const ts);
+uint8_t guii_input_touchnexttime(uint32_t* const time);
 uint8_t guii_input_keyread(gui_keyboard_data_t* const kb);
+uint8_t guii_input_keynexttime(uint32_t* const time);
+uint8_t guii_input_available(void);
 #endif /* !__DOXYGEN__ && defined(GUI_INTERNAL) */
 
 /**
@@ -51,6 +51,38 @@ extern "C" {
 gui_dim_t  gui_lcd_getwidth(void);
 gui_dim_t  gui_lcd_getheight(void);
 void        gui_lcd_confirmactivelayer(uint8_t layer_num);
+void        gui_lcd_fence(void);
+uint8_t     gui_stats_get(gui_stats_t* stats);
+
+#if !__DOXYGEN__
+#if GUI_CFG_USE_LL_STATS
+#define GUI_LCD_STATS_GLYPH()       (GUI.stats.glyphs++)
+#else /* GUI_CFG_USE_LL_STATS */
+#define GUI_LCD_STATS_GLYPH()
+#endif /* !GUI_CFG_USE_LL_STATS */
+
+#if GUI_CFG_USE_LAYER_COMPRESSION
+#define GUI_LCD_TILES_SIZE(w, h)    guii_lcd_tiles_size((w), (h))
+#define GUI_LCD_TILES_INIT(layer)   guii_lcd_tiles_init(layer)
+#define GUI_LCD_TILES_UPDATE(layer) guii_lcd_tiles_update(layer)
+#else /* GUI_CFG_USE_LAYER_COMPRESSION */
+#define GUI_LCD_TILES_SIZE(w, h)    0
+#define GUI_LCD_TILES_INIT(layer)
+#define GUI_LCD_TILES_UPDATE(layer)
+#endif /* !GUI_CFG_USE_LAYER_COMPRESSION */
+
+void        guii_lcd_stats_init(void);
+void        guii_lcd_stats_endframe(void);
+uint8_t     guii_lcd_rotation_init(void);
+void        guii_lcd_rotation_point(gui_dim_t* x, gui_dim_t* y);
+uint8_t     guii_lcd_rotation_cacheremove(const gui_image_desc_t* img);
+uint8_t     guii_lcd_rotation_cachereclaim(void);
+const gui_layer_access_t* guii_lcd_getaccess(const gui_layer_t* layer, uint8_t sync);
+size_t      guii_lcd_tiles_size(gui_dim_t width, gui_dim_t height);
+void        guii_lcd_tiles_init(gui_layer_t* layer);
+void        guii_lcd_tiles_update(gui_layer_t* layer);
+void        guii_lcd_copylayer(gui_layer_t* drawing, const gui_layer_t* layer, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2);
+#endif /* !__DOXYGEN__ */
 
 /**
  * \}
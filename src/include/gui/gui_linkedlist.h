@@ -60,6 +60,8 @@ extern "C" {
 #define gui_linkedlist_multi_getdata(e)     (((e) != NULL) ? (e)->element : NULL)
 
 void                    gui_linkedlist_add_gen(gui_linkedlistroot_t* const root, gui_linkedlist_t* const element);
+void                    gui_linkedlist_insertbefore_gen(gui_linkedlistroot_t* const root, gui_linkedlist_t* const before, gui_linkedlist_t* const element);
+void                    gui_linkedlist_sort_gen(gui_linkedlistroot_t* const root, int (*cmp)(const void* e1, const void* e2, void* arg), void* arg);
 gui_linkedlist_t*       gui_linkedlist_remove_gen(gui_linkedlistroot_t* const root, gui_linkedlist_t* const element);
 gui_linkedlist_t*       gui_linkedlist_getnext_gen(gui_linkedlistroot_t* const root, gui_linkedlist_t* const element);
 gui_linkedlist_t*       gui_linkedlist_getprev_gen(gui_linkedlistroot_t* const root, gui_linkedlist_t* const element);
@@ -54,6 +54,11 @@ uint8_t gui_math_sqrt(float x, float* const result);
 uint8_t gui_math_rsqrt(float x, float* const result);
 uint8_t gui_math_distancebetweenxy(float x1, float y1, float x2, float y2, float* const result);
 uint8_t gui_math_centerofxy(float x1, float y1, float x2, float y2, float* const resultx, float* const resulty);
+uint8_t gui_math_isqrt(uint32_t x, uint32_t* const result);
+uint8_t gui_math_iatan2(int32_t y, int32_t x, int16_t* const result);
+uint8_t gui_math_isincos(int16_t angle, int32_t* const result_sin, int32_t* const result_cos);
+uint8_t gui_math_isincos_q15(int16_t angle, int16_t* const result_sin, int16_t* const result_cos);
+uint8_t gui_math_irecip(uint32_t x, uint32_t* const result);
     
 /**
  * \}
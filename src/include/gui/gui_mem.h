@@ -48,12 +48,29 @@ extern "C" {
  * \{
  */
 
+/**
+ * \defgroup        GUI_MEM_CLASS Allocation classes
+ * \brief           Classes of allocations, used to place memory to suitable region
+ * \sa              gui_mem_region_t, GUI_MEMALLOC_CLASS
+ * \{
+ */
+#define GUI_MEM_CLASS_ANY               ((uint8_t)0x00) /*!< No preference, general purpose regions are used first */
+#define GUI_MEM_CLASS_FAST              ((uint8_t)0x01) /*!< Small and frequently accessed structures, such as widget handles and timers */
+#define GUI_MEM_CLASS_BULK              ((uint8_t)0x02) /*!< Big rarely accessed buffers */
+#define GUI_MEM_CLASS_DMA               ((uint8_t)0x04) /*!< Memory must be accessible by DMA or graphics accelerator */
+#define GUI_MEM_CLASS_PIXEL             (GUI_MEM_CLASS_BULK | GUI_MEM_CLASS_DMA)    /*!< Pixel buffers, such as layers and images */
+/**
+ * \}
+ */
+
 /**
  * \brief           Single memory region descriptor
  */
 typedef struct mem_region_t {
     void* start_address;                /*!< Start address of region */
     size_t size;                        /*!< Size in units of bytes of region */
+    uint8_t classes;                    /*!< Allocation classes preferred in region, see \ref GUI_MEM_CLASS.
+                                            Set to `0` for general purpose region usable by all allocations, including DMA */
 } mem_region_t;
 
 /**
@@ -61,15 +78,88 @@ typedef struct mem_region_t {
  */
 typedef mem_region_t gui_mem_region_t;
 
+/**
+ * \brief           Heap usage and fragmentation statistics
+ * \sa              gui_mem_getstats
+ */
+typedef struct {
+    size_t free_bytes;                  /*!< Sum of user sizes of free blocks */
+    size_t used_bytes;                  /*!< Sum of user sizes of used blocks */
+    size_t free_blocks;                 /*!< Number of free blocks */
+    size_t used_blocks;                 /*!< Number of used blocks */
+    size_t largest_free;                /*!< Largest free block, maximal size of single allocation */
+    uint8_t fragmentation;              /*!< Fragmentation in percent, `0` when all free memory is in single block */
+    size_t alloc_count;                 /*!< Number of successful allocations */
+    size_t fail_count;                  /*!< Number of failed allocations */
+    size_t fail_size;                   /*!< Requested size of last failed allocation */
+    const char* fail_tag;               /*!< Tag of last failed allocation, valid with \ref GUI_CFG_MEM_TRACE */
+} gui_mem_stat_t;
+
+/**
+ * \brief           Heap walk callback function
+ * \param[in]       ptr: User memory of block
+ * \param[in]       size: User size of block in units of bytes
+ * \param[in]       used: `1` if block is allocated, `0` if free
+ * \param[in]       tag: Allocation tag or `NULL` if not known
+ * \param[in]       arg: Custom argument passed to \ref gui_mem_walk
+ */
+typedef void (*gui_mem_walk_fn)(void* ptr, size_t size, uint8_t used, const char* tag, void* arg);
+
 void* gui_mem_alloc(uint32_t size);
 void* gui_mem_realloc(void* ptr, size_t size);
 void* gui_mem_calloc(size_t num, size_t size);
+void* gui_mem_realloc_tag(void* ptr, size_t size, const char* tag);
+void* gui_mem_calloc_tag(size_t num, size_t size, const char* tag);
+void* gui_mem_calloc_class(size_t num, size_t size, uint8_t cls, const char* tag);
+const char* gui_mem_settag(const char* tag);
 void gui_mem_free(void* ptr);
 size_t gui_mem_getfree(void);
 size_t gui_mem_getfull(void);
 size_t gui_mem_getminfree(void);
+size_t gui_mem_getalloccount(void);
+uint8_t gui_mem_getstats(gui_mem_stat_t* stat);
+size_t gui_mem_walk(gui_mem_walk_fn fn, void* arg);
 
 uint8_t gui_mem_assignmemory(const gui_mem_region_t* regions, size_t size);
+
+/**
+ * \brief           Memory arena with bump allocation
+ */
+typedef struct gui_mem_arena gui_mem_arena_t;
+
+gui_mem_arena_t*    gui_mem_arena_create(size_t size);
+size_t              gui_mem_arena_blocksize(size_t size);
+gui_mem_arena_t*    gui_mem_arena_setactive(gui_mem_arena_t* arena);
+void                gui_mem_arena_delete(gui_mem_arena_t* arena);
+
+/**
+ * \brief           Handle of movable memory, current memory address is `*handle`
+ * \sa              gui_mem_movable_alloc
+ */
+typedef void** gui_mem_handle_t;
+
+gui_mem_handle_t    gui_mem_movable_alloc(size_t size);
+uint8_t             gui_mem_movable_realloc(gui_mem_handle_t h, size_t size);
+void                gui_mem_movable_free(gui_mem_handle_t h);
+size_t              gui_mem_compact(size_t max);
+
+/**
+ * \brief           Frame scratch memory statistics
+ * \sa              gui_mem_frame_getstats
+ */
+typedef struct {
+    size_t size;                        /*!< Size of scratch memory, `0` until first use */
+    size_t used;                        /*!< Number of bytes currently used */
+    size_t last;                        /*!< Most bytes used during last finished frame */
+    size_t peak;                        /*!< Most bytes used during any frame, high-water mark */
+    size_t fallback_count;              /*!< Number of buffers allocated from heap as scratch memory was full */
+} gui_mem_frame_stat_t;
+
+void*               gui_mem_frame_alloc(size_t size, const char* tag);
+void                gui_mem_frame_free(void* ptr);
+size_t              gui_mem_frame_getfree(void);
+void                gui_mem_frame_reset(void);
+uint8_t             gui_mem_frame_getstats(gui_mem_frame_stat_t* stat);
     
 /**
  * \}
@@ -65,35 +65,318 @@ typedef struct {
     uint32_t type;                          /*!< Message type */
 } gui_mbox_msg_t;
 
+/*
+ * Reasons to wakeup GUI thread. Ports with notifications
+ * receive them as bits, message box ports only wakeup thread
+ */
+#define GUI_SYS_WAKEUP_INPUT                0x01    /*!< New input entry is available */
+#define GUI_SYS_WAKEUP_TIMER                0x02    /*!< Timer deadline changed */
+#define GUI_SYS_WAKEUP_INVALIDATE           0x04    /*!< Redraw is pending */
+#define GUI_SYS_WAKEUP_LAYER                0x08    /*!< Layer was confirmed by display driver */
+#define GUI_SYS_WAKEUP_WIDGET               0x10    /*!< Widget command, removal or deferred work is pending */
+
+#if GUI_SYS_USE_NOTIFY
+#define guii_wakeup(reason)                 gui_sys_notify(&GUI.OS.thread_id, (reason))
+#define guii_wakeup_isr(reason)             gui_sys_notify_isr(&GUI.OS.thread_id, (reason))
+#else /* GUI_SYS_USE_NOTIFY */
+#define guii_wakeup(reason)                 gui_sys_mbox_putnow(&GUI.OS.mbox, NULL)
+#define guii_wakeup_isr(reason)             gui_sys_mbox_putnow_isr(&GUI.OS.mbox, NULL)
+#endif /* !GUI_SYS_USE_NOTIFY */
+
 /**
  * \brief           OS dependant variables
  */
 typedef struct {
     gui_sys_thread_t thread_id;             /*!< GUI thread ID */
+#if !GUI_SYS_USE_NOTIFY
     gui_sys_mbox_t mbox;                    /*!< Operating system message box */
+#endif /* !GUI_SYS_USE_NOTIFY */
+    uint8_t processing;                     /*!< Set to `1` when GUI thread is processing and events do not need wakeup */
+    gui_idle_stat_t idle_stat;              /*!< Idle statistics */
 } GUI_OS_t;
 #endif /* GUI_CFG_OS */
 
+#if GUI_CFG_USE_PROFILER || __DOXYGEN__
+/**
+ * \brief           Profiler data
+ */
+typedef struct {
+    gui_profiler_frame_t frames[GUI_CFG_PROFILER_FRAMES];   /*!< Ring buffer of recent frames */
+    size_t frames_count;                    /*!< Number of frames written since reset */
+    gui_profiler_frame_t current;           /*!< Frame being recorded */
+    gui_profiler_entry_t types[GUI_CFG_PROFILER_TYPES]; /*!< Draw cost per widget type */
+    gui_profiler_entry_t ids[GUI_CFG_PROFILER_IDS]; /*!< Draw cost per widget ID */
+    gui_profiler_fn fn;                     /*!< Callback called after each frame */
+} gui_profiler_t;
+#endif /* GUI_CFG_USE_PROFILER || __DOXYGEN__ */
+
+#if GUI_CFG_USE_POPUP_RESTORE || __DOXYGEN__
+/**
+ * \brief           State of pixels saved below popup widget
+ */
+typedef enum {
+    GUI_POPUP_IDLE = 0x00,                  /*!< No popup pixels are saved */
+    GUI_POPUP_OPENING,                      /*!< Popup is opening, its invalidations are not checked */
+    GUI_POPUP_SAVE,                         /*!< Pixels below popup are saved on next frame */
+    GUI_POPUP_SAVED,                        /*!< Pixels below popup are saved and up to date */
+    GUI_POPUP_RESTORE,                      /*!< Popup is closed, saved pixels are copied on next frame */
+} gui_popup_state_t;
+#endif /* GUI_CFG_USE_POPUP_RESTORE || __DOXYGEN__ */
+
+#if GUI_CFG_USE_LATENCY || __DOXYGEN__
+/**
+ * \brief           Touch-to-photon latency measurement state
+ */
+typedef enum {
+    GUI_LATENCY_IDLE = 0x00,                /*!< No touch is measured */
+    GUI_LATENCY_DISPATCH,                   /*!< Touch is dispatched to widgets */
+    GUI_LATENCY_INVALIDATED,                /*!< Dispatched touch invalidated widget */
+    GUI_LATENCY_WAIT_FRAME,                 /*!< Waiting for frame to start */
+    GUI_LATENCY_RENDER,                     /*!< Frame with touch result is drawn */
+    GUI_LATENCY_CONFIRM,                    /*!< Waiting for layer confirmation */
+    GUI_LATENCY_CONFIRMED,                  /*!< Layer is confirmed, sample is not saved yet */
+} gui_latency_state_t;
+
+/**
+ * \brief           Touch-to-photon latency data
+ */
+typedef struct {
+    volatile uint8_t state;                 /*!< Measurement state of \ref gui_latency_state_t type */
+    uint32_t received;                      /*!< Time touch was added to input buffer */
+    uint32_t dispatch;                      /*!< Time touch was read from input buffer */
+    uint32_t dispatched;                    /*!< Time touch dispatch finished */
+    uint32_t rendered;                      /*!< Time frame was drawn */
+    uint32_t confirmed;                     /*!< Time layer was confirmed */
+    uint32_t samples[GUI_CFG_LATENCY_SAMPLES];  /*!< Total latency of recent touches */
+    gui_latency_stat_t stat;                /*!< Statistics, averages are saved as sums */
+} gui_latency_t;
+#endif /* GUI_CFG_USE_LATENCY || __DOXYGEN__ */
+
+#if GUI_CFG_USE_WIDGET_POOL || __DOXYGEN__
+/**
+ * \brief           Widget object pool
+ */
+typedef struct {
+    gui_widget_pool_stat_t stat;            /*!< Pool statistics, widget type and number of blocks */
+    uint8_t* mem;                           /*!< Pointer to pool memory */
+    size_t block_size;                      /*!< Size of single block in units of bytes */
+    void* free_list;                        /*!< Pointer to first free block, each free block holds pointer to next one */
+} gui_widget_pool_t;
+#endif /* GUI_CFG_USE_WIDGET_POOL || __DOXYGEN__ */
+
+#if GUI_CFG_USE_OVERLAY || __DOXYGEN__
+/**
+ * \brief           Hardware overlay plane used by widget
+ */
+typedef struct {
+    gui_handle_p h;                         /*!< Widget shown on plane, `NULL` when plane is free */
+    gui_layer_t* layer;                     /*!< Plane buffer with rendered widget and its children */
+    gui_dim_t x;                            /*!< X position last set to low-level */
+    gui_dim_t y;                            /*!< Y position last set to low-level */
+    uint8_t alpha;                          /*!< Plane alpha last set to low-level */
+    uint8_t shown;                          /*!< Set to `1` when plane is enabled on low-level */
+} gui_overlay_plane_t;
+#endif /* GUI_CFG_USE_OVERLAY || __DOXYGEN__ */
+
+#if GUI_CFG_USE_TRANSITION || __DOXYGEN__
+/**
+ * \brief           Running screen transition
+ */
+typedef struct {
+    gui_layer_t* layers[2];                 /*!< Pre-rendered outgoing and incoming screen, `NULL` when transition is not running */
+    gui_timer_t* timer;                     /*!< Frame timer of transition */
+    uint32_t start;                         /*!< Start time in units of milliseconds */
+    uint32_t duration;                      /*!< Duration in units of milliseconds */
+    gui_dim_t offset;                       /*!< Distance incoming screen moved from its start position */
+    uint8_t type;                           /*!< Transition of \ref gui_transition_t type */
+    uint8_t ease;                           /*!< Easing function of \ref gui_anim_ease_t type */
+    uint8_t planes;                         /*!< Set to `1` when layers are shown on overlay planes */
+    uint8_t plane[2];                       /*!< Overlay plane of each layer */
+} gui_transition_state_t;
+#endif /* GUI_CFG_USE_TRANSITION || __DOXYGEN__ */
+
+#if GUI_CFG_USE_WIDGET_ORDER || __DOXYGEN__
+
+/**
+ * \brief           Entry of flattened widget tree in draw order
+ */
+typedef struct {
+    gui_handle_p h;                         /*!< Widget handle, `NULL` for root entry at index `0` */
+    uint16_t size;                          /*!< Number of entries in widget subtree, widget itself not included */
+    uint16_t parent;                        /*!< Index of parent widget entry */
+    uint16_t depth;                         /*!< Nesting level of widget, `1` for widgets on root list */
+} guii_widget_order_t;
+
+#endif /* GUI_CFG_USE_WIDGET_ORDER || __DOXYGEN__ */
+
+#if GUI_CFG_USE_COVERAGE_MASK || __DOXYGEN__
+
+/**
+ * \brief           Tiles of widget drawing region covered by its opaque children
+ */
+typedef struct {
+    uint32_t* tiles;                        /*!< One bit per tile in rows, set when tile is covered */
+    size_t size;                            /*!< Number of allocated words in `tiles` */
+    gui_dim_t x;                            /*!< X position of first tile, aligned to tile size */
+    gui_dim_t y;                            /*!< Y position of first tile, aligned to tile size */
+    gui_dim_t cols;                         /*!< Number of tile columns */
+    gui_dim_t rows;                         /*!< Number of tile rows */
+    uint8_t active;                         /*!< Set to `1` while widget is drawn and at least one tile is covered */
+} guii_coverage_t;
+
+#endif /* GUI_CFG_USE_COVERAGE_MASK || __DOXYGEN__ */
+
 /**
  * \brief           GUI main object structure
  */
 typedef struct {
     gui_lcd_t lcd;                          /*!< LCD low-level settings */
     gui_ll_t ll;                            /*!< Low-level drawing routines for LCD */
+#if GUI_CFG_DISPLAY_COUNT > 1 || __DOXYGEN__
+    gui_ll_control_fn ll_control;           /*!< Low-level control function of display */
+#endif /* GUI_CFG_DISPLAY_COUNT > 1 || __DOXYGEN__ */
     
     uint32_t flags;                         /*!< Core GUI flags management */
     
-    gui_display_t display;                  /*!< Clipping management */
+    gui_display_t display;                  /*!< Clipping management, bounding box of all dirty regions or region currently being redrawn */
+    gui_display_t display_regions[GUI_CFG_DISPLAY_REGIONS]; /*!< List of dirty regions to redraw on next redraw operation */
+    size_t display_regions_count;           /*!< Number of valid dirty regions */
+    uint8_t redrawing;                      /*!< Set to `1` while widgets are drawn, clipping of region being drawn must not change */
+    uint32_t frame_num;                     /*!< Number of drawn frames, saved to layers as content age */
+#if GUI_CFG_USE_BAND_RENDERING || __DOXYGEN__
+    size_t band_size;                       /*!< Size of band buffer in units of pixels */
+    uint8_t band_count;                     /*!< Number of band buffers, `2` when transfer and drawing overlap */
+    uint8_t band_index;                     /*!< Index of band buffer used for next band */
+#endif /* GUI_CFG_USE_BAND_RENDERING || __DOXYGEN__ */
+#if GUI_CFG_FRAME_RATE || __DOXYGEN__
+    uint32_t frame_time;                    /*!< Time of last layer change confirmation or redraw start */
+#endif /* GUI_CFG_FRAME_RATE || __DOXYGEN__ */
+#if GUI_CFG_REDRAW_COALESCE_TIME || __DOXYGEN__
+    uint32_t redraw_request_time;           /*!< Time of first invalidation since last redraw */
+#endif /* GUI_CFG_REDRAW_COALESCE_TIME || __DOXYGEN__ */
+#if GUI_CFG_USE_REFRESH_LIMIT || __DOXYGEN__
+    uint8_t redraw_overload;                /*!< Set to `1` when last frame exceeded \ref GUI_CFG_REFRESH_FRAME_BUDGET */
+#endif /* GUI_CFG_USE_REFRESH_LIMIT || __DOXYGEN__ */
+#if GUI_CFG_USE_IDLE_REFRESH || __DOXYGEN__
+    uint32_t refresh_time;                  /*!< Time display was last seen redrawing or receiving input */
+    uint8_t refresh_mode;                   /*!< Refresh mode last set to driver, member of \ref gui_refresh_mode_t */
+#endif /* GUI_CFG_USE_IDLE_REFRESH || __DOXYGEN__ */
     gui_display_t display_temp;             /*!< Clipping for widgets for drawing and touch, used for drawing area of current widget */
+#if GUI_CFG_USE_COPY_MOVE || __DOXYGEN__
+    gui_handle_p move_widget;               /*!< Widget moved since last frame, its pixels are copied instead of redrawn */
+    gui_display_t move_src;                 /*!< Area of moved widget on newest frame */
+    gui_handle_p scroll_widget;             /*!< Widget with area scrolled since last frame, its pixels are shifted instead of redrawn */
+    gui_display_t scroll_area;              /*!< Absolute scrolled area, see \ref gui_widget_scrollarea */
+    gui_dim_t scroll_dy;                    /*!< Vertical shift of pixels in scrolled area */
+#endif /* GUI_CFG_USE_COPY_MOVE || __DOXYGEN__ */
+#if GUI_CFG_USE_POPUP_RESTORE || __DOXYGEN__
+    gui_handle_p popup_widget;              /*!< Popup widget with pixels below it saved, see \ref gui_widget_popup_begin */
+    gui_display_t popup_area;               /*!< Absolute area of saved pixels. While popup is opening, bounding box of regions dirty before it */
+    uint8_t* popup_buff;                    /*!< Saved pixels of popup area */
+    uint8_t popup_state;                    /*!< State of saved pixels of \ref gui_popup_state_t type */
+#endif /* GUI_CFG_USE_POPUP_RESTORE || __DOXYGEN__ */
+    uint32_t invalidate_batch;              /*!< Nesting level of invalidation batch, see \ref gui_widget_invalidate_begin */
+    uint8_t invalidate_batch_pending;       /*!< Set to `1` when at least one widget was invalidated during batch */
     
     gui_handle_p window_active;             /*!< Pointer to currently active window when creating new widgets */
+#if GUI_CFG_USE_POS_SIZE_CACHE || __DOXYGEN__
+    size_t abs_dirty_count;                 /*!< Number of widgets with invalid cached absolute values */
+#endif /* GUI_CFG_USE_POS_SIZE_CACHE || __DOXYGEN__ */
+#if GUI_CFG_USE_LAYOUT || __DOXYGEN__
+    size_t layout_dirty_count;              /*!< Number of widgets waiting to arrange children widgets */
+#endif /* GUI_CFG_USE_LAYOUT || __DOXYGEN__ */
     gui_handle_p focused_widget;            /*!< Pointer to focused widget for keyboard events if any */
     gui_handle_p focused_widget_prev;       /*!< Pointer to previously focused widget */
+#if (GUI_CFG_USE_KEYBOARD && GUI_CFG_USE_FOCUS_GRAPH) || __DOXYGEN__
+    guii_focus_graph_t focus_graph;         /*!< Precomputed focus neighbours for navigation keys */
+#endif /* (GUI_CFG_USE_KEYBOARD && GUI_CFG_USE_FOCUS_GRAPH) || __DOXYGEN__ */
     
     gui_linkedlistroot_t root;              /*!< Root linked list of widgets */
+    gui_handle_p remove_list;               /*!< List of widgets waiting for removal in next process call */
+#if GUI_CFG_USE_WIDGET_BUILDER || __DOXYGEN__
+    gui_handle_p build_list;                /*!< List of widgets with builder not run yet, in registration order */
+#endif /* GUI_CFG_USE_WIDGET_BUILDER || __DOXYGEN__ */
     gui_timer_core_t timers;                /*!< Software structure management */
+#if GUI_CFG_USE_ANIM || __DOXYGEN__
+    gui_anim_t* anims;                      /*!< List of running property animations */
+    gui_timer_t* anim_timer;                /*!< Single frame timer driving all animations */
+#if GUI_CFG_USE_TRANSITION || __DOXYGEN__
+    gui_transition_state_t transition;      /*!< Screen transition */
+#endif /* GUI_CFG_USE_TRANSITION || __DOXYGEN__ */
+#endif /* GUI_CFG_USE_ANIM || __DOXYGEN__ */
     
-    gui_linkedlistroot_t root_fonts;        /*!< Root linked list of font widgets */
+    gui_linkedlistroot_t root_fonts;        /*!< Root linked list of cached characters, ordered from least to most recently used */
+    gui_font_charentry_t* font_cache[GUI_CFG_FONT_CACHE_HASH_SIZE]; /*!< Hash table of cached characters with linear probing */
+    size_t font_cache_count;                /*!< Number of cached characters */
+    size_t font_cache_size;                 /*!< Number of bytes used by cached characters */
+#if GUI_CFG_USE_IMAGE_CACHE || __DOXYGEN__
+    gui_linkedlistroot_t root_images;       /*!< Root linked list of cached images, ordered from least to most recently used */
+    size_t image_cache_size;                /*!< Number of bytes used by cached images */
+#endif /* GUI_CFG_USE_IMAGE_CACHE || __DOXYGEN__ */
+#if GUI_CFG_USE_SPRITE_CACHE || __DOXYGEN__
+    gui_linkedlistroot_t root_sprites;      /*!< Root linked list of pre-rendered sprites, ordered from least to most recently used */
+    size_t sprite_cache_size;               /*!< Number of bytes used by sprites */
+#endif /* GUI_CFG_USE_SPRITE_CACHE || __DOXYGEN__ */
+    
+#if GUI_CFG_USE_WIDGET_ID_HASH || __DOXYGEN__
+    gui_handle_p* id_hash;                  /*!< Hash table of widgets with linear probing, indexed by widget ID */
+    size_t id_hash_size;                    /*!< Number of slots in hash table, power of `2` */
+    size_t id_hash_count;                   /*!< Number of widgets in hash table */
+    uint8_t id_hash_off;                    /*!< Set to `1` when table could not grow and lookups use widget tree */
+#endif /* GUI_CFG_USE_WIDGET_ID_HASH || __DOXYGEN__ */
+#if GUI_CFG_USE_WIDGET_ORDER || __DOXYGEN__
+    guii_widget_order_t* order;             /*!< Widget tree in pre-order, root entry first */
+    size_t order_size;                      /*!< Number of allocated entries in order array */
+    uint8_t order_valid;                    /*!< Set to `1` when order array matches widget tree */
+#endif /* GUI_CFG_USE_WIDGET_ORDER || __DOXYGEN__ */
+#if GUI_CFG_USE_LL_STATS || __DOXYGEN__
+    gui_ll_t ll_drv;                        /*!< Low-level functions of driver, called by counting wrappers in `ll` */
+    gui_stats_t stats;                      /*!< Low-level statistics of frame being drawn */
+    gui_stats_t stats_frame;                /*!< Low-level statistics of last finished frame */
+#endif /* GUI_CFG_USE_LL_STATS || __DOXYGEN__ */
+#if GUI_CFG_USE_LL_DIRECT_ACCESS || __DOXYGEN__
+    gui_layer_access_t access;              /*!< Cached direct access to memory of last accessed layer */
+    const gui_layer_t* access_layer;        /*!< Layer of cached access or `NULL` */
+    const void* access_address;             /*!< Memory address of layer at time of query */
+    gui_dim_t access_width;                 /*!< Width of layer at time of query */
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS || __DOXYGEN__ */
+#if GUI_CFG_USE_LCD_ROTATION || __DOXYGEN__
+    gui_ll_t ll_rot;                        /*!< Low-level functions of driver, called by rotating wrappers in `ll` */
+    gui_layer_t* rot_layers;                /*!< Display layers with physical size, passed to driver instead of logical layers */
+    gui_dim_t rot_width;                    /*!< Physical LCD width in units of pixels */
+    gui_dim_t rot_height;                   /*!< Physical LCD height in units of pixels */
+    uint8_t* rot_buff;                      /*!< Scratch buffer for rotated source pixels of \ref GUI_CFG_LCD_ROTATION_BUFFER_SIZE bytes */
+    uint8_t rot_pending;                    /*!< Set to `1` when driver may still read scratch buffer */
+    gui_linkedlistroot_t root_rot_images;   /*!< Root linked list of pre-rotated images, ordered from least to most recently used */
+    size_t rot_cache_size;                  /*!< Number of bytes used by pre-rotated images */
+#endif /* GUI_CFG_USE_LCD_ROTATION || __DOXYGEN__ */
+#if GUI_CFG_USE_PROFILER || __DOXYGEN__
+    gui_profiler_t profiler;                /*!< Frame and widget draw cost profiler */
+#endif /* GUI_CFG_USE_PROFILER || __DOXYGEN__ */
+#if GUI_CFG_USE_LATENCY || __DOXYGEN__
+    gui_latency_t latency;                  /*!< Touch-to-photon latency measurement */
+#endif /* GUI_CFG_USE_LATENCY || __DOXYGEN__ */
+#if GUI_CFG_USE_REDRAW_DEBUG || __DOXYGEN__
+    uint8_t redraw_debug;                   /*!< Enabled redraw debug modes, \ref GUI_REDRAW_DEBUG */
+    uint8_t* heatmap;                       /*!< Number of widget draws per pixel, saturated at `255` */
+#endif /* GUI_CFG_USE_REDRAW_DEBUG || __DOXYGEN__ */
+#if GUI_CFG_USE_WIDGET_POOL || __DOXYGEN__
+    gui_widget_pool_t widget_pools[GUI_CFG_WIDGET_POOL_TYPES];  /*!< Object pools for widget allocations */
+#endif /* GUI_CFG_USE_WIDGET_POOL || __DOXYGEN__ */
+#if GUI_CFG_USE_WIDGET_CACHE || __DOXYGEN__
+    size_t widget_cache_size;               /*!< Number of bytes used by widget cache layers */
+#endif /* GUI_CFG_USE_WIDGET_CACHE || __DOXYGEN__ */
+#if GUI_CFG_USE_COVERAGE_MASK || __DOXYGEN__
+    guii_coverage_t coverage;               /*!< Tiles covered by opaque children of widget being drawn */
+#endif /* GUI_CFG_USE_COVERAGE_MASK || __DOXYGEN__ */
+#if GUI_CFG_USE_OVERLAY || __DOXYGEN__
+    gui_overlay_plane_t overlays[GUI_CFG_OVERLAY_COUNT];/*!< Hardware overlay planes used by widgets */
+#endif /* GUI_CFG_USE_OVERLAY || __DOXYGEN__ */
+#if GUI_CFG_USE_ALPHA || __DOXYGEN__
+    gui_layer_t* alpha_layers[GUI_CFG_ALPHA_SCRATCH_LAYERS];/*!< Scratch layers for transparent widgets, one per nesting level */
+    size_t alpha_layers_size[GUI_CFG_ALPHA_SCRATCH_LAYERS]; /*!< Pixel memory size of each scratch layer in units of bytes */
+    uint8_t alpha_depth;                    /*!< Number of transparent widgets currently being drawn */
+#endif /* GUI_CFG_USE_ALPHA || __DOXYGEN__ */
     
     gui_evt_param_t evt_param;
     gui_evt_result_t evt_result;
@@ -103,6 +386,9 @@ typedef struct {
     guii_touch_data_t touch;                /*!< Current touch data and processing tool */
     gui_handle_p active_widget;             /*!< Pointer to widget currently active by touch */
     gui_handle_p active_widget_prev;        /*!< Previously active widget */
+#if GUI_CFG_USE_GESTURE || __DOXYGEN__
+    guii_gesture_t gesture;                 /*!< Gesture recognizer state */
+#endif /* GUI_CFG_USE_GESTURE || __DOXYGEN__ */
 #endif /* GUI_CFG_USE_TOUCH */
 
 #if GUI_CFG_USE_TRANSLATE
@@ -114,12 +400,142 @@ typedef struct {
 #endif /* GUI_CFG_OS */
 
     gui_eventcallback_t evt_cb;             /*!< Pointer to global GUI event callback function */
+
+#if GUI_CFG_USE_SPLASH || __DOXYGEN__
+    uint8_t splash_hold;                    /*!< Set to `1` while splash image is shown and redraw is held */
+#endif /* GUI_CFG_USE_SPLASH || __DOXYGEN__ */
     
     uint8_t initialized;                    /*!< Status indicating GUI is initialized */
 } gui_t;
 
 extern gui_t GUI;
 
+#if GUI_CFG_LL_STATIC || __DOXYGEN__
+
+/**
+ * \brief           Mark low-level function as not supported by driver bound at compile time
+ *
+ *                  Null pointer with type of \ref gui_ll_t member, checks against `NULL` are removed by compiler
+ *
+ * \param[in]       fn: Name of \ref gui_ll_t member
+ * \hideinitializer
+ */
+#define GUI_LL_STATIC_NONE(fn)          (1 ? 0 : GUI.ll.fn)
+
+#include GUI_CFG_LL_STATIC_HEADER
+
+#ifndef GUI_LL_STATIC_Init
+#define GUI_LL_STATIC_Init              GUI.ll.Init
+#endif
+#ifndef GUI_LL_STATIC_IsReady
+#define GUI_LL_STATIC_IsReady           GUI.ll.IsReady
+#endif
+#ifndef GUI_LL_STATIC_SetPixel
+#define GUI_LL_STATIC_SetPixel          GUI.ll.SetPixel
+#endif
+#ifndef GUI_LL_STATIC_GetPixel
+#define GUI_LL_STATIC_GetPixel          GUI.ll.GetPixel
+#endif
+#ifndef GUI_LL_STATIC_Fill
+#define GUI_LL_STATIC_Fill              GUI.ll.Fill
+#endif
+#ifndef GUI_LL_STATIC_Copy
+#define GUI_LL_STATIC_Copy              GUI.ll.Copy
+#endif
+#ifndef GUI_LL_STATIC_CopyBlend
+#define GUI_LL_STATIC_CopyBlend         GUI.ll.CopyBlend
+#endif
+#ifndef GUI_LL_STATIC_DrawHLine
+#define GUI_LL_STATIC_DrawHLine         GUI.ll.DrawHLine
+#endif
+#ifndef GUI_LL_STATIC_DrawVLine
+#define GUI_LL_STATIC_DrawVLine         GUI.ll.DrawVLine
+#endif
+#ifndef GUI_LL_STATIC_FillRect
+#define GUI_LL_STATIC_FillRect          GUI.ll.FillRect
+#endif
+#ifndef GUI_LL_STATIC_DrawImage16
+#define GUI_LL_STATIC_DrawImage16       GUI.ll.DrawImage16
+#endif
+#ifndef GUI_LL_STATIC_DrawImage24
+#define GUI_LL_STATIC_DrawImage24       GUI.ll.DrawImage24
+#endif
+#ifndef GUI_LL_STATIC_DrawImage32
+#define GUI_LL_STATIC_DrawImage32       GUI.ll.DrawImage32
+#endif
+#ifndef GUI_LL_STATIC_DrawImageL
+#define GUI_LL_STATIC_DrawImageL        GUI.ll.DrawImageL
+#endif
+#ifndef GUI_LL_STATIC_DecodeImage
+#define GUI_LL_STATIC_DecodeImage       GUI.ll.DecodeImage
+#endif
+#ifndef GUI_LL_STATIC_CopyChar
+#define GUI_LL_STATIC_CopyChar          GUI.ll.CopyChar
+#endif
+#ifndef GUI_LL_STATIC_FillSpans
+#define GUI_LL_STATIC_FillSpans         GUI.ll.FillSpans
+#endif
+#ifndef GUI_LL_STATIC_FillRoundRect
+#define GUI_LL_STATIC_FillRoundRect     GUI.ll.FillRoundRect
+#endif
+#ifndef GUI_LL_STATIC_FillGradient
+#define GUI_LL_STATIC_FillGradient      GUI.ll.FillGradient
+#endif
+#ifndef GUI_LL_STATIC_FillPath
+#define GUI_LL_STATIC_FillPath          GUI.ll.FillPath
+#endif
+#ifndef GUI_LL_STATIC_DrawLineAA
+#define GUI_LL_STATIC_DrawLineAA        GUI.ll.DrawLineAA
+#endif
+#ifndef GUI_LL_STATIC_BlitTransform
+#define GUI_LL_STATIC_BlitTransform     GUI.ll.BlitTransform
+#endif
+
+/**
+ * \brief           Get low-level function, bound at compile time or from \ref gui_ll_t structure
+ * \param[in]       fn: Name of \ref gui_ll_t member
+ * \hideinitializer
+ */
+#define GUI_LL(fn)                      GUI_LL_STATIC_ ## fn
+
+/**
+ * \brief           Check if low-level function is available
+ *
+ *                  Function address is passed through inline function,
+ *                  direct comparison of bound function with `NULL` would always be true and warned by compiler
+ *
+ * \param[in]       fn: Name of \ref gui_ll_t member
+ * \hideinitializer
+ */
+#define GUI_LL_ISSET(fn)                guii_ll_isset((void (*)(void))GUI_LL(fn))
+
+/**
+ * \brief           Check if function pointer is set
+ * \param[in]       fn: Function pointer
+ * \return          `1` if set, `0` otherwise
+ */
+static inline uint8_t
+guii_ll_isset(void (*fn)(void)) {
+    return fn != NULL;
+}
+#else /* GUI_CFG_LL_STATIC || __DOXYGEN__ */
+#define GUI_LL(fn)                      GUI.ll.fn
+#define GUI_LL_ISSET(fn)                (GUI.ll.fn != NULL)
+#endif /* !(GUI_CFG_LL_STATIC || __DOXYGEN__) */
+
+/**
+ * \brief           Send command to low-level driver of current display
+ * \param[in]       cmd: Member of \ref GUI_LL_Command_t enumeration
+ * \param[in]       param: Command parameter
+ * \param[out]      result: Command result
+ * \hideinitializer
+ */
+#if GUI_CFG_DISPLAY_COUNT > 1 || __DOXYGEN__
+#define GUI_LL_CONTROL(cmd, param, result)  GUI.ll_control(&GUI.lcd, (cmd), (param), (result))
+#else /* GUI_CFG_DISPLAY_COUNT > 1 || __DOXYGEN__ */
+#define GUI_LL_CONTROL(cmd, param, result)  gui_ll_control(&GUI.lcd, (cmd), (param), (result))
+#endif /* !(GUI_CFG_DISPLAY_COUNT > 1 || __DOXYGEN__) */
+
 /**
  * \brief           Check if 2 rectangle objects covers each other in any way
  * \hideinitializer
@@ -138,6 +554,84 @@ extern gui_t GUI;
  */
 #define GUI_RECT_IS_INSIDE(h1x1, h1y1, h1x2, h1y2, h2x1, h2y1, h2x2, h2y2)    (((h1x1) >= (h2x1)) && ((h1x2) <= (h2x2)) && ((h1y1) >= (h2y1)) && ((h1y2) <= (h2y2)))
 
+/**
+ * \brief           Blend foreground and background 8-bit channel values
+ *
+ *                  Calculates `(fg * a + bg * (255 - a)) / 255`, rounded to nearest, without division
+ *
+ * \param[in]       fg: Foreground channel value
+ * \param[in]       bg: Background channel value
+ * \param[in]       a: Foreground weight between `0` and `255`
+ * \return          Blended channel value
+ */
+static inline uint8_t
+guii_blend_u8(uint32_t fg, uint32_t bg, uint32_t a) {
+    uint32_t t = fg * a + bg * (0xFF - a) + 0x80;
+    return GUI_U8((t + (t >> 8)) >> 8);
+}
+
+/**
+ * \brief           Blend RGB channels of two colors, alpha channel of background is kept
+ * \param[in]       fg: Foreground color
+ * \param[in]       bg: Background color
+ * \param[in]       a: Foreground weight between `0` and `255`
+ * \return          Blended color
+ */
+static inline gui_color_t
+guii_blend_color(gui_color_t fg, gui_color_t bg, uint8_t a) {
+    return (bg & 0xFF000000UL)
+        | (gui_color_t)guii_blend_u8((fg >> 16) & 0xFF, (bg >> 16) & 0xFF, a) << 16
+        | (gui_color_t)guii_blend_u8((fg >>  8) & 0xFF, (bg >>  8) & 0xFF, a) << 8
+        | (gui_color_t)guii_blend_u8((fg >>  0) & 0xFF, (bg >>  0) & 0xFF, a);
+}
+
+#if GUI_CFG_USE_LL_DIRECT_ACCESS || __DOXYGEN__
+
+/**
+ * \brief           Get address of pixel in directly accessed layer memory
+ * \param[in]       acc: Layer access
+ * \param[in]       layer: Layer of access
+ * \param[in]       x: Absolute X position on screen
+ * \param[in]       y: Absolute Y position on screen
+ * \return          Pixel address
+ */
+static inline uint8_t *
+guii_access_addr(const gui_layer_access_t* acc, const gui_layer_t* layer, gui_dim_t x, gui_dim_t y) {
+    return acc->base + (size_t)(y - layer->y_pos) * acc->stride
+        + (size_t)(x - layer->x_pos) * (acc->format == GUI_PIXEL_FORMAT_RGB565 ? 2 : 4);
+}
+
+/**
+ * \brief           Read pixel from directly accessed layer memory
+ * \param[in]       acc: Layer access
+ * \param[in]       p: Pixel address
+ * \return          Pixel color in `ARGB8888` format
+ */
+static inline gui_color_t
+guii_access_getpixel(const gui_layer_access_t* acc, const uint8_t* p) {
+    if (acc->format == GUI_PIXEL_FORMAT_RGB565) {
+        return GUI_COLOR_FROM_RGB565(*(const uint16_t *)p);
+    }
+    return *(const uint32_t *)p;
+}
+
+/**
+ * \brief           Write pixel to directly accessed layer memory, same as `SetPixel` low-level function
+ * \param[in]       acc: Layer access
+ * \param[in]       p: Pixel address
+ * \param[in]       color: Pixel color
+ */
+static inline void
+guii_access_setpixel(const gui_layer_access_t* acc, uint8_t* p, gui_color_t color) {
+    if (acc->format == GUI_PIXEL_FORMAT_RGB565) {
+        *(uint16_t *)p = (uint16_t)GUI_COLOR_TO_RGB565(color);
+    } else {
+        *(uint32_t *)p = color;
+    }
+}
+
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS || __DOXYGEN__ */
+
 /**
  * \brief           GUI Handle object from main object
  * \retval          Pointer to GUI handle
@@ -0,0 +1,106 @@
+/**	
+ * \file            gui_remote.h
+ * \brief           Remote display stream
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_REMOTE_H
+#define GUI_HDR_REMOTE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_utils.h"
+
+/**
+ * \ingroup         GUI_UTILS
+ * \defgroup        GUI_REMOTE Remote display
+ * \brief           Stream of changed screen areas for remote viewer
+ *
+ *                  After each frame, its dirty rectangles are encoded from newest layer by deferred work
+ *                  and written to transport callback in chunks of up to \ref GUI_CFG_REMOTE_BUFF_SIZE bytes.
+ *                  Chunk starts with \ref GUI_REMOTE_SYNC_0 and \ref GUI_REMOTE_SYNC_1 bytes,
+ *                  flags with sequence number and `16-bit` payload length. Multi-byte values are little-endian.
+ *                  Payloads of chunks of one batch, from \ref GUI_REMOTE_CHUNK_FIRST to \ref GUI_REMOTE_CHUNK_LAST, form packets:
+ *
+ *                  - \ref GUI_REMOTE_PKT_FRAME, `16-bit` screen width and height, `32-bit` frame number
+ *                  - \ref GUI_REMOTE_PKT_RECT, `16-bit` X, Y, width and height, followed by runs of `RGB565` pixels
+ *                      in row order until rectangle is filled. Run starts with count byte `c`.
+ *                      When bit `7` is set, single pixel follows and is repeated `(c & 0x7F) + 1` times,
+ *                      otherwise `c + 1` pixels follow
+ *                  - \ref GUI_REMOTE_PKT_RECT_RAW, same as \ref GUI_REMOTE_PKT_RECT with all pixels following without runs
+ *                  - \ref GUI_REMOTE_PKT_END, screen of viewer is consistent with frame
+ *
+ *                  Viewer drops batch with missing chunk. When transport fails, next batch sends entire screen.
+ *                  Viewer sends \ref GUI_REMOTE_PKT_TOUCH with `8-bit` state and `16-bit` X and Y,
+ *                  or \ref GUI_REMOTE_PKT_REFRESH to get entire screen, which are passed to \ref gui_remote_receive.
+ *
+ *                  Screenshot is taken with \ref gui_remote_capture, which writes single batch of entire screen
+ *                  to its own transport function, also when stream is not started
+ * \{
+ */
+
+#define GUI_REMOTE_SYNC_0           ((uint8_t)0xA5) /*!< First sync byte of chunk */
+#define GUI_REMOTE_SYNC_1           ((uint8_t)0x5A) /*!< Second sync byte of chunk */
+#define GUI_REMOTE_CHUNK_FIRST      ((uint8_t)0x80) /*!< Chunk flag, first chunk of batch */
+#define GUI_REMOTE_CHUNK_LAST       ((uint8_t)0x40) /*!< Chunk flag, last chunk of batch */
+#define GUI_REMOTE_CHUNK_SEQ        ((uint8_t)0x3F) /*!< Mask of chunk sequence number in flags */
+#define GUI_REMOTE_PKT_FRAME        ((uint8_t)0x01) /*!< Start of batch of rectangles */
+#define GUI_REMOTE_PKT_RECT         ((uint8_t)0x02) /*!< Rectangle with encoded pixels */
+#define GUI_REMOTE_PKT_END          ((uint8_t)0x03) /*!< End of batch */
+#define GUI_REMOTE_PKT_RECT_RAW     ((uint8_t)0x04) /*!< Rectangle with pixels not encoded */
+#define GUI_REMOTE_PKT_TOUCH        ((uint8_t)0x10) /*!< Touch state from viewer */
+#define GUI_REMOTE_PKT_REFRESH      ((uint8_t)0x11) /*!< Request of entire screen from viewer */
+
+#define GUI_REMOTE_CAPTURE_RAW      ((uint8_t)0x01) /*!< Capture flag, send pixels without run-length encoding */
+
+uint8_t     gui_remote_start(gui_remote_write_fn fn, void* arg);
+uint8_t     gui_remote_stop(void);
+uint8_t     gui_remote_refresh(void);
+uint8_t     gui_remote_receive(const void* data, size_t len);
+uint8_t     gui_remote_capture(gui_remote_write_fn fn, void* arg, uint8_t flags);
+uint8_t     gui_remote_setsnapshot(void* mem, size_t size);
+
+void        guii_remote_frame(gui_layer_t* layer);
+void        guii_remote_process(void);
+uint8_t     guii_remote_reading(const gui_layer_t* layer);
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_REMOTE_H */
@@ -0,0 +1,77 @@
+/**	
+ * \file            gui_retain.h
+ * \brief           Character and image cache in retained memory
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_RETAIN_H
+#define GUI_HDR_RETAIN_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_utils.h"
+
+/**
+ * \ingroup         GUI_UTILS
+ * \defgroup        GUI_RETAIN Retained cache
+ * \brief           Character and image cache kept over warm reset
+ *
+ *                  Region is formatted with header of library version, cache layout and application identity.
+ *                  Each entry is stored with checksum and identity hash of its font character or image descriptor.
+ *                  After watchdog or warm reset, \ref gui_retain_setregion validates region
+ *                  and adopts entries to caches, so first screen does not unpack or decode them again.
+ *
+ *                  Entries are appended to region. Space of removed entries is reused
+ *                  when all entries in region are removed, new entries are allocated from heap until then
+ * \{
+ */
+
+#define GUI_RETAIN_CHAR             ((uint8_t)0x01) /*!< Unpacked font character entry */
+#define GUI_RETAIN_IMAGE            ((uint8_t)0x02) /*!< Decoded image cache entry */
+
+size_t      gui_retain_setregion(void* mem, size_t size, uint32_t id);
+
+void*       guii_retain_alloc(uint8_t type, size_t memsize);
+void        guii_retain_commit(void* entry);
+uint8_t     guii_retain_free(void* entry);
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_RETAIN_H */
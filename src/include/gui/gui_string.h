@@ -90,6 +90,23 @@ typedef struct {
 #endif /* GUI_CFG_USE_UNICODE || __DOXYGEN__ */
 } gui_string_t;
 
+/**
+ * \brief           Number formatting flags
+ * \sa              gui_string_numberformat_t
+ */
+#define GUI_STRING_NUMBER_ZEROPAD       ((uint8_t)0x01) /*!< Pad number to minimal width with zeros instead of spaces */
+#define GUI_STRING_NUMBER_PLUS          ((uint8_t)0x02) /*!< Print `+` sign for positive numbers */
+
+/**
+ * \brief           Number format for \ref gui_string_fromnumber
+ */
+typedef struct {
+    uint8_t decimals;                   /*!< Number of fractional digits, value is fixed-point number scaled by `10^decimals` */
+    uint8_t width;                      /*!< Minimal number of characters without suffix, number is padded on the left */
+    uint8_t flags;                      /*!< List of `GUI_STRING_NUMBER_*` flags */
+    const gui_char* suffix;             /*!< Optional unit appended to number, such as `_GT(" V")`. Set to `NULL` if not used */
+} gui_string_numberformat_t;
+
 size_t gui_string_length(const gui_char* const src);
 size_t gui_string_lengthtotal(const gui_char* const src);
 gui_char* gui_string_copy(gui_char* const dst, const gui_char* const src);
@@ -98,8 +115,10 @@ int gui_string_compare(const gui_char* const s1, const gui_char* const s2);
 uint8_t gui_string_isprintable(uint32_t ch);
 uint8_t gui_string_prepare(gui_string_t* const s, const gui_char* const str);
 uint8_t gui_string_getch(gui_string_t* const str, uint32_t* const out, uint8_t* const len);
+size_t gui_string_getchars(gui_string_t* const s, uint32_t* const out, size_t count);
 uint8_t gui_string_getchreverse(gui_string_t* const str, uint32_t* const out, uint8_t* const len);
 uint8_t gui_string_gotoend(gui_string_t* const str);
+size_t gui_string_fromnumber(gui_char* const dst, size_t len, int32_t value, const gui_string_numberformat_t* const fmt);
     
 /**
  * \}
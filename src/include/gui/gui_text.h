@@ -48,10 +48,29 @@ extern "C" {
  * \{
  */
 
+#define GUI_TEXT_VARIANT_LCD        0x80    /*!< Character variant bit for LCD subpixel coverage */
+
 const gui_font_char_t *     gui_text_getchardesc(const gui_font_t* font, uint32_t ch);
 void                        gui_text_getcharsize(const gui_font_t* font, uint32_t ch, gui_dim_t* width, gui_dim_t* height);
+gui_dim_t                   gui_text_getcharadvance(const gui_font_t* font, const gui_font_char_t* c);
+int32_t                     gui_text_getcharadvance64(const gui_font_t* font, const gui_font_char_t* c);
+gui_dim_t                   gui_text_getkerning(const gui_font_t* font, uint32_t left, uint32_t right);
+size_t                      gui_text_getprefixwidths(const gui_font_t* font, const gui_char* str, gui_dim_t* widths, size_t count);
+size_t                      gui_text_getcharsforwidth(const gui_dim_t* widths, size_t count, gui_dim_t width);
 gui_font_charentry_t *      gui_text_getcharentry(const gui_font_t* font, const gui_font_char_t* c);
 gui_font_charentry_t *      gui_text_createcharentry(const gui_font_t* font, const gui_font_char_t* c);
+size_t                      gui_text_getchardatasize(const gui_font_t* font, const gui_font_char_t* c);
+uint8_t                     gui_text_cacheremove(const gui_font_t* font);
+gui_font_charentry_t *      gui_text_getcharvariant(const gui_font_t* font, const gui_font_char_t* c, uint8_t variant);
+#if GUI_CFG_USE_CACHE_RETAIN || __DOXYGEN__
+uint8_t                     guii_text_cacheadopt(gui_font_charentry_t* entry);
+#endif /* GUI_CFG_USE_CACHE_RETAIN || __DOXYGEN__ */
+#if GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__
+uint8_t                     guii_text_cachereclaim(void);
+#endif /* GUI_CFG_USE_CACHE_MANAGER || __DOXYGEN__ */
+#if GUI_CFG_USE_VECTOR_ICON || __DOXYGEN__
+gui_font_charentry_t *      gui_text_geticonentry(const gui_icon_t* icon, gui_dim_t width, gui_dim_t height);
+#endif /* GUI_CFG_USE_VECTOR_ICON || __DOXYGEN__ */
 
 /**
  * \}
@@ -63,8 +63,10 @@ uint8_t guii_timer_start(gui_timer_t* const t);
 uint8_t guii_timer_startperiodic(gui_timer_t* const t);
 uint8_t guii_timer_stop(gui_timer_t* const t);
 uint8_t guii_timer_reset(gui_timer_t* const t);
+uint8_t guii_timer_setslack(gui_timer_t* const t, uint16_t slack);
 
 uint32_t guii_timer_getactivecount(void);
+uint8_t guii_timer_getnexttimeout(uint32_t* timeout);
 void guii_timer_process(void);
 
 /**
@@ -0,0 +1,118 @@
+/**	
+ * \file            gui_trace.h
+ * \brief           Event trace recorder
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_TRACE_H
+#define GUI_HDR_TRACE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_utils.h"
+
+/**
+ * \ingroup         GUI_UTILS
+ * \defgroup        GUI_TRACE Event trace recorder
+ * \brief           Timestamped trace points of GUI pipeline
+ *
+ *                  Trace points are recorded to lock-free ring buffer, oldest events are overwritten.
+ *                  Use \ref GUI_CFG_TRACE_HOOK to forward every event to target tracing tool, such as SEGGER SystemView,
+ *                  or \ref gui_trace_export_json to write events in Chrome trace format, readable by Perfetto.
+ * \{
+ */
+
+/**
+ * \brief           List of trace events
+ */
+typedef enum {
+    GUI_TRACE_EVT_FRAME_START = 0x00,       /*!< Redraw started, argument is number of dirty regions */
+    GUI_TRACE_EVT_FRAME_END,                /*!< Redraw finished */
+    GUI_TRACE_EVT_MBOX_WAKEUP,              /*!< GUI thread woken up, argument is idle time in milliseconds */
+    GUI_TRACE_EVT_TOUCH_RECEIVED,           /*!< Touch added to input buffer, argument is number of touches */
+    GUI_TRACE_EVT_TOUCH_START,              /*!< Touch processing started */
+    GUI_TRACE_EVT_TOUCH_END,                /*!< Touch processing finished */
+    GUI_TRACE_EVT_TIMER_START,              /*!< Timer callback started, argument is timer period */
+    GUI_TRACE_EVT_TIMER_END,                /*!< Timer callback finished */
+    GUI_TRACE_EVT_LAYER_SWAP,               /*!< Layer swap requested from low-level, argument is layer number */
+    GUI_TRACE_EVT_LAYER_CONFIRM,            /*!< Layer swap confirmed by low-level, argument is layer number */
+    GUI_TRACE_EVT_USER,                     /*!< First event available to application */
+} gui_trace_evt_id_t;
+
+/**
+ * \brief           Single recorded trace event
+ */
+typedef struct {
+    uint32_t seq;                           /*!< Sequence number, used to detect incomplete entries */
+    uint32_t time;                          /*!< Timestamp from \ref GUI_CFG_TRACE_TIMESTAMP */
+    uint32_t arg;                           /*!< Event argument */
+    uint8_t id;                             /*!< Event ID of \ref gui_trace_evt_id_t type */
+} gui_trace_evt_t;
+
+/**
+ * \brief           Output function for trace export
+ * \param[in]       data: Data to write
+ * \param[in]       len: Length of data in units of bytes
+ * \param[in]       arg: Custom argument passed to export function
+ */
+typedef void (*gui_trace_write_fn)(const char* data, size_t len, void* arg);
+
+#if GUI_CFG_USE_TRACE || __DOXYGEN__
+
+/**
+ * \brief           Record trace event
+ * \param[in]       id: Event ID
+ * \param[in]       arg: Event argument
+ * \hideinitializer
+ */
+#define GUI_TRACE(id, arg)          gui_trace_record((uint8_t)(id), (uint32_t)(arg))
+#else /* GUI_CFG_USE_TRACE || __DOXYGEN__ */
+#define GUI_TRACE(id, arg)          do {} while (0)
+#endif /* !(GUI_CFG_USE_TRACE || __DOXYGEN__) */
+
+void        gui_trace_record(uint8_t id, uint32_t arg);
+size_t      gui_trace_read(gui_trace_evt_t* evts, size_t len);
+size_t      gui_trace_export_json(gui_trace_write_fn fn, void* arg);
+const char* gui_trace_getname(uint8_t id);
+uint32_t    gui_trace_getdropped(void);
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_TRACE_H */
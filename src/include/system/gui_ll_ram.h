@@ -0,0 +1,81 @@
+/**	
+ * \file            gui_ll_ram.h
+ * \brief           Headless low-level driver with RAM frame buffer
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_LL_RAM_H
+#define GUI_HDR_LL_RAM_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui/gui.h"
+
+/**
+ * \ingroup         GUI_PORT
+ * \defgroup        GUI_LL_RAM Headless RAM driver
+ * \brief           Low-level driver without display, frames are kept in RAM
+ *
+ * Driver uses software kernels on `ARGB8888` frame buffer and confirms every layer change immediately.
+ * It is meant for benchmarks and tests on host or target, where output is checked by reading frame buffer.
+ *
+ * Link it instead of display driver, as both implement \ref gui_ll_control function.
+ *
+ * \{
+ */
+
+/**
+ * \brief           Statistics of headless driver
+ */
+typedef struct {
+    uint32_t frames;                        /*!< Number of layer changes, not used with band rendering */
+    uint32_t bands;                         /*!< Number of flushed bands */
+    uint64_t pixels_flushed;                /*!< Number of pixels copied from bands to frame buffer */
+} gui_ll_ram_stat_t;
+
+const uint32_t* gui_ll_ram_getframebuffer(void);
+uint8_t         gui_ll_ram_getstats(gui_ll_ram_stat_t* stat, uint8_t reset);
+#if GUI_CFG_USE_OVERLAY || __DOXYGEN__
+const gui_layer_t*  gui_ll_ram_getoverlay(uint8_t num, uint8_t* alpha);
+#endif /* GUI_CFG_USE_OVERLAY || __DOXYGEN__ */
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_LL_RAM_H */
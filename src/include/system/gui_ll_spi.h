@@ -0,0 +1,86 @@
+/**	
+ * \file            gui_ll_spi.h
+ * \brief           Low-level driver for command based display controllers
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_LL_SPI_H
+#define GUI_HDR_LL_SPI_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui/gui.h"
+
+/**
+ * \ingroup         GUI_PORT
+ * \defgroup        GUI_LL_SPI Command based display driver
+ * \brief           Driver for SPI or parallel bus controllers without memory mapped frame buffer
+ *
+ * Driver is meant for `ILI9341`, `ST7789` and similar controllers with MIPI DCS command set.
+ * It requires \ref GUI_CFG_USE_BAND_RENDERING to be enabled.
+ *
+ * For each band, display window is set once with column and page address commands
+ * and rendered band is streamed to controller memory with single DMA transfer.
+ * With `2` band buffers, next band is rendered while previous one is transferred.
+ *
+ * Bus functions are implemented by application for its board:
+ *
+ *  - \ref gui_ll_spi_board_init to initialize bus, reset and backlight pins
+ *  - \ref gui_ll_spi_board_cmd to send command with parameters, blocking
+ *  - \ref gui_ll_spi_board_data to start DMA transfer of pixel data after command
+ *  - \ref gui_ll_spi_board_delay for controller init sequence
+ *
+ * When DMA transfer is finished, \ref gui_ll_spi_transfer_done must be called, usually from DMA interrupt.
+ * Pixels are `RGB565` values in native byte order, bus must send each value with most significant byte first,
+ * for example with SPI configured for `16-bit` frames.
+ *
+ * \{
+ */
+
+uint8_t     gui_ll_spi_board_init(void);
+void        gui_ll_spi_board_cmd(uint8_t cmd, const uint8_t* data, size_t len);
+void        gui_ll_spi_board_data(const uint16_t* data, size_t count);
+void        gui_ll_spi_board_delay(uint32_t ms);
+
+void        gui_ll_spi_transfer_done(void);
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_LL_SPI_H */
@@ -0,0 +1,89 @@
+/**	
+ * \file            gui_ll_sw.h
+ * \brief           Software low-level drawing kernels
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_LL_SW_H
+#define GUI_HDR_LL_SW_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui/gui.h"
+#include "gui/gui_lcd.h"
+
+/**
+ * \ingroup         GUI_PORT
+ * \defgroup        GUI_LL_SW Software low-level kernels
+ * \brief           Portable CPU implementation of low-level drawing functions
+ *
+ * Kernels work directly on layer memory for displays without 2D accelerator.
+ * Pixel format is selected by `pixel_format` of each \ref gui_layer_t:
+ * \ref GUI_PIXEL_FORMAT_ARGB8888 and \ref GUI_PIXEL_FORMAT_RGB565 are supported.
+ *
+ * Source image formats match `STM32` DMA2D driver:
+ *
+ *  - `16BPP`: `RGB565` with red in lowest `5` bits
+ *  - `24BPP`: bytes `R, G, B`
+ *  - `32BPP`: bytes `R, G, B, A` with inverted alpha, where `0` means opaque
+ *
+ * \{
+ */
+
+void        gui_ll_sw_assign(gui_ll_t* ll);
+
+uint8_t     gui_ll_sw_isready(gui_lcd_t* lcd);
+void        gui_ll_sw_setpixel(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_color_t color);
+gui_color_t gui_ll_sw_getpixel(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y);
+void        gui_ll_sw_fill(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline, gui_color_t color);
+void        gui_ll_sw_copy(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src);
+void        gui_ll_sw_copyblend(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, uint8_t alpha_src, uint8_t alpha_dst, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src);
+void        gui_ll_sw_drawhline(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color);
+void        gui_ll_sw_drawvline(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color);
+void        gui_ll_sw_fillrect(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t x_size, gui_dim_t y_size, gui_color_t color);
+void        gui_ll_sw_drawimage16(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src);
+void        gui_ll_sw_drawimage24(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src);
+void        gui_ll_sw_drawimage32(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src);
+void        gui_ll_sw_copychar(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src, gui_color_t color);
+void        gui_ll_sw_fillspans(gui_lcd_t* lcd, gui_layer_t* layer, const gui_span_t* spans, size_t count, gui_color_t color);
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_LL_SW_H */
@@ -0,0 +1,71 @@
+/**	
+ * \file            gui_ll_sw_static.h
+ * \brief           Software low-level drawing kernels bound at compile time
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_LL_SW_STATIC_H
+#define GUI_HDR_LL_SW_STATIC_H
+
+#include "system/gui_ll_sw.h"
+
+/**
+ * \ingroup         GUI_LL_SW
+ * \defgroup        GUI_LL_SW_STATIC Software kernels bound at compile time
+ * \brief           Header for \ref GUI_CFG_LL_STATIC_HEADER with drivers of \ref gui_ll_sw_assign
+ *
+ * Bindings match driver which calls \ref gui_ll_sw_assign and clears `IsReady`,
+ * such as `RAM`, `SPI` and `fbdev` drivers. `Init` is still called from \ref gui_ll_t structure.
+ *
+ * \{
+ */
+
+#define GUI_LL_STATIC_IsReady           GUI_LL_STATIC_NONE(IsReady)
+#define GUI_LL_STATIC_SetPixel          gui_ll_sw_setpixel
+#define GUI_LL_STATIC_GetPixel          gui_ll_sw_getpixel
+#define GUI_LL_STATIC_Fill              gui_ll_sw_fill
+#define GUI_LL_STATIC_Copy              gui_ll_sw_copy
+#define GUI_LL_STATIC_CopyBlend         gui_ll_sw_copyblend
+#define GUI_LL_STATIC_DrawHLine         gui_ll_sw_drawhline
+#define GUI_LL_STATIC_DrawVLine         gui_ll_sw_drawvline
+#define GUI_LL_STATIC_FillRect          gui_ll_sw_fillrect
+#define GUI_LL_STATIC_DrawImage16       gui_ll_sw_drawimage16
+#define GUI_LL_STATIC_DrawImage24       gui_ll_sw_drawimage24
+#define GUI_LL_STATIC_DrawImage32       gui_ll_sw_drawimage32
+#define GUI_LL_STATIC_DrawImageL        GUI_LL_STATIC_NONE(DrawImageL)
+#define GUI_LL_STATIC_DecodeImage       GUI_LL_STATIC_NONE(DecodeImage)
+#define GUI_LL_STATIC_CopyChar          gui_ll_sw_copychar
+#define GUI_LL_STATIC_FillSpans         gui_ll_sw_fillspans
+
+/**
+ * \}
+ */
+
+#endif /* GUI_HDR_LL_SW_STATIC_H */
@@ -66,12 +66,29 @@ typedef void (*gui_sys_thread_fn)(void *);
  
 #define GUI_SYS_PORT_CMSIS_OS               1   /*!< CMSIS-OS based port for OS systems capable of ARM CMSIS standard */
 #define GUI_SYS_PORT_WIN32                  2   /*!< WIN32 based port to use ESP library with Windows applications */
+#define GUI_SYS_PORT_POSIX                  3   /*!< POSIX threads based port for Linux and other POSIX systems */
+#define GUI_SYS_PORT_FREERTOS               4   /*!< Native FreeRTOS port, GUI thread is woken up with task notifications */
 
 /* Decide which port to include */
 #if GUI_CFG_SYS_PORT == GUI_SYS_PORT_CMSIS_OS
 #include "system/gui_sys_cmsis_os.h"
 #elif GUI_CFG_SYS_PORT == GUI_SYS_PORT_WIN32
 #include "system/gui_sys_win32.h"
+#elif GUI_CFG_SYS_PORT == GUI_SYS_PORT_POSIX
+#include "system/gui_sys_posix.h"
+#elif GUI_CFG_SYS_PORT == GUI_SYS_PORT_FREERTOS
+#include "system/gui_sys_freertos.h"
+#endif
+
+/**
+ * \brief           Port wakes up GUI thread with notification bits instead of message box
+ *
+ *                  Port setting it to `1` implements \ref gui_sys_notify, \ref gui_sys_notify_isr
+ *                  and \ref gui_sys_notify_wait. Notifications of the same reason are merged
+ *                  and can not overflow like messages
+ */
+#ifndef GUI_SYS_USE_NOTIFY
+#define GUI_SYS_USE_NOTIFY                  0
 #endif
 
 /**
@@ -105,6 +122,7 @@ uint8_t     gui_sys_mbox_delete(gui_sys_mbox_t* b);
 uint32_t    gui_sys_mbox_put(gui_sys_mbox_t* b, void* m);
 uint32_t    gui_sys_mbox_get(gui_sys_mbox_t* b, void** m, uint32_t timeout);
 uint8_t     gui_sys_mbox_putnow(gui_sys_mbox_t* b, void* m);
+uint8_t     gui_sys_mbox_putnow_isr(gui_sys_mbox_t* b, void* m);
 uint8_t     gui_sys_mbox_getnow(gui_sys_mbox_t* b, void** m);
 uint8_t     gui_sys_mbox_isvalid(gui_sys_mbox_t* b);
 uint8_t     gui_sys_mbox_invalid(gui_sys_mbox_t* b);
@@ -113,6 +131,13 @@ uint8_t     gui_sys_thread_create(gui_sys_thread_t* t, const char* name, gui_sys
 uint8_t		gui_sys_thread_terminate(gui_sys_thread_t* t);
 uint8_t 	gui_sys_thread_yield(void);
 
+#if GUI_SYS_USE_NOTIFY || __DOXYGEN__
+uint8_t     gui_sys_notify(gui_sys_thread_t* t, uint32_t bits);
+uint8_t     gui_sys_notify_isr(gui_sys_thread_t* t, uint32_t bits);
+uint32_t    gui_sys_notify_wait(uint32_t* bits, uint32_t timeout);
+uint8_t     gui_sys_notify_getnow(uint32_t* bits);
+#endif /* GUI_SYS_USE_NOTIFY || __DOXYGEN__ */
+
 #endif /* GUI_CFG_OS || __DOXYGEN__ */
 
 /**
@@ -61,6 +61,8 @@ typedef int                         gui_sys_thread_prio_t;
 
 #endif /* GUI_CFG_OS && !__DOXYGEN__ */
 
+void    gui_sys_win32_advancetime(uint32_t ms);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
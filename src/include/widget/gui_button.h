@@ -65,6 +65,9 @@ gui_handle_p    gui_button_create(gui_id_t id, float x, float y, float width, fl
 uint8_t         gui_button_setcolor(gui_handle_p h, gui_button_color_t index, gui_color_t color);
 uint8_t         gui_button_setborderradius(gui_handle_p h, gui_dim_t size);
 uint8_t         gui_button_set3dstyle(gui_handle_p h, uint8_t enable);
+#if GUI_CFG_USE_NINEPATCH || __DOXYGEN__
+uint8_t         gui_button_setskin(gui_handle_p h, const gui_ninepatch_t* normal, const gui_ninepatch_t* active);
+#endif /* GUI_CFG_USE_NINEPATCH || __DOXYGEN__ */
     
 /**
  * \}
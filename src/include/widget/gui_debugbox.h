@@ -65,6 +65,9 @@ uint8_t         gui_debugbox_setslidervisibility(gui_handle_p h, uint8_t visible
 uint8_t         gui_debugbox_scroll(gui_handle_p h, int16_t step);
 
 uint8_t         gui_debugbox_setmaxitems(gui_handle_p h, int16_t max_items);
+uint8_t         gui_debugbox_setringbuffer(gui_handle_p h, size_t size);
+uint8_t         gui_debugbox_setstream(gui_handle_p h, gui_buff_t* buff, size_t line_size);
+uint8_t         gui_debugbox_addprofilerstats(gui_handle_p h);
 
 /**
  * \}
@@ -44,6 +44,7 @@ extern "C" {
  * \{
  */
 #include "gui_widget.h"
+#include "gui_listmodel.h"
 
 /**
  * \defgroup        GUI_DROPDOWN Dropdown
@@ -84,6 +85,9 @@ uint8_t         gui_dropdown_setsliderauto(gui_handle_p h, uint8_t autoMode);
 uint8_t         gui_dropdown_setslidervisibility(gui_handle_p h, uint8_t visible);
 uint8_t         gui_dropdown_scroll(gui_handle_p h, int16_t step);
 uint8_t         gui_dropdown_setopendirection(gui_handle_p h, gui_dropdown_opendir_t dir);
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+uint8_t         gui_dropdown_setmodel(gui_handle_p h, gui_listmodel_p model);
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
     
 /**
  * \}
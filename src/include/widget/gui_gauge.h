@@ -0,0 +1,86 @@
+/**	
+ * \file            gui_gauge.h
+ * \brief           Gauge widget
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_GAUGE_H
+#define GUI_HDR_GAUGE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_widget.h"
+
+/**
+ * \ingroup         GUI_WIDGETS
+ * \defgroup        GUI_GAUGE Gauge
+ * \brief           Round meter with needle
+ * \{
+ */
+
+/**
+ * \brief           List of available colors for gauge
+ */
+typedef enum {
+    GUI_GAUGE_COLOR_BG = 0x00,              /*!< Background color around dial */
+    GUI_GAUGE_COLOR_FACE,                   /*!< Dial face color */
+    GUI_GAUGE_COLOR_SCALE,                  /*!< Scale arc and ticks color */
+    GUI_GAUGE_COLOR_TEXT,                   /*!< Scale labels color */
+    GUI_GAUGE_COLOR_NEEDLE,                 /*!< Needle color */
+    GUI_GAUGE_COLOR_HUB,                    /*!< Needle hub color */
+} gui_gauge_color_t;
+
+gui_handle_p    gui_gauge_create(gui_id_t id, float x, float y, float width, float height, gui_handle_p parent, gui_widget_evt_fn evt_fn, uint16_t flags);
+uint8_t         gui_gauge_setcolor(gui_handle_p h, gui_gauge_color_t index, gui_color_t color);
+uint8_t         gui_gauge_setvalue(gui_handle_p h, int32_t val);
+uint8_t         gui_gauge_setmin(gui_handle_p h, int32_t val);
+uint8_t         gui_gauge_setmax(gui_handle_p h, int32_t val);
+uint8_t         gui_gauge_setangles(gui_handle_p h, int16_t start, int16_t sweep);
+uint8_t         gui_gauge_setticks(gui_handle_p h, uint8_t major, uint8_t minor);
+#if GUI_CFG_USE_IMAGE_TRANSFORM || __DOXYGEN__
+uint8_t         gui_gauge_setneedleimage(gui_handle_p h, const gui_image_desc_t* img, gui_dim_t pivot_x, gui_dim_t pivot_y);
+#endif /* GUI_CFG_USE_IMAGE_TRANSFORM || __DOXYGEN__ */
+int32_t         gui_gauge_getvalue(gui_handle_p h);
+int32_t         gui_gauge_getmin(gui_handle_p h);
+int32_t         gui_gauge_getmax(gui_handle_p h);
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_GAUGE_H */
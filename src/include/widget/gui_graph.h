@@ -56,7 +56,8 @@ typedef enum {
     GUI_GRAPH_COLOR_BG = 0x00,              /*!< Background color index */
     GUI_GRAPH_COLOR_FG = 0x01,              /*!< Foreground color index (background of plotting area) */
     GUI_GRAPH_COLOR_BORDER = 0x02,          /*!< Border color index */
-    GUI_GRAPH_COLOR_GRID = 0x03             /*!< Grid color index */
+    GUI_GRAPH_COLOR_GRID = 0x03,            /*!< Grid color index */
+    GUI_GRAPH_COLOR_TEXT = 0x04             /*!< Axis label color index */
 } gui_graph_color_t;
 
 /**
@@ -77,6 +78,16 @@ typedef enum {
     GUI_GRAPH_TYPE_XY = 0x01,               /*!< Data type is Y versus X [Y(x)] */
 } gui_graph_type_t;
 
+/**
+ * \brief           Graph data sample type enumeration
+ * \sa              gui_graph_data_create_ex
+ */
+typedef enum {
+    GUI_GRAPH_SAMPLE_INT16 = 0x00,          /*!< Each X and Y value is `int16_t` */
+    GUI_GRAPH_SAMPLE_INT32 = 0x01,          /*!< Each X and Y value is `int32_t` */
+    GUI_GRAPH_SAMPLE_FLOAT = 0x02,          /*!< Each X and Y value is `float` */
+} gui_graph_sample_t;
+
 struct gui_graph_data;
 
 typedef struct gui_graph_data * gui_graph_data_p; /*!< Graph data pointer */
@@ -92,10 +103,20 @@ uint8_t         gui_graph_zoomreset(gui_handle_p h);
 uint8_t         gui_graph_zoom(gui_handle_p h, float zoom, float x, float y);
 uint8_t         gui_graph_attachdata(gui_handle_p h, gui_graph_data_p data);
 uint8_t         gui_graph_detachdata(gui_handle_p h, gui_graph_data_p data);
+uint8_t         gui_graph_setstripchart(gui_handle_p h, uint8_t enable);
+uint8_t         gui_graph_setaxislabels(gui_handle_p h, uint8_t enable);
 
 gui_graph_data_p    gui_graph_data_create(gui_id_t id, gui_graph_type_t type, size_t length);
+gui_graph_data_p    gui_graph_data_create_ex(gui_id_t id, gui_graph_type_t type, gui_graph_sample_t sample, size_t length, gui_graph_data_p x_src);
 uint8_t             gui_graph_data_addvalue(gui_graph_data_p data, int16_t x, int16_t y);
+uint8_t             gui_graph_data_addvalues(gui_graph_data_p data, const int16_t* x, const int16_t* y, size_t count);
+uint8_t             gui_graph_data_addvalues_f(gui_graph_data_p data, const float* y, size_t count, float scale, float offset);
+uint8_t             gui_graph_data_addsamples(gui_graph_data_p data, const void* x, const void* y, size_t count);
+uint8_t             gui_graph_data_swapbuffer(gui_graph_data_p data, int16_t* buff, size_t length, int16_t** old);
+uint8_t             gui_graph_data_swapbuffers(gui_graph_data_p data, void* x, void* y, size_t length, void** old_x, void** old_y);
 uint8_t             gui_graph_data_setcolor(gui_graph_data_p data, gui_color_t color);
+uint8_t             gui_graph_data_setdensity(gui_graph_data_p data, uint8_t enable, const gui_color_t* lut);
+uint8_t             gui_graph_data_setlod(gui_graph_data_p data, uint8_t enable);
 gui_graph_data_p    gui_graph_data_get_by_id(gui_handle_p graph_h, gui_id_t id);
 
  
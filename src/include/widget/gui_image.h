@@ -50,6 +50,9 @@ extern "C" {
     
 gui_handle_p    gui_image_create(gui_id_t id, float x, float y, float width, float height, gui_handle_p parent, gui_widget_evt_fn evt_fn, uint16_t flags);
 uint8_t         gui_image_setsource(gui_handle_p h, const gui_image_desc_t* img);
+#if GUI_CFG_USE_IMAGE_TRANSFORM || __DOXYGEN__
+uint8_t         gui_image_settransform(gui_handle_p h, const gui_image_transform_t* tr);
+#endif /* GUI_CFG_USE_IMAGE_TRANSFORM || __DOXYGEN__ */
 
 /**
  * \}
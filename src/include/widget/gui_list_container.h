@@ -51,6 +51,9 @@ extern "C" {
  * When subwidgets are put to it and if they don't support touch move event,
  * event will be forwarded to next widget level (List container) and in 
  * case there are widgets outside visible area, they will be scrolled.
+ *
+ * In recycler mode, set with \ref gui_listcontainer_setrecycler, only rows
+ * to fill visible area are created and they are populated again when new rows scroll in.
  */
 
 /**
@@ -69,9 +72,30 @@ typedef enum {
     GUI_LISTCONTAINER_MODE_VERTICAL_HORIZONTAL, /*!< Vertical & Horizontal mode */
 } gui_listcontainer_mode_t;
 
+/**
+ * \brief           Create widgets of single row in recycler mode
+ * \param[in]       h: List container handle, parent of row widgets
+ * \param[in]       arg: Custom argument passed to \ref gui_listcontainer_setrecycler
+ * \return          Row widget, with widgets of row as children, or `NULL` on failure
+ */
+typedef gui_handle_p (*gui_listcontainer_create_fn)(gui_handle_p h, void* arg);
+
+/**
+ * \brief           Populate row widgets for list index in recycler mode
+ * \param[in]       h: List container handle
+ * \param[in]       row: Row widget returned by \ref gui_listcontainer_create_fn
+ * \param[in]       index: List index of row
+ * \param[in]       arg: Custom argument passed to \ref gui_listcontainer_setrecycler
+ */
+typedef void (*gui_listcontainer_bind_fn)(gui_handle_p h, gui_handle_p row, uint32_t index, void* arg);
+
 gui_handle_p    gui_listcontainer_create(gui_id_t id, float x, float y, float width, float height, gui_handle_p parent, gui_widget_evt_fn evt_fn, uint16_t flags);
 uint8_t         gui_listcontainer_setcolor(gui_handle_p h, gui_listcontainer_color_t index, gui_color_t color);
 uint8_t         gui_listcontainer_setmode(gui_handle_p h, gui_listcontainer_mode_t mode);
+uint8_t         gui_listcontainer_setrecycler(gui_handle_p h, gui_dim_t row_height, uint32_t count,
+                                gui_listcontainer_create_fn create_fn, gui_listcontainer_bind_fn bind_fn, void* arg);
+uint8_t         gui_listcontainer_setrowcount(gui_handle_p h, uint32_t count);
+uint8_t         gui_listcontainer_scrolltorow(gui_handle_p h, uint32_t index);
 
 /**
  * \}
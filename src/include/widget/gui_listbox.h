@@ -44,6 +44,7 @@ extern "C" {
  * \{
  */
 #include "gui_widget.h"
+#include "gui_listmodel.h"
 
 /**
  * \defgroup        GUI_LISTBOX Listbox
@@ -63,6 +64,15 @@ typedef enum {
     GUI_LISTBOX_COLOR_SEL_NOFOC_BG,         /*!< Background color of selected item when widget is not in focus */
 } gui_listbox_color_t;
 
+/**
+ * \brief           Data source callback for virtual listbox
+ * \param[in]       h: Widget handle
+ * \param[in]       index: Entry index to get text for
+ * \return          Pointer to text for entry or `NULL` if entry is empty.
+ *                  Text must stay valid until widget is redrawn
+ */
+typedef const gui_char* (*gui_listbox_data_fn)(gui_handle_p h, int16_t index);
+
 gui_handle_p    gui_listbox_create(gui_id_t id, float x, float y, float width, float height, gui_handle_p parent, gui_widget_evt_fn evt_fn, uint16_t flags);
 uint8_t         gui_listbox_setcolor(gui_handle_p h, gui_listbox_color_t index, gui_color_t color);
 uint8_t         gui_listbox_addstring(gui_handle_p h, const gui_char* text);
@@ -73,6 +83,11 @@ uint8_t         gui_listbox_setstring(gui_handle_p h, int16_t index, const gui_c
 uint8_t         gui_listbox_setselection(gui_handle_p h, int16_t selection);
 int16_t         gui_listbox_getselection(gui_handle_p h);
 uint8_t         gui_listbox_scroll(gui_handle_p h, int16_t step);
+uint8_t         gui_listbox_setdatasource(gui_handle_p h, gui_listbox_data_fn data_fn, int16_t count);
+uint8_t         gui_listbox_setcount(gui_handle_p h, int16_t count);
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+uint8_t         gui_listbox_setmodel(gui_handle_p h, gui_listmodel_p model);
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
 
 /**
  * \}
@@ -0,0 +1,121 @@
+/**	
+ * \file            gui_listmodel.h
+ * \brief           Shared item model for list widgets
+ */
+
+
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_LISTMODEL_H
+#define GUI_HDR_LISTMODEL_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_widget.h"
+
+/**
+ * \ingroup         GUI_WIDGETS
+ * \defgroup        GUI_LISTMODEL List model
+ * \brief           Item storage shared between listbox, dropdown and listview widgets
+ * \{
+ *
+ * Model stores rows of texts once, any number of list widgets may be attached to it.
+ * Every change is reported to attached widgets with index range of changed rows,
+ * widget redraws only rows of this range which are currently visible.
+ *
+ * Listbox and dropdown show first column of model, listview shows one model column per listview column.
+ *
+ * \note            Only pointers to texts are saved to model, unless \ref GUI_CFG_USE_STRING_INTERN is enabled
+ */
+
+/**
+ * \brief           List model handle
+ */
+typedef struct gui_listmodel* gui_listmodel_p;
+
+/**
+ * \brief           Type of change reported to attached widgets
+ */
+typedef enum {
+    GUI_LISTMODEL_CHANGE_UPDATE = 0x00,     /*!< Texts of rows changed, rows stay on the same index */
+    GUI_LISTMODEL_CHANGE_INSERT,            /*!< Rows were inserted, following rows moved down */
+    GUI_LISTMODEL_CHANGE_REMOVE,            /*!< Rows were removed, following rows moved up */
+    GUI_LISTMODEL_CHANGE_RESET,             /*!< All rows changed or model was deleted */
+} gui_listmodel_change_t;
+
+/**
+ * \brief           Change notification callback of attached widget
+ * \param[in]       h: Widget handle
+ * \param[in]       change: Type of change
+ * \param[in]       index: Index of first changed row
+ * \param[in]       count: Number of changed rows
+ */
+typedef void (*gui_listmodel_notify_fn)(gui_handle_p h, gui_listmodel_change_t change, int16_t index, int16_t count);
+
+/**
+ * \brief           Attachment of widget to model, part of widget list data
+ */
+typedef struct gui_listmodel_view {
+    struct gui_listmodel_view* next;                /*!< Next attached widget of the same model */
+    gui_listmodel_p model;                          /*!< Model widget is attached to, `NULL` when not attached */
+    gui_handle_p h;                                 /*!< Widget handle */
+    gui_listmodel_notify_fn notify_fn;              /*!< Change notification callback */
+} gui_listmodel_view_t;
+
+gui_listmodel_p gui_listmodel_create(uint16_t col_count);
+uint8_t         gui_listmodel_delete(gui_listmodel_p model);
+int16_t         gui_listmodel_getcount(gui_listmodel_p model);
+uint16_t        gui_listmodel_getcolcount(gui_listmodel_p model);
+uint8_t         gui_listmodel_addstring(gui_listmodel_p model, const gui_char* text);
+uint8_t         gui_listmodel_insertrow(gui_listmodel_p model, int16_t index, const gui_char* const* texts);
+uint8_t         gui_listmodel_setstring(gui_listmodel_p model, int16_t row, uint16_t col, const gui_char* text);
+const gui_char* gui_listmodel_getstring(gui_listmodel_p model, int16_t row, uint16_t col);
+uint8_t         gui_listmodel_deleterows(gui_listmodel_p model, int16_t index, int16_t count);
+uint8_t         gui_listmodel_clear(gui_listmodel_p model);
+
+#if defined(GUI_INTERNAL) || __DOXYGEN__
+
+uint8_t         guii_listmodel_attach(gui_listmodel_p model, gui_listmodel_view_t* view, gui_handle_p h, gui_listmodel_notify_fn notify_fn);
+uint8_t         guii_listmodel_detach(gui_listmodel_view_t* view);
+
+#endif /* defined(GUI_INTERNAL) || __DOXYGEN__ */
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_LISTMODEL_H */
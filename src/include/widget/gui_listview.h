@@ -44,6 +44,7 @@ extern "C" {
  * \{
  */
 #include "gui_widget.h"
+#include "gui_listmodel.h"
 
 /**
  * \defgroup        GUI_LISTVIEW List view
@@ -70,6 +71,25 @@ struct gui_listview_row;
  * \brief           Typedef for row for public usage
  */
 typedef struct gui_listview_row* gui_listview_row_p;
+
+/**
+ * \brief           Data source callback for virtual list view
+ * \param[in]       h: Widget handle
+ * \param[in]       row: Row index to get text for
+ * \param[in]       col: Column index to get text for
+ * \return          Pointer to text for a cell or `NULL` if cell is empty.
+ *                  Text must stay valid until widget is redrawn
+ */
+typedef const gui_char* (*gui_listview_data_fn)(gui_handle_p h, int16_t row, uint16_t col);
+
+/**
+ * \brief           Row filter callback for list view
+ * \param[in]       h: Widget handle
+ * \param[in]       row: Row to check, use \ref gui_listview_getrowtext to get its cells
+ * \param[in]       arg: Custom argument from \ref gui_listview_setfilter
+ * \return          `1` to show row, `0` to hide it
+ */
+typedef uint8_t (*gui_listview_filter_fn)(gui_handle_p h, gui_listview_row_p row, void* arg);
    
 gui_handle_p    gui_listview_create(gui_id_t id, float x, float y, float width, float height, gui_handle_p parent, gui_widget_evt_fn evt_fn, uint16_t flags);
 uint8_t         gui_listview_setcolor(gui_handle_p h, gui_listview_color_t index, gui_color_t color);
@@ -82,12 +102,21 @@ uint8_t         gui_listview_removerow(gui_handle_p h, int16_t index);
 uint8_t         gui_listview_removerows(gui_handle_p h);
 
 uint8_t         gui_listview_setitemstring(gui_handle_p h, gui_listview_row_p row, uint16_t col, const gui_char* text);
+const gui_char* gui_listview_getrowtext(gui_handle_p h, gui_listview_row_p row, uint16_t col);
 uint8_t         gui_listview_setselection(gui_handle_p h, int16_t selection);
 int16_t         gui_listview_getselection(gui_handle_p h);
 uint8_t         gui_listview_setsliderauto(gui_handle_p h, uint8_t autoMode);
 uint8_t         gui_listview_setslidervisibility(gui_handle_p h, uint8_t visible);
 uint8_t         gui_listview_scroll(gui_handle_p h, int16_t step);
 uint8_t         gui_listview_getitemvalue(gui_handle_p h, int16_t rindex, uint16_t cindex, gui_char* dst, size_t length);
+uint8_t         gui_listview_sort(gui_handle_p h, int16_t col, uint8_t desc);
+uint8_t         gui_listview_setfilter(gui_handle_p h, gui_listview_filter_fn filter_fn, void* arg);
+
+uint8_t         gui_listview_setdatasource(gui_handle_p h, gui_listview_data_fn data_fn, int16_t count);
+uint8_t         gui_listview_setrowcount(gui_handle_p h, int16_t count);
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+uint8_t         gui_listview_setmodel(gui_handle_p h, gui_listmodel_p model);
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
 
 /**
  * \}
@@ -59,6 +59,17 @@ typedef enum {
     GUI_RADIO_COLOR_TEXT,                   /*!< Text color index */
 } gui_radio_color_t;
 
+/**
+ * \brief           Radio group object, tracks checked widget of group
+ *
+ *                  Object is owned by application and must be valid while any radio widget is attached to it.
+ *                  Changing selection in group touches only previously and newly checked widget
+ */
+typedef struct {
+    gui_handle_p selected;                  /*!< Currently checked radio widget or `NULL` if none */
+    uint32_t selected_value;                /*!< Value of checked radio widget */
+} gui_radio_group_t;
+
 gui_handle_p    gui_radio_create(gui_id_t id, float x, float y, float width, float height, gui_handle_p parent, gui_widget_evt_fn evt_fn, uint16_t flags);
 uint8_t         gui_radio_setcolor(gui_handle_p h, gui_radio_color_t index, gui_color_t color);
 uint8_t         gui_radio_setgroup(gui_handle_p h, uint8_t groupId);
@@ -69,6 +80,8 @@ uint32_t        gui_radio_getselectedvalue(gui_handle_p h);
 uint8_t         gui_radio_setdisabled(gui_handle_p h, uint8_t disabled);
 uint8_t         gui_radio_isdisabled(gui_handle_p h);
 uint8_t         gui_radio_setselected(gui_handle_p h);
+uint8_t         gui_radio_attachgroup(gui_handle_p h, gui_radio_group_t* group);
+gui_handle_p    gui_radio_group_getselected(const gui_radio_group_t* group);
     
 /**
  * \}
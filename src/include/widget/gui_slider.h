@@ -77,6 +77,7 @@ uint8_t         gui_slider_setvalue(gui_handle_p h, int32_t val);
 int32_t         gui_slider_getmin(gui_handle_p h);
 int32_t         gui_slider_getmax(gui_handle_p h);
 int32_t         gui_slider_getvalue(gui_handle_p h);
+uint8_t         gui_slider_getstate(gui_handle_p h, int32_t* min, int32_t* max, int32_t* value);
 
 /**
  * \}
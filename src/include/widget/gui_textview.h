@@ -78,6 +78,11 @@ gui_handle_p    gui_textview_create(gui_id_t id, float x, float y, float width,
 uint8_t         gui_textview_setcolor(gui_handle_p h, gui_textview_color_t index, gui_color_t color);
 uint8_t         gui_textview_setvalign(gui_handle_p h, gui_textalign_valign_t align);
 uint8_t         gui_textview_sethalign(gui_handle_p h, gui_textalign_halign_t align);
+#if GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN || __DOXYGEN__
+uint8_t         gui_textview_setnumber(gui_handle_p h, int32_t value);
+uint8_t         gui_textview_setnumberformat(gui_handle_p h, const gui_string_numberformat_t* fmt);
+int32_t         gui_textview_getnumber(gui_handle_p h);
+#endif /* GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN || __DOXYGEN__ */
     
 /**
  * \}
@@ -120,7 +120,7 @@ extern "C" {
  * \hideinitializer
  */
 #define guii_widget_getrelativex(h)                 GUI_DIM((gui_widget_isexpanded(h) ? 0 : \
-                                                        (guii_widget_getflag(__GH(h), GUI_FLAG_XPOS_PERCENT) ? (gui_dim_t)((float)GUI_ROUND(__GH(h)->x * guii_widget_getparentinnerwidth(__GH(h))) / 100.0f) : __GH(h)->x) \
+                                                        (guii_widget_getflag(__GH(h), GUI_FLAG_XPOS_PERCENT) ? GUI_COORD_PERCENT(__GH(h)->x, guii_widget_getparentinnerwidth(__GH(h))) : GUI_COORD_PIXELS(__GH(h)->x)) \
                                                     ))
 
 /**
@@ -131,7 +131,7 @@ extern "C" {
  * \hideinitializer
  */
 #define guii_widget_getrelativey(h)                 GUI_DIM(gui_widget_isexpanded(__GH(h)) ? 0 : \
-                                                        (guii_widget_getflag(__GH(h), GUI_FLAG_YPOS_PERCENT) ? (gui_dim_t)((float)GUI_ROUND(__GH(h)->y * guii_widget_getparentinnerheight(__GH(h))) / 100.0f) : __GH(h)->y) \
+                                                        (guii_widget_getflag(__GH(h), GUI_FLAG_YPOS_PERCENT) ? GUI_COORD_PERCENT(__GH(h)->y, guii_widget_getparentinnerheight(__GH(h))) : GUI_COORD_PIXELS(__GH(h)->y)) \
                                                     )
 
 /**
@@ -200,7 +200,28 @@ extern "C" {
  * \return          `1` on success, `0` otherwise
  * \hideinitializer
  */
-#define guii_widget_callback(h, cmd, param, result) (__GH(h)->callback != NULL ? __GH(h)->callback(h, cmd, param, result) : __GH(h)->widget->callback(h, cmd, param, result))
+#define guii_widget_callback(h, cmd, param, result) (__GH(h)->callback != NULL ? __GH(h)->callback(h, cmd, param, result) : guii_widget_typecallback(h, cmd, param, result))
+
+/**
+ * \brief           Process widget event with callback function of widget type
+ *
+ *                  When widget type has event table, events without handler are not processed
+ *                  and callback function is not called
+ *
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in]       h: Widget handle
+ * \param[in]       cmd: Callback command
+ * \param[in]       param: Pointer to parameters
+ * \param[out]      result: Pointer to result
+ * \return          `1` if command processed, `0` otherwise
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_WIDGET_EVT_TABLE || __DOXYGEN__
+#define guii_widget_typecallback(h, cmd, param, result) (__GH(h)->widget->evt_table == NULL ? __GH(h)->widget->callback(h, cmd, param, result) : \
+                                                        (__GH(h)->widget->evt_table[(cmd)] != NULL ? __GH(h)->widget->evt_table[(cmd)](h, cmd, param, result) : 0))
+#else /* GUI_CFG_USE_WIDGET_EVT_TABLE || __DOXYGEN__ */
+#define guii_widget_typecallback(h, cmd, param, result) (__GH(h)->widget->callback(h, cmd, param, result))
+#endif /* !(GUI_CFG_USE_WIDGET_EVT_TABLE || __DOXYGEN__) */
 
 /**
  * \brief           Get widget colors from list of colors
@@ -211,7 +232,27 @@ extern "C" {
  * \retval          Color value
  * \hideinitializer
  */
-#define guii_widget_getcolor(h, index)              (__GH(h)->colors != NULL ? __GH(h)->colors[(uint8_t)(index)] : (__GH(h)->widget->colors != NULL ? __GH(h)->widget->colors[(uint8_t)(index)] : GUI_COLOR_BLACK))
+#define guii_widget_getcolor(h, index)              (guii_widget_getextvalue(h, colors) != NULL ? guii_widget_getext(h)->colors[(uint8_t)(index)] : guii_widget_getstylecolor(h, index))
+
+/**
+ * \brief           Get shared style of widget
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in]       h: Widget handle
+ * \retval          Pointer to style or `NULL` if not used
+ * \hideinitializer
+ */
+#define guii_widget_getstyle(h)                     ((const gui_style_t *)guii_widget_getextvalue(h, style))
+
+/**
+ * \brief           Get widget color from shared style if set there or from default widget setup
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in]       h: Widget handle
+ * \param[in]       index: Color index from color array for specific widget
+ * \retval          Color value
+ * \hideinitializer
+ */
+#define guii_widget_getstylecolor(h, index)         (guii_widget_getstyle(h) != NULL && guii_widget_getstyle(h)->colors != NULL && (uint8_t)(index) < guii_widget_getstyle(h)->color_count ? guii_widget_getstyle(h)->colors[(uint8_t)(index)] : \
+                                                        (__GH(h)->widget->colors != NULL ? __GH(h)->widget->colors[(uint8_t)(index)] : GUI_COLOR_BLACK))
 
 /**
  * \brief           Returns width of parent element. If parent does not exists, it returns LCD width
@@ -275,6 +316,15 @@ extern "C" {
  */
 #define guii_widget_ishidden(h)                     (!guii_widget_isvisible(__GH(h)))
 
+/**
+ * \brief           Check if widget or any of its parent widgets is hidden
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in]       h: Widget handle
+ * \return          `1` on success, `0` otherwise
+ * \hideinitializer
+ */
+#define guii_widget_ishiddentree(h)                 (!!guii_widget_getflag(__GH(h), GUI_FLAG_HIDDEN_TREE))
+
 /**
  * \brief           Check if widget allows children widgets
  * \note            The function is private and can be called only when GUI protection against multiple access is activated
@@ -330,6 +380,60 @@ extern "C" {
  */
 #define guii_widget_hasalpha(h)                     (guii_widget_isvisible(h) && gui_widget_getalpha(h) < 0xFF)
 
+/**
+ * \brief           Get optional widget data, see \ref gui_handle_ext_t
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in]       h: Widget handle
+ * \return          Pointer to data or `NULL` if it was not allocated yet
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_COMPACT_HANDLE
+#define guii_widget_getext(h)                       (__GH(h)->ext)
+#else /* GUI_CFG_USE_COMPACT_HANDLE */
+#define guii_widget_getext(h)                       (&__GH(h)->ext)
+#endif /* !GUI_CFG_USE_COMPACT_HANDLE */
+
+/**
+ * \brief           Get optional widget data and allocate it if necessary
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in]       h: Widget handle
+ * \return          Pointer to data or `NULL` if memory is not available
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_COMPACT_HANDLE
+#define guii_widget_ext(h)                          (__GH(h)->ext != NULL ? __GH(h)->ext : guii_widget_allocext(h))
+#else /* GUI_CFG_USE_COMPACT_HANDLE */
+#define guii_widget_ext(h)                          (&__GH(h)->ext)
+#endif /* !GUI_CFG_USE_COMPACT_HANDLE */
+
+/**
+ * \brief           Check if optional widget data are available
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in]       h: Widget handle
+ * \param[in]       alloc: Set to `1` to allocate data if necessary
+ * \return          `1` if data are available, `0` otherwise
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_COMPACT_HANDLE
+#define guii_widget_hasext(h, alloc)                (__GH(h)->ext != NULL || ((alloc) && guii_widget_allocext(h) != NULL))
+#else /* GUI_CFG_USE_COMPACT_HANDLE */
+#define guii_widget_hasext(h, alloc)                1
+#endif /* !GUI_CFG_USE_COMPACT_HANDLE */
+
+/**
+ * \brief           Get value from optional widget data
+ * \note            The function is private and can be called only when GUI protection against multiple access is activated
+ * \param[in]       h: Widget handle
+ * \param[in]       field: Member of \ref gui_handle_ext_t
+ * \return          Member value or `0` if data are not allocated
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_COMPACT_HANDLE
+#define guii_widget_getextvalue(h, field)           (__GH(h)->ext != NULL ? __GH(h)->ext->field : 0)
+#else /* GUI_CFG_USE_COMPACT_HANDLE */
+#define guii_widget_getextvalue(h, field)           (__GH(h)->ext.field)
+#endif /* !GUI_CFG_USE_COMPACT_HANDLE */
+
 uint8_t         guii_widget_processtextkey(gui_handle_p h, guii_keyboard_data_t* key);
 
 uint8_t         guii_widget_setparam(gui_handle_p h, uint16_t cfg, const void* data, uint8_t invalidate, uint8_t invalidateparent);
@@ -349,7 +453,6 @@ gui_dim_t       guii_widget_getparentabsolutey(gui_handle_p h);
 
 void*           gui_widget_create(const gui_widget_t* widget, gui_id_t id, float x, float y, float width, float height, gui_handle_p parent, gui_widget_evt_fn evt_fn, uint16_t flags);
 uint8_t         gui_widget_setcolor(gui_handle_p h, uint8_t index, gui_color_t color);
-uint8_t         gui_widget_setstyle(gui_handle_p h, const gui_style_p style);
 
 /**
  * \}
@@ -364,6 +467,7 @@ uint8_t         gui_widget_setstyle(gui_handle_p h, const gui_style_p style);
 uint32_t            gui_widget_alloctextmemory(gui_handle_p h, uint32_t size);
 uint8_t             gui_widget_freetextmemory(gui_handle_p h);
 uint8_t             gui_widget_settext(gui_handle_p h, const gui_char* text);
+uint8_t             gui_widget_appendtext(gui_handle_p h, const gui_char* text);
 const gui_char *    gui_widget_gettext(gui_handle_p h);
 const gui_char *    gui_widget_gettextcopy(gui_handle_p h, gui_char* dst, uint32_t len);
 uint8_t             gui_widget_setfont(gui_handle_p h, const gui_font_t* font);
@@ -450,6 +554,8 @@ uint8_t         gui_widget_incscrolly(gui_handle_p h, gui_dim_t scroll);
 gui_dim_t       gui_widget_getscrollx(gui_handle_p h);
 gui_dim_t       gui_widget_getscrolly(gui_handle_p h);
 
+uint8_t         gui_widget_setlayout(gui_handle_p h, gui_layout_mode_t mode, uint8_t columns, gui_dim_t gap);
+
 /**
  * \}
  */
@@ -479,7 +585,14 @@ uint8_t         gui_widget_setalpha(gui_handle_p h, uint8_t alpha);
 
 uint8_t         gui_widget_invalidate(gui_handle_p h);
 uint8_t         gui_widget_force_invalidate(gui_handle_p h);
+uint8_t         gui_widget_invalidatearea(gui_handle_p h, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height);
+uint8_t         gui_widget_scrollarea(gui_handle_p h, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t dy);
+uint8_t         gui_widget_popup_begin(gui_handle_p h);
+uint8_t         gui_widget_popup_end(gui_handle_p h);
+uint8_t         gui_widget_popup_close(gui_handle_p h);
 uint8_t         gui_widget_invalidatewithparent(gui_handle_p h);
+uint8_t         gui_widget_invalidate_begin(void);
+uint8_t         gui_widget_invalidate_end(void);
 uint8_t         gui_widget_setignoreinvalidate(gui_handle_p h, uint8_t en, uint8_t invalidate);
 uint8_t         gui_widget_setinvalidatewithparent(gui_handle_p h, uint8_t value);
 uint8_t         gui_widget_setuserdata(gui_handle_p h, void* const data);
@@ -494,6 +607,24 @@ gui_id_t        gui_widget_getid(gui_handle_p h);
 gui_handle_p    gui_widget_getbyid(gui_id_t id);
 gui_handle_p    gui_widget_getbyid_ex(gui_id_t id, gui_handle_p parent, uint8_t deep);
 uint8_t         gui_widget_remove(gui_handle_p* h);
+size_t          gui_widget_getpoolstats(gui_widget_pool_stat_t* stats, size_t len);
+uint8_t         gui_widget_arena_begin(size_t size);
+uint8_t         gui_widget_arena_end(gui_handle_p h);
+gui_handle_p    gui_widget_createscreen(const gui_widget_desc_t* desc, size_t count, gui_handle_p parent, gui_handle_p* handles);
+gui_handle_p    gui_widget_clone(gui_handle_p proto, gui_id_t id, float x, float y, gui_handle_p parent);
+uint8_t         gui_widget_snapshot_save(gui_snapshot_t* snap, gui_handle_p* handles, size_t count, uint8_t keep_frame);
+gui_handle_p    gui_widget_snapshot_restore(gui_snapshot_t* snap, const gui_widget_desc_t* desc, size_t count, gui_handle_p parent, gui_handle_p* handles);
+void            gui_widget_snapshot_free(gui_snapshot_t* snap);
+uint8_t         gui_widget_setstyle(gui_handle_p h, const gui_style_t* style);
+uint8_t         gui_widget_updatestyle(const gui_style_t* style);
+uint8_t         gui_widget_post_int(gui_handle_p h, gui_widget_cmd_int_fn fn, int32_t value);
+uint8_t         gui_widget_post_text(gui_handle_p h, gui_widget_cmd_text_fn fn, const gui_char* text);
+uint8_t         gui_widget_setcache(gui_handle_p h, uint8_t enable);
+uint8_t         gui_widget_setdisplaylist(gui_handle_p h, uint8_t enable);
+uint8_t         gui_widget_setrefreshrate(gui_handle_p h, uint16_t hz);
+uint8_t         gui_widget_setpriority(gui_handle_p h, gui_widget_prio_t prio);
+uint8_t         gui_widget_setbuilder(gui_handle_p h, gui_widget_build_fn fn);
+uint8_t         gui_widget_setoverlay(gui_handle_p h, uint8_t enable);
 
 /**
  * \}
@@ -544,6 +675,45 @@ void guii_widget_init(void);
 //Clipping regions
 uint8_t guii_widget_isinsideclippingregion(gui_handle_p h, uint8_t check_sib_cover);
 
+#if GUI_CFG_USE_POS_SIZE_CACHE
+//Lazy update of cached absolute values
+void guii_widget_updateabsvalues(gui_handle_p h);
+#define guii_widget_updateabs(h)    do { if (GUI.abs_dirty_count) { guii_widget_updateabsvalues(h); } } while (0)
+#else /* GUI_CFG_USE_POS_SIZE_CACHE */
+#define guii_widget_updateabs(h)
+#endif /* !GUI_CFG_USE_POS_SIZE_CACHE */
+
+#if GUI_CFG_USE_WIDGET_GRID
+//Grid index of visible areas
+uint32_t guii_widget_getgridmask(gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2);
+#endif /* GUI_CFG_USE_WIDGET_GRID */
+
+#if GUI_CFG_USE_COMPACT_HANDLE
+//Optional data of compact handle
+gui_handle_ext_t* guii_widget_allocext(gui_handle_p h);
+#endif /* GUI_CFG_USE_COMPACT_HANDLE */
+
+#if GUI_CFG_USE_WIDGET_CACHE
+//Retained cache layers
+void guii_widget_freecache(gui_handle_p h);
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+
+#if GUI_CFG_USE_OVERLAY
+//Hardware overlay planes
+void guii_widget_freeoverlay(gui_handle_p h);
+#endif /* GUI_CFG_USE_OVERLAY */
+
+//Cached layout of widget text
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE
+#define guii_widget_gettextlayout(h)        (&__GH(h)->text_layout)
+#define guii_widget_invalidatetextlayout(h) gui_draw_text_layout_invalidate(&__GH(h)->text_layout)
+#define guii_widget_invalidatetextlayoutfrom(h, offset) gui_draw_text_layout_invalidatefrom(&__GH(h)->text_layout, (offset))
+#else /* GUI_CFG_USE_TEXT_LAYOUT_CACHE */
+#define guii_widget_gettextlayout(h)        NULL
+#define guii_widget_invalidatetextlayout(h)
+#define guii_widget_invalidatetextlayoutfrom(h, offset)
+#endif /* !GUI_CFG_USE_TEXT_LAYOUT_CACHE */
+
 //Move widget down and all its parents with it
 void guii_widget_movedowntree(gui_handle_p h);
 
@@ -554,6 +724,35 @@ void guii_widget_active_set(gui_handle_p h);
 
 //Execute actual widget remove process
 uint8_t guii_widget_executeremove(void);
+
+//Widget specific values of screen snapshot
+uint8_t guii_widget_savestate(gui_widget_param* p, const void* data, size_t len);
+uint8_t guii_widget_restorestate(const gui_widget_param* p, void* data, size_t len);
+
+#if GUI_CFG_USE_LAYOUT
+//Arrange children widgets of widgets with layout
+void guii_widget_layoutprocess(void);
+uint8_t guii_widget_getlayoutcontent(gui_handle_p h, gui_dim_t* width, gui_dim_t* height);
+#define guii_widget_islayoutchild(h)        (guii_widget_hasparent(h) && guii_widget_getextvalue(guii_widget_getparent(h), layout.mode) != GUI_LAYOUT_NONE)
+#else /* GUI_CFG_USE_LAYOUT */
+#define guii_widget_islayoutchild(h)        0
+#endif /* !GUI_CFG_USE_LAYOUT */
+
+//Apply widget commands posted from other threads
+uint8_t guii_widget_executecommands(void);
+#if GUI_CFG_USE_WIDGET_CMD_QUEUE
+//Drop commands of removed widget
+void guii_widget_dropcommands(gui_handle_p h);
+#endif /* GUI_CFG_USE_WIDGET_CMD_QUEUE */
+
+#if GUI_CFG_USE_WIDGET_BUILDER
+//Run builder of hidden container in idle time
+uint8_t guii_widget_prebuild(void);
+#endif /* GUI_CFG_USE_WIDGET_BUILDER */
+
+//Values published to other threads without core protection
+void guii_seqlock_write(gui_seqlock_t* seq, void* copies, const void* data, size_t len);
+void guii_seqlock_read(const gui_seqlock_t* seq, const void* copies, void* data, size_t len);
 #endif /* !__DOXYGEN__ */
 
 /**
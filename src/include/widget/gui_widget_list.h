@@ -40,6 +40,9 @@ extern "C" {
 #endif
 
 #include "gui_widget.h"
+#if GUI_CFG_USE_LISTMODEL
+#include "gui_listmodel.h"
+#endif /* GUI_CFG_USE_LISTMODEL */
 
 /**
  * \ingroup         GUI_WIDGETS
@@ -53,6 +56,40 @@ extern "C" {
  *
  */
 
+/**
+ * \brief           Kinetic scroll callback function
+ * \param[in]       h: Widget handle
+ * \param[in]       arg: Custom argument from \ref gui_widget_kinetic_t structure
+ * \param[in]       dx: Number of steps to scroll in horizontal direction
+ * \param[in]       dy: Number of steps to scroll in vertical direction
+ * \return          `1` if widget scrolled, `0` if scroll limit is reached
+ */
+typedef uint8_t (*gui_widget_kinetic_scroll_fn)(gui_handle_p h, void* arg, int16_t dx, int16_t dy);
+
+/**
+ * \brief           Kinetic scroll data structure
+ */
+typedef struct {
+    gui_widget_kinetic_scroll_fn scroll_fn;         /*!< Callback to scroll widget */
+    void* arg;                                      /*!< Custom argument for callback */
+    gui_dim_t step_x;                               /*!< Number of pixels per scroll step in horizontal direction. Set to `0` to disable axis */
+    gui_dim_t step_y;                               /*!< Number of pixels per scroll step in vertical direction. Set to `0` to disable axis */
+    int32_t offset_x;                               /*!< Horizontal offset not yet applied as scroll step, in units of `1/256` pixels */
+    int32_t offset_y;                               /*!< Vertical offset not yet applied as scroll step, in units of `1/256` pixels */
+    int32_t speed_x;                                /*!< Horizontal scroll velocity in units of pixels per second */
+    int32_t speed_y;                                /*!< Vertical scroll velocity in units of pixels per second */
+    uint32_t time;                                  /*!< Time of last touch movement */
+} gui_widget_kinetic_t;
+
+/**
+ * \brief           Compare function for list items
+ * \param[in]       item1: First item
+ * \param[in]       item2: Second item
+ * \param[in]       arg: Custom argument
+ * \return          Negative, zero or positive value when first item is before, equal to or after second item
+ */
+typedef int (*gui_widget_list_compare_fn)(const void* item1, const void* item2, void* arg);
+
 /**
  * \brief           List data structure
  */
@@ -62,22 +99,38 @@ typedef struct {
     int16_t max_visible_items;                      /*!< Maximal number of visible list items at a time */
     int16_t count;                                  /*!< Number of all entries in a list */
     int16_t visiblestartindex;                      /*!< Index in array of string on top of visible area of widget */
+    uint8_t is_virtual;                             /*!< Set to `1` when list does not store items and only \ref count is used */
+    void* cursor;                                   /*!< Last item accessed by index, search for next index starts at nearest of first, last or this item */
+    int16_t cursor_index;                           /*!< Index of \ref cursor item */
     
     uint8_t (*check_values_cb)(gui_handle_p h);     /*!< Check values callback */
     int16_t (*entries_per_page_cb)(gui_handle_p h); /*!< Entries per page callback */
     uint8_t (*remove_item_cb)(gui_handle_p h, void* item);  /* Remove item callback */
+    gui_widget_kinetic_t kinetic;                   /*!< Kinetic scroll data for touch scrolling */
+    
+    gui_seqlock_t selection_seq;                    /*!< Sequence counter of published selection */
+    int16_t selection[2];                           /*!< Copies of selection for readers in other threads */
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+    gui_listmodel_view_t view;                      /*!< Attachment to shared item model, list is virtual when attached */
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
 } gui_widget_listdata_t;
 
 uint8_t     gui_widget_list_init(gui_handle_p h, gui_widget_listdata_t* const ld);
 uint8_t     gui_widget_list_slide(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t dir);
 uint8_t     gui_widget_list_add_item(gui_handle_p h, gui_widget_listdata_t* const ld, void* element);
+uint8_t     gui_widget_list_insert_item_sorted(gui_handle_p h, gui_widget_listdata_t* const ld, void* element, gui_widget_list_compare_fn cmp, void* arg);
+uint8_t     gui_widget_list_detach_item(gui_handle_p h, gui_widget_listdata_t* const ld, void* element);
+uint8_t     gui_widget_list_sort(gui_handle_p h, gui_widget_listdata_t* const ld, gui_widget_list_compare_fn cmp, void* arg);
 void *      gui_widget_list_get_item_byindex(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t index);
 uint8_t     gui_widget_list_remove_item_byindex(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t index);
 uint8_t     gui_widget_list_remove_items(gui_handle_p h, gui_widget_listdata_t* const ld);
 uint8_t     gui_widget_list_check_values(gui_handle_p h, gui_widget_listdata_t* const ld);
+uint8_t     gui_widget_list_set_virtual_count(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t count);
 
 uint8_t     gui_widget_list_inc_selection(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t* const curr_selected, int16_t dir);
 uint8_t     gui_widget_list_set_selection(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t* const curr_selected, int16_t new_selection);
+uint8_t     gui_widget_list_move_selection(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t* const curr_selected, int16_t new_index);
+int16_t     gui_widget_list_get_selection(gui_handle_p h, const gui_widget_listdata_t* const ld);
 
 /**
  * \brief           Get number of items visible `per page` at a time
@@ -108,6 +161,32 @@ uint8_t     gui_widget_list_set_visible_start_index(gui_handle_p h, gui_widget_l
 
 void *      gui_widget_list_get_first_visible_item(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t* const index_out);
 void *      gui_widget_list_get_next_item(gui_handle_p h, gui_widget_listdata_t* const ld, void* const curr_item);
+uint8_t     gui_widget_list_invalidate_items(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t index, int16_t count, gui_dim_t top, gui_dim_t item_height);
+
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+uint8_t     gui_widget_list_set_model(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t* const curr_selected, gui_listmodel_p model, gui_listmodel_notify_fn notify_fn);
+uint8_t     gui_widget_list_model_changed(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t* const curr_selected, gui_listmodel_change_t change, int16_t index, int16_t count);
+
+/**
+ * \brief           Get model list is attached to
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ * \return          Model handle or `NULL` when list stores own items
+ * \hideinitializer
+ */
+#define     gui_widget_list_get_model(h, ld)                ((ld)->view.model)
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
+
+#if GUI_CFG_USE_TOUCH || __DOXYGEN__
+void        gui_widget_kinetic_touchstart(gui_handle_p h, gui_widget_kinetic_t* const k, gui_dim_t step_x, gui_dim_t step_y);
+uint8_t     gui_widget_kinetic_touchmove(gui_handle_p h, gui_widget_kinetic_t* const k, const guii_touch_data_t* const ts);
+void        gui_widget_kinetic_touchend(gui_handle_p h, gui_widget_kinetic_t* const k);
+void        gui_widget_kinetic_stop(gui_handle_p h, gui_widget_kinetic_t* const k);
+
+void        gui_widget_list_touchstart(gui_handle_p h, gui_widget_listdata_t* const ld, gui_dim_t item_height);
+uint8_t     gui_widget_list_touchmove(gui_handle_p h, gui_widget_listdata_t* const ld, const guii_touch_data_t* const ts);
+void        gui_widget_list_touchend(gui_handle_p h, gui_widget_listdata_t* const ld);
+#endif /* GUI_CFG_USE_TOUCH || __DOXYGEN__ */
 
 /**
  * \}
@@ -43,23 +43,66 @@ extern "C" {
 #include "widget/gui_widget.h"
 
 /* List of all widgets */
+#if GUI_CFG_WIDGET_BUTTON
 #include "widget/gui_button.h"
+#endif /* GUI_CFG_WIDGET_BUTTON */
+#if GUI_CFG_WIDGET_CHECKBOX
 #include "widget/gui_checkbox.h"
+#endif /* GUI_CFG_WIDGET_CHECKBOX */
+#if GUI_CFG_WIDGET_CONTAINER
 #include "widget/gui_container.h"
+#endif /* GUI_CFG_WIDGET_CONTAINER */
+#if GUI_CFG_WIDGET_DEBUGBOX
 #include "widget/gui_debugbox.h"
+#endif /* GUI_CFG_WIDGET_DEBUGBOX */
+#if GUI_CFG_WIDGET_DIALOG
 #include "widget/gui_dialog.h"
+#endif /* GUI_CFG_WIDGET_DIALOG */
+#if GUI_CFG_WIDGET_DROPDOWN
 #include "widget/gui_dropdown.h"
+#endif /* GUI_CFG_WIDGET_DROPDOWN */
+#if GUI_CFG_WIDGET_EDITTEXT
 #include "widget/gui_edittext.h"
+#endif /* GUI_CFG_WIDGET_EDITTEXT */
+#if GUI_CFG_WIDGET_GAUGE
+#include "widget/gui_gauge.h"
+#endif /* GUI_CFG_WIDGET_GAUGE */
+#if GUI_CFG_WIDGET_GRAPH
 #include "widget/gui_graph.h"
+#endif /* GUI_CFG_WIDGET_GRAPH */
+#if GUI_CFG_WIDGET_IMAGE
 #include "widget/gui_image.h"
+#endif /* GUI_CFG_WIDGET_IMAGE */
+#if GUI_CFG_WIDGET_LED
 #include "widget/gui_led.h"
+#endif /* GUI_CFG_WIDGET_LED */
+#if GUI_CFG_WIDGET_LIST_CONTAINER
 #include "widget/gui_list_container.h"
+#endif /* GUI_CFG_WIDGET_LIST_CONTAINER */
+#if GUI_CFG_WIDGET_LISTBOX
 #include "widget/gui_listbox.h"
+#endif /* GUI_CFG_WIDGET_LISTBOX */
+#if GUI_CFG_USE_LISTMODEL
+#include "widget/gui_listmodel.h"
+#endif /* GUI_CFG_USE_LISTMODEL */
+#if GUI_CFG_WIDGET_LISTVIEW
 #include "widget/gui_listview.h"
+#endif /* GUI_CFG_WIDGET_LISTVIEW */
+#if GUI_CFG_WIDGET_PROGBAR
 #include "widget/gui_progbar.h"
+#endif /* GUI_CFG_WIDGET_PROGBAR */
+#if GUI_CFG_WIDGET_RADIO
 #include "widget/gui_radio.h"
+#endif /* GUI_CFG_WIDGET_RADIO */
+#if GUI_CFG_WIDGET_SLIDER
 #include "widget/gui_slider.h"
+#endif /* GUI_CFG_WIDGET_SLIDER */
+#if GUI_CFG_WIDGET_TEXTVIEW
 #include "widget/gui_textview.h"
+#endif /* GUI_CFG_WIDGET_TEXTVIEW */
+#if GUI_CFG_WIDGET_WATERFALL
+#include "widget/gui_waterfall.h"
+#endif /* GUI_CFG_WIDGET_WATERFALL */
 #include "widget/gui_window.h"
 
 /* C++ detection */
@@ -62,6 +62,7 @@ gui_handle_p    gui_window_create(gui_id_t id, float x, float y, float width, fl
 gui_handle_p    gui_window_getdesktop(void);
 uint8_t         gui_window_setactive(gui_handle_p h);
 uint8_t         gui_window_setcolor(gui_handle_p h, gui_window_color_t index, gui_color_t color);
+uint8_t         gui_window_setwallpaper(gui_handle_p h, const gui_image_desc_t* img);
 
 #if defined(GUI_INTERNAL)
 gui_handle_p    gui_window_createdesktop(gui_id_t id, gui_widget_evt_fn evt_fn);
@@ -0,0 +1,483 @@
+/**	
+ * \file            gui_ll_drm.c
+ * \brief           Low-level driver for Linux DRM/KMS devices
+ *
+ *                  Layers are dumb buffers scanned out by primary plane.
+ *                  Layer change is atomic page flip with damage clips from dirty regions,
+ *                  layer is confirmed from flip complete event
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#include "system/gui_ll.h"
+#include "system/gui_ll_sw.h"
+#include "gui/gui_mem.h"
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <xf86drm.h>
+#include <xf86drmMode.h>
+#include <drm_fourcc.h>
+
+#if !__DOXYGEN__
+
+#ifndef GUI_LL_DRM_DEVICE
+#define GUI_LL_DRM_DEVICE                   "/dev/dri/card0"
+#endif
+
+#ifndef GUI_LL_DRM_HEAP_SIZE
+#define GUI_LL_DRM_HEAP_SIZE                0x100000
+#endif
+
+#if GUI_CFG_USE_BAND_RENDERING || GUI_CFG_USE_DIRECT_RENDERING || GUI_CFG_USE_TRIPLE_BUFFERING
+#error "DRM driver supports only double buffered layer rendering"
+#endif
+
+#define LCD_LAYERS                          2
+#define LCD_PIXEL_SIZE                      4
+
+/**
+ * \brief           Scan-out buffer of single layer
+ */
+typedef struct {
+    uint32_t handle;                        /*!< Dumb buffer handle */
+    uint32_t fb_id;                         /*!< Frame buffer object */
+    uint32_t pitch;                         /*!< Line length in units of bytes */
+    uint64_t size;                          /*!< Buffer size in units of bytes */
+    void* mem;                              /*!< Mapped buffer memory */
+} drm_buffer_t;
+
+/**
+ * \brief           Property IDs used in atomic requests
+ */
+typedef struct {
+    uint32_t conn_crtc_id;                  /*!< Connector `CRTC_ID` */
+    uint32_t crtc_mode_id;                  /*!< CRTC `MODE_ID` */
+    uint32_t crtc_active;                   /*!< CRTC `ACTIVE` */
+    uint32_t plane_fb_id;                   /*!< Plane `FB_ID` */
+    uint32_t plane_crtc_id;                 /*!< Plane `CRTC_ID` */
+    uint32_t plane_src_x, plane_src_y, plane_src_w, plane_src_h;
+    uint32_t plane_crtc_x, plane_crtc_y, plane_crtc_w, plane_crtc_h;
+    uint32_t plane_damage;                  /*!< Plane `FB_DAMAGE_CLIPS`, `0` when not supported by kernel */
+} drm_props_t;
+
+static int drm_fd = -1;
+static uint32_t conn_id, crtc_id, plane_id;
+static drmModeModeInfo mode;
+static drm_buffer_t buffers[LCD_LAYERS];
+static drm_props_t props;
+static gui_layer_t layers[LCD_LAYERS];
+
+static void
+lcd_init(gui_lcd_t* lcd) {
+    GUI_UNUSED(lcd);
+}
+
+/**
+ * \brief           Find property ID by name
+ * \param[in]       obj_id: Object ID
+ * \param[in]       obj_type: Object type, one of `DRM_MODE_OBJECT_*` values
+ * \param[in]       name: Property name
+ * \param[out]      value: Pointer to output variable to save current value to. Can be set to `NULL`
+ * \return          Property ID or `0` when not found
+ */
+static uint32_t
+get_prop(uint32_t obj_id, uint32_t obj_type, const char* name, uint64_t* value) {
+    drmModeObjectPropertiesPtr p;
+    drmModePropertyPtr prop;
+    uint32_t i, id = 0;
+
+    p = drmModeObjectGetProperties(drm_fd, obj_id, obj_type);
+    if (p == NULL) {
+        return 0;
+    }
+    for (i = 0; i < p->count_props && id == 0; i++) {
+        prop = drmModeGetProperty(drm_fd, p->props[i]);
+        if (prop != NULL) {
+            if (!strcmp(prop->name, name)) {
+                id = prop->prop_id;
+                if (value != NULL) {
+                    *value = p->prop_values[i];
+                }
+            }
+            drmModeFreeProperty(prop);
+        }
+    }
+    drmModeFreeObjectProperties(p);
+    return id;
+}
+
+/**
+ * \brief           Find connected connector, its CRTC and primary plane
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+drm_find_output(void) {
+    drmModeResPtr res;
+    drmModeConnectorPtr conn = NULL;
+    drmModeEncoderPtr enc;
+    drmModePlaneResPtr planes;
+    drmModePlanePtr plane;
+    uint64_t type;
+    int i, k, crtc_index = -1;
+
+    res = drmModeGetResources(drm_fd);
+    if (res == NULL) {
+        return 0;
+    }
+    for (i = 0; i < res->count_connectors; i++) {
+        conn = drmModeGetConnector(drm_fd, res->connectors[i]);
+        if (conn != NULL && conn->connection == DRM_MODE_CONNECTED && conn->count_modes > 0) {
+            break;
+        }
+        drmModeFreeConnector(conn);
+        conn = NULL;
+    }
+    if (conn == NULL) {
+        drmModeFreeResources(res);
+        return 0;
+    }
+    conn_id = conn->connector_id;
+    mode = conn->modes[0];
+    for (i = 0; i < conn->count_modes; i++) {   /* Use preferred mode if set */
+        if (conn->modes[i].type & DRM_MODE_TYPE_PREFERRED) {
+            mode = conn->modes[i];
+            break;
+        }
+    }
+    
+    /* Use CRTC of current encoder or first one encoder can drive */
+    for (i = 0; i < conn->count_encoders && crtc_index < 0; i++) {
+        enc = drmModeGetEncoder(drm_fd, conn->encoders[i]);
+        if (enc == NULL) {
+            continue;
+        }
+        for (k = 0; k < res->count_crtcs; k++) {
+            if ((enc->crtc_id != 0 && res->crtcs[k] == enc->crtc_id)
+                || (enc->crtc_id == 0 && (enc->possible_crtcs & (1UL << k)))) {
+                crtc_index = k;
+                crtc_id = res->crtcs[k];
+                break;
+            }
+        }
+        drmModeFreeEncoder(enc);
+    }
+    drmModeFreeConnector(conn);
+    drmModeFreeResources(res);
+    if (crtc_index < 0) {
+        return 0;
+    }
+    
+    /* Find primary plane for CRTC */
+    planes = drmModeGetPlaneResources(drm_fd);
+    if (planes == NULL) {
+        return 0;
+    }
+    for (i = 0; i < (int)planes->count_planes && plane_id == 0; i++) {
+        plane = drmModeGetPlane(drm_fd, planes->planes[i]);
+        if (plane == NULL) {
+            continue;
+        }
+        if ((plane->possible_crtcs & (1UL << crtc_index))
+            && get_prop(plane->plane_id, DRM_MODE_OBJECT_PLANE, "type", &type)
+            && type == DRM_PLANE_TYPE_PRIMARY) {
+            plane_id = plane->plane_id;
+        }
+        drmModeFreePlane(plane);
+    }
+    drmModeFreePlaneResources(planes);
+    return plane_id != 0;
+}
+
+/**
+ * \brief           Create and map dumb buffer with frame buffer object
+ * \param[out]      buf: Buffer to create
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+drm_create_buffer(drm_buffer_t* buf) {
+    struct drm_mode_create_dumb creq = {0};
+    struct drm_mode_map_dumb mreq = {0};
+    uint32_t handles[4] = {0}, pitches[4] = {0}, offsets[4] = {0};
+
+    creq.width = mode.hdisplay;
+    creq.height = mode.vdisplay;
+    creq.bpp = 8 * LCD_PIXEL_SIZE;
+    if (drmIoctl(drm_fd, DRM_IOCTL_MODE_CREATE_DUMB, &creq) < 0) {
+        return 0;
+    }
+    buf->handle = creq.handle;
+    buf->pitch = creq.pitch;
+    buf->size = creq.size;
+    if (buf->pitch != (uint32_t)mode.hdisplay * LCD_PIXEL_SIZE) {
+        printf("Padded dumb buffer lines are not supported\r\n");
+        return 0;                               /* Software kernels use display width as line length */
+    }
+    
+    handles[0] = buf->handle;
+    pitches[0] = buf->pitch;
+    if (drmModeAddFB2(drm_fd, mode.hdisplay, mode.vdisplay, DRM_FORMAT_XRGB8888,
+            handles, pitches, offsets, &buf->fb_id, 0)) {
+        return 0;
+    }
+    
+    mreq.handle = buf->handle;
+    if (drmIoctl(drm_fd, DRM_IOCTL_MODE_MAP_DUMB, &mreq) < 0) {
+        return 0;
+    }
+    buf->mem = mmap(NULL, buf->size, PROT_READ | PROT_WRITE, MAP_SHARED, drm_fd, mreq.offset);
+    if (buf->mem == MAP_FAILED) {
+        buf->mem = NULL;
+        return 0;
+    }
+    memset(buf->mem, 0x00, buf->size);
+    return 1;
+}
+
+/**
+ * \brief           Add plane setup showing buffer to atomic request
+ * \param[in]       req: Atomic request
+ * \param[in]       buf: Buffer to show
+ */
+static void
+drm_add_plane(drmModeAtomicReqPtr req, const drm_buffer_t* buf) {
+    drmModeAtomicAddProperty(req, plane_id, props.plane_fb_id, buf->fb_id);
+    drmModeAtomicAddProperty(req, plane_id, props.plane_crtc_id, crtc_id);
+    drmModeAtomicAddProperty(req, plane_id, props.plane_src_x, 0);
+    drmModeAtomicAddProperty(req, plane_id, props.plane_src_y, 0);
+    drmModeAtomicAddProperty(req, plane_id, props.plane_src_w, (uint64_t)mode.hdisplay << 16);
+    drmModeAtomicAddProperty(req, plane_id, props.plane_src_h, (uint64_t)mode.vdisplay << 16);
+    drmModeAtomicAddProperty(req, plane_id, props.plane_crtc_x, 0);
+    drmModeAtomicAddProperty(req, plane_id, props.plane_crtc_y, 0);
+    drmModeAtomicAddProperty(req, plane_id, props.plane_crtc_w, mode.hdisplay);
+    drmModeAtomicAddProperty(req, plane_id, props.plane_crtc_h, mode.vdisplay);
+}
+
+/**
+ * \brief           Open device, set mode and show first buffer
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+drm_open(void) {
+    drmModeAtomicReqPtr req;
+    uint32_t blob_id;
+    uint8_t i;
+    int ret;
+
+    drm_fd = open(GUI_LL_DRM_DEVICE, O_RDWR | O_CLOEXEC);
+    if (drm_fd < 0) {
+        printf("Cannot open %s\r\n", GUI_LL_DRM_DEVICE);
+        return 0;
+    }
+    if (drmSetClientCap(drm_fd, DRM_CLIENT_CAP_UNIVERSAL_PLANES, 1)
+        || drmSetClientCap(drm_fd, DRM_CLIENT_CAP_ATOMIC, 1)) {
+        printf("Atomic mode setting is not supported\r\n");
+        return 0;
+    }
+    if (!drm_find_output()) {
+        return 0;
+    }
+    for (i = 0; i < LCD_LAYERS; i++) {
+        if (!drm_create_buffer(&buffers[i])) {
+            return 0;
+        }
+    }
+    
+    props.conn_crtc_id = get_prop(conn_id, DRM_MODE_OBJECT_CONNECTOR, "CRTC_ID", NULL);
+    props.crtc_mode_id = get_prop(crtc_id, DRM_MODE_OBJECT_CRTC, "MODE_ID", NULL);
+    props.crtc_active = get_prop(crtc_id, DRM_MODE_OBJECT_CRTC, "ACTIVE", NULL);
+    props.plane_fb_id = get_prop(plane_id, DRM_MODE_OBJECT_PLANE, "FB_ID", NULL);
+    props.plane_crtc_id = get_prop(plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_ID", NULL);
+    props.plane_src_x = get_prop(plane_id, DRM_MODE_OBJECT_PLANE, "SRC_X", NULL);
+    props.plane_src_y = get_prop(plane_id, DRM_MODE_OBJECT_PLANE, "SRC_Y", NULL);
+    props.plane_src_w = get_prop(plane_id, DRM_MODE_OBJECT_PLANE, "SRC_W", NULL);
+    props.plane_src_h = get_prop(plane_id, DRM_MODE_OBJECT_PLANE, "SRC_H", NULL);
+    props.plane_crtc_x = get_prop(plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_X", NULL);
+    props.plane_crtc_y = get_prop(plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_Y", NULL);
+    props.plane_crtc_w = get_prop(plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_W", NULL);
+    props.plane_crtc_h = get_prop(plane_id, DRM_MODE_OBJECT_PLANE, "CRTC_H", NULL);
+    props.plane_damage = get_prop(plane_id, DRM_MODE_OBJECT_PLANE, "FB_DAMAGE_CLIPS", NULL);
+    
+    /* Set mode with first buffer */
+    if (drmModeCreatePropertyBlob(drm_fd, &mode, sizeof(mode), &blob_id)) {
+        return 0;
+    }
+    req = drmModeAtomicAlloc();
+    drmModeAtomicAddProperty(req, conn_id, props.conn_crtc_id, crtc_id);
+    drmModeAtomicAddProperty(req, crtc_id, props.crtc_mode_id, blob_id);
+    drmModeAtomicAddProperty(req, crtc_id, props.crtc_active, 1);
+    drm_add_plane(req, &buffers[0]);
+    ret = drmModeAtomicCommit(drm_fd, req, DRM_MODE_ATOMIC_ALLOW_MODESET, NULL);
+    drmModeAtomicFree(req);
+    drmModeDestroyPropertyBlob(drm_fd, blob_id);
+    return ret == 0;
+}
+
+/**
+ * \brief           Page flip complete event handler
+ */
+static void
+drm_flip_handler(int fd, unsigned int sequence, unsigned int tv_sec, unsigned int tv_usec, void* user_data) {
+    gui_layer_t* layer = user_data;
+
+    GUI_UNUSED(fd);
+    GUI_UNUSED(sequence);
+    GUI_UNUSED(tv_sec);
+    GUI_UNUSED(tv_usec);
+    gui_lcd_confirmactivelayer(layer->num);     /* Layer is scanned out, previous one can be drawn */
+}
+
+/**
+ * \brief           Thread receiving page flip events
+ */
+static void*
+drm_event_thread(void* arg) {
+    drmEventContext ctx = {0};
+    struct pollfd pfd;
+
+    GUI_UNUSED(arg);
+    ctx.version = 2;
+    ctx.page_flip_handler = drm_flip_handler;
+    pfd.fd = drm_fd;
+    pfd.events = POLLIN;
+    while (1) {
+        if (poll(&pfd, 1, -1) > 0 && (pfd.revents & POLLIN)) {
+            drmHandleEvent(drm_fd, &ctx);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Flip to layer with damage clips of its dirty regions
+ * \param[in]       layer: Layer to show
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+drm_flip(gui_layer_t* layer) {
+    struct drm_mode_rect clips[GUI_CFG_DISPLAY_REGIONS];
+    drmModeAtomicReqPtr req;
+    uint32_t blob_id = 0;
+    size_t i;
+    int ret;
+
+    req = drmModeAtomicAlloc();
+    if (req == NULL) {
+        return 0;
+    }
+    drmModeAtomicAddProperty(req, plane_id, props.plane_fb_id, buffers[layer->num].fb_id);
+    
+    /* Damage clips let compositor and display bridges transfer only changed area */
+    if (props.plane_damage && layer->regions_count > 0) {
+        for (i = 0; i < layer->regions_count; i++) {
+            clips[i].x1 = layer->regions[i].x1;
+            clips[i].y1 = layer->regions[i].y1;
+            clips[i].x2 = layer->regions[i].x2;
+            clips[i].y2 = layer->regions[i].y2;
+        }
+        if (!drmModeCreatePropertyBlob(drm_fd, clips, sizeof(clips[0]) * layer->regions_count, &blob_id)) {
+            drmModeAtomicAddProperty(req, plane_id, props.plane_damage, blob_id);
+        }
+    }
+    ret = drmModeAtomicCommit(drm_fd, req, DRM_MODE_ATOMIC_NONBLOCK | DRM_MODE_PAGE_FLIP_EVENT, layer);
+    drmModeAtomicFree(req);
+    if (blob_id) {
+        drmModeDestroyPropertyBlob(drm_fd, blob_id);   /* Request keeps its own reference */
+    }
+    return ret == 0;
+}
+
+/**
+ * \brief           Low-Level control function
+ */
+uint8_t
+gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result) {
+    switch (cmd) {
+        case GUI_LL_Command_Init: {
+            uint8_t i = 0;
+            gui_ll_t* LL = (gui_ll_t *)param;
+            pthread_t th;
+            static uint8_t heap[GUI_LL_DRM_HEAP_SIZE];
+            static gui_mem_region_t regions[] = {
+                {heap, sizeof(heap), 0}                 /* General purpose region for all allocation classes */
+            };
+            
+            if (!drm_open()) {
+                if (result != NULL) {
+                    *(uint8_t *)result = 1;     /* Device is not available */
+                }
+                return 1;
+            }
+            gui_mem_assignmemory(regions, GUI_COUNT_OF(regions));
+            
+            LCD->width = mode.hdisplay;
+            LCD->height = mode.vdisplay;
+            LCD->pixel_size = LCD_PIXEL_SIZE;
+            
+            LCD->layer_count = LCD_LAYERS;
+            LCD->layers = layers;
+            for (i = 0; i < LCD_LAYERS; i++) {
+                layers[i].num = i;
+                layers[i].pixel_format = GUI_PIXEL_FORMAT_ARGB8888;
+                layers[i].start_address = buffers[i].mem;   /* Draw directly to scan-out buffer */
+            }
+            
+            LL->Init = lcd_init;
+            gui_ll_sw_assign(LL);               /* Use software kernels for all drawing routines */
+            LL->IsReady = NULL;                 /* Kernels are synchronous */
+            
+            pthread_create(&th, NULL, drm_event_thread, NULL);
+            pthread_detach(th);
+            
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;
+        }
+        case GUI_LL_Command_SetActiveLayer: {
+            gui_layer_t* layer = *(gui_layer_t **)param;
+            
+            if (!drm_flip(layer)) {
+                gui_lcd_confirmactivelayer(layer->num); /* Flip failed, do not block drawing */
+            }
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;                           /* Layer is confirmed from flip event */
+        }
+        default:
+            return 0;
+    }
+}
+
+#endif /* !__DOXYGEN__ */
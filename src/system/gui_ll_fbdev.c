@@ -0,0 +1,247 @@
+/**	
+ * \file            gui_ll_fbdev.c
+ * \brief           Low-level driver for Linux frame buffer devices
+ *
+ *                  Layers are drawn directly in memory mapped frame buffer and shown with display panning.
+ *                  When device has no space for second frame, layers are in RAM
+ *                  and only dirty regions are copied to frame buffer
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#include "system/gui_ll.h"
+#include "system/gui_ll_sw.h"
+#include "gui/gui_mem.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <linux/fb.h>
+
+#if !__DOXYGEN__
+
+#ifndef GUI_LL_FBDEV_DEVICE
+#define GUI_LL_FBDEV_DEVICE                 "/dev/fb0"
+#endif
+
+#ifndef GUI_LL_FBDEV_HEAP_SIZE
+#define GUI_LL_FBDEV_HEAP_SIZE              0x100000
+#endif
+
+/* Set to `0` when device does not implement vertical sync wait */
+#ifndef GUI_LL_FBDEV_VSYNC
+#define GUI_LL_FBDEV_VSYNC                  1
+#endif
+
+#if GUI_CFG_USE_BAND_RENDERING || GUI_CFG_USE_DIRECT_RENDERING || GUI_CFG_USE_TRIPLE_BUFFERING
+#error "Frame buffer driver supports only double buffered layer rendering"
+#endif
+
+#define LCD_LAYERS                          2
+
+static int fb_fd = -1;
+static uint8_t* fb_mem;                     /* Memory mapped frame buffer */
+static size_t fb_size;                      /* Size of mapped memory in units of bytes */
+static struct fb_var_screeninfo vinfo;
+static struct fb_fix_screeninfo finfo;
+static uint8_t fb_flip;                     /* Set to `1` when both layers are in frame buffer and display is panned */
+static uint8_t fb_full = 1;                 /* Set to `1` when whole layer must be copied */
+
+static gui_layer_t layers[LCD_LAYERS];
+
+static void
+lcd_init(gui_lcd_t* lcd) {
+    GUI_UNUSED(lcd);
+}
+
+/**
+ * \brief           Open frame buffer device and map its memory
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+fb_open(void) {
+    size_t frame_size;
+
+    fb_fd = open(GUI_LL_FBDEV_DEVICE, O_RDWR);
+    if (fb_fd < 0) {
+        printf("Cannot open %s\r\n", GUI_LL_FBDEV_DEVICE);
+        return 0;
+    }
+    if (ioctl(fb_fd, FBIOGET_VSCREENINFO, &vinfo) < 0) {
+        return 0;
+    }
+    if (vinfo.bits_per_pixel != 32 && vinfo.bits_per_pixel != 16) {
+        printf("Unsupported frame buffer format: %u bits per pixel\r\n", (unsigned)vinfo.bits_per_pixel);
+        return 0;
+    }
+    
+    /* Request space for second frame, it may be refused by device */
+    if (vinfo.yres_virtual < 2 * vinfo.yres) {
+        vinfo.yres_virtual = 2 * vinfo.yres;
+        vinfo.yoffset = 0;
+        ioctl(fb_fd, FBIOPUT_VSCREENINFO, &vinfo);
+        ioctl(fb_fd, FBIOGET_VSCREENINFO, &vinfo);
+    }
+    if (ioctl(fb_fd, FBIOGET_FSCREENINFO, &finfo) < 0) {
+        return 0;
+    }
+    
+    /* Layers can be in frame buffer only when lines are not padded */
+    frame_size = (size_t)finfo.line_length * vinfo.yres;
+    fb_flip = finfo.line_length == vinfo.xres * (vinfo.bits_per_pixel / 8)
+        && vinfo.yres_virtual >= 2 * vinfo.yres && finfo.smem_len >= 2 * frame_size;
+    
+    fb_size = finfo.smem_len;
+    fb_mem = mmap(NULL, fb_size, PROT_READ | PROT_WRITE, MAP_SHARED, fb_fd, 0);
+    if (fb_mem == MAP_FAILED) {
+        fb_mem = NULL;
+        return 0;
+    }
+    return 1;
+}
+
+/**
+ * \brief           Copy rectangle of RAM layer to frame buffer
+ * \param[in]       src: Layer memory
+ * \param[in]       d: Rectangle to copy, `x2` and `y2` are not included
+ */
+static void
+fb_copy_rect(const uint8_t* src, const gui_display_t* d) {
+    size_t ps = vinfo.bits_per_pixel / 8;
+    gui_dim_t y, x1, x2, y2;
+    
+    x1 = GUI_MAX(d->x1, 0);
+    x2 = GUI_MIN(d->x2, (gui_dim_t)vinfo.xres);
+    y2 = GUI_MIN(d->y2, (gui_dim_t)vinfo.yres);
+    for (y = GUI_MAX(d->y1, 0); y < y2 && x1 < x2; y++) {
+        memcpy(&fb_mem[(size_t)y * finfo.line_length + x1 * ps],
+            &src[((size_t)y * vinfo.xres + x1) * ps], (size_t)(x2 - x1) * ps);
+    }
+}
+
+/**
+ * \brief           Copy regions drawn on RAM layer to frame buffer
+ * \param[in]       layer: Layer to show
+ */
+static void
+fb_copy(gui_layer_t* layer) {
+    gui_display_t full = {0, 0, 0, 0};
+    size_t i;
+    
+    if (fb_full || layer->regions_count == 0) {
+        full.x2 = (gui_dim_t)vinfo.xres;
+        full.y2 = (gui_dim_t)vinfo.yres;
+        fb_copy_rect(layer->start_address, &full);
+        fb_full = 0;
+    } else {
+        for (i = 0; i < layer->regions_count; i++) {
+            fb_copy_rect(layer->start_address, &layer->regions[i]);
+        }
+    }
+}
+
+/**
+ * \brief           Low-Level control function
+ */
+uint8_t
+gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result) {
+    switch (cmd) {
+        case GUI_LL_Command_Init: {
+            uint8_t i = 0;
+            gui_ll_t* LL = (gui_ll_t *)param;
+            static uint8_t heap[GUI_LL_FBDEV_HEAP_SIZE];
+            static gui_mem_region_t regions[] = {
+                {heap, sizeof(heap), 0}                 /* General purpose region for all allocation classes */
+            };
+            
+            if (!fb_open()) {
+                if (result != NULL) {
+                    *(uint8_t *)result = 1;     /* Device is not available */
+                }
+                return 1;
+            }
+            gui_mem_assignmemory(regions, GUI_COUNT_OF(regions));
+            
+            LCD->width = (gui_dim_t)vinfo.xres;
+            LCD->height = (gui_dim_t)vinfo.yres;
+            LCD->pixel_size = (uint8_t)(vinfo.bits_per_pixel / 8);
+            
+            LCD->layer_count = LCD_LAYERS;
+            LCD->layers = layers;
+            for (i = 0; i < LCD_LAYERS; i++) {
+                layers[i].num = i;
+                if (vinfo.bits_per_pixel == 32) {
+                    layers[i].pixel_format = GUI_PIXEL_FORMAT_ARGB8888;
+                }
+                if (fb_flip) {                  /* Draw directly to frame buffer, no copy */
+                    layers[i].start_address = &fb_mem[(size_t)i * finfo.line_length * vinfo.yres];
+                } else {
+                    layers[i].start_address = malloc((size_t)vinfo.xres * vinfo.yres * LCD->pixel_size);
+                }
+            }
+            
+            LL->Init = lcd_init;
+            gui_ll_sw_assign(LL);               /* Use software kernels for all drawing routines */
+            LL->IsReady = NULL;                 /* Kernels are synchronous */
+            
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;
+        }
+        case GUI_LL_Command_SetActiveLayer: {
+            gui_layer_t* layer = *(gui_layer_t **)param;
+            
+            if (fb_flip) {
+                vinfo.yoffset = layer->num * vinfo.yres;
+                ioctl(fb_fd, FBIOPAN_DISPLAY, &vinfo);  /* Show layer from next refresh */
+            } else {
+                fb_copy(layer);
+            }
+#if GUI_LL_FBDEV_VSYNC
+            {
+                int crtc = 0;
+                ioctl(fb_fd, FBIO_WAITFORVSYNC, &crtc); /* Previous layer is not scanned out anymore */
+            }
+#endif /* GUI_LL_FBDEV_VSYNC */
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            gui_lcd_confirmactivelayer(layer->num);
+            return 1;
+        }
+        default:
+            return 0;
+    }
+}
+
+#endif /* !__DOXYGEN__ */
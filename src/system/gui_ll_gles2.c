@@ -0,0 +1,1035 @@
+/**
+ * \file            gui_ll_gles2.c
+ * \brief           Low-level driver for OpenGL ES 2 capable GPUs with SDL window
+ *
+ *                  Every layer, including widget cache and alpha scratch layers,
+ *                  is texture attached to frame buffer object. Layer memory is only
+ *                  used as address range to identify layer, pixels never leave GPU.
+ *                  Fills, blits and glyphs from atlas texture are batched to vertex buffer,
+ *                  batch of each dirty region is drawn with scissor set to region
+ *                  when \ref GUI_CFG_USE_LL_GPU is enabled.
+ *
+ *                  Window and GL context are created by SDL thread, which also polls input,
+ *                  context is used only by GUI thread afterwards
+ */
+
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#include "system/gui_ll.h"
+#include "gui/gui_mem.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "SDL.h"
+#include "SDL_opengles2.h"
+
+#if !__DOXYGEN__
+
+#ifndef GUI_LL_GLES2_WIDTH
+#define GUI_LL_GLES2_WIDTH                  800
+#endif
+
+#ifndef GUI_LL_GLES2_HEIGHT
+#define GUI_LL_GLES2_HEIGHT                 480
+#endif
+
+#ifndef GUI_LL_GLES2_HEAP_SIZE
+#define GUI_LL_GLES2_HEAP_SIZE              0x400000
+#endif
+
+#ifndef GUI_LL_GLES2_VSYNC
+#define GUI_LL_GLES2_VSYNC                  1
+#endif
+
+/* Number of quads in vertex buffer before it is drawn */
+#ifndef GUI_LL_GLES2_QUADS
+#define GUI_LL_GLES2_QUADS                  2048
+#endif
+
+/* Width and height of glyph atlas texture */
+#ifndef GUI_LL_GLES2_ATLAS_SIZE
+#define GUI_LL_GLES2_ATLAS_SIZE             1024
+#endif
+
+/* Number of glyphs in atlas, must be power of `2` */
+#ifndef GUI_LL_GLES2_GLYPHS
+#define GUI_LL_GLES2_GLYPHS                 2048
+#endif
+
+/* Number of frame buffer objects, display layers included */
+#ifndef GUI_LL_GLES2_TARGETS
+#define GUI_LL_GLES2_TARGETS                16
+#endif
+
+/* Number of images kept as textures */
+#ifndef GUI_LL_GLES2_IMAGES
+#define GUI_LL_GLES2_IMAGES                 32
+#endif
+
+#if GUI_CFG_USE_BAND_RENDERING || GUI_CFG_USE_DIRECT_RENDERING
+#error "GLES2 driver supports only layer rendering"
+#endif
+
+#if GUI_CFG_USE_LCD_ROTATION
+#error "GLES2 driver does not support rotation wrappers, layer pixels are not in memory"
+#endif
+
+#define LCD_PIXEL_SIZE                      4
+#if GUI_CFG_USE_TRIPLE_BUFFERING
+#define LCD_LAYERS                          3
+#else /* GUI_CFG_USE_TRIPLE_BUFFERING */
+#define LCD_LAYERS                          2
+#endif /* !GUI_CFG_USE_TRIPLE_BUFFERING */
+
+/**
+ * \brief           Fragment color source of batch
+ */
+typedef enum {
+    GLES_MODE_SOLID = 0x00,                 /*!< Vertex color */
+    GLES_MODE_IMAGE,                        /*!< Texture multiplied with vertex color */
+    GLES_MODE_GLYPH,                        /*!< Vertex color with alpha from alpha texture */
+    GLES_MODE_LAYER,                        /*!< Texture color with vertex alpha, layers are opaque */
+} gles_mode_t;
+
+/**
+ * \brief           Blending of batch with target
+ */
+typedef enum {
+    GLES_BLEND_NONE = 0x00,                 /*!< Overwrite target */
+    GLES_BLEND_ALPHA,                       /*!< Blend with source alpha */
+    GLES_BLEND_PREMUL,                      /*!< Blend premultiplied source */
+} gles_blend_t;
+
+/**
+ * \brief           Single vertex in vertex buffer
+ */
+typedef struct {
+    float x, y;                             /*!< Position in target */
+    float u, v;                             /*!< Texture coordinates */
+    uint8_t c[4];                           /*!< Color as `R, G, B, A` bytes */
+} gles_vertex_t;
+
+/**
+ * \brief           Layer as frame buffer object
+ */
+typedef struct {
+    const uint8_t* addr;                    /*!< Layer memory, used as key. `NULL` when entry is free */
+    gui_dim_t width;                        /*!< Layer width */
+    gui_dim_t height;                       /*!< Layer height */
+    GLuint fbo;                             /*!< Frame buffer object */
+    GLuint tex;                             /*!< Color texture of frame buffer object */
+    uint32_t used;                          /*!< Batch counter value when last used */
+} gles_target_t;
+
+/**
+ * \brief           Image uploaded to texture
+ */
+typedef struct {
+    const gui_image_desc_t* img;            /*!< Image descriptor, `NULL` when entry is free */
+    GLuint tex;                             /*!< Texture */
+    uint32_t used;                          /*!< Batch counter value when last used */
+} gles_image_t;
+
+/**
+ * \brief           Glyph in atlas texture
+ */
+typedef struct {
+    const uint8_t* src;                     /*!< Alpha data of glyph, `NULL` when entry is free */
+    uint32_t hash;                          /*!< Hash of glyph alpha, glyph cache memory may be reused */
+    gui_dim_t width;                        /*!< Glyph width */
+    gui_dim_t height;                       /*!< Glyph height */
+    uint16_t x, y;                          /*!< Position in atlas */
+} gles_glyph_t;
+
+static uint32_t frame_buffer[LCD_LAYERS][GUI_LL_GLES2_WIDTH * GUI_LL_GLES2_HEIGHT];   /* Address ranges of layers, never touched */
+static gui_layer_t layers[LCD_LAYERS];
+
+static SDL_Window* window;
+static SDL_GLContext context;
+static SDL_Event evt;
+volatile static uint8_t sdl_initialized = 0;
+
+static GLuint program, vbo, ibo;
+static GLint u_proj, u_mode;
+static GLuint atlas_tex, stream_tex;
+static GLint max_tex_size;
+
+static gles_target_t targets[GUI_LL_GLES2_TARGETS];
+static gles_image_t images[GUI_LL_GLES2_IMAGES];
+static gles_glyph_t glyphs[GUI_LL_GLES2_GLYPHS];
+static size_t glyphs_count;
+static uint16_t atlas_x, atlas_y, atlas_row;
+
+static gles_vertex_t vertices[GUI_LL_GLES2_QUADS * 4];
+static uint16_t indices[GUI_LL_GLES2_QUADS * 6];
+
+/**
+ * \brief           Current batch, all quads share target and state
+ */
+static struct {
+    gles_target_t* target;                  /*!< Target, `NULL` for window */
+    GLuint tex;                             /*!< Texture */
+    gles_mode_t mode;                       /*!< Color source */
+    gles_blend_t blend;                     /*!< Blending */
+    size_t count;                           /*!< Number of quads */
+    uint32_t counter;                       /*!< Number of batches drawn, used for LRU */
+} batch;
+
+static uint8_t* conv;                       /* Conversion buffer for texture uploads */
+static size_t conv_size;
+
+static const char vs_src[] =
+    "attribute vec2 a_pos;\n"
+    "attribute vec2 a_uv;\n"
+    "attribute vec4 a_color;\n"
+    "uniform vec4 u_proj;\n"
+    "varying vec2 v_uv;\n"
+    "varying vec4 v_color;\n"
+    "void main() {\n"
+    "    gl_Position = vec4(a_pos * u_proj.xy + u_proj.zw, 0.0, 1.0);\n"
+    "    v_uv = a_uv;\n"
+    "    v_color = a_color;\n"
+    "}\n";
+
+static const char fs_src[] =
+    "precision mediump float;\n"
+    "uniform sampler2D u_tex;\n"
+    "uniform int u_mode;\n"
+    "varying vec2 v_uv;\n"
+    "varying vec4 v_color;\n"
+    "void main() {\n"
+    "    vec4 t = texture2D(u_tex, v_uv);\n"
+    "    if (u_mode == 0) {\n"
+    "        gl_FragColor = v_color;\n"
+    "    } else if (u_mode == 1) {\n"
+    "        gl_FragColor = t * v_color;\n"
+    "    } else if (u_mode == 2) {\n"
+    "        gl_FragColor = vec4(v_color.rgb, v_color.a * t.a);\n"
+    "    } else {\n"
+    "        gl_FragColor = vec4(t.rgb, v_color.a);\n"
+    "    }\n"
+    "}\n";
+
+static int sdl_thread(void* param);
+static void sdl_input(void);
+static uint8_t gles_setup(void);
+
+/**
+ * \brief           Draw all quads of batch
+ * \param[in]       scissor: Region to limit drawing to, `NULL` for complete target
+ */
+static void
+gles_flush(const gui_display_t* scissor) {
+    gui_dim_t w, h;
+
+    if (batch.count == 0) {
+        return;
+    }
+    if (batch.target != NULL) {
+        w = batch.target->width;
+        h = batch.target->height;
+        glBindFramebuffer(GL_FRAMEBUFFER, batch.target->fbo);
+        glViewport(0, 0, w, h);
+        glUniform4f(u_proj, 2.0f / w, 2.0f / h, -1.0f, -1.0f);  /* Layer row 0 is texture row 0 */
+    } else {
+        w = GUI_LL_GLES2_WIDTH;
+        h = GUI_LL_GLES2_HEIGHT;
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glViewport(0, 0, w, h);
+        glUniform4f(u_proj, 2.0f / w, -2.0f / h, -1.0f, 1.0f);  /* Window origin is bottom left */
+    }
+    if (scissor != NULL) {
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(scissor->x1, scissor->y1, scissor->x2 - scissor->x1, scissor->y2 - scissor->y1);
+    } else {
+        glDisable(GL_SCISSOR_TEST);
+    }
+    glUniform1i(u_mode, (GLint)batch.mode);
+    glBindTexture(GL_TEXTURE_2D, batch.tex);
+    switch (batch.blend) {
+        case GLES_BLEND_ALPHA:
+            glEnable(GL_BLEND);
+            glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ZERO, GL_ONE);
+            break;
+        case GLES_BLEND_PREMUL:
+            glEnable(GL_BLEND);
+            glBlendFuncSeparate(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ZERO, GL_ONE);
+            break;
+        default:
+            glDisable(GL_BLEND);
+            break;
+    }
+    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices[0]) * 4 * batch.count, vertices, GL_STREAM_DRAW);
+    glDrawElements(GL_TRIANGLES, (GLsizei)(6 * batch.count), GL_UNSIGNED_SHORT, 0);
+    batch.count = 0;
+    batch.counter++;
+}
+
+/**
+ * \brief           Add quad to batch, batch is drawn first when its state is different
+ */
+static void
+gles_quad(gles_target_t* target, GLuint tex, gles_mode_t mode, gles_blend_t blend,
+            float x, float y, float w, float h, float u0, float v0, float u1, float v1, gui_color_t color) {
+    gles_vertex_t* v;
+    size_t i;
+
+    if (batch.count == GUI_LL_GLES2_QUADS || batch.target != target || batch.tex != tex
+        || batch.mode != mode || batch.blend != blend) {
+        gles_flush(NULL);
+        batch.target = target;
+        batch.tex = tex;
+        batch.mode = mode;
+        batch.blend = blend;
+    }
+    v = &vertices[4 * batch.count++];
+    v[0].x = x;     v[0].y = y;     v[0].u = u0;    v[0].v = v0;
+    v[1].x = x + w; v[1].y = y;     v[1].u = u1;    v[1].v = v0;
+    v[2].x = x + w; v[2].y = y + h; v[2].u = u1;    v[2].v = v1;
+    v[3].x = x;     v[3].y = y + h; v[3].u = u0;    v[3].v = v1;
+    for (i = 0; i < 4; i++) {
+        v[i].c[0] = (uint8_t)(color >> 16);
+        v[i].c[1] = (uint8_t)(color >> 8);
+        v[i].c[2] = (uint8_t)(color);
+        v[i].c[3] = (uint8_t)(color >> 24);
+    }
+}
+
+/**
+ * \brief           Create texture with nearest filter
+ */
+static GLuint
+gles_texture(GLenum format, gui_dim_t width, gui_dim_t height, const void* data) {
+    GLuint tex;
+
+    glGenTextures(1, &tex);
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+    return tex;
+}
+
+/**
+ * \brief           Get frame buffer object of layer, create it on first use
+ *
+ *                  Widget cache and alpha scratch layers are allocated by core,
+ *                  least recently used object is reused for new layer
+ */
+static gles_target_t*
+gles_target(gui_layer_t* layer) {
+    static uint8_t ready;
+    gles_target_t* t = NULL;
+    size_t i;
+
+    /* GUI thread may not be one which called init, context is taken on first drawing */
+    if (!ready) {
+        SDL_GL_MakeCurrent(window, context);
+        SDL_GL_SetSwapInterval(GUI_LL_GLES2_VSYNC);
+        ready = gles_setup();
+        for (i = 0; i < LCD_LAYERS; i++) {  /* Display layers use first objects */
+            targets[i].addr = (const uint8_t *)frame_buffer[i];
+            targets[i].width = GUI_LL_GLES2_WIDTH;
+            targets[i].height = GUI_LL_GLES2_HEIGHT;
+            targets[i].tex = gles_texture(GL_RGBA, GUI_LL_GLES2_WIDTH, GUI_LL_GLES2_HEIGHT, NULL);
+            glGenFramebuffers(1, &targets[i].fbo);
+            glBindFramebuffer(GL_FRAMEBUFFER, targets[i].fbo);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, targets[i].tex, 0);
+        }
+    }
+    for (i = 0; i < GUI_LL_GLES2_TARGETS; i++) {
+        if (targets[i].addr == layer->start_address && targets[i].width == layer->width && targets[i].height == layer->height) {
+            targets[i].used = batch.counter;
+            return &targets[i];
+        }
+    }
+    for (i = LCD_LAYERS; i < GUI_LL_GLES2_TARGETS; i++) {   /* Display layers are never replaced */
+        if (targets[i].addr == NULL) {
+            t = &targets[i];
+            break;
+        }
+        if (t == NULL || targets[i].used < t->used) {
+            t = &targets[i];
+        }
+    }
+    if (t->addr != NULL) {
+        gles_flush(NULL);                   /* Batch may draw to replaced object */
+        glDeleteFramebuffers(1, &t->fbo);
+        glDeleteTextures(1, &t->tex);
+    }
+    t->addr = layer->start_address;
+    t->width = layer->width;
+    t->height = layer->height;
+    t->used = batch.counter;
+    t->tex = gles_texture(GL_RGBA, t->width, t->height, NULL);
+    glGenFramebuffers(1, &t->fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, t->fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, t->tex, 0);
+    return t;
+}
+
+/**
+ * \brief           Find layer which memory contains address
+ * \param[in]       p: Address in layer memory
+ * \param[out]      x: X position of address in layer
+ * \param[out]      y: Y position of address in layer
+ * \return          Layer object or `NULL` when address is not in any layer
+ */
+static gles_target_t*
+gles_find(const void* p, gui_dim_t* x, gui_dim_t* y) {
+    const uint8_t* a = p;
+    size_t i, off;
+
+    for (i = 0; i < GUI_LL_GLES2_TARGETS; i++) {
+        if (targets[i].addr != NULL && a >= targets[i].addr
+            && a < targets[i].addr + (size_t)targets[i].width * targets[i].height * LCD_PIXEL_SIZE) {
+            off = (size_t)(a - targets[i].addr) / LCD_PIXEL_SIZE;
+            *x = (gui_dim_t)(off % targets[i].width);
+            *y = (gui_dim_t)(off / targets[i].width);
+            return &targets[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Get position of address in drawing layer
+ */
+static void
+gles_xy(gui_layer_t* layer, const void* p, gui_dim_t* x, gui_dim_t* y) {
+    size_t off = (size_t)((const uint8_t *)p - (const uint8_t *)layer->start_address) / LCD_PIXEL_SIZE;
+
+    *x = (gui_dim_t)(off % layer->width);
+    *y = (gui_dim_t)(off / layer->width);
+}
+
+/**
+ * \brief           Get conversion buffer of at least `size` bytes
+ */
+static uint8_t*
+gles_conv(size_t size) {
+    if (size > conv_size) {
+        uint8_t* p = realloc(conv, size);
+        if (p == NULL) {
+            return NULL;
+        }
+        conv = p;
+        conv_size = size;
+    }
+    return conv;
+}
+
+/**
+ * \brief           Convert pixels to `R, G, B, A` bytes
+ * \param[in]       bpp: Source format, `16`, `24` or `32` bits of image, `0` for layer memory
+ */
+static uint8_t*
+gles_convert(const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline, uint8_t bpp) {
+    const uint8_t* s = src;
+    uint8_t* d, *out;
+    gui_dim_t x, y;
+
+    out = d = gles_conv((size_t)x_size * y_size * 4);
+    if (out == NULL) {
+        return NULL;
+    }
+    for (y = 0; y < y_size; y++) {
+        for (x = 0; x < x_size; x++, d += 4) {
+            switch (bpp) {
+                case 16: {                  /* RGB565 with red in lowest bits */
+                    uint16_t c = (uint16_t)(s[0] | (s[1] << 8));
+                    d[0] = (uint8_t)((c & 0x1F) * 255 / 31);
+                    d[1] = (uint8_t)(((c >> 5) & 0x3F) * 255 / 63);
+                    d[2] = (uint8_t)((c >> 11) * 255 / 31);
+                    d[3] = 0xFF;
+                    s += 2;
+                    break;
+                }
+                case 24:
+                    d[0] = s[0]; d[1] = s[1]; d[2] = s[2]; d[3] = 0xFF;
+                    s += 3;
+                    break;
+                case 32:                    /* Alpha is inverted, `0` is opaque */
+                    d[0] = s[0]; d[1] = s[1]; d[2] = s[2]; d[3] = (uint8_t)(0xFF - s[3]);
+                    s += 4;
+                    break;
+                default:                    /* ARGB8888 layer memory */
+                    d[0] = s[2]; d[1] = s[1]; d[2] = s[0]; d[3] = s[3];
+                    s += 4;
+                    break;
+            }
+        }
+        s += (size_t)offline * (bpp ? bpp / 8 : 4);
+    }
+    return out;
+}
+
+/**
+ * \brief           Upload pixels to stream texture, texture covers only uploaded rectangle
+ * \note            Batch using stream texture must be drawn before next upload
+ */
+static GLuint
+gles_stream(GLenum format, gui_dim_t width, gui_dim_t height, const void* data) {
+    gles_flush(NULL);
+    glBindTexture(GL_TEXTURE_2D, stream_tex);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+    return stream_tex;
+}
+
+static void
+lcd_init(gui_lcd_t* lcd) {
+    GUI_UNUSED(lcd);
+    SDL_CreateThread(sdl_thread, "SDL Thread", NULL);
+    while (!sdl_initialized) {}
+}
+
+static void
+lcd_fillrect(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t x_size, gui_dim_t y_size, gui_color_t color) {
+    GUI_UNUSED(lcd);
+    gles_quad(gles_target(layer), 0, GLES_MODE_SOLID, GLES_BLEND_NONE, x, y, x_size, y_size, 0, 0, 0, 0, color);
+}
+
+static void
+lcd_fill(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline, gui_color_t color) {
+    gui_dim_t x, y;
+
+    GUI_UNUSED(offline);
+    gles_xy(layer, dst, &x, &y);
+    lcd_fillrect(lcd, layer, x, y, x_size, y_size, color);
+}
+
+static void
+lcd_drawhline(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    lcd_fillrect(lcd, layer, x, y, length, 1, color);
+}
+
+static void
+lcd_drawvline(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    lcd_fillrect(lcd, layer, x, y, 1, length, color);
+}
+
+static void
+lcd_setpixel(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_color_t color) {
+    lcd_fillrect(lcd, layer, x, y, 1, 1, color);
+}
+
+static void
+lcd_fillspans(gui_lcd_t* lcd, gui_layer_t* layer, const gui_span_t* spans, size_t count, gui_color_t color) {
+    gles_target_t* t = gles_target(layer);
+
+    GUI_UNUSED(lcd);
+    for (; count > 0; count--, spans++) {
+        gles_quad(t, 0, GLES_MODE_SOLID, GLES_BLEND_NONE, spans->x, spans->y, spans->length, 1, 0, 0, 0, 0, color);
+    }
+}
+
+/**
+ * \brief           Read pixel back from GPU
+ * \note            Stalls until GPU finished all drawings, core uses it only
+ *                  for drawings without accelerated functions
+ */
+static gui_color_t
+lcd_getpixel(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y) {
+    gles_target_t* t = gles_target(layer);
+    uint8_t c[4];
+
+    GUI_UNUSED(lcd);
+    gles_flush(NULL);
+    glBindFramebuffer(GL_FRAMEBUFFER, t->fbo);
+    glReadPixels(x, y, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, c);
+    return ((gui_color_t)c[3] << 24) | ((gui_color_t)c[0] << 16) | ((gui_color_t)c[1] << 8) | c[2];
+}
+
+/**
+ * \brief           Copy rectangle from layer or memory to drawing layer
+ * \param[in]       color: Alpha of source in highest byte, other bits set to `1`
+ */
+static void
+gles_copy(gui_layer_t* layer, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_src, gui_color_t color) {
+    gles_target_t* t, *s;
+    gles_blend_t blend = (color >> 24) == 0xFF ? GLES_BLEND_NONE : GLES_BLEND_ALPHA;
+    gui_dim_t x, y, sx, sy;
+    GLuint tex;
+
+    /* Alpha layer is blended with scratch layer as `layer`, destination is found by address */
+    gles_target(layer);
+    if ((t = gles_find(dst, &x, &y)) == NULL) {
+        return;
+    }
+    s = gles_find(src, &sx, &sy);
+    if (s != NULL && s != t) {              /* Layer to layer, such as widget cache to screen */
+        gles_quad(t, s->tex, GLES_MODE_LAYER, blend, x, y, x_size, y_size,
+            (float)sx / s->width, (float)sy / s->height,
+            (float)(sx + x_size) / s->width, (float)(sy + y_size) / s->height, color);
+        return;
+    }
+    if (s == t) {                           /* Scroll inside layer, texture cannot be read while drawn */
+        gles_flush(NULL);
+        glBindFramebuffer(GL_FRAMEBUFFER, t->fbo);
+        glBindTexture(GL_TEXTURE_2D, stream_tex);
+        glCopyTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, sx, sy, x_size, y_size, 0);
+        tex = stream_tex;
+    } else {                                /* Pixels in CPU memory */
+        uint8_t* data = gles_convert(src, x_size, y_size, offline_src, 0);
+        if (data == NULL) {
+            return;
+        }
+        tex = gles_stream(GL_RGBA, x_size, y_size, data);
+    }
+    gles_quad(t, tex, GLES_MODE_LAYER, blend, x, y, x_size, y_size, 0, 0, 1, 1, color);
+    gles_flush(NULL);                       /* Stream texture is reused by next call */
+}
+
+static void
+lcd_copy(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    GUI_UNUSED(lcd);
+    GUI_UNUSED(offline_dst);
+    gles_copy(layer, dst, src, x_size, y_size, offline_src, 0xFFFFFFFFUL);
+}
+
+static void
+lcd_copyblend(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, uint8_t alpha_src, uint8_t alpha_dst, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    GUI_UNUSED(lcd);
+    GUI_UNUSED(alpha_dst);
+    GUI_UNUSED(offline_dst);
+    gles_copy(layer, dst, src, x_size, y_size, offline_src, ((gui_color_t)alpha_src << 24) | 0x00FFFFFFUL);
+}
+
+/**
+ * \brief           Draw part of image, memory mapped images are uploaded once to texture
+ */
+static void
+gles_image(gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_src) {
+    gles_target_t* t = gles_target(layer);
+    gles_image_t* e = NULL;
+    gles_blend_t blend = GLES_BLEND_NONE;
+    gui_dim_t x, y, stride = img->stride ? img->stride : img->x_size;
+    uint8_t bytes = img->bpp / 8;
+    size_t i, off;
+
+    if (img->bpp == 32 && !(img->flags & GUI_FLAG_IMAGE_OPAQUE)) {
+        blend = (img->flags & GUI_FLAG_IMAGE_PREMULTIPLIED) ? GLES_BLEND_PREMUL : GLES_BLEND_ALPHA;
+    }
+    gles_xy(layer, dst, &x, &y);
+
+    /* Decoded, volatile and too large images are streamed */
+    off = (size_t)((const uint8_t *)src - img->image);
+    if (img->compression == GUI_IMAGE_COMPRESSION_NONE && img->read == NULL && !(img->flags & GUI_FLAG_IMAGE_VOLATILE)
+        && (const uint8_t *)src >= img->image && off < (size_t)stride * img->y_size * bytes
+        && stride <= max_tex_size && img->y_size <= max_tex_size) {
+        for (i = 0; i < GUI_LL_GLES2_IMAGES; i++) {
+            if (images[i].img == img) {
+                e = &images[i];
+                break;
+            }
+            if (e == NULL || images[i].img == NULL || (e->img != NULL && images[i].used < e->used)) {
+                e = &images[i];
+            }
+        }
+        if (e->img != img) {
+            uint8_t* data = gles_convert(img->image, stride, img->y_size, 0, img->bpp);
+            if (data == NULL) {
+                return;
+            }
+            if (e->img != NULL) {
+                gles_flush(NULL);
+                glDeleteTextures(1, &e->tex);
+            }
+            e->img = img;
+            e->tex = gles_texture(GL_RGBA, stride, img->y_size, data);
+        }
+        e->used = batch.counter;
+        off /= bytes;
+        gles_quad(t, e->tex, GLES_MODE_IMAGE, blend, x, y, x_size, y_size,
+            (float)(off % stride) / stride, (float)(off / stride) / img->y_size,
+            (float)(off % stride + x_size) / stride, (float)(off / stride + y_size) / img->y_size, 0xFFFFFFFFUL);
+    } else {
+        uint8_t* data = gles_convert(src, x_size, y_size, offline_src, img->bpp);
+        if (data == NULL) {
+            return;
+        }
+        gles_quad(t, gles_stream(GL_RGBA, x_size, y_size, data), GLES_MODE_IMAGE, blend, x, y, x_size, y_size, 0, 0, 1, 1, 0xFFFFFFFFUL);
+        gles_flush(NULL);
+    }
+}
+
+static void
+lcd_drawimage16(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    GUI_UNUSED(lcd);
+    GUI_UNUSED(offline_dst);
+    gles_image(layer, img, dst, src, x_size, y_size, offline_src);
+}
+
+static void
+lcd_drawimage24(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    GUI_UNUSED(lcd);
+    GUI_UNUSED(offline_dst);
+    gles_image(layer, img, dst, src, x_size, y_size, offline_src);
+}
+
+static void
+lcd_drawimage32(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    GUI_UNUSED(lcd);
+    GUI_UNUSED(offline_dst);
+    gles_image(layer, img, dst, src, x_size, y_size, offline_src);
+}
+
+/**
+ * \brief           Get glyph from atlas, add it when not there yet
+ * \return          Glyph entry or `NULL` when glyph does not fit to atlas
+ */
+static gles_glyph_t*
+gles_glyph(const uint8_t* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_src) {
+    gles_glyph_t* g;
+    uint32_t hash = 2166136261UL;
+    const uint8_t* s = src;
+    uint8_t* d;
+    gui_dim_t x, y;
+    size_t i;
+
+    if (x_size > GUI_LL_GLES2_ATLAS_SIZE || y_size > GUI_LL_GLES2_ATLAS_SIZE) {
+        return NULL;
+    }
+
+    /* Glyph cache may reuse memory for other glyph, content is part of the key */
+    for (y = 0; y < y_size; y++, s += offline_src) {
+        for (x = 0; x < x_size; x++, s++) {
+            hash = (hash ^ *s) * 16777619UL;
+        }
+    }
+    i = (((size_t)src >> 2) ^ hash) & (GUI_LL_GLES2_GLYPHS - 1);
+    for (;; i = (i + 1) & (GUI_LL_GLES2_GLYPHS - 1)) {
+        g = &glyphs[i];
+        if (g->src == NULL) {
+            break;
+        }
+        if (g->src == src && g->hash == hash && g->width == x_size && g->height == y_size) {
+            return g;
+        }
+    }
+
+    /* Place glyph on shelf, start new atlas when full */
+    if (atlas_x + x_size > GUI_LL_GLES2_ATLAS_SIZE) {
+        atlas_x = 0;
+        atlas_y += atlas_row;
+        atlas_row = 0;
+    }
+    if (atlas_y + y_size > GUI_LL_GLES2_ATLAS_SIZE || glyphs_count >= GUI_LL_GLES2_GLYPHS / 2) {
+        gles_flush(NULL);                   /* Batch uses current atlas content */
+        memset(glyphs, 0x00, sizeof(glyphs));
+        glyphs_count = 0;
+        atlas_x = atlas_y = atlas_row = 0;
+        return gles_glyph(src, x_size, y_size, offline_src);
+    }
+    g->src = src;
+    g->hash = hash;
+    g->width = x_size;
+    g->height = y_size;
+    g->x = atlas_x;
+    g->y = atlas_y;
+    glyphs_count++;
+    atlas_x += x_size;
+    atlas_row = GUI_MAX(atlas_row, (uint16_t)y_size);
+
+    /* Rows must be packed for upload */
+    s = src;
+    if (offline_src) {
+        d = gles_conv((size_t)x_size * y_size);
+        if (d == NULL) {
+            g->src = NULL;
+            return NULL;
+        }
+        for (y = 0; y < y_size; y++, s += x_size + offline_src) {
+            memcpy(&d[(size_t)y * x_size], s, x_size);
+        }
+        s = d;
+    }
+    glBindTexture(GL_TEXTURE_2D, atlas_tex);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, g->x, g->y, x_size, y_size, GL_ALPHA, GL_UNSIGNED_BYTE, s);
+    return g;
+}
+
+static void
+lcd_copychar(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src, gui_color_t color) {
+    gles_target_t* t = gles_target(layer);
+    gles_glyph_t* g;
+    gui_dim_t x, y;
+    const float a = 1.0f / GUI_LL_GLES2_ATLAS_SIZE;
+
+    GUI_UNUSED(lcd);
+    GUI_UNUSED(offline_dst);
+    gles_xy(layer, dst, &x, &y);
+    g = gles_glyph(src, x_size, y_size, offline_src);
+    if (g != NULL) {
+        gles_quad(t, atlas_tex, GLES_MODE_GLYPH, GLES_BLEND_ALPHA, x, y, x_size, y_size,
+            g->x * a, g->y * a, (g->x + x_size) * a, (g->y + y_size) * a, color);
+    } else {                                /* Large alpha masks, such as icons, are streamed */
+        const uint8_t* s = src;
+        uint8_t* d = gles_conv((size_t)x_size * y_size);
+        gui_dim_t i;
+
+        if (d == NULL) {
+            return;
+        }
+        for (i = 0; i < y_size; i++, s += x_size + offline_src) {
+            memcpy(&d[(size_t)i * x_size], s, x_size);
+        }
+        gles_quad(t, gles_stream(GL_ALPHA, x_size, y_size, d), GLES_MODE_GLYPH, GLES_BLEND_ALPHA, x, y, x_size, y_size, 0, 0, 1, 1, color);
+        gles_flush(NULL);
+    }
+}
+
+static uint8_t
+lcd_isready(gui_lcd_t* lcd) {
+    GUI_UNUSED(lcd);
+    gles_flush(NULL);                       /* Commands are ordered by GPU, CPU never reads layer memory */
+    return 1;
+}
+
+/**
+ * \brief           Compile shaders and create buffers
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+gles_setup(void) {
+    const char* srcs[] = { vs_src, fs_src };
+    GLenum types[] = { GL_VERTEX_SHADER, GL_FRAGMENT_SHADER };
+    GLuint sh;
+    GLint ok;
+    size_t i;
+
+    program = glCreateProgram();
+    for (i = 0; i < 2; i++) {
+        sh = glCreateShader(types[i]);
+        glShaderSource(sh, 1, &srcs[i], NULL);
+        glCompileShader(sh);
+        glGetShaderiv(sh, GL_COMPILE_STATUS, &ok);
+        if (!ok) {
+            printf("GLES2 shader compilation failed\r\n");
+            return 0;
+        }
+        glAttachShader(program, sh);
+        glDeleteShader(sh);
+    }
+    glBindAttribLocation(program, 0, "a_pos");
+    glBindAttribLocation(program, 1, "a_uv");
+    glBindAttribLocation(program, 2, "a_color");
+    glLinkProgram(program);
+    glGetProgramiv(program, GL_LINK_STATUS, &ok);
+    if (!ok) {
+        printf("GLES2 program link failed\r\n");
+        return 0;
+    }
+    glUseProgram(program);
+    u_proj = glGetUniformLocation(program, "u_proj");
+    u_mode = glGetUniformLocation(program, "u_mode");
+    glUniform1i(glGetUniformLocation(program, "u_tex"), 0);
+
+    /* Quads share index buffer */
+    for (i = 0; i < GUI_LL_GLES2_QUADS; i++) {
+        indices[6 * i + 0] = (uint16_t)(4 * i + 0);
+        indices[6 * i + 1] = (uint16_t)(4 * i + 1);
+        indices[6 * i + 2] = (uint16_t)(4 * i + 2);
+        indices[6 * i + 3] = (uint16_t)(4 * i + 0);
+        indices[6 * i + 4] = (uint16_t)(4 * i + 2);
+        indices[6 * i + 5] = (uint16_t)(4 * i + 3);
+    }
+    glGenBuffers(1, &ibo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(gles_vertex_t), (void *)offsetof(gles_vertex_t, x));
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(gles_vertex_t), (void *)offsetof(gles_vertex_t, u));
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(gles_vertex_t), (void *)offsetof(gles_vertex_t, c));
+    for (i = 0; i < 3; i++) {
+        glEnableVertexAttribArray((GLuint)i);
+    }
+
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_tex_size);
+    atlas_tex = gles_texture(GL_ALPHA, GUI_LL_GLES2_ATLAS_SIZE, GUI_LL_GLES2_ATLAS_SIZE, NULL);
+    stream_tex = gles_texture(GL_RGBA, 1, 1, NULL);
+    return 1;
+}
+
+/**
+ * \brief           SDL thread, creates window and polls input
+ */
+static int
+sdl_thread(void* arg) {
+    GUI_UNUSED(arg);
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        printf("SDL init problems: %s\r\n", SDL_GetError());
+    }
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_ES);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 2);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 0);
+    SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
+    window = SDL_CreateWindow("EasyGUI", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+        GUI_LL_GLES2_WIDTH, GUI_LL_GLES2_HEIGHT, SDL_WINDOW_OPENGL);
+    context = SDL_GL_CreateContext(window);
+    SDL_GL_MakeCurrent(window, NULL);       /* Context is made current by GUI thread */
+
+    sdl_initialized = 1;
+    while (1) {
+        SDL_WaitEventTimeout(&evt, 10);
+        do {
+            sdl_input();
+        } while (SDL_PollEvent(&evt));
+    }
+    return 0;
+}
+
+static void
+sdl_input(void) {
+    static gui_touch_data_t ts;
+
+    switch (evt.type) {
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP: {
+            if (evt.button.button == SDL_BUTTON_LEFT) {
+                ts.count = evt.type == SDL_MOUSEBUTTONDOWN;
+                ts.status = ts.count ? GUI_TOUCH_STATE_PRESSED : GUI_TOUCH_STATE_RELEASED;
+                ts.x[0] = (gui_dim_t)evt.button.x;
+                ts.y[0] = (gui_dim_t)evt.button.y;
+                gui_input_touchadd(&ts);
+            }
+            break;
+        }
+        case SDL_MOUSEMOTION: {
+            if (ts.count) {
+                ts.x[0] = (gui_dim_t)evt.motion.x;
+                ts.y[0] = (gui_dim_t)evt.motion.y;
+                gui_input_touchadd(&ts);
+            }
+            break;
+        }
+        case SDL_FINGERDOWN:
+        case SDL_FINGERUP:
+        case SDL_FINGERMOTION: {            /* Touch panels of HMI boards report normalized position */
+            ts.count = evt.type != SDL_FINGERUP;
+            ts.status = ts.count ? GUI_TOUCH_STATE_PRESSED : GUI_TOUCH_STATE_RELEASED;
+            ts.x[0] = (gui_dim_t)(evt.tfinger.x * GUI_LL_GLES2_WIDTH);
+            ts.y[0] = (gui_dim_t)(evt.tfinger.y * GUI_LL_GLES2_HEIGHT);
+            gui_input_touchadd(&ts);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/**
+ * \brief           Low-Level control function
+ */
+uint8_t
+gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result) {
+    switch (cmd) {
+        case GUI_LL_Command_Init: {
+            uint8_t i = 0;
+            gui_ll_t* LL = (gui_ll_t *)param;
+            static uint8_t heap[GUI_LL_GLES2_HEAP_SIZE];
+            static gui_mem_region_t regions[] = {
+                {heap, sizeof(heap), 0}                 /* General purpose region for all allocation classes */
+            };
+
+            gui_mem_assignmemory(regions, GUI_COUNT_OF(regions));
+
+            LCD->width = GUI_LL_GLES2_WIDTH;
+            LCD->height = GUI_LL_GLES2_HEIGHT;
+            LCD->pixel_size = LCD_PIXEL_SIZE;
+
+            LCD->layer_count = LCD_LAYERS;
+            LCD->layers = layers;
+            for (i = 0; i < LCD_LAYERS; i++) {
+                layers[i].num = i;
+                layers[i].pixel_format = GUI_PIXEL_FORMAT_ARGB8888;
+                layers[i].start_address = frame_buffer[i];
+            }
+
+            /* All drawing routines are on GPU, there are no software fallbacks */
+            LL->Init = lcd_init;
+            LL->IsReady = lcd_isready;
+            LL->SetPixel = lcd_setpixel;
+            LL->GetPixel = lcd_getpixel;
+            LL->Fill = lcd_fill;
+            LL->FillRect = lcd_fillrect;
+            LL->DrawHLine = lcd_drawhline;
+            LL->DrawVLine = lcd_drawvline;
+            LL->FillSpans = lcd_fillspans;
+            LL->Copy = lcd_copy;
+            LL->CopyBlend = lcd_copyblend;
+            LL->DrawImage16 = lcd_drawimage16;
+            LL->DrawImage24 = lcd_drawimage24;
+            LL->DrawImage32 = lcd_drawimage32;
+            LL->CopyChar = lcd_copychar;
+
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;
+        }
+#if GUI_CFG_USE_LL_GPU
+        case GUI_LL_Command_Submit: {       /* Region of display layer is complete */
+            const gui_display_t* disp = param;
+
+            if (batch.target != NULL && batch.target < &targets[LCD_LAYERS]) {
+                gles_flush(disp);
+            } else {
+                gles_flush(NULL);
+            }
+            return 1;
+        }
+#endif /* GUI_CFG_USE_LL_GPU */
+        case GUI_LL_Command_SetActiveLayer: {
+            gui_layer_t* layer = *(gui_layer_t **)param;
+            gles_target_t* t = gles_target(layer);
+
+            /* Window content is undefined after swap, whole layer is drawn */
+            gles_quad(NULL, t->tex, GLES_MODE_LAYER, GLES_BLEND_NONE, 0, 0, GUI_LL_GLES2_WIDTH, GUI_LL_GLES2_HEIGHT, 0, 0, 1, 1, 0xFFFFFFFFUL);
+            gles_flush(NULL);
+            SDL_GL_SwapWindow(window);
+            gui_lcd_confirmactivelayer(layer->num);
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;
+        }
+        default:
+            return 0;
+    }
+}
+
+#endif /* !__DOXYGEN__ */
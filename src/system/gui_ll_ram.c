@@ -0,0 +1,248 @@
+/**	
+ * \file            gui_ll_ram.c
+ * \brief           Headless low-level driver with RAM frame buffer
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#include "system/gui_ll.h"
+#include "system/gui_ll_sw.h"
+#include "system/gui_ll_ram.h"
+#include "gui/gui_mem.h"
+
+#if !__DOXYGEN__
+
+#ifndef GUI_LL_RAM_WIDTH
+#define GUI_LL_RAM_WIDTH                    800
+#endif
+
+#ifndef GUI_LL_RAM_HEIGHT
+#define GUI_LL_RAM_HEIGHT                   480
+#endif
+
+#ifndef GUI_LL_RAM_HEAP_SIZE
+#define GUI_LL_RAM_HEAP_SIZE                0x100000
+#endif
+
+#define LCD_PIXEL_SIZE                      4
+#if GUI_CFG_USE_DIRECT_RENDERING
+#define LCD_LAYERS                          1
+#elif GUI_CFG_USE_TRIPLE_BUFFERING && !GUI_CFG_USE_BAND_RENDERING
+#define LCD_LAYERS                          3
+#else /* GUI_CFG_USE_TRIPLE_BUFFERING && !GUI_CFG_USE_BAND_RENDERING */
+#define LCD_LAYERS                          2
+#endif /* !(GUI_CFG_USE_TRIPLE_BUFFERING && !GUI_CFG_USE_BAND_RENDERING) */
+
+#if GUI_CFG_USE_BAND_RENDERING
+#define BAND_LINES                          16
+
+static uint32_t frame_buffer[1][GUI_LL_RAM_WIDTH * GUI_LL_RAM_HEIGHT];
+static uint32_t band_buffer[LCD_LAYERS][GUI_LL_RAM_WIDTH * BAND_LINES];
+#else /* GUI_CFG_USE_BAND_RENDERING */
+static uint32_t frame_buffer[LCD_LAYERS][GUI_LL_RAM_WIDTH * GUI_LL_RAM_HEIGHT];
+#endif /* !GUI_CFG_USE_BAND_RENDERING */
+
+static gui_layer_t layers[LCD_LAYERS];
+static const uint32_t* shown = frame_buffer[0];
+static gui_ll_ram_stat_t stat;
+
+#if GUI_CFG_USE_OVERLAY
+#define LCD_OVERLAYS                        1
+static gui_overlay_t overlays[LCD_OVERLAYS];
+#endif /* GUI_CFG_USE_OVERLAY */
+
+static void
+lcd_init(gui_lcd_t* lcd) {
+    GUI_UNUSED(lcd);
+}
+
+#if GUI_CFG_USE_BAND_RENDERING
+
+/**
+ * \brief           Copy finished band to frame buffer
+ * \param[in]       band: Band layer with position and size
+ */
+static void
+flush_band(gui_layer_t* band) {
+    const uint32_t* src = band->start_address;
+    uint32_t* dst = &frame_buffer[0][(size_t)band->y_pos * GUI_LL_RAM_WIDTH + band->x_pos];
+    gui_dim_t y;
+
+    for (y = 0; y < band->height; y++) {
+        memcpy(dst, src, (size_t)band->width * sizeof(*dst));
+        dst += GUI_LL_RAM_WIDTH;
+        src += band->width;
+    }
+    stat.bands++;
+    stat.pixels_flushed += (uint64_t)band->width * (uint64_t)band->height;
+    band->pending = 0;                              /* Transfer is synchronous */
+}
+
+#endif /* GUI_CFG_USE_BAND_RENDERING */
+
+/**
+ * \brief           Get frame buffer currently shown on virtual display
+ * \return          Pointer to `ARGB8888` frame buffer of `GUI_LL_RAM_WIDTH * GUI_LL_RAM_HEIGHT` pixels
+ */
+const uint32_t*
+gui_ll_ram_getframebuffer(void) {
+    return shown;
+}
+
+#if GUI_CFG_USE_OVERLAY || __DOXYGEN__
+
+/**
+ * \brief           Get layer currently shown on virtual overlay plane
+ * \param[in]       num: Plane number
+ * \param[out]      alpha: Pointer to output variable to save plane alpha. Can be set to `NULL`
+ * \return          Layer with plane content and position, `NULL` when plane is disabled
+ */
+const gui_layer_t*
+gui_ll_ram_getoverlay(uint8_t num, uint8_t* alpha) {
+    if (num >= LCD_OVERLAYS || overlays[num].layer == NULL) {
+        return NULL;
+    }
+    if (alpha != NULL) {
+        *alpha = overlays[num].alpha;
+    }
+    return overlays[num].layer;
+}
+
+#endif /* GUI_CFG_USE_OVERLAY || __DOXYGEN__ */
+
+/**
+ * \brief           Get driver statistics
+ * \param[out]      st: Pointer to output structure
+ * \param[in]       reset: Set to `1` to reset statistics after read
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_ll_ram_getstats(gui_ll_ram_stat_t* st, uint8_t reset) {
+    if (st == NULL) {
+        return 0;
+    }
+    gui_protect(1);
+    *st = stat;
+    if (reset) {
+        memset(&stat, 0x00, sizeof(stat));
+    }
+    gui_unprotect(1);
+    return 1;
+}
+
+/**
+ * \brief           Low-Level control function
+ */
+uint8_t
+gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result) {
+    switch (cmd) {
+        case GUI_LL_Command_Init: {
+            uint8_t i = 0;
+            gui_ll_t* LL = (gui_ll_t *)param;
+            static uint8_t heap[GUI_LL_RAM_HEAP_SIZE];
+            static gui_mem_region_t regions[] = {
+                {heap, sizeof(heap), 0}                 /* General purpose region for all allocation classes */
+            };
+            
+            gui_mem_assignmemory(regions, GUI_COUNT_OF(regions));
+            
+            LCD->width = GUI_LL_RAM_WIDTH;
+            LCD->height = GUI_LL_RAM_HEIGHT;
+            LCD->pixel_size = LCD_PIXEL_SIZE;
+            
+            LCD->layer_count = LCD_LAYERS;
+            LCD->layers = layers;
+            for (i = 0; i < LCD_LAYERS; i++) {
+                layers[i].num = i;
+                layers[i].pixel_format = GUI_PIXEL_FORMAT_ARGB8888;
+#if GUI_CFG_USE_BAND_RENDERING
+                layers[i].start_address = band_buffer[i];
+                layers[i].width = GUI_LL_RAM_WIDTH;
+                layers[i].height = BAND_LINES;
+#else /* GUI_CFG_USE_BAND_RENDERING */
+                layers[i].start_address = frame_buffer[i];
+#endif /* !GUI_CFG_USE_BAND_RENDERING */
+            }
+            
+            LL->Init = lcd_init;
+            gui_ll_sw_assign(LL);               /* Use software kernels for all drawing routines */
+            LL->IsReady = NULL;                 /* Kernels are synchronous */
+            
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;
+        }
+        case GUI_LL_Command_SetActiveLayer: {
+            gui_layer_t* layer = *(gui_layer_t **)param;
+            
+            shown = layer->start_address;
+            stat.frames++;
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            gui_lcd_confirmactivelayer(layer->num); /* Frame is shown immediately */
+            return 1;
+        }
+#if GUI_CFG_USE_BAND_RENDERING
+        case GUI_LL_Command_FlushBand: {
+            flush_band((gui_layer_t *)param);
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;
+        }
+#endif /* GUI_CFG_USE_BAND_RENDERING */
+#if GUI_CFG_USE_OVERLAY
+        case GUI_LL_Command_SetOverlay: {
+            const gui_overlay_t* ov = param;
+            
+            if (ov->num >= LCD_OVERLAYS) {
+                return 0;                       /* Plane does not exist */
+            }
+            overlays[ov->num] = *ov;            /* Plane is composited by reader of frame buffer */
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;
+        }
+#endif /* GUI_CFG_USE_OVERLAY */
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+        case GUI_LL_Command_GetLayerAccess: {
+            GUI_UNUSED(param);
+            ((gui_layer_access_t *)result)->fence = 0;  /* Kernels are synchronous, preset access is valid */
+            return 1;
+        }
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+        default:
+            return 0;
+    }
+}
+
+#endif /* !__DOXYGEN__ */
@@ -1,6 +1,9 @@
 /**	
  * \file            gui_ll_sdl_win32.c
  * \brief           Low-Level SDL implementation for WIN32
+ *
+ *                  Dirty regions of each frame are uploaded to streaming texture,
+ *                  presentation is synchronized to display refresh unless `GUI_LL_SDL_VSYNC` is `0`
  */
  
 /*
@@ -32,17 +35,44 @@
  * Version:         $_version_$
  */
 #include "system/gui_ll.h"
+#include "system/gui_ll_sw.h"
 #include "gui/gui_mem.h"
 #include "SDL.h"
 
 #if !__DOXYGEN__
 
-#define LCD_WIDTH                           800
-#define LCD_HEIGHT                          480
+#ifndef GUI_LL_SDL_WIDTH
+#define GUI_LL_SDL_WIDTH                    800
+#endif
+
+#ifndef GUI_LL_SDL_HEIGHT
+#define GUI_LL_SDL_HEIGHT                   480
+#endif
+
+#ifndef GUI_LL_SDL_HEAP_SIZE
+#define GUI_LL_SDL_HEAP_SIZE                0x100000
+#endif
+
+/*
+ * Set to `0` for automated tests, frames are presented
+ * as soon as they are drawn instead of on display refresh
+ */
+#ifndef GUI_LL_SDL_VSYNC
+#define GUI_LL_SDL_VSYNC                    1
+#endif
+
+#if GUI_CFG_USE_BAND_RENDERING || GUI_CFG_USE_DIRECT_RENDERING
+#error "SDL driver supports only layer rendering"
+#endif
+
 #define LCD_PIXEL_SIZE                      4
+#if GUI_CFG_USE_TRIPLE_BUFFERING
+#define LCD_LAYERS                          3
+#else /* GUI_CFG_USE_TRIPLE_BUFFERING */
 #define LCD_LAYERS                          2
+#endif /* !GUI_CFG_USE_TRIPLE_BUFFERING */
 
-static uint32_t frame_buffer[LCD_LAYERS][LCD_WIDTH * LCD_HEIGHT];
+static uint32_t frame_buffer[LCD_LAYERS][GUI_LL_SDL_WIDTH * GUI_LL_SDL_HEIGHT];
 
 static gui_layer_t layers[LCD_LAYERS];
 
@@ -50,10 +80,13 @@ static SDL_Window* window;
 static SDL_Renderer* renderer;
 static SDL_Texture* texture;
 static SDL_Event evt;
+static SDL_sem* sdl_sem;                    /* Signals new layer to present */
+static SDL_mutex* sdl_mutex;                /* Protects layer handover between threads */
+
+static gui_layer_t* sdl_layer;              /* Layer waiting to be presented */
+static uint8_t sdl_full = 1;                /* Set to `1` when whole texture must be uploaded */
 
 volatile static uint8_t sdl_initialized = 0;
-volatile static uint8_t sdl_refresh = 0;
-volatile static uint8_t sdl_quit = 0;
 
 static int sdl_thread(void * param);
 static int sdl_event_filter(void *userdata, SDL_Event * event);
@@ -62,11 +95,48 @@ static int my_mouse_evt(void);
 /**
  * \brief           Init SDL here
  */
-uint8_t
+static void
 lcd_init(gui_lcd_t* lcd) {
+    GUI_UNUSED(lcd);
+    sdl_sem = SDL_CreateSemaphore(0);
+    sdl_mutex = SDL_CreateMutex();
     SDL_CreateThread(sdl_thread, "SDL Thread", NULL);
     while (!sdl_initialized) {}
-    return 1;
+}
+
+/**
+ * \brief           Upload layer to streaming texture and present it
+ *
+ *                  Only regions drawn on layer in last redraw are uploaded,
+ *                  rest of texture still holds previous frame
+ *
+ * \param[in]       layer: Layer to present
+ * \param[in]       full: Set to `1` to upload whole layer
+ */
+static void
+sdl_present(gui_layer_t* layer, uint8_t full) {
+    const uint32_t* fb = layer->start_address;
+    const gui_display_t* d;
+    SDL_Rect r;
+    size_t i;
+
+    if (full || layer->regions_count == 0) {
+        SDL_UpdateTexture(texture, NULL, fb, GUI_LL_SDL_WIDTH * sizeof(uint32_t));
+    } else {
+        for (i = 0; i < layer->regions_count; i++) {
+            d = &layer->regions[i];
+            r.x = GUI_MAX(d->x1, 0);
+            r.y = GUI_MAX(d->y1, 0);
+            r.w = GUI_MIN(d->x2, GUI_LL_SDL_WIDTH) - r.x;
+            r.h = GUI_MIN(d->y2, GUI_LL_SDL_HEIGHT) - r.y;
+            if (r.w > 0 && r.h > 0) {
+                SDL_UpdateTexture(texture, &r, &fb[(size_t)r.y * GUI_LL_SDL_WIDTH + r.x], GUI_LL_SDL_WIDTH * sizeof(uint32_t));
+            }
+        }
+    }
+    SDL_RenderCopy(renderer, texture, NULL, NULL);
+    SDL_RenderPresent(renderer);
+    gui_lcd_confirmactivelayer(layer->num);     /* Layer memory may be drawn again */
 }
 
 /**
@@ -74,40 +144,44 @@ lcd_init(gui_lcd_t* lcd) {
  */
 static int
 sdl_thread(void* arg) {
+    gui_layer_t* layer;
+    uint8_t full;
+
     if (SDL_Init(SDL_INIT_VIDEO) < 0) {
         printf("SDL init problems: %s\r\n", SDL_GetError());
     }
     SDL_SetEventFilter(sdl_event_filter, NULL);
 
-    window = SDL_CreateWindow("PC Simulator", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, LCD_WIDTH, LCD_HEIGHT, 0);
-    renderer = SDL_CreateRenderer(window, -1, 0);
-    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, LCD_WIDTH, LCD_HEIGHT);
-
-    memset(frame_buffer[0], 0x7F, sizeof(frame_buffer[0]));
-    memset(frame_buffer[1], 0x7F, sizeof(frame_buffer[1]));
-    SDL_UpdateTexture(texture, NULL, frame_buffer[0], LCD_WIDTH * sizeof(uint32_t));
+    window = SDL_CreateWindow("PC Simulator", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, GUI_LL_SDL_WIDTH, GUI_LL_SDL_HEIGHT, 0);
+    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | (GUI_LL_SDL_VSYNC ? SDL_RENDERER_PRESENTVSYNC : 0));
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, GUI_LL_SDL_WIDTH, GUI_LL_SDL_HEIGHT);
 
-    sdl_refresh = 1;
     sdl_initialized = 1;
 
     while (1) {
-        if (sdl_refresh) {
-            sdl_refresh = 0;
-            SDL_UpdateTexture(texture, NULL, frame_buffer[0], LCD_WIDTH * sizeof(uint32_t));
-            SDL_RenderClear(renderer);
-            SDL_RenderCopy(renderer, texture, NULL, NULL);
-            SDL_RenderPresent(renderer);
+        SDL_SemWaitTimeout(sdl_sem, 10);        /* Wait for new frame, poll input meanwhile */
+
+        SDL_LockMutex(sdl_mutex);
+        layer = sdl_layer;
+        full = sdl_full;
+        sdl_layer = NULL;
+        if (layer != NULL) {
+            sdl_full = 0;
+        }
+        SDL_UnlockMutex(sdl_mutex);
+        if (layer != NULL) {
+            sdl_present(layer, full);
         }
 
         while (SDL_PollEvent(&evt)) {
             my_mouse_evt();
         }
-        SDL_Delay(30);
     }
     SDL_DestroyTexture(texture);
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
     SDL_Quit();
+    return 0;
 }
 
 static int 
@@ -117,7 +191,7 @@ sdl_event_filter(void* userdata, SDL_Event* evt) {
 
 static int
 my_mouse_evt(void) {
-    static is_down = 0;
+    static uint8_t is_down = 0;
     static gui_touch_data_t ts;
 
     switch (evt.type) {
@@ -163,80 +237,6 @@ my_mouse_evt(void) {
     return 0;
 }
 
-/**
- *
- */
-void
-lcd_fill(gui_lcd_t* LCD, gui_layer_t* layer, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t OffLine, gui_color_t color) {
-    gui_dim_t x, y;
-    gui_dim_t* addr = dst;
-
-    for (y = 0; y < ySize; y++) {
-        for (x = 0; x < xSize; x++) {
-            *addr++ = (uint32_t)color;
-        }
-        addr += OffLine;
-    }
-}
-
-/**
- *
- */
-void
-lcd_fillrect(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t xSize, gui_dim_t ySize, gui_color_t color) {
-    gui_dim_t xp, yp;
-    uint32_t* fb = layer->start_address;
-
-    for (yp = 0; yp < ySize; yp++) {
-        for (xp = 0; xp < xSize; xp++) {
-            fb[(y + yp) * layer->width + (x + xp)] = (uint32_t)color;
-        }
-    }
-}
-
-/**
- * \brief           Copy from source to destination
- */
-void
-lcd_copy(gui_lcd_t* LCD, gui_layer_t* layer, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
-    gui_dim_t y;
-    const uint32_t* s = src;
-    uint32_t* d = dst;
-
-    for (y = 0; y < ySize; y++) {
-        memcpy(d, s, sizeof(uint32_t) * xSize);
-        s += xSize + offLineSrc;
-        d += xSize + offLineDst;
-    }
-}
-
-void
-lcd_drawhline(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
-    lcd_fillrect(LCD, layer, x, y, length, 1, color);
-}
-
-void
-lcd_drawvline(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
-    lcd_fillrect(LCD, layer, x, y, 1, length, color);
-}
-
-void
-lcd_setpixel(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_color_t color) {
-    uint32_t* fb = layer->start_address;
-    fb[y * layer->width + x] = (uint32_t)color;
-}
-
-gui_color_t
-lcd_getpixel(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y) {
-    uint32_t* fb = layer->start_address;
-    return fb[y * layer->width + x];
-}
-
-uint8_t
-lcd_ready(gui_lcd_t* LCD) {
-    return 1;
-}
-
 /**
  * \brief           Low-Level control function
  */
@@ -246,9 +246,9 @@ gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result)
         case GUI_LL_Command_Init: {
             uint8_t i = 0;
             gui_ll_t* LL = (gui_ll_t *)param;
-            static big_array[0x100000];
+            static uint8_t heap[GUI_LL_SDL_HEAP_SIZE];
             static gui_mem_region_t regions[] = {
-                {big_array, sizeof(big_array)}
+                {heap, sizeof(heap), 0}                 /* General purpose region for all allocation classes */
             };
             
             /*******************************/
@@ -259,38 +259,27 @@ gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result)
             /*******************************/
             /* Set up LCD data             */
             /*******************************/
-            LCD->width = LCD_WIDTH;
-            LCD->height = LCD_HEIGHT;
+            LCD->width = GUI_LL_SDL_WIDTH;
+            LCD->height = GUI_LL_SDL_HEIGHT;
             LCD->pixel_size = LCD_PIXEL_SIZE;
             
             /*******************************/
             /* Set layers count            */
             /*******************************/
-            LCD->layer_count = 2;               /* We have 2 layers for our low-level driver */
+            LCD->layer_count = LCD_LAYERS;
             LCD->layers = layers;
             for (i = 0; i < LCD_LAYERS; i++) {  /* Set each layer */
                 layers[i].num = i;
-                layers[i].start_address = &frame_buffer[0];
+                layers[i].pixel_format = GUI_PIXEL_FORMAT_ARGB8888;
+                layers[i].start_address = frame_buffer[i];
             }
             
             /*******************************/
             /* Set up LCD drawing routines */
             /*******************************/
             LL->Init = lcd_init;                /* Must be set by user */
-            LL->GetPixel = lcd_getpixel;        /* Must be set by user */
-            LL->SetPixel = lcd_setpixel;        /* Must be set by user */
-            //
-            LL->IsReady = lcd_ready;            /* Set is ready function to indicate low-level layer has finished any transmission */
-            LL->Copy = lcd_copy;                /* Set copy memory routine */
-            LL->DrawHLine = lcd_drawhline;      /* Set drawing vertical line routine */
-            LL->DrawVLine = lcd_drawvline;      /* Set drawing horizontal line routine */
-            LL->Fill = lcd_fill;                /* Set fill screen routine */
-            LL->FillRect = lcd_fillrect;        /* Set fill rectangle routine */
-            //LL->CopyBlend = LCD_CopyBlending;   /* Set copy with blending */
-            //LL->DrawImage16 = LCD_DrawImage16;  /* Set draw function for 24bit image (RGB565) format */
-            //LL->DrawImage24 = LCD_DrawImage24;  /* Set draw function for 24bit image (RGB888) format */
-            //LL->DrawImage32 = LCD_DrawImage32;  /* Set draw function for 32bit image (ARGB8888/ABGR8888) format */
-            //LL->CopyChar = LCD_CopyChar;        /* Set draw function for char copy with alpha information */
+            gui_ll_sw_assign(LL);               /* Use software kernels for all drawing routines */
+            LL->IsReady = NULL;                 /* Kernels are synchronous */
             
             if (result != NULL) {
                 *(uint8_t *)result = 0;         /* Successful initialization */
@@ -299,14 +288,19 @@ gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result)
             return 1;                           /* Command processed */
         }
         case GUI_LL_Command_SetActiveLayer: {   /* Set new active layer */
-            uint8_t layer = *(uint8_t *)param;  /* Read layer as byte */
-            LCD->layers[layer].pending = 0;     /* Set layer as pending and redraw on next reload */
+            gui_layer_t* layer = *(gui_layer_t **)param;
 
-            if (result) {
+            SDL_LockMutex(sdl_mutex);
+            if (sdl_layer != NULL) {            /* Previous layer was not presented, its regions are lost */
+                sdl_full = 1;
+            }
+            sdl_layer = layer;
+            SDL_UnlockMutex(sdl_mutex);
+            SDL_SemPost(sdl_sem);               /* Layer is confirmed after it is presented */
+
+            if (result != NULL) {
                 *(uint8_t *)result = 0;         /* Successful layer set as active */
             }
-            sdl_refresh = 1;
-            gui_lcd_confirmactivelayer(layer);  /* Confirm use of new layer */
             return 1;                           /* Command processed */
         }
         default:
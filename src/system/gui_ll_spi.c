@@ -0,0 +1,219 @@
+/**	
+ * \file            gui_ll_spi.c
+ * \brief           Low-level driver for command based display controllers
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#include "system/gui_ll.h"
+#include "system/gui_ll_sw.h"
+#include "system/gui_ll_spi.h"
+#include "gui/gui_mem.h"
+
+#if !__DOXYGEN__
+
+#ifndef GUI_LL_SPI_WIDTH
+#define GUI_LL_SPI_WIDTH                    240
+#endif
+
+#ifndef GUI_LL_SPI_HEIGHT
+#define GUI_LL_SPI_HEIGHT                   320
+#endif
+
+/* Number of display lines in each band buffer */
+#ifndef GUI_LL_SPI_BAND_LINES
+#define GUI_LL_SPI_BAND_LINES               20
+#endif
+
+/* Set to `1` to render and transfer bands in turns without overlap, halves band memory */
+#ifndef GUI_LL_SPI_SINGLE_BAND
+#define GUI_LL_SPI_SINGLE_BAND              0
+#endif
+
+/* Memory access control parameter, sets rotation and RGB/BGR order of panel */
+#ifndef GUI_LL_SPI_MADCTL
+#define GUI_LL_SPI_MADCTL                   0x08
+#endif
+
+#ifndef GUI_LL_SPI_HEAP_SIZE
+#define GUI_LL_SPI_HEAP_SIZE                0x4000
+#endif
+
+#if !GUI_CFG_USE_BAND_RENDERING
+#error "Command based display driver requires GUI_CFG_USE_BAND_RENDERING"
+#endif
+
+/* MIPI DCS commands */
+#define DCS_SOFT_RESET                      0x01
+#define DCS_EXIT_SLEEP_MODE                 0x11
+#define DCS_SET_DISPLAY_ON                  0x29
+#define DCS_SET_COLUMN_ADDRESS              0x2A
+#define DCS_SET_PAGE_ADDRESS                0x2B
+#define DCS_WRITE_MEMORY_START              0x2C
+#define DCS_SET_ADDRESS_MODE                0x36
+#define DCS_SET_PIXEL_FORMAT                0x3A
+
+#define LCD_PIXEL_SIZE                      2
+#if GUI_LL_SPI_SINGLE_BAND
+#define LCD_BANDS                           1
+#else /* GUI_LL_SPI_SINGLE_BAND */
+#define LCD_BANDS                           2
+#endif /* !GUI_LL_SPI_SINGLE_BAND */
+
+static uint16_t band_buffer[LCD_BANDS][GUI_LL_SPI_WIDTH * GUI_LL_SPI_BAND_LINES];
+static gui_layer_t layers[LCD_BANDS];
+static gui_layer_t* volatile transfer;      /* Band currently transferred by DMA, `NULL` when bus is free */
+
+/**
+ * \brief           Send controller init sequence
+ */
+static void
+lcd_init(gui_lcd_t* lcd) {
+    uint8_t param;
+    
+    GUI_UNUSED(lcd);
+    gui_ll_spi_board_cmd(DCS_SOFT_RESET, NULL, 0);
+    gui_ll_spi_board_delay(120);
+    gui_ll_spi_board_cmd(DCS_EXIT_SLEEP_MODE, NULL, 0);
+    gui_ll_spi_board_delay(120);
+    param = 0x55;                           /* 16-bit pixels on both interfaces */
+    gui_ll_spi_board_cmd(DCS_SET_PIXEL_FORMAT, &param, 1);
+    param = GUI_LL_SPI_MADCTL;
+    gui_ll_spi_board_cmd(DCS_SET_ADDRESS_MODE, &param, 1);
+    gui_ll_spi_board_cmd(DCS_SET_DISPLAY_ON, NULL, 0);
+}
+
+/**
+ * \brief           Set start and end address of display window on one axis
+ * \param[in]       cmd: Column or page address command
+ * \param[in]       start: First column or page
+ * \param[in]       end: Last column or page, included in window
+ */
+static void
+set_address(uint8_t cmd, gui_dim_t start, gui_dim_t end) {
+    uint8_t data[4];
+    
+    data[0] = (uint8_t)(start >> 8);
+    data[1] = (uint8_t)start;
+    data[2] = (uint8_t)(end >> 8);
+    data[3] = (uint8_t)end;
+    gui_ll_spi_board_cmd(cmd, data, sizeof(data));
+}
+
+/**
+ * \brief           Send band to display window
+ * \param[in]       band: Band layer with position and size
+ */
+static void
+flush_band(gui_layer_t* band) {
+    while (transfer != NULL) {}             /* Bus is shared, previous band must be sent before window changes */
+    
+    set_address(DCS_SET_COLUMN_ADDRESS, band->x_pos, band->x_pos + band->width - 1);
+    set_address(DCS_SET_PAGE_ADDRESS, band->y_pos, band->y_pos + band->height - 1);
+    gui_ll_spi_board_cmd(DCS_WRITE_MEMORY_START, NULL, 0);
+    
+    transfer = band;
+    gui_ll_spi_board_data(band->start_address, (size_t)band->width * (size_t)band->height);
+#if LCD_BANDS == 1
+    while (transfer != NULL) {}             /* Band memory is reused after return */
+#endif /* LCD_BANDS == 1 */
+}
+
+/**
+ * \brief           Notify driver that DMA transfer of pixel data is finished
+ * \note            Function may be called from interrupt context
+ */
+void
+gui_ll_spi_transfer_done(void) {
+    gui_layer_t* band = transfer;
+    
+    if (band != NULL) {
+        transfer = NULL;
+        band->pending = 0;                  /* Band memory can be drawn again */
+    }
+}
+
+/**
+ * \brief           Low-Level control function
+ */
+uint8_t
+gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result) {
+    switch (cmd) {
+        case GUI_LL_Command_Init: {
+            uint8_t i = 0;
+            gui_ll_t* LL = (gui_ll_t *)param;
+            static uint8_t heap[GUI_LL_SPI_HEAP_SIZE];
+            static gui_mem_region_t regions[] = {
+                {heap, sizeof(heap), 0}                 /* General purpose region for all allocation classes */
+            };
+            
+            if (!gui_ll_spi_board_init()) {
+                if (result != NULL) {
+                    *(uint8_t *)result = 1;
+                }
+                return 1;
+            }
+            gui_mem_assignmemory(regions, GUI_COUNT_OF(regions));
+            
+            LCD->width = GUI_LL_SPI_WIDTH;
+            LCD->height = GUI_LL_SPI_HEIGHT;
+            LCD->pixel_size = LCD_PIXEL_SIZE;
+            
+            LCD->layer_count = LCD_BANDS;
+            LCD->layers = layers;
+            for (i = 0; i < LCD_BANDS; i++) {
+                layers[i].num = i;
+                layers[i].pixel_format = GUI_PIXEL_FORMAT_RGB565;
+                layers[i].start_address = band_buffer[i];
+                layers[i].width = GUI_LL_SPI_WIDTH;
+                layers[i].height = GUI_LL_SPI_BAND_LINES;
+            }
+            
+            LL->Init = lcd_init;
+            gui_ll_sw_assign(LL);               /* Use software kernels for all drawing routines */
+            LL->IsReady = NULL;                 /* Kernels are synchronous */
+            
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;
+        }
+        case GUI_LL_Command_FlushBand: {
+            flush_band((gui_layer_t *)param);
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;
+        }
+        default:
+            return 0;
+    }
+}
+
+#endif /* !__DOXYGEN__ */
@@ -43,11 +43,108 @@ gui_layer_t Layers[GUI_LAYERS];
 static DMA2D_HandleTypeDef DMA2DHandle;
 uint16_t startAddress;
 
-#define DMA2D_START(type) do {                  \
-    DMA2D->CR = (type);                         \
-    DMA2D->CR |= 0 | 0;             \
-    DMA2D->CR |= DMA2D_CR_START;                /* Start the transmission */\
-} while (0)
+/* Hardware JPEG codec and DMA2D YCbCr input are available on STM32F76x/F77x */
+#if GUI_CFG_USE_IMAGE_CACHE && GUI_CFG_USE_IMAGE_COMPRESSION && defined(HAL_JPEG_MODULE_ENABLED) && defined(DMA2D_FGPFCCR_CSS)
+#define LCD_USE_JPEG                    1
+static JPEG_HandleTypeDef JPEGHandle;
+#else
+#define LCD_USE_JPEG                    0
+#endif
+
+/**
+ * \brief           Number of DMA2D jobs which can wait in queue for execution
+ */
+#ifndef DMA2D_QUEUE_SIZE
+#define DMA2D_QUEUE_SIZE                32
+#endif
+
+/**
+ * \brief           Single DMA2D job with register values to program on start
+ */
+typedef struct {
+    uint32_t cr;                                /*!< Transfer mode */
+    uint32_t fgmar;                             /*!< Foreground memory address */
+    uint32_t bgmar;                             /*!< Background memory address */
+    uint32_t omar;                              /*!< Output memory address */
+    uint32_t fgor;                              /*!< Foreground line offset */
+    uint32_t bgor;                              /*!< Background line offset */
+    uint32_t oor;                               /*!< Output line offset */
+    uint32_t fgpfccr;                           /*!< Foreground pixel format and alpha */
+    uint32_t bgpfccr;                           /*!< Background pixel format and alpha */
+    uint32_t opfccr;                            /*!< Output pixel format */
+    uint32_t fgcolr;                            /*!< Foreground color for A8/A4 input */
+    uint32_t ocolr;                             /*!< Output color for register to memory mode */
+    uint32_t nlr;                               /*!< Number of pixels per line and number of lines */
+    uint32_t fgcmar;                            /*!< Foreground CLUT memory address for CLUT load job */
+} dma2d_cmd_t;
+
+/* Job type for loading foreground CLUT, value does not match any transfer mode */
+#define DMA2D_CLUT_LOAD                 0xFFFFFFFFUL
+
+static dma2d_cmd_t dma2d_queue[DMA2D_QUEUE_SIZE];
+static volatile size_t dma2d_queue_in, dma2d_queue_out;
+static volatile uint8_t dma2d_busy;
+
+/* Palette and its size and color mode in CLUT, compared when queuing jobs */
+static const void* dma2d_clut;
+static uint32_t dma2d_clut_cfg;
+
+/* Program and start DMA2D job */
+static void
+dma2d_start(const dma2d_cmd_t* cmd) {
+    if (cmd->cr == DMA2D_CLUT_LOAD) {           /* Copy palette to CLUT memory */
+        DMA2D->FGCMAR = cmd->fgcmar;
+        DMA2D->FGPFCCR = cmd->fgpfccr;
+        DMA2D->CR = DMA2D_CR_CTCIE | DMA2D_CR_CAEIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE;
+        DMA2D->FGPFCCR |= DMA2D_FGPFCCR_START;  /* Start automatic CLUT loading */
+        return;
+    }
+    DMA2D->FGMAR = cmd->fgmar;
+    DMA2D->BGMAR = cmd->bgmar;
+    DMA2D->OMAR = cmd->omar;
+    DMA2D->FGOR = cmd->fgor;
+    DMA2D->BGOR = cmd->bgor;
+    DMA2D->OOR = cmd->oor;
+    DMA2D->FGPFCCR = cmd->fgpfccr;
+    DMA2D->BGPFCCR = cmd->bgpfccr;
+    DMA2D->OPFCCR = cmd->opfccr;
+    DMA2D->FGCOLR = cmd->fgcolr;
+    DMA2D->OCOLR = cmd->ocolr;
+    DMA2D->NLR = cmd->nlr;
+    DMA2D->CR = cmd->cr | DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE;    /* Enable transfer interrupts */
+    DMA2D->CR |= DMA2D_CR_START;                /* Start the transmission */
+}
+
+/* Get free job entry at the end of queue, wait if queue is full */
+static dma2d_cmd_t*
+dma2d_alloc(void) {
+    dma2d_cmd_t* cmd;
+    
+    while (((dma2d_queue_in + 1) % DMA2D_QUEUE_SIZE) == dma2d_queue_out);   /* Wait for free entry */
+    cmd = &dma2d_queue[dma2d_queue_in];
+    memset(cmd, 0x00, sizeof(*cmd));
+    return cmd;
+}
+
+/* Put job allocated with dma2d_alloc to queue and start it if DMA2D is idle */
+static void
+dma2d_submit(dma2d_cmd_t* cmd, uint32_t type) {
+    cmd->cr = type;
+    
+    NVIC_DisableIRQ(DMA2D_IRQn);                /* Protect against interrupt starting next job */
+    dma2d_queue_in = (dma2d_queue_in + 1) % DMA2D_QUEUE_SIZE;
+    if (!dma2d_busy) {                          /* Start job immediately if nothing is in progress */
+        dma2d_busy = 1;
+        dma2d_start(&dma2d_queue[dma2d_queue_out]);
+    }
+    NVIC_EnableIRQ(DMA2D_IRQn);
+}
+
+/* Wait until all queued DMA2D jobs are finished */
+static void
+dma2d_fence(void) {
+    while (dma2d_busy || dma2d_queue_in != dma2d_queue_out);
+}
 
 static
 void LCD_Init(gui_lcd_t* LCD) {
@@ -58,242 +155,466 @@ void LCD_Init(gui_lcd_t* LCD) {
     _LCD_Init();                                    /* Init LCD */
 }
 
+#if GUI_CFG_USE_OVERLAY
+
+extern LTDC_HandleTypeDef LTDCHandle;
+
+/* Show overlay on LTDC layer 2 above main frame buffer, window is clipped to screen */
+static void
+LCD_SetOverlay(const gui_overlay_t* ov) {
+    LTDC_LayerCfgTypeDef cfg = {0};
+    const gui_layer_t* layer = ov->layer;
+    gui_dim_t x1, y1, x2, y2;
+    
+    if (layer != NULL) {
+        x1 = GUI_MAX(layer->x_pos, 0);
+        y1 = GUI_MAX(layer->y_pos, 0);
+        x2 = GUI_MIN(layer->x_pos + layer->width, LCD_WIDTH);
+        y2 = GUI_MIN(layer->y_pos + layer->height, LCD_HEIGHT);
+    }
+    if (layer == NULL || x1 >= x2 || y1 >= y2) {
+        LTDC_Layer2->CR &= ~LTDC_LxCR_LEN;      /* Disable plane */
+    } else {
+        cfg.WindowX0 = x1;
+        cfg.WindowX1 = x2;
+        cfg.WindowY0 = y1;
+        cfg.WindowY1 = y2;
+        cfg.PixelFormat = layer->pixel_format == GUI_PIXEL_FORMAT_RGB565 ? LTDC_PIXEL_FORMAT_RGB565 : LTDC_PIXEL_FORMAT_ARGB8888;
+        cfg.FBStartAdress = (uint32_t)layer->start_address
+            + LCD_PIXEL_SIZE * ((y1 - layer->y_pos) * layer->width + (x1 - layer->x_pos));
+        cfg.Alpha = ov->alpha;
+        cfg.Alpha0 = 0;
+        cfg.BlendingFactor1 = LTDC_BLENDING_FACTOR1_PAxCA;
+        cfg.BlendingFactor2 = LTDC_BLENDING_FACTOR2_PAxCA;
+        cfg.ImageWidth = layer->width;          /* Line pitch of plane buffer */
+        cfg.ImageHeight = y2 - y1;
+        HAL_LTDC_ConfigLayer_NoReload(&LTDCHandle, &cfg, 1);
+    }
+    LTDC->SRCR = LTDC_SRCR_VBR;                 /* Apply new setup in vertical blanking */
+}
+
+#endif /* GUI_CFG_USE_OVERLAY */
+
 static
 uint32_t GetPixelFormat(gui_layer_t* layer) {
-#if defined(LCD_COLOR_FORMAT_ARGB8888)
+    if (layer->pixel_format == GUI_PIXEL_FORMAT_RGB565) {
+        return DMA2D_OUTPUT_RGB565;                 /* RGB565 format */
+    }
     return DMA2D_OUTPUT_ARGB8888;                   /* ARGB8888 format */
-#else
-    return DMA2D_OUTPUT_RGB565;                     /* RGB565 format */
-#endif /* defined(LCD_COLOR_FORMAT_ARGB8888) */
+}
+
+/* Get number of bytes per pixel of layer */
+static
+uint32_t GetPixelSize(gui_layer_t* layer) {
+    return layer->pixel_format == GUI_PIXEL_FORMAT_RGB565 ? 2 : 4;
 }
 
 static
 uint8_t LCD_Ready(gui_lcd_t* LCD) {
-    return !(DMA2D->CR & DMA2D_CR_START);           /* Return status */
+    return !dma2d_busy && dma2d_queue_in == dma2d_queue_out;    /* Ready when all jobs are finished */
 }
 
+/*
+ * Read pixel with CPU after fence.
+ * Starting PFC transfer for single pixel costs much more than converting it in software.
+ */
 static
 gui_color_t LCD_GetPixel(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y) {
-#if defined(LCD_COLOR_FORMAT_ARGB8888)
-    return *(gui_color_t *)((uint32_t)layer->start_address + GUI.lcd.pixel_size * (layer->width * y + x));
-#else
-    gui_color_t color;
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait till end */
-    
-    DMA2D->FGMAR = (uint32_t)(layer->start_address + GUI.lcd.pixel_size * (layer->width * y + x));
-    DMA2D->OMAR = (uint32_t)&color;                 /* Set output address */
-    DMA2D->FGOR = 0;                                /* Set foreground offline */    
-    DMA2D->OOR = 0;                                 /* Set output offline */
-    DMA2D->FGPFCCR = GetPixelFormat(layer);         /* Get source pixel format */
-    DMA2D->OPFCCR = LTDC_PIXEL_FORMAT_ARGB8888;     /* Set output pixel format */
-    DMA2D->NLR = (uint32_t)(1 << 16) | (uint16_t)1; /* Set X and Y */
-
-    DMA2D_START(DMA2D_M2M_PFC);                     /* Start DMA2D transfer */
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait till end */
-    return 0xFF000000UL | color;
-#endif /* defined(LCD_COLOR_FORMAT_ARGB8888) */
+    const void* addr = (const void *)((uint32_t)layer->start_address + GetPixelSize(layer) * (layer->width * y + x));
+    
+    dma2d_fence();                                  /* Make sure all drawings are finished before reading memory */
+    if (layer->pixel_format == GUI_PIXEL_FORMAT_RGB565) {
+        return GUI_COLOR_FROM_RGB565(*(const uint16_t *)addr);
+    }
+    return *(const gui_color_t *)addr;
 }
 
 static
 void LCD_Fill(gui_lcd_t* LCD, gui_layer_t* layer, void* dst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t OffLine, gui_color_t color) {
-#if LCD_PIXEL_SIZE == 2
-    uint8_t r, g, b;
-//    r = (color >> 20) & 0x0F;
-//    g = (color >> 12) & 0x0F;
-//    b = (color >>  4) & 0x0F;
-//    color = 0x0000F000UL | (r << 8) | (g << 4) | b;
-    r = (color >> 19) & 0x1F;
-    g = (color >> 10) & 0x3F;
-    b = (color >>  3) & 0x1F;
-    color = 0x00000000UL | (r << 11) | (g << 5) | b;
-#endif
+    dma2d_cmd_t* cmd;
+    
+    if (layer->pixel_format == GUI_PIXEL_FORMAT_RGB565) {
+        color = GUI_COLOR_TO_RGB565(color);         /* Register color is in output format */
+    }
     if (!xSize || !ySize) {
         return;
     }
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->OCOLR = color;                           /* Color to be used */
-    DMA2D->OMAR = (uint32_t)dst;                    /* Destination address */
-    DMA2D->OOR = OffLine;                           /* Destination line offset */
-    DMA2D->OPFCCR = GetPixelFormat(layer);          /* Defines the number of pixels to be transfered */
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize; /* Size configuration of area to be transfered */
-    
-    DMA2D_START(DMA2D_R2M);                         /* Start DMA2D transfer */
+    cmd = dma2d_alloc();
+    cmd->ocolr = color;                             /* Color to be used */
+    cmd->omar = (uint32_t)dst;                      /* Destination address */
+    cmd->oor = OffLine;                             /* Destination line offset */
+    cmd->opfccr = GetPixelFormat(layer);            /* Defines the number of pixels to be transfered */
+    cmd->nlr = (uint32_t)(xSize << 16) | (uint16_t)ySize;   /* Size configuration of area to be transfered */
+    
+    dma2d_submit(cmd, DMA2D_R2M);                   /* Queue DMA2D transfer */
 }
 
 static
 void LCD_Copy(gui_lcd_t* LCD, gui_layer_t* layer, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
     uint32_t PixelFormat = GetPixelFormat(layer);
+    dma2d_cmd_t* cmd;
     
     if (!xSize || !ySize) {
         return;
     }
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->FGMAR = (uint32_t)src;
-    DMA2D->BGMAR = (uint32_t)dst;
-    DMA2D->OMAR = (uint32_t)dst;
-    DMA2D->FGOR = offLineSrc;
-    DMA2D->BGOR = offLineDst;
-    DMA2D->OOR = offLineDst;
-    DMA2D->FGPFCCR = PixelFormat;
-    DMA2D->BGPFCCR = PixelFormat;
-    DMA2D->OPFCCR = PixelFormat;
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize;
-    
-    DMA2D_START(DMA2D_M2M);                         /* Start DMA2D transfer */
+    cmd = dma2d_alloc();
+    cmd->fgmar = (uint32_t)src;
+    cmd->bgmar = (uint32_t)dst;
+    cmd->omar = (uint32_t)dst;
+    cmd->fgor = offLineSrc;
+    cmd->bgor = offLineDst;
+    cmd->oor = offLineDst;
+    cmd->fgpfccr = PixelFormat;
+    cmd->bgpfccr = PixelFormat;
+    cmd->opfccr = PixelFormat;
+    cmd->nlr = (uint32_t)(xSize << 16) | (uint16_t)ySize;
+    
+    dma2d_submit(cmd, DMA2D_M2M);                   /* Queue DMA2D transfer */
 }
 
 /* Copy layers with blending with alpha combine */
 static
 void LCD_CopyBlending(gui_lcd_t* LCD, gui_layer_t* layer, void* dst, const void* src, uint8_t alphaSrc, uint8_t alphaDst, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
     uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->FGMAR = (uint32_t)src;
-    DMA2D->BGMAR = (uint32_t)dst;                       
-    DMA2D->OMAR = (uint32_t)dst;
-    DMA2D->FGOR = offLineSrc;
-    DMA2D->BGOR = offLineDst;
-    DMA2D->OOR = offLineDst;
-    DMA2D->FGPFCCR = PixelFormat;                   /* Foreground PFC Control Register */
-    DMA2D->BGPFCCR = PixelFormat;                   /* Background PFC Control Register (Defines the BG pixel format) */
-    DMA2D->OPFCCR  = PixelFormat;                   /* Output     PFC Control Register (Defines the output pixel format) */
-    
-    DMA2D->FGPFCCR |= DMA2D_FGPFCCR_AM_0 | alphaSrc << 24;               /* Set alpha for source */
-    DMA2D->BGPFCCR |= alphaDst << 24;               /* Set alpha for destination */
-    
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize;
-    
-    DMA2D_START(DMA2D_M2M_BLEND);                   /* Start DMA2D transfer */
+    dma2d_cmd_t* cmd = dma2d_alloc();
+    
+    cmd->fgmar = (uint32_t)src;
+    cmd->bgmar = (uint32_t)dst;                       
+    cmd->omar = (uint32_t)dst;
+    cmd->fgor = offLineSrc;
+    cmd->bgor = offLineDst;
+    cmd->oor = offLineDst;
+    cmd->fgpfccr = PixelFormat;                     /* Foreground PFC Control Register */
+    cmd->bgpfccr = PixelFormat;                     /* Background PFC Control Register (Defines the BG pixel format) */
+    cmd->opfccr  = PixelFormat;                     /* Output     PFC Control Register (Defines the output pixel format) */
+    
+    cmd->fgpfccr |= DMA2D_FGPFCCR_AM_0 | alphaSrc << 24;   /* Set alpha for source */
+    cmd->bgpfccr |= alphaDst << 24;                 /* Set alpha for destination */
+    
+    cmd->nlr = (uint32_t)(xSize << 16) | (uint16_t)ySize;
+    
+    dma2d_submit(cmd, DMA2D_M2M_BLEND);             /* Queue DMA2D transfer */
 }
 
 static
 void LCD_DrawImage16(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
     uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
+    dma2d_cmd_t* cmd;
+    
     if (!xSize || !ySize) {
         return;
     }
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->FGMAR = (uint32_t)src;
-    DMA2D->BGMAR = (uint32_t)dst;                       
-    DMA2D->OMAR = (uint32_t)dst;
-    DMA2D->FGOR = offLineSrc;
-    DMA2D->BGOR = offLineDst;
-    DMA2D->OOR = offLineDst;
-    DMA2D->FGPFCCR = DMA2D_INPUT_RGB565;            /* Foreground PFC Control Register */
-    DMA2D->BGPFCCR = PixelFormat;                   /* Background PFC Control Register (Defines the BG pixel format) */
-    DMA2D->OPFCCR  = PixelFormat;                   /* Output     PFC Control Register (Defines the output pixel format) */
+    cmd = dma2d_alloc();
+    cmd->fgmar = (uint32_t)src;
+    cmd->omar = (uint32_t)dst;
+    cmd->fgor = offLineSrc;
+    cmd->oor = offLineDst;
+    cmd->fgpfccr = DMA2D_INPUT_RGB565;              /* Foreground PFC Control Register */
+    cmd->opfccr  = PixelFormat;                     /* Output     PFC Control Register (Defines the output pixel format) */
     
     /* Enable invert alpha and swap R and B values with hardware */
 #if defined(DMA2D_FGPFCCR_AI) && defined(DMA2D_FGPFCCR_RBS)
-    DMA2D->FGPFCCR |= DMA2D_FGPFCCR_RBS;
+    cmd->fgpfccr |= DMA2D_FGPFCCR_RBS;
 #endif  /* defined(DMA2D_FGPFCCR_AM_1) */
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize; 
+    cmd->nlr = (uint32_t)(xSize << 16) | (uint16_t)ySize; 
     
-    DMA2D_START(DMA2D_M2M_BLEND);                   /* Start DMA2D transfer */
+    dma2d_submit(cmd, DMA2D_M2M_PFC);               /* Opaque source, copy with conversion */
 }
 
 static
 void LCD_DrawImage24(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
     uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->FGMAR = (uint32_t)src;
-    DMA2D->BGMAR = (uint32_t)dst;                       
-    DMA2D->OMAR = (uint32_t)dst;
-    DMA2D->FGOR = offLineSrc;
-    DMA2D->BGOR = offLineDst;
-    DMA2D->OOR = offLineDst;
-    DMA2D->FGPFCCR = DMA2D_INPUT_RGB888;            /* Foreground PFC Control Register */
-    DMA2D->BGPFCCR = PixelFormat;                   /* Background PFC Control Register (Defines the BG pixel format) */
-    DMA2D->OPFCCR  = PixelFormat;                   /* Output     PFC Control Register (Defines the output pixel format) */
+    dma2d_cmd_t* cmd = dma2d_alloc();
+    
+    cmd->fgmar = (uint32_t)src;
+    cmd->omar = (uint32_t)dst;
+    cmd->fgor = offLineSrc;
+    cmd->oor = offLineDst;
+    cmd->fgpfccr = DMA2D_INPUT_RGB888;              /* Foreground PFC Control Register */
+    cmd->opfccr  = PixelFormat;                     /* Output     PFC Control Register (Defines the output pixel format) */
     
     /* Enable invert alpha and swap R and B values with hardware */
 #if defined(DMA2D_FGPFCCR_RBS)
-    DMA2D->FGPFCCR |= DMA2D_FGPFCCR_RBS;
+    cmd->fgpfccr |= DMA2D_FGPFCCR_RBS;
 #endif  /* defined(DMA2D_FGPFCCR_AM_1) */
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize;
+    cmd->nlr = (uint32_t)(xSize << 16) | (uint16_t)ySize;
     
-    DMA2D_START(DMA2D_M2M_BLEND);                   /* Start DMA2D transfer */
+    dma2d_submit(cmd, DMA2D_M2M_PFC);               /* Opaque source, copy with conversion */
 }
 
 static
 void LCD_DrawImage32(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
     uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->FGMAR = (uint32_t)src;
-    DMA2D->BGMAR = (uint32_t)dst;                       
-    DMA2D->OMAR = (uint32_t)dst;
-    DMA2D->FGOR = offLineSrc;
-    DMA2D->BGOR = offLineDst;
-    DMA2D->OOR = offLineDst;
-    DMA2D->FGPFCCR = DMA2D_INPUT_ARGB8888;          /* Foreground PFC Control Register */
-    DMA2D->BGPFCCR = PixelFormat;                   /* Background PFC Control Register (Defines the BG pixel format) */
-    DMA2D->OPFCCR  = PixelFormat;                   /* Output     PFC Control Register (Defines the output pixel format) */
+    dma2d_cmd_t* cmd = dma2d_alloc();
+    
+    cmd->fgmar = (uint32_t)src;
+    cmd->bgmar = (uint32_t)dst;                       
+    cmd->omar = (uint32_t)dst;
+    cmd->fgor = offLineSrc;
+    cmd->bgor = offLineDst;
+    cmd->oor = offLineDst;
+    cmd->fgpfccr = DMA2D_INPUT_ARGB8888;            /* Foreground PFC Control Register */
+    cmd->bgpfccr = PixelFormat;                     /* Background PFC Control Register (Defines the BG pixel format) */
+    cmd->opfccr  = PixelFormat;                     /* Output     PFC Control Register (Defines the output pixel format) */
     
     /* Enable invert alpha and swap R and B values with hardware */
 #if defined(DMA2D_FGPFCCR_AI) && defined(DMA2D_FGPFCCR_RBS)
-    DMA2D->FGPFCCR |= DMA2D_FGPFCCR_AI | DMA2D_FGPFCCR_RBS;
+    cmd->fgpfccr |= DMA2D_FGPFCCR_AI | DMA2D_FGPFCCR_RBS;
 #endif  /* defined(DMA2D_FGPFCCR_AM_1) */
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize;
+    cmd->nlr = (uint32_t)(xSize << 16) | (uint16_t)ySize;
+    
+    /*
+     * Opaque images do not need background read, blend only when alpha is used.
+     * DMA2D blends straight alpha only, image must not be premultiplied
+     */
+    dma2d_submit(cmd, (img->flags & GUI_FLAG_IMAGE_OPAQUE) ? DMA2D_M2M_PFC : DMA2D_M2M_BLEND);
+}
+
+/*
+ * Draw L8/L4 image with palette in DMA2D CLUT.
+ * CLUT is loaded only when palette differs from the one used by previous indexed image,
+ * palette data must therefore not change while image may be drawn.
+ */
+static
+uint8_t LCD_DrawImageL(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
+    uint32_t cfg, cm, entries;
+    dma2d_cmd_t* cmd;
+    
+    if (img->bpp == 32) {
+        cfg = 0;                                    /* CLUT entries are ARGB8888 */
+    } else if (img->bpp == 24) {
+        cfg = DMA2D_FGPFCCR_CCM;                    /* CLUT entries are RGB888 */
+    } else {
+        return 0;                                   /* RGB565 palette is not supported by CLUT */
+    }
+    if (img->compression == GUI_IMAGE_COMPRESSION_L4) {
+        cm = DMA2D_INPUT_L4;
+        entries = 16;
+        if ((xSize + offLineSrc) & 0x01) {
+            return 0;                               /* Each line must start at byte boundary */
+        }
+    } else {
+        cm = DMA2D_INPUT_L8;
+        entries = 256;
+    }
+    if (img->palette_size && img->palette_size < entries) {
+        entries = img->palette_size;                /* Do not read after end of palette */
+    }
+    cfg |= (entries - 1) << DMA2D_FGPFCCR_CS_Pos;
+    if (!xSize || !ySize) {
+        return 1;
+    }
+    
+    if (dma2d_clut != img->palette || dma2d_clut_cfg != cfg) {
+        cmd = dma2d_alloc();
+        cmd->fgcmar = (uint32_t)img->palette;
+        cmd->fgpfccr = cfg;
+        dma2d_submit(cmd, DMA2D_CLUT_LOAD);         /* Queue CLUT load before transfer which uses it */
+        dma2d_clut = img->palette;
+        dma2d_clut_cfg = cfg;
+    }
+    
+    cmd = dma2d_alloc();
+    cmd->fgmar = (uint32_t)src;
+    cmd->bgmar = (uint32_t)dst;
+    cmd->omar = (uint32_t)dst;
+    cmd->fgor = offLineSrc;
+    cmd->bgor = offLineDst;
+    cmd->oor = offLineDst;
+    cmd->fgpfccr = cm | cfg;                        /* Foreground PFC Control Register with CLUT setup */
+    cmd->bgpfccr = PixelFormat;                     /* Background PFC Control Register (Defines the BG pixel format) */
+    cmd->opfccr  = PixelFormat;                     /* Output     PFC Control Register (Defines the output pixel format) */
+    
+    /* Palette entries have the same layout as 24/32BPP images */
+#if defined(DMA2D_FGPFCCR_AI) && defined(DMA2D_FGPFCCR_RBS)
+    cmd->fgpfccr |= (img->bpp == 32 ? DMA2D_FGPFCCR_AI : 0) | DMA2D_FGPFCCR_RBS;
+#endif  /* defined(DMA2D_FGPFCCR_AI) && defined(DMA2D_FGPFCCR_RBS) */
+    cmd->nlr = (uint32_t)(xSize << 16) | (uint16_t)ySize;
+    
+    dma2d_submit(cmd, DMA2D_M2M_BLEND);             /* Queue DMA2D transfer */
+    return 1;
+}
+
+#if LCD_USE_JPEG
+
+/*
+ * Decode JPEG to image cache.
+ * JPEG codec writes YCbCr MCU blocks to temporary buffer,
+ * DMA2D converts them to pixels of image depth in single transfer.
+ */
+static
+uint8_t LCD_DecodeImage(gui_lcd_t* LCD, const gui_image_desc_t* img, const void* data, void* out) {
+    JPEG_ConfTypeDef info;
+    uint32_t size, css, mcu, opfccr;
+    uint8_t* ycbcr;
+    dma2d_cmd_t* cmd;
+    
+    if (img->compression != GUI_IMAGE_COMPRESSION_JPEG) {
+        return 0;
+    }
+    if (img->bpp == 32) {
+        opfccr = DMA2D_OUTPUT_ARGB8888;
+#if defined(DMA2D_OPFCCR_AI) && defined(DMA2D_OPFCCR_RBS)
+        opfccr |= DMA2D_OPFCCR_AI | DMA2D_OPFCCR_RBS;   /* Same layout as raw 32BPP images */
+#endif /* defined(DMA2D_OPFCCR_AI) && defined(DMA2D_OPFCCR_RBS) */
+    } else if (img->bpp == 24) {
+        opfccr = DMA2D_OUTPUT_RGB888;
+#if defined(DMA2D_OPFCCR_RBS)
+        opfccr |= DMA2D_OPFCCR_RBS;
+#endif /* defined(DMA2D_OPFCCR_RBS) */
+    } else if (img->bpp == 16) {
+        opfccr = DMA2D_OUTPUT_RGB565;
+#if defined(DMA2D_OPFCCR_RBS)
+        opfccr |= DMA2D_OPFCCR_RBS;
+#endif /* defined(DMA2D_OPFCCR_RBS) */
+    } else {
+        return 0;
+    }
     
-    DMA2D_START(DMA2D_M2M_BLEND);                   /* Start DMA2D transfer */
+    /* YCbCr 4:4:4 is the largest output, image is padded to full MCUs */
+    size = (((uint32_t)img->x_size + 15) & ~0x0FUL) * (((uint32_t)img->y_size + 15) & ~0x0FUL) * 3;
+    ycbcr = GUI_MEMALLOC_CLASS(size, GUI_MEM_CLASS_PIXEL);
+    if (ycbcr == NULL) {
+        return 0;
+    }
+    if (HAL_JPEG_Decode(&JPEGHandle, (uint8_t *)data, img->size, ycbcr, size, HAL_MAX_DELAY) != HAL_OK
+        || HAL_JPEG_GetInfo(&JPEGHandle, &info) != HAL_OK
+        || info.ColorSpace != JPEG_YCBCR_COLORSPACE
+        || info.ImageWidth != (uint32_t)img->x_size || info.ImageHeight != (uint32_t)img->y_size) {
+        GUI_MEMFREE(ycbcr);
+        return 0;                                   /* Grayscale and CMYK are not supported by DMA2D */
+    }
+    if (info.ChromaSubsampling == JPEG_420_SUBSAMPLING) {
+        css = DMA2D_CSS_420;
+        mcu = 16;
+    } else if (info.ChromaSubsampling == JPEG_422_SUBSAMPLING) {
+        css = DMA2D_CSS_422;
+        mcu = 16;
+    } else {
+        css = DMA2D_NO_CSS;
+        mcu = 8;
+    }
+    
+    cmd = dma2d_alloc();
+    cmd->fgmar = (uint32_t)ycbcr;
+    cmd->omar = (uint32_t)out;
+    cmd->fgor = (mcu - (uint32_t)img->x_size % mcu) % mcu;  /* Skip padding to full MCU width */
+    cmd->oor = 0;
+    cmd->fgpfccr = DMA2D_INPUT_YCBCR | (css << DMA2D_FGPFCCR_CSS_Pos);
+    cmd->opfccr = opfccr;
+    cmd->nlr = (uint32_t)(img->x_size << 16) | (uint16_t)img->y_size;
+    
+    dma2d_submit(cmd, DMA2D_M2M_PFC);               /* Queue DMA2D conversion */
+    dma2d_fence();                                  /* Pixels must be ready before buffer is released */
+    GUI_MEMFREE(ycbcr);
+    return 1;
 }
 
+#endif /* LCD_USE_JPEG */
+
 static
 void LCD_CopyChar(gui_lcd_t* LCD, gui_layer_t* layer, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc, gui_color_t color) {
     uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
+    dma2d_cmd_t* cmd;
     
     if (!xSize || !ySize) {
         return;
     }
-    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
-    DMA2D->FGMAR = (uint32_t)src;
-    DMA2D->BGMAR = (uint32_t)dst;                       
-    DMA2D->OMAR = (uint32_t)dst;
-    DMA2D->FGOR = offLineSrc;
-    DMA2D->BGOR = offLineDst;
-    DMA2D->OOR = offLineDst;  
-    DMA2D->FGCOLR = color & 0x00FFFFFFUL;           /* Since foreground input color is A4, value in this register will be used for blending purpose */
-    DMA2D->FGPFCCR = DMA2D_INPUT_A8;                /* Foreground PFC Control Register */
-    DMA2D->BGPFCCR = PixelFormat;                   /* Background PFC Control Register (Defines the BG pixel format) */
-    DMA2D->OPFCCR  = PixelFormat;                   /* Output     PFC Control Register (Defines the output pixel format) */
-    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize; 
-    
-    DMA2D_START(DMA2D_M2M_BLEND);                   /* Start DMA2D transfer */
+    cmd = dma2d_alloc();
+    cmd->fgmar = (uint32_t)src;
+    cmd->bgmar = (uint32_t)dst;                       
+    cmd->omar = (uint32_t)dst;
+    cmd->fgor = offLineSrc;
+    cmd->bgor = offLineDst;
+    cmd->oor = offLineDst;  
+    cmd->fgcolr = color & 0x00FFFFFFUL;             /* Since foreground input color is A4, value in this register will be used for blending purpose */
+    cmd->fgpfccr = DMA2D_INPUT_A8;                  /* Foreground PFC Control Register */
+    cmd->bgpfccr = PixelFormat;                     /* Background PFC Control Register (Defines the BG pixel format) */
+    cmd->opfccr  = PixelFormat;                     /* Output     PFC Control Register (Defines the output pixel format) */
+    cmd->nlr = (uint32_t)(xSize << 16) | (uint16_t)ySize; 
+    
+    dma2d_submit(cmd, DMA2D_M2M_BLEND);             /* Queue DMA2D transfer */
 }
 
 static
 void LCD_DrawHLine(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
-    uint32_t addr = (uint32_t)layer->start_address + (LCD->pixel_size * (layer->width * y + x));
+    uint32_t addr = (uint32_t)layer->start_address + (GetPixelSize(layer) * (layer->width * y + x));
     
     LCD_Fill(LCD, layer, (void *)addr, length, 1, layer->width - length, color);
 }
 
 static
 void LCD_DrawVLine(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
-    uint32_t addr = (uint32_t)layer->start_address + (LCD->pixel_size * (layer->width * y + x));
+    uint32_t addr = (uint32_t)layer->start_address + (GetPixelSize(layer) * (layer->width * y + x));
     
     LCD_Fill(LCD, layer, (void *)addr, 1, length, layer->width - 1, color);
 }
 
 static
 void LCD_FillRect(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t xSize, gui_dim_t ySize, gui_color_t color) {
-    uint32_t addr = (uint32_t)layer->start_address + (LCD->pixel_size * (layer->width * y + x));
+    uint32_t addr = (uint32_t)layer->start_address + (GetPixelSize(layer) * (layer->width * y + x));
     
     LCD_Fill(LCD, layer, (void *)addr, xSize, ySize, layer->width - xSize, color);
 }
 
+/*
+ * Fill list of short spans with CPU after single fence.
+ * Setting up DMA2D for each span of a few pixels costs more than writing pixels directly.
+ */
 static
-void LCD_SetPixel(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_color_t color) {
-    LCD_DrawHLine(LCD, layer, x, y, 1, color);
+void LCD_FillSpans(gui_lcd_t* LCD, gui_layer_t* layer, const gui_span_t* spans, size_t count, gui_color_t color) {
+    size_t i;
+    gui_dim_t k;
+    
+    dma2d_fence();                                  /* Previous DMA2D jobs may still write to the same memory */
+    if (layer->pixel_format == GUI_PIXEL_FORMAT_RGB565) {
+        uint16_t c = GUI_COLOR_TO_RGB565(color), *p;
+        for (i = 0; i < count; i++, spans++) {
+            p = (void *)((uint32_t)layer->start_address + (2 * (layer->width * spans->y + spans->x)));
+            for (k = spans->length; k > 0; k--) {
+                *p++ = c;
+            }
+        }
+    } else {
+        uint32_t* p;
+        for (i = 0; i < count; i++, spans++) {
+            p = (void *)((uint32_t)layer->start_address + (4 * (layer->width * spans->y + spans->x)));
+            for (k = spans->length; k > 0; k--) {
+                *p++ = color;
+            }
+        }
+    }
 }
 
-/* Process DMA2D interrupt */
-void DMA2D_IRQHandler(void) {
-    HAL_DMA2D_IRQHandler(&DMA2DHandle);
+static
+void LCD_SetPixel(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_color_t color) {
+    LCD_DrawHLine(LCD, layer, x, y, 1, color);
 }
 
 void TransferErrorCallback(DMA2D_HandleTypeDef* hdma2d) {
      while (1);
 }
+
+/* Process DMA2D interrupt, start next job from queue */
+void DMA2D_IRQHandler(void) {
+    uint32_t isr = DMA2D->ISR;
+    
+    if (isr & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF | DMA2D_ISR_CAEIF)) {   /* Transfer, configuration or CLUT error */
+        DMA2D->IFCR = DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF | DMA2D_IFCR_CAECIF;
+        TransferErrorCallback(&DMA2DHandle);
+    }
+    if (isr & (DMA2D_ISR_TCIF | DMA2D_ISR_CTCIF)) { /* Transfer or CLUT loading completed */
+        DMA2D->IFCR = DMA2D_IFCR_CTCIF | DMA2D_IFCR_CCTCIF;
+        dma2d_queue_out = (dma2d_queue_out + 1) % DMA2D_QUEUE_SIZE;
+        if (dma2d_queue_out != dma2d_queue_in) {    /* Start next job if available */
+            dma2d_start(&dma2d_queue[dma2d_queue_out]);
+        } else {
+            dma2d_busy = 0;                         /* Queue is empty */
+        }
+    }
+}
+
 uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result) {
     switch (cmd) {
         case GUI_LL_Command_Init: {
@@ -317,8 +638,8 @@ uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void*
                 static uint8_t SDRAMMemory[SDRAM_HEAP_SIZE] __attribute__((at(SDRAM_START_ADR + SDRAM_MEMORY_SIZE - SDRAM_HEAP_SIZE))); /* SDRAM heap memory */
 #endif
                 static gui_mem_region_t const regions[] = {
-                    {DTCMMemory1, sizeof(DTCMMemory1)},
-                    {SDRAMMemory, sizeof(SDRAMMemory)},
+                    {DTCMMemory1, sizeof(DTCMMemory1), GUI_MEM_CLASS_FAST}, /* Widgets and timers in fast memory */
+                    {SDRAMMemory, sizeof(SDRAMMemory), GUI_MEM_CLASS_PIXEL},/* Layers and images for DMA2D */
                 };
                 gui_mem_assignmemory(regions, GUI_COUNT_OF(regions));
             } while (0);
@@ -338,6 +659,11 @@ uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void*
             for (i = 0; i < GUI_LAYERS; i++) {  /* Set each layer */
                 Layers[i].num = i;
                 Layers[i].start_address = (void *)(LCD_FRAME_BUFFER + (i * LCD_FRAME_BUFFER_SIZE));
+#if defined(LCD_COLOR_FORMAT_ARGB8888)
+                Layers[i].pixel_format = GUI_PIXEL_FORMAT_ARGB8888;
+#else
+                Layers[i].pixel_format = GUI_PIXEL_FORMAT_RGB565;
+#endif /* defined(LCD_COLOR_FORMAT_ARGB8888) */
             }
             
             /*******************************/
@@ -357,7 +683,15 @@ uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void*
             LL->DrawImage16 = LCD_DrawImage16;  /* Set draw function for 24bit image (RGB565) format */
             LL->DrawImage24 = LCD_DrawImage24;  /* Set draw function for 24bit image (RGB888) format */
             LL->DrawImage32 = LCD_DrawImage32;  /* Set draw function for 32bit image (ARGB8888/ABGR8888) format */
+            LL->DrawImageL = LCD_DrawImageL;    /* Set draw function for L8/L4 images with CLUT */
             LL->CopyChar = LCD_CopyChar;        /* Set draw function for char copy with alpha information */
+#if LCD_USE_JPEG
+            __HAL_RCC_JPEG_CLK_ENABLE();
+            JPEGHandle.Instance = JPEG;
+            HAL_JPEG_Init(&JPEGHandle);         /* Init hardware JPEG codec */
+            LL->DecodeImage = LCD_DecodeImage;  /* Set function for decoding JPEG images to image cache */
+#endif /* LCD_USE_JPEG */
+            LL->FillSpans = LCD_FillSpans;      /* Set function for filling list of horizontal spans */
             
             if (result) {
                 *(uint8_t *)result = 0;         /* Successful initialization */
@@ -370,6 +704,7 @@ uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void*
         }
         case GUI_LL_Command_SetActiveLayer: {   /* Set new active layer */
             gui_layer_t* layer = (gui_layer_t *)param;/* Read layer as byte */
+            dma2d_fence();                      /* Layer may only be shown when all drawings are finished */
             layer->pending = 1;                 /* Set layer as pending and redraw on next reload */
 
             if (result) {
@@ -377,6 +712,47 @@ uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void*
             }
             return 1;                           /* Command processed */
         }
+#if GUI_CFG_USE_DIRECT_RENDERING
+        case GUI_LL_Command_GetScanLine: {      /* Get line currently scanned by LTDC */
+            int32_t line;
+
+            line = (int32_t)(LTDC->CPSR & LTDC_CPSR_CYPOS) - (int32_t)((LTDC->BPCR & LTDC_BPCR_AVBP) + 1);
+            *(gui_dim_t *)result = (gui_dim_t)(line < 0 ? -1 : line);
+            return 1;                           /* Command processed */
+        }
+#endif /* GUI_CFG_USE_DIRECT_RENDERING */
+#if GUI_CFG_USE_OVERLAY
+        case GUI_LL_Command_SetOverlay: {       /* Set up overlay plane */
+            const gui_overlay_t* ov = (const gui_overlay_t *)param;
+            
+            if (ov->num > 0) {
+                return 0;                       /* Only one LTDC layer is free for overlays */
+            }
+            LCD_SetOverlay(ov);
+            if (result) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;                           /* Command processed */
+        }
+#endif /* GUI_CFG_USE_OVERLAY */
+#if GUI_CFG_USE_IDLE_REFRESH
+        case GUI_LL_Command_SetRefreshMode: {   /* Lower refresh of display while GUI is idle */
+            if (!_LCD_SetRefreshMode(*(const gui_refresh_mode_t *)param)) {
+                return 0;
+            }
+            if (result) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;                           /* Command processed */
+        }
+#endif /* GUI_CFG_USE_IDLE_REFRESH */
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+        case GUI_LL_Command_GetLayerAccess: {   /* Frame buffers are in SDRAM, addressable by CPU */
+            GUI_UNUSED(param);
+            GUI_UNUSED(result);                 /* Preset access is valid, fence is kept for DMA2D */
+            return 1;                           /* Command processed */
+        }
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
         default:
             return 0;
     }
@@ -0,0 +1,631 @@
+/**	
+ * \file            gui_ll_sw.c
+ * \brief           Software low-level drawing kernels
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#include "system/gui_ll_sw.h"
+
+#if GUI_CFG_LL_SW_USE_SIMD && defined(__SSE2__)
+#include <emmintrin.h>
+#define LL_SW_SSE2                  1
+#else
+#define LL_SW_SSE2                  0
+#endif /* GUI_CFG_LL_SW_USE_SIMD && defined(__SSE2__) */
+
+/**
+ * \brief           Get pointer to pixel in layer memory
+ * \hideinitializer
+ */
+#define LL_SW_ADDR(layer, x, y)    ((void *)((uint8_t *)(layer)->start_address + (LL_SW_IS565(layer) ? 2 : 4) * ((size_t)(y) * (layer)->width + (x))))
+
+/**
+ * \brief           Check if layer stores `RGB565` pixels
+ * \hideinitializer
+ */
+#define LL_SW_IS565(layer)              ((layer)->pixel_format == GUI_PIXEL_FORMAT_RGB565)
+
+#define argb_to_565(c)                  GUI_COLOR_TO_RGB565((uint32_t)(c))
+#define rgb565_to_argb(p)               GUI_COLOR_FROM_RGB565((uint32_t)(p))
+
+/**
+ * \brief           Blend all `4` channels of `2` colors
+ *
+ *                  Two channels are processed with each multiplication, result of each channel
+ *                  is `(fg * a + bg * (255 - a)) / 255`, rounded to nearest
+ *
+ * \param[in]       fg: Foreground color
+ * \param[in]       bg: Background color
+ * \param[in]       a: Foreground weight between `0` and `255`
+ * \return          Blended color
+ */
+GUI_CFG_FAST_CODE static uint32_t
+blend_argb(uint32_t fg, uint32_t bg, uint32_t a) {
+    uint32_t rb, ag, na = 0xFF - a;
+
+    rb = (fg & 0x00FF00FFUL) * a + (bg & 0x00FF00FFUL) * na + 0x00800080UL;
+    ag = ((fg >> 8) & 0x00FF00FFUL) * a + ((bg >> 8) & 0x00FF00FFUL) * na + 0x00800080UL;
+    rb = ((rb + ((rb >> 8) & 0x00FF00FFUL)) >> 8) & 0x00FF00FFUL;
+    ag = (ag + ((ag >> 8) & 0x00FF00FFUL)) & 0xFF00FF00UL;
+    return ag | rb;
+}
+
+/**
+ * \brief           Blend color premultiplied with alpha over background
+ * \param[in]       fg: Foreground color with `RGB` components premultiplied by `a`
+ * \param[in]       bg: Background color
+ * \param[in]       a: Foreground alpha
+ * \return          Blended opaque color
+ */
+GUI_CFG_FAST_CODE static uint32_t
+blend_premul(uint32_t fg, uint32_t bg, uint32_t a) {
+    return 0xFF000000UL | ((fg & 0x00FFFFFFUL) + (blend_argb(0, bg, a) & 0x00FFFFFFUL));
+}
+
+#if LL_SW_SSE2 || __DOXYGEN__
+
+/**
+ * \brief           Blend `4` colors with per-channel weights expanded to `16-bit` lanes
+ * \param[in]       fg: Foreground colors
+ * \param[in]       bg: Background colors
+ * \param[in]       alo: Weights for first `2` colors
+ * \param[in]       ahi: Weights for last `2` colors
+ * \return          Blended colors
+ */
+static __m128i
+blend_argb_sse2(__m128i fg, __m128i bg, __m128i alo, __m128i ahi) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c255 = _mm_set1_epi16(0xFF);
+    const __m128i c128 = _mm_set1_epi16(0x80);
+    __m128i lo, hi;
+
+    lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(fg, zero), alo),
+        _mm_mullo_epi16(_mm_unpacklo_epi8(bg, zero), _mm_sub_epi16(c255, alo)));
+    hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(fg, zero), ahi),
+        _mm_mullo_epi16(_mm_unpackhi_epi8(bg, zero), _mm_sub_epi16(c255, ahi)));
+    lo = _mm_add_epi16(lo, c128);
+    hi = _mm_add_epi16(hi, c128);
+    lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+    hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+    return _mm_packus_epi16(lo, hi);
+}
+
+/**
+ * \brief           Expand `4` alpha bytes to `16-bit` weights for each channel of `4` colors
+ * \param[in]       a: Alpha values, one byte per color
+ * \param[out]      alo: Weights for first `2` colors
+ * \param[out]      ahi: Weights for last `2` colors
+ */
+static void
+expand_alpha_sse2(uint32_t a, __m128i* alo, __m128i* ahi) {
+    __m128i v = _mm_cvtsi32_si128((int)a);
+
+    v = _mm_unpacklo_epi8(v, _mm_setzero_si128()); /* 16-bit per alpha */
+    v = _mm_unpacklo_epi16(v, v);                   /* Each alpha twice */
+    *alo = _mm_unpacklo_epi32(v, v);                /* Each alpha for 4 channels */
+    *ahi = _mm_unpackhi_epi32(v, v);
+}
+
+#endif /* LL_SW_SSE2 || __DOXYGEN__ */
+
+/**
+ * \brief           Fill row of `ARGB8888` pixels
+ * \param[in]       d: Row start address
+ * \param[in]       len: Number of pixels
+ * \param[in]       c: Pixel value
+ */
+GUI_CFG_FAST_CODE static void
+fill_row32(uint32_t* d, size_t len, uint32_t c) {
+#if LL_SW_SSE2
+    __m128i v = _mm_set1_epi32((int)c);
+
+    for (; len >= 4; len -= 4, d += 4) {
+        _mm_storeu_si128((__m128i *)d, v);
+    }
+#else /* LL_SW_SSE2 */
+    for (; len >= 4; len -= 4, d += 4) {
+        d[0] = c;
+        d[1] = c;
+        d[2] = c;
+        d[3] = c;
+    }
+#endif /* !LL_SW_SSE2 */
+    for (; len; len--) {
+        *d++ = c;
+    }
+}
+
+/**
+ * \brief           Fill row of `RGB565` pixels with word-wide stores
+ * \param[in]       d: Row start address
+ * \param[in]       len: Number of pixels
+ * \param[in]       c: Pixel value
+ */
+GUI_CFG_FAST_CODE static void
+fill_row16(uint16_t* d, size_t len, uint16_t c) {
+    uint32_t c2 = (uint32_t)c | ((uint32_t)c << 16);
+    uint32_t* d32;
+
+    if (len && ((uintptr_t)d & 0x03)) {             /* Align to word */
+        *d++ = c;
+        len--;
+    }
+    for (d32 = (uint32_t *)d; len >= 2; len -= 2) {
+        *d32++ = c2;
+    }
+    if (len) {
+        *(uint16_t *)d32 = c;
+    }
+}
+
+/**
+ * \brief           Assign software kernels to all low-level functions which are not set yet
+ *
+ *                  Hardware accelerated drivers set their functions first
+ *                  and call this function to use software kernels for the rest.
+ *
+ * \param[in,out]   ll: Low-level structure to fill
+ */
+void
+gui_ll_sw_assign(gui_ll_t* ll) {
+#define LL_SW_SET(f, v)     if (ll->f == NULL) { ll->f = v; }
+    LL_SW_SET(IsReady, gui_ll_sw_isready);
+    LL_SW_SET(SetPixel, gui_ll_sw_setpixel);
+    LL_SW_SET(GetPixel, gui_ll_sw_getpixel);
+    LL_SW_SET(Fill, gui_ll_sw_fill);
+    LL_SW_SET(Copy, gui_ll_sw_copy);
+    LL_SW_SET(CopyBlend, gui_ll_sw_copyblend);
+    LL_SW_SET(DrawHLine, gui_ll_sw_drawhline);
+    LL_SW_SET(DrawVLine, gui_ll_sw_drawvline);
+    LL_SW_SET(FillRect, gui_ll_sw_fillrect);
+    LL_SW_SET(DrawImage16, gui_ll_sw_drawimage16);
+    LL_SW_SET(DrawImage24, gui_ll_sw_drawimage24);
+    LL_SW_SET(DrawImage32, gui_ll_sw_drawimage32);
+    LL_SW_SET(CopyChar, gui_ll_sw_copychar);
+    LL_SW_SET(FillSpans, gui_ll_sw_fillspans);
+#undef LL_SW_SET
+}
+
+/**
+ * \brief           Check if low-level layer is ready
+ * \note            Software kernels finish before they return
+ * \param[in]       lcd: LCD handle
+ * \return          Always `1`
+ */
+uint8_t
+gui_ll_sw_isready(gui_lcd_t* lcd) {
+    GUI_UNUSED(lcd);
+    return 1;
+}
+
+/**
+ * \brief           Set single pixel
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to draw to
+ * \param[in]       x: X position relative to layer
+ * \param[in]       y: Y position relative to layer
+ * \param[in]       color: Pixel color
+ */
+void
+gui_ll_sw_setpixel(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_color_t color) {
+    GUI_UNUSED(lcd);
+    if (LL_SW_IS565(layer)) {
+        *(uint16_t *)LL_SW_ADDR(layer, x, y) = argb_to_565(color);
+    } else {
+        *(uint32_t *)LL_SW_ADDR(layer, x, y) = color;
+    }
+}
+
+/**
+ * \brief           Get single pixel
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to read from
+ * \param[in]       x: X position relative to layer
+ * \param[in]       y: Y position relative to layer
+ * \return          Pixel color in `ARGB8888` format
+ */
+gui_color_t
+gui_ll_sw_getpixel(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y) {
+    GUI_UNUSED(lcd);
+    if (LL_SW_IS565(layer)) {
+        return rgb565_to_argb(*(const uint16_t *)LL_SW_ADDR(layer, x, y));
+    }
+    return *(const uint32_t *)LL_SW_ADDR(layer, x, y);
+}
+
+/**
+ * \brief           Fill rectangle in memory with single color
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to draw to
+ * \param[in]       dst: Address of top-left pixel
+ * \param[in]       x_size: Rectangle width
+ * \param[in]       y_size: Rectangle height
+ * \param[in]       offline: Number of pixels to skip after each line
+ * \param[in]       color: Fill color
+ */
+GUI_CFG_FAST_CODE void
+gui_ll_sw_fill(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline, gui_color_t color) {
+    gui_dim_t y;
+
+    GUI_UNUSED(lcd);
+    if (x_size <= 0) {
+        return;
+    }
+    if (LL_SW_IS565(layer)) {
+        uint16_t* d = dst, c = argb_to_565(color);
+        for (y = 0; y < y_size; y++, d += x_size + offline) {
+            fill_row16(d, (size_t)x_size, c);
+        }
+    } else {
+        uint32_t* d = dst;
+        for (y = 0; y < y_size; y++, d += x_size + offline) {
+            fill_row32(d, (size_t)x_size, color);
+        }
+    }
+}
+
+/**
+ * \brief           Copy rectangle of pixels
+ * \note            Source and destination may overlap within each line
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to draw to
+ * \param[in]       dst: Destination address of top-left pixel
+ * \param[in]       src: Source address of top-left pixel
+ * \param[in]       x_size: Rectangle width
+ * \param[in]       y_size: Rectangle height
+ * \param[in]       offline_dst: Number of pixels to skip after each destination line
+ * \param[in]       offline_src: Number of pixels to skip after each source line
+ */
+GUI_CFG_FAST_CODE void
+gui_ll_sw_copy(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    uint8_t* d = dst;
+    const uint8_t* s = src;
+    size_t ps = LL_SW_IS565(layer) ? 2 : 4, len = ps * x_size;
+    gui_dim_t y;
+
+    GUI_UNUSED(lcd);
+    if (x_size <= 0) {
+        return;
+    }
+    for (y = 0; y < y_size; y++) {
+        memmove(d, s, len);
+        d += ps * (x_size + offline_dst);
+        s += ps * (x_size + offline_src);
+    }
+}
+
+/**
+ * \brief           Blend source rectangle to destination with constant source alpha
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to draw to
+ * \param[in]       dst: Destination address of top-left pixel
+ * \param[in]       src: Source address of top-left pixel
+ * \param[in]       alpha_src: Source opacity between `0` and `255`
+ * \param[in]       alpha_dst: Not used, destination pixel alpha is used as is
+ * \param[in]       x_size: Rectangle width
+ * \param[in]       y_size: Rectangle height
+ * \param[in]       offline_dst: Number of pixels to skip after each destination line
+ * \param[in]       offline_src: Number of pixels to skip after each source line
+ */
+GUI_CFG_FAST_CODE void
+gui_ll_sw_copyblend(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, uint8_t alpha_src, uint8_t alpha_dst, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    gui_dim_t x, y;
+
+    GUI_UNUSED(alpha_dst);
+    if (alpha_src == 0xFF) {
+        gui_ll_sw_copy(lcd, layer, dst, src, x_size, y_size, offline_dst, offline_src);
+        return;
+    }
+    if (LL_SW_IS565(layer)) {
+        uint16_t* d = dst;
+        const uint16_t* s = src;
+        for (y = 0; y < y_size; y++, d += offline_dst, s += offline_src) {
+            for (x = 0; x < x_size; x++, d++, s++) {
+                *d = argb_to_565(blend_argb(rgb565_to_argb(*s), rgb565_to_argb(*d), alpha_src));
+            }
+        }
+    } else {
+        uint32_t* d = dst;
+        const uint32_t* s = src;
+#if LL_SW_SSE2
+        __m128i alo, ahi;
+        expand_alpha_sse2(0x01010101UL * alpha_src, &alo, &ahi);
+#endif /* LL_SW_SSE2 */
+        for (y = 0; y < y_size; y++, d += offline_dst, s += offline_src) {
+            x = 0;
+#if LL_SW_SSE2
+            for (; x + 4 <= x_size; x += 4, d += 4, s += 4) {
+                _mm_storeu_si128((__m128i *)d, blend_argb_sse2(_mm_loadu_si128((const __m128i *)s), _mm_loadu_si128((const __m128i *)d), alo, ahi));
+            }
+#endif /* LL_SW_SSE2 */
+            for (; x < x_size; x++, d++, s++) {
+                *d = blend_argb(*s, *d, alpha_src);
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Draw horizontal line
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to draw to
+ * \param[in]       x: X position relative to layer
+ * \param[in]       y: Y position relative to layer
+ * \param[in]       length: Line length
+ * \param[in]       color: Line color
+ */
+void
+gui_ll_sw_drawhline(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    gui_ll_sw_fill(lcd, layer, LL_SW_ADDR(layer, x, y), length, 1, 0, color);
+}
+
+/**
+ * \brief           Draw vertical line
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to draw to
+ * \param[in]       x: X position relative to layer
+ * \param[in]       y: Y position relative to layer
+ * \param[in]       length: Line length
+ * \param[in]       color: Line color
+ */
+void
+gui_ll_sw_drawvline(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    gui_ll_sw_fill(lcd, layer, LL_SW_ADDR(layer, x, y), 1, length, layer->width - 1, color);
+}
+
+/**
+ * \brief           Fill rectangle
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to draw to
+ * \param[in]       x: X position relative to layer
+ * \param[in]       y: Y position relative to layer
+ * \param[in]       x_size: Rectangle width
+ * \param[in]       y_size: Rectangle height
+ * \param[in]       color: Fill color
+ */
+GUI_CFG_FAST_CODE void
+gui_ll_sw_fillrect(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t x_size, gui_dim_t y_size, gui_color_t color) {
+    gui_ll_sw_fill(lcd, layer, LL_SW_ADDR(layer, x, y), x_size, y_size, layer->width - x_size, color);
+}
+
+/**
+ * \brief           Draw opaque `16BPP` image
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to draw to
+ * \param[in]       img: Image descriptor
+ * \param[in]       dst: Destination address of top-left pixel
+ * \param[in]       src: Source address of top-left image pixel
+ * \param[in]       x_size: Width to draw
+ * \param[in]       y_size: Height to draw
+ * \param[in]       offline_dst: Number of pixels to skip after each destination line
+ * \param[in]       offline_src: Number of pixels to skip after each source line
+ */
+GUI_CFG_FAST_CODE void
+gui_ll_sw_drawimage16(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    const uint16_t* s = src;
+    uint32_t p;
+    gui_dim_t x, y;
+
+    GUI_UNUSED2(lcd, img);
+    for (y = 0; y < y_size; y++, s += offline_src) {
+        if (LL_SW_IS565(layer)) {
+            uint16_t* d = (uint16_t *)dst + (size_t)y * (x_size + offline_dst);
+            for (x = 0; x < x_size; x++, s++) {
+                p = *s;                             /* Swap red and blue */
+                *d++ = (uint16_t)(((p & 0x1F) << 11) | (p & 0x07E0) | ((p >> 11) & 0x1F));
+            }
+        } else {
+            uint32_t* d = (uint32_t *)dst + (size_t)y * (x_size + offline_dst);
+            for (x = 0; x < x_size; x++, s++) {
+                p = rgb565_to_argb(*s);
+                *d++ = (p & 0xFF00FF00UL) | ((p >> 16) & 0xFF) | ((p & 0xFF) << 16);
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Draw opaque `24BPP` image
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to draw to
+ * \param[in]       img: Image descriptor
+ * \param[in]       dst: Destination address of top-left pixel
+ * \param[in]       src: Source address of top-left image pixel
+ * \param[in]       x_size: Width to draw
+ * \param[in]       y_size: Height to draw
+ * \param[in]       offline_dst: Number of pixels to skip after each destination line
+ * \param[in]       offline_src: Number of pixels to skip after each source line
+ */
+GUI_CFG_FAST_CODE void
+gui_ll_sw_drawimage24(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    const uint8_t* s = src;
+    uint32_t c;
+    gui_dim_t x, y;
+
+    GUI_UNUSED2(lcd, img);
+    for (y = 0; y < y_size; y++, s += 3 * offline_src) {
+        if (LL_SW_IS565(layer)) {
+            uint16_t* d = (uint16_t *)dst + (size_t)y * (x_size + offline_dst);
+            for (x = 0; x < x_size; x++, s += 3) {
+                c = ((uint32_t)s[0] << 16) | ((uint32_t)s[1] << 8) | s[2];
+                *d++ = argb_to_565(c);
+            }
+        } else {
+            uint32_t* d = (uint32_t *)dst + (size_t)y * (x_size + offline_dst);
+            for (x = 0; x < x_size; x++, s += 3) {
+                *d++ = 0xFF000000UL | ((uint32_t)s[0] << 16) | ((uint32_t)s[1] << 8) | s[2];
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Draw `32BPP` image with per-pixel alpha
+ *
+ *                  Images with \ref GUI_FLAG_IMAGE_OPAQUE are copied without reading destination,
+ *                  images with \ref GUI_FLAG_IMAGE_PREMULTIPLIED skip multiplication of source color
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to draw to
+ * \param[in]       img: Image descriptor
+ * \param[in]       dst: Destination address of top-left pixel
+ * \param[in]       src: Source address of top-left image pixel
+ * \param[in]       x_size: Width to draw
+ * \param[in]       y_size: Height to draw
+ * \param[in]       offline_dst: Number of pixels to skip after each destination line
+ * \param[in]       offline_src: Number of pixels to skip after each source line
+ */
+GUI_CFG_FAST_CODE void
+gui_ll_sw_drawimage32(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    const uint8_t* s = src;
+    uint32_t c, a;
+    uint8_t opaque = !!(img->flags & GUI_FLAG_IMAGE_OPAQUE), premul = !!(img->flags & GUI_FLAG_IMAGE_PREMULTIPLIED);
+    gui_dim_t x, y;
+
+    GUI_UNUSED(lcd);
+    for (y = 0; y < y_size; y++, s += 4 * offline_src) {
+        if (LL_SW_IS565(layer)) {
+            uint16_t* d = (uint16_t *)dst + (size_t)y * (x_size + offline_dst);
+            for (x = 0; x < x_size; x++, s += 4, d++) {
+                a = opaque ? 0xFF : 0xFF - s[3];
+                if (a) {
+                    c = 0xFF000000UL | ((uint32_t)s[0] << 16) | ((uint32_t)s[1] << 8) | s[2];
+                    if (a != 0xFF) {
+                        c = premul ? blend_premul(c, rgb565_to_argb(*d), a) : blend_argb(c, rgb565_to_argb(*d), a);
+                    }
+                    *d = argb_to_565(c);
+                }
+            }
+        } else {
+            uint32_t* d = (uint32_t *)dst + (size_t)y * (x_size + offline_dst);
+            if (opaque) {                           /* Plain copy, destination is not read */
+                for (x = 0; x < x_size; x++, s += 4) {
+                    *d++ = 0xFF000000UL | ((uint32_t)s[0] << 16) | ((uint32_t)s[1] << 8) | s[2];
+                }
+                continue;
+            }
+            for (x = 0; x < x_size; x++, s += 4, d++) {
+                a = 0xFF - s[3];
+                if (a) {
+                    c = 0xFF000000UL | ((uint32_t)s[0] << 16) | ((uint32_t)s[1] << 8) | s[2];
+                    if (a != 0xFF) {
+                        c = premul ? blend_premul(c, *d, a) : blend_argb(c, *d, a);
+                    }
+                    *d = c;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Blend single color to rectangle using `A8` source as alpha
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to draw to
+ * \param[in]       dst: Destination address of top-left pixel
+ * \param[in]       src: Address of first alpha value
+ * \param[in]       x_size: Rectangle width
+ * \param[in]       y_size: Rectangle height
+ * \param[in]       offline_dst: Number of pixels to skip after each destination line
+ * \param[in]       offline_src: Number of alpha values to skip after each source line
+ * \param[in]       color: Color to blend
+ */
+GUI_CFG_FAST_CODE void
+gui_ll_sw_copychar(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src, gui_color_t color) {
+    const uint8_t* s = src;
+    gui_dim_t x, y;
+
+    GUI_UNUSED(lcd);
+    if (LL_SW_IS565(layer)) {
+        uint16_t* d = dst, c = argb_to_565(color);
+        for (y = 0; y < y_size; y++, d += offline_dst, s += offline_src) {
+            for (x = 0; x < x_size; x++, d++, s++) {
+                if (*s == 0xFF) {
+                    *d = c;
+                } else if (*s) {
+                    *d = argb_to_565(blend_argb(color, rgb565_to_argb(*d), *s));
+                }
+            }
+        }
+    } else {
+        uint32_t* d = dst;
+#if LL_SW_SSE2
+        __m128i vc = _mm_set1_epi32((int)color), alo, ahi;
+        uint32_t a4;
+#endif /* LL_SW_SSE2 */
+        for (y = 0; y < y_size; y++, d += offline_dst, s += offline_src) {
+            x = 0;
+#if LL_SW_SSE2
+            for (; x + 4 <= x_size; x += 4, d += 4, s += 4) {
+                memcpy(&a4, s, sizeof(a4));
+                if (a4 == 0) {                      /* Fully transparent, common around glyphs */
+                    continue;
+                } else if (a4 == 0xFFFFFFFFUL) {
+                    _mm_storeu_si128((__m128i *)d, vc);
+                } else {
+                    expand_alpha_sse2(a4, &alo, &ahi);
+                    _mm_storeu_si128((__m128i *)d, blend_argb_sse2(vc, _mm_loadu_si128((const __m128i *)d), alo, ahi));
+                }
+            }
+#endif /* LL_SW_SSE2 */
+            for (; x < x_size; x++, d++, s++) {
+                if (*s == 0xFF) {
+                    *d = color;
+                } else if (*s) {
+                    *d = blend_argb(color, *d, *s);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Fill list of horizontal spans with single color
+ * \param[in]       lcd: LCD handle
+ * \param[in]       layer: Layer to draw to
+ * \param[in]       spans: Spans in layer coordinates
+ * \param[in]       count: Number of spans
+ * \param[in]       color: Fill color
+ */
+GUI_CFG_FAST_CODE void
+gui_ll_sw_fillspans(gui_lcd_t* lcd, gui_layer_t* layer, const gui_span_t* spans, size_t count, gui_color_t color) {
+    uint16_t c = argb_to_565(color);
+
+    GUI_UNUSED(lcd);
+    for (; count; count--, spans++) {
+        if (spans->length <= 0) {
+            continue;
+        }
+        if (LL_SW_IS565(layer)) {
+            fill_row16(LL_SW_ADDR(layer, spans->x, spans->y), (size_t)spans->length, c);
+        } else {
+            fill_row32(LL_SW_ADDR(layer, spans->x, spans->y), (size_t)spans->length, color);
+        }
+    }
+}
@@ -409,6 +409,50 @@ gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result)
             }
             return 1;                           /* Command processed */
         }
+        case GUI_LL_Command_FlushBand: {        /* Send band to display when GUI_CFG_USE_BAND_RENDERING is used */
+            gui_layer_t* band = (gui_layer_t *)param;
+            
+            /*
+             * Set display window to band->x_pos, band->y_pos, band->width, band->height
+             * and send band->width * band->height pixels from band->start_address.
+             *
+             * Buffer is reused for next band after command returns.
+             * If data are sent with DMA, wait for transfer completion before return.
+             */
+            GUI_UNUSED(band);
+            
+            if (result) {
+                *(uint8_t *)result = 0;         /* Successful band transfer */
+            }
+            return 1;                           /* Command processed */
+        }
+        case GUI_LL_Command_SetRefreshMode: {   /* Change refresh when GUI_CFG_USE_IDLE_REFRESH is used */
+            gui_refresh_mode_t mode = *(gui_refresh_mode_t *)param;
+            
+            /*
+             * In GUI_REFRESH_MODE_IDLE mode lower refresh rate or pixel clock,
+             * or stop sending frames to panel with own frame memory.
+             * Restore normal refresh in GUI_REFRESH_MODE_NORMAL mode before returning.
+             */
+            GUI_UNUSED(mode);
+            
+            if (result) {
+                *(uint8_t *)result = 0;         /* Successful mode change */
+            }
+            return 1;                           /* Command processed */
+        }
+        case GUI_LL_Command_GetLayerAccess: {   /* Report CPU access to layer memory when GUI_CFG_USE_LL_DIRECT_ACCESS is used */
+            gui_layer_access_t* acc = (gui_layer_access_t *)result;
+            
+            /*
+             * Access is preset from layer. Set base to NULL when memory
+             * is not addressable by CPU, clear fence when drawing is synchronous.
+             */
+            GUI_UNUSED(param);
+            GUI_UNUSED(acc);
+            
+            return 1;                           /* Command processed */
+        }
         default:
             return 0;
     }
@@ -0,0 +1,794 @@
+/**
+ * \file            gui_ll_vglite.c
+ * \brief           Low-level driver for VeriSilicon VG-Lite vector GPU
+ *
+ *                  Drawing functions are recorded to GPU command buffer and
+ *                  submitted once per redrawn region, CPU waits for GPU only
+ *                  before it accesses layer memory itself.
+ *                  Layers, glyph scratch memory and GPU memory share address space,
+ *                  as on i.MX RT1160/RT1170 devices.
+ *
+ *                  Vector functions need \ref GUI_CFG_USE_LL_GPU, they are replaced
+ *                  by software kernels when \ref GUI_CFG_USE_LCD_ROTATION is enabled
+ */
+
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#include "system/gui_ll.h"
+#include "system/gui_ll_sw.h"
+#include "gui/gui_mem.h"
+#include <string.h>
+#include "vg_lite.h"
+
+#if !__DOXYGEN__
+
+#ifndef GUI_LL_VGLITE_WIDTH
+#define GUI_LL_VGLITE_WIDTH                 720
+#endif
+
+#ifndef GUI_LL_VGLITE_HEIGHT
+#define GUI_LL_VGLITE_HEIGHT                1280
+#endif
+
+/* Set to `1` to use RGB565 layers instead of ARGB8888 */
+#ifndef GUI_LL_VGLITE_RGB565
+#define GUI_LL_VGLITE_RGB565                0
+#endif
+
+/* Size of single GPU command buffer, driver uses 2 of them */
+#ifndef GUI_LL_VGLITE_CMD_BUFFER_SIZE
+#define GUI_LL_VGLITE_CMD_BUFFER_SIZE       0x8000
+#endif
+
+/* Tessellation window of path rasterizer */
+#ifndef GUI_LL_VGLITE_TESS_SIZE
+#define GUI_LL_VGLITE_TESS_SIZE             128
+#endif
+
+/* Memory for glyphs copied to GPU alignment until next GPU finish */
+#ifndef GUI_LL_VGLITE_SCRATCH_SIZE
+#define GUI_LL_VGLITE_SCRATCH_SIZE          0x4000
+#endif
+
+/* Required alignment of buffer start address and line length in units of bytes */
+#ifndef GUI_LL_VGLITE_ADDR_ALIGN
+#define GUI_LL_VGLITE_ADDR_ALIGN            64
+#endif
+
+#ifndef GUI_LL_VGLITE_STRIDE_ALIGN
+#define GUI_LL_VGLITE_STRIDE_ALIGN          16
+#endif
+
+#ifndef GUI_LL_VGLITE_HEAP_SIZE
+#define GUI_LL_VGLITE_HEAP_SIZE             0x400000
+#endif
+
+#if GUI_CFG_USE_BAND_RENDERING || GUI_CFG_USE_DIRECT_RENDERING
+#error "VG-Lite driver supports only layer rendering"
+#endif
+
+#define LCD_LAYERS                          2
+#if GUI_LL_VGLITE_RGB565
+#define LCD_PIXEL_SIZE                      2
+#else
+#define LCD_PIXEL_SIZE                      4
+#endif
+
+#define VGLITE_IS_ALIGNED(x, a)             ((((uint32_t)(x)) & ((a) - 1)) == 0)
+#define VGLITE_ALIGN(x, a)                  (((x) + (a) - 1) & ~((a) - 1))
+
+/* Cubic Bezier control point distance for quarter circle */
+#define VGLITE_KAPPA                        0.5522847f
+
+/* Path opcodes of VG-Lite command stream */
+#define VLC_OP_END                          0x00
+#define VLC_OP_CLOSE                        0x01
+#define VLC_OP_MOVE                         0x02
+#define VLC_OP_LINE                         0x04
+#define VLC_OP_QUAD                         0x06
+#define VLC_OP_CUBIC                        0x08
+
+/* Path data words, enough for rounded rectangle and icons up to 64 segments */
+#define VGLITE_PATH_SIZE                    (64 * 7 + 2)
+
+/*
+ * Board hooks, implemented by application:
+ *
+ *  - vglite_board_init: Set up display controller to scan out first buffer
+ *  - vglite_board_show: Scan out buffer from next vertical blanking period.
+ *                       Call \ref gui_lcd_confirmactivelayer for layer once shown
+ */
+extern uint8_t vglite_board_init(void* fb, gui_dim_t width, gui_dim_t height, uint8_t pixel_size);
+extern void vglite_board_show(gui_layer_t* layer);
+
+/* Frame buffers must be in memory accessible to GPU and display controller */
+#if defined(__GNUC__)
+static uint8_t frame_buffers[LCD_LAYERS][GUI_LL_VGLITE_WIDTH * GUI_LL_VGLITE_HEIGHT * LCD_PIXEL_SIZE]
+    __attribute__((aligned(GUI_LL_VGLITE_ADDR_ALIGN), section(".noncacheable")));
+static uint8_t heap[GUI_LL_VGLITE_HEAP_SIZE] __attribute__((aligned(GUI_LL_VGLITE_ADDR_ALIGN)));
+#else
+static __align(GUI_LL_VGLITE_ADDR_ALIGN) uint8_t frame_buffers[LCD_LAYERS][GUI_LL_VGLITE_WIDTH * GUI_LL_VGLITE_HEIGHT * LCD_PIXEL_SIZE];
+static __align(GUI_LL_VGLITE_ADDR_ALIGN) uint8_t heap[GUI_LL_VGLITE_HEAP_SIZE];
+#endif
+
+static gui_layer_t layers[LCD_LAYERS];
+static uint8_t* scratch;                    /* Glyph scratch memory */
+static size_t scratch_used;                 /* Number of bytes in use by commands not finished yet */
+static uint8_t gpu_pending;                 /* Set to `1` when commands were recorded after last finish */
+#if GUI_CFG_USE_LL_GPU
+static vg_lite_linear_gradient_t grad;      /* Gradient ramp, updated only when GPU is idle */
+static float path_data[VGLITE_PATH_SIZE];
+#endif /* GUI_CFG_USE_LL_GPU */
+
+static void
+lcd_init(gui_lcd_t* lcd) {
+    GUI_UNUSED(lcd);
+}
+
+/**
+ * \brief           Wait for GPU to finish all recorded commands
+ * \note            Must be called before CPU accesses memory used by GPU
+ */
+static void
+vglite_sync(void) {
+    if (gpu_pending) {
+        vg_lite_finish();
+        gpu_pending = 0;
+    }
+    scratch_used = 0;                       /* Glyphs are not referenced anymore */
+}
+
+/**
+ * \brief           Convert ARGB8888 color to VG-Lite `ABGR` color
+ */
+static vg_lite_color_t
+vglite_color(gui_color_t color) {
+    return (color & 0xFF00FF00UL) | ((color >> 16) & 0xFF) | ((color & 0xFF) << 16);
+}
+
+/**
+ * \brief           Set up GPU buffer of layer
+ * \param[in]       layer: Layer to describe
+ * \param[out]      buf: Buffer to fill
+ * \return          `1` when layer memory fits GPU requirements, `0` otherwise
+ */
+static uint8_t
+vglite_target(gui_layer_t* layer, vg_lite_buffer_t* buf) {
+    uint32_t stride = (uint32_t)layer->width * LCD_PIXEL_SIZE;
+
+    if (!VGLITE_IS_ALIGNED(layer->start_address, GUI_LL_VGLITE_ADDR_ALIGN)
+        || !VGLITE_IS_ALIGNED(stride, GUI_LL_VGLITE_STRIDE_ALIGN)) {
+        return 0;                           /* Temporary layers from heap may not be aligned */
+    }
+    memset(buf, 0x00, sizeof(*buf));
+    buf->width = layer->width;
+    buf->height = layer->height;
+    buf->stride = stride;
+    buf->tiled = VG_LITE_LINEAR;
+    /* VG-Lite names formats by memory order of bytes */
+    buf->format = layer->pixel_format == GUI_PIXEL_FORMAT_RGB565 ? VG_LITE_BGR565 : VG_LITE_BGRA8888;
+    buf->memory = layer->start_address;
+    buf->address = (uint32_t)layer->start_address;  /* GPU uses CPU addresses */
+    return 1;
+}
+
+/**
+ * \brief           Set up GPU buffer around pixels at address
+ *
+ *                  Buffer starts at aligned address below `src`,
+ *                  position of `src` is returned as rectangle offset.
+ *
+ * \param[in]       src: First pixel of source rectangle
+ * \param[in]       x_size: Rectangle width in units of pixels
+ * \param[in]       y_size: Rectangle height in units of pixels
+ * \param[in]       offline: Number of pixels between end of line and start of next one
+ * \param[in]       format: GPU pixel format
+ * \param[in]       pixel_size: Number of bytes per pixel
+ * \param[out]      buf: Buffer to fill
+ * \param[out]      rect: Source rectangle in buffer
+ * \return          `1` when memory fits GPU requirements, `0` otherwise
+ */
+static uint8_t
+vglite_source(const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline, vg_lite_buffer_format_t format,
+                uint8_t pixel_size, vg_lite_buffer_t* buf, uint32_t* rect) {
+    uint32_t base = (uint32_t)src & ~(uint32_t)(GUI_LL_VGLITE_ADDR_ALIGN - 1);
+    uint32_t skip = (uint32_t)src - base;
+    uint32_t stride = (uint32_t)(x_size + offline) * pixel_size;
+
+    if ((skip % pixel_size) || !VGLITE_IS_ALIGNED(stride, GUI_LL_VGLITE_STRIDE_ALIGN)) {
+        return 0;
+    }
+    memset(buf, 0x00, sizeof(*buf));
+    buf->width = (int32_t)(skip / pixel_size + x_size);
+    buf->height = y_size;
+    buf->stride = stride;
+    buf->tiled = VG_LITE_LINEAR;
+    buf->format = format;
+    buf->memory = (void *)base;
+    buf->address = base;
+    rect[0] = skip / pixel_size;
+    rect[1] = 0;
+    rect[2] = x_size;
+    rect[3] = y_size;
+    return 1;
+}
+
+/**
+ * \brief           Get position of address in layer
+ */
+static void
+vglite_xy(gui_layer_t* layer, const void* p, int32_t* x, int32_t* y) {
+    size_t off = (size_t)((const uint8_t *)p - (const uint8_t *)layer->start_address) / LCD_PIXEL_SIZE;
+
+    *x = (int32_t)(off % layer->width);
+    *y = (int32_t)(off / layer->width);
+}
+
+/**
+ * \brief           Limit all following path and blit commands to clipping region
+ */
+static void
+vglite_scissor(const gui_display_t* clip) {
+    vg_lite_set_scissor(clip->x1, clip->y1, clip->x2, clip->y2);
+    vg_lite_enable_scissor();
+}
+
+/**
+ * \brief           Fill rectangle with clear command
+ */
+static uint8_t
+vglite_clear(gui_layer_t* layer, int32_t x, int32_t y, int32_t x_size, int32_t y_size, gui_color_t color) {
+    vg_lite_buffer_t target;
+    vg_lite_rectangle_t rect;
+
+    if ((color >> 24) != 0xFF || !vglite_target(layer, &target)) {
+        return 0;                           /* Clear does not blend, transparent fills stay on CPU */
+    }
+    rect.x = x;
+    rect.y = y;
+    rect.width = x_size;
+    rect.height = y_size;
+    vg_lite_clear(&target, &rect, vglite_color(color));
+    gpu_pending = 1;
+    return 1;
+}
+
+static void
+lcd_fill(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline, gui_color_t color) {
+    int32_t x, y;
+
+    vglite_xy(layer, dst, &x, &y);
+    if (offline != layer->width - x_size || !vglite_clear(layer, x, y, x_size, y_size, color)) {
+        vglite_sync();
+        gui_ll_sw_fill(lcd, layer, dst, x_size, y_size, offline, color);
+    }
+}
+
+static void
+lcd_fillrect(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t x_size, gui_dim_t y_size, gui_color_t color) {
+    if (!vglite_clear(layer, x, y, x_size, y_size, color)) {
+        vglite_sync();
+        gui_ll_sw_fillrect(lcd, layer, x, y, x_size, y_size, color);
+    }
+}
+
+static void
+lcd_drawhline(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    if (!vglite_clear(layer, x, y, length, 1, color)) {
+        vglite_sync();
+        gui_ll_sw_drawhline(lcd, layer, x, y, length, color);
+    }
+}
+
+static void
+lcd_drawvline(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t length, gui_color_t color) {
+    if (!vglite_clear(layer, x, y, 1, length, color)) {
+        vglite_sync();
+        gui_ll_sw_drawvline(lcd, layer, x, y, length, color);
+    }
+}
+
+static void
+lcd_fillspans(gui_lcd_t* lcd, gui_layer_t* layer, const gui_span_t* spans, size_t count, gui_color_t color) {
+    size_t i;
+
+    for (i = 0; i < count; i++) {
+        if (!vglite_clear(layer, spans[i].x, spans[i].y, spans[i].length, 1, color)) {
+            vglite_sync();
+            gui_ll_sw_fillspans(lcd, layer, &spans[i], count - i, color);
+            return;
+        }
+    }
+}
+
+/**
+ * \brief           Blit source rectangle to destination address in layer
+ * \param[in]       image_mode: `VG_LITE_MULTIPLY_IMAGE_MODE` to multiply source pixels with `color`
+ * \return          `1` when recorded to GPU, `0` otherwise
+ */
+static uint8_t
+vglite_blit(gui_layer_t* layer, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src,
+                vg_lite_buffer_format_t format, uint8_t pixel_size, vg_lite_blend_t blend, vg_lite_buffer_image_mode_t image_mode, vg_lite_color_t color) {
+    vg_lite_buffer_t target, source;
+    vg_lite_matrix_t matrix;
+    uint32_t rect[4];
+    int32_t x, y;
+
+    if (offline_dst != layer->width - x_size
+        || !vglite_target(layer, &target)
+        || !vglite_source(src, x_size, y_size, offline_src, format, pixel_size, &source, rect)) {
+        return 0;
+    }
+    source.image_mode = image_mode;
+    vglite_xy(layer, dst, &x, &y);
+    vg_lite_identity(&matrix);
+    vg_lite_translate((vg_lite_float_t)x, (vg_lite_float_t)y, &matrix);
+    vg_lite_disable_scissor();
+    if (vg_lite_blit_rect(&target, &source, rect, &matrix, blend, color, VG_LITE_FILTER_POINT) != VG_LITE_SUCCESS) {
+        return 0;
+    }
+    gpu_pending = 1;
+    return 1;
+}
+
+/**
+ * \brief           Get GPU format of layer pixels
+ */
+static vg_lite_buffer_format_t
+vglite_layer_format(gui_layer_t* layer) {
+    return layer->pixel_format == GUI_PIXEL_FORMAT_RGB565 ? VG_LITE_BGR565 : VG_LITE_BGRA8888;
+}
+
+static void
+lcd_copy(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    size_t len = y_size > 0 ? (size_t)LCD_PIXEL_SIZE * ((size_t)(y_size - 1) * (x_size + offline_dst) + x_size) : 0;
+    
+    /* GPU does not define order of pixel access, overlapping rectangles are moved by CPU */
+    if (((const uint8_t *)src < (uint8_t *)dst + len && (uint8_t *)dst < (const uint8_t *)src + len)
+        || !vglite_blit(layer, dst, src, x_size, y_size, offline_dst, offline_src, vglite_layer_format(layer), LCD_PIXEL_SIZE,
+                        VG_LITE_BLEND_NONE, VG_LITE_NORMAL_IMAGE_MODE, 0)) {
+        vglite_sync();
+        gui_ll_sw_copy(lcd, layer, dst, src, x_size, y_size, offline_dst, offline_src);
+    }
+}
+
+static void
+lcd_copyblend(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, uint8_t alpha_src, uint8_t alpha_dst, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    vg_lite_color_t c = 0x01010101UL * alpha_src;
+
+    /* Source pixels are treated as opaque and scaled by constant alpha, same as software kernel */
+    if (!vglite_blit(layer, dst, src, x_size, y_size, offline_dst, offline_src, vglite_layer_format(layer), LCD_PIXEL_SIZE,
+                        alpha_src == 0xFF ? VG_LITE_BLEND_NONE : VG_LITE_BLEND_SRC_OVER,
+                        alpha_src == 0xFF ? VG_LITE_NORMAL_IMAGE_MODE : VG_LITE_MULTIPLY_IMAGE_MODE, c)) {
+        vglite_sync();
+        gui_ll_sw_copyblend(lcd, layer, dst, src, alpha_src, alpha_dst, x_size, y_size, offline_dst, offline_src);
+    }
+}
+
+static void
+lcd_drawimage16(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    /* Source RGB565 images have red in lowest bits, opposite to layers */
+    if (!vglite_blit(layer, dst, src, x_size, y_size, offline_dst, offline_src, VG_LITE_RGB565, 2,
+                        VG_LITE_BLEND_NONE, VG_LITE_NORMAL_IMAGE_MODE, 0)) {
+        vglite_sync();
+        gui_ll_sw_drawimage16(lcd, layer, img, dst, src, x_size, y_size, offline_dst, offline_src);
+    }
+}
+
+/* 24BPP images have no GPU format and 32BPP images use inverted alpha, both stay on CPU */
+static void
+lcd_drawimage24(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    vglite_sync();
+    gui_ll_sw_drawimage24(lcd, layer, img, dst, src, x_size, y_size, offline_dst, offline_src);
+}
+
+static void
+lcd_drawimage32(gui_lcd_t* lcd, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src) {
+    vglite_sync();
+    gui_ll_sw_drawimage32(lcd, layer, img, dst, src, x_size, y_size, offline_dst, offline_src);
+}
+
+static void
+lcd_copychar(gui_lcd_t* lcd, gui_layer_t* layer, void* dst, const void* src, gui_dim_t x_size, gui_dim_t y_size, gui_dim_t offline_dst, gui_dim_t offline_src, gui_color_t color) {
+    size_t stride = VGLITE_ALIGN((size_t)x_size, GUI_LL_VGLITE_STRIDE_ALIGN);
+    size_t size = VGLITE_ALIGN(stride * y_size, GUI_LL_VGLITE_ADDR_ALIGN);
+    const uint8_t* s = src;
+    uint8_t* d;
+    gui_dim_t y;
+
+    if (scratch != NULL && size <= GUI_LL_VGLITE_SCRATCH_SIZE) {
+        if (scratch_used + size > GUI_LL_VGLITE_SCRATCH_SIZE) {
+            vglite_sync();                  /* Reuse scratch memory when glyphs are drawn */
+        }
+
+        /* Copy glyph to aligned lines, GPU reads it as A8 image */
+        d = scratch + scratch_used;
+        for (y = 0; y < y_size; y++, s += x_size + offline_src, d += stride) {
+            memcpy(d, s, x_size);
+        }
+        if (vglite_blit(layer, dst, scratch + scratch_used, x_size, y_size, offline_dst, (gui_dim_t)(stride - x_size),
+                        VG_LITE_A8, 1, VG_LITE_BLEND_SRC_OVER, VG_LITE_MULTIPLY_IMAGE_MODE, vglite_color(color))) {
+            scratch_used += size;
+            return;
+        }
+    }
+    vglite_sync();
+    gui_ll_sw_copychar(lcd, layer, dst, src, x_size, y_size, offline_dst, offline_src, color);
+}
+
+static void
+lcd_setpixel(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_color_t color) {
+    vglite_sync();
+    gui_ll_sw_setpixel(lcd, layer, x, y, color);
+}
+
+static gui_color_t
+lcd_getpixel(gui_lcd_t* lcd, gui_layer_t* layer, gui_dim_t x, gui_dim_t y) {
+    vglite_sync();
+    return gui_ll_sw_getpixel(lcd, layer, x, y);
+}
+
+static uint8_t
+lcd_isready(gui_lcd_t* lcd) {
+    GUI_UNUSED(lcd);
+    vglite_sync();                          /* Blocks until GPU is idle */
+    return 1;
+}
+
+#if GUI_CFG_USE_LL_GPU
+
+/**
+ * \brief           Build rounded rectangle path in path memory
+ * \return          Number of used path words
+ */
+static size_t
+vglite_path_roundrect(float* p, float x, float y, float w, float h, float r) {
+    float k = r * (1.0f - VGLITE_KAPPA);
+    float* s = p;
+
+    *(uint32_t *)p++ = VLC_OP_MOVE;   *p++ = x + r;       *p++ = y;
+    *(uint32_t *)p++ = VLC_OP_LINE;   *p++ = x + w - r;   *p++ = y;
+    *(uint32_t *)p++ = VLC_OP_CUBIC;  *p++ = x + w - k;   *p++ = y;           *p++ = x + w;       *p++ = y + k;       *p++ = x + w;   *p++ = y + r;
+    *(uint32_t *)p++ = VLC_OP_LINE;   *p++ = x + w;       *p++ = y + h - r;
+    *(uint32_t *)p++ = VLC_OP_CUBIC;  *p++ = x + w;       *p++ = y + h - k;   *p++ = x + w - k;   *p++ = y + h;       *p++ = x + w - r; *p++ = y + h;
+    *(uint32_t *)p++ = VLC_OP_LINE;   *p++ = x + r;       *p++ = y + h;
+    *(uint32_t *)p++ = VLC_OP_CUBIC;  *p++ = x + k;       *p++ = y + h;       *p++ = x;           *p++ = y + h - k;   *p++ = x;       *p++ = y + h - r;
+    *(uint32_t *)p++ = VLC_OP_LINE;   *p++ = x;           *p++ = y + r;
+    *(uint32_t *)p++ = VLC_OP_CUBIC;  *p++ = x;           *p++ = y + k;       *p++ = x + k;       *p++ = y;           *p++ = x + r;   *p++ = y;
+    *(uint32_t *)p++ = VLC_OP_CLOSE;
+    *(uint32_t *)p++ = VLC_OP_END;
+    return (size_t)(p - s);
+}
+
+/**
+ * \brief           Initialize path with bounds of clipping region
+ */
+static void
+vglite_path(vg_lite_path_t* path, size_t words, const gui_display_t* clip) {
+    memset(path, 0x00, sizeof(*path));
+    vg_lite_init_path(path, VG_LITE_FP32, VG_LITE_HIGH, (uint32_t)(words * sizeof(float)), path_data,
+        (vg_lite_float_t)clip->x1, (vg_lite_float_t)clip->y1, (vg_lite_float_t)clip->x2, (vg_lite_float_t)clip->y2);
+}
+
+static uint8_t
+lcd_fillroundrect(gui_lcd_t* lcd, gui_layer_t* layer, const gui_display_t* clip, gui_dim_t x, gui_dim_t y, gui_dim_t w, gui_dim_t h, gui_dim_t r, gui_color_t color) {
+    vg_lite_buffer_t target;
+    vg_lite_matrix_t matrix;
+    vg_lite_path_t path;
+
+    GUI_UNUSED(lcd);
+    if (!vglite_target(layer, &target)) {
+        return 0;
+    }
+    vglite_path(&path, vglite_path_roundrect(path_data, x, y, w, h, r), clip);
+    vg_lite_identity(&matrix);
+    vglite_scissor(clip);
+    if (vg_lite_draw(&target, &path, VG_LITE_FILL_NON_ZERO, &matrix, VG_LITE_BLEND_SRC_OVER, vglite_color(color)) != VG_LITE_SUCCESS) {
+        return 0;
+    }
+    gpu_pending = 1;
+    return 1;
+}
+
+static uint8_t
+lcd_fillgradient(gui_lcd_t* lcd, gui_layer_t* layer, const gui_display_t* clip, gui_dim_t x, gui_dim_t y, gui_dim_t w, gui_dim_t h, gui_dim_t r, const gui_gradient_t* gradient) {
+    vg_lite_buffer_t target;
+    vg_lite_matrix_t matrix, *gm;
+    vg_lite_path_t path;
+    vg_lite_color_t colors[2];
+    uint32_t stops[2] = { 0, 255 };
+    size_t words;
+
+    GUI_UNUSED(lcd);
+    if (gradient->type == GUI_GRADIENT_RADIAL || !vglite_target(layer, &target)) {
+        return 0;                           /* Radial gradient stays on CPU */
+    }
+    if (r > 0) {
+        words = vglite_path_roundrect(path_data, x, y, w, h, r);
+    } else {
+        float* p = path_data;
+        *(uint32_t *)p++ = VLC_OP_MOVE;   *p++ = x;       *p++ = y;
+        *(uint32_t *)p++ = VLC_OP_LINE;   *p++ = x + w;   *p++ = y;
+        *(uint32_t *)p++ = VLC_OP_LINE;   *p++ = x + w;   *p++ = y + h;
+        *(uint32_t *)p++ = VLC_OP_LINE;   *p++ = x;       *p++ = y + h;
+        *(uint32_t *)p++ = VLC_OP_CLOSE;
+        *(uint32_t *)p++ = VLC_OP_END;
+        words = (size_t)(p - path_data);
+    }
+    vglite_path(&path, words, clip);
+
+    /* Ramp image is read by queued commands, update it only on idle GPU */
+    vglite_sync();
+    colors[0] = vglite_color(gradient->start);
+    colors[1] = vglite_color(gradient->stop);
+    vg_lite_set_grad(&grad, 2, colors, stops);
+    vg_lite_update_grad(&grad);
+
+    /* Ramp is 256 pixels along X axis, map it to gradient direction */
+    gm = vg_lite_get_grad_matrix(&grad);
+    vg_lite_identity(gm);
+    vg_lite_translate((vg_lite_float_t)x, (vg_lite_float_t)y, gm);
+    if (gradient->type == GUI_GRADIENT_VERTICAL) {
+        vg_lite_rotate(90.0f, gm);
+        vg_lite_scale((vg_lite_float_t)h / 256.0f, 1.0f, gm);
+    } else {
+        vg_lite_scale((vg_lite_float_t)w / 256.0f, 1.0f, gm);
+    }
+    vg_lite_identity(&matrix);
+    vglite_scissor(clip);
+    if (vg_lite_draw_gradient(&target, &path, VG_LITE_FILL_NON_ZERO, &matrix, &grad, VG_LITE_BLEND_SRC_OVER) != VG_LITE_SUCCESS) {
+        return 0;
+    }
+    gpu_pending = 1;
+    return 1;
+}
+
+static uint8_t
+lcd_fillpath(gui_lcd_t* lcd, gui_layer_t* layer, const gui_display_t* clip, const gui_icon_t* icon, gui_dim_t x, gui_dim_t y, gui_dim_t w, gui_dim_t h, gui_color_t color) {
+    static const uint8_t points[] = { 0, 1, 1, 2, 3 };
+    static const uint8_t ops[] = { VLC_OP_END, VLC_OP_MOVE, VLC_OP_LINE, VLC_OP_QUAD, VLC_OP_CUBIC };
+    vg_lite_buffer_t target;
+    vg_lite_matrix_t matrix;
+    vg_lite_path_t path;
+    const uint8_t* c = icon->path;
+    float* p = path_data;
+    uint8_t i, first = 1;
+
+    GUI_UNUSED(lcd);
+    if (!vglite_target(layer, &target)) {
+        return 0;
+    }
+
+    /* Icon commands map to VG-Lite opcodes, contours are closed before each move */
+    for (; *c != GUI_ICON_CMD_END; c += 1 + 2 * points[*c]) {
+        if (*c >= GUI_COUNT_OF(ops) || p + 2 + 2 * points[*c] >= path_data + VGLITE_PATH_SIZE) {
+            return 0;                       /* Unknown command or path too long, draw on CPU */
+        }
+        if (*c == GUI_ICON_CMD_MOVE && !first) {
+            *(uint32_t *)p++ = VLC_OP_CLOSE;
+        }
+        first = 0;
+        *(uint32_t *)p++ = ops[*c];
+        for (i = 0; i < 2 * points[*c]; i++) {
+            *p++ = (float)c[1 + i];
+        }
+    }
+    *(uint32_t *)p++ = VLC_OP_CLOSE;
+    *(uint32_t *)p++ = VLC_OP_END;
+    vglite_path(&path, (size_t)(p - path_data), clip);
+    path.bounding_box[0] = 0;               /* Bounds are in design grid units */
+    path.bounding_box[1] = 0;
+    path.bounding_box[2] = icon->width;
+    path.bounding_box[3] = icon->height;
+
+    vg_lite_identity(&matrix);
+    vg_lite_translate((vg_lite_float_t)x, (vg_lite_float_t)y, &matrix);
+    vg_lite_scale((vg_lite_float_t)w / icon->width, (vg_lite_float_t)h / icon->height, &matrix);
+    vglite_scissor(clip);
+    if (vg_lite_draw(&target, &path, VG_LITE_FILL_NON_ZERO, &matrix, VG_LITE_BLEND_SRC_OVER, vglite_color(color)) != VG_LITE_SUCCESS) {
+        return 0;
+    }
+    gpu_pending = 1;
+    return 1;
+}
+
+static uint8_t
+lcd_drawlineaa(gui_lcd_t* lcd, gui_layer_t* layer, const gui_display_t* clip, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_color_t color) {
+    vg_lite_buffer_t target;
+    vg_lite_matrix_t matrix;
+    vg_lite_path_t path;
+    float dx = (float)(x2 - x1), dy = (float)(y2 - y1), len, nx, ny;
+    float* p = path_data;
+
+    GUI_UNUSED(lcd);
+    if (!vglite_target(layer, &target)) {
+        return 0;
+    }
+    if (!gui_math_sqrt(dx * dx + dy * dy, &len) || len == 0.0f) {
+        return 0;
+    }
+
+    /* Line is polygon of 1 pixel width around pixel centers */
+    nx = -dy / len * 0.5f;
+    ny = dx / len * 0.5f;
+    *(uint32_t *)p++ = VLC_OP_MOVE;   *p++ = x1 + 0.5f + nx;  *p++ = y1 + 0.5f + ny;
+    *(uint32_t *)p++ = VLC_OP_LINE;   *p++ = x2 + 0.5f + nx;  *p++ = y2 + 0.5f + ny;
+    *(uint32_t *)p++ = VLC_OP_LINE;   *p++ = x2 + 0.5f - nx;  *p++ = y2 + 0.5f - ny;
+    *(uint32_t *)p++ = VLC_OP_LINE;   *p++ = x1 + 0.5f - nx;  *p++ = y1 + 0.5f - ny;
+    *(uint32_t *)p++ = VLC_OP_CLOSE;
+    *(uint32_t *)p++ = VLC_OP_END;
+    vglite_path(&path, (size_t)(p - path_data), clip);
+    vg_lite_identity(&matrix);
+    vglite_scissor(clip);
+    if (vg_lite_draw(&target, &path, VG_LITE_FILL_NON_ZERO, &matrix, VG_LITE_BLEND_SRC_OVER, vglite_color(color)) != VG_LITE_SUCCESS) {
+        return 0;
+    }
+    gpu_pending = 1;
+    return 1;
+}
+
+static uint8_t
+lcd_blittransform(gui_lcd_t* lcd, gui_layer_t* layer, const gui_display_t* clip, const gui_image_desc_t* img, gui_dim_t x, gui_dim_t y, const gui_image_transform_t* t) {
+    vg_lite_buffer_t target, source;
+    vg_lite_matrix_t matrix;
+    uint32_t rect[4];
+    gui_dim_t stride;
+
+    GUI_UNUSED(lcd);
+
+    /* Only memory mapped RGB565 images have matching GPU format */
+    if (img->bpp != 16 || img->compression != GUI_IMAGE_COMPRESSION_NONE || img->image == NULL || img->read != NULL
+        || !vglite_target(layer, &target)) {
+        return 0;
+    }
+    stride = img->stride ? img->stride : img->x_size;
+    if (!vglite_source(img->image, img->x_size, img->y_size, stride - img->x_size, VG_LITE_RGB565, 2, &source, rect)
+        || rect[0] != 0) {
+        return 0;                           /* Matrix works on full buffer, image must start aligned */
+    }
+
+    /* Scale first, then rotate around pivot placed at drawing position */
+    vg_lite_identity(&matrix);
+    vg_lite_translate((vg_lite_float_t)x, (vg_lite_float_t)y, &matrix);
+    vg_lite_rotate((vg_lite_float_t)t->angle / 10.0f, &matrix);
+    vg_lite_scale((vg_lite_float_t)t->scale_x / 256.0f, (vg_lite_float_t)t->scale_y / 256.0f, &matrix);
+    vg_lite_translate(-(vg_lite_float_t)t->pivot_x, -(vg_lite_float_t)t->pivot_y, &matrix);
+    vglite_scissor(clip);
+    if (vg_lite_blit(&target, &source, &matrix, VG_LITE_BLEND_SRC_OVER, 0,
+            (t->flags & GUI_FLAG_TRANSFORM_BILINEAR) ? VG_LITE_FILTER_BI_LINEAR : VG_LITE_FILTER_POINT) != VG_LITE_SUCCESS) {
+        return 0;
+    }
+    gpu_pending = 1;
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_LL_GPU */
+
+/**
+ * \brief           Low-Level control function
+ */
+uint8_t
+gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void* result) {
+    switch (cmd) {
+        case GUI_LL_Command_Init: {
+            uint8_t i = 0;
+            gui_ll_t* LL = (gui_ll_t *)param;
+            static gui_mem_region_t regions[] = {
+                {heap, sizeof(heap), GUI_MEM_CLASS_PIXEL}
+            };
+
+            vg_lite_set_command_buffer_size(GUI_LL_VGLITE_CMD_BUFFER_SIZE);
+            if (vg_lite_init(GUI_LL_VGLITE_TESS_SIZE, GUI_LL_VGLITE_TESS_SIZE) != VG_LITE_SUCCESS
+                || !vglite_board_init(frame_buffers[0], GUI_LL_VGLITE_WIDTH, GUI_LL_VGLITE_HEIGHT, LCD_PIXEL_SIZE)) {
+                if (result != NULL) {
+                    *(uint8_t *)result = 1;     /* Device is not available */
+                }
+                return 1;
+            }
+#if GUI_CFG_USE_LL_GPU
+            memset(&grad, 0x00, sizeof(grad));
+            vg_lite_init_grad(&grad);
+#endif /* GUI_CFG_USE_LL_GPU */
+            gui_mem_assignmemory(regions, GUI_COUNT_OF(regions));
+            scratch = GUI_MEMALLOC_CLASS(GUI_LL_VGLITE_SCRATCH_SIZE + GUI_LL_VGLITE_ADDR_ALIGN, GUI_MEM_CLASS_PIXEL);
+            if (scratch != NULL) {
+                scratch = (uint8_t *)VGLITE_ALIGN((uint32_t)scratch, GUI_LL_VGLITE_ADDR_ALIGN);
+            }
+
+            LCD->width = GUI_LL_VGLITE_WIDTH;
+            LCD->height = GUI_LL_VGLITE_HEIGHT;
+            LCD->pixel_size = LCD_PIXEL_SIZE;
+
+            LCD->layer_count = LCD_LAYERS;
+            LCD->layers = layers;
+            for (i = 0; i < LCD_LAYERS; i++) {
+                layers[i].num = i;
+#if GUI_LL_VGLITE_RGB565
+                layers[i].pixel_format = GUI_PIXEL_FORMAT_RGB565;
+#else
+                layers[i].pixel_format = GUI_PIXEL_FORMAT_ARGB8888;
+#endif
+                layers[i].start_address = frame_buffers[i];
+            }
+
+            gui_ll_sw_assign(LL);               /* Functions not listed below use software kernels */
+            LL->Init = lcd_init;
+            LL->IsReady = lcd_isready;
+            LL->SetPixel = lcd_setpixel;
+            LL->GetPixel = lcd_getpixel;
+            LL->Fill = lcd_fill;
+            LL->FillRect = lcd_fillrect;
+            LL->DrawHLine = lcd_drawhline;
+            LL->DrawVLine = lcd_drawvline;
+            LL->FillSpans = lcd_fillspans;
+            LL->Copy = lcd_copy;
+            LL->CopyBlend = lcd_copyblend;
+            LL->DrawImage16 = lcd_drawimage16;
+            LL->DrawImage24 = lcd_drawimage24;
+            LL->DrawImage32 = lcd_drawimage32;
+            LL->DrawImageL = NULL;              /* Indexed images are expanded by core */
+            LL->CopyChar = lcd_copychar;
+#if GUI_CFG_USE_LL_GPU
+            LL->FillRoundRect = lcd_fillroundrect;
+            LL->FillGradient = lcd_fillgradient;
+            LL->FillPath = lcd_fillpath;
+            LL->DrawLineAA = lcd_drawlineaa;
+            LL->BlitTransform = lcd_blittransform;
+#endif /* GUI_CFG_USE_LL_GPU */
+
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;
+        }
+#if GUI_CFG_USE_LL_GPU
+        case GUI_LL_Command_Submit: {
+            GUI_UNUSED(param);
+            if (gpu_pending) {
+                vg_lite_flush();                /* Start region, CPU continues with next one */
+            }
+            return 1;
+        }
+#endif /* GUI_CFG_USE_LL_GPU */
+        case GUI_LL_Command_SetActiveLayer: {
+            gui_layer_t* layer = *(gui_layer_t **)param;
+
+            vglite_sync();                      /* Layer may only be shown when all drawings are finished */
+            vglite_board_show(layer);
+            if (result != NULL) {
+                *(uint8_t *)result = 0;
+            }
+            return 1;                           /* Layer is confirmed by board from frame interrupt */
+        }
+        default:
+            return 0;
+    }
+}
+
+#endif /* !__DOXYGEN__ */
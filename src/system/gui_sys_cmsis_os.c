@@ -182,6 +182,11 @@ gui_sys_mbox_putnow(gui_sys_mbox_t* b, void* m) {
     return osMessagePut(*b, (uint32_t)m, 0) == osOK;
 }
 
+uint8_t
+gui_sys_mbox_putnow_isr(gui_sys_mbox_t* b, void* m) {
+    return osMessagePut(*b, (uint32_t)m, 0) == osOK;
+}
+
 uint8_t
 gui_sys_mbox_getnow(gui_sys_mbox_t* b, void** m) {
     osEvent evt;
@@ -0,0 +1,271 @@
+/**	
+ * \file            gui_sys_freertos.c
+ * \brief           System dependant functions for native FreeRTOS
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "system/gui_sys.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#if !__DOXYGEN__
+
+#if GUI_CFG_OS
+static SemaphoreHandle_t sys_mutex;
+
+/* Convert timeout in units of milliseconds to ticks, `0` means wait forever */
+static TickType_t
+ms_to_ticks(uint32_t ms) {
+    if (!ms) {
+        return portMAX_DELAY;
+    }
+    return (TickType_t)((ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS);  /* Never wait shorter than requested */
+}
+#endif /* GUI_CFG_OS */
+
+uint8_t
+gui_sys_init(void) {
+#if GUI_CFG_OS
+    gui_sys_mutex_create(&sys_mutex);
+#endif /* GUI_CFG_OS */
+    return 1;
+}
+
+uint32_t
+gui_sys_now(void) {
+    return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+}
+
+#if GUI_CFG_OS
+
+uint8_t
+gui_sys_protect(void) {
+    gui_sys_mutex_lock(&sys_mutex);
+    return 1;
+}
+
+uint8_t
+gui_sys_unprotect(void) {
+    gui_sys_mutex_unlock(&sys_mutex);
+    return 1;
+}
+
+uint8_t
+gui_sys_mutex_create(gui_sys_mutex_t* p) {
+    *p = xSemaphoreCreateRecursiveMutex();
+    return *p != NULL;
+}
+
+uint8_t
+gui_sys_mutex_delete(gui_sys_mutex_t* p) {
+    vSemaphoreDelete(*p);
+    return 1;
+}
+
+uint8_t
+gui_sys_mutex_lock(gui_sys_mutex_t* p) {
+    return xSemaphoreTakeRecursive(*p, portMAX_DELAY) == pdPASS;
+}
+
+uint8_t
+gui_sys_mutex_unlock(gui_sys_mutex_t* p) {
+    return xSemaphoreGiveRecursive(*p) == pdPASS;
+}
+
+uint8_t
+gui_sys_mutex_isvalid(gui_sys_mutex_t* p) {
+    return *p != NULL;
+}
+
+uint8_t
+gui_sys_mutex_invalid(gui_sys_mutex_t* p) {
+    *p = GUI_SYS_MUTEX_NULL;
+    return 1;
+}
+
+uint8_t
+gui_sys_sem_create(gui_sys_sem_t* p, uint8_t cnt) {
+    *p = xSemaphoreCreateBinary();
+    if (*p != NULL && cnt) {
+        xSemaphoreGive(*p);
+    }
+    return *p != NULL;
+}
+
+uint8_t
+gui_sys_sem_delete(gui_sys_sem_t* p) {
+    vSemaphoreDelete(*p);
+    return 1;
+}
+
+uint32_t
+gui_sys_sem_wait(gui_sys_sem_t* p, uint32_t timeout) {
+    uint32_t time = gui_sys_now();
+    return xSemaphoreTake(*p, ms_to_ticks(timeout)) == pdPASS ? (gui_sys_now() - time) : GUI_SYS_TIMEOUT;
+}
+
+uint8_t
+gui_sys_sem_release(gui_sys_sem_t* p) {
+    return xSemaphoreGive(*p) == pdPASS;
+}
+
+uint8_t
+gui_sys_sem_isvalid(gui_sys_sem_t* p) {
+    return *p != NULL;
+}
+
+uint8_t
+gui_sys_sem_invalid(gui_sys_sem_t* p) {
+    *p = GUI_SYS_SEM_NULL;
+    return 1;
+}
+
+uint8_t
+gui_sys_mbox_create(gui_sys_mbox_t* b, size_t size) {
+    *b = xQueueCreate((UBaseType_t)size, sizeof(void *));
+    return *b != NULL;
+}
+
+uint8_t
+gui_sys_mbox_delete(gui_sys_mbox_t* b) {
+    if (uxQueueMessagesWaiting(*b)) {
+        return 0;
+    }
+    vQueueDelete(*b);
+    return 1;
+}
+
+uint32_t
+gui_sys_mbox_put(gui_sys_mbox_t* b, void* m) {
+    uint32_t time = gui_sys_now();
+    return xQueueSend(*b, &m, portMAX_DELAY) == pdPASS ? (gui_sys_now() - time) : GUI_SYS_TIMEOUT;
+}
+
+uint32_t
+gui_sys_mbox_get(gui_sys_mbox_t* b, void** m, uint32_t timeout) {
+    uint32_t time = gui_sys_now();
+    return xQueueReceive(*b, m, ms_to_ticks(timeout)) == pdPASS ? (gui_sys_now() - time) : GUI_SYS_TIMEOUT;
+}
+
+uint8_t
+gui_sys_mbox_putnow(gui_sys_mbox_t* b, void* m) {
+    return xQueueSend(*b, &m, 0) == pdPASS;
+}
+
+uint8_t
+gui_sys_mbox_putnow_isr(gui_sys_mbox_t* b, void* m) {
+    BaseType_t woken = pdFALSE;
+    BaseType_t res;
+    
+    res = xQueueSendFromISR(*b, &m, &woken);
+    portYIELD_FROM_ISR(woken);
+    return res == pdPASS;
+}
+
+uint8_t
+gui_sys_mbox_getnow(gui_sys_mbox_t* b, void** m) {
+    return xQueueReceive(*b, m, 0) == pdPASS;
+}
+
+uint8_t
+gui_sys_mbox_isvalid(gui_sys_mbox_t* b) {
+    return *b != NULL;
+}
+
+uint8_t
+gui_sys_mbox_invalid(gui_sys_mbox_t* b) {
+    *b = GUI_SYS_MBOX_NULL;
+    return 1;
+}
+
+uint8_t
+gui_sys_thread_create(gui_sys_thread_t* t, const char* name, gui_sys_thread_fn thread_fn, void* const arg, size_t stack_size, gui_sys_thread_prio_t prio) {
+    TaskHandle_t tmp;
+    
+    /*
+     * Handle is written by kernel before new thread may run,
+     * so thread can be notified as soon as it waits.
+     * Stack size is in units of stack words, same as with CMSIS-OS port
+     */
+    return xTaskCreate(thread_fn, name, (configSTACK_DEPTH_TYPE)(stack_size ? stack_size : configMINIMAL_STACK_SIZE),
+            arg, prio, t != NULL ? t : &tmp) == pdPASS;
+}
+
+uint8_t
+gui_sys_thread_terminate(gui_sys_thread_t* t) {
+    vTaskDelete(t != NULL ? *t : NULL);         /* Terminate ourself with NULL */
+    return 1;
+}
+
+uint8_t
+gui_sys_thread_yield(void) {
+    taskYIELD();
+    return 1;
+}
+
+/*
+ * Wakeup reasons are set as bits in notification value of GUI thread.
+ * Setting bits never fails and never blocks, multiple
+ * wakeups before GUI thread runs are merged to single one
+ */
+uint8_t
+gui_sys_notify(gui_sys_thread_t* t, uint32_t bits) {
+    if (*t == NULL) {                           /* Thread not yet created */
+        return 0;
+    }
+    return xTaskNotify(*t, bits, eSetBits) == pdPASS;
+}
+
+uint8_t
+gui_sys_notify_isr(gui_sys_thread_t* t, uint32_t bits) {
+    BaseType_t woken = pdFALSE;
+    
+    if (*t == NULL) {
+        return 0;
+    }
+    xTaskNotifyFromISR(*t, bits, eSetBits, &woken);
+    portYIELD_FROM_ISR(woken);
+    return 1;
+}
+
+uint32_t
+gui_sys_notify_wait(uint32_t* bits, uint32_t timeout) {
+    uint32_t time = gui_sys_now();
+    return xTaskNotifyWait(0, 0xFFFFFFFFUL, bits, ms_to_ticks(timeout)) == pdPASS ? (gui_sys_now() - time) : GUI_SYS_TIMEOUT;
+}
+
+uint8_t
+gui_sys_notify_getnow(uint32_t* bits) {
+    return xTaskNotifyWait(0, 0xFFFFFFFFUL, bits, 0) == pdPASS;
+}
+
+#endif /* GUI_CFG_OS */
+#endif /* !__DOXYGEN__ */
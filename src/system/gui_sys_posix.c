@@ -0,0 +1,480 @@
+/**	
+ * \file            gui_sys_posix.c
+ * \brief           System dependant functions for POSIX systems
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define _GNU_SOURCE
+#include "system/gui_sys.h"
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sched.h>
+#include <limits.h>
+
+#if !__DOXYGEN__
+
+static struct timespec sys_start_time;
+
+#if GUI_CFG_OS
+
+#include <pthread.h>
+
+/**
+ * \brief           Binary semaphore, same as on other ports
+ */
+struct gui_sys_posix_sem {
+    pthread_mutex_t mutex;                      /*!< Protects count */
+    pthread_cond_t cond;                        /*!< Signals count change */
+    uint8_t cnt;                                /*!< Semaphore count, `0` or `1` */
+};
+
+/**
+ * \brief           Message queue with one lock, put and get are constant time
+ */
+struct gui_sys_posix_mbox {
+    pthread_mutex_t mutex;                      /*!< Lock of queue */
+    pthread_cond_t not_empty;                   /*!< Signals new entry */
+    pthread_cond_t not_full;                    /*!< Signals free slot */
+    size_t in, out, count, size;
+    void* entries[1];
+};
+
+/**
+ * \brief           Thread handle, POSIX thread function has different prototype
+ */
+struct gui_sys_posix_thread {
+    pthread_t th;                               /*!< POSIX thread */
+    gui_sys_thread_fn fn;                       /*!< GUI thread function */
+    void* arg;                                  /*!< GUI thread function argument */
+};
+
+static pthread_mutex_t sys_mutex;               /* Mutex for main protection */
+
+#endif /* GUI_CFG_OS */
+
+/**
+ * \brief           Get milliseconds from monotonic clock since start time
+ */
+static uint32_t
+sys_tick(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)((now.tv_sec - sys_start_time.tv_sec) * 1000
+        + (now.tv_nsec - sys_start_time.tv_nsec) / 1000000);
+}
+
+#if GUI_CFG_OS
+
+/**
+ * \brief           Initialize condition variable on monotonic clock
+ * \param[in]       cond: Condition variable to initialize
+ */
+static void
+cond_init(pthread_cond_t* cond) {
+    pthread_condattr_t attr;
+
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+/**
+ * \brief           Get absolute deadline from relative timeout
+ * \param[out]      ts: Deadline on monotonic clock
+ * \param[in]       timeout: Timeout in units of milliseconds
+ */
+static void
+get_deadline(struct timespec* ts, uint32_t timeout) {
+    clock_gettime(CLOCK_MONOTONIC, ts);
+    ts->tv_sec += timeout / 1000;
+    ts->tv_nsec += (long)(timeout % 1000) * 1000000L;
+    if (ts->tv_nsec >= 1000000000L) {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000L;
+    }
+}
+
+/**
+ * \brief           Thread entry calling GUI thread function
+ * \param[in]       arg: Thread handle
+ */
+static void*
+thread_entry(void* arg) {
+    struct gui_sys_posix_thread* t = arg;
+
+    t->fn(t->arg);
+    return NULL;
+}
+
+#endif /* GUI_CFG_OS */
+
+uint8_t
+gui_sys_init(void) {
+    clock_gettime(CLOCK_MONOTONIC, &sys_start_time);
+
+#if GUI_CFG_OS
+    {
+        pthread_mutexattr_t attr;
+
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);  /* Protection may be nested */
+        pthread_mutex_init(&sys_mutex, &attr);
+        pthread_mutexattr_destroy(&attr);
+    }
+#endif /* GUI_CFG_OS */
+    return 1;
+}
+
+uint32_t
+gui_sys_now(void) {
+    return sys_tick();
+}
+
+#if GUI_CFG_OS
+
+uint8_t
+gui_sys_protect(void) {
+    pthread_mutex_lock(&sys_mutex);
+    return 1;
+}
+
+uint8_t
+gui_sys_unprotect(void) {
+    pthread_mutex_unlock(&sys_mutex);
+    return 1;
+}
+
+uint8_t
+gui_sys_mutex_create(gui_sys_mutex_t* p) {
+    pthread_mutexattr_t attr;
+
+    *p = malloc(sizeof(**p));
+    if (*p == NULL) {
+        return 0;
+    }
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(*p, &attr);
+    pthread_mutexattr_destroy(&attr);
+    return 1;
+}
+
+uint8_t
+gui_sys_mutex_delete(gui_sys_mutex_t* p) {
+    pthread_mutex_destroy(*p);
+    free(*p);
+    *p = GUI_SYS_MUTEX_NULL;
+    return 1;
+}
+
+uint8_t
+gui_sys_mutex_lock(gui_sys_mutex_t* p) {
+    return pthread_mutex_lock(*p) == 0;
+}
+
+uint8_t
+gui_sys_mutex_unlock(gui_sys_mutex_t* p) {
+    return pthread_mutex_unlock(*p) == 0;
+}
+
+uint8_t
+gui_sys_mutex_isvalid(gui_sys_mutex_t* p) {
+    return *p != NULL;
+}
+
+uint8_t
+gui_sys_mutex_invalid(gui_sys_mutex_t* p) {
+    *p = GUI_SYS_MUTEX_NULL;
+    return 1;
+}
+
+uint8_t
+gui_sys_sem_create(gui_sys_sem_t* p, uint8_t cnt) {
+    *p = malloc(sizeof(**p));
+    if (*p == NULL) {
+        return 0;
+    }
+    pthread_mutex_init(&(*p)->mutex, NULL);
+    cond_init(&(*p)->cond);
+    (*p)->cnt = !!cnt;
+    return 1;
+}
+
+uint8_t
+gui_sys_sem_delete(gui_sys_sem_t* p) {
+    pthread_cond_destroy(&(*p)->cond);
+    pthread_mutex_destroy(&(*p)->mutex);
+    free(*p);
+    *p = GUI_SYS_SEM_NULL;
+    return 1;
+}
+
+uint32_t
+gui_sys_sem_wait(gui_sys_sem_t* p, uint32_t timeout) {
+    struct gui_sys_posix_sem* sem = *p;
+    struct timespec ts;
+    uint32_t tick = sys_tick();
+
+    if (timeout) {
+        get_deadline(&ts, timeout);
+    }
+    pthread_mutex_lock(&sem->mutex);
+    while (!sem->cnt) {
+        if (!timeout) {                         /* Timeout = 0 means unlimited time */
+            pthread_cond_wait(&sem->cond, &sem->mutex);
+        } else if (pthread_cond_timedwait(&sem->cond, &sem->mutex, &ts) != 0 && !sem->cnt) {
+            pthread_mutex_unlock(&sem->mutex);
+            return GUI_SYS_TIMEOUT;
+        }
+    }
+    sem->cnt = 0;
+    pthread_mutex_unlock(&sem->mutex);
+    return sys_tick() - tick;
+}
+
+uint8_t
+gui_sys_sem_release(gui_sys_sem_t* p) {
+    struct gui_sys_posix_sem* sem = *p;
+
+    pthread_mutex_lock(&sem->mutex);
+    sem->cnt = 1;
+    pthread_cond_signal(&sem->cond);
+    pthread_mutex_unlock(&sem->mutex);
+    return 1;
+}
+
+uint8_t
+gui_sys_sem_isvalid(gui_sys_sem_t* p) {
+    return *p != NULL;
+}
+
+uint8_t
+gui_sys_sem_invalid(gui_sys_sem_t* p) {
+    *p = GUI_SYS_SEM_NULL;
+    return 1;
+}
+
+uint8_t
+gui_sys_mbox_create(gui_sys_mbox_t* b, size_t size) {
+    struct gui_sys_posix_mbox* mbox;
+
+    *b = GUI_SYS_MBOX_NULL;
+    if (size == 0) {
+        return 0;
+    }
+    mbox = malloc(sizeof(*mbox) + size * sizeof(void *));
+    if (mbox != NULL) {
+        memset(mbox, 0x00, sizeof(*mbox));
+        mbox->size = size;
+        pthread_mutex_init(&mbox->mutex, NULL);
+        cond_init(&mbox->not_empty);
+        cond_init(&mbox->not_full);
+        *b = mbox;
+    }
+    return *b != NULL;
+}
+
+uint8_t
+gui_sys_mbox_delete(gui_sys_mbox_t* b) {
+    struct gui_sys_posix_mbox* mbox = *b;
+
+    pthread_cond_destroy(&mbox->not_full);
+    pthread_cond_destroy(&mbox->not_empty);
+    pthread_mutex_destroy(&mbox->mutex);
+    free(mbox);
+    *b = GUI_SYS_MBOX_NULL;
+    return 1;
+}
+
+/**
+ * \brief           Write entry to queue with free slot
+ * \note            Queue lock must be held
+ */
+static void
+mbox_write(struct gui_sys_posix_mbox* mbox, void* m) {
+    mbox->entries[mbox->in] = m;
+    if (++mbox->in >= mbox->size) {
+        mbox->in = 0;
+    }
+    mbox->count++;
+    pthread_cond_signal(&mbox->not_empty);
+}
+
+/**
+ * \brief           Read entry from non-empty queue
+ * \note            Queue lock must be held
+ */
+static void*
+mbox_read(struct gui_sys_posix_mbox* mbox) {
+    void* m = mbox->entries[mbox->out];
+    if (++mbox->out >= mbox->size) {
+        mbox->out = 0;
+    }
+    mbox->count--;
+    pthread_cond_signal(&mbox->not_full);
+    return m;
+}
+
+uint32_t
+gui_sys_mbox_put(gui_sys_mbox_t* b, void* m) {
+    struct gui_sys_posix_mbox* mbox = *b;
+    uint32_t time = sys_tick();
+
+    pthread_mutex_lock(&mbox->mutex);
+    while (mbox->count == mbox->size) {         /* Block until there is free slot */
+        pthread_cond_wait(&mbox->not_full, &mbox->mutex);
+    }
+    mbox_write(mbox, m);
+    pthread_mutex_unlock(&mbox->mutex);
+    return sys_tick() - time;
+}
+
+uint32_t
+gui_sys_mbox_get(gui_sys_mbox_t* b, void** m, uint32_t timeout) {
+    struct gui_sys_posix_mbox* mbox = *b;
+    struct timespec ts;
+    uint32_t time = sys_tick();
+
+    if (timeout) {
+        get_deadline(&ts, timeout);
+    }
+    pthread_mutex_lock(&mbox->mutex);
+    while (mbox->count == 0) {
+        if (!timeout) {                         /* Timeout = 0 means unlimited time */
+            pthread_cond_wait(&mbox->not_empty, &mbox->mutex);
+        } else if (pthread_cond_timedwait(&mbox->not_empty, &mbox->mutex, &ts) != 0 && mbox->count == 0) {
+            pthread_mutex_unlock(&mbox->mutex);
+            return GUI_SYS_TIMEOUT;
+        }
+    }
+    *m = mbox_read(mbox);
+    pthread_mutex_unlock(&mbox->mutex);
+    return sys_tick() - time;
+}
+
+uint8_t
+gui_sys_mbox_putnow(gui_sys_mbox_t* b, void* m) {
+    struct gui_sys_posix_mbox* mbox = *b;
+    uint8_t ret = 0;
+
+    pthread_mutex_lock(&mbox->mutex);
+    if (mbox->count < mbox->size) {
+        mbox_write(mbox, m);
+        ret = 1;
+    }
+    pthread_mutex_unlock(&mbox->mutex);
+    return ret;
+}
+
+uint8_t
+gui_sys_mbox_putnow_isr(gui_sys_mbox_t* b, void* m) {
+    return gui_sys_mbox_putnow(b, m);           /* Signal handlers must not use GUI */
+}
+
+uint8_t
+gui_sys_mbox_getnow(gui_sys_mbox_t* b, void** m) {
+    struct gui_sys_posix_mbox* mbox = *b;
+    uint8_t ret = 0;
+
+    pthread_mutex_lock(&mbox->mutex);
+    if (mbox->count > 0) {
+        *m = mbox_read(mbox);
+        ret = 1;
+    }
+    pthread_mutex_unlock(&mbox->mutex);
+    return ret;
+}
+
+uint8_t
+gui_sys_mbox_isvalid(gui_sys_mbox_t* b) {
+    return *b != NULL;
+}
+
+uint8_t
+gui_sys_mbox_invalid(gui_sys_mbox_t* b) {
+    *b = GUI_SYS_MBOX_NULL;
+    return 1;
+}
+
+uint8_t
+gui_sys_thread_create(gui_sys_thread_t* t, const char* name, gui_sys_thread_fn thread_fn, void* const arg, size_t stack_size, gui_sys_thread_prio_t prio) {
+    pthread_attr_t attr;
+    struct gui_sys_posix_thread* data;
+    size_t min_size = PTHREAD_STACK_MIN;
+    int res;
+
+    data = malloc(sizeof(*data));
+    if (data == NULL) {
+        return 0;
+    }
+    data->fn = thread_fn;
+    data->arg = arg;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    if (stack_size > 0) {
+        pthread_attr_setstacksize(&attr, stack_size > min_size ? stack_size : min_size);
+    }
+    res = pthread_create(&data->th, &attr, thread_entry, data);
+    pthread_attr_destroy(&attr);
+    if (res != 0) {
+        free(data);
+        return 0;
+    }
+#if defined(__GLIBC__)
+    if (name != NULL) {
+        pthread_setname_np(data->th, name);
+    }
+#endif /* defined(__GLIBC__) */
+    if (t != NULL) {
+        *t = data;
+    }
+    return 1;
+}
+
+uint8_t
+gui_sys_thread_terminate(gui_sys_thread_t* t) {
+    if (t == NULL) {                            /* Shall we terminate ourself? */
+        pthread_exit(NULL);
+    }
+    return pthread_cancel((*t)->th) == 0;
+}
+
+uint8_t
+gui_sys_thread_yield(void) {
+    sched_yield();
+    return 1;
+}
+
+#endif /* GUI_CFG_OS */
+#endif /* !__DOXYGEN__ */
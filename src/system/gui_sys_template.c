@@ -261,6 +261,18 @@ gui_sys_mbox_putnow(gui_sys_mbox_t* b, void* m) {
     return osMessagePut(*b, (uint32_t)m, 0) == osOK;/* Put new message without timeout */
 }
 
+/**
+ * \brief           Put a new entry to message queue from interrupt context without timeout (now or fail)
+ * \note            Function must never block. Use RTOS specific ISR version of queue put function
+ * \param[in]       b: Pointer to message queue structure
+ * \param[in]       m: Pointer to message to save to queue
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_sys_mbox_putnow_isr(gui_sys_mbox_t* b, void* m) {
+    return osMessagePut(*b, (uint32_t)m, 0) == osOK;/* CMSIS-OS put is allowed from interrupt with zero timeout */
+}
+
 /**
  * \brief           Get an entry from message queue immediatelly
  * \param[in]       b: Pointer to message queue structure
@@ -38,7 +38,18 @@
 
 #if !__DOXYGEN__
 
+/*
+ * Set to `1` to use virtual clock for GUI time, advanced by application
+ * with gui_sys_win32_advancetime. Automated tests then run faster than real time
+ */
+#ifndef GUI_SYS_WIN32_VIRTUAL_TIME
+#define GUI_SYS_WIN32_VIRTUAL_TIME          0
+#endif
+
 static LARGE_INTEGER freq, sys_start_time;
+#if GUI_SYS_WIN32_VIRTUAL_TIME
+static volatile uint32_t virtual_time;
+#endif /* GUI_SYS_WIN32_VIRTUAL_TIME */
 
 #if GUI_CFG_OS
 
@@ -95,7 +106,25 @@ gui_sys_init(void) {
 
 uint32_t
 gui_sys_now(void) {
+#if GUI_SYS_WIN32_VIRTUAL_TIME
+    return virtual_time;
+#else /* GUI_SYS_WIN32_VIRTUAL_TIME */
     return osKernelSysTick();
+#endif /* !GUI_SYS_WIN32_VIRTUAL_TIME */
+}
+
+/**
+ * \brief           Advance virtual clock returned by \ref gui_sys_now
+ * \note            Has no effect unless `GUI_SYS_WIN32_VIRTUAL_TIME` is set to `1`
+ * \param[in]       ms: Time to add in units of milliseconds
+ */
+void
+gui_sys_win32_advancetime(uint32_t ms) {
+#if GUI_SYS_WIN32_VIRTUAL_TIME
+    virtual_time += ms;
+#else /* GUI_SYS_WIN32_VIRTUAL_TIME */
+    (void)ms;
+#endif /* !GUI_SYS_WIN32_VIRTUAL_TIME */
 }
 
 #if GUI_CFG_OS
@@ -318,6 +347,11 @@ gui_sys_mbox_putnow(gui_sys_mbox_t* b, void* m) {
     return 1;
 }
 
+uint8_t
+gui_sys_mbox_putnow_isr(gui_sys_mbox_t* b, void* m) {
+    return gui_sys_mbox_putnow(b, m);       /* There are no interrupts on Windows */
+}
+
 uint8_t
 gui_sys_mbox_getnow(gui_sys_mbox_t* b, void** m) {
     win32_mbox_t* mbox = *b;
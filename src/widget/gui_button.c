@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "widget/gui_button.h"
 
+#if GUI_CFG_WIDGET_BUTTON || __DOXYGEN__
+
 /**
  * \ingroup         GUI_BUTTON
  * \brief           Button object structure
@@ -44,9 +46,13 @@ typedef struct {
     
     gui_dim_t borderwidth;                          /*!< Border width */
     gui_dim_t borderradius;                         /*!< Border radius */
+#if GUI_CFG_USE_NINEPATCH
+    const gui_ninepatch_t* skin[2];                 /*!< Background images for normal and active state */
+#endif /* GUI_CFG_USE_NINEPATCH */
 } gui_button_t;
 
 #define CFG_BORDER_RADIUS   0x01
+#define CFG_SKIN            0x02
 
 static uint8_t gui_button_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result);
 
@@ -60,6 +66,21 @@ gui_color_t colors[] = {
     GUI_COLOR_GRAY,                                 /*!< Default border color index in array */
 };
 
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+/**
+ * \brief           Widget events processed by callback, other events are not delivered to widget
+ */
+static const gui_widget_evt_fn
+evt_table[GUI_EVT_COUNT] = {
+    [GUI_EVT_PRE_INIT] = gui_button_callback,
+    [GUI_EVT_SETPARAM] = gui_button_callback,
+    [GUI_EVT_DRAW] = gui_button_callback,
+    [GUI_EVT_KEYPRESS] = gui_button_callback,
+    [GUI_EVT_ACTIVEIN] = gui_button_callback,
+    [GUI_EVT_ACTIVEOUT] = gui_button_callback,
+};
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
+
 /**
  * \brief           Widget initialization structure
  */
@@ -71,6 +92,9 @@ gui_widget_t widget = {
     .callback = gui_button_callback,                /*!< Callback function */
     .colors = colors,                               /*!< List of default colors */
     .color_count = GUI_COUNT_OF(colors),            /*!< Number of colors */
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+    .evt_table = evt_table,                         /*!< List of handled events */
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
 };
 
 /**
@@ -92,11 +116,21 @@ gui_button_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
         }
         case GUI_EVT_SETPARAM: {                    /* Set parameter for widget */
             gui_widget_param* p = GUI_EVT_PARAMTYPE_WIDGETPARAM(param);
+            uint8_t changed = 1;
             switch (p->type) {
-                case CFG_BORDER_RADIUS: b->borderradius = *(gui_dim_t *)p->data; break;
+                case CFG_BORDER_RADIUS:
+                    changed = b->borderradius != *(gui_dim_t *)p->data;
+                    b->borderradius = *(gui_dim_t *)p->data;
+                    break;
+#if GUI_CFG_USE_NINEPATCH
+                case CFG_SKIN:
+                    changed = memcmp(b->skin, p->data, sizeof(b->skin)) != 0;
+                    memcpy(b->skin, p->data, sizeof(b->skin));
+                    break;
+#endif /* GUI_CFG_USE_NINEPATCH */
                 default: break;
             }
-            GUI_EVT_RESULTTYPE_U8(result) = 1;      /* Save result */
+            GUI_EVT_RESULTTYPE_U8(result) = changed;/* Save result, skip invalidation when unchanged */
             return 1;
         }
         case GUI_EVT_DRAW: {
@@ -123,6 +157,15 @@ gui_button_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
             }
             
             /* Draw actual button structure */
+#if GUI_CFG_USE_NINEPATCH
+            if (b->skin[0] != NULL) {
+                const gui_ninepatch_t* skin = b->skin[0];
+                if (guii_widget_getflag(h, GUI_FLAG_ACTIVE) && b->skin[1] != NULL) {
+                    skin = b->skin[1];
+                }
+                gui_draw_ninepatch(disp, x, y, width, height, skin);
+            } else
+#endif /* GUI_CFG_USE_NINEPATCH */
             if (guii_widget_getflag(h, GUI_FLAG_3D)) {
                 gui_draw_filledrectangle(disp, x + 2, y + 2, width - 4, height - 4, c1);
                 gui_draw_rectangle3d(disp, x, y, width, height, guii_widget_getflag(h, GUI_FLAG_ACTIVE) ? GUI_DRAW_3D_State_Lowered : GUI_DRAW_3D_State_Raised);
@@ -143,6 +186,7 @@ gui_button_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
                 f.align = GUI_HALIGN_CENTER | GUI_VALIGN_CENTER;
                 f.color1width = f.width;
                 f.color1 = c2;
+                f.layout = guii_widget_gettextlayout(h); /* Reuse layout of widget text */
                 gui_draw_writetext(disp, gui_widget_getfont(h), gui_widget_gettext(h), &f);
             }
             return 1;
@@ -230,3 +274,26 @@ gui_button_set3dstyle(gui_handle_p h, uint8_t enable) {
     
     return 1;
 }
+
+#if GUI_CFG_USE_NINEPATCH || __DOXYGEN__
+
+/**
+ * \brief           Set nine-patch images drawn as button background instead of colors and border
+ * \param[in]       h: Widget handle
+ * \param[in]       normal: Background in normal state or `NULL` to draw with colors
+ * \param[in]       active: Background in pressed state or `NULL` to use `normal` background
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_button_setskin(gui_handle_p h, const gui_ninepatch_t* normal, const gui_ninepatch_t* active) {
+    const gui_ninepatch_t* skin[2];
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    
+    skin[0] = normal;
+    skin[1] = active;
+    return guii_widget_setparam(h, CFG_SKIN, skin, 1, 0);   /* Set parameter */
+}
+
+#endif /* GUI_CFG_USE_NINEPATCH || __DOXYGEN__ */
+
+#endif /* GUI_CFG_WIDGET_BUTTON || __DOXYGEN__ */
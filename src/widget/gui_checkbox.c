@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "widget/gui_checkbox.h"
 
+#if GUI_CFG_WIDGET_CHECKBOX || __DOXYGEN__
+
 /**
  * \ingroup         GUI_CHECKBOX
  * \name            GUI_CHECKBOX_FLAGS
@@ -64,6 +66,18 @@ typedef struct {
 
 static uint8_t gui_checkbox_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result);
 
+/**
+ * \brief           Check box look, used as sprite key
+ */
+typedef struct {
+    const gui_widget_t* type;                       /*!< Widget type, keeps sprites of different widgets apart */
+    gui_color_t bg;                                 /*!< Background color of box */
+    gui_color_t fg;                                 /*!< Color of check mark and focus rectangle */
+    gui_dim_t size;                                 /*!< Box size */
+    uint8_t checked;                                /*!< Set to `1` when check mark is drawn */
+    uint8_t focused;                                /*!< Set to `1` when focus rectangle is drawn */
+} gui_checkbox_sprite_t;
+
 /**
  * \brief           List of default color in the same order of widget color enumeration
  */
@@ -76,6 +90,20 @@ gui_color_t colors[] = {
     GUI_COLOR_BLACK,                                /*!< Default text color for widget */
 };
 
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+/**
+ * \brief           Widget events processed by callback, other events are not delivered to widget
+ */
+static const gui_widget_evt_fn
+evt_table[GUI_EVT_COUNT] = {
+    [GUI_EVT_SETPARAM] = gui_checkbox_callback,
+    [GUI_EVT_DRAW] = gui_checkbox_callback,
+    [GUI_EVT_CLICK] = gui_checkbox_callback,
+    [GUI_EVT_SAVESTATE] = gui_checkbox_callback,
+    [GUI_EVT_RESTORESTATE] = gui_checkbox_callback,
+};
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
+
 /**
  * \brief           Widget initialization structure
  */
@@ -87,6 +115,9 @@ gui_widget_t widget = {
     .callback = gui_checkbox_callback,              /*!< Callback function */
     .colors = colors,                               /*!< List of default colors */
     .color_count = GUI_COUNT_OF(colors),            /*!< Number of colors */
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+    .evt_table = evt_table,                         /*!< List of handled events */
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
 };
 
 /* Set checked status */
@@ -121,6 +152,36 @@ set_disabled(gui_handle_p h, uint8_t state) {
     return 0;
 }
 
+/**
+ * \brief           Draw check box without text
+ * \param[in]       disp: Clipping region
+ * \param[in]       sx: Top left X position of box
+ * \param[in]       sy: Top left Y position of box
+ * \param[in]       key: Check box look, \ref gui_checkbox_sprite_t structure
+ */
+static void
+checkbox_draw(const gui_display_t* disp, gui_dim_t sx, gui_dim_t sy, const void* key) {
+    const gui_checkbox_sprite_t* cb = key;
+    gui_dim_t size = cb->size;
+    
+    gui_draw_filledrectangle(disp, sx + 1, sy + 1, size - 2, size - 2, cb->bg);
+    gui_draw_rectangle3d(disp, sx, sy, size, size, GUI_DRAW_3D_State_Lowered);
+    
+    if (cb->focused) {                              /* When in focus */
+        gui_draw_rectangle(disp, sx + 2, sy + 2, size - 4, size - 4, cb->fg);
+    }
+    
+    if (cb->checked) {
+        gui_draw_line(disp, sx + 4, sy + 5, sx + size - 4 - 2, sy + size - 4 - 1, cb->fg);
+        gui_draw_line(disp, sx + 4, sy + 4, sx + size - 4 - 1, sy + size - 4 - 1, cb->fg);
+        gui_draw_line(disp, sx + 5, sy + 4, sx + size - 4 - 1, sy + size - 4 - 2, cb->fg);
+        
+        gui_draw_line(disp, sx + 4, sy + size - 4 - 2, sx + size - 4 - 2, sy + 4, cb->fg);
+        gui_draw_line(disp, sx + 4, sy + size - 4 - 1, sx + size - 4 - 1, sy + 4, cb->fg);
+        gui_draw_line(disp, sx + 5, sy + size - 4 - 1, sx + size - 4 - 1, sy + 5, cb->fg);
+    }
+}
+
 /**
  * \brief           Default widget callback function
  * \param[in]       h: Widget handle
@@ -135,20 +196,22 @@ gui_checkbox_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
     switch (evt) {
         case GUI_EVT_SETPARAM: {                    /* Set parameter for widget */
             gui_widget_param* p = GUI_EVT_PARAMTYPE_WIDGETPARAM(param);
+            uint8_t changed = 1;
             switch (p->type) {
                 case CFG_CHECK:                     /* Set current progress value */
                     set_checked(h, *(uint8_t *)p->data);
                     break;
                 case CFG_DISABLE:                   /* Set disabled status */
-                    set_disabled(h, *(uint8_t *)p->data);
+                    changed = set_disabled(h, *(uint8_t *)p->data);
                     break;
                 default: break;
             }
-            GUI_EVT_RESULTTYPE_U8(result) = 1;      /* Save result */
+            GUI_EVT_RESULTTYPE_U8(result) = changed;/* Save result, skip invalidation when unchanged */
             return 1;
         }
         case GUI_EVT_DRAW: {
             gui_display_t* disp = GUI_EVT_PARAMTYPE_DISP(param);
+            gui_checkbox_sprite_t sprite;
             gui_color_t c1;
             gui_dim_t x, y, width, height, size, sx, sy;
             
@@ -168,22 +231,16 @@ gui_checkbox_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                 c1 = guii_widget_getcolor(h, GUI_CHECKBOX_COLOR_BG);
             }
             
-            gui_draw_filledrectangle(disp, sx + 1, sy + 1, size - 2, size - 2, c1);
-            gui_draw_rectangle3d(disp, sx, sy, size, size, GUI_DRAW_3D_State_Lowered);
-            
-            if (guii_widget_isfocused(h) && !(o->flags & GUI_FLAG_CHECKBOX_DISABLED)) {    /* When in focus */
-                gui_draw_rectangle(disp, sx + 2, sy + 2, size - 4, size - 4, guii_widget_getcolor(h, GUI_CHECKBOX_COLOR_FG));
-            }
-            
-            if (o->flags & GUI_FLAG_CHECKBOX_CHECKED) {
-                gui_draw_line(disp, sx + 4, sy + 5, sx + size - 4 - 2, sy + size - 4 - 1, guii_widget_getcolor(h, GUI_CHECKBOX_COLOR_FG));
-                gui_draw_line(disp, sx + 4, sy + 4, sx + size - 4 - 1, sy + size - 4 - 1, guii_widget_getcolor(h, GUI_CHECKBOX_COLOR_FG));
-                gui_draw_line(disp, sx + 5, sy + 4, sx + size - 4 - 1, sy + size - 4 - 2, guii_widget_getcolor(h, GUI_CHECKBOX_COLOR_FG));
-                
-                gui_draw_line(disp, sx + 4, sy + size - 4 - 2, sx + size - 4 - 2, sy + 4, guii_widget_getcolor(h, GUI_CHECKBOX_COLOR_FG));
-                gui_draw_line(disp, sx + 4, sy + size - 4 - 1, sx + size - 4 - 1, sy + 4, guii_widget_getcolor(h, GUI_CHECKBOX_COLOR_FG));
-                gui_draw_line(disp, sx + 5, sy + size - 4 - 1, sx + size - 4 - 1, sy + 5, guii_widget_getcolor(h, GUI_CHECKBOX_COLOR_FG));
+            memset(&sprite, 0x00, sizeof(sprite));  /* Key is compared including padding */
+            sprite.type = &widget;
+            sprite.bg = c1;
+            sprite.size = size;
+            sprite.checked = !!(o->flags & GUI_FLAG_CHECKBOX_CHECKED);
+            sprite.focused = guii_widget_isfocused(h) && !(o->flags & GUI_FLAG_CHECKBOX_DISABLED);
+            if (sprite.checked || sprite.focused) {
+                sprite.fg = guii_widget_getcolor(h, GUI_CHECKBOX_COLOR_FG);
             }
+            guii_draw_sprite(disp, sx, sy, size, size, &sprite, sizeof(sprite), checkbox_draw);
             
             /* Draw text if possible */
             if (gui_widget_isfontandtextset(h)) {
@@ -197,6 +254,7 @@ gui_checkbox_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                 f.align = GUI_HALIGN_LEFT | GUI_VALIGN_CENTER;
                 f.color1width = f.width;
                 f.color1 = guii_widget_getcolor(h, GUI_CHECKBOX_COLOR_TEXT);
+                f.layout = guii_widget_gettextlayout(h); /* Reuse layout of widget text */
                 gui_draw_writetext(disp, gui_widget_getfont(h), gui_widget_gettext(h), &f);
             }
             
@@ -208,6 +266,16 @@ gui_checkbox_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
             }
             return 1;
         }
+        case GUI_EVT_SAVESTATE: {                   /* Save values to screen snapshot */
+            GUI_EVT_RESULTTYPE_U8(result) = guii_widget_savestate(GUI_EVT_PARAMTYPE_WIDGETPARAM(param),
+                &o->flags, sizeof(o->flags));
+            return 1;
+        }
+        case GUI_EVT_RESTORESTATE: {                /* Restore values from screen snapshot */
+            GUI_EVT_RESULTTYPE_U8(result) = guii_widget_restorestate(GUI_EVT_PARAMTYPE_WIDGETPARAM(param),
+                &o->flags, sizeof(o->flags));
+            return 1;
+        }
         default:                                    /* Handle default option */
             GUI_UNUSED3(h, param, result);          /* Unused elements to prevent compiler warnings */
             return 0;                               /* Command was not processed */
@@ -266,11 +334,12 @@ gui_checkbox_setchecked(gui_handle_p h, uint8_t checked) {
 uint8_t
 gui_checkbox_setdisabled(gui_handle_p h, uint8_t disabled) {
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
-    return guii_widget_setparam(h, CFG_DISABLE, &disabled, 0, 0);   /* Set parameter */
+    return guii_widget_setparam(h, CFG_DISABLE, &disabled, 1, 0);   /* Set parameter */
 }
 
 /**
  * \brief           Check if checkbox is checked
+ * \note            State is a single byte read without core protection and function may be called from any thread
  * \param[in]       h: Widget handle
  * \return          `1` on success, `0` otherwise
  */
@@ -292,3 +361,5 @@ gui_checkbox_isdisabled(gui_handle_p h) {
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
     return (o->flags & GUI_FLAG_CHECKBOX_DISABLED) == GUI_FLAG_CHECKBOX_DISABLED;
 }
+
+#endif /* GUI_CFG_WIDGET_CHECKBOX || __DOXYGEN__ */
@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "widget/gui_container.h"
 
+#if GUI_CFG_WIDGET_CONTAINER || __DOXYGEN__
+
 /**
  * \ingroup         GUI_CONTAINER
  * \brief           Container object structure
@@ -60,7 +62,7 @@ static const
 gui_widget_t widget = {
     .name = _GT("CONTAINER"),                       /*!< Widget name */
     .size = sizeof(gui_container_t),                /*!< Size of widget for memory allocation */
-    .flags = GUI_FLAG_WIDGET_ALLOW_CHILDREN,        /*!< List of widget flags */
+    .flags = GUI_FLAG_WIDGET_ALLOW_CHILDREN | GUI_FLAG_WIDGET_OPAQUE,   /*!< List of widget flags */
     .callback = gui_container_callback,             /*!< Control function */
     .colors = colors,                               /*!< Pointer to colors array */
     .color_count = GUI_COUNT_OF(colors),            /*!< Number of colors */
@@ -125,3 +127,5 @@ uint8_t
 gui_container_setcolor(gui_handle_p h, gui_container_color_t index, gui_color_t color) {
     return gui_widget_setcolor(h, (uint8_t)index, color);
 }
+
+#endif /* GUI_CFG_WIDGET_CONTAINER || __DOXYGEN__ */
@@ -36,6 +36,8 @@
 #include "widget/gui_debugbox.h"
 #include "widget/gui_widget_list.h"
 
+#if GUI_CFG_WIDGET_DEBUGBOX || __DOXYGEN__
+
 /**
  * \ingroup         GUI_DEBUGBOX
  * \name            GUI_DEBUGBOX_FLAGS
@@ -56,8 +58,19 @@
  */
 typedef struct {
     gui_linkedlist_t list;                          /*!< Linked list entry, must always be first on list */
+#if GUI_CFG_USE_MEM_MOVABLE || __DOXYGEN__
+    gui_mem_handle_t text;                          /*!< Handle of text entry in movable memory */
+#else /* GUI_CFG_USE_MEM_MOVABLE || __DOXYGEN__ */
     gui_char* text;                                 /*!< Text entry */
+#endif /* !(GUI_CFG_USE_MEM_MOVABLE || __DOXYGEN__) */
 } gui_debugbox_item_t;
+
+/* Get current address of item text */
+#if GUI_CFG_USE_MEM_MOVABLE || __DOXYGEN__
+#define item_text(item)             ((gui_char *)*(item)->text)
+#else /* GUI_CFG_USE_MEM_MOVABLE || __DOXYGEN__ */
+#define item_text(item)             ((item)->text)
+#endif /* !(GUI_CFG_USE_MEM_MOVABLE || __DOXYGEN__) */
     
 /**
  * \ingroup         GUI_DEBUGBOX
@@ -71,6 +84,19 @@ typedef struct {
     
     gui_dim_t sliderwidth;                          /*!< Slider width in units of pixels */
     uint8_t flags;                                  /*!< Widget flags */
+    
+    size_t* ring_lines;                             /*!< Offsets of lines in text ring, followed by text ring in the same memory block.
+                                                        Set to `NULL` when each line is allocated as separate list item */
+    gui_char* ring;                                 /*!< Text ring with `NULL` terminated lines */
+    size_t ring_size;                               /*!< Size of text ring in units of bytes */
+    size_t ring_head;                               /*!< Offset in text ring to write next line to */
+    int16_t ring_first;                             /*!< Index of oldest line in array of offsets */
+    int16_t ring_capacity;                          /*!< Number of entries in array of offsets */
+    
+    gui_buff_t* stream;                             /*!< Buffer with text written by other threads, see \ref gui_debugbox_setstream */
+    gui_char* stream_line;                          /*!< Line read from stream and not yet terminated */
+    size_t stream_line_size;                        /*!< Size of line memory in units of bytes */
+    size_t stream_line_len;                         /*!< Number of bytes in line read so far */
 } gui_debugbox_t;
 
 static uint8_t gui_debugbox_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result);
@@ -156,10 +182,201 @@ check_values(gui_handle_p h) {
  */
 static uint8_t
 remove_item(gui_handle_p h, void* element) {
+#if GUI_CFG_USE_MEM_MOVABLE
+    gui_mem_movable_free(((gui_debugbox_item_t *)element)->text);
+#endif /* GUI_CFG_USE_MEM_MOVABLE */
     GUI_MEMFREE(element);
     return 1;
 }
 
+/**
+ * \brief           Get text of line stored in text ring
+ * \param[in]       o: Debugbox object
+ * \param[in]       index: Line index, `0` is the oldest line
+ * \return          Line text
+ */
+static const gui_char*
+ring_get_line(gui_debugbox_t* o, int16_t index) {
+    return o->ring + o->ring_lines[(o->ring_first + index) % o->ring_capacity];
+}
+
+/**
+ * \brief           Remove oldest line from text ring
+ * \param[in]       o: Debugbox object
+ */
+static void
+ring_remove_oldest(gui_debugbox_t* o) {
+    o->ring_first = (o->ring_first + 1) % o->ring_capacity;
+    o->ld.count--;
+}
+
+/**
+ * \brief           Copy line to text ring, oldest lines are overwritten when there is no space for it
+ * \param[in]       o: Debugbox object
+ * \param[in]       text: Line text
+ * \return          Number of lines removed to make space for new line
+ */
+static int16_t
+ring_add_line(gui_debugbox_t* o, const gui_char* text) {
+    size_t len = gui_string_lengthtotal(text) + 1, pos = o->ring_head, first;
+    int16_t removed = 0;
+    
+    if (pos + len > o->ring_size) {                 /* Line does not fit to end of ring, continue at start */
+        while (o->ld.count > 0 && o->ring_lines[o->ring_first] >= pos) {
+            ring_remove_oldest(o);                  /* Lines after head are the oldest ones */
+            removed++;
+        }
+        pos = 0;
+    }
+    while (o->ld.count > 0) {
+        first = o->ring_lines[o->ring_first];
+        if (o->ld.count < o->ring_capacity          /* Free entry for line offset */
+            && (first >= pos + len || first + gui_string_lengthtotal(o->ring + first) + 1 <= pos)) {
+            break;                                  /* Oldest line is not overwritten */
+        }
+        ring_remove_oldest(o);
+        removed++;
+    }
+    memcpy(o->ring + pos, text, len);
+    o->ring_lines[(o->ring_first + o->ld.count) % o->ring_capacity] = pos;
+    o->ring_head = pos + len;
+    o->ld.count++;
+    return removed;
+}
+
+/**
+ * \brief           Add line to text ring and update top visible line
+ *
+ *                  View keeps following last line when it was visible before,
+ *                  otherwise the same lines stay visible as long as they are not overwritten
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       text: Line text
+ * \return          Number of lines removed to make space for new line
+ */
+static int16_t
+ring_add(gui_handle_p h, const gui_char* text) {
+    gui_debugbox_t* o = GUI_VP(h);
+    int16_t removed, start;
+    uint8_t at_bottom;
+    
+    start = gui_widget_list_get_visible_start_index(h, &o->ld);
+    at_bottom = start + gui_widget_list_get_count_pp(h, &o->ld) >= gui_widget_list_get_count(h, &o->ld);
+    removed = ring_add_line(o, text);
+    if (at_bottom) {                                /* Keep last line visible */
+        gui_widget_list_set_visible_start_index(h, &o->ld, gui_widget_list_get_count(h, &o->ld));
+    } else {                                        /* Keep the same lines visible */
+        gui_widget_list_set_visible_start_index(h, &o->ld, GUI_MAX(start - removed, 0));
+    }
+    gui_widget_list_check_values(h, &o->ld);
+    return removed;
+}
+
+/**
+ * \brief           Redraw only lines changed by adding new lines to text ring
+ *
+ *                  Visible lines which are still on screen are shifted up by copying pixels,
+ *                  new lines and scroll bar are redrawn
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       removed: Number of oldest lines removed when lines were added
+ * \param[in]       prev_start: Top visible line index before lines were added
+ * \param[in]       prev_count: Number of lines before lines were added
+ * \param[in]       prev_flags: Widget flags before lines were added
+ */
+static void
+ring_invalidate(gui_handle_p h, int16_t removed, int16_t prev_start, int16_t prev_count, uint8_t prev_flags) {
+    gui_debugbox_t* o = GUI_VP(h);
+    gui_dim_t width, height, itemheight, text_width;
+    int16_t pp, start, shift, first_new;
+    
+    pp = gui_widget_list_get_count_pp(h, &o->ld);
+    start = gui_widget_list_get_visible_start_index(h, &o->ld);
+    shift = removed + start - prev_start;           /* Number of lines to move visible lines up by */
+    if (h->font == NULL || pp <= 0 || shift < 0 || shift >= pp
+        || ((o->flags ^ prev_flags) & GUI_FLAG_DEBUGBOX_SLIDER_ON)) {
+        gui_widget_invalidate(h);                   /* Complete layout has changed */
+        return;
+    }
+    width = gui_widget_getwidth(h);
+    height = gui_widget_getheight(h);
+    itemheight = item_height(h, NULL);
+    text_width = (o->flags & GUI_FLAG_DEBUGBOX_SLIDER_ON) ? (width - o->sliderwidth - 3) : (width - 4);
+    
+    gui_widget_invalidate_begin();
+    if (shift > 0) {
+        gui_widget_scrollarea(h, 2, 2, text_width, height - 4, -shift * itemheight);
+        gui_widget_invalidatearea(h, 2 + text_width, 0, width - 2 - text_width, height);   /* Scroll bar and right border */
+    } else if (o->flags & GUI_FLAG_DEBUGBOX_SLIDER_ON) {
+        gui_widget_invalidatearea(h, 2 + text_width, 0, width - 2 - text_width, height);
+    }
+    
+    /* Redraw lines not shown on previous frame and lines at bottom of widget */
+    first_new = GUI_MIN(prev_count - removed - start, pp - shift);
+    first_new = GUI_MAX(first_new, 0);
+    if (2 + first_new * itemheight < height - 2) {
+        gui_widget_invalidatearea(h, 2, 2 + first_new * itemheight, width - 2, height - 4 - first_new * itemheight);   /* Text may overlap right border */
+    }
+    gui_widget_invalidate_end();
+}
+
+/**
+ * \brief           Read text written to stream and add complete lines to widget
+ *
+ *                  All lines read in single call are redrawn together
+ *
+ * \param[in]       timer: Widget timer
+ */
+static void
+stream_timer_callback(gui_timer_t* timer) {
+    gui_handle_p h = guii_timer_getparams(timer);
+    gui_debugbox_t* o = GUI_VP(h);
+    int16_t removed = 0, prev_start, prev_count;
+    uint8_t prev_flags, added = 0;
+    const uint8_t* data;
+    uint32_t i, len;
+    
+    if (o->stream == NULL || !gui_buffer_getfull(o->stream)) {
+        return;
+    }
+    prev_start = gui_widget_list_get_visible_start_index(h, &o->ld);
+    prev_count = gui_widget_list_get_count(h, &o->ld);
+    prev_flags = o->flags;
+    
+    gui_widget_invalidate_begin();
+    while ((len = gui_buffer_getlinearblockreadlength(o->stream)) > 0) {  /* Process text in place */
+        data = gui_buffer_getlinearblockreadaddress(o->stream);
+        for (i = 0; i < len; i++) {
+            if (data[i] == '\r') {
+                continue;
+            }
+            if (data[i] != '\n') {
+                o->stream_line[o->stream_line_len++] = data[i];
+                if (o->stream_line_len < o->stream_line_size - 1) {
+                    continue;
+                }
+            }
+            
+            /* Line is complete on new line character or when line memory is full */
+            o->stream_line[o->stream_line_len] = 0;
+            o->stream_line_len = 0;
+            if (o->ring_lines != NULL) {
+                if (gui_string_lengthtotal(o->stream_line) < o->ring_size) {
+                    removed += ring_add(h, o->stream_line);
+                    added = 1;
+                }
+            } else {
+                gui_debugbox_addstring(h, o->stream_line);
+            }
+        }
+        gui_buffer_skip(o->stream, len);            /* Release memory to writer */
+    }
+    if (added) {
+        ring_invalidate(h, removed, prev_start, prev_count, prev_flags);
+    }
+    gui_widget_invalidate_end();
+}
+
 /**
  * \brief           Default widget callback function
  * \param[in]       h: Widget handle
@@ -222,7 +439,7 @@ gui_debugbox_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
             /* Draw text if possible */
             if (h->font != NULL && gui_widget_list_get_count(h, &o->ld)) {
                 gui_draw_text_t f;
-                gui_debugbox_item_t* item;
+                gui_debugbox_item_t* item = NULL;
                 uint16_t itemheight;
                 int16_t index;
                 gui_dim_t tmp;
@@ -244,11 +461,21 @@ gui_debugbox_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                 }
                 
                 /* Draw list items */
-                for (item = gui_widget_list_get_first_visible_item(h, &o->ld, &index); item != NULL && f.y <= disp->y2;
-                        item = gui_widget_list_get_next_item(h, &o->ld, item), index++) {
-                            
+                if (o->ring_lines != NULL) {
+                    f.color1 = guii_widget_getcolor(h, GUI_DEBUGBOX_COLOR_TEXT);
+                    for (index = gui_widget_list_get_visible_start_index(h, &o->ld);
+                            index < gui_widget_list_get_count(h, &o->ld) && f.y <= disp->y2; index++) {
+                        if (f.y + (gui_dim_t)itemheight > disp->y1) {   /* Skip lines above drawing area */
+                            gui_draw_writetext(disp, gui_widget_getfont(h), ring_get_line(o, index), &f);
+                        }
+                        f.y += itemheight;
+                    }
+                } else {
+                    item = gui_widget_list_get_first_visible_item(h, &o->ld, &index);
+                }
+                for (; item != NULL && f.y <= disp->y2; item = gui_widget_list_get_next_item(h, &o->ld, item), index++) {
                     f.color1 = guii_widget_getcolor(h, GUI_DEBUGBOX_COLOR_TEXT);
-                    gui_draw_writetext(disp, gui_widget_getfont(h), item->text, &f);
+                    gui_draw_writetext(disp, gui_widget_getfont(h), item_text(item), &f);
                     f.y += itemheight;
                 }
                 disp->y2 = tmp;
@@ -256,9 +483,19 @@ gui_debugbox_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
             
             return 1;
         }
+        case GUI_EVT_CLONE: {                       /* Widget copied from prototype */
+            GUI_EVT_RESULTTYPE_U8(result) = 0;      /* Lines belong to prototype, widget cannot be copied */
+            return 1;
+        }
         case GUI_EVT_REMOVE: {
             /* Remove all items */
             gui_widget_list_remove_items(h, &o->ld);
+            if (o->ring_lines != NULL) {
+                GUI_MEMFREE(o->ring_lines);
+            }
+            if (o->stream_line != NULL) {
+                GUI_MEMFREE(o->stream_line);
+            }
             return 1;
         }
 #if GUI_CFG_USE_TOUCH
@@ -331,10 +568,33 @@ gui_debugbox_addstring(gui_handle_p h, const gui_char* text) {
     
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
 
+    if (o->ring_lines != NULL) {
+        int16_t prev_start, prev_count;
+        uint8_t prev_flags;
+        
+        if (gui_string_lengthtotal(text) >= o->ring_size) {
+            return 0;                               /* Line cannot fit to text ring */
+        }
+        prev_start = gui_widget_list_get_visible_start_index(h, &o->ld);
+        prev_count = gui_widget_list_get_count(h, &o->ld);
+        prev_flags = o->flags;
+        ring_invalidate(h, ring_add(h, text), prev_start, prev_count, prev_flags);
+        return 1;
+    }
+
+#if GUI_CFG_USE_MEM_MOVABLE
+    item = GUI_MEMALLOC(sizeof(*item));             /* Only fixed size item stays in place */
+    if (item != NULL && (item->text = gui_mem_movable_alloc(sizeof(*text) * (gui_string_lengthtotal(text) + 1))) == NULL) {
+        GUI_MEMFREE(item);
+    }
+#else /* GUI_CFG_USE_MEM_MOVABLE */
     item = GUI_MEMALLOC(GUI_MEM_ALIGN(sizeof(*item)) + sizeof(*text) * (gui_string_lengthtotal(text) + 1));
     if (item != NULL) {
         item->text = (void *)((char *)item + GUI_MEM_ALIGN(sizeof(*item)));
-        gui_string_copy(item->text, text);
+    }
+#endif /* !GUI_CFG_USE_MEM_MOVABLE */
+    if (item != NULL) {
+        gui_string_copy(item_text(item), text);
         gui_widget_list_add_item(h, &o->ld, item);
         
         /*
@@ -382,5 +642,143 @@ gui_debugbox_setmaxitems(gui_handle_p h, int16_t max_items) {
     gui_debugbox_t* o = GUI_VP(h);
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && max_items > 0);
     o->maxcount = max_items;
+    if (o->ring_lines != NULL && o->ring_capacity != max_items) {
+        return gui_debugbox_setringbuffer(h, o->ring_size);  /* New array of line offsets is required */
+    }
+    return 1;
+}
+
+/**
+ * \brief           Store lines in single text ring instead of allocating memory for each line
+ *
+ *                  Memory for text and for offsets of maximal number of lines is allocated once.
+ *                  When new line does not fit, the oldest lines are overwritten by it.
+ *                  Lines already on screen are shifted by copying pixels when new line is added
+ *
+ * \note            All existing lines are removed. Set maximal number of lines
+ *                  with \ref gui_debugbox_setmaxitems first to avoid new allocation
+ * \param[in]       h: Widget handle
+ * \param[in]       size: Size of text ring in units of bytes.
+ *                      Set to `0` to allocate separate memory for each line again
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_debugbox_setringbuffer(gui_handle_p h, size_t size) {
+    gui_debugbox_t* o = GUI_VP(h);
+    size_t* lines = NULL;
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    
+    if (size > 0) {
+        lines = GUI_MEMALLOC(GUI_MEM_ALIGN(sizeof(*lines) * o->maxcount) + size);
+        if (lines == NULL) {
+            return 0;
+        }
+    }
+    gui_widget_list_remove_items(h, &o->ld);        /* Remove items of previous mode */
+    if (o->ring_lines != NULL) {
+        GUI_MEMFREE(o->ring_lines);
+    }
+    o->ring_lines = lines;
+    o->ring = lines != NULL ? (void *)((char *)lines + GUI_MEM_ALIGN(sizeof(*lines) * o->maxcount)) : NULL;
+    o->ring_size = size;
+    o->ring_head = 0;
+    o->ring_first = 0;
+    o->ring_capacity = lines != NULL ? o->maxcount : 0;
+    o->ld.is_virtual = lines != NULL;               /* Lines are not stored as list items */
+    gui_widget_list_set_visible_start_index(h, &o->ld, 0);
+    gui_widget_list_check_values(h, &o->ld);
+    gui_widget_invalidate(h);
+    return 1;
+}
+
+/**
+ * \brief           Show text written to ring buffer by other threads
+ *
+ *                  Buffer is read by widget periodically, at most once per
+ *                  \ref GUI_CFG_DEBUGBOX_STREAM_PERIOD, and complete lines are added to widget.
+ *                  Lines read at once are redrawn together.
+ *                  Use with \ref gui_debugbox_setringbuffer to add lines without allocations
+ *
+ * \note            Buffer may be written by single thread with \ref gui_buffer_write
+ *                  without GUI protection, it must not be written from multiple threads at a time
+ * \param[in]       h: Widget handle
+ * \param[in]       buff: Initialized buffer to read text from. Set to `NULL` to stop reading
+ * \param[in]       line_size: Maximal length of single line including `NULL` termination.
+ *                      Longer lines are split
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_debugbox_setstream(gui_handle_p h, gui_buff_t* buff, size_t line_size) {
+    gui_debugbox_t* o = GUI_VP(h);
+    gui_char* line = NULL;
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && (buff == NULL || line_size > 1));
+    
+    if (buff != NULL) {
+        line = GUI_MEMALLOC(line_size);
+        if (line == NULL) {
+            return 0;
+        }
+        if (guii_widget_getextvalue(h, timer) == NULL) {
+            if (guii_widget_hasext(h, 1)) {         /* Timer is kept in optional widget data */
+                guii_widget_getext(h)->timer = guii_timer_create(GUI_CFG_DEBUGBOX_STREAM_PERIOD, stream_timer_callback, h);
+            }
+            if (guii_widget_getextvalue(h, timer) == NULL) {
+                GUI_MEMFREE(line);
+                return 0;
+            }
+        }
+        guii_timer_startperiodic(guii_widget_getext(h)->timer);
+    } else if (guii_widget_getextvalue(h, timer) != NULL) {
+        guii_timer_stop(guii_widget_getext(h)->timer);
+    }
+    if (o->stream_line != NULL) {
+        GUI_MEMFREE(o->stream_line);
+    }
+    o->stream = buff;
+    o->stream_line = line;
+    o->stream_line_size = line_size;
+    o->stream_line_len = 0;
     return 1;
 }
+
+/**
+ * \brief           Add profiler summary of last frame and draw cost of widget types to debugbox
+ * \note            Available only when \ref GUI_CFG_USE_PROFILER is enabled
+ * \param[in]       h: Widget handle
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_debugbox_addprofilerstats(gui_handle_p h) {
+#if GUI_CFG_USE_PROFILER
+    gui_profiler_frame_t frame;
+    gui_profiler_entry_t types[GUI_CFG_PROFILER_TYPES];
+    char buff[128];
+    size_t i, cnt;
+    uint8_t ret;
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    
+    if (!gui_profiler_getframes(&frame, 1)) {
+        return 0;
+    }
+    sprintf(buff, "Frame: %lu redraw, %lu draw, %lu widgets, %lu touch, %lu timers",
+        (unsigned long)frame.redraw_cycles, (unsigned long)frame.draw_cycles, (unsigned long)frame.widgets,
+        (unsigned long)frame.touch_cycles, (unsigned long)frame.timer_cycles);
+    ret = gui_debugbox_addstring(h, _GT(buff));
+    
+    cnt = gui_profiler_getwidgets(types, GUI_CFG_PROFILER_TYPES, 0);
+    for (i = 0; i < cnt && ret; i++) {
+        sprintf(buff, "%.24s: %lu calls, %lu cycles", (const char *)types[i].widget->name,
+            (unsigned long)types[i].count, (unsigned long)types[i].cycles);
+        ret = gui_debugbox_addstring(h, _GT(buff));
+    }
+    return ret;
+#else /* GUI_CFG_USE_PROFILER */
+    GUI_UNUSED(h);
+    return 0;
+#endif /* !GUI_CFG_USE_PROFILER */
+}
+
+#endif /* GUI_CFG_WIDGET_DEBUGBOX || __DOXYGEN__ */
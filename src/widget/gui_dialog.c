@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "widget/gui_dialog.h"
 
+#if GUI_CFG_WIDGET_DIALOG || __DOXYGEN__
+
 /**
  * \ingroup         GUI_DIALOG
  * \brief           Dialog object structure
@@ -159,12 +161,14 @@ gui_dialog_create(gui_id_t id, float x, float y, float width, float height, gui_
     }
 
     /* Create base widget for dialog */
+    gui_widget_popup_begin(NULL);                   /* Save pixels below dialog */
     ptr = func(id, x, y, width, height, NULL, evt_fn, flags | GUI_FLAG_WIDGET_CREATE_PARENT_DESKTOP);
     if (ptr != NULL) {
         guii_widget_setflag(ptr, GUI_FLAG_WIDGET_DIALOG_BASE); /* Add dialog base flag to widget */
         gui_linkedlist_widgetmovetobottom(ptr);     /* Move to bottom on linked list make it on top now with flag set as dialog */
         add_to_active_dialogs(ptr);                 /* Add this dialog to active dialogs */
     }
+    gui_widget_popup_end(ptr);
     
     return (gui_handle_p)ptr;
 }
@@ -248,8 +252,11 @@ gui_dialog_dismiss(gui_handle_p h, int status) {
         {
             remove_from_active_dialogs(l);          /* Remove from active dialogs */
         }
+        gui_widget_popup_close(h);                  /* Restore pixels below dialog instead of redraw */
         gui_widget_remove(&h);                      /* Remove widget */
     }
 
     return ret;
 }
+
+#endif /* GUI_CFG_WIDGET_DIALOG || __DOXYGEN__ */
@@ -36,6 +36,8 @@
 #include "widget/gui_dropdown.h"
 #include "widget/gui_widget_list.h"
 
+#if GUI_CFG_WIDGET_DROPDOWN || __DOXYGEN__
+
 /**
  * \ingroup         GUI_DROPDOWN
  * \name            GUI_DROPDOWN_FLAGS Flags
@@ -173,6 +175,7 @@ static uint8_t
 open_close(gui_handle_p h, uint8_t state) {
     gui_dropdown_t* o = GUI_VP(h);
     if (state && !is_opened(h)) {
+        gui_widget_popup_begin(h);                  /* Save pixels below opened list */
         o->flags |= GUI_FLAG_DROPDOWN_OPENED;
         if (is_dir_up(h)) {                         /* Width is opening to up */
             uint8_t is_percent;
@@ -185,9 +188,14 @@ open_close(gui_handle_p h, uint8_t state) {
 
         /* Set new height */
         gui_widget_setheightoriginal(h, HEIGHT_CONST(h) * gui_widget_getheightoriginal(h, NULL));
+        gui_widget_popup_end(h);
         return 1;
     } else if (!state && is_opened(h)) {
+        gui_widget_popup_close(h);                  /* Restore pixels below list instead of redraw */
         o->flags &= ~GUI_FLAG_DROPDOWN_OPENED;
+#if GUI_CFG_USE_TOUCH
+        gui_widget_kinetic_stop(h, &o->ld.kinetic); /* Closed list can't scroll */
+#endif /* GUI_CFG_USE_TOUCH */
 
         /* Set height back to "normal" */
         gui_widget_setheightoriginal(h, gui_widget_getheightoriginal(h, NULL) / HEIGHT_CONST(h));
@@ -227,6 +235,77 @@ check_values(gui_handle_p h) {
     return 1;
 }
 
+/**
+ * \brief           Get text of item
+ * \param[in]       h: Widget handle
+ * \param[in]       item: Stored item or `NULL` when items are shown from model
+ * \param[in]       index: Item index
+ * \return          Item text or `NULL` if item is empty
+ */
+static const gui_char*
+get_item_text(gui_handle_p h, gui_dropdown_item_t* item, int16_t index) {
+#if GUI_CFG_USE_LISTMODEL
+    gui_dropdown_t* o = GUI_VP(h);
+    
+    if (gui_widget_list_get_model(h, &o->ld) != NULL) {
+        return gui_listmodel_getstring(gui_widget_list_get_model(h, &o->ld), index, 0);
+    }
+#else /* GUI_CFG_USE_LISTMODEL */
+    GUI_UNUSED2(h, index);
+#endif /* !GUI_CFG_USE_LISTMODEL */
+    return item != NULL ? item->text : NULL;
+}
+
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+
+/**
+ * \brief           Model change callback, redraws only affected visible items
+ * \param[in]       h: Widget handle
+ * \param[in]       change: Type of change
+ * \param[in]       index: Index of first changed item
+ * \param[in]       count: Number of changed items
+ */
+static void
+model_changed(gui_handle_p h, gui_listmodel_change_t change, int16_t index, int16_t count) {
+    gui_dropdown_t* o = GUI_VP(h);
+    uint8_t slider = o->flags & GUI_FLAG_DROPDOWN_SLIDER_ON;
+    int16_t start = gui_widget_list_get_visible_start_index(h, &o->ld);
+    gui_dim_t y = 0, height, y1, height1;
+    
+    gui_widget_list_model_changed(h, &o->ld, &o->selected, change, index, count);
+    if (change == GUI_LISTMODEL_CHANGE_RESET) {
+        gui_widget_invalidate(h);
+        return;
+    }
+    if (change == GUI_LISTMODEL_CHANGE_UPDATE && o->selected >= index && o->selected < index + count) {
+        if (!is_opened(h)) {
+            gui_widget_invalidate(h);               /* Closed widget shows only selected item */
+            return;
+        }
+        height = gui_widget_getheight(h);
+        get_opened_positions(h, &y, &height, &y1, &height1);
+        gui_widget_invalidatearea(h, 0, y1, gui_widget_getwidth(h), height1);   /* Selected text in main part */
+    }
+    if (!is_opened(h)) {
+        return;                                     /* List of items is not visible */
+    }
+    
+    height = gui_widget_getheight(h);
+    get_opened_positions(h, &y, &height, &y1, &height1);
+    if (change == GUI_LISTMODEL_CHANGE_UPDATE) {
+        gui_widget_list_invalidate_items(h, &o->ld, index, count, y + 2, h->font != NULL ? item_height(h, NULL) : 0);
+    } else if (slider != (o->flags & GUI_FLAG_DROPDOWN_SLIDER_ON) || start != gui_widget_list_get_visible_start_index(h, &o->ld)) {
+        gui_widget_invalidate(h);                   /* Items moved on entire list */
+    } else {
+        gui_widget_list_invalidate_items(h, &o->ld, index, -1, y + 2, h->font != NULL ? item_height(h, NULL) : 0);
+        if (slider) {                               /* Scrollbar shows number of items */
+            gui_widget_invalidatearea(h, gui_widget_getwidth(h) - o->sliderwidth - 1, y, o->sliderwidth + 1, height);
+        }
+    }
+}
+
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
+
 /**
  * \brief           Delete item from widget and check values
  * \param[in]       h: Widget handle
@@ -256,6 +335,9 @@ delete_item(gui_handle_p h, int16_t index) {
  */
 static uint8_t
 remove_item_memory(gui_handle_p h, void* item) {
+#if GUI_CFG_USE_STRING_INTERN
+    gui_intern_release(((gui_dropdown_item_t *)item)->text);
+#endif /* GUI_CFG_USE_STRING_INTERN */
     GUI_MEMFREE(item);
     return 1;
 }
@@ -279,6 +361,7 @@ process_click(gui_handle_p h, guii_touch_data_t* ts) {
     y = 0;                                          /* Relative Y position for touch events */
     height = gui_widget_getheight(h);        
     get_opened_positions(h, &y, &height, &y1, &height1);    /* Calculate values */
+    gui_widget_popup_close(h);                      /* List is closed below, new selection is drawn on closed widget only */
     
     /* Check if press was on normal area when widget is closed */
     if (ts->y_rel[0] >= y1 && ts->y_rel[0] <= (y1 + height1)) {   /* Check first part */
@@ -312,7 +395,6 @@ static uint8_t
 gui_dropdown_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result) {
     gui_dropdown_t* o = GUI_VP(h);
 #if GUI_CFG_USE_TOUCH
-    static gui_dim_t ty;
 #endif /* GUI_CFG_USE_TOUCH */
     
     switch (evt) {
@@ -359,7 +441,7 @@ gui_dropdown_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                 gui_draw_text_init(&f);             /* Init structure */
                 
                 item = gui_widget_list_get_item_byindex(h, &o->ld, o->selected);
-                if (item != NULL) {
+                if (item != NULL || o->ld.is_virtual) {
                     f.x = x + 3;
                     f.y = y1 + 3;
                     f.width = width - 6;
@@ -367,7 +449,7 @@ gui_dropdown_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                     f.align = GUI_HALIGN_LEFT | GUI_VALIGN_CENTER;
                     f.color1width = f.width;
                     f.color1 = guii_widget_getcolor(h, GUI_DROPDOWN_COLOR_TEXT);
-                    gui_draw_writetext(disp, gui_widget_getfont(h), item->text, &f);
+                    gui_draw_writetext(disp, gui_widget_getfont(h), get_item_text(h, item, o->selected), &f);
                 }
             }
             
@@ -416,8 +498,9 @@ gui_dropdown_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                 }
                 
                 /* Draw list items */
-                for (item = gui_widget_list_get_first_visible_item(h, &o->ld, &index); item != NULL && f.y <= disp->y2;
-                        item = gui_widget_list_get_next_item(h, &o->ld, item), index++) {
+                for (item = gui_widget_list_get_first_visible_item(h, &o->ld, &index);
+                        (item != NULL || o->ld.is_virtual) && index < gui_widget_list_get_count(h, &o->ld) && f.y <= disp->y2;
+                        item = item != NULL ? gui_widget_list_get_next_item(h, &o->ld, item) : NULL, index++) {
 
                     if (index == o->selected) {
                         gui_draw_filledrectangle(disp, x + 2, f.y, width - 3, GUI_MIN(f.height, itemheight), guii_widget_isfocused(h) ? guii_widget_getcolor(h, GUI_DROPDOWN_COLOR_SEL_FOC_BG) : guii_widget_getcolor(h, GUI_DROPDOWN_COLOR_SEL_NOFOC_BG));
@@ -425,35 +508,40 @@ gui_dropdown_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                     } else {
                         f.color1 = guii_widget_getcolor(h, GUI_DROPDOWN_COLOR_TEXT);
                     }
-                    gui_draw_writetext(disp, gui_widget_getfont(h), item->text, &f);
+                    gui_draw_writetext(disp, gui_widget_getfont(h), get_item_text(h, item, index), &f);
                     f.y += itemheight;
                 }
                 disp->y2 = tmp;                     /* Set temporary value back */
             }
             return 1;
         }
+        case GUI_EVT_CLONE: {                       /* Widget copied from prototype */
+            GUI_EVT_RESULTTYPE_U8(result) = 0;      /* Items belong to prototype, widget cannot be copied */
+            return 1;
+        }
         case GUI_EVT_REMOVE: {
+#if GUI_CFG_USE_TOUCH
+            gui_widget_kinetic_stop(h, &o->ld.kinetic);
+#endif /* GUI_CFG_USE_TOUCH */
+#if GUI_CFG_USE_LISTMODEL
+            guii_listmodel_detach(&o->ld.view);
+#endif /* GUI_CFG_USE_LISTMODEL */
             gui_widget_list_remove_items(h, &o->ld);
             return 1;
         }
 #if GUI_CFG_USE_TOUCH
         case GUI_EVT_TOUCHSTART: {
-            guii_touch_data_t* ts = GUI_EVT_PARAMTYPE_TOUCH(param);  /* Get touch data */
-            ty = ts->y_rel[0];                      /* Save relative Y position */
+            gui_widget_list_touchstart(h, &o->ld, h->font != NULL ? item_height(h, NULL) : 0);
             
             GUI_EVT_RESULTTYPE_TOUCH(result) = touchHANDLED;
             return 1;
         }
         case GUI_EVT_TOUCHMOVE: {
-            guii_touch_data_t* ts = GUI_EVT_PARAMTYPE_TOUCH(param);  /* Get touch data */
-            if (h->font != NULL) {
-                gui_dim_t height = item_height(h, NULL);
-                
-                if (GUI_ABS(ty - ts->y_rel[0]) > height) {
-                    gui_widget_list_slide(h, &o->ld, (ty - ts->y_rel[0]) > 0 ? 1 : -1);
-                    ty = ts->y_rel[0];
-                }
-            }
+            gui_widget_list_touchmove(h, &o->ld, GUI_EVT_PARAMTYPE_TOUCH(param));
+            return 1;
+        }
+        case GUI_EVT_TOUCHEND: {
+            gui_widget_list_touchend(h, &o->ld);
             return 1;
         }
 #endif /* GUI_CFG_USE_TOUCH */
@@ -526,7 +614,8 @@ gui_dropdown_setcolor(gui_handle_p h, gui_dropdown_color_t index, gui_color_t co
 /**
  * \brief           Add a new string to list box
  * \param[in]       h: Widget handle
- * \param[in]       text: Pointer to text to add to list. Only pointer is saved to memory!
+ * \param[in]       text: Pointer to text to add to list. Only pointer is saved to memory,
+ *                      unless \ref GUI_CFG_USE_STRING_INTERN is enabled
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
@@ -537,15 +626,26 @@ gui_dropdown_addstring(gui_handle_p h, const gui_char* text) {
     
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
 
+#if GUI_CFG_USE_STRING_INTERN
+    if ((text = gui_intern_get(text)) == NULL) {    /* Use shared copy of text */
+        return 0;
+    }
+#endif /* GUI_CFG_USE_STRING_INTERN */
     item = GUI_MEMALLOC(sizeof(*item));             /* Allocate memory for entry */
     if (item != NULL) {
         item->text = (gui_char *)text;
-        gui_widget_list_add_item(h, &o->ld, item);  /* Add to linkedlist */
-        
-        gui_widget_invalidate(h);                   /* Invalidate widget */
-         
-        ret = 1;
+        if (gui_widget_list_add_item(h, &o->ld, item)) {/* Add to linkedlist, not possible when model is used */
+            gui_widget_invalidate(h);               /* Invalidate widget */
+            ret = 1;
+        } else {
+            GUI_MEMFREE(item);
+        }
+    }
+#if GUI_CFG_USE_STRING_INTERN
+    if (!ret) {
+        gui_intern_release(text);
     }
+#endif /* GUI_CFG_USE_STRING_INTERN */
     
     return ret;
 }
@@ -581,7 +681,8 @@ gui_dropdown_setopendirection(gui_handle_p h, gui_dropdown_opendir_t dir) {
  * \brief           Set string value to already added string index
  * \param[in]       h: Widget handle
  * \param[in]       index: Index (position) on list to set/change text
- * \param[in]       text: Pointer to text to add to list. Only pointer is saved to memory!
+ * \param[in]       text: Pointer to text to add to list. Only pointer is saved to memory,
+ *                      unless \ref GUI_CFG_USE_STRING_INTERN is enabled
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
@@ -594,6 +695,12 @@ gui_dropdown_setstring(gui_handle_p h, uint16_t index, const gui_char* text) {
 
     item = gui_widget_list_get_item_byindex(h, &o->ld, index);  /* Get list item from handle */
     if (item != NULL) {
+#if GUI_CFG_USE_STRING_INTERN
+        if ((text = gui_intern_get(text)) == NULL) {/* Use shared copy of text */
+            return 0;
+        }
+        gui_intern_release(item->text);
+#endif /* GUI_CFG_USE_STRING_INTERN */
         item->text = (gui_char *)text;              /* Set new text */
         gui_widget_invalidate(h);                   /* Invalidate widget */
     }
@@ -672,6 +779,7 @@ gui_dropdown_setselection(gui_handle_p h, int16_t selection) {
 
 /**
  * \brief           Get selected value
+ * \note            Selection is read without core protection and function may be called from any thread
  * \param[in]       h: Widget handle
  * \return          Selection number or -1 if no selection
  */
@@ -679,5 +787,31 @@ int16_t
 gui_dropdown_getselection(gui_handle_p h) {
     gui_dropdown_t* o = GUI_VP(h);
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
-    return o->selected;                       /* Read selection */
+    return gui_widget_list_get_selection(h, &o->ld);    /* Read published selection */
 }
+
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+
+/**
+ * \brief           Show items of shared list model
+ *
+ *                  Model may be attached to several widgets at the same time.
+ *                  First column of model is shown, change of model redraws only affected visible items.
+ *
+ * \note            All strings added with \ref gui_dropdown_addstring are removed and selection is cleared
+ * \param[in]       h: Widget handle
+ * \param[in]       model: Model handle. Set to `NULL` to detach model
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_dropdown_setmodel(gui_handle_p h, gui_listmodel_p model) {
+    gui_dropdown_t* o = GUI_VP(h);
+
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+
+    return gui_widget_list_set_model(h, &o->ld, &o->selected, model, model_changed);
+}
+
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
+
+#endif /* GUI_CFG_WIDGET_DROPDOWN || __DOXYGEN__ */
@@ -40,6 +40,8 @@
 #include "gui/gui_keyboard.h"
 #endif /* GUI_CFG_USE_KEYBOARD */
 
+#if GUI_CFG_WIDGET_EDITTEXT || __DOXYGEN__
+
 /**
  * \ingroup         GUI_EDITTEXT
  * \name            GUI_EDITTEXT_FLAGS
@@ -48,6 +50,7 @@
  */
 
 #define GUI_EDITTEXT_FLAG_MULTILINE             0x01    /*!< Defines widget as multi-line edit */
+#define GUI_EDITTEXT_FLAG_CURSOR                0x02    /*!< Cursor is in visible phase of blink */
     
 /**
  * \}
@@ -63,6 +66,9 @@ typedef struct {
     uint8_t flags;                                  /*!< List of widget flags */
     gui_edittext_valign_t valign;                   /*!< Vertical align setup */
     gui_edittext_halign_t halign;                   /*!< Horizontal align setup */
+    gui_dim_t cursor_x;                             /*!< Cursor X position relative to widget, set on draw */
+    gui_dim_t cursor_y;                             /*!< Cursor Y position relative to widget, set on draw */
+    gui_dim_t cursor_h;                             /*!< Visible cursor height, set on draw */
 } gui_edittext_t;
 
 #define CFG_MULTILINE       0x01
@@ -97,6 +103,125 @@ gui_widget_t widget = {
 /* Check if edit text is multiline */
 #define is_multiline(o)            (o->flags & GUI_EDITTEXT_FLAG_MULTILINE)
 
+#if GUI_CFG_EDITTEXT_CURSOR_PERIOD
+
+/**
+ * \brief           Invalidate only cursor rectangle of widget
+ * \param[in]       h: Widget handle
+ */
+static void
+invalidate_cursor(gui_handle_p h) {
+    gui_edittext_t* o = GUI_VP(h);
+    
+    if (o->cursor_h > 0) {                          /* Position is known after first draw */
+        gui_widget_invalidatearea(h, o->cursor_x, o->cursor_y, GUI_CFG_EDITTEXT_CURSOR_WIDTH, o->cursor_h);
+    }
+}
+
+/* Timer callback for cursor blink */
+static void
+cursor_timer_callback(gui_timer_t* t) {
+    gui_handle_p h = guii_timer_getparams(t);       /* Get timer parameters */
+    gui_edittext_t* o = GUI_VP(h);
+    if (h != NULL) {
+        o->flags ^= GUI_EDITTEXT_FLAG_CURSOR;       /* Toggle blink phase */
+        invalidate_cursor(h);
+    }
+}
+
+/**
+ * \brief           Show cursor and start blink timer
+ * \param[in]       h: Widget handle
+ */
+static void
+cursor_start(gui_handle_p h) {
+    gui_edittext_t* o = GUI_VP(h);
+    gui_handle_ext_t* e = guii_widget_ext(h);
+    
+    if (e != NULL && e->timer == NULL) {
+        e->timer = guii_timer_create(GUI_CFG_EDITTEXT_CURSOR_PERIOD, cursor_timer_callback, h);
+    }
+    o->flags |= GUI_EDITTEXT_FLAG_CURSOR;
+    if (e != NULL && e->timer != NULL) {
+        guii_timer_startperiodic(e->timer);         /* Start blink from visible phase */
+    }
+    invalidate_cursor(h);
+}
+
+/**
+ * \brief           Hide cursor and stop blink timer
+ * \param[in]       h: Widget handle
+ */
+static void
+cursor_stop(gui_handle_p h) {
+    gui_edittext_t* o = GUI_VP(h);
+    
+    if (guii_widget_getextvalue(h, timer) != NULL) {
+        guii_timer_stop(guii_widget_getext(h)->timer);
+    }
+    if (o->flags & GUI_EDITTEXT_FLAG_CURSOR) {
+        o->flags &= ~GUI_EDITTEXT_FLAG_CURSOR;
+        invalidate_cursor(h);
+    }
+}
+
+#endif /* GUI_CFG_EDITTEXT_CURSOR_PERIOD */
+
+#if GUI_CFG_USE_KEYBOARD
+
+/**
+ * \brief           Process key and redraw only lines affected by edit
+ *
+ *                  In multi-line top aligned text, lines above edited one do not change.
+ *                  Redraw starts at line before cursor, previous word may wrap back to it on delete
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       kb: Keyboard data
+ * \return          `1` if key was processed, `0` otherwise
+ */
+static uint8_t
+process_key(gui_handle_p h, guii_keyboard_data_t* kb) {
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE
+    gui_edittext_t* o = GUI_VP(h);
+    const gui_text_layout_t* l = guii_widget_gettextlayout(h);
+    gui_dim_t y, lh, height;
+    size_t line, cursor, count;
+    uint8_t ret, ignore;
+    
+    height = gui_widget_getheight(h) - 10;          /* Height of text area */
+    lh = l->lineheight ? l->lineheight : (gui_widget_getfont(h) != NULL ? gui_widget_getfont(h)->size : 0);
+    /* Text taller than area is bottom aligned in edit mode, new line would move all lines */
+    if (!is_multiline(o) || o->valign != GUI_EDITTEXT_VALIGN_TOP || !l->valid || !lh
+        || l->str != gui_widget_gettext(h) || l->start || (gui_dim_t)(l->count + 1) * lh > height) {
+        return guii_widget_processtextkey(h, kb);   /* Complete widget must be redrawn */
+    }
+    
+    /* Find line with cursor */
+    cursor = guii_widget_getextvalue(h, textcursor);
+    for (line = 0; line + 1 < l->count && l->lines[line + 1].offset <= cursor; line++) {}
+    if (line) {
+        line--;
+    }
+    
+    count = l->count;                               /* Layout keeps only lines before change after key */
+    ignore = guii_widget_getflag(h, GUI_FLAG_IGNORE_INVALIDATE) ? 1 : 0;
+    guii_widget_setflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Skip complete widget invalidation */
+    ret = guii_widget_processtextkey(h, kb);
+    if (!ignore) {
+        guii_widget_clrflag(h, GUI_FLAG_IGNORE_INVALIDATE);
+        if (ret) {
+            y = 5 + (gui_dim_t)line * lh;           /* Top of first changed line */
+            gui_widget_invalidatearea(h, 2, y, gui_widget_getwidth(h) - 4, (gui_dim_t)(count - line) * lh + GUI_MAX(lh, gui_widget_getfont(h)->size));   /* Text may grow by one line */
+        }
+    }
+    return ret;
+#else /* GUI_CFG_USE_TEXT_LAYOUT_CACHE */
+    return guii_widget_processtextkey(h, kb);
+#endif /* !GUI_CFG_USE_TEXT_LAYOUT_CACHE */
+}
+
+#endif /* GUI_CFG_USE_KEYBOARD */
+
 /**
  * \brief           Default widget callback function
  * \param[in]       h: Widget handle
@@ -117,23 +242,28 @@ gui_edittext_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
         }
         case GUI_EVT_SETPARAM: {                    /* Set parameter for widget */
             gui_widget_param* p = GUI_EVT_PARAMTYPE_WIDGETPARAM(param);
+            uint8_t changed = 1;
             switch (p->type) {
                 case CFG_MULTILINE:
-                    if (*(uint8_t *)p->data && !is_multiline(h)) {
+                    if (*(uint8_t *)p->data && !is_multiline(o)) {
                         o->flags |= GUI_EDITTEXT_FLAG_MULTILINE;
-                    } else if (!*(uint8_t *)p->data && is_multiline(h)) {
+                    } else if (!*(uint8_t *)p->data && is_multiline(o)) {
                         o->flags &= ~GUI_EDITTEXT_FLAG_MULTILINE;
+                    } else {
+                        changed = 0;
                     }
                     break; /* Set max X value to widget */
                 case CFG_HALIGN: 
+                    changed = o->halign != *(gui_edittext_halign_t *)p->data;
                     o->halign = *(gui_edittext_halign_t *)p->data;
                     break;
                 case CFG_VALIGN: 
+                    changed = o->valign != *(gui_edittext_valign_t *)p->data;
                     o->valign = *(gui_edittext_valign_t *)p->data;
                     break;
                 default: break;
             }
-            GUI_EVT_RESULTTYPE_U8(result) = 1;
+            GUI_EVT_RESULTTYPE_U8(result) = changed;
             return 1;
         }
         case GUI_EVT_DRAW: {
@@ -152,7 +282,7 @@ gui_edittext_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                 gui_draw_rectangle(disp, x + 3, y + 3, width - 6, height - 6, guii_widget_getcolor(h, GUI_EDITTEXT_COLOR_BORDER));
             }
             
-            if (gui_widget_isfontandtextset(h)) {   /* Ready to write string */
+            if (gui_widget_getfont(h) != NULL) {    /* Empty text is written too for cursor position */
                 gui_draw_text_t f;
                 gui_draw_text_init(&f);             /* Init font drawing */
                 
@@ -165,25 +295,55 @@ gui_edittext_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                 f.color1 = guii_widget_getcolor(h, GUI_EDITTEXT_COLOR_FG);
                 f.flags |= GUI_FLAG_TEXT_RIGHTALIGN | GUI_FLAG_TEXT_EDITMODE;
                 
-                if (is_multiline(h)) {
+                if (is_multiline(o)) {
                     f.flags |= GUI_FLAG_TEXT_MULTILINE; /* Set multiline flag for widget */
                 }
                 
-                gui_draw_writetext(disp, gui_widget_getfont(h), gui_widget_gettext(h), &f);
+                if (gui_widget_isfontandtextset(h)) {
+                    f.layout = guii_widget_gettextlayout(h);    /* Reuse layout of widget text */
+                    gui_draw_writetext(disp, gui_widget_getfont(h), gui_widget_gettext(h), &f);
+                } else {
+                    gui_draw_writetext(disp, gui_widget_getfont(h), _GT(""), &f);
+                }
+#if GUI_CFG_EDITTEXT_CURSOR_PERIOD
+                /* Keep cursor inside text area, blink invalidates only this rectangle */
+                o->cursor_x = GUI_MAX(5, GUI_MIN(f.cursorx - x, width - 5 - GUI_CFG_EDITTEXT_CURSOR_WIDTH));
+                o->cursor_y = GUI_MAX(5, f.cursory - y);
+                o->cursor_h = GUI_MIN(f.cursory - y + f.lineheight, height - 5) - o->cursor_y;
+                if (guii_widget_isfocused(h) && (o->flags & GUI_EDITTEXT_FLAG_CURSOR) && o->cursor_h > 0) {
+                    gui_draw_filledrectangle(disp, x + o->cursor_x, y + o->cursor_y, GUI_CFG_EDITTEXT_CURSOR_WIDTH, o->cursor_h, f.color1);
+                }
+#endif /* GUI_CFG_EDITTEXT_CURSOR_PERIOD */
             }
             return 1;
         }
-#if GUI_CFG_USE_KEYBOARD
         case GUI_EVT_FOCUSIN:
+#if GUI_CFG_USE_KEYBOARD
             gui_keyboard_show(h);
+#endif /* GUI_CFG_USE_KEYBOARD */
+#if GUI_CFG_EDITTEXT_CURSOR_PERIOD
+            cursor_start(h);
+#endif /* GUI_CFG_EDITTEXT_CURSOR_PERIOD */
             return 1;
         case GUI_EVT_FOCUSOUT:
+#if GUI_CFG_USE_KEYBOARD
             gui_keyboard_hide();
+#endif /* GUI_CFG_USE_KEYBOARD */
+#if GUI_CFG_EDITTEXT_CURSOR_PERIOD
+            cursor_stop(h);
+#endif /* GUI_CFG_EDITTEXT_CURSOR_PERIOD */
             return 1;
+#if GUI_CFG_USE_KEYBOARD
         case GUI_EVT_KEYPRESS: {
             guii_keyboard_data_t* kb = GUI_EVT_PARAMTYPE_KEYBOARD(param);    /* Get keyboard data */
-            if (guii_widget_processtextkey(h, kb)) {
+            if (process_key(h, kb)) {
                 GUI_EVT_RESULTTYPE_KEYBOARD(result) = keyHANDLED;
+#if GUI_CFG_EDITTEXT_CURSOR_PERIOD
+                o->flags |= GUI_EDITTEXT_FLAG_CURSOR;   /* Cursor stays visible while typing */
+                if (guii_widget_getextvalue(h, timer) != NULL) {
+                    guii_timer_reset(guii_widget_getext(h)->timer);
+                }
+#endif /* GUI_CFG_EDITTEXT_CURSOR_PERIOD */
             }
             return 1;
         }
@@ -267,3 +427,5 @@ gui_edittext_sethalign(gui_handle_p h, gui_edittext_halign_t align) {
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
     return guii_widget_setparam(h, CFG_HALIGN, &align, 1, 1);
 }
+
+#endif /* GUI_CFG_WIDGET_EDITTEXT || __DOXYGEN__ */
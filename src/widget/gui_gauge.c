@@ -0,0 +1,831 @@
+/**	
+ * \file            gui_gauge.c
+ * \brief           Gauge widget
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "widget/gui_gauge.h"
+
+#if GUI_CFG_WIDGET_GAUGE || __DOXYGEN__
+
+/**
+ * \ingroup         GUI_GAUGE
+ * \brief           Needle drawn from image
+ */
+typedef struct {
+    const gui_image_desc_t* img;                    /*!< Needle image pointing up, `NULL` to draw default needle */
+    gui_dim_t pivot_x;                              /*!< X position of rotation point in image */
+    gui_dim_t pivot_y;                              /*!< Y position of rotation point in image */
+} gui_gauge_needle_t;
+
+/**
+ * \ingroup         GUI_GAUGE
+ * \brief           Gauge object structure
+ */
+typedef struct {
+    gui_handle C;                                   /*!< GUI handle object, must always be first on list */
+    
+    int32_t min;                                    /*!< Value at start of scale */
+    int32_t max;                                    /*!< Value at end of scale */
+    int32_t value;                                  /*!< Current value */
+    int16_t start;                                  /*!< Angle of scale start, clockwise from top in units of `0.1` degree */
+    int16_t sweep;                                  /*!< Angle of whole scale in units of `0.1` degree, negative for counter-clockwise scale */
+    uint8_t major;                                  /*!< Number of major scale divisions */
+    uint8_t minor;                                  /*!< Number of minor divisions in single major division */
+    gui_gauge_needle_t needle;                      /*!< Optional needle image */
+#if GUI_CFG_USE_GAUGE_CACHE
+    gui_layer_t* dial;                              /*!< Dial rendered once, without needle */
+    gui_color_t dial_colors[4];                     /*!< Colors used for rendered dial */
+    const gui_font_t* dial_font;                    /*!< Font used for rendered dial */
+    uint8_t dial_valid;                             /*!< Set to `1` when rendered dial is up to date */
+#endif /* GUI_CFG_USE_GAUGE_CACHE */
+} gui_gauge_t;
+
+/**
+ * \brief           Dimensions of dial parts, relative to widget
+ */
+typedef struct {
+    gui_dim_t cx;                                   /*!< X position of dial center */
+    gui_dim_t cy;                                   /*!< Y position of dial center */
+    gui_dim_t r;                                    /*!< Radius of dial face */
+    gui_dim_t rs;                                   /*!< Radius of scale arc and outer end of ticks */
+    gui_dim_t lm;                                   /*!< Length of major tick, minor tick is half of it */
+    gui_dim_t ln;                                   /*!< Needle length from center */
+    gui_dim_t lt;                                   /*!< Needle tail length behind center */
+    gui_dim_t bw;                                   /*!< Half width of needle at center */
+    gui_dim_t rh;                                   /*!< Radius of needle hub */
+} gauge_geom_t;
+
+#define CFG_VALUE           0x01
+#define CFG_MIN             0x02
+#define CFG_MAX             0x03
+#define CFG_ANGLES          0x04
+#define CFG_TICKS           0x05
+#define CFG_NEEDLE          0x06
+
+static uint8_t gui_gauge_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result);
+
+/**
+ * \brief           List of default color in the same order of widget color enumeration
+ */
+static const
+gui_color_t colors[] = {
+    GUI_COLOR_WIN_LIGHTGRAY,                        /*!< Default background color */
+    GUI_COLOR_WHITE,                                /*!< Default dial face color */
+    GUI_COLOR_BLACK,                                /*!< Default scale color */
+    GUI_COLOR_BLACK,                                /*!< Default labels color */
+    GUI_COLOR_WIN_RED,                              /*!< Default needle color */
+    GUI_COLOR_WIN_DARKGRAY,                         /*!< Default hub color */
+};
+
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+/**
+ * \brief           Widget events processed by callback, other events are not delivered to widget
+ */
+static const gui_widget_evt_fn
+evt_table[GUI_EVT_COUNT] = {
+    [GUI_EVT_PRE_INIT] = gui_gauge_callback,
+    [GUI_EVT_SETPARAM] = gui_gauge_callback,
+    [GUI_EVT_DRAW] = gui_gauge_callback,
+#if GUI_CFG_USE_GAUGE_CACHE
+    [GUI_EVT_REMOVE] = gui_gauge_callback,
+    [GUI_EVT_CLONE] = gui_gauge_callback,
+#endif /* GUI_CFG_USE_GAUGE_CACHE */
+    [GUI_EVT_SAVESTATE] = gui_gauge_callback,
+    [GUI_EVT_RESTORESTATE] = gui_gauge_callback,
+};
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
+
+/**
+ * \brief           Widget initialization structure
+ */
+static const
+gui_widget_t widget = {
+    .name = _GT("GAUGE"),                           /*!< Widget name */
+    .size = sizeof(gui_gauge_t),                    /*!< Size of widget for memory allocation */
+    .flags = GUI_FLAG_WIDGET_OPAQUE,                /*!< List of widget flags */
+    .callback = gui_gauge_callback,                 /*!< Callback function */
+    .colors = colors,                               /*!< List of default colors */
+    .color_count = GUI_COUNT_OF(colors),            /*!< Number of colors */
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+    .evt_table = evt_table,                         /*!< List of handled events */
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
+};
+
+/* Multiply by Q16 value and round half away from zero, keeps dial symmetric */
+static gui_dim_t
+mul_q16(gui_dim_t v, int32_t q) {
+    int32_t t = (int32_t)v * q;
+    return (gui_dim_t)(t >= 0 ? (t + 0x8000) / 0x10000 : -((0x8000 - t) / 0x10000));
+}
+
+/* Get dimensions of dial parts from widget size */
+static void
+get_geom(gui_handle_p h, gauge_geom_t* g) {
+    gui_dim_t wi = gui_widget_getwidth(h), hi = gui_widget_getheight(h);
+    
+    g->cx = wi / 2;
+    g->cy = hi / 2;
+    g->r = GUI_MAX(GUI_MIN(wi, hi) / 2 - 1, 1);
+    g->rs = g->r - g->r / 16 - 1;
+    g->lm = g->r / 8 + 1;
+    g->ln = g->rs - g->lm / 2;
+    g->lt = g->r / 6;
+    g->bw = GUI_MAX(g->r / 24, 2);
+    g->rh = GUI_MAX(g->r / 12, 3);
+}
+
+/* Get point at angle and distance from dial center */
+static void
+get_point(const gauge_geom_t* g, int32_t angle, gui_dim_t radius, gui_dim_t* x, gui_dim_t* y) {
+    int16_t s, c;
+    
+    gui_math_isincos_q15((int16_t)(angle % 3600), &s, &c);
+    *x = g->cx + mul_q16(radius, (int32_t)s * 2);   /* Sine and cosine to units of 1/65536 */
+    *y = g->cy - mul_q16(radius, (int32_t)c * 2);
+}
+
+/* Get needle angle for value, value is limited to scale range */
+static int32_t
+get_angle(gui_gauge_t* o, int32_t val) {
+    val = GUI_MAX(GUI_MIN(val, o->max), o->min);
+    return o->start + (int32_t)(((int64_t)o->sweep * ((int64_t)val - o->min)) / ((int64_t)o->max - o->min));
+}
+
+/* Get points of default needle: tip, left side, tail and right side */
+static void
+get_needle(gui_gauge_t* o, const gauge_geom_t* g, int32_t val, gui_dim_t* pt) {
+    int32_t a = get_angle(o, val);
+    
+    get_point(g, a, g->ln, &pt[0], &pt[1]);
+    get_point(g, a - 900, g->bw, &pt[2], &pt[3]);
+    get_point(g, a + 1800, g->lt, &pt[4], &pt[5]);
+    get_point(g, a + 900, g->bw, &pt[6], &pt[7]);
+}
+
+/**
+ * \brief           Get area covered by needle for value
+ * \param[in]       h: Widget handle
+ * \param[in]       val: Value needle points to
+ * \param[out]      box: Output area as `x1, y1, x2, y2` relative to widget, with `x2` and `y2` exclusive
+ */
+static void
+get_needle_box(gui_handle_p h, int32_t val, gui_dim_t* box) {
+    gui_gauge_t* o = GUI_VP(h);
+    gauge_geom_t g;
+    size_t i;
+    
+    get_geom(h, &g);
+#if GUI_CFG_USE_IMAGE_TRANSFORM
+    if (o->needle.img != NULL) {
+        const gui_image_desc_t* img = o->needle.img;
+        int64_t px, py, min_x = INT64_MAX, min_y = INT64_MAX, max_x = INT64_MIN, max_y = INT64_MIN;
+        int32_t s, c;
+        
+        /* Rotated image corners, the same as image transformation */
+        gui_math_isincos((int16_t)(get_angle(o, val) % 3600), &s, &c);
+        for (i = 0; i < 4; i++) {
+            int64_t x = (i & 0x01) ? img->x_size - o->needle.pivot_x : -o->needle.pivot_x;
+            int64_t y = (i & 0x02) ? img->y_size - o->needle.pivot_y : -o->needle.pivot_y;
+            
+            px = c * x - s * y;
+            py = s * x + c * y;
+            min_x = GUI_MIN(min_x, px);
+            max_x = GUI_MAX(max_x, px);
+            min_y = GUI_MIN(min_y, py);
+            max_y = GUI_MAX(max_y, py);
+        }
+        box[0] = g.cx + (gui_dim_t)(min_x / 0x10000) - 3;   /* Margin covers rounding and filtered edges */
+        box[1] = g.cy + (gui_dim_t)(min_y / 0x10000) - 3;
+        box[2] = g.cx + (gui_dim_t)(max_x / 0x10000) + 3;
+        box[3] = g.cy + (gui_dim_t)(max_y / 0x10000) + 3;
+        return;
+    }
+#endif /* GUI_CFG_USE_IMAGE_TRANSFORM */
+    {
+        gui_dim_t pt[8];
+        
+        get_needle(o, &g, val, pt);
+        box[0] = g.cx - g.rh;                       /* Needle hub */
+        box[1] = g.cy - g.rh;
+        box[2] = g.cx + g.rh;
+        box[3] = g.cy + g.rh;
+        for (i = 0; i < 4; i++) {
+            box[0] = GUI_MIN(box[0], pt[2 * i]);
+            box[1] = GUI_MIN(box[1], pt[2 * i + 1]);
+            box[2] = GUI_MAX(box[2], pt[2 * i]);
+            box[3] = GUI_MAX(box[3], pt[2 * i + 1]);
+        }
+        box[0] -= 2;                                /* Margin covers anti-aliased edges */
+        box[1] -= 2;
+        box[2] += 3;
+        box[3] += 3;
+    }
+}
+
+/* Invalidate only area covered by needle before and after value change */
+static void
+invalidate_needle(gui_handle_p h, int32_t old) {
+    gui_gauge_t* o = GUI_VP(h);
+    gui_dim_t b1[4], b2[4], x1, y1;
+    
+    if (get_angle(o, old) == get_angle(o, o->value)) {
+        return;
+    }
+    get_needle_box(h, old, b1);
+    get_needle_box(h, o->value, b2);
+    x1 = GUI_MIN(b1[0], b2[0]);
+    y1 = GUI_MIN(b1[1], b2[1]);
+    gui_widget_invalidatearea(h, x1, y1, GUI_MAX(b1[2], b2[2]) - x1, GUI_MAX(b1[3], b2[3]) - y1);
+}
+
+/**
+ * \brief           Draw dial background, face, scale and labels
+ * \param[in]       h: Widget handle
+ * \param[in]       disp: Display clipping region
+ * \param[in]       x: Absolute X position of widget
+ * \param[in]       y: Absolute Y position of widget
+ */
+static void
+draw_dial(gui_handle_p h, const gui_display_t* disp, gui_dim_t x, gui_dim_t y) {
+    gui_gauge_t* o = GUI_VP(h);
+    gui_color_t scale = guii_widget_getcolor(h, GUI_GAUGE_COLOR_SCALE);
+    gui_dim_t x1, y1, x2, y2, len;
+    int32_t i, count, segments, a;
+    uint8_t full = GUI_ABS(o->sweep) >= 3600;
+    gauge_geom_t g;
+    
+    get_geom(h, &g);
+    g.cx += x;                                      /* Draw at absolute position */
+    g.cy += y;
+    
+    gui_draw_filledrectangle(disp, x, y, gui_widget_getwidth(h), gui_widget_getheight(h), guii_widget_getcolor(h, GUI_GAUGE_COLOR_BG));
+    gui_draw_filledcircle(disp, g.cx, g.cy, g.r, guii_widget_getcolor(h, GUI_GAUGE_COLOR_FACE));
+    gui_draw_circle_aa(disp, g.cx, g.cy, g.r, scale);
+    
+    /* Scale arc from segments of 5 degrees */
+    segments = GUI_MAX(GUI_ABS(o->sweep) / 50, 1);
+    get_point(&g, o->start, g.rs, &x1, &y1);
+    for (i = 1; i <= segments; i++) {
+        get_point(&g, o->start + (o->sweep * i) / segments, g.rs, &x2, &y2);
+        gui_draw_line_aa(disp, x1, y1, x2, y2, scale);
+        x1 = x2;
+        y1 = y2;
+    }
+    
+    /* Major and minor ticks, last tick overlaps first one on full circle */
+    count = (int32_t)o->major * o->minor;
+    for (i = 0; i <= count - full; i++) {
+        a = o->start + (o->sweep * i) / count;
+        len = (i % o->minor) ? g.lm / 2 : g.lm;
+        get_point(&g, a, g.rs, &x1, &y1);
+        get_point(&g, a, g.rs - len, &x2, &y2);
+        gui_draw_line_aa(disp, x1, y1, x2, y2, scale);
+    }
+    
+    /* Value labels inside major ticks */
+    if (h->font != NULL) {
+        const gui_font_t* font = gui_widget_getfont(h);
+        gui_dim_t rl = g.rs - g.lm - 1 - (2 * (gui_dim_t)font->size) / 3;
+        gui_char buff[12];
+        gui_draw_text_t f;
+        
+        for (i = 0; rl > 0 && i <= (int32_t)o->major - full; i++) {
+            gui_string_fromnumber(buff, GUI_COUNT_OF(buff), o->min + (int32_t)((((int64_t)o->max - o->min) * i) / o->major), NULL);
+            get_point(&g, o->start + (o->sweep * i) / o->major, rl, &x1, &y1);
+            
+            gui_draw_text_init(&f);                 /* Init structure */
+            f.width = 4 * (gui_dim_t)font->size;
+            f.height = (gui_dim_t)font->size;
+            f.x = x1 - f.width / 2;
+            f.y = y1 - f.height / 2;
+            f.align = GUI_HALIGN_CENTER | GUI_VALIGN_CENTER;
+            f.color1width = f.width;
+            f.color1 = guii_widget_getcolor(h, GUI_GAUGE_COLOR_TEXT);
+            gui_draw_writetext(disp, font, buff, &f);
+        }
+    }
+}
+
+/**
+ * \brief           Draw needle for current value
+ * \param[in]       h: Widget handle
+ * \param[in]       disp: Display clipping region
+ * \param[in]       x: Absolute X position of widget
+ * \param[in]       y: Absolute Y position of widget
+ */
+static void
+draw_needle(gui_handle_p h, const gui_display_t* disp, gui_dim_t x, gui_dim_t y) {
+    gui_gauge_t* o = GUI_VP(h);
+    gui_color_t color = guii_widget_getcolor(h, GUI_GAUGE_COLOR_NEEDLE);
+    gui_dim_t pt[8];
+    gauge_geom_t g;
+    size_t i;
+    
+    get_geom(h, &g);
+    g.cx += x;                                      /* Draw at absolute position */
+    g.cy += y;
+#if GUI_CFG_USE_IMAGE_TRANSFORM
+    if (o->needle.img != NULL) {
+        gui_image_transform_t tr;
+        
+        memset(&tr, 0x00, sizeof(tr));
+        tr.angle = (int16_t)(get_angle(o, o->value) % 3600);
+        tr.scale_x = tr.scale_y = 256;
+        tr.pivot_x = o->needle.pivot_x;
+        tr.pivot_y = o->needle.pivot_y;
+        tr.flags = GUI_FLAG_TRANSFORM_BILINEAR;
+        gui_draw_image_transform(disp, g.cx, g.cy, o->needle.img, &tr);
+        return;
+    }
+#endif /* GUI_CFG_USE_IMAGE_TRANSFORM */
+    get_needle(o, &g, o->value, pt);
+    gui_draw_filledtriangle(disp, pt[0], pt[1], pt[2], pt[3], pt[6], pt[7], color);
+    gui_draw_filledtriangle(disp, pt[4], pt[5], pt[2], pt[3], pt[6], pt[7], color);
+    for (i = 0; i < 8; i += 2) {                    /* Smooth outline */
+        gui_draw_line_aa(disp, pt[i], pt[i + 1], pt[(i + 2) & 0x07], pt[(i + 3) & 0x07], color);
+    }
+    color = guii_widget_getcolor(h, GUI_GAUGE_COLOR_HUB);
+    gui_draw_filledcircle(disp, g.cx, g.cy, g.rh, color);
+    gui_draw_circle_aa(disp, g.cx, g.cy, g.rh, color);
+}
+
+#if GUI_CFG_USE_GAUGE_CACHE
+
+/**
+ * \brief           Free pre-rendered dial of gauge
+ * \param[in]       h: Widget handle
+ */
+static void
+free_dial(gui_handle_p h) {
+    gui_gauge_t* o = GUI_VP(h);
+    
+    if (o->dial != NULL) {
+        gui_lcd_fence();                            /* Dial may still be copied by queued low-level operation */
+        GUI_MEMFREE(o->dial);
+        o->dial = NULL;
+    }
+    o->dial_valid = 0;
+}
+
+/**
+ * \brief           Get pre-rendered dial of gauge, render it if necessary
+ * \param[in]       h: Widget handle
+ * \param[in]       x: Absolute X position of widget
+ * \param[in]       y: Absolute Y position of widget
+ * \param[in]       wi: Widget width
+ * \param[in]       hi: Widget height
+ * \return          Layer with rendered dial on success, `NULL` otherwise
+ */
+static gui_layer_t *
+get_dial(gui_handle_p h, gui_dim_t x, gui_dim_t y, gui_dim_t wi, gui_dim_t hi) {
+    gui_gauge_t* o = GUI_VP(h);
+    gui_layer_t* layer = o->dial, *prev;
+    gui_display_t disp;
+    size_t i;
+    
+    if (layer != NULL && (layer->width != wi || layer->height != hi)) {
+        free_dial(h);                               /* Widget size changed, allocate new buffer */
+        layer = NULL;
+    }
+    if (layer == NULL) {
+        if (wi <= 0 || hi <= 0) {
+            return NULL;
+        }
+        layer = GUI_MEMALLOC_CLASS(sizeof(*layer) + (size_t)wi * (size_t)hi * (size_t)GUI.lcd.pixel_size + GUI_LCD_TILES_SIZE(wi, hi), GUI_MEM_CLASS_PIXEL);
+        if (layer == NULL) {
+            return NULL;
+        }
+        memset(layer, 0x00, sizeof(*layer));
+        layer->width = wi;
+        layer->height = hi;
+        layer->start_address = ((uint8_t *)layer) + sizeof(*layer);
+        layer->pixel_format = GUI.lcd.layers[0].pixel_format;
+        GUI_LCD_TILES_INIT(layer);
+        o->dial = layer;
+        o->dial_valid = 0;
+    }
+    
+    /* Colors and font are set by generic widget functions, compare them on every draw */
+    for (i = 0; i < GUI_COUNT_OF(o->dial_colors); i++) {
+        if (o->dial_colors[i] != guii_widget_getcolor(h, (uint8_t)i)) {
+            o->dial_valid = 0;
+        }
+    }
+    if (o->dial_font != h->font) {
+        o->dial_valid = 0;
+    }
+    
+    /* Layer content does not depend on widget position */
+    layer->x_pos = x;
+    layer->y_pos = y;
+    if (!o->dial_valid) {
+#if GUI_CFG_USE_COVERAGE_MASK
+        uint8_t coverage = GUI.coverage.active;
+        
+        GUI.coverage.active = 0;                    /* Dial is needed also below covering widgets */
+#endif /* GUI_CFG_USE_COVERAGE_MASK */
+        gui_lcd_fence();                            /* Previous dial may still be copied */
+        disp.x1 = x;
+        disp.y1 = y;
+        disp.x2 = x + wi;
+        disp.y2 = y + hi;
+        prev = GUI.lcd.drawing_layer;
+        GUI.lcd.drawing_layer = layer;
+        draw_dial(h, &disp, x, y);
+        GUI.lcd.drawing_layer = prev;
+        GUI_LCD_TILES_UPDATE(layer);
+#if GUI_CFG_USE_COVERAGE_MASK
+        GUI.coverage.active = coverage;
+#endif /* GUI_CFG_USE_COVERAGE_MASK */
+        for (i = 0; i < GUI_COUNT_OF(o->dial_colors); i++) {
+            o->dial_colors[i] = guii_widget_getcolor(h, (uint8_t)i);
+        }
+        o->dial_font = h->font;
+        o->dial_valid = 1;
+    }
+    return layer;
+}
+
+/**
+ * \brief           Copy pre-rendered dial to drawing layer
+ * \param[in]       h: Widget handle
+ * \param[in]       disp: Display clipping region
+ * \param[in]       x: Absolute X position of widget
+ * \param[in]       y: Absolute Y position of widget
+ * \return          `1` when dial was copied, `0` when it must be drawn directly
+ */
+static uint8_t
+copy_dial(gui_handle_p h, const gui_display_t* disp, gui_dim_t x, gui_dim_t y) {
+    gui_layer_t* layer, *drawing = GUI.lcd.drawing_layer;
+    gui_dim_t x1, y1, x2, y2, wi, hi;
+    
+    wi = gui_widget_getwidth(h);
+    hi = gui_widget_getheight(h);
+    if ((layer = get_dial(h, x, y, wi, hi)) == NULL) {
+        return 0;
+    }
+#if GUI_CFG_USE_DISPLAY_LIST
+    guii_draw_list_cancel();                        /* Copy is not recorded to display list */
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+    x1 = GUI_MAX(disp->x1, x);
+    y1 = GUI_MAX(disp->y1, y);
+    x2 = GUI_MIN(disp->x2, x + wi);
+    y2 = GUI_MIN(disp->y2, y + hi);
+    guii_lcd_copylayer(drawing, layer, x1, y1, x2, y2);
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_GAUGE_CACHE */
+
+/* Set value for widget */
+static uint8_t
+set_value(gui_handle_p h, int32_t val) {
+    gui_gauge_t* o = GUI_VP(h);
+    if (o->value != val) {
+        int32_t old = o->value;
+        
+        o->value = val;
+        invalidate_needle(h, old);                  /* Dial is restored only around needle */
+        guii_widget_callback(h, GUI_EVT_VALUECHANGED, NULL, NULL);  /* Process callback */
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * \brief           Default widget callback function
+ * \param[in]       h: Widget handle
+ * \param[in]       evt: Event type
+ * \param[in]       param: Input parameters for callback type
+ * \param[out]      result: Result for callback type
+ * \return          `1` if command processed, `0` otherwise
+ */
+static uint8_t
+gui_gauge_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result) {
+    gui_gauge_t* o = GUI_VP(h);
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    switch (evt) {
+        case GUI_EVT_PRE_INIT: {
+            o->min = o->value = 0;
+            o->max = 100;
+            o->start = -1350;
+            o->sweep = 2700;
+            o->major = 10;
+            o->minor = 5;
+            return 1;
+        }
+        case GUI_EVT_SETPARAM: {
+            gui_widget_param* v = GUI_EVT_PARAMTYPE_WIDGETPARAM(param);
+            uint8_t dial = 1, changed = 0;
+            int32_t tmp;
+            switch (v->type) {
+                case CFG_VALUE:
+                    set_value(h, *(int32_t *)v->data);
+                    dial = 0;
+                    break;
+                case CFG_MIN:
+                    tmp = *(int32_t *)v->data;
+                    if (tmp < o->max && tmp != o->min) {
+                        o->min = tmp;
+                        changed = 1;
+                    }
+                    break;
+                case CFG_MAX:
+                    tmp = *(int32_t *)v->data;
+                    if (tmp > o->min && tmp != o->max) {
+                        o->max = tmp;
+                        changed = 1;
+                    }
+                    break;
+                case CFG_ANGLES: {
+                    const int16_t* a = (const int16_t *)v->data;
+                    if (a[1] != 0 && a[1] >= -3600 && a[1] <= 3600
+                        && (o->start != (int16_t)(a[0] % 3600) || o->sweep != a[1])) {
+                        o->start = (int16_t)(a[0] % 3600);
+                        o->sweep = a[1];
+                        changed = 1;
+                    }
+                    break;
+                }
+                case CFG_TICKS: {
+                    const uint8_t* t = (const uint8_t *)v->data;
+                    if (o->major != GUI_MAX(t[0], 1) || o->minor != GUI_MAX(t[1], 1)) {
+                        o->major = GUI_MAX(t[0], 1);
+                        o->minor = GUI_MAX(t[1], 1);
+                        changed = 1;
+                    }
+                    break;
+                }
+                case CFG_NEEDLE: {
+                    const gui_gauge_needle_t* n = (const gui_gauge_needle_t *)v->data;
+                    if (o->needle.img != n->img || o->needle.pivot_x != n->pivot_x || o->needle.pivot_y != n->pivot_y) {
+                        o->needle = *n;
+                        changed = 1;
+                    }
+                    dial = 0;
+                    break;
+                }
+                default: changed = 1; break;
+            }
+            if (!changed) {
+                GUI_EVT_RESULTTYPE_U8(result) = 0;  /* Nothing changed, skip invalidation */
+                break;
+            }
+#if GUI_CFG_USE_GAUGE_CACHE
+            if (dial) {
+                o->dial_valid = 0;                  /* Render scale again on next draw */
+            }
+#else /* GUI_CFG_USE_GAUGE_CACHE */
+            GUI_UNUSED(dial);
+#endif /* !GUI_CFG_USE_GAUGE_CACHE */
+            GUI_EVT_RESULTTYPE_U8(result) = 1;      /* Save result */
+            break;
+        }
+        case GUI_EVT_DRAW: {
+            gui_display_t* disp = GUI_EVT_PARAMTYPE_DISP(param);
+            gui_dim_t x, y;
+            uint8_t copied = 0;
+            
+            x = gui_widget_getabsolutex(h);         /* Get absolute position on screen */
+            y = gui_widget_getabsolutey(h);         /* Get absolute position on screen */
+            
+#if GUI_CFG_USE_GAUGE_CACHE
+            copied = copy_dial(h, disp, x, y);
+#endif /* GUI_CFG_USE_GAUGE_CACHE */
+            if (!copied) {
+                draw_dial(h, disp, x, y);
+            }
+            draw_needle(h, disp, x, y);
+            break;
+        }
+#if GUI_CFG_USE_GAUGE_CACHE
+        case GUI_EVT_REMOVE: {
+            free_dial(h);
+            return 1;
+        }
+        case GUI_EVT_CLONE: {                       /* Widget copied from prototype */
+            o->dial = NULL;                         /* Dial layer belongs to prototype */
+            o->dial_valid = 0;
+            return 1;
+        }
+#endif /* GUI_CFG_USE_GAUGE_CACHE */
+        case GUI_EVT_SAVESTATE: {                   /* Save values to screen snapshot */
+            GUI_EVT_RESULTTYPE_U8(result) = guii_widget_savestate(GUI_EVT_PARAMTYPE_WIDGETPARAM(param),
+                &o->min, offsetof(gui_gauge_t, needle) - offsetof(gui_gauge_t, min));
+            return 1;
+        }
+        case GUI_EVT_RESTORESTATE: {                /* Restore values from screen snapshot */
+            GUI_EVT_RESULTTYPE_U8(result) = guii_widget_restorestate(GUI_EVT_PARAMTYPE_WIDGETPARAM(param),
+                &o->min, offsetof(gui_gauge_t, needle) - offsetof(gui_gauge_t, min));
+#if GUI_CFG_USE_GAUGE_CACHE
+            o->dial_valid = 0;                      /* Scale may be different */
+#endif /* GUI_CFG_USE_GAUGE_CACHE */
+            return 1;
+        }
+        default:                                    /* Handle default option */
+            GUI_UNUSED3(h, param, result);          /* Unused elements to prevent compiler warnings */
+            return 0;                               /* Command was not processed */
+    }
+    return 1;
+}
+
+/**
+ * \brief           Create new gauge widget
+ *
+ *                  Dial with scale and labels is drawn once and needle is drawn over it on every redraw.
+ *                  When value changes, only area around old and new needle position is redrawn.
+ *
+ * \note            With \ref GUI_CFG_USE_GAUGE_CACHE enabled, dial is rendered to buffer of widget size
+ * \param[in]       id: Widget unique ID to use for identity for callback processing
+ * \param[in]       x: Widget `X` position relative to parent widget
+ * \param[in]       y: Widget `Y` position relative to parent widget
+ * \param[in]       width: Widget width in units of pixels
+ * \param[in]       height: Widget height in units of pixels
+ * \param[in]       parent: Parent widget handle. Set to `NULL` to use current active parent widget
+ * \param[in]       evt_fn: Custom widget callback function. Set to `NULL` to use default callback
+ * \param[in]       flags: flags for create procedure
+ * \return          Widget handle on success, `NULL` otherwise
+ */
+gui_handle_p
+gui_gauge_create(gui_id_t id, float x, float y, float width, float height, gui_handle_p parent, gui_widget_evt_fn evt_fn, uint16_t flags) {
+    return (gui_handle_p)gui_widget_create(&widget, id, x, y, width, height, parent, evt_fn, flags);
+}
+
+/**
+ * \brief           Set color to specific part of widget
+ * \param[in]       h: Widget handle
+ * \param[in]       index: Color index
+ * \param[in]       color: Color value
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_gauge_setcolor(gui_handle_p h, gui_gauge_color_t index, gui_color_t color) {
+    return gui_widget_setcolor(h, (uint8_t)index, color);
+}
+
+/**
+ * \brief           Set gauge current value
+ * \note            Value outside range is shown at start or end of scale
+ * \param[in]       h: Widget handle
+ * \param[in]       val: New current value
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_gauge_setvalue(gui_handle_p h, int32_t val) {
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    return guii_widget_setparam(h, CFG_VALUE, &val, 0, 0);  /* Only area of needle is invalidated */
+}
+
+/**
+ * \brief           Set gauge value at start of scale
+ * \param[in]       h: Widget handle
+ * \param[in]       val: New minimal value, must be lower than maximal value
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_gauge_setmin(gui_handle_p h, int32_t val) {
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    return guii_widget_setparam(h, CFG_MIN, &val, 1, 0);
+}
+
+/**
+ * \brief           Set gauge value at end of scale
+ * \param[in]       h: Widget handle
+ * \param[in]       val: New maximal value, must be greater than minimal value
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_gauge_setmax(gui_handle_p h, int32_t val) {
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    return guii_widget_setparam(h, CFG_MAX, &val, 1, 0);
+}
+
+/**
+ * \brief           Set position of scale on dial
+ * \param[in]       h: Widget handle
+ * \param[in]       start: Angle of scale start, clockwise from top in units of `0.1` degree
+ * \param[in]       sweep: Angle of whole scale in units of `0.1` degree, between `-3600` and `3600`.
+ *                      Negative value places scale counter-clockwise from start
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_gauge_setangles(gui_handle_p h, int16_t start, int16_t sweep) {
+    int16_t a[2];
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    a[0] = start;
+    a[1] = sweep;
+    return guii_widget_setparam(h, CFG_ANGLES, a, 1, 0);
+}
+
+/**
+ * \brief           Set number of scale divisions
+ * \param[in]       h: Widget handle
+ * \param[in]       major: Number of major divisions, each major tick has value label
+ * \param[in]       minor: Number of minor divisions in single major division
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_gauge_setticks(gui_handle_p h, uint8_t major, uint8_t minor) {
+    uint8_t t[2];
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    t[0] = major;
+    t[1] = minor;
+    return guii_widget_setparam(h, CFG_TICKS, t, 1, 0);
+}
+
+#if GUI_CFG_USE_IMAGE_TRANSFORM || __DOXYGEN__
+
+/**
+ * \brief           Set image used as needle instead of default one
+ *
+ *                  Image is rotated around pivot point placed at dial center with \ref gui_draw_image_transform.
+ *                  Hub is not drawn, it is expected to be part of image.
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       img: Needle image pointing up. Set to `NULL` to use default needle
+ * \param[in]       pivot_x: X position of rotation point in image
+ * \param[in]       pivot_y: Y position of rotation point in image
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_gauge_setneedleimage(gui_handle_p h, const gui_image_desc_t* img, gui_dim_t pivot_x, gui_dim_t pivot_y) {
+    gui_gauge_needle_t n;
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    n.img = img;
+    n.pivot_x = pivot_x;
+    n.pivot_y = pivot_y;
+    return guii_widget_setparam(h, CFG_NEEDLE, &n, 1, 0);
+}
+
+#endif /* GUI_CFG_USE_IMAGE_TRANSFORM || __DOXYGEN__ */
+
+/**
+ * \brief           Get gauge value at start of scale
+ * \param[in]       h: Widget handle
+ * \return          Minimal value
+ */
+int32_t
+gui_gauge_getmin(gui_handle_p h) {
+    gui_gauge_t* o = GUI_VP(h);
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    return o->min;
+}
+
+/**
+ * \brief           Get gauge value at end of scale
+ * \param[in]       h: Widget handle
+ * \return          Maximal value
+ */
+int32_t
+gui_gauge_getmax(gui_handle_p h) {
+    gui_gauge_t* o = GUI_VP(h);
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    return o->max;
+}
+
+/**
+ * \brief           Get gauge current value
+ * \param[in]       h: Widget handle
+ * \return          Current value
+ */
+int32_t
+gui_gauge_getvalue(gui_handle_p h) {
+    gui_gauge_t* o = GUI_VP(h);
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    return o->value;
+}
+
+#endif /* GUI_CFG_WIDGET_GAUGE || __DOXYGEN__ */
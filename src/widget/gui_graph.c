@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "widget/gui_graph.h"
 
+#if GUI_CFG_WIDGET_GRAPH || __DOXYGEN__
+
 /**
  * \ingroup         GUI_GRAPH
  * \brief           Graph data widget structure
@@ -46,14 +48,79 @@ typedef struct gui_graph_data {
     
     gui_id_t id;                                    /*!< Data ID */
     
-    int16_t* data;                                  /*!< Pointer to actual data object */
-    size_t length;                                  /*!< Size of data array */
+    void* x;                                        /*!< Pointer to array of X values, `NULL` for \ref GUI_GRAPH_TYPE_YT */
+    void* y;                                        /*!< Pointer to array of Y values */
+    size_t length;                                  /*!< Number of values in each array */
     size_t ptr;                                     /*!< Read/Write start pointer */
+    gui_graph_sample_t sample;                      /*!< Type of each X and Y value */
+    uint8_t x_shared;                               /*!< Set to `1` when X values belong to other data object and are never written */
     
     gui_color_t color;                              /*!< Curve color */
     gui_graph_type_t type;                          /*!< Plot data type */
+    
+    uint32_t version;                               /*!< Data version, incremented on every change */
+    uint32_t buff_version;                          /*!< Buffer version, incremented when data buffer is swapped */
+    float* col_min;                                 /*!< Decimated minimal value for each pixel column */
+    float* col_max;                                 /*!< Decimated maximal value for each pixel column */
+    gui_dim_t col_count;                            /*!< Number of decimated pixel columns */
+    uint32_t col_version;                           /*!< Data version used for decimated columns */
+    float col_min_x;                                /*!< Visible minimal X value used for decimated columns */
+    float col_max_x;                                /*!< Visible maximal X value used for decimated columns */
+    uint8_t col_valid;                              /*!< Decimated columns are valid for parameters above */
+    
+    uint8_t lod;                                    /*!< Set to `1` when level-of-detail levels are used for decimation */
+    uint8_t lod_valid;                              /*!< Levels are valid for current buffer and follow each write */
+    float* lod_levels;                              /*!< Minimal and maximal value pairs of all levels. First level summarizes
+                                                            \ref GRAPH_LOD_BLOCK values, each next level `2` entries of previous level */
+    size_t lod_length;                              /*!< Data length used for levels */
+    
+    uint8_t dens;                                   /*!< Set to `1` when \ref GUI_GRAPH_TYPE_XY data is drawn as density */
+    const gui_color_t* dens_lut;                    /*!< Density color table with `256` entries, `NULL` for default one */
+    uint16_t* dens_cnt;                             /*!< Number of points in each plot pixel, row by row from top */
+    gui_dim_t dens_width;                           /*!< Plot width used for point counts */
+    gui_dim_t dens_height;                          /*!< Plot height used for point counts */
+    float dens_min_x;                               /*!< Visible minimal X value used for point counts */
+    float dens_min_y;                               /*!< Visible minimal Y value used for point counts */
+    float dens_step_x;                              /*!< Number of pixels per X value unit used for point counts */
+    float dens_step_y;                              /*!< Number of pixels per Y value unit used for point counts */
+    uint8_t dens_valid;                             /*!< Point counts are valid for parameters above and follow each write */
 } gui_graph_data_t;
 
+#define GRAPH_TICKS_MAX     16              /*!< Maximal number of ticks on single axis */
+
+/**
+ * \ingroup         GUI_GRAPH
+ * \brief           Single axis tick with cached label
+ */
+typedef struct {
+    gui_dim_t pos;                                  /*!< Tick position relative to plot area, X from left or Y from top */
+    gui_dim_t width;                                /*!< Label width in units of pixels */
+    gui_char text[16];                              /*!< Label text */
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__
+    gui_text_layout_t layout;                       /*!< Cached layout of label text */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE || __DOXYGEN__ */
+} graph_tick_t;
+
+/**
+ * \ingroup         GUI_GRAPH
+ * \brief           Axis ticks and labels, computed again only when parameters below change
+ */
+typedef struct {
+    graph_tick_t x[GRAPH_TICKS_MAX];                /*!< Ticks on X axis */
+    graph_tick_t y[GRAPH_TICKS_MAX];                /*!< Ticks on Y axis */
+    uint8_t x_count;                                /*!< Number of ticks on X axis */
+    uint8_t y_count;                                /*!< Number of ticks on Y axis */
+    
+    uint8_t valid;                                  /*!< Ticks are valid for parameters below */
+    const gui_font_t* font;                         /*!< Font used for labels */
+    gui_dim_t width;                                /*!< Widget width used for ticks */
+    gui_dim_t height;                               /*!< Widget height used for ticks */
+    float min_x;                                    /*!< Visible minimal X value used for ticks */
+    float max_x;                                    /*!< Visible maximal X value used for ticks */
+    float min_y;                                    /*!< Visible minimal Y value used for ticks */
+    float max_y;                                    /*!< Visible maximal Y value used for ticks */
+} graph_axes_t;
+
 /**
  * \ingroup         GUI_GRAPH
  * \brief           Graph widget structure
@@ -73,6 +140,20 @@ typedef struct {
     float visible_max_x;                            /*!< Visible maximal X value for plot */
     float visible_min_y;                            /*!< Visible minimal Y value for plot */
     float visible_max_y;                            /*!< Visible maximal Y value for plot */
+    graph_axes_t* axes;                             /*!< Axis ticks and labels, `NULL` when labels are disabled */
+#if GUI_CFG_USE_WIDGET_CACHE || __DOXYGEN__
+    uint8_t strip;                                  /*!< Set to `1` when strip chart mode is enabled */
+    uint8_t strip_valid;                            /*!< Cache layer holds complete graph for parameters below */
+    uint32_t strip_version;                         /*!< Data version drawn to cache layer */
+    uint32_t strip_buff_version;                    /*!< Data buffer version drawn to cache layer */
+    float strip_frac;                               /*!< Fractional part of pixels scrolled */
+    gui_dim_t strip_width;                          /*!< Widget width used for cached graph */
+    gui_dim_t strip_height;                         /*!< Widget height used for cached graph */
+    float strip_min_x;                              /*!< Visible minimal X value used for cached graph */
+    float strip_max_x;                              /*!< Visible maximal X value used for cached graph */
+    float strip_min_y;                              /*!< Visible minimal Y value used for cached graph */
+    float strip_max_y;                              /*!< Visible maximal Y value used for cached graph */
+#endif /* GUI_CFG_USE_WIDGET_CACHE || __DOXYGEN__ */
 } gui_graph_t;
 
 #define CFG_MIN_X           0x01
@@ -81,6 +162,9 @@ typedef struct {
 #define CFG_MAX_Y           0x04
 #define CFG_ZOOM_RESET      0x05
 
+#define GRAPH_CHUNK         32              /*!< Number of points transformed to screen coordinates at a time */
+#define GRAPH_LOD_BLOCK     16              /*!< Number of values summarized by single entry of first level-of-detail level */
+
 static uint8_t gui_graph_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result);
 
 /**
@@ -92,6 +176,7 @@ gui_color_t colors[] = {
     GUI_COLOR_BLACK,                                /*!< Default foreground color */
     GUI_COLOR_BLACK,                                /*!< Default border color */
     0xFF002F00,                                     /*!< Default grid color */
+    GUI_COLOR_BLACK,                                /*!< Default axis label color */
 };
 
 /**
@@ -107,6 +192,293 @@ gui_widget_t widget = {
     .color_count = GUI_COUNT_OF(colors),            /*!< Number of colors */
 };
 
+/**
+ * \brief           Size of single value in units of bytes in the same order of sample type enumeration
+ */
+static const
+uint8_t sample_sizes[] = {
+    sizeof(int16_t),                                /*!< Size of \ref GUI_GRAPH_SAMPLE_INT16 */
+    sizeof(int32_t),                                /*!< Size of \ref GUI_GRAPH_SAMPLE_INT32 */
+    sizeof(float),                                  /*!< Size of \ref GUI_GRAPH_SAMPLE_FLOAT */
+};
+
+/**
+ * \brief           Transform contiguous values to screen coordinates
+ *
+ *                  Each output is `origin + (value - min) * step`.
+ *                  Loops work on plain arrays without dependencies between values,
+ *                  so compiler can vectorize them.
+ *
+ * \param[in]       values: Array of values of `sample` type
+ * \param[in]       sample: Type of values
+ * \param[in]       start: Index of first value to transform
+ * \param[in]       count: Number of values to transform
+ * \param[in]       origin: Screen coordinate of `min` value
+ * \param[in]       min: Value at `origin` coordinate
+ * \param[in]       step: Number of pixels per value unit, negative for Y axis
+ * \param[out]      out: Array of at least `count` screen coordinates
+ */
+static void
+graph_transform(const void* values, gui_graph_sample_t sample, size_t start, size_t count, float origin, float min, float step, float* out) {
+    size_t i;
+
+    switch (sample) {
+        case GUI_GRAPH_SAMPLE_INT32: {
+            const int32_t* v = (const int32_t *)values + start;
+            for (i = 0; i < count; i++) {
+                out[i] = origin + ((float)v[i] - min) * step;
+            }
+            break;
+        }
+        case GUI_GRAPH_SAMPLE_FLOAT: {
+            const float* v = (const float *)values + start;
+            for (i = 0; i < count; i++) {
+                out[i] = origin + (v[i] - min) * step;
+            }
+            break;
+        }
+        default: {
+            const int16_t* v = (const int16_t *)values + start;
+            for (i = 0; i < count; i++) {
+                out[i] = origin + ((float)v[i] - min) * step;
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * \brief           Colors of default density color table, values are spread evenly between them
+ */
+static const
+gui_color_t dens_stops[] = {
+    0xFF0000FF,
+    0xFF00FFFF,
+    0xFFFFFF00,
+    GUI_COLOR_WHITE,
+};
+
+/**
+ * \brief           Get tick step for axis as `mant * 10^exp`
+ * \param[in]       raw: Minimal step in units of values
+ * \param[out]      mant: Step mantissa, `1`, `2` or `5`
+ * \param[out]      exp: Step exponent
+ */
+static void
+graph_axis_step(float raw, uint8_t* mant, int8_t* exp) {
+    float p = 1.0f;
+    int8_t e = 0;
+    
+    for (; e < 9 && p * 10.0f <= raw; e++) {
+        p *= 10.0f;
+    }
+    for (; e > -9 && p > raw; e--) {
+        p /= 10.0f;
+    }
+    if (raw <= p) {
+        *mant = 1;
+    } else if (raw <= 2.0f * p) {
+        *mant = 2;
+    } else if (raw <= 5.0f * p) {
+        *mant = 5;
+    } else {
+        *mant = 1;
+        e++;
+    }
+    *exp = e;
+}
+
+/**
+ * \brief           Compute ticks and labels for single axis
+ *
+ *                  Ticks are placed on multiples of `1`, `2` or `5` times power of `10`.
+ *                  Labels are formatted from integer multiples of step as fixed-point numbers, no floating-point formatting is used.
+ *
+ * \param[out]      ticks: Array of \ref GRAPH_TICKS_MAX ticks
+ * \param[in]       font: Font used for labels
+ * \param[in]       min: Visible minimal value
+ * \param[in]       max: Visible maximal value
+ * \param[in]       size: Axis length in units of pixels
+ * \param[in]       spacing: Minimal distance between ticks in units of pixels
+ * \param[in]       is_y: Set to `1` for Y axis where positions grow downwards
+ * \return          Number of ticks
+ */
+static uint8_t
+graph_axis_ticks(graph_tick_t* ticks, const gui_font_t* font, float min, float max, gui_dim_t size, gui_dim_t spacing, uint8_t is_y) {
+    gui_dim_t widths[GUI_COUNT_OF(ticks->text)];
+    gui_string_numberformat_t fmt = {0};
+    uint8_t mant, i, len, count = 0;
+    int8_t exp;
+    int32_t mul, n, first, last;
+    float step, pstep;
+    
+    if (size <= 0 || !(max > min) || spacing <= 0) {
+        return 0;
+    }
+    
+    pstep = (float)size / (max - min);              /* Number of pixels per value unit */
+    graph_axis_step((float)spacing / pstep, &mant, &exp);
+    for (;;) {
+        step = (float)mant;
+        for (i = 0; (int8_t)i < exp; i++) {
+            step *= 10.0f;
+        }
+        for (i = 0; (int8_t)i < -exp; i++) {
+            step /= 10.0f;
+        }
+        if (step > 1e9f || exp < -9 || GUI_MAX(max < 0 ? -max : max, min < 0 ? -min : min) > 1e9f
+            || GUI_MAX(max < 0 ? -max : max, min < 0 ? -min : min) / step > 1e8f) {
+            return 0;                               /* Label values would overflow or need too many decimals */
+        }
+        for (mul = mant, i = 0; (int8_t)i < exp; i++) { /* Integer step for labels */
+            mul *= 10;
+        }
+        first = (int32_t)ceilf(min / step);
+        last = (int32_t)floorf(max / step);
+        if (last - first < GRAPH_TICKS_MAX) {
+            break;
+        }
+        if (mant == 5) {                            /* Use next larger step */
+            mant = 1;
+            exp++;
+        } else {
+            mant = mant == 1 ? 2 : 5;
+        }
+    }
+    
+    fmt.decimals = exp < 0 ? (uint8_t)-exp : 0;     /* Label value is integer multiple of 10^exp */
+    for (n = first; n <= last; n++, count++) {
+        graph_tick_t* tk = &ticks[count];
+        
+        tk->pos = GUI_MIN(GUI_DIM(((float)n * step - min) * pstep), size - 1);
+        if (is_y) {
+            tk->pos = size - 1 - tk->pos;
+        }
+        
+        gui_string_fromnumber(tk->text, GUI_COUNT_OF(tk->text), n * mul, &fmt);
+        
+        len = (uint8_t)gui_text_getprefixwidths(font, tk->text, widths, GUI_COUNT_OF(widths) - 1);
+        tk->width = widths[len];
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE
+        gui_draw_text_layout_invalidate(&tk->layout);   /* Text changed inside the same buffer */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE */
+    }
+    return count;
+}
+
+/**
+ * \brief           Compute ticks and labels for both axes and set borders for labels
+ *
+ *                  Nothing is computed while visible area, widget size and font do not change
+ *
+ * \param[in]       h: Widget handle
+ */
+static void
+graph_axes_update(gui_handle_p h) {
+    gui_graph_t* g = (gui_graph_t *)h;
+    graph_axes_t* a = g->axes;
+    const gui_font_t* font = gui_widget_getfont(h);
+    gui_dim_t width = gui_widget_getwidth(h);
+    gui_dim_t height = gui_widget_getheight(h);
+    gui_dim_t fs, maxw = 0;
+    uint8_t i;
+    
+    if (a->valid && a->font == font && a->width == width && a->height == height
+        && a->min_x == g->visible_min_x && a->max_x == g->visible_max_x
+        && a->min_y == g->visible_min_y && a->max_y == g->visible_max_y) {
+        return;
+    }
+    a->x_count = a->y_count = 0;
+    if (font != NULL) {
+        fs = (gui_dim_t)font->size;
+        
+        /* Bottom border holds X labels, Y ticks depend on it */
+        g->border[GUI_GRAPH_BORDER_BOTTOM] = fs + 6;
+        a->y_count = graph_axis_ticks(a->y, font, g->visible_min_y, g->visible_max_y,
+            height - g->border[GUI_GRAPH_BORDER_TOP] - g->border[GUI_GRAPH_BORDER_BOTTOM], 2 * fs, 1);
+        
+        /* Left border holds widest Y label, X ticks depend on it */
+        for (i = 0; i < a->y_count; i++) {
+            maxw = GUI_MAX(maxw, a->y[i].width);
+        }
+        g->border[GUI_GRAPH_BORDER_LEFT] = GUI_MAX(5, maxw + 6);
+        a->x_count = graph_axis_ticks(a->x, font, g->visible_min_x, g->visible_max_x,
+            width - g->border[GUI_GRAPH_BORDER_LEFT] - g->border[GUI_GRAPH_BORDER_RIGHT], 5 * fs, 0);
+    }
+    a->valid = 1;
+    a->font = font;
+    a->width = width;
+    a->height = height;
+    a->min_x = g->visible_min_x;
+    a->max_x = g->visible_max_x;
+    a->min_y = g->visible_min_y;
+    a->max_y = g->visible_max_y;
+}
+
+/**
+ * \brief           Draw cached axis labels in borders
+ * \param[in]       h: Widget handle
+ * \param[in]       disp: Clipping region
+ * \param[in]       x: Absolute X position of widget
+ * \param[in]       y: Absolute Y position of widget
+ */
+static void
+graph_axes_draw(gui_handle_p h, const gui_display_t* disp, gui_dim_t x, gui_dim_t y) {
+    gui_graph_t* g = (gui_graph_t *)h;
+    graph_axes_t* a = g->axes;
+    const gui_font_t* font = gui_widget_getfont(h);
+    gui_dim_t width = gui_widget_getwidth(h);
+    gui_dim_t height = gui_widget_getheight(h);
+    gui_draw_text_t f;
+    graph_tick_t* t;
+    uint8_t i;
+    
+    for (i = 0; i < a->x_count + a->y_count; i++) {
+        gui_draw_text_init(&f);
+        if (i < a->x_count) {                       /* X label below tick, kept inside widget */
+            t = &a->x[i];
+            f.x = x + g->border[GUI_GRAPH_BORDER_LEFT] + t->pos - t->width / 2;
+            f.x = GUI_MAX(x + 1, GUI_MIN(f.x, x + width - 1 - t->width));
+            f.y = y + height - g->border[GUI_GRAPH_BORDER_BOTTOM] + 3;
+        } else {                                    /* Y label left of tick, kept inside widget */
+            t = &a->y[i - a->x_count];
+            f.x = x + g->border[GUI_GRAPH_BORDER_LEFT] - 3 - t->width;
+            f.y = y + g->border[GUI_GRAPH_BORDER_TOP] + t->pos - (gui_dim_t)font->size / 2;
+            f.y = GUI_MAX(y + 1, GUI_MIN(f.y, y + height - 1 - (gui_dim_t)font->size));
+        }
+        f.width = t->width + 1;
+        f.height = (gui_dim_t)font->size;
+        if (f.x >= disp->x2 || f.y >= disp->y2 || (f.x + f.width) <= disp->x1 || (f.y + f.height) <= disp->y1) {
+            continue;                               /* Label is not in clipping region */
+        }
+        f.align = GUI_HALIGN_LEFT | GUI_VALIGN_TOP;
+        f.color1width = f.width;
+        f.color1 = guii_widget_getcolor(h, GUI_GRAPH_COLOR_TEXT);
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE
+        f.layout = &t->layout;
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE */
+        gui_draw_writetext(disp, font, t->text, &f);
+    }
+}
+
+/**
+ * \brief           Release axis ticks and labels
+ * \param[in]       g: Graph widget
+ */
+static void
+graph_axes_free(gui_graph_t* g) {
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE
+    uint8_t i;
+    
+    for (i = 0; i < GRAPH_TICKS_MAX; i++) {
+        gui_draw_text_layout_free(&g->axes->x[i].layout);
+        gui_draw_text_layout_free(&g->axes->y[i].layout);
+    }
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE */
+    GUI_MEMFREE(g->axes);
+    g->axes = NULL;
+}
+
 /**
  * \brief           Reset zoom to `1`
  * \param[in]       h: Widget handle
@@ -122,25 +494,835 @@ graph_reset(gui_handle_p h) {
 }
 
 /**
- * \brief           Zoom plot with specific zoom at specific coordinates
+ * \brief           Zoom plot with specific zoom at specific coordinates
+ * \param[in]       h: Widget handle
+ * \param[in]       zoom: Zoom multiplier. number > 1 is zoom, less is unzoom
+ * \param[in]       xpos, ypos: X and Y position for zoom coordinate on screen
+ */
+static void
+graph_zoom(gui_handle_p h, float zoom, float xpos, float ypos) {
+    gui_graph_t* g = (gui_graph_t *)h;
+
+    if (xpos < 0.0f || xpos > 1.0f) { xpos = 0.5f; }
+    if (ypos < 0.0f || ypos > 1.0f) { ypos = 0.5f; }
+           
+    g->visible_min_x += (g->visible_max_x - g->visible_min_x) * (zoom - 1.0f) * xpos;
+    g->visible_max_x -= (g->visible_max_x - g->visible_min_x) * (zoom - 1.0f) * (1.0f - xpos);
+
+    g->visible_min_y += (g->visible_max_y - g->visible_min_y) * (zoom - 1.0f) * ypos;
+    g->visible_max_y -= (g->visible_max_y - g->visible_min_y) * (zoom - 1.0f) * (1.0f - ypos);
+}
+
+/**
+ * \brief           Merge value range to minimal and maximal value
+ *
+ *                  Empty range has minimal value greater than maximal value
+ *
+ * \param[in,out]   min, max: Range to merge to
+ * \param[in]       vmin, vmax: Range to merge
+ */
+static void
+graph_merge(float* min, float* max, float vmin, float vmax) {
+    if (*min > *max) {                              /* Range is empty */
+        *min = vmin;
+        *max = vmax;
+    } else {
+        if (vmin < *min) {
+            *min = vmin;
+        }
+        if (vmax > *max) {
+            *max = vmax;
+        }
+    }
+}
+
+/**
+ * \brief           Merge minimal and maximal value of contiguous Y values
+ * \param[in]       data: Data object handle
+ * \param[in]       a: Ring position of first value
+ * \param[in]       b: Ring position after last value
+ * \param[in,out]   min, max: Range to merge values to
+ */
+static void
+graph_lod_raw(const gui_graph_data_t* data, size_t a, size_t b, float* min, float* max) {
+    float v[GRAPH_CHUNK];
+    size_t k, n;
+    
+    for (; a < b; a += n) {
+        n = GUI_MIN(b - a, (size_t)GRAPH_CHUNK);
+        graph_transform(data->y, data->sample, a, n, 0, 0, 1, v);
+        for (k = 0; k < n; k++) {
+            graph_merge(min, max, v[k], v[k]);
+        }
+    }
+}
+
+/**
+ * \brief           Compute level-of-detail entries for range of first level entries and all their parents
+ * \param[in]       data: Data object with allocated levels
+ * \param[in]       lo: First entry of first level
+ * \param[in]       hi: Last entry of first level, inclusive
+ */
+static void
+graph_lod_compute(gui_graph_data_t* data, size_t lo, size_t hi) {
+    float* l = data->lod_levels;
+    size_t j, n = data->length / GRAPH_LOD_BLOCK;
+    
+    for (j = lo; j <= hi && j < n; j++) {           /* First level from values */
+        l[2 * j] = 1;
+        l[2 * j + 1] = 0;
+        graph_lod_raw(data, j * GRAPH_LOD_BLOCK, (j + 1) * GRAPH_LOD_BLOCK, &l[2 * j], &l[2 * j + 1]);
+    }
+    for (; n > 1; n >>= 1) {                        /* Each next level from 2 entries of previous */
+        lo >>= 1;
+        hi >>= 1;
+        for (j = lo; j <= hi && j < (n >> 1); j++) {
+            l[2 * n + 2 * j] = l[4 * j];
+            l[2 * n + 2 * j + 1] = l[4 * j + 1];
+            graph_merge(&l[2 * n + 2 * j], &l[2 * n + 2 * j + 1], l[4 * j + 2], l[4 * j + 3]);
+        }
+        l += 2 * n;
+    }
+}
+
+/**
+ * \brief           Allocate and compute level-of-detail levels for complete buffer
+ * \param[in]       data: YT data object
+ * \return          `1` when levels are valid, `0` otherwise
+ */
+static uint8_t
+graph_lod_build(gui_graph_data_t* data) {
+    size_t n, count = 0;
+    
+    if (data->lod_valid) {
+        return 1;
+    }
+    if (data->lod_levels == NULL || data->lod_length != data->length) {
+        if (data->lod_levels != NULL) {
+            GUI_MEMFREE(data->lod_levels);
+        }
+        for (n = data->length / GRAPH_LOD_BLOCK; n; n >>= 1) {
+            count += n;
+        }
+        data->lod_levels = count ? GUI_MEMALLOC(2 * sizeof(*data->lod_levels) * count) : NULL;
+        if (data->lod_levels == NULL) {
+            data->lod_length = 0;
+            return 0;
+        }
+        data->lod_length = data->length;
+    }
+    graph_lod_compute(data, 0, data->length / GRAPH_LOD_BLOCK);
+    data->lod_valid = 1;
+    return 1;
+}
+
+/**
+ * \brief           Merge minimal and maximal value of contiguous Y values using level-of-detail levels
+ *
+ *                  Largest entries which fit to range are used, time is proportional to logarithm of range length
+ *
+ * \param[in]       data: Data object with valid levels
+ * \param[in]       a: Ring position of first value
+ * \param[in]       b: Ring position after last value
+ * \param[in,out]   min, max: Range to merge values to
+ */
+static void
+graph_lod_query(const gui_graph_data_t* data, size_t a, size_t b, float* min, float* max) {
+    const float* l = data->lod_levels;
+    size_t lo, hi, n = data->length / GRAPH_LOD_BLOCK;
+    
+    /* Values before first and after last complete block */
+    lo = GUI_MIN(b, (a + GRAPH_LOD_BLOCK - 1) / GRAPH_LOD_BLOCK * GRAPH_LOD_BLOCK);
+    graph_lod_raw(data, a, lo, min, max);
+    hi = GUI_MAX(lo, b / GRAPH_LOD_BLOCK * GRAPH_LOD_BLOCK);
+    graph_lod_raw(data, hi, b, min, max);
+    
+    /* Complete blocks, go up until range is covered */
+    for (lo /= GRAPH_LOD_BLOCK, hi /= GRAPH_LOD_BLOCK; lo < hi; lo >>= 1, hi >>= 1) {
+        if (lo & 1) {
+            graph_merge(min, max, l[2 * lo], l[2 * lo + 1]);
+            lo++;
+        }
+        if (hi & 1) {
+            hi--;
+            graph_merge(min, max, l[2 * hi], l[2 * hi + 1]);
+        }
+        l += 2 * n;
+        n >>= 1;
+    }
+}
+
+/**
+ * \brief           Get first sample index which belongs to pixel column or columns right of it
+ * \param[in]       g: Graph widget
+ * \param[in]       data: YT data object
+ * \param[in]       c: Pixel column
+ * \param[in]       xStep: Number of pixels per sample
+ * \return          Sample index, oldest sample is `0`
+ */
+static size_t
+graph_column_start(gui_graph_t* g, gui_graph_data_t* data, gui_dim_t c, float xStep) {
+    float est = g->visible_min_x + (float)c / xStep;
+    size_t i;
+    
+    i = est <= 0.0f ? 0 : (est >= (float)data->length ? data->length : (size_t)est);
+    
+    /* Estimate may differ by rounding, use the same expression as for drawing */
+    while (i > 0 && ((float)(i - 1) - g->visible_min_x) * xStep >= (float)c) {
+        i--;
+    }
+    while (i < data->length && ((float)i - g->visible_min_x) * xStep < (float)c) {
+        i++;
+    }
+    return i;
+}
+
+/**
+ * \brief           Decimate YT plot samples to minimal and maximal value per pixel column
+ *
+ *                  Result is cached in data object until data, visible X range or plot width changes
+ *
+ * \param[in]       g: Graph widget
+ * \param[in]       data: YT data object
+ * \param[in]       width: Plot area width in units of pixels
+ * \param[in]       xStep: Number of pixels per sample
+ * \return          `1` when columns are valid, `0` otherwise
+ */
+static uint8_t
+graph_decimate(gui_graph_t* g, gui_graph_data_t* data, gui_dim_t width, float xStep) {
+    float v[GRAPH_CHUNK];
+    size_t i, k, n, read;
+    float pos;
+    gui_dim_t c;
+    
+    if (width <= 0 || !data->length) {
+        return 0;
+    }
+    if (data->col_valid && data->col_version == data->version && data->col_count == width
+        && data->col_min_x == g->visible_min_x && data->col_max_x == g->visible_max_x) {
+        return 1;                                   /* Cached columns are still valid */
+    }
+    
+    if (data->col_count != width) {                 /* Plot size changed, reallocate columns */
+        if (data->col_min != NULL) {
+            GUI_MEMFREE(data->col_min);
+        }
+        data->col_min = GUI_MEMALLOC(2 * sizeof(*data->col_min) * width);
+        if (data->col_min == NULL) {
+            data->col_max = NULL;
+            data->col_count = 0;
+            data->col_valid = 0;
+            return 0;
+        }
+        data->col_max = data->col_min + width;
+        data->col_count = width;
+    }
+    for (c = 0; c < width; c++) {                   /* Reset all columns to empty, minimal is greater than maximal */
+        data->col_min[c] = 1;
+        data->col_max[c] = 0;
+    }
+    
+    if (data->lod && xStep > 0.0f && graph_lod_build(data)) {   /* Each column from level-of-detail levels */
+        size_t from, to, cnt;
+        
+        to = graph_column_start(g, data, 0, xStep);
+        for (c = 0; c < width && to < data->length; c++) {
+            from = to;
+            to = graph_column_start(g, data, c + 1, xStep);
+            if (from == to) {
+                continue;
+            }
+            read = (data->ptr + from) % data->length;
+            cnt = GUI_MIN(to - from, data->length - read);
+            graph_lod_query(data, read, read + cnt, &data->col_min[c], &data->col_max[c]);
+            if (cnt < to - from) {                  /* Column continues on start of ring */
+                graph_lod_query(data, 0, to - from - cnt, &data->col_min[c], &data->col_max[c]);
+            }
+        }
+    } else {
+        /* Put each visible sample to its pixel column, values are read in contiguous chunks */
+        i = g->visible_min_x > 0 ? (size_t)g->visible_min_x : 0;
+        read = (data->ptr + i) % data->length;
+        for (; i < data->length; i += n) {
+            n = GUI_MIN(GUI_MIN((size_t)GRAPH_CHUNK, data->length - i), data->length - read);
+            graph_transform(data->y, data->sample, read, n, 0, 0, 1, v);
+            for (k = 0; k < n; k++) {
+                pos = ((float)(i + k) - g->visible_min_x) * xStep;
+                if (pos >= (float)width) {          /* Right of visible area, samples are in increasing order */
+                    break;
+                }
+                if (pos >= 0.0f) {
+                    c = (gui_dim_t)pos;
+                    graph_merge(&data->col_min[c], &data->col_max[c], v[k], v[k]);
+                }
+            }
+            if (k < n) {
+                break;
+            }
+            read += n;
+            if (read == data->length) {
+                read = 0;
+            }
+        }
+    }
+    
+    data->col_version = data->version;
+    data->col_min_x = g->visible_min_x;
+    data->col_max_x = g->visible_max_x;
+    data->col_valid = 1;
+    return 1;
+}
+
+/**
+ * \brief           Add or remove points to or from density point counts
+ *
+ *                  Points outside visible area are ignored, counts saturate at `65535`
+ *
+ * \param[in]       data: XY data object with allocated point counts
+ * \param[in]       start: Ring position of first point
+ * \param[in]       count: Number of contiguous points
+ * \param[in]       add: Set to `1` to add points or `0` to remove them
+ */
+static void
+graph_density_update(gui_graph_data_t* data, size_t start, size_t count, uint8_t add) {
+    float px[GRAPH_CHUNK], py[GRAPH_CHUNK];
+    size_t k, n;
+    uint16_t* cnt;
+    
+    for (; count; count -= n, start += n) {
+        n = GUI_MIN(count, (size_t)GRAPH_CHUNK);
+        graph_transform(data->x, data->sample, start, n, 0, data->dens_min_x, data->dens_step_x, px);
+        graph_transform(data->y, data->sample, start, n, 0, data->dens_min_y, data->dens_step_y, py);
+        for (k = 0; k < n; k++) {
+            if (px[k] < 0.0f || px[k] >= (float)data->dens_width
+                || py[k] < 0.0f || py[k] >= (float)data->dens_height) {
+                continue;                           /* Point is not visible */
+            }
+            cnt = &data->dens_cnt[(data->dens_height - 1 - (gui_dim_t)py[k]) * data->dens_width + (gui_dim_t)px[k]];
+            if (add) {
+                if (*cnt < 0xFFFF) {
+                    (*cnt)++;
+                }
+            } else if (*cnt > 0 && *cnt < 0xFFFF) { /* Saturated count stays as is */
+                (*cnt)--;
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Accumulate all XY plot points to point count for each plot pixel
+ *
+ *                  Result is kept in data object and updated on every write
+ *                  until buffer, visible area or plot size changes
+ *
+ * \param[in]       g: Graph widget
+ * \param[in]       data: XY data object
+ * \param[in]       width: Plot area width in units of pixels
+ * \param[in]       height: Plot area height in units of pixels
+ * \param[in]       xStep: Number of pixels per X value unit
+ * \param[in]       yStep: Number of pixels per Y value unit
+ * \return          `1` when point counts are valid, `0` otherwise
+ */
+static uint8_t
+graph_density(gui_graph_t* g, gui_graph_data_t* data, gui_dim_t width, gui_dim_t height, float xStep, float yStep) {
+    if (width <= 0 || height <= 0) {
+        return 0;
+    }
+    if (data->dens_valid && data->dens_width == width && data->dens_height == height
+        && data->dens_min_x == g->visible_min_x && data->dens_step_x == xStep
+        && data->dens_min_y == g->visible_min_y && data->dens_step_y == yStep) {
+        return 1;                                   /* Counts follow all writes */
+    }
+    
+    if (data->dens_width != width || data->dens_height != height) { /* Plot size changed, reallocate counts */
+        if (data->dens_cnt != NULL) {
+            GUI_MEMFREE(data->dens_cnt);
+        }
+        data->dens_cnt = GUI_MEMALLOC(sizeof(*data->dens_cnt) * width * height);
+        if (data->dens_cnt == NULL) {
+            data->dens_width = 0;
+            data->dens_height = 0;
+            data->dens_valid = 0;
+            return 0;
+        }
+        data->dens_width = width;
+        data->dens_height = height;
+    } else {
+        memset(data->dens_cnt, 0x00, sizeof(*data->dens_cnt) * width * height);
+    }
+    
+    data->dens_min_x = g->visible_min_x;
+    data->dens_min_y = g->visible_min_y;
+    data->dens_step_x = xStep;
+    data->dens_step_y = yStep;
+    graph_density_update(data, 0, data->length, 1);
+    data->dens_valid = 1;
+    return 1;
+}
+
+/**
+ * \brief           Draw point counts of data object with its color table
+ *
+ *                  Neighbour pixels with the same color are drawn as single line,
+ *                  drawing time depends only on plot size
+ *
+ * \param[in]       disp: Clipping region, already limited to plot area
+ * \param[in]       data: XY data object with valid point counts
+ * \param[in]       x: Absolute X position of plot area
+ * \param[in]       y: Absolute Y position of plot area
+ */
+static void
+graph_density_draw(const gui_display_t* disp, gui_graph_data_t* data, gui_dim_t x, gui_dim_t y) {
+    const uint16_t* row;
+    gui_dim_t r, r_to, c, c_from, c_to, start;
+    uint32_t max = 0, pos;
+    size_t i, s;
+    uint8_t idx, start_idx;
+    gui_color_t color;
+    
+    for (i = 0; i < (size_t)data->dens_width * data->dens_height; i++) {   /* Colors are scaled to maximal count */
+        if (data->dens_cnt[i] > max) {
+            max = data->dens_cnt[i];
+        }
+    }
+    if (!max) {
+        return;
+    }
+    
+    r = GUI_MAX(0, disp->y1 - y);
+    r_to = GUI_MIN(data->dens_height, disp->y2 - y);
+    c_from = GUI_MAX(0, disp->x1 - x);
+    c_to = GUI_MIN(data->dens_width, disp->x2 - x);
+    for (; r < r_to; r++) {
+        row = &data->dens_cnt[r * data->dens_width];
+        for (c = c_from; c < c_to;) {
+            if (!row[c]) {                          /* Empty pixel shows plot background */
+                c++;
+                continue;
+            }
+            start = c;
+            start_idx = GUI_U8(((uint32_t)row[c] * 255 + max - 1) / max);
+            for (c++; c < c_to && row[c]; c++) {
+                idx = GUI_U8(((uint32_t)row[c] * 255 + max - 1) / max);
+                if (idx != start_idx) {
+                    break;
+                }
+            }
+            if (data->dens_lut != NULL) {
+                color = data->dens_lut[start_idx];
+            } else {
+                pos = (uint32_t)start_idx * (GUI_COUNT_OF(dens_stops) - 1);
+                s = pos / 255;
+                color = s < GUI_COUNT_OF(dens_stops) - 1
+                    ? 0xFF000000UL | guii_blend_color(dens_stops[s + 1], dens_stops[s], GUI_U8(pos % 255)) : dens_stops[s];
+            }
+            gui_draw_hline(disp, x + start, y + r, c - start, color);
+        }
+    }
+}
+
+/**
+ * \brief           Draw plot area of graph inside clipping region
+ *
+ *                  Background, grid lines and plots are drawn, borders and axis labels are not touched.
+ *
+ * \param[in]       h: Widget handle
+ * \param[in,out]   disp: Clipping region, restored before function returns
+ */
+static void
+graph_draw_plot(gui_handle_p h, gui_display_t* disp) {
+    gui_graph_t* g = (gui_graph_t *)h;
+    gui_graph_data_p data;
+    gui_linkedlistmulti_t* link;
+    gui_dim_t bt, br, bb, bl, x, y, width, height;
+    uint8_t i;
+    
+    bt = g->border[GUI_GRAPH_BORDER_TOP];
+    br = g->border[GUI_GRAPH_BORDER_RIGHT];
+    bb = g->border[GUI_GRAPH_BORDER_BOTTOM];
+    bl = g->border[GUI_GRAPH_BORDER_LEFT];
+    
+    x = gui_widget_getabsolutex(h);
+    y = gui_widget_getabsolutey(h);
+    width = gui_widget_getwidth(h);
+    height = gui_widget_getheight(h);
+    
+    gui_draw_filledrectangle(disp, x + bl, y + bt, width - bl - br, height - bt - bb, guii_widget_getcolor(h, GUI_GRAPH_COLOR_FG));
+    
+    if (g->axes != NULL) {                          /* Grid lines on ticks */
+        for (i = 0; i < g->axes->y_count; i++) {
+            gui_draw_hline(disp, x + bl, y + bt + g->axes->y[i].pos, width - bl - br, guii_widget_getcolor(h, GUI_GRAPH_COLOR_GRID));
+        }
+        for (i = 0; i < g->axes->x_count; i++) {
+            gui_draw_vline(disp, x + bl + g->axes->x[i].pos, y + bt, height - bt - bb, guii_widget_getcolor(h, GUI_GRAPH_COLOR_GRID));
+        }
+    } else {
+        /* Draw horizontal lines */
+        if (g->rows) {
+            float step;
+            step = (float)(height - bt - bb) / (float)g->rows;
+            for (i = 1; i < g->rows; i++) {
+                gui_draw_hline(disp, GUI_DIM(x + bl), GUI_DIM(y + bt + i * step), GUI_DIM(width - bl - br), guii_widget_getcolor(h, GUI_GRAPH_COLOR_GRID));
+            }
+        }
+        /* Draw vertical lines */
+        if (g->columns) {
+            float step;
+            step = (float)(width - bl - br) / (float)g->columns;
+            for (i = 1; i < g->columns; i++) {
+                gui_draw_vline(disp, GUI_DIM(x + bl + i * step), GUI_DIM(y + bt), GUI_DIM(height - bt - bb), guii_widget_getcolor(h, GUI_GRAPH_COLOR_GRID));
+            }
+        }
+    }
+    
+    /* Check if any data attached to this graph */
+    if (gui_linkedlist_hasentries(&g->root)) {  /* We have attached plots */
+        gui_display_t display;
+        register float x1, y1, x2, y2;      /* Try to add these variables to core registers */
+        float xSize = g->visible_max_x - g->visible_min_x;  /* Calculate X size */
+        float ySize = g->visible_max_y - g->visible_min_y;  /* Calculate Y size */
+        float xStep = (float)(width - bl - br) / (float)xSize;  /* Calculate X step */
+        float yStep = (float)(height - bt - bb) / (float)ySize; /* calculate Y step */
+        gui_dim_t yBottom = y + height - bb - 1;    /* Bottom Y value */
+        gui_dim_t xLeft = x + bl;                   /* Left X position */
+        size_t read;
+        
+        memcpy(&display, disp, sizeof(gui_display_t));  /* Save GUI display data */
+        
+        /* Set clipping region */
+        if ((x + bl) > disp->x1) {
+            disp->x1 = x + bl;
+        }
+        if ((x + width - br) < disp->x2) {
+            disp->x2 = x + width - br;
+        }
+        if ((y + bt) > disp->y1) {
+            disp->y1 = y + bt;
+        }
+        if ((y + height - bb) < disp->y2) {
+            disp->y2 = y + height - bb;
+        }
+        
+        /* Draw all plot attached to graph */
+        for (link = gui_linkedlist_multi_getnext_gen(&g->root, NULL); link != NULL; 
+                link = gui_linkedlist_multi_getnext_gen(NULL, link)) {
+            data = (gui_graph_data_p)gui_linkedlist_multi_getdata(link);/* Get data from list */
+            
+            read = data->ptr;               /* Get start read pointer */
+            
+            if (data->type == GUI_GRAPH_TYPE_XY && data->dens
+                && graph_density(g, data, width - bl - br, height - bt - bb, xStep, yStep)) {
+                graph_density_draw(disp, data, xLeft, y + bt);  /* Draw point counts instead of lines */
+            } else if (data->type == GUI_GRAPH_TYPE_YT && xStep < 1.0f
+                && graph_decimate(g, data, width - bl - br, xStep)) {
+                /*
+                 * More samples than pixels, draw one vertical span per pixel column
+                 * from minimal to maximal value, connected to the neighbour column
+                 */
+                gui_dim_t c, c_to, yt, yb, prev_t = 0, prev_b = 0;
+                float f;
+                uint8_t prev = 0;
+                
+                c = GUI_MAX(0, disp->x1 - xLeft - 1);
+                c_to = GUI_MIN(data->col_count, disp->x2 - xLeft + 1);
+                for (; c < c_to; c++) {
+                    if (data->col_min[c] > data->col_max[c]) {  /* No sample in column */
+                        prev = 0;
+                        continue;
+                    }
+                    f = yBottom - ((float)data->col_max[c] - g->visible_min_y) * yStep;
+                    yt = GUI_DIM(GUI_MAX(GUI_MIN(f, (float)disp->y2), (float)(disp->y1 - 1)));
+                    f = yBottom - ((float)data->col_min[c] - g->visible_min_y) * yStep;
+                    yb = GUI_DIM(GUI_MAX(GUI_MIN(f, (float)disp->y2), (float)(disp->y1 - 1)));
+                    if (prev) {
+                        gui_dim_t t = yt, b = yb;
+                        if (prev_t > yb) {  /* Previous column is below */
+                            b = prev_t;
+                        } else if (prev_b < yt) {   /* Previous column is above */
+                            t = prev_b;
+                        }
+                        gui_draw_vline(disp, xLeft + c, t, b - t + 1, data->color);
+                    } else {
+                        gui_draw_vline(disp, xLeft + c, yt, yb - yt + 1, data->color);
+                    }
+                    prev_t = yt;
+                    prev_b = yb;
+                    prev = 1;
+                }
+            } else if (data->length) {
+                float px[GRAPH_CHUNK], py[GRAPH_CHUNK];
+                size_t p, k, n;
+                uint8_t yt = data->type == GUI_GRAPH_TYPE_YT;
+                
+                size_t p0 = 0;
+                
+                x1 = xLeft - g->visible_min_x * xStep;  /* Start X of YT plot */
+                y1 = 0;
+                if (yt && (x1 > disp->x2 || (x1 + (data->length * xStep)) < disp->x1)) {
+                    continue;                       /* Plot is completely on the right or on the left of active area */
+                }
+                if (yt && x1 < disp->x1 - xStep) {  /* Skip values left of active area, for example when zoomed in */
+                    float f = (float)(disp->x1 - xLeft) / xStep + g->visible_min_x - 1.0f;
+                    
+                    p0 = f <= 0.0f ? 0 : (f >= (float)data->length ? data->length - 1 : (size_t)f);
+                    x1 = xLeft + ((float)p0 - g->visible_min_x) * xStep;
+                    read = (read + p0) % data->length;
+                }
+                
+                /*
+                 * Transform contiguous chunks of values to screen coordinates first,
+                 * ring buffer is split to chunk before and after wrap position
+                 */
+                for (p = p0; p < data->length && (!yt || x1 <= disp->x2); p += n) {
+                    n = GUI_MIN(GUI_MIN((size_t)GRAPH_CHUNK, data->length - p), data->length - read);
+                    graph_transform(data->y, data->sample, read, n, yBottom, g->visible_min_y, -yStep, py);
+                    if (!yt) {
+                        graph_transform(data->x, data->sample, read, n, xLeft, g->visible_min_x, xStep, px);
+                    }
+                    for (k = 0; k < n; k++) {
+                        if (p == p0 && !k) {        /* First point */
+                            if (!yt) {
+                                x1 = px[0];
+                            }
+                            y1 = py[0];
+                            continue;
+                        }
+                        if (yt) {
+                            if (x1 > disp->x2) {
+                                break;
+                            }
+                            x2 = x1 + xStep;        /* Calculate next X */
+                        } else {
+                            x2 = px[k];
+                        }
+                        y2 = py[k];
+                        if (!yt || ((x1 >= disp->x1 || x2 >= disp->x1) && (x1 < disp->x2 || x2 < disp->x2))) {
+                            gui_draw_line(disp, GUI_DIM(x1), GUI_DIM(y1), GUI_DIM(x2), GUI_DIM(y2), data->color);   /* Draw actual line */
+                        }
+                        x1 = x2, y1 = y2;           /* Copy values as old */
+                    }
+                    read += n;
+                    if (read == data->length) {     /* Check overflow */
+                        read = 0;
+                    }
+                }
+            }
+        }
+        memcpy(disp, &display, sizeof(gui_display_t));  /* Copy data back */
+    }
+}
+
+/**
+ * \brief           Draw complete graph inside clipping region
+ * \param[in]       h: Widget handle
+ * \param[in,out]   disp: Clipping region, restored before function returns
+ */
+static void
+graph_draw(gui_handle_p h, gui_display_t* disp) {
+    gui_graph_t* g = (gui_graph_t *)h;
+    gui_dim_t bt, br, bb, bl, x, y, width, height;
+    
+    if (g->axes != NULL) {
+        graph_axes_update(h);                       /* Labels may change borders */
+    }
+    bt = g->border[GUI_GRAPH_BORDER_TOP];
+    br = g->border[GUI_GRAPH_BORDER_RIGHT];
+    bb = g->border[GUI_GRAPH_BORDER_BOTTOM];
+    bl = g->border[GUI_GRAPH_BORDER_LEFT];
+    
+    x = gui_widget_getabsolutex(h);
+    y = gui_widget_getabsolutey(h);
+    width = gui_widget_getwidth(h);
+    height = gui_widget_getheight(h);
+    
+    gui_draw_filledrectangle(disp, x, y, bl, height, guii_widget_getcolor(h, GUI_GRAPH_COLOR_BG));
+    gui_draw_filledrectangle(disp, x + bl, y, width - bl - br, bt, guii_widget_getcolor(h, GUI_GRAPH_COLOR_BG));
+    gui_draw_filledrectangle(disp, x + bl, y + height - bb, width - bl - br, bb, guii_widget_getcolor(h, GUI_GRAPH_COLOR_BG));
+    gui_draw_filledrectangle(disp, x + width - br, y, br, height, guii_widget_getcolor(h, GUI_GRAPH_COLOR_BG));
+    gui_draw_rectangle(disp, x, y, width, height, guii_widget_getcolor(h, GUI_GRAPH_COLOR_BORDER));
+    if (g->axes != NULL) {
+        graph_axes_draw(h, disp, x, y);
+    }
+    graph_draw_plot(h, disp);
+}
+
+#if GUI_CFG_USE_WIDGET_CACHE || __DOXYGEN__
+
+/**
+ * \brief           Get single data object of strip chart
+ * \param[in]       g: Graph widget
+ * \return          Data handle when exactly one YT data object is attached, `NULL` otherwise
+ */
+static gui_graph_data_p
+graph_strip_data(gui_graph_t* g) {
+    gui_linkedlistmulti_t* link;
+    gui_graph_data_p data;
+    
+    link = gui_linkedlist_multi_getnext_gen(&g->root, NULL);
+    if (link == NULL || gui_linkedlist_multi_getnext_gen(NULL, link) != NULL) {
+        return NULL;
+    }
+    data = (gui_graph_data_p)gui_linkedlist_multi_getdata(link);
+    return data->type == GUI_GRAPH_TYPE_YT ? data : NULL;
+}
+
+/**
+ * \brief           Check if clipping region covers complete widget and widget is drawn to its cache layer
+ * \param[in]       h: Widget handle
+ * \param[in]       disp: Clipping region
+ * \return          `1` if cache layer holds or will hold complete graph, `0` otherwise
+ */
+static uint8_t
+graph_strip_iscached(gui_handle_p h, const gui_display_t* disp) {
+    gui_dim_t x = gui_widget_getabsolutex(h);
+    gui_dim_t y = gui_widget_getabsolutey(h);
+    
+    return GUI.lcd.drawing_layer == h->cache_layer
+        && disp->x1 <= x && disp->y1 <= y
+        && disp->x2 >= (x + gui_widget_getwidth(h)) && disp->y2 >= (y + gui_widget_getheight(h));
+}
+
+/**
+ * \brief           Save state after complete graph redraw to allow incremental scrolling later
+ * \param[in]       h: Widget handle
+ * \param[in]       disp: Clipping region used for drawing
+ */
+static void
+graph_strip_save(gui_handle_p h, const gui_display_t* disp) {
+    gui_graph_t* g = (gui_graph_t *)h;
+    gui_graph_data_p data = graph_strip_data(g);
+    
+    g->strip_valid = g->strip && data != NULL && graph_strip_iscached(h, disp);
+    if (g->strip_valid) {
+        g->strip_version = data->version;
+        g->strip_buff_version = data->buff_version;
+        g->strip_frac = 0;
+        g->strip_width = gui_widget_getwidth(h);
+        g->strip_height = gui_widget_getheight(h);
+        g->strip_min_x = g->visible_min_x;
+        g->strip_max_x = g->visible_max_x;
+        g->strip_min_y = g->visible_min_y;
+        g->strip_max_y = g->visible_max_y;
+    }
+}
+
+/**
+ * \brief           Redraw vertical slice of plot area
  * \param[in]       h: Widget handle
- * \param[in]       zoom: Zoom multiplier. number > 1 is zoom, less is unzoom
- * \param[in]       xpos, ypos: X and Y position for zoom coordinate on screen
+ * \param[in]       disp: Clipping region
+ * \param[in]       x1: Slice start X position
+ * \param[in]       x2: Slice end X position, exclusive
  */
 static void
-graph_zoom(gui_handle_p h, float zoom, float xpos, float ypos) {
-    gui_graph_t* g = (gui_graph_t *)h;
-
-    if (xpos < 0.0f || xpos > 1.0f) { xpos = 0.5f; }
-    if (ypos < 0.0f || ypos > 1.0f) { ypos = 0.5f; }
-           
-    g->visible_min_x += (g->visible_max_x - g->visible_min_x) * (zoom - 1.0f) * xpos;
-    g->visible_max_x -= (g->visible_max_x - g->visible_min_x) * (zoom - 1.0f) * (1.0f - xpos);
+graph_strip_drawslice(gui_handle_p h, const gui_display_t* disp, gui_dim_t x1, gui_dim_t x2) {
+    gui_display_t d;
+    
+    memcpy(&d, disp, sizeof(d));
+    d.x1 = GUI_MAX(d.x1, x1);
+    d.x2 = GUI_MIN(d.x2, x2);
+    if (d.x1 < d.x2) {
+        graph_draw_plot(h, &d);
+    }
+}
 
-    g->visible_min_y += (g->visible_max_y - g->visible_min_y) * (zoom - 1.0f) * ypos;
-    g->visible_max_y -= (g->visible_max_y - g->visible_min_y) * (zoom - 1.0f) * (1.0f - ypos);
+/**
+ * \brief           Scroll strip chart by number of new samples and draw only new columns
+ *
+ *                  Plot area in cache layer is shifted left in place,
+ *                  new columns on the right and vertical grid lines are redrawn.
+ *                  All samples added since last frame are processed with single shift.
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       disp: Clipping region
+ * \return          `1` if graph was updated incrementally, `0` if complete redraw is required
+ */
+static uint8_t
+graph_strip_scroll(gui_handle_p h, gui_display_t* disp) {
+    gui_graph_t* g = (gui_graph_t *)h;
+    gui_graph_data_p data;
+    gui_layer_t* layer = GUI.lcd.drawing_layer;
+    gui_dim_t x, y, bt, bb, bl, br, pw, ph, shift, gx;
+    float pixels, step;
+    uint8_t i;
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+    const gui_layer_access_t* acc;
+    uint8_t* p;
+    size_t ps, len;
+    gui_dim_t r;
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+    
+    data = graph_strip_data(g);
+    if (!g->strip || !g->strip_valid || data == NULL || !graph_strip_iscached(h, disp)
+        || g->strip_width != gui_widget_getwidth(h) || g->strip_height != gui_widget_getheight(h)
+        || g->strip_min_x != g->visible_min_x || g->strip_max_x != g->visible_max_x
+        || g->strip_min_y != g->visible_min_y || g->strip_max_y != g->visible_max_y
+        || data->buff_version != g->strip_buff_version || data->version == g->strip_version) {
+        return 0;
+    }
+    
+    x = gui_widget_getabsolutex(h);
+    y = gui_widget_getabsolutey(h);
+    bt = g->border[GUI_GRAPH_BORDER_TOP];
+    br = g->border[GUI_GRAPH_BORDER_RIGHT];
+    bb = g->border[GUI_GRAPH_BORDER_BOTTOM];
+    bl = g->border[GUI_GRAPH_BORDER_LEFT];
+    pw = g->strip_width - bl - br;
+    ph = g->strip_height - bt - bb;
+    
+    /* Number of pixels to scroll for all samples added since last frame */
+    pixels = g->strip_frac + (float)(data->version - g->strip_version) * (float)pw / (g->visible_max_x - g->visible_min_x);
+    if (pw <= 0 || ph <= 0 || pixels >= (float)pw) {
+        return 0;                                   /* Complete plot changed */
+    }
+    shift = GUI_DIM(pixels);
+    if (!shift) {
+        return 1;                                   /* Less than a pixel, keep accumulating samples */
+    }
+    g->strip_frac = pixels - (float)shift;
+    g->strip_version = data->version;
+    
+    /* Shift plot area left, source and destination overlap within each line */
+#if GUI_CFG_USE_LL_DIRECT_ACCESS
+    if ((acc = guii_lcd_getaccess(layer, 1)) != NULL) {
+        ps = acc->format == GUI_PIXEL_FORMAT_RGB565 ? 2 : 4;
+        len = (size_t)(pw - shift) * ps;
+        for (r = 0; r < ph; r++) {
+            p = guii_access_addr(acc, layer, x + bl, y + bt + r);
+            memmove(p, p + (size_t)shift * ps, len);
+        }
+    } else
+#endif /* GUI_CFG_USE_LL_DIRECT_ACCESS */
+    {
+        GUI_LL(Copy)(&GUI.lcd, layer,
+            (void *)(((uint8_t *)layer->start_address) + GUI.lcd.pixel_size * ((y + bt - layer->y_pos) * layer->width + (x + bl - layer->x_pos))),
+            (void *)(((uint8_t *)layer->start_address) + GUI.lcd.pixel_size * ((y + bt - layer->y_pos) * layer->width + (x + bl + shift - layer->x_pos))),
+            pw - shift, ph, layer->width - (pw - shift), layer->width - (pw - shift));
+    }
+    
+    /* Vertical grid lines stay on place, restore old positions and draw them at new */
+    if (g->axes != NULL) {
+        for (i = 0; i < g->axes->x_count; i++) {
+            gx = x + bl + g->axes->x[i].pos;
+            graph_strip_drawslice(h, disp, gx - shift, gx - shift + 1);
+            graph_strip_drawslice(h, disp, gx, gx + 1);
+        }
+    } else if (g->columns) {
+        step = (float)pw / (float)g->columns;
+        for (i = 1; i < g->columns; i++) {
+            gx = GUI_DIM(x + bl + i * step);
+            graph_strip_drawslice(h, disp, gx - shift, gx - shift + 1);
+            graph_strip_drawslice(h, disp, gx, gx + 1);
+        }
+    }
+    
+    /* New columns on the right side */
+    graph_strip_drawslice(h, disp, x + bl + pw - shift, x + bl + pw);
+    return 1;
 }
 
+#endif /* GUI_CFG_USE_WIDGET_CACHE || __DOXYGEN__ */
+
 /**
  * \brief           Default widget callback function
  * \param[in]       h: Widget handle
@@ -172,141 +1354,34 @@ gui_graph_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
         }
         case GUI_EVT_SETPARAM: {                     /* Set parameter from widget */
             gui_widget_param* p = GUI_EVT_PARAMTYPE_WIDGETPARAM(param);
+            float* val = NULL;
             switch (p->type) {
-                case CFG_MIN_X: g->min_x = *(float *)p->data; break;/* Set min X value to widget */
-                case CFG_MAX_X: g->max_x = *(float *)p->data; break;/* Set max X value to widget */
-                case CFG_MIN_Y: g->min_y = *(float *)p->data; break;/* Set min Y value to widget */
-                case CFG_MAX_Y: g->max_y = *(float *)p->data; break;/* Set max Y value to widget */
+                case CFG_MIN_X: val = &g->min_x; break; /* Set min X value to widget */
+                case CFG_MAX_X: val = &g->max_x; break; /* Set max X value to widget */
+                case CFG_MIN_Y: val = &g->min_y; break; /* Set min Y value to widget */
+                case CFG_MAX_Y: val = &g->max_y; break; /* Set max Y value to widget */
                 case CFG_ZOOM_RESET: graph_reset(h); break; /* Reset zoom */
                 default: break;
             }
             GUI_EVT_RESULTTYPE_U8(result) = 1;   /* Save result */
+            if (val != NULL) {
+                GUI_EVT_RESULTTYPE_U8(result) = *val != *(float *)p->data;  /* Skip invalidation when unchanged */
+                *val = *(float *)p->data;
+            }
             return 1;
         }
         case GUI_EVT_DRAW: {                         /* Draw widget */
-            gui_graph_data_p data;
-            gui_linkedlistmulti_t* link;
-            gui_dim_t bt, br, bb, bl, x, y, width, height;
-            uint8_t i;
             gui_display_t* disp = GUI_EVT_PARAMTYPE_DISP(param);   /* Get display pointer */
             
-            bt = g->border[GUI_GRAPH_BORDER_TOP];
-            br = g->border[GUI_GRAPH_BORDER_RIGHT];
-            bb = g->border[GUI_GRAPH_BORDER_BOTTOM];
-            bl = g->border[GUI_GRAPH_BORDER_LEFT];
-            
-            x = gui_widget_getabsolutex(h);
-            y = gui_widget_getabsolutey(h);
-            width = gui_widget_getwidth(h);
-            height = gui_widget_getheight(h);
-            
-            gui_draw_filledrectangle(disp, x, y, bl, height, guii_widget_getcolor(h, GUI_GRAPH_COLOR_BG));
-            gui_draw_filledrectangle(disp, x + bl, y, width - bl - br, bt, guii_widget_getcolor(h, GUI_GRAPH_COLOR_BG));
-            gui_draw_filledrectangle(disp, x + bl, y + height - bb, width - bl - br, bb, guii_widget_getcolor(h, GUI_GRAPH_COLOR_BG));
-            gui_draw_filledrectangle(disp, x + width - br, y, br, height, guii_widget_getcolor(h, GUI_GRAPH_COLOR_BG));
-            gui_draw_filledrectangle(disp, x + bl, y + bt, width - bl - br, height - bt - bb, guii_widget_getcolor(h, GUI_GRAPH_COLOR_FG));
-            gui_draw_rectangle(disp, x, y, width, height, guii_widget_getcolor(h, GUI_GRAPH_COLOR_BORDER));
-            
-            /* Draw horizontal lines */
-            if (g->rows) {
-                float step;
-                step = (float)(height - bt - bb) / (float)g->rows;
-                for (i = 1; i < g->rows; i++) {
-                    gui_draw_hline(disp, GUI_DIM(x + bl), GUI_DIM(y + bt + i * step), GUI_DIM(width - bl - br), guii_widget_getcolor(h, GUI_GRAPH_COLOR_GRID));
-                }
-            }
-            /* Draw vertical lines */
-            if (g->columns) {
-                float step;
-                step = (float)(width - bl - br) / (float)g->columns;
-                for (i = 1; i < g->columns; i++) {
-                    gui_draw_vline(disp, GUI_DIM(x + bl + i * step), GUI_DIM(y + bt), GUI_DIM(height - bt - bb), guii_widget_getcolor(h, GUI_GRAPH_COLOR_GRID));
-                }
-            }
-            
-            /* Check if any data attached to this graph */
-            if (gui_linkedlist_hasentries(&g->root)) {  /* We have attached plots */
-                gui_display_t display;
-                register float x1, y1, x2, y2;      /* Try to add these variables to core registers */
-                float xSize = g->visible_max_x - g->visible_min_x;  /* Calculate X size */
-                float ySize = g->visible_max_y - g->visible_min_y;  /* Calculate Y size */
-                float xStep = (float)(width - bl - br) / (float)xSize;  /* Calculate X step */
-                float yStep = (float)(height - bt - bb) / (float)ySize; /* calculate Y step */
-                gui_dim_t yBottom = y + height - bb - 1;    /* Bottom Y value */
-                gui_dim_t xLeft = x + bl;                   /* Left X position */
-                size_t read, write;
-                
-                memcpy(&display, disp, sizeof(gui_display_t));  /* Save GUI display data */
-                
-                /* Set clipping region */
-                if ((x + bl) > disp->x1) {
-                    disp->x1 = x + bl;
-                }
-                if ((x + width - br) < disp->x2) {
-                    disp->x2 = x + width - br;
-                }
-                if ((y + bt) > disp->y1) {
-                    disp->y1 = y + bt;
-                }
-                if ((y + height - bb) < disp->y2) {
-                    disp->y2 = y + height - bb;
-                }
-                
-                /* Draw all plot attached to graph */
-                for (link = gui_linkedlist_multi_getnext_gen(&g->root, NULL); link != NULL; 
-                        link = gui_linkedlist_multi_getnext_gen(NULL, link)) {
-                    data = (gui_graph_data_p)gui_linkedlist_multi_getdata(link);/* Get data from list */
-                    
-                    read = data->ptr;               /* Get start read pointer */
-                    write = data->ptr;              /* Get start write pointer */
-                    
-                    if (data->type == GUI_GRAPH_TYPE_YT) {  /* Draw YT plot */
-                        /* Calculate first point */
-                        x1 = xLeft - g->visible_min_x * xStep;  /* Calculate start X */
-                        y1 = yBottom - (data->data[read] - g->visible_min_y) * yStep;   /* Calculate start Y */
-                        if (++read == data->length) {   /* Check overflow */
-                            read = 0;
-                        }
-                        
-                        /* Outside of right || outside on left */
-                        if (x1 > disp->x2 || (x1 + (data->length * xStep)) < disp->x1) {/* Plot start is on the right of active area */
-                            continue;
-                        }
-                        
-                        while (read != write && x1 <= disp->x2) {   /* Calculate next points */
-                            x2 = x1 + xStep;                /* Calculate next X */
-                            y2 = yBottom - ((float)data->data[read] - g->visible_min_y) * yStep;/* Calculate next Y */
-                            if ((x1 >= disp->x1 || x2 >= disp->x1) && (x1 < disp->x2 || x2 < disp->x2)) {
-                                gui_draw_line(disp, GUI_DIM(x1), GUI_DIM(y1), GUI_DIM(x2), GUI_DIM(y2), data->color);   /* Draw actual line */
-                            }
-                            x1 = x2, y1 = y2;       /* Copy values as old */
-                            
-                            if (++read == data->length) {   /* Check overflow */
-                                read = 0;
-                            }
-                        }
-                    } else if (data->type == GUI_GRAPH_TYPE_XY) {   /* Draw XY plot */                        
-                        /* Calculate first point */
-                        x1 = xLeft + ((float)data->data[2 * read + 0] - g->visible_min_x) * xStep;
-                        y1 = yBottom - ((float)data->data[2 * read + 1] - g->visible_min_y) * yStep;
-                        if (++read == data->length) {   /* Check overflow */
-                            read = 0;
-                        }
-                        
-                        while (read != write) {     /* Calculate next points */
-                            x2 = xLeft + ((float)(data->data[2 * read + 0] - g->visible_min_x) * xStep);
-                            y2 = yBottom - ((float)(data->data[2 * read + 1] - g->visible_min_y) * yStep);
-                            gui_draw_line(disp, GUI_DIM(x1), GUI_DIM(y1), GUI_DIM(x2), GUI_DIM(y2), data->color);   /* Draw actual line */
-                            x1 = x2, y1 = y2;       /* Check overflow */
-                            
-                            if (++read == data->length) {   /* Check overflow */
-                                read = 0;
-                            }
-                        }
-                    }
-                }
-                memcpy(disp, &display, sizeof(gui_display_t));  /* Copy data back */
+#if GUI_CFG_USE_WIDGET_CACHE
+            if (graph_strip_scroll(h, disp)) {      /* Only new samples have to be drawn */
+                return 1;
             }
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+            graph_draw(h, disp);
+#if GUI_CFG_USE_WIDGET_CACHE
+            graph_strip_save(h, disp);
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
             return 1;
         }
 #if GUI_CFG_USE_TOUCH
@@ -328,7 +1403,7 @@ gui_graph_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
                 diff = (float)(ts->y_diff[0]) / step;
                 g->visible_min_y += diff;
                 g->visible_max_y += diff;
-#if GUI_CFG_TOUCH_MAX_PRESSES > 1
+#if GUI_CFG_TOUCH_MAX_PRESSES > 1 && !GUI_CFG_USE_GESTURE
             } else if (ts->ts.count == 2) {         /* Scale widget on multiple touches */
                 float centerX, centerY, zoom;
                 
@@ -336,7 +1411,7 @@ gui_graph_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
                 zoom = ts->distance / ts->distance_old; /* Calculate zoom value */
                 
                 graph_zoom(h, zoom, (float)centerX / (float)gui_widget_getwidth(h), (float)centerY / (float)gui_widget_getheight(h));
-#endif /* GUI_CFG_TOUCH_MAX_PRESSES > 1 */
+#endif /* GUI_CFG_TOUCH_MAX_PRESSES > 1 && !GUI_CFG_USE_GESTURE */
             }
             gui_widget_invalidate(h);               /* Invalidate widget */
             
@@ -345,14 +1420,30 @@ gui_graph_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
         }
         case GUI_EVT_TOUCHEND:
             return 1;
+#if GUI_CFG_USE_GESTURE
+        case GUI_EVT_GESTURE: {
+            const gui_gesture_t* gs = GUI_EVT_PARAMTYPE_GESTURE(param);
+            
+            if (gs->type == GUI_GESTURE_PINCH) {    /* Scale widget on multiple touches */
+                graph_zoom(h, (float)gs->scale / 256.0f, (float)gs->x / (float)gui_widget_getwidth(h), (float)gs->y / (float)gui_widget_getheight(h));
+                gui_widget_invalidate(h);
+                return 1;
+            }
+            return 0;
+        }
+#endif /* GUI_CFG_USE_GESTURE */
 #endif /* GUI_CFG_USE_TOUCH */
         case GUI_EVT_DBLCLICK:
             graph_reset(h);                         /* Reset zoom */
             gui_widget_invalidate(h);               /* Invalidate widget */
             return 1;
         
-#if GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE
+        case GUI_EVT_CLONE: {                       /* Widget copied from prototype */
+            GUI_EVT_RESULTTYPE_U8(result) = 0;      /* Plots belong to prototype, widget cannot be copied */
+            return 1;
+        }
         case GUI_EVT_REMOVE: {                       /* When widget is about to be removed */
+#if GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE
             gui_graph_data_p data;
             gui_linkedlistmulti_t* link;
             
@@ -362,10 +1453,12 @@ gui_graph_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
                 data = (gui_graph_data_p)gui_linkedlist_multi_getdata(link);    /* Get data from list */
                 gui_linkedlist_multi_find_remove(&data->root, h);   /* Remove element from linked list with search */
             }
-            
+#endif /* GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE */
+            if (g->axes != NULL) {
+                graph_axes_free(g);
+            }
             return 1;
         }
-#endif /* GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE */
         default:                                    /* Handle default option */
             GUI_UNUSED3(h, param, result);          /* Unused elements to prevent compiler warnings */
             return 0;                               /* Command was not processed */
@@ -481,10 +1574,10 @@ uint8_t
 gui_graph_setaxes(gui_handle_p h, float min_x, float max_x, float min_y, float max_y) {
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
 
-    guii_widget_setparam(h, CFG_MIN_X, &min_x, 0, 0);
-    guii_widget_setparam(h, CFG_MAX_X, &max_x, 0, 0);
-    guii_widget_setparam(h, CFG_MIN_Y, &min_y, 0, 0);
-    guii_widget_setparam(h, CFG_MAX_Y, &max_y, 1, 0);   /* Set param and invalidate */
+    guii_widget_setparam(h, CFG_MIN_X, &min_x, 1, 0);  /* Each changed axis invalidates widget */
+    guii_widget_setparam(h, CFG_MAX_X, &max_x, 1, 0);
+    guii_widget_setparam(h, CFG_MIN_Y, &min_y, 1, 0);
+    guii_widget_setparam(h, CFG_MAX_Y, &max_y, 1, 0);
 
     return 1;
 }
@@ -517,6 +1610,72 @@ gui_graph_zoom(gui_handle_p h, float zoom, float x, float y) {
     return 1;
 }
 
+/**
+ * \brief           Enable or disable axis ticks and labels
+ *
+ *                  Ticks are placed on round values with step of `1`, `2` or `5` times power of `10`,
+ *                  depending on visible area, plot size and widget font.
+ *                  Grid lines are drawn on ticks instead of fixed number of rows and columns.
+ *                  Left and bottom borders are enlarged to hold labels.
+ *                  Label texts and their layout are computed again only when visible area, widget size or font changes.
+ *
+ * \note            Labels are not drawn when widget has no font
+ * \param[in]       h: Widget handle
+ * \param[in]       enable: Set to `1` to enable labels or `0` to disable them
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_graph_setaxislabels(gui_handle_p h, uint8_t enable) {
+    gui_graph_t* g = (gui_graph_t *)h;
+    uint8_t ret = 1;
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    GUI_CORE_PROTECT(1);
+    if (enable && g->axes == NULL) {
+        g->axes = GUI_MEMALLOC(sizeof(*g->axes));
+        ret = g->axes != NULL;
+    } else if (!enable && g->axes != NULL) {
+        graph_axes_free(g);
+        g->border[GUI_GRAPH_BORDER_BOTTOM] = 5;     /* Default borders */
+        g->border[GUI_GRAPH_BORDER_LEFT] = 5;
+    }
+#if GUI_CFG_USE_WIDGET_CACHE
+    g->strip_valid = 0;                             /* Plot area moves */
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+    GUI_CORE_UNPROTECT(1);
+    gui_widget_invalidate(h);
+    return ret;
+}
+
+/**
+ * \brief           Enable or disable strip chart mode
+ *
+ *                  In strip chart mode graph is drawn through widget cache layer.
+ *                  When new values are added to single attached \ref GUI_GRAPH_TYPE_YT data object,
+ *                  plot is scrolled left and only new columns are drawn instead of complete graph.
+ *
+ * \note            Function has no effect if \ref GUI_CFG_USE_WIDGET_CACHE is disabled
+ * \param[in]       h: Widget handle
+ * \param[in]       enable: Set to `1` to enable strip chart mode or `0` to disable it
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_graph_setstripchart(gui_handle_p h, uint8_t enable) {
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+#if GUI_CFG_USE_WIDGET_CACHE
+    GUI_CORE_PROTECT(1);
+    ((gui_graph_t *)h)->strip = enable;
+    ((gui_graph_t *)h)->strip_valid = 0;
+    GUI_CORE_UNPROTECT(1);
+    gui_widget_setcache(h, enable);                 /* Content is retained in cache layer */
+    gui_widget_invalidate(h);
+    return 1;
+#else /* GUI_CFG_USE_WIDGET_CACHE */
+    GUI_UNUSED(enable);
+    return 0;
+#endif /* !GUI_CFG_USE_WIDGET_CACHE */
+}
+
 /**
  * \brief           Attach new data object to graph widget
  * \param[in,out]   h: Graph widget handle
@@ -582,22 +1741,59 @@ gui_graph_detachdata(gui_handle_p h, gui_graph_data_p data) {
  * \param[in]       type: Type of data. According to selected type different allocation size will occur
  * \param[in]       length: Number of points on plot.
  * \return          Graph data handle on success, `NULL` otherwise
+ * \sa              gui_graph_data_create_ex
  */
 gui_graph_data_p
 gui_graph_data_create(gui_id_t id, gui_graph_type_t type, size_t length) {
+    return gui_graph_data_create_ex(id, type, GUI_GRAPH_SAMPLE_INT16, length, NULL);
+}
+
+/**
+ * \brief           Creates data object with specific sample type
+ *
+ *                  X and Y values are stored in separate arrays of `length` values each.
+ *                  Several \ref GUI_GRAPH_TYPE_XY data objects may use X values of single object,
+ *                  for example when all curves are sampled at the same X positions.
+ *                  Data object with shared X values never writes them, only Y values are added to it.
+ *                  Values on the same ring position belong together, shared objects shall be written with the same number of values.
+ *
+ * \param[in]       id: Graph data ID
+ * \param[in]       type: Type of data. X values are allocated only for \ref GUI_GRAPH_TYPE_XY
+ * \param[in]       sample: Type of each X and Y value
+ * \param[in]       length: Number of points on plot
+ * \param[in]       x_src: \ref GUI_GRAPH_TYPE_XY data object with the same sample type and at least `length` points
+ *                      to use X values from. Set to `NULL` to allocate own X values
+ * \return          Graph data handle on success, `NULL` otherwise
+ */
+gui_graph_data_p
+gui_graph_data_create_ex(gui_id_t id, gui_graph_type_t type, gui_graph_sample_t sample, size_t length, gui_graph_data_p x_src) {
     gui_graph_data_t* data;
+    size_t size;
+    
+    GUI_ASSERTPARAMS(sample < GUI_COUNT_OF(sample_sizes) && (x_src == NULL
+        || (type == GUI_GRAPH_TYPE_XY && x_src->type == GUI_GRAPH_TYPE_XY && x_src->sample == sample && x_src->length >= length)));
 
     data = GUI_MEMALLOC(sizeof(*data));             /* Allocate memory for basic widget */
     if (data != NULL) {
         data->id = id;
         data->type = type;
+        data->sample = sample;
         data->length = length;
-        if (type == GUI_GRAPH_TYPE_YT) {            /* Only Y values are stored */
-            data->data = GUI_MEMALLOC(sizeof(*data->data) * length);    /* Store Y values for plot */
+        
+        size = sample_sizes[sample] * length;
+        if (type == GUI_GRAPH_TYPE_XY && x_src == NULL) {
+            data->y = GUI_MEMALLOC(2 * size);       /* Store Y values followed by X values */
+            if (data->y != NULL) {
+                data->x = (uint8_t *)data->y + size;
+            }
         } else {
-            data->data = GUI_MEMALLOC(sizeof(*data->data) * length * 2);/* Store X and Y values for plot */
+            data->y = GUI_MEMALLOC(size);           /* Store Y values for plot */
+            if (type == GUI_GRAPH_TYPE_XY) {
+                data->x = x_src->x;                 /* Use values of other object */
+                data->x_shared = 1;
+            }
         }
-        if (data->data == NULL) {
+        if (data->y == NULL) {
             GUI_MEMFREE(data);                      /* Remove widget because data memory could not be allocated */
             data = NULL;
         }
@@ -606,6 +1802,111 @@ gui_graph_data_create(gui_id_t id, gui_graph_type_t type, size_t length) {
     return (gui_graph_data_p)data;
 }
 
+/**
+ * \brief           Convert values to type of data object
+ * \param[out]      dst: Destination array of `sample` type
+ * \param[in]       sample: Destination value type
+ * \param[in]       src: Source array of `src_sample` type
+ * \param[in]       src_sample: Source value type. Only \ref GUI_GRAPH_SAMPLE_INT16,
+ *                      \ref GUI_GRAPH_SAMPLE_FLOAT or `sample` are supported
+ * \param[in]       count: Number of values to convert
+ * \param[in]       scale: Multiplier applied to \ref GUI_GRAPH_SAMPLE_FLOAT source values
+ * \param[in]       offset: Offset added to \ref GUI_GRAPH_SAMPLE_FLOAT source values after scaling
+ */
+static void
+graph_data_convert(void* dst, gui_graph_sample_t sample, const void* src, gui_graph_sample_t src_sample, size_t count, float scale, float offset) {
+    size_t i;
+    float v;
+    
+    if (src_sample == sample && (sample != GUI_GRAPH_SAMPLE_FLOAT || (scale == 1.0f && offset == 0.0f))) {
+        memcpy(dst, src, sample_sizes[sample] * count);
+    } else if (src_sample == GUI_GRAPH_SAMPLE_FLOAT) {
+        for (i = 0; i < count; i++) {
+            v = ((const float *)src)[i] * scale + offset;
+            if (sample == GUI_GRAPH_SAMPLE_FLOAT) {
+                ((float *)dst)[i] = v;
+                continue;
+            }
+            v += v < 0 ? -0.5f : 0.5f;              /* Round to nearest */
+            if (sample == GUI_GRAPH_SAMPLE_INT32) { /* Saturate to range of integer type */
+                ((int32_t *)dst)[i] = v >= 2147483648.0f ? INT32_MAX : (v < -2147483648.0f ? INT32_MIN : (int32_t)v);
+            } else {
+                ((int16_t *)dst)[i] = (int16_t)(v > 32767.0f ? 32767 : (v < -32768.0f ? -32768 : v));
+            }
+        }
+    } else if (sample == GUI_GRAPH_SAMPLE_INT32) {  /* 16-bit source to wider type */
+        for (i = 0; i < count; i++) {
+            ((int32_t *)dst)[i] = ((const int16_t *)src)[i];
+        }
+    } else {
+        for (i = 0; i < count; i++) {
+            ((float *)dst)[i] = ((const int16_t *)src)[i];
+        }
+    }
+}
+
+/**
+ * \brief           Write values to the end of data object without invalidation
+ *
+ *                  When `count` is greater than data length, only last values are kept.
+ *                  Ring buffer is written in at most `2` contiguous chunks.
+ *
+ * \param[in]       data: Data object handle
+ * \param[in]       x: Array of X values, ignored unless data type is \ref GUI_GRAPH_TYPE_XY with own X values
+ * \param[in]       y: Array of Y values
+ * \param[in]       src_sample: Type of values in `x` and `y` arrays
+ * \param[in]       count: Number of values in arrays
+ * \param[in]       scale: Multiplier applied to \ref GUI_GRAPH_SAMPLE_FLOAT source values
+ * \param[in]       offset: Offset added to \ref GUI_GRAPH_SAMPLE_FLOAT source values after scaling
+ */
+static void
+graph_data_write(gui_graph_data_p data, const void* x, const void* y, gui_graph_sample_t src_sample, size_t count, float scale, float offset) {
+    const uint8_t* sx = x;
+    const uint8_t* sy = y;
+    size_t len, skip, ss, ds;
+    
+    ss = sample_sizes[src_sample];
+    ds = sample_sizes[data->sample];
+    if (data->type != GUI_GRAPH_TYPE_XY || data->x_shared) {
+        sx = NULL;                                  /* Only Y values are written */
+    }
+    data->version += count;                         /* Each value scrolls plot and invalidates decimated columns */
+    if (count > data->length) {                     /* Skip values which would be overwritten anyway */
+        skip = count - data->length;
+        sy += skip * ss;
+        if (sx != NULL) {
+            sx += skip * ss;
+        }
+        count = data->length;
+    }
+    if (data->dens_valid && data->x_shared) {
+        data->dens_valid = 0;                       /* Old X values are not known, count points again on next draw */
+    }
+    while (count) {
+        len = GUI_MIN(count, data->length - data->ptr);
+        if (data->dens_valid) {
+            graph_density_update(data, data->ptr, len, 0);  /* Remove points which are overwritten */
+        }
+        graph_data_convert((uint8_t *)data->y + ds * data->ptr, data->sample, sy, src_sample, len, scale, offset);
+        sy += ss * len;
+        if (sx != NULL) {
+            graph_data_convert((uint8_t *)data->x + ds * data->ptr, data->sample, sx, src_sample, len, scale, offset);
+            sx += ss * len;
+        }
+        if (data->dens_valid) {
+            graph_density_update(data, data->ptr, len, 1); /* Add new points */
+        }
+        if (data->lod_valid) {                      /* Summaries of changed blocks */
+            graph_lod_compute(data, data->ptr / GRAPH_LOD_BLOCK, (data->ptr + len - 1) / GRAPH_LOD_BLOCK);
+        }
+        count -= len;
+        data->ptr += len;
+        if (data->ptr >= data->length) {
+            data->ptr = 0;                          /* Reset read operation */
+        }
+    }
+}
+
 /**
  * \brief           Add new value to the end of data object
  * \param[in]       data: Data object handle
@@ -617,16 +1918,206 @@ uint8_t
 gui_graph_data_addvalue(gui_graph_data_p data, int16_t x, int16_t y) {
     GUI_ASSERTPARAMS(data);                
 
-    if (data->type == GUI_GRAPH_TYPE_YT) {          /* YT plot */
-        data->data[data->ptr] = y;                  /* Only Y value is relevant */
-    } else if (data->type == GUI_GRAPH_TYPE_XY) {   /* XY plot */
-        data->data[2 * data->ptr + 0] = x;          /* Set X value */
-        data->data[2 * data->ptr + 1] = y;          /* Set Y value */
+    graph_data_write(data, &x, &y, GUI_GRAPH_SAMPLE_INT16, 1, 1.0f, 0.0f);
+#if GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE
+    graph_invalidate(data);                         /* Invalidate graphs attached to this data object */
+#endif /* GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE */
+
+    return 1;
+}
+
+/**
+ * \brief           Add multiple values to the end of data object
+ *
+ *                  Values are copied in single call and attached graphs are invalidated only once.
+ *                  When `count` is greater than data length, only last values are kept.
+ *                  Values are converted when data object uses different sample type.
+ *
+ * \param[in]       data: Data object handle
+ * \param[in]       x: Array of X values. Used only in case data type is \ref GUI_GRAPH_TYPE_XY with own X values and may be `NULL` otherwise
+ * \param[in]       y: Array of Y values
+ * \param[in]       count: Number of values in arrays
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_graph_data_addvalues(gui_graph_data_p data, const int16_t* x, const int16_t* y, size_t count) {
+    GUI_ASSERTPARAMS(data != NULL && y != NULL && (x != NULL || data->type == GUI_GRAPH_TYPE_YT || data->x_shared));
+
+    GUI_CORE_PROTECT(1);
+    graph_data_write(data, x, y, GUI_GRAPH_SAMPLE_INT16, count, 1.0f, 0.0f);
+    GUI_CORE_UNPROTECT(1);
+#if GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE
+    graph_invalidate(data);                         /* Invalidate graphs attached to this data object */
+#endif /* GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE */
+
+    return 1;
+}
+
+/**
+ * \brief           Add multiple values of data object sample type to the end of data object
+ *
+ *                  Values are copied without conversion, attached graphs are invalidated only once.
+ *                  When `count` is greater than data length, only last values are kept.
+ *
+ * \param[in]       data: Data object handle
+ * \param[in]       x: Array of X values of data object sample type. Used only in case data type is
+ *                      \ref GUI_GRAPH_TYPE_XY with own X values and may be `NULL` otherwise
+ * \param[in]       y: Array of Y values of data object sample type
+ * \param[in]       count: Number of values in arrays
+ * \return          `1` on success, `0` otherwise
+ * \sa              gui_graph_data_create_ex
+ */
+uint8_t
+gui_graph_data_addsamples(gui_graph_data_p data, const void* x, const void* y, size_t count) {
+    GUI_ASSERTPARAMS(data != NULL && y != NULL && (x != NULL || data->type == GUI_GRAPH_TYPE_YT || data->x_shared));
+
+    GUI_CORE_PROTECT(1);
+    graph_data_write(data, x, y, data->sample, count, 1.0f, 0.0f);
+    GUI_CORE_UNPROTECT(1);
+#if GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE
+    graph_invalidate(data);                         /* Invalidate graphs attached to this data object */
+#endif /* GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE */
+
+    return 1;
+}
+
+/**
+ * \brief           Add multiple floating-point Y values to the end of data object
+ *
+ *                  Each value is converted as `y[i] * scale + offset`. For integer sample types
+ *                  it is rounded and saturated to range of the type. Attached graphs are invalidated only once.
+ *
+ * \note            Only \ref GUI_GRAPH_TYPE_YT data objects or data objects with shared X values are supported
+ * \param[in]       data: Data object handle
+ * \param[in]       y: Array of Y values
+ * \param[in]       count: Number of values in array
+ * \param[in]       scale: Multiplier applied to each value
+ * \param[in]       offset: Offset added to each value after scaling
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_graph_data_addvalues_f(gui_graph_data_p data, const float* y, size_t count, float scale, float offset) {
+    GUI_ASSERTPARAMS(data != NULL && y != NULL && (data->type == GUI_GRAPH_TYPE_YT || data->x_shared));
+
+    GUI_CORE_PROTECT(1);
+    graph_data_write(data, NULL, y, GUI_GRAPH_SAMPLE_FLOAT, count, scale, offset);
+    GUI_CORE_UNPROTECT(1);
+#if GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE
+    graph_invalidate(data);                         /* Invalidate graphs attached to this data object */
+#endif /* GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE */
+
+    return 1;
+}
+
+/**
+ * \brief           Replace Y values buffer of \ref GUI_GRAPH_SAMPLE_INT16 data object with user buffer without copying values
+ *
+ *                  Use it for double buffering: fill second buffer while graph
+ *                  draws from first one, then swap them and continue with returned buffer.
+ *                  Buffer must hold `length` values, oldest value first.
+ *                  For \ref GUI_GRAPH_TYPE_XY X values stay on place and must hold at least `length` values.
+ *                  Buffer must stay valid until it is swapped out again.
+ *
+ * \param[in]       data: Data object handle
+ * \param[in]       buff: New data buffer
+ * \param[in]       length: Number of points in new buffer
+ * \param[out]      old: Pointer to save previous buffer to. Set to `NULL` if not used
+ * \return          `1` on success, `0` otherwise
+ * \sa              gui_graph_data_swapbuffers
+ */
+uint8_t
+gui_graph_data_swapbuffer(gui_graph_data_p data, int16_t* buff, size_t length, int16_t** old) {
+    void* o;
+    
+    GUI_ASSERTPARAMS(data != NULL && data->sample == GUI_GRAPH_SAMPLE_INT16);
+
+    if (!gui_graph_data_swapbuffers(data, NULL, buff, length, NULL, &o)) {
+        return 0;
+    }
+    if (old != NULL) {
+        *old = o;
+    }
+    return 1;
+}
+
+/**
+ * \brief           Replace X and Y values buffers with user buffers without copying values
+ *
+ *                  Buffers hold `length` values of data object sample type, oldest value first
+ *                  and must stay valid until they are swapped out again.
+ *
+ * \param[in]       data: Data object handle
+ * \param[in]       x: New X values buffer for \ref GUI_GRAPH_TYPE_XY. Data object does not share X values anymore.
+ *                      Set to `NULL` to keep current X values, they must hold at least `length` values
+ * \param[in]       y: New Y values buffer
+ * \param[in]       length: Number of points in new buffers
+ * \param[out]      old_x: Pointer to save previous X buffer to. Set to `NULL` if not used
+ * \param[out]      old_y: Pointer to save previous Y buffer to. Set to `NULL` if not used
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_graph_data_swapbuffers(gui_graph_data_p data, void* x, void* y, size_t length, void** old_x, void** old_y) {
+    GUI_ASSERTPARAMS(data != NULL && y != NULL && length > 0 && (x == NULL || data->type == GUI_GRAPH_TYPE_XY));
+
+    GUI_CORE_PROTECT(1);
+    if (old_x != NULL) {
+        *old_x = data->x;
+    }
+    if (old_y != NULL) {
+        *old_y = data->y;
     }
-    data->ptr++;                                    /* Increase write and read pointers */
-    if (data->ptr >= data->length) {
-        data->ptr = 0;                              /* Reset read operation */
+    if (x != NULL) {
+        data->x = x;
+        data->x_shared = 0;
+    }
+    data->y = y;
+    data->length = length;
+    data->ptr = 0;                                  /* Oldest value is on start */
+    data->version++;                                /* Invalidate decimated columns */
+    data->buff_version++;                           /* Complete plot changed */
+    data->dens_valid = 0;                           /* Point counts do not belong to new buffer */
+    data->lod_valid = 0;                            /* Levels are computed again on next draw */
+    GUI_CORE_UNPROTECT(1);
+#if GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE
+    graph_invalidate(data);                         /* Invalidate graphs attached to this data object */
+#endif /* GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE */
+
+    return 1;
+}
+
+/**
+ * \brief           Enable or disable density mode for \ref GUI_GRAPH_TYPE_XY data object
+ *
+ *                  In density mode points are not connected with lines. Each plot pixel
+ *                  is drawn with color depending on number of points inside it,
+ *                  empty pixels keep plot background. Point counts are kept in memory
+ *                  of `2` bytes per plot pixel and updated when values are added,
+ *                  drawing time depends only on plot size and not on number of points.
+ *                  Counts are computed again when buffer is swapped, plot is zoomed or moved.
+ *
+ * \note            Data object with shared X values counts points again on each draw after its values change.
+ *                  Changes of shared X values alone are not detected.
+ * \param[in,out]   data: Graph data handle
+ * \param[in]       enable: Set to `1` to enable density mode or `0` to disable it
+ * \param[in]       lut: Table of `256` colors, index `255` is used for pixel with most points.
+ *                      Table must stay valid while used by data object. Set to `NULL` to use default table
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_graph_data_setdensity(gui_graph_data_p data, uint8_t enable, const gui_color_t* lut) {
+    GUI_ASSERTPARAMS(data != NULL && data->type == GUI_GRAPH_TYPE_XY);
+
+    GUI_CORE_PROTECT(1);
+    data->dens = enable;
+    data->dens_lut = lut;
+    if (!enable && data->dens_cnt != NULL) {        /* Counts are not needed anymore */
+        GUI_MEMFREE(data->dens_cnt);
+        data->dens_cnt = NULL;
+        data->dens_width = 0;
+        data->dens_height = 0;
     }
+    data->dens_valid = 0;
+    GUI_CORE_UNPROTECT(1);
 #if GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE
     graph_invalidate(data);                         /* Invalidate graphs attached to this data object */
 #endif /* GUI_CFG_WIDGET_GRAPH_DATA_AUTO_INVALIDATE */
@@ -634,6 +2125,38 @@ gui_graph_data_addvalue(gui_graph_data_p data, int16_t x, int16_t y) {
     return 1;
 }
 
+/**
+ * \brief           Enable or disable level-of-detail levels for \ref GUI_GRAPH_TYPE_YT data object
+ *
+ *                  Levels hold minimal and maximal value for blocks of values, each next level
+ *                  for twice as long blocks, similar to mipmaps of image. They are computed on first draw
+ *                  and updated for changed blocks only when values are added.
+ *                  When several values fall to single pixel column, column range is taken from largest
+ *                  blocks which fit to it. Time to draw zoomed or moved plot is then proportional
+ *                  to plot width and not to number of visible values.
+ *
+ * \note            Levels take `8` bytes per `16` values of data object
+ * \param[in,out]   data: Graph data handle
+ * \param[in]       enable: Set to `1` to enable levels or `0` to disable them
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_graph_data_setlod(gui_graph_data_p data, uint8_t enable) {
+    GUI_ASSERTPARAMS(data != NULL && data->type == GUI_GRAPH_TYPE_YT);
+
+    GUI_CORE_PROTECT(1);
+    data->lod = enable;
+    if (!enable && data->lod_levels != NULL) {      /* Levels are not needed anymore */
+        GUI_MEMFREE(data->lod_levels);
+        data->lod_levels = NULL;
+        data->lod_length = 0;
+    }
+    data->lod_valid = 0;
+    GUI_CORE_UNPROTECT(1);
+
+    return 1;
+}
+
 /**
  * \brief           Set color for graph data
  * \param[in,out]   data: Graph data handle
@@ -679,3 +2202,5 @@ gui_graph_data_get_by_id(gui_handle_p graph_h, gui_id_t id) {
     
     return link != NULL ? data : NULL;
 }
+
+#endif /* GUI_CFG_WIDGET_GRAPH || __DOXYGEN__ */
@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "widget/gui_image.h"
 
+#if GUI_CFG_WIDGET_IMAGE || __DOXYGEN__
+
 /**
  * \ingroup         GUI_IMAGE
  * \brief           Image object structure
@@ -43,10 +45,23 @@ typedef struct {
     gui_handle C;                                   /*!< GUI handle object, must always be first on list */
     
     const gui_image_desc_t* image;                  /*!< Pointer to image object to draw */
+#if GUI_CFG_USE_IMAGE_TRANSFORM
+    const gui_image_transform_t* transform;         /*!< Scale and rotation of image or `NULL` */
+#endif /* GUI_CFG_USE_IMAGE_TRANSFORM */
 } gui_image_t;
 
 static uint8_t gui_image_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result);
 
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+/**
+ * \brief           Widget events processed by callback, other events are not delivered to widget
+ */
+static const gui_widget_evt_fn
+evt_table[GUI_EVT_COUNT] = {
+    [GUI_EVT_DRAW] = gui_image_callback,
+};
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
+
 /**
  * \brief           Widget initialization structure
  */
@@ -58,6 +73,9 @@ gui_widget_t widget = {
     .callback = gui_image_callback,                 /*!< Callback function */
     .colors = 0,                                    /*!< List of default colors */
     .color_count = 0,                               /*!< Define number of colors */
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+    .evt_table = evt_table,                         /*!< List of handled events */
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
 };
 
 /**
@@ -81,6 +99,12 @@ gui_image_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
             x = gui_widget_getabsolutex(h);
             y = gui_widget_getabsolutey(h);
             
+#if GUI_CFG_USE_IMAGE_TRANSFORM
+            if (o->transform != NULL) {             /* Pivot point is in widget center */
+                gui_draw_image_transform(disp, x + gui_widget_getwidth(h) / 2, y + gui_widget_getheight(h) / 2, o->image, o->transform);
+                return 1;
+            }
+#endif /* GUI_CFG_USE_IMAGE_TRANSFORM */
             gui_draw_image(disp, x, y, o->image);   /* Draw actual image on screen */
             return 1;
         }
@@ -127,3 +151,30 @@ gui_image_setsource(gui_handle_p h, const gui_image_desc_t* img) {
 
     return 1;
 }
+
+#if GUI_CFG_USE_IMAGE_TRANSFORM || __DOXYGEN__
+
+/**
+ * \brief           Set scale and rotation of image, drawn with pivot point in widget center
+ * \note            Transformed image is clipped to widget area
+ * \param[in]       h: Widget handle
+ * \param[in]       tr: Transformation, must stay valid while set. Set to `NULL` to draw image as it is
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_image_settransform(gui_handle_p h, const gui_image_transform_t* tr) {
+    gui_image_t* o = GUI_VP(h);
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    
+    o->transform = tr;                              /* Set transformation */
+    
+    /* Rotated image does not cover whole widget */
+    gui_widget_setinvalidatewithparent(h, tr != NULL || (o->image != NULL && o->image->bpp == 32));
+    gui_widget_invalidatewithparent(h);
+    
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_IMAGE_TRANSFORM || __DOXYGEN__ */
+
+#endif /* GUI_CFG_WIDGET_IMAGE || __DOXYGEN__ */
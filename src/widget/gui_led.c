@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "widget/gui_led.h"
 
+#if GUI_CFG_WIDGET_LED || __DOXYGEN__
+
 /**
  * \ingroup         GUI_LED
  * \name            GUI_LED_FLAGS
@@ -65,6 +67,18 @@ typedef struct {
 
 static uint8_t gui_led_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result);
 
+/**
+ * \brief           LED look, used as sprite key
+ */
+typedef struct {
+    const gui_widget_t* type;                       /*!< Widget type, keeps sprites of different widgets apart */
+    gui_color_t fill;                               /*!< Fill color */
+    gui_color_t border;                             /*!< Border color */
+    gui_dim_t width;                                /*!< LED width */
+    gui_dim_t height;                               /*!< LED height */
+    gui_led_type_t shape;                           /*!< LED shape */
+} gui_led_sprite_t;
+
 /**
  * \brief           List of default color in the same order of widget color enumeration
  */
@@ -76,6 +90,17 @@ gui_color_t colors[] = {
     GUI_COLOR_BLACK,                                /*!< Default border color when led is off */
 };
 
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+/**
+ * \brief           Widget events processed by callback, other events are not delivered to widget
+ */
+static const gui_widget_evt_fn
+evt_table[GUI_EVT_COUNT] = {
+    [GUI_EVT_SETPARAM] = gui_led_callback,
+    [GUI_EVT_DRAW] = gui_led_callback,
+};
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
+
 /**
  * \brief           Widget initialization structure
  */
@@ -87,8 +112,31 @@ gui_widget_t widget = {
     .callback = gui_led_callback,                   /*!< Control function */
     .colors = colors,                               /*!< List of default colors */
     .color_count = GUI_COUNT_OF(colors),            /*!< Number of colors */
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+    .evt_table = evt_table,                         /*!< List of handled events */
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
 };
 
+/**
+ * \brief           Draw LED shape
+ * \param[in]       disp: Clipping region
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       key: LED look, \ref gui_led_sprite_t structure
+ */
+static void
+led_draw(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, const void* key) {
+    const gui_led_sprite_t* led = key;
+    
+    if (led->shape == GUI_LED_TYPE_RECT) {            /* When led has rectangle shape */
+        gui_draw_filledrectangle(disp, x + 1, y + 1, led->width - 2, led->height - 2, led->fill);
+        gui_draw_rectangle(disp, x, y, led->width, led->height, led->border);
+    } else {
+        gui_draw_filledcircle(disp, x + led->width / 2, y + led->height / 2, led->width / 2, led->fill);
+        gui_draw_circle(disp, x + led->width / 2, y + led->height / 2, led->width / 2, led->border);
+    }
+}
+
 /**
  * \brief           Default widget callback function
  * \param[in]       h: Widget handle
@@ -104,8 +152,10 @@ gui_led_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const pa
     switch (evt) {
         case GUI_EVT_SETPARAM: {                     /* Set parameter for widget */
             gui_widget_param* p = GUI_EVT_PARAMTYPE_WIDGETPARAM(param);
+            uint8_t changed = 1;
             switch (p->type) {
                 case CFG_SET:
+                    changed = !(o->flags & GUI_LED_FLAG_ON) != !*(uint8_t *)p->data;
                     if (*(uint8_t *)p->data) {
                         o->flags |= GUI_LED_FLAG_ON;
                     } else {
@@ -116,15 +166,17 @@ gui_led_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const pa
                     o->flags ^= GUI_LED_FLAG_ON;    /* Toggle flag */
                     break;
                 case CFG_TYPE: 
+                    changed = o->type != *(gui_led_type_t *)p->data;
                     o->type = *(gui_led_type_t *)p->data;   /* Set type */
                     break;
                 default: break;
             }
-            GUI_EVT_RESULTTYPE_U8(result) = 1;      /* Save result */
+            GUI_EVT_RESULTTYPE_U8(result) = changed;/* Save result, skip invalidation when unchanged */
             return 1;
         }
         case GUI_EVT_DRAW: {
             gui_display_t* disp = GUI_EVT_PARAMTYPE_DISP(param);
+            gui_led_sprite_t sprite;
             gui_color_t c1, c2;
             gui_dim_t x, y, width, height;
             
@@ -142,13 +194,14 @@ gui_led_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const pa
                 c2 = guii_widget_getcolor(h, GUI_LED_COLOR_OFF_BORDER);
             }
             
-            if (o->type == GUI_LED_TYPE_RECT) {     /* When led has rectangle shape */
-                gui_draw_filledrectangle(disp, x + 1, y + 1, width - 2, height - 2, c1);
-                gui_draw_rectangle(disp, x, y, width, height, c2);
-            } else {
-                gui_draw_filledcircle(disp, x + width / 2, y + height / 2, width / 2, c1);
-                gui_draw_circle(disp, x + width / 2, y + height / 2, width / 2, c2);
-            }
+            memset(&sprite, 0x00, sizeof(sprite));  /* Key is compared including padding */
+            sprite.type = &widget;
+            sprite.fill = c1;
+            sprite.border = c2;
+            sprite.width = width;
+            sprite.height = height;
+            sprite.shape = o->type;
+            guii_draw_sprite(disp, x, y, width, height, &sprite, sizeof(sprite), led_draw);
             return 1;                               /* */
         }
         default:                                    /* Handle default option */
@@ -233,3 +286,5 @@ gui_led_ison(gui_handle_p h) {
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
     return (o->flags & GUI_LED_FLAG_ON) == GUI_LED_FLAG_ON;
 }
+
+#endif /* GUI_CFG_WIDGET_LED || __DOXYGEN__ */
@@ -34,6 +34,9 @@
 #define GUI_INTERNAL
 #include "gui/gui_private.h"
 #include "widget/gui_list_container.h"
+#include "widget/gui_widget_list.h"
+
+#if GUI_CFG_WIDGET_LIST_CONTAINER || __DOXYGEN__
 
 /**
  * \ingroup         GUI_LISTCONTAINER
@@ -45,6 +48,16 @@ typedef struct {
     gui_listcontainer_mode_t mode;                  /*!< List container type */
     gui_dim_t maxscrollx;                           /*!< Maximal scroll on X axis */
     gui_dim_t maxscrolly;                           /*!< Maximal scroll on Y axis */
+    gui_widget_kinetic_t kinetic;                   /*!< Kinetic scroll data */
+    
+    gui_dim_t row_height;                           /*!< Height of row in recycler mode, `0` when not used */
+    uint32_t row_count;                             /*!< Number of rows in list */
+    int32_t row_scroll;                             /*!< Scroll of rows in units of pixels */
+    gui_handle_p* rows;                             /*!< Row widgets, row of list index is in slot `index % rows_count` */
+    uint32_t* rows_bound;                           /*!< List index bound to each row widget, `UINT32_MAX` when none */
+    size_t rows_count;                              /*!< Number of row widgets */
+    gui_listcontainer_bind_fn bind_fn;              /*!< Bind function for rows */
+    void* bind_arg;                                 /*!< Custom argument of bind function */
 } gui_listcontainer_t;
 
 #define CFG_MODE            0x01
@@ -66,12 +79,80 @@ static const
 gui_widget_t widget = {
     .name = _GT("LIST_CONTAINER"),                  /*!< Widget name */ 
     .size = sizeof(gui_listcontainer_t),            /*!< Size of widget for memory allocation */
-    .flags = GUI_FLAG_WIDGET_ALLOW_CHILDREN | GUI_FLAG_WIDGET_INVALIDATE_PARENT,    /*!< List of widget flags */
+    .flags = GUI_FLAG_WIDGET_ALLOW_CHILDREN | GUI_FLAG_WIDGET_INVALIDATE_PARENT | GUI_FLAG_WIDGET_OPAQUE,    /*!< List of widget flags */
     .callback = gui_listcontainer_callback,         /*!< Control function */
     .colors = colors,                               /*!< List of default colors */
     .color_count = GUI_COUNT_OF(colors),            /*!< Number of colors */
 };
 
+/**
+ * \brief           Get maximal scroll of rows in recycler mode
+ * \param[in]       h: Widget handle
+ * \return          Maximal scroll in units of pixels
+ */
+static int32_t
+recycler_maxscroll(gui_handle_p h) {
+    gui_listcontainer_t* o = GUI_VP(h);
+    int32_t max;
+    
+    max = (int32_t)o->row_count * o->row_height - gui_widget_getinnerheight(h);
+    return GUI_MAX(max, 0);
+}
+
+/**
+ * \brief           Position row widgets for current scroll and bind rows which came to view
+ *
+ *                  Visible rows are at list indexes from `row_scroll / row_height` on,
+ *                  row widgets of indexes outside list are hidden
+ * \param[in]       h: Widget handle
+ */
+static void
+recycler_layout(gui_handle_p h) {
+    gui_listcontainer_t* o = GUI_VP(h);
+    uint32_t first, index;
+    size_t i, slot;
+    gui_handle_p row;
+    
+    first = (uint32_t)(o->row_scroll / o->row_height);
+    for (i = 0; i < o->rows_count; i++) {
+        index = first + (uint32_t)i;
+        slot = index % o->rows_count;
+        row = o->rows[slot];
+        if (index >= o->row_count) {
+            gui_widget_hide(row);
+            continue;
+        }
+        if (o->rows_bound[slot] != index) {         /* Row scrolled in, repopulate widgets */
+            o->rows_bound[slot] = index;
+            if (o->bind_fn != NULL) {
+                o->bind_fn(h, row, index, o->bind_arg);
+            }
+        }
+        gui_widget_setyposition(row, (gui_dim_t)((int32_t)index * o->row_height - o->row_scroll));
+        gui_widget_show(row);
+    }
+}
+
+/**
+ * \brief           Remove all children and row widgets of recycler mode
+ * \note            Children are removed from memory on next processing
+ * \param[in]       h: Widget handle
+ */
+static void
+recycler_free(gui_handle_p h) {
+    gui_listcontainer_t* o = GUI_VP(h);
+    gui_handle_p w, next;
+    
+    for (w = gui_linkedlist_widgetgetnext(h, NULL); w != NULL; w = next) {
+        next = gui_linkedlist_widgetgetnext(NULL, w);
+        gui_widget_remove(&w);
+    }
+    GUI_MEMFREE(o->rows);
+    GUI_MEMFREE(o->rows_bound);
+    o->rows_count = 0;
+    o->row_height = 0;
+}
+
 /* Calculate scroll limits according to children widgets */
 static void
 calculate_limits(gui_handle_p h) {
@@ -79,17 +160,28 @@ calculate_limits(gui_handle_p h) {
     gui_dim_t x, y, width, height, cmx = 0, cmy = 0;
     gui_listcontainer_t* o = GUI_VP(h);
     
-    /* Scan all children widgets and check for maximal possible scroll */
-    for (w = gui_linkedlist_widgetgetnext(h, NULL); w != NULL;
-            w = gui_linkedlist_widgetgetnext(NULL, w)) {
+    if (o->row_height) {                            /* Rows are scrolled by recycler, not by widget scroll */
+        o->maxscrollx = 0;
+        o->maxscrolly = 0;
+        return;
+    }
+#if GUI_CFG_USE_LAYOUT
+    /* Size of children is known from last arrange pass when layout is used */
+    if (!guii_widget_getlayoutcontent(h, &cmx, &cmy))
+#endif /* GUI_CFG_USE_LAYOUT */
+    {
+        /* Scan all children widgets and check for maximal possible scroll */
+        for (w = gui_linkedlist_widgetgetnext(h, NULL); w != NULL;
+                w = gui_linkedlist_widgetgetnext(NULL, w)) {
 
-        x = guii_widget_getrelativex(w);
-        y = guii_widget_getrelativey(w);
-        width = gui_widget_getwidth(w);
-        height = gui_widget_getheight(w);
+            x = guii_widget_getrelativex(w);
+            y = guii_widget_getrelativey(w);
+            width = gui_widget_getwidth(w);
+            height = gui_widget_getheight(w);
 
-        cmx = GUI_MAX(cmx, x + width);
-        cmy = GUI_MAX(cmy, y + height);
+            cmx = GUI_MAX(cmx, x + width);
+            cmy = GUI_MAX(cmy, y + height);
+        }
     }
 
     width = gui_widget_getinnerwidth(h);  
@@ -112,6 +204,49 @@ calculate_limits(gui_handle_p h) {
     }
 }
 
+#if GUI_CFG_USE_TOUCH
+
+/**
+ * \brief           Scroll container by number of pixels, used as kinetic scroll callback
+ * \param[in]       h: Widget handle
+ * \param[in]       arg: Custom argument, not used
+ * \param[in]       dx: Number of pixels to scroll in horizontal direction
+ * \param[in]       dy: Number of pixels to scroll in vertical direction
+ * \return          `1` if container scrolled, `0` otherwise
+ */
+static uint8_t
+kinetic_scroll(gui_handle_p h, void* arg, int16_t dx, int16_t dy) {
+    gui_listcontainer_t* o = GUI_VP(h);
+    gui_dim_t sx, sy;
+    
+    GUI_UNUSED(arg);
+    if (o->row_height) {
+        int32_t scroll = o->row_scroll;
+        
+        o->row_scroll = GUI_MAX(0, GUI_MIN(o->row_scroll + dy, recycler_maxscroll(h)));
+        if (o->row_scroll == scroll) {
+            return 0;
+        }
+        recycler_layout(h);
+        return 1;
+    }
+    calculate_limits(h);                            /* Calculate scroll limits */
+
+    /* Get current scroll values */
+    sx = gui_widget_getscrollx(h);
+    sy = gui_widget_getscrolly(h);
+    
+    if (dx) {
+        gui_widget_setscrollx(h, GUI_MAX(0, GUI_MIN(sx + dx, o->maxscrollx)));
+    }
+    if (dy) {
+        gui_widget_setscrolly(h, GUI_MAX(0, GUI_MIN(sy + dy, o->maxscrolly)));
+    }
+    return gui_widget_getscrollx(h) != sx || gui_widget_getscrolly(h) != sy;
+}
+
+#endif /* GUI_CFG_USE_TOUCH */
+
 /**
  * \brief           Default widget callback function
  * \param[in]       h: Widget handle
@@ -130,13 +265,15 @@ gui_listcontainer_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t
         }
         case GUI_EVT_SETPARAM: {                     /* Set parameter for widget */
             gui_widget_param* p = GUI_EVT_PARAMTYPE_WIDGETPARAM(param);
+            uint8_t changed = 1;
             switch (p->type) {
                 case CFG_MODE:
+                    changed = o->mode != *(gui_listcontainer_mode_t *)p->data;
                     o->mode = *(gui_listcontainer_mode_t *)p->data;
                     break;
                 default: break;
             }
-            GUI_EVT_RESULTTYPE_U8(result) = 1;   /* Save result */
+            GUI_EVT_RESULTTYPE_U8(result) = changed;/* Save result, skip invalidation when unchanged */
             return 1;
         }
         case GUI_EVT_CHILDWIDGETCREATED: {           /* Child widget has been created */
@@ -156,49 +293,41 @@ gui_listcontainer_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t
             gui_draw_filledrectangle(disp, x, y, width, height, guii_widget_getcolor(h, GUI_LISTCONTAINER_COLOR_BG));
             return 1;                               /* */
         }
+        case GUI_EVT_CLONE: {                       /* Widget copied from prototype */
+            memset(&o->kinetic, 0x00, sizeof(o->kinetic));  /* Scroll animation is not copied */
+            GUI_EVT_RESULTTYPE_U8(result) = o->row_height == 0; /* Rows of recycler belong to prototype */
+            return 1;
+        }
+        case GUI_EVT_REMOVE: {
+#if GUI_CFG_USE_TOUCH
+            gui_widget_kinetic_stop(h, &o->kinetic);
+#endif /* GUI_CFG_USE_TOUCH */
+            GUI_MEMFREE(o->rows);                   /* Row widgets are removed as children */
+            GUI_MEMFREE(o->rows_bound);
+            o->rows_count = 0;
+            o->row_height = 0;
+            return 1;
+        }
 #if GUI_CFG_USE_TOUCH
         case GUI_EVT_TOUCHSTART: {
+            o->kinetic.scroll_fn = kinetic_scroll;
+            gui_widget_kinetic_touchstart(h, &o->kinetic,
+                o->mode != GUI_LISTCONTAINER_MODE_VERTICAL ? 1 : 0,
+                o->mode != GUI_LISTCONTAINER_MODE_HORIZONTAL ? 1 : 0);
             GUI_EVT_RESULTTYPE_TOUCH(result) = touchHANDLED;
             return 1;
         }
         case GUI_EVT_TOUCHMOVE: {
-            gui_dim_t sx, sy, new_diff;
-            guii_touch_data_t* ts = GUI_EVT_PARAMTYPE_TOUCH(param);  /* Get touch data */
-
-            /* Get current scroll values */
-            sx = gui_widget_getscrollx(h);
-            sy = gui_widget_getscrolly(h);
-
-            /* Try to scroll widget */
-            if (o->mode == GUI_LISTCONTAINER_MODE_VERTICAL || o->mode == GUI_LISTCONTAINER_MODE_VERTICAL_HORIZONTAL) {
-                new_diff = -ts->y_diff[0];
-                if ((new_diff + sy) <= 0) {
-                    gui_widget_setscrolly(h, 0);
-                } else if ((new_diff + sy) >= o->maxscrolly) {
-                    gui_widget_setscrolly(h, o->maxscrolly);
-                } else {
-                    gui_widget_setscrolly(h, sy + new_diff);
-                }
-            }
-            if (o->mode == GUI_LISTCONTAINER_MODE_HORIZONTAL || o->mode == GUI_LISTCONTAINER_MODE_VERTICAL_HORIZONTAL) {
-                new_diff = -ts->x_diff[0];
-                if ((new_diff + sx) <= 0) {
-                    gui_widget_setscrollx(h, 0);
-                } else if ((new_diff + sx) >= o->maxscrollx) {
-                    gui_widget_setscrollx(h, o->maxscrollx);
-                } else {
-                    gui_widget_setscrollx(h, sx + new_diff);
-                }
-            }
-            calculate_limits(h);                    /* Calculate scroll limits */
-            
-            /* Check if scroll was successful */
-            /* Handle touch, otherwise send it to parent widget */
-            GUI_EVT_RESULTTYPE_TOUCH(result) = touchCONTINUE;
-            if (gui_widget_getscrollx(h) != sx || gui_widget_getscrolly(h) != sy) {
+            /* Handle touch if scroll was successful, otherwise send it to parent widget */
+            if (gui_widget_kinetic_touchmove(h, &o->kinetic, GUI_EVT_PARAMTYPE_TOUCH(param))) {
                 GUI_EVT_RESULTTYPE_TOUCH(result) = touchHANDLED;
+            } else {
+                GUI_EVT_RESULTTYPE_TOUCH(result) = touchCONTINUE;
             }
-
+            return 1;
+        }
+        case GUI_EVT_TOUCHEND: {
+            gui_widget_kinetic_touchend(h, &o->kinetic);
             return 1;
         }
 #endif /* GUI_CFG_USE_TOUCH */
@@ -256,3 +385,106 @@ gui_listcontainer_setmode(gui_handle_p h, gui_listcontainer_mode_t mode) {
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
     return guii_widget_setparam(h, CFG_MODE, &mode, 1, 0);
 }
+
+/**
+ * \brief           Set recycler mode with fixed pool of row widgets
+ *
+ *                  Only enough rows to fill visible area plus one are created with `create_fn`.
+ *                  When rows scroll in, their widgets are repopulated with `bind_fn`,
+ *                  thus memory and tree traversal do not depend on number of rows in list.
+ *                  Rows are scrolled vertically, children created before are removed
+ *
+ * \note            Number of row widgets depends on widget height at the time of call
+ * \note            `create_fn` can copy hidden prototype row with \ref gui_widget_clone,
+ *                  rows are then created without initialization of each widget
+ * \param[in]       h: Widget handle
+ * \param[in]       row_height: Height of each row in units of pixels
+ * \param[in]       count: Number of rows in list
+ * \param[in]       create_fn: Function to create widgets of single row
+ * \param[in]       bind_fn: Function to populate row widgets for list index
+ * \param[in]       arg: Custom argument passed to create and bind functions
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listcontainer_setrecycler(gui_handle_p h, gui_dim_t row_height, uint32_t count,
+                                gui_listcontainer_create_fn create_fn, gui_listcontainer_bind_fn bind_fn, void* arg) {
+    gui_listcontainer_t* o = GUI_VP(h);
+    size_t i, cnt;
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && row_height > 0 && create_fn != NULL && bind_fn != NULL);
+    
+    recycler_free(h);                               /* Rows are the only children */
+    
+    cnt = (size_t)((gui_widget_getinnerheight(h) + row_height - 1) / row_height) + 1;
+    o->rows = GUI_MEMALLOC(sizeof(*o->rows) * cnt);
+    o->rows_bound = GUI_MEMALLOC(sizeof(*o->rows_bound) * cnt);
+    if (o->rows == NULL || o->rows_bound == NULL) {
+        recycler_free(h);
+        return 0;
+    }
+    o->rows_count = cnt;
+    for (i = 0; i < cnt; i++) {
+        o->rows_bound[i] = UINT32_MAX;
+        if ((o->rows[i] = create_fn(h, arg)) == NULL) {
+            recycler_free(h);
+            return 0;
+        }
+    }
+    
+    o->mode = GUI_LISTCONTAINER_MODE_VERTICAL;
+    o->row_height = row_height;
+    o->row_count = count;
+    o->row_scroll = 0;
+    o->bind_fn = bind_fn;
+    o->bind_arg = arg;
+    gui_widget_setscrollx(h, 0);
+    gui_widget_setscrolly(h, 0);
+    recycler_layout(h);
+    gui_widget_invalidate(h);
+    return 1;
+}
+
+/**
+ * \brief           Set number of rows in recycler mode
+ *
+ *                  Visible rows are bound again, use it also when data of rows change
+ * \note            Recycler mode must be set first with \ref gui_listcontainer_setrecycler
+ * \param[in]       h: Widget handle
+ * \param[in]       count: Number of rows in list
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listcontainer_setrowcount(gui_handle_p h, uint32_t count) {
+    gui_listcontainer_t* o = GUI_VP(h);
+    size_t i;
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && o->row_height);
+    
+    o->row_count = count;
+    o->row_scroll = GUI_MIN(o->row_scroll, recycler_maxscroll(h));
+    for (i = 0; i < o->rows_count; i++) {
+        o->rows_bound[i] = UINT32_MAX;
+    }
+    recycler_layout(h);
+    return 1;
+}
+
+/**
+ * \brief           Scroll rows in recycler mode to show row on top
+ * \note            Recycler mode must be set first with \ref gui_listcontainer_setrecycler
+ * \param[in]       h: Widget handle
+ * \param[in]       index: List index of row
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listcontainer_scrolltorow(gui_handle_p h, uint32_t index) {
+    gui_listcontainer_t* o = GUI_VP(h);
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && o->row_height);
+    
+    o->row_scroll = GUI_MIN((int32_t)GUI_MIN(index, (uint32_t)INT32_MAX / (uint32_t)o->row_height) * o->row_height, recycler_maxscroll(h));
+    recycler_layout(h);
+    return 1;
+}
+
+#endif /* GUI_CFG_WIDGET_LIST_CONTAINER || __DOXYGEN__ */
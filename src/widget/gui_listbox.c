@@ -36,6 +36,8 @@
 #include "widget/gui_listbox.h"
 #include "widget/gui_widget_list.h"
 
+#if GUI_CFG_WIDGET_LISTBOX || __DOXYGEN__
+
 /**
  * \ingroup         GUI_LISTBOX
  * \name            GUI_LISTBOX_FLAGS
@@ -67,6 +69,7 @@ typedef struct {
     gui_handle C;                                   /*!< GUI handle object, must always be first on list */
     
     gui_widget_listdata_t ld;                       /*!< List data handle */
+    gui_listbox_data_fn data_fn;                    /*!< Data source callback for virtual mode */
     int16_t selected;                               /*!< Selected text index */
     
     gui_dim_t sliderwidth;                          /*!< Slider width in units of pixels */
@@ -95,7 +98,7 @@ static const
 gui_widget_t widget = {
     .name = _GT("LISTBOX"),                         /*!< Widget name */
     .size = sizeof(gui_listbox_t),                  /*!< Size of widget for memory allocation */
-    .flags = 0,                                     /*!< List of widget flags */
+    .flags = GUI_FLAG_WIDGET_OPAQUE,                /*!< List of widget flags */
     .callback = gui_listbox_callback,               /*!< Callback function */
     .colors = colors,                               /*!< List of default colors */
     .color_count = GUI_COUNT_OF(colors),            /*!< Define number of colors */
@@ -153,6 +156,59 @@ check_values(gui_handle_p h) {
     return 1;
 }
 
+/**
+ * \brief           Get text of item
+ * \param[in]       h: Widget handle
+ * \param[in]       item: Stored item or `NULL` in virtual mode
+ * \param[in]       index: Item index
+ * \return          Item text or `NULL` if item is empty
+ */
+static const gui_char*
+get_item_text(gui_handle_p h, gui_listbox_item_t* item, int16_t index) {
+    gui_listbox_t* o = GUI_VP(h);
+    
+#if GUI_CFG_USE_LISTMODEL
+    if (gui_widget_list_get_model(h, &o->ld) != NULL) {
+        return gui_listmodel_getstring(gui_widget_list_get_model(h, &o->ld), index, 0);
+    }
+#endif /* GUI_CFG_USE_LISTMODEL */
+    if (o->data_fn != NULL) {
+        return o->data_fn(h, index);
+    }
+    return item != NULL ? item->text : NULL;
+}
+
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+
+/**
+ * \brief           Model change callback, redraws only affected visible items
+ * \param[in]       h: Widget handle
+ * \param[in]       change: Type of change
+ * \param[in]       index: Index of first changed item
+ * \param[in]       count: Number of changed items
+ */
+static void
+model_changed(gui_handle_p h, gui_listmodel_change_t change, int16_t index, int16_t count) {
+    gui_listbox_t* o = GUI_VP(h);
+    uint8_t slider = o->flags & GUI_FLAG_LISTBOX_SLIDER_ON;
+    int16_t start = gui_widget_list_get_visible_start_index(h, &o->ld);
+    
+    gui_widget_list_model_changed(h, &o->ld, &o->selected, change, index, count);
+    if (change == GUI_LISTMODEL_CHANGE_UPDATE) {
+        gui_widget_list_invalidate_items(h, &o->ld, index, count, 2, h->font != NULL ? item_height(h, NULL) : 0);
+    } else if (change == GUI_LISTMODEL_CHANGE_RESET || slider != (o->flags & GUI_FLAG_LISTBOX_SLIDER_ON)
+        || start != gui_widget_list_get_visible_start_index(h, &o->ld)) {
+        gui_widget_invalidate(h);                   /* Items moved on entire widget */
+    } else {
+        gui_widget_list_invalidate_items(h, &o->ld, index, -1, 2, h->font != NULL ? item_height(h, NULL) : 0);
+        if (slider) {                               /* Scrollbar shows number of items */
+            gui_widget_invalidatearea(h, gui_widget_getwidth(h) - o->sliderwidth - 1, 0, o->sliderwidth + 1, gui_widget_getheight(h));
+        }
+    }
+}
+
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
+
 /**
  * \brief           Delete item from widget and check values
  * \param[in]       h: Widget handle
@@ -182,6 +238,9 @@ delete_item(gui_handle_p h, int16_t index) {
  */
 static uint8_t
 remove_item_memory(gui_handle_p h, void* item) {
+#if GUI_CFG_USE_STRING_INTERN
+    gui_intern_release(((gui_listbox_item_t *)item)->text);
+#endif /* GUI_CFG_USE_STRING_INTERN */
     GUI_MEMFREE(item);
     return 1;
 }
@@ -198,7 +257,6 @@ static uint8_t
 gui_listbox_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result) {
     gui_listbox_t* o = GUI_VP(h);
 #if GUI_CFG_USE_TOUCH
-    static gui_dim_t ty;
 #endif /* GUI_CFG_USE_TOUCH */
     
     switch (evt) {
@@ -270,17 +328,21 @@ gui_listbox_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* cons
                     disp->y2 = y + height - 2;
                 }
                 
-                /* Draw list items */
-                for (item = gui_widget_list_get_first_visible_item(h, &o->ld, &index); item != NULL && f.y <= disp->y2;
-                        item = gui_widget_list_get_next_item(h, &o->ld, item), index++) {
-                            
+                /* Draw list items, in virtual mode text is requested from data source or model */
+                for (item = gui_widget_list_get_first_visible_item(h, &o->ld, &index);
+                        (item != NULL || o->ld.is_virtual) && index < gui_widget_list_get_count(h, &o->ld) && f.y <= disp->y2;
+                        item = item != NULL ? gui_widget_list_get_next_item(h, &o->ld, item) : NULL, index++) {
+                    const gui_char* text = get_item_text(h, item, index);
+
                     if (index == o->selected) {
                         gui_draw_filledrectangle(disp, x + 2, f.y, width - 3, GUI_MIN(f.height, itemheight), guii_widget_isfocused(h) ? guii_widget_getcolor(h, GUI_LISTBOX_COLOR_SEL_FOC_BG) : guii_widget_getcolor(h, GUI_LISTBOX_COLOR_SEL_NOFOC_BG));
                         f.color1 = guii_widget_isfocused(h) ? guii_widget_getcolor(h, GUI_LISTBOX_COLOR_SEL_FOC) : guii_widget_getcolor(h, GUI_LISTBOX_COLOR_SEL_NOFOC);
                     } else {
                         f.color1 = guii_widget_getcolor(h, GUI_LISTBOX_COLOR_TEXT);
                     }
-                    gui_draw_writetext(disp, gui_widget_getfont(h), item->text, &f);
+                    if (text != NULL) {
+                        gui_draw_writetext(disp, gui_widget_getfont(h), text, &f);
+                    }
                     f.y += itemheight;
                 }
                 disp->y2 = tmp;
@@ -288,28 +350,33 @@ gui_listbox_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* cons
             
             return 1;
         }
+        case GUI_EVT_CLONE: {                       /* Widget copied from prototype */
+            GUI_EVT_RESULTTYPE_U8(result) = 0;      /* Items belong to prototype, widget cannot be copied */
+            return 1;
+        }
         case GUI_EVT_REMOVE: {
+#if GUI_CFG_USE_TOUCH
+            gui_widget_kinetic_stop(h, &o->ld.kinetic);
+#endif /* GUI_CFG_USE_TOUCH */
+#if GUI_CFG_USE_LISTMODEL
+            guii_listmodel_detach(&o->ld.view);
+#endif /* GUI_CFG_USE_LISTMODEL */
             gui_widget_list_remove_items(h, &o->ld);
             return 1;
         }
 #if GUI_CFG_USE_TOUCH
         case GUI_EVT_TOUCHSTART: {
-            guii_touch_data_t* ts = GUI_EVT_PARAMTYPE_TOUCH(param);  /* Get touch data */
-            ty = ts->y_rel[0];
+            gui_widget_list_touchstart(h, &o->ld, h->font != NULL ? item_height(h, NULL) : 0);
             
             GUI_EVT_RESULTTYPE_TOUCH(result) = touchHANDLED;
             return 1;
         }
         case GUI_EVT_TOUCHMOVE: {
-            guii_touch_data_t* ts = GUI_EVT_PARAMTYPE_TOUCH(param);  /* Get touch data */
-            if (h->font != NULL) {
-                gui_dim_t height = item_height(h, NULL);   /* Get element height */
-                
-                if (GUI_ABS(ty - ts->y_rel[0]) > height) {
-                    gui_widget_list_slide(h, &o->ld, (ty - ts->y_rel[0]) > 0 ? 1 : -1);
-                    ty = ts->y_rel[0];
-                }
-            }
+            gui_widget_list_touchmove(h, &o->ld, GUI_EVT_PARAMTYPE_TOUCH(param));
+            return 1;
+        }
+        case GUI_EVT_TOUCHEND: {
+            gui_widget_list_touchend(h, &o->ld);
             return 1;
         }
 #endif /* GUI_CFG_USE_TOUCH */
@@ -394,7 +461,8 @@ gui_listbox_setcolor(gui_handle_p h, gui_listbox_color_t index, gui_color_t colo
 /**
  * \brief           Add a new string to list box
  * \param[in]       h: Widget handle
- * \param[in]       text: Pointer to text to add to list. Only pointer is saved to memory!
+ * \param[in]       text: Pointer to text to add to list. Only pointer is saved to memory,
+ *                      unless \ref GUI_CFG_USE_STRING_INTERN is enabled
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
@@ -405,15 +473,26 @@ gui_listbox_addstring(gui_handle_p h, const gui_char* text) {
     
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
 
+#if GUI_CFG_USE_STRING_INTERN
+    if ((text = gui_intern_get(text)) == NULL) {    /* Use shared copy of text */
+        return 0;
+    }
+#endif /* GUI_CFG_USE_STRING_INTERN */
     item = GUI_MEMALLOC(sizeof(*item));             /* Allocate memory for entry */
     if (item != NULL) {
         item->text = (gui_char *)text;              /* Add text to entry */
-        gui_widget_list_add_item(h, &o->ld, item);  /* Add item to linked list */
-        
-        gui_widget_invalidate(h);
-        
-        ret = 1;
+        if (gui_widget_list_add_item(h, &o->ld, item)) {/* Add item to linked list, virtual list does not store items */
+            gui_widget_invalidate(h);
+            ret = 1;
+        } else {
+            GUI_MEMFREE(item);
+        }
     }
+#if GUI_CFG_USE_STRING_INTERN
+    if (!ret) {
+        gui_intern_release(text);
+    }
+#endif /* GUI_CFG_USE_STRING_INTERN */
     
     return ret;
 }
@@ -422,7 +501,8 @@ gui_listbox_addstring(gui_handle_p h, const gui_char* text) {
  * \brief           Set string value to already added string index
  * \param[in]       h: Widget handle
  * \param[in]       index: Index (position) on list to set/change text
- * \param[in]       text: Pointer to text to add to list. Only pointer is saved to memory!
+ * \param[in]       text: Pointer to text to add to list. Only pointer is saved to memory,
+ *                      unless \ref GUI_CFG_USE_STRING_INTERN is enabled
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
@@ -434,6 +514,12 @@ gui_listbox_setstring(gui_handle_p h, int16_t index, const gui_char* text) {
 
     item = gui_widget_list_get_item_byindex(h, &o->ld, index);  /* Get list item from handle */
     if (item != NULL) {
+#if GUI_CFG_USE_STRING_INTERN
+        if ((text = gui_intern_get(text)) == NULL) {/* Use shared copy of text */
+            return 0;
+        }
+        gui_intern_release(item->text);
+#endif /* GUI_CFG_USE_STRING_INTERN */
         item->text = (gui_char *)text;              /* Set new text */
         gui_widget_invalidate(h);                   /* Invalidate widget */
     }
@@ -508,6 +594,7 @@ gui_listbox_setselection(gui_handle_p h, int16_t selection) {
 
 /**
  * \brief           Get selected value
+ * \note            Selection is read without core protection and function may be called from any thread
  * \param[in]       h: Widget handle
  * \return          Selection on success, `-1` otherwise
  */
@@ -515,5 +602,75 @@ int16_t
 gui_listbox_getselection(gui_handle_p h) {
     gui_listbox_t* o = GUI_VP(h);
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
-    return o->selected;
+    return gui_widget_list_get_selection(h, &o->ld);
 }
+
+/**
+ * \brief           Switch listbox to virtual mode with data source callback
+ *
+ *                  In virtual mode strings are not stored in widget. Text for each
+ *                  visible entry is requested from data source callback during redraw.
+ *
+ * \note            All strings added with \ref gui_listbox_addstring are removed
+ * \param[in]       h: Widget handle
+ * \param[in]       data_fn: Data source callback function
+ * \param[in]       count: Number of entries in list
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listbox_setdatasource(gui_handle_p h, gui_listbox_data_fn data_fn, int16_t count) {
+    gui_listbox_t* o = GUI_VP(h);
+
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && data_fn != NULL);
+
+#if GUI_CFG_USE_LISTMODEL
+    guii_listmodel_detach(&o->ld.view);             /* Data source replaces model */
+#endif /* GUI_CFG_USE_LISTMODEL */
+    o->data_fn = data_fn;
+    return gui_widget_list_set_virtual_count(h, &o->ld, count);
+}
+
+/**
+ * \brief           Set number of entries for listbox in virtual mode
+ * \note            Data source must be set first with \ref gui_listbox_setdatasource
+ * \param[in]       h: Widget handle
+ * \param[in]       count: Number of entries in list
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listbox_setcount(gui_handle_p h, int16_t count) {
+    gui_listbox_t* o = GUI_VP(h);
+
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && o->data_fn != NULL);
+
+    return gui_widget_list_set_virtual_count(h, &o->ld, count);
+}
+
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+
+/**
+ * \brief           Show items of shared list model
+ *
+ *                  Model may be attached to several widgets at the same time.
+ *                  First column of model is shown, change of model redraws only affected visible items.
+ *
+ * \note            All strings added with \ref gui_listbox_addstring are removed and selection is cleared
+ * \param[in]       h: Widget handle
+ * \param[in]       model: Model handle. Set to `NULL` to detach model
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listbox_setmodel(gui_handle_p h, gui_listmodel_p model) {
+    gui_listbox_t* o = GUI_VP(h);
+
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+
+    if (model != NULL) {
+        o->data_fn = NULL;                          /* Model replaces data source */
+    }
+    return gui_widget_list_set_model(h, &o->ld, &o->selected, model, model_changed);
+}
+
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
+
+#endif /* GUI_CFG_WIDGET_LISTBOX || __DOXYGEN__ */
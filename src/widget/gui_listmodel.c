@@ -0,0 +1,354 @@
+/**	
+ * \file            gui_listmodel.c
+ * \brief           Shared item model for list widgets
+ */
+
+
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "widget/gui_listmodel.h"
+
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+
+/**
+ * \ingroup         GUI_LISTMODEL
+ * \brief           List model object structure
+ */
+struct gui_listmodel {
+    const gui_char** cells;                         /*!< Texts of all rows, `col_count` entries per row */
+    int16_t count;                                  /*!< Number of rows in model */
+    int16_t size;                                   /*!< Number of rows allocated in cells array */
+    uint16_t col_count;                             /*!< Number of columns per row */
+    gui_listmodel_view_t* views;                    /*!< Linked list of attached widgets */
+};
+
+/**
+ * \brief           Report change to all attached widgets
+ * \param[in]       model: Model handle
+ * \param[in]       change: Type of change
+ * \param[in]       index: Index of first changed row
+ * \param[in]       count: Number of changed rows
+ */
+static void
+notify(gui_listmodel_p model, gui_listmodel_change_t change, int16_t index, int16_t count) {
+    gui_listmodel_view_t* view;
+    
+    for (view = model->views; view != NULL; view = view->next) {
+        view->notify_fn(view->h, change, index, count);
+    }
+}
+
+/**
+ * \brief           Set text to cell, previous text is released
+ * \param[in]       cell: Pointer to cell
+ * \param[in]       text: New text, may be `NULL`
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+set_cell(const gui_char** cell, const gui_char* text) {
+#if GUI_CFG_USE_STRING_INTERN
+    if (text != NULL && (text = gui_intern_get(text)) == NULL) {    /* Use shared copy of text */
+        return 0;
+    }
+    if (*cell != NULL) {
+        gui_intern_release(*cell);
+    }
+#endif /* GUI_CFG_USE_STRING_INTERN */
+    *cell = text;
+    return 1;
+}
+
+/**
+ * \brief           Create new list model
+ * \param[in]       col_count: Number of text columns in each row. Use `1` for listbox and dropdown
+ * \return          Model handle on success, `NULL` otherwise
+ */
+gui_listmodel_p
+gui_listmodel_create(uint16_t col_count) {
+    gui_listmodel_p model;
+    
+    GUI_ASSERTPARAMS(col_count > 0);
+    
+    model = GUI_MEMALLOC(sizeof(*model));
+    if (model != NULL) {
+        model->col_count = col_count;
+    }
+    return model;
+}
+
+/**
+ * \brief           Delete list model and release all its rows
+ * \note            Attached widgets are detached and left empty
+ * \param[in]       model: Model handle
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listmodel_delete(gui_listmodel_p model) {
+    gui_listmodel_view_t* view;
+    
+    GUI_ASSERTPARAMS(model != NULL);
+    
+    while ((view = model->views) != NULL) {         /* Detach widgets first, they report no more rows */
+        guii_listmodel_detach(view);
+        view->notify_fn(view->h, GUI_LISTMODEL_CHANGE_RESET, 0, 0);
+    }
+    gui_listmodel_clear(model);
+    GUI_MEMFREE(model->cells);
+    GUI_MEMFREE(model);
+    return 1;
+}
+
+/**
+ * \brief           Get number of rows in model
+ * \param[in]       model: Model handle
+ * \return          Number of rows
+ */
+int16_t
+gui_listmodel_getcount(gui_listmodel_p model) {
+    GUI_ASSERTPARAMS(model != NULL);
+    return model->count;
+}
+
+/**
+ * \brief           Get number of columns in each row of model
+ * \param[in]       model: Model handle
+ * \return          Number of columns
+ */
+uint16_t
+gui_listmodel_getcolcount(gui_listmodel_p model) {
+    GUI_ASSERTPARAMS(model != NULL);
+    return model->col_count;
+}
+
+/**
+ * \brief           Add new row to the end of model with text in first column
+ * \param[in]       model: Model handle
+ * \param[in]       text: Text of first column
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listmodel_addstring(gui_listmodel_p model, const gui_char* text) {
+    GUI_ASSERTPARAMS(model != NULL);
+    
+    if (model->col_count == 1) {
+        return gui_listmodel_insertrow(model, -1, &text);
+    }
+    if (gui_listmodel_insertrow(model, -1, NULL)) {
+        return gui_listmodel_setstring(model, model->count - 1, 0, text);
+    }
+    return 0;
+}
+
+/**
+ * \brief           Insert new row to model
+ * \param[in]       model: Model handle
+ * \param[in]       index: Index of new row. Use `-1` to add row to the end
+ * \param[in]       texts: Array of texts with one entry for each column. Set to `NULL` for empty row
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listmodel_insertrow(gui_listmodel_p model, int16_t index, const gui_char* const* texts) {
+    const gui_char** row;
+    uint16_t i;
+    
+    GUI_ASSERTPARAMS(model != NULL && index <= model->count);
+    
+    if (model->count == INT16_MAX) {
+        return 0;
+    }
+    if (model->count == model->size) {              /* Grow array, double size for amortized constant time */
+        int16_t size = model->size ? GUI_MIN(2 * (int32_t)model->size, INT16_MAX) : 8;
+        const gui_char** cells = GUI_MEMREALLOC(model->cells, sizeof(*cells) * model->col_count * size);
+        if (cells == NULL) {
+            return 0;
+        }
+        model->cells = cells;
+        model->size = size;
+    }
+    if (index < 0) {
+        index = model->count;
+    }
+    row = &model->cells[(size_t)index * model->col_count];
+    memmove(row + model->col_count, row, sizeof(*row) * model->col_count * (model->count - index));
+    memset(row, 0x00, sizeof(*row) * model->col_count);
+    if (texts != NULL) {
+        for (i = 0; i < model->col_count; i++) {
+            if (!set_cell(&row[i], texts[i])) {     /* Release already set texts on failure */
+                while (i--) {
+                    set_cell(&row[i], NULL);
+                }
+                memmove(row, row + model->col_count, sizeof(*row) * model->col_count * (model->count - index));
+                return 0;
+            }
+        }
+    }
+    model->count++;
+    notify(model, GUI_LISTMODEL_CHANGE_INSERT, index, 1);
+    return 1;
+}
+
+/**
+ * \brief           Set text of model cell
+ * \param[in]       model: Model handle
+ * \param[in]       row: Row index
+ * \param[in]       col: Column index
+ * \param[in]       text: New text of cell
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listmodel_setstring(gui_listmodel_p model, int16_t row, uint16_t col, const gui_char* text) {
+    const gui_char** cell;
+    
+    GUI_ASSERTPARAMS(model != NULL);
+    
+    if (row < 0 || row >= model->count || col >= model->col_count) {
+        return 0;
+    }
+    cell = &model->cells[(size_t)row * model->col_count + col];
+    if (*cell == text || (*cell != NULL && text != NULL && !gui_string_compare(*cell, text))) {
+        return 1;                                   /* Same text, nothing to redraw */
+    }
+    if (!set_cell(cell, text)) {
+        return 0;
+    }
+    notify(model, GUI_LISTMODEL_CHANGE_UPDATE, row, 1);
+    return 1;
+}
+
+/**
+ * \brief           Get text of model cell
+ * \param[in]       model: Model handle
+ * \param[in]       row: Row index
+ * \param[in]       col: Column index
+ * \return          Text of cell or `NULL` if cell is empty or does not exist
+ */
+const gui_char*
+gui_listmodel_getstring(gui_listmodel_p model, int16_t row, uint16_t col) {
+    GUI_ASSERTPARAMS(model != NULL);
+    
+    if (row < 0 || row >= model->count || col >= model->col_count) {
+        return NULL;
+    }
+    return model->cells[(size_t)row * model->col_count + col];
+}
+
+/**
+ * \brief           Delete rows from model
+ * \param[in]       model: Model handle
+ * \param[in]       index: Index of first row to delete
+ * \param[in]       count: Number of rows to delete. Rows after the end of model are ignored
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listmodel_deleterows(gui_listmodel_p model, int16_t index, int16_t count) {
+    const gui_char** row;
+    size_t i;
+    
+    GUI_ASSERTPARAMS(model != NULL);
+    
+    if (index < 0 || index >= model->count || count <= 0) {
+        return 0;
+    }
+    count = GUI_MIN(count, model->count - index);
+    row = &model->cells[(size_t)index * model->col_count];
+    for (i = 0; i < (size_t)count * model->col_count; i++) {
+        set_cell(&row[i], NULL);
+    }
+    memmove(row, row + (size_t)count * model->col_count,
+        sizeof(*row) * model->col_count * (model->count - index - count));
+    model->count -= count;
+    notify(model, GUI_LISTMODEL_CHANGE_REMOVE, index, count);
+    return 1;
+}
+
+/**
+ * \brief           Delete all rows from model
+ * \param[in]       model: Model handle
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listmodel_clear(gui_listmodel_p model) {
+    GUI_ASSERTPARAMS(model != NULL);
+    
+    if (model->count) {
+        gui_listmodel_deleterows(model, 0, model->count);
+    }
+    return 1;
+}
+
+/**
+ * \brief           Attach widget to model
+ * \note            This function is private and may be called only from list widgets
+ * \param[in]       model: Model handle
+ * \param[in]       view: Attachment structure of widget
+ * \param[in]       h: Widget handle
+ * \param[in]       notify_fn: Change notification callback of widget
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+guii_listmodel_attach(gui_listmodel_p model, gui_listmodel_view_t* view, gui_handle_p h, gui_listmodel_notify_fn notify_fn) {
+    GUI_ASSERTPARAMS(model != NULL && view != NULL && view->model == NULL && notify_fn != NULL);
+    
+    view->model = model;
+    view->h = h;
+    view->notify_fn = notify_fn;
+    view->next = model->views;
+    model->views = view;
+    return 1;
+}
+
+/**
+ * \brief           Detach widget from its model
+ * \note            This function is private and may be called only from list widgets
+ * \param[in]       view: Attachment structure of widget
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+guii_listmodel_detach(gui_listmodel_view_t* view) {
+    gui_listmodel_view_t** v;
+    
+    GUI_ASSERTPARAMS(view != NULL);
+    
+    if (view->model == NULL) {
+        return 0;
+    }
+    for (v = &view->model->views; *v != NULL; v = &(*v)->next) {
+        if (*v == view) {
+            *v = view->next;
+            break;
+        }
+    }
+    view->next = NULL;
+    view->model = NULL;
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
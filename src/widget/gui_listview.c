@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "widget/gui_listview.h"
 #include "widget/gui_widget_list.h"
+
+#if GUI_CFG_WIDGET_LISTVIEW || __DOXYGEN__
     
 /**
  * \ingroup         GUI_LISTVIEW
@@ -56,7 +58,11 @@
  */
 typedef struct gui_listview_row {
     gui_linkedlist_t list;                          /*!< Linked list entry, must be first on list */
-    gui_linkedlistroot_t root;                      /*!< Linked list root entry for \ref gui_listview_item_t column data entries */
+    const gui_char** cells;                         /*!< Array of cell texts, one entry per column.
+                                                        Points right after row structure unless it was grown for columns added later */
+    uint16_t cell_count;                            /*!< Number of entries in cell texts array */
+    uint32_t order;                                 /*!< Number of row in order of adding, used when rows are not sorted */
+    uint8_t hidden;                                 /*!< Set to `1` when row is hidden by filter */
 } gui_listview_row_t;
 
 /**
@@ -69,15 +75,6 @@ typedef struct gui_listview_col {
     gui_char* text;                                 /*!< Header column text size */
 } gui_listview_col_t;
 
-/**
- * \ingroup         GUI_LISTVIEW
- * \brief           Listview string item object
- */
-typedef struct gui_listview_item {
-    gui_linkedlist_t list;                          /*!< Linked list entry, must always be first on list */
-    gui_char* text;                                 /*!< Text entry */
-} gui_listview_item_t;
-    
 /**
  * \ingroup         GUI_LISTVIEW
  * \brief           Listview object structure
@@ -90,10 +87,18 @@ typedef struct {
     uint16_t col_count;                             /*!< Number of columns in listview package */
 
     gui_widget_listdata_t ld;                       /*!< List data handle */
+    gui_listview_data_fn data_fn;                   /*!< Data source callback for virtual mode */
     int16_t selected;                               /*!< Selected text index */
     
     gui_dim_t sliderwidth;                          /*!< Slider width in units of pixels */
     uint8_t flags;                                  /*!< Widget flags */
+    
+    gui_linkedlistroot_t hidden;                    /*!< Rows hidden by filter, not part of list data */
+    gui_listview_filter_fn filter_fn;               /*!< Row filter callback, `NULL` when all rows are shown */
+    void* filter_arg;                               /*!< Custom argument for filter callback */
+    int16_t sort_col;                               /*!< Column rows are sorted by or `-1` to keep order of adding */
+    uint8_t sort_desc;                              /*!< Set to `1` for descending sort order */
+    uint32_t order;                                 /*!< Order number for next added row */
 } gui_listview_t;
 
 static uint8_t gui_listview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result);
@@ -126,22 +131,96 @@ gui_widget_t widget = {
 };
 
 /**
- * \brief           Get column value for specific row
- * \param[in]       h: Widget handle
+ * \brief           Check if row cells array is allocated together with row
+ * \param[in]       row: Row handle
+ * \return          `1` if cells follow row structure in the same memory block, `0` otherwise
+ */
+#define is_cells_inline(row)                ((row)->cells == (const gui_char **)((row) + 1))
+
+/**
+ * \brief           Get cell text of row
  * \param[in]       row: Row handle
  * \param[in]       c: Column index for row
- * \return          Item handle on success, `NULL` otherwise
+ * \return          Cell text, empty string if cell is not set
+ */
+static const gui_char*
+get_row_text(const gui_listview_row_t* row, int16_t c) {
+    if (c >= 0 && c < (int16_t)row->cell_count && row->cells[c] != NULL) {
+        return row->cells[c];
+    }
+    return _GT("");
+}
+
+/**
+ * \brief           Compare rows in current sort order
+ * \param[in]       r1: First row
+ * \param[in]       r2: Second row
+ * \param[in]       arg: Listview object
+ * \return          Negative, zero or positive value when first row is before, equal to or after second row
+ */
+static int
+compare_rows(const void* r1, const void* r2, void* arg) {
+    const gui_listview_row_t *a = r1, *b = r2;
+    gui_listview_t* o = arg;
+    int res = 0;
+    
+    if (o->sort_col >= 0) {
+        res = gui_string_compare(get_row_text(a, o->sort_col), get_row_text(b, o->sort_col));
+        if (o->sort_desc) {
+            res = -res;
+        }
+    }
+    if (res == 0) {                                 /* Equal rows stay in order of adding */
+        res = a->order < b->order ? -1 : (a->order > b->order);
+    }
+    return res;
+}
+
+/**
+ * \brief           Check if rows are shown in other order or subset than they were added
+ * \param[in]       o: Listview object
+ * \return          `1` if view is sorted or filtered, `0` otherwise
  */
-static gui_listview_item_t *
-get_item_for_row(gui_handle_p h, gui_listview_row_t* row, uint16_t c) {
+#define is_view_active(o)                   ((o)->sort_col >= 0 || (o)->filter_fn != NULL)
+
+/**
+ * \brief           Add row to shown rows at position of sort order or to hidden rows when filtered out
+ * \param[in]       h: Widget handle
+ * \param[in]       row: Row not on any list
+ */
+static void
+place_row(gui_handle_p h, gui_listview_row_t* row) {
     gui_listview_t* o = GUI_VP(h);
     
-    if (row == NULL || c >= o->col_count) {
-        return NULL;
+    row->hidden = o->filter_fn != NULL && !o->filter_fn(h, (gui_listview_row_p)row, o->filter_arg);
+    if (row->hidden) {
+        gui_linkedlist_add_gen(&o->hidden, &row->list);
+    } else if (is_view_active(o)) {
+        gui_widget_list_insert_item_sorted(h, &o->ld, row, compare_rows, o);
+    } else {
+        gui_widget_list_add_item(h, &o->ld, row);
     }
+}
+
+/**
+ * \brief           Get index of shown row
+ * \param[in]       o: Listview object
+ * \param[in]       row: Row to find
+ * \return          Row index or `-1` if row is not shown
+ */
+static int16_t
+find_row_index(gui_listview_t* o, gui_listview_row_t* row) {
+    gui_linkedlist_t* item;
+    int16_t i = 0;
     
-    /* Get item by index value = column number */
-    return (void *)gui_linkedlist_getnext_byindex_gen(&row->root, c);
+    if (row != NULL && !row->hidden) {
+        for (item = gui_linkedlist_getnext_gen(&o->ld.root, NULL); item != NULL; item = gui_linkedlist_getnext_gen(NULL, item), i++) {
+            if (item == &row->list) {
+                return i;
+            }
+        }
+    }
+    return -1;
 }
 
 /**
@@ -197,6 +276,57 @@ check_values(gui_handle_p h) {
     return 1;
 }
 
+/**
+ * \brief           Get cell text in virtual mode
+ * \param[in]       h: Widget handle
+ * \param[in]       row: Row index
+ * \param[in]       col: Column index
+ * \return          Cell text or `NULL` if cell is empty
+ */
+static const gui_char*
+get_virtual_text(gui_handle_p h, int16_t row, uint16_t col) {
+    gui_listview_t* o = GUI_VP(h);
+    
+#if GUI_CFG_USE_LISTMODEL
+    if (gui_widget_list_get_model(h, &o->ld) != NULL) {
+        return gui_listmodel_getstring(gui_widget_list_get_model(h, &o->ld), row, col);
+    }
+#endif /* GUI_CFG_USE_LISTMODEL */
+    return o->data_fn != NULL ? o->data_fn(h, row, col) : NULL;
+}
+
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+
+/**
+ * \brief           Model change callback, redraws only affected visible rows
+ * \param[in]       h: Widget handle
+ * \param[in]       change: Type of change
+ * \param[in]       index: Index of first changed row
+ * \param[in]       count: Number of changed rows
+ */
+static void
+model_changed(gui_handle_p h, gui_listmodel_change_t change, int16_t index, int16_t count) {
+    gui_listview_t* o = GUI_VP(h);
+    uint8_t slider = o->flags & GUI_FLAG_LISTVIEW_SLIDER_ON;
+    int16_t start = gui_widget_list_get_visible_start_index(h, &o->ld);
+    gui_dim_t itemheight = item_height(h, NULL);
+    
+    gui_widget_list_model_changed(h, &o->ld, &o->selected, change, index, count);
+    if (change == GUI_LISTMODEL_CHANGE_UPDATE) {
+        gui_widget_list_invalidate_items(h, &o->ld, index, count, 2 + itemheight, itemheight);  /* Rows start below header */
+    } else if (change == GUI_LISTMODEL_CHANGE_RESET || slider != (o->flags & GUI_FLAG_LISTVIEW_SLIDER_ON)
+        || start != gui_widget_list_get_visible_start_index(h, &o->ld)) {
+        gui_widget_invalidate(h);                   /* Rows moved on entire widget */
+    } else {
+        gui_widget_list_invalidate_items(h, &o->ld, index, -1, 2 + itemheight, itemheight);
+        if (slider) {                               /* Scrollbar shows number of rows */
+            gui_widget_invalidatearea(h, gui_widget_getwidth(h) - o->sliderwidth - 1, 0, o->sliderwidth + 1, gui_widget_getheight(h));
+        }
+    }
+}
+
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
+
 /**
  * \brief           Remove all rows from list view
  * \param[in]       h: Widget handle
@@ -206,11 +336,18 @@ check_values(gui_handle_p h) {
 static uint8_t
 remove_row(gui_handle_p h, void* item) {
     gui_listview_row_t* row = item;
-    gui_listview_item_t* col;
     
-    /* Remove row items (columns) first */
-    while ((col = (gui_listview_item_t *)gui_linkedlist_remove_gen(&row->root, (gui_linkedlist_t *)gui_linkedlist_getnext_gen(&row->root, NULL))) != NULL) {
-        GUI_MEMFREE(col);
+#if GUI_CFG_USE_STRING_INTERN
+    {
+        uint16_t i;
+        
+        for (i = 0; i < row->cell_count; i++) {
+            gui_intern_release(row->cells[i]);
+        }
+    }
+#endif /* GUI_CFG_USE_STRING_INTERN */
+    if (!is_cells_inline(row)) {                    /* Cells were grown to separate block */
+        GUI_MEMFREE(row->cells);
     }
     GUI_MEMFREE(item);                              /* Remove item itself */
     return 1;
@@ -228,13 +365,13 @@ static uint8_t
 gui_listview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result) {
     gui_listview_t* o = GUI_VP(h);
 #if GUI_CFG_USE_TOUCH
-    static gui_dim_t ty;
     static gui_listview_col_t* column_slide;
 #endif /* GUI_CFG_USE_TOUCH */
     
     switch (evt) {
         case GUI_EVT_PRE_INIT: {
             o->selected = -1;                       /* Invalidate selection */
+            o->sort_col = -1;                       /* Keep rows in order of adding */
             o->sliderwidth = 30;                    /* Set slider width */
             o->flags |= GUI_FLAG_LISTVIEW_SLIDER_AUTO;    /* Enable auto mode for slider */
 
@@ -249,7 +386,6 @@ gui_listview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
             gui_dim_t x, y, width, height, itemheight;
             uint16_t i;
             gui_listview_row_t* item;
-            gui_listview_item_t* col_item;
 
             x = gui_widget_getabsolutex(h);
             y = gui_widget_getabsolutey(h);
@@ -320,9 +456,16 @@ gui_listview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                         disp->y2 = y + height - 2;
                     }
                     
-                    /* Draw list items */
-                    for (item = gui_widget_list_get_first_visible_item(h, &o->ld, &index); item != NULL && f.y <= disp->y2;
-                            item = gui_widget_list_get_next_item(h, &o->ld, item), index++) {
+                    /*
+                     * Draw list items
+                     *
+                     * In virtual mode there are no stored rows,
+                     * text for visible cells is requested from data source or model instead
+                     */
+                    for (item = gui_widget_list_get_first_visible_item(h, &o->ld, &index);
+                            (item != NULL || o->ld.is_virtual) && index < gui_widget_list_get_count(h, &o->ld) && f.y <= disp->y2;
+                            item = item != NULL ? gui_widget_list_get_next_item(h, &o->ld, item) : NULL, index++) {
+                        const gui_char* text;
 
                         if (index == o->selected) {
                             gui_draw_filledrectangle(disp, x + 2, f.y, width - 2, GUI_MIN(f.height, itemheight), guii_widget_isfocused(h) ? guii_widget_getcolor(h, GUI_LISTVIEW_COLOR_SEL_FOC_BG) : guii_widget_getcolor(h, GUI_LISTVIEW_COLOR_SEL_NOFOC_BG));
@@ -331,13 +474,19 @@ gui_listview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                             f.color1 = guii_widget_getcolor(h, GUI_LISTVIEW_COLOR_TEXT);
                         }
                         xTmp = x + 2;
-                        for (i = 0, col_item = (gui_listview_item_t *)gui_linkedlist_getnext_gen(&item->root, NULL); col_item != NULL && i < o->col_count;
-                                col_item = (gui_listview_item_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)col_item), i++) {
-                            if (col_item->text != NULL) {   /* Draw if text set */
+                        for (i = 0; i < o->col_count && xTmp <= disp->x2; i++) {
+                            if (o->ld.is_virtual) {
+                                text = get_virtual_text(h, index, i);
+                            } else if (i < item->cell_count) {
+                                text = item->cells[i];
+                            } else {
+                                break;              /* No more columns for this row */
+                            }
+                            if (text != NULL) {     /* Draw if text set */
                                 f.width = o->cols[i]->width - 6;
                                 f.color1width = GUI.lcd.width;  /* Use the same color for entire width */
                                 f.x = xTmp + 3;     /* Set offset */
-                                gui_draw_writetext(disp, gui_widget_getfont(h), col_item->text, &f);
+                                gui_draw_writetext(disp, gui_widget_getfont(h), text, &f);
                             }
                             xTmp += o->cols[i]->width;  /* Increase X value */
                         }
@@ -350,9 +499,22 @@ gui_listview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
             
             return 1;
         }
+        case GUI_EVT_CLONE: {                       /* Widget copied from prototype */
+            GUI_EVT_RESULTTYPE_U8(result) = 0;      /* Items belong to prototype, widget cannot be copied */
+            return 1;
+        }
         case GUI_EVT_REMOVE: {
+#if GUI_CFG_USE_TOUCH
+            gui_widget_kinetic_stop(h, &o->ld.kinetic);
+#endif /* GUI_CFG_USE_TOUCH */
             /* Remove all rows */
+#if GUI_CFG_USE_LISTMODEL
+            guii_listmodel_detach(&o->ld.view);
+#endif /* GUI_CFG_USE_LISTMODEL */
             gui_widget_list_remove_items(h, &o->ld);
+            while (o->hidden.first != NULL) {
+                remove_row(h, gui_linkedlist_remove_gen(&o->hidden, o->hidden.first));
+            }
 
             /* Remove all columns */
             if (o->cols != NULL) {
@@ -370,7 +532,7 @@ gui_listview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
             guii_touch_data_t* ts = GUI_EVT_PARAMTYPE_TOUCH(param);  /* Get touch data */
             gui_dim_t height = item_height(h, NULL);    /* Get element height */
             
-            ty = ts->y_rel[0];                      /* Save Y position */
+            gui_widget_list_touchstart(h, &o->ld, height);  /* Start vertical slide */
             
             /* Check column slide */
             column_slide = NULL;
@@ -391,7 +553,6 @@ gui_listview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
         case GUI_EVT_TOUCHMOVE: {
             size_t i;
             guii_touch_data_t* ts = GUI_EVT_PARAMTYPE_TOUCH(param);  /* Get touch data */
-            gui_dim_t height = item_height(h, NULL);   /* Get element height */
             
             /* Horizontal slide */
             if (column_slide != NULL) {
@@ -415,18 +576,14 @@ gui_listview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
             
             /* Possible vertical slide? */
             if (column_slide == NULL) {
-                /*
-                 * Check slide vertical difference
-                 * and save current relative value in case of slide event
-                 */
-                if (GUI_ABS(ty - ts->y_rel[0]) > height) {
-                    gui_widget_list_slide(h, &o->ld, (ty - ts->y_rel[0]) > 0 ? 1 : -1);
-                    ty = ts->y_rel[0];
-                }
+                gui_widget_list_touchmove(h, &o->ld, ts);
             }
             return 1;
         }
         case GUI_EVT_TOUCHEND: {
+            if (column_slide == NULL) {
+                gui_widget_list_touchend(h, &o->ld);
+            }
             column_slide = NULL;
             return 1;
         }
@@ -470,8 +627,8 @@ gui_listview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                     }
                     sum += o->cols[i]->width;       /* Increase sum value */
                 }
-                if (i != o->col_count) {            /* We have value */
-                    //TODO: Sort rows on press
+                if (i != o->col_count && !o->ld.is_virtual) {   /* Sort by pressed column, toggle order on next press */
+                    gui_listview_sort(h, (int16_t)i, o->sort_col == (int16_t)i && !o->sort_desc);
                 }
                 handled = 1;
             }
@@ -599,9 +756,17 @@ gui_listview_addrow(gui_handle_p h) {
     
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
 
-    row = GUI_MEMALLOC(sizeof(*row));               /* Allocate memory for new row(s) */
+    if (o->ld.is_virtual) {                         /* Rows are not stored in virtual mode */
+        return NULL;
+    }
+    
+    /* Allocate row and its cells for existing columns in single block */
+    row = GUI_MEMALLOC(sizeof(*row) + sizeof(*row->cells) * o->col_count);
     if (row != NULL) {
-        gui_widget_list_add_item(h, &o->ld, row);
+        row->cells = (const gui_char **)(row + 1);
+        row->cell_count = o->col_count;
+        row->order = o->order++;
+        place_row(h, row);
     }
     
     return (gui_listview_row_p)row;
@@ -632,6 +797,9 @@ gui_listview_removerows(gui_handle_p h) {
     gui_listview_t* o = GUI_VP(h);
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
 
+    while (o->hidden.first != NULL) {
+        remove_row(h, gui_linkedlist_remove_gen(&o->hidden, o->hidden.first));
+    }
     return gui_widget_list_remove_items(h, &o->ld);
 }
 
@@ -640,38 +808,163 @@ gui_listview_removerows(gui_handle_p h) {
  * \param[in]       h: Widget handle
  * \param[in]       row: Row object handle, previously returned with \ref gui_listview_addrow function
  * \param[in]       col: Column number to set. First column is on `index = 0`
- * \param[in]       text: Text to use for item
+ * \param[in]       text: Text to use for item. Only pointer is saved to memory,
+ *                      unless \ref GUI_CFG_USE_STRING_INTERN is enabled
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
 gui_listview_setitemstring(gui_handle_p h, gui_listview_row_p row, uint16_t col, const gui_char* text) {
-    uint8_t ret = 0;
-    gui_listview_item_t* item = 0;
+    gui_listview_t* o = GUI_VP(h);
+    gui_listview_row_t* r = (gui_listview_row_t *)row;
+    uint8_t ret = 1;
     
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && row != NULL);
 
-    item = (gui_listview_item_t *)gui_linkedlist_getnext_gen(&((gui_listview_row_t *)row)->root, NULL); /* Get first in linked list */
-    col++;
-    while (col--) {                                 /* Find right column */
-        if (item == NULL) {
-            item = GUI_MEMALLOC(sizeof(*item));     /* Allocate for item */
-            if (item == NULL) {
-                break;
+    /* Grow cells array when column was added after row */
+    if (col >= r->cell_count) {
+        uint16_t count = GUI_MAX(col + 1, o->col_count);
+        const gui_char** cells = GUI_MEMALLOC(sizeof(*cells) * count);
+        
+        if (cells != NULL) {
+            memcpy(cells, r->cells, sizeof(*cells) * r->cell_count);
+            if (!is_cells_inline(r)) {
+                GUI_MEMFREE(r->cells);
             }
-            gui_linkedlist_add_gen(&((gui_listview_row_t *)row)->root, (gui_linkedlist_t *)item);   /* Add element to linked list */
-        }
-        if (col) {
-            item = (gui_listview_item_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)item);   /* Get next in linked list */
+            r->cells = cells;
+            r->cell_count = count;
+        } else {
+            ret = 0;
         }
     }
-    if (item != NULL) {
-        item->text = (gui_char *)text;              /* Set text to item */
-        ret = 1;
+#if GUI_CFG_USE_STRING_INTERN
+    if (ret && (text = gui_intern_get(text)) == NULL) { /* Use shared copy of text */
+        ret = 0;
+    }
+    if (ret) {
+        gui_intern_release(r->cells[col]);
+    }
+#endif /* GUI_CFG_USE_STRING_INTERN */
+    if (ret) {
+        r->cells[col] = text;                       /* Set text to cell */
+        
+        /* Move row to its new position in view */
+        if (o->filter_fn != NULL || o->sort_col == (int16_t)col) {
+            gui_listview_row_t* selected = gui_widget_list_get_item_byindex(h, &o->ld, o->selected);
+            
+            if (r->hidden) {
+                gui_linkedlist_remove_gen(&o->hidden, &r->list);
+            } else {
+                gui_widget_list_detach_item(h, &o->ld, r);
+            }
+            place_row(h, r);
+            gui_widget_list_move_selection(h, &o->ld, &o->selected, find_row_index(o, selected));
+            gui_widget_invalidate(h);
+        }
     }
 
     return ret;
 }
 
+/**
+ * \brief           Get cell text of row
+ * \param[in]       h: Widget handle
+ * \param[in]       row: Row object handle, previously returned with \ref gui_listview_addrow function
+ * \param[in]       col: Column number. First column is on `index = 0`
+ * \return          Cell text, empty string if cell is not set
+ */
+const gui_char*
+gui_listview_getrowtext(gui_handle_p h, gui_listview_row_p row, uint16_t col) {
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && row != NULL);
+    return get_row_text((gui_listview_row_t *)row, (int16_t)col);
+}
+
+/**
+ * \brief           Sort rows by column text
+ *
+ *                  Rows are relinked in place, texts are not copied.
+ *                  Rows added later and cells of sort column set later are inserted at position of sort order.
+ *                  Pressing column header sorts rows by that column too
+ *
+ * \note            Row indexes of other functions (selection, row removal, item value)
+ *                  refer to position of row in sorted and filtered view
+ * \note            Not available in virtual mode
+ * \param[in]       h: Widget handle
+ * \param[in]       col: Column index to sort rows by. Set to `-1` to show rows in order they were added
+ * \param[in]       desc: Set to `1` for descending order, `0` for ascending
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listview_sort(gui_handle_p h, int16_t col, uint8_t desc) {
+    gui_listview_t* o = GUI_VP(h);
+    gui_listview_row_t* selected;
+    uint8_t ret;
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && col < (int16_t)o->col_count);
+    
+    if (o->ld.is_virtual) {
+        return 0;
+    }
+    selected = gui_widget_list_get_item_byindex(h, &o->ld, o->selected);
+    o->sort_col = col >= 0 ? col : -1;
+    o->sort_desc = GUI_U8(!!desc);
+    ret = gui_widget_list_sort(h, &o->ld, compare_rows, o);
+    gui_widget_list_move_selection(h, &o->ld, &o->selected, find_row_index(o, selected));   /* Selected row stays selected */
+    return ret;
+}
+
+/**
+ * \brief           Show only rows accepted by filter callback
+ *
+ *                  Rows are moved between shown and hidden rows without copying texts.
+ *                  Call function again to apply filter after its criteria changed.
+ *                  Rows added later and rows with changed cells are checked with filter too
+ *
+ * \note            Not available in virtual mode
+ * \param[in]       h: Widget handle
+ * \param[in]       filter_fn: Filter callback. Set to `NULL` to show all rows
+ * \param[in]       arg: Custom argument passed to filter callback
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listview_setfilter(gui_handle_p h, gui_listview_filter_fn filter_fn, void* arg) {
+    gui_listview_t* o = GUI_VP(h);
+    gui_listview_row_t *row, *next, *selected;
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    
+    if (o->ld.is_virtual) {
+        return 0;
+    }
+    selected = gui_widget_list_get_item_byindex(h, &o->ld, o->selected);
+    o->filter_fn = filter_fn;
+    o->filter_arg = arg;
+    
+    /* Hide shown rows not accepted anymore */
+    for (row = (gui_listview_row_t *)gui_linkedlist_getnext_gen(&o->ld.root, NULL); row != NULL; row = next) {
+        next = (gui_listview_row_t *)gui_linkedlist_getnext_gen(NULL, &row->list);
+        if (filter_fn != NULL && !filter_fn(h, (gui_listview_row_p)row, arg)) {
+            gui_widget_list_detach_item(h, &o->ld, row);
+            row->hidden = 1;
+            gui_linkedlist_add_gen(&o->hidden, &row->list);
+        }
+    }
+    
+    /* Show hidden rows accepted now, sort once at the end */
+    for (row = (gui_listview_row_t *)o->hidden.first; row != NULL; row = next) {
+        next = (gui_listview_row_t *)gui_linkedlist_getnext_gen(NULL, &row->list);
+        if (filter_fn == NULL || filter_fn(h, (gui_listview_row_p)row, arg)) {
+            gui_linkedlist_remove_gen(&o->hidden, &row->list);
+            row->hidden = 0;
+            gui_widget_list_add_item(h, &o->ld, row);
+        }
+    }
+    gui_widget_list_sort(h, &o->ld, compare_rows, o);
+    gui_widget_list_set_visible_start_index(h, &o->ld, gui_widget_list_get_visible_start_index(h, &o->ld));
+    gui_widget_list_check_values(h, &o->ld);
+    gui_widget_list_move_selection(h, &o->ld, &o->selected, find_row_index(o, selected));
+    return 1;
+}
+
 /**
  * \brief           Scroll list if possible
  * \param[in]       h: Widget handle
@@ -704,6 +997,7 @@ gui_listview_setselection(gui_handle_p h, int16_t selection) {
 
 /**
  * \brief           Get selected row number
+ * \note            Selection is read without core protection and function may be called from any thread
  * \param[in]       h: Widget handle
  * \return          Selection number on success, -1 otherwise
  */
@@ -711,7 +1005,7 @@ int16_t
 gui_listview_getselection(gui_handle_p h) {
     gui_listview_t* o = GUI_VP(h);
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
-    return o->selected;
+    return gui_widget_list_get_selection(h, &o->ld);
 }
 
 /**
@@ -732,14 +1026,99 @@ gui_listview_getitemvalue(gui_handle_p h, int16_t rindex, uint16_t cindex, gui_c
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && dst != NULL && length > 1);
     
     *dst = 0;
-    row = gui_widget_list_get_item_byindex(h, &o->ld, rindex);
-    if (row != NULL) {
-        gui_listview_item_t* item = get_item_for_row(h, row, cindex);   /* Get item from column */
-        if (item != NULL) {                         /* In case of valid index */
-            gui_string_copyn(dst, item->text, length - 1);  /* Copy text to destination */
+    if (o->ld.is_virtual) {                         /* Virtual mode, ask data source or model */
+        if (rindex >= 0 && rindex < gui_widget_list_get_count(h, &o->ld) && cindex < o->col_count) {
+            const gui_char* text = get_virtual_text(h, rindex, cindex);
+            if (text != NULL) {
+                gui_string_copyn(dst, text, length - 1);
+            }
             ret = 1;
         }
+        return GUI_U8(ret);
+    }
+    row = gui_widget_list_get_item_byindex(h, &o->ld, rindex);
+    if (row != NULL && cindex < o->col_count && cindex < row->cell_count) {
+        if (row->cells[cindex] != NULL) {           /* In case of valid index */
+            gui_string_copyn(dst, row->cells[cindex], length - 1);  /* Copy text to destination */
+        }
+        ret = 1;
     }
 
     return GUI_U8(ret);
 }
+
+/**
+ * \brief           Switch list view to virtual mode with data source callback
+ *
+ *                  In virtual mode rows are not stored in widget. Text for each visible
+ *                  cell is requested from data source callback during redraw,
+ *                  which allows lists with thousands of rows in constant memory.
+ *
+ * \note            All rows added with \ref gui_listview_addrow are removed
+ * \param[in]       h: Widget handle
+ * \param[in]       data_fn: Data source callback function
+ * \param[in]       count: Number of rows in list
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listview_setdatasource(gui_handle_p h, gui_listview_data_fn data_fn, int16_t count) {
+    gui_listview_t* o = GUI_VP(h);
+
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && data_fn != NULL);
+
+#if GUI_CFG_USE_LISTMODEL
+    guii_listmodel_detach(&o->ld.view);             /* Data source replaces model */
+#endif /* GUI_CFG_USE_LISTMODEL */
+    o->data_fn = data_fn;
+    return gui_widget_list_set_virtual_count(h, &o->ld, count);
+}
+
+/**
+ * \brief           Set number of rows for list view in virtual mode
+ * \note            Data source must be set first with \ref gui_listview_setdatasource
+ * \param[in]       h: Widget handle
+ * \param[in]       count: Number of rows in list
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listview_setrowcount(gui_handle_p h, int16_t count) {
+    gui_listview_t* o = GUI_VP(h);
+
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && o->data_fn != NULL);
+
+    return gui_widget_list_set_virtual_count(h, &o->ld, count);
+}
+
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+
+/**
+ * \brief           Show rows of shared list model
+ *
+ *                  Model may be attached to several widgets at the same time.
+ *                  Each listview column shows model column with the same index,
+ *                  change of model redraws only affected visible rows.
+ *
+ * \note            All rows added with \ref gui_listview_addrow are removed and selection is cleared.
+ *                  Sort and filter are not available while model is attached
+ * \param[in]       h: Widget handle
+ * \param[in]       model: Model handle. Set to `NULL` to detach model
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_listview_setmodel(gui_handle_p h, gui_listmodel_p model) {
+    gui_listview_t* o = GUI_VP(h);
+
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+
+    if (model != NULL) {
+        o->data_fn = NULL;                          /* Model replaces data source */
+        while (o->hidden.first != NULL) {           /* Rows hidden by filter are removed too */
+            remove_row(h, gui_linkedlist_remove_gen(&o->hidden, o->hidden.first));
+        }
+    }
+    return gui_widget_list_set_model(h, &o->ld, &o->selected, model, model_changed);
+}
+
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
+
+#endif /* GUI_CFG_WIDGET_LISTVIEW || __DOXYGEN__ */
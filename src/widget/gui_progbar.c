@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "widget/gui_progbar.h"
 
+#if GUI_CFG_WIDGET_PROGBAR || __DOXYGEN__
+
 /**
  * \ingroup         GUI_PROGBAR
  * \name            GUI_PROGBAR_FLAGS
@@ -81,6 +83,21 @@ gui_color_t colors[] = {
     GUI_COLOR_BLACK,                                /*!< Default border color */
 };
 
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+/**
+ * \brief           Widget events processed by callback, other events are not delivered to widget
+ */
+static const gui_widget_evt_fn
+evt_table[GUI_EVT_COUNT] = {
+    [GUI_EVT_PRE_INIT] = gui_progbar_callback,
+    [GUI_EVT_SETPARAM] = gui_progbar_callback,
+    [GUI_EVT_DRAW] = gui_progbar_callback,
+    [GUI_EVT_SAVESTATE] = gui_progbar_callback,
+    [GUI_EVT_RESTORESTATE] = gui_progbar_callback,
+    [GUI_EVT_CLONE] = gui_progbar_callback,
+};
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
+
 /**
  * \brief           Widget initialization structure
  */
@@ -92,33 +109,106 @@ gui_widget_t widget = {
     .callback = gui_progbar_callback,               /*!< Callback function */
     .colors = colors,                               /*!< List of default colors */
     .color_count = GUI_COUNT_OF(colors),            /*!< Number of colors */
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+    .evt_table = evt_table,                         /*!< List of handled events */
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
 };
 
 #define is_anim(o)  ((((gui_progbar_t *)(o))->flags & GUI_FLAG_PROGBAR_ANIMATE) == GUI_FLAG_PROGBAR_ANIMATE)
 
+/* Get width of active part for value */
+static gui_dim_t
+get_active_width(gui_handle_p h, int32_t val) {
+    gui_progbar_t* o = GUI_VP(h);
+    return ((gui_widget_getwidth(h) - 4) * (val - o->min)) / (o->max - o->min);
+}
+
+/* Get percentage shown for value */
+static int32_t
+get_percent(gui_handle_p h, int32_t val) {
+    gui_progbar_t* o = GUI_VP(h);
+    return ((val - o->min) * 100) / (o->max - o->min);
+}
+
+/* Invalidate only part of widget changed when displayed value changes from old value to current one */
+static void
+invalidate_value(gui_handle_p h, int32_t old) {
+    gui_progbar_t* o = GUI_VP(h);
+    gui_dim_t w1, w2, width, height;
+    
+    width = gui_widget_getwidth(h);
+    height = gui_widget_getheight(h);
+    w1 = get_active_width(h, old);
+    w2 = get_active_width(h, o->currentvalue);
+    
+    /* Span between old and new end of active part, text color changes one pixel before it */
+    if (w1 != w2) {
+        gui_dim_t start = GUI_MIN(w1, w2);
+        gui_widget_invalidatearea(h, 1 + start, 2, GUI_ABS(w2 - w1) + 1, height - 4);
+    }
+    
+    /* Centered percentage text, font size is upper bound for glyph advance of digits and percent sign */
+    if ((o->flags & GUI_FLAG_PROGBAR_PERCENT) && h->font != NULL
+        && get_percent(h, old) != get_percent(h, o->currentvalue)) {
+        const gui_font_t* font = gui_widget_getfont(h);
+        gui_dim_t tw, th;
+        
+        tw = GUI_MIN(width - 4, 4 * (gui_dim_t)font->size);
+        th = GUI_MIN(height - 4, (gui_dim_t)font->size);
+        gui_widget_invalidatearea(h, (width - tw) / 2, (height - th) / 2, tw, th);
+    }
+}
+
+#if GUI_CFG_USE_ANIM
+#define ANIM_TIME_PER_UNIT  10                      /*!< Animation time for value change of `1` in units of milliseconds */
+
+/* Set displayed value, called by animation engine */
+static uint8_t
+set_current(gui_handle_p h, int32_t val) {
+    gui_progbar_t* o = GUI_VP(h);
+    if (o->currentvalue != val) {
+        int32_t old = o->currentvalue;
+        o->currentvalue = val;
+        invalidate_value(h, old);
+    }
+    return 1;
+}
+#endif /* GUI_CFG_USE_ANIM */
+
 /* Set value for widget */
 static uint8_t
 set_value(gui_handle_p h, int32_t val) {
     gui_progbar_t* o = GUI_VP(h);
     if (o->desiredvalue != val) {                   /* Value has changed */
+        int32_t old;
+        
         o->desiredvalue = val;                      /* Set value */
         if (o->currentvalue < o->min) {
             o->currentvalue = o->min;
         } else if (o->currentvalue > o->max) {
             o->currentvalue = o->max;
         }
-        if (is_anim(h) && h->timer != NULL) {       /* In case of animation and timer availability */
-            guii_timer_start(h->timer);             /* Start timer */
+        old = o->currentvalue;
+#if GUI_CFG_USE_ANIM
+        if (!is_anim(h) || !gui_anim_startvalue(h, set_current, o->currentvalue, o->desiredvalue,
+                ANIM_TIME_PER_UNIT * GUI_ABS(o->desiredvalue - o->currentvalue), GUI_ANIM_EASE_LINEAR)) {
+            o->currentvalue = o->desiredvalue;      /* Set values to the same */
+        }
+#else /* GUI_CFG_USE_ANIM */
+        if (is_anim(h) && guii_widget_getextvalue(h, timer) != NULL) {  /* In case of animation and timer availability */
+            guii_timer_start(guii_widget_getext(h)->timer); /* Start timer */
         } else {
             o->currentvalue = o->desiredvalue;      /* Set values to the same */
         }
-        gui_widget_invalidate(h);
+#endif /* !GUI_CFG_USE_ANIM */
+        invalidate_value(h, old);                   /* Animation invalidates later steps */
         guii_widget_callback(h, GUI_EVT_VALUECHANGED, NULL, NULL);  /* Process callback */
         return 1;
     }
     return 0;
 }
 
+#if !GUI_CFG_USE_ANIM
 /* Timer callback for widget */
 static void
 timer_callback(gui_timer_t* t) {
@@ -126,16 +216,18 @@ timer_callback(gui_timer_t* t) {
     gui_progbar_t* o = GUI_VP(h);
     if (h != NULL) {
         if (o->currentvalue != o->desiredvalue) {   /* Check difference */
+            int32_t old = o->currentvalue;
             if (o->currentvalue > o->desiredvalue) {
                 o->currentvalue--;
             } else {
                 o->currentvalue++;
             }
-            gui_widget_invalidate(h);
+            invalidate_value(h, old);
             guii_timer_start(t);
         }
     }
 }
+#endif /* !GUI_CFG_USE_ANIM */
 
 /**
  * \brief           Default widget callback function
@@ -159,13 +251,15 @@ gui_progbar_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* cons
         case GUI_EVT_SETPARAM: {
             gui_widget_param* v = GUI_EVT_PARAMTYPE_WIDGETPARAM(param);
             int32_t tmp;
+            uint8_t changed = 1;
             switch (v->type) {
                 case CFG_VALUE:
                     set_value(h, *(int32_t *)v->data);
                     break;
                 case CFG_MAX:
                     tmp = *(int32_t *)v->data;
-                    if (tmp > o->min) {
+                    changed = tmp != o->max;
+                    if (changed && tmp > o->min) {
                         o->max = tmp;
                         if (o->desiredvalue > o->max || o->currentvalue > o->max) {
                             set_value(h, tmp);
@@ -174,7 +268,8 @@ gui_progbar_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* cons
                     break;
                 case CFG_MIN:
                     tmp = *(int32_t *)v->data;
-                    if (tmp < o->max) {
+                    changed = tmp != o->min;
+                    if (changed && tmp < o->max) {
                         o->min = tmp;
                         if (o->desiredvalue < o->min || o->currentvalue < o->min) {
                             set_value(h, tmp);
@@ -182,6 +277,7 @@ gui_progbar_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* cons
                     }
                     break;
                 case CFG_PERCENT:
+                    changed = !(o->flags & GUI_FLAG_PROGBAR_PERCENT) != !*(uint8_t *)v->data;
                     if (*(uint8_t *)v->data) {
                         o->flags |= GUI_FLAG_PROGBAR_PERCENT;
                     } else {
@@ -189,24 +285,35 @@ gui_progbar_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* cons
                     }
                     break;
                 case CFG_ANIM:
+                    changed = !(o->flags & GUI_FLAG_PROGBAR_ANIMATE) != !*(uint8_t *)v->data;
+#if GUI_CFG_USE_ANIM
+                    if (*(uint8_t *)v->data) {
+                        o->flags |= GUI_FLAG_PROGBAR_ANIMATE;   /* Enable animations */
+                    } else {
+                        o->flags &= ~GUI_FLAG_PROGBAR_ANIMATE;  /* Disable animation */
+                        gui_anim_stop(h, GUI_ANIM_PROP_VALUE, 1);   /* Jump to desired value */
+                    }
+#else /* GUI_CFG_USE_ANIM */
                     if (*(uint8_t *)v->data) {
-                        if (h->timer == NULL) {
-                            h->timer = guii_timer_create(10, timer_callback, h);    /* Create animation timer */
+                        gui_handle_ext_t* e = guii_widget_ext(h);
+                        if (e != NULL && e->timer == NULL) {
+                            e->timer = guii_timer_create(10, timer_callback, h);    /* Create animation timer */
                         }
-                        if (h->timer != NULL) { /* Check timer response */
+                        if (e != NULL && e->timer != NULL) {    /* Check timer response */
                             o->flags |= GUI_FLAG_PROGBAR_ANIMATE;   /* Enable animations */
                         }
                     } else {
                         o->flags &= ~GUI_FLAG_PROGBAR_ANIMATE;  /* Disable animation */
-                        if (h->timer != NULL) {
-                            guii_timer_remove(&h->timer);   /* Remove timer */
+                        if (guii_widget_getextvalue(h, timer) != NULL) {
+                            guii_timer_remove(&guii_widget_getext(h)->timer);   /* Remove timer */
                         }
                         set_value(h, o->desiredvalue);  /* Reset value */
                     }
+#endif /* !GUI_CFG_USE_ANIM */
                     break;
                 default: break;
             }
-            GUI_EVT_RESULTTYPE_U8(result) = 1;      /* Save result */
+            GUI_EVT_RESULTTYPE_U8(result) = changed;/* Save result, skip invalidation when unchanged */
             break;
         }
         case GUI_EVT_DRAW: {
@@ -218,7 +325,7 @@ gui_progbar_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* cons
             width = gui_widget_getwidth(h);
             height = gui_widget_getheight(h);
            
-            w = ((width - 4) * (o->currentvalue - o->min)) / (o->max - o->min); /* Get width for active part */
+            w = get_active_width(h, o->currentvalue);   /* Get width for active part */
             
             gui_draw_filledrectangle(disp, x + w + 2, y + 2, width - w - 4, height - 4, guii_widget_getcolor(h, GUI_PROGBAR_COLOR_BG));
             gui_draw_filledrectangle(disp, x + 2, y + 2, w, height - 4, guii_widget_getcolor(h, GUI_PROGBAR_COLOR_FG));
@@ -230,7 +337,7 @@ gui_progbar_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* cons
                 gui_char buff[5];
                 
                 if (o->flags & GUI_FLAG_PROGBAR_PERCENT) {
-                    sprintf((char *)buff, "%lu%%", (unsigned long)(((o->currentvalue - o->min) * 100) / (o->max - o->min)));
+                    sprintf((char *)buff, "%lu%%", (unsigned long)get_percent(h, o->currentvalue));
                     text = buff;
                 } else if (gui_widget_isfontandtextset(h)) {
                     text = gui_widget_gettext(h);
@@ -253,6 +360,32 @@ gui_progbar_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* cons
             }
             break;
         }
+        case GUI_EVT_SAVESTATE: {                   /* Save values to screen snapshot */
+            GUI_EVT_RESULTTYPE_U8(result) = guii_widget_savestate(GUI_EVT_PARAMTYPE_WIDGETPARAM(param),
+                &o->min, sizeof(*o) - offsetof(gui_progbar_t, min));
+            return 1;
+        }
+        case GUI_EVT_RESTORESTATE: {                /* Restore values from screen snapshot */
+            GUI_EVT_RESULTTYPE_U8(result) = guii_widget_restorestate(GUI_EVT_PARAMTYPE_WIDGETPARAM(param),
+                &o->min, sizeof(*o) - offsetof(gui_progbar_t, min));
+            o->currentvalue = o->desiredvalue;      /* Animation is not restored */
+            return 1;
+        }
+        case GUI_EVT_CLONE: {                       /* Widget copied from prototype */
+            o->currentvalue = o->desiredvalue;      /* Animation is not copied */
+#if !GUI_CFG_USE_ANIM
+            if (o->flags & GUI_FLAG_PROGBAR_ANIMATE) {
+                gui_handle_ext_t* e = guii_widget_ext(h);
+                if (e != NULL) {
+                    e->timer = guii_timer_create(10, timer_callback, h);    /* Each widget has its own timer */
+                }
+                if (e == NULL || e->timer == NULL) {
+                    o->flags &= ~GUI_FLAG_PROGBAR_ANIMATE;
+                }
+            }
+#endif /* !GUI_CFG_USE_ANIM */
+            return 1;
+        }
         default:                                    /* Handle default option */
             GUI_UNUSED3(h, param, result);          /* Unused elements to prevent compiler warnings */
             return 0;                               /* Command was not processed */
@@ -298,7 +431,7 @@ gui_progbar_setcolor(gui_handle_p h, gui_progbar_color_t index, gui_color_t colo
 uint8_t
 gui_progbar_setvalue(gui_handle_p h, int32_t val) {
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
-    return guii_widget_setparam(h, CFG_VALUE, &val, 1, 0);
+    return guii_widget_setparam(h, CFG_VALUE, &val, 0, 0);  /* Only changed part is invalidated */
 }
 
 /**
@@ -384,3 +517,5 @@ gui_progbar_getvalue(gui_handle_p h) {
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
     return o->desiredvalue;
 }
+
+#endif /* GUI_CFG_WIDGET_PROGBAR || __DOXYGEN__ */
@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "widget/gui_radio.h"
 
+#if GUI_CFG_WIDGET_RADIO || __DOXYGEN__
+
 /**
  * \ingroup         GUI_RADIO
  * \name            GUI_RADIO_FLAGS
@@ -56,6 +58,7 @@
 typedef struct {
     gui_handle C;                                   /*!< GUI handle object, must always be first on list */
     
+    gui_radio_group_t* group;                       /*!< Attached group object or `NULL` to use group ID */
     uint8_t group_id;                               /*!< Group ID for radio box */
     uint32_t value;                                 /*!< Single radio value when selected */
     uint32_t selected_value;                        /*!< Currently selected value in radio group. 
@@ -65,6 +68,19 @@ typedef struct {
 
 static uint8_t gui_radio_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result);
 
+/**
+ * \brief           Radio box look, used as sprite key
+ */
+typedef struct {
+    const gui_widget_t* type;                       /*!< Widget type, keeps sprites of different widgets apart */
+    gui_color_t bg;                                 /*!< Background color of circle */
+    gui_color_t border;                             /*!< Border color of circle */
+    gui_color_t fg;                                 /*!< Color of selection dot and focus circle */
+    gui_dim_t size;                                 /*!< Circle size */
+    uint8_t checked;                                /*!< Set to `1` when selection dot is drawn */
+    uint8_t focused;                                /*!< Set to `1` when focus circle is drawn */
+} gui_radio_sprite_t;
+
 /**
  * \brief           List of default color in the same order of widget color enumeration
  */
@@ -77,6 +93,21 @@ gui_color_t colors[] = {
     GUI_COLOR_BLACK,                                /*!< Text color index */
 };
 
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+/**
+ * \brief           Widget events processed by callback, other events are not delivered to widget
+ */
+static const gui_widget_evt_fn
+evt_table[GUI_EVT_COUNT] = {
+    [GUI_EVT_DRAW] = gui_radio_callback,
+    [GUI_EVT_CLICK] = gui_radio_callback,
+    [GUI_EVT_SAVESTATE] = gui_radio_callback,
+    [GUI_EVT_RESTORESTATE] = gui_radio_callback,
+    [GUI_EVT_CLONE] = gui_radio_callback,
+    [GUI_EVT_REMOVE] = gui_radio_callback,
+};
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
+
 /**
  * \brief           Widget initialization structure
  */
@@ -88,8 +119,33 @@ gui_widget_t widget = {
     .callback = gui_radio_callback,                 /*!< Callback function */
     .colors = colors,                               /*!< List of default colors */
     .color_count = GUI_COUNT_OF(colors),            /*!< Number of colors */
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+    .evt_table = evt_table,                         /*!< List of handled events */
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
 };
 
+/**
+ * \brief           Set checked widget of group object, previously checked widget is unchecked
+ * \param[in]       group: Group object
+ * \param[in]       h: Widget handle to set as checked
+ */
+static void
+group_select(gui_radio_group_t* group, gui_handle_p h) {
+    gui_handle_p prev = group->selected;
+    
+    if (prev != NULL && prev != h) {
+        ((gui_radio_t *)GUI_VP(prev))->flags &= ~GUI_FLAG_RADIO_CHECKED;   /* Clear flag */
+        gui_widget_invalidate(prev);
+    }
+    group->selected = h;
+    group->selected_value = ((gui_radio_t *)GUI_VP(h))->value;
+}
+
+/**
+ * \brief           Set radio as checked widget of its group
+ * \param[in]       h: Widget handle
+ * \return          `1` on success, `0` otherwise
+ */
 static uint8_t
 set_active(gui_handle_p h) {
     gui_handle_p handle;
@@ -100,21 +156,24 @@ set_active(gui_handle_p h) {
         return 0;
     }
     
-    /*
-     * Find radio widgets on the same page
-     * and with the same group ID as widget to be set as active
-     */
-    for (handle = gui_linkedlist_widgetgetnext(guii_widget_getparent(h), NULL); handle != NULL; 
-            handle = gui_linkedlist_widgetgetnext(NULL, handle)) {
-       
-        o_handle = GUI_VP(handle);
-                
-        /* Check if widget is radio box and group is the same as clicked widget */
-        if (handle != h && handle->widget == &widget && o_handle->group_id == o->group_id) {
-            o_handle->selected_value = o->value;  /* Set selected value for widget */
-            if (o_handle->flags & GUI_FLAG_RADIO_CHECKED) { /* Check if widget active */
-                o_handle->flags &= ~GUI_FLAG_RADIO_CHECKED; /* Clear flag */
-                gui_widget_invalidate(handle);
+    if (o->group != NULL) {                         /* Group object knows checked widget */
+        group_select(o->group, h);
+    } else {
+        /*
+         * Find radio widgets on the same page
+         * and with the same group ID as widget to be set as active
+         */
+        for (handle = gui_linkedlist_widgetgetnext(guii_widget_getparent(h), NULL); handle != NULL; 
+                handle = gui_linkedlist_widgetgetnext(NULL, handle)) {
+            o_handle = GUI_VP(handle);
+            
+            /* Check if widget is radio box and group is the same as clicked widget */
+            if (handle != h && handle->widget == &widget && o_handle->group == NULL && o_handle->group_id == o->group_id) {
+                o_handle->selected_value = o->value;    /* Set selected value for widget */
+                if (o_handle->flags & GUI_FLAG_RADIO_CHECKED) { /* Check if widget active */
+                    o_handle->flags &= ~GUI_FLAG_RADIO_CHECKED; /* Clear flag */
+                    gui_widget_invalidate(handle);
+                }
             }
         }
     }
@@ -145,6 +204,30 @@ set_disabled(gui_handle_p h, uint8_t state) {
     return 0;
 }
 
+/**
+ * \brief           Draw radio circle without text
+ * \param[in]       disp: Clipping region
+ * \param[in]       sx: Top left X position of circle box
+ * \param[in]       sy: Top left Y position of circle box
+ * \param[in]       key: Radio look, \ref gui_radio_sprite_t structure
+ */
+static void
+radio_draw(const gui_display_t* disp, gui_dim_t sx, gui_dim_t sy, const void* key) {
+    const gui_radio_sprite_t* rb = key;
+    gui_dim_t size = rb->size;
+    
+    gui_draw_filledcircle(disp, sx + size / 2, sy + size / 2, size / 2, rb->bg);
+    gui_draw_circle(disp, sx + size / 2, sy + size / 2, size / 2, rb->border);
+    
+    if (rb->focused) {                              /* When in focus */
+        gui_draw_circle(disp, sx + size / 2, sy + size / 2, size / 2 - 2, rb->fg);
+    }
+
+    if (rb->checked) {
+        gui_draw_filledcircle(disp, sx + size / 2, sy + size / 2, size / 2 - 5, rb->fg);
+    }
+}
+
 /**
  * \brief           Default widget callback function
  * \param[in]       h: Widget handle
@@ -160,6 +243,7 @@ gui_radio_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
     switch (evt) {
         case GUI_EVT_DRAW: {
             gui_display_t* disp = GUI_EVT_PARAMTYPE_DISP(param);
+            gui_radio_sprite_t sprite;
             gui_color_t c1;
             gui_dim_t x, y, width, height, size, sx, sy;
             
@@ -179,16 +263,17 @@ gui_radio_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
                 c1 = guii_widget_getcolor(h, GUI_RADIO_COLOR_BG);
             }
             
-            gui_draw_filledcircle(disp, sx + size / 2, sy + size / 2, size / 2, c1);
-            gui_draw_circle(disp, sx + size / 2, sy + size / 2, size / 2, guii_widget_getcolor(h, GUI_RADIO_COLOR_BORDER));
-            
-            if (guii_widget_isfocused(h) && !(o->flags & GUI_FLAG_RADIO_DISABLED)) {  /* When in focus */
-                gui_draw_circle(disp, sx + size / 2, sy + size / 2, size / 2 - 2, guii_widget_getcolor(h, GUI_RADIO_COLOR_FG));
-            }
-
-            if (o->flags & GUI_FLAG_RADIO_CHECKED) {
-                gui_draw_filledcircle(disp, sx + size / 2, sy + size / 2, size / 2 - 5, guii_widget_getcolor(h, GUI_RADIO_COLOR_FG));
+            memset(&sprite, 0x00, sizeof(sprite));  /* Key is compared including padding */
+            sprite.type = &widget;
+            sprite.bg = c1;
+            sprite.border = guii_widget_getcolor(h, GUI_RADIO_COLOR_BORDER);
+            sprite.size = size;
+            sprite.checked = !!(o->flags & GUI_FLAG_RADIO_CHECKED);
+            sprite.focused = guii_widget_isfocused(h) && !(o->flags & GUI_FLAG_RADIO_DISABLED);
+            if (sprite.checked || sprite.focused) {
+                sprite.fg = guii_widget_getcolor(h, GUI_RADIO_COLOR_FG);
             }
+            guii_draw_sprite(disp, sx, sy, size + 1, size + 1, &sprite, sizeof(sprite), radio_draw);
             
             /* Draw text if possible */
             if (gui_widget_isfontandtextset(h)) {
@@ -202,6 +287,7 @@ gui_radio_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
                 f.align = GUI_HALIGN_LEFT | GUI_VALIGN_CENTER;
                 f.color1width = f.width;
                 f.color1 = guii_widget_getcolor(h, GUI_RADIO_COLOR_TEXT);
+                f.layout = guii_widget_gettextlayout(h); /* Reuse layout of widget text */
                 gui_draw_writetext(disp, gui_widget_getfont(h), gui_widget_gettext(h), &f);
             }
             
@@ -214,6 +300,46 @@ gui_radio_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
             }
             return 1;
         }
+        case GUI_EVT_SAVESTATE: {                   /* Save values to screen snapshot */
+            GUI_EVT_RESULTTYPE_U8(result) = guii_widget_savestate(GUI_EVT_PARAMTYPE_WIDGETPARAM(param),
+                &o->group_id, sizeof(*o) - offsetof(gui_radio_t, group_id));
+            return 1;
+        }
+        case GUI_EVT_RESTORESTATE: {                /* Restore values from screen snapshot */
+            GUI_EVT_RESULTTYPE_U8(result) = guii_widget_restorestate(GUI_EVT_PARAMTYPE_WIDGETPARAM(param),
+                &o->group_id, sizeof(*o) - offsetof(gui_radio_t, group_id));
+            if (o->group != NULL && (o->flags & GUI_FLAG_RADIO_CHECKED)) {
+                o->group->selected = h;             /* Restored checked widget is checked in group */
+                o->group->selected_value = o->value;
+            }
+            return 1;
+        }
+        case GUI_EVT_CLONE: {                       /* Widget copied from prototype */
+            if (o->group != NULL) {
+                o->flags &= ~GUI_FLAG_RADIO_CHECKED;/* Group object keeps prototype as checked widget */
+            } else if (o->flags & GUI_FLAG_RADIO_CHECKED) {
+                gui_handle_p handle;
+                gui_radio_t* o_handle;
+
+                /* Only one widget of group on the same page can be checked */
+                for (handle = gui_linkedlist_widgetgetnext(guii_widget_getparent(h), NULL); handle != NULL;
+                        handle = gui_linkedlist_widgetgetnext(NULL, handle)) {
+                    o_handle = GUI_VP(handle);
+                    if (handle->widget == &widget && o_handle->group == NULL && o_handle->group_id == o->group_id
+                        && (o_handle->flags & GUI_FLAG_RADIO_CHECKED)) {
+                        o->flags &= ~GUI_FLAG_RADIO_CHECKED;
+                        break;
+                    }
+                }
+            }
+            return 1;
+        }
+        case GUI_EVT_REMOVE: {                      /* When widget is about to be removed */
+            if (o->group != NULL && o->group->selected == h) {
+                o->group->selected = NULL;          /* Group must not point to removed widget */
+            }
+            return 1;
+        }
         default:                                    /* Handle default option */
             GUI_UNUSED3(h, param, result);          /* Unused elements to prevent compiler warnings */
             return 0;                               /* Command was not processed */
@@ -254,6 +380,7 @@ gui_radio_setcolor(gui_handle_p h, gui_radio_color_t index, gui_color_t color) {
 /**
  * \brief           Set radio group for widget
  * \note            Radio widgets with the same group must be on the same parent widget
+ * \note            Group ID is not used while group object is attached with \ref gui_radio_attachgroup
  * \param[in]       h: Widget handle
  * \param[in]       groupId: Group ID for widget
  * \return          `1` on success, `0` otherwise
@@ -277,7 +404,7 @@ gui_radio_setgroup(gui_handle_p h, uint8_t groupId) {
                 handle = gui_linkedlist_widgetgetnext(NULL, handle)) {
             o_handle = GUI_VP(handle);
             /* Check if widget is radio box and group is the same as input group */
-            if (handle != h && __GH(o_handle)->widget == &widget && o_handle->group_id == groupId) {
+            if (handle != h && __GH(o_handle)->widget == &widget && o_handle->group == NULL && o_handle->group_id == groupId) {
                 o->selected_value = o_handle->selected_value;   /* Set selected value for widget */
                 break;          
             }
@@ -355,9 +482,52 @@ uint32_t
 gui_radio_getselectedvalue(gui_handle_p h) {
     gui_radio_t* o = GUI_VP(h);
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    if (o->group != NULL) {
+        return o->group->selected_value;
+    }
     return o->selected_value;
 }
 
+/**
+ * \brief           Attach radio widget to group object
+ *
+ *                  Widgets attached to the same group may be on different parent widgets.
+ *                  When checked widget is attached, previously checked widget of group is unchecked
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       group: Group object, initialized to zero before first use.
+ *                      Set to `NULL` to detach widget and use group ID again
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_radio_attachgroup(gui_handle_p h, gui_radio_group_t* group) {
+    gui_radio_t* o = GUI_VP(h);
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+
+    if (o->group == group) {
+        return 1;
+    }
+    if (o->group != NULL && o->group->selected == h) {
+        o->group->selected = NULL;                  /* Widget is not part of previous group anymore */
+    }
+    o->group = group;
+    if (group != NULL && (o->flags & GUI_FLAG_RADIO_CHECKED)) {
+        group_select(group, h);                     /* Checked widget becomes checked widget of group */
+    }
+    return 1;
+}
+
+/**
+ * \brief           Get checked radio widget of group
+ * \param[in]       group: Group object
+ * \return          Checked widget handle or `NULL` if none is checked
+ */
+gui_handle_p
+gui_radio_group_getselected(const gui_radio_group_t* group) {
+    GUI_ASSERTPARAMS(group != NULL);
+    return group->selected;
+}
+
 /**
  * \brief           Disable widget to prevent state change
  * \param[in]       h: Widget handle
@@ -381,3 +551,5 @@ gui_radio_isdisabled(gui_handle_p h) {
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
     return (o->flags & GUI_FLAG_RADIO_DISABLED) == GUI_FLAG_RADIO_DISABLED;
 }
+
+#endif /* GUI_CFG_WIDGET_RADIO || __DOXYGEN__ */
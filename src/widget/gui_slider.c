@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "widget/gui_slider.h"
 
+#if GUI_CFG_WIDGET_SLIDER || __DOXYGEN__
+
 /**
  * \ingroup         GUI_SLIDER
  * \brief           Slider object structure
@@ -51,6 +53,9 @@ typedef struct {
     uint8_t current_size;                           /*!< Current size for animation */
     
     uint8_t flags;                                  /*!< Widget flags */
+    
+    gui_seqlock_t seq;                              /*!< Sequence counter of published values */
+    int32_t shared[2][3];                           /*!< Copies of `min`, `max` and `value` for readers in other threads */
 } gui_slider_t;
 
 #define CFG_MODE            0x01
@@ -93,6 +98,57 @@ get_delta(gui_handle_p h, gui_dim_t wi, gui_dim_t he) {
     return wi > he ? he : wi;
 }
 
+/* Get offset of value position from start of slider bar */
+static gui_dim_t
+get_offset(gui_handle_p h, int32_t value) {
+    gui_slider_t* o = GUI_VP(h);
+    gui_dim_t width, height, delta;
+    
+    width = gui_widget_getwidth(h);
+    height = gui_widget_getheight(h);
+    delta = get_delta(h, width, height);
+    if (is_horizontal(h)) {                         /* Horizontal slider */
+        width -= delta;
+        if (o->mode == GUI_SLIDER_MODE_RIGHT_LEFT) {/* Right left version */
+            return width - (gui_dim_t)(((float)(width) * (float)(value - o->min)) / (float)(o->max - o->min));
+        }
+        return (gui_dim_t)(((float)(width) * (float)(value - o->min)) / (float)(o->max - o->min));
+    }
+    height -= delta;                                /* Vertical slider */
+    if (o->mode == GUI_SLIDER_MODE_BOTTOM_TOP) {    /* Bottom top version */
+        return height - (gui_dim_t)(((float)(height) * (float)value) / (float)(o->max - o->min));
+    }
+    return (gui_dim_t)(((float)(height) * (float)value) / (float)(o->max - o->min));
+}
+
+/* Invalidate only span of slider between old and new position of value circle */
+static void
+invalidate_value(gui_handle_p h, int32_t old) {
+    gui_slider_t* o = GUI_VP(h);
+    gui_dim_t o1, o2, start, length;
+    
+    o1 = get_offset(h, old);
+    o2 = get_offset(h, o->value);
+    if (o1 == o2) {
+        return;
+    }
+    
+    /* Circle is centered at offset from half of delta and has radius up to half of delta */
+    start = GUI_MIN(o1, o2) - 1;
+    length = GUI_ABS(o2 - o1) + get_delta(h, gui_widget_getwidth(h), gui_widget_getheight(h)) + 2;
+    if (is_horizontal(h)) {
+        gui_widget_invalidatearea(h, start, 0, length, gui_widget_getheight(h));
+    } else {
+        gui_widget_invalidatearea(h, 0, start, gui_widget_getwidth(h), length);
+    }
+}
+
+/* Size of values shared with other threads */
+#define SHARED_LEN              (offsetof(gui_slider_t, mode) - offsetof(gui_slider_t, min))
+
+/* Publish current range and value to getters */
+#define publish(o)              guii_seqlock_write(&(o)->seq, (o)->shared, &(o)->min, SHARED_LEN)
+
 /* Set slider value */
 static uint8_t 
 set_value(gui_handle_p h, int32_t value) {
@@ -103,7 +159,10 @@ set_value(gui_handle_p h, int32_t value) {
         value = o->min;
     }
     if (value != o->value) {                        /* Check difference in values */
+        int32_t old = o->value;
         o->value = value;                           /* Set new value */
+        publish(o);
+        invalidate_value(h, old);                   /* Redraw only changed part */
         guii_widget_callback(h, GUI_EVT_VALUECHANGED, NULL, NULL);  /* Callback process */
         return 1;
     }
@@ -155,8 +214,7 @@ touch_handle(gui_handle_p h, guii_touch_data_t* ts) {
         value = (int32_t)(((float)(o->max - o->min)) * (float)pos / (float)height) + o->min;
     }
     
-    gui_widget_invalidate(h);                       /* Redraw widget */
-    return set_value(h, value);                     /* Set new value */
+    return set_value(h, value);                     /* Set new value, changed part is redrawn */
 }
 
 /* Timer callback function for slider widget */
@@ -199,11 +257,14 @@ gui_slider_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
             o->min = 0;                             /* Set default minimal value */
             o->max = 100;                           /* Set default maximal value */
             o->value = 50;                          /* Set default value */
+            publish(o);
             
             o->max_size = 4;
             o->current_size = 0;
-            h->timer = guii_timer_create(30, timer_callback, o);    /* Create timer for widget, when widget is deleted, timer will be automatically deleted too */
-            if (h->timer == NULL) {                 /* Check if timer created */
+            if (guii_widget_hasext(h, 1)) {         /* Timer is kept in optional widget data */
+                guii_widget_getext(h)->timer = guii_timer_create(30, timer_callback, o);    /* Create timer for widget, when widget is deleted, timer will be automatically deleted too */
+            }
+            if (guii_widget_getextvalue(h, timer) == NULL) {    /* Check if timer created */
                 GUI_EVT_RESULTTYPE_U8(result) = 0;   /* Failed, widget will be deleted */
             }
             return 1;
@@ -211,8 +272,10 @@ gui_slider_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
         case GUI_EVT_SETPARAM: {                     /* Set parameter for widget */
             gui_widget_param* v = GUI_EVT_PARAMTYPE_WIDGETPARAM(param);
             int32_t tmp;
+            uint8_t changed = 1;
             switch (v->type) {
                 case CFG_MODE:                      /* Set current progress value */
+                    changed = o->mode != *(gui_slider_mode_t *)v->data;
                     o->mode = *(gui_slider_mode_t *)v->data;
                     break;
                 case CFG_VALUE:                     /* Set current progress value */
@@ -220,25 +283,31 @@ gui_slider_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
                     break;
                 case CFG_MAX:                       /* Set maximal value */
                     tmp = *(int32_t *)v->data;
-                    if (tmp > o->min) {
+                    changed = tmp != o->max;
+                    if (changed && tmp > o->min) {
                         o->max = tmp;
                         if (o->value > o->max) {
                             set_value(h, tmp);
+                        } else {
+                            publish(o);
                         }
                     }
                     break;
                 case CFG_MIN:                       /* Set minimal value */
                     tmp = *(int32_t *)v->data;
-                    if (tmp < o->max) {
+                    changed = tmp != o->min;
+                    if (changed && tmp < o->max) {
                         o->min = tmp;
                         if (o->value < o->min) {
                             set_value(h, tmp);
+                        } else {
+                            publish(o);
                         }
                     }
                     break;
                 default: break;
             }
-            GUI_EVT_RESULTTYPE_U8(result) = 1;   /* Save result */
+            GUI_EVT_RESULTTYPE_U8(result) = changed;/* Save result, skip invalidation when unchanged */
             return 1;
         }
         case GUI_EVT_DRAW: {
@@ -271,14 +340,9 @@ gui_slider_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
             circleSize = (deltaH >> 2) + o->current_size * (deltaH - (deltaH >> 2)) / o->max_size;    /* Get circle size */
             
             /* Draw bottom rectangle */
+            offset = get_offset(h, o->value);       /* Get value position */
             if (is_horizontal(h)) {                 /* Horizontal slider */
-                offset = 0;                         /* Make start offset */
                 width -= delta;
-                if (o->mode == GUI_SLIDER_MODE_RIGHT_LEFT) {/* Right left version */
-                    offset = width - (gui_dim_t)(((float)(width) * (float)(o->value - o->min)) / (float)(o->max - o->min));
-                } else {                            /* Left right version */
-                    offset = (gui_dim_t)(((float)(width) * (float)(o->value - o->min)) / (float)(o->max - o->min));
-                }
                 x += deltaH;
                 gui_draw_filledroundedrectangle(disp, x, y + ((delta - recParam) >> 1), offset, recParam, (recParam >> 1), c1);   
                 gui_draw_filledroundedrectangle(disp, x + offset, y + ((delta - recParam) >> 1), width - offset, recParam, (recParam >> 1), c2);
@@ -286,13 +350,7 @@ gui_slider_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
                 gui_draw_filledcircle(disp, x + offset, y + deltaH, circleSize, guii_widget_getcolor(h, GUI_SLIDER_COLOR_FG));
                 gui_draw_circle(disp, x + offset, y + deltaH, circleSize, guii_widget_getcolor(h, GUI_SLIDER_COLOR_BORDER));
             } else {                                /* Vertical slider */
-                offset = 0;                         /* Make start offset */
                 height -= delta;
-                if (o->mode == GUI_SLIDER_MODE_BOTTOM_TOP) {    /* Bottom top version */
-                    offset = height - (gui_dim_t)(((float)(height) * (float)o->value) / (float)(o->max - o->min));
-                } else {                            /* Top bottom version */
-                    offset = (gui_dim_t)(((float)(height) * (float)o->value) / (float)(o->max - o->min));
-                }
                 y += deltaH;
                 gui_draw_filledroundedrectangle(disp, x + ((delta - recParam) >> 1), y, recParam, offset, (recParam >> 1), c1);   
                 gui_draw_filledroundedrectangle(disp, x + ((delta - recParam) >> 1), y + offset, recParam, height - offset, (recParam >> 1), c2);
@@ -318,13 +376,34 @@ gui_slider_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
             return 1;
 #endif /* GUI_CFG_USE_TOUCH */
         case GUI_EVT_ACTIVEIN: {
-            guii_timer_startperiodic(h->timer);     /* Start animation timer */
+            guii_timer_startperiodic(guii_widget_getext(h)->timer); /* Start animation timer */
             return 1;
         }
         case GUI_EVT_ACTIVEOUT: {
             gui_widget_invalidate(h);               /* Invalidate widget */
             return 1;
         }
+        case GUI_EVT_SAVESTATE: {                   /* Save values to screen snapshot */
+            GUI_EVT_RESULTTYPE_U8(result) = guii_widget_savestate(GUI_EVT_PARAMTYPE_WIDGETPARAM(param),
+                &o->min, offsetof(gui_slider_t, max_size) - offsetof(gui_slider_t, min));
+            return 1;
+        }
+        case GUI_EVT_RESTORESTATE: {                /* Restore values from screen snapshot */
+            GUI_EVT_RESULTTYPE_U8(result) = guii_widget_restorestate(GUI_EVT_PARAMTYPE_WIDGETPARAM(param),
+                &o->min, offsetof(gui_slider_t, max_size) - offsetof(gui_slider_t, min));
+            publish(o);
+            return 1;
+        }
+        case GUI_EVT_CLONE: {                       /* Widget copied from prototype */
+            o->current_size = 0;
+            if (guii_widget_hasext(h, 1)) {         /* Each widget has its own timer */
+                guii_widget_getext(h)->timer = guii_timer_create(30, timer_callback, o);
+            }
+            if (guii_widget_getextvalue(h, timer) == NULL) {
+                GUI_EVT_RESULTTYPE_U8(result) = 0;   /* Failed, copy will be deleted */
+            }
+            return 1;
+        }
         default:                                    /* Handle default option */
             GUI_UNUSED3(h, param, result);          /* Unused elements to prevent compiler warnings */
             return 0;                               /* Command was not processed */
@@ -382,7 +461,7 @@ gui_slider_setmode(gui_handle_p h, gui_slider_mode_t mode) {
 uint8_t
 gui_slider_setvalue(gui_handle_p h, int32_t val) {
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
-    return guii_widget_setparam(h, CFG_VALUE, &val, 1, 0);
+    return guii_widget_setparam(h, CFG_VALUE, &val, 0, 0);  /* Only changed part is invalidated */
 }
 
 /**
@@ -409,38 +488,72 @@ gui_slider_setmax(gui_handle_p h, int32_t val) {
     return guii_widget_setparam(h, CFG_MAX, &val, 1, 0);
 }
 
+/**
+ * \brief           Get slider range and current value at once
+ * \note            Values are read without core protection and function may be called from any thread.
+ *                  Returned values always belong to the same widget state
+ * \param[in]       h: Widget handle
+ * \param[out]      min: Pointer to save minimal value to. Set to `NULL` if not used
+ * \param[out]      max: Pointer to save maximal value to. Set to `NULL` if not used
+ * \param[out]      value: Pointer to save current value to. Set to `NULL` if not used
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_slider_getstate(gui_handle_p h, int32_t* min, int32_t* max, int32_t* value) {
+    gui_slider_t* o = GUI_VP(h);
+    int32_t v[3];
+
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    guii_seqlock_read(&o->seq, o->shared, v, SHARED_LEN);
+    if (min != NULL) {
+        *min = v[0];
+    }
+    if (max != NULL) {
+        *max = v[1];
+    }
+    if (value != NULL) {
+        *value = v[2];
+    }
+    return 1;
+}
+
 /**
  * \brief           Get slider minimal value
+ * \note            Function may be called from any thread, see \ref gui_slider_getstate
  * \param[in]       h: Widget handle
  * \return          Minimal value 
  */
 int32_t
 gui_slider_getmin(gui_handle_p h) {
-    gui_slider_t* o = GUI_VP(h);
-    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
-    return o->min;
+    int32_t val = 0;
+    gui_slider_getstate(h, &val, NULL, NULL);
+    return val;
 }
 
 /**
  * \brief           Get slider maximal value
+ * \note            Function may be called from any thread, see \ref gui_slider_getstate
  * \param[in]       h: Widget handle
  * \return          Maximal value  
  */
 int32_t
 gui_slider_getmax(gui_handle_p h) {
-    gui_slider_t* o = GUI_VP(h);
-    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
-    return o->max;
+    int32_t val = 0;
+    gui_slider_getstate(h, NULL, &val, NULL);
+    return val;
 }
 
 /**
  * \brief           Get slider current value
+ * \note            Function may be called from any thread, see \ref gui_slider_getstate
  * \param[in]       h: Widget handle
  * \return          Current value 
  */
 int32_t
 gui_slider_getvalue(gui_handle_p h) {
-    gui_slider_t* o = GUI_VP(h);
-    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
-    return o->value;
+    int32_t val = 0;
+    gui_slider_getstate(h, NULL, NULL, &val);
+    return val;
 }
+
+#endif /* GUI_CFG_WIDGET_SLIDER || __DOXYGEN__ */
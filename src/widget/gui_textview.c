@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "widget/gui_textview.h"
 
+#if GUI_CFG_WIDGET_TEXTVIEW || __DOXYGEN__
+
 /**
  * \ingroup         GUI_TEXTVIEW
  * \brief           Textview object structure
@@ -45,6 +47,11 @@ typedef struct {
     gui_textalign_valign_t valign;                  /*!< Vertical text align */
     gui_textalign_halign_t halign;                  /*!< Horizontal text align */
     uint8_t flags;                                  /*!< Widget flags */
+#if GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN || __DOXYGEN__
+    int32_t number;                                 /*!< Shown number value */
+    gui_string_numberformat_t number_fmt;           /*!< Format of shown number */
+    gui_char number_text[GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN + 1];   /*!< Formatted number used as widget text */
+#endif /* GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN || __DOXYGEN__ */
 } gui_textview_t;
 
 #define CFG_VALIGN          0x01
@@ -61,6 +68,20 @@ gui_color_t colors[] = {
     GUI_COLOR_WIN_TEXT,                             /*!< Default text color */
 };
 
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+/**
+ * \brief           Widget events processed by callback, other events are not delivered to widget
+ */
+static const gui_widget_evt_fn
+evt_table[GUI_EVT_COUNT] = {
+    [GUI_EVT_PRE_INIT] = gui_textview_callback,
+    [GUI_EVT_SETPARAM] = gui_textview_callback,
+    [GUI_EVT_DRAW] = gui_textview_callback,
+    [GUI_EVT_KEYPRESS] = gui_textview_callback,
+    [GUI_EVT_CLICK] = gui_textview_callback,
+};
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
+
 /**
  * \brief           Widget initialization structure
  */
@@ -72,6 +93,9 @@ gui_widget_t widget = {
     .callback = gui_textview_callback,              /*!< Callback function */
     .colors = colors,                               /*!< List of default colors */
     .color_count = GUI_COUNT_OF(colors),            /*!< Define number of colors */
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+    .evt_table = evt_table,                         /*!< List of handled events */
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
 };
 #define o                   ((gui_textview_t *)(h))
 
@@ -92,16 +116,19 @@ gui_textview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
         }
         case GUI_EVT_SETPARAM: {                     /* Set parameter for widget */
             gui_widget_param* p = GUI_EVT_PARAMTYPE_WIDGETPARAM(param);
+            uint8_t changed = 1;
             switch (p->type) {
                 case CFG_HALIGN: 
+                    changed = o->halign != *(gui_textalign_halign_t *)p->data;
                     o->halign = *(gui_textalign_halign_t *)p->data;
                     break;
                 case CFG_VALIGN: 
+                    changed = o->valign != *(gui_textalign_valign_t *)p->data;
                     o->valign = *(gui_textalign_valign_t *)p->data;
                     break;
                 default: break;
             }
-            GUI_EVT_RESULTTYPE_U8(result) = 1;   /* Save result */
+            GUI_EVT_RESULTTYPE_U8(result) = changed;/* Save result, skip invalidation when unchanged */
             return 1;
         }
         case GUI_EVT_DRAW: {
@@ -133,6 +160,7 @@ gui_textview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                 f.flags |= GUI_FLAG_TEXT_MULTILINE; /* Enable multiline */
                 f.color1width = f.width;
                 f.color1 = guii_widget_getcolor(h, GUI_TEXTVIEW_COLOR_TEXT);
+                f.layout = guii_widget_gettextlayout(h); /* Reuse layout of widget text */
                 gui_draw_writetext(disp, gui_widget_getfont(h), gui_widget_gettext(h), &f);
             }
             return 1;
@@ -215,3 +243,184 @@ gui_textview_sethalign(gui_handle_p h, gui_textalign_halign_t align) {
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
     return guii_widget_setparam(h, CFG_HALIGN, &align, 1, 1);   /* Set parameter */
 }
+
+#if GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN || __DOXYGEN__
+
+#define o                   ((gui_textview_t *)(h))
+
+/**
+ * \brief           Skip spaces at the beginning of line, they are not drawn in multi-line mode
+ * \param[in]       str: Input string
+ * \return          Pointer to first non-space character
+ */
+static const gui_char *
+number_skipspaces(const gui_char* str) {
+    while (*str == ' ') {
+        str++;
+    }
+    return str;
+}
+
+/**
+ * \brief           Invalidate part of widget with characters changed between old and new number text
+ *
+ *                  When both strings have the same width, such as digits of monospace font,
+ *                  text does not move and only changed character cells are redrawn.
+ *                  Complete widget is invalidated otherwise
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       old: Currently shown text
+ * \param[in]       str: New text
+ */
+static void
+number_invalidate(gui_handle_p h, const gui_char* old, const gui_char* str) {
+    const gui_font_t* font;
+    const gui_font_char_t* c;
+    uint32_t co[GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN], cn[GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN];
+    gui_dim_t po[GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN + 1], pn[GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN + 1];
+    gui_dim_t wi, x, x1 = 0, x2 = 0;
+    gui_string_t s;
+    size_t no, nn, i;
+    uint8_t changed = 0;
+    
+    font = gui_widget_getfont(h);
+    old = number_skipspaces(old);
+    str = number_skipspaces(str);
+    if (font == NULL || font->advance64 != NULL) {  /* Characters do not start at integer pixel positions */
+        gui_widget_invalidate(h);
+        return;
+    }
+    gui_string_prepare(&s, old);
+    no = gui_string_getchars(&s, co, GUI_COUNT_OF(co));
+    gui_string_prepare(&s, str);
+    nn = gui_string_getchars(&s, cn, GUI_COUNT_OF(cn));
+    wi = gui_widget_getinnerwidth(h);
+    if (no != nn || gui_text_getprefixwidths(font, old, po, no) != no
+        || gui_text_getprefixwidths(font, str, pn, nn) != nn
+        || po[no] != pn[nn] || pn[nn] >= wi) {      /* Text moves or does not fit to single line */
+        gui_widget_invalidate(h);
+        return;
+    }
+    for (i = 0; i < nn; i++) {
+        if (cn[i] == '\n' || cn[i] == '\r' || co[i] == '\n' || co[i] == '\r') {
+            gui_widget_invalidate(h);
+            return;
+        }
+        if (co[i] == cn[i] && po[i] == pn[i]) {     /* Character did not change */
+            continue;
+        }
+        if (!changed) {                             /* First changed character */
+            x1 = GUI_MIN(po[i], pn[i]);
+            changed = 1;
+        }
+        x2 = GUI_MAX(x2, GUI_MAX(po[i + 1], pn[i + 1]));
+        if ((c = gui_text_getchardesc(font, co[i])) != NULL) {  /* Glyph may be wider than advance */
+            x2 = GUI_MAX(x2, po[i] + c->x_size);
+        }
+        if ((c = gui_text_getchardesc(font, cn[i])) != NULL) {
+            x2 = GUI_MAX(x2, pn[i] + c->x_size);
+        }
+    }
+    if (!changed) {
+        return;
+    }
+    
+    x = gui_widget_getpaddingleft(h);              /* Start of text, the same as in draw event */
+    if (o->halign == GUI_TEXTVIEW_HALIGN_CENTER) {
+        x += (wi - pn[nn]) / 2;
+    } else if (o->halign == GUI_TEXTVIEW_HALIGN_RIGHT) {
+        x += wi - pn[nn];
+    }
+    gui_widget_invalidatearea(h, x + x1 - 1, 0, x2 - x1 + 2, gui_widget_getheight(h));  /* One pixel more for LCD fringes */
+}
+
+/**
+ * \brief           Format number and set it as widget text
+ * \param[in]       h: Widget handle
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+number_update(gui_handle_p h) {
+    gui_char str[GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN + 1];
+    
+    if (!gui_string_fromnumber(str, GUI_COUNT_OF(str), o->number, &o->number_fmt)) {
+        return 0;
+    }
+    if (h->text != o->number_text) {                /* Number mode is not active yet */
+        if (guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC)) {
+            gui_widget_freetextmemory(h);           /* Text is now in widget memory */
+        }
+        gui_string_copy(o->number_text, str);
+        return gui_widget_settext(h, o->number_text);
+    }
+    if (!gui_string_compare(str, o->number_text)) { /* Nothing to redraw */
+        return 1;
+    }
+    
+    number_invalidate(h, o->number_text, str);
+    gui_string_copy(o->number_text, str);
+    guii_widget_invalidatetextlayout(h);            /* Content changed with the same pointer */
+#if GUI_CFG_USE_TRANSLATE
+    h->text_translated = h->text;                   /* Numbers are never translated */
+    h->text_translate_version = GUI.translate.version;
+#endif /* GUI_CFG_USE_TRANSLATE */
+    guii_widget_callback(h, GUI_EVT_TEXTCHANGED, NULL, NULL);
+    return 1;
+}
+
+/**
+ * \brief           Show number as widget text
+ *
+ *                  Number is formatted with integer arithmetic to memory inside widget,
+ *                  no memory is allocated and widget is not redrawn when text does not change.
+ *                  When width of text is the same as before, for example with digits of equal width,
+ *                  only changed characters are redrawn
+ *
+ * \note            Available only when \ref GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN is enabled
+ * \param[in]       h: Widget handle
+ * \param[in]       value: Integer value or fixed-point value according to number format
+ * \return          `1` on success, `0` otherwise
+ * \sa              gui_textview_setnumberformat
+ */
+uint8_t
+gui_textview_setnumber(gui_handle_p h, int32_t value) {
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    
+    if (o->number == value && h->text == o->number_text) {
+        return 1;
+    }
+    o->number = value;
+    return number_update(h);
+}
+
+/**
+ * \brief           Set format of number shown with \ref gui_textview_setnumber
+ * \note            Suffix string is not copied and must stay valid while it is used
+ * \param[in]       h: Widget handle
+ * \param[in]       fmt: Number format
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_textview_setnumberformat(gui_handle_p h, const gui_string_numberformat_t* fmt) {
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && fmt != NULL);
+    
+    memcpy(&o->number_fmt, fmt, sizeof(o->number_fmt));
+    return number_update(h);
+}
+
+/**
+ * \brief           Get number shown with \ref gui_textview_setnumber
+ * \param[in]       h: Widget handle
+ * \return          Last number value
+ */
+int32_t
+gui_textview_getnumber(gui_handle_p h) {
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    return o->number;
+}
+
+#undef o
+
+#endif /* GUI_CFG_WIDGET_TEXTVIEW_NUMBER_LEN || __DOXYGEN__ */
+
+#endif /* GUI_CFG_WIDGET_TEXTVIEW || __DOXYGEN__ */
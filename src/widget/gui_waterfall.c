@@ -0,0 +1,446 @@
+/**	
+ * \file            gui_waterfall.c
+ * \brief           Waterfall widget
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "widget/gui_waterfall.h"
+
+
+#if GUI_CFG_WIDGET_WATERFALL || __DOXYGEN__
+
+/**
+ * \ingroup         GUI_WATERFALL
+ * \brief           Row of values passed to widget
+ */
+typedef struct {
+    const uint8_t* values;                          /*!< Values used as index to color table */
+    size_t count;                                   /*!< Number of values */
+} gui_waterfall_row_t;
+
+/**
+ * \ingroup         GUI_WATERFALL
+ * \brief           Waterfall object structure
+ */
+typedef struct {
+    gui_handle C;                                   /*!< GUI handle object, must always be first on list */
+    
+    const gui_color_t* lut;                         /*!< Color table with `256` entries set by user, `NULL` for default one */
+    gui_layer_t* buff;                              /*!< Ring buffer of rows in pixel format of LCD, color table follows rows */
+    uint8_t* lut_px;                                /*!< Color table converted to pixel format of LCD */
+    gui_dim_t head;                                 /*!< Buffer row with newest values, drawn on top */
+    gui_dim_t rows;                                 /*!< Number of rows with values */
+} gui_waterfall_t;
+
+#define CFG_ROW             0x01
+#define CFG_LUT             0x02
+#define CFG_CLEAR           0x03
+
+static uint8_t gui_waterfall_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result);
+
+/**
+ * \brief           List of default color in the same order of widget color enumeration
+ */
+static const
+gui_color_t colors[] = {
+    GUI_COLOR_BLACK,                                /*!< Default background color */
+};
+
+/**
+ * \brief           Colors of default color table, values are spread evenly between them
+ */
+static const
+gui_color_t lut_stops[] = {
+    GUI_COLOR_BLACK,
+    0xFF0000FF,
+    0xFFFF0000,
+    0xFFFFFF00,
+    GUI_COLOR_WHITE,
+};
+
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+/**
+ * \brief           Widget events processed by callback, other events are not delivered to widget
+ */
+static const gui_widget_evt_fn
+evt_table[GUI_EVT_COUNT] = {
+    [GUI_EVT_SETPARAM] = gui_waterfall_callback,
+    [GUI_EVT_DRAW] = gui_waterfall_callback,
+    [GUI_EVT_CLONE] = gui_waterfall_callback,
+    [GUI_EVT_REMOVE] = gui_waterfall_callback,
+};
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
+
+/**
+ * \brief           Widget initialization structure
+ */
+static const
+gui_widget_t widget = {
+    .name = _GT("WATERFALL"),                       /*!< Widget name */
+    .size = sizeof(gui_waterfall_t),                /*!< Size of widget for memory allocation */
+    .flags = GUI_FLAG_WIDGET_OPAQUE,                /*!< List of widget flags */
+    .callback = gui_waterfall_callback,             /*!< Callback function */
+    .colors = colors,                               /*!< List of default colors */
+    .color_count = GUI_COUNT_OF(colors),            /*!< Number of colors */
+#if GUI_CFG_USE_WIDGET_EVT_TABLE
+    .evt_table = evt_table,                         /*!< List of handled events */
+#endif /* GUI_CFG_USE_WIDGET_EVT_TABLE */
+};
+
+/**
+ * \brief           Convert color table to pixel format of row buffer
+ * \param[in]       h: Widget handle
+ */
+static void
+build_lut(gui_handle_p h) {
+    gui_waterfall_t* o = GUI_VP(h);
+    gui_color_t c;
+    uint32_t pos;
+    size_t i, s;
+    
+    for (i = 0; i < 256; i++) {
+        if (o->lut != NULL) {
+            c = o->lut[i];
+        } else {
+            pos = (uint32_t)i * (GUI_COUNT_OF(lut_stops) - 1);
+            s = pos / 255;
+            c = s < GUI_COUNT_OF(lut_stops) - 1
+                ? 0xFF000000UL | guii_blend_color(lut_stops[s + 1], lut_stops[s], GUI_U8(pos % 255)) : lut_stops[s];
+        }
+        if (o->buff->pixel_format == GUI_PIXEL_FORMAT_RGB565) {
+            ((uint16_t *)o->lut_px)[i] = GUI_COLOR_TO_RGB565(c);
+        } else {
+            ((uint32_t *)o->lut_px)[i] = c;
+        }
+    }
+}
+
+/**
+ * \brief           Free row buffer of widget
+ * \param[in]       h: Widget handle
+ */
+static void
+free_buffer(gui_handle_p h) {
+    gui_waterfall_t* o = GUI_VP(h);
+    
+    if (o->buff != NULL) {
+        gui_lcd_fence();                            /* Rows may still be copied by queued low-level operation */
+        GUI_MEMFREE(o->buff);
+        o->buff = NULL;
+    }
+    o->head = o->rows = 0;
+}
+
+/**
+ * \brief           Get row buffer of widget size, allocate it if necessary
+ * \param[in]       h: Widget handle
+ * \return          Layer with rows on success, `NULL` otherwise
+ */
+static gui_layer_t *
+get_buffer(gui_handle_p h) {
+    gui_waterfall_t* o = GUI_VP(h);
+    gui_dim_t wi = gui_widget_getwidth(h), hi = gui_widget_getheight(h);
+    gui_layer_t* layer = o->buff;
+    size_t px;
+    
+    if (layer != NULL && (layer->width != wi || layer->height != hi)) {
+        free_buffer(h);                             /* Widget size changed, old rows are dropped */
+        layer = NULL;
+    }
+    if (layer == NULL) {
+        if (wi <= 0 || hi <= 0) {
+            return NULL;
+        }
+        px = (size_t)wi * (size_t)hi * (size_t)GUI.lcd.pixel_size;
+        layer = GUI_MEMALLOC_CLASS(sizeof(*layer) + px + 256 * (size_t)GUI.lcd.pixel_size, GUI_MEM_CLASS_PIXEL);
+        if (layer == NULL) {
+            return NULL;
+        }
+        memset(layer, 0x00, sizeof(*layer));
+        layer->width = wi;
+        layer->height = hi;
+        layer->start_address = ((uint8_t *)layer) + sizeof(*layer);
+        layer->pixel_format = GUI.lcd.layers[0].pixel_format;
+        o->buff = layer;
+        o->lut_px = ((uint8_t *)layer->start_address) + px;
+        o->head = o->rows = 0;
+        build_lut(h);
+    }
+    return layer;
+}
+
+/**
+ * \brief           Get value for column, maximum of all values mapped to it
+ * \param[in]       row: Row of values
+ * \param[in]       x: Column index
+ * \param[in]       width: Number of columns
+ * \return          Value of column
+ */
+static uint8_t
+get_value(const gui_waterfall_row_t* row, size_t x, size_t width) {
+    size_t i = x * row->count / width, end = (x + 1) * row->count / width;
+    uint8_t v = row->values[i];
+    
+    for (i++; i < end; i++) {                       /* More values than columns, keep peaks visible */
+        v = GUI_MAX(v, row->values[i]);
+    }
+    return v;
+}
+
+/**
+ * \brief           Convert row of values to pixels and place it on top
+ * \param[in]       h: Widget handle
+ * \param[in]       row: Row of values
+ */
+static void
+add_row(gui_handle_p h, const gui_waterfall_row_t* row) {
+    gui_waterfall_t* o = GUI_VP(h);
+    gui_layer_t* layer;
+    size_t x, width;
+    void* dst;
+    
+    if ((layer = get_buffer(h)) == NULL) {
+        return;
+    }
+    width = (size_t)layer->width;
+    o->head = o->head ? o->head - 1 : layer->height - 1;    /* Oldest row is replaced */
+    if (o->rows < layer->height) {
+        o->rows++;
+    }
+    dst = ((uint8_t *)layer->start_address) + (size_t)o->head * width * (size_t)GUI.lcd.pixel_size;
+    
+    gui_lcd_fence();                                /* Row may still be copied by queued low-level operation */
+    if (layer->pixel_format == GUI_PIXEL_FORMAT_RGB565) {
+        for (x = 0; x < width; x++) {
+            ((uint16_t *)dst)[x] = ((const uint16_t *)o->lut_px)[get_value(row, x, width)];
+        }
+    } else {
+        for (x = 0; x < width; x++) {
+            ((uint32_t *)dst)[x] = ((const uint32_t *)o->lut_px)[get_value(row, x, width)];
+        }
+    }
+}
+
+/**
+ * \brief           Copy consecutive buffer rows to drawing layer
+ * \param[in]       disp: Display clipping region
+ * \param[in]       layer: Row buffer
+ * \param[in]       x: Absolute X position of widget
+ * \param[in]       y: Absolute Y position of first row
+ * \param[in]       row: First buffer row to copy
+ * \param[in]       count: Number of rows to copy
+ */
+static void
+copy_rows(const gui_display_t* disp, gui_layer_t* layer, gui_dim_t x, gui_dim_t y, gui_dim_t row, gui_dim_t count) {
+    gui_layer_t* drawing = GUI.lcd.drawing_layer;
+    gui_dim_t x1, y1, x2, y2;
+    
+    layer->x_pos = x;                               /* Place buffer so that row is at requested position */
+    layer->y_pos = y - row;
+    x1 = GUI_MAX(disp->x1, x);
+    y1 = GUI_MAX(disp->y1, y);
+    x2 = GUI_MIN(disp->x2, x + layer->width);
+    y2 = GUI_MIN(disp->y2, y + count);
+    if (x2 > x1 && y2 > y1) {
+        GUI_LL(Copy)(&GUI.lcd, drawing,
+            (void *)(((uint8_t *)drawing->start_address) + GUI.lcd.pixel_size * ((y1 - drawing->y_pos) * drawing->width + (x1 - drawing->x_pos))),
+            (void *)(((uint8_t *)layer->start_address) + GUI.lcd.pixel_size * ((y1 - layer->y_pos) * layer->width + (x1 - layer->x_pos))),
+            x2 - x1,                                /* Area width */
+            y2 - y1,                                /* Area height */
+            drawing->width - (x2 - x1),             /* Offline destination */
+            layer->width - (x2 - x1)                /* Offline source */
+        );
+    }
+}
+
+/**
+ * \brief           Default widget callback function
+ * \param[in]       h: Widget handle
+ * \param[in]       evt: Event type
+ * \param[in]       param: Input parameters for callback type
+ * \param[out]      result: Result for callback type
+ * \return          `1` if command processed, `0` otherwise
+ */
+static uint8_t
+gui_waterfall_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result) {
+    gui_waterfall_t* o = GUI_VP(h);
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    switch (evt) {
+        case GUI_EVT_SETPARAM: {
+            gui_widget_param* v = GUI_EVT_PARAMTYPE_WIDGETPARAM(param);
+            switch (v->type) {
+                case CFG_ROW:
+                    add_row(h, (const gui_waterfall_row_t *)v->data);
+                    break;
+                case CFG_LUT:
+                    o->lut = *(const gui_color_t **)v->data;
+                    if (o->buff != NULL) {
+                        build_lut(h);               /* Rows already in buffer keep their colors */
+                    }
+                    break;
+                case CFG_CLEAR:
+                    o->rows = 0;
+                    break;
+                default: break;
+            }
+            GUI_EVT_RESULTTYPE_U8(result) = 1;      /* Save result */
+            break;
+        }
+        case GUI_EVT_DRAW: {
+            gui_display_t* disp = GUI_EVT_PARAMTYPE_DISP(param);
+            gui_dim_t x, y, wi, hi, n = 0, first;
+            gui_layer_t* layer = o->buff;
+            
+            x = gui_widget_getabsolutex(h);         /* Get absolute position on screen */
+            y = gui_widget_getabsolutey(h);         /* Get absolute position on screen */
+            wi = gui_widget_getwidth(h);
+            hi = gui_widget_getheight(h);
+            
+            if (layer != NULL && (layer->width != wi || layer->height != hi)) {
+                free_buffer(h);                     /* Rows do not match new size */
+                layer = NULL;
+            }
+            if (layer != NULL && o->rows > 0) {
+#if GUI_CFG_USE_DISPLAY_LIST
+                guii_draw_list_cancel();            /* Copy is not recorded to display list */
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+                
+                /* Newest rows from head to end of buffer, older rows continue from buffer start */
+                n = o->rows;
+                first = GUI_MIN(n, hi - o->head);
+                copy_rows(disp, layer, x, y, o->head, first);
+                if (n > first) {
+                    copy_rows(disp, layer, x, y + first, 0, n - first);
+                }
+            }
+            if (n < hi) {
+                gui_draw_filledrectangle(disp, x, y + n, wi, hi - n, guii_widget_getcolor(h, GUI_WATERFALL_COLOR_BG));
+            }
+            break;
+        }
+        case GUI_EVT_CLONE: {                       /* Widget copied from prototype */
+            GUI_EVT_RESULTTYPE_U8(result) = 0;      /* Rows belong to prototype, widget cannot be copied */
+            return 1;
+        }
+        case GUI_EVT_REMOVE: {
+            free_buffer(h);
+            return 1;
+        }
+        default:                                    /* Handle default option */
+            GUI_UNUSED3(h, param, result);          /* Unused elements to prevent compiler warnings */
+            return 0;                               /* Command was not processed */
+    }
+    return 1;
+}
+
+/**
+ * \brief           Create new waterfall widget
+ *
+ *                  Each added row of values is converted to one row of pixels through color table
+ *                  and placed on top, older rows move down by one row.
+ *                  Rows are kept in ring buffer, redraw copies it to screen with up to two `Copy` operations.
+ *
+ * \note            Buffer of widget size in pixel format of LCD and converted color table are allocated on first row
+ * \param[in]       id: Widget unique ID to use for identity for callback processing
+ * \param[in]       x: Widget `X` position relative to parent widget
+ * \param[in]       y: Widget `Y` position relative to parent widget
+ * \param[in]       width: Widget width in units of pixels
+ * \param[in]       height: Widget height in units of pixels
+ * \param[in]       parent: Parent widget handle. Set to `NULL` to use current active parent widget
+ * \param[in]       evt_fn: Custom widget callback function. Set to `NULL` to use default callback
+ * \param[in]       flags: flags for create procedure
+ * \return          Widget handle on success, `NULL` otherwise
+ */
+gui_handle_p
+gui_waterfall_create(gui_id_t id, float x, float y, float width, float height, gui_handle_p parent, gui_widget_evt_fn evt_fn, uint16_t flags) {
+    return (gui_handle_p)gui_widget_create(&widget, id, x, y, width, height, parent, evt_fn, flags);
+}
+
+/**
+ * \brief           Set color to specific part of widget
+ * \param[in]       h: Widget handle
+ * \param[in]       index: Color index
+ * \param[in]       color: Color value
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_waterfall_setcolor(gui_handle_p h, gui_waterfall_color_t index, gui_color_t color) {
+    return gui_widget_setcolor(h, (uint8_t)index, color);
+}
+
+/**
+ * \brief           Set color table used to convert values to pixels
+ * \note            Rows already added keep their colors
+ * \param[in]       h: Widget handle
+ * \param[in]       lut: Table of `256` colors, must stay valid while used by widget.
+ *                      Set to `NULL` to use default table from black over blue, red and yellow to white
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_waterfall_setlut(gui_handle_p h, const gui_color_t* lut) {
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    return guii_widget_setparam(h, CFG_LUT, &lut, 0, 0);
+}
+
+/**
+ * \brief           Add new row of values on top of widget
+ *
+ *                  Values are spread over widget width. When there are more values than columns,
+ *                  each column shows maximal value of values mapped to it.
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       values: Values used as index to color table, for example scaled FFT magnitudes
+ * \param[in]       count: Number of values
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_waterfall_addrow(gui_handle_p h, const uint8_t* values, size_t count) {
+    gui_waterfall_row_t row;
+    
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && values != NULL && count > 0);
+    row.values = values;
+    row.count = count;
+    return guii_widget_setparam(h, CFG_ROW, &row, 1, 0);
+}
+
+/**
+ * \brief           Remove all rows from widget
+ * \param[in]       h: Widget handle
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_waterfall_clear(gui_handle_p h) {
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    return guii_widget_setparam(h, CFG_CLEAR, NULL, 1, 0);
+}
+
+#endif /* GUI_CFG_WIDGET_WATERFALL || __DOXYGEN__ */
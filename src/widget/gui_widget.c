@@ -35,6 +35,7 @@
 #include "gui/gui_private.h"
 #include "widget/gui_widget.h"
 #include "widget/gui_window.h"
+#include "system/gui_sys.h"
 
 /**
  * \brief           Default widget settings
@@ -46,11 +47,61 @@ gui_widget_default_t widget_default;
 
 /* Widget absolute cache setup */
 #if GUI_CFG_USE_POS_SIZE_CACHE
-#define SET_WIDGET_ABS_VALUES(h)        set_widget_abs_values(h)
+#define SET_WIDGET_ABS_VALUES(h)        do { set_widget_abs_dirty(h); guii_focus_invalidate(); } while (0)
 #else
-#define SET_WIDGET_ABS_VALUES(h)
+#define SET_WIDGET_ABS_VALUES(h)        guii_focus_invalidate()
 #endif
 
+/* Children layout setup */
+#if GUI_CFG_USE_LAYOUT
+#define SET_WIDGET_LAYOUT_DIRTY(h)      set_widget_layout_dirty(h)
+
+/**
+ * \brief           Mark children widgets to be arranged again on next process call
+ * \param[in]       h: Widget handle or `NULL`. Nothing is done when widget does not use layout
+ */
+static void
+set_widget_layout_dirty(gui_handle_p h) {
+    if (h != NULL && guii_widget_getextvalue(h, layout.mode) != GUI_LAYOUT_NONE
+        && !guii_widget_getflag(h, GUI_FLAG_LAYOUT_DIRTY)) {
+        guii_widget_setflag(h, GUI_FLAG_LAYOUT_DIRTY);
+        GUI.layout_dirty_count++;
+    }
+}
+#else
+#define SET_WIDGET_LAYOUT_DIRTY(h)
+#endif
+
+/**
+ * \brief           Update hidden tree flag of widget and all its children after visibility change
+ *
+ *                  Children are only processed when flag of widget changes,
+ *                  hidden check of parents is then single flag check instead of parent loop
+ *
+ * \param[in]       h: Widget handle
+ */
+static void
+update_hidden_tree(gui_handle_p h) {
+    gui_handle_p child;
+    uint8_t hidden;
+    
+    hidden = guii_widget_ishidden(h) || (guii_widget_hasparent(h) && guii_widget_ishiddentree(guii_widget_getparent(h)));
+    if (hidden == guii_widget_ishiddentree(h)) {
+        return;                                     /* Subtree is not affected */
+    }
+    guii_focus_invalidate();                        /* Focusable widgets changed */
+    if (hidden) {
+        guii_widget_setflag(h, GUI_FLAG_HIDDEN_TREE);
+    } else {
+        guii_widget_clrflag(h, GUI_FLAG_HIDDEN_TREE);
+    }
+    if (guii_widget_haschildren(h)) {
+        GUI_LINKEDLIST_WIDGETSLISTNEXT(h, child) {
+            update_hidden_tree(child);
+        }
+    }
+}
+
 /**
  * \brief           Calculate widget absolute width
  *                  based on relative values from all parent widgets
@@ -63,9 +114,9 @@ calculate_widget_width(gui_handle_p h) {
     if (guii_widget_getflag(h, GUI_FLAG_EXPANDED)) {/* Maximize window over parent */
         width = guii_widget_getparentinnerwidth(h); /* Return parent inner width */
     } else if (guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT)) {   /* Percentage width */
-        width = GUI_DIM(GUI_ROUND((h->width * guii_widget_getparentinnerwidth(h)) / 100.0f));   /* Calculate percent width */
+        width = GUI_COORD_PERCENT(h->width, guii_widget_getparentinnerwidth(h));  /* Calculate percent width */
     } else {                                        /* Normal width */
-        width = GUI_DIM(h->width);                  /* Width in pixels */
+        width = GUI_COORD_PIXELS(h->width);         /* Width in pixels */
     }
     return width;
 }
@@ -81,13 +132,15 @@ calculate_widget_height(gui_handle_p h) {
     if (guii_widget_getflag(h, GUI_FLAG_EXPANDED)) {/* Maximize window over parent */
         height = guii_widget_getparentinnerheight(h);   /* Return parent inner height */
     } else if (guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT)) {   /* Percentage width */
-        height = GUI_DIM(GUI_ROUND((h->height * guii_widget_getparentinnerheight(h)) / 100.0f));  /* Calculate percent height */
+        height = GUI_COORD_PERCENT(h->height, guii_widget_getparentinnerheight(h));    /* Calculate percent height */
     } else {                                        /* Normal height */
-        height = GUI_DIM(h->height);                /* Width in pixels */
+        height = GUI_COORD_PIXELS(h->height);       /* Width in pixels */
     }
     return height;
 }
 
+#if !GUI_CFG_USE_POS_SIZE_CACHE
+
 /**
  * \brief           Calculate widget absolute X position on screen in units of pixels
  * \param[in]       h: Widget handle
@@ -108,7 +161,7 @@ calculate_widget_absolute_x(gui_handle_p h) {
     for (w = guii_widget_getparent(h); w != NULL;
         w = guii_widget_getparent(w)) {             /* Go through all parent windows */
         out += guii_widget_getrelativex(w) + gui_widget_getpaddingleft(w);  /* Add X offset from parent and left padding of parent */
-        out -= w->x_scroll;                         /* Decrease by scroll value */
+        out -= guii_widget_getextvalue(w, x_scroll);/* Decrease by scroll value */
     }
     return out;
 }
@@ -133,11 +186,13 @@ calculate_widget_absolute_y(gui_handle_p h) {
     for (w = guii_widget_getparent(h); w != NULL;
         w = guii_widget_getparent(w)) {             /* Go through all parent windows */
         out += guii_widget_getrelativey(w) + gui_widget_getpaddingtop(w);   /* Add Y offset from parent and top padding of parent */
-        out -= w->y_scroll;                         /* Decrease by scroll value */
+        out -= guii_widget_getextvalue(w, y_scroll);/* Decrease by scroll value */
     }
     return out;
 }
 
+#endif /* !GUI_CFG_USE_POS_SIZE_CACHE */
+
 /**
  * \brief           Calculates absolute visible position and size on screen.
  *                  Actual visible position may change when other widgets cover current one
@@ -177,1087 +232,4058 @@ calculate_widget_absolute_visible_position_size(gui_handle_p h, gui_dim_t* x1, g
     return 1;
 }
 
+#if GUI_CFG_USE_WIDGET_GRID
+
+/**
+ * \brief           Get grid cell index for coordinate
+ * \param[in]       v: Coordinate on screen
+ * \param[in]       size: Screen size in specific direction
+ * \param[in]       cells: Number of cells in specific direction
+ * \return          Cell index, clamped to valid range
+ */
+static uint32_t
+get_grid_cell(gui_dim_t v, gui_dim_t size, uint32_t cells) {
+    if (v <= 0 || size <= 0) {
+        return 0;
+    } else if (v >= size) {
+        return cells - 1;
+    }
+    return (uint32_t)((int32_t)v * (int32_t)cells / (int32_t)size);
+}
+
+/**
+ * \brief           Get mask of grid cells covered by rectangle
+ * \param[in]       x1: Top left X position
+ * \param[in]       y1: Top left Y position
+ * \param[in]       x2: Bottom right X position
+ * \param[in]       y2: Bottom right Y position
+ * \return          Mask of covered cells, `0` if rectangle is empty
+ */
+uint32_t
+guii_widget_getgridmask(gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2) {
+    uint32_t c1, c2, r1, r2, row, mask = 0;
+    
+    if (x2 < x1 || y2 < y1) {                       /* Nothing is visible */
+        return 0;
+    }
+    c1 = get_grid_cell(x1, GUI.lcd.width, GUI_CFG_WIDGET_GRID_COLS);
+    c2 = get_grid_cell(x2, GUI.lcd.width, GUI_CFG_WIDGET_GRID_COLS);
+    r1 = get_grid_cell(y1, GUI.lcd.height, GUI_CFG_WIDGET_GRID_ROWS);
+    r2 = get_grid_cell(y2, GUI.lcd.height, GUI_CFG_WIDGET_GRID_ROWS);
+    
+    /* Set bits for columns in first row and copy them to all other rows */
+    row = ((uint32_t)0xFFFFFFFF >> (31 - (c2 - c1))) << c1;
+    for (; r1 <= r2; r1++) {
+        mask |= row << (r1 * GUI_CFG_WIDGET_GRID_COLS);
+    }
+    return mask;
+}
+
+#endif /* GUI_CFG_USE_WIDGET_GRID */
+
 #if GUI_CFG_USE_POS_SIZE_CACHE
 
 /**
- * \brief           Set widget absolute values for position and size
+ * \brief           Mark absolute values of widget as invalid
+ *
+ *                  Values are recalculated on next read.
+ *                  Children widgets are marked invalid only when parent values get recalculated
+ *
+ * \param[in]       h: Widget handle
+ */
+static void
+set_widget_abs_dirty(gui_handle_p h) {
+    if (!guii_widget_getflag(h, GUI_FLAG_ABS_DIRTY)) {
+        guii_widget_setflag(h, GUI_FLAG_ABS_DIRTY);
+        GUI.abs_dirty_count++;
+    }
+}
+
+/**
+ * \brief           Recalculate absolute position and size values of widget if marked invalid
+ *
+ *                  Parent widget is updated first, values of widget are then
+ *                  calculated from cached values of parent in constant time
+ *
+ * \note            Use \ref guii_widget_updateabs macro instead to skip tree walk when no widget is invalid
  * \param[in]       h: Widget handle
  */
-static uint8_t
-set_widget_abs_values(gui_handle_p h) {
+void
+guii_widget_updateabsvalues(gui_handle_p h) {
+    gui_handle_p p, child;
+    gui_dim_t x, y, wi, hi;
+    
+    p = guii_widget_getparent(h);
+    if (p != NULL) {
+        guii_widget_updateabsvalues(p);             /* Make sure parent has valid values */
+    }
+    if (!guii_widget_getflag(h, GUI_FLAG_ABS_DIRTY)) {
+        return;
+    }
+    guii_widget_clrflag(h, GUI_FLAG_ABS_DIRTY);     /* Clear flag first as parent values are used below */
+    GUI.abs_dirty_count--;
+    
     /* Update widget absolute values */
-    h->abs_x = calculate_widget_absolute_x(h);
-    h->abs_y = calculate_widget_absolute_y(h);
+#if GUI_CFG_USE_LAYOUT
+    wi = h->abs_width;
+    hi = h->abs_height;
+#endif /* GUI_CFG_USE_LAYOUT */
+    h->abs_x = guii_widget_getrelativex(h);
+    h->abs_y = guii_widget_getrelativey(h);
     h->abs_width = calculate_widget_width(h);
     h->abs_height = calculate_widget_height(h);
+#if GUI_CFG_USE_LAYOUT
+    if (h->abs_width != wi || h->abs_height != hi) {
+        set_widget_layout_dirty(h);                 /* Size changed together with parent, arrange children again */
+    }
+#endif /* GUI_CFG_USE_LAYOUT */
+    if (p != NULL) {
+        h->abs_x += p->abs_x + gui_widget_getpaddingleft(p) - guii_widget_getextvalue(p, x_scroll);
+        h->abs_y += p->abs_y + gui_widget_getpaddingtop(p) - guii_widget_getextvalue(p, y_scroll);
+    }
     
-    /* Calculate absolute visible position/size on screen */
-    calculate_widget_absolute_visible_position_size(h,
-        &h->abs_visible_x1, &h->abs_visible_y1,
-        &h->abs_visible_x2, &h->abs_visible_y2);
+    /* Visible area is inside parent inner area and parent visible area */
+    x = guii_widget_getparentabsolutex(h);
+    y = guii_widget_getparentabsolutey(h);
+    wi = guii_widget_getparentinnerwidth(h);
+    hi = guii_widget_getparentinnerheight(h);
+    h->abs_visible_x1 = GUI_MAX(h->abs_x, x);
+    h->abs_visible_y1 = GUI_MAX(h->abs_y, y);
+    h->abs_visible_x2 = GUI_MIN(h->abs_x + h->abs_width, x + wi);
+    h->abs_visible_y2 = GUI_MIN(h->abs_y + h->abs_height, y + hi);
+    if (p != NULL) {
+        h->abs_visible_x1 = GUI_MAX(h->abs_visible_x1, p->abs_visible_x1);
+        h->abs_visible_y1 = GUI_MAX(h->abs_visible_y1, p->abs_visible_y1);
+        h->abs_visible_x2 = GUI_MIN(h->abs_visible_x2, p->abs_visible_x2);
+        h->abs_visible_y2 = GUI_MIN(h->abs_visible_y2, p->abs_visible_y2);
+    }
+#if GUI_CFG_USE_WIDGET_GRID
+    h->grid_mask = guii_widget_getgridmask(h->abs_visible_x1, h->abs_visible_y1,
+        h->abs_visible_x2, h->abs_visible_y2);
+#endif /* GUI_CFG_USE_WIDGET_GRID */
 
-    /* Update children widgets */
+    /* Children values depend on widget values, invalidate direct children only */
     if (guii_widget_haschildren(h)) {
-        gui_handle_p child;
-        
-        /* Scan all children widgets */
         GUI_LINKEDLIST_WIDGETSLISTNEXT(h, child) {
-            set_widget_abs_values(child);           /* Process child widget */
+            set_widget_abs_dirty(child);
         }
     }
-    return 1;
 }
 #endif /* GUI_CFG_USE_POS_SIZE_CACHE */
 
+#if GUI_CFG_USE_WIDGET_POOL
 /**
- * \brief           Remove widget from memory
- * \param[in]       h: Widget handle
- * \return          `1` on success, `0` otherwise
+ * \brief           Get object pool for widget type
+ * \param[in]       widget: Widget type
+ * \param[in]       create: Set to `1` to create new pool if it does not exist yet
+ * \return          Pointer to pool or `NULL` if not available
  */
-static uint8_t
-remove_widget(gui_handle_p h) {
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+static gui_widget_pool_t *
+get_widget_pool(const gui_widget_t* widget, uint8_t create) {
+    gui_widget_pool_t* pool;
+    size_t i;
     
-    /*
-     * Check and react on:
-     *
-     * Step 1: If widget is in focus, set its parent widget to focus. If there is no parent, disable focus
-     * Step 2: Clear previous focused handle, if it is set to current widget
-     * Step 3: If widget is active, clear it
-     * Step 4: If widget is set as previous active, set its parent as previous active
-     */
-    if (GUI.focused_widget == h) {                  /* Step 1 */
-        if (guii_widget_hasparent(h)) {             /* Should always happen as top parent (window) can't be removed */
-            GUI.focused_widget = guii_widget_getparent(h);  /* Set parent widget as focused */
-        } else {
-            guii_widget_focus_clear();              /* Clear all widgets from focused */
-            GUI.focused_widget = NULL;
+    for (i = 0; i < GUI_CFG_WIDGET_POOL_TYPES; i++) {
+        pool = &GUI.widget_pools[i];
+        if (pool->stat.widget == widget) {
+            return pool;
+        } else if (pool->stat.widget == NULL) {     /* First empty entry, pools are added in order */
+            break;
         }
     }
-    if (GUI.focused_widget_prev == h) {             /* Step 2 */
-        GUI.focused_widget_prev = NULL;
-    }
-    if (GUI.active_widget == h) {                   /* Step 3 */
-        GUI.active_widget = NULL;                   /* Invalidate active widget */
-    }
-    if (GUI.active_widget_prev == h) {              /* Step 4 */
-        GUI.active_widget_prev = guii_widget_getparent(h);  /* Set widget as previous active */
-    }
-    if (GUI.window_active != NULL && h == GUI.window_active) {  /* Check for parent window */
-        GUI.window_active = guii_widget_getparent(GUI.window_active);
+    if (!create || i == GUI_CFG_WIDGET_POOL_TYPES) {
+        return NULL;
     }
     
-    /*
-     * Final steps to remove widget are:
-     * 
-     * - Invalidate widget and its parent,
-     *      make sure parent is redrawn on screen
-     * - Free any possible memory used for text operation
-     * - Remove software timer if exists
-     * - Remove custom colors
-     * - Remove widget from its linkedlist
-     * - Free widget memory
-     */
-    gui_widget_invalidatewithparent(h);
-    gui_widget_freetextmemory(h);
-    if (h->timer != NULL) {
-        guii_timer_remove(&h->timer);
+    /* Create new pool with all blocks in free list */
+    pool->block_size = GUI_MEM_ALIGN(widget->size);
+    pool->stat.count = widget->pool_count ? widget->pool_count : GUI_CFG_WIDGET_POOL_COUNT;
+#if GUI_CFG_USE_MEM_ARENA
+    {
+        gui_mem_arena_t* arena = gui_mem_arena_setactive(NULL);/* Pools outlive screen arenas */
+        pool->mem = GUI_MEMALLOC_CLASS(pool->block_size * pool->stat.count, GUI_MEM_CLASS_FAST);
+        gui_mem_arena_setactive(arena);
     }
-    if (h->colors != NULL) {
-        GUI_MEMFREE(h->colors);
-        h->colors = NULL;
+#else /* GUI_CFG_USE_MEM_ARENA */
+    pool->mem = GUI_MEMALLOC_CLASS(pool->block_size * pool->stat.count, GUI_MEM_CLASS_FAST);
+#endif /* !GUI_CFG_USE_MEM_ARENA */
+    if (pool->mem == NULL) {
+        return NULL;
     }
-    gui_linkedlist_widgetremove(h);                 /* Remove entry from linked list of parent widget */
-    GUI_MEMFREE(h);                                 /* Free memory for widget */
-    
-    return 1;                                       /* Widget deleted */
+    for (i = pool->stat.count; i > 0; i--) {
+        void** block = (void **)(pool->mem + (i - 1) * pool->block_size);
+        *block = pool->free_list;
+        pool->free_list = block;
+    }
+    pool->stat.widget = widget;
+    return pool;
 }
 
 /**
- * \brief           Check and remove all widgets with delete flag enabled using recursion
- * \param[in]       parent: Parent widget handle
+ * \brief           Allocate memory for widget from its object pool or heap
+ * \param[in]       widget: Widget type
+ * \return          Pointer to zeroed memory or `NULL` on failure
  */
-static void
-remove_widgets(gui_handle_p parent) {
-    gui_handle_p h, next;
-    static uint32_t lvl = 0;
-    
-    /* Scan all widgets in system */
-    for (h = gui_linkedlist_widgetgetnext(parent, NULL); h != NULL; ) {        
-        if (guii_widget_getflag(h, GUI_FLAG_REMOVE)) {  /* Widget should be deleted */
-            next = gui_linkedlist_widgetgetnext(NULL, h);   /* Get next widget of current */
-            
-            /*
-             * Before we can actually delete widget,
-             * we have to check for its children widgets.
-             *
-             * In this case set remove flags to all children widgets
-             * and process with delete of all
-             *
-             * Steps to perform are:
-             *
-             * - Step 1: Set remove flag to all direct children widgets
-             * - Step 2: Perform mass erase of children widgets 
-             *      This step is recursive operation.
-             */
-            if (guii_widget_haschildren(h)) {       /* Children widgets are supported */
-                gui_handle_p tmp;
-                
-                /* Step 1 */
-                GUI_LINKEDLIST_WIDGETSLISTNEXT(h, tmp) {
-                    guii_widget_setflag(tmp, GUI_FLAG_REMOVE); /* Set remove bit to all children elements */
-                }
-                
-                /* Step 2 */
-                lvl++;
-                remove_widgets(h);                  /* Remove children widgets directly */
-                lvl--;
+static void *
+widget_alloc(const gui_widget_t* widget) {
+    gui_widget_pool_t* pool;
+    void* ptr;
+    
+    pool = get_widget_pool(widget, 1);
+    if (pool != NULL) {
+        if (pool->free_list != NULL) {              /* Pop block from free list */
+            ptr = pool->free_list;
+            pool->free_list = *(void **)ptr;
+            memset(ptr, 0x00, widget->size);
+            if (++pool->stat.used > pool->stat.max_used) {
+                pool->stat.max_used = pool->stat.used;
             }
-            
-            /*
-             * Removing widget will also remove linked list chain
-             * Therefore we have to save previous widget so we know next one
-             */
-            remove_widget(h);                       /* Remove widget itself */
-            
-            /* Move widget pointer to next widget of already deleted and continue checking */
-            h = next;                               /* Set current pointer to next one */
-            continue;                               /* Continue to prevent further execution */
-        } else if (guii_widget_haschildren(h)) {    /* Children widgets are supported */
-            remove_widgets(h);                      /* Check children widgets if anything to remove */
+            return ptr;
         }
-        h = gui_linkedlist_widgetgetnext(NULL, h);  /* Get next widget of current */
+        pool->stat.overflow++;
     }
+    return GUI_MEMALLOC_CLASS(widget->size, GUI_MEM_CLASS_FAST);
+}
+
+/**
+ * \brief           Free widget memory to its object pool or heap
+ * \param[in]       h: Widget handle
+ */
+static void
+widget_free(gui_handle_p h) {
+    gui_widget_pool_t* pool;
     
-#if GUI_CFG_OS
-    if (lvl == 0) {                                 /* Notify about remove execution */
-        gui_sys_mbox_putnow(&GUI.OS.mbox, NULL);
+    pool = get_widget_pool(h->widget, 0);
+    if (pool != NULL && (uint8_t *)h >= pool->mem
+        && (uint8_t *)h < pool->mem + pool->block_size * pool->stat.count) {
+        *(void **)h = pool->free_list;              /* Push block to free list */
+        pool->free_list = h;
+        pool->stat.used--;
+    } else {
+        GUI_MEMFREE(h);
     }
-#endif /* GUI_CFG_OS */
 }
 
+#define WIDGET_ALLOC(widget)            widget_alloc(widget)
+#define WIDGET_FREE(h)                  do { widget_free(h); (h) = NULL; } while (0)
+#else /* GUI_CFG_USE_WIDGET_POOL */
+#define WIDGET_ALLOC(widget)            GUI_MEMALLOC_CLASS((widget)->size, GUI_MEM_CLASS_FAST)
+#define WIDGET_FREE(h)                  GUI_MEMFREE(h)
+#endif /* !GUI_CFG_USE_WIDGET_POOL */
+
+#if GUI_CFG_USE_WIDGET_ID_HASH || __DOXYGEN__
+
 /**
- * \brief           Get vidget visible X, Y and width, height values on screen
- * 
- *                  It will calculate where widget is (including scrolling).
- *
- * \param[in]       h: Widget handle
- * \param[out]      x1: Output variable to save top left X position on screen
- * \param[out]      y1: Output variable to save top left Y position on screen
- * \param[out]      x2: Output variable to save bottom right X position on screen
- * \param[out]      y2: Output variable to save bottom right Y position on screen
- * \return          `1` on success, `0` otherwise
+ * \brief           Get hash table start slot for widget ID
+ * \param[in]       id: Widget ID
+ * \return          Slot index in hash table
  */
-static uint8_t
-get_widget_abs_visible_position_size(gui_handle_p h, gui_dim_t* x1, gui_dim_t* y1, gui_dim_t* x2, gui_dim_t* y2) {
-#if GUI_CFG_USE_POS_SIZE_CACHE
-    *x1 = h->abs_visible_x1;
-    *y1 = h->abs_visible_y1;
-    *x2 = h->abs_visible_x2;
-    *y2 = h->abs_visible_y2;
-    return 1;
-#else /* GUI_CFG_USE_POS_SIZE_CACHE */
-    return calculate_widget_absolute_visible_position_size(h, x1, y1, x2, y2);
-#endif /* !GUI_CFG_USE_POS_SIZE_CACHE */
+static size_t
+id_hash_slot(gui_id_t id) {
+    uint32_t h = (uint32_t)id * 0x9E3779B1UL;       /* Spread bits using golden ratio multiplier */
+    return (size_t)(h ^ (h >> 16)) & (GUI.id_hash_size - 1);
 }
 
 /**
- * \brief           Set clipping region for visible part of widget
- * \param[in]       h: Widget handle
+ * \brief           Resize hash table and insert all existing entries again
+ * \param[in]       size: New number of slots, power of `2`
  * \return          `1` on success, `0` otherwise
  */
 static uint8_t
-set_clipping_region(gui_handle_p h) {
-    gui_dim_t x1, y1, x2, y2;
-    
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
-    
-    /* Get visible widget part and absolute position on screen according to parent */
-    get_widget_abs_visible_position_size(h, &x1, &y1, &x2, &y2);
-    
-    /* Possible improvement */
-    /*
-     * If widget has direct children widgets which are not transparent,
-     * it is possible to limit clipping region for update process to only
-     * part of widget which is actually visible on screen.
-     *
-     * This may only work if padding is 0 and widget position wasn't changed
-     */
-    
-    /* Set invalid clipping region */
-    if (GUI.display.x1 > x1)    { GUI.display.x1 = x1; }
-    if (GUI.display.x2 < x2)    { GUI.display.x2 = x2; }
-    if (GUI.display.y1 > y1)    { GUI.display.y1 = y1; }
-    if (GUI.display.y2 < y2)    { GUI.display.y2 = y2; }
+id_hash_resize(size_t size) {
+    gui_handle_p* old = GUI.id_hash;
+    size_t old_size = GUI.id_hash_size, i, j;
     
+#if GUI_CFG_USE_MEM_ARENA
+    {
+        gui_mem_arena_t* arena = gui_mem_arena_setactive(NULL); /* Table outlives screen arenas */
+        GUI.id_hash = GUI_MEMALLOC_CLASS(size * sizeof(*GUI.id_hash), GUI_MEM_CLASS_FAST);
+        gui_mem_arena_setactive(arena);
+    }
+#else /* GUI_CFG_USE_MEM_ARENA */
+    GUI.id_hash = GUI_MEMALLOC_CLASS(size * sizeof(*GUI.id_hash), GUI_MEM_CLASS_FAST);
+#endif /* !GUI_CFG_USE_MEM_ARENA */
+    if (GUI.id_hash == NULL) {
+        GUI.id_hash = old;
+        return 0;
+    }
+    GUI.id_hash_size = size;
+    for (i = 0; i < old_size; i++) {
+        if (old[i] != NULL) {
+            for (j = id_hash_slot(old[i]->id); GUI.id_hash[j] != NULL; j = (j + 1) & (size - 1)) {}
+            GUI.id_hash[j] = old[i];
+        }
+    }
+    if (old != NULL) {
+        GUI_MEMFREE(old);
+    }
     return 1;
 }
 
 /**
- * \brief           Invalidate widget and set redraw flag
- * \note            If widget is transparent, parent must be updated too. This function will handle these cases.
+ * \brief           Add widget to ID hash table
+ * \note            When table cannot grow, it is released and lookups use widget tree from now on
  * \param[in]       h: Widget handle
- * \param[in]       setclipping: When set to 1, clipping region will be expanded to widget size
- * \return          `1` on success, `0` otherwise
  */
-static uint8_t
-invalidate_widget(gui_handle_p h, uint8_t setclipping) {
-    gui_handle_p h1, h2;
-    gui_dim_t h1x1, h1x2, h2x1, h2x2;
-    gui_dim_t h1y1, h1y2, h2y1, h2y2;
+static void
+id_hash_add(gui_handle_p h) {
+    size_t i;
     
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
-
-    /* Check ignore flag */
-    if (guii_widget_getflag(h, GUI_FLAG_IGNORE_INVALIDATE)) {
-        return 0;
+    if (GUI.id_hash_off) {
+        return;
     }
-
-    /*
-     * First check if any of parent widgets are hidden = ignore redraw
-     *
-     * When widget is invalidated for first first time,
-     * ignore this check and force widget invalidation to create absolute visible positions for later usage
-     */
-#if GUI_CFG_USE_POS_SIZE_CACHE
-    if (!guii_widget_getflag(h, GUI_FLAG_FIRST_INVALIDATE)) 
-#endif /* GUI_CFG_USE_POS_SIZE_CACHE */
-    {
-        for (h1 = guii_widget_getparent(h); h1 != NULL;
-            h1 = guii_widget_getparent(h1)) {
-            if (guii_widget_ishidden(h1)) {
-                return 1;
+    if ((GUI.id_hash_count + 1) * 4 > GUI.id_hash_size * 3) {   /* Keep table at most 75% full */
+        if (!id_hash_resize(GUI.id_hash_size ? 2 * GUI.id_hash_size : 32)) {
+            if (GUI.id_hash != NULL) {
+                GUI_MEMFREE(GUI.id_hash);
             }
+            GUI.id_hash_size = 0;
+            GUI.id_hash_count = 0;
+            GUI.id_hash_off = 1;
+            return;
         }
     }
-    guii_widget_clrflag(h, GUI_FLAG_FIRST_INVALIDATE);  /* Clear flag */
-        
-    h1 = h;                                         /* Save temporary */
-    guii_widget_setflag(h1, GUI_FLAG_REDRAW);       /* Redraw widget */
-    GUI.flags |= GUI_FLAG_REDRAW;                   /* Notify stack about redraw operations */
-    
-    if (setclipping) {
-        set_clipping_region(h);                     /* Set clipping region for widget redrawing operation */
-    }
+    for (i = id_hash_slot(h->id); GUI.id_hash[i] != NULL; i = (i + 1) & (GUI.id_hash_size - 1)) {}
+    GUI.id_hash[i] = h;
+    GUI.id_hash_count++;
+}
 
-    /*
-     * Invalid only widget with higher Z-index (lowered on linked list) of current object
-     * 
-     * If widget should be redrawn, then any widget above it should be redrawn too, otherwise z-index match will fail.
-     *
-     * Widget may not need redraw operation if positions don't match
-     *
-     * If widget is transparent, check all widgets, even those which are below current widget in list
-     * Get first element of parent linked list for checking
-     */
-#if GUI_CFG_USE_ALPHA
-    if (guii_widget_hasalpha(h1) && guii_widget_hasparent(h1)) {
-        invalidate_widget(guii_widget_getparent(h1), 0);    /* Invalidate parent widget */
+/**
+ * \brief           Remove widget from ID hash table
+ * \note            Linear probing requires entries after removed slot to be moved back
+ * \param[in]       h: Widget handle
+ */
+static void
+id_hash_remove(gui_handle_p h) {
+    size_t i, j, k, mask = GUI.id_hash_size - 1;
+    
+    if (GUI.id_hash == NULL) {
+        return;
     }
-#endif /* GUI_CFG_USE_ALPHA */
-    for (; h1 != NULL; h1 = gui_linkedlist_widgetgetnext(NULL, h1)) {
-        get_widget_abs_visible_position_size(h1, &h1x1, &h1y1, &h1x2, &h1y2); /* Get visible position on LCD for widget */
-        
-        /* Scan widgets on top of current widget */
-        for (h2 = gui_linkedlist_widgetgetnext(NULL, h1); h2 != NULL;
-                h2 = gui_linkedlist_widgetgetnext(NULL, h2)) {
-            /* Get visible position on second widget */
-            get_widget_abs_visible_position_size(h2, &h2x1, &h2y1, &h2x2, &h2y2);
-                    
-            /* Check if next widget is on top of current one */
-            if (
-                guii_widget_getflag(h2, GUI_FLAG_REDRAW) || /* Flag is already set */
-                !GUI_RECT_MATCH(                    /* Widgets are not one over another */
-                    h1x1, h1y1, h1x2, h1y2,
-                    h2x1, h2y1, h2x2, h2y2)
-            ) {
-                continue;
-            }
-            guii_widget_setflag(h2, GUI_FLAG_REDRAW);   /* Redraw widget on next loop */
+    for (i = id_hash_slot(h->id); GUI.id_hash[i] != h; i = (i + 1) & mask) {
+        if (GUI.id_hash[i] == NULL) {               /* Widget is not in table, it was not added to linked list */
+            return;
         }
     }
+    GUI.id_hash[i] = NULL;
+    GUI.id_hash_count--;
     
-    /*
-     * If widget is not the last on the linked list (top z-index)
-     * check status of parent widget if it is last.
-     * If it is not, process parent redraw and check similar parent widgets if are over our widget
-     */
-    if (guii_widget_hasparent(h)) {
-        gui_handle_p ph = guii_widget_getparent(h);
-        if (!gui_linkedlist_iswidgetlast(ph)) {
-            invalidate_widget(guii_widget_getparent(h), 0);
+    /* Move back entries which would not be found anymore */
+    for (j = (i + 1) & mask; GUI.id_hash[j] != NULL; j = (j + 1) & mask) {
+        k = id_hash_slot(GUI.id_hash[j]->id);
+        if ((j > i && (k <= i || k > j)) || (j < i && (k <= i && k > j))) {
+            GUI.id_hash[i] = GUI.id_hash[j];
+            GUI.id_hash[j] = NULL;
+            i = j;
         }
     }
+}
 
-#if GUI_CFG_USE_ALPHA    
+/**
+ * \brief           Find widget by ID in hash table
+ * \param[in]       id: Widget ID
+ * \param[out]      h: Pointer to output widget handle, set to `NULL` when there is no widget with ID
+ * \return          `1` when result is valid, `0` when widget tree must be searched instead
+ */
+static uint8_t
+id_hash_find(gui_id_t id, gui_handle_p* h) {
+    size_t i;
+    
+    *h = NULL;
+    if (GUI.id_hash_off) {
+        return 0;
+    }
+    if (GUI.id_hash == NULL) {                      /* No widgets created yet */
+        return 1;
+    }
+    for (i = id_hash_slot(id); GUI.id_hash[i] != NULL; i = (i + 1) & (GUI.id_hash_size - 1)) {
+        if (GUI.id_hash[i]->id == id) {
+            if (*h != NULL) {                       /* Duplicated ID, return first one in tree order */
+                return 0;
+            }
+            *h = GUI.id_hash[i];
+        }
+    }
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_WIDGET_ID_HASH || __DOXYGEN__ */
+
+#if GUI_CFG_USE_POPUP_RESTORE || __DOXYGEN__
+
+/**
+ * \brief           Release pixels saved below popup widget
+ */
+static void
+popup_release(void) {
+    if (GUI.popup_buff != NULL) {
+        GUI_MEMFREE(GUI.popup_buff);
+    }
+    GUI.popup_widget = NULL;
+    GUI.popup_state = GUI_POPUP_IDLE;
+}
+
+/**
+ * \brief           Check if widget is popup with saved pixels or any of its children
+ * \param[in]       h: Widget handle
+ * \return          `1` if widget is part of popup, `0` otherwise
+ */
+static uint8_t
+is_popup_content(gui_handle_p h) {
+    return GUI.popup_widget != NULL && (h == GUI.popup_widget || gui_widget_ischildof(h, GUI.popup_widget));
+}
+
+/**
+ * \brief           Check area invalidated by widget against pixels saved below popup
+ *
+ *                  Saved pixels are released when any widget below popup changes.
+ *                  Closed popup does not add dirty regions anymore, its area is restored from saved pixels
+ *                  and popup is redrawn once on its final position on next frame
+ *
+ * \param[in]       h: Widget which content changed in area
+ * \param[in]       x1: Top left X position
+ * \param[in]       y1: Top left Y position
+ * \param[in]       x2: Bottom right X position
+ * \param[in]       y2: Bottom right Y position
+ * \return          `1` if area must not be added to dirty regions, `0` otherwise
+ */
+static uint8_t
+popup_check_area(gui_handle_p h, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2) {
+    const gui_display_t* a = &GUI.popup_area;
+
+    if (GUI.popup_state == GUI_POPUP_SAVE || GUI.popup_state == GUI_POPUP_SAVED) {
+        if (!is_popup_content(h) && GUI_RECT_MATCH(x1, y1, x2, y2, a->x1, a->y1, a->x2, a->y2)) {
+            popup_release();                        /* Content below popup changed */
+        }
+    } else if (GUI.popup_state == GUI_POPUP_RESTORE) {
+        return is_popup_content(h);
+    }
+    return 0;
+}
+
+#endif /* GUI_CFG_USE_POPUP_RESTORE || __DOXYGEN__ */
+
+#if GUI_CFG_USE_DISPLAY_LIST || __DOXYGEN__
+
+/**
+ * \brief           Mark display list of widget outdated after its content changed
+ * \param[in]       h: Widget handle
+ */
+static void
+invalidate_draw_list(gui_handle_p h) {
+    if (h->draw_list != NULL) {
+        h->draw_list->valid = 0;
+        h->draw_list->failed = 0;                   /* Changed drawing may fit into list again */
+    }
+}
+
+/**
+ * \brief           Release display list of widget
+ * \param[in]       h: Widget handle
+ */
+static void
+free_draw_list(gui_handle_p h) {
+    if (h->draw_list != NULL) {
+        gui_draw_list_free(h->draw_list);
+        GUI_MEMFREE(h->draw_list);
+    }
+}
+
+#endif /* GUI_CFG_USE_DISPLAY_LIST || __DOXYGEN__ */
+
+#if GUI_CFG_USE_REFRESH_LIMIT || __DOXYGEN__
+
+#define REFRESH_FLAG_OPEN               0x01    /*!< Widget was redrawn and its refresh window is open */
+#define REFRESH_FLAG_PENDING            0x02    /*!< Widget was invalidated during refresh window */
+
+/**
+ * \brief           End refresh window of widget and invalidate it when it changed meanwhile
+ * \param[in]       t: Refresh timer of widget
+ */
+static void
+refresh_timer_cb(gui_timer_t* t) {
+    gui_handle_p h = guii_timer_getparams(t);
+    gui_handle_ext_t* e = guii_widget_getext(h);
+    uint8_t pending = e->refresh_flags & REFRESH_FLAG_PENDING;
+    
+    e->refresh_flags = 0;
+    if (pending) {
+        gui_widget_invalidate(h);                   /* Opens next window when widget is still limited */
+    }
+}
+
+/**
+ * \brief           Check if widget invalidation must wait for end of its refresh window
+ *
+ *                  Window is opened when limited widget is invalidated and lasts for its refresh period,
+ *                  or for \ref GUI_CFG_REFRESH_FRAME_BUDGET when widget is limited only by its priority.
+ *                  All invalidations during window are merged to single one at its end
+ * \param[in]       h: Widget handle
+ * \return          `1` if invalidation is postponed, `0` if widget must be invalidated now
+ */
+static uint8_t
+refresh_defer(gui_handle_p h) {
+    gui_handle_ext_t* e = guii_widget_getext(h);
+    
+    if (e == NULL || (e->refresh_period == 0 && e->refresh_prio == GUI_WIDGET_PRIO_INTERACTIVE)) {
+        return 0;
+    }
+    if (e->refresh_flags & REFRESH_FLAG_OPEN) {
+        e->refresh_flags |= REFRESH_FLAG_PENDING;
+        return 1;
+    }
+    if (e->refresh_period == 0 && !GUI.redraw_overload) {
+        return 0;                                   /* Priority applies only while frames are over budget */
+    }
+    if (e->refresh_timer == NULL) {
+        e->refresh_timer = guii_timer_create(e->refresh_period ? e->refresh_period : GUI_CFG_REFRESH_FRAME_BUDGET, refresh_timer_cb, h);
+        if (e->refresh_timer == NULL) {
+            return 0;                               /* Redraw without limit when memory is not available */
+        }
+    }
+    e->refresh_flags = REFRESH_FLAG_OPEN;
+    guii_timer_start(e->refresh_timer);
+    if (GUI.redraw_overload && e->refresh_prio == GUI_WIDGET_PRIO_BACKGROUND) {
+        e->refresh_flags |= REFRESH_FLAG_PENDING;   /* Checked again at the end of window */
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * \brief           Close refresh window of widget after its limits changed
+ * \param[in]       h: Widget handle
+ */
+static void
+refresh_reset(gui_handle_p h) {
+    gui_handle_ext_t* e = guii_widget_getext(h);
+    uint8_t pending = e->refresh_flags & REFRESH_FLAG_PENDING;
+    
+    if (e->refresh_timer != NULL) {
+        guii_timer_remove(&e->refresh_timer);       /* Timer period depends on limits */
+    }
+    e->refresh_flags = 0;
+    if (pending) {
+        gui_widget_invalidate(h);
+    }
+}
+
+#endif /* GUI_CFG_USE_REFRESH_LIMIT || __DOXYGEN__ */
+
+#if GUI_CFG_USE_WIDGET_BUILDER || __DOXYGEN__
+
+/**
+ * \brief           Remove widget from list of widgets waiting for builder
+ * \param[in]       h: Widget handle
+ */
+static void
+build_unlink(gui_handle_p h) {
+    gui_handle_p* p;
+    
+    for (p = &GUI.build_list; *p != NULL; p = &guii_widget_getext(*p)->build_next) {
+        if (*p == h) {
+            *p = guii_widget_getext(h)->build_next;
+            break;
+        }
+    }
+    guii_widget_getext(h)->build = NULL;
+    guii_widget_getext(h)->build_next = NULL;
+}
+
+/**
+ * \brief           Run builder of widget if it was not run yet
+ * \param[in]       h: Widget handle
+ */
+static void
+widget_build(gui_handle_p h) {
+    gui_widget_build_fn fn = guii_widget_getextvalue(h, build);
+    
+    if (fn != NULL) {
+        build_unlink(h);                            /* Builder runs only once */
+        fn(h);
+    }
+}
+
+#endif /* GUI_CFG_USE_WIDGET_BUILDER || __DOXYGEN__ */
+
+/**
+ * \brief           Remove widget from memory
+ * \param[in]       h: Widget handle
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+remove_widget(gui_handle_p h) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+    
     /*
-     * Check if any of parent widgets has alpha = should be invalidated too
+     * Check and react on:
      *
-     * Since recursion is used, call function only once and recursion will take care for upper level of parent widgets
+     * Step 1: If widget is in focus, set its parent widget to focus. If there is no parent, disable focus
+     * Step 2: Clear previous focused handle, if it is set to current widget
+     * Step 3: If widget is active, clear it
+     * Step 4: If widget is set as previous active, set its parent as previous active
      */
-    for (h = guii_widget_getparent(h); h != NULL; h = guii_widget_getparent(h)) {
-        if (guii_widget_hasalpha(h)) {              /* If widget has alpha */
-            invalidate_widget(h, 0);                /* Invalidate parent too */
+    if (GUI.focused_widget == h) {                  /* Step 1 */
+        if (guii_widget_hasparent(h)) {             /* Should always happen as top parent (window) can't be removed */
+            GUI.focused_widget = guii_widget_getparent(h);  /* Set parent widget as focused */
+        } else {
+            guii_widget_focus_clear();              /* Clear all widgets from focused */
+            GUI.focused_widget = NULL;
+        }
+    }
+    if (GUI.focused_widget_prev == h) {             /* Step 2 */
+        GUI.focused_widget_prev = NULL;
+    }
+    guii_focus_invalidate();                        /* Graph must not point to removed widget */
+    if (GUI.active_widget == h) {                   /* Step 3 */
+        GUI.active_widget = NULL;                   /* Invalidate active widget */
+        PT_INIT(&GUI.touch.pt);                     /* Pending click or long press belongs to removed widget */
+    }
+    if (GUI.active_widget_prev == h) {              /* Step 4 */
+        GUI.active_widget_prev = guii_widget_getparent(h);  /* Set widget as previous active */
+    }
+    if (GUI.window_active != NULL && h == GUI.window_active) {  /* Check for parent window */
+        GUI.window_active = guii_widget_getparent(GUI.window_active);
+    }
+    
+    /*
+     * Final steps to remove widget are:
+     * 
+     * - Invalidate widget and its parent,
+     *      make sure parent is redrawn on screen
+     * - Free any possible memory used for text operation
+     * - Remove software timer if exists
+     * - Remove custom colors
+     * - Remove widget from its linkedlist
+     * - Free widget memory
+     */
+    gui_widget_invalidatewithparent(h);
+    gui_widget_freetextmemory(h);
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE
+    gui_draw_text_layout_free(&h->text_layout);
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE */
+    if (guii_widget_getextvalue(h, timer) != NULL) {
+        guii_timer_remove(&guii_widget_getext(h)->timer);
+    }
+#if GUI_CFG_USE_REFRESH_LIMIT
+    if (guii_widget_getextvalue(h, refresh_timer) != NULL) {
+        guii_timer_remove(&guii_widget_getext(h)->refresh_timer);
+    }
+#endif /* GUI_CFG_USE_REFRESH_LIMIT */
+#if GUI_CFG_USE_WIDGET_BUILDER
+    if (guii_widget_getextvalue(h, build) != NULL) {
+        build_unlink(h);
+    }
+#endif /* GUI_CFG_USE_WIDGET_BUILDER */
+#if GUI_CFG_USE_ANIM
+    guii_anim_remove(h);
+#endif /* GUI_CFG_USE_ANIM */
+#if GUI_CFG_USE_TOUCH && GUI_CFG_USE_GESTURE
+    guii_gesture_remove(h);
+#endif /* GUI_CFG_USE_TOUCH && GUI_CFG_USE_GESTURE */
+#if GUI_CFG_USE_WIDGET_CMD_QUEUE
+    guii_widget_dropcommands(h);                    /* Handle may be reused by next created widget */
+#endif /* GUI_CFG_USE_WIDGET_CMD_QUEUE */
+#if GUI_CFG_USE_COPY_MOVE
+    if (GUI.move_widget == h) {
+        GUI.move_widget = NULL;                     /* Area of removed widget is redrawn */
+    }
+    if (GUI.scroll_widget == h) {
+        GUI.scroll_widget = NULL;
+    }
+#endif /* GUI_CFG_USE_COPY_MOVE */
+#if GUI_CFG_USE_POPUP_RESTORE
+    if (GUI.popup_widget == h) {
+        if (GUI.popup_state == GUI_POPUP_RESTORE) {
+            GUI.popup_widget = NULL;                /* Area is restored on next frame */
+        } else {
+            popup_release();                        /* Area of removed widget is redrawn */
+        }
+    }
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+    if (guii_widget_getextvalue(h, colors) != NULL) {
+        if (!guii_widget_getflag(h, GUI_FLAG_CONST_COLORS)) {
+            GUI_MEMFREE(guii_widget_getext(h)->colors);
+        }
+        guii_widget_getext(h)->colors = NULL;
+    }
+#if GUI_CFG_USE_WIDGET_CACHE
+    guii_widget_freecache(h);
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+#if GUI_CFG_USE_DISPLAY_LIST
+    free_draw_list(h);
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+#if GUI_CFG_USE_OVERLAY
+    guii_widget_freeoverlay(h);
+#endif /* GUI_CFG_USE_OVERLAY */
+#if GUI_CFG_USE_COMPACT_HANDLE
+    if (h->ext != NULL) {
+        GUI_MEMFREE(h->ext);
+        h->ext = NULL;
+    }
+#endif /* GUI_CFG_USE_COMPACT_HANDLE */
+#if GUI_CFG_USE_POS_SIZE_CACHE
+    if (guii_widget_getflag(h, GUI_FLAG_ABS_DIRTY)) {
+        GUI.abs_dirty_count--;                      /* Widget is not waiting for update anymore */
+    }
+#endif /* GUI_CFG_USE_POS_SIZE_CACHE */
+#if GUI_CFG_USE_LAYOUT
+    if (guii_widget_getflag(h, GUI_FLAG_LAYOUT_DIRTY)) {
+        GUI.layout_dirty_count--;                   /* Widget is not waiting for arrange anymore */
+    }
+    set_widget_layout_dirty(guii_widget_getparent(h));  /* Close the gap in parent layout */
+#endif /* GUI_CFG_USE_LAYOUT */
+    gui_linkedlist_widgetremove(h);                 /* Remove entry from linked list of parent widget */
+#if GUI_CFG_USE_WIDGET_ID_HASH
+    id_hash_remove(h);
+#endif /* GUI_CFG_USE_WIDGET_ID_HASH */
+#if GUI_CFG_USE_MEM_ARENA
+    {
+        gui_mem_arena_t* arena = h->arena;          /* Children are already removed at this point */
+        
+        WIDGET_FREE(h);                             /* Free memory for widget */
+        if (arena != NULL) {
+            gui_mem_arena_delete(arena);            /* Release memory of complete screen at once */
+        }
+    }
+#else /* GUI_CFG_USE_MEM_ARENA */
+    WIDGET_FREE(h);                                 /* Free memory for widget */
+#endif /* !GUI_CFG_USE_MEM_ARENA */
+    
+    return 1;                                       /* Widget deleted */
+}
+
+/**
+ * \brief           Get nesting level of widget
+ * \param[in]       h: Widget handle or `NULL`
+ * \return          Number of widgets from widget to root, including widget itself. `0` for `NULL`
+ */
+static size_t
+get_widget_depth(gui_handle_p h) {
+    size_t depth = 0;
+    
+    for (; h != NULL; h = guii_widget_getparent(h)) {
+        depth++;
+    }
+    return depth;
+}
+
+/**
+ * \brief           Remove widget together with all its children widgets
+ *
+ *                  Tree is walked without recursion, first deepest child is always removed
+ *                  and walk continues from its parent
+ *
+ * \param[in]       h: Widget handle
+ */
+static void
+remove_widget_tree(gui_handle_p h) {
+    gui_handle_p c = h, p;
+    
+    /*
+     * Children widgets must be removed before parent
+     * as their linked list is part of parent widget memory
+     */
+    for (;;) {
+        while (guii_widget_haschildren(c)) {
+            c = gui_linkedlist_widgetgetnext(c, NULL);
+        }
+        if (c == h) {
             break;
         }
+        p = guii_widget_getparent(c);               /* Save parent before current is removed */
+        remove_widget(c);
+        c = p;
+    }
+    remove_widget(h);                               /* Remove widget itself */
+}
+
+/**
+ * \brief           Get vidget visible X, Y and width, height values on screen
+ * 
+ *                  It will calculate where widget is (including scrolling).
+ *
+ * \param[in]       h: Widget handle
+ * \param[out]      x1: Output variable to save top left X position on screen
+ * \param[out]      y1: Output variable to save top left Y position on screen
+ * \param[out]      x2: Output variable to save bottom right X position on screen
+ * \param[out]      y2: Output variable to save bottom right Y position on screen
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+get_widget_abs_visible_position_size(gui_handle_p h, gui_dim_t* x1, gui_dim_t* y1, gui_dim_t* x2, gui_dim_t* y2) {
+#if GUI_CFG_USE_POS_SIZE_CACHE
+    guii_widget_updateabs(h);
+    *x1 = h->abs_visible_x1;
+    *y1 = h->abs_visible_y1;
+    *x2 = h->abs_visible_x2;
+    *y2 = h->abs_visible_y2;
+    return 1;
+#else /* GUI_CFG_USE_POS_SIZE_CACHE */
+    return calculate_widget_absolute_visible_position_size(h, x1, y1, x2, y2);
+#endif /* !GUI_CFG_USE_POS_SIZE_CACHE */
+}
+
+/**
+ * \brief           Get area of rectangle in units of pixels
+ * \param[in]       x1: Top left X position
+ * \param[in]       y1: Top left Y position
+ * \param[in]       x2: Bottom right X position
+ * \param[in]       y2: Bottom right Y position
+ * \return          Area in units of pixels
+ */
+static uint32_t
+get_rect_area(gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2) {
+    if (x2 <= x1 || y2 <= y1) {
+        return 0;
+    }
+    return (uint32_t)(x2 - x1) * (uint32_t)(y2 - y1);
+}
+
+/**
+ * \brief           Get area of union rectangle of 2 regions
+ * \param[in]       a: First region
+ * \param[in]       b: Second region
+ * \return          Area of bounding box covering both regions
+ */
+static uint32_t
+get_region_union_area(const gui_display_t* a, const gui_display_t* b) {
+    return get_rect_area(GUI_MIN(a->x1, b->x1), GUI_MIN(a->y1, b->y1), GUI_MAX(a->x2, b->x2), GUI_MAX(a->y2, b->y2));
+}
+
+/**
+ * \brief           Expand first region to cover second region too
+ * \param[in,out]   a: Region to expand
+ * \param[in]       b: Region to include
+ */
+static void
+merge_region(gui_display_t* a, const gui_display_t* b) {
+    a->x1 = GUI_MIN(a->x1, b->x1);
+    a->y1 = GUI_MIN(a->y1, b->y1);
+    a->x2 = GUI_MAX(a->x2, b->x2);
+    a->y2 = GUI_MAX(a->y2, b->y2);
+}
+
+/**
+ * \brief           Add new dirty region to list of regions for next redraw
+ *
+ *                  Region is merged with existing one when union does not cover more pixels
+ *                  than both regions drawn separately. When list is full, region is merged
+ *                  with entry which grows the least.
+ *
+ * \param[in]       x1: Top left X position
+ * \param[in]       y1: Top left Y position
+ * \param[in]       x2: Bottom right X position
+ * \param[in]       y2: Bottom right Y position
+ */
+static void
+add_clipping_region(gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2) {
+    gui_display_t r;
+    gui_display_t* regs = GUI.display_regions;
+    size_t i, best;
+    uint32_t cost, best_cost;
+    uint8_t merged;
+
+    if (x2 <= x1 || y2 <= y1) {                     /* Nothing to redraw */
+        return;
+    }
+    r.x1 = x1;
+    r.y1 = y1;
+    r.x2 = x2;
+    r.y2 = y2;
+
+    /* Merge with any region where union is not bigger than regions itself */
+    do {
+        merged = 0;
+        for (i = 0; i < GUI.display_regions_count; i++) {
+            if (get_region_union_area(&regs[i], &r) <= 
+                get_rect_area(regs[i].x1, regs[i].y1, regs[i].x2, regs[i].y2) + get_rect_area(r.x1, r.y1, r.x2, r.y2)) {
+                merge_region(&r, &regs[i]);         /* Take region with us */
+                regs[i] = regs[--GUI.display_regions_count];    /* Remove entry from list */
+                merged = 1;                         /* New region may now cover other entries too */
+                break;
+            }
+        }
+    } while (merged);
+
+    if (GUI.display_regions_count < GUI_COUNT_OF(GUI.display_regions)) {
+        regs[GUI.display_regions_count++] = r;      /* Add new entry to list */
+        return;
+    }
+
+    /* List is full, find entry which grows the least */
+    best = 0;
+    best_cost = (uint32_t)-1;
+    for (i = 0; i < GUI.display_regions_count; i++) {
+        cost = get_region_union_area(&regs[i], &r) - get_rect_area(regs[i].x1, regs[i].y1, regs[i].x2, regs[i].y2);
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = i;
+        }
+    }
+    merge_region(&regs[best], &r);
+}
+
+/**
+ * \brief           Expand clipping region and add dirty region for next redraw
+ * \param[in]       x1: Top left X position
+ * \param[in]       y1: Top left Y position
+ * \param[in]       x2: Bottom right X position
+ * \param[in]       y2: Bottom right Y position
+ */
+static void
+add_dirty_area(gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2) {
+    /* Set invalid clipping region */
+    if (GUI.display.x1 > x1)    { GUI.display.x1 = x1; }
+    if (GUI.display.x2 < x2)    { GUI.display.x2 = x2; }
+    if (GUI.display.y1 > y1)    { GUI.display.y1 = y1; }
+    if (GUI.display.y2 < y2)    { GUI.display.y2 = y2; }
+    
+    add_clipping_region(x1, y1, x2, y2);            /* Add region to list of dirty regions */
+}
+
+/**
+ * \brief           Set clipping region for visible part of widget
+ * \param[in]       h: Widget handle
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+set_clipping_region(gui_handle_p h) {
+    gui_dim_t x1, y1, x2, y2;
+    
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+    
+    /*
+     * Widgets may change their own setup in draw event (keyboard buttons set text).
+     * Region currently drawn is also used as clipping and must not grow beyond layer memory
+     */
+    if (GUI.redrawing) {
+        return 1;
+    }
+    
+    /* Get visible widget part and absolute position on screen according to parent */
+    get_widget_abs_visible_position_size(h, &x1, &y1, &x2, &y2);
+    
+    /* Possible improvement */
+    /*
+     * If widget has direct children widgets which are not transparent,
+     * it is possible to limit clipping region for update process to only
+     * part of widget which is actually visible on screen.
+     *
+     * This may only work if padding is 0 and widget position wasn't changed
+     */
+
+#if GUI_CFG_USE_POPUP_RESTORE
+    if (popup_check_area(h, x1, y1, x2, y2)) {
+        return 1;                                   /* Area is restored from saved pixels */
+    }
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+    add_dirty_area(x1, y1, x2, y2);
+    
+    return 1;
+}
+
+/**
+ * \brief           Notify stack about pending redraw operation
+ */
+static void
+set_redraw_pending(void) {
+#if GUI_CFG_REDRAW_COALESCE_TIME
+    if (!(GUI.flags & GUI_FLAG_REDRAW)) {
+        GUI.redraw_request_time = gui_sys_now();    /* Start coalescing window on first invalidation */
+    }
+#endif /* GUI_CFG_REDRAW_COALESCE_TIME */
+#if GUI_CFG_OS
+    if (!(GUI.flags & GUI_FLAG_REDRAW) && !GUI.OS.processing) {
+        guii_wakeup(GUI_SYS_WAKEUP_INVALIDATE);     /* Wakeup GUI thread for first pending redraw */
+    }
+#endif /* GUI_CFG_OS */
+#if GUI_CFG_USE_LATENCY
+    if (GUI.latency.state == GUI_LATENCY_DISPATCH) {
+        GUI.latency.state = GUI_LATENCY_INVALIDATED;    /* Measured touch has visible result */
+    }
+#endif /* GUI_CFG_USE_LATENCY */
+    GUI.flags |= GUI_FLAG_REDRAW;                   /* Notify stack about redraw operations */
+}
+
+/**
+ * \brief           Maximal number of separate rectangles tracked when propagating redraw to siblings
+ */
+#define INVALIDATE_SIBLING_RECTS        4
+
+/**
+ * \brief           Add rectangle to list of redrawn rectangles used for sibling overlap checks
+ * \param[in,out]   rects: List of rectangles
+ * \param[in,out]   cnt: Number of valid rectangles in list
+ * \param[in]       r: Rectangle to add
+ */
+static void
+add_redrawn_rect(gui_display_t* rects, size_t* cnt, const gui_display_t* r) {
+    if (*cnt < INVALIDATE_SIBLING_RECTS) {
+        rects[(*cnt)++] = *r;
+    } else {                                        /* Expand last rectangle */
+        rects[*cnt - 1].x1 = GUI_MIN(rects[*cnt - 1].x1, r->x1);
+        rects[*cnt - 1].y1 = GUI_MIN(rects[*cnt - 1].y1, r->y1);
+        rects[*cnt - 1].x2 = GUI_MAX(rects[*cnt - 1].x2, r->x2);
+        rects[*cnt - 1].y2 = GUI_MAX(rects[*cnt - 1].y2, r->y2);
+    }
+}
+
+/**
+ * \brief           Set redraw flag to sibling widgets on top of widget which overlap redrawn area
+ *
+ *                  Siblings are processed once in z-order. Widget is redrawn when it overlaps
+ *                  any widget already set for redraw and its area is then added to redrawn area.
+ *                  Redrawn area is kept as few rectangles, when list is full last one is expanded
+ *
+ * \param[in]       h: Widget handle which is redrawn
+ * \param[in]       area: Absolute area of widget which is redrawn. Set to `NULL` for complete widget
+ * \return          `1` if transparent widget is set for redraw and parent must be redrawn below it, `0` otherwise
+ */
+static uint8_t
+invalidate_siblings_above(gui_handle_p h, const gui_display_t* area) {
+    gui_display_t rects[INVALIDATE_SIBLING_RECTS], r;
+    size_t cnt = 1, i;
+    uint8_t ret = 0;
+#if GUI_CFG_USE_WIDGET_GRID
+    uint32_t mask;
+#endif /* GUI_CFG_USE_WIDGET_GRID */
+    
+    get_widget_abs_visible_position_size(h, &rects[0].x1, &rects[0].y1, &rects[0].x2, &rects[0].y2);
+    if (area != NULL) {                             /* Only part of widget is redrawn */
+        rects[0].x1 = GUI_MAX(rects[0].x1, area->x1);
+        rects[0].y1 = GUI_MAX(rects[0].y1, area->y1);
+        rects[0].x2 = GUI_MIN(rects[0].x2, area->x2);
+        rects[0].y2 = GUI_MIN(rects[0].y2, area->y2);
+    }
+#if GUI_CFG_USE_WIDGET_GRID
+    mask = h->grid_mask;                            /* Grid cells of redrawn area */
+#endif /* GUI_CFG_USE_WIDGET_GRID */
+    for (h = gui_linkedlist_widgetgetnext(NULL, h); h != NULL; h = gui_linkedlist_widgetgetnext(NULL, h)) {
+        if (guii_widget_ishidden(h) || guii_widget_getflag(h, GUI_FLAG_OVERLAY)) {  /* Hidden widget is not drawn, overlay is on own plane */
+            continue;
+        }
+        get_widget_abs_visible_position_size(h, &r.x1, &r.y1, &r.x2, &r.y2);
+#if GUI_CFG_USE_WIDGET_GRID
+        if (!(h->grid_mask & mask)) {               /* Fast check for widgets far away from redrawn area */
+            continue;
+        }
+#endif /* GUI_CFG_USE_WIDGET_GRID */
+        for (i = 0; i < cnt; i++) {
+            if (GUI_RECT_MATCH(rects[i].x1, rects[i].y1, rects[i].x2, rects[i].y2, r.x1, r.y1, r.x2, r.y2)) {
+                break;
+            }
+        }
+        if (i == cnt) {                             /* Widget is not over redrawn area */
+            continue;
+        }
+        guii_widget_setflag(h, GUI_FLAG_REDRAW);    /* Redraw widget on next loop */
+#if GUI_CFG_USE_WIDGET_GRID
+        mask |= h->grid_mask;
+#endif /* GUI_CFG_USE_WIDGET_GRID */
+#if GUI_CFG_USE_ALPHA
+        if (guii_widget_hasalpha(h)) {              /* Transparent widget is blended over content below */
+            ret = 1;
+        }
+#endif /* GUI_CFG_USE_ALPHA */
+        
+        add_redrawn_rect(rects, &cnt, &r);          /* Widgets above must be checked against this widget too */
+    }
+    return ret;
+}
+
+/**
+ * \brief           Invalidate single widget and set redraw flag
+ * \note            Parent widgets which must be invalidated too are returned instead of invalidated
+ * \param[in]       h: Widget handle
+ * \param[in]       setclipping: When set to 1, clipping region will be expanded to widget size
+ * \param[in]       area: Absolute area of widget to redraw, used to check overlapping widgets.
+ *                      Set to `NULL` to redraw complete widget
+ * \param[out]      up: Parent widget to invalidate next or `NULL`
+ * \param[out]      alpha: Transparent parent widget to invalidate or `NULL`, covered by `up` when invalidated completely
+ * \return          `0` when widget is ignored, `1` when processing stopped at widget, `2` when parents must be checked
+ */
+static uint8_t
+invalidate_widget_single(gui_handle_p h, uint8_t setclipping, const gui_display_t* area, gui_handle_p* up, gui_handle_p* alpha) {
+    gui_handle_p h1;
+    
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+
+    /* Check ignore flag */
+    if (guii_widget_getflag(h, GUI_FLAG_IGNORE_INVALIDATE)) {
+        return 0;
+    }
+#if GUI_CFG_USE_POPUP_RESTORE
+    if (setclipping && GUI.popup_state == GUI_POPUP_RESTORE && is_popup_content(h)) {
+        return 1;                                   /* Area of closed popup is restored from saved pixels */
+    }
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+
+    /*
+     * First check if any of parent widgets are hidden = ignore redraw
+     *
+     * When widget is invalidated for first first time,
+     * ignore this check and force widget invalidation to create absolute visible positions for later usage
+     */
+#if GUI_CFG_USE_POS_SIZE_CACHE
+    if (!guii_widget_getflag(h, GUI_FLAG_FIRST_INVALIDATE)) 
+#endif /* GUI_CFG_USE_POS_SIZE_CACHE */
+    {
+        if (guii_widget_hasparent(h) && guii_widget_ishiddentree(guii_widget_getparent(h))) {
+            return 1;
+        }
+    }
+    guii_widget_clrflag(h, GUI_FLAG_FIRST_INVALIDATE);  /* Clear flag */
+
+#if GUI_CFG_USE_WIDGET_CACHE
+    /* Content of widget changed, cached layers of widget and its parents are not valid anymore */
+    for (h1 = h; h1 != NULL; h1 = guii_widget_getparent(h1)) {
+        guii_widget_clrflag(h1, GUI_FLAG_CACHE_VALID);
+    }
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+
+#if GUI_CFG_USE_OVERLAY
+    /* Widgets shown on overlay plane are rendered to plane buffer only, main layer is not affected */
+    for (h1 = h; h1 != NULL; h1 = guii_widget_getparent(h1)) {
+        if (guii_widget_getflag(h1, GUI_FLAG_OVERLAY)) {
+            guii_widget_setflag(h1, GUI_FLAG_REDRAW);
+            set_redraw_pending();
+            return 1;
+        }
+    }
+#endif /* GUI_CFG_USE_OVERLAY */
+    
+    /* Only record widget when batch is active, process it on batch end */
+    if (GUI.invalidate_batch) {
+        guii_widget_setflag(h, GUI_FLAG_INVALIDATE_BATCH | (setclipping ? GUI_FLAG_INVALIDATE_BATCH_CLIP : 0));
+        GUI.invalidate_batch_pending = 1;
+        return 1;
+    }
+        
+    h1 = h;                                         /* Save temporary */
+    guii_widget_setflag(h1, GUI_FLAG_REDRAW);       /* Redraw widget */
+    set_redraw_pending();                           /* Notify stack about redraw operations */
+    
+    if (setclipping) {
+        set_clipping_region(h);                     /* Set clipping region for widget redrawing operation */
+    }
+
+    /*
+     * Invalid only widget with higher Z-index (lowered on linked list) of current object
+     * 
+     * If widget should be redrawn, then any widget above it should be redrawn too, otherwise z-index match will fail.
+     *
+     * Widget may not need redraw operation if positions don't match
+     *
+     * If widget is transparent, check all widgets, even those which are below current widget in list
+     * Get first element of parent linked list for checking
+     */
+#if GUI_CFG_USE_ALPHA
+    if (guii_widget_hasalpha(h1) && guii_widget_hasparent(h1)) {
+        *up = guii_widget_getparent(h1);            /* Invalidate parent widget */
+    }
+#endif /* GUI_CFG_USE_ALPHA */
+    if (invalidate_siblings_above(h1, area) && guii_widget_hasparent(h1)) {
+        *up = guii_widget_getparent(h1);            /* Redraw content below transparent widget */
+    }
+    
+    /*
+     * If widget is not the last on the linked list (top z-index)
+     * check status of parent widget if it is last.
+     * If it is not, process parent redraw and check similar parent widgets if are over our widget
+     */
+    if (guii_widget_hasparent(h)) {
+        gui_handle_p ph = guii_widget_getparent(h);
+        if (!gui_linkedlist_iswidgetlast(ph)) {
+            *up = ph;
+        }
+    }
+
+#if GUI_CFG_USE_ALPHA    
+    /*
+     * Check if any of parent widgets has alpha = should be invalidated too
+     *
+     * Only first one is returned, its own parents are checked when it is invalidated
+     */
+    for (h = guii_widget_getparent(h); h != NULL; h = guii_widget_getparent(h)) {
+        if (guii_widget_hasalpha(h)) {              /* If widget has alpha */
+            *alpha = h;                             /* Invalidate parent too */
+            break;
+        }
+    }
+#endif /* GUI_CFG_USE_ALPHA */
+    
+    return 2;
+}
+
+/**
+ * \brief           Invalidate widget and set redraw flag
+ * \note            If widget is transparent, parent must be updated too. This function will handle these cases.
+ *
+ *                  Parents are invalidated in loop instead of recursion.
+ *                  When parent stops processing early, pending transparent parent is invalidated next
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       setclipping: When set to 1, clipping region will be expanded to widget size
+ * \param[in]       area: Absolute area of widget to redraw, used to check overlapping widgets.
+ *                      Set to `NULL` to redraw complete widget
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+invalidate_widget_area(gui_handle_p h, uint8_t setclipping, const gui_display_t* area) {
+    gui_handle_p up, alpha, pending = NULL;
+    uint8_t res, ret;
+    
+    up = alpha = NULL;
+    res = invalidate_widget_single(h, setclipping, area, &up, &alpha);
+    ret = res ? 1 : 0;
+    for (;;) {
+        if (res == 2) {                             /* Continue with parent, transparent one is covered by it */
+            pending = up != NULL ? alpha : NULL;
+            h = up != NULL ? up : alpha;
+        } else {                                    /* Parent stopped early, transparent parent was not reached */
+            h = pending != h ? pending : NULL;
+            pending = NULL;
+        }
+        if (h == NULL) {
+            break;
+        }
+        up = alpha = NULL;
+        res = invalidate_widget_single(h, 0, area, &up, &alpha);
+    }
+    return ret;
+}
+
+
+/**
+ * \brief           Invalidate complete widget and set redraw flag
+ * \param[in]       h: Widget handle
+ * \param[in]       setclipping: When set to 1, clipping region will be expanded to widget size
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+invalidate_widget(gui_handle_p h, uint8_t setclipping) {
+    return invalidate_widget_area(h, setclipping, NULL);
+}
+
+/**
+ * \brief           Process widgets recorded during invalidation batch
+ *
+ *                  Children lists are processed first as invalidated widget may require
+ *                  its parent to be invalidated too. Each list of siblings is then processed once in z-order,
+ *                  the same way as \ref invalidate_siblings_above does for single widget
+ *
+ * \param[in]       parent: Parent widget of list to process. Set to `NULL` for root list
+ * \return          `1` if at least one widget was set for redraw, `0` otherwise
+ */
+static uint8_t
+invalidate_batch_list(gui_handle_p parent) {
+    gui_display_t rects[INVALIDATE_SIBLING_RECTS], r;
+    gui_handle_p h, p;
+    size_t cnt = 0, i;
+    uint8_t ret = 0;
+    
+    GUI_LINKEDLIST_WIDGETSLISTNEXT(parent, h) {
+        if (guii_widget_haschildren(h)) {
+            ret |= invalidate_batch_list(h);
+        }
+    }
+    
+    GUI_LINKEDLIST_WIDGETSLISTNEXT(parent, h) {
+        if (guii_widget_getflag(h, GUI_FLAG_INVALIDATE_BATCH)) {
+            if (guii_widget_getflag(h, GUI_FLAG_INVALIDATE_BATCH_CLIP)) {
+                set_clipping_region(h);             /* Set clipping region for widget redrawing operation */
+            }
+            guii_widget_clrflag(h, GUI_FLAG_INVALIDATE_BATCH | GUI_FLAG_INVALIDATE_BATCH_CLIP);
+            
+            /* Parent must be invalidated when widget is transparent or parent is not on top */
+            if (parent != NULL && (!gui_linkedlist_iswidgetlast(parent) || guii_widget_hasalpha(h))) {
+                guii_widget_setflag(parent, GUI_FLAG_INVALIDATE_BATCH);
+            }
+#if GUI_CFG_USE_ALPHA
+            for (p = parent; p != NULL; p = guii_widget_getparent(p)) {
+                if (guii_widget_hasalpha(p)) {      /* Transparent parent must be invalidated too */
+                    guii_widget_setflag(p, GUI_FLAG_INVALIDATE_BATCH);
+                    break;
+                }
+            }
+#else /* GUI_CFG_USE_ALPHA */
+            GUI_UNUSED(p);
+#endif /* !GUI_CFG_USE_ALPHA */
+            get_widget_abs_visible_position_size(h, &r.x1, &r.y1, &r.x2, &r.y2);
+        } else {
+            if (!cnt || guii_widget_ishidden(h)) {  /* Nothing redrawn below or widget is not drawn */
+                continue;
+            }
+            get_widget_abs_visible_position_size(h, &r.x1, &r.y1, &r.x2, &r.y2);
+            for (i = 0; i < cnt; i++) {
+                if (GUI_RECT_MATCH(rects[i].x1, rects[i].y1, rects[i].x2, rects[i].y2, r.x1, r.y1, r.x2, r.y2)) {
+                    break;
+                }
+            }
+            if (i == cnt) {                         /* Widget is not over redrawn area */
+                continue;
+            }
+        }
+        guii_widget_setflag(h, GUI_FLAG_REDRAW);    /* Redraw widget on next loop */
+        add_redrawn_rect(rects, &cnt, &r);
+        ret = 1;
+    }
+    return ret;
+}
+
+/**
+ * \brief           Get widget by specific input parameters
+ * \param[in]       parent: Parent widget handle. Set to NULL to use root
+ * \param[in]       id: Widget id we are searching for in parent
+ * \param[in]       deep: Flag if search should go deeper to check for widget on parent tree
+ * \return          Widget handle on success, NULL otherwise
+ */
+static gui_handle_p
+get_widget_by_id(gui_handle_p parent, gui_id_t id, uint8_t deep) {
+    gui_handle_p h;
+    
+    /* List all widgets of parent*/
+    GUI_LINKEDLIST_WIDGETSLISTNEXT(parent, h) {
+        if (gui_widget_getid(h) == id) {
+            return h;
+        } else if (deep && guii_widget_haschildren(h)) {    /* Check children if possible */
+            gui_handle_p tmp = get_widget_by_id(h, id, deep);
+            if (tmp != NULL) {
+                return tmp;
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Get first common widget between 2 widgets in a tree
+ * \param[in]       h1: First widget handle
+ * \param[in]       h2: Second widget handle
+ * \return          First common widget handle on tree
+ */
+static gui_handle_p
+get_common_parentwidget(gui_handle_p h1, gui_handle_p h2) {
+    gui_handle_p tmp;
+    
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h1) && guii_widget_iswidget(h2)); 
+    
+    for (; h1 != NULL; h1 = guii_widget_getparent(h1)) {/* Process all entries */
+        for (tmp = h2; tmp != NULL; tmp = guii_widget_getparent(tmp)) {
+            if (h1 == tmp) {
+                return tmp;
+            }
+        }
+    }
+    return GUI.root.first;                          /* Return bottom widget on list */
+}
+
+/**
+ * \brief           Set widget size and invalidate approprite widgets if necessary
+ * \note            This function only sets width/height values, it does not change or modifies flags
+ * \param[in]       h: Widget handle
+ * \param[in]       x: Width in units of pixels or percents
+ * \param[in]       y: height in units of pixels or percents
+ * \param[in]       wp: Set to `1` if width unit is in percent
+ * \param[in]       hp: Set to `1` if height unit is in percent
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+set_widget_size(gui_handle_p h, gui_coord_t wi, gui_coord_t hi, uint8_t wp, uint8_t hp) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+    
+    if ( wi != h->width || hi != h->height ||       /* Check any differences */
+        (wp && !guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT)) ||  /* New width is in percent, old is not */
+        (!wp && guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT)) ||  /* New width is not in percent, old is */
+        (hp && !guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT)) || /* New height is in percent, old is not */
+        (!hp && guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT))    /* New height is not in percent, old is */
+    ) {
+        gui_dim_t wc, hc;
+        uint8_t is_flag;
+        
+        /* Changing position or size must force invalidation */
+        is_flag = !!guii_widget_getflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Get ignore invalidate flag */
+        guii_widget_clrflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Clear flag */
+#if GUI_CFG_USE_POPUP_RESTORE
+        if (GUI.popup_widget == h && GUI.popup_state != GUI_POPUP_RESTORE) {
+            popup_release();                        /* Saved area does not match opened popup anymore */
+        }
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+        
+        /* First invalidate current position if not expanded before change of size */
+        if (!gui_widget_isexpanded(h) && !guii_widget_getflag(h, GUI_FLAG_FIRST_INVALIDATE | GUI_FLAG_OVERLAY)) {
+            gui_widget_invalidatewithparent(h);     /* Set old clipping region first */
+        }
+        
+        /* Get current values */
+        wc = gui_widget_getwidth(h);                /* Get current width */
+        hc = gui_widget_getheight(h);               /* Get current height */
+        
+        /* Check percent flag */
+        if (wp) {
+            guii_widget_setflag(h, GUI_FLAG_WIDTH_PERCENT);
+        } else {
+            guii_widget_clrflag(h, GUI_FLAG_WIDTH_PERCENT);
+        }
+        if (hp) {
+            guii_widget_setflag(h, GUI_FLAG_HEIGHT_PERCENT);
+        } else {
+            guii_widget_clrflag(h, GUI_FLAG_HEIGHT_PERCENT);
+        }
+        
+        /* Set values for width and height */
+        h->width = wi;                              /* Set parameter */
+        h->height = hi;                             /* Set parameter */
+        SET_WIDGET_ABS_VALUES(h);                   /* Set widget absolute values */
+        SET_WIDGET_LAYOUT_DIRTY(h);                 /* Inner size changed */
+        SET_WIDGET_LAYOUT_DIRTY(guii_widget_getparent(h));  /* Measured size changed */
+        
+        /* Check if any of dimensions are bigger than before */
+        if (!gui_widget_isexpanded(h) && !guii_widget_getflag(h, GUI_FLAG_FIRST_INVALIDATE) &&
+            (gui_widget_getwidth(h) > wc || gui_widget_getheight(h) > hc)) {
+            gui_widget_invalidate(h);               /* Invalidate widget */
+        }
+#if GUI_CFG_USE_OVERLAY
+        if (guii_widget_getflag(h, GUI_FLAG_OVERLAY)) {
+            guii_widget_setflag(h, GUI_FLAG_REDRAW);/* Plane buffer is allocated again with new size */
+            set_redraw_pending();
+        }
+#endif /* GUI_CFG_USE_OVERLAY */
+        if (is_flag) {
+            guii_widget_setflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Set flag back */
+        }
+    }
+
+    return 1;
+}
+
+#if GUI_CFG_USE_COPY_MOVE || __DOXYGEN__
+
+/**
+ * \brief           Check if widget and its children are not waiting for redraw
+ * \param[in]       h: Widget handle
+ * \return          `1` if content on newest frame is up to date, `0` otherwise
+ */
+static uint8_t
+is_content_unchanged(gui_handle_p h) {
+    gui_handle_p c;
+    
+    if (guii_widget_getflag(h, GUI_FLAG_REDRAW | GUI_FLAG_INVALIDATE_BATCH)) {
+        return 0;
+    }
+    if (guii_widget_allowchildren(h)) {
+        GUI_LINKEDLIST_WIDGETSLISTNEXT(h, c) {
+            if (!is_content_unchanged(c)) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/**
+ * \brief           Check if widget pixels may be copied when it is moved
+ * \param[in]       h: Widget handle
+ * \return          `1` if widget is opaque, unchanged and drawn directly to main layer, `0` otherwise
+ */
+static uint8_t
+can_copy_move(gui_handle_p h) {
+    gui_handle_p p;
+    
+    if (GUI.redrawing || GUI.lcd.layer_count < 2 || !guii_widget_hasparent(h)
+        || (GUI.move_widget != NULL && GUI.move_widget != h)    /* Only one widget is moved per frame */
+        || !guii_widget_getcoreflag(h, GUI_FLAG_WIDGET_OPAQUE)
+        || guii_widget_getcoreflag(h, GUI_FLAG_WIDGET_INVALIDATE_PARENT)
+        || guii_widget_getflag(h, GUI_FLAG_WIDGET_INVALIDATE_PARENT)
+        || guii_widget_ishiddentree(h)) {
+        return 0;
+    }
+    for (p = h; p != NULL; p = guii_widget_getparent(p)) {
+        if (guii_widget_hasalpha(p) || guii_widget_getflag(p, GUI_FLAG_OVERLAY)
+            || (p != h && guii_widget_getflag(p, GUI_FLAG_CACHE))) {
+            return 0;
+        }
+    }
+    return is_content_unchanged(h);
+}
+
+/**
+ * \brief           Check if pixels of widget area may be shifted on newest frame instead of redrawn
+ * \param[in]       h: Widget handle
+ * \return          `1` if widget is drawn directly to main layer and is not moved, `0` otherwise
+ */
+static uint8_t
+can_copy_scroll(gui_handle_p h) {
+    gui_handle_p p;
+    
+    if (GUI.redrawing || GUI.lcd.layer_count < 2 || !guii_widget_hasparent(h)
+        || guii_widget_getcoreflag(h, GUI_FLAG_WIDGET_INVALIDATE_PARENT)
+        || guii_widget_getflag(h, GUI_FLAG_WIDGET_INVALIDATE_PARENT)
+        || guii_widget_ishiddentree(h)) {
+        return 0;
+    }
+    for (p = h; p != NULL; p = guii_widget_getparent(p)) {
+        if (p == GUI.move_widget || guii_widget_hasalpha(p)
+            || guii_widget_getflag(p, GUI_FLAG_OVERLAY) || guii_widget_getflag(p, GUI_FLAG_CACHE)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * \brief           Get area of moved widget and check if it is fully visible
+ * \param[in]       h: Widget handle
+ * \param[out]      r: Absolute area of widget on screen
+ * \return          `1` if widget is not clipped and no widget above overlaps it, `0` otherwise
+ */
+static uint8_t
+get_copy_move_area(gui_handle_p h, gui_display_t* r) {
+    gui_dim_t x1, y1, x2, y2;
+    gui_handle_p p, s;
+    
+    r->x1 = gui_widget_getabsolutex(h);
+    r->y1 = gui_widget_getabsolutey(h);
+    r->x2 = r->x1 + gui_widget_getwidth(h);
+    r->y2 = r->y1 + gui_widget_getheight(h);
+    get_widget_abs_visible_position_size(h, &x1, &y1, &x2, &y2);
+    if (x1 != r->x1 || y1 != r->y1 || x2 != r->x2 || y2 != r->y2
+        || r->x1 < 0 || r->y1 < 0 || r->x2 > GUI.lcd.width || r->y2 > GUI.lcd.height) {
+        return 0;                                   /* Part of widget is clipped */
+    }
+    
+    /* Widgets above widget and above any of its parents would be copied together or must be redrawn */
+    for (p = h; p != NULL; p = guii_widget_getparent(p)) {
+        for (s = gui_linkedlist_widgetgetnext(NULL, p); s != NULL; s = gui_linkedlist_widgetgetnext(NULL, s)) {
+            if (guii_widget_ishidden(s) || guii_widget_getflag(s, GUI_FLAG_OVERLAY)) {
+                continue;
+            }
+            get_widget_abs_visible_position_size(s, &x1, &y1, &x2, &y2);
+            if (GUI_RECT_MATCH(r->x1, r->y1, r->x2, r->y2, x1, y1, x2, y2)) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/**
+ * \brief           Check if area overlaps any region waiting for redraw
+ * \param[in]       r: Area to check
+ * \return          `1` if area is not up to date on newest frame, `0` otherwise
+ */
+static uint8_t
+is_area_dirty(const gui_display_t* r) {
+    size_t i;
+    
+    if (!GUI.display_regions_count) {               /* Widgets without clipping region use bounding box */
+        return GUI.display.x1 < GUI.display.x2
+            && GUI_RECT_MATCH(r->x1, r->y1, r->x2, r->y2, GUI.display.x1, GUI.display.y1, GUI.display.x2, GUI.display.y2);
+    }
+    for (i = 0; i < GUI.display_regions_count; i++) {
+        if (GUI_RECT_MATCH(r->x1, r->y1, r->x2, r->y2,
+            GUI.display_regions[i].x1, GUI.display_regions[i].y1, GUI.display_regions[i].x2, GUI.display_regions[i].y2)) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief           Redraw parent of widget in area of old position not covered by new position
+ * \param[in]       h: Moved widget handle
+ * \param[in]       o: Old area of widget
+ * \param[in]       n: New area of widget, set to `NULL` to redraw complete old area
+ */
+static void
+invalidate_uncovered(gui_handle_p h, const gui_display_t* o, const gui_display_t* n) {
+    gui_dim_t y1, y2;
+    
+#if GUI_CFG_USE_POPUP_RESTORE
+    popup_check_area(h, o->x1, o->y1, o->x2, o->y2);    /* Background of widget is uncovered */
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+    if (n == NULL || !GUI_RECT_MATCH(o->x1, o->y1, o->x2, o->y2, n->x1, n->y1, n->x2, n->y2)) {
+        add_dirty_area(o->x1, o->y1, o->x2, o->y2);
+    } else {
+        y1 = GUI_MAX(o->y1, n->y1);
+        y2 = GUI_MIN(o->y2, n->y2);
+        if (n->y1 > o->y1) {
+            add_dirty_area(o->x1, o->y1, o->x2, GUI_MIN(n->y1, o->y2)); /* Top strip */
+        }
+        if (n->y2 < o->y2) {
+            add_dirty_area(o->x1, GUI_MAX(n->y2, o->y1), o->x2, o->y2); /* Bottom strip */
+        }
+        if (y2 > y1 && n->x1 > o->x1) {
+            add_dirty_area(o->x1, y1, GUI_MIN(n->x1, o->x2), y2);   /* Left strip */
+        }
+        if (y2 > y1 && n->x2 < o->x2) {
+            add_dirty_area(GUI_MAX(n->x2, o->x1), y1, o->x2, y2);   /* Right strip */
+        }
+    }
+    invalidate_widget(guii_widget_getparent(h), 0); /* Parent and widgets below redraw uncovered area */
+    set_redraw_pending();                           /* Moved pixels are copied on next frame */
+}
+
+#endif /* GUI_CFG_USE_COPY_MOVE || __DOXYGEN__ */
+
+/**
+ * \brief           Set widget position and invalidate approprite widgets if necessary
+ * \param[in]       h: Widget handle
+ * \param[in]       x: X position in units of pixels or percents
+ * \param[in]       y: Y position in units of pixels or percents
+ * \param[in]       xp: Set to `1` if X position is in percent
+ * \param[in]       yp: Set to `1` if Y position is in percent
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+set_widget_position(gui_handle_p h, gui_coord_t x, gui_coord_t y, uint8_t xp, uint8_t yp) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+
+    if (h->x != x || h->y != y ||                   /* Check any differences */
+        (xp && !guii_widget_getflag(h, GUI_FLAG_XPOS_PERCENT)) ||   /* New X position is in percent, old is not */
+        (!xp && guii_widget_getflag(h, GUI_FLAG_XPOS_PERCENT)) ||   /* New X position is not in percent, old is */
+        (yp && !guii_widget_getflag(h, GUI_FLAG_YPOS_PERCENT)) ||   /* New Y position is in percent, old is not */
+        (!yp && guii_widget_getflag(h, GUI_FLAG_YPOS_PERCENT))      /* New Y position is not in percent, old is */
+    ) {
+        uint8_t is_flag;
+#if GUI_CFG_USE_COPY_MOVE
+        gui_display_t old_area, new_area;
+        uint8_t copy = 0;
+#endif /* GUI_CFG_USE_COPY_MOVE */
+
+        /* Changing position or size must force invalidation */
+        is_flag = !!guii_widget_getflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Get ignore invalidate flag */
+        guii_widget_clrflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Clear flag */
+#if GUI_CFG_USE_POPUP_RESTORE
+        if (GUI.popup_widget == h && GUI.popup_state != GUI_POPUP_RESTORE) {
+            popup_release();                        /* Saved area does not match opened popup anymore */
+        }
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+
+        if (!gui_widget_isexpanded(h) && !guii_widget_getflag(h, GUI_FLAG_FIRST_INVALIDATE | GUI_FLAG_OVERLAY)) {
+#if GUI_CFG_USE_COPY_MOVE
+            copy = can_copy_move(h) && get_copy_move_area(h, &old_area)
+                && (GUI.move_widget == h || !is_area_dirty(&old_area));  /* Pixels on newest frame must be up to date */
+            if (!copy) {
+                if (GUI.move_widget == h) {
+                    GUI.move_widget = NULL;         /* Content changed, redraw at both positions */
+                }
+                gui_widget_invalidatewithparent(h); /* Set old clipping region first */
+            }
+#else /* GUI_CFG_USE_COPY_MOVE */
+            gui_widget_invalidatewithparent(h);     /* Set old clipping region first */
+#endif /* !GUI_CFG_USE_COPY_MOVE */
+        }
+        
+        /* Set position flags */
+        if (xp) {
+            guii_widget_setflag(h, GUI_FLAG_XPOS_PERCENT);
+        } else {
+            guii_widget_clrflag(h, GUI_FLAG_XPOS_PERCENT);
+        }
+        if (yp) {
+            guii_widget_setflag(h, GUI_FLAG_YPOS_PERCENT);
+        } else {
+            guii_widget_clrflag(h, GUI_FLAG_YPOS_PERCENT);
+        }
+        
+        /* Set new position coordinates */
+        h->x = x;                                   /* Set parameter */
+        h->y = y;                                   /* Set parameter */
+        SET_WIDGET_ABS_VALUES(h);                   /* Set widget absolute values */
+        
+        if (!gui_widget_isexpanded(h) && !guii_widget_getflag(h, GUI_FLAG_FIRST_INVALIDATE | GUI_FLAG_OVERLAY)) {
+#if GUI_CFG_USE_COPY_MOVE
+            if (copy && get_copy_move_area(h, &new_area)) {
+                if (GUI.move_widget == NULL) {      /* Keep area on newest frame when moved again before redraw */
+                    GUI.move_widget = h;
+                    GUI.move_src = old_area;
+                }
+                invalidate_uncovered(h, &old_area, &new_area);
+            } else {
+                if (copy) {
+                    GUI.move_widget = NULL;
+                    invalidate_uncovered(h, &old_area, NULL);   /* Old position was not invalidated yet */
+                }
+                gui_widget_invalidatewithparent(h); /* Set new clipping region */
+            }
+#else /* GUI_CFG_USE_COPY_MOVE */
+            gui_widget_invalidatewithparent(h);     /* Set new clipping region */
+#endif /* !GUI_CFG_USE_COPY_MOVE */
+        }
+#if GUI_CFG_USE_OVERLAY
+        if (guii_widget_getflag(h, GUI_FLAG_OVERLAY)) {
+            set_redraw_pending();                   /* Only plane position changes */
+        }
+#endif /* GUI_CFG_USE_OVERLAY */
+        if (is_flag) {
+            guii_widget_setflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Set flag back */
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * \brief           Check if widget can be removed
+ * \param[in]       h: Widget handle
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+can_remove_widget(gui_handle_p h) {
+    gui_evt_result_t result = {0};
+    
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+    
+    /* Desktop window cannot be deleted */
+    if (h == gui_window_getdesktop()) {             /* Root widget can not be deleted! */
+        return 0;
+    }
+    
+    /* Check widget status itself */
+    GUI_EVT_RESULTTYPE_U8(&result) = 1;
+    if (!guii_widget_callback(h, GUI_EVT_REMOVE, NULL, &result) || GUI_EVT_RESULTTYPE_U8(&result)) { /* If command was not processed, allow delete */
+        GUI_EVT_RESULTTYPE_U8(&result) = 1;      /* Manually allow delete */
+    }
+    
+    /* Check children widgets recursively */
+    if (GUI_EVT_RESULTTYPE_U8(&result) && guii_widget_haschildren(h)) {
+        gui_handle_p h1;
+        GUI_LINKEDLIST_WIDGETSLISTNEXT(h, h1) {
+            if (!can_remove_widget(h1)) {           /* If we should not delete it */
+                return 0;                           /* Stop on first call */
+            }
+        }
+    }
+    
+    return GUI_EVT_RESULTTYPE_U8(&result);
+}
+
+/**
+ * \brief           Check if visible part of widget is inside clipping region for redraw
+ * \param[in]       h: Widget handle
+ * \param[in]       check_sib_cover: Set to `1` to check if any sibling is fully covering current widget
+ * \return          `1` on success, `0` otherwise
+ */
+GUI_CFG_FAST_CODE uint8_t
+guii_widget_isinsideclippingregion(gui_handle_p h, uint8_t check_sib_cover) {
+    gui_dim_t x1, y1, x2, y2;
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+    
+    /* Get widget visible section */
+    get_widget_abs_visible_position_size(h, &x1, &y1, &x2, &y2);
+
+    /* Check if widget is inside drawing area */
+    if (!GUI_RECT_MATCH(
+        x1, y1, x2, y2,
+        GUI.display.x1, GUI.display.y1, GUI.display.x2, GUI.display.y2
+    )) {
+        return 0;
+    }
+
+    /* 
+     * Seems like it is inside drawing area 
+     * Now check if this widget is fully hidden by any of its siblings.
+     * Check only widgets on linked list after current widget
+     */
+    if (check_sib_cover) {
+        gui_dim_t tx1, ty1, tx2, ty2;
+        gui_handle_p tmp;
+
+        /* Process all widgets after current one */
+        for (tmp = gui_linkedlist_widgetgetnext(NULL, h); tmp != NULL;
+            tmp = gui_linkedlist_widgetgetnext(NULL, tmp)) {
+
+            if (guii_widget_ishidden(tmp) || guii_widget_getflag(tmp, GUI_FLAG_OVERLAY)) {  /* Ignore hidden widgets and widgets on overlay plane */
+                continue;
+            }
+#if GUI_CFG_USE_WIDGET_GRID
+            guii_widget_updateabs(tmp);
+            if ((tmp->grid_mask & h->grid_mask) != h->grid_mask) {  /* Must cover all cells to cover widget */
+                continue;
+            }
+#endif /* GUI_CFG_USE_WIDGET_GRID */
+
+            /* Get display information for new widget */
+            get_widget_abs_visible_position_size(tmp, &tx1, &ty1, &tx2, &ty2);
+
+            /* Check if widget is inside */
+            if (GUI_RECT_IS_INSIDE(x1, y1, x2, y2, tx1, ty1, tx2, ty2) &&
+                !guii_widget_getflag(tmp, GUI_FLAG_WIDGET_INVALIDATE_PARENT) &&
+                !guii_widget_hasalpha(tmp)          /* Must not have transparency enabled */
+                ) {
+                return 0;                           /* Widget fully covered by another! */
+            }
+        }
+    }
+
+    return 1;                                       /* We have to draw it */
+}
+
+/**
+ * \brief           Publish new value to readers in other threads
+ *
+ *                  Value is kept in `2` copies. Odd sequence directs readers to second copy
+ *                  while first one is written and even sequence to first copy while second one is written,
+ *                  so reader never waits for writer it preempted
+ *
+ * \note            Only one writer at a time is allowed, normally GUI thread with core protection
+ * \param[in,out]   seq: Sequence counter of published value
+ * \param[out]      copies: Array of `2` copies of value, each `len` bytes long
+ * \param[in]       data: New value
+ * \param[in]       len: Size of value in units of bytes
+ */
+void
+guii_seqlock_write(gui_seqlock_t* seq, void* copies, const void* data, size_t len) {
+    uint8_t* c = copies;
+
+    ++*seq;                                         /* Readers switch to second copy */
+    GUI_CFG_MEMORY_BARRIER();
+    memcpy(c, data, len);
+    GUI_CFG_MEMORY_BARRIER();
+    ++*seq;                                         /* Readers switch back to updated first copy */
+    GUI_CFG_MEMORY_BARRIER();
+    memcpy(c + len, data, len);
+}
+
+/**
+ * \brief           Read value published with \ref guii_seqlock_write
+ * \note            Function does not use core protection and may be called from any thread.
+ *                  It retries only when writer modified value during the copy
+ * \param[in]       seq: Sequence counter of published value
+ * \param[in]       copies: Array of `2` copies of value, each `len` bytes long
+ * \param[out]      data: Pointer to save consistent value to
+ * \param[in]       len: Size of value in units of bytes
+ */
+void
+guii_seqlock_read(const gui_seqlock_t* seq, const void* copies, void* data, size_t len) {
+    uint32_t s;
+
+    do {
+        s = *seq;
+        GUI_CFG_MEMORY_BARRIER();
+        memcpy(data, (const uint8_t *)copies + (s & 0x01) * len, len);
+        GUI_CFG_MEMORY_BARRIER();
+    } while (s != *seq);                            /* Copy was overwritten meanwhile */
+}
+
+#if GUI_CFG_USE_WIDGET_CMD_QUEUE || __DOXYGEN__
+
+/**
+ * \brief           Command types in widget command queue
+ */
+typedef enum {
+    WIDGET_CMD_INT = 0x00,                          /*!< Setter with integer value */
+    WIDGET_CMD_TEXT,                                /*!< Setter with text value */
+} widget_cmd_type_t;
+
+/**
+ * \brief           Single entry in widget command queue
+ */
+typedef struct {
+    volatile size_t seq;                            /*!< Sequence number, tells if slot is free or holds published command */
+    gui_handle_p h;                                 /*!< Widget handle */
+    widget_cmd_type_t type;                         /*!< Command type */
+    union {
+        gui_widget_cmd_int_fn i;                    /*!< Integer setter */
+        gui_widget_cmd_text_fn t;                   /*!< Text setter */
+    } fn;                                           /*!< Setter function to call */
+    union {
+        int32_t i;                                  /*!< Integer value */
+        const gui_char* t;                          /*!< Text value */
+    } arg;                                          /*!< Value passed to setter */
+} widget_cmd_t;
+
+/*
+ * Bounded multi-producer single-consumer queue.
+ *
+ * Producers reserve position with compare and swap on write index
+ * and publish command by setting slot sequence to position + 1.
+ * Consumer (GUI thread) releases slot by setting sequence to position + queue size
+ */
+#define CMD_QUEUE_MASK              (GUI_CFG_WIDGET_CMD_QUEUE_SIZE - 1)
+static widget_cmd_t cmd_queue[GUI_CFG_WIDGET_CMD_QUEUE_SIZE];
+static widget_cmd_t cmd_batch[GUI_CFG_WIDGET_CMD_QUEUE_SIZE];
+static volatile size_t cmd_in;                      /* Reserved write position, modified by producers */
+static size_t cmd_out;                              /* Read position, modified by consumer only */
+
+/**
+ * \brief           Add command to queue without core protection
+ * \param[in]       cmd: Command to add, sequence field is ignored
+ * \return          `1` on success, `0` if queue is full
+ */
+static uint8_t
+cmd_post(const widget_cmd_t* cmd) {
+    widget_cmd_t* slot;
+    size_t pos, seq;
+    
+    for (pos = cmd_in;;) {
+        slot = &cmd_queue[pos & CMD_QUEUE_MASK];
+        seq = slot->seq;
+        if (seq == pos) {                           /* Slot is free for this position */
+            if (GUI_CFG_ATOMIC_CAS(&cmd_in, pos, pos + 1)) {
+                break;
+            }
+        } else if ((ptrdiff_t)(seq - pos) < 0) {    /* Slot still holds command from previous round */
+            return 0;
+        }
+        pos = cmd_in;                               /* Other producer was faster, try again */
+    }
+    slot->h = cmd->h;
+    slot->type = cmd->type;
+    slot->fn = cmd->fn;
+    slot->arg = cmd->arg;
+    GUI_CFG_MEMORY_BARRIER();                       /* Command must be stored before it is published */
+    slot->seq = pos + 1;
+#if GUI_CFG_OS
+    guii_wakeup(GUI_SYS_WAKEUP_WIDGET);             /* Wakeup GUI thread */
+#endif /* GUI_CFG_OS */
+    return 1;
+}
+
+/**
+ * \brief           Apply commands posted from other threads
+ * \note            Of consecutive commands with the same widget and setter function only the last one is applied
+ * \note            This function is private and may be called only when OS protection is active
+ * \return          `1` if at least one command was applied, `0` otherwise
+ */
+uint8_t
+guii_widget_executecommands(void) {
+    widget_cmd_t* slot;
+    size_t cnt, i, j;
+    
+    /* Move published commands to batch and release slots to producers */
+    for (cnt = 0; cnt < GUI_CFG_WIDGET_CMD_QUEUE_SIZE; cnt++) {
+        slot = &cmd_queue[cmd_out & CMD_QUEUE_MASK];
+        if (slot->seq != cmd_out + 1) {             /* Not published yet */
+            break;
+        }
+        GUI_CFG_MEMORY_BARRIER();                   /* Read command only after it was published */
+        cmd_batch[cnt] = *slot;
+        GUI_CFG_MEMORY_BARRIER();                   /* Command must be read before slot is released */
+        slot->seq = cmd_out + GUI_CFG_WIDGET_CMD_QUEUE_SIZE;
+        cmd_out++;
+    }
+    
+    for (i = 0; i < cnt; i++) {
+        gui_handle_p h = cmd_batch[i].h;
+        
+        for (j = i + 1; j < cnt; j++) {             /* Skip command when newer one overrides it */
+            if (cmd_batch[j].h == h && cmd_batch[j].type == cmd_batch[i].type
+                && (cmd_batch[i].type == WIDGET_CMD_INT ? cmd_batch[j].fn.i == cmd_batch[i].fn.i : cmd_batch[j].fn.t == cmd_batch[i].fn.t)) {
+                break;
+            }
+        }
+        if (j < cnt || h == NULL || !guii_widget_iswidget(h) || guii_widget_getflag(h, GUI_FLAG_REMOVE)) {
+            continue;
+        }
+        if (cmd_batch[i].type == WIDGET_CMD_INT) {
+            cmd_batch[i].fn.i(h, cmd_batch[i].arg.i);
+        } else {
+            cmd_batch[i].fn.t(h, cmd_batch[i].arg.t);
+        }
+    }
+    return cnt > 0;
+}
+
+/**
+ * \brief           Drop published commands of widget before its memory is released
+ *
+ *                  Published slots are owned by consumer until it releases them, so handle
+ *                  is cleared in place. Commands posted after widget was removed are invalid
+ *                  as any other call with removed handle
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       h: Widget handle
+ */
+void
+guii_widget_dropcommands(gui_handle_p h) {
+    widget_cmd_t* slot;
+    size_t pos;
+    
+    for (pos = cmd_out; pos - cmd_out < GUI_CFG_WIDGET_CMD_QUEUE_SIZE; pos++) {
+        slot = &cmd_queue[pos & CMD_QUEUE_MASK];
+        if (slot->seq != pos + 1) {                 /* Not published yet */
+            break;
+        }
+        if (slot->h == h) {
+            slot->h = NULL;                         /* Command is skipped when applied */
+        }
+    }
+}
+
+#endif /* GUI_CFG_USE_WIDGET_CMD_QUEUE || __DOXYGEN__ */
+
+/**
+ * \brief           Init widget part of library
+ */
+void
+guii_widget_init(void) {
+#if GUI_CFG_USE_WIDGET_CMD_QUEUE
+    size_t i;
+    
+    for (i = 0; i < GUI_CFG_WIDGET_CMD_QUEUE_SIZE; i++) {
+        cmd_queue[i].seq = i;                       /* Slot is free for first position it maps to */
+    }
+#endif /* GUI_CFG_USE_WIDGET_CMD_QUEUE */
+    gui_window_createdesktop(GUI_ID_WINDOW_BASE, NULL);     /* Create base window object */
+}
+
+#if GUI_CFG_USE_WIDGET_BUILDER || __DOXYGEN__
+
+/**
+ * \brief           Run builder of first hidden widget waiting for it
+ * \return          `1` if builder was run, `0` if no widget is waiting
+ */
+uint8_t
+guii_widget_prebuild(void) {
+    gui_handle_p h, p;
+    
+    for (h = GUI.build_list; h != NULL; h = guii_widget_getext(h)->build_next) {
+        for (p = h; p != NULL && !guii_widget_getflag(p, GUI_FLAG_REMOVE); p = guii_widget_getparent(p)) {}
+        if (p == NULL) {                            /* Widget is not removed together with parent */
+            widget_build(h);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+#endif /* GUI_CFG_USE_WIDGET_BUILDER || __DOXYGEN__ */
+
+/**
+ * \brief           Execute remove, check all widgets with remove status
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+guii_widget_executeremove(void) {
+    gui_handle_p h, p, next, list = NULL;
+    
+    if (GUI.remove_list == NULL) {                  /* Anything to remove? */
+        return 0;
+    }
+    
+    /*
+     * Skip widgets with one of parents waiting for removal too,
+     * they are removed together with parent and
+     * their handles are not valid after parent is removed
+     */
+    for (h = GUI.remove_list; h != NULL; h = next) {
+        next = h->remove_next;
+        for (p = guii_widget_getparent(h); p != NULL && !guii_widget_getflag(p, GUI_FLAG_REMOVE);
+            p = guii_widget_getparent(p)) {}
+        if (p == NULL) {
+            h->remove_next = list;
+            list = h;
+        }
+    }
+    GUI.remove_list = NULL;
+    
+    for (h = list; h != NULL; h = next) {
+        next = h->remove_next;                      /* Save next before widget is removed */
+        remove_widget_tree(h);
+    }
+    
+#if GUI_CFG_OS
+    guii_wakeup(GUI_SYS_WAKEUP_WIDGET);             /* Notify about remove execution */
+#endif /* GUI_CFG_OS */
+    return 1;
+}
+
+#if GUI_CFG_USE_LAYOUT
+
+/**
+ * \brief           Arrange children widgets according to layout of widget
+ *
+ *                  Children are measured first from their (cached) size values
+ *                  and moved to position in layout. Size of arranged content is saved
+ *                  to be used as scroll limit without scanning children again.
+ *
+ * \param[in]       h: Widget handle with layout
+ */
+static void
+layout_arrange(gui_handle_p h) {
+    gui_layout_t* l = &guii_widget_getext(h)->layout;
+    gui_handle_p c;
+    gui_dim_t x = 0, y = 0, wi, hi, cell = 0, line = 0;
+    uint8_t col = 0;
+    
+    if (l->mode == GUI_LAYOUT_GRID) {               /* Equal width of cells over inner width */
+        cell = GUI_MAX(0, (gui_widget_getinnerwidth(h) - (l->columns - 1) * l->gap) / l->columns);
+    }
+    l->content_width = 0;
+    l->content_height = 0;
+    GUI_LINKEDLIST_WIDGETSLISTNEXT(h, c) {
+        if (guii_widget_getflag(c, GUI_FLAG_HIDDEN | GUI_FLAG_EXPANDED)) {
+            continue;                               /* Widget does not take space in layout */
+        }
+        
+        /* Measure */
+        wi = gui_widget_getwidth(c);
+        hi = gui_widget_getheight(c);
+        
+        /* Arrange, nothing is invalidated when position does not change */
+        set_widget_position(c, GUI_COORD(x), GUI_COORD(y), 0, 0);
+        l->content_width = GUI_MAX(l->content_width, x + wi);
+        l->content_height = GUI_MAX(l->content_height, y + hi);
+        
+        switch (l->mode) {
+            case GUI_LAYOUT_ROW:
+                x += wi + l->gap;
+                break;
+            case GUI_LAYOUT_COLUMN:
+                y += hi + l->gap;
+                break;
+            case GUI_LAYOUT_GRID:
+                line = GUI_MAX(line, hi);           /* Row is as high as highest cell */
+                if (++col >= l->columns) {
+                    col = 0;
+                    x = 0;
+                    y += line + l->gap;
+                    line = 0;
+                } else {
+                    x += cell + l->gap;
+                }
+                break;
+            default: break;
+        }
+    }
+}
+
+/**
+ * \brief           Arrange children of widgets marked with changed layout
+ * \param[in]       parent: Parent widget handle or `NULL` for root widgets
+ */
+static void
+layout_process_tree(gui_handle_p parent) {
+    gui_handle_p h;
+    
+    GUI_LINKEDLIST_WIDGETSLISTNEXT(parent, h) {
+        if (!GUI.layout_dirty_count) {              /* Stop when all layouts are valid */
+            return;
+        }
+        if (guii_widget_getflag(h, GUI_FLAG_LAYOUT_DIRTY)) {
+            guii_widget_clrflag(h, GUI_FLAG_LAYOUT_DIRTY);
+            GUI.layout_dirty_count--;
+            layout_arrange(h);
+        }
+        if (guii_widget_haschildren(h)) {
+            layout_process_tree(h);
+        }
+    }
+}
+
+/**
+ * \brief           Arrange children of all widgets with changed layout
+ * \note            Arrange of widget only moves its children, sizes do not change.
+ *                  Layouts are independent and only widgets marked with changed layout are processed
+ */
+void
+guii_widget_layoutprocess(void) {
+    if (GUI.layout_dirty_count) {
+        layout_process_tree(NULL);
+    }
+}
+
+/**
+ * \brief           Get size of children widgets from last arrange pass
+ * \param[in]       h: Widget handle
+ * \param[out]      width: Output variable to save content width to
+ * \param[out]      height: Output variable to save content height to
+ * \return          `1` if widget uses layout and values are valid, `0` otherwise
+ */
+uint8_t
+guii_widget_getlayoutcontent(gui_handle_p h, gui_dim_t* width, gui_dim_t* height) {
+    if (guii_widget_getextvalue(h, layout.mode) == GUI_LAYOUT_NONE
+        || guii_widget_getflag(h, GUI_FLAG_LAYOUT_DIRTY)) {
+        return 0;
+    }
+    *width = guii_widget_getext(h)->layout.content_width;
+    *height = guii_widget_getext(h)->layout.content_height;
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_LAYOUT */
+
+/**
+ * \brief           Move widget down on linked list (put it as last, most visible on screen)
+ * \param[in]       h: Widget handle
+ */
+void
+guii_widget_movedowntree(gui_handle_p h) {              
+    /*
+     * Move widget to the end of parent linked list
+     * This will allow widget to be first checked next time for touch detection
+     * and will be drawn on top of al widgets as expected except if there is widget which allows children (new window or similar)
+     */
+    if (!guii_widget_islayoutchild(h) && gui_linkedlist_widgetmovetobottom(h)) {
+        gui_widget_invalidate(h);                   /* Invalidate object */
+    }
+    
+    /*
+     * Since linked list is threaded, we should move our widget to the end of parent list.
+     * The same should be in the parent as it should also be on the end of its parent and so on.
+     * With parent recursion this can be achieved
+     */
+    if (guii_widget_hasparent(h)) {                 /* Move its parent to the bottom of parent linked list */
+        gui_handle_p parent;
+        for (parent = guii_widget_getparent(h); parent != NULL;
+            parent = guii_widget_getparent(parent)) {
+            if (!guii_widget_islayoutchild(parent) && gui_linkedlist_widgetmovetobottom(parent)) {
+                gui_widget_invalidate(parent);
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Clear focus on widget
+ * \param[in]       h: Widget handle
+ */
+void
+guii_widget_focus_clear(void) {
+    if (GUI.focused_widget != NULL && GUI.focused_widget != GUI.root.first) { /* First widget is always in focus */
+        GUI.focused_widget_prev = GUI.focused_widget;   /* Clear everything */
+        do {
+            guii_widget_callback(GUI.focused_widget, GUI_EVT_FOCUSOUT, NULL, NULL);
+            guii_widget_clrflag(GUI.focused_widget, GUI_FLAG_FOCUS);
+            gui_widget_invalidate(GUI.focused_widget);
+            GUI.focused_widget = guii_widget_getparent(GUI.focused_widget);
+        } while (GUI.focused_widget != GUI.root.first); /* Loop to the bottom */
+        GUI.focused_widget = NULL;                  /* Reset focused widget */
+    }
+}
+
+/**
+ * \brief           Set widget as focused
+ * \param[in]       h: Widget handle
+ */
+void
+guii_widget_focus_set(gui_handle_p h) {
+    gui_handle_p common = NULL;
+
+    if (GUI.focused_widget == h || h == NULL) {     /* Check current focused widget */
+        return;
+    }
+    
+    /*
+     * TODO: Check if widget is in list for remove or any parent of it
+     */
+    
+    /*
+     * Step 1:
+     *
+     * Identify common parent from new and old focused widget
+     * Remove focused flag on widget which are not in tree between old and new widgets
+     */
+    if (GUI.focused_widget != NULL) {                /* We already have one widget in focus */
+        common = get_common_parentwidget(GUI.focused_widget, h); /* Get first widget in common */
+        if (common != NULL) {                       /* We have common object, invalidate only those which are not common in tree */
+            for (; 
+                GUI.focused_widget != NULL && common != NULL && GUI.focused_widget != common;
+                GUI.focused_widget = guii_widget_getparent(GUI.focused_widget)) {
+                guii_widget_clrflag(GUI.focused_widget, GUI_FLAG_FOCUS);    /* Clear focused flag */
+                guii_widget_callback(GUI.focused_widget, GUI_EVT_FOCUSOUT, NULL, NULL);  /* Notify with callback */
+                gui_widget_invalidate(GUI.focused_widget);  /* Invalidate widget */
+            }
+        }
+    } else {
+        common = GUI.root.first;                    /* Get bottom widget */
+    }
+    
+    /*
+     * Step 2:
+     *
+     * Set new widget as focused
+     * Set all widget from common to current as focused
+     */ 
+    GUI.focused_widget = h;                         /* Set new focused widget */
+    while (h != NULL && common != NULL && h != common) {
+        guii_widget_setflag(h, GUI_FLAG_FOCUS);     /* Set focused flag */
+        guii_widget_callback(h, GUI_EVT_FOCUSIN, NULL, NULL);   /* Notify with callback */
+        gui_widget_invalidate(h);                   /* Invalidate widget */
+        h = guii_widget_getparent(h);               /* Get parent widget */
+    }
+}
+
+/**
+ * \brief           Clear active status on widget
+ */
+void
+guii_widget_active_clear(void) {
+    if (GUI.active_widget != NULL) {
+        guii_widget_callback(GUI.active_widget, GUI_EVT_ACTIVEOUT, NULL, NULL);  /* Notify user about change */
+        guii_widget_clrflag(GUI.active_widget, GUI_FLAG_ACTIVE | GUI_FLAG_TOUCH_MOVE);  /* Clear all widget based flags */
+        GUI.active_widget_prev = GUI.active_widget; /* Save as previous active */
+        GUI.active_widget = NULL;                   /* Clear active widget handle */
+    }
+}
+
+/**
+ * \brief           Set widget as active
+ * \param[in]       h: Widget handle. When set to NULL, current active widget is cleared
+ */
+void
+guii_widget_active_set(gui_handle_p h) {
+    guii_widget_active_clear();                     /* Clear active widget flag */
+    GUI.active_widget = h;                          /* Set new active widget */
+    if (h != NULL) {
+        guii_widget_setflag(GUI.active_widget, GUI_FLAG_ACTIVE);    /* Set active widget flag */
+        guii_widget_callback(GUI.active_widget, GUI_EVT_ACTIVEIN, NULL, NULL);
+    }
+}
+
+/**
+ * \brief           Get absolute inner X position of parent widget
+ * \note            This function returns inner X position in absolute form.
+ *                     Imagine parent absolute X is 10, and left padding is 2. Function returns 12.
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       h: Widget handle for which parent should be calculated
+ * \return          Parent absolute inner X position
+ */
+gui_dim_t
+guii_widget_getparentabsolutex(gui_handle_p h) {
+    gui_dim_t out = 0;
+    
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+    
+    h = guii_widget_getparent(h);                   /* Get parent of widget */
+    if (h != NULL) {                                /* Save left padding */
+        out = gui_widget_getpaddingleft(h);         /* Get left padding from parent widget */
+    }
+    out += gui_widget_getabsolutex(h);              /* Add absolute X of parent and to current padding */
+    return out;
+}
+
+/**
+ * \brief           Get absolute inner Y position of parent widget
+ * \note            This function returns inner Y position in absolute form.
+ *                     Imagine parent absolute `Y = 10`, and `top padding = 2`. Function returns `12`
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       h: Widget handle for which parent should be calculated
+ * \return          Parent absolute inner Y position
+ */
+gui_dim_t
+guii_widget_getparentabsolutey(gui_handle_p h) {
+    gui_dim_t out = 0;
+    
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+    
+    h = guii_widget_getparent(h);                   /* Get parent of widget */
+    if (h != NULL) {                                /* Save left padding */
+        out = gui_widget_getpaddingtop(h);          /* Get top padding from parent widget */
+    }
+    out += gui_widget_getabsolutey(h);              /* Add absolute Y of parent and to current padding */
+    return out;
+}
+
+/**
+ * \brief           Get absolute `X` position on LCD for specific widget
+ * \param[in]       h: Widget handle
+ * \return          `X` position on screen in units of pixels
+ */
+gui_dim_t
+gui_widget_getabsolutex(gui_handle_p h) {   
+    if (h == NULL) {                                /* Check input value */
+        return 0;                                   /* At left value */
+    }
+#if GUI_CFG_USE_POS_SIZE_CACHE
+    guii_widget_updateabs(h);
+    return h->abs_x;                                /* Cached value */
+#else /* GUI_CFG_USE_POS_SIZE_CACHE */
+    return calculate_widget_absolute_x(h);          /* Calculate value */
+#endif /* !GUI_CFG_USE_POS_SIZE_CACHE */
+}
+
+/**
+ * \brief           Get absolute `Y` position on LCD for specific widget
+ * \param[in]       h: Widget handle 
+ * \return          `Y` position on screen in units of pixels
+ */
+gui_dim_t
+gui_widget_getabsolutey(gui_handle_p h) {
+    if (h == NULL) {                                /* Check input value */
+        return 0;                                   /* At left value */
+    }
+#if GUI_CFG_USE_POS_SIZE_CACHE
+    guii_widget_updateabs(h);
+    return h->abs_y;                                /* Cached value */
+#else /* GUI_CFG_USE_POS_SIZE_CACHE */
+    return calculate_widget_absolute_y(h);          /* Calculate value */
+#endif /* !GUI_CFG_USE_POS_SIZE_CACHE */
+}
+
+/**
+ * \brief           Get widget `X` position relative to parent in units of pixels
+ * \param[in]       h: Widget handle
+ * \return          Widget `X` position relative to parent
+ */
+gui_dim_t
+gui_widget_getxposition(gui_handle_p h) {
+    return gui_widget_getabsolutex(h) - guii_widget_getparentabsolutex(h);
+}
+
+/**
+ * \brief           Get widget `Y` position relative to parent in units of pixels
+ * \param[in]       h: Widget handle
+ * \return          Widget `Y` position relative to parent
+ */
+gui_dim_t
+gui_widget_getyposition(gui_handle_p h) {
+    return gui_widget_getabsolutey(h) - guii_widget_getparentabsolutey(h);
+}
+
+/**
+ * \brief           Invalidate widget and parent widget for redraw 
+ * \param[in]       h: Widget handle
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_invalidatewithparent(gui_handle_p h) {
+    uint8_t res;
+    
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+    
+#if GUI_CFG_USE_DISPLAY_LIST
+    invalidate_draw_list(h);
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+#if GUI_CFG_USE_POPUP_RESTORE
+    if (GUI.popup_state == GUI_POPUP_RESTORE && is_popup_content(h)) {
+        return 1;                                   /* Parent below closed popup is restored from saved pixels */
+    }
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+    res = invalidate_widget(h, 1);                  /* Invalidate object with clipping */
+    GUI_UNUSED(res);
+    if (guii_widget_hasparent(h)) {                 /* If parent exists, invalid only parent */
+        invalidate_widget(guii_widget_getparent(h), 0); /* Invalidate parent object without clipping */
+    }
+
+    return 1;
+}
+
+/**
+ * \brief           Start invalidation batch
+ *
+ *                  Until batch ends, invalidated widgets are only recorded.
+ *                  Overlap propagation and clipping regions are calculated once for all of them
+ *                  when \ref gui_widget_invalidate_end is called.
+ *
+ * \note            Batches may be nested, widgets are processed when last batch ends
+ * \return          `1` on success, `0` otherwise
+ * \sa              gui_widget_invalidate_end
+ */
+uint8_t
+gui_widget_invalidate_begin(void) {
+    GUI.invalidate_batch++;
+    return 1;
+}
+
+/**
+ * \brief           End invalidation batch and process all widgets invalidated during batch
+ * \return          `1` on success, `0` otherwise
+ * \sa              gui_widget_invalidate_begin
+ */
+uint8_t
+gui_widget_invalidate_end(void) {
+    GUI_ASSERTPARAMS(GUI.invalidate_batch > 0);
+    
+    if (--GUI.invalidate_batch == 0 && GUI.invalidate_batch_pending) {
+        GUI.invalidate_batch_pending = 0;
+        if (invalidate_batch_list(NULL)) {          /* Process all widgets */
+            set_redraw_pending();                   /* Notify stack about redraw operations */
+        }
+    }
+    return 1;
+}
+
+/**
+ * \brief           Set if parent widget should be invalidated when we invalidate primary widget
+ * \note            Useful for widgets where there is no background: Transparent images, textview, slider, etc
+ * \param[in]       h: Widget handle
+ * \param[in]       value: Set to `1` to invalidate parent widget when invalidating widget or `0` to invalidate only widget itself
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_setinvalidatewithparent(gui_handle_p h, uint8_t value) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+    
+    if (value) {                                    /* On positive value */
+        guii_widget_setflag(h, GUI_FLAG_WIDGET_INVALIDATE_PARENT); /* Enable auto invalidation of parent widget */
+    } else {                                        /* On zero */
+        guii_widget_clrflag(h, GUI_FLAG_WIDGET_INVALIDATE_PARENT); /* Disable auto invalidation of parent widget */
+    }
+
+    return 1;
+}
+
+/**
+ * \brief           Set widget parameter in OS secure way
+ * \param[in]       h: Widget handle
+ * \param[in]       cfg: Configuration to use, passed later to callback function
+ * \param[in]       data: Custom data to pass later to configuration callback
+ * \param[in]       invalidate: Flag if widget should be invalidated after parameter change
+ * \param[in]       invalidateparent: change if parent widget should be invalidated after parameter change
+ * \note            Invalidation is skipped when widget sets callback result to `0`, meaning value was not changed
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+guii_widget_setparam(gui_handle_p h, uint16_t cfg, const void* data, uint8_t invalidate, uint8_t invalidateparent) {
+    gui_widget_param p;
+    gui_evt_param_t param = {0};
+    gui_evt_result_t result = {0};
+
+    GUI_ASSERTPARAMS(h != NULL && guii_widget_iswidget(h));   
+    
+    GUI_EVT_PARAMTYPE_WIDGETPARAM(&param) = &p;
+    GUI_EVT_RESULTTYPE_U8(&result) = 1;
+    
+    p.type = cfg;
+    p.data = (void *)data;
+    
+    guii_widget_callback(h, GUI_EVT_SETPARAM, &param, &result); /* Process callback function */
+    if (!GUI_EVT_RESULTTYPE_U8(&result)) {          /* Widget reported unchanged parameter value */
+        return 1;                                   /* Nothing to redraw */
+    }
+    if (invalidateparent) {
+        gui_widget_invalidatewithparent(h);         /* Invalidate widget and parent */
+    } else if (invalidate) {
+        gui_widget_invalidate(h);                   /* Invalidate widget only */
+    }
+    
+    return 1;
+}
+
+/**
+ * \brief           Create new widget and add it to linked list to parent object
+ * \note            This function may only be called from widget create function, such as \ref gui_button_create or similar
+ * \param[in]       widget: Pointer to \ref gui_widget_t structure with widget description
+ * \param[in]       id: Widget unique ID to use for identity for callback processing
+ * \param[in]       x: Widget `X` position relative to parent widget
+ * \param[in]       y: Widget `Y` position relative to parent widget
+ * \param[in]       width: Widget width in units of pixels
+ * \param[in]       height: Widget height in units of pixels
+ * \param[in]       parent: Parent widget handle. Set to `NULL` to use current active parent widget
+ * \param[in]       evt_fn: Widget callback function. Set to `NULL` to use default widget specific callback
+ * \param[in]       flags: flags for create procedure
+ * \return          Widget handle on success, `NULL` otherwise
+ */
+void *
+gui_widget_create(const gui_widget_t* widget, gui_id_t id, float x, float y, float width, float height, gui_handle_p parent, gui_widget_evt_fn evt_fn, uint16_t flags) {
+    gui_handle_p h;
+#if GUI_CFG_MEM_TRACE
+    const char* tag;
+#endif /* GUI_CFG_MEM_TRACE */
+    
+    GUI_ASSERTPARAMS(widget != NULL && widget->callback != NULL);
+    
+    /* Allocation size check */
+    if (widget->size < sizeof(gui_handle)) { 
+        return 0;
+    }
+
+#if GUI_CFG_MEM_TRACE
+    tag = gui_mem_settag((const char *)widget->name);   /* Tag widget and all its init allocations with widget name */
+#endif /* GUI_CFG_MEM_TRACE */
+    h = WIDGET_ALLOC(widget);                       /* Allocate memory for widget */
+    if (h != NULL) {
+        gui_evt_param_t param = {0};
+        gui_evt_result_t result = {0};
+
+        h->id = id;                                 /* Save ID */
+        h->widget = widget;                         /* Widget object structure */
+        h->footprint = GUI_WIDGET_FOOTPRINT;        /* Set widget footprint */
+        h->callback = evt_fn;                       /* Set widget callback */
+#if GUI_CFG_USE_ALPHA
+        h->alpha = 0xFF;                            /* Set full transparency by default */
+#endif /* GUI_CFG_USE_ALPHA */
+        
+        /*
+         * Parent window check
+         *
+         * - Dialog's parent widget is desktop widget
+         * - If flag for parent desktop is set, parent widget is also desktop
+         * - Otherwise parent widget passed as parameter is used if it supports children widgets
+         */
+        if (flags & GUI_FLAG_WIDGET_CREATE_NO_PARENT) {
+            h->parent = NULL;
+        } else if (guii_widget_isdialogbase(h) || flags & GUI_FLAG_WIDGET_CREATE_PARENT_DESKTOP) {  /* Dialogs do not have parent widget */
+            h->parent = gui_window_getdesktop();    /* Set parent object */
+        } else {
+            if (parent != NULL && guii_widget_allowchildren(parent)) {
+                h->parent = parent;
+            } else {
+                h->parent = GUI.window_active;       /* Set parent object. It will be NULL on first call */
+            }
+        }
+        
+        /* Call pre-init function to set default widget parameters */
+        GUI_EVT_RESULTTYPE_U8(&result) = 1;
+        if (get_widget_depth(h->parent) >= GUI_CFG_WIDGET_DEPTH_MAX) {  /* Tree traversal stacks are limited in depth */
+            GUI_EVT_RESULTTYPE_U8(&result) = 0;
+        } else {
+            guii_widget_callback(h, GUI_EVT_PRE_INIT, NULL, &result);    /* Notify internal widget library about init successful */
+        }
+        
+        if (!GUI_EVT_RESULTTYPE_U8(&result)) {
+#if GUI_CFG_USE_COMPACT_HANDLE
+            if (h->ext != NULL) {
+                GUI_MEMFREE(h->ext);
+            }
+#endif /* GUI_CFG_USE_COMPACT_HANDLE */
+            WIDGET_FREE(h);
+            h = NULL;
+        }
+        
+        if (h != NULL) {
+            /* Set widget default values */
+            h->font = widget_default.font;          /* Set default font */
+
+            /* Do not invalidate widget while setting first size and position */
+            guii_widget_setflag(h, GUI_FLAG_FIRST_INVALIDATE);  /* Ignore invalidation process for size and position */
+            gui_widget_setsize(h, GUI_DIM(width), GUI_DIM(height)); /* Set widget size */
+            gui_widget_setposition(h, GUI_DIM(x), GUI_DIM(y));  /* Set widget position */
+            gui_widget_invalidate(h);               /* Force invalidation once we set size and position first time */
+            
+#if GUI_CFG_WIDGET_CREATE_IGNORE_INVALIDATE
+            flags |= GUI_FLAG_WIDGET_CREATE_IGNORE_INVALIDATE;  /* Add ignore invalidate flag */
+#endif /* GUI_CFG_WIDGET_CREATE_IGNORE_INVALIDATE */
+            guii_widget_setflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Ignore invalidation process */
+            if (!(flags & GUI_FLAG_WIDGET_CREATE_IGNORE_INVALIDATE)) {
+                guii_widget_clrflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Include invalidation process */
+            }
+
+            update_hidden_tree(h);                  /* Widget inherits hidden state of parents */
+
+            /* Add widget to linked list of parent widget */
+            GUI_EVT_RESULTTYPE_U8(&result) = 0;
+            guii_widget_callback(h, GUI_EVT_EXCLUDELINKEDLIST, NULL, &result);
+            if (!GUI_EVT_RESULTTYPE_U8(&result)) {   /* Check if widget should be added to linked list */
+                gui_linkedlist_widgetadd(h->parent, h); /* Add entry to linkedlist of parent widget */
+                SET_WIDGET_LAYOUT_DIRTY(h->parent); /* Place new child to parent layout */
+                guii_focus_invalidate();            /* New widget can receive focus */
+#if GUI_CFG_USE_WIDGET_ID_HASH
+                id_hash_add(h);                     /* Only widgets on tree can be found by ID */
+#endif /* GUI_CFG_USE_WIDGET_ID_HASH */
+            }
+            guii_widget_callback(h, GUI_EVT_INIT, NULL, NULL);  /* Notify user about init successful */
+            gui_widget_invalidate(h);               /* Invalidate object */
+
+            /* Notify parent widget if exists */
+            if (guii_widget_hasparent(h)) {         /* If widget has parent */
+                GUI_EVT_PARAMTYPE_HANDLE(&param) = h;   /* Set widget pointer */
+                guii_widget_callback(guii_widget_getparent(h), GUI_EVT_CHILDWIDGETCREATED, &param, NULL);/* Notify parent about new child widget */
+            }
+        }
+    }
+#if GUI_CFG_MEM_TRACE
+    gui_mem_settag(tag);
+#endif /* GUI_CFG_MEM_TRACE */
+
+    return (void *)h;
+}
+
+/*******************************************/
+/**                  .....                **/
+/*******************************************/
+
+/**
+ * \brief           Set color to widget specific index
+ * \param[in]       h: Widget handle
+ * \param[in]       index: Index in array of colors
+ * \param[in]       color: Actual color code to set
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_setcolor(gui_handle_p h, uint8_t index, gui_color_t color) {
+    gui_handle_ext_t* e;
+    uint8_t ret = 1;
+    
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+
+    if (index < h->widget->color_count && guii_widget_getcolor(h, index) == color) {
+        return 1;                                   /* Color is already set, nothing to do */
+    }
+    e = guii_widget_ext(h);
+    if (e == NULL) {
+        return 0;
+    }
+    if (e->colors == NULL || guii_widget_getflag(h, GUI_FLAG_CONST_COLORS)) {   /* Do we need to allocate color memory? */
+        if (h->widget->color_count) {               /* Check if at least some colors should be used */
+            gui_color_t* colors = GUI_MEMALLOC(sizeof(*colors) * h->widget->color_count);
+            if (colors != NULL) {                   /* Copy all colors to new memory first */
+                uint8_t i;
+                for (i = 0; i < h->widget->color_count; i++) {
+                    colors[i] = guii_widget_getcolor(h, i);
+                }
+                e->colors = colors;
+                guii_widget_clrflag(h, GUI_FLAG_CONST_COLORS);
+            } else {
+                ret = 0;
+            }
+        } else {
+            ret = 0;
+        }
+    }
+    if (ret) {
+        if (index < h->widget->color_count) {       /* Index in valid range */
+           e->colors[index] = color;                /* Set new color */
+           gui_widget_invalidate(h);                /* Redraw object with new color */
+        } else {
+            ret = 0;
+        }
+    }
+    
+    return ret;
+}
+
+/**
+ * \brief           Remove widget from memory
+ * \note            If widget has child widgets, they will be removed too
+ * \param[in,out]   h: Pointer to widget handle. If removed, pointer will be invalidated and set to `NULL`
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_remove(gui_handle_p* h) {
+    uint8_t ret = 0;
+    GUI_ASSERTPARAMS(h != NULL && guii_widget_iswidget(*h));  
+
+    if (can_remove_widget(*h)) {                    /* Check if we can delete widget */
+        if (!guii_widget_getflag(*h, GUI_FLAG_REMOVE)) {/* Add to pending list only once */
+            guii_widget_setflag(*h, GUI_FLAG_REMOVE);   /* Set flag for widget delete */
+            (*h)->remove_next = GUI.remove_list;
+            GUI.remove_list = *h;
+        }
+        if (guii_widget_isfocused(*h)) {            /* In case current widget is in focus */
+            guii_widget_focus_set(guii_widget_getparent(*h));   /* Set parent as focused */
+        }
+        ret = 1;
+        *h = NULL;
+#if GUI_CFG_OS
+        guii_wakeup(GUI_SYS_WAKEUP_WIDGET);         /* Wakeup GUI thread for removal */
+#endif /* GUI_CFG_OS */
     }
-#endif /* GUI_CFG_USE_ALPHA */
-    
-    return 1;
+
+    return ret;                                     /* Removed successfully */
 }
 
 /**
- * \brief           Get widget by specific input parameters
- * \param[in]       parent: Parent widget handle. Set to NULL to use root
- * \param[in]       id: Widget id we are searching for in parent
- * \param[in]       deep: Flag if search should go deeper to check for widget on parent tree
- * \return          Widget handle on success, NULL otherwise
+ * \brief           Get statistics of widget object pools
+ * \note            Use statistics to set number of widgets per pool for specific application
+ * \param[out]      stats: Pointer to array to write statistics to. Set to `NULL` to get only number of pools
+ * \param[in]       len: Number of entries in `stats` array
+ * \return          Number of created pools
  */
-static gui_handle_p
-get_widget_by_id(gui_handle_p parent, gui_id_t id, uint8_t deep) {
-    gui_handle_p h;
-    
-    /* List all widgets of parent*/
-    GUI_LINKEDLIST_WIDGETSLISTNEXT(parent, h) {
-        if (gui_widget_getid(h) == id) {
-            return h;
-        } else if (deep && guii_widget_haschildren(h)) {    /* Check children if possible */
-            gui_handle_p tmp = get_widget_by_id(h, id, deep);
-            if (tmp != NULL) {
-                return tmp;
-            }
+size_t
+gui_widget_getpoolstats(gui_widget_pool_stat_t* stats, size_t len) {
+    size_t cnt = 0;
+#if GUI_CFG_USE_WIDGET_POOL
+    GUI_CORE_PROTECT(1);
+    for (; cnt < GUI_CFG_WIDGET_POOL_TYPES && GUI.widget_pools[cnt].stat.widget != NULL; cnt++) {
+        if (stats != NULL && cnt < len) {
+            stats[cnt] = GUI.widget_pools[cnt].stat;
         }
     }
-    return NULL;
+    GUI_CORE_UNPROTECT(1);
+#else /* GUI_CFG_USE_WIDGET_POOL */
+    GUI_UNUSED(stats);
+    GUI_UNUSED(len);
+#endif /* !GUI_CFG_USE_WIDGET_POOL */
+    return cnt;
 }
 
 /**
- * \brief           Get first common widget between 2 widgets in a tree
- * \param[in]       h1: First widget handle
- * \param[in]       h2: Second widget handle
- * \return          First common widget handle on tree
+ * \brief           Start building screen in memory arena
+ *
+ *                  Widgets and their memory (colors, texts, timers, items) created until
+ *                  \ref gui_widget_arena_end is called are allocated from single arena block.
+ *                  When block is full, heap memory is used instead.
+ *
+ * \note            GUI is locked until \ref gui_widget_arena_end is called.
+ *                  Only widget create and setup functions should be called in between
+ * \param[in]       size: Arena size in units of bytes
+ * \return          `1` on success, `0` otherwise
  */
-static gui_handle_p
-get_common_parentwidget(gui_handle_p h1, gui_handle_p h2) {
-    gui_handle_p tmp;
+uint8_t
+gui_widget_arena_begin(size_t size) {
+    uint8_t ret = 0;
+#if GUI_CFG_USE_MEM_ARENA
+    gui_mem_arena_t* arena;
     
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h1) && guii_widget_iswidget(h2)); 
+    GUI_CORE_PROTECT(1);                            /* Released in end function */
+    arena = gui_mem_arena_create(size);
+    if (arena != NULL) {
+        gui_mem_arena_setactive(arena);
+        ret = 1;
+    } else {
+        GUI_CORE_UNPROTECT(1);
+    }
+#else /* GUI_CFG_USE_MEM_ARENA */
+    GUI_UNUSED(size);
+#endif /* !GUI_CFG_USE_MEM_ARENA */
+    return ret;
+}
+
+/**
+ * \brief           Finish building screen and attach arena to widget
+ * \note            Widget with attached arena must be top widget of all widgets created in arena,
+ *                  arena memory is released when this widget is removed
+ * \param[in]       h: Widget handle, usually window created first after \ref gui_widget_arena_begin
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_arena_end(gui_handle_p h) {
+    uint8_t ret = 0;
+#if GUI_CFG_USE_MEM_ARENA
+    gui_mem_arena_t* arena;
     
-    for (; h1 != NULL; h1 = guii_widget_getparent(h1)) {/* Process all entries */
-        for (tmp = h2; tmp != NULL; tmp = guii_widget_getparent(tmp)) {
-            if (h1 == tmp) {
-                return tmp;
-            }
+    arena = gui_mem_arena_setactive(NULL);          /* Next allocations use heap again */
+    if (arena != NULL) {
+        if (guii_widget_iswidget(h) && h->arena == NULL) {
+            h->arena = arena;
+            ret = 1;
         }
+        GUI_CORE_UNPROTECT(1);                      /* Protected in begin function */
     }
-    return GUI.root.first;                          /* Return bottom widget on list */
+#else /* GUI_CFG_USE_MEM_ARENA */
+    GUI_UNUSED(h);
+#endif /* !GUI_CFG_USE_MEM_ARENA */
+    return ret;
 }
 
 /**
- * \brief           Set widget size and invalidate approprite widgets if necessary
- * \note            This function only sets width/height values, it does not change or modifies flags
- * \param[in]       h: Widget handle
- * \param[in]       x: Width in units of pixels or percents
- * \param[in]       y: height in units of pixels or percents
- * \param[in]       wp: Set to `1` if width unit is in percent
- * \param[in]       hp: Set to `1` if height unit is in percent
- * \return          `1` on success, `0` otherwise
+ * \brief           Create all widgets from constant screen description table
+ *
+ *                  Widgets are created in table order within single invalidation batch.
+ *                  Parent entry must be placed in table before its children.
+ *                  Colors of entry are used directly from table, no memory is allocated for them
+ *                  until color is changed with \ref gui_widget_setcolor
+ *
+ * \note            Table is not copied, it must stay valid while widgets exist.
+ *                  It can be declared `const` and placed to read-only memory
+ * \param[in]       desc: Pointer to table of widget descriptions
+ * \param[in]       count: Number of entries in table
+ * \param[in]       parent: Parent widget for entries with parent index `-1`.
+ *                      Set to `NULL` to use current active parent widget
+ * \param[out]      handles: Array of `count` entries to write created handles to
+ * \return          Handle of first created widget on success, `NULL` otherwise.
+ *                      When any widget cannot be created, all widgets created by this call are removed
  */
-static uint8_t
-set_widget_size(gui_handle_p h, float wi, float hi, uint8_t wp, uint8_t hp) {
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+gui_handle_p
+gui_widget_createscreen(const gui_widget_desc_t* desc, size_t count, gui_handle_p parent, gui_handle_p* handles) {
+    gui_handle_p h, p, ret = NULL;
+    size_t i;
     
-    if ( wi != h->width || hi != h->height ||       /* Check any differences */
-        (wp && !guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT)) ||  /* New width is in percent, old is not */
-        (!wp && guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT)) ||  /* New width is not in percent, old is */
-        (hp && !guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT)) || /* New height is in percent, old is not */
-        (!hp && guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT))    /* New height is not in percent, old is */
-    ) {
-        gui_dim_t wc, hc;
-        uint8_t is_flag;
-        
-        /* Changing position or size must force invalidation */
-        is_flag = !!guii_widget_getflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Get ignore invalidate flag */
-        guii_widget_clrflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Clear flag */
-        
-        /* First invalidate current position if not expanded before change of size */
-        if (!gui_widget_isexpanded(h) && !guii_widget_getflag(h, GUI_FLAG_FIRST_INVALIDATE)) {
-            gui_widget_invalidatewithparent(h);     /* Set old clipping region first */
+    GUI_ASSERTPARAMS(desc != NULL && count > 0 && handles != NULL);
+    
+    GUI_CORE_PROTECT(1);
+    gui_widget_invalidate_begin();                  /* Calculate clipping once for entire screen */
+    for (i = 0; i < count; i++) {
+        p = parent;
+        if (desc[i].parent >= 0) {
+            if ((size_t)desc[i].parent >= i) {
+                break;                              /* Parent must be created first */
+            }
+            p = handles[desc[i].parent];
         }
-        
-        /* Get current values */
-        wc = gui_widget_getwidth(h);                /* Get current width */
-        hc = gui_widget_getheight(h);               /* Get current height */
-        
-        /* Check percent flag */
-        if (wp) {
-            guii_widget_setflag(h, GUI_FLAG_WIDTH_PERCENT);
-        } else {
-            guii_widget_clrflag(h, GUI_FLAG_WIDTH_PERCENT);
+        h = desc[i].create(desc[i].id, desc[i].x, desc[i].y, desc[i].width, desc[i].height, p, desc[i].evt_fn, desc[i].flags);
+        if (h == NULL) {
+            break;
         }
-        if (hp) {
-            guii_widget_setflag(h, GUI_FLAG_HEIGHT_PERCENT);
-        } else {
-            guii_widget_clrflag(h, GUI_FLAG_HEIGHT_PERCENT);
+        handles[i] = h;
+        if (desc[i].style != NULL) {
+            gui_widget_setstyle(h, desc[i].style);
         }
-        
-        /* Set values for width and height */
-        h->width = wi;                              /* Set parameter */
-        h->height = hi;                             /* Set parameter */
-        SET_WIDGET_ABS_VALUES(h);                   /* Set widget absolute values */
-        
-        /* Check if any of dimensions are bigger than before */
-        if (!gui_widget_isexpanded(h) && !guii_widget_getflag(h, GUI_FLAG_FIRST_INVALIDATE) &&
-            (gui_widget_getwidth(h) > wc || gui_widget_getheight(h) > hc)) {
-            gui_widget_invalidate(h);               /* Invalidate widget */
+        if (desc[i].colors != NULL && h->widget->color_count && guii_widget_hasext(h, 1)) {
+            if (guii_widget_getext(h)->colors != NULL && !guii_widget_getflag(h, GUI_FLAG_CONST_COLORS)) {
+                GUI_MEMFREE(guii_widget_getext(h)->colors); /* Colors set by widget init are replaced */
+            }
+            guii_widget_getext(h)->colors = (gui_color_t *)desc[i].colors;  /* Use colors from table */
+            guii_widget_setflag(h, GUI_FLAG_CONST_COLORS);
         }
-        if (is_flag) {
-            guii_widget_setflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Set flag back */
+        if (desc[i].font != NULL) {
+            h->font = desc[i].font;
+        }
+        if (desc[i].padding) {
+            h->padding = desc[i].padding;
+            SET_WIDGET_ABS_VALUES(h);
+        }
+        if (desc[i].text != NULL) {
+            gui_widget_settext(h, desc[i].text);
         }
+        gui_widget_invalidate(h);
     }
-
-    return 1;
+    if (i == count) {
+        ret = handles[0];
+    } else {                                        /* Failed, remove partially created screen */
+        while (i-- > 0) {
+            h = handles[i];
+            handles[i] = NULL;
+            if (desc[i].parent < 0) {               /* Children are removed together with parent */
+                gui_widget_remove(&h);
+            }
+        }
+    }
+    gui_widget_invalidate_end();
+    GUI_CORE_UNPROTECT(1);
+    
+    return ret;
 }
 
+#if GUI_CFG_USE_WIDGET_CLONE || __DOXYGEN__
+
+/* Widget flags describing state of single widget, not copied from prototype */
+#define CLONE_CLEAR_FLAGS               (GUI_FLAG_REDRAW | GUI_FLAG_ACTIVE | GUI_FLAG_FOCUS | GUI_FLAG_REMOVE \
+                                            | GUI_FLAG_FIRST_INVALIDATE | GUI_FLAG_TOUCH_MOVE | GUI_FLAG_ABS_DIRTY \
+                                            | GUI_FLAG_INVALIDATE_BATCH | GUI_FLAG_INVALIDATE_BATCH_CLIP \
+                                            | GUI_FLAG_CACHE_VALID | GUI_FLAG_OVERLAY | GUI_FLAG_LAYOUT_DIRTY)
+
 /**
- * \brief           Set widget position and invalidate approprite widgets if necessary
+ * \brief           Check if widget text is in heap memory owned by widget
  * \param[in]       h: Widget handle
- * \param[in]       x: X position in units of pixels or percents
- * \param[in]       y: Y position in units of pixels or percents
- * \param[in]       xp: Set to `1` if X position is in percent
- * \param[in]       yp: Set to `1` if Y position is in percent
- * \return          `1` on success, `0` otherwise
+ * \return          `1` if text memory is allocated from heap, `0` otherwise
  */
 static uint8_t
-set_widget_position(gui_handle_p h, float x, float y, uint8_t xp, uint8_t yp) {
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+clone_textonheap(gui_handle_p h) {
+    if (!guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC) || h->text == NULL) {
+        return 0;
+    }
+#if GUI_CFG_WIDGET_TEXT_INLINE_SIZE
+    return h->text != h->text_inline;
+#else /* GUI_CFG_WIDGET_TEXT_INLINE_SIZE */
+    return 1;
+#endif /* !GUI_CFG_WIDGET_TEXT_INLINE_SIZE */
+}
 
-    if (h->x != x || h->y != y ||                   /* Check any differences */
-        (xp && !guii_widget_getflag(h, GUI_FLAG_XPOS_PERCENT)) ||   /* New X position is in percent, old is not */
-        (!xp && guii_widget_getflag(h, GUI_FLAG_XPOS_PERCENT)) ||   /* New X position is not in percent, old is */
-        (yp && !guii_widget_getflag(h, GUI_FLAG_YPOS_PERCENT)) ||   /* New Y position is in percent, old is not */
-        (!yp && guii_widget_getflag(h, GUI_FLAG_YPOS_PERCENT))      /* New Y position is not in percent, old is */
-    ) {
-        uint8_t is_flag;
+#if GUI_CFG_USE_MEM_ARENA || __DOXYGEN__
 
-        /* Changing position or size must force invalidation */
-        is_flag = !!guii_widget_getflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Get ignore invalidate flag */
-        guii_widget_clrflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Clear flag */
+/**
+ * \brief           Get number of arena bytes needed to copy widget and all its children
+ * \param[in]       h: Prototype widget handle
+ * \return          Arena size in units of bytes
+ */
+static size_t
+clone_size(gui_handle_p h) {
+    gui_handle_p child;
+    size_t size;
 
-        if (!gui_widget_isexpanded(h) && !guii_widget_getflag(h, GUI_FLAG_FIRST_INVALIDATE)) {
-            gui_widget_invalidatewithparent(h);     /* Set old clipping region first */
-        }
-        
-        /* Set position flags */
-        if (xp) {
-            guii_widget_setflag(h, GUI_FLAG_XPOS_PERCENT);
-        } else {
-            guii_widget_clrflag(h, GUI_FLAG_XPOS_PERCENT);
-        }
-        if (yp) {
-            guii_widget_setflag(h, GUI_FLAG_YPOS_PERCENT);
-        } else {
-            guii_widget_clrflag(h, GUI_FLAG_YPOS_PERCENT);
-        }
-        
-        /* Set new position coordinates */
-        h->x = x;                                   /* Set parameter */
-        h->y = y;                                   /* Set parameter */
-        SET_WIDGET_ABS_VALUES(h);                   /* Set widget absolute values */
-        
-        if (!gui_widget_isexpanded(h) && !guii_widget_getflag(h, GUI_FLAG_FIRST_INVALIDATE)) {
-            gui_widget_invalidatewithparent(h);     /* Set new clipping region */
-        }
-        if (is_flag) {
-            guii_widget_setflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Set flag back */
+    size = gui_mem_arena_blocksize(h->widget->size);
+#if GUI_CFG_USE_COMPACT_HANDLE
+    if (h->ext != NULL) {
+        size += gui_mem_arena_blocksize(sizeof(*h->ext));
+    }
+#endif /* GUI_CFG_USE_COMPACT_HANDLE */
+    if (guii_widget_getextvalue(h, colors) != NULL && !guii_widget_getflag(h, GUI_FLAG_CONST_COLORS)) {
+        size += gui_mem_arena_blocksize(sizeof(gui_color_t) * h->widget->color_count);
+    }
+    if (clone_textonheap(h)) {
+        size += gui_mem_arena_blocksize(guii_widget_getext(h)->textmemsize);
+    }
+    if (guii_widget_getextvalue(h, timer) != NULL) {
+        size += gui_mem_arena_blocksize(sizeof(gui_timer_t));   /* Copy usually creates its own timer */
+    }
+    if (guii_widget_allowchildren(h)) {
+        GUI_LINKEDLIST_WIDGETSLISTNEXT(h, child) {
+            size += clone_size(child);
         }
     }
-
-    return 1;
+    return size;
 }
 
+#endif /* GUI_CFG_USE_MEM_ARENA || __DOXYGEN__ */
+
 /**
- * \brief           Check if widget can be removed
+ * \brief           Free copy of widget which was not added to widget tree
  * \param[in]       h: Widget handle
- * \return          `1` on success, `0` otherwise
  */
-static uint8_t
-can_remove_widget(gui_handle_p h) {
+static void
+clone_free(gui_handle_p h) {
+    if (clone_textonheap(h)) {
+        GUI_MEMFREE(h->text);
+    }
+    if (guii_widget_getextvalue(h, colors) != NULL && !guii_widget_getflag(h, GUI_FLAG_CONST_COLORS)) {
+        GUI_MEMFREE(guii_widget_getext(h)->colors);
+    }
+#if GUI_CFG_USE_COMPACT_HANDLE
+    if (h->ext != NULL) {
+        GUI_MEMFREE(h->ext);
+    }
+#endif /* GUI_CFG_USE_COMPACT_HANDLE */
+    WIDGET_FREE(h);
+}
+
+/**
+ * \brief           Copy single widget from prototype and add it to parent widget
+ *
+ *                  Memory owned by prototype, such as custom colors and dynamic text, is copied.
+ *                  Caches, timers and other values of single widget are reset
+ *
+ * \param[in]       proto: Prototype widget handle
+ * \param[in]       id: ID of copy
+ * \param[in]       parent: Parent widget of copy
+ * \return          Widget handle on success, `NULL` otherwise
+ */
+static gui_handle_p
+clone_widget(gui_handle_p proto, gui_id_t id, gui_handle_p parent) {
+    gui_evt_param_t param = {0};
     gui_evt_result_t result = {0};
-    
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
-    
-    /* Desktop window cannot be deleted */
-    if (h == gui_window_getdesktop()) {             /* Root widget can not be deleted! */
-        return 0;
+    gui_handle_ext_t* e;
+    gui_handle_p h;
+    uint8_t text_heap;
+#if GUI_CFG_MEM_TRACE
+    const char* tag;
+#endif /* GUI_CFG_MEM_TRACE */
+
+    if (guii_widget_isdialogbase(proto) || get_widget_depth(parent) >= GUI_CFG_WIDGET_DEPTH_MAX) {
+        return NULL;                                /* Dialogs are registered by dialog module */
     }
-    
-    /* Check widget status itself */
-    GUI_EVT_RESULTTYPE_U8(&result) = 1;
-    if (!guii_widget_callback(h, GUI_EVT_REMOVE, NULL, &result) || GUI_EVT_RESULTTYPE_U8(&result)) { /* If command was not processed, allow delete */
-        GUI_EVT_RESULTTYPE_U8(&result) = 1;      /* Manually allow delete */
+
+#if GUI_CFG_MEM_TRACE
+    tag = gui_mem_settag((const char *)proto->widget->name);
+#endif /* GUI_CFG_MEM_TRACE */
+    h = WIDGET_ALLOC(proto->widget);
+    if (h == NULL) {
+#if GUI_CFG_MEM_TRACE
+        gui_mem_settag(tag);
+#endif /* GUI_CFG_MEM_TRACE */
+        return NULL;
     }
-    
-    /* Check children widgets recursively */
-    if (GUI_EVT_RESULTTYPE_U8(&result) && guii_widget_haschildren(h)) {
-        gui_handle_p h1;
-        GUI_LINKEDLIST_WIDGETSLISTNEXT(h, h1) {
-            if (!can_remove_widget(h1)) {           /* If we should not delete it */
-                return 0;                           /* Stop on first call */
-            }
+    memcpy(h, proto, proto->widget->size);          /* Copy handle and widget specific values at once */
+
+    /* Tree position and values of single widget */
+    memset(&h->list, 0x00, sizeof(h->list));
+    memset(&h->root_list, 0x00, sizeof(h->root_list));
+    h->id = id;
+    h->parent = parent;
+    h->remove_next = NULL;
+    h->flags &= ~CLONE_CLEAR_FLAGS;
+#if GUI_CFG_USE_TRANSLATE
+    h->text_translated = NULL;
+    h->text_translate_version = 0;
+#endif /* GUI_CFG_USE_TRANSLATE */
+#if GUI_CFG_USE_TEXT_LAYOUT_CACHE
+    memset(&h->text_layout, 0x00, sizeof(h->text_layout));
+#endif /* GUI_CFG_USE_TEXT_LAYOUT_CACHE */
+#if GUI_CFG_USE_WIDGET_CACHE
+    h->cache_layer = NULL;
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+#if GUI_CFG_USE_DISPLAY_LIST
+    h->draw_list = NULL;                            /* Recorded again on first draw */
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+#if GUI_CFG_USE_MEM_ARENA
+    h->arena = NULL;
+#endif /* GUI_CFG_USE_MEM_ARENA */
+
+    /* Release pointers to prototype memory first, copy can be freed at any step then */
+    text_heap = clone_textonheap(proto);
+    if (text_heap) {
+        h->text = NULL;
+    }
+#if GUI_CFG_USE_COMPACT_HANDLE
+    h->ext = NULL;
+    if (proto->ext != NULL) {
+        h->ext = GUI_MEMALLOC_CLASS(sizeof(*h->ext), GUI_MEM_CLASS_FAST);
+        if (h->ext == NULL) {
+            goto fail;
+        }
+        memcpy(h->ext, proto->ext, sizeof(*h->ext));
+    }
+#endif /* GUI_CFG_USE_COMPACT_HANDLE */
+    if (guii_widget_getextvalue(proto, colors) != NULL && !guii_widget_getflag(proto, GUI_FLAG_CONST_COLORS)) {
+        e = guii_widget_getext(h);
+        e->colors = GUI_MEMALLOC(sizeof(*e->colors) * h->widget->color_count);
+        if (e->colors == NULL) {
+            goto fail;
+        }
+        memcpy(e->colors, guii_widget_getext(proto)->colors, sizeof(*e->colors) * h->widget->color_count);
+    }
+    if (text_heap) {
+        h->text = GUI_MEMALLOC(guii_widget_getext(h)->textmemsize);
+        if (h->text == NULL) {
+            goto fail;
         }
+        memcpy(h->text, proto->text, guii_widget_getext(h)->textmemsize);
+#if GUI_CFG_WIDGET_TEXT_INLINE_SIZE
+    } else if (proto->text != NULL && proto->text == proto->text_inline) {
+        h->text = h->text_inline;                   /* Inline text is copied with handle */
+#endif /* GUI_CFG_WIDGET_TEXT_INLINE_SIZE */
+    }
+    e = guii_widget_getext(h);
+    if (e != NULL) {
+        e->timer = NULL;                            /* Widget creates its own timer on clone event */
+#if GUI_CFG_USE_REFRESH_LIMIT
+        e->refresh_timer = NULL;
+        e->refresh_flags = 0;
+#endif /* GUI_CFG_USE_REFRESH_LIMIT */
+#if GUI_CFG_USE_WIDGET_BUILDER
+        e->build_next = NULL;
+#endif /* GUI_CFG_USE_WIDGET_BUILDER */
+    }
+
+    /* Widget specific values owned by prototype are processed by widget */
+    GUI_EVT_PARAMTYPE_HANDLE(&param) = proto;
+    GUI_EVT_RESULTTYPE_U8(&result) = 1;
+    guii_widget_callback(h, GUI_EVT_CLONE, &param, &result);
+    if (!GUI_EVT_RESULTTYPE_U8(&result)) {
+        goto fail;
+    }
+#if GUI_CFG_MEM_TRACE
+    gui_mem_settag(tag);
+#endif /* GUI_CFG_MEM_TRACE */
+
+#if GUI_CFG_USE_WIDGET_BUILDER
+    if (e != NULL && e->build != NULL) {            /* Prototype was not built yet, copy waits for its builder too */
+        gui_handle_p* p;
+
+        for (p = &GUI.build_list; *p != NULL; p = &guii_widget_getext(*p)->build_next) {}
+        *p = h;
+    }
+#endif /* GUI_CFG_USE_WIDGET_BUILDER */
+
+    /* Add widget to linked list of parent widget */
+    GUI_EVT_RESULTTYPE_U8(&result) = 0;
+    guii_widget_callback(h, GUI_EVT_EXCLUDELINKEDLIST, NULL, &result);
+    if (!GUI_EVT_RESULTTYPE_U8(&result)) {
+        gui_linkedlist_widgetadd(parent, h);
+        SET_WIDGET_LAYOUT_DIRTY(parent);
+#if GUI_CFG_USE_WIDGET_ID_HASH
+        id_hash_add(h);
+#endif /* GUI_CFG_USE_WIDGET_ID_HASH */
+    }
+    SET_WIDGET_ABS_VALUES(h);
+    SET_WIDGET_LAYOUT_DIRTY(h);
+    update_hidden_tree(h);
+    if (parent != NULL) {
+        GUI_EVT_PARAMTYPE_HANDLE(&param) = h;
+        guii_widget_callback(parent, GUI_EVT_CHILDWIDGETCREATED, &param, NULL);
     }
-    
-    return GUI_EVT_RESULTTYPE_U8(&result);
+    return h;
+
+fail:
+#if GUI_CFG_MEM_TRACE
+    gui_mem_settag(tag);
+#endif /* GUI_CFG_MEM_TRACE */
+    clone_free(h);
+    return NULL;
 }
 
 /**
- * \brief           Check if visible part of widget is inside clipping region for redraw
- * \param[in]       h: Widget handle
- * \param[in]       check_sib_cover: Set to `1` to check if any sibling is fully covering current widget
+ * \brief           Copy children of prototype widget to widget
+ * \param[in]       proto: Prototype widget handle
+ * \param[in]       h: Copy of prototype widget
  * \return          `1` on success, `0` otherwise
  */
-uint8_t
-guii_widget_isinsideclippingregion(gui_handle_p h, uint8_t check_sib_cover) {
-    gui_dim_t x1, y1, x2, y2;
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
-    
-    /* Get widget visible section */
-    get_widget_abs_visible_position_size(h, &x1, &y1, &x2, &y2);
+static uint8_t
+clone_children(gui_handle_p proto, gui_handle_p h) {
+    gui_handle_p child, c;
 
-    /* Check if widget is inside drawing area */
-    if (!GUI_RECT_MATCH(
-        x1, y1, x2, y2,
-        GUI.display.x1, GUI.display.y1, GUI.display.x2, GUI.display.y2
-    )) {
-        return 0;
+    if (!guii_widget_allowchildren(proto)) {
+        return 1;
     }
-
-    /* 
-     * Seems like it is inside drawing area 
-     * Now check if this widget is fully hidden by any of its siblings.
-     * Check only widgets on linked list after current widget
-     */
-    if (check_sib_cover) {
-        gui_dim_t tx1, ty1, tx2, ty2;
-        gui_handle_p tmp;
-
-        /* Process all widgets after current one */
-        for (tmp = gui_linkedlist_widgetgetnext(NULL, h); tmp != NULL;
-            tmp = gui_linkedlist_widgetgetnext(NULL, tmp)) {
-
-            if (guii_widget_ishidden(tmp)) {        /* Ignore hidden widgets */
-                continue;
-            }
-
-            /* Get display information for new widget */
-            get_widget_abs_visible_position_size(tmp, &tx1, &ty1, &tx2, &ty2);
-
-            /* Check if widget is inside */
-            if (GUI_RECT_IS_INSIDE(x1, y1, x2, y2, tx1, ty1, tx2, ty2) &&
-                !guii_widget_getflag(tmp, GUI_FLAG_WIDGET_INVALIDATE_PARENT) &&
-                !guii_widget_hasalpha(tmp)          /* Must not have transparency enabled */
-                ) {
-                return 0;                           /* Widget fully covered by another! */
-            }
+    GUI_LINKEDLIST_WIDGETSLISTNEXT(proto, child) {
+        if (guii_widget_getflag(child, GUI_FLAG_REMOVE)) {
+            continue;                               /* Widget waits for removal */
+        }
+        if ((c = clone_widget(child, child->id, h)) == NULL || !clone_children(child, c)) {
+            return 0;
         }
     }
-
-    return 1;                                       /* We have to draw it */
+    return 1;
 }
 
+#endif /* GUI_CFG_USE_WIDGET_CLONE || __DOXYGEN__ */
+
 /**
- * \brief           Init widget part of library
+ * \brief           Create copy of prototype widget together with all its children
+ *
+ *                  Values of each widget, including widget specific values, are copied from prototype
+ *                  instead of calling widget initialization, thus many equal widgets, such as rows of list,
+ *                  are created quickly from single prototype. Only copy is invalidated, once.
+ *                  With \ref GUI_CFG_USE_MEM_ARENA enabled, memory for complete copy is allocated as single block,
+ *                  released when copy is removed.
+ *
+ *                  Each widget of copy receives \ref GUI_EVT_CLONE event with prototype as parameter.
+ *                  Callback function of prototype is used for copy too, it can bind copy to its own data in this event
+ *
+ * \note            Copy has the same visibility as prototype. Prototype is usually created hidden,
+ *                  copy is then shown with \ref gui_widget_show
+ * \note            Children of copy keep IDs of prototype children, use \ref gui_widget_getbyid_ex to find them in copy
+ * \note            Widgets with their own items, such as list box or graph, and dialogs cannot be copied
+ * \note            Function has no effect if \ref GUI_CFG_USE_WIDGET_CLONE is disabled
+ * \param[in]       proto: Prototype widget handle
+ * \param[in]       id: ID of new widget
+ * \param[in]       x: Widget `X` position relative to parent widget
+ * \param[in]       y: Widget `Y` position relative to parent widget
+ * \param[in]       parent: Parent widget of copy. Set to `NULL` to use parent of prototype
+ * \return          Widget handle on success, `NULL` otherwise
  */
-void
-guii_widget_init(void) {
-    gui_window_createdesktop(GUI_ID_WINDOW_BASE, NULL);     /* Create base window object */
+gui_handle_p
+gui_widget_clone(gui_handle_p proto, gui_id_t id, float x, float y, gui_handle_p parent) {
+    gui_handle_p h = NULL;
+#if GUI_CFG_USE_WIDGET_CLONE
+    uint8_t ok = 0;
+#if GUI_CFG_USE_MEM_ARENA
+    gui_mem_arena_t* arena, *prev;
+#endif /* GUI_CFG_USE_MEM_ARENA */
+
+    GUI_ASSERTPARAMS(guii_widget_iswidget(proto));
+
+    GUI_CORE_PROTECT(1);
+    if (parent == NULL || !guii_widget_allowchildren(parent)) {
+        parent = guii_widget_getparent(proto);
+    }
+    if (parent != NULL && (parent == proto || gui_widget_ischildof(parent, proto))) {
+        GUI_CORE_UNPROTECT(1);
+        return NULL;                                /* Copy cannot be placed inside prototype */
+    }
+#if GUI_CFG_USE_MEM_ARENA
+    arena = gui_mem_arena_create(clone_size(proto));
+    prev = gui_mem_arena_setactive(arena);          /* Heap is used when arena is not available */
+#endif /* GUI_CFG_USE_MEM_ARENA */
+    h = clone_widget(proto, id, parent);
+    if (h != NULL) {
+        guii_widget_setflag(h, GUI_FLAG_FIRST_INVALIDATE);  /* Copy is invalidated only once */
+        gui_widget_setposition(h, GUI_DIM(x), GUI_DIM(y));
+        ok = clone_children(proto, h);
+#if GUI_CFG_USE_MEM_ARENA
+        h->arena = arena;                           /* Released with copy, also when partial copy is removed */
+        arena = NULL;
+#endif /* GUI_CFG_USE_MEM_ARENA */
+    }
+#if GUI_CFG_USE_MEM_ARENA
+    gui_mem_arena_setactive(prev);
+    if (arena != NULL) {
+        gui_mem_arena_delete(arena);                /* Copy was not created */
+    }
+#endif /* GUI_CFG_USE_MEM_ARENA */
+    if (h != NULL && !ok) {
+        gui_widget_remove(&h);                      /* Remove partially created copy */
+        h = NULL;
+    }
+    if (h != NULL) {
+        guii_focus_invalidate();                    /* New widgets can receive focus */
+        gui_widget_invalidate(h);
+    }
+    GUI_CORE_UNPROTECT(1);
+#else /* GUI_CFG_USE_WIDGET_CLONE */
+    GUI_UNUSED(proto);
+    GUI_UNUSED(id);
+    GUI_UNUSED(x);
+    GUI_UNUSED(y);
+    GUI_UNUSED(parent);
+#endif /* !GUI_CFG_USE_WIDGET_CLONE */
+    return h;
 }
 
+/* Widget flags saved to screen snapshot */
+#define SNAPSHOT_FLAGS                  (GUI_FLAG_HIDDEN | GUI_FLAG_DISABLED | GUI_FLAG_3D | GUI_FLAG_EXPANDED \
+                                            | GUI_FLAG_WIDTH_PERCENT | GUI_FLAG_HEIGHT_PERCENT \
+                                            | GUI_FLAG_XPOS_PERCENT | GUI_FLAG_YPOS_PERCENT | GUI_FLAG_CACHE)
+
 /**
- * \brief           Execute remove, check all widgets with remove status
- * \return          `1` on success, `0` otherwise
+ * \brief           Copy value to snapshot memory and advance memory pointer
+ * \param[in,out]   ptr: Pointer to snapshot memory pointer. When memory pointer is `NULL`, value is only counted
+ * \param[in]       data: Pointer to value
+ * \param[in]       len: Number of bytes of value
+ * \return          Number of bytes value takes in snapshot
  */
-uint8_t
-guii_widget_executeremove(void) {
-    if (GUI.flags & GUI_FLAG_REMOVE) {              /* Anything to remove? */
-        remove_widgets(NULL);                       /* Remove widgets */
-        GUI.flags &= ~GUI_FLAG_REMOVE;
-        return 1;
+static size_t
+snapshot_put(uint8_t** ptr, const void* data, size_t len) {
+    if (*ptr != NULL) {
+        memcpy(*ptr, data, len);
+        *ptr += len;
     }
-    return 0;
+    return len;
 }
 
 /**
- * \brief           Move widget down on linked list (put it as last, most visible on screen)
- * \param[in]       h: Widget handle
+ * \brief           Copy value from snapshot memory and advance memory pointer
+ * \param[in,out]   ptr: Pointer to snapshot memory pointer
+ * \param[out]      data: Pointer to value
+ * \param[in]       len: Number of bytes of value
  */
-void
-guii_widget_movedowntree(gui_handle_p h) {              
-    /*
-     * Move widget to the end of parent linked list
-     * This will allow widget to be first checked next time for touch detection
-     * and will be drawn on top of al widgets as expected except if there is widget which allows children (new window or similar)
-     */
-    if (gui_linkedlist_widgetmovetobottom(h)) {
-        gui_widget_invalidate(h);                   /* Invalidate object */
-    }
-    
-    /*
-     * Since linked list is threaded, we should move our widget to the end of parent list.
-     * The same should be in the parent as it should also be on the end of its parent and so on.
-     * With parent recursion this can be achieved
-     */
-    if (guii_widget_hasparent(h)) {                 /* Move its parent to the bottom of parent linked list */
-        gui_handle_p parent;
-        for (parent = guii_widget_getparent(h); parent != NULL;
-            parent = guii_widget_getparent(parent)) {
-            if (gui_linkedlist_widgetmovetobottom(parent)) {
-                gui_widget_invalidate(parent);
-            }
-        }
-    }
+static void
+snapshot_get(const uint8_t** ptr, void* data, size_t len) {
+    memcpy(data, *ptr, len);
+    *ptr += len;
 }
 
 /**
- * \brief           Clear focus on widget
+ * \brief           Serialize state of single widget
  * \param[in]       h: Widget handle
+ * \param[out]      ptr: Memory to write state to. Set to `NULL` to only get size of state
+ * \return          Number of bytes of widget state
  */
-void
-guii_widget_focus_clear(void) {
-    if (GUI.focused_widget != NULL && GUI.focused_widget != GUI.root.first) { /* First widget is always in focus */
-        GUI.focused_widget_prev = GUI.focused_widget;   /* Clear everything */
-        do {
-            guii_widget_callback(GUI.focused_widget, GUI_EVT_FOCUSOUT, NULL, NULL);
-            guii_widget_clrflag(GUI.focused_widget, GUI_FLAG_FOCUS);
-            gui_widget_invalidate(GUI.focused_widget);
-            GUI.focused_widget = guii_widget_getparent(GUI.focused_widget);
-        } while (GUI.focused_widget != GUI.root.first); /* Loop to the bottom */
-        GUI.focused_widget = NULL;                  /* Reset focused widget */
+static size_t
+snapshot_save_widget(gui_handle_p h, uint8_t* ptr) {
+    gui_widget_param p;
+    gui_evt_param_t param;
+    gui_evt_result_t result;
+    uint32_t flags = h->flags & SNAPSHOT_FLAGS, memsize;
+    gui_dim_t scroll;
+    size_t size = 0;
+    uint8_t type, len;
+    
+    /* Values common to all widgets */
+    size += snapshot_put(&ptr, &flags, sizeof(flags));
+    size += snapshot_put(&ptr, &h->x, sizeof(h->x));
+    size += snapshot_put(&ptr, &h->y, sizeof(h->y));
+    size += snapshot_put(&ptr, &h->width, sizeof(h->width));
+    size += snapshot_put(&ptr, &h->height, sizeof(h->height));
+    size += snapshot_put(&ptr, &h->padding, sizeof(h->padding));
+    size += snapshot_put(&ptr, &h->zindex, sizeof(h->zindex));
+#if GUI_CFG_USE_ALPHA
+    size += snapshot_put(&ptr, &h->alpha, sizeof(h->alpha));
+#endif /* GUI_CFG_USE_ALPHA */
+    scroll = guii_widget_getextvalue(h, x_scroll);
+    size += snapshot_put(&ptr, &scroll, sizeof(scroll));
+    scroll = guii_widget_getextvalue(h, y_scroll);
+    size += snapshot_put(&ptr, &scroll, sizeof(scroll));
+    
+    /* Text pointer is kept, dynamically allocated text is copied */
+    type = h->text == NULL ? 0 : (guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC) ? 2 : 1);
+    size += snapshot_put(&ptr, &type, sizeof(type));
+    if (type == 1) {
+        size += snapshot_put(&ptr, &h->text, sizeof(h->text));
+    } else if (type == 2) {
+        memsize = (uint32_t)guii_widget_getextvalue(h, textmemsize);
+        size += snapshot_put(&ptr, &memsize, sizeof(memsize));
+        size += snapshot_put(&ptr, h->text, (gui_string_lengthtotal(h->text) + 1) * sizeof(gui_char));
     }
+    
+    /* Widget specific values are written after their length */
+    p.type = 0xFF;
+    p.data = ptr != NULL ? ptr + 1 : NULL;
+    GUI_EVT_PARAMTYPE_WIDGETPARAM(&param) = &p;
+    GUI_EVT_RESULTTYPE_U8(&result) = 0;
+    guii_widget_callback(h, GUI_EVT_SAVESTATE, &param, &result);
+    len = GUI_EVT_RESULTTYPE_U8(&result);
+    size += snapshot_put(&ptr, &len, sizeof(len)) + len;
+    
+    return size;
 }
 
 /**
- * \brief           Set widget as focused
+ * \brief           Restore state of single widget
  * \param[in]       h: Widget handle
+ * \param[in,out]   ptr: Pointer to snapshot memory pointer
  */
-void
-guii_widget_focus_set(gui_handle_p h) {
-    gui_handle_p common = NULL;
-
-    if (GUI.focused_widget == h || h == NULL) {     /* Check current focused widget */
-        return;
-    }
+static void
+snapshot_restore_widget(gui_handle_p h, const uint8_t** ptr) {
+    gui_widget_param p;
+    gui_evt_param_t param;
+    gui_evt_result_t result;
+    gui_coord_t x, y, wi, hi;
+    uint32_t flags, padding, memsize;
+    int32_t zindex;
+    gui_dim_t sx, sy;
+    const gui_char* text;
+    uint8_t type, len;
+#if GUI_CFG_USE_ALPHA
+    uint8_t alpha;
+#endif /* GUI_CFG_USE_ALPHA */
     
-    /*
-     * TODO: Check if widget is in list for remove or any parent of it
-     */
+    snapshot_get(ptr, &flags, sizeof(flags));
+    snapshot_get(ptr, &x, sizeof(x));
+    snapshot_get(ptr, &y, sizeof(y));
+    snapshot_get(ptr, &wi, sizeof(wi));
+    snapshot_get(ptr, &hi, sizeof(hi));
+    snapshot_get(ptr, &padding, sizeof(padding));
+    snapshot_get(ptr, &zindex, sizeof(zindex));
+#if GUI_CFG_USE_ALPHA
+    snapshot_get(ptr, &alpha, sizeof(alpha));
+#endif /* GUI_CFG_USE_ALPHA */
+    snapshot_get(ptr, &sx, sizeof(sx));
+    snapshot_get(ptr, &sy, sizeof(sy));
     
-    /*
-     * Step 1:
-     *
-     * Identify common parent from new and old focused widget
-     * Remove focused flag on widget which are not in tree between old and new widgets
-     */
-    if (GUI.focused_widget != NULL) {                /* We already have one widget in focus */
-        common = get_common_parentwidget(GUI.focused_widget, h); /* Get first widget in common */
-        if (common != NULL) {                       /* We have common object, invalidate only those which are not common in tree */
-            for (; 
-                GUI.focused_widget != NULL && common != NULL && GUI.focused_widget != common;
-                GUI.focused_widget = guii_widget_getparent(GUI.focused_widget)) {
-                guii_widget_clrflag(GUI.focused_widget, GUI_FLAG_FOCUS);    /* Clear focused flag */
-                guii_widget_callback(GUI.focused_widget, GUI_EVT_FOCUSOUT, NULL, NULL);  /* Notify with callback */
-                gui_widget_invalidate(GUI.focused_widget);  /* Invalidate widget */
-            }
+    set_widget_size(h, wi, hi, !!(flags & GUI_FLAG_WIDTH_PERCENT), !!(flags & GUI_FLAG_HEIGHT_PERCENT));
+    set_widget_position(h, x, y, !!(flags & GUI_FLAG_XPOS_PERCENT), !!(flags & GUI_FLAG_YPOS_PERCENT));
+    if (h->padding != padding) {
+        h->padding = padding;
+        SET_WIDGET_ABS_VALUES(h);
+        SET_WIDGET_LAYOUT_DIRTY(h);
+    }
+    gui_widget_setzindex(h, zindex);
+#if GUI_CFG_USE_ALPHA
+    gui_widget_setalpha(h, alpha);
+#endif /* GUI_CFG_USE_ALPHA */
+    if (guii_widget_allowchildren(h)) {
+        gui_widget_setscrollx(h, sx);
+        gui_widget_setscrolly(h, sy);
+    }
+    
+    snapshot_get(ptr, &type, sizeof(type));
+    if (type == 1) {
+        snapshot_get(ptr, &text, sizeof(text));
+        gui_widget_settext(h, text);
+    } else if (type == 2) {
+        snapshot_get(ptr, &memsize, sizeof(memsize));
+        if (memsize > 2 * sizeof(gui_char) && gui_widget_alloctextmemory(h, memsize / sizeof(gui_char) - 1)) {
+            gui_widget_settext(h, (const gui_char *)*ptr);
         }
-    } else {
-        common = GUI.root.first;                    /* Get bottom widget */
+        *ptr += (gui_string_lengthtotal((const gui_char *)*ptr) + 1) * sizeof(gui_char);
+    } else if (h->text != NULL && !guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC)) {
+        h->text = NULL;                             /* Text from table was removed */
+        guii_widget_invalidatetextlayout(h);
+        gui_widget_invalidate(h);
     }
     
-    /*
-     * Step 2:
-     *
-     * Set new widget as focused
-     * Set all widget from common to current as focused
-     */ 
-    GUI.focused_widget = h;                         /* Set new focused widget */
-    while (h != NULL && common != NULL && h != common) {
-        guii_widget_setflag(h, GUI_FLAG_FOCUS);     /* Set focused flag */
-        guii_widget_callback(h, GUI_EVT_FOCUSIN, NULL, NULL);   /* Notify with callback */
-        gui_widget_invalidate(h);                   /* Invalidate widget */
-        h = guii_widget_getparent(h);               /* Get parent widget */
+    snapshot_get(ptr, &len, sizeof(len));
+    if (len) {
+        p.type = len;
+        p.data = (void *)*ptr;
+        GUI_EVT_PARAMTYPE_WIDGETPARAM(&param) = &p;
+        GUI_EVT_RESULTTYPE_U8(&result) = 0;
+        guii_widget_callback(h, GUI_EVT_RESTORESTATE, &param, &result);
+        *ptr += len;
+        gui_widget_invalidate(h);
     }
-}
-
-/**
- * \brief           Clear active status on widget
- */
-void
-guii_widget_active_clear(void) {
-    if (GUI.active_widget != NULL) {
-        guii_widget_callback(GUI.active_widget, GUI_EVT_ACTIVEOUT, NULL, NULL);  /* Notify user about change */
-        guii_widget_clrflag(GUI.active_widget, GUI_FLAG_ACTIVE | GUI_FLAG_TOUCH_MOVE);  /* Clear all widget based flags */
-        GUI.active_widget_prev = GUI.active_widget; /* Save as previous active */
-        GUI.active_widget = NULL;                   /* Clear active widget handle */
+    
+    /* Flags last, hidden widget is not invalidated anymore */
+    h->flags = (h->flags & ~(GUI_FLAG_DISABLED | GUI_FLAG_3D | GUI_FLAG_CACHE))
+        | (flags & (GUI_FLAG_DISABLED | GUI_FLAG_3D | GUI_FLAG_CACHE));
+    gui_widget_setexpanded(h, !!(flags & GUI_FLAG_EXPANDED));
+    if (flags & GUI_FLAG_HIDDEN) {
+        gui_widget_hide(h);
+    } else {
+        gui_widget_show(h);
     }
 }
 
+#if GUI_CFG_USE_WIDGET_CACHE
+
 /**
- * \brief           Set widget as active
- * \param[in]       h: Widget handle. When set to NULL, current active widget is cleared
+ * \brief           Clear redraw flag of all children widgets
+ * \param[in]       parent: Parent widget handle
  */
-void
-guii_widget_active_set(gui_handle_p h) {
-    guii_widget_active_clear();                     /* Clear active widget flag */
-    GUI.active_widget = h;                          /* Set new active widget */
-    if (h != NULL) {
-        guii_widget_setflag(GUI.active_widget, GUI_FLAG_ACTIVE);    /* Set active widget flag */
-        guii_widget_callback(GUI.active_widget, GUI_EVT_ACTIVEIN, NULL, NULL);
+static void
+clear_children_redraw(gui_handle_p parent) {
+    gui_handle_p h;
+    
+    GUI_LINKEDLIST_WIDGETSLISTNEXT(parent, h) {
+        guii_widget_clrflag(h, GUI_FLAG_REDRAW);
+        if (guii_widget_haschildren(h)) {
+            clear_children_redraw(h);
+        }
     }
 }
 
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+
 /**
- * \brief           Get absolute inner X position of parent widget
- * \note            This function returns inner X position in absolute form.
- *                     Imagine parent absolute X is 10, and left padding is 2. Function returns 12.
+ * \brief           Save state of screen widgets to snapshot
  *
- * \note            This function is private and may be called only when OS protection is active
- * \param[in]       h: Widget handle for which parent should be calculated
- * \return          Parent absolute inner X position
+ *                  Position, size, flags, padding, z-index, alpha, scroll and text of each widget
+ *                  are serialized to single memory buffer of exact size, together with widget specific values
+ *                  (value of progress bar and slider, checkbox and radio state).
+ *                  Screen can be removed afterwards and created again with \ref gui_widget_snapshot_restore.
+ *
+ *                  When `keep_frame` is set and first widget has valid cache layer (\ref gui_widget_setcache),
+ *                  snapshot takes cache layer, so screen is shown after restore with single copy operation.
+ *                  Kept frames count to \ref GUI_CFG_WIDGET_CACHE_SIZE budget until snapshot is freed,
+ *                  keep frames only for screens expected to be shown again soon.
+ *
+ * \note            Text which is not allocated by widget is saved as pointer, it must stay valid
+ * \param[in,out]   snap: Snapshot to save to. Previous content is freed
+ * \param[in]       handles: Array of widget handles, written by \ref gui_widget_createscreen
+ * \param[in]       count: Number of entries in `handles` array
+ * \param[in]       keep_frame: Set to `1` to keep rendered content of first widget
+ * \return          `1` on success, `0` otherwise
+ * \sa              gui_widget_snapshot_free
  */
-gui_dim_t
-guii_widget_getparentabsolutex(gui_handle_p h) {
-    gui_dim_t out = 0;
+uint8_t
+gui_widget_snapshot_save(gui_snapshot_t* snap, gui_handle_p* handles, size_t count, uint8_t keep_frame) {
+    uint8_t* ptr;
+    size_t i, len = 0;
     
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+    GUI_ASSERTPARAMS(snap != NULL && handles != NULL && count > 0);
     
-    h = guii_widget_getparent(h);                   /* Get parent of widget */
-    if (h != NULL) {                                /* Save left padding */
-        out = gui_widget_getpaddingleft(h);         /* Get left padding from parent widget */
+    GUI_CORE_PROTECT(1);
+    gui_widget_snapshot_free(snap);
+    for (i = 0; i < count && guii_widget_iswidget(handles[i]); i++) {
+        len += snapshot_save_widget(handles[i], NULL);
     }
-    out += gui_widget_getabsolutex(h);              /* Add absolute X of parent and to current padding */
-    return out;
+    if (i == count) {
+        snap->data = GUI_MEMALLOC(len);
+    }
+    if (snap->data != NULL) {
+        for (ptr = snap->data, i = 0; i < count; i++) {
+            ptr += snapshot_save_widget(handles[i], ptr);
+        }
+        snap->len = len;
+        snap->count = count;
+#if GUI_CFG_USE_WIDGET_CACHE
+        if (keep_frame && handles[0]->cache_layer != NULL && guii_widget_getflag(handles[0], GUI_FLAG_CACHE_VALID)) {
+            snap->frame = handles[0]->cache_layer;  /* Take layer, widget is rendered again if it stays on screen */
+            handles[0]->cache_layer = NULL;
+            guii_widget_clrflag(handles[0], GUI_FLAG_CACHE_VALID);
+        }
+#else /* GUI_CFG_USE_WIDGET_CACHE */
+        GUI_UNUSED(keep_frame);
+#endif /* !GUI_CFG_USE_WIDGET_CACHE */
+    }
+    GUI_CORE_UNPROTECT(1);
+    
+    return snap->data != NULL;
 }
 
 /**
- * \brief           Get absolute inner Y position of parent widget
- * \note            This function returns inner Y position in absolute form.
- *                     Imagine parent absolute `Y = 10`, and `top padding = 2`. Function returns `12`
+ * \brief           Create screen from description table and restore state of its widgets from snapshot
  *
- * \note            This function is private and may be called only when OS protection is active
- * \param[in]       h: Widget handle for which parent should be calculated
- * \return          Parent absolute inner Y position
+ *                  Widgets are created and restored within single invalidation batch.
+ *                  Snapshot stays valid and may be restored again until freed,
+ *                  except for kept frame, which is given to first widget of screen.
+ *
+ * \param[in,out]   snap: Snapshot saved from screen created with the same table
+ * \param[in]       desc: Pointer to table of widget descriptions
+ * \param[in]       count: Number of entries in table, must match number of widgets in snapshot
+ * \param[in]       parent: Parent widget for entries with parent index `-1`.
+ *                      Set to `NULL` to use current active parent widget
+ * \param[out]      handles: Array of `count` entries to write created handles to
+ * \return          Handle of first created widget on success, `NULL` otherwise
+ * \sa              gui_widget_createscreen
  */
-gui_dim_t
-guii_widget_getparentabsolutey(gui_handle_p h) {
-    gui_dim_t out = 0;
+gui_handle_p
+gui_widget_snapshot_restore(gui_snapshot_t* snap, const gui_widget_desc_t* desc, size_t count, gui_handle_p parent, gui_handle_p* handles) {
+    gui_handle_p ret;
+    const uint8_t* ptr;
+    size_t i;
     
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+    GUI_ASSERTPARAMS(snap != NULL && snap->data != NULL && snap->count == count);
     
-    h = guii_widget_getparent(h);                   /* Get parent of widget */
-    if (h != NULL) {                                /* Save left padding */
-        out = gui_widget_getpaddingtop(h);          /* Get top padding from parent widget */
+    GUI_CORE_PROTECT(1);
+    gui_widget_invalidate_begin();                  /* Calculate clipping once for entire screen */
+    ret = gui_widget_createscreen(desc, count, parent, handles);
+    if (ret != NULL) {
+        for (ptr = snap->data, i = 0; i < count; i++) {
+            snapshot_restore_widget(handles[i], &ptr);
+        }
+    }
+    gui_widget_invalidate_end();
+#if GUI_CFG_USE_WIDGET_CACHE
+    /* Restored content matches kept frame, it is copied to screen instead of rendering widgets */
+    if (ret != NULL && snap->frame != NULL && guii_widget_getflag(ret, GUI_FLAG_CACHE) && ret->cache_layer == NULL) {
+        ret->cache_layer = snap->frame;
+        snap->frame = NULL;
+        guii_widget_setflag(ret, GUI_FLAG_CACHE_VALID);
+        clear_children_redraw(ret);
+    }
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+    GUI_CORE_UNPROTECT(1);
+    
+    return ret;
+}
+
+/**
+ * \brief           Free memory of snapshot
+ * \param[in,out]   snap: Snapshot to free
+ */
+void
+gui_widget_snapshot_free(gui_snapshot_t* snap) {
+    if (snap == NULL) {
+        return;
     }
-    out += gui_widget_getabsolutey(h);              /* Add absolute Y of parent and to current padding */
-    return out;
+    GUI_CORE_PROTECT(1);
+    if (snap->data != NULL) {
+        GUI_MEMFREE(snap->data);
+    }
+#if GUI_CFG_USE_WIDGET_CACHE
+    if (snap->frame != NULL) {
+        GUI.widget_cache_size -= sizeof(*snap->frame) + (size_t)snap->frame->width * (size_t)snap->frame->height * (size_t)GUI.lcd.pixel_size;
+        GUI_MEMFREE(snap->frame);
+    }
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
+    snap->data = NULL;
+    snap->frame = NULL;
+    snap->len = 0;
+    snap->count = 0;
+    GUI_CORE_UNPROTECT(1);
 }
 
 /**
- * \brief           Get absolute `X` position on LCD for specific widget
- * \param[in]       h: Widget handle
- * \return          `X` position on screen in units of pixels
+ * \brief           Save widget specific values to snapshot memory
+ * \param[in,out]   p: Snapshot memory from \ref GUI_EVT_SAVESTATE event
+ * \param[in]       data: Pointer to widget values
+ * \param[in]       len: Number of bytes of widget values
+ * \return          Number of saved bytes
  */
-gui_dim_t
-gui_widget_getabsolutex(gui_handle_p h) {   
-    if (h == NULL) {                                /* Check input value */
-        return 0;                                   /* At left value */
+uint8_t
+guii_widget_savestate(gui_widget_param* p, const void* data, size_t len) {
+    if (len > p->type) {
+        return 0;
     }
-#if GUI_CFG_USE_POS_SIZE_CACHE
-    return h->abs_x;                                /* Cached value */
-#else /* GUI_CFG_USE_POS_SIZE_CACHE */
-    return calculate_widget_absolute_x(h);          /* Calculate value */
-#endif /* !GUI_CFG_USE_POS_SIZE_CACHE */
+    if (p->data != NULL) {
+        memcpy(p->data, data, len);
+    }
+    return (uint8_t)len;
 }
 
 /**
- * \brief           Get absolute `Y` position on LCD for specific widget
- * \param[in]       h: Widget handle 
- * \return          `Y` position on screen in units of pixels
+ * \brief           Restore widget specific values from snapshot memory
+ * \param[in]       p: Snapshot memory from \ref GUI_EVT_RESTORESTATE event
+ * \param[out]      data: Pointer to widget values
+ * \param[in]       len: Number of bytes of widget values
+ * \return          `1` on success, `0` otherwise
  */
-gui_dim_t
-gui_widget_getabsolutey(gui_handle_p h) {
-    if (h == NULL) {                                /* Check input value */
-        return 0;                                   /* At left value */
+uint8_t
+guii_widget_restorestate(const gui_widget_param* p, void* data, size_t len) {
+    if (p->type != len) {
+        return 0;
     }
-#if GUI_CFG_USE_POS_SIZE_CACHE
-    return h->abs_y;                                /* Cached value */
-#else /* GUI_CFG_USE_POS_SIZE_CACHE */
-    return calculate_widget_absolute_y(h);          /* Calculate value */
-#endif /* !GUI_CFG_USE_POS_SIZE_CACHE */
+    memcpy(data, p->data, len);
+    return 1;
 }
 
 /**
- * \brief           Get widget `X` position relative to parent in units of pixels
+ * \brief           Apply font and padding of shared style to widget
  * \param[in]       h: Widget handle
- * \return          Widget `X` position relative to parent
  */
-gui_dim_t
-gui_widget_getxposition(gui_handle_p h) {
-    return gui_widget_getabsolutex(h) - guii_widget_getparentabsolutex(h);
+static void
+apply_style(gui_handle_p h) {
+    const gui_style_t* style = guii_widget_getstyle(h);
+    
+    if (style->font != NULL) {
+        gui_widget_setfont(h, style->font);
+    }
+    if (style->padding && h->padding != style->padding) {
+        h->padding = style->padding;
+        SET_WIDGET_ABS_VALUES(h);
+    }
+    gui_widget_invalidate(h);
 }
 
 /**
- * \brief           Get widget `Y` position relative to parent in units of pixels
- * \param[in]       h: Widget handle
- * \return          Widget `Y` position relative to parent
+ * \brief           Apply changed style to all widgets in tree using it
+ * \param[in]       parent: Parent widget to scan children of, `NULL` for root widgets
+ * \param[in]       style: Changed style
  */
-gui_dim_t
-gui_widget_getyposition(gui_handle_p h) {
-    return gui_widget_getabsolutey(h) - guii_widget_getparentabsolutey(h);
+static void
+update_style(gui_handle_p parent, const gui_style_t* style) {
+    gui_handle_p h;
+    
+    GUI_LINKEDLIST_WIDGETSLISTNEXT(parent, h) {
+        if (guii_widget_getstyle(h) == style) {
+            apply_style(h);
+        }
+        if (guii_widget_allowchildren(h)) {
+            update_style(h, style);
+        }
+    }
 }
 
 /**
- * \brief           Invalidate widget and parent widget for redraw 
+ * \brief           Set shared style to widget
+ *
+ *                  Style is not copied, widget only keeps pointer to it.
+ *                  Colors set with \ref gui_widget_setcolor have priority over style colors
+ *
  * \param[in]       h: Widget handle
+ * \param[in]       style: Pointer to style, which must stay valid while used by widget.
+ *                      Set to `NULL` to use widget default colors again
  * \return          `1` on success, `0` otherwise
+ * \sa              gui_widget_updatestyle
  */
 uint8_t
-gui_widget_invalidatewithparent(gui_handle_p h) {
-    uint8_t res;
-    
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+gui_widget_setstyle(gui_handle_p h, const gui_style_t* style) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));
     
-    res = invalidate_widget(h, 1);                  /* Invalidate object with clipping */
-    GUI_UNUSED(res);
-    if (guii_widget_hasparent(h)) {                 /* If parent exists, invalid only parent */
-        invalidate_widget(guii_widget_getparent(h), 0); /* Invalidate parent object without clipping */
+    if (!guii_widget_hasext(h, style != NULL)) {
+        return style == NULL;                       /* Style was never set or memory is not available */
+    }
+    guii_widget_getext(h)->style = style;
+    if (style != NULL) {
+        apply_style(h);
+    } else {
+        gui_widget_invalidate(h);
     }
-
     return 1;
 }
 
 /**
- * \brief           Set if parent widget should be invalidated when we invalidate primary widget
- * \note            Useful for widgets where there is no background: Transparent images, textview, slider, etc
- * \param[in]       h: Widget handle
- * \param[in]       value: Set to `1` to invalidate parent widget when invalidating widget or `0` to invalidate only widget itself
+ * \brief           Apply changes of style to all widgets using it
+ *
+ *                  To restyle application, modify style members, for example swap `colors` pointer,
+ *                  and call this function once
+ *
+ * \param[in]       style: Pointer to changed style
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
-gui_widget_setinvalidatewithparent(gui_handle_p h, uint8_t value) {
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+gui_widget_updatestyle(const gui_style_t* style) {
+    GUI_ASSERTPARAMS(style != NULL);
     
-    if (value) {                                    /* On positive value */
-        guii_widget_setflag(h, GUI_FLAG_WIDGET_INVALIDATE_PARENT); /* Enable auto invalidation of parent widget */
-    } else {                                        /* On zero */
-        guii_widget_clrflag(h, GUI_FLAG_WIDGET_INVALIDATE_PARENT); /* Disable auto invalidation of parent widget */
-    }
-
+    GUI_CORE_PROTECT(1);
+    gui_widget_invalidate_begin();                  /* Widgets are redrawn in single pass */
+    update_style(NULL, style);
+    gui_widget_invalidate_end();
+    GUI_CORE_UNPROTECT(1);
     return 1;
 }
 
 /**
- * \brief           Set widget parameter in OS secure way
+ * \brief           Post integer setter call for widget from any thread
+ *
+ *                  Function does not lock GUI core and never waits for drawing.
+ *                  Setter is called by GUI thread on next process call,
+ *                  for example \ref gui_progbar_setvalue or \ref gui_widget_setzindex
+ *
+ * \note            When the same setter is posted multiple times for widget before it is applied,
+ *                  only the last value is used
  * \param[in]       h: Widget handle
- * \param[in]       cfg: Configuration to use, passed later to callback function
- * \param[in]       data: Custom data to pass later to configuration callback
- * \param[in]       invalidate: Flag if widget should be invalidated after parameter change
- * \param[in]       invalidateparent: change if parent widget should be invalidated after parameter change
- * \return          `1` on success, `0` otherwise
+ * \param[in]       fn: Setter function to call
+ * \param[in]       value: Value passed to setter
+ * \return          `1` on success, `0` if queue is full
  */
 uint8_t
-guii_widget_setparam(gui_handle_p h, uint16_t cfg, const void* data, uint8_t invalidate, uint8_t invalidateparent) {
-    gui_widget_param p;
-    gui_evt_param_t param = {0};
-    gui_evt_result_t result = {0};
-
-    GUI_ASSERTPARAMS(h != NULL && guii_widget_iswidget(h));   
-    
-    GUI_EVT_PARAMTYPE_WIDGETPARAM(&param) = &p;
-    GUI_EVT_RESULTTYPE_U8(&result) = 1;
-    
-    p.type = cfg;
-    p.data = (void *)data;
-    
-    guii_widget_callback(h, GUI_EVT_SETPARAM, &param, &result); /* Process callback function */
-    if (invalidateparent) {
-        gui_widget_invalidatewithparent(h);         /* Invalidate widget and parent */
-    } else if (invalidate) {
-        gui_widget_invalidate(h);                   /* Invalidate widget only */
-    }
+gui_widget_post_int(gui_handle_p h, gui_widget_cmd_int_fn fn, int32_t value) {
+#if GUI_CFG_USE_WIDGET_CMD_QUEUE
+    widget_cmd_t cmd;
     
-    return 1;
+    GUI_ASSERTPARAMS(h != NULL && fn != NULL);
+    cmd.h = h;
+    cmd.type = WIDGET_CMD_INT;
+    cmd.fn.i = fn;
+    cmd.arg.i = value;
+    return cmd_post(&cmd);
+#else /* GUI_CFG_USE_WIDGET_CMD_QUEUE */
+    GUI_UNUSED(h);
+    GUI_UNUSED(fn);
+    GUI_UNUSED(value);
+    return 0;
+#endif /* !GUI_CFG_USE_WIDGET_CMD_QUEUE */
 }
 
 /**
- * \brief           Create new widget and add it to linked list to parent object
- * \note            This function may only be called from widget create function, such as \ref gui_button_create or similar
- * \param[in]       widget: Pointer to \ref gui_widget_t structure with widget description
- * \param[in]       id: Widget unique ID to use for identity for callback processing
- * \param[in]       x: Widget `X` position relative to parent widget
- * \param[in]       y: Widget `Y` position relative to parent widget
- * \param[in]       width: Widget width in units of pixels
- * \param[in]       height: Widget height in units of pixels
- * \param[in]       parent: Parent widget handle. Set to `NULL` to use current active parent widget
- * \param[in]       evt_fn: Widget callback function. Set to `NULL` to use default widget specific callback
- * \param[in]       flags: flags for create procedure
- * \return          Widget handle on success, `NULL` otherwise
+ * \brief           Post text setter call for widget from any thread
+ *
+ *                  Function does not lock GUI core and never waits for drawing.
+ *                  Setter is called by GUI thread on next process call, for example \ref gui_widget_settext
+ *
+ * \note            Text is not copied and must stay valid until setter copies or stops using it
+ * \param[in]       h: Widget handle
+ * \param[in]       fn: Setter function to call
+ * \param[in]       text: Text passed to setter
+ * \return          `1` on success, `0` if queue is full
  */
-void *
-gui_widget_create(const gui_widget_t* widget, gui_id_t id, float x, float y, float width, float height, gui_handle_p parent, gui_widget_evt_fn evt_fn, uint16_t flags) {
-    gui_handle_p h;
-    
-    GUI_ASSERTPARAMS(widget != NULL && widget->callback != NULL);
+uint8_t
+gui_widget_post_text(gui_handle_p h, gui_widget_cmd_text_fn fn, const gui_char* text) {
+#if GUI_CFG_USE_WIDGET_CMD_QUEUE
+    widget_cmd_t cmd;
     
-    /* Allocation size check */
-    if (widget->size < sizeof(gui_handle)) { 
-        return 0;
-    }
+    GUI_ASSERTPARAMS(h != NULL && fn != NULL);
+    cmd.h = h;
+    cmd.type = WIDGET_CMD_TEXT;
+    cmd.fn.t = fn;
+    cmd.arg.t = text;
+    return cmd_post(&cmd);
+#else /* GUI_CFG_USE_WIDGET_CMD_QUEUE */
+    GUI_UNUSED(h);
+    GUI_UNUSED(fn);
+    GUI_UNUSED(text);
+    return 0;
+#endif /* !GUI_CFG_USE_WIDGET_CMD_QUEUE */
+}
 
-    h = GUI_MEMALLOC(widget->size);                 /* Allocate memory for widget */
-    if (h != NULL) {
-        gui_evt_param_t param = {0};
-        gui_evt_result_t result = {0};
+#if GUI_CFG_USE_COMPACT_HANDLE || __DOXYGEN__
 
-        h->id = id;                                 /* Save ID */
-        h->widget = widget;                         /* Widget object structure */
-        h->footprint = GUI_WIDGET_FOOTPRINT;        /* Set widget footprint */
-        h->callback = evt_fn;                       /* Set widget callback */
-#if GUI_CFG_USE_ALPHA
-        h->alpha = 0xFF;                            /* Set full transparency by default */
-#endif /* GUI_CFG_USE_ALPHA */
-        
-        /*
-         * Parent window check
-         *
-         * - Dialog's parent widget is desktop widget
-         * - If flag for parent desktop is set, parent widget is also desktop
-         * - Otherwise parent widget passed as parameter is used if it supports children widgets
-         */
-        if (flags & GUI_FLAG_WIDGET_CREATE_NO_PARENT) {
-            h->parent = NULL;
-        } else if (guii_widget_isdialogbase(h) || flags & GUI_FLAG_WIDGET_CREATE_PARENT_DESKTOP) {  /* Dialogs do not have parent widget */
-            h->parent = gui_window_getdesktop();    /* Set parent object */
-        } else {
-            if (parent != NULL && guii_widget_allowchildren(parent)) {
-                h->parent = parent;
-            } else {
-                h->parent = GUI.window_active;       /* Set parent object. It will be NULL on first call */
-            }
-        }
-        
-        /* Call pre-init function to set default widget parameters */
-        GUI_EVT_RESULTTYPE_U8(&result) = 1;
-        guii_widget_callback(h, GUI_EVT_PRE_INIT, NULL, &result);    /* Notify internal widget library about init successful */
-        
-        if (!GUI_EVT_RESULTTYPE_U8(&result)) {
-            GUI_MEMFREE(h);
-            h = NULL;
+/**
+ * \brief           Allocate optional widget data of compact handle
+ * \param[in]       h: Widget handle
+ * \return          Pointer to data on success, `NULL` otherwise
+ */
+gui_handle_ext_t *
+guii_widget_allocext(gui_handle_p h) {
+    if (h->ext == NULL) {
+        h->ext = GUI_MEMALLOC_CLASS(sizeof(*h->ext), GUI_MEM_CLASS_FAST);
+        if (h->ext != NULL) {
+            memset(h->ext, 0x00, sizeof(*h->ext));
         }
-        
-        if (h != NULL) {
-            /* Set widget default values */
-            h->font = widget_default.font;          /* Set default font */
+    }
+    return h->ext;
+}
 
-            /* Do not invalidate widget while setting first size and position */
-            guii_widget_setflag(h, GUI_FLAG_FIRST_INVALIDATE);  /* Ignore invalidation process for size and position */
-            gui_widget_setsize(h, GUI_DIM(width), GUI_DIM(height)); /* Set widget size */
-            gui_widget_setposition(h, GUI_DIM(x), GUI_DIM(y));  /* Set widget position */
-            gui_widget_invalidate(h);               /* Force invalidation once we set size and position first time */
-            
-#if GUI_CFG_WIDGET_CREATE_IGNORE_INVALIDATE
-            flags |= GUI_FLAG_WIDGET_CREATE_IGNORE_INVALIDATE;  /* Add ignore invalidate flag */
-#endif /* GUI_CFG_WIDGET_CREATE_IGNORE_INVALIDATE */
-            guii_widget_setflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Ignore invalidation process */
-            if (!(flags & GUI_FLAG_WIDGET_CREATE_IGNORE_INVALIDATE)) {
-                guii_widget_clrflag(h, GUI_FLAG_IGNORE_INVALIDATE); /* Include invalidation process */
-            }
+#endif /* GUI_CFG_USE_COMPACT_HANDLE || __DOXYGEN__ */
 
-            /* Add widget to linked list of parent widget */
-            GUI_EVT_RESULTTYPE_U8(&result) = 0;
-            guii_widget_callback(h, GUI_EVT_EXCLUDELINKEDLIST, NULL, &result);
-            if (!GUI_EVT_RESULTTYPE_U8(&result)) {   /* Check if widget should be added to linked list */
-                gui_linkedlist_widgetadd(h->parent, h); /* Add entry to linkedlist of parent widget */
-            }
-            guii_widget_callback(h, GUI_EVT_INIT, NULL, NULL);  /* Notify user about init successful */
-            gui_widget_invalidate(h);               /* Invalidate object */
+#if GUI_CFG_USE_WIDGET_CACHE || __DOXYGEN__
 
-            /* Notify parent widget if exists */
-            if (guii_widget_hasparent(h)) {         /* If widget has parent */
-                GUI_EVT_PARAMTYPE_HANDLE(&param) = h;   /* Set widget pointer */
-                guii_widget_callback(guii_widget_getparent(h), GUI_EVT_CHILDWIDGETCREATED, &param, NULL);/* Notify parent about new child widget */
-            }
-        }
+/**
+ * \brief           Free widget cache layer and return its memory to cache budget
+ * \param[in]       h: Widget handle
+ */
+void
+guii_widget_freecache(gui_handle_p h) {
+    if (h->cache_layer != NULL) {
+        GUI.widget_cache_size -= sizeof(*h->cache_layer) + (size_t)h->cache_layer->width * (size_t)h->cache_layer->height * (size_t)GUI.lcd.pixel_size
+            + GUI_LCD_TILES_SIZE(h->cache_layer->width, h->cache_layer->height);
+        GUI_MEMFREE(h->cache_layer);
+        h->cache_layer = NULL;
+    }
+    guii_widget_clrflag(h, GUI_FLAG_CACHE_VALID);
+}
+
+#endif /* GUI_CFG_USE_WIDGET_CACHE || __DOXYGEN__ */
+
+/**
+ * \brief           Enable or disable drawing of widget through retained offscreen cache layer
+ *
+ *                  Widget and its children are rendered once to cache layer and later redraws
+ *                  only copy cached content until widget or any of its children is invalidated.
+ *
+ *                  Transparent widget is blended from cache with its alpha.
+ *                  Enable cache before fading widget with \ref gui_widget_setalpha,
+ *                  each animation frame then only runs blend pass instead of rendering widget tree again.
+ *
+ * \note            Use it for static widgets which paint complete area, such as graph background or keyboard
+ * \note            Function has no effect if \ref GUI_CFG_USE_WIDGET_CACHE is disabled
+ * \param[in]       h: Widget handle
+ * \param[in]       enable: Set to `1` to enable cache or `0` to disable it and release memory
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_setcache(gui_handle_p h, uint8_t enable) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));
+#if GUI_CFG_USE_WIDGET_CACHE
+    GUI_CORE_PROTECT(1);
+    if (enable) {
+        guii_widget_setflag(h, GUI_FLAG_CACHE);
+    } else {
+        guii_widget_clrflag(h, GUI_FLAG_CACHE);
+        guii_widget_freecache(h);
+    }
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+#else /* GUI_CFG_USE_WIDGET_CACHE */
+    GUI_UNUSED(enable);
+    return 0;
+#endif /* !GUI_CFG_USE_WIDGET_CACHE */
+}
+
+/**
+ * \brief           Enable or disable drawing of widget from recorded display list
+ *
+ *                  Drawing calls of widget are recorded during draw callback and replayed on later redraws,
+ *                  for example when widget above it moves, until widget itself is invalidated.
+ *                  Widget is drawn with its callback when its complete visible area is not redrawn at once
+ *                  or drawing does not fit into \ref GUI_CFG_DISPLAY_LIST_SIZE bytes.
+ *
+ * \note            Use it for widgets which draw only with `gui_draw_*` functions
+ *                  and whose drawing depends only on their own state
+ * \note            Function has no effect if \ref GUI_CFG_USE_DISPLAY_LIST is disabled
+ * \param[in]       h: Widget handle
+ * \param[in]       enable: Set to `1` to enable display list or `0` to disable it and release memory
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_setdisplaylist(gui_handle_p h, uint8_t enable) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));
+#if GUI_CFG_USE_DISPLAY_LIST
+    GUI_CORE_PROTECT(1);
+    if (enable) {
+        guii_widget_setflag(h, GUI_FLAG_DISPLAY_LIST);
+    } else {
+        guii_widget_clrflag(h, GUI_FLAG_DISPLAY_LIST);
+        free_draw_list(h);
+    }
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+#else /* GUI_CFG_USE_DISPLAY_LIST */
+    GUI_UNUSED(enable);
+    return 0;
+#endif /* !GUI_CFG_USE_DISPLAY_LIST */
+}
+
+/**
+ * \brief           Set maximal refresh rate of widget
+ *
+ *                  Widget is redrawn immediately on first change and then at most once per period.
+ *                  All changes during period are shown by single redraw at its end.
+ *                  Use it for widgets updated from fast data sources, such as sensor values
+ *
+ * \note            Function has no effect if \ref GUI_CFG_USE_REFRESH_LIMIT is disabled
+ * \param[in]       h: Widget handle
+ * \param[in]       hz: Maximal number of redraws per second or `0` to redraw on every change
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_setrefreshrate(gui_handle_p h, uint16_t hz) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));
+#if GUI_CFG_USE_REFRESH_LIMIT
+    GUI_CORE_PROTECT(1);
+    if (!guii_widget_hasext(h, 1)) {
+        GUI_CORE_UNPROTECT(1);
+        return 0;
     }
-
-    return (void *)h;
+    guii_widget_getext(h)->refresh_period = hz ? (uint16_t)GUI_MAX(1000 / hz, 1) : 0;
+    refresh_reset(h);
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+#else /* GUI_CFG_USE_REFRESH_LIMIT */
+    GUI_UNUSED(hz);
+    return 0;
+#endif /* !GUI_CFG_USE_REFRESH_LIMIT */
 }
 
-/*******************************************/
-/**                  .....                **/
-/*******************************************/
+/**
+ * \brief           Set redraw priority class of widget
+ *
+ *                  While frames take longer than \ref GUI_CFG_REFRESH_FRAME_BUDGET,
+ *                  \ref GUI_WIDGET_PRIO_LIVE widgets are redrawn at most once per refresh period,
+ *                  or once per budget when refresh rate is not set,
+ *                  and \ref GUI_WIDGET_PRIO_BACKGROUND widgets wait until frames fit into budget again
+ *
+ * \note            Function has no effect if \ref GUI_CFG_USE_REFRESH_LIMIT is disabled
+ * \param[in]       h: Widget handle
+ * \param[in]       prio: Priority class, member of \ref gui_widget_prio_t enumeration
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_setpriority(gui_handle_p h, gui_widget_prio_t prio) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h) && prio <= GUI_WIDGET_PRIO_BACKGROUND);
+#if GUI_CFG_USE_REFRESH_LIMIT
+    GUI_CORE_PROTECT(1);
+    if (!guii_widget_hasext(h, 1)) {
+        GUI_CORE_UNPROTECT(1);
+        return 0;
+    }
+    guii_widget_getext(h)->refresh_prio = (uint8_t)prio;
+    refresh_reset(h);
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+#else /* GUI_CFG_USE_REFRESH_LIMIT */
+    GUI_UNUSED(prio);
+    return 0;
+#endif /* !GUI_CFG_USE_REFRESH_LIMIT */
+}
 
 /**
- * \brief           Set color to widget specific index
+ * \brief           Set builder creating children widgets of container on first show
+ *
+ *                  Builder of hidden widget is called once, on first \ref gui_widget_show call for widget,
+ *                  or in idle time before with \ref GUI_CFG_WIDGET_PREBUILD enabled.
+ *                  Builder of visible widget is called immediately.
+ *                  Use it for tab pages and screens which are created hidden at startup
+ *
+ * \note            Function has no effect if \ref GUI_CFG_USE_WIDGET_BUILDER is disabled
  * \param[in]       h: Widget handle
- * \param[in]       index: Index in array of colors
- * \param[in]       color: Actual color code to set
+ * \param[in]       fn: Builder function or `NULL` to cancel builder which was not run yet
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
-gui_widget_setcolor(gui_handle_p h, uint8_t index, gui_color_t color) {
-    uint8_t ret = 1;
+gui_widget_setbuilder(gui_handle_p h, gui_widget_build_fn fn) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));
+#if GUI_CFG_USE_WIDGET_BUILDER
+    gui_handle_p* p;
     
-    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
-
-    if (h->colors == NULL) {                        /* Do we need to allocate color memory? */
-        if (h->widget->color_count) {               /* Check if at least some colors should be used */
-            h->colors = GUI_MEMALLOC(sizeof(*h->colors) * h->widget->color_count);
-            if (h->colors != NULL) {                /* Copy all colors to new memory first */
-                memcpy(h->colors, h->widget->colors, sizeof(*h->colors) * h->widget->color_count);
-            } else {
-                ret = 0;
-            }
+    GUI_CORE_PROTECT(1);
+    if (!guii_widget_hasext(h, fn != NULL)) {
+        GUI_CORE_UNPROTECT(1);
+        return fn == NULL;
+    }
+    if (guii_widget_getext(h)->build != NULL) {
+        build_unlink(h);                            /* Replace builder which was not run yet */
+    }
+    if (fn != NULL) {
+        if (guii_widget_getflag(h, GUI_FLAG_HIDDEN)) {
+            for (p = &GUI.build_list; *p != NULL; p = &guii_widget_getext(*p)->build_next) {}
+            *p = h;                                 /* Prebuild in order of registration */
+            guii_widget_getext(h)->build = fn;
         } else {
-            ret = 0;
+            fn(h);                                  /* Children are needed now */
         }
     }
-    if (ret) {
-        if (index < h->widget->color_count) {       /* Index in valid range */
-           h->colors[index] = color;                /* Set new color */
-        } else {
-            ret = 0;
+    GUI_CORE_UNPROTECT(1);
+    return 1;
+#else /* GUI_CFG_USE_WIDGET_BUILDER */
+    GUI_UNUSED(fn);
+    return 0;
+#endif /* !GUI_CFG_USE_WIDGET_BUILDER */
+}
+
+#if GUI_CFG_USE_OVERLAY || __DOXYGEN__
+
+/**
+ * \brief           Disable overlay plane of widget and free its buffer
+ * \param[in]       h: Widget handle
+ */
+void
+guii_widget_freeoverlay(gui_handle_p h) {
+    gui_overlay_plane_t* plane;
+    gui_overlay_t ov;
+    uint8_t result = 0;
+    size_t i;
+
+    for (i = 0; i < GUI_COUNT_OF(GUI.overlays); i++) {
+        plane = &GUI.overlays[i];
+        if (plane->h != h) {
+            continue;
         }
+        if (plane->shown) {
+            ov.num = (uint8_t)i;
+            ov.layer = NULL;
+            ov.alpha = 0;
+            GUI_LL_CONTROL(GUI_LL_Command_SetOverlay, &ov, &result);
+        }
+        if (plane->layer != NULL) {
+            GUI_MEMFREE(plane->layer);
+        }
+        memset(plane, 0x00, sizeof(*plane));
     }
-    
-    return ret;
+    guii_widget_clrflag(h, GUI_FLAG_OVERLAY);
 }
 
+#endif /* GUI_CFG_USE_OVERLAY || __DOXYGEN__ */
+
 /**
- * \brief           Remove widget from memory
- * \note            If widget has child widgets, they will be removed too
- * \param[in,out]   h: Pointer to widget handle. If removed, pointer will be invalidated and set to `NULL`
- * \return          `1` on success, `0` otherwise
+ * \brief           Enable or disable showing widget on hardware overlay plane
+ *
+ *                  Widget and its children are rendered to plane buffer and display controller
+ *                  blends it over main layer. Moving widget, changing its alpha or hiding it
+ *                  only changes plane setup, widgets below are not redrawn.
+ *
+ * \note            Plane is always on top of main layer, use it for top-level widgets,
+ *                  such as keyboard, dialog or cursor
+ * \note            Function has no effect if \ref GUI_CFG_USE_OVERLAY is disabled
+ * \param[in]       h: Widget handle
+ * \param[in]       enable: Set to `1` to show widget on plane or `0` to draw it normally again
+ * \return          `1` on success, `0` when no plane is available or low-level does not support overlays
  */
 uint8_t
-gui_widget_remove(gui_handle_p* h) {
+gui_widget_setoverlay(gui_handle_p h, uint8_t enable) {
     uint8_t ret = 0;
-    GUI_ASSERTPARAMS(h != NULL && guii_widget_iswidget(*h));  
 
-    if (can_remove_widget(*h)) {                    /* Check if we can delete widget */
-        guii_widget_setflag(*h, GUI_FLAG_REMOVE);   /* Set flag for widget delete */
-        GUI.flags |= GUI_FLAG_REMOVE;               /* Set flag for to remove at least one widget from tree */
-        if (guii_widget_isfocused(h)) {             /* In case current widget is in focus */
-            guii_widget_focus_set(guii_widget_getparent(*h));   /* Set parent as focused */
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));
+#if GUI_CFG_USE_OVERLAY
+    GUI_CORE_PROTECT(1);
+    if (enable == !!guii_widget_getflag(h, GUI_FLAG_OVERLAY)) {
+        ret = 1;                                    /* Nothing to change */
+    } else if (enable) {
+        gui_overlay_t ov;
+        uint8_t result = 1;
+        size_t i;
+
+        for (i = 0; i < GUI_COUNT_OF(GUI.overlays) && (GUI.overlays[i].h != NULL || GUI.overlays[i].layer != NULL); i++) {}  /* Plane may be used by screen transition */
+        ov.num = (uint8_t)i;
+        ov.layer = NULL;
+        ov.alpha = 0;
+        if (i < GUI_COUNT_OF(GUI.overlays)          /* Check plane is free and supported by low-level */
+            && GUI_LL_CONTROL(GUI_LL_Command_SetOverlay, &ov, &result) && !result) {
+            gui_widget_invalidatewithparent(h);     /* Redraw area below without widget */
+            GUI.overlays[i].h = h;
+            guii_widget_setflag(h, GUI_FLAG_OVERLAY | GUI_FLAG_REDRAW);
+            ret = 1;
         }
+    } else {
+        guii_widget_freeoverlay(h);
+        gui_widget_invalidatewithparent(h);         /* Draw widget on main layer again */
         ret = 1;
-        *h = NULL;
-#if GUI_CFG_OS
-        gui_sys_mbox_putnow(&GUI.OS.mbox, NULL);    /* Put message to queue */
-#endif /* GUI_CFG_OS */
     }
-
-    return ret;                                     /* Removed successfully */
+    GUI_CORE_UNPROTECT(1);
+#else /* GUI_CFG_USE_OVERLAY */
+    GUI_UNUSED(enable);
+#endif /* !GUI_CFG_USE_OVERLAY */
+    return ret;
 }
 
 /**
@@ -1279,7 +4305,11 @@ gui_widget_empty(gui_handle_p h) {
             ret = 0;
             break;
         }
-        guii_widget_setflag(h, GUI_FLAG_REMOVE);    /* Set remove flag */
+        if (!guii_widget_getflag(child, GUI_FLAG_REMOVE)) {
+            guii_widget_setflag(child, GUI_FLAG_REMOVE);/* Set remove flag */
+            child->remove_next = GUI.remove_list;   /* Add to pending list */
+            GUI.remove_list = child;
+        }
     }
     
     return ret;
@@ -1315,10 +4345,12 @@ guii_widget_processtextkey(gui_handle_p h, guii_keyboard_data_t* kb) {
     uint32_t ch;
     uint8_t l;
     gui_string_t currStr;
+    gui_handle_ext_t* e;
     
     GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
     
-    if (!guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC)) {  /* Must be dynamically allocated memory */
+    e = guii_widget_getext(h);
+    if (!guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC) || e == NULL) {  /* Must be dynamically allocated memory */
         return 0;
     }
     
@@ -1330,14 +4362,11 @@ guii_widget_processtextkey(gui_handle_p h, guii_keyboard_data_t* kb) {
     tlen = gui_string_lengthtotal(h->text);         /* Get total length of string */
     len = gui_string_length(h->text);               /* Get string length */
     if ((ch == GUI_KEY_LF || ch >= 32) && ch != 127) {  /* Check valid character character */
-        if (len < (h->textmemsize - l)) {           /* Memory still available for new character */
-            size_t pos;
-            for (pos = tlen + l - 1; pos > h->textcursor; pos--) {  /* Shift characters down */
-                h->text[pos] = h->text[pos - l];
-            }
-            for (pos = 0; pos < l; pos++) {         /* Fill new characters to empty memory */
-                h->text[h->textcursor++] = kb->kb.keys[pos];
-            }
+        if (len < (e->textmemsize - l)) {           /* Memory still available for new character */
+            memmove(&h->text[e->textcursor + l], &h->text[e->textcursor], tlen - e->textcursor);    /* Shift characters down */
+            memcpy(&h->text[e->textcursor], kb->kb.keys, l);    /* Fill new characters to empty memory */
+            guii_widget_invalidatetextlayoutfrom(h, e->textcursor); /* Text content changed from cursor */
+            e->textcursor += l;
             h->text[tlen + l] = 0;                  /* Add 0 to the end */
             
             gui_widget_invalidate(h);               /* Invalidate widget */
@@ -1345,20 +4374,17 @@ guii_widget_processtextkey(gui_handle_p h, guii_keyboard_data_t* kb) {
             return 1;
         }
     } else if (ch == 8 || ch == 127) {              /* Backspace character */
-        if (tlen && h->textcursor) {
-            size_t pos;
-            
-            gui_string_prepare(&currStr, (gui_char *)((uint32_t)h->text + h->textcursor - 1));  /* Set string to process */
+        if (tlen && e->textcursor) {
+            gui_string_prepare(&currStr, &h->text[e->textcursor - 1]);    /* Set string to process */
             gui_string_gotoend(&currStr);           /* Go to the end of string */
             if (!gui_string_getchreverse(&currStr, &ch, &l)) {  /* Get last character */
                 return 0;                           
             }
-            for (pos = h->textcursor - l; pos < (tlen - l); pos++) {/* Shift characters up */
-                h->text[pos] = h->text[pos + l];
-            }
-            h->textcursor -= l;                     /* Decrease text cursor by number of bytes for character deleted */
+            memmove(&h->text[e->textcursor - l], &h->text[e->textcursor], tlen - e->textcursor);    /* Shift characters up */
+            e->textcursor -= l;                     /* Decrease text cursor by number of bytes for character deleted */
             h->text[tlen - l] = 0;                  /* Set 0 to the end of string */
             
+            guii_widget_invalidatetextlayoutfrom(h, e->textcursor); /* Text content changed from cursor */
             gui_widget_invalidate(h);               /* Invalidate widget */
             guii_widget_callback(h, GUI_EVT_TEXTCHANGED, NULL, NULL);/* Process callback */
             return 1;
@@ -1367,35 +4393,66 @@ guii_widget_processtextkey(gui_handle_p h, guii_keyboard_data_t* kb) {
     return 0;
 }
 
+/**
+ * \brief           Free dynamically allocated text memory, memory inside handle is only released
+ * \param[in]       h: Widget handle
+ */
+static void
+text_freememory(gui_handle_p h) {
+#if GUI_CFG_WIDGET_TEXT_INLINE_SIZE
+    if (h->text == h->text_inline) {
+        h->text = NULL;
+        return;
+    }
+#endif /* GUI_CFG_WIDGET_TEXT_INLINE_SIZE */
+    GUI_MEMFREE(h->text);
+}
+
 /**
  * \brief           Allocate memory for text operations if text will be dynamic
  * \note            When unicode feature is enabled, memory should be 4x required characters because unicode can store up to 4 bytes for single character
+ * \note            Memory up to \ref GUI_CFG_WIDGET_TEXT_INLINE_SIZE bytes is taken from widget handle instead of heap
  * \param[in]       h: Widget handle
  * \param[in]       size: Number of bytes to allocate
  * \return          Number of bytes allocated
  */
 uint32_t
 gui_widget_alloctextmemory(gui_handle_p h, uint32_t size) {
+    gui_handle_ext_t* e;
+    
     GUI_ASSERTPARAMS(guii_widget_iswidget(h) && size > 1);   
     
+    e = guii_widget_ext(h);
+    if (e == NULL) {
+        return 0;
+    }
     if (guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC) && h->text != NULL) { /* Check if already allocated */
-        GUI_MEMFREE(h->text);                       /* Free memory first */
-        h->textmemsize = 0;                         /* Reset memory size */
+        text_freememory(h);                         /* Free memory first */
+        e->textmemsize = 0;                         /* Reset memory size */
     }
     h->text = NULL;                                 /* Reset pointer */
 
-    h->textmemsize = sizeof(gui_char) * (size + 1); /* Allocate text memory */
-    h->text = GUI_MEMALLOC(h->textmemsize);
+    e->textmemsize = sizeof(gui_char) * (size + 1); /* Allocate text memory */
+#if GUI_CFG_WIDGET_TEXT_INLINE_SIZE
+    if (e->textmemsize <= sizeof(h->text_inline)) { /* Short text fits to handle */
+        memset(h->text_inline, 0x00, sizeof(h->text_inline));
+        h->text = h->text_inline;
+    } else
+#endif /* GUI_CFG_WIDGET_TEXT_INLINE_SIZE */
+    {
+        h->text = GUI_MEMALLOC(e->textmemsize);
+    }
     if (h->text != NULL) {                          /* Check if allocated */
         guii_widget_setflag(h, GUI_FLAG_DYNAMICTEXTALLOC); /* Dynamically allocated */
     } else {
-        h->textmemsize = 0;                         /* No dynamic bytes available */
+        e->textmemsize = 0;                         /* No dynamic bytes available */
         guii_widget_clrflag(h, GUI_FLAG_DYNAMICTEXTALLOC); /* Not allocated */
     }
+    guii_widget_invalidatetextlayout(h);            /* Text memory changed */
     gui_widget_invalidate(h);                       /* Redraw object */
     guii_widget_callback(h, GUI_EVT_TEXTCHANGED, NULL, NULL);   /* Process callback */
     
-    return h->textmemsize;                          /* Return number of bytes allocated */
+    return e->textmemsize;                          /* Return number of bytes allocated */
 }
 
 /**
@@ -1410,10 +4467,10 @@ gui_widget_freetextmemory(gui_handle_p h) {
     GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
     
     if (guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC) && h->text != NULL) { /* Check if dynamically alocated */
-        GUI_MEMFREE(h->text);                       /* Free memory first */
-        h->text = NULL;                             /* Reset memory */
-        h->textmemsize = 0;                         /* Reset memory size */
+        text_freememory(h);                         /* Free memory first */
+        guii_widget_getext(h)->textmemsize = 0;     /* Reset memory size */
         guii_widget_clrflag(h, GUI_FLAG_DYNAMICTEXTALLOC); /* Not allocated */
+        guii_widget_invalidatetextlayout(h);        /* Text memory changed */
         gui_widget_invalidate(h);                   /* Redraw object */
         guii_widget_callback(h, GUI_EVT_TEXTCHANGED, NULL, NULL);   /* Process callback */
         res = 1;
@@ -1427,6 +4484,8 @@ gui_widget_freetextmemory(gui_handle_p h) {
  * \note            If dynamic memory allocation was used then content will be copied to allocated memory
  *                     otherwise only pointer to input text will be used 
  *                     and each further change of input pointer text will affect to output
+ * \note            Text equal to current one is ignored, widget is only redrawn when the same
+ *                     user pointer is passed again as content could be modified in place
  * \param[in]       h: Widget handle
  * \param[in]       text: Pointer to text to set to widget
  * \return          `1` on success, `0` otherwise
@@ -1435,10 +4494,26 @@ uint8_t
 gui_widget_settext(gui_handle_p h, const gui_char* text) {
     GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
     
+    if (h->text != NULL && text != NULL && h->text != text
+        && !gui_string_compare(h->text, text)) {    /* Check for the same content on different memory */
+        if (!guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC)) {
+            h->text = (gui_char *)text;             /* Use new pointer, content stays */
+#if GUI_CFG_USE_TRANSLATE
+            h->text_translated = NULL;              /* Translation may point to old memory */
+#endif /* GUI_CFG_USE_TRANSLATE */
+        }
+        return 1;                                   /* Nothing to redraw */
+    }
+    
+    guii_widget_invalidatetextlayout(h);            /* Content may change even with the same pointer */
+#if GUI_CFG_USE_TRANSLATE
+    h->text_translated = NULL;                      /* Translate text again on next use */
+#endif /* GUI_CFG_USE_TRANSLATE */
     if (guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC)) {   /* Memory for text is dynamically allocated */
-        if (h->textmemsize) {
-            if (gui_string_lengthtotal(text) > (h->textmemsize - 1)) {  /* Check string length */
-                gui_string_copyn(h->text, text, h->textmemsize - 1);    /* Do not copy all bytes because of memory overflow */
+        size_t memsize = guii_widget_getextvalue(h, textmemsize);
+        if (memsize) {
+            if (gui_string_lengthtotal(text) > (memsize - 1)) {  /* Check string length */
+                gui_string_copyn(h->text, text, memsize - 1);   /* Do not copy all bytes because of memory overflow */
             } else {
                 gui_string_copy(h->text, text);     /* Copy entire string */
             }
@@ -1457,8 +4532,48 @@ gui_widget_settext(gui_handle_p h, const gui_char* text) {
             guii_widget_callback(h, GUI_EVT_TEXTCHANGED, NULL, NULL);   /* Process callback */
         }
     }
-    h->textcursor = gui_string_lengthtotal(h->text);/* Set cursor to the end of string */
+    if (guii_widget_hasext(h, 0)) {                 /* Only widgets with optional data edit text */
+        guii_widget_getext(h)->textcursor = gui_string_lengthtotal(h->text);/* Set cursor to the end of string */
+    }
+    
+    return 1;
+}
+
+/**
+ * \brief           Append text to the end of widget text
+ *
+ *                  Widget must use dynamically allocated text memory, see \ref gui_widget_alloctextmemory.
+ *                  Text is truncated when memory is full. Cached layout keeps lines before appended text,
+ *                  which makes appending to long multi-line text fast, for example in log window.
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       text: Text to append
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_appendtext(gui_handle_p h, const gui_char* text) {
+    size_t memsize, len;
+    
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h) && text != NULL);
     
+    memsize = guii_widget_getextvalue(h, textmemsize);
+    if (!guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC) || !memsize || h->text == NULL) {
+        return 0;
+    }
+    len = gui_string_lengthtotal(h->text);
+    if (len >= (memsize - 1) || !*text) {
+        return 0;
+    }
+    guii_widget_invalidatetextlayoutfrom(h, len);   /* Only lines from the end change */
+#if GUI_CFG_USE_TRANSLATE
+    h->text_translated = NULL;                      /* Translate text again on next use */
+#endif /* GUI_CFG_USE_TRANSLATE */
+    gui_string_copyn(&h->text[len], text, memsize - 1 - len);
+    if (guii_widget_hasext(h, 0)) {
+        guii_widget_getext(h)->textcursor = gui_string_lengthtotal(h->text);/* Set cursor to the end of string */
+    }
+    gui_widget_invalidate(h);                       /* Redraw object */
+    guii_widget_callback(h, GUI_EVT_TEXTCHANGED, NULL, NULL);   /* Process callback */
     return 1;
 }
 
@@ -1477,7 +4592,11 @@ gui_widget_gettext(gui_handle_p h) {
 #if GUI_CFG_USE_TRANSLATE
     /* For static texts only */
     if (!guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC) && h->text != NULL) {
-        t = gui_translate_get(h->text);             /* Get translation entry */
+        if (h->text_translated == NULL || h->text_translate_version != GUI.translate.version) { /* Translate only after text or language change */
+            h->text_translated = gui_translate_get(h->text);
+            h->text_translate_version = GUI.translate.version;
+        }
+        t = h->text_translated;                     /* Get translation entry */
     } else 
 #endif /* GUI_CFG_USE_TRANSLATE */
     { 
@@ -1552,7 +4671,7 @@ gui_widget_getfont(gui_handle_p h) {
  */
 uint8_t
 gui_widget_setsize(gui_handle_p h, gui_dim_t width, gui_dim_t height) {
-    return set_widget_size(h, GUI_FLOAT(width), GUI_FLOAT(height), 0, 0);
+    return set_widget_size(h, GUI_COORD(width), GUI_COORD(height), 0, 0);
 }
 
 /**
@@ -1564,7 +4683,7 @@ gui_widget_setsize(gui_handle_p h, gui_dim_t width, gui_dim_t height) {
  */
 uint8_t
 gui_widget_setsizepercent(gui_handle_p h, float width, float height) {
-    return set_widget_size(h, width, height, 1, 1);
+    return set_widget_size(h, GUI_COORD(width), GUI_COORD(height), 1, 1);
 }
 
 /**
@@ -1577,7 +4696,7 @@ gui_widget_setsizepercent(gui_handle_p h, float width, float height) {
  */
 uint8_t
 gui_widget_setsizeoriginal(gui_handle_p h, float width, float height) {
-    return set_widget_size(h, width, height,
+    return set_widget_size(h, GUI_COORD(width), GUI_COORD(height),
         guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT) == GUI_FLAG_WIDTH_PERCENT,
         guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT) == GUI_FLAG_HEIGHT_PERCENT
     );
@@ -1591,7 +4710,7 @@ gui_widget_setsizeoriginal(gui_handle_p h, float width, float height) {
  */
 uint8_t
 gui_widget_setwidth(gui_handle_p h, gui_dim_t width) {
-    return set_widget_size(h, GUI_FLOAT(width), h->height,
+    return set_widget_size(h, GUI_COORD(width), h->height,
         0,
         guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT) == GUI_FLAG_HEIGHT_PERCENT
     );
@@ -1605,7 +4724,7 @@ gui_widget_setwidth(gui_handle_p h, gui_dim_t width) {
  */
 uint8_t
 gui_widget_setwidthpercent(gui_handle_p h, float width) {
-    return set_widget_size(h, width, h->height,
+    return set_widget_size(h, GUI_COORD(width), h->height,
         1,
         guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT) == GUI_FLAG_HEIGHT_PERCENT
     );
@@ -1620,7 +4739,7 @@ gui_widget_setwidthpercent(gui_handle_p h, float width) {
  */
 uint8_t
 gui_widget_setwidthoriginal(gui_handle_p h, float width) {
-    return set_widget_size(h, width, h->height,
+    return set_widget_size(h, GUI_COORD(width), h->height,
         guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT) == GUI_FLAG_WIDTH_PERCENT,
         guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT) == GUI_FLAG_HEIGHT_PERCENT
     );
@@ -1634,7 +4753,7 @@ gui_widget_setwidthoriginal(gui_handle_p h, float width) {
  */
 uint8_t
 gui_widget_setheight(gui_handle_p h, gui_dim_t height) {
-    return set_widget_size(h, h->width, GUI_FLOAT(height),
+    return set_widget_size(h, h->width, GUI_COORD(height),
         guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT) == GUI_FLAG_WIDTH_PERCENT,
         0
     );
@@ -1648,7 +4767,7 @@ gui_widget_setheight(gui_handle_p h, gui_dim_t height) {
  */
 uint8_t
 gui_widget_setheightpercent(gui_handle_p h, float height) {
-    return set_widget_size(h, h->width, height,
+    return set_widget_size(h, h->width, GUI_COORD(height),
         guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT) == GUI_FLAG_WIDTH_PERCENT,
         1
     );
@@ -1663,7 +4782,7 @@ gui_widget_setheightpercent(gui_handle_p h, float height) {
  */
 uint8_t
 gui_widget_setheightoriginal(gui_handle_p h, float height) {
-    return set_widget_size(h, h->width, height,
+    return set_widget_size(h, h->width, GUI_COORD(height),
         guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT) == GUI_FLAG_WIDTH_PERCENT,
         guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT) == GUI_FLAG_HEIGHT_PERCENT
     );
@@ -1696,6 +4815,7 @@ gui_widget_getwidth(gui_handle_p h) {
     GUI_ASSERTPARAMS(guii_widget_iswidget(h) && GUI.initialized); 
     
 #if GUI_CFG_USE_POS_SIZE_CACHE
+    guii_widget_updateabs(h);
     res = h->abs_width;                             /* Cached value */
 #else /* GUI_CFG_USE_POS_SIZE_CACHE */
     res = calculate_widget_width(h);                /* Calculate value */
@@ -1720,6 +4840,7 @@ gui_widget_getheight(gui_handle_p h) {
     GUI_ASSERTPARAMS(guii_widget_iswidget(h) && GUI.initialized); 
 
 #if GUI_CFG_USE_POS_SIZE_CACHE
+    guii_widget_updateabs(h);
     res = h->abs_height;                            /* Cached value */
 #else /* GUI_CFG_USE_POS_SIZE_CACHE */
     res = calculate_widget_height(h);               /* Calculate value */
@@ -1791,7 +4912,7 @@ gui_widget_getwidthoriginal(gui_handle_p h, uint8_t* is_percent) {
     if (is_percent != NULL) {
         *is_percent = guii_widget_getflag(h, GUI_FLAG_WIDTH_PERCENT) == GUI_FLAG_WIDTH_PERCENT;
     }
-    return h->width;
+    return GUI_COORD_FLOAT(h->width);
 }
 
 /**
@@ -1807,7 +4928,7 @@ gui_widget_getheightoriginal(gui_handle_p h, uint8_t* is_percent) {
     if (is_percent != NULL) {
         *is_percent = guii_widget_getflag(h, GUI_FLAG_HEIGHT_PERCENT) == GUI_FLAG_HEIGHT_PERCENT;
     }
-    return h->height;
+    return GUI_COORD_FLOAT(h->height);
 }
 
 /**
@@ -1829,9 +4950,13 @@ gui_widget_setexpanded(gui_handle_p h, uint8_t state) {
         gui_widget_invalidatewithparent(h);         /* Invalidate with parent first for clipping region */
         guii_widget_clrflag(h, GUI_FLAG_EXPANDED);  /* Clear expanded after invalidation */
         SET_WIDGET_ABS_VALUES(h);                   /* Set widget absolute values */
+        SET_WIDGET_LAYOUT_DIRTY(h);
+        SET_WIDGET_LAYOUT_DIRTY(guii_widget_getparent(h));
     } else if (state && !is_expanded) {
         guii_widget_setflag(h, GUI_FLAG_EXPANDED);  /* Expand widget */
         SET_WIDGET_ABS_VALUES(h);                   /* Set widget absolute values */
+        SET_WIDGET_LAYOUT_DIRTY(h);
+        SET_WIDGET_LAYOUT_DIRTY(guii_widget_getparent(h));
         gui_widget_invalidate(h);                   /* Redraw only selected widget as it is over all window */
     }
     
@@ -1863,7 +4988,7 @@ gui_widget_isexpanded(gui_handle_p h) {
  */
 uint8_t
 gui_widget_setposition(gui_handle_p h, gui_dim_t x, gui_dim_t y) {
-    return set_widget_position(h, GUI_FLOAT(x), GUI_FLOAT(y), 0, 0);
+    return set_widget_position(h, GUI_COORD(x), GUI_COORD(y), 0, 0);
 }
 
 /**
@@ -1875,7 +5000,7 @@ gui_widget_setposition(gui_handle_p h, gui_dim_t x, gui_dim_t y) {
  */
 uint8_t
 gui_widget_setpositionpercent(gui_handle_p h, float x, float y) {
-    return set_widget_position(h, x, y, 1, 1);
+    return set_widget_position(h, GUI_COORD(x), GUI_COORD(y), 1, 1);
 }
 
 /**
@@ -1888,7 +5013,7 @@ gui_widget_setpositionpercent(gui_handle_p h, float x, float y) {
  */
 uint8_t
 gui_widget_setpositionoriginal(gui_handle_p h, float x, float y) {
-    return set_widget_position(h, x, y,
+    return set_widget_position(h, GUI_COORD(x), GUI_COORD(y),
         guii_widget_getflag(h, GUI_FLAG_XPOS_PERCENT) == GUI_FLAG_XPOS_PERCENT,
         guii_widget_getflag(h, GUI_FLAG_YPOS_PERCENT) == GUI_FLAG_YPOS_PERCENT
     );
@@ -1902,7 +5027,7 @@ gui_widget_setpositionoriginal(gui_handle_p h, float x, float y) {
  */
 uint8_t
 gui_widget_setxposition(gui_handle_p h, gui_dim_t x) {
-    return set_widget_position(h, GUI_FLOAT(x), h->y,
+    return set_widget_position(h, GUI_COORD(x), h->y,
         0,
         guii_widget_getflag(h, GUI_FLAG_YPOS_PERCENT) == GUI_FLAG_YPOS_PERCENT
     );
@@ -1916,7 +5041,7 @@ gui_widget_setxposition(gui_handle_p h, gui_dim_t x) {
  */
 uint8_t
 gui_widget_setxpositionpercent(gui_handle_p h, float x) {
-    return set_widget_position(h, x, h->y,
+    return set_widget_position(h, GUI_COORD(x), h->y,
         1,
         guii_widget_getflag(h, GUI_FLAG_YPOS_PERCENT) == GUI_FLAG_YPOS_PERCENT
     );
@@ -1930,7 +5055,7 @@ gui_widget_setxpositionpercent(gui_handle_p h, float x) {
  * \return          `1` on success, `0` otherwise
  */uint8_t
 gui_widget_setxpositionoriginal(gui_handle_p h, float x) {
-    return set_widget_position(h, x, h->y,
+    return set_widget_position(h, GUI_COORD(x), h->y,
         guii_widget_getflag(h, GUI_FLAG_XPOS_PERCENT) == GUI_FLAG_XPOS_PERCENT,
         guii_widget_getflag(h, GUI_FLAG_YPOS_PERCENT) == GUI_FLAG_YPOS_PERCENT
     );
@@ -1944,7 +5069,7 @@ gui_widget_setxpositionoriginal(gui_handle_p h, float x) {
  */
 uint8_t
 gui_widget_setyposition(gui_handle_p h, gui_dim_t y) {
-    return set_widget_position(h, h->x, GUI_FLOAT(y),
+    return set_widget_position(h, h->x, GUI_COORD(y),
         guii_widget_getflag(h, GUI_FLAG_XPOS_PERCENT) == GUI_FLAG_XPOS_PERCENT,
         0
     );
@@ -1958,7 +5083,7 @@ gui_widget_setyposition(gui_handle_p h, gui_dim_t y) {
  */
 uint8_t
 gui_widget_setypositionpercent(gui_handle_p h, float y) {
-    return set_widget_position(h, h->x, y,
+    return set_widget_position(h, h->x, GUI_COORD(y),
         guii_widget_getflag(h, GUI_FLAG_XPOS_PERCENT) == GUI_FLAG_XPOS_PERCENT,
         1
     );
@@ -1973,7 +5098,7 @@ gui_widget_setypositionpercent(gui_handle_p h, float y) {
  */
 uint8_t
 gui_widget_setypositionoriginal(gui_handle_p h, float y) {
-    return set_widget_position(h, h->x, y,
+    return set_widget_position(h, h->x, GUI_COORD(y),
         guii_widget_getflag(h, GUI_FLAG_XPOS_PERCENT) == GUI_FLAG_XPOS_PERCENT,
         guii_widget_getflag(h, GUI_FLAG_YPOS_PERCENT) == GUI_FLAG_YPOS_PERCENT
     );
@@ -1992,7 +5117,7 @@ gui_widget_getxpositionoriginal(gui_handle_p h, uint8_t* is_percent) {
     if (is_percent != NULL) {
         *is_percent = guii_widget_getflag(h, GUI_FLAG_XPOS_PERCENT) == GUI_FLAG_XPOS_PERCENT;
     }
-    return h->x;
+    return GUI_COORD_FLOAT(h->x);
 }
 
 /**
@@ -2008,7 +5133,7 @@ gui_widget_getypositionoriginal(gui_handle_p h, uint8_t* is_percent) {
     if (is_percent != NULL) {
         *is_percent = guii_widget_getflag(h, GUI_FLAG_YPOS_PERCENT) == GUI_FLAG_YPOS_PERCENT;
     }
-    return h->y;
+    return GUI_COORD_FLOAT(h->y);
 }
 
 /**
@@ -2022,6 +5147,14 @@ gui_widget_invalidate(gui_handle_p h) {
     
     GUI_ASSERTPARAMS(guii_widget_iswidget(h));     
     
+#if GUI_CFG_USE_DISPLAY_LIST
+    invalidate_draw_list(h);
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+#if GUI_CFG_USE_REFRESH_LIMIT
+    if (refresh_defer(h)) {
+        return 1;                                   /* Widget is redrawn at the end of its refresh window */
+    }
+#endif /* GUI_CFG_USE_REFRESH_LIMIT */
     if (!guii_widget_getflag(h, GUI_FLAG_IGNORE_INVALIDATE)) {
         res = invalidate_widget(h, 1);              /* Invalidate widget with clipping */
         if (guii_widget_hasparent(h) && (
@@ -2042,6 +5175,299 @@ gui_widget_force_invalidate(gui_handle_p h) {
     return gui_widget_invalidate(h);
 }
 
+/**
+ * \brief           Invalidate only part of widget and prepare it for redraw
+ *
+ *                  Widget is redrawn with clipping region limited to selected area,
+ *                  for example single edited line of multi-line text
+ *
+ * \note            Complete widget is invalidated when it depends on other widgets in redraw,
+ *                  such as transparent or overlay widgets.
+ *                  Parent of widget with \ref GUI_FLAG_WIDGET_INVALIDATE_PARENT flag is redrawn in the same area only
+ * \param[in]       h: Widget handle
+ * \param[in]       x: `X` position of area relative to widget
+ * \param[in]       y: `Y` position of area relative to widget
+ * \param[in]       width: Area width in units of pixels
+ * \param[in]       height: Area height in units of pixels
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_invalidatearea(gui_handle_p h, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height) {
+    gui_dim_t x1, y1, x2, y2, ax, ay;
+    gui_display_t area;
+    gui_handle_p h1;
+    
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));
+    
+#if GUI_CFG_USE_DISPLAY_LIST
+    invalidate_draw_list(h);
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+    if (guii_widget_getflag(h, GUI_FLAG_IGNORE_INVALIDATE)) {
+        return 0;
+    }
+    for (h1 = h; h1 != NULL; h1 = guii_widget_getparent(h1)) {
+        if (GUI.redrawing
+#if GUI_CFG_USE_ALPHA
+            || guii_widget_hasalpha(h1)
+#endif /* GUI_CFG_USE_ALPHA */
+#if GUI_CFG_USE_OVERLAY
+            || guii_widget_getflag(h1, GUI_FLAG_OVERLAY)
+#endif /* GUI_CFG_USE_OVERLAY */
+            || (h1 != h && (guii_widget_getflag(h1, GUI_FLAG_WIDGET_INVALIDATE_PARENT)
+                || guii_widget_getcoreflag(h1, GUI_FLAG_WIDGET_INVALIDATE_PARENT)))) {
+            return gui_widget_invalidate(h);        /* Area of parent must be redrawn too */
+        }
+    }
+#if GUI_CFG_USE_REFRESH_LIMIT
+    if (refresh_defer(h)) {
+        return 1;                                   /* Complete widget is invalidated at the end of its refresh window */
+    }
+#endif /* GUI_CFG_USE_REFRESH_LIMIT */
+    
+    /* Get part of area visible on screen */
+    get_widget_abs_visible_position_size(h, &x1, &y1, &x2, &y2);
+    ax = gui_widget_getabsolutex(h) + x;
+    ay = gui_widget_getabsolutey(h) + y;
+    x1 = GUI_MAX(x1, ax);
+    y1 = GUI_MAX(y1, ay);
+    x2 = GUI_MIN(x2, ax + width);
+    y2 = GUI_MIN(y2, ay + height);
+    if (x2 <= x1 || y2 <= y1) {
+        return 1;                                   /* Area is not visible */
+    }
+    
+    area.x1 = x1;
+    area.y1 = y1;
+    area.x2 = x2;
+    area.y2 = y2;
+    if (!invalidate_widget_area(h, 0, &area)) {     /* Redraw widget without its complete clipping region */
+        return 0;
+    }
+    if (guii_widget_hasparent(h) && (
+            guii_widget_getflag(h, GUI_FLAG_WIDGET_INVALIDATE_PARENT) ||
+            guii_widget_getcoreflag(h, GUI_FLAG_WIDGET_INVALIDATE_PARENT))) {
+        invalidate_widget_area(guii_widget_getparent(h), 0, &area); /* Parent is drawn below widget in the same area */
+    }
+#if GUI_CFG_USE_POPUP_RESTORE
+    if (popup_check_area(h, x1, y1, x2, y2)) {
+        return 1;                                   /* Area is restored from saved pixels */
+    }
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+    add_dirty_area(x1, y1, x2, y2);
+    return 1;
+}
+
+/**
+ * \brief           Scroll content of widget area vertically and prepare it for redraw
+ *
+ *                  Pixels of area on newest frame are shifted by `dy` on next frame
+ *                  and only part of area uncovered by shift is redrawn,
+ *                  for example single line appended to bottom of log window.
+ *                  Complete area is invalidated when pixels cannot be copied
+ *
+ * \note            Area must be painted by widget itself, content drawn after scroll
+ *                  must be the same as content drawn before scroll, moved by `dy` pixels
+ * \note            Pixels are copied only with \ref GUI_CFG_USE_COPY_MOVE enabled,
+ *                  when widget is fully visible and not covered by any other widget
+ * \param[in]       h: Widget handle
+ * \param[in]       x: `X` position of area relative to widget
+ * \param[in]       y: `Y` position of area relative to widget
+ * \param[in]       width: Area width in units of pixels
+ * \param[in]       height: Area height in units of pixels
+ * \param[in]       dy: Number of pixels to shift content by. Negative value shifts content up
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_scrollarea(gui_handle_p h, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t dy) {
+#if GUI_CFG_USE_COPY_MOVE
+    gui_display_t a, r;
+#endif /* GUI_CFG_USE_COPY_MOVE */
+
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h) && width > 0 && height > 0);
+    
+    if (dy == 0) {
+        return 1;
+    }
+#if GUI_CFG_USE_COPY_MOVE
+    a.x1 = gui_widget_getabsolutex(h) + x;
+    a.y1 = gui_widget_getabsolutey(h) + y;
+    a.x2 = a.x1 + width;
+    a.y2 = a.y1 + height;
+    if (GUI.scroll_widget == h && !memcmp(&GUI.scroll_area, &a, sizeof(a))) {
+        dy += GUI.scroll_dy;                        /* Shift newest frame only once, by total distance */
+        GUI.scroll_widget = NULL;
+    } else if (GUI.scroll_widget != NULL || guii_widget_getflag(h, GUI_FLAG_IGNORE_INVALIDATE)
+        || !can_copy_scroll(h) || !get_copy_move_area(h, &r) || is_area_dirty(&a)
+        || a.x1 < r.x1 || a.y1 < r.y1 || a.x2 > r.x2 || a.y2 > r.y2) {
+        dy = height;                                /* Pixels on newest frame cannot be used */
+    }
+    if (dy == 0) {
+        return 1;                                   /* Uncovered areas of previous shifts are already invalidated */
+    }
+    if (GUI_ABS(dy) < height) {
+        GUI.scroll_widget = h;
+        GUI.scroll_area = a;
+        GUI.scroll_dy = dy;
+        if (dy < 0) {
+            return gui_widget_invalidatearea(h, x, y + height + dy, width, -dy);    /* Bottom strip */
+        }
+        return gui_widget_invalidatearea(h, x, y, width, dy);   /* Top strip */
+    }
+#endif /* GUI_CFG_USE_COPY_MOVE */
+    return gui_widget_invalidatearea(h, x, y, width, height);
+}
+
+/**
+ * \brief           Start opening of popup widget, such as dropdown list or dialog
+ *
+ *                  Pixels of newest frame below popup are saved on first frame popup is drawn.
+ *                  When popup is closed with \ref gui_widget_popup_close,
+ *                  they are copied back instead of redrawing widgets below popup.
+ *                  Call \ref gui_widget_popup_end when popup has its final size and position
+ *
+ * \note            Only popup itself may change between begin and end calls
+ * \note            Pixels are saved only with \ref GUI_CFG_USE_POPUP_RESTORE enabled
+ * \param[in]       h: Widget opened as popup if it already exists, set to `NULL` when popup is created.
+ *                      Regions waiting for redraw inside its area do not prevent saving
+ * \return          `1` on success, `0` otherwise
+ * \sa              gui_widget_popup_end, gui_widget_popup_close
+ */
+uint8_t
+gui_widget_popup_begin(gui_handle_p h) {
+#if GUI_CFG_USE_POPUP_RESTORE
+    gui_display_t* d = &GUI.popup_area;
+    const gui_display_t* r;
+    gui_dim_t x1 = GUI_DIM_MAX, y1 = GUI_DIM_MAX, x2 = GUI_DIM_MIN, y2 = GUI_DIM_MIN;
+    size_t i, cnt;
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+
+    GUI_ASSERTPARAMS(h == NULL || guii_widget_iswidget(h));
+
+#if GUI_CFG_USE_POPUP_RESTORE
+    if (GUI.popup_state != GUI_POPUP_IDLE) {
+        return 0;                                   /* Pixels are saved for one popup only */
+    }
+    if (h != NULL) {
+        get_widget_abs_visible_position_size(h, &x1, &y1, &x2, &y2);
+    }
+
+    /* Regions waiting for redraw are not up to date on newest frame */
+    d->x1 = GUI_DIM_MAX;
+    d->y1 = GUI_DIM_MAX;
+    d->x2 = GUI_DIM_MIN;
+    d->y2 = GUI_DIM_MIN;
+    cnt = GUI.display_regions_count ? GUI.display_regions_count : 1;
+    for (i = 0; i < cnt; i++) {
+        r = GUI.display_regions_count ? &GUI.display_regions[i] : &GUI.display;
+        if (r->x1 >= r->x2 || r->y1 >= r->y2
+            || (r->x1 >= x1 && r->y1 >= y1 && r->x2 <= x2 && r->y2 <= y2)) {  /* Popup draws over its old area */
+            continue;
+        }
+        d->x1 = GUI_MIN(d->x1, r->x1);
+        d->y1 = GUI_MIN(d->y1, r->y1);
+        d->x2 = GUI_MAX(d->x2, r->x2);
+        d->y2 = GUI_MAX(d->y2, r->y2);
+    }
+    GUI.popup_state = GUI_POPUP_OPENING;
+    return 1;
+#else /* GUI_CFG_USE_POPUP_RESTORE */
+    GUI_UNUSED(h);
+    return 0;
+#endif /* !GUI_CFG_USE_POPUP_RESTORE */
+}
+
+/**
+ * \brief           End opening of popup widget and prepare memory for pixels below it
+ * \param[in]       h: Popup widget handle. Set to `NULL` if popup was not created
+ * \return          `1` if pixels below popup are saved on next frame, `0` otherwise
+ * \sa              gui_widget_popup_begin
+ */
+uint8_t
+gui_widget_popup_end(gui_handle_p h) {
+#if GUI_CFG_USE_POPUP_RESTORE
+    gui_display_t* d = &GUI.popup_area;
+    gui_dim_t x1, y1, x2, y2;
+    gui_handle_p p;
+#endif /* GUI_CFG_USE_POPUP_RESTORE */
+
+    GUI_ASSERTPARAMS(h == NULL || guii_widget_iswidget(h));
+
+#if GUI_CFG_USE_POPUP_RESTORE
+    if (GUI.popup_state != GUI_POPUP_OPENING) {
+        return 0;
+    }
+    GUI.popup_state = GUI_POPUP_IDLE;
+    if (h == NULL || guii_widget_ishiddentree(h)) {
+        return 0;
+    }
+    for (p = h; p != NULL; p = guii_widget_getparent(p)) {
+        if (guii_widget_getflag(p, GUI_FLAG_OVERLAY)
+            || (p != h && guii_widget_getflag(p, GUI_FLAG_CACHE))) {
+            return 0;                               /* Popup is not drawn directly to main layer */
+        }
+    }
+    get_widget_abs_visible_position_size(h, &x1, &y1, &x2, &y2);
+    x1 = GUI_MAX(x1, 0);
+    y1 = GUI_MAX(y1, 0);
+    x2 = GUI_MIN(x2, GUI.lcd.width);
+    y2 = GUI_MIN(y2, GUI.lcd.height);
+    if (x2 <= x1 || y2 <= y1
+        || (d->x1 < d->x2 && GUI_RECT_MATCH(x1, y1, x2, y2, d->x1, d->y1, d->x2, d->y2))) {
+        return 0;                                   /* Pixels below popup are not up to date */
+    }
+    GUI.popup_buff = GUI_MEMALLOC_CLASS((size_t)GUI.lcd.pixel_size * (size_t)(x2 - x1) * (size_t)(y2 - y1), GUI_MEM_CLASS_PIXEL);
+    if (GUI.popup_buff == NULL) {
+        return 0;
+    }
+    d->x1 = x1;
+    d->y1 = y1;
+    d->x2 = x2;
+    d->y2 = y2;
+    GUI.popup_widget = h;
+    GUI.popup_state = GUI_POPUP_SAVE;
+    return 1;
+#else /* GUI_CFG_USE_POPUP_RESTORE */
+    GUI_UNUSED(h);
+    return 0;
+#endif /* !GUI_CFG_USE_POPUP_RESTORE */
+}
+
+/**
+ * \brief           Close popup widget and restore pixels below it
+ *
+ *                  Call function before popup changes its size or is removed.
+ *                  Area of popup is restored from saved pixels on next frame
+ *                  and popup is redrawn only on its final position.
+ *                  When pixels are not saved, popup closes as usual and widgets below it are redrawn
+ *
+ * \param[in]       h: Popup widget handle
+ * \return          `1` if area is restored from saved pixels, `0` otherwise
+ * \sa              gui_widget_popup_begin
+ */
+uint8_t
+gui_widget_popup_close(gui_handle_p h) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));
+
+#if GUI_CFG_USE_POPUP_RESTORE
+    if (GUI.popup_widget != h) {
+        return 0;
+    }
+    if (GUI.popup_state == GUI_POPUP_RESTORE) {
+        return 1;                                   /* Popup is already closed */
+    }
+    if (GUI.popup_state != GUI_POPUP_SAVED) {
+        popup_release();                            /* Popup closed before it was drawn */
+        return 0;
+    }
+    GUI.popup_state = GUI_POPUP_RESTORE;
+    set_redraw_pending();                           /* Saved pixels are copied even if nothing else changes */
+    return 1;
+#else /* GUI_CFG_USE_POPUP_RESTORE */
+    GUI_UNUSED(h);
+    return 0;
+#endif /* !GUI_CFG_USE_POPUP_RESTORE */
+}
+
 /**
  * \brief           Set ignore widget option
  *                  
@@ -2086,8 +5512,13 @@ gui_widget_show(gui_handle_p h) {
     GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
     
     if (guii_widget_getflag(h, GUI_FLAG_HIDDEN)) {  /* If hidden, show it */
+#if GUI_CFG_USE_WIDGET_BUILDER
+        widget_build(h);                            /* Children are created while widget is still hidden */
+#endif /* GUI_CFG_USE_WIDGET_BUILDER */
         guii_widget_clrflag(h, GUI_FLAG_HIDDEN);
+        update_hidden_tree(h);                      /* Children are visible again before invalidation */
         gui_widget_invalidatewithparent(h);         /* Invalidate it for redraw with parent */
+        SET_WIDGET_LAYOUT_DIRTY(guii_widget_getparent(h));
     }
     
     return 1;
@@ -2127,9 +5558,12 @@ gui_widget_hide(gui_handle_p h) {
         }
         if (GUI.active_widget != NULL && (GUI.active_widget == h || gui_widget_ischildof(GUI.active_widget, h))) {      /* Clear active */
             guii_widget_active_clear();
+            PT_INIT(&GUI.touch.pt);                 /* Hidden widget gets no click or long press */
         }
         gui_widget_invalidatewithparent(h);         /* Invalidate it for redraw with parent */
         guii_widget_setflag(h, GUI_FLAG_HIDDEN);    /* Hide widget */
+        update_hidden_tree(h);
+        SET_WIDGET_LAYOUT_DIRTY(guii_widget_getparent(h));
     }
     
     return 1;
@@ -2184,6 +5618,13 @@ gui_widget_getparent(gui_handle_p h) {
  */
 gui_handle_p
 gui_widget_getbyid(gui_id_t id) {
+#if GUI_CFG_USE_WIDGET_ID_HASH
+    gui_handle_p h;
+    
+    if (id_hash_find(id, &h)) {                     /* Unique ID or no widget at all */
+        return h;
+    }
+#endif /* GUI_CFG_USE_WIDGET_ID_HASH */
     return get_widget_by_id(NULL, id, 1);           /* Find widget by ID */
 }
 
@@ -2199,6 +5640,19 @@ gui_widget_getbyid(gui_id_t id) {
  */
 gui_handle_p
 gui_widget_getbyid_ex(gui_id_t id, gui_handle_p parent, uint8_t deep) {
+#if GUI_CFG_USE_WIDGET_ID_HASH
+    gui_handle_p h, p;
+    
+    if (id_hash_find(id, &h)) {                     /* Unique ID, check only its position in tree */
+        if (h != NULL && (parent != NULL || !deep)) {
+            for (p = guii_widget_getparent(h); p != parent && deep && p != NULL; p = guii_widget_getparent(p)) {}
+            if (p != parent) {
+                h = NULL;
+            }
+        }
+        return h;
+    }
+#endif /* GUI_CFG_USE_WIDGET_ID_HASH */
     return get_widget_by_id(parent, id, deep);      /* Search widget */
 }
 
@@ -2268,7 +5722,7 @@ gui_widget_getuserdata(gui_handle_p h) {
 uint8_t
 gui_widget_processdefaultcallback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result) {
     GUI_ASSERTPARAMS(guii_widget_iswidget(h));
-    return h->widget->callback(h, evt, param, result); /* Call default callback function */
+    return guii_widget_typecallback(h, evt, param, result); /* Call default callback function */
 }
 
 /**
@@ -2316,8 +5770,8 @@ gui_widget_setscrollx(gui_handle_p h, gui_dim_t scroll) {
     
     GUI_ASSERTPARAMS(guii_widget_iswidget(h) && guii_widget_allowchildren(h));
     
-    if (h->x_scroll != scroll) {
-        h->x_scroll = scroll;
+    if (guii_widget_getextvalue(h, x_scroll) != scroll && guii_widget_hasext(h, 1)) {
+        guii_widget_getext(h)->x_scroll = scroll;
         SET_WIDGET_ABS_VALUES(h);                   /* Set new absolute values */
         gui_widget_invalidate(h);                   /* Invalidate widget */
         ret = 1;
@@ -2338,8 +5792,8 @@ gui_widget_setscrolly(gui_handle_p h, gui_dim_t scroll) {
     
     GUI_ASSERTPARAMS(guii_widget_iswidget(h) && guii_widget_allowchildren(h));
     
-    if (h->y_scroll != scroll) {
-        h->y_scroll = scroll;
+    if (guii_widget_getextvalue(h, y_scroll) != scroll && guii_widget_hasext(h, 1)) {
+        guii_widget_getext(h)->y_scroll = scroll;
         SET_WIDGET_ABS_VALUES(h);                   /* Set new absolute values */
         gui_widget_invalidate(h);                   /* Invalidate widget */
         ret = 1;
@@ -2361,8 +5815,8 @@ gui_widget_incscrollx(gui_handle_p h, gui_dim_t scroll) {
     
     GUI_ASSERTPARAMS(guii_widget_iswidget(h) && guii_widget_allowchildren(h));
     
-    if (scroll) {
-        h->x_scroll += scroll;
+    if (scroll && guii_widget_hasext(h, 1)) {
+        guii_widget_getext(h)->x_scroll += scroll;
         SET_WIDGET_ABS_VALUES(h);                   /* Set new absolute values */
         gui_widget_invalidate(h);                   /* Invalidate widget */
         ret = 1;
@@ -2384,8 +5838,8 @@ gui_widget_incscrolly(gui_handle_p h, gui_dim_t scroll) {
     
     GUI_ASSERTPARAMS(guii_widget_iswidget(h) && guii_widget_allowchildren(h));
     
-    if (scroll) {
-        h->y_scroll += scroll;
+    if (scroll && guii_widget_hasext(h, 1)) {
+        guii_widget_getext(h)->y_scroll += scroll;
         SET_WIDGET_ABS_VALUES(h);                   /* Set new absolute values */
         gui_widget_invalidate(h);                   /* Invalidate widget */
         ret = 1;
@@ -2402,7 +5856,7 @@ gui_widget_incscrolly(gui_handle_p h, gui_dim_t scroll) {
 gui_dim_t
 gui_widget_getscrollx(gui_handle_p h) {
     GUI_ASSERTPARAMS(guii_widget_iswidget(h) && guii_widget_allowchildren(h));
-    return h->x_scroll;                             /* Get X scroll */
+    return guii_widget_getextvalue(h, x_scroll); /* Get X scroll */
 }
 
 /**
@@ -2413,7 +5867,59 @@ gui_widget_getscrollx(gui_handle_p h) {
 gui_dim_t
 gui_widget_getscrolly(gui_handle_p h) {
     GUI_ASSERTPARAMS(guii_widget_iswidget(h) && guii_widget_allowchildren(h));
-    return h->y_scroll;                             /* Get Y scroll */
+    return guii_widget_getextvalue(h, y_scroll); /* Get Y scroll */
+}
+
+/**
+ * \brief           Set automatic layout of children widgets
+ *
+ *                  Children widgets are placed in linked list order and positions set by user are overwritten.
+ *                  Hidden and expanded children widgets are skipped.
+ *                  Sizes of children widgets are not modified.
+ *
+ *                  Children are arranged on next \ref gui_process call and again only when
+ *                  child is added, removed, resized, shown or hidden or when size or padding of widget changes.
+ *                  Touch on child widget does not change its order in this case.
+ *
+ * \note            Function is available only when \ref GUI_CFG_USE_LAYOUT is enabled
+ * \param[in]       h: Widget handle with children support
+ * \param[in]       mode: Layout mode. Use \ref GUI_LAYOUT_NONE to use positions set by user again
+ * \param[in]       columns: Number of columns in \ref GUI_LAYOUT_GRID mode, ignored otherwise
+ * \param[in]       gap: Space between children widgets in units of pixels
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_setlayout(gui_handle_p h, gui_layout_mode_t mode, uint8_t columns, gui_dim_t gap) {
+#if GUI_CFG_USE_LAYOUT
+    gui_layout_t* l;
+#endif /* GUI_CFG_USE_LAYOUT */
+
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h) && guii_widget_allowchildren(h));
+    
+#if GUI_CFG_USE_LAYOUT
+    if (mode == GUI_LAYOUT_NONE && guii_widget_getextvalue(h, layout.mode) == GUI_LAYOUT_NONE) {
+        return 1;                                   /* Nothing to disable */
+    }
+    if (!guii_widget_hasext(h, 1)) {
+        return 0;
+    }
+    l = &guii_widget_getext(h)->layout;
+    l->mode = (uint8_t)mode;
+    l->columns = columns > 0 ? columns : 1;
+    l->gap = gap;
+    if (mode == GUI_LAYOUT_NONE) {
+        if (guii_widget_getflag(h, GUI_FLAG_LAYOUT_DIRTY)) {
+            guii_widget_clrflag(h, GUI_FLAG_LAYOUT_DIRTY);
+            GUI.layout_dirty_count--;
+        }
+    } else {
+        set_widget_layout_dirty(h);
+    }
+    return 1;
+#else /* GUI_CFG_USE_LAYOUT */
+    GUI_UNUSED3(mode, columns, gap);
+    return 0;
+#endif /* !GUI_CFG_USE_LAYOUT */
 }
 
 /**
@@ -2479,6 +5985,7 @@ gui_widget_setzindex(gui_handle_p h, int32_t zindex) {
         } else {
             gui_linkedlist_widgetmovetobottom(h);   /* Move widget to bottom on linked list = most important and most visible */
         }
+        SET_WIDGET_LAYOUT_DIRTY(guii_widget_getparent(h));  /* Children are arranged in linked list order */
     }
     
     return 1;
@@ -2497,6 +6004,7 @@ gui_widget_getzindex(gui_handle_p h) {
 
 /**
  * \brief           Set widget alpha level to widget
+ * \note            Cached widget (\ref gui_widget_setcache) keeps its cache and is only blended again with new alpha
  * \param[in]       h: Widget handle
  * \param[in]       alpha: Alpha level, where `0x00` means hidden and `0xFF` means totally visible widget
  * \return          `1` on success, `0` otherwise
@@ -2504,13 +6012,29 @@ gui_widget_getzindex(gui_handle_p h) {
 uint8_t
 gui_widget_setalpha(gui_handle_p h, uint8_t alpha) {
     uint8_t ret = 0;
+#if GUI_CFG_USE_ALPHA && GUI_CFG_USE_WIDGET_CACHE
+    uint32_t cache_valid;
+#endif /* GUI_CFG_USE_ALPHA && GUI_CFG_USE_WIDGET_CACHE */
     
 #if GUI_CFG_USE_ALPHA
     GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
     if (h->alpha != alpha) {                        /* Check transparency match */
         h->alpha = alpha;                           /* Set new transparency level */
         SET_WIDGET_ABS_VALUES(h);                   /* Set widget absolute values */
+        update_hidden_tree(h);                      /* Fully transparent widget is hidden */
+#if GUI_CFG_USE_OVERLAY
+        if (guii_widget_getflag(h, GUI_FLAG_OVERLAY)) {
+            set_redraw_pending();                   /* Plane alpha is changed, content stays */
+            return 1;
+        }
+#endif /* GUI_CFG_USE_OVERLAY */
+#if GUI_CFG_USE_WIDGET_CACHE
+        cache_valid = guii_widget_getflag(h, GUI_FLAG_CACHE_VALID);
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
         gui_widget_invalidate(h);                   /* Invalidate widget */
+#if GUI_CFG_USE_WIDGET_CACHE
+        guii_widget_setflag(h, cache_valid);        /* Content did not change, cache is only blended with new alpha */
+#endif /* GUI_CFG_USE_WIDGET_CACHE */
         ret = 1;
     }
 #endif /* GUI_CFG_USE_ALPHA */
@@ -2553,6 +6077,7 @@ gui_widget_setpaddingtop(gui_handle_p h, gui_dim_t x) {
 
     h->padding = (uint32_t)((h->padding & 0x00FFFFFFUL) | (uint32_t)((uint8_t)x) << 24);/* Padding top */
     SET_WIDGET_ABS_VALUES(h);
+    SET_WIDGET_LAYOUT_DIRTY(h);
     
     return 1;
 }
@@ -2569,6 +6094,7 @@ gui_widget_setpaddingright(gui_handle_p h, gui_dim_t x) {
 
     h->padding = (uint32_t)((h->padding & 0xFF00FFFFUL) | (uint32_t)((uint8_t)x) << 16);/* Padding right */
     SET_WIDGET_ABS_VALUES(h);
+    SET_WIDGET_LAYOUT_DIRTY(h);
     
     return 1;
 }
@@ -2585,6 +6111,7 @@ gui_widget_setpaddingbottom(gui_handle_p h, gui_dim_t x) {
 
     h->padding = (uint32_t)((h->padding & 0xFFFF00FFUL) | (uint32_t)((uint8_t)x) << 8); /* Padding bottom */
     SET_WIDGET_ABS_VALUES(h);
+    SET_WIDGET_LAYOUT_DIRTY(h);
     
     return 1;
 }
@@ -2601,6 +6128,7 @@ gui_widget_setpaddingleft(gui_handle_p h, gui_dim_t x) {
 
     h->padding = (uint32_t)((h->padding & 0xFFFFFF00UL) | (uint32_t)((uint8_t)x) << 0); /* Padding left */
     SET_WIDGET_ABS_VALUES(h);
+    SET_WIDGET_LAYOUT_DIRTY(h);
     
     return 1;
 }
@@ -2618,6 +6146,7 @@ gui_widget_setpaddingtopbottom(gui_handle_p h, gui_dim_t x) {
     h->padding = (uint32_t)((h->padding & 0x00FFFFFFUL) | (uint32_t)((uint8_t)x) << 24);/* Padding top */
     h->padding = (uint32_t)((h->padding & 0xFFFF00FFUL) | (uint32_t)((uint8_t)x) << 8); /* Padding bottom */
     SET_WIDGET_ABS_VALUES(h);
+    SET_WIDGET_LAYOUT_DIRTY(h);
     
     return 1;
 }
@@ -2635,6 +6164,7 @@ gui_widget_setpaddingleftright(gui_handle_p h, gui_dim_t x) {
     h->padding = (uint32_t)((h->padding & 0xFF00FFFFUL) | (uint32_t)((uint8_t)x) << 16);/* Padding right */
     h->padding = (uint32_t)((h->padding & 0xFFFFFF00UL) | (uint32_t)((uint8_t)x) << 0); /* Padding left */
     SET_WIDGET_ABS_VALUES(h);
+    SET_WIDGET_LAYOUT_DIRTY(h);
     
     return 1;
 }
@@ -2654,6 +6184,7 @@ gui_widget_setpadding(gui_handle_p h, gui_dim_t x) {
     h->padding = (uint32_t)((h->padding & 0xFFFF00FFUL) | (uint32_t)((uint8_t)x) << 8); /* Padding bottom */
     h->padding = (uint32_t)((h->padding & 0xFFFFFF00UL) | (uint32_t)((uint8_t)x) << 0); /* Padding left */
     SET_WIDGET_ABS_VALUES(h);
+    SET_WIDGET_LAYOUT_DIRTY(h);
     
     return 1;
 }
@@ -34,9 +34,54 @@
 #define GUI_INTERNAL
 #include "gui/gui_private.h"
 #include "widget/gui_widget_list.h"
+#include "system/gui_sys.h"
+
+/* Shared by list based widgets only */
+#if GUI_CFG_WIDGET_DEBUGBOX || GUI_CFG_WIDGET_DROPDOWN || GUI_CFG_WIDGET_LIST_CONTAINER || GUI_CFG_WIDGET_LISTBOX || GUI_CFG_WIDGET_LISTVIEW || __DOXYGEN__
 
 #define ENTRIES_PER_PAGE(h, ld)         (((ld)->entries_per_page_cb != NULL) ? (ld)->entries_per_page_cb(h) : 0)
 
+/**
+ * \brief           Get item by index, starting search at nearest known item
+ *
+ *                  Item accessed last is remembered, accessing the same or neighbour index
+ *                  (selection change, scroll, drawing of visible items) takes constant time
+ *
+ * \param[in]       ld: List data handle
+ * \param[in]       index: Item index
+ * \return          Item handle on success, `NULL` otherwise
+ */
+static void *
+get_item(gui_widget_listdata_t* ld, int16_t index) {
+    gui_linkedlist_t* item;
+    int16_t i;
+    
+    if (ld->is_virtual || index < 0 || index >= ld->count) {
+        return NULL;
+    }
+    
+    /* Select closest start point */
+    if (ld->cursor != NULL && GUI_ABS(index - ld->cursor_index) <= GUI_MIN(index, ld->count - 1 - index)) {
+        item = ld->cursor;
+        i = ld->cursor_index;
+    } else if (index <= ld->count - 1 - index) {
+        item = gui_linkedlist_getnext_gen(&ld->root, NULL);
+        i = 0;
+    } else {
+        item = gui_linkedlist_getprev_gen(&ld->root, NULL);
+        i = ld->count - 1;
+    }
+    for (; item != NULL && i < index; i++) {
+        item = gui_linkedlist_getnext_gen(NULL, item);
+    }
+    for (; item != NULL && i > index; i--) {
+        item = gui_linkedlist_getprev_gen(NULL, item);
+    }
+    ld->cursor = item;
+    ld->cursor_index = index;
+    return item;
+}
+
 /**
  * \brief           Set active selection
  * \param[in]       h: Widget handle
@@ -48,6 +93,7 @@ static void
 set_selection(gui_handle_p h, gui_widget_listdata_t* ld, int16_t* selected, int16_t new_selection) {
     if (*selected != new_selection && new_selection < ld->count && new_selection >= -1) {
         *selected = new_selection;
+        guii_seqlock_write(&ld->selection_seq, ld->selection, selected, sizeof(*selected));
         guii_widget_callback(h, GUI_EVT_SELECTIONCHANGED, NULL, NULL);
         gui_widget_invalidate(h);
     }
@@ -92,8 +138,9 @@ check_values(gui_handle_p h, gui_widget_listdata_t* ld) {
 uint8_t
 gui_widget_list_init(gui_handle_p h, gui_widget_listdata_t* const ld) {
     GUI_UNUSED(h);
-    GUI_UNUSED(ld);
     
+    ld->selection[0] = -1;                          /* Lists start without selection */
+    ld->selection[1] = -1;
     return 1;
 }
 
@@ -134,6 +181,9 @@ gui_widget_list_slide(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t d
  */
 uint8_t
 gui_widget_list_add_item(gui_handle_p h, gui_widget_listdata_t* const ld, void* const element) {
+    if (ld->is_virtual) {                       /* Virtual lists don't store items */
+        return 0;
+    }
     gui_linkedlist_add_gen(&ld->root, element); /* Add to linked list */
     ld->count++;                                /* Increase number of items */
     
@@ -142,6 +192,73 @@ gui_widget_list_add_item(gui_handle_p h, gui_widget_listdata_t* const ld, void*
     return 1;
 }
 
+/**
+ * \brief           Insert new item to list at position given by sort order
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ * \param[in]       element: Item to insert. Item must have \ref gui_linkedlist_t structure as first element
+ * \param[in]       cmp: Compare function of list sort order
+ * \param[in]       arg: Custom argument for compare function
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_list_insert_item_sorted(gui_handle_p h, gui_widget_listdata_t* const ld, void* element, gui_widget_list_compare_fn cmp, void* arg) {
+    gui_linkedlist_t* item;
+    
+    if (ld->is_virtual) {
+        return 0;
+    }
+    item = gui_linkedlist_getnext_gen(&ld->root, NULL);
+    while (item != NULL && cmp(element, item, arg) >= 0) {  /* Equal items keep insertion order */
+        item = gui_linkedlist_getnext_gen(NULL, item);
+    }
+    gui_linkedlist_insertbefore_gen(&ld->root, item, element);
+    ld->count++;
+    ld->cursor = NULL;                          /* Indexes of following items changed */
+    
+    check_values(h, ld);
+    return 1;
+}
+
+/**
+ * \brief           Remove item from list without releasing its memory
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ * \param[in]       element: Item on list to remove
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_list_detach_item(gui_handle_p h, gui_widget_listdata_t* const ld, void* element) {
+    if (ld->is_virtual) {
+        return 0;
+    }
+    gui_linkedlist_remove_gen(&ld->root, element);
+    ld->count--;
+    ld->cursor = NULL;
+    
+    check_values(h, ld);
+    return 1;
+}
+
+/**
+ * \brief           Sort list items without copying them
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ * \param[in]       cmp: Compare function
+ * \param[in]       arg: Custom argument for compare function
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_list_sort(gui_handle_p h, gui_widget_listdata_t* const ld, gui_widget_list_compare_fn cmp, void* arg) {
+    if (ld->is_virtual) {
+        return 0;
+    }
+    gui_linkedlist_sort_gen(&ld->root, cmp, arg);
+    ld->cursor = NULL;
+    gui_widget_invalidate(h);
+    return 1;
+}
+
 /**
  * \brief           Get item by index number
  * \param[in]       h: Widget handle
@@ -151,12 +268,10 @@ gui_widget_list_add_item(gui_handle_p h, gui_widget_listdata_t* const ld, void*
  */
 void *
 gui_widget_list_get_item_byindex(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t index) {
-    if (index == 0) {
-        return (void *)gui_linkedlist_getnext_gen(&ld->root, NULL);
-    } else if (index == ld->count - 1) {
-        return (void *)gui_linkedlist_getprev_gen(&ld->root, NULL);
+    if (ld->is_virtual) {
+        return NULL;
     }
-    return (void *)gui_linkedlist_getnext_byindex_gen(&ld->root, index);
+    return get_item(ld, index);
 }
 
 /**
@@ -170,8 +285,13 @@ uint8_t
 gui_widget_list_remove_item_byindex(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t index) {
     void* item;
     
-    item = gui_linkedlist_getnext_byindex_gen(&ld->root, index);
+    if (ld->is_virtual) {
+        return 0;
+    }
+    item = get_item(ld, index);
     if (item != NULL) {
+        ld->cursor = gui_linkedlist_getprev_gen(NULL, item);    /* Keep cursor valid on previous item */
+        ld->cursor_index = index - 1;
         item = gui_linkedlist_remove_gen(&ld->root, item);
         ld->count--;
         if (ld->remove_item_cb != NULL) {
@@ -192,6 +312,11 @@ uint8_t
 gui_widget_list_remove_items(gui_handle_p h, gui_widget_listdata_t* const ld) {
     void* item;
     
+    ld->cursor = NULL;
+    if (ld->is_virtual) {
+        ld->count = 0;
+        return 1;
+    }
     while (ld->count) {
         item = gui_linkedlist_getnext_byindex_gen(&ld->root, 0);
         if (item != NULL) {
@@ -218,6 +343,30 @@ gui_widget_list_check_values(gui_handle_p h, gui_widget_listdata_t* const ld) {
     return check_values(h, ld);
 }
 
+/**
+ * \brief           Switch list to virtual mode and set number of entries
+ *
+ *                  Virtual list does not store items in memory. Widget asks application
+ *                  for data of visible entries only, when they are drawn.
+ *
+ * \note            All stored items are removed from list when it is switched to virtual mode
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ * \param[in]       count: Number of entries in a list
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_list_set_virtual_count(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t count) {
+    if (!ld->is_virtual) {
+        gui_widget_list_remove_items(h, ld);        /* Release stored items first */
+        ld->is_virtual = 1;
+    }
+    ld->count = count > 0 ? count : 0;
+    check_values(h, ld);
+    gui_widget_invalidate(h);
+    return 1;
+}
+
 /**
  * \brief           Set new active selected item from a list
  * \param[in]       h: Widget handle
@@ -260,6 +409,43 @@ gui_widget_list_set_selection(gui_handle_p h, gui_widget_listdata_t* const ld, i
     return 1;
 }
 
+/**
+ * \brief           Update index of selected item after items were reordered
+ * \note            Selection changed event is not called as the same item stays selected
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ * \param[in,out]   curr_selected: Pointer to current selection which will be updated only
+ * \param[in]       new_index: New index of selected item or `-1` if it is no longer on list
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_list_move_selection(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t* const curr_selected, int16_t new_index) {
+    GUI_UNUSED(h);
+    
+    if (*curr_selected != new_index) {
+        *curr_selected = new_index;
+        guii_seqlock_write(&ld->selection_seq, ld->selection, curr_selected, sizeof(*curr_selected));
+    }
+    return 1;
+}
+
+/**
+ * \brief           Get selection published by \ref gui_widget_list_set_selection
+ * \note            Selection is read without core protection and function may be called from any thread
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ * \return          Selected index or `-1` if no selection
+ */
+int16_t
+gui_widget_list_get_selection(gui_handle_p h, const gui_widget_listdata_t* const ld) {
+    int16_t selected;
+    
+    GUI_UNUSED(h);
+    
+    guii_seqlock_read(&ld->selection_seq, ld->selection, &selected, sizeof(selected));
+    return selected;
+}
+
 /**
  * \brief           Set top visible start list index
  * \param[in]       h: Widget handle
@@ -288,7 +474,7 @@ gui_widget_list_set_visible_start_index(gui_handle_p h, gui_widget_listdata_t* c
  */
 void *
 gui_widget_list_get_first_visible_item(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t* const index_out) {
-    void* item = gui_linkedlist_getnext_byindex_gen(&ld->root, ld->visiblestartindex);
+    void* item = get_item(ld, ld->visiblestartindex);
     if (index_out != NULL) {
         *index_out = ld->visiblestartindex;
     }
@@ -306,3 +492,325 @@ void *
 gui_widget_list_get_next_item(gui_handle_p h, gui_widget_listdata_t* const ld, void* const curr_item) {
     return gui_linkedlist_getnext_gen(NULL, curr_item);
 }
+
+/**
+ * \brief           Invalidate range of items, only part of range currently visible is redrawn
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ * \param[in]       index: Index of first item to invalidate
+ * \param[in]       count: Number of items to invalidate. Use `-1` for all items from index to the end
+ * \param[in]       top: Y position of first visible item relative to widget
+ * \param[in]       item_height: Height of single item in units of pixels
+ * \return          `1` if visible part was invalidated, `0` otherwise
+ */
+uint8_t
+gui_widget_list_invalidate_items(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t index, int16_t count, gui_dim_t top, gui_dim_t item_height) {
+    int32_t first, last;
+    
+    if (item_height <= 0) {
+        gui_widget_invalidate(h);
+        return 1;
+    }
+    first = GUI_MAX(index, ld->visiblestartindex);
+    last = ld->visiblestartindex + (gui_widget_getheight(h) - top) / item_height;   /* Last row may be visible partially */
+    if (count >= 0) {
+        last = GUI_MIN(last, (int32_t)index + count - 1);
+    }
+    if (first > last) {
+        return 0;                                   /* Range is not visible */
+    }
+    return gui_widget_invalidatearea(h, 0, top + (gui_dim_t)(first - ld->visiblestartindex) * item_height,
+        gui_widget_getwidth(h), (gui_dim_t)(last - first + 1) * item_height);
+}
+
+#if GUI_CFG_USE_LISTMODEL || __DOXYGEN__
+
+/**
+ * \brief           Attach list to shared item model or detach it
+ *
+ *                  List is switched to virtual mode, number of items is taken from model.
+ *                  All stored items are removed from list.
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ * \param[in,out]   curr_selected: Pointer to current selection, it is cleared
+ * \param[in]       model: Model handle. Set to `NULL` to detach list and use stored items again
+ * \param[in]       notify_fn: Change notification callback of widget
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_list_set_model(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t* const curr_selected, gui_listmodel_p model, gui_listmodel_notify_fn notify_fn) {
+    if (model == ld->view.model) {
+        return 1;                                   /* Already attached or never attached */
+    }
+    if (ld->view.model != NULL) {
+        guii_listmodel_detach(&ld->view);
+    }
+    set_selection(h, ld, curr_selected, -1);
+    if (model != NULL) {
+        guii_listmodel_attach(model, &ld->view, h, notify_fn);
+        return gui_widget_list_set_virtual_count(h, ld, gui_listmodel_getcount(model));
+    }
+    gui_widget_list_remove_items(h, ld);
+    ld->is_virtual = 0;                             /* Store own items again */
+    check_values(h, ld);
+    gui_widget_invalidate(h);
+    return 1;
+}
+
+/**
+ * \brief           Update list after change of attached model
+ *
+ *                  Number of items is read from model and selection follows selected item.
+ *                  Widget is not invalidated, caller redraws affected items only.
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ * \param[in,out]   curr_selected: Pointer to current selection
+ * \param[in]       change: Type of change
+ * \param[in]       index: Index of first changed item
+ * \param[in]       count: Number of changed items
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_widget_list_model_changed(gui_handle_p h, gui_widget_listdata_t* const ld, int16_t* const curr_selected, gui_listmodel_change_t change, int16_t index, int16_t count) {
+    ld->count = ld->view.model != NULL ? gui_listmodel_getcount(ld->view.model) : 0;
+    if (*curr_selected >= 0) {
+        if (change == GUI_LISTMODEL_CHANGE_INSERT && *curr_selected >= index) {
+            gui_widget_list_move_selection(h, ld, curr_selected, *curr_selected + count);
+        } else if (change == GUI_LISTMODEL_CHANGE_REMOVE && *curr_selected >= index + count) {
+            gui_widget_list_move_selection(h, ld, curr_selected, *curr_selected - count);
+        } else if ((change == GUI_LISTMODEL_CHANGE_REMOVE && *curr_selected >= index)
+            || *curr_selected >= ld->count) {       /* Selected item is no longer on list */
+            set_selection(h, ld, curr_selected, -1);
+        }
+    }
+    check_values(h, ld);
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_LISTMODEL || __DOXYGEN__ */
+
+#if GUI_CFG_USE_TOUCH || __DOXYGEN__
+
+#define KINETIC_REST_TIME               100 /*!< Time after last touch movement when release does not start kinetic scroll */
+
+static gui_timer_t* kinetic_timer;              /*!< Single timer for kinetic scroll animation */
+static gui_handle_p kinetic_widget;             /*!< Widget currently scrolled by kinetic animation */
+static gui_widget_kinetic_t* kinetic_data;      /*!< Kinetic data of currently scrolled widget */
+
+/**
+ * \brief           Apply accumulated offset as scroll steps
+ * \param[in]       h: Widget handle
+ * \param[in]       k: Kinetic data handle
+ * \param[out]      applied: Set to `1` if at least one step was applied to widget
+ * \return          `1` if widget scrolled or nothing was applied, `0` if scroll limit is reached
+ */
+static uint8_t
+kinetic_apply(gui_handle_p h, gui_widget_kinetic_t* const k, uint8_t* applied) {
+    int16_t dx = 0, dy = 0;
+    
+    if (k->step_x > 0) {
+        dx = GUI_I16(k->offset_x / ((int32_t)k->step_x * 256));
+        k->offset_x -= (int32_t)dx * k->step_x * 256;
+    }
+    if (k->step_y > 0) {
+        dy = GUI_I16(k->offset_y / ((int32_t)k->step_y * 256));
+        k->offset_y -= (int32_t)dy * k->step_y * 256;
+    }
+    *applied = dx || dy;
+    if (!*applied || k->scroll_fn == NULL) {
+        return 1;
+    }
+    return k->scroll_fn(h, k->arg, dx, dy);
+}
+
+#if GUI_CFG_USE_KINETIC_SCROLL || __DOXYGEN__
+
+/**
+ * \brief           Kinetic scroll animation timer callback
+ * \param[in]       t: Timer handle
+ */
+static void
+kinetic_timer_callback(gui_timer_t* t) {
+    gui_widget_kinetic_t* k = kinetic_data;
+    uint8_t applied;
+    
+    if (k == NULL) {
+        guii_timer_stop(t);
+        return;
+    }
+    
+    /* Move with current velocity and decelerate */
+    k->offset_x += k->speed_x * (GUI_CFG_KINETIC_PERIOD * 256) / 1000;
+    k->offset_y += k->speed_y * (GUI_CFG_KINETIC_PERIOD * 256) / 1000;
+    k->speed_x -= k->speed_x * GUI_CFG_KINETIC_DECAY / 256;
+    k->speed_y -= k->speed_y * GUI_CFG_KINETIC_DECAY / 256;
+    
+    if ((!kinetic_apply(kinetic_widget, k, &applied) && applied)
+        || (GUI_ABS(k->speed_x) < GUI_CFG_KINETIC_MIN_SPEED && GUI_ABS(k->speed_y) < GUI_CFG_KINETIC_MIN_SPEED)) {
+        gui_widget_kinetic_stop(kinetic_widget, k); /* Limit reached or widget stopped */
+    }
+}
+
+#endif /* GUI_CFG_USE_KINETIC_SCROLL || __DOXYGEN__ */
+
+/**
+ * \brief           Start touch scrolling, stops kinetic animation of widget if active
+ * \param[in]       h: Widget handle
+ * \param[in]       k: Kinetic data handle with scroll callback set
+ * \param[in]       step_x: Number of pixels per horizontal scroll step. Set to `0` to disable horizontal scroll
+ * \param[in]       step_y: Number of pixels per vertical scroll step. Set to `0` to disable vertical scroll
+ */
+void
+gui_widget_kinetic_touchstart(gui_handle_p h, gui_widget_kinetic_t* const k, gui_dim_t step_x, gui_dim_t step_y) {
+    gui_widget_kinetic_stop(h, k);
+    k->step_x = step_x;
+    k->step_y = step_y;
+    k->offset_x = 0;
+    k->offset_y = 0;
+    k->time = gui_sys_now();
+}
+
+/**
+ * \brief           Scroll widget with touch movement and track its velocity
+ * \param[in]       h: Widget handle
+ * \param[in]       k: Kinetic data handle
+ * \param[in]       ts: Touch data of move event
+ * \return          `1` if widget scrolled, `0` otherwise
+ */
+uint8_t
+gui_widget_kinetic_touchmove(gui_handle_p h, gui_widget_kinetic_t* const k, const guii_touch_data_t* const ts) {
+    uint8_t applied, ret;
+    
+    /* Content follows finger, average velocity with previous sample */
+    if (k->step_x > 0) {
+        k->offset_x -= (int32_t)ts->x_diff[0] * 256;
+        k->speed_x = (k->speed_x - ts->x_speed[0]) / 2;
+    }
+    if (k->step_y > 0) {
+        k->offset_y -= (int32_t)ts->y_diff[0] * 256;
+        k->speed_y = (k->speed_y - ts->y_speed[0]) / 2;
+    }
+    k->time = ts->ts.time;
+    
+    ret = kinetic_apply(h, k, &applied);
+    return ret && applied;
+}
+
+/**
+ * \brief           Finish touch scrolling and start kinetic animation with velocity of last movement
+ * \note            Animation does not start if \ref GUI_CFG_USE_KINETIC_SCROLL is disabled,
+ *                  velocity is too low or touch has been resting before release
+ * \param[in]       h: Widget handle
+ * \param[in]       k: Kinetic data handle
+ */
+void
+gui_widget_kinetic_touchend(gui_handle_p h, gui_widget_kinetic_t* const k) {
+#if GUI_CFG_USE_KINETIC_SCROLL
+#if GUI_CFG_USE_GESTURE
+    int32_t sx, sy;
+    
+    if (guii_gesture_getspeed(&sx, &sy)) {          /* Use velocity of gesture recognizer */
+        k->speed_x = k->step_x > 0 ? -sx : 0;
+        k->speed_y = k->step_y > 0 ? -sy : 0;
+    }
+#endif /* GUI_CFG_USE_GESTURE */
+    if ((gui_sys_now() - k->time) > KINETIC_REST_TIME
+        || (GUI_ABS(k->speed_x) < GUI_CFG_KINETIC_MIN_SPEED && GUI_ABS(k->speed_y) < GUI_CFG_KINETIC_MIN_SPEED)) {
+        k->speed_x = 0;
+        k->speed_y = 0;
+        return;
+    }
+    if (kinetic_data != NULL) {                     /* Only one widget scrolls at a time */
+        gui_widget_kinetic_stop(kinetic_widget, kinetic_data);
+    }
+    if (kinetic_timer == NULL) {
+        kinetic_timer = guii_timer_create(GUI_CFG_KINETIC_PERIOD, kinetic_timer_callback, NULL);
+    }
+    if (kinetic_timer != NULL) {
+        kinetic_widget = h;
+        kinetic_data = k;
+        guii_timer_startperiodic(kinetic_timer);
+    }
+#else /* GUI_CFG_USE_KINETIC_SCROLL */
+    GUI_UNUSED(h);
+    k->speed_x = 0;
+    k->speed_y = 0;
+#endif /* !GUI_CFG_USE_KINETIC_SCROLL */
+}
+
+/**
+ * \brief           Stop kinetic animation of widget
+ * \note            Must be called when widget with active animation is removed
+ * \param[in]       h: Widget handle
+ * \param[in]       k: Kinetic data handle
+ */
+void
+gui_widget_kinetic_stop(gui_handle_p h, gui_widget_kinetic_t* const k) {
+    GUI_UNUSED(h);
+    if (kinetic_data == k) {
+        kinetic_data = NULL;
+        kinetic_widget = NULL;
+        guii_timer_stop(kinetic_timer);
+    }
+    k->speed_x = 0;
+    k->speed_y = 0;
+}
+
+/**
+ * \brief           Scroll list by number of items, used as kinetic scroll callback
+ * \param[in]       h: Widget handle
+ * \param[in]       arg: List data handle
+ * \param[in]       dx: Number of steps in horizontal direction, not used
+ * \param[in]       dy: Number of items to scroll
+ * \return          `1` if list scrolled, `0` otherwise
+ */
+static uint8_t
+list_kinetic_scroll(gui_handle_p h, void* arg, int16_t dx, int16_t dy) {
+    gui_widget_listdata_t* ld = arg;
+    int16_t start = ld->visiblestartindex;
+    
+    GUI_UNUSED(dx);
+    gui_widget_list_slide(h, ld, dy);
+    return ld->visiblestartindex != start;
+}
+
+/**
+ * \brief           Start touch scrolling of list
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ * \param[in]       item_height: Height of single item in units of pixels
+ */
+void
+gui_widget_list_touchstart(gui_handle_p h, gui_widget_listdata_t* const ld, gui_dim_t item_height) {
+    ld->kinetic.scroll_fn = list_kinetic_scroll;
+    ld->kinetic.arg = ld;
+    gui_widget_kinetic_touchstart(h, &ld->kinetic, 0, item_height);
+}
+
+/**
+ * \brief           Scroll list with touch movement
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ * \param[in]       ts: Touch data of move event
+ * \return          `1` if list scrolled, `0` otherwise
+ */
+uint8_t
+gui_widget_list_touchmove(gui_handle_p h, gui_widget_listdata_t* const ld, const guii_touch_data_t* const ts) {
+    return gui_widget_kinetic_touchmove(h, &ld->kinetic, ts);
+}
+
+/**
+ * \brief           Finish touch scrolling of list and start kinetic animation
+ * \param[in]       h: Widget handle
+ * \param[in]       ld: List data handle
+ */
+void
+gui_widget_list_touchend(gui_handle_p h, gui_widget_listdata_t* const ld) {
+    gui_widget_kinetic_touchend(h, &ld->kinetic);
+}
+
+#endif /* GUI_CFG_USE_TOUCH || __DOXYGEN__ */
+
+#endif /* GUI_CFG_WIDGET_DEBUGBOX || GUI_CFG_WIDGET_DROPDOWN || GUI_CFG_WIDGET_LIST_CONTAINER || GUI_CFG_WIDGET_LISTBOX || GUI_CFG_WIDGET_LISTVIEW || __DOXYGEN__ */
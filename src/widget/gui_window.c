@@ -41,8 +41,17 @@
  */
 typedef struct {
     gui_handle C;                                   /*!< GUI handle object, must always be first on list */
+    
+    const gui_image_desc_t* wallpaper;              /*!< Image drawn centered on background */
+#if GUI_CFG_USE_WALLPAPER_CACHE
+    gui_layer_t* wallpaper_layer;                   /*!< Background color and image rendered once */
+    gui_color_t wallpaper_color;                    /*!< Background color used for rendered layer */
+    uint8_t wallpaper_valid;                        /*!< Set to `1` when rendered layer is up to date */
+#endif /* GUI_CFG_USE_WALLPAPER_CACHE */
 } gui_window_t;
 
+#define CFG_WALLPAPER       0x01
+
 static uint8_t gui_window_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result);
 
 /**
@@ -63,12 +72,124 @@ static const
 gui_widget_t widget = {
     .name = _GT("WINDOW"),                          /*!< Widget name */
     .size = sizeof(gui_window_t),                   /*!< Size of widget for memory allocation */
-    .flags = GUI_FLAG_WIDGET_ALLOW_CHILDREN,        /*!< List of widget flags */
+    .flags = GUI_FLAG_WIDGET_ALLOW_CHILDREN | GUI_FLAG_WIDGET_OPAQUE,   /*!< List of widget flags */
     .callback = gui_window_callback,                /*!< Control function */
     .colors = colors,                               /*!< Pointer to colors array */
     .color_count = GUI_COUNT_OF(colors),            /*!< Number of colors */
 };
 
+#if GUI_CFG_USE_WALLPAPER_CACHE
+
+/**
+ * \brief           Free pre-rendered background of window
+ * \param[in]       h: Widget handle
+ */
+static void
+free_wallpaper(gui_handle_p h) {
+    gui_window_t* o = GUI_VP(h);
+    
+    if (o->wallpaper_layer != NULL) {
+        GUI_MEMFREE(o->wallpaper_layer);
+        o->wallpaper_layer = NULL;
+    }
+    o->wallpaper_valid = 0;
+}
+
+/**
+ * \brief           Get pre-rendered background of window, render it if necessary
+ * \param[in]       h: Widget handle
+ * \param[in]       x: Absolute X position of window
+ * \param[in]       y: Absolute Y position of window
+ * \param[in]       wi: Window width
+ * \param[in]       hi: Window height
+ * \param[in]       color: Background color
+ * \return          Layer with rendered background on success, `NULL` otherwise
+ */
+static gui_layer_t *
+get_wallpaper(gui_handle_p h, gui_dim_t x, gui_dim_t y, gui_dim_t wi, gui_dim_t hi, gui_color_t color) {
+    gui_window_t* o = GUI_VP(h);
+    gui_layer_t* layer = o->wallpaper_layer, *prev;
+    gui_display_t disp;
+    
+    if (layer != NULL && (layer->width != wi || layer->height != hi)) {
+        free_wallpaper(h);                          /* Window size changed, allocate new buffer */
+        layer = NULL;
+    }
+    if (layer == NULL) {
+        if (wi <= 0 || hi <= 0) {
+            return NULL;
+        }
+        layer = GUI_MEMALLOC_CLASS(sizeof(*layer) + (size_t)wi * (size_t)hi * (size_t)GUI.lcd.pixel_size + GUI_LCD_TILES_SIZE(wi, hi), GUI_MEM_CLASS_PIXEL);
+        if (layer == NULL) {
+            return NULL;
+        }
+        memset(layer, 0x00, sizeof(*layer));
+        layer->width = wi;
+        layer->height = hi;
+        layer->start_address = ((uint8_t *)layer) + sizeof(*layer);
+        layer->pixel_format = GUI.lcd.layers[0].pixel_format;
+        GUI_LCD_TILES_INIT(layer);
+        o->wallpaper_layer = layer;
+        o->wallpaper_valid = 0;
+    }
+    
+    /* Layer content does not depend on window position, only on color and image */
+    layer->x_pos = x;
+    layer->y_pos = y;
+    if (!o->wallpaper_valid || o->wallpaper_color != color) {
+        disp.x1 = x;
+        disp.y1 = y;
+        disp.x2 = x + wi;
+        disp.y2 = y + hi;
+        prev = GUI.lcd.drawing_layer;
+        GUI.lcd.drawing_layer = layer;
+        gui_draw_filledrectangle(&disp, x, y, wi, hi, color);
+        gui_draw_image(&disp, x + (wi - o->wallpaper->x_size) / 2, y + (hi - o->wallpaper->y_size) / 2, o->wallpaper);
+        GUI.lcd.drawing_layer = prev;
+        GUI_LCD_TILES_UPDATE(layer);
+        o->wallpaper_color = color;
+        o->wallpaper_valid = 1;
+    }
+    return layer;
+}
+
+#endif /* GUI_CFG_USE_WALLPAPER_CACHE */
+
+/**
+ * \brief           Draw window background with optional wallpaper
+ * \param[in]       h: Widget handle
+ * \param[in]       disp: Display clipping region
+ * \param[in]       x: Absolute X position of window
+ * \param[in]       y: Absolute Y position of window
+ * \param[in]       wi: Window width
+ * \param[in]       hi: Window height
+ */
+static void
+draw_background(gui_handle_p h, const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t wi, gui_dim_t hi) {
+    gui_window_t* o = GUI_VP(h);
+    gui_color_t color = guii_widget_getcolor(h, GUI_WINDOW_COLOR_BG);
+#if GUI_CFG_USE_WALLPAPER_CACHE
+    gui_layer_t* layer, *drawing = GUI.lcd.drawing_layer;
+    gui_dim_t x1, y1, x2, y2;
+    
+    if (o->wallpaper != NULL && (layer = get_wallpaper(h, x, y, wi, hi, color)) != NULL) {
+        x1 = GUI_MAX(disp->x1, x);
+        y1 = GUI_MAX(disp->y1, y);
+        x2 = GUI_MIN(disp->x2, x + wi);
+        y2 = GUI_MIN(disp->y2, y + hi);
+#if GUI_CFG_USE_DISPLAY_LIST
+        guii_draw_list_cancel();                    /* Copy is not recorded to display list */
+#endif /* GUI_CFG_USE_DISPLAY_LIST */
+        guii_lcd_copylayer(drawing, layer, x1, y1, x2, y2);
+        return;
+    }
+#endif /* GUI_CFG_USE_WALLPAPER_CACHE */
+    gui_draw_filledrectangle(disp, x, y, wi, hi, color);
+    if (o->wallpaper != NULL) {
+        gui_draw_image((gui_display_t *)disp, x + (wi - o->wallpaper->x_size) / 2, y + (hi - o->wallpaper->y_size) / 2, o->wallpaper);
+    }
+}
+
 /**
  * \brief           Default widget callback function
  * \param[in]       h: Widget handle
@@ -83,12 +204,39 @@ gui_window_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
     static gui_dim_t ts_mode = 0;
 #endif /* GUI_CFG_USE_TOUCH */
     
+    gui_window_t* o = GUI_VP(h);
+    
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
     switch (evt) {
         case GUI_EVT_PRE_INIT: {                      /* Called immediatelly after widget is created */
             gui_window_setactive(h);                /* Set active window */
             return 1;
         }
+        case GUI_EVT_SETPARAM: {
+            gui_widget_param* v = GUI_EVT_PARAMTYPE_WIDGETPARAM(param);
+            switch (v->type) {
+                case CFG_WALLPAPER:
+                    o->wallpaper = *(const gui_image_desc_t **)v->data;
+#if GUI_CFG_USE_WALLPAPER_CACHE
+                    free_wallpaper(h);              /* Render new image on next draw */
+#endif /* GUI_CFG_USE_WALLPAPER_CACHE */
+                    break;
+                default: break;
+            }
+            GUI_EVT_RESULTTYPE_U8(result) = 1;      /* Save result */
+            return 1;
+        }
+#if GUI_CFG_USE_WALLPAPER_CACHE
+        case GUI_EVT_REMOVE: {
+            free_wallpaper(h);
+            return 1;
+        }
+        case GUI_EVT_CLONE: {                       /* Widget copied from prototype */
+            o->wallpaper_layer = NULL;              /* Background layer belongs to prototype */
+            o->wallpaper_valid = 0;
+            return 1;
+        }
+#endif /* GUI_CFG_USE_WALLPAPER_CACHE */
         case GUI_EVT_DRAW: {
             uint8_t inFocus;
             gui_display_t* disp = GUI_EVT_PARAMTYPE_DISP(param);
@@ -101,7 +249,7 @@ gui_window_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
             wi = gui_widget_getwidth(h);   
             hi = gui_widget_getheight(h);   
             
-            gui_draw_filledrectangle(disp, x, y, wi, hi, guii_widget_getcolor(h, GUI_WINDOW_COLOR_BG));
+            draw_background(h, disp, x, y, wi, hi);
             if (guii_widget_getflag(h, GUI_FLAG_CHILD)) {
                 gui_dim_t tx, ty, tW;
                 
@@ -168,6 +316,7 @@ gui_window_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
                     f.align = GUI_HALIGN_CENTER | GUI_VALIGN_CENTER;
                     f.color1width = f.width;
                     f.color1 = guii_widget_getcolor(h, GUI_WINDOW_COLOR_TEXT);
+                    f.layout = guii_widget_gettextlayout(h); /* Reuse layout of widget text */
                     gui_draw_writetext(disp, gui_widget_getfont(h), gui_widget_gettext(h), &f);
                 }
             }
@@ -326,6 +475,19 @@ uint8_t
 gui_window_setcolor(gui_handle_p h, gui_window_color_t index, gui_color_t color) {
     return gui_widget_setcolor(h, (uint8_t)index, color);
 }
+
+/**
+ * \brief           Set wallpaper image, drawn centered over background color
+ * \note            With \ref GUI_CFG_USE_WALLPAPER_CACHE enabled, background is rendered once and copied on redraw
+ * \param[in]       h: Widget handle
+ * \param[in]       img: Pointer to image descriptor or `NULL` to draw background color only
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_window_setwallpaper(gui_handle_p h, const gui_image_desc_t* img) {
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+    return guii_widget_setparam(h, CFG_WALLPAPER, &img, 1, 0);
+}
  
 /**
  * \brief           Set active window for future widgets and for current top window
@@ -341,6 +503,7 @@ gui_window_setactive(gui_handle_p h) {
     
     guii_widget_focus_clear();                      /* Clear focus on widget */
     guii_widget_active_clear();                     /* Clear active on widget */
+    PT_INIT(&GUI.touch.pt);                         /* Click or long press must not reach previous window */
 
     return 1;
 }
@@ -0,0 +1,582 @@
+/**	
+ * \file            font_subset.c
+ * \brief           Host tool to generate font with only used characters
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+
+/*
+ * Tool is compiled on host together with source font and translation tables
+ * and writes C source of new sparse font with only characters used by application.
+ *
+ * Used characters are collected from all entries of translation tables
+ * and from string literals inside `_GT()` macros of source files passed on command line.
+ * Character `?` is always included as it replaces missing characters on drawing.
+ *
+ * Source font and tables are listed in `font_subset_cfg.h` file on include path:
+ *
+ *  #define FONT_SUBSET_FONT            GUI_Font_Arial_Narrow_Italic_21
+ *  #define FONT_SUBSET_LANGS(X)        X(lang_english) X(lang_german)
+ *
+ * Build and run, `gui_config.h` of application must be on include path:
+ *
+ *  gcc -Isrc/include -I<cfg> tools/font_subset/font_subset.c src/fonts/Arial_Narrow_Italic.c translations.c -o font_subset
+ *  ./font_subset [-a4] [-rle] [-n name] [-c chars] [files...] > font_subset_out.c
+ *
+ *  -a4:    Write characters in 4-bit alpha format, `A8` is used otherwise
+ *  -rle:   Compress characters with run-length encoding, see \ref GUI_FLAG_FONT_RLE
+ *  -n:     Name of generated font structure, `<font>_Subset` by default
+ *  -c:     Additional characters, UTF-8 encoded, such as digits of numbers formatted at runtime
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "gui/gui.h"
+#include "font_subset_cfg.h"
+
+#define STR_(x)                     #x
+#define STR(x)                      STR_(x)
+
+#define CH_MAX                      0x110000UL
+
+extern gui_const gui_font_t FONT_SUBSET_FONT;
+#ifdef FONT_SUBSET_LANGS
+#define LANG_EXTERN(l)              extern gui_const gui_translate_language_t l;
+#define LANG_ENTRY(l)               &l,
+FONT_SUBSET_LANGS(LANG_EXTERN)
+static const gui_translate_language_t* langs[] = { FONT_SUBSET_LANGS(LANG_ENTRY) NULL };
+#else /* FONT_SUBSET_LANGS */
+static const gui_translate_language_t* langs[] = { NULL };
+#endif /* !FONT_SUBSET_LANGS */
+
+static uint8_t used[CH_MAX / 8];            /* Bit per character code */
+static uint32_t missing;                    /* Number of used characters not in source font */
+
+#define CH_ISUSED(ch)               (used[(ch) >> 3] & (1 << ((ch) & 0x07)))
+
+/**
+ * \brief           Find character in source font, without replacement
+ * \param[in]       font: Source font
+ * \param[in]       ch: Character code
+ * \return          Char info on success, `NULL` otherwise
+ */
+static const gui_font_char_t *
+font_find(const gui_font_t* font, uint32_t ch) {
+    uint16_t i;
+
+    if (font->ranges != NULL) {
+        for (i = 0; i < font->range_count; i++) {
+            if (ch >= font->ranges[i].start && ch < font->ranges[i].start + font->ranges[i].count) {
+                return &font->data[font->ranges[i].index + (ch - font->ranges[i].start)];
+            }
+        }
+        return NULL;
+    }
+    if (ch >= font->startchar && ch <= font->endchar) {
+        return &font->data[ch - font->startchar];
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Get number of bytes of character data in source font format
+ * \param[in]       font: Source font
+ * \param[in]       c: Source character
+ * \return          Number of data bytes
+ */
+static size_t
+char_datasize(const gui_font_t* font, const gui_font_char_t* c) {
+    size_t columns;
+
+    if (font->flags & GUI_FLAG_FONT_A8) {
+        columns = c->x_size;
+    } else if (font->flags & GUI_FLAG_FONT_A4) {
+        columns = ((size_t)c->x_size + 1) >> 1;
+    } else if (font->flags & GUI_FLAG_FONT_AA) {
+        columns = ((size_t)c->x_size + 3) >> 2;
+    } else {
+        columns = ((size_t)c->x_size + 7) >> 3;
+    }
+    return columns * c->y_size;
+}
+
+/**
+ * \brief           Mark character as used
+ * \param[in]       ch: Character code
+ */
+static void
+mark_char(uint32_t ch) {
+    if (ch == '\r' || ch == '\n') {                 /* Drawn as white space */
+        ch = ' ';
+    }
+    if (ch >= CH_MAX || CH_ISUSED(ch)) {
+        return;
+    }
+    used[ch >> 3] |= 1 << (ch & 0x07);
+    if (font_find(&FONT_SUBSET_FONT, ch) == NULL) {
+        fprintf(stderr, "font_subset: character U+%04lX is not in source font\n", (unsigned long)ch);
+        missing++;
+    }
+}
+
+/**
+ * \brief           Mark all characters of UTF-8 encoded string
+ *
+ *                  Invalid sequences are marked byte by byte, same as non-unicode strings
+ *
+ * \param[in]       str: String to mark
+ * \param[in]       len: String length in units of bytes
+ */
+static void
+mark_string(const uint8_t* str, size_t len) {
+    size_t i = 0, n, k;
+    uint32_t ch;
+
+    while (i < len) {
+        ch = str[i];
+        n = ch < 0x80 ? 0 : (ch & 0xE0) == 0xC0 ? 1 : (ch & 0xF0) == 0xE0 ? 2 : (ch & 0xF8) == 0xF0 ? 3 : 4;
+        if (n > 0 && n < 4 && i + n < len) {
+            ch &= 0x3F >> n;
+            for (k = 1; k <= n && (str[i + k] & 0xC0) == 0x80; k++) {
+                ch = (ch << 6) | (str[i + k] & 0x3F);
+            }
+            if (k > n) {
+                mark_char(ch);
+                i += n + 1;
+                continue;
+            }
+            ch = str[i];
+        }
+        mark_char(ch);
+        i++;
+    }
+}
+
+/**
+ * \brief           Parse C string literal, escape sequences are decoded
+ * \param[in]       p: Pointer to opening quote
+ * \param[out]      out: Output buffer, at least as long as input
+ * \param[out]      len: Length of decoded string is added to this variable
+ * \return          Pointer after closing quote
+ */
+static const char *
+parse_literal(const char* p, uint8_t* out, size_t* len) {
+    uint32_t v;
+    int k;
+
+    for (p++; *p != '\0' && *p != '"'; p++) {
+        if (*p != '\\') {
+            out[(*len)++] = (uint8_t)*p;
+            continue;
+        }
+        switch (*++p) {
+            case 'n':   out[(*len)++] = '\n'; break;
+            case 'r':   out[(*len)++] = '\r'; break;
+            case 't':   out[(*len)++] = '\t'; break;
+            case 'x':
+                for (v = 0; (p[1] >= '0' && p[1] <= '9') || ((p[1] | 0x20) >= 'a' && (p[1] | 0x20) <= 'f'); p++) {
+                    v = (v << 4) | (uint32_t)(p[1] <= '9' ? p[1] - '0' : (p[1] | 0x20) - 'a' + 10);
+                }
+                out[(*len)++] = (uint8_t)v;
+                break;
+            case '\0':
+                return p;
+            default:
+                if (*p >= '0' && *p <= '7') {       /* Octal value of up to 3 digits */
+                    for (v = 0, k = 0; k < 3 && *p >= '0' && *p <= '7'; k++, p++) {
+                        v = (v << 3) | (uint32_t)(*p - '0');
+                    }
+                    p--;
+                    out[(*len)++] = (uint8_t)v;
+                } else {
+                    out[(*len)++] = (uint8_t)*p;
+                }
+        }
+    }
+    return *p == '"' ? p + 1 : p;
+}
+
+/**
+ * \brief           Mark characters of all `_GT()` string literals in source file
+ * \param[in]       path: File path
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+scan_file(const char* path) {
+    FILE* f;
+    char* text, *p;
+    uint8_t* str;
+    long size;
+    size_t len;
+
+    if ((f = fopen(path, "rb")) == NULL) {
+        fprintf(stderr, "font_subset: cannot open %s\n", path);
+        return 0;
+    }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    text = malloc((size_t)size + 1);
+    str = malloc((size_t)size + 1);
+    if (text == NULL || str == NULL || fread(text, 1, (size_t)size, f) != (size_t)size) {
+        fclose(f);
+        free(text);
+        free(str);
+        return 0;
+    }
+    fclose(f);
+    text[size] = '\0';
+
+    for (p = text; (p = strstr(p, "_GT(")) != NULL; ) {
+        p += 4;
+        len = 0;
+        for (;;) {                                  /* Adjacent literals are concatenated */
+            while (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n') {
+                p++;
+            }
+            if (*p != '"') {
+                break;
+            }
+            p = (char *)parse_literal(p, str, &len);
+        }
+        mark_string(str, len);
+    }
+    free(text);
+    free(str);
+    return 1;
+}
+
+/**
+ * \brief           Get character pixels in 8-bit alpha format
+ * \param[in]       font: Source font
+ * \param[in]       c: Source character
+ * \param[out]      out: Output buffer of `x_size * y_size` bytes
+ */
+static void
+char_to_a8(const gui_font_t* font, const gui_font_char_t* c, uint8_t* out) {
+    size_t x, y, columns;
+    uint8_t b;
+
+    for (y = 0; y < c->y_size; y++) {
+        for (x = 0; x < c->x_size; x++) {
+            if (font->flags & GUI_FLAG_FONT_A8) {
+                b = c->data[y * c->x_size + x];
+            } else if (font->flags & GUI_FLAG_FONT_A4) {
+                columns = ((size_t)c->x_size + 1) >> 1;
+                b = c->data[y * columns + (x >> 1)];
+                b = (uint8_t)(((x & 0x01) ? (b & 0x0F) : (b >> 4)) * 0x11);
+            } else if (font->flags & GUI_FLAG_FONT_AA) {
+                columns = ((size_t)c->x_size + 3) >> 2;
+                b = c->data[y * columns + (x >> 2)];
+                b = (uint8_t)(((b >> (6 - 2 * (x & 0x03))) & 0x03) * 0x55);
+            } else {
+                columns = ((size_t)c->x_size + 7) >> 3;
+                b = c->data[y * columns + (x >> 3)];
+                b = ((b >> (7 - (x & 0x07))) & 0x01) ? 0xFF : 0x00;
+            }
+            *out++ = b;
+        }
+    }
+}
+
+/**
+ * \brief           Compress character pixels in \ref GUI_FLAG_FONT_RLE format
+ * \param[in]       a8: Character pixels in 8-bit alpha format
+ * \param[in]       count: Number of pixels
+ * \param[in]       a4: Set to `1` to write literal pixels in 4-bit alpha format
+ * \param[out]      out: Output buffer, `count + count / 128 + 1` bytes is enough
+ * \return          Number of compressed bytes
+ */
+static size_t
+rle_encode(const uint8_t* a8, size_t count, uint8_t a4, uint8_t* out) {
+    static uint8_t q[0x100 * 0x100];
+    size_t i = 0, k, run, len = 0;
+    uint8_t full = a4 ? 0x0F : 0xFF;
+
+    for (k = 0; k < count; k++) {                   /* Quantize to output format first */
+        q[k] = a4 ? (uint8_t)((a8[k] * 15 + 127) / 255) : a8[k];
+    }
+    while (i < count) {
+        if (q[i] == 0x00 || q[i] == full) {         /* Run of transparent or solid pixels */
+            for (run = 1; run < 64 && i + run < count && q[i + run] == q[i]; run++) {}
+            out[len++] = (uint8_t)((q[i] ? 0x40 : 0x00) | (run - 1));
+        } else {                                    /* Literal pixels until next transparent or solid one */
+            for (run = 1; run < 128 && i + run < count && q[i + run] != 0x00 && q[i + run] != full; run++) {}
+            out[len++] = (uint8_t)(0x80 | (run - 1));
+            for (k = 0; k < run; k++) {
+                if (!a4) {
+                    out[len++] = q[i + k];
+                } else if (k & 0x01) {
+                    out[len - 1] |= q[i + k];
+                } else {
+                    out[len++] = (uint8_t)(q[i + k] << 4);
+                }
+            }
+        }
+        i += run;
+    }
+    return len;
+}
+
+/**
+ * \brief           Write character pixels to atlas array in output format
+ * \param[in]       c: Source character
+ * \param[in]       a8: Character pixels in 8-bit alpha format
+ * \param[in]       a4: Set to `1` to write 4-bit alpha format
+ * \param[in]       rle: Set to `1` to write run-length compressed data
+ * \return          Number of written bytes
+ */
+static size_t
+write_char(const gui_font_char_t* c, const uint8_t* a8, uint8_t a4, uint8_t rle) {
+    static uint8_t codes[0x100 * 0x100 + 0x200 + 2];
+    size_t x, y, columns = a4 ? ((size_t)c->x_size + 1) >> 1 : c->x_size;
+    uint8_t b;
+
+    if (rle) {
+        size_t len = rle_encode(a8, (size_t)c->x_size * c->y_size, a4, &codes[2]);
+
+        codes[0] = (uint8_t)len;                    /* Little-endian length header */
+        codes[1] = (uint8_t)(len >> 8);
+        for (x = 0; x < len + 2; x++) {
+            printf("%s 0x%02X,%s", (x % 16) ? "" : "   ", codes[x], (x % 16) == 15 || x == len + 1 ? "\n" : "");
+        }
+        return len + 2;
+    }
+    for (y = 0; y < c->y_size; y++) {
+        printf("   ");
+        for (x = 0; x < columns; x++) {
+            if (a4) {
+                b = (uint8_t)(((a8[y * c->x_size + 2 * x] * 15 + 127) / 255) << 4);
+                if (2 * x + 1 < c->x_size) {
+                    b |= (uint8_t)((a8[y * c->x_size + 2 * x + 1] * 15 + 127) / 255);
+                }
+            } else {
+                b = a8[y * c->x_size + x];
+            }
+            printf(" 0x%02X,", b);
+        }
+        printf("\n");
+    }
+    return columns * c->y_size;
+}
+
+int
+main(int argc, char** argv) {
+    const gui_font_t* font = &FONT_SUBSET_FONT;
+    const gui_font_char_t* c;
+    const char* name = STR(FONT_SUBSET_FONT) "_Subset";
+    static uint8_t buff[0x100 * 0x100];
+    uint8_t a4 = 0, rle = 0;
+    uint32_t ch, first = 0, last = 0, count = 0, ranges = 0, kerns = 0, start, i;
+    size_t offset = 0, size_src = 0, n;
+    size_t* sizes;
+    int arg;
+
+    if (font->read != NULL) {
+        fprintf(stderr, "font_subset: font with external storage is not supported\n");
+        return 1;
+    }
+    if (font->flags & GUI_FLAG_FONT_RLE) {
+        fprintf(stderr, "font_subset: compressed source font is not supported\n");
+        return 1;
+    }
+
+    /* Size of all source characters */
+    n = font->ranges != NULL ? 0 : (size_t)font->endchar - font->startchar + 1;
+    for (i = 0; font->ranges != NULL && i < font->range_count; i++) {
+        n = GUI_MAX(n, (size_t)font->ranges[i].index + font->ranges[i].count);
+    }
+    while (n--) {
+        size_src += char_datasize(font, &font->data[n]);
+    }
+
+    /* Collect used characters */
+    mark_char('?');
+    for (arg = 1; arg < argc; arg++) {
+        if (!strcmp(argv[arg], "-a4")) {
+            a4 = 1;
+        } else if (!strcmp(argv[arg], "-rle")) {
+            rle = 1;
+        } else if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+            name = argv[++arg];
+        } else if (!strcmp(argv[arg], "-c") && arg + 1 < argc) {
+            arg++;
+            mark_string((const uint8_t *)argv[arg], strlen(argv[arg]));
+        } else if (!scan_file(argv[arg])) {
+            return 1;
+        }
+    }
+    for (i = 0; langs[i] != NULL; i++) {
+        size_t k;
+        for (k = 0; k < langs[i]->count; k++) {
+            if (langs[i]->entries[k] != NULL) {
+                mark_string(langs[i]->entries[k], strlen((const char *)langs[i]->entries[k]));
+            }
+        }
+    }
+    for (ch = 0; ch < CH_MAX; ch++) {               /* Keep only characters existing in font */
+        if (CH_ISUSED(ch) && (c = font_find(font, ch)) != NULL) {
+            if (!count) {
+                first = ch;
+            }
+            last = ch;
+            count++;
+        } else {
+            used[ch >> 3] &= ~(1 << (ch & 0x07));
+        }
+    }
+
+    printf("#include \"gui/gui.h\"\n\n");
+    printf("/* Generated by font_subset from %s, %lu characters */\n\n", STR(FONT_SUBSET_FONT), (unsigned long)count);
+
+    /* Character data, compressed size is known only after it is written */
+    sizes = calloc((size_t)count + 1, sizeof(*sizes));
+    if (sizes == NULL) {
+        fprintf(stderr, "font_subset: out of memory\n");
+        return 1;
+    }
+    printf("gui_const uint8_t %s_Atlas[] = {\n", name);
+    for (ch = first, i = 0; count && ch <= last; ch++) {
+        if (CH_ISUSED(ch)) {
+            c = font_find(font, ch);
+            if ((c->x_size && c->y_size) || rle) {
+                printf("    /* U+%04lX */\n", (unsigned long)ch);
+                char_to_a8(font, c, buff);
+                sizes[i] = write_char(c, buff, a4, rle);
+            }
+            i++;
+        }
+    }
+    printf("};\n\n");
+
+    /* Character table in order of codes */
+    printf("gui_const gui_font_char_t %s_CharTable[] = {\n", name);
+    for (ch = first, i = 0; count && ch <= last; ch++) {
+        if (CH_ISUSED(ch)) {
+            c = font_find(font, ch);
+            printf("    {%4u, %4u, %2u, %4u, %4u, &%s_Atlas[%lu]},\n",
+                c->x_size, c->y_size, c->x_pos, c->y_pos, c->x_margin, name, (unsigned long)offset);
+            offset += sizes[i++];
+        }
+    }
+    printf("};\n\n");
+    free(sizes);
+
+    /* Sorted ranges of consecutive characters */
+    printf("gui_const gui_font_range_t %s_Ranges[] = {\n", name);
+    for (ch = first, i = 0; count && ch <= last; ch++) {
+        if (CH_ISUSED(ch)) {
+            for (start = ch; ch + 1 <= last && CH_ISUSED(ch + 1); ch++) {}
+            printf("    {0x%04lX, %4lu, %4lu},\n", (unsigned long)start, (unsigned long)(ch - start + 1), (unsigned long)i);
+            i += ch - start + 1;
+            ranges++;
+        }
+    }
+    printf("};\n\n");
+
+    /* Advance of characters, when source font has it */
+    if (font->advance != NULL) {
+        printf("gui_const uint8_t %s_Advance[] = {\n   ", name);
+        for (ch = first; count && ch <= last; ch++) {
+            if (CH_ISUSED(ch)) {
+                printf(" %u,", font->advance[font_find(font, ch) - font->data]);
+            }
+        }
+        printf("\n};\n\n");
+    }
+    if (font->advance64 != NULL) {
+        printf("gui_const uint16_t %s_Advance64[] = {\n   ", name);
+        for (ch = first; count && ch <= last; ch++) {
+            if (CH_ISUSED(ch)) {
+                printf(" %u,", font->advance64[font_find(font, ch) - font->data]);
+            }
+        }
+        printf("\n};\n\n");
+    }
+
+    /* Kerning pairs of included characters, source order is kept sorted */
+    for (i = 0; i < font->kerning_count; i++) {
+        if (CH_ISUSED(font->kerning[i].left) && CH_ISUSED(font->kerning[i].right)) {
+            if (!kerns++) {
+                printf("gui_const gui_font_kern_t %s_Kerning[] = {\n", name);
+            }
+            printf("    {0x%04X, 0x%04X, %d},\n", font->kerning[i].left, font->kerning[i].right, font->kerning[i].value);
+        }
+    }
+    if (kerns) {
+        printf("};\n\n");
+    }
+
+    printf("gui_const gui_font_t %s = {\n", name);
+    printf("    _GT(\"%s\"),\n", (const char *)font->name);
+    printf("    %u,\n", font->size);
+    printf("    0x%02lX,\n", (unsigned long)(first & 0xFFFF));
+    printf("    0x%02lX,\n", (unsigned long)(last & 0xFFFF));
+    printf("    %s", a4 ? "GUI_FLAG_FONT_A4" : "GUI_FLAG_FONT_A8");
+    if (rle) {
+        printf(" | GUI_FLAG_FONT_RLE");
+    }
+    if (font->flags & GUI_FLAG_FONT_LCD) {
+        printf(" | GUI_FLAG_FONT_LCD");
+    }
+    if (font->flags & ~(GUI_FLAG_FONT_AA | GUI_FLAG_FONT_A8 | GUI_FLAG_FONT_A4 | GUI_FLAG_FONT_LCD)) {
+        printf(" | 0x%02X", font->flags & ~(GUI_FLAG_FONT_AA | GUI_FLAG_FONT_A8 | GUI_FLAG_FONT_A4 | GUI_FLAG_FONT_LCD));
+    }
+    printf(",\n");
+    printf("    %s_CharTable,\n", name);
+    if (font->advance != NULL) {
+        printf("    %s_Advance,\n", name);
+    } else {
+        printf("    NULL,\n");
+    }
+    if (kerns) {
+        printf("    %s_Kerning,\n", name);
+    } else {
+        printf("    NULL,\n");
+    }
+    printf("    %lu,\n", (unsigned long)kerns);
+    printf("    %s_Ranges,\n", name);
+    printf("    %lu,\n", (unsigned long)ranges);
+    printf("    NULL,\n");
+    printf("    NULL,\n");
+    if (font->advance64 != NULL) {
+        printf("    %s_Advance64,\n", name);
+    } else {
+        printf("    NULL,\n");
+    }
+    printf("};\n");
+
+    fprintf(stderr, "font_subset: %lu characters in %lu ranges, %lu bytes of data from %lu source bytes\n",
+        (unsigned long)count, (unsigned long)ranges, (unsigned long)offset, (unsigned long)size_src);
+    if (missing) {
+        fprintf(stderr, "font_subset: %lu used characters are not in source font\n", (unsigned long)missing);
+    }
+    return 0;
+}
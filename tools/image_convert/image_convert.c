@@ -0,0 +1,270 @@
+/**	
+ * \file            image_convert.c
+ * \brief           Host tool to convert images to raw image descriptors
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+
+
+/*
+ * Tool is compiled and run on host and writes C source of raw memory mapped image
+ * in pixel format used by low-level drawing functions, ready to be used with \ref gui_draw_image.
+ *
+ * Input is binary `PPM` (`P6`) or `PAM` (`P7`) file with `RGB` or `RGB_ALPHA` tuples of `8` bits,
+ * which can be exported by most image editors or converted with `netpbm` or `ImageMagick`.
+ *
+ * Image without transparent pixels gets \ref GUI_FLAG_IMAGE_OPAQUE flag,
+ * low-level drivers then copy it without reading and blending destination.
+ *
+ *  gcc tools/image_convert/image_convert.c -o image_convert
+ *  ./image_convert [-b bpp] [-p] [-a align] [-n name] image.pam > image.c
+ *
+ *  -b:     Bits per pixel of output, `16`, `24` or `32`. `32` is used for images with alpha, `24` otherwise
+ *  -p:     Premultiply color components of `32BPP` image with alpha, see \ref GUI_FLAG_IMAGE_PREMULTIPLIED
+ *  -a:     Align start of image and each row to given number of bytes for burst access, `1` by default
+ *  -n:     Name of generated image descriptor, `image` by default
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * \brief           Read next header token of `PPM` file, comments are skipped
+ * \param[in]       f: Input file
+ * \param[out]      tok: Output buffer for token
+ * \param[in]       size: Size of output buffer
+ * \return          `1` on success, `0` otherwise
+ */
+static int
+read_token(FILE* f, char* tok, size_t size) {
+    size_t len = 0;
+    int c;
+
+    while ((c = fgetc(f)) != EOF) {
+        if (c == '#') {                             /* Comment until end of line */
+            while ((c = fgetc(f)) != EOF && c != '\n') {}
+        } else if (c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+            break;
+        }
+    }
+    while (c != EOF && c != ' ' && c != '\t' && c != '\r' && c != '\n') {
+        if (len + 1 < size) {
+            tok[len++] = (char)c;
+        }
+        c = fgetc(f);
+    }
+    tok[len] = '\0';
+    return len > 0;
+}
+
+/**
+ * \brief           Read `PPM` or `PAM` image to `RGBA` buffer
+ * \param[in]       path: File path
+ * \param[out]      width: Image width
+ * \param[out]      height: Image height
+ * \return          Pointer to `4` bytes per pixel in order `R, G, B, A` with `A = 255` for opaque pixel,
+ *                      `NULL` on failure
+ */
+static unsigned char *
+read_image(const char* path, long* width, long* height) {
+    char tok[64];
+    long maxval = 0, depth = 0, i;
+    unsigned char* rgba = NULL;
+    FILE* f;
+
+    *width = *height = 0;
+    if ((f = fopen(path, "rb")) == NULL) {
+        fprintf(stderr, "image_convert: cannot open %s\n", path);
+        return NULL;
+    }
+    if (!read_token(f, tok, sizeof(tok))) {
+        goto fail;
+    }
+    if (!strcmp(tok, "P6")) {
+        depth = 3;
+        if (read_token(f, tok, sizeof(tok))) {
+            *width = atol(tok);
+        }
+        if (read_token(f, tok, sizeof(tok))) {
+            *height = atol(tok);
+        }
+        if (read_token(f, tok, sizeof(tok))) {      /* Single white space after max value is consumed */
+            maxval = atol(tok);
+        }
+    } else if (!strcmp(tok, "P7")) {
+        while (read_token(f, tok, sizeof(tok)) && strcmp(tok, "ENDHDR")) {
+            if (!strcmp(tok, "WIDTH") && read_token(f, tok, sizeof(tok))) {
+                *width = atol(tok);
+            } else if (!strcmp(tok, "HEIGHT") && read_token(f, tok, sizeof(tok))) {
+                *height = atol(tok);
+            } else if (!strcmp(tok, "DEPTH") && read_token(f, tok, sizeof(tok))) {
+                depth = atol(tok);
+            } else if (!strcmp(tok, "MAXVAL") && read_token(f, tok, sizeof(tok))) {
+                maxval = atol(tok);
+            }
+        }
+    }
+    if (*width <= 0 || *height <= 0 || *width > 0x7FFF || *height > 0x7FFF
+        || maxval != 255 || (depth != 3 && depth != 4)) {
+        fprintf(stderr, "image_convert: %s is not 8-bit RGB or RGB_ALPHA PPM/PAM image\n", path);
+        goto fail;
+    }
+    if ((rgba = malloc((size_t)*width * (size_t)*height * 4)) == NULL) {
+        goto fail;
+    }
+    for (i = 0; i < *width * *height; i++) {
+        rgba[4 * i + 3] = 0xFF;
+        if (fread(&rgba[4 * i], (size_t)depth, 1, f) != 1) {
+            fprintf(stderr, "image_convert: %s is truncated\n", path);
+            free(rgba);
+            rgba = NULL;
+            break;
+        }
+    }
+fail:
+    fclose(f);
+    return rgba;
+}
+
+int
+main(int argc, char** argv) {
+    const char* name = "image";
+    const char* path = NULL;
+    unsigned char* rgba;
+    unsigned char px[4];
+    long width, height, stride, align = 1, bpp = 0, bytes, x, y, n = 0;
+    int premul = 0, opaque = 1, arg;
+    unsigned r, g, b, a;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (!strcmp(argv[arg], "-b") && arg + 1 < argc) {
+            bpp = atol(argv[++arg]);
+        } else if (!strcmp(argv[arg], "-p")) {
+            premul = 1;
+        } else if (!strcmp(argv[arg], "-a") && arg + 1 < argc) {
+            align = atol(argv[++arg]);
+        } else if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+            name = argv[++arg];
+        } else {
+            path = argv[arg];
+        }
+    }
+    if (path == NULL || (bpp && bpp != 16 && bpp != 24 && bpp != 32) || align < 1 || (align & (align - 1))) {
+        fprintf(stderr, "usage: image_convert [-b 16|24|32] [-p] [-a align] [-n name] image.pam\n");
+        return 1;
+    }
+    if ((rgba = read_image(path, &width, &height)) == NULL) {
+        return 1;
+    }
+    for (x = 0; x < width * height; x++) {
+        if (rgba[4 * x + 3] != 0xFF) {
+            opaque = 0;
+            break;
+        }
+    }
+    if (!bpp) {
+        bpp = opaque ? 24 : 32;
+    } else if (bpp != 32 && !opaque) {
+        fprintf(stderr, "image_convert: alpha channel is dropped for %ldBPP output\n", bpp);
+    }
+    opaque = opaque || bpp != 32;                   /* Alpha is not stored */
+    premul = premul && bpp == 32 && !opaque;        /* Premultiplied and straight colors are the same when opaque */
+
+    /* Smallest row length in pixels, which keeps each row start aligned */
+    bytes = bpp / 8;
+    for (stride = width; (stride * bytes) % align; stride++) {}
+
+    printf("#include \"gui/gui.h\"\n\n");
+    printf("/* Generated by image_convert from %s, %ldx%ld pixels */\n\n", path, width, height);
+    if (align > 1) {
+        printf("#if defined(__GNUC__) || defined(__clang__) || defined(__CC_ARM)\n");
+        printf("__attribute__((aligned(%ld)))\n", align);
+        printf("#endif\n");
+    }
+    printf("gui_const uint8_t %s_Data[] = {\n", name);
+    for (y = 0; y < height; y++) {
+        for (x = 0; x < stride; x++) {
+            if (x < width) {
+                memcpy(px, &rgba[4 * (y * width + x)], sizeof(px));
+            } else {
+                memset(px, 0x00, sizeof(px));       /* Row padding is never drawn */
+            }
+            r = px[0], g = px[1], b = px[2], a = px[3];
+            if (premul) {
+                r = (r * a + 127) / 255;
+                g = (g * a + 127) / 255;
+                b = (b * a + 127) / 255;
+            }
+            if (!(n % 16)) {
+                printf("   ");
+            }
+            if (bpp == 16) {                        /* Red in low bits, stored little endian */
+                unsigned v = ((b >> 3) << 11) | ((g >> 2) << 5) | (r >> 3);
+                printf(" 0x%02X, 0x%02X,", v & 0xFF, v >> 8);
+            } else if (bpp == 24) {
+                printf(" 0x%02X, 0x%02X, 0x%02X,", r, g, b);
+            } else {                                /* Alpha is inverted, `0` is opaque */
+                printf(" 0x%02X, 0x%02X, 0x%02X, 0x%02X,", r, g, b, 0xFF - a);
+            }
+            if (!(++n % 16)) {
+                printf("\n");
+            }
+        }
+    }
+    if (n % 16) {
+        printf("\n");
+    }
+    printf("};\n\n");
+
+    printf("gui_const gui_image_desc_t %s = {\n", name);
+    printf("    %ld,\n", width);
+    printf("    %ld,\n", height);
+    printf("    %ld,\n", bpp);
+    printf("    %s_Data,\n", name);
+    printf("    GUI_IMAGE_COMPRESSION_NONE,\n");
+    printf("    NULL,\n");
+    printf("    0,\n");
+    printf("    0,\n");
+    printf("    NULL,\n");
+    printf("    NULL,\n");
+    printf("    sizeof(%s_Data),\n", name);
+    if (opaque || premul) {
+        printf("    %s,\n", opaque ? "GUI_FLAG_IMAGE_OPAQUE" : "GUI_FLAG_IMAGE_PREMULTIPLIED");
+    } else {
+        printf("    0,\n");
+    }
+    printf("    %ld,\n", stride == width ? 0 : stride);
+    printf("};\n");
+
+    fprintf(stderr, "image_convert: %ldx%ld pixels, %ldBPP, %s, row stride %ld bytes\n",
+        width, height, bpp, opaque ? "opaque" : premul ? "premultiplied alpha" : "alpha", stride * bytes);
+    free(rgba);
+    return 0;
+}
@@ -0,0 +1,278 @@
+/**	
+ * \file            remote_view.c
+ * \brief           Host tool to view remote display stream and inject touch
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+
+
+/*
+ * Tool is compiled and run on host. It decodes stream written by \ref gui_remote_start transport
+ * from standard input and writes screen to binary `PPM` file after each batch.
+ * Transport is connected with usual tools, for example `nc device 5000 | ./remote_view -o screen.ppm`
+ * or `./remote_view -o screen.ppm < /dev/ttyACM0`.
+ *
+ * With `-t`, `-d`, `-u` or `-f`, tool instead writes packets for \ref gui_remote_receive to standard output.
+ *
+ *  gcc tools/remote_view/remote_view.c -o remote_view
+ *  ./remote_view [-o screen.ppm] < stream
+ *  ./remote_view -t x y | -d x y | -u | -f > transport
+ *
+ *  -o:     Output image, rewritten after each batch, `screen.ppm` by default
+ *  -t:     Touch press and release at position
+ *  -d:     Touch press or move at position, touch stays pressed
+ *  -u:     Touch release
+ *  -f:     Request entire screen
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Stream format, same values as in `gui_remote.h` */
+#define REMOTE_SYNC_0               0xA5
+#define REMOTE_SYNC_1               0x5A
+#define REMOTE_CHUNK_FIRST          0x80
+#define REMOTE_CHUNK_LAST           0x40
+#define REMOTE_CHUNK_SEQ            0x3F
+#define REMOTE_PKT_FRAME            0x01
+#define REMOTE_PKT_RECT             0x02
+#define REMOTE_PKT_END              0x03
+#define REMOTE_PKT_RECT_RAW         0x04
+#define REMOTE_PKT_TOUCH            0x10
+#define REMOTE_PKT_REFRESH          0x11
+
+static unsigned char* screen;                       /* `RGB` pixels of screen, `3` bytes each */
+static long screen_w, screen_h;
+static unsigned char* batch;                        /* Payload of chunks of current batch */
+static size_t batch_len, batch_pos, batch_size;
+
+/**
+ * \brief           Read byte of batch payload
+ * \return          Byte value or `EOF` at the end of payload
+ */
+static int
+get8(void) {
+    return batch_pos < batch_len ? batch[batch_pos++] : EOF;
+}
+
+/**
+ * \brief           Read `16-bit` little endian value of batch payload
+ * \param[out]      val: Output value
+ * \return          `1` on success, `0` otherwise
+ */
+static int
+get16(long* val) {
+    int lo = get8(), hi = get8();
+
+    if (lo == EOF || hi == EOF) {
+        return 0;
+    }
+    *val = lo | (hi << 8);
+    return 1;
+}
+
+/**
+ * \brief           Decode rectangle with `RGB565` pixels to screen
+ * \param[in]       raw: Set to `1` when pixels are not run-length encoded
+ * \return          `1` on success, `0` when batch is broken
+ */
+static int
+read_rect(int raw) {
+    long x, y, w, h, i, n, px = 0, pos = 0;
+    int c, rep;
+    unsigned char* p;
+
+    if (!get16(&x) || !get16(&y) || !get16(&w) || !get16(&h)
+        || x + w > screen_w || y + h > screen_h) {
+        return 0;
+    }
+    while (pos < w * h) {
+        if (raw) {
+            rep = 0;
+            n = 1;
+        } else if ((c = get8()) == EOF) {
+            return 0;
+        } else {
+            rep = c & 0x80;
+            n = (c & 0x7F) + 1;
+        }
+        for (i = 0; i < n && pos < w * h; i++, pos++) {
+            if ((!rep || !i) && !get16(&px)) {
+                return 0;
+            }
+            p = &screen[3 * ((y + pos / w) * screen_w + x + pos % w)];
+            p[0] = (unsigned char)(((px >> 8) & 0xF8) | ((px >> 13) & 0x07));
+            p[1] = (unsigned char)(((px >> 3) & 0xFC) | ((px >> 9) & 0x03));
+            p[2] = (unsigned char)(((px << 3) & 0xF8) | ((px >> 2) & 0x07));
+        }
+    }
+    return 1;
+}
+
+/**
+ * \brief           Decode complete batch to screen
+ * \param[out]      frame: Frame number of batch
+ * \return          `1` on success, `0` when batch is broken
+ */
+static int
+read_batch(unsigned long* frame) {
+    long w, h, lo, hi;
+    int c;
+
+    batch_pos = 0;
+    if (get8() != REMOTE_PKT_FRAME || !get16(&w) || !get16(&h) || !get16(&lo) || !get16(&hi)) {
+        return 0;
+    }
+    *frame = (unsigned long)lo | ((unsigned long)hi << 16);
+    if (w != screen_w || h != screen_h) {           /* Screen is cleared when size changes */
+        free(screen);
+        screen_w = w;
+        screen_h = h;
+        if ((screen = calloc((size_t)(w * h), 3)) == NULL) {
+            exit(1);
+        }
+    }
+    while ((c = get8()) == REMOTE_PKT_RECT || c == REMOTE_PKT_RECT_RAW) {
+        if (!read_rect(c == REMOTE_PKT_RECT_RAW)) {
+            return 0;
+        }
+    }
+    return c == REMOTE_PKT_END;
+}
+/**
+ * \brief           Write screen to binary `PPM` file
+ * \param[in]       path: File path
+ * \return          `1` on success, `0` otherwise
+ */
+static int
+write_screen(const char* path) {
+    FILE* f;
+    int ok;
+
+    if ((f = fopen(path, "wb")) == NULL) {
+        fprintf(stderr, "remote_view: cannot open %s\n", path);
+        return 0;
+    }
+    fprintf(f, "P6\n%ld %ld\n255\n", screen_w, screen_h);
+    ok = fwrite(screen, 3, (size_t)(screen_w * screen_h), f) == (size_t)(screen_w * screen_h);
+    fclose(f);
+    return ok;
+}
+
+/**
+ * \brief           Write touch packet for device
+ * \param[in]       pressed: Set to `1` for pressed touch
+ * \param[in]       x: X position
+ * \param[in]       y: Y position
+ */
+static void
+write_touch(int pressed, long x, long y) {
+    unsigned char pkt[6];
+
+    pkt[0] = REMOTE_PKT_TOUCH;
+    pkt[1] = (unsigned char)pressed;
+    pkt[2] = (unsigned char)x;
+    pkt[3] = (unsigned char)(x >> 8);
+    pkt[4] = (unsigned char)y;
+    pkt[5] = (unsigned char)(y >> 8);
+    fwrite(pkt, sizeof(pkt), 1, stdout);
+}
+
+int
+main(int argc, char** argv) {
+    const char* path = "screen.ppm";
+    unsigned long frame = 0;
+    size_t len;
+    int c, prev = EOF, arg, ok = 0, flags, lo, hi, seq = 0;
+
+    for (arg = 1; arg < argc; arg++) {
+        if (!strcmp(argv[arg], "-o") && arg + 1 < argc) {
+            path = argv[++arg];
+        } else if ((!strcmp(argv[arg], "-t") || !strcmp(argv[arg], "-d")) && arg + 2 < argc) {
+            write_touch(1, atol(argv[arg + 1]), atol(argv[arg + 2]));
+            if (argv[arg][1] == 't') {
+                write_touch(0, atol(argv[arg + 1]), atol(argv[arg + 2]));
+            }
+            return 0;
+        } else if (!strcmp(argv[arg], "-u")) {
+            write_touch(0, 0, 0);
+            return 0;
+        } else if (!strcmp(argv[arg], "-f")) {
+            putchar(REMOTE_PKT_REFRESH);
+            return 0;
+        } else {
+            fprintf(stderr, "usage: remote_view [-o screen.ppm] < stream\n");
+            fprintf(stderr, "       remote_view -t x y | -d x y | -u | -f > transport\n");
+            return 1;
+        }
+    }
+
+    /* Chunks are joined to batch, batch with missing chunk is dropped */
+    while ((c = getchar()) != EOF) {
+        if (prev != REMOTE_SYNC_0 || c != REMOTE_SYNC_1) {
+            prev = c;
+            continue;
+        }
+        prev = EOF;
+        if ((flags = getchar()) == EOF || (lo = getchar()) == EOF || (hi = getchar()) == EOF) {
+            break;
+        }
+        len = (size_t)lo | ((size_t)hi << 8);
+        if (flags & REMOTE_CHUNK_FIRST) {
+            batch_len = 0;
+            ok = 1;
+        } else if ((flags & REMOTE_CHUNK_SEQ) != seq) {
+            ok = 0;                                 /* Chunk was lost, wait for next batch */
+        }
+        seq = (flags + 1) & REMOTE_CHUNK_SEQ;
+        if (batch_len + len > batch_size) {
+            batch_size = 2 * (batch_len + len);
+            if ((batch = realloc(batch, batch_size)) == NULL) {
+                return 1;
+            }
+        }
+        if (fread(&batch[batch_len], 1, len, stdin) != len) {
+            break;
+        }
+        batch_len += len;
+        if (ok && (flags & REMOTE_CHUNK_LAST)) {
+            ok = 0;
+            if (read_batch(&frame)) {
+                write_screen(path);
+                fprintf(stderr, "remote_view: frame %lu\n", frame);
+            } else {
+                fprintf(stderr, "remote_view: broken batch\n");
+            }
+        }
+    }
+    free(batch);
+    free(screen);
+    return 0;
+}